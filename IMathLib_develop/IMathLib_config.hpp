@@ -7,6 +7,45 @@
 #include <intrin.h>
 #include <cstdint>
 
+
+//配列演算で利用するSIMD命令セットの選択(IMATH_SIMD_DISABLEの定義で無効化)
+#if !defined IMATH_SIMD_DISABLE
+#if defined __AVX2__
+#define IMATH_SIMD_AVX2
+#endif
+#if defined __AVX__ || defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#define IMATH_SIMD_SSE2
+#endif
+#endif
+
+//FMA命令の有無(コンパイラが乗算と加算を縮約し得るため, IMATH_SIMD_DISABLEに関わらず判定する)
+#if defined __FMA__ || (defined _MSC_VER && defined __AVX2__)
+#define IMATH_FMA
+#endif
+
+//乗算と加算の縮約の無効化(誤差なし変換を用いるカーネルの範囲を囲み, スカラーと配列演算の結果を一致させる)
+#if defined __clang__
+#define IMATH_FP_CONTRACT_OFF_PUSH _Pragma("float_control(push)") _Pragma("STDC FP_CONTRACT OFF")
+#define IMATH_FP_CONTRACT_POP _Pragma("float_control(pop)")
+#elif defined __GNUC__ && defined IMATH_FMA
+//(GCCではoptimizeの異なる関数がインライン展開されないため, 縮約が起こり得るFMA命令の利用時のみ指定する)
+#define IMATH_FP_CONTRACT_OFF_PUSH _Pragma("GCC push_options") _Pragma("GCC optimize(\"fp-contract=off\")")
+#define IMATH_FP_CONTRACT_POP _Pragma("GCC pop_options")
+#elif defined _MSC_VER
+#define IMATH_FP_CONTRACT_OFF_PUSH __pragma(float_control(push)) __pragma(fp_contract(off))
+#define IMATH_FP_CONTRACT_POP __pragma(float_control(pop))
+#else
+#define IMATH_FP_CONTRACT_OFF_PUSH
+#define IMATH_FP_CONTRACT_POP
+#endif
+
+//定数評価中であるかの判定(利用できない処理系では常に定数評価の経路を用いる)
+#if (defined _MSC_VER && _MSC_VER >= 1925) || (defined __clang__ && __clang_major__ >= 9) || (!defined __clang__ && defined __GNUC__ && __GNUC__ >= 9)
+#define IMATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define IMATH_IS_CONSTANT_EVALUATED() true
+#endif
+
 namespace iml {
 
 	//ライブラリ内部で用いるべきビット長ごとの型定義
@@ -213,9 +213,9 @@ namespace iml {
 	class allocator {
 	public:
 		constexpr allocator() noexcept {}
-		constexpr allocator(allocator& alloc) noexcept {}
+		constexpr allocator(const allocator& alloc) noexcept {}
 		template <class U>
-		constexpr allocator(allocator<U>& alloc) noexcept {}
+		constexpr allocator(const allocator<U>& alloc) noexcept {}
 		~allocator() {}
 
 		using value_type = T;
@@ -239,6 +239,107 @@ namespace iml {
 	bool operator!=(const allocator<T>&, const allocator<U>&) { return false; }
 
 
+	//  アリーナ(確保したブロックの先頭から順に切り出し, 解放は破棄時またはreset()でまとめて行う)
+	//  寿命の揃った一時オブジェクトの確保をヒープの管理から切り離すために用いる
+	class arena {
+		struct block {
+			block*	next;
+			size_t	size;						//  データ部のバイト数
+		};
+		block*	head_m;
+		char*	cur_m;							//  先頭ブロックの未使用領域
+		char*	end_m;
+		size_t	block_size_m;
+
+		static char* data(block* b) { return reinterpret_cast<char*>(b) + ((sizeof(block) + 15) & ~size_t(15)); }
+		static char* align_up(char* p, size_t align) {
+			return reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(p) + (align - 1)) & ~std::uintptr_t(align - 1));
+		}
+		//  n バイト以上のブロックを先頭に追加
+		void add_block(size_t n) {
+			size_t size = (n > block_size_m) ? n : block_size_m;
+			block* b = static_cast<block*>(::operator new(((sizeof(block) + 15) & ~size_t(15)) + size));
+			b->next = head_m;
+			b->size = size;
+			head_m = b;
+			cur_m = data(b);
+			end_m = cur_m + size;
+		}
+	public:
+		explicit arena(size_t block_size = 65536) : head_m(nullptr), cur_m(nullptr), end_m(nullptr), block_size_m(block_size) {}
+		arena(const arena&) = delete;
+		~arena() { reset(); }
+
+		arena& operator=(const arena&) = delete;
+
+		//  メモリ確保(alignは2のべき乗で16以下)
+		[[nodiscard]] void* allocate(size_t bytes, size_t align = 16) {
+			char* p = align_up(cur_m, align);
+			if (cur_m == nullptr || p + bytes > end_m) {
+				add_block(bytes);
+				p = cur_m;
+			}
+			cur_m = p + bytes;
+			return p;
+		}
+		//  メモリ解放(直前に確保した領域であれば巻き戻し, それ以外は何もしない)
+		void deallocate(void* p, size_t bytes) {
+			if (static_cast<char*>(p) + bytes == cur_m) cur_m = static_cast<char*>(p);
+		}
+		//  全てのブロックを解放
+		void reset() {
+			while (head_m != nullptr) {
+				block* next = head_m->next;
+				::operator delete(static_cast<void*>(head_m));
+				head_m = next;
+			}
+			cur_m = end_m = nullptr;
+		}
+	};
+
+	//  アリーナを用いるアロケータ(アリーナが指定されていなければallocatorと同様にヒープから確保する)
+	template <class T>
+	class arena_allocator {
+		template <class> friend class arena_allocator;
+
+		arena*	arena_m;
+	public:
+		constexpr arena_allocator() noexcept : arena_m(nullptr) {}
+		constexpr arena_allocator(arena& a) noexcept : arena_m(addressof(a)) {}
+		constexpr arena_allocator(const arena_allocator& alloc) noexcept : arena_m(alloc.arena_m) {}
+		template <class U>
+		constexpr arena_allocator(const arena_allocator<U>& alloc) noexcept : arena_m(alloc.arena_m) {}
+		~arena_allocator() {}
+
+		using value_type = T;
+		using pointer = T * ;
+
+		template <class Other>
+		struct rebind {
+			using other = arena_allocator<Other>;
+		};
+		template <class Other>
+		using rebind_t = arena_allocator<Other>;
+
+		[[nodiscard]] pointer allocate(size_t n) {
+			if (arena_m == nullptr) return static_cast<pointer>(::operator new(n * sizeof(value_type)));
+			return static_cast<pointer>(arena_m->allocate(n * sizeof(value_type), alignof(value_type)));
+		}
+		void deallocate(pointer p, size_t n) {
+			if (arena_m == nullptr) ::operator delete(static_cast<void*>(p));
+			else arena_m->deallocate(static_cast<void*>(p), n * sizeof(value_type));
+		}
+		//  コピー構築されたコンテナも同一のアリーナを用いる
+		arena_allocator select_on_container_copy_construction() const { return *this; }
+
+		arena* get_arena() const noexcept { return arena_m; }
+	};
+	template <class T, class U>
+	bool operator==(const arena_allocator<T>& a, const arena_allocator<U>& b) { return a.get_arena() == b.get_arena(); }
+	template <class T, class U>
+	bool operator!=(const arena_allocator<T>& a, const arena_allocator<U>& b) { return !(a == b); }
+
+
 	//  リソースの破棄条件をdeallocator_baseを通して共通化する
 	namespace dealloc {
 		static constexpr size_t variable = 0;				//  newで確保されたインスタンスに対してdeleteをする
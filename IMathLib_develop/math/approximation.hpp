@@ -0,0 +1,393 @@
+﻿#ifndef IMATH_MATH_APPROXIMATION_HPP
+#define IMATH_MATH_APPROXIMATION_HPP
+
+#include "IMathLib/math/math.hpp"
+#include <ostream>
+#include <string>
+#include <vector>
+
+//関数の多項式・有理関数近似
+//Chebyshev級数の打ち切りかRemez法による最良近似の係数をconstexprに求め, Estrin法で評価する
+//係数はt = (x - center)scale ∈ [-1, 1]のべき乗に対するもので, write_approximationで係数表と評価関数のコードを出力できる
+
+namespace iml {
+
+	//Estrin法による多項式 Σ[i < N] c[i]t^i の評価
+	template <size_t N>
+	struct Estrin {
+		template <class T, class S>
+		static constexpr S _estrin_(const T* c, const S& t) {
+			S p[(N + 1) / 2] = {};
+			for (size_t i = 0; i < N / 2; ++i) p[i] = S(c[2 * i]) + S(c[2 * i + 1]) * t;
+			if (N & 1) p[N / 2] = S(c[N - 1]);
+			//t^(2^k)で隣り合う項をまとめる
+			S u = t * t;
+			for (size_t n = (N + 1) / 2; n > 1; n = (n + 1) / 2) {
+				for (size_t i = 0; i < n / 2; ++i) p[i] = p[2 * i] + p[2 * i + 1] * u;
+				if (n & 1) p[n / 2] = p[n - 1];
+				if (n > 2) u = u * u;
+			}
+			return p[0];
+		}
+	};
+	template <>
+	struct Estrin<0> {
+		template <class T, class S>
+		static constexpr S _estrin_(const T*, const S&) { return S(0); }
+	};
+
+
+	//[a, b]でのN次多項式近似 Σ[i <= N] c[i]t^i
+	template <class T, size_t N>
+	struct polynomial_approximation {
+		T a, b, center, scale;
+		T c[N + 1];
+		T error;				//最大誤差の推定値
+
+		template <class S>
+		constexpr S operator()(const S& x) const {
+			return Estrin<N + 1>::_estrin_(c, S((x - S(center)) * S(scale)));
+		}
+	};
+	//[a, b]での有理関数近似 Σ[i <= N] p[i]t^i / Σ[i <= M] q[i]t^i (q[0] = 1)
+	template <class T, size_t N, size_t M>
+	struct rational_approximation {
+		T a, b, center, scale;
+		T p[N + 1], q[M + 1];
+		T error;				//最大誤差の推定値
+
+		template <class S>
+		constexpr S operator()(const S& x) const {
+			S t = (x - S(center)) * S(scale);
+			return Estrin<N + 1>::_estrin_(p, t) / Estrin<M + 1>::_estrin_(q, t);
+		}
+	};
+
+
+	//g(t) = f(center + half t)のK点の補間によるChebyshev係数c[0], ..., c[K - 1]
+	template <size_t K, class F, class T>
+	inline constexpr void __chebyshev_coefficients(F& f, const T& center, const T& half, T* c) {
+		//T[j](x[k]) = cos(πj(2k + 1)/2K)は漸化式では誤差が蓄積するのでcos(πm/2K)の表から引く
+		T w[4 * K] = {}, y[K] = {};
+		for (size_t m = 0; m < 4 * K; ++m) w[m] = T(cos(pi<T> * m / (2 * K)));
+		for (size_t k = 0; k < K; ++k) y[k] = T(f(center + half * w[2 * k + 1]));
+		for (size_t j = 0; j < K; ++j) {
+			T sum = 0;
+			for (size_t k = 0; k < K; ++k) sum += y[k] * w[j * (2 * k + 1) % (4 * K)];
+			c[j] = sum * 2 / K;
+		}
+		c[0] /= 2;
+	}
+	//Chebyshev級数 Σ[j <= N] ch[j]T[j](t) のべき級数の係数
+	template <size_t N, class T>
+	inline constexpr void __chebyshev_to_monomial(const T* ch, T* c) {
+		T t0[N + 1] = {}, t1[N + 1] = {};
+		for (size_t i = 0; i <= N; ++i) c[i] = 0;
+		t0[0] = 1;
+		c[0] = ch[0];
+		if (N == 0) return;
+		t1[1] = 1;
+		c[1] = ch[1];
+		for (size_t j = 2; j <= N; ++j) {
+			//T[j] = 2tT[j - 1] - T[j - 2]をt0に上書きする
+			for (size_t i = j; i > 0; --i) t0[i] = 2 * t1[i - 1] - t0[i];
+			t0[0] = -t0[0];
+			for (size_t i = 0; i <= j; ++i) c[i] += ch[j] * t0[i];
+			for (size_t i = 0; i <= j; ++i) {
+				T temp = t0[i];
+				t0[i] = t1[i];
+				t1[i] = temp;
+			}
+		}
+	}
+
+
+	//Chebyshev級数の打ち切りによる[a, b]でのN次多項式近似
+	template <size_t N, class F, class T>
+	inline constexpr auto chebyshev_approximation(F f, const T& a, const T& b) {
+		using result_type = typename math_function_type<T>::type;
+		//次数の2倍の点数で求めて打ち切った項を誤差とする
+		constexpr size_t K = 2 * (N + 1);
+
+		polynomial_approximation<result_type, N> result = {};
+		result.a = a; result.b = b;
+		result.center = result_type(a + b) / 2;
+		result_type half = result_type(b - a) / 2;
+		result.scale = 1 / half;
+
+		result_type ch[K] = {};
+		__chebyshev_coefficients<K>(f, result.center, half, ch);
+		for (size_t j = N + 1; j < K; ++j) result.error += abs(ch[j]);
+		__chebyshev_to_monomial<N>(ch, result.c);
+		return result;
+	}
+
+	//[a, b]でのChebyshev近似の誤差がtolerance以下となる最小の次数(127次まで)
+	template <class F, class T, class S>
+	inline constexpr size_t chebyshev_degree(F f, const T& a, const T& b, const S& tolerance) {
+		using result_type = typename math_function_type<T>::type;
+		constexpr size_t K = 128;
+
+		result_type ch[K] = {};
+		__chebyshev_coefficients<K>(f, result_type(a + b) / 2, result_type(b - a) / 2, ch);
+		//打ち切り誤差は係数の減衰を考慮して2max[j > n]|c[j]|で見積もる(単純な和は丸め誤差の項を累積する)
+		for (size_t n = K - 1; n > 0; --n)
+			if (2 * abs(ch[n]) > tolerance) return n;
+		return 0;
+	}
+
+
+	//Remez法による[-1, 1]でのN/M次有理関数の最良近似(係数はChebyshev基底でq[0] = 1)
+	template <size_t N, size_t M, class T, class F>
+	struct Remez {
+		static constexpr size_t K = N + M + 2;
+		static constexpr size_t L = (N > M) ? N : M;
+
+		F& f;
+		T center, half;
+		T x[K];					//参照点
+		T p[N + 1], q[M + 1];
+		T deviation;			//連立方程式の解の偏差
+		T level;				//参照点での|誤差|の最大値
+
+		constexpr Remez(F& f, const T& center, const T& half) : f(f), center(center), half(half), x{}, p{}, q{}, deviation(0), level(0) {
+			//初期の参照点はChebyshev多項式の極値
+			for (size_t i = 0; i < K; ++i) x[i] = -T(cos(pi<T> * i / (K - 1)));
+			q[0] = 1;
+		}
+
+		static constexpr void chebyshev(const T& t, T* tn) {
+			tn[0] = 1;
+			if (L > 0) tn[1] = t;
+			for (size_t j = 2; j <= L; ++j) tn[j] = 2 * t * tn[j - 1] - tn[j - 2];
+		}
+		constexpr T g(const T& t) const { return T(f(center + half * t)); }
+		constexpr T approximation(const T& t) const {
+			T tn[L + 1] = {}, num = 0, den = 0;
+			chebyshev(t, tn);
+			for (size_t j = 0; j <= N; ++j) num += p[j] * tn[j];
+			for (size_t j = 0; j <= M; ++j) den += q[j] * tn[j];
+			return num / den;
+		}
+		constexpr T error(const T& t) const { return g(t) - approximation(t); }
+
+		//参照点で g - p/q = ±level となる係数を求める(有理関数のときは偏差を固定して反復する)
+		constexpr void solve() {
+			T y[K] = {};
+			for (size_t i = 0; i < K; ++i) y[i] = g(x[i]);
+			T e = deviation;
+			for (size_t iter = 0; iter < ((M == 0) ? 1 : 16); ++iter) {
+				T m[K][K + 1] = {};
+				for (size_t i = 0; i < K; ++i) {
+					T tn[L + 1] = {}, s = (i & 1) ? -1 : 1;
+					chebyshev(x[i], tn);
+					for (size_t j = 0; j <= N; ++j) m[i][j] = tn[j];
+					for (size_t j = 1; j <= M; ++j) m[i][N + j] = -(y[i] - s * e) * tn[j];
+					m[i][K - 1] = s;
+					m[i][K] = y[i];
+				}
+				//部分ピボット選択付きGaussの消去法
+				for (size_t j = 0; j < K; ++j) {
+					size_t r = j;
+					for (size_t i = j + 1; i < K; ++i) if (abs(m[i][j]) > abs(m[r][j])) r = i;
+					for (size_t k = 0; k <= K; ++k) {
+						T temp = m[j][k];
+						m[j][k] = m[r][k];
+						m[r][k] = temp;
+					}
+					for (size_t i = j + 1; i < K; ++i) {
+						T c = m[i][j] / m[j][j];
+						for (size_t k = j; k <= K; ++k) m[i][k] -= c * m[j][k];
+					}
+				}
+				T z[K] = {};
+				for (size_t i = K; i-- > 0;) {
+					T sum = m[i][K];
+					for (size_t k = i + 1; k < K; ++k) sum -= m[i][k] * z[k];
+					z[i] = sum / m[i][i];
+				}
+				for (size_t j = 0; j <= N; ++j) p[j] = z[j];
+				for (size_t j = 1; j <= M; ++j) q[j] = z[N + j];
+				bool converged = abs(z[K - 1] - e) <= numeric_traits<T>::epsilon() * abs(z[K - 1]);
+				e = z[K - 1];
+				if (converged) break;
+			}
+			deviation = e;
+		}
+
+		//誤差の符号が一定な各区間で|誤差|が最大となる点を新たな参照点とする
+		//戻り値は新たな参照点での|誤差|の最大値と最小値の比
+		constexpr T exchange() {
+			T z[K + 1] = {};
+			z[0] = -1; z[K] = 1;
+			for (size_t i = 0; i + 1 < K; ++i) {
+				//誤差の零点を二分法で求める
+				T l = x[i], r = x[i + 1], el = error(l);
+				for (size_t iter = 0; iter < 64 && r - l > numeric_traits<T>::epsilon() * 4; ++iter) {
+					T c = (l + r) / 2, ec = error(c);
+					if ((ec < 0) == (el < 0)) l = c, el = ec;
+					else r = c;
+				}
+				z[i + 1] = (l + r) / 2;
+			}
+			T emax = 0, emin = numeric_traits<T>::max();
+			for (size_t i = 0; i < K; ++i) {
+				T s = (error(x[i]) < 0) ? -1 : 1;
+				//標本点から最大の点を選んで黄金分割法で精密化する
+				constexpr size_t samples = 8;
+				T best = x[i], ebest = s * error(x[i]);
+				for (size_t k = 0; k <= samples; ++k) {
+					T t = z[i] + (z[i + 1] - z[i]) * k / samples, et = s * error(t);
+					if (et > ebest) best = t, ebest = et;
+				}
+				T l = best - (z[i + 1] - z[i]) / samples, r = best + (z[i + 1] - z[i]) / samples;
+				if (l < z[i]) l = z[i];
+				if (r > z[i + 1]) r = z[i + 1];
+				const T phi = T(0.6180339887498948482);
+				T c1 = r - phi * (r - l), c2 = l + phi * (r - l), e1 = s * error(c1), e2 = s * error(c2);
+				for (size_t iter = 0; iter < 48 && r - l > numeric_traits<T>::epsilon() * 4; ++iter) {
+					if (e1 < e2) {
+						l = c1; c1 = c2; e1 = e2;
+						c2 = l + phi * (r - l); e2 = s * error(c2);
+					}
+					else {
+						r = c2; c2 = c1; e2 = e1;
+						c1 = r - phi * (r - l); e1 = s * error(c1);
+					}
+				}
+				if (e1 > ebest) best = c1, ebest = e1;
+				if (e2 > ebest) best = c2, ebest = e2;
+				x[i] = best;
+				if (ebest > emax) emax = ebest;
+				if (ebest < emin) emin = ebest;
+			}
+			level = emax;
+			return (emin > 0) ? emax / emin : numeric_traits<T>::max();
+		}
+
+		constexpr void run(size_t iterations) {
+			for (size_t iter = 0; iter < iterations; ++iter) {
+				solve();
+				//偏差が揃えば収束
+				if (exchange() - 1 <= T(1e-6)) break;
+			}
+		}
+	};
+
+	//Remez法による[a, b]でのN次多項式の最良近似
+	template <size_t N, class F, class T>
+	inline constexpr auto minimax_polynomial(F f, const T& a, const T& b, size_t iterations = 32) {
+		using result_type = typename math_function_type<T>::type;
+
+		polynomial_approximation<result_type, N> result = {};
+		result.a = a; result.b = b;
+		result.center = result_type(a + b) / 2;
+		result_type half = result_type(b - a) / 2;
+		result.scale = 1 / half;
+
+		Remez<N, 0, result_type, F> remez(f, result.center, half);
+		remez.run(iterations);
+		result.error = remez.level;
+		__chebyshev_to_monomial<N>(remez.p, result.c);
+		return result;
+	}
+	//Remez法による[a, b]でのN/M次有理関数の最良近似
+	template <size_t N, size_t M, class F, class T>
+	inline constexpr auto minimax_rational(F f, const T& a, const T& b, size_t iterations = 32) {
+		using result_type = typename math_function_type<T>::type;
+
+		rational_approximation<result_type, N, M> result = {};
+		result.a = a; result.b = b;
+		result.center = result_type(a + b) / 2;
+		result_type half = result_type(b - a) / 2;
+		result.scale = 1 / half;
+
+		Remez<N, M, result_type, F> remez(f, result.center, half);
+		remez.run(iterations);
+		result.error = remez.level;
+		__chebyshev_to_monomial<N>(remez.p, result.p);
+		__chebyshev_to_monomial<M>(remez.q, result.q);
+		//分母の定数項を1に正規化
+		result_type q0 = result.q[0];
+		for (size_t i = 0; i <= N; ++i) result.p[i] /= q0;
+		for (size_t i = 0; i <= M; ++i) result.q[i] /= q0;
+		return result;
+	}
+
+
+	//近似の[a, b]での最大誤差(n + 1個の等分点で計測, relativeならば相対誤差)
+	template <class F, class Approximation>
+	inline constexpr auto approximation_error(F f, const Approximation& p, size_t n = 1000, bool relative = false) {
+		using result_type = decltype(p.error);
+
+		result_type result = 0;
+		for (size_t i = 0; i <= n; ++i) {
+			result_type x = p.a + (p.b - p.a) * i / n, y = result_type(f(x));
+			result_type e = abs(y - p(x));
+			if (relative && y != 0) e /= abs(y);
+			if (e > result) result = e;
+		}
+		return result;
+	}
+
+
+	//Σ[i < n] c[i]t^i をEstrin法で評価する式(t^(2^k)はt2, t4, ...とする)
+	inline std::string __estrin_expression(size_t n, const char* c) {
+		if (n == 0) return "0";
+		std::vector<std::string> p((n + 1) / 2);
+		for (size_t i = 0; i < n / 2; ++i)
+			p[i] = "(" + std::string(c) + "[" + std::to_string(2 * i) + "] + " + c + "[" + std::to_string(2 * i + 1) + "] * t)";
+		if (n & 1) p[n / 2] = std::string(c) + "[" + std::to_string(n - 1) + "]";
+		size_t power = 2;
+		for (size_t m = (n + 1) / 2; m > 1; m = (m + 1) / 2, power *= 2) {
+			for (size_t i = 0; i < m / 2; ++i) p[i] = "(" + p[2 * i] + " + " + p[2 * i + 1] + " * t" + std::to_string(power) + ")";
+			if (m & 1) p[m / 2] = p[m - 1];
+		}
+		return p[0];
+	}
+	//Estrin法で用いるt^(2^k)の宣言
+	inline std::string __estrin_powers(size_t n, const char* type) {
+		std::string result;
+		size_t power = 2;
+		for (size_t m = (n + 1) / 2; m > 1; m = (m + 1) / 2, power *= 2) {
+			result += std::string("\tconst ") + type + " t" + std::to_string(power) + " = "
+				+ ((power == 2) ? std::string("t") : "t" + std::to_string(power / 2)) + " * "
+				+ ((power == 2) ? std::string("t") : "t" + std::to_string(power / 2)) + ";\n";
+		}
+		return result;
+	}
+	template <class T>
+	inline void __write_coefficients(std::ostream& os, const char* type, const char* name, const T* c, size_t n) {
+		os << "\tconstexpr " << type << ' ' << name << '[' << n << "] = {";
+		for (size_t i = 0; i < n; ++i) os << ((i == 0) ? " " : ", ") << c[i];
+		os << " };\n";
+	}
+
+	//近似の係数表とEstrin法による評価関数のコードを出力
+	template <class T, size_t N>
+	inline void write_approximation(std::ostream& os, const char* name, const polynomial_approximation<T, N>& p, const char* type = "double") {
+		std::streamsize precision = os.precision(numeric_traits<T>::digits10 + 2);
+		os << "//[" << p.a << ", " << p.b << "]での" << N << "次多項式近似(最大誤差 " << p.error << ")\n";
+		os << "inline " << type << ' ' << name << '(' << type << " x) {\n";
+		__write_coefficients(os, type, "c", p.c, N + 1);
+		os << "\tconst " << type << " t = (x - " << p.center << ") * " << p.scale << ";\n";
+		os << __estrin_powers(N + 1, type);
+		os << "\treturn " << __estrin_expression(N + 1, "c") << ";\n}\n";
+		os.precision(precision);
+	}
+	template <class T, size_t N, size_t M>
+	inline void write_approximation(std::ostream& os, const char* name, const rational_approximation<T, N, M>& r, const char* type = "double") {
+		std::streamsize precision = os.precision(numeric_traits<T>::digits10 + 2);
+		os << "//[" << r.a << ", " << r.b << "]での" << N << '/' << M << "次有理関数近似(最大誤差 " << r.error << ")\n";
+		os << "inline " << type << ' ' << name << '(' << type << " x) {\n";
+		__write_coefficients(os, type, "p", r.p, N + 1);
+		__write_coefficients(os, type, "q", r.q, M + 1);
+		os << "\tconst " << type << " t = (x - " << r.center << ") * " << r.scale << ";\n";
+		os << __estrin_powers((N > M) ? N + 1 : M + 1, type);
+		os << "\treturn " << __estrin_expression(N + 1, "p") << "\n\t\t/ " << __estrin_expression(M + 1, "q") << ";\n}\n";
+		os.precision(precision);
+	}
+}
+
+
+#endif
\ No newline at end of file
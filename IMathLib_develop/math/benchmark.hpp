@@ -0,0 +1,222 @@
+﻿#ifndef IMATH_MATH_BENCHMARK_HPP
+#define IMATH_MATH_BENCHMARK_HPP
+
+#include "IMathLib/IMathLib_config.hpp"
+#include "IMathLib/utility/utility/bit_cast.hpp"
+#include "IMathLib/utility/timer.hpp"
+#include <vector>
+#include <string>
+#include <ostream>
+
+//数学関数の精度と速度の計測
+//精度は高精度の参照値(double-double)の表とのULP誤差, 速度はスカラー呼び出しと配列演算の1要素あたりの時間で評価する
+//(参照値の表は多倍長浮動小数点数などにより乱数の点列で生成するか, 事前に計算した値を用いる)
+
+namespace iml {
+	namespace bench {
+
+		//参照値(引数x, yとhi + loで表した関数値)
+		struct reference_value {
+			double x, y;
+			double hi, lo;
+		};
+
+
+		//Tにおける|x|の1ulp(doubleで表す)
+		inline double ulp_of(float x) {
+			int_t e = int_t((bit_cast<uint32_t>(x) >> 23) & 0xFF);
+			//非正規化数は2^-149
+			return bit_cast<double>(uint64_t(((e < 1) ? 1 : e) - 150 + 1023) << 52);
+		}
+		inline double ulp_of(double x) {
+			int_t e = int_t((bit_cast<uint64_t>(x) >> 52) & 0x7FF);
+			//2^(e - 1075)が非正規化数となる範囲はビットで直接表す
+			if (e <= 52) return bit_cast<double>(uint64_t(1) << ((e < 1) ? 0 : e - 1));
+			return bit_cast<double>(uint64_t(e - 52) << 52);
+		}
+		//参照値hi + loに対するvalueのULP誤差(非有限値は一致すれば0, 一致しなければ無限大)
+		template <class T>
+		inline double ulp_error(T value, double hi, double lo) {
+			const double inf = bit_cast<double>(0x7FF0000000000000ull);
+			T ref = static_cast<T>(hi);
+			if (!(ref - ref == 0) || !(value - value == 0)) {
+				if (value == ref || (value != value && ref != ref)) return 0;
+				return inf;
+			}
+			double d = (double(value) - hi) - lo;
+			return ((d < 0) ? -d : d) / ulp_of(ref);
+		}
+
+
+		//精度の測定結果
+		struct accuracy_result {
+			double max_ulp = 0, mean_ulp = 0;
+			double worst_x = 0, worst_y = 0;		//最大誤差となる引数
+			size_t count = 0;
+		};
+		//f(x, y)の参照値に対する誤差
+		template <class T, class F>
+		inline accuracy_result measure_accuracy(F f, const reference_value* first, const reference_value* last) {
+			accuracy_result result;
+			double sum = 0;
+			for (; first != last; ++first, ++result.count) {
+				double e = ulp_error<T>(f(static_cast<T>(first->x), static_cast<T>(first->y)), first->hi, first->lo);
+				sum += e;
+				if (!(e <= result.max_ulp)) {
+					result.max_ulp = e;
+					result.worst_x = first->x;
+					result.worst_y = first->y;
+				}
+			}
+			if (result.count != 0) result.mean_ulp = sum / result.count;
+			return result;
+		}
+
+
+		//速度の測定結果
+		struct throughput_result {
+			double ns_per_element = 0;
+			double elements_per_second = 0;
+			size_t count = 0;
+		};
+		//最適化による呼び出しの除去を防ぐ
+		template <class T>
+		inline void do_not_optimize(const T& x) {
+			static volatile T sink;
+			sink = x;
+		}
+		//f(x[i], y[i])をrepeat回ずつ呼び出す
+		template <class T, class F>
+		inline throughput_result measure_scalar(F f, const T* x, const T* y, size_t n, size_t repeat) {
+			timer<std::chrono::nanoseconds> t;
+			T acc = 0;
+			t.start();
+			for (size_t r = 0; r < repeat; ++r)
+				for (size_t i = 0; i < n; ++i) acc += f(x[i], y[i]);
+			long long ns = t.now_time();
+			do_not_optimize(acc);
+
+			throughput_result result;
+			result.count = n * repeat;
+			result.ns_per_element = double(ns) / result.count;
+			result.elements_per_second = (ns > 0) ? 1e9 * result.count / ns : 0;
+			return result;
+		}
+		//配列演算f(x, x + n, y, out)をrepeat回呼び出す
+		template <class T, class F>
+		inline throughput_result measure_array(F f, const T* x, const T* y, T* out, size_t n, size_t repeat) {
+			timer<std::chrono::nanoseconds> t;
+			t.start();
+			for (size_t r = 0; r < repeat; ++r) {
+				f(x, x + n, y, out);
+				do_not_optimize(out[r % n]);
+			}
+			long long ns = t.now_time();
+
+			throughput_result result;
+			result.count = n * repeat;
+			result.ns_per_element = double(ns) / result.count;
+			result.elements_per_second = (ns > 0) ? 1e9 * result.count / ns : 0;
+			return result;
+		}
+
+
+		//正規化数x > 0に対する区分線形なlog2(指数部 + 仮数部 - 1)
+		inline double __piecewise_log2(double x) {
+			uint64_t bits = bit_cast<uint64_t>(x);
+			return double(int_t((bits >> 52) & 0x7FF) - 1023) + (bit_cast<double>((bits & 0x000FFFFFFFFFFFFFull) | 0x3FF0000000000000ull) - 1);
+		}
+		//[a, b]上の再現性のある擬似乱数の点列(logarithmicならば対数的に分布させる)
+		template <class T>
+		inline std::vector<T> sweep(double a, double b, size_t n, bool logarithmic = false, uint64_t seed = 0x9E3779B97F4A7C15ull) {
+			std::vector<T> result(n);
+			double la = 0, lb = 0;
+			if (logarithmic) {
+				//log2の近似はその逆写像2^ie * (1 + (e - ie))と組にすれば端点a, bが正確に対応する
+				la = __piecewise_log2(a);
+				lb = __piecewise_log2(b);
+			}
+			for (size_t i = 0; i < n; ++i) {
+				//xorshift64*
+				seed ^= seed >> 12; seed ^= seed << 25; seed ^= seed >> 27;
+				double u = double((seed * 0x2545F4914F6CDD1Dull) >> 11) * (1. / 9007199254740992.);
+				if (logarithmic) {
+					double e = la + (lb - la) * u;
+					int_t ie = int_t(e);
+					if (e < ie) --ie;
+					//2^ie * (1 + (e - ie))
+					result[i] = static_cast<T>(bit_cast<double>(uint64_t(ie + 1023) << 52) * (1 + (e - ie)));
+				}
+				else result[i] = static_cast<T>(a + (b - a) * u);
+			}
+			return result;
+		}
+
+
+		//1つの関数の計測結果
+		struct entry {
+			std::string name;			//関数名
+			std::string type;			//引数の型
+			std::string domain;			//速度計測の定義域
+			accuracy_result accuracy;
+			throughput_result scalar;
+			throughput_result array;
+		};
+
+		//計測結果の集計と出力
+		class report {
+			std::vector<entry> entries_m;
+
+			static void write_number(std::ostream& os, double x) {
+				//JSONでは非有限値を表現できないため文字列とする
+				if (x - x == 0) os << x;
+				else os << "\"" << ((x != x) ? "nan" : "inf") << "\"";
+			}
+			static void write_string(std::ostream& os, const std::string& str) {
+				os << '"';
+				for (char c : str) {
+					if (c == '"' || c == '\\') os << '\\';
+					os << c;
+				}
+				os << '"';
+			}
+		public:
+			void add(const entry& e) { entries_m.push_back(e); }
+			const std::vector<entry>& entries() const { return entries_m; }
+
+			//CSV形式で出力
+			void write_csv(std::ostream& os) const {
+				os << "name,type,domain,max_ulp,mean_ulp,worst_x,worst_y,reference_count,scalar_ns,array_ns,array_elements_per_second\n";
+				for (const entry& e : entries_m) {
+					os << e.name << ',' << e.type << ",\"" << e.domain << "\","
+						<< e.accuracy.max_ulp << ',' << e.accuracy.mean_ulp << ','
+						<< e.accuracy.worst_x << ',' << e.accuracy.worst_y << ',' << e.accuracy.count << ','
+						<< e.scalar.ns_per_element << ',' << e.array.ns_per_element << ',' << e.array.elements_per_second << '\n';
+				}
+			}
+			//JSON形式で出力
+			void write_json(std::ostream& os) const {
+				os << "[\n";
+				for (size_t i = 0; i < entries_m.size(); ++i) {
+					const entry& e = entries_m[i];
+					os << "  {\"name\": "; write_string(os, e.name);
+					os << ", \"type\": "; write_string(os, e.type);
+					os << ", \"domain\": "; write_string(os, e.domain);
+					os << ", \"max_ulp\": "; write_number(os, e.accuracy.max_ulp);
+					os << ", \"mean_ulp\": "; write_number(os, e.accuracy.mean_ulp);
+					os << ", \"worst_x\": "; write_number(os, e.accuracy.worst_x);
+					os << ", \"worst_y\": "; write_number(os, e.accuracy.worst_y);
+					os << ", \"reference_count\": " << e.accuracy.count;
+					os << ", \"scalar_ns\": "; write_number(os, e.scalar.ns_per_element);
+					os << ", \"array_ns\": "; write_number(os, e.array.ns_per_element);
+					os << ", \"array_elements_per_second\": "; write_number(os, e.array.elements_per_second);
+					os << ((i + 1 == entries_m.size()) ? "}\n" : "},\n");
+				}
+				os << "]\n";
+			}
+		};
+	}
+}
+
+
+#endif
\ No newline at end of file
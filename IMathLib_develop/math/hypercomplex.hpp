@@ -9,6 +9,7 @@
 #include "IMathLib/math/hypercomplex/exp.hpp"
 #include "IMathLib/math/hypercomplex/octonion.hpp"
 #include "IMathLib/math/hypercomplex/quaternion.hpp"
+#include "IMathLib/math/hypercomplex/riemann_zeta.hpp"
 #include "IMathLib/math/hypercomplex/split_complex.hpp"
 
 
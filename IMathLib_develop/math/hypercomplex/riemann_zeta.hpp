@@ -0,0 +1,87 @@
+﻿#ifndef IMATH_MATH_HYPERCOMPLEX_RIEMANN_ZETA_HPP
+#define IMATH_MATH_HYPERCOMPLEX_RIEMANN_ZETA_HPP
+
+#include "IMathLib/math/math.hpp"
+#include "IMathLib/math/hypercomplex/complex.hpp"
+#include "IMathLib/math/hypercomplex/exp.hpp"
+
+
+namespace iml {
+
+	template <class T>
+	struct Dirichlet_eta<complex<T>> {
+		using value_type = typename math_function_type<T>::type;
+		using result_type = complex<value_type>;
+		using table = eta_coefficient_table<borwein_terms(numeric_traits<value_type>::digits), value_type>;
+
+		//Borweinの加速級数(|Im s|が大きいときは項数が不足する)
+		static constexpr result_type _dirichlet_eta_(const complex<T>& s, false_type) {
+			constexpr size_t n = borwein_terms(numeric_traits<value_type>::digits);
+			result_type result(0, 0);
+			for (size_t k = n; k-- > 0;) result += table::c[k] * exp(-s * log(value_type(k + 1)));
+			return result;
+		}
+		static result_type _kernel_(const complex<T>& s) {
+			value_type r = 0, i = 0;
+			Zeta_kernel<value_type>::_dirichlet_eta_(s[0], s[1], r, i);
+			return result_type(r, i);
+		}
+		//実行時はBorweinの加速級数とEuler-Maclaurinの公式を使い分けるカーネルで計算
+		static constexpr result_type _dirichlet_eta_(const complex<T>& s, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _dirichlet_eta_(s, false_type()) : _kernel_(s);
+		}
+		static constexpr result_type _dirichlet_eta_(const complex<T>& s) {
+			return _dirichlet_eta_(s, is_elementary_kernel_type<value_type>());
+		}
+	};
+
+	template <class T>
+	struct Riemann_zeta<complex<T>> {
+		using value_type = typename math_function_type<T>::type;
+		using result_type = complex<value_type>;
+
+		static constexpr result_type _riemann_zeta_(const complex<T>& s, false_type) {
+			return dirichlet_eta(s) / (1 - exp((1 - s) * log(value_type(2))));
+		}
+		static result_type _kernel_(const complex<T>& s) {
+			value_type r = 0, i = 0;
+			Zeta_kernel<value_type>::_riemann_zeta_(s[0], s[1], r, i);
+			return result_type(r, i);
+		}
+		static constexpr result_type _riemann_zeta_(const complex<T>& s, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _riemann_zeta_(s, false_type()) : _kernel_(s);
+		}
+		static constexpr result_type _riemann_zeta_(const complex<T>& s) {
+			return _riemann_zeta_(s, is_elementary_kernel_type<value_type>());
+		}
+	};
+
+
+	//直線上の点s + j ds (0 <= j < n)に対するリーマンのゼータ関数
+	template <class T, class OutputIterator>
+	inline OutputIterator _riemann_zeta_line_(const complex<T>& s, const complex<T>& ds, size_t n, OutputIterator result, false_type) {
+		using value_type = typename math_function_type<T>::type;
+		for (size_t j = 0; j < n; ++j, ++result)
+			*result = riemann_zeta(complex<value_type>(s[0] + value_type(j) * ds[0], s[1] + value_type(j) * ds[1]));
+		return result;
+	}
+	//line_segment点ずつカーネルで評価する(カーネルはline_anchor点ごとに(k + 1)^-sを求め直し, その間は(k + 1)^-dsの乗算で更新する)
+	template <class T, class OutputIterator>
+	inline OutputIterator _riemann_zeta_line_(const complex<T>& s, const complex<T>& ds, size_t n, OutputIterator result, true_type) {
+		using value_type = typename math_function_type<T>::type;
+		constexpr size_t segment = Zeta_kernel<value_type>::line_segment;
+		value_type zr[segment], zi[segment];
+		for (size_t first = 0; first < n; first += segment) {
+			size_t count = (n - first < segment) ? n - first : segment;
+			Zeta_kernel<value_type>::_riemann_zeta_line_(s[0], s[1], ds[0], ds[1], first, count, zr, zi);
+			for (size_t j = 0; j < count; ++j, ++result) *result = complex<value_type>(zr[j], zi[j]);
+		}
+		return result;
+	}
+	template <class T, class OutputIterator>
+	inline OutputIterator riemann_zeta_line(const complex<T>& s, const complex<T>& ds, size_t n, OutputIterator result) {
+		return _riemann_zeta_line_(s, ds, n, result, is_elementary_kernel_type<typename math_function_type<T>::type>());
+	}
+}
+
+#endif
\ No newline at end of file
@@ -7,17 +7,22 @@
 #include "IMathLib/math/math/bernoulli_number.hpp"
 #include "IMathLib/math/math/beta.hpp"
 #include "IMathLib/math/math/binom.hpp"
+#include "IMathLib/math/math/catalan.hpp"
+#include "IMathLib/math/math/combinatorics.hpp"
 #include "IMathLib/math/math/conj.hpp"
 #include "IMathLib/math/math/dirichlet_eta.hpp"
 #include "IMathLib/math/math/e.hpp"
+#include "IMathLib/math/math/elementary_kernel.hpp"
 #include "IMathLib/math/math/elliptic_int.hpp"
 #include "IMathLib/math/math/erf.hpp"
+#include "IMathLib/math/math/erf_kernel.hpp"
 #include "IMathLib/math/math/exp.hpp"
 #include "IMathLib/math/math/exp_int.hpp"
 #include "IMathLib/math/math/factorial.hpp"
 #include "IMathLib/math/math/fresnel_int.hpp"
 #include "IMathLib/math/math/frexp.hpp"
 #include "IMathLib/math/math/gamma.hpp"
+#include "IMathLib/math/math/gamma_kernel.hpp"
 #include "IMathLib/math/math/hypabolic_function.hpp"
 #include "IMathLib/math/math/ihypabolic_function.hpp"
 #include "IMathLib/math/math/imag.hpp"
@@ -37,12 +42,16 @@
 #include "IMathLib/math/math/pow.hpp"
 #include "IMathLib/math/math/real.hpp"
 #include "IMathLib/math/math/riemann_zeta.hpp"
+#include "IMathLib/math/math/rounding_kernel.hpp"
 #include "IMathLib/math/math/sgn.hpp"
+#include "IMathLib/math/math/simd_type.hpp"
 #include "IMathLib/math/math/sqrt.hpp"
 #include "IMathLib/math/math/stirling_number.hpp"
 #include "IMathLib/math/math/trigonometric_int.hpp"
 #include "IMathLib/math/math/trigonometric_function.hpp"
 #include "IMathLib/math/math/type_parameter.hpp"
+#include "IMathLib/math/math/vectorized.hpp"
+#include "IMathLib/math/math/zeta_kernel.hpp"
 
 
 
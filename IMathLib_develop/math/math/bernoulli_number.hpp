@@ -7,46 +7,110 @@
 #include "IMathLib/math/math/trigonometric_function.hpp"
 #include "IMathLib/math/math/pi.hpp"
 #include "IMathLib/utility/tuple.hpp"
+#include <vector>
+#include <mutex>
 
 
 namespace iml {
 
-	//ベルヌーイ数のテーブル
+	//正接数T[k](tan x = Σ T[k] x^(2k - 1)/(2k - 1)!)をt[1], ..., t[n]に求める(Brent-Harveyの方法, O(n^2))
+	//t[k]にはT[k]r^kを格納する(浮動小数点数ではr = 1/16としてB[2k]より先に溢れることを防ぎ, 整数ではr = 1とする)
+	//加算のみで構成されるため浮動小数点数でも誤差が蓄積しない
+	//j = kの項は係数0を掛けずに扱う(溢れたt[k - 1] = ∞との積がNaNとなり, 溢れたB[2k]が±∞にならないため)
+	template <class T>
+	inline constexpr void __tangent_numbers(T* t, size_t n, const T& r) {
+		if (n == 0) return;
+		t[1] = r;
+		for (size_t k = 2; k <= n; ++k) t[k] = t[k - 1] * r * T(k - 1);
+		for (size_t k = 2; k <= n; ++k) {
+			t[k] = t[k] * T(2);
+			for (size_t j = k + 1; j <= n; ++j) t[j] = t[j - 1] * r * T(j - k) + t[j] * T(j - k + 2);
+		}
+	}
+	//B[2k] = (-1)^(k - 1) 2k T[k] / (4^k(4^k - 1)) = (-1)^(k - 1) 2k t[k] / (1 - 4^-k)によりb[0], ..., b[n - 1]を求める
+	//(tはr = 1/16の正接数, 奇数番目は0で初期化されているものとする)
+	template <class T>
+	inline constexpr void __bernoulli_numbers(T* b, const T* t, size_t n) {
+		if (n > 0) b[0] = 1;
+		if (n > 1) b[1] = T(-1) / 2;
+		T p = 1;
+		for (size_t k = 1; 2 * k < n; ++k) {
+			p /= 4;
+			T x = T(2 * k) * t[k] / (1 - p);
+			b[2 * k] = (k & 1) ? x : -x;
+		}
+	}
+
+	//コンパイル時のベルヌーイ数列(全体をO(N^2)で一度だけ生成する)
+	template <size_t N, class T>
+	struct Bernoulli_number_sequence {
+		T b[N];
+		T t[N / 2 + 1];
+		constexpr Bernoulli_number_sequence() : b{}, t{} {
+			__tangent_numbers(t, (N - 1) / 2, T(1) / 16);
+			__bernoulli_numbers(b, t, N);
+		}
+	};
+	template <size_t N, class T>
+	inline constexpr Bernoulli_number_sequence<N, T> bernoulli_number_sequence{};
+
+	//ベルヌーイ数のテーブル(b[0], ..., b[N - 1])
 	template <size_t, class, class>
 	struct Bernoulli_number_table;
 	template <size_t N, class T, size_t... Indices>
 	struct Bernoulli_number_table<N, T, index_tuple<size_t, Indices...>> {
 		using result_type = typename math_function_type<T>::type;
 
-		static constexpr result_type __bernoulli_number(size_t n) {
-			result_type bn[N + 1] = {};
-			result_type x1 = 0, x2 = 0;
-			
-			if (n == 1) return -0.5;
-			else if ((n & 1) == 1) return 0;			//1でない奇数のときは0
-			else if (n == 0) return 1;
-
-			bn[0] = 1; bn[1] = -0.5;
-			for (size_t i = 2; i <= n; ++i) {
-				//奇数なら次の計算
-				if ((i & 1) == 1) continue;
-				//奇数項が0であることを考慮
-				x1 = 1;
-				x2 = bn[0] + (i + 1)*bn[1];
-				for (size_t j = 2; j <= i - 1; j += 2) {
-					x1 *= result_type(i + 2 - j) / j * (i + 2 - (j - 1)) / (j - 1);
-					x2 += x1 * bn[j];
-				}
-				bn[i] = -x2 / (i + 1);
-			}
-			return bn[n];
-		}
-
-		static constexpr result_type b[N] = { __bernoulli_number(Indices)... };
+		static constexpr result_type b[N] = { bernoulli_number_sequence<N, result_type>.b[Indices]... };
 	};
 	template <size_t N, class T = IMATH_DEFAULT_FLOATING_POINT>
 	struct bernoulli_number_table : Bernoulli_number_table<N, T, typename index_range<size_t, 0, N>::type> {};
 
+
+	//ベルヌーイ数の実行時テーブル(要求された次数を含むように倍々に伸長する)
+	template <class T>
+	class bernoulli_number_cache {
+		std::vector<T> b_m;
+	public:
+		bernoulli_number_cache() : b_m() {}
+		explicit bernoulli_number_cache(size_t n) : b_m() { reserve(n); }
+
+		size_t size() const { return b_m.size(); }
+		//B[n]まで構築
+		void reserve(size_t n) {
+			if (n < b_m.size()) return;
+			size_t m = (n + 1 > 2 * b_m.size()) ? n + 1 : 2 * b_m.size();
+			std::vector<T> t(m / 2 + 1);
+			__tangent_numbers(t.data(), (m - 1) / 2, T(1) / 16);
+			b_m.assign(m, T(0));
+			__bernoulli_numbers(b_m.data(), t.data(), m);
+		}
+		T operator()(size_t n) {
+			reserve(n);
+			return b_m[n];
+		}
+	};
+
+	//B[n] = (-1)^(n/2 + 1) 2 n! ζ(n) / (2π)^n(nが十分大きい偶数のとき, ζ(n)は直接和で速やかに収束する)
+	template <class T>
+	inline constexpr T __bernoulli_number_zeta(size_t n) {
+		T f = 2, z = 1, z0 = 0;
+		for (size_t i = 1; i <= n; ++i) f *= T(i) / (2 * pi<T>);
+		for (size_t k = 2; !error_evaluation(z, z0); ++k) {
+			z0 = z;
+			z += pow(T(k), -T(n));
+		}
+		return ((n & 2) ? f : -f) * z;
+	}
+	//テーブルを超える次数のベルヌーイ数(共有の実行時テーブルを伸長して参照する)
+	template <class T>
+	inline T __bernoulli_number_cached(size_t n) {
+		static bernoulli_number_cache<T> cache;
+		static std::mutex m;
+		std::lock_guard<std::mutex> lock(m);
+		return cache(n);
+	}
+
 	//ベルヌーイ数
 	template <class T>
 	inline constexpr auto bernoulli_number(size_t n) {
@@ -54,24 +118,32 @@ namespace iml {
 
 		if (n == 1) return result_type(-0.5);
 		else if ((n & 1) == 1) return result_type(0);			//1でない奇数のときは0
-		else if (n == 0) return result_type(1);
-
-		//i=1のとき
-		result_type x1 = -1;
-		result_type x2 = 0;
-		for (size_t i = 0; i <= n; ++i) x2 -= result_type(i) / (i + 1);
-
-		for (size_t i = 2; i <= n; ++i) {
-			x1 *= -pow(result_type(i) / (i - 1), n);
-			result_type temp1 = result_type(1) / (i + 1);
-			result_type temp2 = 1;
-			for (size_t j = i + 1; j <= n; ++j) {
-				temp2 /= (1 - result_type(i) / j);
-				temp1 += temp2 / (j + 1);
-			}
-			x2 += x1 * temp1;
+		else if (n < IMATH_BERNOULLI_NUMBER_TABLE) return bernoulli_number_table<IMATH_BERNOULLI_NUMBER_TABLE, result_type>::b[n];
+		return IMATH_IS_CONSTANT_EVALUATED() ? __bernoulli_number_zeta<result_type>(n) : __bernoulli_number_cached<result_type>(n);
+	}
+
+	//ベルヌーイ数の厳密な値B[n] = num/den(denは正であり, 多倍長整数型を用いれば任意の次数で求まる)
+	//分母はvon Staudt-Clausenの定理により(p - 1)がnを割り切る素数pの積となる
+	template <class Integer>
+	inline void bernoulli_number(size_t n, Integer& num, Integer& den) {
+		if (n == 0) { num = Integer(1); den = Integer(1); return; }
+		if (n == 1) { num = Integer(-1); den = Integer(2); return; }
+		if ((n & 1) == 1) { num = Integer(0); den = Integer(1); return; }
+		den = Integer(1);
+		for (size_t d = 1; d <= n; ++d) {
+			if (n % d != 0) continue;
+			size_t p = d + 1, i = 2;
+			for (; i * i <= p; ++i) if (p % i == 0) break;
+			if (i * i > p) den = den * Integer(p);
 		}
-		return x2;
+		size_t k = n / 2;
+		std::vector<Integer> t(k + 1, Integer(0));
+		__tangent_numbers(t.data(), k, Integer(1));
+		//num = (-1)^(k - 1) 2k T[k] den / (4^k(4^k - 1))(割り切れる)
+		Integer p(1);
+		for (size_t i = 0; i < k; ++i) p = p * Integer(4);
+		num = Integer(2 * k) * t[k] * den / (p * (p - Integer(1)));
+		if ((k & 1) == 0) num = -num;
 	}
 
 	//周期ベルヌーイ多項式
@@ -2,17 +2,82 @@
 #define IMATH_MATH_MATH_BINOM_HPP
 
 #include "IMathLib/math/math/math_traits.hpp"
+#include "IMathLib/math/math/factorial.hpp"
 
 
 namespace iml {
 
+	//size_tでオーバーフローしない三角形状の数表の行数
+	//漸化式 T(n + 1, k) = Recurrence::a(n, k)T(n, k) + T(n, k - 1), T(0, 0) = 1 で定まる
+	template <class Recurrence>
+	inline constexpr size_t __combinatorial_triangle_rows() {
+		size_t row[128] = { 1 };
+		for (size_t n = 0; n + 1 < 128; ++n) {
+			for (size_t k = n + 2; k-- > 0;) {
+				size_t a = Recurrence::a(n, k), prev = (k == 0) ? 0 : row[k - 1];
+				if (row[k] != 0 && a > (numeric_traits<size_t>::max)() / row[k]) return n + 1;
+				if (a * row[k] > (numeric_traits<size_t>::max)() - prev) return n + 1;
+				row[k] = a * row[k] + prev;
+			}
+		}
+		return 128;
+	}
+
+	//三角形状の数表(n行目はk = 0, ..., n, コンパイル時に構築)
+	template <class Recurrence>
+	struct Combinatorial_triangle {
+		static constexpr size_t rows = __combinatorial_triangle_rows<Recurrence>();
+
+		size_t c[rows * (rows + 1) / 2];
+
+		constexpr Combinatorial_triangle() : c{} {
+			c[0] = 1;
+			for (size_t n = 0; n + 1 < rows; ++n) {
+				const size_t* p = c + n * (n + 1) / 2;
+				size_t* q = c + (n + 1) * (n + 2) / 2;
+				for (size_t k = 0; k <= n + 1; ++k)
+					q[k] = ((k <= n) ? Recurrence::a(n, k) * p[k] : 0) + ((k == 0) ? 0 : p[k - 1]);
+			}
+		}
+
+		//0 <= k <= n < rows
+		constexpr size_t operator()(size_t n, size_t k) const { return c[n * (n + 1) / 2 + k]; }
+	};
+
+	//Pascalの三角形
+	struct Binomial_recurrence {
+		static constexpr size_t a(size_t, size_t) { return 1; }
+	};
+	template <class Recurrence>
+	inline constexpr Combinatorial_triangle<Recurrence> combinatorial_triangle{};
+	inline constexpr const Combinatorial_triangle<Binomial_recurrence>& binomial_table = combinatorial_triangle<Binomial_recurrence>;
+
+
 	//二項係数
 	inline constexpr auto binom(size_t n, size_t k) {
 		using result_type = typename math_function_type<size_t>::type;
 
+		if (k > n) return result_type(0);
+		if (k > n - k) k = n - k;
+		//size_tで表せる範囲はテーブル参照
+		if (n < binomial_table.rows) return result_type(binomial_table(n, k));
+		if (n < factorial_table.real_fact_size)
+			return result_type(factorial_table.real_fact[n] / (factorial_table.real_fact[k] * factorial_table.real_fact[n - k]));
+
 		result_type result = 1;
-		if (k < (n / 2)) for (size_t i = 1; i <= k; ++i) result *= result_type(n - i + 1) / i;
-		else for (size_t i = 1, end = n - k; i <= end; ++i) result *= result_type(n - i + 1) / i;
+		for (size_t i = 1; i <= k; ++i) result *= result_type(n - i + 1) / i;
+		return result;
+	}
+	//二項係数(Integer型で厳密に計算)
+	template <class Integer>
+	inline constexpr Integer binom(size_t n, size_t k) {
+		if (k > n) return Integer(0);
+		if (k > n - k) k = n - k;
+		if (n < binomial_table.rows) return Integer(binomial_table(n, k));
+
+		//C(n - k + i, i)を順に求めるため各段の除算は割り切れる
+		Integer result = 1;
+		for (size_t i = 1; i <= k; ++i) result = result * Integer(n - k + i) / Integer(i);
 		return result;
 	}
 }
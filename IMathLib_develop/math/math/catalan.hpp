@@ -0,0 +1,31 @@
+﻿#ifndef IMATH_MATH_MATH_CATALAN_HPP
+#define IMATH_MATH_MATH_CATALAN_HPP
+
+#include "IMathLib/math/math/math_traits.hpp"
+
+namespace iml {
+
+	//カタランの定数(G = 1/2 Σ (-8)^k (3k + 2)/((2k + 1)^3 C(2k, k)^3))
+	template <class T>
+	inline constexpr auto _catalan_() -> decltype(real_as_math_constant_t<T>()) {
+		using result_type = real_as_math_constant_t<T>;
+
+		//項の比 -k^3/(2k + 1)^3
+		result_type a = 2, an = 1, b = 0;
+		for (size_t i = 1; !error_evaluation(a, b); ++i) {
+			b = a;
+			result_type k = result_type(i);
+			an *= -k * k * k / ((2 * k + 1) * (2 * k + 1) * (2 * k + 1));
+			a += an * (3 * k + 2);
+		}
+		return b / 2;
+	}
+
+
+	//カタランの定数
+	template <class T>
+	constexpr auto catalan_constant = _catalan_<T>();
+}
+
+
+#endif
\ No newline at end of file
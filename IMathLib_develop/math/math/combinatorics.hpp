@@ -0,0 +1,176 @@
+﻿#ifndef IMATH_MATH_MATH_COMBINATORICS_HPP
+#define IMATH_MATH_MATH_COMBINATORICS_HPP
+
+#include "IMathLib/math/math/math_traits.hpp"
+#include "IMathLib/math/math/factorial.hpp"
+#include "IMathLib/math/math/binom.hpp"
+#include "IMathLib/math/math/stirling_number.hpp"
+#include "IMathLib/math/math/gamma.hpp"
+#include <vector>
+
+//組合せ論の数表
+//size_tに収まる範囲はコンパイル時のテーブル(factorial_table, binomial_table, stirling1_table, stirling2_table)を参照する
+//それを超える範囲は多倍長整数の数表(combinatorial_table)かmod pの数表(modular_combinatorics)を用いる
+
+namespace iml {
+
+	//log(n!)のテーブル
+	template <class T>
+	struct Log_factorial_table {
+		static constexpr size_t size = 256;
+		T x[size];
+		Log_factorial_table() {
+			for (size_t i = 0; i < size; ++i) x[i] = lgamma(T(i + 1));
+		}
+	};
+
+	//log(n!)
+	template <class T = IMATH_DEFAULT_FLOATING_POINT>
+	inline T log_fact(size_t n) {
+		static const Log_factorial_table<T> table;
+		return (n < table.size) ? table.x[n] : T(lgamma(T(n) + 1));
+	}
+	//log(C(n, k))
+	template <class T = IMATH_DEFAULT_FLOATING_POINT>
+	inline T log_binom(size_t n, size_t k) {
+		if (k > n) return numeric_traits<T>::negative_infinity();
+		if (n < binomial_table.rows) return T(log(T(binomial_table(n, (k > n - k) ? n - k : k))));
+		return log_fact<T>(n) - log_fact<T>(k) - log_fact<T>(n - k);
+	}
+
+
+	//Integer型の三角形状の数表(必要な行まで伸長する)
+	template <class Integer, class Recurrence>
+	class combinatorial_table {
+		std::vector<Integer> c_m;
+		size_t rows_m;
+		Integer zero_m;
+	public:
+		combinatorial_table() : c_m(1, Integer(1)), rows_m(1), zero_m(0) {}
+		explicit combinatorial_table(size_t n) : combinatorial_table() { reserve(n); }
+
+		size_t rows() const { return rows_m; }
+		//n行目まで構築
+		void reserve(size_t n) {
+			if (n < rows_m) return;
+			c_m.resize((n + 1) * (n + 2) / 2);
+			for (; rows_m <= n; ++rows_m) {
+				size_t m = rows_m - 1;
+				const Integer* p = c_m.data() + m * (m + 1) / 2;
+				Integer* q = c_m.data() + rows_m * (rows_m + 1) / 2;
+				//size_tのテーブルの範囲は変換するだけでよい
+				if (rows_m < combinatorial_triangle<Recurrence>.rows) {
+					for (size_t k = 0; k <= rows_m; ++k) q[k] = Integer(combinatorial_triangle<Recurrence>(rows_m, k));
+					continue;
+				}
+				q[0] = Integer(Recurrence::a(m, 0)) * p[0];
+				for (size_t k = 1; k <= m; ++k) q[k] = Integer(Recurrence::a(m, k)) * p[k] + p[k - 1];
+				q[rows_m] = p[m];
+			}
+		}
+
+		//伸長で既存の要素が再配置されるため値で返す(t(5, 2) + t(1000, 3)のような式でも参照が無効にならない)
+		Integer operator()(size_t n, size_t k) {
+			if (k > n) return zero_m;
+			reserve(n);
+			return c_m[n * (n + 1) / 2 + k];
+		}
+		//構築済み(n < rows())の要素の参照(次のreserveまで有効)
+		const Integer& at(size_t n, size_t k) const {
+			if (k > n) return zero_m;
+			return c_m[n * (n + 1) / 2 + k];
+		}
+	};
+	template <class Integer>
+	using binomial_triangle = combinatorial_table<Integer, Binomial_recurrence>;
+	template <class Integer>
+	using stirling1_triangle = combinatorial_table<Integer, Stirling1_recurrence>;
+	template <class Integer>
+	using stirling2_triangle = combinatorial_table<Integer, Stirling2_recurrence>;
+
+
+	//mod pの階乗とその逆元のテーブル(pは2^32未満の素数, 必要に応じて伸長する)
+	class modular_combinatorics {
+		uint64_t p_m;
+		std::vector<uint64_t> fact_m, inverse_fact_m;
+
+		uint64_t pow_mod(uint64_t x, uint64_t n) const {
+			uint64_t result = 1;
+			for (x %= p_m; n > 0; n >>= 1, x = x * x % p_m)
+				if (n & 1) result = result * x % p_m;
+			return result;
+		}
+		//n < pに対するC(n, k)
+		uint64_t binom_small(size_t n, size_t k) {
+			if (k > n) return 0;
+			reserve(n);
+			return fact_m[n] * inverse_fact_m[k] % p_m * inverse_fact_m[n - k] % p_m;
+		}
+	public:
+		explicit modular_combinatorics(size_t p, size_t n = 0) : p_m(p), fact_m(1, 1 % p), inverse_fact_m(1, 1 % p) { reserve(n); }
+
+		size_t modulus() const { return size_t(p_m); }
+		//n!まで構築(p以上は0なので構築しない)
+		void reserve(size_t n) {
+			size_t first = fact_m.size();
+			if (n < first || first >= p_m) return;
+			//再構築の回数を抑えるため倍々に伸長する
+			size_t last = (n + 1 > 2 * first) ? n + 1 : 2 * first;
+			if (last > p_m) last = size_t(p_m);
+			fact_m.resize(last);
+			inverse_fact_m.resize(last);
+			for (size_t i = first; i < last; ++i) fact_m[i] = fact_m[i - 1] * i % p_m;
+			inverse_fact_m[last - 1] = pow_mod(fact_m[last - 1], p_m - 2);
+			for (size_t i = last - 1; i > first; --i) inverse_fact_m[i - 1] = inverse_fact_m[i] * i % p_m;
+		}
+
+		//n! mod p
+		size_t fact(size_t n) {
+			if (n >= p_m) return 0;
+			reserve(n);
+			return size_t(fact_m[n]);
+		}
+		//(n!)^-1 mod p (n < p)
+		size_t inverse_fact(size_t n) {
+			reserve(n);
+			return size_t(inverse_fact_m[n]);
+		}
+		//n^-1 mod p (n mod p != 0)
+		size_t inverse(size_t n) {
+			n %= p_m;
+			reserve(n);
+			return size_t(inverse_fact_m[n] * fact_m[n - 1] % p_m);
+		}
+		//C(n, k) mod p (n >= pはLucasの定理)
+		size_t binom(size_t n, size_t k) {
+			if (k > n) return 0;
+			uint64_t result = 1;
+			for (; n > 0 && result != 0; n /= size_t(p_m), k /= size_t(p_m))
+				result = result * binom_small(n % p_m, k % p_m) % p_m;
+			return size_t(result);
+		}
+		//n!/(n - k)! mod p
+		size_t perm(size_t n, size_t k) {
+			if (k > n) return 0;
+			//連続するk個の整数がpの倍数を含まなければn mod pの場合に帰着できる
+			if (n >= p_m) {
+				if (k > n % p_m) return 0;
+				n %= p_m;
+			}
+			reserve(n);
+			return size_t(fact_m[n] * inverse_fact_m[n - k] % p_m);
+		}
+		//重複組合せ H(n, k) = C(n + k - 1, k) mod p
+		size_t multichoose(size_t n, size_t k) {
+			return (n == 0) ? ((k == 0) ? 1 % size_t(p_m) : 0) : binom(n + k - 1, k);
+		}
+		//Catalan数 C(2n, n)/(n + 1) mod p
+		size_t catalan(size_t n) {
+			//C(2n, n) - C(2n, n + 1)
+			return size_t((binom(2 * n, n) + p_m - binom(2 * n, n + 1)) % p_m);
+		}
+	};
+}
+
+
+#endif
\ No newline at end of file
@@ -3,30 +3,59 @@
 
 #include "IMathLib/math/math/math_traits.hpp"
 #include "IMathLib/math/math/pow.hpp"
+#include "IMathLib/math/math/zeta_kernel.hpp"
+#include "IMathLib/utility/tuple.hpp"
 
 namespace iml {
 
+	//Borweinの加速級数 η(s) = Σ[k < N] c[k]/(k + 1)^s の係数のテーブル
+	template <size_t, class, class>
+	struct Eta_coefficient_table;
+	template <size_t N, class T, size_t... Indices>
+	struct Eta_coefficient_table<N, T, index_tuple<size_t, Indices...>> {
+		using result_type = typename math_function_type<T>::type;
+
+		//c[k] = (-1)^k(d[N] - d[k])/d[N] (d[k] = Σ[i <= k] a[i], a[i + 1] = a[i]*4(N + i)(N - i)/((2i + 1)(2i + 2)))
+		static constexpr result_type __eta_coefficient(size_t k) {
+			result_type a = 1, total = 0, tail = 0;
+			for (size_t i = 0; i <= N; ++i) {
+				total += a;
+				if (i > k) tail += a;
+				a *= result_type(4) * (N + i) * (N - i) / ((2 * i + 1) * (2 * i + 2));
+			}
+			return ((k & 1) == 1) ? -tail / total : tail / total;
+		}
+
+		static constexpr result_type c[N] = { __eta_coefficient(Indices)... };
+	};
+	template <size_t N, class T = IMATH_DEFAULT_FLOATING_POINT>
+	struct eta_coefficient_table : Eta_coefficient_table<N, T, typename index_range<size_t, 0, N>::type> {};
+
+	//仮数部がbitsビットの精度に必要なBorweinの加速級数の項数(誤差は3/(3 + √8)^N程度)
+	inline constexpr size_t borwein_terms(size_t bits) {
+		return size_t((bits * 0.6931471805599453 + 1.0986122886681098) / 1.7627471740390861) + 2;
+	}
+
+
 	//ディリクレのイータ関数
 	template <class T>
 	struct Dirichlet_eta {
 		using result_type = typename math_function_type<T>::type;
+		using table = eta_coefficient_table<borwein_terms(numeric_traits<result_type>::digits), result_type>;
 
+		static constexpr result_type _dirichlet_eta_(const T& x, false_type) {
+			constexpr size_t n = borwein_terms(numeric_traits<result_type>::digits);
+			//小さい項から加算
+			result_type result = 0;
+			for (size_t k = n; k-- > 0;) result += table::c[k] * pow(result_type(k + 1), -result_type(x));
+			return result;
+		}
+		//実行時は係数表を持つカーネルで計算
+		static constexpr result_type _dirichlet_eta_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _dirichlet_eta_(x, false_type()) : Zeta_kernel<result_type>::_dirichlet_eta_(static_cast<result_type>(x));
+		}
 		static constexpr result_type _dirichlet_eta_(const T& x) {
-			result_type x2 = 0.5, x1 = 0.5, x3 = 1, x4 = 1, x5 = 0;
-
-			for (size_t i = 1; !error_evaluation(x2, x5); ++i) {
-				x5 = x2;
-				x1 /= 2;
-				x3 = x4 = x1;
-				for (size_t j = 1; j <= i; ++j) {
-					//x3 *= -result_type(i + 1 - j) / j;
-					//x4 += x3 * pow(j + 1, -x);
-					x3 *= -pow(result_type(j) / (j + 1), x)*(i + 1 - j) / j;
-					x4 += x3;
-				}
-				x2 += x4;
-			}
-			return x2;
+			return _dirichlet_eta_(x, is_elementary_kernel_type<result_type>());
 		}
 	};
 	template <class T>
@@ -0,0 +1,454 @@
+﻿#ifndef IMATH_MATH_MATH_ELEMENTARY_KERNEL_HPP
+#define IMATH_MATH_MATH_ELEMENTARY_KERNEL_HPP
+
+#include "IMathLib/math/math/simd_type.hpp"
+#include "IMathLib/utility/type_traits/integral_constant.hpp"
+
+//float/doubleに対する初等関数の実行時カーネル
+//Cody-Waite法による範囲縮約とミニマックス多項式による評価で構成され, packの演算のみで記述されるため
+//スカラーとSIMDで同一の実装を利用する
+//最大誤差(long doubleとの比較, 乱数による2*10^6点): double版 exp,pow 1.01ulp, log,sin,cos 0.77ulp, float版 exp 1.05ulp, その他 0.76ulp
+//(exp,powの1ulpを超える誤差は結果が非正規化数となる範囲でのみ生じる)
+
+IMATH_FP_CONTRACT_OFF_PUSH
+namespace iml {
+	namespace simd {
+
+		//誤差なし加算(a + b = s + e)
+		template <class T>
+		inline void two_sum(const T& a, const T& b, T& s, T& e) {
+			T x = a + b, bb = x - a;
+			e = (a - (x - bb)) + (b - bb);
+			s = x;
+		}
+		//|a| >= |b|のときの誤差なし加算
+		template <class T>
+		inline void fast_two_sum(const T& a, const T& b, T& s, T& e) {
+			T x = a + b;
+			e = b - (x - a);
+			s = x;
+		}
+		//誤差なし乗算(a * b = p + e)
+		//FMA命令が利用できるときは乗算の誤差を直接求める(Dekkerの分割は乗算と加算の縮約で誤差なしとならない)
+		template <class T>
+		inline void two_prod(const T& a, const T& b, T& p, T& e) {
+			T x = a * b;
+#if defined IMATH_FMA
+			e = fma(a, b, -x);
+#else
+			T t = a * 134217729., ah = t - (t - a), al = a - ah;
+			t = b * 134217729.;
+			T bh = t - (t - b), bl = b - bh;
+			e = ((ah * bh - x) + ah * bl + al * bh) + al * bl;
+#endif
+			p = x;
+		}
+
+
+		template <class T>
+		struct Elementary_kernel_impl;
+
+		//double
+		template <>
+		struct Elementary_kernel_impl<double> {
+
+			//指数関数(xlはxの下位部分)
+			template <class P>
+			static P _exp_(const P& x, const P& xl = P(0.)) {
+				//x = n*log(2) + r (|r| <= log(2)/2)
+				const P shifter = 6755399441055744.;
+				P n = (x * 1.4426950408889634 + shifter) - shifter;
+				//hiは誤差なく求まるためrの丸め誤差を高次の項にのみ留める
+				P hi = x - n * 0.6931471805598903, lo = n * 5.497923018708371e-14 - xl, r = hi - lo;
+				//exp(r) = 1 + r + r^2/2 + r^3*Q(r) のミニマックス近似(絶対誤差 2.5e-17)
+				P q = r * 2.5105221103345265e-08 + 2.761380778935526e-07;
+				q = q * r + 2.755725684190048e-06;
+				q = q * r + 2.4801536386738515e-05;
+				q = q * r + 0.00019841269871776425;
+				q = q * r + 0.001388888890588272;
+				q = q * r + 0.008333333333327966;
+				q = q * r + 0.04166666666665135;
+				q = q * r + 0.16666666666666669;
+				P p = 1. + (hi + ((r * r) * (q * r + 0.5) - lo));
+				//2^nは指数部の範囲を超えるため2回に分けて乗算
+				P n1 = (n * 0.5 + shifter) - shifter;
+				P result = p * pow2i(n1) * pow2i(n - n1);
+				result = select(x > 709.782712893384, P(bit_cast<double>(0x7FF0000000000000ull)), result);
+				return select(x < -745.1332191019412, P(0.), result);
+			}
+
+			//自然対数
+			template <class P>
+			static P _log_(const P& x) {
+				//非正規化数は2^54倍して正規化
+				typename P::mask_type sub = x < 2.2250738585072014e-308;
+				P e, m = split_exponent(select(sub, x * 18014398509481984., x), e);
+				e = select(sub, e - 54., e);
+				//sqrt(2)/2 < m < sqrt(2)
+				typename P::mask_type big = m > 1.4142135623730951;
+				m = select(big, m * 0.5, m);
+				e = select(big, e + 1., e);
+				//log(m) = 2atanh(s) (s = f/(2+f))
+				P f = m - 1., s = f / (f + 2.), z = s * s;
+				P R = z * 0.14795949746504108 + 0.15314050539471846;
+				R = R * z + 0.18183564327007024;
+				R = R * z + 0.22222198573157717;
+				R = R * z + 0.2857142874238801;
+				R = R * z + 0.39999999999414676;
+				R = R * z + 0.6666666666666734;
+				R = R * z;
+				P hfsq = 0.5 * f * f;
+				P result = e * 0.6931471805598903 - ((hfsq - (s * (hfsq + R) + e * 5.497923018708371e-14)) - f);
+				//特殊値
+				const P inf = bit_cast<double>(0x7FF0000000000000ull);
+				result = select(x == inf, inf, result);
+				result = select(x == 0., -inf, result);
+				result = select(x < 0., P(bit_cast<double>(0x7FF8000000000000ull)), result);
+				return select(x != x, x, result);
+			}
+
+			//|x|の自然対数をdouble-doubleで求める(powの内部計算. xは正の有限値とし, 0, ∞, NaNは_pow_で別に扱う)
+			template <class P>
+			static void _log_ext_(const P& x, P& hi, P& lo) {
+				typename P::mask_type sub = x < 2.2250738585072014e-308;
+				P e, m = split_exponent(select(sub, x * 18014398509481984., x), e);
+				e = select(sub, e - 54., e);
+				typename P::mask_type big = m > 1.4142135623730951;
+				m = select(big, m * 0.5, m);
+				e = select(big, e + 1., e);
+				//s = f/(2+f)をdouble-doubleで計算
+				P f = m - 1., u, ul;
+				fast_two_sum(P(2.), f, u, ul);
+				P sh = f / u, ph, pl;
+				two_prod(sh, u, ph, pl);
+				P sl = (((f - ph) - pl) - sh * ul) / u;
+				//(2/3)s^3をdouble-doubleで計算
+				P zh, zl, ch, cl;
+				two_prod(sh, sh, zh, zl);
+				two_prod(zh, sh, ch, cl);
+				cl = cl + zl * sh + 3. * zh * sl;
+				P th, tl;
+				two_prod(ch, P(0.6666666666666666), th, tl);
+				tl = tl + ch * 3.700743415417188e-17 + cl * 0.6666666666666666;
+				//残りの項は倍精度で十分
+				P z = zh, R = z * 0.13196216008149544 + 0.1325682922171571;
+				R = R * z + 0.15386756870258378;
+				R = R * z + 0.1818178437635656;
+				R = R * z + 0.22222222519827348;
+				R = R * z + 0.28571428570100044;
+				R = R * z + 0.40000000000002256;
+				P tail = R * z * z * sh;
+				//log(m) = 2s + (2/3)s^3 + tail
+				P a, b;
+				two_sum(2. * sh, th, a, b);
+				b = b + (2. * sl + tl + tail);
+				fast_two_sum(a, b, a, b);
+				//e*log(2)を加算
+				P c, d;
+				two_sum(e * 0.6931471805598903, a, c, d);
+				d = d + b + e * 5.497923018708371e-14;
+				fast_two_sum(c, d, hi, lo);
+			}
+
+			//冪乗(特殊値はIEEE 754のpowに従う)
+			template <class P>
+			static P _pow_(const P& x, const P& y) {
+				const P inf = bit_cast<double>(0x7FF0000000000000ull);
+				P ax = abs(x), ay = abs(y), lh, ll;
+				_log_ext_(ax, lh, ll);
+				//y*log|x|をdouble-doubleで計算
+				P ph, pl;
+				two_prod(y, lh, ph, pl);
+				pl = pl + y * ll;
+				fast_two_sum(ph, pl, ph, pl);
+				P result = _exp_(ph, pl);
+				//|y|が大きいときは分割がオーバーフローするため誤差項を無視
+				if (any(ay >= 8.452712498170644e+270)) result = select(ay >= 8.452712498170644e+270, _exp_(y * lh), result);
+				//yの整数判定と偶奇判定
+				typename P::mask_type large = ay >= 4503599627370496.;
+				typename P::mask_type integer = large | (((ay + 4503599627370496.) - 4503599627370496.) == ay);
+				typename P::mask_type odd = integer & (ay < 9007199254740992.) & low_bit_mask<0>(select(large, ay, ay + 4503599627370496.));
+				//|x| = 0, ∞は|x|^yの符号のみで決まる(対数を経由しない)
+				typename P::mask_type edge = (ax == 0.) | (ax == inf);
+				result = select(edge, select((ax == inf) ^ (y < 0.), inf, P(0.)), result);
+				//負の底(-0, -∞を含む)
+				result = select(low_bit_mask<63>(x) & odd, -result, result);
+				result = select((x < 0.) & (x > -inf) & !integer, P(bit_cast<double>(0x7FF8000000000000ull)), result);
+				//NaNの伝播
+				result = select((x != x) | (y != y), x + y, result);
+				//1となる場合(NaNを含む)
+				result = select((ax == 1.) & (ay == inf), P(1.), result);
+				return select((y == 0.) | (x == 1.), P(1.), result);
+			}
+
+			//区間縮約したx = y0 + y1に対するsin(x)
+			template <class P>
+			static P _ksin_(const P& y0, const P& y1) {
+				P z = y0 * y0, v = z * y0;
+				P r = z * 1.589682797204921e-10 - 2.505075865405815e-08;
+				r = r * z + 2.7557313695231825e-06;
+				r = r * z - 0.00019841269829816966;
+				r = r * z + 0.008333333333322425;
+				return y0 - ((z * (0.5 * y1 - v * r) - y1) - v * -0.16666666666666632);
+			}
+			//区間縮約したx = y0 + y1に対するcos(x)
+			template <class P>
+			static P _kcos_(const P& y0, const P& y1) {
+				P z = y0 * y0;
+				P r = z * -1.1359669919311247e-11 + 2.087572368536474e-09;
+				r = r * z - 2.755731435524804e-07;
+				r = r * z + 2.4801587289491847e-05;
+				r = r * z - 0.0013888888888874138;
+				r = r * z + 0.0416666666666666;
+				r = r * z;
+				P hz = 0.5 * z, w = 1. - hz;
+				return w + (((1. - w) - hz) + (z * r - y0 * y1));
+			}
+			//象限に応じたsin(Cos = false)とcos(Cos = true)の選択
+			template <bool Cos, class P, class M>
+			static P _quadrant_(const P& y0, const P& y1, const M& swap, M neg) {
+				P s = _ksin_(y0, y1), c = _kcos_(y0, y1);
+				if (Cos) neg = neg ^ swap;
+				P result = Cos ? select(swap, s, c) : select(swap, c, s);
+				return select(neg, -result, result);
+			}
+
+			//2/πの2進展開(32bit単位)
+			static uint32_t _two_over_pi_(size_t i) {
+				static const uint32_t table[] = {
+					0xA2F9836E, 0x4E441529, 0xFC2757D1, 0xF534DDC0, 0xDB629599, 0x3C439041, 0xFE5163AB, 0xDEBBC561,
+					0xB7246E3A, 0x424DD2E0, 0x06492EEA, 0x09D1921C, 0xFE1DEB1C, 0xB129A73E, 0xE88235F5, 0x2EBB4484,
+					0xE99C7026, 0xB45F7E41, 0x3991D639, 0x835339F4, 0x9C845F8B, 0xBDF9283B, 0x1FF897FF, 0xDE05980F,
+					0xEF2F118B, 0x5A0A6D1F, 0x6D367ECF, 0x27CB09B7, 0x4F463F66, 0x9E5FEA2D, 0x7527BAC7, 0xEBE5F17B,
+					0x3D0739F7, 0x8A5292EA, 0x6BFB5FB1, 0x1F8D5D08, 0x56033046, 0xFC7B6BAB, 0xF0CFBC20, 0x9AF4361D
+				};
+				return table[i];
+			}
+			//多倍長整数pの[pos, pos+count)のビット(count <= 53)
+			static uint64_t _bits_(const uint32_t* p, int_t pos, int_t count) {
+				if (pos < 0) return (count + pos > 0) ? _bits_(p, 0, count + pos) << -pos : 0;
+				//3語にまたがらないように32bitずつ取り出す
+				if (count > 32) return (_bits_(p, pos + 32, count - 32) << 32) | _bits_(p, pos, 32);
+				uint64_t result = 0;
+				for (int_t i = (pos + count - 1) >> 5; i >= (pos >> 5); --i) result = (result << 32) | ((i < 9) ? p[i] : 0);
+				result >>= (pos & 31);
+				return result & ((uint64_t(1) << count) - 1);
+			}
+			//Payne-Hanek法による区間縮約(ax >= 2^20, ax = q*π/2 + y0 + y1, |y0| <= π/4)
+			static int_t _reduce_large_(double ax, double& y0, double& y1) {
+				uint64_t bits = bit_cast<uint64_t>(ax);
+				int_t ex = int_t((bits >> 52) & 0x7FF) - 1075;
+				uint64_t m = (bits & 0x000FFFFFFFFFFFFFull) | 0x0010000000000000ull;
+				//4の倍数にしかならない上位の語は不要
+				int_t i0 = (ex > 2) ? (ex - 2) / 32 : 0;
+
+				//mと2/πの224bit分の積
+				uint32_t p[9] = {};
+				uint64_t ml[2] = { m & 0xFFFFFFFF, m >> 32 };
+				for (size_t i = 0; i < 2; ++i) {
+					uint64_t carry = 0;
+					for (size_t k = 0; k < 7; ++k) {
+						uint64_t t = ml[i] * _two_over_pi_(i0 + 6 - k) + p[i + k] + carry;
+						p[i + k] = uint32_t(t);
+						carry = t >> 32;
+					}
+					p[i + 7] += uint32_t(carry);
+				}
+
+				//sビット目以上が整数部
+				int_t s = 32 * (i0 + 7) - ex;
+				int_t q = int_t(_bits_(p, s, 2));
+				//小数部を[-1/2, 1/2)に丸める
+				bool neg = _bits_(p, s - 1, 1) != 0;
+				if (neg) {
+					uint64_t carry = 1;
+					for (size_t i = 0; i < 9; ++i) {
+						uint64_t t = uint64_t(uint32_t(~p[i])) + carry;
+						p[i] = uint32_t(t);
+						carry = t >> 32;
+					}
+					q = (q + 1) & 3;
+				}
+				int_t msb = s - 1;
+				while (msb >= 0 && _bits_(p, msb, 1) == 0) --msb;
+				if (msb < 0) { y0 = y1 = 0; return q; }
+
+				//上位106bitをdouble-doubleとしてπ/2を乗算
+				double a = double(_bits_(p, msb - 52, 53)) * bit_cast<double>(uint64_t(msb - 52 - s + 1023) << 52);
+				double b = double(_bits_(p, msb - 105, 53)) * bit_cast<double>(uint64_t(msb - 105 - s + 1023) << 52);
+				pack<double, 1> h, l;
+				two_prod(pack<double, 1>(a), pack<double, 1>(1.5707963267948966), h, l);
+				l += a * 6.123233995736766e-17 + b * 1.5707963267948966;
+				fast_two_sum(h.v, l.v, y0, y1);
+				if (neg) { y0 = -y0; y1 = -y1; }
+				return q;
+			}
+			//|x| >= 2^20または非有限のときのsin/cos
+			template <bool Cos>
+			static double _sin_cos_large_(double x) {
+				if (x - x != 0) return x - x;
+				double y0, y1;
+				int_t q = _reduce_large_((x < 0) ? -x : x, y0, y1);
+				if (x < 0) { y0 = -y0; y1 = -y1; q = (4 - q) & 3; }
+				return _quadrant_<Cos>(pack<double, 1>(y0), pack<double, 1>(y1), (q & 1) != 0, (q & 2) != 0).v;
+			}
+			template <bool Cos, class P>
+			static P _sin_cos_(const P& x) {
+				//x = n*π/2 + y0 + y1 (π/2を3分割したCody-Waite法)
+				const P shifter = 6755399441055744.;
+				P shifted = x * 0.6366197723675814 + shifter;
+				P n = shifted - shifter;
+				P r = x - n * 1.5707963267341256, s, e, s2, e2;
+				two_sum(r, -(n * 6.077100506303966e-11), s, e);
+				two_sum(s, -(n * 2.0222662487111665e-21), s2, e2);
+				e = e + e2 - n * 8.4784276603689e-32;
+				P y0, y1;
+				fast_two_sum(s2, e, y0, y1);
+				P result = _quadrant_<Cos>(y0, y1, low_bit_mask<0>(shifted), low_bit_mask<1>(shifted));
+
+				//範囲外の要素はスカラーで再計算
+				if (any(abs(x) >= 1048576.)) {
+					double xs[P::size], rs[P::size];
+					x.store(xs);
+					result.store(rs);
+					for (size_t i = 0; i < P::size; ++i) {
+						if (!(xs[i] < 1048576. && xs[i] > -1048576.)) rs[i] = _sin_cos_large_<Cos>(xs[i]);
+					}
+					result = P::load(rs);
+				}
+				return result;
+			}
+			template <class P>
+			static P _sin_(const P& x) { return _sin_cos_<false>(x); }
+			template <class P>
+			static P _cos_(const P& x) { return _sin_cos_<true>(x); }
+		};
+
+
+		//float(sin, cos, powは倍精度のカーネルで計算)
+		template <>
+		struct Elementary_kernel_impl<float> {
+
+			template <class P>
+			static P _exp_(const P& x) {
+				const P shifter = 12582912.f;
+				P n = (x * 1.44269502f + shifter) - shifter;
+				P hi = x - n * 0.693145751953125f, lo = n * 1.428606765330187e-06f, r = hi - lo;
+				P q = r * 0.0013933735685502761f + 0.0083572501641396f;
+				q = q * r + 0.041666486650895514f;
+				q = q * r + 0.16666630668365348f;
+				P p = 1.f + (hi + ((r * r) * (q * r + 0.5f) - lo));
+				P n1 = (n * 0.5f + shifter) - shifter;
+				P result = p * pow2i(n1) * pow2i(n - n1);
+				result = select(x > 88.72283f, P(bit_cast<float>(0x7F800000u)), result);
+				return select(x < -103.97208f, P(0.f), result);
+			}
+
+			template <class P>
+			static P _log_(const P& x) {
+				typename P::mask_type sub = x < 1.17549435e-38f;
+				P e, m = split_exponent(select(sub, x * 33554432.f, x), e);
+				e = select(sub, e - 25.f, e);
+				typename P::mask_type big = m > 1.41421356f;
+				m = select(big, m * 0.5f, m);
+				e = select(big, e + 1.f, e);
+				P f = m - 1.f, s = f / (f + 2.f), z = s * s;
+				P R = z * 0.29871729016304016f + 0.3997754156589508f;
+				R = R * z + 0.6666677594184875f;
+				R = R * z;
+				P hfsq = 0.5f * f * f;
+				P result = e * 0.693145751953125f - ((hfsq - (s * (hfsq + R) + e * 1.428606765330187e-06f)) - f);
+				const P inf = bit_cast<float>(0x7F800000u);
+				result = select(x == inf, inf, result);
+				result = select(x == 0.f, -inf, result);
+				result = select(x < 0.f, P(bit_cast<float>(0x7FC00000u)), result);
+				return select(x != x, x, result);
+			}
+
+			//倍精度のカーネルの呼び出し
+			struct sin_kernel {
+				template <class P>
+				P operator()(const P& x) const { return Elementary_kernel_impl<double>::_sin_(x); }
+			};
+			struct cos_kernel {
+				template <class P>
+				P operator()(const P& x) const { return Elementary_kernel_impl<double>::_cos_(x); }
+			};
+			struct pow_kernel {
+				template <class P>
+				P operator()(const P& x, const P& y) const { return Elementary_kernel_impl<double>::_pow_(x, y); }
+			};
+			template <class F>
+			static pack<float, 1> _promote_(const pack<float, 1>& x, F f) { return narrow(f(widen(x))); }
+			template <class F>
+			static pack<float, 1> _promote_(const pack<float, 1>& x, const pack<float, 1>& y, F f) { return narrow(f(widen(x), widen(y))); }
+#if defined IMATH_SIMD_SSE2
+			template <class F>
+			static pack<float, 4> _promote_(const pack<float, 4>& x, F f) { return narrow(f(widen_low(x)), f(widen_high(x))); }
+			template <class F>
+			static pack<float, 4> _promote_(const pack<float, 4>& x, const pack<float, 4>& y, F f) {
+				return narrow(f(widen_low(x), widen_low(y)), f(widen_high(x), widen_high(y)));
+			}
+#endif
+#if defined IMATH_SIMD_AVX2
+			template <class F>
+			static pack<float, 8> _promote_(const pack<float, 8>& x, F f) { return narrow(f(widen_low(x)), f(widen_high(x))); }
+			template <class F>
+			static pack<float, 8> _promote_(const pack<float, 8>& x, const pack<float, 8>& y, F f) {
+				return narrow(f(widen_low(x), widen_low(y)), f(widen_high(x), widen_high(y)));
+			}
+#endif
+
+			template <class P>
+			static P _sin_(const P& x) { return _promote_(x, sin_kernel()); }
+			template <class P>
+			static P _cos_(const P& x) { return _promote_(x, cos_kernel()); }
+			template <class P>
+			static P _pow_(const P& x, const P& y) { return _promote_(x, y, pow_kernel()); }
+		};
+	}
+
+
+	//実行時カーネルを持つ型であるか(Exp等はこれがtrueならば定数評価でないときにカーネルを用いる)
+	template <class T>
+	struct is_elementary_kernel_type : false_type {};
+	template <>
+	struct is_elementary_kernel_type<float> : true_type {};
+	template <>
+	struct is_elementary_kernel_type<double> : true_type {};
+	template <class T>
+	constexpr bool is_elementary_kernel_type_v = is_elementary_kernel_type<T>::value;
+
+
+	//スカラーに対する実行時カーネル
+	template <class T>
+	struct Elementary_kernel;
+	template <>
+	struct Elementary_kernel<double> {
+		using impl = simd::Elementary_kernel_impl<double>;
+		using pack_type = simd::pack<double, 1>;
+
+		static double _exp_(double x) { return impl::_exp_(pack_type(x)).v; }
+		static double _log_(double x) { return impl::_log_(pack_type(x)).v; }
+		static double _sin_(double x) { return impl::_sin_(pack_type(x)).v; }
+		static double _cos_(double x) { return impl::_cos_(pack_type(x)).v; }
+		static double _pow_(double x, double y) { return impl::_pow_(pack_type(x), pack_type(y)).v; }
+		static double _sqrt_(double x) { return simd::sqrt(pack_type(x)).v; }
+	};
+	template <>
+	struct Elementary_kernel<float> {
+		using impl = simd::Elementary_kernel_impl<float>;
+		using pack_type = simd::pack<float, 1>;
+
+		static float _exp_(float x) { return impl::_exp_(pack_type(x)).v; }
+		static float _log_(float x) { return impl::_log_(pack_type(x)).v; }
+		static float _sin_(float x) { return impl::_sin_(pack_type(x)).v; }
+		static float _cos_(float x) { return impl::_cos_(pack_type(x)).v; }
+		static float _pow_(float x, float y) { return impl::_pow_(pack_type(x), pack_type(y)).v; }
+		static float _sqrt_(float x) { return simd::sqrt(pack_type(x)).v; }
+	};
+}
+IMATH_FP_CONTRACT_POP
+
+
+#endif
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "IMathLib/math/math/math_traits.hpp"
 #include "IMathLib/math/math/sqrt.hpp"
 #include "IMathLib/math/math/pi.hpp"
+#include "IMathLib/math/math/exp.hpp"
+#include "IMathLib/math/math/log.hpp"
+#include "IMathLib/math/math/erf_kernel.hpp"
 
 namespace iml {
 
@@ -12,17 +15,40 @@ namespace iml {
 	struct Erf {
 		using result_type = typename math_function_type<T>::type;
 
-		static constexpr result_type _erf_(const T& x) {
+		//x >= 2での連分数 erfcx(x) = 1/(√π(x + (1/2)/(x + 1/(x + (3/2)/(x + ...)))))(Lentz法)
+		static constexpr result_type _erfcx_fraction_(const result_type& x) {
+			result_type f = x, c = x, d = 0, f0 = 0;
+			for (size_t i = 1; !error_evaluation(f, f0) && i < 1000; ++i) {
+				f0 = f;
+				result_type a = result_type(i) / 2;
+				d = 1 / (x + a * d);
+				c = x + a / c;
+				f *= c * d;
+			}
+			return 1 / (sqrt(pi<result_type>) * f);
+		}
+		static constexpr result_type _erf_(const T& x, false_type) {
+			//|x| >= 2では1 - erfc(|x|)
+			if (x >= 2) return 1 - exp(-x * x) * _erfcx_fraction_(x);
+			if (x <= -2) return exp(-x * x) * _erfcx_fraction_(-x) - 1;
+			//erf(x) = 2/√π e^(-x^2) Σ 2^n x^(2n+1) / (2n+1)!!(項が全て同符号のため桁落ちしない)
 			result_type x1 = x, x2 = x, x3 = 0;
-			result_type temp = x * x;
+			result_type temp = 2 * x * x;
 			constexpr result_type c = 2 / sqrt(pi<result_type>);
 
 			for (size_t i = 1; !error_evaluation(x2, x3); ++i) {
 				x3 = x2;
-				x1 *= -temp / i;
-				x2 += x1 / (2 * i + 1);
+				x1 *= temp / (2 * i + 1);
+				x2 += x1;
 			}
-			return c*x2;
+			return c * exp(-x * x) * x2;
+		}
+		//実行時は有理関数近似のカーネルで計算
+		static constexpr result_type _erf_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _erf_(x, false_type()) : Erf_kernel<result_type>::_erf_(static_cast<result_type>(x));
+		}
+		static constexpr result_type _erf_(const T& x) {
+			return _erf_(x, is_elementary_kernel_type<result_type>());
 		}
 	};
 	template <class T>
@@ -34,12 +60,106 @@ namespace iml {
 	struct Erfc {
 		using result_type = typename math_function_type<T>::type;
 
+		static constexpr result_type _erfc_(const T& x, false_type) {
+			return (x >= 2) ? exp(-x * x) * Erf<result_type>::_erfcx_fraction_(x) : 1 - erf(x);
+		}
+		//実行時は有理関数近似のカーネルで計算
+		static constexpr result_type _erfc_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _erfc_(x, false_type()) : Erf_kernel<result_type>::_erfc_(static_cast<result_type>(x));
+		}
 		static constexpr result_type _erfc_(const T& x) {
-			return 1 - erf(x);
+			return _erfc_(x, is_elementary_kernel_type<result_type>());
 		}
 	};
 	template <class T>
 	inline constexpr auto erfc(const T& x) { return Erfc<T>::_erfc_(x); }
+
+
+	//スケーリングされた相補誤差関数
+	template <class T>
+	struct Erfcx {
+		using result_type = typename math_function_type<T>::type;
+
+		static constexpr result_type _erfcx_(const T& x, false_type) {
+			return (x >= 2) ? Erf<result_type>::_erfcx_fraction_(x) : exp(x * x) * (1 - erf(x));
+		}
+		//実行時は有理関数近似のカーネルで計算
+		static constexpr result_type _erfcx_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _erfcx_(x, false_type()) : Erf_kernel<result_type>::_erfcx_(static_cast<result_type>(x));
+		}
+		static constexpr result_type _erfcx_(const T& x) {
+			return _erfcx_(x, is_elementary_kernel_type<result_type>());
+		}
+	};
+	template <class T>
+	inline constexpr auto erfcx(const T& x) { return Erfcx<T>::_erfcx_(x); }
+
+
+	//逆誤差関数
+	template <class T>
+	struct Erfinv {
+		using result_type = typename math_function_type<T>::type;
+
+		//l = log(1 - y^2)から|erfinv(y)|の初期値を求める(Winitzkiの近似)
+		static constexpr result_type _initial_(const result_type& l) {
+			constexpr result_type a = result_type(0.147);
+			result_type t = 2 / (pi<result_type> * a) + l / 2;
+			return sqrt(sqrt(t * t - l / a) - t);
+		}
+		static constexpr result_type _erfinv_(const T& y, false_type) {
+			if (y > 1 || y < -1) return numeric_traits<result_type>::nan();
+			if (y == 1) return numeric_traits<result_type>::positive_infinity();
+			if (y == -1) return numeric_traits<result_type>::negative_infinity();
+			result_type x = _initial_(log((1 - y) * (1 + y))), x0 = 0;
+			if (y < 0) x = -x;
+			//erf(x) = yに対するNewton法
+			for (size_t i = 0; !error_evaluation(x, x0) && i < 100; ++i) {
+				x0 = x;
+				x -= (erf(x) - y) * sqrt(pi<result_type>) / 2 * exp(x * x);
+			}
+			return x;
+		}
+		//実行時は有理関数近似とNewton法1回のカーネルで計算
+		static constexpr result_type _erfinv_(const T& y, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _erfinv_(y, false_type()) : Erf_kernel<result_type>::_erfinv_(static_cast<result_type>(y));
+		}
+		static constexpr result_type _erfinv_(const T& y) {
+			return _erfinv_(y, is_elementary_kernel_type<result_type>());
+		}
+	};
+	template <class T>
+	inline constexpr auto erfinv(const T& y) { return Erfinv<T>::_erfinv_(y); }
+
+
+	//逆相補誤差関数
+	template <class T>
+	struct Erfcinv {
+		using result_type = typename math_function_type<T>::type;
+
+		static constexpr result_type _erfcinv_(const T& q, false_type) {
+			if (q > 2 || q < 0) return numeric_traits<result_type>::nan();
+			if (q == 0) return numeric_traits<result_type>::positive_infinity();
+			if (q == 2) return numeric_traits<result_type>::negative_infinity();
+			//1 - y^2 = q(2 - q)とすることでqが小さいときも初期値の精度を保つ
+			result_type x = Erfinv<result_type>::_initial_(log(q * (2 - q))), x0 = 0;
+			if (q > 1) x = -x;
+			//erfc(x) = qに対するNewton法
+			for (size_t i = 0; !error_evaluation(x, x0) && i < 100; ++i) {
+				x0 = x;
+				x += (erfc(x) - q) * sqrt(pi<result_type>) / 2 * exp(x * x);
+			}
+			return x;
+		}
+		//実行時は有理関数近似とNewton法1回のカーネルで計算
+		static constexpr result_type _erfcinv_(const T& q, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _erfcinv_(q, false_type()) : Erf_kernel<result_type>::_erfcinv_(static_cast<result_type>(q));
+		}
+		static constexpr result_type _erfcinv_(const T& q) {
+			return _erfcinv_(q, is_elementary_kernel_type<result_type>());
+		}
+	};
+	template <class T>
+	inline constexpr auto erfcinv(const T& q) { return Erfcinv<T>::_erfcinv_(q); }
 }
 
 
@@ -0,0 +1,298 @@
+﻿#ifndef IMATH_MATH_MATH_ERF_KERNEL_HPP
+#define IMATH_MATH_MATH_ERF_KERNEL_HPP
+
+#include "IMathLib/math/math/elementary_kernel.hpp"
+
+//float/doubleに対する誤差関数族の実行時カーネル
+//|x| <= 1のerfはx^2の有理関数(5/6次), x >= 1/2のerfcx(x) = e^(x^2)erfc(x)は[1/2, 2), [2, 6), [6, ∞)の3区間の有理関数で近似し,
+//erfcはe^(-x^2)erfcx(x)(x^2はdouble-doubleで計算)とすることで裾でも相対精度を保つ(区間の係数はレーンごとに選択するため反復や分岐を持たない)
+//erfcxの有理関数は低次の項と除算をdouble-doubleで補正し, Horner法の丸め誤差を抑える
+//逆誤差関数は|y| < 1/2でyR(y^2), それ以外ではs = √(-log(q(2 - q)))(q = 1 - |y|)の有理関数を初期値として
+//log erfc(x) = log qに対するNewton法を1回適用する(|y| < 3/4ではerfのdouble-doubleの値から残差を求める)
+//最大誤差(long doubleとの比較): double版 erf 3.2ulp, erfc 3.7ulp, erfcx 3.2ulp, erfinv 2.5ulp, erfcinv 2.5ulp(erfcの値が非正規化数となる範囲を除く)
+
+IMATH_FP_CONTRACT_OFF_PUSH
+namespace iml {
+	namespace simd {
+
+		template <class T>
+		struct Erf_kernel_impl;
+
+		//double
+		template <>
+		struct Erf_kernel_impl<double> {
+			using elementary = Elementary_kernel_impl<double>;
+
+			//erfcxの有理関数でdouble-doubleで累積する低次の項の数
+			static constexpr size_t compensated_terms = 4;
+
+			//3区間の係数のレーンごとの選択(aとcは最初と最後の区間のマスク)
+			template <class P, class M>
+			static P _coefficient_(const M& a, const M& c, const double(&table)[3][7], size_t i) {
+				return select(a, P(table[0][i]), select(c, P(table[2][i]), P(table[1][i])));
+			}
+
+			//erf(x) = xR(x^2)のミニマックス近似(|x| <= 1, 相対誤差 2.2e-18, sはx^2)
+			template <class P>
+			static P _erf_small_(const P& x, const P& s) {
+				P n = s * 0.00019495599237539615 + 0.0018272941175602583;
+				n = n * s + 0.04530390493414132;
+				n = n * s + 0.142149290543889;
+				n = n * s + 1.1283791670955126;
+				P d = s * 2.0297399832150392e-05 + 0.0006812155314538929;
+				d = d * s + 0.010582210762349284;
+				d = d * s + 0.09325282772991055;
+				d = d * s + 0.45930986204733454;
+				d = d * s + 1.;
+				return x * (n / d);
+			}
+			//_erf_small_のdouble-doubleでの値h + l(最後の2項と除算を補正する)
+			template <class P>
+			static void _erf_small_ext_(const P& x, P& h, P& l) {
+				P s, sl;
+				two_prod(x, x, s, sl);
+				P n = s * 0.00019495599237539615 + 0.0018272941175602583, nl = 0.;
+				n = n * s + 0.04530390493414132;
+				_horner_step_(n, nl, s, sl, P(0.142149290543889));
+				_horner_step_(n, nl, s, sl, P(1.1283791670955126));
+				P d = s * 2.0297399832150392e-05 + 0.0006812155314538929, dl = 0.;
+				d = d * s + 0.010582210762349284;
+				d = d * s + 0.09325282772991055;
+				_horner_step_(d, dl, s, sl, P(0.45930986204733454));
+				_horner_step_(d, dl, s, sl, P(1.));
+				P q = n / d, ph, pl;
+				two_prod(q, d, ph, pl);
+				P ql = (((n - ph) - pl) + (nl - q * dl)) / d;
+				two_prod(x, q, h, l);
+				l = l + x * ql;
+			}
+			//x >= 1/2でのerfcx(x)のミニマックス近似
+			//[1/2, 2): R(x - 1/2)(相対誤差 1.4e-17), [2, 6): R(x - 2)(4.9e-17), [6, ∞): R(1/x^2)/x(1.2e-17)
+			template <class P>
+			static P _erfcx_large_(const P& x) {
+				static const double num[3][7] = {
+					{ 0.6156903441929259, 0.74815181712124, 0.4251535924299304, 0.13277477453939548, 0.022625554466523614, 0.0016731403556548739, 1.885445058624929e-08 },
+					{ 0.25539567631050575, 0.29555590463259646, 0.14463501761420014, 0.03720799255399168, 0.005026015496735362, 0.0002855193484028061, 5.1618770235296575e-12 },
+					{ 0.5641895835477563, 8.903440438362543, 39.38052547736741, 49.49885238035317, 8.510472882022771, 0., 0. }
+				};
+				static const double den[3][7] = {
+					{ 1., 2.047848649756867, 1.812139469033694, 0.8899975756962581, 0.25695731983378045, 0.041575330331787404, 0.0029664005725810573 },
+					{ 1., 1.5754079015688223, 1.0614128586293352, 0.39220468753929105, 0.08401936156966473, 0.009920512025617433, 0.000506070276576577 },
+					{ 1., 16.280937291283507, 77.19063267876774, 115.99404485349345, 39.15273296708732, 0., 0. }
+				};
+				typename P::mask_type near = x < 2., far = x >= 6.;
+				//[6, ∞)ではt = 1/x^2をdouble-doubleで求める(x > 10^150ではerfcx(x) = 1/(√π x)とし, double-doubleの溢れを避ける)
+				typename P::mask_type huge = x > 1e150;
+				P y = select(huge, P(1.), x), sh, sl, r = 1. / (y * y);
+				two_prod(y, y, sh, sl);
+				P rh, rl;
+				two_prod(r, sh, rh, rl);
+				P t = select(near, x - 0.5, select(far, r, x - 2.)), tl = select(far, r * (((1. - rh) - rl) - r * sl), P(0.));
+				//丸め誤差の大きい低次の項はdouble-doubleで累積する
+				P n = _coefficient_<P>(near, far, num, 6), d = _coefficient_<P>(near, far, den, 6), nl = 0., dl = 0.;
+				for (size_t i = 6; i-- > compensated_terms;) {
+					n = n * t + _coefficient_<P>(near, far, num, i);
+					d = d * t + _coefficient_<P>(near, far, den, i);
+				}
+				for (size_t i = compensated_terms; i-- > 0;) {
+					_horner_step_(n, nl, t, tl, _coefficient_<P>(near, far, num, i));
+					_horner_step_(d, dl, t, tl, _coefficient_<P>(near, far, den, i));
+				}
+				//[6, ∞)では分母にxを掛ける
+				P ph, pl;
+				two_prod(d, y, ph, pl);
+				d = select(far, ph, d);
+				dl = select(far, pl + dl * y, dl);
+				//(n + nl)/(d + dl)を1回の補正付きで求める
+				P q = n / d;
+				two_prod(q, d, ph, pl);
+				return select(huge, 0.5641895835477563 / x, q + (((n - ph) - pl) + (nl - q * dl)) / d);
+			}
+			//(h + l) <- (h + l)(t + tl) + c
+			template <class P>
+			static void _horner_step_(P& h, P& l, const P& t, const P& tl, const P& c) {
+				P ph, pl;
+				two_prod(h, t, ph, pl);
+				pl = pl + (l * t + h * tl);
+				two_sum(c, ph, h, ph);
+				l = ph + pl;
+			}
+
+			//相補誤差関数erfc(x + xl)(xlはxの下位部分であり裾でのe^(-x^2)の補正にのみ用いる)
+			template <class P>
+			static P _erfc_(const P& x, const P& xl = P(0.)) {
+				P ax = abs(x), h, l;
+				two_prod(ax, ax, h, l);
+				l = l + 2. * x * xl;
+				P r = elementary::_exp_(-h, -l) * _erfcx_large_(ax);
+				r = select(x < 0., 2. - r, r);
+				return select(ax < 0.5, 1. - _erf_small_(x, x * x), r);
+			}
+			//誤差関数
+			template <class P>
+			static P _erf_(const P& x) {
+				P ax = abs(x), h, l;
+				two_prod(ax, ax, h, l);
+				P r = 1. - elementary::_exp_(-h, -l) * _erfcx_large_(ax);
+				r = select(x < 0., -r, r);
+				return select(ax <= 1., _erf_small_(x, x * x), r);
+			}
+			//スケーリングされた相補誤差関数erfcx(x) = e^(x^2)erfc(x)
+			template <class P>
+			static P _erfcx_(const P& x) {
+				P ax = abs(x), h, l;
+				two_prod(ax, ax, h, l);
+				P e = elementary::_exp_(h, l), large = _erfcx_large_(ax);
+				P r = select(x < 0., 2. * e - large, large);
+				return select(ax < 0.5, e * (1. - _erf_small_(x, x * x)), r);
+			}
+
+			//erfc(x) = qq(yの符号を付ける)の解(|y| < 1/2ではerfinv(y)を直接求める)
+			template <class P>
+			static P _inverse_(const P& y, const P& qq) {
+				//erfinv(y) = yR(y^2)のミニマックス近似(|y| < 1/2, 相対誤差 1.0e-17)
+				//分子と分母は低次の項で桁落ちするため, 最後の2項と除算をdouble-doubleで補正する
+				P z, zl;
+				two_prod(y, y, z, zl);
+				P n = z * 0.0002993070491683925 + 0.0169526372815395, nl = 0.;
+				n = n * z - 0.3110446769244692;
+				n = n * z + 1.2714335324682242;
+				_horner_step_(n, nl, z, zl, P(-1.852864041971515));
+				_horner_step_(n, nl, z, zl, P(0.886226925452758));
+				P d = z * 0.06064872896635517 - 0.6091875462745635, dl = 0.;
+				d = d * z + 1.9066189667202342;
+				_horner_step_(d, dl, z, zl, P(-2.3525325722201997));
+				_horner_step_(d, dl, z, zl, P(1.));
+				P q = n / d, ph, pl;
+				two_prod(q, d, ph, pl);
+				P central = y * (q + (((n - ph) - pl) + (nl - q * dl)) / d);
+
+				//s = √(-log(qq(2 - qq)))の有理関数による初期値
+				//s < 3: R(s - s0)(s0 = √(-log(3/4)), 相対誤差 1.8e-9), s >= 3: sR(1/s)(2.2e-9)
+				static const double num[2][6] = {
+					{ 0.47693627707666647, 0.7391549364800625, -0.1705666186510584, 0.1962929126135336, -0.006410563794058299, 0.013100515440485879 },
+					{ 1.000033408654372, 17.939047847516058, -5.472760009163181, -124.6917205747142, 89.86899144484445, -128.48689867462897 }
+				};
+				static const double den[2][6] = {
+					{ 1., -0.32701220830639827, 0.2219023712179459, -0.01346420151022065, 0.012918144125552068, 2.72566725573492e-05 },
+					{ 1., 17.946806071965614, -3.4576020411678656, -110.99997367607797, 30.783160716229773, -96.00727369087407 }
+				};
+				P s = sqrt(-elementary::_log_(qq * (2. - qq)));
+				typename P::mask_type mid = s < 3.;
+				P t = select(mid, s - 0.5363600213026516, 1. / s);
+				P pn = select(mid, P(num[0][5]), P(num[1][5])), pd = select(mid, P(den[0][5]), P(den[1][5]));
+				for (size_t i = 5; i-- > 0;) {
+					pn = pn * t + select(mid, P(num[0][i]), P(num[1][i]));
+					pd = pd * t + select(mid, P(den[0][i]), P(den[1][i]));
+				}
+				P x = pn / pd * select(mid, P(1.), s);
+
+				//log erfc(x) - log qq = log erfcx(x) - x^2 - log qqの零点へのNewton法(x^2とlog qqの相殺はdouble-doubleで扱う)
+				//初期値はx >= erfinv(1/2) ≒ 0.477であるため, erfcxはx < 1/2の分岐を持たない_erfcx_large_で求める(1/2未満への僅かな外挿は下のerfの残差を用いる側に限られる)
+				P e = _erfcx_large_(x), h, l, lh, ll;
+				two_prod(x, x, h, l);
+				elementary::_log_ext_(qq, lh, ll);
+				P f = (elementary::_log_(e) - (h + lh)) - (l + ll);
+				P by_log = x + f * e * 0.886226925452758;
+				//|y| < 3/4ではerfcxの誤差がそのまま数ulpとなるため, erfc(x) - qq = (1 - qq) - erf(x)をerfのdouble-doubleの値から求める
+				//(e^(x^2)は初期値の精度でerfcx(x)/qqに等しい)
+				P eh, el, oh, ol;
+				_erf_small_ext_(x, eh, el);
+				two_sum(P(1.), -qq, oh, ol);
+				P by_erf = x + (((oh - eh) + ol) - el) * (e / qq) * 0.886226925452758;
+
+				const P inf = bit_cast<double>(0x7FF0000000000000ull);
+				P result = select(qq == 0., inf, select(qq > 0.25, by_erf, by_log));
+				result = select(y < 0., -result, result);
+				result = select(abs(y) < 0.5, central, result);
+				return select(qq >= 0., result, P(bit_cast<double>(0x7FF8000000000000ull)));
+			}
+			//逆誤差関数
+			template <class P>
+			static P _erfinv_(const P& y) { return _inverse_(y, 1. - abs(y)); }
+			//逆相補誤差関数
+			template <class P>
+			static P _erfcinv_(const P& q) { return _inverse_(1. - q, select(q > 1., 2. - q, q)); }
+
+			//標準正規分布の累積分布関数Φ(x) = erfc(-x/√2)/2(-x/√2をdouble-doubleで計算して下側の裾の相対精度を保つ)
+			template <class P>
+			static P _normal_cdf_(const P& x) {
+				P zh, zl;
+				two_prod(x, P(-0.7071067811865476), zh, zl);
+				return 0.5 * _erfc_(zh, zl + x * 4.833646656726457e-17);
+			}
+			//標準正規分布の分位関数Φ^-1(p) = -√2 erfcinv(2p)
+			template <class P>
+			static P _normal_quantile_(const P& p) { return _erfcinv_(2. * p) * -1.4142135623730951; }
+		};
+
+
+		//float(倍精度のカーネルで計算)
+		template <>
+		struct Erf_kernel_impl<float> {
+			struct erf_kernel {
+				template <class P>
+				P operator()(const P& x) const { return Erf_kernel_impl<double>::_erf_(x); }
+			};
+			struct erfc_kernel {
+				template <class P>
+				P operator()(const P& x) const { return Erf_kernel_impl<double>::_erfc_(x); }
+			};
+			struct erfcx_kernel {
+				template <class P>
+				P operator()(const P& x) const { return Erf_kernel_impl<double>::_erfcx_(x); }
+			};
+			struct erfinv_kernel {
+				template <class P>
+				P operator()(const P& x) const { return Erf_kernel_impl<double>::_erfinv_(x); }
+			};
+			struct erfcinv_kernel {
+				template <class P>
+				P operator()(const P& x) const { return Erf_kernel_impl<double>::_erfcinv_(x); }
+			};
+			struct normal_cdf_kernel {
+				template <class P>
+				P operator()(const P& x) const { return Erf_kernel_impl<double>::_normal_cdf_(x); }
+			};
+			struct normal_quantile_kernel {
+				template <class P>
+				P operator()(const P& x) const { return Erf_kernel_impl<double>::_normal_quantile_(x); }
+			};
+
+			template <class P>
+			static P _erf_(const P& x) { return Elementary_kernel_impl<float>::_promote_(x, erf_kernel()); }
+			template <class P>
+			static P _erfc_(const P& x) { return Elementary_kernel_impl<float>::_promote_(x, erfc_kernel()); }
+			template <class P>
+			static P _erfcx_(const P& x) { return Elementary_kernel_impl<float>::_promote_(x, erfcx_kernel()); }
+			template <class P>
+			static P _erfinv_(const P& x) { return Elementary_kernel_impl<float>::_promote_(x, erfinv_kernel()); }
+			template <class P>
+			static P _erfcinv_(const P& x) { return Elementary_kernel_impl<float>::_promote_(x, erfcinv_kernel()); }
+			template <class P>
+			static P _normal_cdf_(const P& x) { return Elementary_kernel_impl<float>::_promote_(x, normal_cdf_kernel()); }
+			template <class P>
+			static P _normal_quantile_(const P& x) { return Elementary_kernel_impl<float>::_promote_(x, normal_quantile_kernel()); }
+		};
+	}
+
+
+	//スカラーに対する実行時カーネル
+	template <class T>
+	struct Erf_kernel {
+		using impl = simd::Erf_kernel_impl<T>;
+		using pack_type = simd::pack<T, 1>;
+
+		static T _erf_(T x) { return impl::_erf_(pack_type(x)).v; }
+		static T _erfc_(T x) { return impl::_erfc_(pack_type(x)).v; }
+		static T _erfcx_(T x) { return impl::_erfcx_(pack_type(x)).v; }
+		static T _erfinv_(T x) { return impl::_erfinv_(pack_type(x)).v; }
+		static T _erfcinv_(T x) { return impl::_erfcinv_(pack_type(x)).v; }
+		static T _normal_cdf_(T x) { return impl::_normal_cdf_(pack_type(x)).v; }
+		static T _normal_quantile_(T x) { return impl::_normal_quantile_(pack_type(x)).v; }
+	};
+}
+IMATH_FP_CONTRACT_POP
+
+
+#endif
\ No newline at end of file
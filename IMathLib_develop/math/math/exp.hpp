@@ -4,6 +4,7 @@
 #include "IMathLib/math/math/math_traits.hpp"
 #include "IMathLib/math/math/e.hpp"
 #include "IMathLib/math/math/ipow.hpp"
+#include "IMathLib/math/math/elementary_kernel.hpp"
 
 namespace iml {
 
@@ -33,9 +34,16 @@ namespace iml {
 			}
 			return _ipow_(x2)*ipow(e<result_type>, index);
 		}
-		static constexpr result_type _exp_(const T& x) {
+		static constexpr result_type _exp_(const T& x, false_type) {
 			return (x < 0) ? 1 / _exp_impl_(-x) : _exp_impl_(x);
 		}
+		//実行時はカーネルで計算
+		static constexpr result_type _exp_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _exp_(x, false_type()) : Elementary_kernel<result_type>::_exp_(static_cast<result_type>(x));
+		}
+		static constexpr result_type _exp_(const T& x) {
+			return _exp_(x, is_elementary_kernel_type<result_type>());
+		}
 	};
 	template <>
 	struct Exp<size_t> {
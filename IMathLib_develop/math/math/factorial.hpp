@@ -6,40 +6,109 @@
 
 namespace iml {
 
+	//size_tでオーバーフローしない階乗の個数
+	inline constexpr size_t __fact_table_size() {
+		size_t n = 0, f = 1;
+		while (f <= (numeric_traits<size_t>::max)() / (n + 1)) f *= ++n;
+		return n + 1;
+	}
+	//size_tでオーバーフローしない二重階乗の個数
+	inline constexpr size_t __double_fact_table_size() {
+		size_t n = 2, f[2] = { 1, 1 };
+		while (f[n & 1] <= (numeric_traits<size_t>::max)() / n) f[n & 1] *= n, ++n;
+		return n;
+	}
+	//浮動小数点数でオーバーフローしない階乗の個数
+	inline constexpr size_t __real_fact_table_size() {
+		size_t n = 0;
+		for (IMATH_DEFAULT_FLOATING_POINT f = 1; f <= (numeric_traits<IMATH_DEFAULT_FLOATING_POINT>::max)() / (n + 1); f *= ++n);
+		return n + 1;
+	}
+
+	//階乗と二重階乗のテーブル(コンパイル時に構築)
+	struct Factorial_table {
+		static constexpr size_t fact_size = __fact_table_size();
+		static constexpr size_t double_fact_size = __double_fact_table_size();
+		static constexpr size_t real_fact_size = __real_fact_table_size();
+
+		size_t fact[fact_size];
+		size_t double_fact[double_fact_size];
+		IMATH_DEFAULT_FLOATING_POINT real_fact[real_fact_size];
+
+		constexpr Factorial_table() : fact{}, double_fact{}, real_fact{} {
+			fact[0] = 1;
+			for (size_t i = 1; i < fact_size; ++i) fact[i] = fact[i - 1] * i;
+			double_fact[0] = double_fact[1] = 1;
+			for (size_t i = 2; i < double_fact_size; ++i) double_fact[i] = double_fact[i - 2] * i;
+			real_fact[0] = 1;
+			for (size_t i = 1; i < real_fact_size; ++i) real_fact[i] = real_fact[i - 1] * i;
+		}
+	};
+	inline constexpr Factorial_table factorial_table{};
+
+
+	template <class UIntegral>
+	struct Factorial {
+		//汎用
+		static constexpr UIntegral _fact_(const UIntegral& x, false_type) {
+			UIntegral result = 1;
+			for (UIntegral i = x; i > 1; i = i - 1) result = result * i;
+			return result;
+		}
+		static constexpr UIntegral _double_fact_(const UIntegral& x, false_type) {
+			UIntegral result = 1;
+			for (UIntegral i = x; i > 1; i = i - 2) result = result * i;
+			return result;
+		}
+		static constexpr UIntegral _multi_fact_(size_t n, const UIntegral& x, false_type) {
+			UIntegral result = 1;
+			for (UIntegral i = x; i > 1; i = (i > n) ? UIntegral(i - n) : UIntegral(0)) result = result * i;
+			return result;
+		}
+		//テーブル参照(負の値はsize_tへの変換で表の大きさを超えるため汎用の計算に回る)
+		static constexpr UIntegral _fact_(const UIntegral& x, true_type) {
+			return (size_t(x) < factorial_table.fact_size) ? UIntegral(factorial_table.fact[size_t(x)]) : _fact_(x, false_type());
+		}
+		static constexpr UIntegral _double_fact_(const UIntegral& x, true_type) {
+			return (size_t(x) < factorial_table.double_fact_size) ? UIntegral(factorial_table.double_fact[size_t(x)]) : _double_fact_(x, false_type());
+		}
+		static constexpr UIntegral _multi_fact_(size_t n, const UIntegral& x, true_type) {
+			return (n == 1) ? _fact_(x, true_type()) : (n == 2) ? _double_fact_(x, true_type()) : _multi_fact_(n, x, false_type());
+		}
+
+		static constexpr UIntegral _fact_(const UIntegral& x) { return _fact_(x, is_integral<UIntegral>()); }
+		static constexpr UIntegral _double_fact_(const UIntegral& x) { return _double_fact_(x, is_integral<UIntegral>()); }
+		static constexpr UIntegral _multi_fact_(size_t n, const UIntegral& x) { return _multi_fact_(n, x, is_integral<UIntegral>()); }
+	};
+
 	//階乗(基本的に符号無し整数)
 	template <class UIntegral>
 	inline constexpr UIntegral fact(const UIntegral& x) {
-		if (x == 0) return 1;
-		return x * fact(x - 1);
+		return Factorial<UIntegral>::_fact_(x);
 	}
 	template <class UIntegral, class T>
 	inline constexpr T fact(const UIntegral& x, const T& init) {
-		if (x == 0) return init;
-		return init * x * fact(x - 1);
+		return init * fact(x);
 	}
 
 	//二重階乗(基本的に符号無し整数)
 	template <class UIntegral>
 	inline constexpr UIntegral double_fact(const UIntegral& x) {
-		if (x <= 2) return x;
-		return x * double_fact(x - 2);
+		return Factorial<UIntegral>::_double_fact_(x);
 	}
 	template <class UIntegral, class T>
 	inline constexpr T double_fact(const UIntegral& x, const T& init) {
-		if (x <= 2) return x * init;
-		return init * x * double_fact(x - 2);
+		return init * double_fact(x);
 	}
 
 	//多重階乗(基本的に符号無し整数)
 	template <class UIntegral>
 	inline constexpr UIntegral multi_fact(size_t n, const UIntegral& x) {
-		if (x <= n) return x;
-		return x * multi_fact(n, x - 2);
+		return Factorial<UIntegral>::_multi_fact_(n, x);
 	}
 	template <class UIntegral, class T>
 	inline constexpr UIntegral multi_fact(size_t n, const UIntegral& x, const T& init) {
-		if (x <= n) return x * init;
-		return init * x * multi_fact(n, x - 2);
+		return init * multi_fact(n, x);
 	}
 }
 
@@ -7,28 +7,53 @@
 #include "IMathLib/math/math/log.hpp"
 #include "IMathLib/math/math/sgn.hpp"
 #include "IMathLib/math/math/pow.hpp"
+#include "IMathLib/math/math/rounding_kernel.hpp"
 #include "IMathLib/utility/tuple.hpp"
 
 namespace iml {
 
+	//指数部と仮数部に分解する(2進数, x = a*2^n (0.5 <= |a| < 1), ±0, 無限大, NaNはn = 0)
+	template <class T>
+	struct Frexp2 {
+		static constexpr pair<T, int_t> _frexp2_(const T& x, false_type) {
+			if (x == 0 || !(x - x == 0)) return pair<T, int_t>(x, 0);
+			T a = (x < 0) ? -x : x;
+			int_t n = 0;
+			while (a >= 65536) { a /= 65536; n += 16; }
+			while (a >= 1) { a /= 2; ++n; }
+			while (a < T(1) / 65536) { a *= 65536; n -= 16; }
+			while (a < T(0.5)) { a *= 2; --n; }
+			return pair<T, int_t>((x < 0) ? -a : a, n);
+		}
+		static constexpr pair<T, int_t> _frexp2_(const T& x, true_type) {
+			if (IMATH_IS_CONSTANT_EVALUATED()) return _frexp2_(x, false_type());
+			int_t n = 0;
+			T a = Rounding_kernel<T>::_frexp_(x, n);
+			return pair<T, int_t>(a, n);
+		}
+		static constexpr pair<T, int_t> _frexp2_(const T& x) { return _frexp2_(x, is_rounding_kernel_type<T>()); }
+	};
+	template <class T>
+	inline constexpr auto frexp2(const T& x) { return Frexp2<T>::_frexp2_(x); }
+
 	//指数部と仮数部に分解する(10進数)
 	inline constexpr pair<float, int_t> frexp10(float x) {
 		float temp = log10(abs(x));
-		int_t n = floor_integer(temp) - (temp < 0);
+		int_t n = floor_integer(temp);
 		float a = pow(10.f, temp - n);
 
 		return pair<float, int_t>(sgn(x)*a, n);
 	}
 	inline constexpr pair<double, int_t> frexp10(double x) {
 		double temp = log10(abs(x));
-		int_t n = floor_integer(temp) - (temp < 0);
+		int_t n = floor_integer(temp);
 		double a = pow(10.f, temp - n);
 
 		return pair<double, int_t>(sgn(x)*a, n);
 	}
 	inline constexpr pair<long double, int_t> frexp10(long double x) {
 		long double temp = log10(abs(x));
-		int_t n = floor_integer(temp) - (temp < 0);
+		int_t n = floor_integer(temp);
 		long double a = pow(10.f, temp - n);
 
 		return pair<long double, int_t>(sgn(x)*a, n);
@@ -8,6 +8,7 @@
 #include "IMathLib/math/math/exp.hpp"
 #include "IMathLib/math/math/pow.hpp"
 #include "IMathLib/math/math/trigonometric_function.hpp"
+#include "IMathLib/math/math/gamma_kernel.hpp"
 
 namespace iml {
 
@@ -16,7 +17,7 @@ namespace iml {
 	struct Lgamma {
 		using result_type = typename math_function_type<T>::type;
 		//x >= 0 を仮定
-		static constexpr result_type _lgamma_(result_type x) {
+		static constexpr result_type _lgamma_(result_type x, false_type) {
 			constexpr result_type log_const = log(2 * pi<result_type>) / 2;
 
 			result_type k = 1;
@@ -27,7 +28,7 @@ namespace iml {
 			result_type x1 = 1 / x, x2 = 1 / (6 * x), x3 = 0;
 			result_type w = x * x;
 
-			for (size_t i = 2; !error_evaluation(x2, x3) && (IMATH_BERNOULLI_NUMBER_TABLE >= 2 * i); ++i) {
+			for (size_t i = 2; !error_evaluation(x2, x3) && (IMATH_BERNOULLI_NUMBER_TABLE > 2 * i); ++i) {
 				x3 = x2;
 				x1 /= w;
 				x2 += x1 * bernoulli_number_table<IMATH_BERNOULLI_NUMBER_TABLE, result_type>::b[2 * i] / (i*(2 * i - 1));
@@ -35,6 +36,13 @@ namespace iml {
 			//kの補正を入れる
 			return (log_const - x + (x - 0.5)*log(x) + x2 / 2 - log(k));
 		}
+		//実行時はLanczos近似のカーネルで計算
+		static constexpr result_type _lgamma_(result_type x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _lgamma_(x, false_type()) : Gamma_kernel<result_type>::_lgamma_(x);
+		}
+		static constexpr result_type _lgamma_(result_type x) {
+			return _lgamma_(x, is_elementary_kernel_type<result_type>());
+		}
 	};
 	template <class T>
 	inline constexpr auto lgamma(const T& x) { return Lgamma<T>::_lgamma_(x); }
@@ -45,12 +53,19 @@ namespace iml {
 	struct Gamma {
 		using result_type = typename math_function_type<T>::type;
 
-		static constexpr result_type _gamma_(const T& x) {
+		static constexpr result_type _gamma_(const T& x, false_type) {
 			//xが負数であるとき相反公式で反転
 			return ((x < 0)
 				? pi<result_type> / (sin(pi<result_type> * x)*exp(lgamma(1 - x)))
 				: exp(lgamma(x)));
 		}
+		//実行時はLanczos近似のカーネルで計算
+		static constexpr result_type _gamma_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _gamma_(x, false_type()) : Gamma_kernel<result_type>::_gamma_(static_cast<result_type>(x));
+		}
+		static constexpr result_type _gamma_(const T& x) {
+			return _gamma_(x, is_elementary_kernel_type<result_type>());
+		}
 	};
 	template <class T>
 	inline constexpr auto gamma(const T& x) { return Gamma<T>::_gamma_(x); }
@@ -87,15 +102,22 @@ namespace iml {
 			}
 			return x2 * exp(-x)*pow(x, a);
 		}
-		static constexpr result_type _gamma1_(const T& a, const T& x) {
+		static constexpr result_type _gamma1_(const T& a, const T& x, const result_type& ga, false_type) {
 			if (x == 0) return 0;
-			return ((x >= 1 + a) ? gamma(a) - _gamma2_impl_(a, x) : _gamma1_impl_(a, x));
+			return ((x >= 1 + a) ? ga - _gamma2_impl_(a, x) : _gamma1_impl_(a, x));
+		}
+		//実行時は正規化不完全ガンマ関数のカーネルで計算
+		static constexpr result_type _gamma1_(const T& a, const T& x, const result_type& ga, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _gamma1_(a, x, ga, false_type())
+				: Gamma_kernel<result_type>::_gamma_p_(static_cast<result_type>(a), static_cast<result_type>(x)) * ga;
+		}
+		static constexpr result_type _gamma1_(const T& a, const T& x) {
+			return _gamma1_(a, x, gamma(a), is_elementary_kernel_type<result_type>());
 		}
 
 		//ガンマ関数値が渡された場合のものを定義
 		static constexpr result_type _gamma1_(const T& a, const T& x, const result_type& ga) {
-			if (x == 0) return 0;
-			return ((x >= 1 + a) ? ga - _gamma2_impl_(a, x) : _gamma1_impl_(a, x));
+			return _gamma1_(a, x, ga, is_elementary_kernel_type<result_type>());
 		}
 	};
 	template <class T>
@@ -133,13 +155,21 @@ namespace iml {
 			}
 			return x2 * exp(-x)*pow(x, a);
 		}
+		static constexpr result_type _gamma2_(const T& a, const T& x, const result_type& ga, false_type) {
+			return ((x < 1 + a) ? ga - _gamma1_impl_(a, x) : _gamma2_impl_(a, x));
+		}
+		//実行時は正規化不完全ガンマ関数のカーネルで計算
+		static constexpr result_type _gamma2_(const T& a, const T& x, const result_type& ga, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _gamma2_(a, x, ga, false_type())
+				: Gamma_kernel<result_type>::_gamma_q_(static_cast<result_type>(a), static_cast<result_type>(x)) * ga;
+		}
 		static constexpr result_type _gamma2_(const T& a, const T& x) {
-			return ((x < 1 + a) ? gamma(a) - _gamma1_impl_(a, x) : _gamma2_impl_(a, x));
+			return _gamma2_(a, x, gamma(a), is_elementary_kernel_type<result_type>());
 		}
 
 		//ガンマ関数値が渡された場合のものを定義
 		static constexpr result_type _gamma2_(const T& a, const T& x, const result_type& ga) {
-			return ((x < 1 + a) ? ga - _gamma1_impl_(a, x) : _gamma2_impl_(a, x));
+			return _gamma2_(a, x, ga, is_elementary_kernel_type<result_type>());
 		}
 	};
 	template <class T>
@@ -148,19 +178,47 @@ namespace iml {
 
 	//第1種不完全ガンマ関数による正規化ガンマ関数
 	template <class T>
-	inline constexpr auto gamma_p(const T& a, const T& x) {
-		if (a == 0) return static_cast<typename Gamma1<T>::result_type>(1);
-		auto temp = gamma(a);
-		return Gamma1<T>::_gamma1_(a, x, temp) / temp;
-	}
+	struct Gamma_p {
+		using result_type = typename math_function_type<T>::type;
+
+		static constexpr result_type _gamma_p_(const T& a, const T& x, false_type) {
+			auto temp = gamma(a);
+			return Gamma1<T>::_gamma1_(a, x, temp, false_type()) / temp;
+		}
+		//実行時はガンマ関数を経由せずカーネルで直接計算
+		static constexpr result_type _gamma_p_(const T& a, const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _gamma_p_(a, x, false_type())
+				: Gamma_kernel<result_type>::_gamma_p_(static_cast<result_type>(a), static_cast<result_type>(x));
+		}
+		static constexpr result_type _gamma_p_(const T& a, const T& x) {
+			if (a == 0) return 1;
+			return _gamma_p_(a, x, is_elementary_kernel_type<result_type>());
+		}
+	};
+	template <class T>
+	inline constexpr auto gamma_p(const T& a, const T& x) { return Gamma_p<T>::_gamma_p_(a, x); }
 
 	//第2種不完全ガンマ関数による正規化ガンマ関数
 	template <class T>
-	inline constexpr auto gamma_q(const T& a, const T& x) {
-		if (a == 0) return static_cast<typename Gamma2<T>::result_type>(0);
-		auto temp = gamma(a);
-		return Gamma2<T>::_gamma2_(a, x, temp) / temp;
-	}
+	struct Gamma_q {
+		using result_type = typename math_function_type<T>::type;
+
+		static constexpr result_type _gamma_q_(const T& a, const T& x, false_type) {
+			auto temp = gamma(a);
+			return Gamma2<T>::_gamma2_(a, x, temp, false_type()) / temp;
+		}
+		//実行時はガンマ関数を経由せずカーネルで直接計算
+		static constexpr result_type _gamma_q_(const T& a, const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _gamma_q_(a, x, false_type())
+				: Gamma_kernel<result_type>::_gamma_q_(static_cast<result_type>(a), static_cast<result_type>(x));
+		}
+		static constexpr result_type _gamma_q_(const T& a, const T& x) {
+			if (a == 0) return 0;
+			return _gamma_q_(a, x, is_elementary_kernel_type<result_type>());
+		}
+	};
+	template <class T>
+	inline constexpr auto gamma_q(const T& a, const T& x) { return Gamma_q<T>::_gamma_q_(a, x); }
 
 
 	//ディガンマ関数
@@ -177,7 +235,7 @@ namespace iml {
 			//B[2]=1/6
 			result_type x1 = 1 / w, x2 = 1 / (6 * w), x3 = 0;
 
-			for (size_t i = 2; !error_evaluation(x2, x3) && (IMATH_BERNOULLI_NUMBER_TABLE >= 2 * i); ++i) {
+			for (size_t i = 2; !error_evaluation(x2, x3) && (IMATH_BERNOULLI_NUMBER_TABLE > 2 * i); ++i) {
 				x3 = x2;
 				x1 /= w;
 				x2 += x1*bernoulli_number_table<IMATH_BERNOULLI_NUMBER_TABLE, result_type>::b[2 * i] / i;
@@ -185,12 +243,19 @@ namespace iml {
 			//kの補正を入れる
 			return (log(x) - 1 / (2 * x) - x2 / 2 - k);
 		}
-		static constexpr result_type _digamma_(const T& x) {
+		static constexpr result_type _digamma_(const T& x, false_type) {
 			//xが負数であるとき相反公式で反転
 			return ((x < 0)
 				? _digamma_impl_(1 - x) - pi<result_type> / tan(pi<result_type> * x)
 				: _digamma_impl_(x));
 		}
+		//実行時は固定回数のシフトによるカーネルで計算
+		static constexpr result_type _digamma_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _digamma_(x, false_type()) : Gamma_kernel<result_type>::_digamma_(static_cast<result_type>(x));
+		}
+		static constexpr result_type _digamma_(const T& x) {
+			return _digamma_(x, is_elementary_kernel_type<result_type>());
+		}
 	};
 	template <class T>
 	inline constexpr auto digamma(const T& x) { return Digamma<T>::_digamma_(x); }
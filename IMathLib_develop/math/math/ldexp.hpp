@@ -2,16 +2,18 @@
 #define IMATH_MATH_MATH_LDEXP_HPP
 
 #include "IMathLib/IMathLib_config.hpp"
+#include "IMathLib/math/math/rounding_kernel.hpp"
 
 namespace iml {
 
 	//指数部と仮数部から浮動小数点を復元
+	//実行時は指数部のビット操作により, 定数式では2^16または2^64単位の乗算の繰り返しにより求める
 	template <class>
 	struct Ldexp2;
 	template <>
 	struct Ldexp2<float> {
 		template <class Int>
-		static constexpr float _ldexp2_(float x, Int n) {
+		static constexpr float _ldexp2_(float x, Int n, false_type) {
 			constexpr float lshift = uint16_t(-1) + 1.f;
 			constexpr float rshift = 1.f / lshift;
 
@@ -31,11 +33,17 @@ namespace iml {
 			}
 			return x;
 		}
+		template <class Int>
+		static constexpr float _ldexp2_(float x, Int n, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _ldexp2_(x, n, false_type()) : Rounding_kernel<float>::_ldexp_(x, static_cast<int_t>(n));
+		}
+		template <class Int>
+		static constexpr float _ldexp2_(float x, Int n) { return _ldexp2_(x, n, is_rounding_kernel_type<float>()); }
 	};
 	template <>
 	struct Ldexp2<double> {
 		template <class Int>
-		static constexpr double _ldexp2_(double x, Int n) {
+		static constexpr double _ldexp2_(double x, Int n, false_type) {
 			constexpr double lshift = uint64_t(-1) + 1.;
 			constexpr double rshift = 1. / lshift;
 
@@ -55,11 +63,17 @@ namespace iml {
 			}
 			return x;
 		}
+		template <class Int>
+		static constexpr double _ldexp2_(double x, Int n, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _ldexp2_(x, n, false_type()) : Rounding_kernel<double>::_ldexp_(x, static_cast<int_t>(n));
+		}
+		template <class Int>
+		static constexpr double _ldexp2_(double x, Int n) { return _ldexp2_(x, n, is_rounding_kernel_type<double>()); }
 	};
 	template <>
 	struct Ldexp2<long double> {
 		template <class Int>
-		static constexpr long double _ldexp2_(long double x, Int n) {
+		static constexpr long double _ldexp2_(long double x, Int n, false_type) {
 			constexpr long double lshift = uint64_t(-1) + 1.l;
 			constexpr long double rshift = 1.l / lshift;
 
@@ -79,6 +93,12 @@ namespace iml {
 			}
 			return x;
 		}
+		template <class Int>
+		static constexpr long double _ldexp2_(long double x, Int n, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _ldexp2_(x, n, false_type()) : Rounding_kernel<long double>::_ldexp_(x, static_cast<int_t>(n));
+		}
+		template <class Int>
+		static constexpr long double _ldexp2_(long double x, Int n) { return _ldexp2_(x, n, is_rounding_kernel_type<long double>()); }
 	};
 	template <class T, class Int>
 	inline constexpr auto ldexp2(T x, Int n) { return Ldexp2<T>::_ldexp2_(x, n); }
@@ -3,6 +3,7 @@
 
 #include "IMathLib/math/math/math_traits.hpp"
 #include "IMathLib/math/math/ln2.hpp"
+#include "IMathLib/math/math/elementary_kernel.hpp"
 
 namespace iml {
 
@@ -44,11 +45,18 @@ namespace iml {
 			}
 			return 2 * x2 + index * ln2<result_type>;
 		}
-		static constexpr result_type _log_(const T& x) {
+		static constexpr result_type _log_(const T& x, false_type) {
 			if (x == 0) return numeric_traits<result_type>::positive_infinity();
 			//xを1以上にする
 			return (x < 1) ? (-_log_impl_(1 / x)) : _log_impl_(x);
 		}
+		//実行時はカーネルで計算
+		static constexpr result_type _log_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _log_(x, false_type()) : Elementary_kernel<result_type>::_log_(static_cast<result_type>(x));
+		}
+		static constexpr result_type _log_(const T& x) {
+			return _log_(x, is_elementary_kernel_type<result_type>());
+		}
 	};
 	template <class T>
 	inline constexpr auto log(const T& x) { return Log<T>::_log_(x); }
@@ -2,19 +2,53 @@
 #define IMATH_MATH_MATH_NUMERICAL_CORRECTION_HPP
 
 #include "IMathLib/math/math/math_traits.hpp"
+#include "IMathLib/math/math/rounding_kernel.hpp"
 
 //数値補正系関数
+//float, doubleの実行時はビット操作による実装(rounding_kernel.hpp)を利用し, 定数式ではループ回数が仮数部のビット数で抑えられる算術演算による実装を利用する
 
 namespace iml {
 
+	//|x|の整数部(NaN, x + 1 == xとなる既に整数の|x|, 無限大はそのまま)
+	//2の冪の和として上位の桁から求めるため加算は全て誤差なく行われる
+	template <class T>
+	inline constexpr T __trunc_abs(const T& ax) {
+		if (!(ax == ax) || ax + 1 == ax) return ax;
+		if (ax < 1) return T(0);
+		T p = 1, t = 0;
+		while (p * 2 <= ax) p *= 2;
+		for (; p >= 1; p /= 2) if (t + p <= ax) t += p;
+		return t;
+	}
+	//|x|に対する丸めの結果rにxの符号を付与する(±0はxの符号を保つ)
+	template <class T>
+	inline constexpr T __rounding_sign(const T& x, const T& r) {
+		return (r == 0) ? x * 0 : ((x < 0) ? -r : r);
+	}
+	template <class T>
+	inline constexpr T __trunc(const T& x) {
+		return __rounding_sign(x, __trunc_abs((x < 0) ? -x : x));
+	}
+
+
 	//床関数(切り捨て)
-	template<class>
-	struct Floor;
+	//浮動小数点型の場合
+	template <class T>
+	struct Floor {
+		static constexpr T _floor_(const T& x, false_type) {
+			T t = __trunc(x);
+			return (t > x) ? t - 1 : t;
+		}
+		static constexpr T _floor_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _floor_(x, false_type()) : Rounding_kernel<T>::_floor_(x);
+		}
+		static constexpr T _floor_(const T& x) { return _floor_(x, is_rounding_kernel_type<T>()); }
+	};
 	//整数のとき
 #define IMATH_FLOOR(TYPE)\
 	template<>\
 	struct Floor<TYPE> {\
-		static constexpr bool _floor_(TYPE x) { return x; }\
+		static constexpr TYPE _floor_(TYPE x) { return x; }\
 	};
 	IMATH_FLOOR(bool);
 	IMATH_FLOOR(char);
@@ -31,125 +65,32 @@ namespace iml {
 	IMATH_FLOOR(long long);
 	IMATH_FLOOR(unsigned long long);
 #undef IMATH_FLOOR
-	//浮動小数点型の場合
-	template<>
-	struct Floor<float> {
-		static constexpr float _floor_(float x) {
-			float result = 0;
-
-			//xが正のとき
-			while (x >= 1) {
-				//size_tの上限を超えている場合
-				if (x > (numeric_traits<size_t>::max)()) {
-					x -= (numeric_traits<size_t>::max)();
-					result += (numeric_traits<size_t>::max)();
-				}
-				else {
-					result += static_cast<size_t>(x);
-					break;
-				}
-			}
-			//xが負のとき
-			x = -x;				//符号反転
-			while (x >= 1) {
-				//size_tの上限を超えている場合(+1は必ずelseを通して終了させるため)
-				if (x > (numeric_traits<size_t>::max)() + 1.0f) {
-					x -= (numeric_traits<size_t>::max)();
-					result -= (numeric_traits<size_t>::max)();
-				}
-				else {
-					result -= static_cast<size_t>(x) + 1.0f;
-					break;
-				}
-			}
-
-			return result;
-		}
-	};
-	template<>
-	struct Floor<double> {
-		static constexpr double _floor_(double x) {
-			double result = 0;
-
-			//xが正のとき
-			while (x >= 1) {
-				//size_tの上限を超えている場合
-				if (x > (numeric_traits<size_t>::max)()) {
-					x -= (numeric_traits<size_t>::max)();
-					result += (numeric_traits<size_t>::max)();
-				}
-				else {
-					result += static_cast<size_t>(x);
-					break;
-				}
-			}
-			//xが負のとき
-			x = -x;				//符号反転
-			while (x >= 1) {
-				//size_tの上限を超えている場合(+1は必ずelseを通して終了させるため)
-				if (x > (numeric_traits<size_t>::max)() + 1.0) {
-					x -= (numeric_traits<size_t>::max)();
-					result -= (numeric_traits<size_t>::max)();
-				}
-				else {
-					result -= static_cast<size_t>(x) + 1.0;
-					break;
-				}
-			}
-
-			return result;
-		}
-	};
-	template<>
-	struct Floor<long double> {
-		static constexpr long double _floor_(long double x) {
-			long double result = 0;
-
-			//xが正のとき
-			while (x >= 1) {
-				//size_tの上限を超えている場合
-				if (x > (numeric_traits<size_t>::max)()) {
-					x -= (numeric_traits<size_t>::max)();
-					result += (numeric_traits<size_t>::max)();
-				}
-				else {
-					result += static_cast<size_t>(x);
-					break;
-				}
-			}
-			//xが負のとき
-			x = -x;				//符号反転
-			while (x >= 1) {
-				//size_tの上限を超えている場合(+1は必ずelseを通して終了させるため)
-				if (x > (numeric_traits<size_t>::max)() + 1.0) {
-					x -= (numeric_traits<size_t>::max)();
-					result -= (numeric_traits<size_t>::max)();
-				}
-				else {
-					result -= static_cast<size_t>(x) + 1.0;
-					break;
-				}
-			}
-
-			return result;
-		}
-	};
 	template <class T>
 	inline constexpr auto floor(const T& x) { return Floor<T>::_floor_(x); }
 
 	//整数値として結果を得る
 	template <class T>
-	inline constexpr int_t floor_integer(const T& x) { return static_cast<int_t>(floor(x) + 0.1); }
+	inline constexpr int_t floor_integer(const T& x) { return static_cast<int_t>(floor(x)); }
 
 
 	//天井関数(切り上げ)
-	template<class>
-	struct Ceil;
+	//浮動小数点型の場合
+	template <class T>
+	struct Ceil {
+		static constexpr T _ceil_(const T& x, false_type) {
+			T t = __trunc(x);
+			return (t < x) ? t + 1 : t;
+		}
+		static constexpr T _ceil_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _ceil_(x, false_type()) : Rounding_kernel<T>::_ceil_(x);
+		}
+		static constexpr T _ceil_(const T& x) { return _ceil_(x, is_rounding_kernel_type<T>()); }
+	};
 	//整数のとき
 #define IMATH_CEIL(TYPE)\
 	template<>\
 	struct Ceil<TYPE> {\
-		static constexpr bool _ceil_(TYPE x) { return x; }\
+		static constexpr TYPE _ceil_(TYPE x) { return x; }\
 	};
 	IMATH_CEIL(bool);
 	IMATH_CEIL(char);
@@ -166,125 +107,32 @@ namespace iml {
 	IMATH_CEIL(long long);
 	IMATH_CEIL(unsigned long long);
 #undef IMATH_CEIL
-	//浮動小数点型の場合
-	template<>
-	struct Ceil<float> {
-		static constexpr float _ceil_(float x) {
-			float result = 0;
-
-			//xが正のとき
-			while (x >= 1) {
-				//size_tの上限を超えている場合(+1は必ずelseを通して終了させるため)
-				if (x > (numeric_traits<size_t>::max)() + 1.0f) {
-					x -= (numeric_traits<size_t>::max)();
-					result += (numeric_traits<size_t>::max)();
-				}
-				else {
-					result += static_cast<size_t>(x) + 1.0f;
-					break;
-				}
-			}
-			//xが負のとき
-			x = -x;				//符号反転
-			while (x >= 1) {
-				//size_tの上限を超えている場合
-				if (x > (numeric_traits<size_t>::max)()) {
-					x -= (numeric_traits<size_t>::max)();
-					result -= (numeric_traits<size_t>::max)();
-				}
-				else {
-					result -= static_cast<size_t>(x);
-					break;
-				}
-			}
-
-			return result;
-		}
-	};
-	template<>
-	struct Ceil<double> {
-		static constexpr double _ceil_(double x) {
-			double result = 0;
-
-			//xが正のとき
-			while (x >= 1) {
-				//size_tの上限を超えている場合(+1は必ずelseを通して終了させるため)
-				if (x > (numeric_traits<size_t>::max)() + 1.0) {
-					x -= (numeric_traits<size_t>::max)();
-					result += (numeric_traits<size_t>::max)();
-				}
-				else {
-					result += static_cast<size_t>(x) + 1.0;
-					break;
-				}
-			}
-			//xが負のとき
-			x = -x;				//符号反転
-			while (x >= 1) {
-				//size_tの上限を超えている場合
-				if (x > (numeric_traits<size_t>::max)()) {
-					x -= (numeric_traits<size_t>::max)();
-					result -= (numeric_traits<size_t>::max)();
-				}
-				else {
-					result -= static_cast<size_t>(x);
-					break;
-				}
-			}
-
-			return result;
-		}
-	};
-	template<>
-	struct Ceil<long double> {
-		static constexpr long double _ceil_(long double x) {
-			long double result = 0;
-
-			//xが正のとき
-			while (x >= 1) {
-				//size_tの上限を超えている場合(+1は必ずelseを通して終了させるため)
-				if (x > (numeric_traits<size_t>::max)() + 1.0) {
-					x -= (numeric_traits<size_t>::max)();
-					result += (numeric_traits<size_t>::max)();
-				}
-				else {
-					result += static_cast<size_t>(x) + 1.0;
-					break;
-				}
-			}
-			//xが負のとき
-			x = -x;				//符号反転
-			while (x >= 1) {
-				//size_tの上限を超えている場合
-				if (x > (numeric_traits<size_t>::max)()) {
-					x -= (numeric_traits<size_t>::max)();
-					result -= (numeric_traits<size_t>::max)();
-				}
-				else {
-					result -= static_cast<size_t>(x);
-					break;
-				}
-			}
-
-			return result;
-		}
-	};
 	template <class T>
 	inline constexpr auto ceil(const T& x) { return Ceil<T>::_ceil_(x); }
 
 	//整数値として結果を得る
 	template <class T>
-	inline constexpr int_t ceil_integer(const T& x) { return static_cast<int_t>(ceil(x) + 0.1); }
+	inline constexpr int_t ceil_integer(const T& x) { return static_cast<int_t>(ceil(x)); }
 
 
-	//四捨五入
-	template<class>
-	struct Round;
+	//四捨五入(0.5は0から遠い方向へ丸める)
+	//浮動小数点型の場合
+	template <class T>
+	struct Round {
+		static constexpr T _round_(const T& x, false_type) {
+			T ax = (x < 0) ? -x : x, t = __trunc_abs(ax);
+			return __rounding_sign(x, (ax - t >= T(0.5)) ? t + 1 : t);
+		}
+		static constexpr T _round_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _round_(x, false_type()) : Rounding_kernel<T>::_round_(x);
+		}
+		static constexpr T _round_(const T& x) { return _round_(x, is_rounding_kernel_type<T>()); }
+	};
 	//整数のとき
 #define IMATH_ROUND(TYPE)\
 	template<>\
 	struct Round<TYPE> {\
-		static constexpr bool _round_(TYPE x) { return x; }\
+		static constexpr TYPE _round_(TYPE x) { return x; }\
 	};
 	IMATH_ROUND(bool);
 	IMATH_ROUND(char);
@@ -301,45 +149,121 @@ namespace iml {
 	IMATH_ROUND(long long);
 	IMATH_ROUND(unsigned long long);
 #undef IMATH_ROUND
-	//浮動小数点型の場合
-	template<>
-	struct Round<float> {
-		static constexpr float _round_(float x) { return (x < 0) ? ceil(x - 0.5f) : floor(x + 0.5f); }
-	};
-	template<>
-	struct Round<double> {
-		static constexpr double _round_(double x) { return (x < 0) ? ceil(x - 0.5) : floor(x + 0.5); }
-	};
-	template<>
-	struct Round<long double> {
-		static constexpr long double _round_(long double x) { return (x < 0) ? ceil(x - 0.5) : floor(x + 0.5); }
-	};
 	template <class T>
 	inline constexpr auto round(const T& x) { return Round<T>::_round_(x); }
 
 	//整数値として結果を得る
 	template <class T>
-	inline constexpr int_t round_integer(const T& x) { return static_cast<int_t>(round(x) + 0.1); }
+	inline constexpr int_t round_integer(const T& x) { return static_cast<int_t>(round(x)); }
+
+
+	//最近接偶数丸め
+	//浮動小数点型の場合
+	template <class T>
+	struct Nearbyint {
+		static constexpr T _nearbyint_(const T& x, false_type) {
+			T ax = (x < 0) ? -x : x, t = __trunc_abs(ax), d = ax - t;
+			//丁度中間のときは偶数側へ丸める
+			return __rounding_sign(x, (d > T(0.5) || (d == T(0.5) && __trunc_abs(t / 2) * 2 != t)) ? t + 1 : t);
+		}
+		static constexpr T _nearbyint_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _nearbyint_(x, false_type()) : Rounding_kernel<T>::_nearbyint_(x);
+		}
+		static constexpr T _nearbyint_(const T& x) { return _nearbyint_(x, is_rounding_kernel_type<T>()); }
+	};
+	//整数のとき
+#define IMATH_NEARBYINT(TYPE)\
+	template<>\
+	struct Nearbyint<TYPE> {\
+		static constexpr TYPE _nearbyint_(TYPE x) { return x; }\
+	};
+	IMATH_NEARBYINT(bool);
+	IMATH_NEARBYINT(char);
+	IMATH_NEARBYINT(unsigned char);
+	IMATH_NEARBYINT(wchar_t);
+	IMATH_NEARBYINT(short);
+	IMATH_NEARBYINT(unsigned short);
+	IMATH_NEARBYINT(int);
+	IMATH_NEARBYINT(unsigned int);
+	IMATH_NEARBYINT(long);
+	IMATH_NEARBYINT(unsigned long);
+	IMATH_NEARBYINT(char16_t);
+	IMATH_NEARBYINT(char32_t);
+	IMATH_NEARBYINT(long long);
+	IMATH_NEARBYINT(unsigned long long);
+#undef IMATH_NEARBYINT
+	template <class T>
+	inline constexpr auto nearbyint(const T& x) { return Nearbyint<T>::_nearbyint_(x); }
 
 
 	//0方向への丸め
+	//浮動小数点型の場合
 	template <class T>
 	struct Trunc {
-		static constexpr T _trunc_(const T& x) { return (x < 0) ? ceil(x) : floor(x); }
+		static constexpr T _trunc_(const T& x, false_type) {
+			return __trunc(x);
+		}
+		static constexpr T _trunc_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _trunc_(x, false_type()) : Rounding_kernel<T>::_trunc_(x);
+		}
+		static constexpr T _trunc_(const T& x) { return _trunc_(x, is_rounding_kernel_type<T>()); }
+	};
+	//整数のとき
+#define IMATH_TRUNC(TYPE)\
+	template<>\
+	struct Trunc<TYPE> {\
+		static constexpr TYPE _trunc_(TYPE x) { return x; }\
 	};
+	IMATH_TRUNC(bool);
+	IMATH_TRUNC(char);
+	IMATH_TRUNC(unsigned char);
+	IMATH_TRUNC(wchar_t);
+	IMATH_TRUNC(short);
+	IMATH_TRUNC(unsigned short);
+	IMATH_TRUNC(int);
+	IMATH_TRUNC(unsigned int);
+	IMATH_TRUNC(long);
+	IMATH_TRUNC(unsigned long);
+	IMATH_TRUNC(char16_t);
+	IMATH_TRUNC(char32_t);
+	IMATH_TRUNC(long long);
+	IMATH_TRUNC(unsigned long long);
+#undef IMATH_TRUNC
 	template <class T>
 	inline constexpr auto trunc(const T& x) { return Trunc<T>::_trunc_(x); }
 
 	//整数値として結果を得る
 	template <class T>
-	inline constexpr int_t trunc_integer(const T& x) { return static_cast<int_t>(trunc(x) + 0.1); }
+	inline constexpr int_t trunc_integer(const T& x) { return static_cast<int_t>(trunc(x)); }
 
 
-	//剰余
+	//剰余(x - trunc(x/y)*yを商の丸め誤差なく求める)
+	//三角関数等の周期関数の範囲縮約にも利用する
 	template <class T>
 	struct Mod {
+		//整数型
+		static constexpr T _mod_(const T& x, const T& y, true_type) { return x % y; }
+		//浮動小数点型
+		static constexpr T _mod_(const T& x, const T& y, false_type) { return _fmod_(x, y, is_rounding_kernel_type<T>()); }
+
+		//|y|*2^kを大きい方から引いていき, 各減算はSterbenzの補題により誤差が生じない
+		static constexpr T _fmod_(const T& x, const T& y, false_type) {
+			T ax = (x < 0) ? -x : x, ay = (y < 0) ? -y : y;
+
+			//xが無限大かNaN, yが0かNaN
+			if (!(ax - ax == 0) || !(ay > 0)) return numeric_traits<T>::nan();
+			if (ax < ay) return x;
+			//ay <= t <= ax < 2t
+			T t = ay;
+			while (t <= ax - t) t *= 2;
+			for (; t >= ay; t /= 2) if (ax >= t) ax -= t;
+			return (x < 0) ? -ax : ax;
+		}
+		static constexpr T _fmod_(const T& x, const T& y, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _fmod_(x, y, false_type()) : __fmod_kernel(x, y);
+		}
 
-		static constexpr T _mod_(const T& x, const T& y) { return x - trunc(x / y) * y; }
+		static constexpr T _mod_(const T& x, const T& y) { return _mod_(x, y, is_integral<T>()); }
 	};
 	template <class T>
 	inline constexpr auto mod(const T& x, const T& y) { return Mod<T>::_mod_(x, y); }
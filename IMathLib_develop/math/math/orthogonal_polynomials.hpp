@@ -3,31 +3,191 @@
 
 #include "IMathLib/math/math/math_traits.hpp"
 #include "IMathLib/math/math/sqrt.hpp"
-#include "IMathLib/math/math/pow.hpp"
-#include "IMathLib/math/math/factorial.hpp"
+#include <vector>
 
 //直交多項式の実装
+//次数nの値は三項漸化式によりO(n)で求め, 級数はClenshawの方法で評価する
 
 namespace iml {
 
+	//直交多項式の三項漸化式 p[k + 1] = (a(k)x + b(k))p[k] - c(k)p[k - 1] (p[-1] = 0, p[0] = initial(x))
+	//ルジャンドル多項式
+	template <class T>
+	struct Legendre_recurrence {
+		constexpr T a(size_t k) const { return T(2 * k + 1) / (k + 1); }
+		constexpr T b(size_t) const { return 0; }
+		constexpr T c(size_t k) const { return T(k) / (k + 1); }
+		template <class S>
+		constexpr S initial(const S&) const { return S(1); }
+	};
+	//ルジャンドル陪多項式(kはP_{m + k}^{m}の次数)
+	template <class T>
+	struct Associated_legendre_recurrence {
+		size_t m;
+		constexpr T a(size_t k) const { return T(2 * (k + m) + 1) / (k + 1); }
+		constexpr T b(size_t) const { return 0; }
+		constexpr T c(size_t k) const { return T(k + 2 * m) / (k + 1); }
+		//P_{m}^{m}(x) = (2m - 1)!!(1 - x^2)^(m/2)
+		template <class S>
+		constexpr S initial(const S& x) const {
+			S result = S(1);
+			if (m == 0) return result;
+			S w = sqrt(1 - x * x);
+			for (size_t i = 1; i <= m; ++i) result *= T(2 * i - 1) * w;
+			return result;
+		}
+	};
+	//ラゲール陪多項式(alpha = 0でラゲール多項式)
+	template <class T>
+	struct Laguerre_recurrence {
+		T alpha;
+		constexpr T a(size_t k) const { return T(-1) / (k + 1); }
+		constexpr T b(size_t k) const { return (2 * k + 1 + alpha) / (k + 1); }
+		constexpr T c(size_t k) const { return (k + alpha) / (k + 1); }
+		template <class S>
+		constexpr S initial(const S&) const { return S(1); }
+	};
+	//エルミート多項式(物理学での定義)
+	template <class T>
+	struct Hermite_recurrence {
+		constexpr T a(size_t) const { return 2; }
+		constexpr T b(size_t) const { return 0; }
+		constexpr T c(size_t k) const { return T(2 * k); }
+		template <class S>
+		constexpr S initial(const S&) const { return S(1); }
+	};
+	//第1種チェビシェフ多項式
+	template <class T>
+	struct Chebyshev_t_recurrence {
+		constexpr T a(size_t k) const { return (k == 0) ? 1 : 2; }
+		constexpr T b(size_t) const { return 0; }
+		constexpr T c(size_t) const { return 1; }
+		template <class S>
+		constexpr S initial(const S&) const { return S(1); }
+	};
+	//第2種チェビシェフ多項式
+	template <class T>
+	struct Chebyshev_u_recurrence {
+		constexpr T a(size_t) const { return 2; }
+		constexpr T b(size_t) const { return 0; }
+		constexpr T c(size_t) const { return 1; }
+		template <class S>
+		constexpr S initial(const S&) const { return S(1); }
+	};
+	//ヤコビ多項式(P_{n}^{(alpha, beta)}(x))
+	template <class T>
+	struct Jacobi_recurrence {
+		T alpha, beta;
+		//2(k + 1)(k + α + β + 1)(2k + α + β)p[k + 1] = (2k + α + β + 1)((2k + α + β + 2)(2k + α + β)x + α^2 - β^2)p[k] - 2(k + α)(k + β)(2k + α + β + 2)p[k - 1]
+		constexpr T a(size_t k) const {
+			if (k == 0) return (alpha + beta + 2) / 2;
+			T s = 2 * k + alpha + beta;
+			return (s + 1) * (s + 2) / (2 * (k + 1) * (k + alpha + beta + 1));
+		}
+		constexpr T b(size_t k) const {
+			if (k == 0) return (alpha - beta) / 2;
+			T s = 2 * k + alpha + beta;
+			return (s + 1) * (alpha * alpha - beta * beta) / (2 * (k + 1) * (k + alpha + beta + 1) * s);
+		}
+		constexpr T c(size_t k) const {
+			T s = 2 * k + alpha + beta;
+			return (k + alpha) * (k + beta) * (s + 2) / ((k + 1) * (k + alpha + beta + 1) * s);
+		}
+		template <class S>
+		constexpr S initial(const S&) const { return S(1); }
+	};
+
+	//係数を0 <= k < nについて事前に計算した三項漸化式(多数の点で同じ次数を評価するとき除算を省く)
+	template <class Recurrence, class T>
+	struct Tabulated_recurrence {
+		Recurrence r;
+		std::vector<T> ta, tb, tc;
+
+		Tabulated_recurrence(const Recurrence& r, size_t n) : r(r), ta(n), tb(n), tc(n) {
+			for (size_t k = 0; k < n; ++k) {
+				ta[k] = r.a(k);
+				tb[k] = r.b(k);
+				tc[k] = r.c(k);
+			}
+		}
+		T a(size_t k) const { return ta[k]; }
+		T b(size_t k) const { return tb[k]; }
+		T c(size_t k) const { return tc[k]; }
+		template <class S>
+		S initial(const S& x) const { return r.initial(x); }
+	};
+
+
+	//三項漸化式によるp[n](x)
+	template <class Recurrence, class S>
+	inline constexpr S orthogonal_polynomials(const Recurrence& r, size_t n, const S& x) {
+		S p0 = r.initial(x);
+		if (n == 0) return p0;
+		S p1 = (r.a(0) * x + r.b(0)) * p0;
+		for (size_t k = 1; k < n; ++k) {
+			S p2 = (r.a(k) * x + r.b(k)) * p1 - r.c(k) * p0;
+			p0 = p1;
+			p1 = p2;
+		}
+		return p1;
+	}
+	//p[0](x), ..., p[n](x)を順に出力
+	template <class Recurrence, class S, class OutputIterator>
+	inline OutputIterator orthogonal_polynomials(const Recurrence& r, size_t n, const S& x, OutputIterator result) {
+		S p0 = r.initial(x);
+		*result = p0; ++result;
+		if (n == 0) return result;
+		S p1 = (r.a(0) * x + r.b(0)) * p0;
+		*result = p1; ++result;
+		for (size_t k = 1; k < n; ++k, ++result) {
+			S p2 = (r.a(k) * x + r.b(k)) * p1 - r.c(k) * p0;
+			p0 = p1;
+			p1 = p2;
+			*result = p1;
+		}
+		return result;
+	}
+	//Clenshawの方法による直交多項式の級数 Σ coef[k]p[k](x) ([first, last)は双方向イテレータ)
+	template <class Recurrence, class S, class BidirectionalIterator>
+	inline constexpr S orthogonal_series(const Recurrence& r, const S& x, BidirectionalIterator first, BidirectionalIterator last) {
+		if (first == last) return S(0);
+		size_t n = 0;
+		for (BidirectionalIterator it = first; it != last; ++it) ++n;
+		//u[k] = coef[k] + (a(k)x + b(k))u[k + 1] - c(k + 1)u[k + 2]
+		S u1 = S(0), u2 = S(0);
+		for (size_t k = n - 1; k != 0; --k) {
+			--last;
+			S u0 = S(*last) + (r.a(k) * x + r.b(k)) * u1 - r.c(k + 1) * u2;
+			u2 = u1;
+			u1 = u0;
+		}
+		S p0 = r.initial(x);
+		return p0 * (S(*first) + (r.a(0) * x + r.b(0)) * u1 - r.c(1) * u2);
+	}
+
+
 	//ラゲール多項式(L_{n}(x))
 	template <class T>
 	inline constexpr auto laguerre_polynomials(size_t n, const T& x) {
 		using result_type = typename math_function_type<T>::type;
-
-		if (n == 0) return result_type(1);
-		if (n == 1) return result_type(-x + 1);
-		return ((2 * n - 1 - x)*laguerre_polynomials(n - 1, x) - (n - 1)*laguerre_polynomials(n - 2, x)) / n;
+		return orthogonal_polynomials(Laguerre_recurrence<result_type>{ 0 }, n, result_type(x));
+	}
+	template <class T, class OutputIterator>
+	inline OutputIterator laguerre_polynomials(size_t n, const T& x, OutputIterator result) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_polynomials(Laguerre_recurrence<result_type>{ 0 }, n, result_type(x), result);
 	}
 
 	//ラゲール陪多項式(L_{n}^{k}(x))
 	template <class T>
 	inline constexpr auto associated_laguerre_polynomials(size_t n, size_t k, const T& x) {
 		using result_type = typename math_function_type<T>::type;
-
-		if (n == 0) return result_type(1);
-		if (n == 1) return result_type(-x + k + 1);
-		return ((2 * n + k - 1 - x)*associated_laguerre_polynomials(n - 1, k, x) - (n + k - 1)*associated_laguerre_polynomials(n - 2, k, x)) / n;
+		return orthogonal_polynomials(Laguerre_recurrence<result_type>{ result_type(k) }, n, result_type(x));
+	}
+	template <class T, class OutputIterator>
+	inline OutputIterator associated_laguerre_polynomials(size_t n, size_t k, const T& x, OutputIterator result) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_polynomials(Laguerre_recurrence<result_type>{ result_type(k) }, n, result_type(x), result);
 	}
 
 
@@ -35,27 +195,114 @@ namespace iml {
 	template <class T>
 	inline constexpr auto legendre_polynomials(size_t k, const T& x) {
 		using result_type = typename math_function_type<T>::type;
-
-		if (k == 0) return result_type(1);
-		if (k == 1) return result_type(x);
-		return ((2 * k - 1)*x*legendre_polynomials(k - 1, x) - (k - 1)*legendre_polynomials(k - 2, x)) / k;
+		return orthogonal_polynomials(Legendre_recurrence<result_type>(), k, result_type(x));
+	}
+	template <class T, class OutputIterator>
+	inline OutputIterator legendre_polynomials(size_t k, const T& x, OutputIterator result) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_polynomials(Legendre_recurrence<result_type>(), k, result_type(x), result);
 	}
 
 	//ルジャンドル陪多項式(P_{k}^{m}(x))
 	template <class T>
 	inline constexpr auto associated_legendre_polynomials(size_t k, size_t m, const T& x) {
 		using result_type = typename math_function_type<T>::type;
+		if (k < m) return result_type(0);
+		return orthogonal_polynomials(Associated_legendre_recurrence<result_type>{ m }, k - m, result_type(x));
+	}
+	//P_{0}^{m}(x), ..., P_{k}^{m}(x)を順に出力(次数がm未満の項は0)
+	template <class T, class OutputIterator>
+	inline OutputIterator associated_legendre_polynomials(size_t k, size_t m, const T& x, OutputIterator result) {
+		using result_type = typename math_function_type<T>::type;
+		for (size_t i = 0; i <= k && i < m; ++i, ++result) *result = result_type(0);
+		if (k < m) return result;
+		return orthogonal_polynomials(Associated_legendre_recurrence<result_type>{ m }, k - m, result_type(x), result);
+	}
 
-		if (m == k + 1) return result_type(0);
-		if (m == k) {
-			//mが奇数なら(整数+1/2)乗に分解
-			if ((m & 1) == 1) return double_fact(2 * m - 1, pow(1 - x * x, (m - 1) / 2)*sqrt(1 - x * x));
-			else return double_fact(2 * m - 1, pow(1 - x * x, m / 2));
-		}
-		return ((2 * k - 1)*x*associated_legendre_polynomials(k - 1, m, x) - (k + m - 1)*associated_legendre_polynomials(k - 2, m, x)) / (k - m);
+
+	//エルミート多項式(H_{n}(x))
+	template <class T>
+	inline constexpr auto hermite_polynomials(size_t n, const T& x) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_polynomials(Hermite_recurrence<result_type>(), n, result_type(x));
+	}
+	template <class T, class OutputIterator>
+	inline OutputIterator hermite_polynomials(size_t n, const T& x, OutputIterator result) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_polynomials(Hermite_recurrence<result_type>(), n, result_type(x), result);
+	}
+
+
+	//第1種チェビシェフ多項式(T_{n}(x))
+	template <class T>
+	inline constexpr auto chebyshev_t_polynomials(size_t n, const T& x) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_polynomials(Chebyshev_t_recurrence<result_type>(), n, result_type(x));
+	}
+	template <class T, class OutputIterator>
+	inline OutputIterator chebyshev_t_polynomials(size_t n, const T& x, OutputIterator result) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_polynomials(Chebyshev_t_recurrence<result_type>(), n, result_type(x), result);
+	}
+
+	//第2種チェビシェフ多項式(U_{n}(x))
+	template <class T>
+	inline constexpr auto chebyshev_u_polynomials(size_t n, const T& x) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_polynomials(Chebyshev_u_recurrence<result_type>(), n, result_type(x));
+	}
+	template <class T, class OutputIterator>
+	inline OutputIterator chebyshev_u_polynomials(size_t n, const T& x, OutputIterator result) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_polynomials(Chebyshev_u_recurrence<result_type>(), n, result_type(x), result);
+	}
+
+
+	//ヤコビ多項式(P_{n}^{(a, b)}(x))
+	template <class T>
+	inline constexpr auto jacobi_polynomials(size_t n, const T& a, const T& b, const T& x) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_polynomials(Jacobi_recurrence<result_type>{ result_type(a), result_type(b) }, n, result_type(x));
+	}
+	template <class T, class OutputIterator>
+	inline OutputIterator jacobi_polynomials(size_t n, const T& a, const T& b, const T& x, OutputIterator result) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_polynomials(Jacobi_recurrence<result_type>{ result_type(a), result_type(b) }, n, result_type(x), result);
 	}
 
-}
 
+	//直交多項式の級数(Clenshawの方法)
+	template <class T, class BidirectionalIterator>
+	inline constexpr auto legendre_series(const T& x, BidirectionalIterator first, BidirectionalIterator last) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_series(Legendre_recurrence<result_type>(), result_type(x), first, last);
+	}
+	template <class T, class BidirectionalIterator>
+	inline constexpr auto laguerre_series(const T& x, BidirectionalIterator first, BidirectionalIterator last) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_series(Laguerre_recurrence<result_type>{ 0 }, result_type(x), first, last);
+	}
+	template <class T, class BidirectionalIterator>
+	inline constexpr auto hermite_series(const T& x, BidirectionalIterator first, BidirectionalIterator last) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_series(Hermite_recurrence<result_type>(), result_type(x), first, last);
+	}
+	template <class T, class BidirectionalIterator>
+	inline constexpr auto chebyshev_t_series(const T& x, BidirectionalIterator first, BidirectionalIterator last) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_series(Chebyshev_t_recurrence<result_type>(), result_type(x), first, last);
+	}
+	template <class T, class BidirectionalIterator>
+	inline constexpr auto chebyshev_u_series(const T& x, BidirectionalIterator first, BidirectionalIterator last) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_series(Chebyshev_u_recurrence<result_type>(), result_type(x), first, last);
+	}
+	template <class T, class BidirectionalIterator>
+	inline constexpr auto jacobi_series(const T& a, const T& b, const T& x, BidirectionalIterator first, BidirectionalIterator last) {
+		using result_type = typename math_function_type<T>::type;
+		return orthogonal_series(Jacobi_recurrence<result_type>{ result_type(a), result_type(b) }, result_type(x), first, last);
+	}
+
+}
 
 #endif
\ No newline at end of file
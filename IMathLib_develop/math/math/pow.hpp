@@ -16,15 +16,57 @@ namespace iml {
 	struct Pow {
 		using result_type = typename math_function_type<T>::type;
 
+		template <class S>
+		static constexpr result_type _pow_impl_(const result_type& x, const S& y, false_type) { return exp(y*log(x)); }
+		//実行時はカーネルで計算(y*log(x)を拡張精度で扱うためexp(y*log(x))より誤差が小さい)
+		template <class S>
+		static constexpr result_type _pow_impl_(const result_type& x, const S& y, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _pow_impl_(x, y, false_type())
+				: Elementary_kernel<result_type>::_pow_(x, static_cast<result_type>(y));
+		}
+		//yが整数であるかとその偶奇(2^62以上は偶数の整数として扱う)
+		template <class S>
+		static constexpr bool _is_integer_(const S& y, bool& odd) {
+			S ay = (y < 0) ? -y : y;
+			if (!(ay < S(4611686018427387904.))) { odd = false; return true; }
+			int64_t n = static_cast<int64_t>(ay);
+			odd = (n & 1) != 0;
+			return static_cast<S>(n) == ay;
+		}
+		//特殊値はIEEE 754のpowに従い, 定数評価と実行時で同じ結果となるようにここで全て処理する
+		//(定数評価では-0と+0を区別できないため, 奇数の負の冪での0の符号のみ実行時に限り反映する)
 		template <class S, class = enable_if_t<!is_integral_v<S>>>
 		static constexpr result_type _pow_(const T& x, const S& y) {
+			using tag = cat_bool<is_elementary_kernel_type_v<result_type> && is_floating_point_v<S>>;
+			const result_type inf = numeric_traits<result_type>::positive_infinity();
 
-			if (x == 0 && y == 0) return result_type(1);
-			else if (x == 0) return result_type(0);
-			//(-1)^nはnが整数でないときは実数の範囲では演算不可(pow(T, int_t)等で呼び出せばいい)
-			else if (x < 0) return  numeric_traits<result_type>::nan();
-	
-			return exp(y*log(x));
+			if (y == 0 || x == 1) return result_type(1);
+			if (x != x || y != y) return numeric_traits<result_type>::nan();
+			bool odd = false;
+			const bool integer = _is_integer_(y, odd);
+			const result_type ax = (x < 0) ? result_type(-x) : result_type(x);
+			//0の冪
+			if (x == 0) {
+				if (y > 0) return odd ? result_type(x) : result_type(0);
+				return (odd && !IMATH_IS_CONSTANT_EVALUATED()) ? result_type(1) / result_type(x) : inf;
+			}
+			//∞の冪
+			if (ax == inf) {
+				result_type r = (y < 0) ? result_type(0) : inf;
+				return (x < 0 && odd) ? -r : r;
+			}
+			//指数が±∞
+			if (y == inf || y == -inf) {
+				if (ax == 1) return result_type(1);
+				return ((ax > 1) == (y > 0)) ? inf : result_type(0);
+			}
+			//(-1)^yはyが整数でないときは実数の範囲では演算不可(pow(T, int_t)等で呼び出せばいい)
+			if (x < 0) {
+				if (!integer) return numeric_traits<result_type>::nan();
+				result_type r = _pow_impl_(ax, y, tag());
+				return odd ? -r : r;
+			}
+			return _pow_impl_(ax, y, tag());
 		}
 		//自然数冪
 		static constexpr auto _pow_(const T& x, size_t y) { return ipow(x, y); }
@@ -6,15 +6,25 @@
 #include "IMathLib/math/math/pow.hpp"
 #include "IMathLib/math/math/pi.hpp"
 #include "IMathLib/math/math/gamma.hpp"
+#include "IMathLib/math/math/zeta_kernel.hpp"
 
 namespace iml {
 
 	//リーマンのゼータ関数
 	template <class T>
 	struct Riemann_zeta {
-		static constexpr auto _riemann_zeta_(const T& x) {
+		using result_type = typename math_function_type<T>::type;
+
+		static constexpr result_type _riemann_zeta_(const T& x, false_type) {
 			return dirichlet_eta(x) / (1 - pow<size_t, T>(2, 1 - x));
 		}
+		//実行時はs = 1の近傍でLaurent展開, s < -1/2で関数等式を用いるカーネルで計算
+		static constexpr result_type _riemann_zeta_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _riemann_zeta_(x, false_type()) : Zeta_kernel<result_type>::_riemann_zeta_(static_cast<result_type>(x));
+		}
+		static constexpr result_type _riemann_zeta_(const T& x) {
+			return _riemann_zeta_(x, is_elementary_kernel_type<result_type>());
+		}
 	};
 	template <class T>
 	inline constexpr auto riemann_zeta(const T& x) { return Riemann_zeta<T>::_riemann_zeta_(x); }
@@ -0,0 +1,302 @@
+﻿#ifndef IMATH_MATH_MATH_ROUNDING_KERNEL_HPP
+#define IMATH_MATH_MATH_ROUNDING_KERNEL_HPP
+
+#include "IMathLib/math/math/simd_type.hpp"
+#include "IMathLib/utility/type_traits/integral_constant.hpp"
+
+//float/doubleに対する丸め関数と指数操作の実行時カーネル
+//packの演算では|x| < 2^(仮数部のビット数)の範囲で x + 2^p - 2^p が整数へ丸められることを利用し,
+//スカラーではIEEE754のビット列を直接操作する(いずれも丸めモードは最近接偶数丸めを仮定する)
+
+namespace iml {
+	namespace simd {
+
+		template <class T>
+		struct Rounding_kernel_impl {
+			//2^(仮数部のビット数)
+			static constexpr T shifter = (sizeof(T) == 4) ? T(8388608.) : T(4503599627370496.);
+
+			//|x|の整数部(|x| < shifter)
+			template <class P>
+			static P _trunc_abs_(const P& ax) {
+				P t = (ax + shifter) - shifter;
+				return select(t > ax, t - T(1), t);
+			}
+			//|x|に対する結果rにxの符号を付与する(|x| >= shifter, 無限大, NaN, ±0はxをそのまま返す)
+			template <class P>
+			static P _sign_(const P& x, const P& ax, const P& r) {
+				return select((ax < shifter) & (x != T(0)), select(x < T(0), -r, r), x);
+			}
+
+			//0方向への丸め
+			template <class P>
+			static P _trunc_(const P& x) {
+				P ax = abs(x);
+				return _sign_(x, ax, _trunc_abs_(ax));
+			}
+			//床関数
+			template <class P>
+			static P _floor_(const P& x) {
+				P t = _trunc_(x);
+				return select(t > x, t - T(1), t);
+			}
+			//天井関数
+			template <class P>
+			static P _ceil_(const P& x) {
+				P t = _trunc_(x);
+				return select(t < x, t + T(1), t);
+			}
+			//四捨五入(0.5は0から遠い方向へ丸める)
+			template <class P>
+			static P _round_(const P& x) {
+				P ax = abs(x), t = _trunc_abs_(ax);
+				return _sign_(x, ax, select(ax - t >= T(0.5), t + T(1), t));
+			}
+			//最近接偶数丸め
+			template <class P>
+			static P _nearbyint_(const P& x) {
+				P ax = abs(x);
+				return _sign_(x, ax, (ax + shifter) - shifter);
+			}
+		};
+	}
+
+
+	//ビット操作による実装を利用する型
+	template <class T>
+	struct is_rounding_kernel_type : false_type {};
+	template <>
+	struct is_rounding_kernel_type<float> : true_type {};
+	template <>
+	struct is_rounding_kernel_type<double> : true_type {};
+	//long doubleはdoubleと同一の表現の場合のみ
+	template <>
+	struct is_rounding_kernel_type<long double> : cat_bool<sizeof(long double) == sizeof(double)> {};
+
+
+	//スカラー版
+	template <class T>
+	struct Rounding_kernel;
+	template <>
+	struct Rounding_kernel<double> {
+		static constexpr uint64_t sign_mask = 0x8000000000000000ull;
+		static constexpr uint64_t fraction_mask = 0x000FFFFFFFFFFFFFull;
+
+		//バイアスを除いた指数部
+		static int_t _exponent_(uint64_t u) { return int_t((u >> 52) & 0x7FF) - 1023; }
+
+		static double _trunc_(double x) {
+			uint64_t u = bit_cast<uint64_t>(x);
+			int_t e = _exponent_(u);
+			//整数, 無限大, NaN
+			if (e >= 52) return x;
+			if (e < 0) return bit_cast<double>(u & sign_mask);
+			return bit_cast<double>(u & ~(fraction_mask >> e));
+		}
+		static double _floor_(double x) {
+			uint64_t u = bit_cast<uint64_t>(x);
+			int_t e = _exponent_(u);
+			if (e >= 52) return x;
+			if (e < 0) {
+				//±0はそのまま
+				if ((u << 1) == 0) return x;
+				return (u >> 63) ? -1. : 0.;
+			}
+			uint64_t m = fraction_mask >> e;
+			if ((u & m) == 0) return x;
+			//負数は絶対値を切り上げる(指数部への桁上がりも正しく扱われる)
+			if (u >> 63) u += m;
+			return bit_cast<double>(u & ~m);
+		}
+		static double _ceil_(double x) {
+			uint64_t u = bit_cast<uint64_t>(x);
+			int_t e = _exponent_(u);
+			if (e >= 52) return x;
+			if (e < 0) {
+				if ((u << 1) == 0) return x;
+				return (u >> 63) ? -0. : 1.;
+			}
+			uint64_t m = fraction_mask >> e;
+			if ((u & m) == 0) return x;
+			if (!(u >> 63)) u += m;
+			return bit_cast<double>(u & ~m);
+		}
+		static double _round_(double x) {
+			uint64_t u = bit_cast<uint64_t>(x);
+			int_t e = _exponent_(u);
+			if (e >= 52) return x;
+			if (e < 0) return bit_cast<double>((u & sign_mask) | ((e == -1) ? 0x3FF0000000000000ull : 0));
+			uint64_t m = fraction_mask >> e;
+			if ((u & m) == 0) return x;
+			//0.5に相当するビットを加えて切り捨てる
+			u += 0x0008000000000000ull >> e;
+			return bit_cast<double>(u & ~m);
+		}
+		static double _nearbyint_(double x) { return simd::Rounding_kernel_impl<double>::_nearbyint_(simd::pack<double, 1>(x)).v; }
+
+		//x = m * 2^e (0.5 <= |m| < 1)
+		static double _frexp_(double x, int_t& e) {
+			uint64_t u = bit_cast<uint64_t>(x);
+			int_t ee = int_t((u >> 52) & 0x7FF);
+			//±0, 非正規化数
+			if (ee == 0) {
+				if ((u << 1) == 0) { e = 0; return x; }
+				x = _frexp_(x * 18446744073709551616., e);
+				e -= 64;
+				return x;
+			}
+			//無限大, NaN
+			if (ee == 0x7FF) { e = 0; return x; }
+			e = ee - 1022;
+			return bit_cast<double>((u & (sign_mask | fraction_mask)) | 0x3FE0000000000000ull);
+		}
+		//x * 2^n (非正規化数の範囲でも丸めは1回のみ)
+		static double _ldexp_(double x, int_t n) {
+			if (n > 1023) {
+				x *= 8.98846567431158e+307;
+				n -= 1023;
+				if (n > 1023) {
+					x *= 8.98846567431158e+307;
+					n -= 1023;
+					if (n > 1023) n = 1023;
+				}
+			}
+			else if (n < -1022) {
+				//2^-1022 * 2^53 (非正規化数を経由しないように一旦2^53倍しておく)
+				x *= 2.004168360008973e-292;
+				n += 1022 - 53;
+				if (n < -1022) {
+					x *= 2.004168360008973e-292;
+					n += 1022 - 53;
+					if (n < -1022) n = -1022;
+				}
+			}
+			return x * bit_cast<double>(uint64_t(0x3FF + n) << 52);
+		}
+	};
+	template <>
+	struct Rounding_kernel<float> {
+		static constexpr uint32_t sign_mask = 0x80000000u;
+		static constexpr uint32_t fraction_mask = 0x007FFFFFu;
+
+		static int_t _exponent_(uint32_t u) { return int_t((u >> 23) & 0xFF) - 127; }
+
+		static float _trunc_(float x) {
+			uint32_t u = bit_cast<uint32_t>(x);
+			int_t e = _exponent_(u);
+			if (e >= 23) return x;
+			if (e < 0) return bit_cast<float>(u & sign_mask);
+			return bit_cast<float>(u & ~(fraction_mask >> e));
+		}
+		static float _floor_(float x) {
+			uint32_t u = bit_cast<uint32_t>(x);
+			int_t e = _exponent_(u);
+			if (e >= 23) return x;
+			if (e < 0) {
+				if ((u << 1) == 0) return x;
+				return (u >> 31) ? -1.f : 0.f;
+			}
+			uint32_t m = fraction_mask >> e;
+			if ((u & m) == 0) return x;
+			if (u >> 31) u += m;
+			return bit_cast<float>(u & ~m);
+		}
+		static float _ceil_(float x) {
+			uint32_t u = bit_cast<uint32_t>(x);
+			int_t e = _exponent_(u);
+			if (e >= 23) return x;
+			if (e < 0) {
+				if ((u << 1) == 0) return x;
+				return (u >> 31) ? -0.f : 1.f;
+			}
+			uint32_t m = fraction_mask >> e;
+			if ((u & m) == 0) return x;
+			if (!(u >> 31)) u += m;
+			return bit_cast<float>(u & ~m);
+		}
+		static float _round_(float x) {
+			uint32_t u = bit_cast<uint32_t>(x);
+			int_t e = _exponent_(u);
+			if (e >= 23) return x;
+			if (e < 0) return bit_cast<float>((u & sign_mask) | ((e == -1) ? 0x3F800000u : 0));
+			uint32_t m = fraction_mask >> e;
+			if ((u & m) == 0) return x;
+			u += 0x00400000u >> e;
+			return bit_cast<float>(u & ~m);
+		}
+		static float _nearbyint_(float x) { return simd::Rounding_kernel_impl<float>::_nearbyint_(simd::pack<float, 1>(x)).v; }
+
+		static float _frexp_(float x, int_t& e) {
+			uint32_t u = bit_cast<uint32_t>(x);
+			int_t ee = int_t((u >> 23) & 0xFF);
+			if (ee == 0) {
+				if ((u << 1) == 0) { e = 0; return x; }
+				x = _frexp_(x * 18446744073709551616.f, e);
+				e -= 64;
+				return x;
+			}
+			if (ee == 0xFF) { e = 0; return x; }
+			e = ee - 126;
+			return bit_cast<float>((u & (sign_mask | fraction_mask)) | 0x3F000000u);
+		}
+		static float _ldexp_(float x, int_t n) {
+			if (n > 127) {
+				x *= 1.7014118e+38f;
+				n -= 127;
+				if (n > 127) {
+					x *= 1.7014118e+38f;
+					n -= 127;
+					if (n > 127) n = 127;
+				}
+			}
+			else if (n < -126) {
+				//2^-126 * 2^24
+				x *= 1.9721523e-31f;
+				n += 126 - 24;
+				if (n < -126) {
+					x *= 1.9721523e-31f;
+					n += 126 - 24;
+					if (n < -126) n = -126;
+				}
+			}
+			return x * bit_cast<float>(uint32_t(0x7F + n) << 23);
+		}
+	};
+	//doubleと同一の表現のlong double
+	template <>
+	struct Rounding_kernel<long double> {
+		using kernel = Rounding_kernel<double>;
+
+		static long double _trunc_(long double x) { return kernel::_trunc_(double(x)); }
+		static long double _floor_(long double x) { return kernel::_floor_(double(x)); }
+		static long double _ceil_(long double x) { return kernel::_ceil_(double(x)); }
+		static long double _round_(long double x) { return kernel::_round_(double(x)); }
+		static long double _nearbyint_(long double x) { return kernel::_nearbyint_(double(x)); }
+		static long double _frexp_(long double x, int_t& e) { return kernel::_frexp_(double(x), e); }
+		static long double _ldexp_(long double x, int_t n) { return kernel::_ldexp_(double(x), n); }
+	};
+
+
+	//剰余(x - trunc(x/y)*y)を誤差なく求める
+	//|y|*2^kを大きい方から引いていき, 各減算はSterbenzの補題により誤差が生じない
+	template <class T>
+	inline T __fmod_kernel(T x, T y) {
+		using kernel = Rounding_kernel<T>;
+		T ax = (x < 0) ? -x : x, ay = (y < 0) ? -y : y;
+
+		//xが無限大かNaN, yが0かNaN
+		if (!(ax - ax == 0) || !(ay > 0)) return (x - x) / (y - y);
+		if (ax < ay) return x;
+		int_t ex, ey;
+		kernel::_frexp_(ax, ex);
+		kernel::_frexp_(ay, ey);
+		//t = |y|*2^(ex-ey) は |x|/2 < t < 2|x|
+		T t = kernel::_ldexp_(ay, ex - ey);
+		if (t > ax) t *= T(0.5);
+		for (; t >= ay; t *= T(0.5)) if (ax >= t) ax -= t;
+		return (x < 0) ? -ax : ax;
+	}
+}
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,456 @@
+﻿#ifndef IMATH_MATH_MATH_SIMD_TYPE_HPP
+#define IMATH_MATH_MATH_SIMD_TYPE_HPP
+
+#include "IMathLib/IMathLib_config.hpp"
+#include "IMathLib/utility/utility/bit_cast.hpp"
+
+//初等関数の配列演算のためのSIMDレジスタの薄いラッパー
+//pack<T, 1>はスカラーであり全てのカーネルはpackの演算のみで記述する
+
+namespace iml {
+	namespace simd {
+
+		//N個のTをまとめて演算する型
+		template <class T, size_t N>
+		struct pack;
+
+
+		//スカラー(double)
+		template <>
+		struct pack<double, 1> {
+			using value_type = double;
+			using mask_type = bool;
+			static constexpr size_t size = 1;
+
+			double v;
+
+			pack() = default;
+			pack(double x) : v(x) {}
+
+			static pack load(const double* p) { return pack(*p); }
+			void store(double* p) const { *p = v; }
+
+			pack operator-() const { return pack(-v); }
+			pack& operator+=(const pack& x) { v += x.v; return *this; }
+			pack& operator-=(const pack& x) { v -= x.v; return *this; }
+			pack& operator*=(const pack& x) { v *= x.v; return *this; }
+			pack& operator/=(const pack& x) { v /= x.v; return *this; }
+		};
+		inline pack<double, 1> operator+(const pack<double, 1>& a, const pack<double, 1>& b) { return a.v + b.v; }
+		inline pack<double, 1> operator-(const pack<double, 1>& a, const pack<double, 1>& b) { return a.v - b.v; }
+		inline pack<double, 1> operator*(const pack<double, 1>& a, const pack<double, 1>& b) { return a.v * b.v; }
+		inline pack<double, 1> operator/(const pack<double, 1>& a, const pack<double, 1>& b) { return a.v / b.v; }
+		inline bool operator<(const pack<double, 1>& a, const pack<double, 1>& b) { return a.v < b.v; }
+		inline bool operator>(const pack<double, 1>& a, const pack<double, 1>& b) { return a.v > b.v; }
+		inline bool operator<=(const pack<double, 1>& a, const pack<double, 1>& b) { return a.v <= b.v; }
+		inline bool operator>=(const pack<double, 1>& a, const pack<double, 1>& b) { return a.v >= b.v; }
+		inline bool operator==(const pack<double, 1>& a, const pack<double, 1>& b) { return a.v == b.v; }
+		inline bool operator!=(const pack<double, 1>& a, const pack<double, 1>& b) { return a.v != b.v; }
+		inline pack<double, 1> select(bool m, const pack<double, 1>& a, const pack<double, 1>& b) { return m ? a : b; }
+		inline pack<double, 1> abs(const pack<double, 1>& x) { return bit_cast<double>(bit_cast<uint64_t>(x.v) & 0x7FFFFFFFFFFFFFFFull); }
+		inline pack<double, 1> sqrt(const pack<double, 1>& x) {
+#if defined IMATH_SIMD_SSE2
+			return _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(x.v)));
+#else
+			//ハードウェア命令が利用できないときはNewton法
+			if (!(x.v > 0) || x.v == bit_cast<double>(0x7FF0000000000000ull)) return (x.v == 0 || x.v > 0) ? x.v : bit_cast<double>(0x7FF8000000000000ull);
+			double y = bit_cast<double>((bit_cast<uint64_t>(x.v) >> 1) + 0x1FF8000000000000ull);
+			for (size_t i = 0; i < 6; ++i) y = 0.5 * (y + x.v / y);
+			return y;
+#endif
+		}
+#if defined IMATH_FMA
+		//丸めが1回のa * b + c(FMA命令が利用できるときのみ定義)
+		inline pack<double, 1> fma(const pack<double, 1>& a, const pack<double, 1>& b, const pack<double, 1>& c) {
+			return _mm_cvtsd_f64(_mm_fmadd_sd(_mm_set_sd(a.v), _mm_set_sd(b.v), _mm_set_sd(c.v)));
+		}
+#endif
+		//2^n(nは整数値で|n| < 1023)
+		inline pack<double, 1> pow2i(const pack<double, 1>& n) {
+			return bit_cast<double>(bit_cast<uint64_t>(n.v + 4503599627371519.0) << 52);
+		}
+		//正規化数xをx = m*2^e(1 <= m < 2)に分解
+		inline pack<double, 1> split_exponent(const pack<double, 1>& x, pack<double, 1>& e) {
+			uint64_t bits = bit_cast<uint64_t>(x.v);
+			e = double((bits >> 52) & 0x7FF) - 1023;
+			return bit_cast<double>((bits & 0x000FFFFFFFFFFFFFull) | 0x3FF0000000000000ull);
+		}
+		//丸め定数の加算で得た整数値の下位ビットの判定
+		template <size_t Bit>
+		inline bool low_bit_mask(const pack<double, 1>& shifted) { return ((bit_cast<uint64_t>(shifted.v) >> Bit) & 1) != 0; }
+		inline bool any(bool m) { return m; }
+		inline bool all(bool m) { return m; }
+
+
+		//スカラー(float)
+		template <>
+		struct pack<float, 1> {
+			using value_type = float;
+			using mask_type = bool;
+			static constexpr size_t size = 1;
+
+			float v;
+
+			pack() = default;
+			pack(float x) : v(x) {}
+
+			static pack load(const float* p) { return pack(*p); }
+			void store(float* p) const { *p = v; }
+
+			pack operator-() const { return pack(-v); }
+			pack& operator+=(const pack& x) { v += x.v; return *this; }
+			pack& operator-=(const pack& x) { v -= x.v; return *this; }
+			pack& operator*=(const pack& x) { v *= x.v; return *this; }
+			pack& operator/=(const pack& x) { v /= x.v; return *this; }
+		};
+		inline pack<float, 1> operator+(const pack<float, 1>& a, const pack<float, 1>& b) { return a.v + b.v; }
+		inline pack<float, 1> operator-(const pack<float, 1>& a, const pack<float, 1>& b) { return a.v - b.v; }
+		inline pack<float, 1> operator*(const pack<float, 1>& a, const pack<float, 1>& b) { return a.v * b.v; }
+		inline pack<float, 1> operator/(const pack<float, 1>& a, const pack<float, 1>& b) { return a.v / b.v; }
+		inline bool operator<(const pack<float, 1>& a, const pack<float, 1>& b) { return a.v < b.v; }
+		inline bool operator>(const pack<float, 1>& a, const pack<float, 1>& b) { return a.v > b.v; }
+		inline bool operator<=(const pack<float, 1>& a, const pack<float, 1>& b) { return a.v <= b.v; }
+		inline bool operator>=(const pack<float, 1>& a, const pack<float, 1>& b) { return a.v >= b.v; }
+		inline bool operator==(const pack<float, 1>& a, const pack<float, 1>& b) { return a.v == b.v; }
+		inline bool operator!=(const pack<float, 1>& a, const pack<float, 1>& b) { return a.v != b.v; }
+		inline pack<float, 1> select(bool m, const pack<float, 1>& a, const pack<float, 1>& b) { return m ? a : b; }
+		inline pack<float, 1> abs(const pack<float, 1>& x) { return bit_cast<float>(bit_cast<uint32_t>(x.v) & 0x7FFFFFFFu); }
+		inline pack<float, 1> sqrt(const pack<float, 1>& x) {
+#if defined IMATH_SIMD_SSE2
+			return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x.v)));
+#else
+			return float(sqrt(pack<double, 1>(x.v)).v);
+#endif
+		}
+#if defined IMATH_FMA
+		inline pack<float, 1> fma(const pack<float, 1>& a, const pack<float, 1>& b, const pack<float, 1>& c) {
+			return _mm_cvtss_f32(_mm_fmadd_ss(_mm_set_ss(a.v), _mm_set_ss(b.v), _mm_set_ss(c.v)));
+		}
+#endif
+		inline pack<float, 1> pow2i(const pack<float, 1>& n) {
+			return bit_cast<float>(bit_cast<uint32_t>(n.v + 8388735.f) << 23);
+		}
+		inline pack<float, 1> split_exponent(const pack<float, 1>& x, pack<float, 1>& e) {
+			uint32_t bits = bit_cast<uint32_t>(x.v);
+			e = float(int_t((bits >> 23) & 0xFF) - 127);
+			return bit_cast<float>((bits & 0x007FFFFFu) | 0x3F800000u);
+		}
+		//精度の拡張と縮小
+		inline pack<double, 1> widen(const pack<float, 1>& x) { return double(x.v); }
+		inline pack<float, 1> narrow(const pack<double, 1>& x) { return float(x.v); }
+
+
+#if defined IMATH_SIMD_SSE2
+		//SSE2のマスク
+		template <class T, size_t N>
+		struct pack_mask;
+		template <>
+		struct pack_mask<double, 2> {
+			__m128d m;
+			pack_mask(__m128d x) : m(x) {}
+		};
+		inline pack_mask<double, 2> operator&(const pack_mask<double, 2>& a, const pack_mask<double, 2>& b) { return _mm_and_pd(a.m, b.m); }
+		inline pack_mask<double, 2> operator|(const pack_mask<double, 2>& a, const pack_mask<double, 2>& b) { return _mm_or_pd(a.m, b.m); }
+		inline pack_mask<double, 2> operator^(const pack_mask<double, 2>& a, const pack_mask<double, 2>& b) { return _mm_xor_pd(a.m, b.m); }
+		inline pack_mask<double, 2> operator!(const pack_mask<double, 2>& a) { return _mm_xor_pd(a.m, _mm_castsi128_pd(_mm_set1_epi32(-1))); }
+		inline bool any(const pack_mask<double, 2>& a) { return _mm_movemask_pd(a.m) != 0; }
+		inline bool all(const pack_mask<double, 2>& a) { return _mm_movemask_pd(a.m) == 0x3; }
+
+		template <>
+		struct pack_mask<float, 4> {
+			__m128 m;
+			pack_mask(__m128 x) : m(x) {}
+		};
+		inline pack_mask<float, 4> operator&(const pack_mask<float, 4>& a, const pack_mask<float, 4>& b) { return _mm_and_ps(a.m, b.m); }
+		inline pack_mask<float, 4> operator|(const pack_mask<float, 4>& a, const pack_mask<float, 4>& b) { return _mm_or_ps(a.m, b.m); }
+		inline pack_mask<float, 4> operator^(const pack_mask<float, 4>& a, const pack_mask<float, 4>& b) { return _mm_xor_ps(a.m, b.m); }
+		inline pack_mask<float, 4> operator!(const pack_mask<float, 4>& a) { return _mm_xor_ps(a.m, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+		inline bool any(const pack_mask<float, 4>& a) { return _mm_movemask_ps(a.m) != 0; }
+		inline bool all(const pack_mask<float, 4>& a) { return _mm_movemask_ps(a.m) == 0xF; }
+
+
+		//SSE2(double×2)
+		template <>
+		struct pack<double, 2> {
+			using value_type = double;
+			using mask_type = pack_mask<double, 2>;
+			static constexpr size_t size = 2;
+
+			__m128d v;
+
+			pack() = default;
+			pack(__m128d x) : v(x) {}
+			pack(double x) : v(_mm_set1_pd(x)) {}
+
+			static pack load(const double* p) { return _mm_loadu_pd(p); }
+			void store(double* p) const { _mm_storeu_pd(p, v); }
+
+			pack operator-() const { return _mm_xor_pd(v, _mm_set1_pd(-0.)); }
+			pack& operator+=(const pack& x) { v = _mm_add_pd(v, x.v); return *this; }
+			pack& operator-=(const pack& x) { v = _mm_sub_pd(v, x.v); return *this; }
+			pack& operator*=(const pack& x) { v = _mm_mul_pd(v, x.v); return *this; }
+			pack& operator/=(const pack& x) { v = _mm_div_pd(v, x.v); return *this; }
+		};
+		inline pack<double, 2> operator+(const pack<double, 2>& a, const pack<double, 2>& b) { return _mm_add_pd(a.v, b.v); }
+		inline pack<double, 2> operator-(const pack<double, 2>& a, const pack<double, 2>& b) { return _mm_sub_pd(a.v, b.v); }
+		inline pack<double, 2> operator*(const pack<double, 2>& a, const pack<double, 2>& b) { return _mm_mul_pd(a.v, b.v); }
+		inline pack<double, 2> operator/(const pack<double, 2>& a, const pack<double, 2>& b) { return _mm_div_pd(a.v, b.v); }
+		inline pack_mask<double, 2> operator<(const pack<double, 2>& a, const pack<double, 2>& b) { return _mm_cmplt_pd(a.v, b.v); }
+		inline pack_mask<double, 2> operator>(const pack<double, 2>& a, const pack<double, 2>& b) { return _mm_cmpgt_pd(a.v, b.v); }
+		inline pack_mask<double, 2> operator<=(const pack<double, 2>& a, const pack<double, 2>& b) { return _mm_cmple_pd(a.v, b.v); }
+		inline pack_mask<double, 2> operator>=(const pack<double, 2>& a, const pack<double, 2>& b) { return _mm_cmpge_pd(a.v, b.v); }
+		inline pack_mask<double, 2> operator==(const pack<double, 2>& a, const pack<double, 2>& b) { return _mm_cmpeq_pd(a.v, b.v); }
+		inline pack_mask<double, 2> operator!=(const pack<double, 2>& a, const pack<double, 2>& b) { return _mm_cmpneq_pd(a.v, b.v); }
+		inline pack<double, 2> select(const pack_mask<double, 2>& m, const pack<double, 2>& a, const pack<double, 2>& b) {
+			return _mm_or_pd(_mm_and_pd(m.m, a.v), _mm_andnot_pd(m.m, b.v));
+		}
+		inline pack<double, 2> abs(const pack<double, 2>& x) { return _mm_andnot_pd(_mm_set1_pd(-0.), x.v); }
+		inline pack<double, 2> sqrt(const pack<double, 2>& x) { return _mm_sqrt_pd(x.v); }
+#if defined IMATH_FMA
+		inline pack<double, 2> fma(const pack<double, 2>& a, const pack<double, 2>& b, const pack<double, 2>& c) { return _mm_fmadd_pd(a.v, b.v, c.v); }
+#endif
+		inline pack<double, 2> pow2i(const pack<double, 2>& n) {
+			return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(_mm_add_pd(n.v, _mm_set1_pd(4503599627371519.0))), 52));
+		}
+		inline pack<double, 2> split_exponent(const pack<double, 2>& x, pack<double, 2>& e) {
+			__m128i bits = _mm_castpd_si128(x.v);
+			__m128d t = _mm_castsi128_pd(_mm_or_si128(_mm_srli_epi64(bits, 52), _mm_castpd_si128(_mm_set1_pd(4503599627370496.0))));
+			e = _mm_sub_pd(t, _mm_set1_pd(4503599627371519.0));
+			return _mm_or_pd(_mm_and_pd(x.v, _mm_castsi128_pd(_mm_set1_epi64x(0x000FFFFFFFFFFFFFll))), _mm_set1_pd(1.));
+		}
+		template <size_t Bit>
+		inline pack_mask<double, 2> low_bit_mask(const pack<double, 2>& shifted) {
+			//対象のビットを各32bitの最上位に移動して符号拡張
+			__m128i t = _mm_srai_epi32(_mm_slli_epi64(_mm_castpd_si128(shifted.v), 63 - Bit), 31);
+			return _mm_castsi128_pd(_mm_shuffle_epi32(t, _MM_SHUFFLE(3, 3, 1, 1)));
+		}
+
+
+		//SSE2(float×4)
+		template <>
+		struct pack<float, 4> {
+			using value_type = float;
+			using mask_type = pack_mask<float, 4>;
+			static constexpr size_t size = 4;
+
+			__m128 v;
+
+			pack() = default;
+			pack(__m128 x) : v(x) {}
+			pack(float x) : v(_mm_set1_ps(x)) {}
+
+			static pack load(const float* p) { return _mm_loadu_ps(p); }
+			void store(float* p) const { _mm_storeu_ps(p, v); }
+
+			pack operator-() const { return _mm_xor_ps(v, _mm_set1_ps(-0.f)); }
+			pack& operator+=(const pack& x) { v = _mm_add_ps(v, x.v); return *this; }
+			pack& operator-=(const pack& x) { v = _mm_sub_ps(v, x.v); return *this; }
+			pack& operator*=(const pack& x) { v = _mm_mul_ps(v, x.v); return *this; }
+			pack& operator/=(const pack& x) { v = _mm_div_ps(v, x.v); return *this; }
+		};
+		inline pack<float, 4> operator+(const pack<float, 4>& a, const pack<float, 4>& b) { return _mm_add_ps(a.v, b.v); }
+		inline pack<float, 4> operator-(const pack<float, 4>& a, const pack<float, 4>& b) { return _mm_sub_ps(a.v, b.v); }
+		inline pack<float, 4> operator*(const pack<float, 4>& a, const pack<float, 4>& b) { return _mm_mul_ps(a.v, b.v); }
+		inline pack<float, 4> operator/(const pack<float, 4>& a, const pack<float, 4>& b) { return _mm_div_ps(a.v, b.v); }
+		inline pack_mask<float, 4> operator<(const pack<float, 4>& a, const pack<float, 4>& b) { return _mm_cmplt_ps(a.v, b.v); }
+		inline pack_mask<float, 4> operator>(const pack<float, 4>& a, const pack<float, 4>& b) { return _mm_cmpgt_ps(a.v, b.v); }
+		inline pack_mask<float, 4> operator<=(const pack<float, 4>& a, const pack<float, 4>& b) { return _mm_cmple_ps(a.v, b.v); }
+		inline pack_mask<float, 4> operator>=(const pack<float, 4>& a, const pack<float, 4>& b) { return _mm_cmpge_ps(a.v, b.v); }
+		inline pack_mask<float, 4> operator==(const pack<float, 4>& a, const pack<float, 4>& b) { return _mm_cmpeq_ps(a.v, b.v); }
+		inline pack_mask<float, 4> operator!=(const pack<float, 4>& a, const pack<float, 4>& b) { return _mm_cmpneq_ps(a.v, b.v); }
+		inline pack<float, 4> select(const pack_mask<float, 4>& m, const pack<float, 4>& a, const pack<float, 4>& b) {
+			return _mm_or_ps(_mm_and_ps(m.m, a.v), _mm_andnot_ps(m.m, b.v));
+		}
+		inline pack<float, 4> abs(const pack<float, 4>& x) { return _mm_andnot_ps(_mm_set1_ps(-0.f), x.v); }
+		inline pack<float, 4> sqrt(const pack<float, 4>& x) { return _mm_sqrt_ps(x.v); }
+#if defined IMATH_FMA
+		inline pack<float, 4> fma(const pack<float, 4>& a, const pack<float, 4>& b, const pack<float, 4>& c) { return _mm_fmadd_ps(a.v, b.v, c.v); }
+#endif
+		inline pack<float, 4> pow2i(const pack<float, 4>& n) {
+			return _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm_add_ps(n.v, _mm_set1_ps(8388735.f))), 23));
+		}
+		inline pack<float, 4> split_exponent(const pack<float, 4>& x, pack<float, 4>& e) {
+			__m128i bits = _mm_castps_si128(x.v);
+			__m128 t = _mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(bits, 23), _mm_castps_si128(_mm_set1_ps(8388608.f))));
+			e = _mm_sub_ps(t, _mm_set1_ps(8388735.f));
+			return _mm_or_ps(_mm_and_ps(x.v, _mm_castsi128_ps(_mm_set1_epi32(0x007FFFFF))), _mm_set1_ps(1.f));
+		}
+		inline pack<double, 2> widen_low(const pack<float, 4>& x) { return _mm_cvtps_pd(x.v); }
+		inline pack<double, 2> widen_high(const pack<float, 4>& x) { return _mm_cvtps_pd(_mm_movehl_ps(x.v, x.v)); }
+		inline pack<float, 4> narrow(const pack<double, 2>& lo, const pack<double, 2>& hi) {
+			return _mm_movelh_ps(_mm_cvtpd_ps(lo.v), _mm_cvtpd_ps(hi.v));
+		}
+#endif
+
+
+#if defined IMATH_SIMD_AVX2
+		//AVX2のマスク
+		template <>
+		struct pack_mask<double, 4> {
+			__m256d m;
+			pack_mask(__m256d x) : m(x) {}
+		};
+		inline pack_mask<double, 4> operator&(const pack_mask<double, 4>& a, const pack_mask<double, 4>& b) { return _mm256_and_pd(a.m, b.m); }
+		inline pack_mask<double, 4> operator|(const pack_mask<double, 4>& a, const pack_mask<double, 4>& b) { return _mm256_or_pd(a.m, b.m); }
+		inline pack_mask<double, 4> operator^(const pack_mask<double, 4>& a, const pack_mask<double, 4>& b) { return _mm256_xor_pd(a.m, b.m); }
+		inline pack_mask<double, 4> operator!(const pack_mask<double, 4>& a) { return _mm256_xor_pd(a.m, _mm256_castsi256_pd(_mm256_set1_epi32(-1))); }
+		inline bool any(const pack_mask<double, 4>& a) { return _mm256_movemask_pd(a.m) != 0; }
+		inline bool all(const pack_mask<double, 4>& a) { return _mm256_movemask_pd(a.m) == 0xF; }
+
+		template <>
+		struct pack_mask<float, 8> {
+			__m256 m;
+			pack_mask(__m256 x) : m(x) {}
+		};
+		inline pack_mask<float, 8> operator&(const pack_mask<float, 8>& a, const pack_mask<float, 8>& b) { return _mm256_and_ps(a.m, b.m); }
+		inline pack_mask<float, 8> operator|(const pack_mask<float, 8>& a, const pack_mask<float, 8>& b) { return _mm256_or_ps(a.m, b.m); }
+		inline pack_mask<float, 8> operator^(const pack_mask<float, 8>& a, const pack_mask<float, 8>& b) { return _mm256_xor_ps(a.m, b.m); }
+		inline pack_mask<float, 8> operator!(const pack_mask<float, 8>& a) { return _mm256_xor_ps(a.m, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+		inline bool any(const pack_mask<float, 8>& a) { return _mm256_movemask_ps(a.m) != 0; }
+		inline bool all(const pack_mask<float, 8>& a) { return _mm256_movemask_ps(a.m) == 0xFF; }
+
+
+		//AVX2(double×4)
+		template <>
+		struct pack<double, 4> {
+			using value_type = double;
+			using mask_type = pack_mask<double, 4>;
+			static constexpr size_t size = 4;
+
+			__m256d v;
+
+			pack() = default;
+			pack(__m256d x) : v(x) {}
+			pack(double x) : v(_mm256_set1_pd(x)) {}
+
+			static pack load(const double* p) { return _mm256_loadu_pd(p); }
+			void store(double* p) const { _mm256_storeu_pd(p, v); }
+
+			pack operator-() const { return _mm256_xor_pd(v, _mm256_set1_pd(-0.)); }
+			pack& operator+=(const pack& x) { v = _mm256_add_pd(v, x.v); return *this; }
+			pack& operator-=(const pack& x) { v = _mm256_sub_pd(v, x.v); return *this; }
+			pack& operator*=(const pack& x) { v = _mm256_mul_pd(v, x.v); return *this; }
+			pack& operator/=(const pack& x) { v = _mm256_div_pd(v, x.v); return *this; }
+		};
+		inline pack<double, 4> operator+(const pack<double, 4>& a, const pack<double, 4>& b) { return _mm256_add_pd(a.v, b.v); }
+		inline pack<double, 4> operator-(const pack<double, 4>& a, const pack<double, 4>& b) { return _mm256_sub_pd(a.v, b.v); }
+		inline pack<double, 4> operator*(const pack<double, 4>& a, const pack<double, 4>& b) { return _mm256_mul_pd(a.v, b.v); }
+		inline pack<double, 4> operator/(const pack<double, 4>& a, const pack<double, 4>& b) { return _mm256_div_pd(a.v, b.v); }
+		inline pack_mask<double, 4> operator<(const pack<double, 4>& a, const pack<double, 4>& b) { return _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ); }
+		inline pack_mask<double, 4> operator>(const pack<double, 4>& a, const pack<double, 4>& b) { return _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ); }
+		inline pack_mask<double, 4> operator<=(const pack<double, 4>& a, const pack<double, 4>& b) { return _mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ); }
+		inline pack_mask<double, 4> operator>=(const pack<double, 4>& a, const pack<double, 4>& b) { return _mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ); }
+		inline pack_mask<double, 4> operator==(const pack<double, 4>& a, const pack<double, 4>& b) { return _mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ); }
+		inline pack_mask<double, 4> operator!=(const pack<double, 4>& a, const pack<double, 4>& b) { return _mm256_cmp_pd(a.v, b.v, _CMP_NEQ_UQ); }
+		inline pack<double, 4> select(const pack_mask<double, 4>& m, const pack<double, 4>& a, const pack<double, 4>& b) {
+			return _mm256_blendv_pd(b.v, a.v, m.m);
+		}
+		inline pack<double, 4> abs(const pack<double, 4>& x) { return _mm256_andnot_pd(_mm256_set1_pd(-0.), x.v); }
+		inline pack<double, 4> sqrt(const pack<double, 4>& x) { return _mm256_sqrt_pd(x.v); }
+#if defined IMATH_FMA
+		inline pack<double, 4> fma(const pack<double, 4>& a, const pack<double, 4>& b, const pack<double, 4>& c) { return _mm256_fmadd_pd(a.v, b.v, c.v); }
+#endif
+		inline pack<double, 4> pow2i(const pack<double, 4>& n) {
+			return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(_mm256_add_pd(n.v, _mm256_set1_pd(4503599627371519.0))), 52));
+		}
+		inline pack<double, 4> split_exponent(const pack<double, 4>& x, pack<double, 4>& e) {
+			__m256i bits = _mm256_castpd_si256(x.v);
+			__m256d t = _mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.0))));
+			e = _mm256_sub_pd(t, _mm256_set1_pd(4503599627371519.0));
+			return _mm256_or_pd(_mm256_and_pd(x.v, _mm256_castsi256_pd(_mm256_set1_epi64x(0x000FFFFFFFFFFFFFll))), _mm256_set1_pd(1.));
+		}
+		template <size_t Bit>
+		inline pack_mask<double, 4> low_bit_mask(const pack<double, 4>& shifted) {
+			__m256i t = _mm256_slli_epi64(_mm256_castpd_si256(shifted.v), 63 - Bit);
+			return _mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_setzero_si256(), t));
+		}
+
+
+		//AVX2(float×8)
+		template <>
+		struct pack<float, 8> {
+			using value_type = float;
+			using mask_type = pack_mask<float, 8>;
+			static constexpr size_t size = 8;
+
+			__m256 v;
+
+			pack() = default;
+			pack(__m256 x) : v(x) {}
+			pack(float x) : v(_mm256_set1_ps(x)) {}
+
+			static pack load(const float* p) { return _mm256_loadu_ps(p); }
+			void store(float* p) const { _mm256_storeu_ps(p, v); }
+
+			pack operator-() const { return _mm256_xor_ps(v, _mm256_set1_ps(-0.f)); }
+			pack& operator+=(const pack& x) { v = _mm256_add_ps(v, x.v); return *this; }
+			pack& operator-=(const pack& x) { v = _mm256_sub_ps(v, x.v); return *this; }
+			pack& operator*=(const pack& x) { v = _mm256_mul_ps(v, x.v); return *this; }
+			pack& operator/=(const pack& x) { v = _mm256_div_ps(v, x.v); return *this; }
+		};
+		inline pack<float, 8> operator+(const pack<float, 8>& a, const pack<float, 8>& b) { return _mm256_add_ps(a.v, b.v); }
+		inline pack<float, 8> operator-(const pack<float, 8>& a, const pack<float, 8>& b) { return _mm256_sub_ps(a.v, b.v); }
+		inline pack<float, 8> operator*(const pack<float, 8>& a, const pack<float, 8>& b) { return _mm256_mul_ps(a.v, b.v); }
+		inline pack<float, 8> operator/(const pack<float, 8>& a, const pack<float, 8>& b) { return _mm256_div_ps(a.v, b.v); }
+		inline pack_mask<float, 8> operator<(const pack<float, 8>& a, const pack<float, 8>& b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+		inline pack_mask<float, 8> operator>(const pack<float, 8>& a, const pack<float, 8>& b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+		inline pack_mask<float, 8> operator<=(const pack<float, 8>& a, const pack<float, 8>& b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ); }
+		inline pack_mask<float, 8> operator>=(const pack<float, 8>& a, const pack<float, 8>& b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ); }
+		inline pack_mask<float, 8> operator==(const pack<float, 8>& a, const pack<float, 8>& b) { return _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ); }
+		inline pack_mask<float, 8> operator!=(const pack<float, 8>& a, const pack<float, 8>& b) { return _mm256_cmp_ps(a.v, b.v, _CMP_NEQ_UQ); }
+		inline pack<float, 8> select(const pack_mask<float, 8>& m, const pack<float, 8>& a, const pack<float, 8>& b) {
+			return _mm256_blendv_ps(b.v, a.v, m.m);
+		}
+		inline pack<float, 8> abs(const pack<float, 8>& x) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), x.v); }
+		inline pack<float, 8> sqrt(const pack<float, 8>& x) { return _mm256_sqrt_ps(x.v); }
+#if defined IMATH_FMA
+		inline pack<float, 8> fma(const pack<float, 8>& a, const pack<float, 8>& b, const pack<float, 8>& c) { return _mm256_fmadd_ps(a.v, b.v, c.v); }
+#endif
+		inline pack<float, 8> pow2i(const pack<float, 8>& n) {
+			return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(_mm256_add_ps(n.v, _mm256_set1_ps(8388735.f))), 23));
+		}
+		inline pack<float, 8> split_exponent(const pack<float, 8>& x, pack<float, 8>& e) {
+			__m256i bits = _mm256_castps_si256(x.v);
+			__m256 t = _mm256_castsi256_ps(_mm256_or_si256(_mm256_srli_epi32(bits, 23), _mm256_castps_si256(_mm256_set1_ps(8388608.f))));
+			e = _mm256_sub_ps(t, _mm256_set1_ps(8388735.f));
+			return _mm256_or_ps(_mm256_and_ps(x.v, _mm256_castsi256_ps(_mm256_set1_epi32(0x007FFFFF))), _mm256_set1_ps(1.f));
+		}
+		inline pack<double, 4> widen_low(const pack<float, 8>& x) { return _mm256_cvtps_pd(_mm256_castps256_ps128(x.v)); }
+		inline pack<double, 4> widen_high(const pack<float, 8>& x) { return _mm256_cvtps_pd(_mm256_extractf128_ps(x.v, 1)); }
+		inline pack<float, 8> narrow(const pack<double, 4>& lo, const pack<double, 4>& hi) {
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo.v)), _mm256_cvtpd_ps(hi.v), 1);
+		}
+#endif
+
+
+		//利用可能な最大幅のpack
+		template <class T>
+		struct native_pack {
+			using type = pack<T, 1>;
+		};
+#if defined IMATH_SIMD_AVX2
+		template <>
+		struct native_pack<double> {
+			using type = pack<double, 4>;
+		};
+		template <>
+		struct native_pack<float> {
+			using type = pack<float, 8>;
+		};
+#elif defined IMATH_SIMD_SSE2
+		template <>
+		struct native_pack<double> {
+			using type = pack<double, 2>;
+		};
+		template <>
+		struct native_pack<float> {
+			using type = pack<float, 4>;
+		};
+#endif
+		template <class T>
+		using native_pack_t = typename native_pack<T>::type;
+	}
+}
+
+
+#endif
\ No newline at end of file
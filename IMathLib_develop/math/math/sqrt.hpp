@@ -5,6 +5,7 @@
 
 #include "IMathLib/utility/type_traits.hpp"
 #include "IMathLib/math/math/abs.hpp"
+#include "IMathLib/math/math/elementary_kernel.hpp"
 
 namespace iml {
 
@@ -28,7 +29,7 @@ namespace iml {
 	struct Sqrt {
 		using result_type = typename math_function_type<T>::type;
 
-		static constexpr result_type _sqrt_(const T& x) {
+		static constexpr result_type _sqrt_(const T& x, false_type) {
 
 			if ((x == 0) || (x == 1)) return x;
 
@@ -54,6 +55,13 @@ namespace iml {
 			}
 			return temp * x1 * c;
 		}
+		//実行時はハードウェア命令で計算
+		static constexpr result_type _sqrt_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _sqrt_(x, false_type()) : Elementary_kernel<result_type>::_sqrt_(static_cast<result_type>(x));
+		}
+		static constexpr result_type _sqrt_(const T& x) {
+			return _sqrt_(x, is_elementary_kernel_type<result_type>());
+		}
 	};
 	template <class T>
 	inline constexpr auto sqrt(const T& x) { return Sqrt<T>::_sqrt_(x); }
@@ -2,24 +2,60 @@
 #define _IMATH_MATH_STIRLING_NUMBER_HPP
 
 #include "IMathLib/math/math/math_traits.hpp"
+#include "IMathLib/math/math/binom.hpp"
+#include <vector>
 
 namespace iml {
 
-	//第1種スターリング数(n > 0)
+	//第1種スターリング数(符号なし)の漸化式 c(n + 1, k) = n c(n, k) + c(n, k - 1)
+	struct Stirling1_recurrence {
+		static constexpr size_t a(size_t n, size_t) { return n; }
+	};
+	//第2種スターリング数の漸化式 S(n + 1, k) = k S(n, k) + S(n, k - 1)
+	struct Stirling2_recurrence {
+		static constexpr size_t a(size_t, size_t k) { return k; }
+	};
+	inline constexpr const Combinatorial_triangle<Stirling1_recurrence>& stirling1_table = combinatorial_triangle<Stirling1_recurrence>;
+	inline constexpr const Combinatorial_triangle<Stirling2_recurrence>& stirling2_table = combinatorial_triangle<Stirling2_recurrence>;
+
+	//三角形状の数表のn行目のk列目までをInteger型で厳密に計算(O(nk))
+	template <class Recurrence, class Integer>
+	inline Integer __combinatorial_triangle_value(size_t n, size_t k) {
+		if (k > n) return Integer(0);
+		std::vector<Integer> row(k + 1, Integer(0));
+		row[0] = 1;
+		for (size_t i = 0; i < n; ++i)
+			for (size_t j = ((i + 1 < k) ? i + 1 : k) + 1; j-- > 0;)
+				row[j] = Integer(Recurrence::a(i, j)) * row[j] + ((j == 0) ? Integer(0) : row[j - 1]);
+		return row[k];
+	}
+
+
+	//第1種スターリング数(符号なし, n > 0)
 	inline constexpr int_t stirling_number1(int_t n, int_t k) {
 		if (k < 1 || k > n) return 0;
-		if (k == n) return 1;
-		return (n - 1) * stirling_number1(n - 1, k)
-			+ stirling_number1(n - 1, k - 1);
+		if (size_t(n) < stirling1_table.rows) return int_t(stirling1_table(n, k));
+		return __combinatorial_triangle_value<Stirling1_recurrence, int_t>(n, k);
+	}
+	template <class Integer>
+	inline Integer stirling_number1(size_t n, size_t k) {
+		if (k > n) return Integer(0);
+		if (n < stirling1_table.rows) return Integer(stirling1_table(n, k));
+		return __combinatorial_triangle_value<Stirling1_recurrence, Integer>(n, k);
 	}
 
 
 	//第2種スターリング数(n > 0)
 	inline constexpr int_t stirling_number2(int_t n, int_t k) {
 		if (k < 1 || k > n) return 0;
-		if (k == 1 || k == n) return 1;
-		return k * stirling_number2(n - 1, k)
-			+ stirling_number2(n - 1, k - 1);
+		if (size_t(n) < stirling2_table.rows) return int_t(stirling2_table(n, k));
+		return __combinatorial_triangle_value<Stirling2_recurrence, int_t>(n, k);
+	}
+	template <class Integer>
+	inline Integer stirling_number2(size_t n, size_t k) {
+		if (k > n) return Integer(0);
+		if (n < stirling2_table.rows) return Integer(stirling2_table(n, k));
+		return __combinatorial_triangle_value<Stirling2_recurrence, Integer>(n, k);
 	}
 }
 
@@ -5,6 +5,7 @@
 #include "IMathLib/math/math/pi.hpp"
 #include "IMathLib/math/math/numerical_correction.hpp"
 #include "IMathLib/math/math/abs.hpp"
+#include "IMathLib/math/math/elementary_kernel.hpp"
 
 
 namespace iml {
@@ -36,11 +37,17 @@ namespace iml {
 			return x2;
 		}
 
+		static constexpr result_type _cos_(const T& x, false_type) {
+			//周期性と対称性により[0, π]へ縮約する(剰余は誤差なく求まり, 2π - tempもSterbenzの補題により誤差が生じない)
+			result_type temp = mod<result_type>(abs(static_cast<result_type>(x)), 2 * pi<result_type>);
+			return (temp > pi<result_type>) ? _cos_impl_(2 * pi<result_type> - temp) : _cos_impl_(temp);
+		}
+		//実行時はカーネルで計算
+		static constexpr result_type _cos_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _cos_(x, false_type()) : Elementary_kernel<result_type>::_cos_(static_cast<result_type>(x));
+		}
 		static constexpr result_type _cos_(const T& x) {
-			//周期性
-			result_type temp = mod<result_type>(x, 2 * pi<result_type>);
-			//正数値で演算する(余分な比較を省くため)
-			return (temp < 0) ? _cos_impl_(-temp) : _cos_impl_(temp);
+			return _cos_(x, is_elementary_kernel_type<result_type>());
 		}
 	};
 	template <class T>
@@ -52,8 +59,16 @@ namespace iml {
 	struct Sin {
 		using result_type = typename math_function_type<T>::type;
 
+		static constexpr result_type _sin_(const T& x, false_type) {
+			//xが大きいときにπ/2 - xの丸め誤差が生じないように先に周期で縮約する
+			return cos(pi<result_type> / 2 - mod<result_type>(x, 2 * pi<result_type>));
+		}
+		//実行時はカーネルで計算(π/2 - xの丸め誤差も生じない)
+		static constexpr result_type _sin_(const T& x, true_type) {
+			return IMATH_IS_CONSTANT_EVALUATED() ? _sin_(x, false_type()) : Elementary_kernel<result_type>::_sin_(static_cast<result_type>(x));
+		}
 		static constexpr result_type _sin_(const T& x) {
-			return cos(pi<result_type> / 2 - x);
+			return _sin_(x, is_elementary_kernel_type<result_type>());
 		}
 	};
 	template <class T>
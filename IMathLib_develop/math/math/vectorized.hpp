@@ -0,0 +1,480 @@
+﻿#ifndef IMATH_MATH_MATH_VECTORIZED_HPP
+#define IMATH_MATH_MATH_VECTORIZED_HPP
+
+#include "IMathLib/math/math/elementary_kernel.hpp"
+#include "IMathLib/math/math/erf.hpp"
+#include "IMathLib/math/math/erf_kernel.hpp"
+#include "IMathLib/math/math/exp.hpp"
+#include "IMathLib/math/math/gamma.hpp"
+#include "IMathLib/math/math/gamma_kernel.hpp"
+#include "IMathLib/math/math/riemann_zeta.hpp"
+#include "IMathLib/math/math/rounding_kernel.hpp"
+#include "IMathLib/math/math/log.hpp"
+#include "IMathLib/math/math/numerical_correction.hpp"
+#include "IMathLib/math/math/orthogonal_polynomials.hpp"
+#include "IMathLib/math/math/pow.hpp"
+#include "IMathLib/math/math/trigonometric_function.hpp"
+#include "IMathLib/math/math/zeta_kernel.hpp"
+#include "IMathLib/utility/iterator.hpp"
+
+//配列に対する初等関数, 丸め関数とガンマ関数族の一括評価
+//float/doubleの連続領域(ポインタ)はSIMDのカーネルで処理し, それ以外は要素ごとに評価する
+//(不完全ガンマ関数は反復回数が要素ごとに異なるため連続領域でもスカラーのカーネルを要素ごとに適用する)
+
+IMATH_FP_CONTRACT_OFF_PUSH
+namespace iml {
+	namespace simd {
+
+		//各関数のカーネルと汎用実装の組
+		struct exp_function {
+			template <class P>
+			P operator()(const P& x) const { return Elementary_kernel_impl<typename P::value_type>::_exp_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::exp(x); }
+		};
+		struct log_function {
+			template <class P>
+			P operator()(const P& x) const { return Elementary_kernel_impl<typename P::value_type>::_log_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::log(x); }
+		};
+		struct sin_function {
+			template <class P>
+			P operator()(const P& x) const { return Elementary_kernel_impl<typename P::value_type>::_sin_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::sin(x); }
+		};
+		struct cos_function {
+			template <class P>
+			P operator()(const P& x) const { return Elementary_kernel_impl<typename P::value_type>::_cos_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::cos(x); }
+		};
+		//要素がfloat/doubleならば汎用の反復子でもスカラーのカーネルで計算する(負の底や特殊値の扱いを連続領域と一致させる)
+		template <class T, class S>
+		inline auto __pow_generic(const T& x, const S& y, true_type) { return Elementary_kernel<T>::_pow_(x, static_cast<T>(y)); }
+		template <class T, class S>
+		inline auto __pow_generic(const T& x, const S& y, false_type) { return iml::pow(x, y); }
+		struct pow_function {
+			template <class P>
+			P operator()(const P& x, const P& y) const { return Elementary_kernel_impl<typename P::value_type>::_pow_(x, y); }
+			template <class T, class S>
+			auto generic(const T& x, const S& y) const { return __pow_generic(x, y, is_elementary_kernel_type<T>()); }
+		};
+		//指数を固定した冪乗
+		template <class S>
+		struct pow_scalar_function {
+			S y;
+			template <class P>
+			P operator()(const P& x) const { return Elementary_kernel_impl<typename P::value_type>::_pow_(x, P(typename P::value_type(y))); }
+			template <class T>
+			auto generic(const T& x) const { return __pow_generic(x, y, is_elementary_kernel_type<T>()); }
+		};
+
+		struct lgamma_function {
+			template <class P>
+			P operator()(const P& x) const { return Gamma_kernel_impl<typename P::value_type>::_lgamma_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::lgamma(x); }
+		};
+		struct gamma_function {
+			template <class P>
+			P operator()(const P& x) const { return Gamma_kernel_impl<typename P::value_type>::_gamma_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::gamma(x); }
+		};
+		struct digamma_function {
+			template <class P>
+			P operator()(const P& x) const { return Gamma_kernel_impl<typename P::value_type>::_digamma_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::digamma(x); }
+		};
+		struct riemann_zeta_function {
+			template <class P>
+			P operator()(const P& x) const { return Zeta_kernel_impl<typename P::value_type>::_riemann_zeta_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::riemann_zeta(x); }
+		};
+		struct dirichlet_eta_function {
+			template <class P>
+			P operator()(const P& x) const { return Zeta_kernel_impl<typename P::value_type>::_dirichlet_eta_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::dirichlet_eta(x); }
+		};
+		struct erf_function {
+			template <class P>
+			P operator()(const P& x) const { return Erf_kernel_impl<typename P::value_type>::_erf_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::erf(x); }
+		};
+		struct erfc_function {
+			template <class P>
+			P operator()(const P& x) const { return Erf_kernel_impl<typename P::value_type>::_erfc_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::erfc(x); }
+		};
+		struct erfcx_function {
+			template <class P>
+			P operator()(const P& x) const { return Erf_kernel_impl<typename P::value_type>::_erfcx_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::erfcx(x); }
+		};
+		struct erfinv_function {
+			template <class P>
+			P operator()(const P& x) const { return Erf_kernel_impl<typename P::value_type>::_erfinv_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::erfinv(x); }
+		};
+		struct erfcinv_function {
+			template <class P>
+			P operator()(const P& x) const { return Erf_kernel_impl<typename P::value_type>::_erfcinv_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::erfcinv(x); }
+		};
+		struct floor_function {
+			template <class P>
+			P operator()(const P& x) const { return Rounding_kernel_impl<typename P::value_type>::_floor_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::floor(x); }
+		};
+		struct ceil_function {
+			template <class P>
+			P operator()(const P& x) const { return Rounding_kernel_impl<typename P::value_type>::_ceil_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::ceil(x); }
+		};
+		struct trunc_function {
+			template <class P>
+			P operator()(const P& x) const { return Rounding_kernel_impl<typename P::value_type>::_trunc_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::trunc(x); }
+		};
+		struct round_function {
+			template <class P>
+			P operator()(const P& x) const { return Rounding_kernel_impl<typename P::value_type>::_round_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::round(x); }
+		};
+		struct nearbyint_function {
+			template <class P>
+			P operator()(const P& x) const { return Rounding_kernel_impl<typename P::value_type>::_nearbyint_(x); }
+			template <class T>
+			auto generic(const T& x) const { return iml::nearbyint(x); }
+		};
+		//正規化不完全ガンマ関数(Upper = trueならばQ(a, x), 引数の順はx, a)
+		template <bool Upper>
+		struct gamma_pq_function {
+			template <class P>
+			P operator()(const P& x, const P& a) const {
+				using value_type = typename P::value_type;
+				value_type xs[P::size], as[P::size];
+				x.store(xs);
+				a.store(as);
+				for (size_t i = 0; i < P::size; ++i) xs[i] = Upper ? Gamma_kernel<value_type>::_gamma_q_(as[i], xs[i]) : Gamma_kernel<value_type>::_gamma_p_(as[i], xs[i]);
+				return P::load(xs);
+			}
+			template <class T, class S>
+			auto generic(const T& x, const S& a) const { return Upper ? iml::gamma_q(a, x) : iml::gamma_p(a, x); }
+		};
+		//aを固定した正規化不完全ガンマ関数
+		template <bool Upper, class S>
+		struct gamma_pq_scalar_function {
+			S a;
+			template <class P>
+			P operator()(const P& x) const { return gamma_pq_function<Upper>()(x, P(typename P::value_type(a))); }
+			template <class T>
+			auto generic(const T& x) const { return Upper ? iml::gamma_q(a, x) : iml::gamma_p(a, x); }
+		};
+
+		//次数nを固定した直交多項式
+		template <class Recurrence>
+		struct orthogonal_polynomials_function {
+			Recurrence r;
+			size_t n;
+			template <class P>
+			P operator()(const P& x) const { return orthogonal_polynomials(r, n, x); }
+			template <class T>
+			auto generic(const T& x) const { return orthogonal_polynomials(r, n, static_cast<decltype(r.a(0))>(x)); }
+		};
+		//係数[first, last)を固定した直交多項式の級数
+		template <class Recurrence, class BidirectionalIterator>
+		struct orthogonal_series_function {
+			Recurrence r;
+			BidirectionalIterator first, last;
+			template <class P>
+			P operator()(const P& x) const { return orthogonal_series(r, x, first, last); }
+			template <class T>
+			auto generic(const T& x) const { return orthogonal_series(r, static_cast<decltype(r.a(0))>(x), first, last); }
+		};
+
+		//イテレータであるかの判定(iterator_traitsを持たない型でもエラーにしない)
+		template <class T, class = void>
+		struct is_iterator_type : false_type {};
+		template <class T>
+		struct is_iterator_type<T, void_t<typename iterator_traits<T>::iterator_category>> : true_type {};
+	}
+
+
+	//配列に対する関数の適用
+	template <class InputIterator, class OutputIterator>
+	struct Vectorized_function {
+		template <class F>
+		static OutputIterator _apply_(InputIterator first, InputIterator last, OutputIterator result, F f) {
+			for (; first != last; ++first, ++result) *result = f.generic(*first);
+			return result;
+		}
+		template <class InputIterator2, class F>
+		static OutputIterator _apply_(InputIterator first, InputIterator last, InputIterator2 first2, OutputIterator result, F f) {
+			for (; first != last; ++first, ++first2, ++result) *result = f.generic(*first, *first2);
+			return result;
+		}
+	};
+	//float/doubleの連続領域
+	template <class T>
+	struct Vectorized_array {
+		using pack_type = simd::native_pack_t<T>;
+		using scalar_type = simd::pack<T, 1>;
+
+		template <class F>
+		static T* _apply_(const T* first, const T* last, T* result, F f) {
+			size_t n = size_t(last - first), i = 0;
+			for (; i + pack_type::size <= n; i += pack_type::size) f(pack_type::load(first + i)).store(result + i);
+			//端数
+			for (; i < n; ++i) f(scalar_type(first[i])).store(result + i);
+			return result + n;
+		}
+		template <class F>
+		static T* _apply_(const T* first, const T* last, const T* first2, T* result, F f) {
+			size_t n = size_t(last - first), i = 0;
+			for (; i + pack_type::size <= n; i += pack_type::size) f(pack_type::load(first + i), pack_type::load(first2 + i)).store(result + i);
+			for (; i < n; ++i) f(scalar_type(first[i]), scalar_type(first2[i])).store(result + i);
+			return result + n;
+		}
+		template <class F>
+		static T* _apply_(const T* first, const T* last, T* first2, T* result, F f) {
+			return _apply_(first, last, static_cast<const T*>(first2), result, f);
+		}
+		//2つ目の引数が連続領域でないとき
+		template <class InputIterator2, class F>
+		static T* _apply_(const T* first, const T* last, InputIterator2 first2, T* result, F f) {
+			for (; first != last; ++first, ++first2, ++result) f(scalar_type(first[0]), scalar_type(T(*first2))).store(result);
+			return result;
+		}
+	};
+	template <>
+	struct Vectorized_function<double*, double*> : Vectorized_array<double> {};
+	template <>
+	struct Vectorized_function<const double*, double*> : Vectorized_array<double> {};
+	template <>
+	struct Vectorized_function<float*, float*> : Vectorized_array<float> {};
+	template <>
+	struct Vectorized_function<const float*, float*> : Vectorized_array<float> {};
+
+
+	//指数関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vexp(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::exp_function());
+	}
+	//自然対数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vlog(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::log_function());
+	}
+	//正弦関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vsin(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::sin_function());
+	}
+	//余弦関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vcos(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::cos_function());
+	}
+
+	//対数ガンマ関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vlgamma(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::lgamma_function());
+	}
+	//ガンマ関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vgamma(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::gamma_function());
+	}
+	//ディガンマ関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vdigamma(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::digamma_function());
+	}
+	//リーマンのゼータ関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vriemann_zeta(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::riemann_zeta_function());
+	}
+	//ディリクレのイータ関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vdirichlet_eta(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::dirichlet_eta_function());
+	}
+
+	//誤差関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator verf(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::erf_function());
+	}
+	//相補誤差関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator verfc(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::erfc_function());
+	}
+	//スケーリングされた相補誤差関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator verfcx(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::erfcx_function());
+	}
+	//逆誤差関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator verfinv(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::erfinv_function());
+	}
+	//逆相補誤差関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator verfcinv(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::erfcinv_function());
+	}
+
+	//冪乗(yがイテレータならば要素ごとの冪乗, そうでなければ共通の指数)
+	template <class InputIterator, class S, class OutputIterator>
+	inline OutputIterator _vpow_(InputIterator first, InputIterator last, const S& y, OutputIterator result, false_type) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::pow_scalar_function<S>{ y });
+	}
+	template <class InputIterator, class InputIterator2, class OutputIterator>
+	inline OutputIterator _vpow_(InputIterator first, InputIterator last, InputIterator2 first2, OutputIterator result, true_type) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, first2, result, simd::pow_function());
+	}
+	template <class InputIterator, class S, class OutputIterator>
+	inline OutputIterator vpow(InputIterator first, InputIterator last, const S& y, OutputIterator result) {
+		return _vpow_(first, last, y, result, simd::is_iterator_type<S>());
+	}
+
+	//床関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vfloor(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::floor_function());
+	}
+	//天井関数
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vceil(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::ceil_function());
+	}
+	//0方向への丸め
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vtrunc(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::trunc_function());
+	}
+	//四捨五入
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vround(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::round_function());
+	}
+	//最近接偶数丸め
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vnearbyint(InputIterator first, InputIterator last, OutputIterator result) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::nearbyint_function());
+	}
+
+	//正規化不完全ガンマ関数P(a, x)と Q(a, x)([first, last)がx, aがイテレータならば要素ごとのa, そうでなければ共通のa)
+	template <bool Upper, class S, class InputIterator, class OutputIterator>
+	inline OutputIterator _vgamma_pq_(const S& a, InputIterator first, InputIterator last, OutputIterator result, false_type) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::gamma_pq_scalar_function<Upper, S>{ a });
+	}
+	template <bool Upper, class InputIterator2, class InputIterator, class OutputIterator>
+	inline OutputIterator _vgamma_pq_(InputIterator2 first2, InputIterator first, InputIterator last, OutputIterator result, true_type) {
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, first2, result, simd::gamma_pq_function<Upper>());
+	}
+	template <class S, class InputIterator, class OutputIterator>
+	inline OutputIterator vgamma_p(const S& a, InputIterator first, InputIterator last, OutputIterator result) {
+		return _vgamma_pq_<false>(a, first, last, result, simd::is_iterator_type<S>());
+	}
+	template <class S, class InputIterator, class OutputIterator>
+	inline OutputIterator vgamma_q(const S& a, InputIterator first, InputIterator last, OutputIterator result) {
+		return _vgamma_pq_<true>(a, first, last, result, simd::is_iterator_type<S>());
+	}
+
+	//直交多項式(rは三項漸化式, 次数nを固定して[first, last)の各点で評価する, 漸化式の係数は事前に表にする)
+	template <class Recurrence, class InputIterator, class OutputIterator>
+	inline OutputIterator vorthogonal_polynomials(const Recurrence& r, size_t n, InputIterator first, InputIterator last, OutputIterator result) {
+		using table_type = Tabulated_recurrence<Recurrence, decltype(r.a(0))>;
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::orthogonal_polynomials_function<table_type>{ table_type(r, n + 1), n });
+	}
+	//直交多項式の級数(係数[cfirst, clast)を固定して[first, last)の各点でClenshawの方法により評価する)
+	template <class Recurrence, class BidirectionalIterator, class InputIterator, class OutputIterator>
+	inline OutputIterator vorthogonal_series(const Recurrence& r, BidirectionalIterator cfirst, BidirectionalIterator clast, InputIterator first, InputIterator last, OutputIterator result) {
+		size_t n = 0;
+		for (BidirectionalIterator it = cfirst; it != clast; ++it) ++n;
+		using table_type = Tabulated_recurrence<Recurrence, decltype(r.a(0))>;
+		return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, simd::orthogonal_series_function<table_type, BidirectionalIterator>{ table_type(r, n + 1), cfirst, clast });
+	}
+	template <class InputIterator>
+	using vectorized_value_t = typename math_function_type<typename iterator_traits<InputIterator>::value_type>::type;
+
+	//ルジャンドル多項式
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vlegendre_polynomials(size_t n, InputIterator first, InputIterator last, OutputIterator result) {
+		return vorthogonal_polynomials(Legendre_recurrence<vectorized_value_t<InputIterator>>(), n, first, last, result);
+	}
+	//ルジャンドル陪多項式
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vassociated_legendre_polynomials(size_t k, size_t m, InputIterator first, InputIterator last, OutputIterator result) {
+		if (k < m) {
+			for (; first != last; ++first, ++result) *result = vectorized_value_t<InputIterator>(0);
+			return result;
+		}
+		return vorthogonal_polynomials(Associated_legendre_recurrence<vectorized_value_t<InputIterator>>{ m }, k - m, first, last, result);
+	}
+	//ラゲール多項式
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vlaguerre_polynomials(size_t n, InputIterator first, InputIterator last, OutputIterator result) {
+		return vorthogonal_polynomials(Laguerre_recurrence<vectorized_value_t<InputIterator>>{ 0 }, n, first, last, result);
+	}
+	//ラゲール陪多項式
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vassociated_laguerre_polynomials(size_t n, size_t k, InputIterator first, InputIterator last, OutputIterator result) {
+		using value_type = vectorized_value_t<InputIterator>;
+		return vorthogonal_polynomials(Laguerre_recurrence<value_type>{ value_type(k) }, n, first, last, result);
+	}
+	//エルミート多項式
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vhermite_polynomials(size_t n, InputIterator first, InputIterator last, OutputIterator result) {
+		return vorthogonal_polynomials(Hermite_recurrence<vectorized_value_t<InputIterator>>(), n, first, last, result);
+	}
+	//第1種, 第2種チェビシェフ多項式
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vchebyshev_t_polynomials(size_t n, InputIterator first, InputIterator last, OutputIterator result) {
+		return vorthogonal_polynomials(Chebyshev_t_recurrence<vectorized_value_t<InputIterator>>(), n, first, last, result);
+	}
+	template <class InputIterator, class OutputIterator>
+	inline OutputIterator vchebyshev_u_polynomials(size_t n, InputIterator first, InputIterator last, OutputIterator result) {
+		return vorthogonal_polynomials(Chebyshev_u_recurrence<vectorized_value_t<InputIterator>>(), n, first, last, result);
+	}
+	//ヤコビ多項式
+	template <class S, class InputIterator, class OutputIterator>
+	inline OutputIterator vjacobi_polynomials(size_t n, const S& a, const S& b, InputIterator first, InputIterator last, OutputIterator result) {
+		using value_type = vectorized_value_t<InputIterator>;
+		return vorthogonal_polynomials(Jacobi_recurrence<value_type>{ value_type(a), value_type(b) }, n, first, last, result);
+	}
+	//ルジャンドル級数, チェビシェフ級数
+	template <class BidirectionalIterator, class InputIterator, class OutputIterator>
+	inline OutputIterator vlegendre_series(BidirectionalIterator cfirst, BidirectionalIterator clast, InputIterator first, InputIterator last, OutputIterator result) {
+		return vorthogonal_series(Legendre_recurrence<vectorized_value_t<InputIterator>>(), cfirst, clast, first, last, result);
+	}
+	template <class BidirectionalIterator, class InputIterator, class OutputIterator>
+	inline OutputIterator vchebyshev_t_series(BidirectionalIterator cfirst, BidirectionalIterator clast, InputIterator first, InputIterator last, OutputIterator result) {
+		return vorthogonal_series(Chebyshev_t_recurrence<vectorized_value_t<InputIterator>>(), cfirst, clast, first, last, result);
+	}
+}
+IMATH_FP_CONTRACT_POP
+
+
+#endif
\ No newline at end of file
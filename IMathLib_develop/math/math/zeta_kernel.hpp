@@ -0,0 +1,556 @@
+﻿#ifndef IMATH_MATH_MATH_ZETA_KERNEL_HPP
+#define IMATH_MATH_MATH_ZETA_KERNEL_HPP
+
+#include "IMathLib/math/math/elementary_kernel.hpp"
+#include "IMathLib/math/math/gamma_kernel.hpp"
+#include <vector>
+
+//float/doubleに対するゼータ関数とイータ関数の実行時カーネル
+//実数はBorweinの加速級数(n = 23項の係数表)でη(s)を求めてζ(s) = η(s)/(1 - 2^(1-s))とし, |s - 1| <= 3/2ではStieltjes定数によるLaurent展開, s < -1/2では関数等式で反転する
+//(k + 1)^-sは素数の冪のみを指数関数で求め, 合成数は素因数の冪の積とする(素因数は静的な篩の表で引き, 表の範囲外は直接求める)
+//複素数は|t| <= 40かつ|1 - 2^(1-s)| >= 1/2でBorweinの加速級数(n = 32, 64), それ以外ではEuler-Maclaurinの公式で評価し, Re s < 0では関数等式で反転する
+//直線上の一括評価ではline_anchor点ごとに(k + 1)^-sを直接求め, その間は隣接する点の差による(k + 1)^-Δの乗算で更新する
+//最大誤差(mpmathとの比較): double版 実数 s >= -1/2で4ulp, 複素数 Re s >= 0でmax(1, |ζ(s)|)に対して
+//点ごとの評価 12ε(|t| <= 40), 20ε(|t| <= 2000), 直線上の一括評価 40ε(|t| <= 2000, 点の間隔 <= 1/2)
+//関数等式で反転する範囲では|s log|s||ε程度
+
+IMATH_FP_CONTRACT_OFF_PUSH
+namespace iml {
+	namespace simd {
+
+		template <class T>
+		struct Zeta_kernel_impl;
+
+		//double
+		template <>
+		struct Zeta_kernel_impl<double> {
+			using elementary = Elementary_kernel_impl<double>;
+			using gamma_kernel = Gamma_kernel_impl<double>;
+			using scalar_type = pack<double, 1>;
+
+			//直線上の一括評価の1回の呼び出しの点数と(k + 1)^-sを直接計算し直す間隔
+			//(更新の乗算による丸め誤差は計算し直すまでの点数に比例して蓄積する)
+			static constexpr size_t line_segment = 32;
+			static constexpr size_t line_anchor = 8;
+			//最小の素因数の表の大きさ(これ以上の自然数は素数と同様に直接冪を求める)
+			static constexpr size_t sieve_size = 4096;
+			//(k + 1)^-sをスタック上に保持する項数(Euler-Maclaurinの公式で|σ| + |t| < 約740まで)
+			static constexpr size_t buffer_size = 256;
+
+			//e^u - 1(|u| < 0.35ではTaylor展開)
+			template <class P>
+			static P _expm1_(const P& u) {
+				P q = u * 1.1470745597729725e-11 + 1.6059043836821613e-10;
+				q = q * u + 2.08767569878681e-09;
+				q = q * u + 2.505210838544172e-08;
+				q = q * u + 2.755731922398589e-07;
+				q = q * u + 2.7557319223985893e-06;
+				q = q * u + 2.48015873015873e-05;
+				q = q * u + 0.0001984126984126984;
+				q = q * u + 0.001388888888888889;
+				q = q * u + 0.008333333333333333;
+				q = q * u + 0.041666666666666664;
+				q = q * u + 0.16666666666666666;
+				q = q * u + 0.5;
+				return select(abs(u) < 0.35, (q * u + 1.) * u, elementary::_exp_(u) - 1.);
+			}
+
+			//Borweinの加速級数 η(s) = Σ[k < 23] c[k]/(k + 1)^s (s >= -1/2)
+			template <class P>
+			static P _eta_borwein_(const P& s) {
+				//c[k] = (-1)^k(d[n] - d[k])/d[n]
+				static const double c[23] = {
+					1.0, -0.9999999999999948, 0.9999999999990757, -0.9999999999347411, 0.9999999975451689, -0.9999999430629232,
+					0.999999110970443, -0.9999900951112628, 0.9999179682378209, -0.9994795499874877, 0.9974120618174954, -0.9897328200432381,
+					0.9670289747976083, -0.9132383260618081, 0.8107799475174268, -0.653912636918443, 0.46162367553904354, -0.27447613023930717,
+					0.13188752429665085, -0.04872773989197223, 0.012905063533033742, -0.0021707423941183753, 0.00017365939152947003
+				};
+				//23以下の素数pのlog pのdouble-double
+				static const double lh[9] = {
+					0.6931471805599453, 1.0986122886681098, 1.6094379124341003, 1.9459101490553132, 2.3978952727983707, 2.5649493574615367,
+					2.833213344056216, 2.9444389791664403, 3.1354942159291497
+				};
+				static const double ll[9] = {
+					2.3190468138462996e-17, -9.07129723500153e-17, 9.280081691085902e-17, 7.323586207904907e-17, -1.253584211423161e-16, -2.5580975097208856e-18,
+					-8.500696635386325e-17, 1.9776172119535626e-16, 1.5758359867283186e-17
+				};
+				//k + 1の最小の素因数(素数は0)
+				static const size_t factor[23] = { 0, 0, 0, 2, 0, 2, 0, 2, 3, 2, 0, 2, 0, 2, 3, 2, 0, 2, 0, 2, 3, 2, 0 };
+
+				P w[23], ph, pl;
+				w[0] = 1.;
+				for (size_t k = 1, i = 0; k < 23; ++k) {
+					if (factor[k] == 0) {
+						two_prod(s, P(lh[i]), ph, pl);
+						w[k] = elementary::_exp_(-ph, -(pl + s * ll[i]));
+						++i;
+					}
+					else w[k] = w[factor[k] - 1] * w[(k + 1) / factor[k] - 1];
+				}
+				//小さい項から加算
+				P result = w[22] * c[22];
+				for (size_t k = 21; k != 0; --k) result = result + w[k] * c[k];
+				return result + 1.;
+			}
+			//|s - 1| <= 3/2に対するLaurent展開 ζ(s) = 1/(s - 1) + Σ (-1)^n γ[n]/n! (s - 1)^n (γ[n]はStieltjes定数)
+			template <class P>
+			static P _zeta_laurent_(const P& s) {
+				static const double a[20] = {
+					0.5772156649015329, 0.07281584548367673, -0.00484518159643616, -0.00034230573671722433, 9.689041939447084e-05,
+					-6.6110318108421895e-06, -3.316240908752772e-07, 1.0462094584479188e-07, -8.733218100273798e-09, 9.47827778276236e-11,
+					5.658421927608708e-11, -6.768689863513697e-12, 3.4921159366720317e-13, 4.4104247417577536e-15, -2.3997862217709992e-15,
+					2.1677312200726828e-16, -9.544466076366965e-18, -7.387676660538637e-20, 4.800850782488065e-20, -4.139956737713306e-21
+				};
+				//s - 1の丸め誤差は1/(s - 1)で補正
+				P h, l;
+				two_sum(s, P(-1.), h, l);
+				P q = P(a[19]);
+				for (size_t n = 19; n != 0; --n) q = q * h + a[n - 1];
+				P r = 1. / h;
+				return r + (q - l * r * r);
+			}
+
+			//関数等式 ζ(s) = 2(2π)^(s - 1)sin(πs/2)Γ(1 - s)ζ(1 - s) の係数
+			template <class P>
+			static P _reflection_(const P& s) {
+				P z = 1. - s, sm = s - 1., ph, pl;
+				two_prod(sm, P(1.8378770664093456), ph, pl);
+				pl = pl - sm * 7.756588316134483e-17;
+				P sn = gamma_kernel::_sin_cos_pi_<false>(s * 0.5) * 2.;
+				P result = (elementary::_exp_(ph, pl) * gamma_kernel::_gamma_(z)) * sn;
+				//Γ(1 - s)がオーバーフローする範囲は対数で合成
+				typename P::mask_type big = z > 171.;
+				if (any(big)) {
+					P h = elementary::_exp_((ph + gamma_kernel::_lgamma_(z)) * 0.5, pl * 0.5);
+					result = select(big, (h * sn) * h, result);
+				}
+				//負の偶数は自明な零点
+				return select(sn == 0., P(0.), result);
+			}
+
+			//リーマンのゼータ関数
+			template <class P>
+			static P _riemann_zeta_(const P& s) {
+				const P inf = bit_cast<double>(0x7FF0000000000000ull), nan = bit_cast<double>(0x7FF8000000000000ull);
+				typename P::mask_type reflect = s < -0.5;
+				P z = select(reflect, 1. - s, s);
+				//ζ(z) = η(z)/(1 - 2^(1 - z)) (z = 1の近傍では1 - zが誤差なく求まるためexpm1で相殺を避ける)
+				P result = _eta_borwein_(z) / -_expm1_((1. - z) * 0.6931471805599453);
+				//z > 64ではζ(z) = 1
+				result = select(z > 64., P(1.), select(z == 1., inf, result));
+				//s = 1の近傍はBorweinの加速級数の相殺が大きいためLaurent展開とする
+				typename P::mask_type near = (abs(s - 1.) <= 1.5) & (s != 1.);
+				if (any(near)) result = select(near, _zeta_laurent_(s), result);
+				if (any(reflect)) result = select(reflect, _reflection_(s) * result, result);
+				return select(s != s, nan, result);
+			}
+			//ディリクレのイータ関数
+			template <class P>
+			static P _dirichlet_eta_(const P& s) {
+				const P nan = bit_cast<double>(0x7FF8000000000000ull);
+				typename P::mask_type reflect = s < -0.5;
+				P z = select(reflect, 1. - s, s);
+				P result = select(z > 64., P(1.), _eta_borwein_(z));
+				//η(s) = (1 - 2^(1 - s))ζ(s) (s = 1ではlog 2)
+				typename P::mask_type near = abs(s - 1.) <= 1.5;
+				if (any(near)) {
+					P e = -_expm1_((1. - s) * 0.6931471805599453) * _zeta_laurent_(s);
+					result = select(near, select(s == 1., P(0.6931471805599453), e), result);
+				}
+				//η(s) = (1 - 2^(1 - s))ζ(s) = (1 - 2^z)/(1 - 2^(1 - z)) * 2(2π)^(s - 1)sin(πs/2)Γ(z) * η(z)
+				if (any(reflect)) {
+					P r = _expm1_(z * 0.6931471805599453) / _expm1_((1. - z) * 0.6931471805599453);
+					result = select(reflect, (_reflection_(s) * result) * r, result);
+				}
+				return select(s != s, nan, result);
+			}
+
+
+			//スカラーの絶対値
+			static double _abs_(double x) { return abs(scalar_type(x)).v; }
+			//複素数の乗除算
+			static void _mul_(double ar, double ai, double br, double bi, double& rr, double& ri) {
+				double t = ar * br - ai * bi;
+				ri = ar * bi + ai * br;
+				rr = t;
+			}
+			static void _div_(double ar, double ai, double br, double bi, double& rr, double& ri) {
+				//Smithの方法
+				if (_abs_(br) >= _abs_(bi)) {
+					double r = bi / br, d = br + bi * r;
+					double t = (ar + ai * r) / d;
+					ri = (ai - ar * r) / d;
+					rr = t;
+				}
+				else {
+					double r = br / bi, d = br * r + bi;
+					double t = (ar * r + ai) / d;
+					ri = (ai * r - ar) / d;
+					rr = t;
+				}
+			}
+			//arg(x + iy)
+			static double _arg_(double x, double y) {
+				if (x == 0 && y == 0) return 0;
+				double ax = _abs_(x), ay = _abs_(y);
+				double r = (ay > ax) ? ax / ay : ay / ax;
+				//atan r = 2atan(r/(1 + √(1 + r^2)))を2回用いて|r| <= tan(π/16)としてから級数で計算
+				r = r / (1. + sqrt(scalar_type(1. + r * r)).v);
+				r = r / (1. + sqrt(scalar_type(1. + r * r)).v);
+				double w = r * r, a = 1. / 29;
+				for (int_t i = 13; i >= 0; --i) a = a * -w + 1. / (2 * i + 1);
+				a *= 4. * r;
+				if (ay > ax) a = 1.5707963267948966 - a;
+				if (x < 0) a = 3.141592653589793 - a;
+				return (y < 0) ? -a : a;
+			}
+			//log w = log|w| + i arg w
+			static void _log_(double wr, double wi, double& lr, double& li) {
+				lr = elementary::_log_(scalar_type(wr * wr + wi * wi)).v * 0.5;
+				li = _arg_(wr, wi);
+			}
+
+			//m^-s = e^(-σ log m)(cos(t log m) - i sin(t log m))
+			static void _power_(double sr, double si, double m, double& wr, double& wi) {
+				scalar_type lh, ll, ph, pl, qh, ql;
+				elementary::_log_ext_(scalar_type(m), lh, ll);
+				two_prod(scalar_type(sr), lh, ph, pl);
+				two_prod(scalar_type(si), lh, qh, ql);
+				double r = elementary::_exp_(-ph, -(pl + ll * sr)).v;
+				//位相の下位部分は1次で補正
+				double c = elementary::_cos_(qh).v, sn = elementary::_sin_(qh).v, e = (ql + ll * si).v;
+				wr = r * (c - e * sn);
+				wi = -r * (sn + e * c);
+			}
+			//sieve_size未満の自然数の最小の素因数の表
+			struct Sieve_table {
+				uint16_t p[sieve_size];
+				Sieve_table() : p() {
+					for (size_t i = 2; i < sieve_size; ++i) {
+						if (p[i] != 0) continue;
+						for (size_t j = i; j < sieve_size; j += i) if (p[j] == 0) p[j] = uint16_t(i);
+					}
+				}
+			};
+			static const uint16_t* _sieve_() {
+				static const Sieve_table table;
+				return table.p;
+			}
+			//w[k] = (k + 1)^-s (0 <= k < n)を素数の冪の積で求める
+			static void _powers_(double sr, double si, size_t n, double* wr, double* wi) {
+				const uint16_t* factor = _sieve_();
+				wr[0] = 1; wi[0] = 0;
+				for (size_t k = 1; k < n; ++k) {
+					size_t p = (k + 1 < sieve_size) ? factor[k + 1] : k + 1;
+					if (p == k + 1) _power_(sr, si, double(p), wr[k], wi[k]);
+					else _mul_(wr[p - 1], wi[p - 1], wr[(k + 1) / p - 1], wi[(k + 1) / p - 1], wr[k], wi[k]);
+				}
+			}
+
+			//Borweinの加速級数の係数(n = 32, 64)
+			static const double* _borwein_coefficients_(size_t n) {
+				static const double c32[32] = {
+					1.0, -1.0, 1.0, -0.9999999999999999, 0.9999999999999956, -0.9999999999997994,
+					0.9999999999938609, -0.9999999998649105, 0.9999999977694676, -0.999999971473712, 0.9999997104537385, -0.9999976222939507,
+					0.9999839584657739, -0.9999099635808779, 0.9995752248158726, -0.9983009089656449, 0.9941953510449522, -0.9829544651872265,
+					0.9567257315191999, -0.9044921225074827, 0.8156949871875634, -0.6869855506262865, 0.528343686957736, -0.36280435095577035,
+					0.21751716776255575, -0.11124997091266166, 0.04729731398489733, -0.01619245778522999, 0.004275662228214579, -0.0008152497252699952,
+					9.970680093230157e-05, -5.86510593719421e-06
+				};
+				static const double c64[64] = {
+					1.0, -1.0, 1.0, -1.0, 1.0, -1.0,
+					1.0, -1.0, 1.0, -1.0, 1.0, -1.0,
+					1.0, -1.0, 1.0, -1.0, 1.0, -0.9999999999999998,
+					0.9999999999999972, -0.9999999999999702, 0.9999999999997115, -0.9999999999974895, 0.9999999999803195, -0.9999999998604787,
+					0.9999999991025493, -0.9999999947467751, 0.9999999719430163, -0.9999998629439174, 0.9999993863205852, -0.9999974763671956,
+					0.9999904516233729, -0.9999667064290234, 0.9998928560477877, -0.9996813237669896, 0.9991228711169807, -0.9977631603169594,
+					0.9947085987309959, -0.9883755573087835, 0.9762561159344865, -0.9548503493513126, 0.9199643690021527, -0.8675250995342194,
+					0.7948682803919022, -0.7021538058420341, 0.5933087565664054, -0.4759028607185361, 0.3597310449990248, -0.25448272876720945,
+					0.1673758986227202, -0.10169298693792123, 0.05671014439014981, -0.028834929206207595, 0.013273522671482569, -0.005488624954919322,
+					0.002020586408288343, -0.0006553535525670567, 0.00018490169012255945, -4.4664525723640834e-05, 9.048070477498685e-06, -1.4944719724498501e-06,
+					1.93221809815387e-07, -1.833491625985424e-08, 1.1351824325988556e-09, -3.439946765451077e-11
+				};
+				return (n == 32) ? c32 : c64;
+			}
+			//Borweinの加速級数の項数(|t| <= 8では32項, |t| <= 40では64項で誤差が2^-53を下回る)
+			static size_t _borwein_terms_(double at) { return (at <= 8.) ? 32 : 64; }
+			//Euler-Maclaurinの公式の項数(|s + 2j|/(2πN) <= 1/2とする)
+			static size_t _euler_maclaurin_terms_(double as) {
+				double n = (as + 60.) * 0.3183098861837907;
+				return (n < 16.) ? 16 : size_t(n) + 1;
+			}
+
+			//η(s) = Σ c[k](k + 1)^-s
+			static void _eta_sum_(const double* c, size_t n, const double* wr, const double* wi, double& er, double& ei) {
+				er = 0; ei = 0;
+				for (size_t k = n; k-- > 0;) {
+					er += c[k] * wr[k];
+					ei += c[k] * wi[k];
+				}
+			}
+			//1 - 2^(1 - s) = -(e^((1 - s)log 2) - 1)
+			static void _eta_factor_(double sr, double si, double& fr, double& fi) {
+				double a = (1. - sr) * 0.6931471805599453;
+				//位相b = -t log 2はdouble-doubleとして下位部分を1次で補正
+				scalar_type bh, bl;
+				two_prod(scalar_type(-si), scalar_type(0.6931471805599453), bh, bl);
+				bl = bl - si * 2.3190468138462996e-17;
+				double em = _expm1_(scalar_type(a)).v, e = bl.v;
+				double c = elementary::_cos_(bh).v, sn = elementary::_sin_(bh).v;
+				double hc = elementary::_cos_(bh * 0.5).v, h = elementary::_sin_(bh * 0.5).v + e * 0.5 * hc;
+				fr = 2. * h * h - em * (c - e * sn);
+				fi = -(em + 1.) * (sn + e * c);
+			}
+			//Euler-Maclaurinの公式 ζ(s) = Σ[k < N] k^-s + N^(1 - s)/(s - 1) + N^-s/2 + Σ B[2j]/(2j)! s(s + 1)...(s + 2j - 2)N^(1 - s - 2j)
+			//(w[k] = (k + 1)^-s (0 <= k < N))
+			static void _euler_maclaurin_(double sr, double si, size_t n, const double* wr, const double* wi, double& zr, double& zi) {
+				//B[2j]/(2j)!
+				static const double b[30] = {
+					0.08333333333333333, -0.001388888888888889, 3.306878306878307e-05, -8.267195767195768e-07, 2.08767569878681e-08, -5.284190138687493e-10,
+					1.3382536530684679e-11, -3.3896802963225827e-13, 8.586062056277845e-15, -2.174868698558062e-16, 5.5090028283602295e-18, -1.3954464685812522e-19,
+					3.534707039629467e-21, -8.953517427037546e-23, 2.267952452337683e-24, -5.744790668872202e-26, 1.455172475614865e-27, -3.6859949406653103e-29,
+					9.336734257095045e-31, -2.36502241570063e-32, 5.990671762482134e-34, -1.5174548844682903e-35, 3.843758125454189e-37, -9.736353072646691e-39,
+					2.466247044200681e-40, -6.247076741820743e-42, 1.5824030244644914e-43, -4.008273685948936e-45, 1.0153075855569557e-46, -2.5718041582418717e-48
+				};
+				double dn = double(n), nr = wr[n - 1], ni = wi[n - 1];
+				//補正項は小さいため先に加算する
+				double tr = nr / dn, ti = ni / dn, pr = sr, pi = si, inv2 = 1. / (dn * dn);
+				double cr = 0, ci = 0, ur, ui;
+				for (size_t j = 0; j < 30; ++j) {
+					_mul_(pr, pi, tr, ti, ur, ui);
+					cr += b[j] * ur; ci += b[j] * ui;
+					if (_abs_(b[j] * ur) + _abs_(b[j] * ui) < 1e-19 * (_abs_(cr) + _abs_(ci))) break;
+					//s(s + 1)...(s + 2j)
+					_mul_(pr, pi, sr + double(2 * j + 1), si, pr, pi);
+					_mul_(pr, pi, sr + double(2 * j + 2), si, pr, pi);
+					tr *= inv2; ti *= inv2;
+				}
+				_div_(nr * dn, ni * dn, sr - 1., si, ur, ui);
+				zr = cr + (ur + nr * 0.5);
+				zi = ci + (ui + ni * 0.5);
+				for (size_t k = n - 1; k-- > 0;) {
+					zr += wr[k];
+					zi += wi[k];
+				}
+			}
+
+			//log Γ(z) (Re z > 0, 虚部は2πの整数倍の不定性を持つ)
+			static void _lgamma_complex_(double zr, double zi, double& gr, double& gi) {
+				//Stirling級数の係数 B[2j]/(2j(2j - 1))
+				static const double b[9] = {
+					0.08333333333333333, -0.002777777777777778, 0.0007936507936507937, -0.0005952380952380953, 0.0008417508417508417, -0.0019175269175269176,
+					0.00641025641025641, -0.029550653594771242, 0.17964437236883057
+				};
+				//|z| >= 10までずらす
+				double pr = 1, pi = 0;
+				for (; zr * zr + zi * zi < 100.; zr += 1.) _mul_(pr, pi, zr, zi, pr, pi);
+				double lr, li, vr, vi, v2r, v2i;
+				_log_(zr, zi, lr, li);
+				_div_(1., 0., zr, zi, vr, vi);
+				_mul_(vr, vi, vr, vi, v2r, v2i);
+				double sr = b[8], si = 0;
+				for (size_t j = 8; j-- > 0;) {
+					_mul_(sr, si, v2r, v2i, sr, si);
+					sr += b[j];
+				}
+				_mul_(sr, si, vr, vi, sr, si);
+				//(z - 1/2)log z - z + log(2π)/2 - log(z(z + 1)...)
+				double qr, qi;
+				_log_(pr, pi, qr, qi);
+				gr = ((zr - 0.5) * lr - zi * li - zr + 0.9189385332046728) + (sr - qr);
+				gi = ((zr - 0.5) * li + zi * lr - zi) + (si - qi);
+			}
+			//log(2(2π)^(s - 1)sin(πs/2)Γ(1 - s)) (Re s < 0)
+			static void _log_reflection_(double sr, double si, double& lr, double& li) {
+				double gr, gi;
+				_lgamma_complex_(1. - sr, -si, gr, gi);
+				//Im w >= 0で sin w = e^(-iw)(1 - e^(2iw))i/2 (w = π|s|/2, 共役をとって符号を戻す)
+				double at = _abs_(si), b = 1.5707963267948966 * at;
+				double e = elementary::_exp_(scalar_type(-2. * b)).v, em = _expm1_(scalar_type(-2. * b)).v;
+				double c = gamma_kernel::_sin_cos_pi_<true>(scalar_type(sr)).v, sn = gamma_kernel::_sin_cos_pi_<false>(scalar_type(sr)).v;
+				double h = gamma_kernel::_sin_cos_pi_<false>(scalar_type(sr * 0.5)).v;
+				//1 - e^(2iw) = (1 - e^-2b cos πσ) - i e^-2b sin πσ
+				double ur, ui;
+				_log_(2. * h * h - em * c, -e * sn, ur, ui);
+				double sin_r = b - 0.6931471805599453 + ur, sin_i = 1.5707963267948966 * (1. - sr) + ui;
+				if (si < 0) sin_i = -sin_i;
+				lr = (0.6931471805599453 + (sr - 1.) * 1.8378770664093456) + gr + sin_r;
+				li = si * 1.8378770664093456 + gi + sin_i;
+			}
+			//e^l
+			static void _exp_(double lr, double li, double& er, double& ei) {
+				double r = elementary::_exp_(scalar_type(lr)).v;
+				er = r * elementary::_cos_(scalar_type(li)).v;
+				ei = r * elementary::_sin_(scalar_type(li)).v;
+			}
+
+			//1 - 2^(1 - s)を求めて|1 - 2^(1 - s)| >= 1/2であるか
+			//(ζ(s) = η(s)/(1 - 2^(1 - s))は零点s = 1 + 2πik/log 2の近傍で誤差が拡大するため, それ以外ではEuler-Maclaurinの公式を用いる)
+			static bool _eta_factor_large_(double sr, double si, double& fr, double& fi) {
+				_eta_factor_(sr, si, fr, fi);
+				return fr * fr + fi * fi >= 0.25;
+			}
+			//Re s >= 0に対するζ(s)(Eta = trueならばη(s))
+			template <bool Eta>
+			static void _zeta_positive_(double sr, double si, double& zr, double& zi) {
+				double at = _abs_(si), fr, fi;
+				double br[buffer_size], bi[buffer_size];
+				if (!Eta && sr == 1. && si == 0.) { zr = bit_cast<double>(0x7FF0000000000000ull); zi = 0; return; }
+				if (at <= 40. && (Eta || _eta_factor_large_(sr, si, fr, fi))) {
+					size_t n = _borwein_terms_(at);
+					_powers_(sr, si, n, br, bi);
+					_eta_sum_(_borwein_coefficients_(n), n, br, bi, zr, zi);
+					if (Eta) return;
+					_div_(zr, zi, fr, fi, zr, zi);
+					return;
+				}
+				//項数がbuffer_sizeを超えるときのみ確保する
+				size_t n = _euler_maclaurin_terms_(_abs_(sr) + at);
+				std::vector<double> vr, vi;
+				double* wr = br, * wi = bi;
+				if (n > buffer_size) {
+					vr.resize(n); vi.resize(n);
+					wr = vr.data(); wi = vi.data();
+				}
+				_powers_(sr, si, n, wr, wi);
+				_euler_maclaurin_(sr, si, n, wr, wi, zr, zi);
+				if (!Eta) return;
+				_eta_factor_(sr, si, fr, fi);
+				_mul_(zr, zi, fr, fi, zr, zi);
+			}
+			//複素数に対するζ(s)(Eta = trueならばη(s))
+			template <bool Eta>
+			static void _zeta_complex_(double sr, double si, double& zr, double& zi) {
+				if (sr != sr || si != si) { zr = zi = bit_cast<double>(0x7FF8000000000000ull); return; }
+				if (sr >= 0.) { _zeta_positive_<Eta>(sr, si, zr, zi); return; }
+				//関数等式で反転
+				double lr, li, er, ei;
+				_zeta_positive_<false>(1. - sr, -si, zr, zi);
+				_log_reflection_(sr, si, lr, li);
+				_exp_(lr, li, er, ei);
+				_mul_(zr, zi, er, ei, zr, zi);
+				if (!Eta) return;
+				_eta_factor_(sr, si, er, ei);
+				_mul_(zr, zi, er, ei, zr, zi);
+			}
+
+			//s + j ds (first <= j < first + n, n <= line_segment)に対するζ(s)
+			static void _zeta_line_(double sr, double si, double dr, double di, size_t first, size_t n, double* zr, double* zi) {
+				double ar = sr + double(first) * dr, br = sr + double(first + n - 1) * dr;
+				//区間が虚軸を跨ぐときは点ごとに評価
+				if ((ar < 0) != (br < 0)) {
+					for (size_t j = 0; j < n; ++j) _zeta_complex_<false>(sr + double(first + j) * dr, si + double(first + j) * di, zr[j], zi[j]);
+					return;
+				}
+				//関数等式で反転するときは1 - sの直線上で評価
+				bool reflect = ar < 0;
+				double ur = reflect ? 1. - ar : ar, ui = (reflect ? -1. : 1.) * (si + double(first) * di);
+				double at = _abs_(ui), bt = _abs_(si + double(first + n - 1) * di);
+				if (bt > at) at = bt;
+				//区間の端点で|s|が最大となる
+				double as = _abs_(ur) + _abs_(ui), bs = _abs_(reflect ? 1. - br : br) + bt;
+				if (bs > as) as = bs;
+
+				bool borwein = at <= 40.;
+				size_t m = borwein ? _borwein_terms_(at) : _euler_maclaurin_terms_(as);
+				//(k + 1)^-sと隣接する点の差ごとの(k + 1)^-Δの作業領域(項数がbuffer_sizeを超えるときのみ確保する)
+				const size_t cache = 4;
+				double buffer[2 * (cache + 1) * buffer_size];
+				std::vector<double> v;
+				double* wr = buffer;
+				if (m > buffer_size) {
+					v.resize(2 * (cache + 1) * m);
+					wr = v.data();
+				}
+				double* wi = wr + m, * mr = wi + m, * mi = mr + cache * m;
+				//点ごとの評価と同じ丸められた点で評価するため, 隣接する点の差(高々数通り)ごとに(k + 1)^-Δを保持する
+				double cr[cache], ci[cache];
+				size_t used = 0, next = 0;
+				for (size_t j = 0; j < n; ++j) {
+					double pr = sr + double(first + j) * dr, pi = si + double(first + j) * di;
+					double qr = reflect ? 1. - pr : pr, qi = reflect ? -pi : pi, fr, fi;
+					if (j % line_anchor == 0) _powers_(qr, qi, m, wr, wi);
+					else {
+						//(k + 1)^-(q + Δ) = (k + 1)^-q (k + 1)^-Δ
+						double er = qr - ur, ei = qi - ui;
+						size_t c = 0;
+						while (c < used && !(cr[c] == er && ci[c] == ei)) ++c;
+						if (c == used) {
+							if (used < cache) ++used;
+							else { c = next; next = (next + 1) % cache; }
+							cr[c] = er; ci[c] = ei;
+							_powers_(er, ei, m, mr + c * m, mi + c * m);
+						}
+						for (size_t k = 1; k < m; ++k) _mul_(wr[k], wi[k], mr[c * m + k], mi[c * m + k], wr[k], wi[k]);
+					}
+					ur = qr; ui = qi;
+					if (borwein) {
+						if (_eta_factor_large_(qr, qi, fr, fi)) {
+							_eta_sum_(_borwein_coefficients_(m), m, wr, wi, zr[j], zi[j]);
+							_div_(zr[j], zi[j], fr, fi, zr[j], zi[j]);
+						}
+						else _zeta_positive_<false>(qr, qi, zr[j], zi[j]);
+					}
+					else _euler_maclaurin_(qr, qi, m, wr, wi, zr[j], zi[j]);
+					if (reflect) {
+						_log_reflection_(pr, pi, fr, fi);
+						_exp_(fr, fi, fr, fi);
+						_mul_(zr[j], zi[j], fr, fi, zr[j], zi[j]);
+					}
+				}
+			}
+		};
+
+
+		//float(倍精度のカーネルで計算)
+		template <>
+		struct Zeta_kernel_impl<float> {
+			struct riemann_zeta_kernel {
+				template <class P>
+				P operator()(const P& x) const { return Zeta_kernel_impl<double>::_riemann_zeta_(x); }
+			};
+			struct dirichlet_eta_kernel {
+				template <class P>
+				P operator()(const P& x) const { return Zeta_kernel_impl<double>::_dirichlet_eta_(x); }
+			};
+
+			template <class P>
+			static P _riemann_zeta_(const P& x) { return Elementary_kernel_impl<float>::_promote_(x, riemann_zeta_kernel()); }
+			template <class P>
+			static P _dirichlet_eta_(const P& x) { return Elementary_kernel_impl<float>::_promote_(x, dirichlet_eta_kernel()); }
+		};
+	}
+
+
+	//スカラーに対する実行時カーネル(複素数は倍精度で計算)
+	template <class T>
+	struct Zeta_kernel {
+		using impl = simd::Zeta_kernel_impl<T>;
+		using pack_type = simd::pack<T, 1>;
+
+		static constexpr size_t line_segment = simd::Zeta_kernel_impl<double>::line_segment;
+
+		static T _riemann_zeta_(T x) { return impl::_riemann_zeta_(pack_type(x)).v; }
+		static T _dirichlet_eta_(T x) { return impl::_dirichlet_eta_(pack_type(x)).v; }
+		static void _riemann_zeta_(T sr, T si, T& zr, T& zi) {
+			double r, i;
+			simd::Zeta_kernel_impl<double>::_zeta_complex_<false>(sr, si, r, i);
+			zr = T(r); zi = T(i);
+		}
+		static void _dirichlet_eta_(T sr, T si, T& zr, T& zi) {
+			double r, i;
+			simd::Zeta_kernel_impl<double>::_zeta_complex_<true>(sr, si, r, i);
+			zr = T(r); zi = T(i);
+		}
+		//s + j ds (first <= j < first + n, n <= line_segment)
+		static void _riemann_zeta_line_(T sr, T si, T dr, T di, size_t first, size_t n, T* zr, T* zi) {
+			double r[line_segment], i[line_segment];
+			simd::Zeta_kernel_impl<double>::_zeta_line_(sr, si, dr, di, first, n, r, i);
+			for (size_t j = 0; j < n; ++j) { zr[j] = T(r[j]); zi[j] = T(i[j]); }
+		}
+	};
+}
+IMATH_FP_CONTRACT_POP
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,297 @@
+﻿#ifndef IMATH_MATH_MONTE_CARLO_HPP
+#define IMATH_MATH_MONTE_CARLO_HPP
+
+#include "IMathLib/math/math.hpp"
+#include "IMathLib/math/random.hpp"
+#include "IMathLib/math/statistics.hpp"
+#include "IMathLib/math/quadrature.hpp"
+#include <vector>
+#include <stdexcept>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+//モンテカルロ積分
+//標本は一定数ごとのバッチに分け, バッチbは同じシード値の生成器を(b + 1)*2^64段飛躍させた独立な系列を用いる
+//バッチの結果は番号順に併合して16個ごとに停止を判定するため, スレッド数によらず同じシード値からは同じ結果が得られる
+//各スレッドは判定を待たずに先のバッチを計算し, スレッドは積分ごとに1度だけ起動する
+//分散低減法として対称変量法, 制御変量法, 層別抽出法(超立方体の各次元をk等分した格子の各胞から1点ずつ), 重点抽出法を備える
+
+namespace iml {
+
+	//モンテカルロ積分器(Tは値の型, Engineは乱数生成器でEngine(seed)とjump(k, e)をもつもの)
+	template <class T = IMATH_DEFAULT_FLOATING_POINT, class Engine = rnd::philox4x32_10>
+	class monte_carlo_integrator {
+		size_t				dim;
+		std::vector<T>		lo, hi;				//積分領域の超直方体
+		uint64_t			seed;
+		size_t				threads;			//0ならばハードウェアのスレッド数
+		uint64_t			batch;				//バッチあたりの関数の評価回数の目安
+		uint64_t			max_samples;		//関数の評価回数の上限
+		T					abs_tolerance, rel_tolerance;
+		bool				antithetic;
+		size_t				strata;				//層別抽出での各次元の分割数
+
+		//停止を判定するまでに併合するバッチ数(スレッド数によらない)
+		static constexpr size_t round = 16;
+
+		//1回の反復(全ての胞から1点ずつ)での胞の数
+		uint64_t cells() const {
+			uint64_t c = 1;
+			for (size_t i = 0; i < dim; ++i) c *= strata;
+			return c;
+		}
+		//1回の反復での関数の評価回数
+		uint64_t evaluations_per_replicate(bool box) const { return box ? cells() * (antithetic ? 2 : 1) : 1; }
+
+		//超直方体上の1回の反復(関数値の胞についての平均と体積の積)
+		template <class F, class G>
+		struct Box_replicate {
+			const monte_carlo_integrator* p;
+			F f;
+			G g;
+			std::vector<T> u, x;
+
+			Box_replicate(const monte_carlo_integrator* p, F f, G g) :p(p), f(f), g(g), u(p->dim), x(p->dim) {}
+
+			template <class Handle>
+			void operator()(Handle handle, T& fy, T& gy) {
+				const size_t d = p->dim, k = p->strata;
+				uint64_t c = p->cells();
+				T sf = 0, sg = 0, vol = 1;
+				for (size_t i = 0; i < d; ++i) vol *= p->hi[i] - p->lo[i];
+				for (uint64_t cell = 0; cell < c; ++cell) {
+					//胞の添字を各次元の格子番号に分解する
+					uint64_t r = cell;
+					for (size_t i = 0; i < d; ++i) {
+						u[i] = (T(r % k) + handle->template unit<T>()) / T(k);
+						r /= k;
+					}
+					eval(u, sf, sg);
+					//対称変量(胞の中で鏡映した点)
+					if (p->antithetic) {
+						r = cell;
+						for (size_t i = 0; i < d; ++i) {
+							u[i] = T(2 * (r % k) + 1) / T(k) - u[i];
+							r /= k;
+						}
+						eval(u, sf, sg);
+					}
+				}
+				T m = T(c) * (p->antithetic ? 2 : 1);
+				fy = vol * sf / m;
+				gy = vol * sg / m;
+			}
+			void eval(const std::vector<T>& u, T& sf, T& sg) {
+				for (size_t i = 0; i < p->dim; ++i) x[i] = p->lo[i] + (p->hi[i] - p->lo[i]) * u[i];
+				sf += f(x.data());
+				sg += g(x.data());
+			}
+		};
+		//分布から生成した点での1回の反復(Weightは重点抽出法での重み)
+		template <class F, class G, class Sampler, class Weight>
+		struct Sampler_replicate {
+			const monte_carlo_integrator* p;
+			F f;
+			G g;
+			Sampler s;
+			Weight w;
+			std::vector<T> x;
+
+			Sampler_replicate(const monte_carlo_integrator* p, F f, G g, Sampler s, Weight w) :p(p), f(f), g(g), s(s), w(w), x(p->dim) {}
+
+			template <class Handle>
+			void operator()(Handle handle, T& fy, T& gy) {
+				s(handle, x.data());
+				T wx = w(x.data());
+				fy = wx * f(x.data());
+				gy = wx * g(x.data());
+			}
+		};
+		//制御変量を用いない場合のg
+		struct Zero_function {
+			T operator()(const T*) const { return 0; }
+		};
+		//重点抽出法を用いない場合の重み
+		struct Unit_weight {
+			T operator()(const T*) const { return 1; }
+		};
+		//重点抽出法の重み1/q(x)
+		template <class Density>
+		struct Inverse_density {
+			Density q;
+			T operator()(const T* x) const { return 1 / q(x); }
+		};
+
+		//E[g] = g_meanを既知とする推定値と標準誤差(controlが偽ならばfの標本平均)
+		static void estimate(const stats::covariance_accumulator<T>& acc, bool control, const T& g_mean, T& value, T& error) {
+			uint64_t n = acc.count();
+			if (!control || !(acc.variance_y() > 0)) {
+				value = acc.mean_x();
+				error = (n > 1) ? sqrt(acc.variance_x() / T(n - 1)) : T(0);
+				return;
+			}
+			//最適な係数c = Cov(f, g)/Var(g)による残差の分散
+			T c = acc.covariance() / acc.variance_y();
+			value = acc.mean_x() - c * (acc.mean_y() - g_mean);
+			T res = acc.variance_x() - c * acc.covariance();
+			error = (n > 2 && res > 0) ? sqrt(res / T(n - 2)) : T(0);
+		}
+		//バッチb(反復n回)の計算
+		template <class Replicate>
+		stats::covariance_accumulator<T> run_batch(Replicate& rep, uint64_t n, uint64_t b) const {
+			Engine gen(seed);
+			gen.jump(b + 1, 64);
+			stats::covariance_accumulator<T> m;
+			T fy, gy;
+			for (uint64_t j = 0; j < n; ++j) {
+				rep(&gen, fy, gy);
+				m.push(fy, gy);
+			}
+			return m;
+		}
+		//誤差が許容値以下か評価回数が上限に達するまでバッチを並列に計算する
+		//スレッドは未着手のバッチを番号順に取り, 併合済みのバッチからround + nt個先までの結果を保持する
+		template <class Replicate>
+		integration_result<T> run(const Replicate& rep, uint64_t evals, bool control, const T& g_mean) const {
+			size_t nt = threads;
+			if (nt == 0) nt = std::thread::hardware_concurrency();
+			if (nt == 0) nt = 1;
+			//バッチあたりの反復数
+			const uint64_t n = (batch > evals) ? batch / evals : 1;
+			const uint64_t window = round + nt;
+			std::vector<stats::covariance_accumulator<T>> part(window);
+			std::vector<char> ready(window, 0);
+			uint64_t next = 0, merged = 0;
+			bool stop = false;
+			std::exception_ptr failure;
+			std::mutex m;
+			std::condition_variable cv;
+			auto worker = [&]() {
+				Replicate r(rep);
+				std::unique_lock<std::mutex> lock(m);
+				for (;;) {
+					cv.wait(lock, [&]() { return stop || next < merged + window; });
+					if (stop) return;
+					uint64_t b = next++;
+					lock.unlock();
+					stats::covariance_accumulator<T> acc;
+					try {
+						acc = run_batch(r, n, b);
+					}
+					catch (...) {
+						lock.lock();
+						if (!failure) failure = std::current_exception();
+						stop = true;
+						cv.notify_all();
+						return;
+					}
+					lock.lock();
+					part[b % window] = acc;
+					ready[b % window] = 1;
+					cv.notify_all();
+				}
+			};
+			//1スレッドならば呼び出し元のスレッドで順に計算する
+			std::vector<std::thread> pool;
+			Replicate local(rep);
+			if (nt > 1) for (size_t t = 0; t < nt; ++t) pool.emplace_back(worker);
+
+			stats::covariance_accumulator<T> total;
+			integration_result<T> result = { T(0), T(0), 0 };
+			{
+				std::unique_lock<std::mutex> lock(m);
+				for (;;) {
+					for (size_t i = 0; i < round; ++i) {
+						size_t k = size_t(merged % window);
+						if (pool.empty()) part[k] = run_batch(local, n, merged);
+						else {
+							cv.wait(lock, [&]() { return ready[k] || failure; });
+							if (failure) break;
+							ready[k] = 0;
+						}
+						total.merge(part[k]);
+						++merged;
+						cv.notify_all();
+					}
+					if (failure) break;
+					estimate(total, control, g_mean, result.value, result.error);
+					result.evaluations = total.count() * evals;
+					if (result.error <= abs_tolerance || result.error <= rel_tolerance * abs(result.value)) break;
+					if ((total.count() + round * n) * evals > max_samples) break;
+				}
+				stop = true;
+				cv.notify_all();
+			}
+			for (size_t t = 0; t < pool.size(); ++t) pool[t].join();
+			if (failure) std::rethrow_exception(failure);
+			return result;
+		}
+	public:
+		//[0, 1]^dimensionでの積分器
+		explicit monte_carlo_integrator(size_t dimension, uint64_t seed = 0)
+			: dim(dimension), lo(dimension, T(0)), hi(dimension, T(1)), seed(seed), threads(0), batch(4096), max_samples(uint64_t(1) << 26)
+			, abs_tolerance(0), rel_tolerance(T(1e-3)), antithetic(false), strata(1) {}
+
+		//積分領域を[lo[i], hi[i]]の直積とする
+		template <class InputIterator1, class InputIterator2>
+		void set_box(InputIterator1 lo_first, InputIterator2 hi_first) {
+			for (size_t i = 0; i < dim; ++i, ++lo_first, ++hi_first) {
+				lo[i] = *lo_first;
+				hi[i] = *hi_first;
+			}
+		}
+		//標準誤差がmax(abs_tolerance, rel_tolerance|I|)以下となれば停止する
+		void set_tolerance(const T& abs_tol, const T& rel_tol) { abs_tolerance = abs_tol; rel_tolerance = rel_tol; }
+		void set_max_samples(uint64_t n) { max_samples = n; }
+		void set_threads(size_t n) { threads = n; }
+		//バッチあたりの関数の評価回数(誤差の判定はバッチ16個ごとに行う)
+		void set_batch_size(uint64_t n) { batch = (n == 0) ? 1 : n; }
+		void set_seed(uint64_t s) { seed = s; }
+		//対称変量法(超直方体上の積分でのみ有効)
+		void set_antithetic(bool b) { antithetic = b; }
+		//層別抽出法で各次元をk等分する(1回の反復でk^dimension点を評価する. 超直方体上の積分でのみ有効)
+		//対称変量法で2倍した評価回数が64ビットに収まらない(k^dimension > 2^63)場合は変更せずに例外を送出する
+		void set_strata(size_t k) {
+			if (k == 0) k = 1;
+			for (uint64_t c = 1, i = 0; i < dim; ++i, c *= k)
+				if (c > (uint64_t(1) << 63) / k) throw std::length_error("Number of strata cells exceeds 2^63.");
+			strata = k;
+		}
+
+		size_t dimension() const { return dim; }
+
+		//超直方体上の∫f(x)dx(fはconst T*を引数にとる)
+		template <class F>
+		integration_result<T> integrate(F f) const {
+			return run(Box_replicate<F, Zero_function>(this, f, Zero_function()), evaluations_per_replicate(true), false, T(0));
+		}
+		//積分値g_integralが既知のgを制御変量とする∫f(x)dx
+		template <class F, class G>
+		integration_result<T> integrate(F f, G g, const T& g_integral) const {
+			return run(Box_replicate<F, G>(this, f, g), evaluations_per_replicate(true), true, g_integral);
+		}
+		//sampler(handle, x)で生成したXに対するE[f(X)](handleはrnd::random_base<Engine, UInt>*で, 統計分布の生成をそのまま用いることができる)
+		template <class F, class Sampler>
+		integration_result<T> expectation(F f, Sampler sampler) const {
+			return run(Sampler_replicate<F, Zero_function, Sampler, Unit_weight>(this, f, Zero_function(), sampler, Unit_weight())
+				, evaluations_per_replicate(false), false, T(0));
+		}
+		//E[g(X)] = g_meanが既知のgを制御変量とするE[f(X)]
+		template <class F, class G, class Sampler>
+		integration_result<T> expectation(F f, G g, const T& g_mean, Sampler sampler) const {
+			return run(Sampler_replicate<F, G, Sampler, Unit_weight>(this, f, g, sampler, Unit_weight())
+				, evaluations_per_replicate(false), true, g_mean);
+		}
+		//密度qの分布からsamplerで生成したXによる重点抽出法での∫f(x)dx = E[f(X)/q(X)]
+		template <class F, class Sampler, class Density>
+		integration_result<T> importance(F f, Sampler sampler, Density q) const {
+			return run(Sampler_replicate<F, Zero_function, Sampler, Inverse_density<Density>>(this, f, Zero_function(), sampler, Inverse_density<Density>{ q })
+				, evaluations_per_replicate(false), false, T(0));
+		}
+	};
+}
+
+
+#endif
\ No newline at end of file
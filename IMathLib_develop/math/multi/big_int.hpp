@@ -0,0 +1,551 @@
+﻿#ifndef _IMATH_MULTI_BIG_INT_HPP
+#define _IMATH_MULTI_BIG_INT_HPP
+
+#include "IMathLib/IMathLib_config.hpp"
+#include "IMathLib/container/allocator.hpp"
+#include "IMathLib/math/math/abs.hpp"
+#include "IMathLib/math/math/sgn.hpp"
+#include "IMathLib/math/math/sqrt.hpp"
+#include "IMathLib/math/multi/limb.hpp"
+#include "IMathLib/math/multi/multi_int.hpp"
+#include "IMathLib/utility/type_traits/is_type.hpp"
+#include "IMathLib/utility/utility/bit_cast.hpp"
+#include "IMathLib/utility/utility/move.hpp"
+#include <ostream>
+#include <string>
+
+namespace iml {
+
+	constexpr size_t big_int_decimal_threshold = 24;		//10進変換で分割統治法を用いる最小の要素数
+
+	//任意長整数(Allocator:リムのアロケータ)
+	//符号と絶対値で表し, 絶対値はinline_size要素以下であればオブジェクト内に, それを超えればアロケータから確保した領域に格納する
+	//除算は0方向へ丸め, 右シフトは床関数による丸めとなる(除数が0の場合は未定義)
+	template <class Allocator = allocator<limb_t>>
+	class big_int {
+		template <class> friend class big_int;
+	public:
+		using allocator_type = Allocator;
+		static constexpr size_t inline_size = 2;			//オブジェクト内に格納できる要素数
+	private:
+		using traits = allocator_traits<Allocator>;
+
+		Allocator	alloc_m;
+		limb_t*		p_m;						//inline_mまたは確保した領域
+		size_t		size_m;						//上位の0を除いた要素数
+		size_t		capacity_m;
+		bool		neg_m;
+		limb_t		inline_m[inline_size];
+
+		bool is_inline() const { return p_m == inline_m; }
+		void release() {
+			if (!is_inline()) traits::deallocate(alloc_m, p_m, capacity_m);
+			p_m = inline_m;
+			capacity_m = inline_size;
+		}
+		//n要素以上の領域を確保する(既存の値は保持する)
+		void reserve(size_t n) {
+			if (n <= capacity_m) return;
+			size_t cap = (n < 2 * capacity_m) ? 2 * capacity_m : n;
+			limb_t* p = traits::allocate(alloc_m, cap);
+			for (size_t i = 0; i < size_m; ++i) p[i] = p_m[i];
+			release();
+			p_m = p;
+			capacity_m = cap;
+		}
+		//上位の0を除く
+		void normalize(size_t n) {
+			size_m = __limb_normalized_size(p_m, n);
+			if (size_m == 0) neg_m = false;
+		}
+		//絶対値をn要素の配列から設定する
+		void assign_magnitude(const limb_t* a, size_t n, bool neg) {
+			n = __limb_normalized_size(a, n);
+			reserve(n);
+			for (size_t i = 0; i < n; ++i) p_m[i] = a[i];
+			size_m = n;
+			neg_m = neg && (n != 0);
+		}
+		void assign_u64(uint64_t u, bool neg) {
+			p_m[0] = u;
+			size_m = (u != 0);
+			neg_m = neg && (u != 0);
+		}
+		//領域の交換(アロケータは交換しない)
+		void swap_storage(big_int& n) {
+			big_int temp(move(n));
+			n.assign_storage(move(*this));
+			assign_storage(move(temp));
+		}
+		//nの領域を引き継ぐ(アロケータが等しくなければ複製する)
+		void assign_storage(big_int&& n) {
+			if (!n.is_inline() && alloc_m == n.alloc_m) {
+				release();
+				p_m = n.p_m;
+				capacity_m = n.capacity_m;
+				n.p_m = n.inline_m;
+				n.capacity_m = inline_size;
+			}
+			else {
+				reserve(n.size_m);
+				for (size_t i = 0; i < n.size_m; ++i) p_m[i] = n.p_m[i];
+			}
+			size_m = n.size_m;
+			neg_m = n.neg_m;
+			n.size_m = 0;
+			n.neg_m = false;
+		}
+
+		//符号付きの加算(*this = *this + (negb ? -b : b))
+		void add_signed(const big_int& b, bool negb) {
+			size_t an = size_m, bn = b.size_m;
+			if (neg_m == negb) {
+				//n要素で加算し, 桁上がりがある場合のみ1要素伸ばす
+				size_t n = (an > bn) ? an : bn;
+				reserve(n);
+				limb_t c = (an >= bn) ? __limb_add(p_m, p_m, an, b.p_m, bn) : __limb_add(p_m, b.p_m, bn, p_m, an);
+				size_m = n;
+				if (c != 0) {
+					reserve(n + 1);
+					p_m[size_m++] = c;
+				}
+				neg_m = negb && (size_m != 0);
+				return;
+			}
+			//絶対値の大きい方から小さい方を引く
+			int cmp = (an != bn) ? ((an < bn) ? -1 : 1) : __limb_cmp(p_m, b.p_m, an);
+			if (cmp >= 0) {
+				__limb_sub(p_m, p_m, an, b.p_m, bn);
+				normalize(an);
+			}
+			else {
+				reserve(bn);
+				__limb_sub(p_m, b.p_m, bn, p_m, an);
+				normalize(bn);
+				neg_m = negb;
+			}
+		}
+
+		//絶対値の除算(q, rはa, bと異なること)
+		static void divrem_magnitude(const big_int& a, const big_int& b, big_int* q, big_int* r) {
+			size_t an = a.size_m, bn = b.size_m;
+			if (an < bn) {
+				if (r != nullptr) r->assign_magnitude(a.p_m, an, a.neg_m);
+				if (q != nullptr) q->assign_u64(0, false);
+				return;
+			}
+			big_int tq(a.alloc_m), tr(a.alloc_m);
+			tq.reserve(an - bn + 1);
+			tr.reserve(bn);
+			__limb_divrem(tq.p_m, tr.p_m, a.p_m, an, b.p_m, bn);
+			tq.neg_m = (a.neg_m != b.neg_m);
+			tq.normalize(an - bn + 1);
+			tr.neg_m = a.neg_m;
+			tr.normalize(bn);
+			if (q != nullptr) q->swap_storage(tq);
+			if (r != nullptr) r->swap_storage(tr);
+		}
+
+		//10進数の文字列への変換の補助(pw[k] = 10^(19*2^k))
+		//x < 10^(19*2^k)であり, padならば19*2^k桁となるように0を補う
+		static void to_decimal(std::string& s, const big_int& x, const std::vector<big_int>& pw, size_t k, bool pad) {
+			if (x.size_m < big_int_decimal_threshold || k == 0) {
+				std::string t;
+				std::vector<limb_t> u(x.p_m, x.p_m + x.size_m), q(x.size_m);
+				size_t n = x.size_m;
+				//10^19ずつ取り出す(下位の桁から)
+				while (n > 0) {
+					limb_t r = __limb_divrem_1(q.data(), u.data(), n, 10000000000000000000ull);
+					for (size_t i = 0; i < n; ++i) u[i] = q[i];
+					n = __limb_normalized_size(u.data(), n);
+					for (size_t i = 0; i < 19 && (n > 0 || r != 0); ++i, r /= 10) t.push_back(char('0' + r % 10));
+				}
+				if (pad) t.resize(size_t(19) << k, '0');
+				s.append(t.rbegin(), t.rend());
+				return;
+			}
+			//x = q*10^(19*2^(k-1)) + r
+			big_int q(x.alloc_m), r(x.alloc_m);
+			divrem_magnitude(x, pw[k - 1], &q, &r);
+			if (!pad && q.size_m == 0) to_decimal(s, r, pw, k - 1, false);
+			else {
+				to_decimal(s, q, pw, k - 1, pad);
+				to_decimal(s, r, pw, k - 1, true);
+			}
+		}
+		//10進数の文字列からの変換の補助(数字のみのn文字, pw[k] = 10^(19*2^k))
+		static void from_decimal(big_int& x, const char* str, size_t n, const std::vector<big_int>& pw) {
+			if (n <= 19 * big_int_decimal_threshold) {
+				x.assign_u64(0, false);
+				x.reserve(n / 19 + 1);
+				//19桁ずつ x = x*10^19 + d
+				for (size_t i = 0; i < n;) {
+					size_t m = (n - i) % 19;
+					if (m == 0) m = 19;
+					limb_t d = 0, p = 1;
+					for (size_t j = 0; j < m; ++j, ++i) {
+						d = d * 10 + limb_t(str[i] - '0');
+						p *= 10;
+					}
+					x.p_m[x.size_m] = __limb_mul_1(x.p_m, x.p_m, x.size_m, p);
+					__limb_add_1(x.p_m, x.p_m, x.size_m + 1, d);
+					x.normalize(x.size_m + 1);
+				}
+				return;
+			}
+			//下位19*2^k桁(n/2以上)とそれ以外に分割する
+			size_t k = 0;
+			while ((size_t(19) << (k + 1)) < n) ++k;
+			size_t low = size_t(19) << k;
+			big_int hi(x.alloc_m), lo(x.alloc_m);
+			from_decimal(hi, str, n - low, pw);
+			from_decimal(lo, str + (n - low), low, pw);
+			hi *= pw[k];
+			hi += lo;
+			x.swap_storage(hi);
+		}
+		//pw[k] = 10^(19*2^k) (k < m)
+		std::vector<big_int> decimal_powers(size_t m) const {
+			std::vector<big_int> pw;
+			pw.push_back(big_int(10000000000000000000ull, alloc_m));
+			while (pw.size() < m) pw.push_back(pw.back() * pw.back());
+			return pw;
+		}
+		void assign_string(const char* str, size_t len) {
+			assign_u64(0, false);
+			bool neg = false;
+			size_t i = 0;
+			if (i < len && (str[i] == '+' || str[i] == '-')) neg = (str[i++] == '-');
+			while (i < len && str[i] == '0') ++i;
+			size_t n = 0;
+			while (i + n < len && str[i + n] >= '0' && str[i + n] <= '9') ++n;
+			if (n == 0) return;
+			if (n <= 19 * big_int_decimal_threshold) from_decimal(*this, str + i, n, std::vector<big_int>());
+			else {
+				//19*2^k < n となるkまで
+				size_t m = 1;
+				while ((size_t(19) << m) < n) ++m;
+				from_decimal(*this, str + i, n, decimal_powers(m));
+			}
+			neg_m = neg && (size_m != 0);
+		}
+
+	public:
+		big_int() : alloc_m(), p_m(inline_m), size_m(0), capacity_m(inline_size), neg_m(false) {}
+		explicit big_int(const Allocator& alloc) : alloc_m(alloc), p_m(inline_m), size_m(0), capacity_m(inline_size), neg_m(false) {}
+		big_int(const big_int& n) : alloc_m(traits::select_on_container_copy_construction(n.alloc_m)), p_m(inline_m), size_m(0), capacity_m(inline_size), neg_m(false) {
+			assign_magnitude(n.p_m, n.size_m, n.neg_m);
+		}
+		big_int(const big_int& n, const Allocator& alloc) : alloc_m(alloc), p_m(inline_m), size_m(0), capacity_m(inline_size), neg_m(false) {
+			assign_magnitude(n.p_m, n.size_m, n.neg_m);
+		}
+		big_int(big_int&& n) : alloc_m(n.alloc_m), p_m(inline_m), size_m(0), capacity_m(inline_size), neg_m(false) {
+			assign_storage(move(n));
+		}
+		//組み込みの整数からの変換
+		template <class Int, class = enable_if_t<is_integral_v<Int>>>
+		big_int(Int n, const Allocator& alloc = Allocator()) : alloc_m(alloc), p_m(inline_m), size_m(0), capacity_m(inline_size), neg_m(false) {
+			bool neg = is_signed_v<Int> && (n < Int(0));
+			assign_u64(neg ? uint64_t(0) - uint64_t(n) : uint64_t(n), neg);
+		}
+		//浮動小数点数からの変換(0方向へ丸める)
+		template <class Float, class = enable_if_t<is_floating_point_v<Float>>, class = void>
+		explicit big_int(Float x, const Allocator& alloc = Allocator()) : alloc_m(alloc), p_m(inline_m), size_m(0), capacity_m(inline_size), neg_m(false) {
+			uint64_t u = bit_cast<uint64_t>(double(x));
+			int_t e = int_t((u >> 52) & 0x7FF);
+			//|x| < 1, 無限大, NaN
+			if (e < 1023 || e == 0x7FF) return;
+			//x = m * 2^(e - 1075)
+			limb_t m = (u & 0x000FFFFFFFFFFFFFull) | 0x0010000000000000ull;
+			if (e < 1075) assign_u64(m >> (1075 - e), false);
+			else {
+				assign_u64(m, false);
+				*this <<= size_t(e - 1075);
+			}
+			neg_m = (u >> 63) != 0;
+		}
+		//固定長の多倍長整数からの変換
+		template <size_t N>
+		explicit big_int(const multi_int<N>& n, const Allocator& alloc = Allocator()) : alloc_m(alloc), p_m(inline_m), size_m(0), capacity_m(inline_size), neg_m(false) {
+			bool neg = n.sign() < 0;
+			multi_int<N> a = neg ? -n : n;
+			limb_t u[multi_int<N>::size];
+			for (size_t i = 0; i < multi_int<N>::size; ++i) u[i] = a[i];
+			assign_magnitude(u, multi_int<N>::size, neg);
+		}
+		//絶対値をn要素の配列(下位から順)から構築
+		big_int(const limb_t* a, size_t n, bool neg = false, const Allocator& alloc = Allocator()) : alloc_m(alloc), p_m(inline_m), size_m(0), capacity_m(inline_size), neg_m(false) {
+			assign_magnitude(a, n, neg);
+		}
+		//10進数の文字列からの変換(先頭の符号と数字の並びを読み取る)
+		explicit big_int(const char* str, const Allocator& alloc = Allocator()) : alloc_m(alloc), p_m(inline_m), size_m(0), capacity_m(inline_size), neg_m(false) {
+			size_t len = 0;
+			while (str[len] != '\0') ++len;
+			assign_string(str, len);
+		}
+		explicit big_int(const std::string& str, const Allocator& alloc = Allocator()) : alloc_m(alloc), p_m(inline_m), size_m(0), capacity_m(inline_size), neg_m(false) {
+			assign_string(str.data(), size_t(str.size()));
+		}
+		~big_int() { release(); }
+
+		big_int& operator=(const big_int& n) {
+			if (this != &n) assign_magnitude(n.p_m, n.size_m, n.neg_m);
+			return *this;
+		}
+		big_int& operator=(big_int&& n) {
+			if (this != &n) assign_storage(move(n));
+			return *this;
+		}
+
+		allocator_type get_allocator() const { return alloc_m; }
+
+		//単項演算子
+		big_int operator+() const { return *this; }
+		big_int operator-() const {
+			big_int temp(*this);
+			temp.neg_m = !neg_m && (size_m != 0);
+			return temp;
+		}
+		big_int& operator++() { return *this += big_int(1, alloc_m); }
+		big_int operator++(int) {
+			big_int temp(*this);
+			++*this;
+			return temp;
+		}
+		big_int& operator--() { return *this -= big_int(1, alloc_m); }
+		big_int operator--(int) {
+			big_int temp(*this);
+			--*this;
+			return temp;
+		}
+
+		//代入演算
+		big_int& operator+=(const big_int& n) {
+			if (this == &n) return *this <<= 1;
+			add_signed(n, n.neg_m);
+			return *this;
+		}
+		big_int& operator-=(const big_int& n) {
+			if (this == &n) {
+				assign_u64(0, false);
+				return *this;
+			}
+			add_signed(n, !n.neg_m && (n.size_m != 0));
+			return *this;
+		}
+		big_int& operator*=(const big_int& n) {
+			size_t an = size_m, bn = n.size_m;
+			bool neg = (neg_m != n.neg_m);
+			if (an == 0 || bn == 0) {
+				assign_u64(0, false);
+				return *this;
+			}
+			//1要素同士はオブジェクト内で完結させる
+			if (an == 1 && bn == 1) {
+				limb_t hi, lo = __limb_mul(p_m[0], n.p_m[0], hi);
+				p_m[0] = lo;
+				p_m[1] = hi;
+				normalize(2);
+				neg_m = neg;
+				return *this;
+			}
+			//オブジェクト内に収まる大きさの積はスタック上で求め, 上位の0を除いてから格納する
+			if (an + bn <= 2 * inline_size) {
+				limb_t t[2 * inline_size];
+				if (an >= bn) __limb_mul(t, p_m, an, n.p_m, bn);
+				else __limb_mul(t, n.p_m, bn, p_m, an);
+				assign_magnitude(t, an + bn, neg);
+				return *this;
+			}
+			big_int temp(alloc_m);
+			temp.reserve(an + bn);
+			if (an >= bn) __limb_mul(temp.p_m, p_m, an, n.p_m, bn);
+			else __limb_mul(temp.p_m, n.p_m, bn, p_m, an);
+			temp.normalize(an + bn);
+			temp.neg_m = neg;
+			swap_storage(temp);
+			return *this;
+		}
+		big_int& operator/=(const big_int& n) {
+			divrem_magnitude(big_int(*this), n, this, nullptr);
+			return *this;
+		}
+		big_int& operator%=(const big_int& n) {
+			divrem_magnitude(big_int(*this), n, nullptr, this);
+			return *this;
+		}
+		big_int& operator<<=(size_t s) {
+			if (size_m == 0) return *this;
+			size_t q = s / 64, r = s % 64, n = size_m;
+			//最上位の要素からはみ出すビットがある場合のみ1要素伸ばす
+			size_t m = (r != 0 && (p_m[n - 1] >> (64 - r)) != 0) ? n + q + 1 : n + q;
+			reserve(m);
+			if (r != 0) {
+				limb_t c = __limb_lshift(p_m + q, p_m, n, r);
+				if (m > n + q) p_m[n + q] = c;
+			}
+			else for (size_t i = n; i-- > 0;) p_m[i + q] = p_m[i];
+			for (size_t i = 0; i < q; ++i) p_m[i] = 0;
+			size_m = m;
+			return *this;
+		}
+		//負数は-∞方向へ丸める
+		big_int& operator>>=(size_t s) {
+			size_t q = s / 64, r = s % 64, n = size_m;
+			if (q >= n) {
+				if (neg_m) assign_u64(1, true);
+				else assign_u64(0, false);
+				return *this;
+			}
+			//切り捨てられるビットの有無
+			bool inexact = false;
+			for (size_t i = 0; i < q; ++i) inexact = inexact || (p_m[i] != 0);
+			for (size_t i = 0; i < n - q; ++i) p_m[i] = p_m[i + q];
+			if (r != 0) inexact = (__limb_rshift(p_m, p_m, n - q, r) != 0) || inexact;
+			bool neg = neg_m;
+			normalize(n - q);
+			if (neg && inexact) {
+				limb_t c = __limb_add_1(p_m, p_m, size_m, 1);
+				if (c != 0) {
+					reserve(size_m + 1);
+					p_m[size_m++] = c;
+				}
+				neg_m = true;
+			}
+			else neg_m = neg && (size_m != 0);
+			return *this;
+		}
+
+		//商と剰余を同時に求める
+		static void divrem(const big_int& a, const big_int& b, big_int& q, big_int& r) {
+			divrem_magnitude(big_int(a), big_int(b), &q, &r);
+		}
+
+		//符号(-1, 0, 1)
+		int_t sign() const { return neg_m ? -1 : ((size_m == 0) ? 0 : 1); }
+		//2進数での桁数(絶対値)
+		size_t bit_width() const { return (size_m == 0) ? 0 : 64 * size_m - __limb_clz(p_m[size_m - 1]); }
+		//絶対値の要素数と要素へのアクセス
+		size_t size() const { return size_m; }
+		limb_t operator[](size_t index) const { return (index < size_m) ? p_m[index] : 0; }
+		const limb_t* data() const { return p_m; }
+
+		//変換
+		explicit operator bool() const { return size_m != 0; }
+		//2^64を法とした値
+		template <class Int, class = enable_if_t<is_integral_v<Int>>>
+		explicit operator Int() const {
+			uint64_t u = (size_m == 0) ? 0 : p_m[0];
+			return Int(neg_m ? uint64_t(0) - u : u);
+		}
+		//上位2要素に残りの要素の有無を加味して丸める
+		explicit operator double() const {
+			size_t n = size_m;
+			if (n == 0) return 0.;
+			size_t s = __limb_clz(p_m[n - 1]);
+			limb_t hi = p_m[n - 1] << s, sticky = 0;
+			if (n >= 2) {
+				if (s != 0) hi |= p_m[n - 2] >> (64 - s);
+				sticky = p_m[n - 2] << s;
+			}
+			for (size_t i = 0; i + 2 < n; ++i) sticky |= p_m[i];
+			hi |= (sticky != 0);
+			double result = ldexp2(double(hi), int_t(64 * (n - 1)) - int_t(s));
+			return neg_m ? -result : result;
+		}
+
+		//10進数の文字列(要素数が大きければ10^(19*2^k)による分割統治法を用いる)
+		std::string to_string() const {
+			std::string s;
+			if (neg_m) s.push_back('-');
+			if (size_m == 0) s.push_back('0');
+			else if (size_m < big_int_decimal_threshold) to_decimal(s, *this, std::vector<big_int>(), 0, false);
+			else {
+				//10^(19*2^k) >= B^size となるkまで
+				size_t m = 1;
+				while ((size_t(19) << m) < 20 * size_m) ++m;
+				std::vector<big_int> pw = decimal_powers(m);
+				to_decimal(s, *this, pw, m, false);
+			}
+			return s;
+		}
+
+		//二項演算
+		friend big_int operator+(const big_int& lhs, const big_int& rhs) { return big_int(lhs) += rhs; }
+		friend big_int operator-(const big_int& lhs, const big_int& rhs) { return big_int(lhs) -= rhs; }
+		friend big_int operator*(const big_int& lhs, const big_int& rhs) { return big_int(lhs) *= rhs; }
+		friend big_int operator/(const big_int& lhs, const big_int& rhs) { return big_int(lhs) /= rhs; }
+		friend big_int operator%(const big_int& lhs, const big_int& rhs) { return big_int(lhs) %= rhs; }
+		friend big_int operator<<(const big_int& lhs, size_t s) { return big_int(lhs) <<= s; }
+		friend big_int operator>>(const big_int& lhs, size_t s) { return big_int(lhs) >>= s; }
+
+		//比較演算
+		friend bool operator==(const big_int& lhs, const big_int& rhs) {
+			return lhs.neg_m == rhs.neg_m && lhs.size_m == rhs.size_m && __limb_cmp(lhs.p_m, rhs.p_m, lhs.size_m) == 0;
+		}
+		friend bool operator!=(const big_int& lhs, const big_int& rhs) { return !(lhs == rhs); }
+		friend bool operator<(const big_int& lhs, const big_int& rhs) {
+			if (lhs.neg_m != rhs.neg_m) return lhs.neg_m;
+			int cmp = (lhs.size_m != rhs.size_m) ? ((lhs.size_m < rhs.size_m) ? -1 : 1) : __limb_cmp(lhs.p_m, rhs.p_m, lhs.size_m);
+			return lhs.neg_m ? (cmp > 0) : (cmp < 0);
+		}
+		friend bool operator>(const big_int& lhs, const big_int& rhs) { return rhs < lhs; }
+		friend bool operator<=(const big_int& lhs, const big_int& rhs) { return !(rhs < lhs); }
+		friend bool operator>=(const big_int& lhs, const big_int& rhs) { return !(lhs < rhs); }
+
+		//ストリーム出力
+		friend std::ostream& operator<<(std::ostream& os, const big_int& n) {
+			return os << n.to_string();
+		}
+		friend std::wostream& operator<<(std::wostream& os, const big_int& n) {
+			std::string s = n.to_string();
+			return os << std::wstring(s.begin(), s.end());
+		}
+	};
+
+
+	//任意長整数の判定
+	template <class T>
+	struct is_big_int : false_type {};
+	template <class Allocator>
+	struct is_big_int<big_int<Allocator>> : true_type {};
+	template <class T>
+	constexpr bool is_big_int_v = is_big_int<T>::value;
+
+
+	template <class Allocator>
+	struct Abs<big_int<Allocator>> {
+		static big_int<Allocator> _abs_(const big_int<Allocator>& x) { return (x.sign() < 0) ? -x : x; }
+	};
+	template <class Allocator>
+	struct Sgn<big_int<Allocator>> {
+		static int_t _sgn_(const big_int<Allocator>& x) { return x.sign(); }
+	};
+	//平方根の整数部(上位の半分の桁の平方根を初期値としてNewton法で上から収束させる)
+	template <class Allocator>
+	struct Isqrt<big_int<Allocator>> {
+		using result_type = big_int<Allocator>;
+
+		static result_type _isqrt_(const big_int<Allocator>& x) {
+			if (x.sign() <= 0) return result_type(0, x.get_allocator());
+			size_t n = x.bit_width();
+			if (n <= 64) {
+				uint64_t u = x[0], y = uint64_t(1) << ((n + 1) / 2);
+				for (uint64_t z = (y + u / y) / 2; z < y; z = (y + u / y) / 2) y = z;
+				return result_type(y, x.get_allocator());
+			}
+			//isqrt(x) <= (isqrt(x >> 2k) + 1)*2^k
+			size_t k = n / 4;
+			result_type y = (_isqrt_(x >> (2 * k)) + result_type(1, x.get_allocator())) << k;
+			for (;;) {
+				result_type z = (y + x / y) >> 1;
+				if (z >= y) break;
+				y = move(z);
+			}
+			return y;
+		}
+	};
+}
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,645 @@
+﻿#ifndef IMATH_MATH_MULTI_LIMB_HPP
+#define IMATH_MATH_MULTI_LIMB_HPP
+
+#include "IMathLib/IMathLib_config.hpp"
+#include <vector>
+
+//多倍長演算の基本演算
+//64bitのリム(下位から順に格納)の配列に対する加減乗除を提供し, 固定長(multi_int)と可変長の多倍長整数で共有する
+//乗算は要素数に応じて筆算, Karatsuba法, Toom-3法, 数論変換(NTT)を選択し, 除算は筆算(Knuth Algorithm D)とNewton法による逆数を用いた除算を選択する
+
+//ハードウェアの加算キャリーと128bit積の利用
+#if defined _M_X64 || defined __x86_64__
+#define IMATH_LIMB_ADDCARRY
+#endif
+#if defined _MSC_VER && defined _M_X64
+#define IMATH_LIMB_UMUL128
+#elif defined __SIZEOF_INT128__
+#define IMATH_LIMB_INT128
+#endif
+
+namespace iml {
+
+	using limb_t = uint64_t;
+
+	//要素数の閾値
+	constexpr size_t limb_karatsuba_threshold = 32;			//Karatsuba法を用いる最小の要素数
+	constexpr size_t limb_toom3_threshold = 128;			//Toom-3法を用いる最小の要素数
+	constexpr size_t limb_ntt_threshold = 12288;				//数論変換による乗算を用いる最小の要素数
+	constexpr size_t limb_ntt_max_size = size_t(1) << 22;		//数論変換による乗算の積の最大の要素数
+	constexpr size_t limb_newton_division_threshold = 48;		//Newton法による除算を用いる除数の最小の要素数
+
+
+	//キャリー付き加算(a + b + c)
+	inline limb_t __limb_addc(limb_t a, limb_t b, unsigned char c, unsigned char& co) {
+#if defined IMATH_LIMB_ADDCARRY
+		unsigned long long r;
+		co = _addcarry_u64(c, a, b, &r);
+		return r;
+#else
+		limb_t s = a + b, r = s + c;
+		co = (s < a) | (r < s);
+		return r;
+#endif
+	}
+	//ボロー付き減算(a - b - c)
+	inline limb_t __limb_subb(limb_t a, limb_t b, unsigned char c, unsigned char& co) {
+#if defined IMATH_LIMB_ADDCARRY
+		unsigned long long r;
+		co = _subborrow_u64(c, a, b, &r);
+		return r;
+#else
+		limb_t s = a - b, r = s - c;
+		co = (a < b) | (s < c);
+		return r;
+#endif
+	}
+	//128bit積(戻り値は下位, hiに上位)
+	inline limb_t __limb_mul(limb_t a, limb_t b, limb_t& hi) {
+#if defined IMATH_LIMB_UMUL128
+		unsigned __int64 h;
+		limb_t lo = _umul128(a, b, &h);
+		hi = h;
+		return lo;
+#elif defined IMATH_LIMB_INT128
+		unsigned __int128 p = (unsigned __int128)a * b;
+		hi = limb_t(p >> 64);
+		return limb_t(p);
+#else
+		limb_t a0 = a & 0xFFFFFFFF, a1 = a >> 32, b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+		limb_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+		limb_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFF) + (p10 & 0xFFFFFFFF);
+		hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+		return (mid << 32) | (p00 & 0xFFFFFFFF);
+#endif
+	}
+	//128bit÷64bit(hi < dであること, 戻り値は商, rに剰余)
+	inline limb_t __limb_div(limb_t hi, limb_t lo, limb_t d, limb_t& r) {
+#if defined IMATH_LIMB_UMUL128 && _MSC_VER >= 1920
+		unsigned __int64 rr;
+		limb_t q = _udiv128(hi, lo, d, &rr);
+		r = rr;
+		return q;
+#elif defined IMATH_LIMB_INT128
+		unsigned __int128 n = ((unsigned __int128)hi << 64) | lo;
+		r = limb_t(n % d);
+		return limb_t(n / d);
+#else
+		limb_t q = 0;
+		for (int i = 63; i >= 0; --i) {
+			limb_t top = hi >> 63;
+			hi = (hi << 1) | (lo >> 63);
+			lo <<= 1;
+			q <<= 1;
+			if (top || hi >= d) { hi -= d; q |= 1; }
+		}
+		r = hi;
+		return q;
+#endif
+	}
+	//先頭から連続する0のビット数(x != 0)
+	inline size_t __limb_clz(limb_t x) {
+		size_t n = 0;
+		if (!(x >> 32)) { n += 32; x <<= 32; }
+		if (!(x >> 48)) { n += 16; x <<= 16; }
+		if (!(x >> 56)) { n += 8; x <<= 8; }
+		if (!(x >> 60)) { n += 4; x <<= 4; }
+		if (!(x >> 62)) { n += 2; x <<= 2; }
+		if (!(x >> 63)) ++n;
+		return n;
+	}
+
+
+	//r = a + b (n要素, 戻り値はキャリー)
+	inline limb_t __limb_add_n(limb_t* r, const limb_t* a, const limb_t* b, size_t n) {
+		unsigned char c = 0;
+		for (size_t i = 0; i < n; ++i) r[i] = __limb_addc(a[i], b[i], c, c);
+		return c;
+	}
+	//r = a + b (bは1要素)
+	inline limb_t __limb_add_1(limb_t* r, const limb_t* a, size_t n, limb_t b) {
+		for (size_t i = 0; i < n; ++i) {
+			r[i] = a[i] + b;
+			b = (r[i] < b);
+		}
+		return b;
+	}
+	//r = a + b (an >= bn)
+	inline limb_t __limb_add(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn) {
+		limb_t c = __limb_add_n(r, a, b, bn);
+		return __limb_add_1(r + bn, a + bn, an - bn, c);
+	}
+	//r = a - b (n要素, 戻り値はボロー)
+	inline limb_t __limb_sub_n(limb_t* r, const limb_t* a, const limb_t* b, size_t n) {
+		unsigned char c = 0;
+		for (size_t i = 0; i < n; ++i) r[i] = __limb_subb(a[i], b[i], c, c);
+		return c;
+	}
+	inline limb_t __limb_sub_1(limb_t* r, const limb_t* a, size_t n, limb_t b) {
+		for (size_t i = 0; i < n; ++i) {
+			limb_t x = a[i];
+			r[i] = x - b;
+			b = (x < b);
+		}
+		return b;
+	}
+	//r = a - b (an >= bn)
+	inline limb_t __limb_sub(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn) {
+		limb_t c = __limb_sub_n(r, a, b, bn);
+		return __limb_sub_1(r + bn, a + bn, an - bn, c);
+	}
+	//比較(a < bならば負, a == bならば0, a > bならば正)
+	inline int __limb_cmp(const limb_t* a, const limb_t* b, size_t n) {
+		while (n-- > 0) if (a[n] != b[n]) return (a[n] < b[n]) ? -1 : 1;
+		return 0;
+	}
+	//上位の0を除いた要素数
+	inline size_t __limb_normalized_size(const limb_t* a, size_t n) {
+		while (n > 0 && a[n - 1] == 0) --n;
+		return n;
+	}
+	//r = a << s (0 < s < 64, 戻り値ははみ出したビット)
+	inline limb_t __limb_lshift(limb_t* r, const limb_t* a, size_t n, size_t s) {
+		limb_t out = a[n - 1] >> (64 - s);
+		for (size_t i = n - 1; i > 0; --i) r[i] = (a[i] << s) | (a[i - 1] >> (64 - s));
+		r[0] = a[0] << s;
+		return out;
+	}
+	//r = a >> s (0 < s < 64, 戻り値ははみ出したビットを上位に詰めたもの)
+	inline limb_t __limb_rshift(limb_t* r, const limb_t* a, size_t n, size_t s) {
+		limb_t out = a[0] << (64 - s);
+		for (size_t i = 0; i + 1 < n; ++i) r[i] = (a[i] >> s) | (a[i + 1] << (64 - s));
+		r[n - 1] = a[n - 1] >> s;
+		return out;
+	}
+
+
+	//r = a * b (bは1要素, 戻り値は最上位)
+	inline limb_t __limb_mul_1(limb_t* r, const limb_t* a, size_t n, limb_t b) {
+		limb_t c = 0, hi;
+		for (size_t i = 0; i < n; ++i) {
+			limb_t lo = __limb_mul(a[i], b, hi);
+			lo += c;
+			c = hi + (lo < c);
+			r[i] = lo;
+		}
+		return c;
+	}
+	//r += a * b
+	inline limb_t __limb_addmul_1(limb_t* r, const limb_t* a, size_t n, limb_t b) {
+		limb_t c = 0, hi;
+		for (size_t i = 0; i < n; ++i) {
+			limb_t lo = __limb_mul(a[i], b, hi);
+			lo += c;
+			hi += (lo < c);
+			lo += r[i];
+			c = hi + (lo < r[i]);
+			r[i] = lo;
+		}
+		return c;
+	}
+	//r -= a * b
+	inline limb_t __limb_submul_1(limb_t* r, const limb_t* a, size_t n, limb_t b) {
+		limb_t c = 0, hi;
+		for (size_t i = 0; i < n; ++i) {
+			limb_t lo = __limb_mul(a[i], b, hi);
+			lo += c;
+			hi += (lo < c);
+			limb_t x = r[i];
+			r[i] = x - lo;
+			c = hi + (x < lo);
+		}
+		return c;
+	}
+
+	//筆算による乗算(rはan + bn要素でa, bと重ならないこと)
+	inline void __limb_mul_basecase(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn) {
+		r[an] = __limb_mul_1(r, a, an, b[0]);
+		for (size_t i = 1; i < bn; ++i) r[an + i] = __limb_addmul_1(r + i, a, an, b[i]);
+	}
+
+	inline void __limb_mul_n(limb_t* r, const limb_t* a, const limb_t* b, size_t n);
+
+	//|a - b|(戻り値はa < bであるか, bnはan以下)
+	inline bool __limb_abs_sub(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn) {
+		bool neg = (__limb_normalized_size(a + bn, an - bn) == 0) && (__limb_cmp(a, b, bn) < 0);
+		if (neg) {
+			__limb_sub_n(r, b, a, bn);
+			for (size_t i = bn; i < an; ++i) r[i] = 0;
+		}
+		else __limb_sub(r, a, an, b, bn);
+		return neg;
+	}
+
+	//Karatsuba法(a = a0 + a1*B^l として a*b = z0 + (z0 + z2 - (a0 - a1)(b0 - b1))*B^l + z2*B^2l)
+	inline void __limb_mul_karatsuba(limb_t* r, const limb_t* a, const limb_t* b, size_t n) {
+		size_t l = (n + 1) / 2, h = n - l;
+		std::vector<limb_t> da(l), db(l), zm(2 * l), t(2 * l + 1);
+
+		bool neg = __limb_abs_sub(da.data(), a, l, a + l, h) != __limb_abs_sub(db.data(), b, l, b + l, h);
+		__limb_mul_n(r, a, b, l);
+		__limb_mul_n(r + 2 * l, a + l, b + l, h);
+		__limb_mul_n(zm.data(), da.data(), db.data(), l);
+
+		//t = z0 + z2 ∓ zm
+		t[2 * l] = __limb_add(t.data(), r, 2 * l, r + 2 * l, 2 * h);
+		if (neg) t[2 * l] += __limb_add_n(t.data(), t.data(), zm.data(), 2 * l);
+		else t[2 * l] -= __limb_sub_n(t.data(), t.data(), zm.data(), 2 * l);
+		__limb_add(r + l, r + l, 2 * n - l, t.data(), __limb_normalized_size(t.data(), 2 * l + 1));
+	}
+
+	//2の補数表現での演算の補助(Toom-3法の補間で利用)
+	//r = aの符号拡張(an要素からn要素)
+	inline void __limb_signed_assign(limb_t* r, size_t n, const limb_t* a, size_t an, bool neg) {
+		for (size_t i = 0; i < an; ++i) r[i] = a[i];
+		for (size_t i = an; i < n; ++i) r[i] = 0;
+		//負数ならば2の補数をとる
+		if (neg) {
+			limb_t c = 1;
+			for (size_t i = 0; i < n; ++i) {
+				r[i] = ~r[i] + c;
+				c = c && (r[i] == 0);
+			}
+		}
+	}
+	//3による正確な除算(2の補数でも成立する)
+	inline void __limb_divexact_by3(limb_t* r, const limb_t* a, size_t n) {
+		constexpr limb_t inv3 = 0xAAAAAAAAAAAAAAABull;
+		limb_t c = 0, hi;
+		for (size_t i = 0; i < n; ++i) {
+			limb_t x = a[i], s = x - c;
+			limb_t q = s * inv3;
+			r[i] = q;
+			__limb_mul(q, 3, hi);
+			c = hi + (x < c);
+		}
+	}
+	//2による正確な除算(算術シフト)
+	inline void __limb_divexact_by2(limb_t* r, const limb_t* a, size_t n) {
+		limb_t sign = a[n - 1] & 0x8000000000000000ull;
+		__limb_rshift(r, a, n, 1);
+		r[n - 1] |= sign;
+	}
+
+	//Toom-3法(点0, 1, -1, -2, ∞で評価し, Bodratoの手順で補間する)
+	inline void __limb_mul_toom3(limb_t* r, const limb_t* a, const limb_t* b, size_t n) {
+		size_t k = (n + 2) / 3, k2 = n - 2 * k, w = 2 * k + 2;
+		const limb_t *a0 = a, *a1 = a + k, *a2 = a + 2 * k, *b0 = b, *b1 = b + k, *b2 = b + 2 * k;
+		std::vector<limb_t> buf(4 * (k + 1) + 3 * (2 * k + 2) + 4 * w);
+		limb_t *ea = buf.data(), *eb = ea + (k + 1), *fa = eb + (k + 1), *fb = fa + (k + 1);
+		limb_t *v1 = fb + (k + 1), *vm1 = v1 + (2 * k + 2), *vm2 = vm1 + (2 * k + 2);
+		limb_t *t1 = vm2 + (2 * k + 2), *t2 = t1 + w, *t3 = t2 + w, *t4 = t3 + w;
+
+		//x(1) = x0 + x1 + x2, x(-1) = x0 - x1 + x2 (符号と絶対値)
+		ea[k] = __limb_add(ea, a0, k, a2, k2);
+		eb[k] = __limb_add(eb, b0, k, b2, k2);
+		fa[k] = ea[k] + __limb_add_n(fa, ea, a1, k);
+		fb[k] = eb[k] + __limb_add_n(fb, eb, b1, k);
+		__limb_mul_n(v1, fa, fb, k + 1);
+		bool sm1 = __limb_abs_sub(ea, ea, k + 1, a1, k) != __limb_abs_sub(eb, eb, k + 1, b1, k);
+		__limb_mul_n(vm1, ea, eb, k + 1);
+
+		//x(-2) = x0 - 2*x1 + 4*x2 = ((x2*2 - x1)*2 + x0)
+		for (size_t i = 0; i < k + 1; ++i) fa[i] = fb[i] = 0;
+		fa[k2] = __limb_lshift(fa, a2, k2, 1);
+		fb[k2] = __limb_lshift(fb, b2, k2, 1);
+		bool na = __limb_abs_sub(fa, fa, k + 1, a1, k), nb = __limb_abs_sub(fb, fb, k + 1, b1, k);
+		//(±|y|)*2 + x0
+		fa[k] = (fa[k] << 1) | __limb_lshift(fa, fa, k, 1);
+		fb[k] = (fb[k] << 1) | __limb_lshift(fb, fb, k, 1);
+		if (na) na = !__limb_abs_sub(fa, fa, k + 1, a0, k);
+		else __limb_add(fa, fa, k + 1, a0, k);
+		if (nb) nb = !__limb_abs_sub(fb, fb, k + 1, b0, k);
+		else __limb_add(fb, fb, k + 1, b0, k);
+		__limb_mul_n(vm2, fa, fb, k + 1);
+		bool sm2 = na != nb;
+
+		//v0, v∞はrへ直接配置する
+		__limb_mul_n(r, a0, b0, k);
+		for (size_t i = 2 * k; i < 4 * k; ++i) r[i] = 0;
+		if (k2 > 0) __limb_mul_n(r + 4 * k, a2, b2, k2);
+		const limb_t *v0 = r, *vinf = r + 4 * k;
+		size_t ninf = 2 * k2;
+
+		//r3 = (v(-2) - v(1))/3, r1 = (v(1) - v(-1))/2, r2 = v(-1) - v(0)
+		__limb_signed_assign(t3, w, vm2, 2 * k + 2, sm2);
+		__limb_signed_assign(t4, w, v1, 2 * k + 2, false);
+		__limb_sub_n(t3, t3, t4, w);
+		__limb_divexact_by3(t3, t3, w);
+		__limb_signed_assign(t2, w, vm1, 2 * k + 2, sm1);
+		__limb_sub_n(t1, t4, t2, w);
+		__limb_divexact_by2(t1, t1, w);
+		__limb_signed_assign(t4, w, v0, 2 * k, false);
+		__limb_sub_n(t2, t2, t4, w);
+		//r3 = (r2 - r3)/2 + 2*v∞
+		__limb_sub_n(t3, t2, t3, w);
+		__limb_divexact_by2(t3, t3, w);
+		__limb_signed_assign(t4, w, vinf, ninf, false);
+		__limb_add_n(t3, t3, t4, w);
+		__limb_add_n(t3, t3, t4, w);
+		//r2 = r2 + r1 - v∞, r1 = r1 - r3
+		__limb_add_n(t2, t2, t1, w);
+		__limb_sub_n(t2, t2, t4, w);
+		__limb_sub_n(t1, t1, t3, w);
+
+		//r = v0 + r1*B^k + r2*B^2k + r3*B^3k + v∞*B^4k (各係数は非負)
+		const limb_t* t[3] = { t1, t2, t3 };
+		for (size_t i = 0; i < 3; ++i) {
+			size_t off = (i + 1) * k, m = (w < 2 * n - off) ? w : 2 * n - off;
+			__limb_add(r + off, r + off, 2 * n - off, t[i], __limb_normalized_size(t[i], m));
+		}
+	}
+
+	//数論変換(法P, 原始根G, P - 1は2^kで割り切れる)
+	template <uint32_t P, uint32_t G>
+	struct __limb_ntt_prime {
+		static constexpr uint32_t mod = P;
+
+		static uint32_t _add_(uint32_t a, uint32_t b) { uint32_t c = a + b; return (c >= P) ? c - P : c; }
+		static uint32_t _sub_(uint32_t a, uint32_t b) { return (a >= b) ? a - b : a + P - b; }
+		static uint32_t _mul_(uint32_t a, uint32_t b) { return uint32_t(uint64_t(a) * b % P); }
+		static uint32_t _pow_(uint32_t a, uint32_t e) {
+			uint32_t r = 1;
+			for (; e != 0; e >>= 1, a = _mul_(a, a)) if (e & 1) r = _mul_(r, a);
+			return r;
+		}
+
+		//順変換(周波数間引き, 出力はビット反転順)
+		static void _forward_(uint32_t* a, size_t n) {
+			std::vector<uint32_t> w(n / 2);
+			for (size_t len = n; len >= 2; len >>= 1) {
+				size_t half = len / 2;
+				uint32_t wl = _pow_(G, (P - 1) / uint32_t(len));
+				w[0] = 1;
+				for (size_t j = 1; j < half; ++j) w[j] = _mul_(w[j - 1], wl);
+				for (size_t i = 0; i < n; i += len) {
+					for (size_t j = 0; j < half; ++j) {
+						uint32_t u = a[i + j], v = a[i + j + half];
+						a[i + j] = _add_(u, v);
+						a[i + j + half] = _mul_(_sub_(u, v), w[j]);
+					}
+				}
+			}
+		}
+		//逆変換(時間間引き, 入力はビット反転順)
+		static void _inverse_(uint32_t* a, size_t n) {
+			std::vector<uint32_t> w(n / 2);
+			uint32_t ig = _pow_(G, P - 2);
+			for (size_t len = 2; len <= n; len <<= 1) {
+				size_t half = len / 2;
+				uint32_t wl = _pow_(ig, (P - 1) / uint32_t(len));
+				w[0] = 1;
+				for (size_t j = 1; j < half; ++j) w[j] = _mul_(w[j - 1], wl);
+				for (size_t i = 0; i < n; i += len) {
+					for (size_t j = 0; j < half; ++j) {
+						uint32_t u = a[i + j], v = _mul_(a[i + j + half], w[j]);
+						a[i + j] = _add_(u, v);
+						a[i + j + half] = _sub_(u, v);
+					}
+				}
+			}
+			uint32_t in = _pow_(uint32_t(n % P), P - 2);
+			for (size_t i = 0; i < n; ++i) a[i] = _mul_(a[i], in);
+		}
+
+		//32bitずつに分割した係数列の巡回畳み込み(結果はaに格納, 平方ならばb == nullptr)
+		static void _convolution_(uint32_t* a, uint32_t* b, size_t n) {
+			for (size_t i = 0; i < n; ++i) a[i] %= P;
+			_forward_(a, n);
+			if (b == nullptr) for (size_t i = 0; i < n; ++i) a[i] = _mul_(a[i], a[i]);
+			else {
+				for (size_t i = 0; i < n; ++i) b[i] %= P;
+				_forward_(b, n);
+				for (size_t i = 0; i < n; ++i) a[i] = _mul_(a[i], b[i]);
+			}
+			_inverse_(a, n);
+		}
+	};
+	using __limb_ntt_prime1 = __limb_ntt_prime<998244353, 3>;		//119*2^23 + 1
+	using __limb_ntt_prime2 = __limb_ntt_prime<469762049, 3>;		//7*2^26 + 1
+	using __limb_ntt_prime3 = __limb_ntt_prime<754974721, 11>;		//45*2^24 + 1
+
+	//数論変換による乗算(an >= bn > 0, an + bn <= limb_ntt_max_size, rはan + bn要素でa, bと重ならないこと)
+	//リムを32bitの係数に分割し, 3つの法での巡回畳み込みを中国剰余定理(Garnerの算法)で復元する
+	//各係数は min(2an, 2bn)*(2^32 - 1)^2 < 2^86 であり, 3つの法の積(約2^88.2)を超えない
+	inline void __limb_mul_ntt(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn) {
+		using p1 = __limb_ntt_prime1;
+		using p2 = __limb_ntt_prime2;
+		using p3 = __limb_ntt_prime3;
+		bool square = (a == b && an == bn);
+		size_t n = 1;
+		while (n < 2 * (an + bn)) n <<= 1;
+
+		//各法での畳み込み
+		std::vector<uint32_t> c1(n), c2(n), c3(n), t;
+		for (size_t i = 0; i < an; ++i) { c1[2 * i] = uint32_t(a[i]); c1[2 * i + 1] = uint32_t(a[i] >> 32); }
+		c2 = c3 = c1;
+		if (!square) {
+			t.assign(n, 0);
+			for (size_t i = 0; i < bn; ++i) { t[2 * i] = uint32_t(b[i]); t[2 * i + 1] = uint32_t(b[i] >> 32); }
+		}
+		std::vector<uint32_t> t2(t), t3(t);
+		p1::_convolution_(c1.data(), square ? nullptr : t.data(), n);
+		p2::_convolution_(c2.data(), square ? nullptr : t2.data(), n);
+		p3::_convolution_(c3.data(), square ? nullptr : t3.data(), n);
+
+		//x = r1 + m1*(y + m2*z) (0 <= y < m2, 0 <= z < m3)として復元し, 2^32ずつ桁上げする
+		const uint32_t m1_inv2 = p2::_pow_(p1::mod % p2::mod, p2::mod - 2);
+		const uint32_t m12_inv3 = p3::_pow_(p3::_mul_(p1::mod % p3::mod, p2::mod % p3::mod), p3::mod - 2);
+		limb_t carry_lo = 0, carry_hi = 0;
+		for (size_t k = 0; k < 2 * (an + bn); ++k) {
+			uint32_t r1 = c1[k], r2 = c2[k] % p2::mod, r3 = c3[k] % p3::mod;
+			uint32_t y = p2::_mul_(p2::_sub_(r2, r1 % p2::mod), m1_inv2);
+			uint32_t s = uint32_t((uint64_t(r1) + uint64_t(p1::mod) * y) % p3::mod);
+			uint32_t z = p3::_mul_(p3::_sub_(r3, s), m12_inv3);
+			limb_t hi, lo = __limb_mul(limb_t(p1::mod), limb_t(y) + limb_t(p2::mod) * z, hi);
+			unsigned char c;
+			lo = __limb_addc(lo, r1, 0, c);
+			hi += c;
+			carry_lo = __limb_addc(carry_lo, lo, 0, c);
+			carry_hi += hi + c;
+			if (k & 1) r[k / 2] |= limb_t(uint32_t(carry_lo)) << 32;
+			else r[k / 2] = uint32_t(carry_lo);
+			carry_lo = (carry_lo >> 32) | (carry_hi << 32);
+			carry_hi >>= 32;
+		}
+	}
+
+	//r = a * b (n要素同士, rは2n要素でa, bと重ならないこと)
+	inline void __limb_mul_n(limb_t* r, const limb_t* a, const limb_t* b, size_t n) {
+		if (n < limb_karatsuba_threshold) __limb_mul_basecase(r, a, n, b, n);
+		else if (n < limb_toom3_threshold) __limb_mul_karatsuba(r, a, b, n);
+		else if (n < limb_ntt_threshold || 2 * n > limb_ntt_max_size) __limb_mul_toom3(r, a, b, n);
+		else __limb_mul_ntt(r, a, n, b, n);
+	}
+	//r = a * b (an >= bn > 0, rはan + bn要素でa, bと重ならないこと)
+	inline void __limb_mul(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn) {
+		if (bn < limb_karatsuba_threshold) { __limb_mul_basecase(r, a, an, b, bn); return; }
+		//数論変換は不均衡な積もそのまま扱える
+		if (bn >= limb_ntt_threshold && an + bn <= limb_ntt_max_size) { __limb_mul_ntt(r, a, an, b, bn); return; }
+		//bn要素ずつに分割して平衡な乗算に帰着する
+		std::vector<limb_t> t(2 * bn);
+		__limb_mul_n(r, a, b, bn);
+		size_t i = bn;
+		for (; i + bn <= an; i += bn) {
+			__limb_mul_n(t.data(), a + i, b, bn);
+			for (size_t j = i + bn; j < i + 2 * bn; ++j) r[j] = 0;
+			__limb_add(r + i, r + i, 2 * bn, t.data(), 2 * bn);
+		}
+		if (i < an) {
+			size_t m = an - i;
+			__limb_mul(t.data(), b, bn, a + i, m);
+			for (size_t j = i + bn; j < an + bn; ++j) r[j] = 0;
+			__limb_add(r + i, r + i, m + bn, t.data(), m + bn);
+		}
+	}
+
+
+	//a / d (dは1要素, qはn要素, 戻り値は剰余)
+	inline limb_t __limb_divrem_1(limb_t* q, const limb_t* a, size_t n, limb_t d) {
+		limb_t r = 0;
+		for (size_t i = n; i-- > 0;) q[i] = __limb_div(r, a[i], d, r);
+		return r;
+	}
+
+	//筆算による除算(Knuth Algorithm D, uはun + 1要素で正規化済み, vはvn要素で最上位ビットが1, qはun - vn + 1要素)
+	//uは剰余で上書きされる
+	inline void __limb_divrem_basecase(limb_t* q, limb_t* u, size_t un, const limb_t* v, size_t vn) {
+		limb_t v1 = v[vn - 1], v2 = (vn > 1) ? v[vn - 2] : 0;
+		for (size_t j = un - vn + 1; j-- > 0;) {
+			limb_t u0 = u[j + vn], u1 = u[j + vn - 1], u2 = (vn > 1) ? u[j + vn - 2] : 0;
+			limb_t qhat, rhat;
+			bool overflow = false;
+			if (u0 >= v1) {
+				//qhat = B - 1
+				qhat = ~limb_t(0);
+				rhat = u1 + v1;
+				overflow = (rhat < u1);
+			}
+			else qhat = __limb_div(u0, u1, v1, rhat);
+			//qhat*v2 > rhat*B + u2 の間qhatを減らす
+			while (!overflow) {
+				limb_t hi, lo = __limb_mul(qhat, v2, hi);
+				if (hi < rhat || (hi == rhat && lo <= u2)) break;
+				--qhat;
+				rhat += v1;
+				overflow = (rhat < v1);
+			}
+			limb_t borrow = __limb_submul_1(u + j, v, vn, qhat);
+			limb_t top = u[j + vn];
+			u[j + vn] = top - borrow;
+			//引き過ぎた場合は戻す
+			if (top < borrow) {
+				--qhat;
+				u[j + vn] += __limb_add_n(u + j, u + j, v, vn);
+			}
+			q[j] = qhat;
+		}
+	}
+
+	//Newton法による逆数 floor((B^(2n) - 1)/v) (vはn要素で最上位ビットが1, xはn + 1要素)
+	//上位h = n/2 + 2要素の逆数を再帰的に求め, x_1 = 2*x_0 - v*x_0^2/B^(2n) の1回の反復で精度を倍にする
+	inline void __limb_reciprocal(limb_t* x, const limb_t* v, size_t n) {
+		if (n < limb_newton_division_threshold) {
+			//B^(2n) - 1 を筆算で割る
+			std::vector<limb_t> u(2 * n + 1, ~limb_t(0));
+			u[2 * n] = 0;
+			__limb_divrem_basecase(x, u.data(), 2 * n, v, n);
+		}
+		else {
+			size_t h = n / 2 + 2;
+			std::vector<limb_t> xh(h + 1), sq(2 * h + 2), p(2 * h + 2 + n);
+			__limb_reciprocal(xh.data(), v + (n - h), h);
+			//x_0 = xh*B^(n - h) として v*x_0^2/B^(2n) = v*xh^2/B^(2h)
+			__limb_mul_n(sq.data(), xh.data(), xh.data(), h + 1);
+			__limb_mul(p.data(), sq.data(), 2 * h + 2, v, n);
+			for (size_t i = 0; i < n + 1; ++i) x[i] = 0;
+			for (size_t i = 0; i < h + 1; ++i) x[n - h + i] = xh[i];
+			x[n] = (x[n] << 1) | __limb_lshift(x, x, n, 1);
+			__limb_sub(x, x, n + 1, p.data() + 2 * h, n + 1);
+		}
+		//補正: v*(x + 1) <= B^(2n) - 1 の間xを増やし, v*x > B^(2n) - 1 の間xを減らす
+		std::vector<limb_t> vx(2 * n + 1);
+		__limb_mul(vx.data(), x, n + 1, v, n);
+		for (;;) {
+			if (vx[2 * n] != 0) {
+				__limb_sub_1(x, x, n + 1, 1);
+				__limb_sub(vx.data(), vx.data(), 2 * n + 1, v, n);
+				continue;
+			}
+			std::vector<limb_t> s(vx);
+			if (__limb_add(s.data(), s.data(), 2 * n + 1, v, n) || s[2 * n] != 0) break;
+			__limb_add_1(x, x, n + 1, 1);
+			vx.swap(s);
+		}
+	}
+
+	//Newton法による逆数を用いた除算(uはun要素で正規化済み, vはvn要素で最上位ビットが1, qはun - vn + 1要素)
+	//B^vnを基数とする筆算として, 各桁の商を逆数との積により求める
+	inline void __limb_divrem_newton(limb_t* q, limb_t* u, size_t un, const limb_t* v, size_t vn) {
+		size_t n = vn, blocks = (un + n - 1) / n;
+		std::vector<limb_t> inv(n + 1), win(2 * n + 1), t(3 * n + 2), qb(n + 2), qv(2 * n + 2), rem(n);
+		__limb_reciprocal(inv.data(), v, n);
+
+		for (size_t i = 0; i < un - vn + 1; ++i) q[i] = 0;
+		for (size_t blk = blocks; blk-- > 0;) {
+			size_t off = blk * n, len = (un - off < n) ? un - off : n;
+			//win = rem*B^n + (この桁)
+			for (size_t i = 0; i < n; ++i) win[i] = (i < len) ? u[off + i] : 0;
+			for (size_t i = 0; i < n; ++i) win[n + i] = rem[i];
+			win[2 * n] = 0;
+			//qb = floor(win*inv/B^(2n))は真の商より高々2小さい
+			__limb_mul(t.data(), win.data(), 2 * n, inv.data(), n + 1);
+			for (size_t i = 0; i < n + 2; ++i) qb[i] = (2 * n + i < 3 * n + 1) ? t[2 * n + i] : 0;
+			__limb_mul(qv.data(), qb.data(), n + 1, v, n);
+			__limb_sub(win.data(), win.data(), 2 * n + 1, qv.data(), 2 * n + 1);
+			while (__limb_normalized_size(win.data() + n, n + 1) != 0 || __limb_cmp(win.data(), v, n) >= 0) {
+				__limb_sub(win.data(), win.data(), 2 * n + 1, v, n);
+				__limb_add_1(qb.data(), qb.data(), n + 1, 1);
+			}
+			for (size_t i = 0; i < n; ++i) rem[i] = win[i];
+			//商の書き込み(上位側は既に書き込まれた桁へ桁上がりする)
+			if (off < un - vn + 1) {
+				size_t m = un - vn + 1 - off;
+				__limb_add(q + off, q + off, m, qb.data(), __limb_normalized_size(qb.data(), (n + 1 < m) ? n + 1 : m));
+			}
+			for (size_t i = 0; i < len; ++i) u[off + i] = 0;
+		}
+		for (size_t i = 0; i < n; ++i) u[i] = rem[i];
+	}
+
+	//a / d (an >= dn, d[dn - 1] != 0, qはan - dn + 1要素, rはdn要素)
+	inline void __limb_divrem(limb_t* q, limb_t* r, const limb_t* a, size_t an, const limb_t* d, size_t dn) {
+		if (dn == 1) {
+			r[0] = __limb_divrem_1(q, a, an, d[0]);
+			return;
+		}
+		//除数の最上位ビットが1となるように正規化する
+		size_t s = __limb_clz(d[dn - 1]);
+		std::vector<limb_t> u(an + 1), v(dn);
+		if (s != 0) {
+			__limb_lshift(v.data(), d, dn, s);
+			u[an] = __limb_lshift(u.data(), a, an, s);
+		}
+		else {
+			for (size_t i = 0; i < dn; ++i) v[i] = d[i];
+			for (size_t i = 0; i < an; ++i) u[i] = a[i];
+			u[an] = 0;
+		}
+		if (dn < limb_newton_division_threshold) {
+			std::vector<limb_t> qq(an - dn + 2);
+			__limb_divrem_basecase(qq.data(), u.data(), an, v.data(), dn);
+			for (size_t i = 0; i < an - dn + 1; ++i) q[i] = qq[i];
+		}
+		else {
+			std::vector<limb_t> qq(an - dn + 2);
+			__limb_divrem_newton(qq.data(), u.data(), an + 1, v.data(), dn);
+			for (size_t i = 0; i < an - dn + 1; ++i) q[i] = qq[i];
+		}
+		if (s != 0) __limb_rshift(r, u.data(), dn, s);
+		else for (size_t i = 0; i < dn; ++i) r[i] = u[i];
+	}
+}
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,204 @@
+﻿#ifndef IMATH_MATH_MULTI_MATH_CONSTANT_HPP
+#define IMATH_MATH_MULTI_MATH_CONSTANT_HPP
+
+#include "IMathLib/IMathLib_config.hpp"
+#include "IMathLib/math/math/sqrt.hpp"
+#include "IMathLib/math/multi/big_int.hpp"
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace iml {
+
+	//数学定数の多倍長固定小数点数(値はx/2^prec)による計算
+
+	//二分割法で並列に計算する区間の項数の下限
+	constexpr size_t __binary_splitting_parallel_terms = 512;
+
+	//超幾何級数 Σ[k >= 0] c(k) Π[1 <= j <= k] p(j)/q(j) の[a, b)の部分について
+	//P = Π p(k), Q = Π q(k), T = Q Σ c(k) Π[a <= j <= k] p(j)/q(j) を求める(k = 0ではp = q = 1とする)
+	//Pは親の区間で用いる場合(need_p)のみ求め, threads > 1であれば左右の部分木を別のスレッドで計算する
+	template <class Constant>
+	inline void __binary_splitting(size_t a, size_t b, big_int<>& P, big_int<>& Q, big_int<>& T, bool need_p, size_t threads) {
+		if (b - a == 1) {
+			big_int<> c;
+			Constant::_term_(a, P, Q, c);
+			T = c * P;
+			return;
+		}
+		size_t m = a + (b - a) / 2;
+		big_int<> P2, Q2, T2;
+		if (threads > 1 && b - a >= __binary_splitting_parallel_terms) {
+			std::future<void> left = std::async(std::launch::async, __binary_splitting<Constant>, a, m, std::ref(P), std::ref(Q), std::ref(T), true, threads / 2);
+			__binary_splitting<Constant>(m, b, P2, Q2, T2, need_p, threads - threads / 2);
+			left.get();
+		}
+		else {
+			__binary_splitting<Constant>(a, m, P, Q, T, true, 1);
+			__binary_splitting<Constant>(m, b, P2, Q2, T2, need_p, 1);
+		}
+		//T = T1 Q2 + P1 T2
+		T *= Q2;
+		T += P * T2;
+		if (need_p) P *= P2;
+		Q *= Q2;
+	}
+	//超幾何級数のn項までの和 T/Q
+	template <class Constant>
+	inline void __binary_splitting(size_t n, big_int<>& Q, big_int<>& T) {
+		big_int<> P;
+		size_t threads = std::thread::hardware_concurrency();
+		__binary_splitting<Constant>(0, n, P, Q, T, false, (threads == 0) ? 1 : threads);
+	}
+	//級数の項の比が2^-bits未満でc(k)がdeg次の多項式であるときに誤差を2^-(prec + 8)未満とする項数
+	inline size_t __binary_splitting_terms(size_t prec, double bits, size_t deg) {
+		size_t lg = 0;
+		for (size_t p = prec; p != 0; p >>= 1) ++lg;
+		return size_t(double(prec + deg * lg + 8) / bits) + 2;
+	}
+
+
+	//円周率(Chudnovskyの公式 1/π = 12 Σ (-1)^k (6k)!(13591409 + 545140134k)/((3k)!(k!)^3 640320^(3k + 3/2)))
+	struct Pi_constant {
+		//p(k) = -(6k - 5)(2k - 1)(6k - 1), q(k) = 640320^3 k^3/24
+		static void _term_(size_t k, big_int<>& p, big_int<>& q, big_int<>& c) {
+			c = big_int<>(uint64_t(545140134) * k + 13591409);
+			if (k == 0) {
+				p = big_int<>(1);
+				q = big_int<>(1);
+				return;
+			}
+			big_int<> bk(k);
+			p = -(big_int<>(uint64_t(6) * k - 5) * big_int<>(uint64_t(2) * k - 1) * big_int<>(uint64_t(6) * k - 1));
+			q = bk * bk * bk * big_int<>(uint64_t(10939058860032000));
+		}
+		//π = 426880√10005 Q/T (1項あたり約47.11ビット)
+		static big_int<> _fixed_(size_t prec) {
+			size_t w = prec + 32;
+			big_int<> Q, T;
+			__binary_splitting<Pi_constant>(__binary_splitting_terms(w, 47.11, 1), Q, T);
+			return ((isqrt(big_int<>(10005) << (2 * w)) * big_int<>(426880) * Q) / T) >> 32;
+		}
+	};
+	//ネイピア数(e = Σ 1/k!)
+	struct E_constant {
+		static void _term_(size_t k, big_int<>& p, big_int<>& q, big_int<>& c) {
+			p = big_int<>(1);
+			q = big_int<>((k == 0) ? 1 : k);
+			c = big_int<>(1);
+		}
+		static big_int<> _fixed_(size_t prec) {
+			size_t w = prec + 32, n = 1;
+			//log2(n!) > w + 8
+			for (double lg = 0; lg <= double(w + 8); lg += _log2_(++n));
+			big_int<> Q, T;
+			__binary_splitting<E_constant>(n + 1, Q, T);
+			return (T << w) / Q >> 32;
+		}
+		static double _log2_(size_t n) {
+			double x = double(n), r = 0;
+			for (; x >= 2; x /= 2) ++r;
+			//1 <= x < 2でのlog2(x) >= x - 1 の下界を用いる
+			return r + (x - 1);
+		}
+	};
+	//log2(log2 = 3/4 Σ (-1)^k (k!)^2/(2^k (2k + 1)!))
+	struct Ln2_constant {
+		//p(k) = -k, q(k) = 4(2k + 1)
+		static void _term_(size_t k, big_int<>& p, big_int<>& q, big_int<>& c) {
+			c = big_int<>(1);
+			if (k == 0) {
+				p = big_int<>(1);
+				q = big_int<>(1);
+				return;
+			}
+			p = -big_int<>(k);
+			q = big_int<>(uint64_t(8) * k + 4);
+		}
+		static big_int<> _fixed_(size_t prec) {
+			size_t w = prec + 32;
+			big_int<> Q, T;
+			__binary_splitting<Ln2_constant>(__binary_splitting_terms(w, 3, 0), Q, T);
+			return ((T * big_int<>(3)) << w) / (Q << 2) >> 32;
+		}
+	};
+	//カタランの定数(G = 1/2 Σ (-8)^k (3k + 2)/((2k + 1)^3 C(2k, k)^3))
+	struct Catalan_constant {
+		//p(k) = -k^3, q(k) = (2k + 1)^3
+		static void _term_(size_t k, big_int<>& p, big_int<>& q, big_int<>& c) {
+			c = big_int<>(uint64_t(3) * k + 2);
+			if (k == 0) {
+				p = big_int<>(1);
+				q = big_int<>(1);
+				return;
+			}
+			big_int<> bk(k), b2(uint64_t(2) * k + 1);
+			p = -(bk * bk * bk);
+			q = b2 * b2 * b2;
+		}
+		//1項あたり3ビット
+		static big_int<> _fixed_(size_t prec) {
+			size_t w = prec + 32;
+			big_int<> Q, T;
+			__binary_splitting<Catalan_constant>(__binary_splitting_terms(w, 3, 1), Q, T);
+			return (T << w) / (Q << 1) >> 32;
+		}
+	};
+	//アペリーの定数(ζ(3) = 1/64 Σ (-1)^k (205k^2 + 250k + 77)(k!)^10/((2k + 1)!)^5)
+	struct Apery_constant {
+		//p(k) = -k^5, q(k) = 32(2k + 1)^5
+		static void _term_(size_t k, big_int<>& p, big_int<>& q, big_int<>& c) {
+			c = big_int<>(uint64_t(205) * k * k + uint64_t(250) * k + 77);
+			if (k == 0) {
+				p = big_int<>(1);
+				q = big_int<>(1);
+				return;
+			}
+			big_int<> bk(k), b2(uint64_t(2) * k + 1), k2 = bk * bk, b4 = b2 * b2;
+			p = -(k2 * k2 * bk);
+			q = (b4 * b4 * b2) << 5;
+		}
+		//1項あたり10ビット
+		static big_int<> _fixed_(size_t prec) {
+			size_t w = prec + 32;
+			big_int<> Q, T;
+			__binary_splitting<Apery_constant>(__binary_splitting_terms(w, 10, 2), Q, T);
+			return (T << w) / (Q << 6) >> 32;
+		}
+	};
+
+
+	//数学定数の実行時キャッシュ(要求された精度を含むように精度を倍々に伸長する)
+	template <class Constant>
+	class math_constant_cache {
+		big_int<> x_m;
+		size_t prec_m;
+	public:
+		math_constant_cache() : x_m(), prec_m(0) {}
+
+		size_t precision() const { return prec_m; }
+		void reserve(size_t prec) {
+			if (prec <= prec_m) return;
+			size_t p = (prec > 2 * prec_m) ? prec : 2 * prec_m;
+			x_m = Constant::_fixed_(p);
+			prec_m = p;
+		}
+		//x*2^prec(誤差は最下位ビットの2未満)
+		big_int<> operator()(size_t prec) {
+			reserve(prec);
+			return x_m >> (prec_m - prec);
+		}
+	};
+
+	//定数の固定小数点数(共有の実行時キャッシュから切り出すため, 同程度以下の精度の2回目以降の参照では級数を計算しない)
+	template <class Constant>
+	inline big_int<> math_constant_fixed(size_t prec) {
+		static math_constant_cache<Constant> cache;
+		static std::mutex m;
+		std::lock_guard<std::mutex> lock(m);
+		return cache(prec);
+	}
+}
+
+
+#endif
\ No newline at end of file
@@ -2,220 +2,1297 @@
 #define _IMATH_MULTI_MULTI_FLOAT_HPP
 
 #include "IMathLib/IMathLib_config.hpp"
-#include "IMathLib/math/math.hpp"
+#include "IMathLib/math/math/math_traits.hpp"
+#include "IMathLib/math/math/numeric_traits.hpp"
+#include "IMathLib/math/math/abs.hpp"
+#include "IMathLib/math/math/sgn.hpp"
+#include "IMathLib/math/math/sqrt.hpp"
+#include "IMathLib/math/math/exp.hpp"
+#include "IMathLib/math/math/log.hpp"
+#include "IMathLib/math/math/trigonometric_function.hpp"
+#include "IMathLib/math/math/bernoulli_number.hpp"
+#include "IMathLib/math/math/gamma.hpp"
+#include "IMathLib/math/math/erf.hpp"
+#include "IMathLib/math/math/dirichlet_eta.hpp"
+#include "IMathLib/math/math/riemann_zeta.hpp"
+#include "IMathLib/math/math/pi.hpp"
+#include "IMathLib/math/math/e.hpp"
+#include "IMathLib/math/math/ln2.hpp"
+#include "IMathLib/math/math/catalan.hpp"
+#include "IMathLib/math/multi/limb.hpp"
+#include "IMathLib/math/multi/big_int.hpp"
+#include "IMathLib/math/multi/math_constant.hpp"
+#include "IMathLib/utility/type_traits/is_type.hpp"
+#include "IMathLib/utility/utility/bit_cast.hpp"
+#include <ostream>
+#include <string>
+#include <vector>
 
 namespace iml {
 
+	//固定小数点数(値はx/2^prec)による初等関数の計算の補助
+
+	//二分割法で扱う級数 Σ[k >= 1] Π[1 <= i <= k] p/(d(i)2^s) の項の分母d(i)
+	inline limb_t __multi_float_exp_term(size_t i) { return i; }								//exp(x) - 1
+	inline limb_t __multi_float_cos_term(size_t i) { return limb_t(2 * i - 1) * (2 * i); }		//cos(x) - 1 (p = -x^2)
+	inline limb_t __multi_float_sin_term(size_t i) { return limb_t(2 * i) * (2 * i + 1); }		//sin(x)/x - 1 (p = -x^2)
+
+	//[a, b)の部分和 = T/(Q 2^(s(b - a))), P = p^(b - a)
+	inline void __multi_float_split(const big_int<>& p, size_t s, limb_t (*d)(size_t), size_t a, size_t b, big_int<>& P, big_int<>& Q, big_int<>& T) {
+		if (b - a == 1) {
+			P = p;
+			Q = big_int<>(d(a));
+			T = p;
+			return;
+		}
+		size_t m = a + (b - a) / 2;
+		big_int<> P2, Q2, T2;
+		__multi_float_split(p, s, d, a, m, P, Q, T);
+		__multi_float_split(p, s, d, m, b, P2, Q2, T2);
+		//T = T1 Q2 2^(s(b - m)) + P1 T2
+		T *= Q2;
+		T <<= s * (b - m);
+		T += P * T2;
+		P *= P2;
+		Q *= Q2;
+	}
+	//級数の和*2^prec(項の比が1/2以下となり, 項が2^-(prec + 4)を下回るまで加える)
+	inline big_int<> __multi_float_series(const big_int<>& p, size_t s, limb_t (*d)(size_t), size_t prec) {
+		if (p.sign() == 0) return big_int<>();
+		//log2|p/2^s| <= bp, log2 d(i) >= 63 - clz(d(i))
+		int64_t bp = int64_t(p.bit_width()) - int64_t(s), acc = 0;
+		size_t n = 0;
+		for (;;) {
+			acc += bp - int64_t(63 - __limb_clz(d(++n)));
+			if (acc < -int64_t(prec + 4) && bp - int64_t(63 - __limb_clz(d(n + 1))) < -1) break;
+		}
+		big_int<> P, Q, T;
+		__multi_float_split(p, s, d, 1, n + 1, P, Q, T);
+		size_t e = s * n;
+		if (e <= prec) T <<= (prec - e);
+		else T >>= (e - prec);
+		return T / Q;
+	}
+
+	//x*2^precの小数点以下lo + 1ビット目からhiビット目までの整数
+	inline big_int<> __multi_float_chunk(const big_int<>& ax, size_t prec, size_t lo, size_t hi) {
+		return (ax >> (prec - hi)) - ((ax >> (prec - lo)) << (hi - lo));
+	}
+	//exp(x)*2^prec (|x| < 1)
+	//xを小数点以下のビット幅が倍々になる区間ごとに分割し, 各区間の級数を二分割法で求める(bit-burst法)
+	inline big_int<> __multi_float_exp_fixed(const big_int<>& x, size_t prec) {
+		big_int<> result = big_int<>(1) << prec, ax = abs(x);
+		for (size_t lo = 0, hi = 16; lo < prec; lo = hi, hi *= 2) {
+			if (hi > prec) hi = prec;
+			big_int<> p = __multi_float_chunk(ax, prec, lo, hi);
+			if (p.sign() == 0) continue;
+			if (x.sign() < 0) p = -p;
+			result *= (big_int<>(1) << prec) + __multi_float_series(p, hi, __multi_float_exp_term, prec);
+			result >>= prec;
+		}
+		return result;
+	}
+	//cos(x)*2^prec, sin(x)*2^prec (|x| < 1)
+	inline void __multi_float_sincos_fixed(const big_int<>& x, size_t prec, big_int<>& c, big_int<>& s) {
+		big_int<> ax = abs(x), one = big_int<>(1) << prec;
+		c = one;
+		s = big_int<>();
+		for (size_t lo = 0, hi = 16; lo < prec; lo = hi, hi *= 2) {
+			if (hi > prec) hi = prec;
+			big_int<> p = __multi_float_chunk(ax, prec, lo, hi);
+			if (p.sign() == 0) continue;
+			if (x.sign() < 0) p = -p;
+			big_int<> q = -(p * p);
+			big_int<> cj = one + __multi_float_series(q, 2 * hi, __multi_float_cos_term, prec);
+			big_int<> sj = ((one + __multi_float_series(q, 2 * hi, __multi_float_sin_term, prec)) * p) >> hi;
+			//加法定理
+			big_int<> c2 = (c * cj - s * sj) >> prec;
+			s = (s * cj + c * sj) >> prec;
+			c = move(c2);
+		}
+	}
+	//log(m)*2^prec (1/√2 <= m/2^prec <= √2)
+	//精度を倍々に上げながらNewton法 y <- y + m exp(-y) - 1 を適用する
+	inline big_int<> __multi_float_log_fixed(const big_int<>& m, size_t prec) {
+		std::vector<size_t> ps;
+		for (size_t p = prec;; p = p / 2 + 32) {
+			ps.push_back(p);
+			if (p <= 128) break;
+		}
+		//最低精度では|log m| < 0.35から7回の反復で2^-128以下となる
+		size_t p = ps.back();
+		big_int<> y, mp = m >> (prec - p), one = big_int<>(1) << p;
+		for (size_t i = 0; i < 7; ++i) y += ((mp * __multi_float_exp_fixed(-y, p)) >> p) - one;
+		for (size_t i = ps.size() - 1; i-- > 0;) {
+			y <<= ps[i] - p;
+			p = ps[i];
+			mp = m >> (prec - p);
+			one = big_int<>(1) << p;
+			y += ((mp * __multi_float_exp_fixed(-y, p)) >> p) - one;
+		}
+		return y;
+	}
+
+
+	template <size_t N>
+	struct Multi_float_kernel;
+
 	//固定長任意精度浮動小数点(N:仮数部のビット数)
+	//仮数部をNを64の倍数に切り上げたビット数で保持し, 四則演算と平方根は最近接偶数丸めで正しく丸める
+	//指数部の範囲を超えた結果は無限大または0となる(非正規化数は持たない)
 	template <size_t N>
 	class multi_float {
 		template <size_t> friend class multi_float;
+		template <size_t> friend struct Multi_float_kernel;
+		friend struct numeric_traits<multi_float>;
+	public:
+		static constexpr size_t size = N / 64 + (N % 64 != 0);			//仮数部の配列数
+		static constexpr size_t digits = 64 * size;						//仮数部のビット数
+		static constexpr size_t digits10 = size_t((digits - 1) * 0.30102999566398120);
+		static constexpr int64_t max_exponent = int64_t(1) << 40;		//|x| < 2^max_exponent
+		static constexpr int64_t min_exponent = -max_exponent;			//|x| >= 2^(min_exponent - 1)
+	private:
+		//値の種類
+		static constexpr unsigned char zero_kind = 0;
+		static constexpr unsigned char finite_kind = 1;
+		static constexpr unsigned char infinity_kind = 2;
+		static constexpr unsigned char nan_kind = 3;
 
-		//確保される配列数
-		static constexpr size_t size_m = N / numeric_traits<size_t>::digits + (N % numeric_traits<size_t>::digits != 0);
-
-		bool sign_m;					//符号部
-		size_t x_m[size_m];			//仮数部
-		int_t index_m;				//指数部
+		limb_t x_m[size];				//仮数部(下位から順に格納し, 最上位ビットは1)
+		int64_t exponent_m;				//指数部(|x| = 0.x_m * 2^exponent_m)
+		bool sign_m;					//符号部(負ならば真)
+		unsigned char kind_m;
 
-		//加算(型の符号は無視)
-		multi_float multi_float_add(const multi_float& n) {
+		static multi_float special(unsigned char kind, bool neg) {
 			multi_float result;
-			bool carry_out = false;
-
-			if (this->index_m > n.index_m) {
-				//指数の差
-				int_t index_imu_range = this->index_m - n.index_m;
-				result.index_m = this->index_m;
-				//キャリーアウト
-				carry_out = n.x_m[size_m - 1 - index_imu_range] > (numeric_traits<size_t>::max() / 2);
-				//キャリーしながら加算
-				for (size_t i = size_m - 1; i != index_imu_range; --i) {
-					result.x_m[i] = this->x_m[i] + n.x_m[i - index_imu_range] + carry_out;
-					carry_out = (this->x_m[i] > (numeric_traits<size_t>::max() - carry_out))
-						|| (n.x_m[i - index_imu_range] > (numeric_traits<size_t>::max() - carry_out))
-						|| (this->x_m[i] > (numeric_traits<size_t>::max() - n.x_m[i - index_imu_range]));
-				}
-				//(--0) == numeric_traits<size_t>::max()
-				for (size_t i = index_imu_range; (i != numeric_traits<size_t>::max()) && (carry_out); --i) {
-					result.x_m[i] = this->x_m[i] + carry_out;
-					carry_out = this->x_m[i] > (numeric_traits<size_t>::max() - carry_out);
+			result.kind_m = kind;
+			result.sign_m = neg;
+			return result;
+		}
+		//a*2^e (aはn要素)を丸めて設定する(stickyはaより下位に0でないビットが存在すること)
+		//stickyを用いる場合はaがdigits + 2ビット以上であること
+		void assign_rounded(const limb_t* a, size_t n, int64_t e, bool neg, bool sticky) {
+			n = __limb_normalized_size(a, n);
+			sign_m = neg;
+			if (n == 0) {
+				kind_m = zero_kind;
+				exponent_m = 0;
+				for (size_t i = 0; i < size; ++i) x_m[i] = 0;
+				return;
+			}
+			kind_m = finite_kind;
+			size_t bits = 64 * n - __limb_clz(a[n - 1]);
+			if (bits <= digits) {
+				//左詰めにする
+				size_t s = digits - bits, q = s / 64, r = s % 64;
+				for (size_t i = 0; i < size; ++i) x_m[i] = 0;
+				if (r != 0) {
+					limb_t c = __limb_lshift(x_m + q, a, n, r);
+					if (n + q < size) x_m[n + q] = c;
 				}
+				else for (size_t i = 0; i < n; ++i) x_m[q + i] = a[i];
 			}
 			else {
-				//指数の差
-				int_t index_imu_range = n.index_m - this->index_m;
-				result.index_m = n.index_m;
-				//キャリーアウト(キャリーしない場合も考慮)
-				carry_out = (index_imu_range == 0) ? 0 : (this->x_m[size_m - 1 - index_imu_range] > (numeric_traits<size_t>::max() / 2));
-				//キャリーしながら加算
-				for (size_t i = size_m - 1; i != index_imu_range; --i) {
-					result.x_m[i] = this->x_m[i - index_imu_range] + n.x_m[i] + carry_out;
-					carry_out = (this->x_m[i - index_imu_range] > (numeric_traits<size_t>::max() - carry_out))
-						|| (n.x_m[i] > (numeric_traits<size_t>::max() - carry_out))
-						|| (this->x_m[i - index_imu_range] > (numeric_traits<size_t>::max() - n.x_m[i]));
+				//下位sビットを切り捨てて最近接偶数丸め
+				size_t s = bits - digits, q = s / 64, r = s % 64;
+				size_t rq = (s - 1) / 64, rr = (s - 1) % 64;
+				bool round = ((a[rq] >> rr) & 1) != 0;
+				for (size_t i = 0; i < rq && !sticky; ++i) sticky = (a[i] != 0);
+				sticky = sticky || (rr != 0 && (a[rq] << (64 - rr)) != 0);
+				for (size_t i = 0; i < size; ++i) {
+					limb_t lo = (q + i < n) ? a[q + i] : 0, hi = (q + i + 1 < n) ? a[q + i + 1] : 0;
+					x_m[i] = (r != 0) ? ((lo >> r) | (hi << (64 - r))) : lo;
 				}
-				//(--0) == numeric_traits<size_t>::max()
-				for (size_t i = index_imu_range; (i != numeric_traits<size_t>::max()) && (carry_out); --i) {
-					result.x_m[i] = n.x_m[i] + carry_out;
-					carry_out = n.x_m[i] > (numeric_traits<size_t>::max() - carry_out);
+				if (round && (sticky || (x_m[0] & 1) != 0)) {
+					if (__limb_add_1(x_m, x_m, size, 1) != 0) {
+						x_m[size - 1] = limb_t(1) << 63;
+						++bits;
+					}
 				}
 			}
-			//シフト処理
-			if (carry_out) {
-				++result.index_m;
-				carry_out = result.x_m[size_m - 1] > (numeric_traits<size_t>::max() / 2);
-				for (size_t i = size_m - 1; i != 0; --i) {
-					result.x_m[i] = result.x_m[i - 1] + carry_out;
-					carry_out = result.x_m[i - 1] > (numeric_traits<size_t>::max() - carry_out);
-				}
-				result.x_m[0] = 1 + carry_out;
+			exponent_m = e + int64_t(bits);
+			if (exponent_m > max_exponent) kind_m = infinity_kind;
+			else if (exponent_m < min_exponent) assign_rounded(a, 0, 0, neg, false);
+		}
+		void assign_u64(uint64_t u, bool neg) {
+			assign_rounded(&u, 1, 0, neg, false);
+		}
+		void assign_double(double x) {
+			uint64_t u = bit_cast<uint64_t>(x);
+			bool neg = (u >> 63) != 0;
+			int64_t e = int64_t((u >> 52) & 0x7FF);
+			uint64_t m = u & 0x000FFFFFFFFFFFFFull;
+			if (e == 0x7FF) {
+				*this = special((m == 0) ? infinity_kind : nan_kind, neg);
+				return;
+			}
+			//非正規化数は隠れビットを持たない
+			if (e == 0) e = 1;
+			else m |= 0x0010000000000000ull;
+			assign_rounded(&m, 1, e - 1075, neg, false);
+		}
+		//10^k
+		static big_int<> pow10(size_t k) {
+			big_int<> result(1), p(10);
+			for (; k != 0; k >>= 1) {
+				if (k & 1) result *= p;
+				if (k > 1) p *= p;
 			}
 			return result;
 		}
-		//減算(型の符号は無視)
-		multi_float multi_float_sub(const multi_float& n) {
-			multi_float result;
-			bool carry_out = false;
-
-			if (this->index_m > n.index_m) {
-				//指数の差
-				int_t index_imu_range = this->index_m - n.index_m;
-				result.index_m = this->index_m;
-				//キャリーアウト
-				carry_out = (numeric_traits<size_t>::max() / 2 + 1) > n.x_m[size_m - 1 - index_imu_range];
-				//キャリーしながら加算
-				for (size_t i = size_m - 1; i != index_imu_range; --i) {
-					result.x_m[i] = this->x_m[i] + numeric_traits<size_t>::max() - n.x_m[i - index_imu_range] + carry_out;
-					carry_out = ((this->x_m[i] + carry_out) > n.x_m[i - index_imu_range])
-						|| (this->x_m[i] > (n.x_m[i - index_imu_range] - carry_out))
-						|| (this->x_m[i] > (n.x_m[i - index_imu_range]));
-				}
-				//(--0) == numeric_traits<size_t>::max()
-				for (size_t i = index_imu_range; i != numeric_traits<size_t>::max(); --i) {
-					result.x_m[i] = this->x_m[i] + numeric_traits<size_t>::max() + carry_out;
-					carry_out = (this->x_m[i] > 0) || (carry_out);
-				}
+		//上位wビットに切り詰める(v*2^e)
+		static void truncate(big_int<>& v, int64_t& e, size_t w) {
+			size_t n = v.bit_width();
+			if (n > w) {
+				v >>= n - w;
+				e += int64_t(n - w);
 			}
-			else {
-				//指数の差
-				int_t index_imu_range = n.index_m - this->index_m;
-				result.index_m = n.index_m;
-				//キャリーアウト(キャリーしない場合も考慮)
-				carry_out = (index_imu_range == 0) ? 1 : ((numeric_traits<size_t>::max() / 2 + 1) > this->x_m[size_m - 1 - index_imu_range]);
-				//キャリーしながら加算
-				for (size_t i = size_m - 1; i != index_imu_range; --i) {
-					result.x_m[i] = this->x_m[i - index_imu_range] + numeric_traits<size_t>::max() - n.x_m[i] + carry_out;
-					carry_out = ((this->x_m[i - index_imu_range] + carry_out) > n.x_m[i])
-						|| (this->x_m[i - index_imu_range] > (n.x_m[i] - carry_out))
-						|| (this->x_m[i - index_imu_range] > (n.x_m[i]));
+		}
+		//num*10^k ≈ v*2^g (vはwビット以上で相対誤差は2^(bit_width(|k|) + 8 - w)未満)
+		//5^|k|を上位wビットに切り詰めながら冪乗するため, 指数が大きくても桁数はwに比例する
+		static big_int<> scale10_approx(const big_int<>& num, int64_t k, size_t w, int64_t& g) {
+			big_int<> r(1), p(5);
+			int64_t er = 0, ep = 0;
+			for (uint64_t a = uint64_t((k < 0) ? -k : k); a != 0; a >>= 1) {
+				if (a & 1) {
+					r *= p;
+					er += ep;
+					truncate(r, er, w);
 				}
-				//(--0) == numeric_traits<size_t>::max()
-				for (size_t i = index_imu_range; (i != numeric_traits<size_t>::max()) && (carry_out); --i) {
-					result.x_m[i] = numeric_traits<size_t>::max() - n.x_m[i] + carry_out;
-					carry_out = carry_out > n.x_m[i];
+				if (a > 1) {
+					p *= p;
+					ep *= 2;
+					truncate(p, ep, w);
 				}
 			}
-			//補数表現を元に戻す(この処理の後で理論上はcarry_out==falseとなる)
-			if (!carry_out) {
-				result.sign_m = true;
-				carry_out = true;
-				for (size_t i = size_m - 1; i != numeric_traits<size_t>::max(); --i) {
-					bool temp = carry_out > result.x_m[i];
-					result.x_m[i] = numeric_traits<size_t>::max() - result.x_m[i] + carry_out;
-					carry_out = temp;
+			if (k >= 0) {
+				g = k + er;
+				return num * r;
+			}
+			size_t s = w + r.bit_width();
+			g = k - er - int64_t(s);
+			return (num << s) / r;
+		}
+		//v (v >= 0)の2^hを法とした値が0からebビット以内にあるか
+		static bool near_multiple(const big_int<>& v, size_t h, size_t eb) {
+			big_int<> t = v - ((v >> h) << h);
+			return t.bit_width() <= eb || ((big_int<>(1) << h) - t).bit_width() <= eb;
+		}
+		static size_t bit_width(uint64_t a) {
+			size_t n = 0;
+			for (; a != 0; a >>= 1) ++n;
+			return n;
+		}
+		//誤差なく計算する指数の大きさの上限(超える場合は近似値から丸めの境界を判定する)
+		static constexpr int64_t exact_exponent = 8 * int64_t(digits) + 1024;
+		//num/den (num >= 0, den > 0)を丸めて設定する
+		void assign_ratio(const big_int<>& num, const big_int<>& den, bool neg) {
+			if (num.sign() == 0) {
+				assign_rounded(nullptr, 0, 0, neg, false);
+				return;
+			}
+			int64_t sh = int64_t(digits) + 2 + int64_t(den.bit_width()) - int64_t(num.bit_width());
+			if (sh < 0) sh = 0;
+			big_int<> q, r;
+			big_int<>::divrem(num << size_t(sh), den, q, r);
+			assign_rounded(q.data(), q.size(), -sh, neg, r.sign() != 0);
+		}
+		void assign_string(const char* str, size_t len) {
+			size_t i = 0;
+			bool neg = false;
+			if (i < len && (str[i] == '+' || str[i] == '-')) neg = (str[i++] == '-');
+			if (i < len && (str[i] == 'i' || str[i] == 'I')) {
+				*this = special(infinity_kind, neg);
+				return;
+			}
+			if (i < len && (str[i] == 'n' || str[i] == 'N')) {
+				*this = special(nan_kind, neg);
+				return;
+			}
+			//仮数部の数字の並びと小数点以下の桁数
+			std::string d;
+			int64_t e10 = 0;
+			bool point = false;
+			for (; i < len; ++i) {
+				char c = str[i];
+				if (c == '.' && !point) point = true;
+				else if (c >= '0' && c <= '9') {
+					if (point) --e10;
+					if (!(d.empty() && c == '0')) d.push_back(c);
 				}
+				else break;
+			}
+			if (i < len && (str[i] == 'e' || str[i] == 'E')) {
+				++i;
+				bool eneg = false;
+				if (i < len && (str[i] == '+' || str[i] == '-')) eneg = (str[i++] == '-');
+				int64_t t = 0;
+				for (; i < len && str[i] >= '0' && str[i] <= '9'; ++i) if (t < (int64_t(1) << 50)) t = t * 10 + (str[i] - '0');
+				e10 += eneg ? -t : t;
 			}
-			//シフト処理
-			if (result.x_m[0] == 0) {
-				//シフト量のカウント
-				size_t cnt = 1;
-				for (; (cnt < size_m) && (result.x_m[cnt] == 0); ++cnt);
-				result.index_m -= cnt;
-				//演算結果が0
-				if (cnt == size_m) {
-					result.index_m = 0;
-					result.sign_m = false;
+			big_int<> num(d);
+			if (num.sign() == 0) {
+				assign_rounded(nullptr, 0, 0, neg, false);
+				return;
+			}
+			//10^(l - 1) <= |x| < 10^l が指数部の範囲を大きく超える場合
+			int64_t l = int64_t(d.size()) + e10;
+			if (l > max_exponent / 3 + 1) {
+				*this = special(infinity_kind, neg);
+				return;
+			}
+			if (l < min_exponent / 3 - 1) {
+				assign_rounded(nullptr, 0, 0, neg, false);
+				return;
+			}
+			if (e10 < -exact_exponent || exact_exponent < e10) {
+				uint64_t ak = uint64_t((e10 < 0) ? -e10 : e10);
+				size_t kb = bit_width(ak);
+				//境界に極めて近い場合は精度を上げ, 誤差のない計算より桁数が大きくなれば打ち切る
+				for (size_t w = digits + kb + 64; w < 4 * ak + num.bit_width(); w *= 2) {
+					int64_t g;
+					big_int<> v = scale10_approx(num, e10, w, g);
+					size_t n = v.bit_width(), eb = n + kb + 9 - w;
+					if (!near_multiple(v, n - digits - 1, eb)) {
+						assign_rounded(v.data(), v.size(), g, neg, false);
+						return;
+					}
 				}
-				else {
-					//シフト実行
-					for (size_t i = 0, end = size_m - cnt; i < end; ++i) result.x_m[i] = result.x_m[i + cnt];
-					for (size_t i = this->size_m - cnt; i < size_m; ++i) result.x_m[i] = 0;
+			}
+			if (e10 >= 0) {
+				num *= pow10(size_t(e10));
+				assign_rounded(num.data(), num.size(), 0, neg, false);
+			}
+			else assign_ratio(num, pow10(size_t(-e10)), neg);
+		}
+
+		//m*2^e2*10^kを最近接偶数丸めした整数(結果はn桁程度)
+		static big_int<> round_scaled(const big_int<>& m, int64_t e2, int64_t k, size_t n) {
+			uint64_t ak = uint64_t((k < 0) ? -k : k), ae = uint64_t((e2 < 0) ? -e2 : e2);
+			if (e2 < -exact_exponent || exact_exponent < e2) {
+				size_t kb = bit_width(ak);
+				//10^n < 2^(w - 64)であるためv*2^gのgは負となる
+				for (size_t w = digits + 4 * n + kb + 64; w < 4 * ak + ae + digits; w *= 2) {
+					int64_t g;
+					big_int<> v = scale10_approx(m, k, w, g);
+					size_t h = size_t(-(g + e2)), eb = v.bit_width() + kb + 9 - w;
+					v += big_int<>(1) << (h - 1);
+					if (!near_multiple(v, h, eb)) return v >> h;
 				}
 			}
+			big_int<> num = m, den(1), d, r;
+			if (k >= 0) num *= pow10(size_t(k));
+			else den = pow10(size_t(-k));
+			if (e2 >= 0) num <<= size_t(e2);
+			else den <<= size_t(-e2);
+			big_int<>::divrem(num, den, d, r);
+			r <<= 1;
+			if (r > den || (r == den && (d[0] & 1) != 0)) ++d;
+			return d;
+		}
+		//絶対値の比較
+		static int compare_magnitude(const multi_float& a, const multi_float& b) {
+			if (a.exponent_m != b.exponent_m) return (a.exponent_m < b.exponent_m) ? -1 : 1;
+			return __limb_cmp(a.x_m, b.x_m, size);
+		}
+		//a + (negb ? -b : b)
+		static multi_float add(const multi_float& a, const multi_float& b, bool negb) {
+			bool sa = a.sign_m, sb = (b.sign_m != negb);
+			if (a.kind_m == nan_kind || b.kind_m == nan_kind) return special(nan_kind, false);
+			if (a.kind_m == infinity_kind) return (b.kind_m == infinity_kind && sa != sb) ? special(nan_kind, false) : a;
+			if (b.kind_m == infinity_kind) return special(infinity_kind, sb);
+			if (b.kind_m == zero_kind) return (a.kind_m == zero_kind) ? special(zero_kind, sa && sb) : a;
+			if (a.kind_m == zero_kind) {
+				multi_float result(b);
+				result.sign_m = sb;
+				return result;
+			}
+			//絶対値の大きい方をpとする
+			const multi_float* p = &a, *q = &b;
+			bool sp = sa, sq = sb;
+			if (compare_magnitude(a, b) < 0) {
+				p = &b; q = &a;
+				sp = sb; sq = sa;
+			}
+			int64_t d = p->exponent_m - q->exponent_m;
+			multi_float result(*p);
+			result.sign_m = sp;
+			//|q| < ulp(p)/4 であれば丸めの結果はp
+			if (d > int64_t(digits) + 1) return result;
+			//pを左にdビットずらして整数として加減算する
+			limb_t u[2 * size + 2];
+			size_t dq = size_t(d) / 64, dr = size_t(d) % 64, n = size + dq + 1;
+			for (size_t i = 0; i < dq; ++i) u[i] = 0;
+			if (dr != 0) u[size + dq] = __limb_lshift(u + dq, p->x_m, size, dr);
+			else {
+				for (size_t i = 0; i < size; ++i) u[dq + i] = p->x_m[i];
+				u[size + dq] = 0;
+			}
+			if (sp == sq) __limb_add(u, u, n, q->x_m, size);
+			else __limb_sub(u, u, n, q->x_m, size);
+			result.assign_rounded(u, n, q->exponent_m - int64_t(digits), sp, false);
+			//x - x = +0
+			if (result.kind_m == zero_kind) result.sign_m = false;
+			return result;
+		}
+		static multi_float mul(const multi_float& a, const multi_float& b) {
+			bool neg = (a.sign_m != b.sign_m);
+			if (a.kind_m == nan_kind || b.kind_m == nan_kind) return special(nan_kind, false);
+			if (a.kind_m == infinity_kind || b.kind_m == infinity_kind)
+				return (a.kind_m == zero_kind || b.kind_m == zero_kind) ? special(nan_kind, false) : special(infinity_kind, neg);
+			if (a.kind_m == zero_kind || b.kind_m == zero_kind) return special(zero_kind, neg);
+			limb_t u[2 * size];
+			if (&a == &b) __limb_mul_n(u, a.x_m, a.x_m, size);
+			else __limb_mul(u, a.x_m, size, b.x_m, size);
+			multi_float result;
+			result.assign_rounded(u, 2 * size, a.exponent_m + b.exponent_m - 2 * int64_t(digits), neg, false);
 			return result;
 		}
+		static multi_float div(const multi_float& a, const multi_float& b) {
+			bool neg = (a.sign_m != b.sign_m);
+			if (a.kind_m == nan_kind || b.kind_m == nan_kind) return special(nan_kind, false);
+			if (a.kind_m == infinity_kind) return (b.kind_m == infinity_kind) ? special(nan_kind, false) : special(infinity_kind, neg);
+			if (b.kind_m == infinity_kind) return special(zero_kind, neg);
+			if (b.kind_m == zero_kind) return (a.kind_m == zero_kind) ? special(nan_kind, false) : special(infinity_kind, neg);
+			if (a.kind_m == zero_kind) return special(zero_kind, neg);
+			//(a*2^(64(size + 1)))/bの商は2^(digits + 64)以上となり, 剰余の有無を丸めに加味する
+			limb_t u[2 * size + 1], q[size + 2], r[size];
+			for (size_t i = 0; i <= size; ++i) u[i] = 0;
+			for (size_t i = 0; i < size; ++i) u[size + 1 + i] = a.x_m[i];
+			__limb_divrem(q, r, u, 2 * size + 1, b.x_m, size);
+			bool sticky = false;
+			for (size_t i = 0; i < size; ++i) sticky = sticky || (r[i] != 0);
+			multi_float result;
+			result.assign_rounded(q, size + 2, a.exponent_m - b.exponent_m - 64 * int64_t(size + 1), neg, sticky);
+			return result;
+		}
+		//比較(-1, 0, 1, 順序付けできなければ2)
+		static int compare(const multi_float& a, const multi_float& b) {
+			if (a.kind_m == nan_kind || b.kind_m == nan_kind) return 2;
+			if (a.kind_m == zero_kind && b.kind_m == zero_kind) return 0;
+			if (a.kind_m == zero_kind) return b.sign_m ? 1 : -1;
+			if (b.kind_m == zero_kind) return a.sign_m ? -1 : 1;
+			if (a.sign_m != b.sign_m) return a.sign_m ? -1 : 1;
+			int cmp;
+			if (a.kind_m == infinity_kind || b.kind_m == infinity_kind)
+				cmp = (a.kind_m == b.kind_m) ? 0 : ((a.kind_m == infinity_kind) ? 1 : -1);
+			else cmp = compare_magnitude(a, b);
+			return a.sign_m ? -cmp : cmp;
+		}
+		//整数部の絶対値
+		big_int<> integer_magnitude() const {
+			if (kind_m != finite_kind || exponent_m <= 0) return big_int<>();
+			big_int<> m(x_m, size);
+			if (exponent_m >= int64_t(digits)) return m << size_t(exponent_m - int64_t(digits));
+			return m >> size_t(int64_t(digits) - exponent_m);
+		}
 	public:
-		constexpr multi_float(size_t n) : x_m{ n }, sign_m(false), index_m(0) {}
-		multi_float(const multi_float& n) {
-			this->sign_m = n.sign_m;
-			this->index_m = n.index_m;
-			for (size_t i = 0; i < size_m; ++i) this->x_m[i] = n.x_m[i];
+		multi_float() : x_m{}, exponent_m(0), sign_m(false), kind_m(zero_kind) {}
+		//組み込みの整数からの変換
+		template <class Int, class = enable_if_t<is_integral_v<Int>>>
+		multi_float(Int n) : x_m{}, exponent_m(0), sign_m(false), kind_m(zero_kind) {
+			bool neg = is_signed_v<Int> && (n < Int(0));
+			assign_u64(neg ? uint64_t(0) - uint64_t(n) : uint64_t(n), neg);
 		}
-		template <size_t _N>
-		explicit multi_float(const multi_float<_N>& n) {
-			this->sign_m = n.sign_m;
-			this->index_m = n.index_m;
-			for (size_t i = 0, m = min(this->size_m, n.size_m); i < m; ++i) this->x_m[i] = n.x_m[i];
+		//浮動小数点数からの変換(誤差なく変換される)
+		template <class Float, class = enable_if_t<is_floating_point_v<Float>>, class = void>
+		multi_float(Float x) : x_m{}, exponent_m(0), sign_m(false), kind_m(zero_kind) {
+			assign_double(double(x));
+		}
+		//精度の異なる浮動小数点数からの変換
+		template <size_t M>
+		explicit multi_float(const multi_float<M>& x) : x_m{}, exponent_m(0), sign_m(x.sign_m), kind_m(x.kind_m) {
+			if (x.kind_m == finite_kind) assign_rounded(x.x_m, multi_float<M>::size, x.exponent_m - int64_t(multi_float<M>::digits), x.sign_m, false);
+		}
+		//任意長整数からの変換
+		template <class Allocator>
+		explicit multi_float(const big_int<Allocator>& n) : x_m{}, exponent_m(0), sign_m(false), kind_m(zero_kind) {
+			assign_rounded(n.data(), n.size(), 0, n.sign() < 0, false);
+		}
+		//10進数の文字列からの変換(符号, 小数点, 指数部およびinf, nanを読み取る)
+		explicit multi_float(const char* str) : x_m{}, exponent_m(0), sign_m(false), kind_m(zero_kind) {
+			size_t len = 0;
+			while (str[len] != '\0') ++len;
+			assign_string(str, len);
+		}
+		explicit multi_float(const std::string& str) : x_m{}, exponent_m(0), sign_m(false), kind_m(zero_kind) {
+			assign_string(str.data(), size_t(str.size()));
 		}
 
+		//単項演算子
 		multi_float operator+() const { return *this; }
 		multi_float operator-() const {
 			multi_float temp(*this);
-			temp.sign_m = !temp.sign_m;
+			temp.sign_m = !sign_m;
 			return temp;
 		}
-		multi_float& operator+=(const multi_float& n) {
-			if (this->sign_m) {
-				if (n.sign_m) {
-					//(-n1) + (-n2)=-(n1 + n2)
-					multi_float temp = multi_float_add(n);
-					temp.sign_m = !temp.sign_m;
-					return *this = temp;
-				}
-				else {
-					//(-n1) + n2=-(n1 - n2)
-					multi_float temp = multi_float_sub(n);
-					temp.sign_m = !temp.sign_m;
-					return *this = temp;
-				}
-			}
+		multi_float& operator++() { return *this = add(*this, multi_float(1), false); }
+		multi_float operator++(int) {
+			multi_float temp(*this);
+			++*this;
+			return temp;
+		}
+		multi_float& operator--() { return *this = add(*this, multi_float(1), true); }
+		multi_float operator--(int) {
+			multi_float temp(*this);
+			--*this;
+			return temp;
+		}
+
+		//代入演算
+		multi_float& operator+=(const multi_float& n) { return *this = add(*this, n, false); }
+		multi_float& operator-=(const multi_float& n) { return *this = add(*this, n, true); }
+		multi_float& operator*=(const multi_float& n) { return *this = mul(*this, n); }
+		multi_float& operator/=(const multi_float& n) { return *this = div(*this, n); }
+
+		//符号(-1, 0, 1)
+		int_t sign() const { return (kind_m == zero_kind || kind_m == nan_kind) ? 0 : (sign_m ? -1 : 1); }
+		//|x| = m*2^exponent() (1/2 <= m < 1)
+		int64_t exponent() const { return exponent_m; }
+		bool is_finite() const { return kind_m == zero_kind || kind_m == finite_kind; }
+		bool is_infinity() const { return kind_m == infinity_kind; }
+		bool is_nan() const { return kind_m == nan_kind; }
+
+		//変換
+		//0方向に丸めた整数の2^64を法とした値
+		template <class Int, class = enable_if_t<is_integral_v<Int>>>
+		explicit operator Int() const {
+			if (kind_m != finite_kind || exponent_m > int64_t(digits) + 64) return Int(0);
+			uint64_t u = integer_magnitude()[0];
+			return Int(sign_m ? uint64_t(0) - u : u);
+		}
+		//上位1要素に残りの要素の有無を加味して丸める
+		template <class Float, class = enable_if_t<is_floating_point_v<Float>>, class = void>
+		explicit operator Float() const {
+			double result;
+			if (kind_m == nan_kind) result = bit_cast<double>(0x7FF8000000000000ull);
+			else if (kind_m == infinity_kind || (kind_m == finite_kind && exponent_m > 1100)) result = bit_cast<double>(0x7FF0000000000000ull);
+			else if (kind_m == zero_kind || exponent_m < -1200) result = 0.;
 			else {
-				//n1 + (-n2)=n1 - n2 / n1 + n2
-				return *this = (n.sign_m ? multi_float_sub(n) : multi_float_add(n));
+				limb_t hi = x_m[size - 1], sticky = 0;
+				for (size_t i = 0; i + 1 < size; ++i) sticky |= x_m[i];
+				result = ldexp2(double(hi | (sticky != 0)), int_t(exponent_m - 64));
+			}
+			return Float(sign_m ? -result : result);
+		}
+		//0方向に丸めた整数
+		template <class Allocator>
+		explicit operator big_int<Allocator>() const {
+			big_int<> m = integer_magnitude();
+			return big_int<Allocator>(m.data(), m.size(), sign_m);
+		}
+
+		//10進数の指数表記の文字列(n:有効桁数)
+		std::string to_string(size_t n = digits10) const {
+			std::string s;
+			if (kind_m == nan_kind) return "nan";
+			if (sign_m) s.push_back('-');
+			if (kind_m == infinity_kind) return s + "inf";
+			if (kind_m == zero_kind) return s + "0";
+			if (n == 0) n = 1;
+			big_int<> m(x_m, size), p10 = pow10(n), d;
+			int64_t e2 = exponent_m - int64_t(digits);
+			//10^e10 <= |x| < 10^(e10 + 1)の推定値から補正する
+			double t = double(exponent_m - 1) * 0.30102999566398120;
+			int64_t e10 = int64_t(t);
+			if (double(e10) > t) --e10;
+			for (;;) {
+				//d = round(|x|*10^(n - 1 - e10))
+				d = round_scaled(m, e2, int64_t(n) - 1 - e10, n);
+				if (d >= p10) ++e10;
+				else if (d * big_int<>(10) < p10) --e10;
+				else break;
+			}
+			std::string ds = d.to_string();
+			s.push_back(ds[0]);
+			if (n > 1) {
+				s.push_back('.');
+				s.append(ds, 1, std::string::npos);
 			}
+			s.push_back('e');
+			s.push_back((e10 < 0) ? '-' : '+');
+			s += std::to_string((e10 < 0) ? -e10 : e10);
+			return s;
+		}
+
+		//二項演算
+		friend multi_float operator+(const multi_float& lhs, const multi_float& rhs) { return add(lhs, rhs, false); }
+		friend multi_float operator-(const multi_float& lhs, const multi_float& rhs) { return add(lhs, rhs, true); }
+		friend multi_float operator*(const multi_float& lhs, const multi_float& rhs) { return mul(lhs, rhs); }
+		friend multi_float operator/(const multi_float& lhs, const multi_float& rhs) { return div(lhs, rhs); }
+
+		//比較演算(NaNとの比較は!=のみ真)
+		friend bool operator==(const multi_float& lhs, const multi_float& rhs) { return compare(lhs, rhs) == 0; }
+		friend bool operator!=(const multi_float& lhs, const multi_float& rhs) { return compare(lhs, rhs) != 0; }
+		friend bool operator<(const multi_float& lhs, const multi_float& rhs) { return compare(lhs, rhs) == -1; }
+		friend bool operator>(const multi_float& lhs, const multi_float& rhs) { return compare(lhs, rhs) == 1; }
+		friend bool operator<=(const multi_float& lhs, const multi_float& rhs) {
+			int cmp = compare(lhs, rhs);
+			return cmp == -1 || cmp == 0;
+		}
+		friend bool operator>=(const multi_float& lhs, const multi_float& rhs) {
+			int cmp = compare(lhs, rhs);
+			return cmp == 1 || cmp == 0;
+		}
+
+		//ストリーム出力
+		friend std::ostream& operator<<(std::ostream& os, const multi_float& n) {
+			return os << n.to_string();
+		}
+		friend std::wostream& operator<<(std::wostream& os, const multi_float& n) {
+			std::string s = n.to_string();
+			return os << std::wstring(s.begin(), s.end());
 		}
-		multi_float& operator-=(const multi_float& n) {
-			if (this->sign_m) {
-				if (n.sign_m) {
-					//(-n1) - (-n2)=-(n1 - n2)
-					multi_float temp = multi_float_sub(n);
-					temp.sign_m = !temp.sign_m;
-					return *this = temp;
+	};
+
+
+	//多倍長浮動小数点数の判定
+	template <class T>
+	struct is_multi_float : false_type {};
+	template <size_t N>
+	struct is_multi_float<multi_float<N>> : true_type {};
+	template <class T>
+	constexpr bool is_multi_float_v = is_multi_float<T>::value;
+
+
+	template <size_t N>
+	struct numeric_traits<multi_float<N>> {
+		using type = multi_float<N>;
+		using int_type = int64_t;
+
+		static constexpr int_type digits = int_type(type::digits);
+		static constexpr int_type digits10 = int_type(type::digits10);
+
+		static type(min)() { return -(max)(); }
+		static type(max)() {
+			type result;
+			result.kind_m = type::finite_kind;
+			result.exponent_m = type::max_exponent;
+			for (size_t i = 0; i < type::size; ++i) result.x_m[i] = ~limb_t(0);
+			return result;
+		}
+		static type norm() {
+			type result;
+			result.kind_m = type::finite_kind;
+			result.exponent_m = type::min_exponent;
+			result.x_m[type::size - 1] = limb_t(1) << 63;
+			return result;
+		}
+		static type positive_infinity() { return type::special(type::infinity_kind, false); }
+		static type negative_infinity() { return type::special(type::infinity_kind, true); }
+		static type nan() { return type::special(type::nan_kind, false); }
+		static type epsilon() {
+			type result(1);
+			result.exponent_m += 1 - digits;
+			return result;
+		}
+
+		static bool is_positive_infinity(const type& x) { return x.is_infinity() && x.sign() > 0; }
+		static bool is_negative_infinity(const type& x) { return x.is_infinity() && x.sign() < 0; }
+		static bool is_nan(const type& x) { return x.is_nan(); }
+	};
+
+	template <size_t N>
+	struct math_function_type<multi_float<N>> {
+		using type = multi_float<N>;
+	};
+
+	template <size_t M, size_t N>
+	struct is_inclusion<multi_float<M>, multi_float<N>> : cat_bool<multi_float<M>::digits <= multi_float<N>::digits> {};
+	//組み込みの数値型は誤差なく変換される
+	template <class T, size_t N>
+	struct is_inclusion<T, multi_float<N>> : cat_bool<is_integral_v<T> || is_floating_point_v<T>> {};
+
+	template <size_t N>
+	struct Error_evaluation<multi_float<N>> {
+		static multi_float<N> epsilon() { return numeric_traits<multi_float<N>>::epsilon() * 10; }
+		static bool _error_evaluation_(const multi_float<N>& x1, const multi_float<N>& x2) {
+			return (x2 == 0) ? (abs(x1 - x2) < epsilon()) : (abs((x1 - x2) / x2) < epsilon());
+		}
+	};
+
+	template <size_t N>
+	struct Abs<multi_float<N>> {
+		static multi_float<N> _abs_(const multi_float<N>& x) { return (x.sign() < 0) ? -x : x; }
+	};
+	template <size_t N>
+	struct Sgn<multi_float<N>> {
+		static int_t _sgn_(const multi_float<N>& x) { return x.sign(); }
+	};
+
+
+	//多倍長浮動小数点数の関数の実装
+	//初等関数は誤差の上界を見込んだ固定小数点数で計算し, 丸めの境界に近ければ精度を上げて再計算することで正しく丸める
+	//特殊関数は64ビットの保護桁を持つ型で計算して丸める
+	template <size_t N>
+	struct Multi_float_kernel {
+		using type = multi_float<N>;
+		using guard_type = multi_float<type::digits + 64>;
+
+		static constexpr size_t digits = type::digits;
+		static constexpr size_t error_bits = 16;				//固定小数点数での計算誤差の上界(最下位ビット単位の2の冪)
+
+		//|x|*2^precの整数部(符号はxと同じ)
+		static big_int<> _fixed_(const type& x, size_t prec) {
+			if (x.kind_m != type::finite_kind) return big_int<>();
+			big_int<> v(x.x_m, type::size);
+			int64_t s = x.exponent_m - int64_t(digits) + int64_t(prec);
+			if (s >= 0) v <<= size_t(s);
+			else if (-s > int64_t(digits)) return big_int<>();
+			else v >>= size_t(-s);
+			return x.sign_m ? -v : v;
+		}
+		//v*2^e
+		static type _make_(const big_int<>& v, int64_t e) {
+			type result;
+			result.assign_rounded(v.data(), v.size(), e, v.sign() < 0, false);
+			return result;
+		}
+		//v*2^e (vの誤差は2^error未満)が丸めの境界から十分に離れていればrに代入して真を返す
+		static bool _round_(type& r, const big_int<>& v, int64_t e, bool force, size_t error = error_bits) {
+			size_t n = v.bit_width();
+			if (!force) {
+				if (n < digits + error + 4) return false;
+				//切り捨てられるビットの半分の位置を法とした値が境界から離れていること
+				size_t h = n - digits - 1;
+				big_int<> a = abs(v), t = a - ((a >> h) << h);
+				if (t.bit_width() <= error + 1 || ((big_int<>(1) << h) - t).bit_width() <= error + 1) return false;
+			}
+			r.assign_rounded(v.data(), v.size(), e, v.sign() < 0, false);
+			return true;
+		}
+		//再計算での保護桁(相殺により有効桁が不足していればその分も加える)
+		static size_t _next_guard_(size_t guard, const big_int<>& v) {
+			size_t n = v.bit_width();
+			return 2 * guard + ((n < digits + 64) ? digits + 64 - n : 0);
+		}
+		static bool _force_(size_t guard) { return guard > 64 * digits; }
+
+		//整数の判定
+		static bool _is_integer_(const type& x) {
+			if (x.kind_m == type::zero_kind) return true;
+			if (x.kind_m != type::finite_kind || x.exponent_m <= 0) return false;
+			if (x.exponent_m >= int64_t(digits)) return true;
+			size_t s = digits - size_t(x.exponent_m), q = s / 64, r = s % 64;
+			for (size_t i = 0; i < q; ++i) if (x.x_m[i] != 0) return false;
+			return r == 0 || (x.x_m[q] << (64 - r)) == 0;
+		}
+
+		//定数(64ビットの保護桁を持つ固定小数点数から丸める)
+		template <class Constant>
+		static const type& _constant_() {
+			static const type result = _make_(math_constant_fixed<Constant>(digits + 64), -int64_t(digits + 64));
+			return result;
+		}
+		static const type& _pi_() { return _constant_<Pi_constant>(); }
+		static const type& _ln2_() { return _constant_<Ln2_constant>(); }
+
+		//平方根(仮数部を2digits + 4ビット以上の整数に広げて整数の平方根をとる)
+		static type _sqrt_(const type& x) {
+			if (x.kind_m == type::zero_kind || x.kind_m == type::nan_kind) return x;
+			if (x.sign_m) return type::special(type::nan_kind, false);
+			if (x.kind_m == type::infinity_kind) return x;
+			//x = m*2^t = (m*2^s)*2^(t - s) (t - sは偶数)
+			int64_t t = x.exponent_m - int64_t(digits), s = int64_t(digits) + 4 + ((t - int64_t(digits) - 4) & 1);
+			big_int<> y = big_int<>(x.x_m, type::size) << size_t(s), r = isqrt(y);
+			type result;
+			result.assign_rounded(r.data(), r.size(), (t - s) / 2, false, r * r != y);
+			return result;
+		}
+
+		//exp(x/2^prec) = E*2^(k - prec) (1/√2 <= E/2^prec <= √2)
+		static big_int<> _exp_reduce_(const big_int<>& x, size_t prec, int64_t& k) {
+			size_t bx = x.bit_width(), bk = (bx > prec) ? bx - prec + 1 : 0;
+			big_int<> l = math_constant_fixed<Ln2_constant>(prec + bk), y = x << bk, q = (abs(y) + (l >> 1)) / l;
+			k = int64_t(q);
+			if (x.sign() < 0) {
+				q = -q;
+				k = -k;
+			}
+			return __multi_float_exp_fixed((y - q * l) >> bk, prec);
+		}
+		static type _exp_(const type& x) {
+			if (x.kind_m == type::nan_kind) return x;
+			if (x.kind_m == type::infinity_kind) return x.sign_m ? type() : x;
+			//exp(x) = 1 + x + ... (|x| < 2^-(digits + 2)ならば1に丸められる)
+			if (x.kind_m == type::zero_kind || x.exponent_m < -int64_t(digits) - 2) return type(1);
+			if (x.exponent_m > 62) return x.sign_m ? type() : type::special(type::infinity_kind, false);
+			for (size_t guard = 64;;) {
+				size_t prec = digits + guard;
+				int64_t k;
+				big_int<> v = _exp_reduce_(_fixed_(x, prec), prec, k);
+				type result;
+				if (k > type::max_exponent + 1) return type::special(type::infinity_kind, false);
+				if (k < type::min_exponent - 1) return type();
+				if (_round_(result, v, k - int64_t(prec), _force_(guard))) return result;
+				guard = _next_guard_(guard, v);
+			}
+		}
+		//exp(x) - 1
+		static type _expm1_(const type& x) {
+			if (x.kind_m == type::nan_kind || x.kind_m == type::zero_kind) return x;
+			if (x.kind_m == type::infinity_kind) return x.sign_m ? type(-1) : x;
+			//expm1(x) = x + x^2/2 + ...
+			if (x.exponent_m < -int64_t(digits) - 2) return x;
+			if (x.exponent_m > 62) return x.sign_m ? type(-1) : type::special(type::infinity_kind, false);
+			for (size_t guard = 64;;) {
+				size_t prec = digits + guard;
+				int64_t k;
+				big_int<> v = _exp_reduce_(_fixed_(x, prec), prec, k);
+				if (k > type::max_exponent + 1) return type::special(type::infinity_kind, false);
+				//k < -prec - 2ならばexp(x) < 2^-(prec + 1)
+				if (k < -int64_t(prec) - 2) v = big_int<>();
+				else if (k >= 0) v <<= size_t(k);
+				else v >>= size_t(-k);
+				v -= big_int<>(1) << prec;
+				type result;
+				if (_round_(result, v, -int64_t(prec), _force_(guard))) return result;
+				guard = _next_guard_(guard, v);
+			}
+		}
+		static type _log_(const type& x) {
+			if (x.kind_m == type::nan_kind) return x;
+			if (x.kind_m == type::zero_kind) return type::special(type::infinity_kind, true);
+			if (x.sign_m) return type::special(type::nan_kind, false);
+			if (x.kind_m == type::infinity_kind) return x;
+			//x = m*2^e (1/√2 <= m < √2)
+			bool low = x.x_m[type::size - 1] < 0xB504F333F9DE6484ull;
+			int64_t e = x.exponent_m - (low ? 1 : 0);
+			if (e == 0 && x == type(1)) return type();
+			size_t be = 0;
+			for (int64_t a = (e < 0) ? -e : e; a != 0; a >>= 1) ++be;
+			for (size_t guard = 64;;) {
+				size_t prec = digits + guard;
+				big_int<> v = __multi_float_log_fixed(big_int<>(x.x_m, type::size) << (prec - digits + (low ? 1 : 0)), prec);
+				if (e != 0) v += (big_int<>(e) * math_constant_fixed<Ln2_constant>(prec + be)) >> be;
+				type result;
+				if (_round_(result, v, -int64_t(prec), _force_(guard))) return result;
+				guard = _next_guard_(guard, v);
+			}
+		}
+
+		//|x| = kπ/2 + r (|r| <= π/4)としてcos(r)*2^prec, sin(r)*2^precとkの下位2ビットを求める
+		static size_t _sincos_(const type& x, size_t prec, big_int<>& c, big_int<>& s) {
+			size_t bx = (x.exponent_m > 0) ? size_t(x.exponent_m) : 0;
+			big_int<> ax = abs(_fixed_(x, prec + bx)), h = math_constant_fixed<Pi_constant>(prec + bx - 1);
+			big_int<> k = (ax + (h >> 1)) / h;
+			__multi_float_sincos_fixed((ax - k * h) >> bx, prec, c, s);
+			return size_t(k[0] & 3);
+		}
+		//sin(x)とcos(x)の計算(is_sinで選択する)
+		static type _sin_cos_(const type& x, bool is_sin) {
+			if (x.kind_m == type::nan_kind) return x;
+			if (x.kind_m == type::infinity_kind) return type::special(type::nan_kind, false);
+			//sin(x) = x - x^3/6 + ..., cos(x) = 1 - x^2/2 + ...
+			if (x.kind_m == type::zero_kind || x.exponent_m < -int64_t(digits / 2) - 2) return is_sin ? x : type(1);
+			for (size_t guard = 64;;) {
+				size_t prec = digits + guard;
+				big_int<> c, s;
+				size_t q = _sincos_(x, prec, c, s);
+				//sin: (s, c, -s, -c), cos: (c, -s, -c, s)
+				if (!is_sin) ++q;
+				big_int<> v = ((q & 1) != 0) ? c : s;
+				if ((q & 2) != 0) v = -v;
+				if (is_sin && x.sign_m) v = -v;
+				type result;
+				if (_round_(result, v, -int64_t(prec), _force_(guard))) return result;
+				guard = _next_guard_(guard, v);
+			}
+		}
+		static type _sin_(const type& x) { return _sin_cos_(x, true); }
+		static type _cos_(const type& x) { return _sin_cos_(x, false); }
+		//sin(πx) (r = x - round(x)を誤差なく求めてsin(πr)とするため, 整数の近傍でも相対精度を保つ)
+		static type _sin_pi_(const type& x) {
+			if (x.kind_m != type::finite_kind) return _sin_(x);
+			if (_is_integer_(x)) return type();
+			type a = abs(x);
+			big_int<> k = (_fixed_(a, 1) + big_int<>(1)) >> 1;
+			type result = _sin_(_pi_() * (a - type(k)));
+			return ((k[0] & 1) != x.sign_m) ? -result : result;
+		}
+		static type _tan_(const type& x) {
+			if (x.kind_m == type::nan_kind) return x;
+			if (x.kind_m == type::infinity_kind) return type::special(type::nan_kind, false);
+			//tan(x) = x + x^3/3 + ...
+			if (x.kind_m == type::zero_kind || x.exponent_m < -int64_t(digits / 2) - 2) return x;
+			for (size_t guard = 64;;) {
+				size_t prec = digits + guard;
+				big_int<> c, s;
+				size_t q = _sincos_(x, prec, c, s);
+				//tan: (s/c, -c/s)
+				big_int<> v = ((q & 1) != 0) ? -(c << prec) / s : (s << prec) / c;
+				if (x.sign_m) v = -v;
+				type result;
+				if (_round_(result, v, -int64_t(prec), _force_(guard))) return result;
+				guard = _next_guard_(guard, v);
+			}
+		}
+
+		//Stirlingの級数の係数 B[2k]/(2k(2k - 1)) = (-1)^(k - 1) T[k]/((2k - 1)4^k(4^k - 1)) (T[k]:正接数)
+		//x >= digits/2ではdigits/8 + 16項で十分に収束する
+		static std::vector<type> _stirling_coefficients_() {
+			size_t n = digits / 8 + 16;
+			std::vector<big_int<>> t(n + 1);
+			__tangent_numbers(t.data(), n, big_int<>(1));
+			std::vector<type> c(n + 1);
+			for (size_t k = 1; k <= n; ++k) {
+				big_int<> p = big_int<>(1) << (2 * k);
+				c[k] = _make_(t[k], -int64_t(2 * k)) / type((p - big_int<>(1)) * big_int<>(2 * k - 1));
+				if ((k & 1) == 0) c[k] = -c[k];
+			}
+			return c;
+		}
+		//Eulerの定数γ = -ψ(1) (z = digits/2 でのStirlingの級数 ψ(z) = log(z) - 1/(2z) - Σ B[2k]/(2k z^(2k)) から ψ(1) = ψ(z) - Σ[j < z] 1/j)
+		static type _euler_gamma_() {
+			const std::vector<type> c = _stirling_coefficients_();
+			type z = type(digits / 2), w = 1 / z, w2 = w * w, p = w2, sum = 0;
+			for (size_t k = 1; k < c.size(); ++k) {
+				type term = c[k] * type(2 * k - 1) * p;
+				if (term.kind_m == type::zero_kind || (sum.kind_m != type::zero_kind && term.exponent_m < sum.exponent_m - int64_t(digits) - 2)) break;
+				sum += term;
+				p *= w2;
+			}
+			type h = 0;
+			for (size_t j = digits / 2 - 1; j > 0; --j) h += 1 / type(j);
+			return h - _log_(z) + w / 2 + sum;
+		}
+		//lgamma(1 + ε) = -γε + Σ[k >= 2] (-1)^k ζ(k)ε^k/k の係数(center = 2ではlgamma(2 + ε) = (1 - γ)ε + Σ[k >= 2] (-1)^k (ζ(k) - 1)ε^k/k)
+		//|ε| <= 1/8でdigits/3 + 8項あれば十分に収束する
+		static std::vector<type> _lgamma_taylor_coefficients_(size_t center) {
+			size_t n = digits / 3 + 8;
+			std::vector<type> c(n + 1);
+			type g = _euler_gamma_();
+			c[1] = (center == 1) ? -g : 1 - g;
+			for (size_t k = 2; k <= n; ++k) {
+				type z = _riemann_zeta_impl_(type(k));
+				if (center == 2) z -= 1;
+				c[k] = z / type(k);
+				if (k & 1) c[k] = -c[k];
+			}
+			return c;
+		}
+		//lgamma(center + ε) (center = 1, 2, |ε| <= 1/8)
+		static type _lgamma_taylor_(const std::vector<type>& c, const type& e) {
+			type p = e, sum = 0;
+			for (size_t k = 1; k < c.size(); ++k) {
+				type term = c[k] * p;
+				if (term.kind_m == type::zero_kind || (sum.kind_m != type::zero_kind && term.exponent_m < sum.exponent_m - int64_t(digits) - 2)) break;
+				sum += term;
+				p *= e;
+			}
+			return sum;
+		}
+		static type _lgamma_impl_(const type& x) {
+			if (x.kind_m == type::nan_kind) return x;
+			if (x.kind_m == type::infinity_kind || (x <= 0 && _is_integer_(x))) return type::special(type::infinity_kind, false);
+			//相反公式 lgamma(x) = log(π/|sin(πx)|) - lgamma(1 - x)
+			if (x < 0.5) return _log_(_pi_() / abs(_sin_pi_(x))) - _lgamma_impl_(1 - x);
+			if (x == 1 || x == 2) return type();
+			//零点1, 2の近傍ではStirlingの級数の相殺を避けてTaylor展開を用いる(ε = x - 1, x - 2は誤差なく求まる)
+			if (abs(x - 1) <= 0.125) {
+				static const std::vector<type> c1 = _lgamma_taylor_coefficients_(1);
+				return _lgamma_taylor_(c1, x - 1);
+			}
+			if (abs(x - 2) <= 0.125) {
+				static const std::vector<type> c2 = _lgamma_taylor_coefficients_(2);
+				return _lgamma_taylor_(c2, x - 2);
+			}
+			//z = x + n >= digits/2 としてStirlingの級数 (z - 1/2)log(z) - z + log(2π)/2 + Σ B[2k]/(2k(2k - 1)z^(2k - 1))
+			static const std::vector<type> c = _stirling_coefficients_();
+			static const type log_const = _log_(2 * _pi_()) / 2;
+			type z = x, p = 1;
+			while (z < type(digits / 2)) {
+				p *= z;
+				++z;
+			}
+			type w = 1 / z, w2 = w * w, sum = 0;
+			for (size_t k = 1; k < c.size(); ++k) {
+				type term = c[k] * w;
+				if (term.kind_m == type::zero_kind || (sum.kind_m != type::zero_kind && term.exponent_m < sum.exponent_m - int64_t(digits) - 2)) break;
+				sum += term;
+				w *= w2;
+			}
+			return (z - 0.5) * _log_(z) - z + log_const + sum - _log_(p);
+		}
+		static type _gamma_impl_(const type& x) {
+			if (x.kind_m == type::nan_kind) return x;
+			if (x.kind_m == type::infinity_kind) return x.sign_m ? type::special(type::nan_kind, false) : x;
+			if (_is_integer_(x)) {
+				if (x <= 0) return type::special(type::nan_kind, false);
+				//(x - 1)!を誤差なく求める
+				if (x.exponent_m <= 16) {
+					big_int<> f(1);
+					for (size_t i = 2, n = size_t(x); i < n; ++i) f *= big_int<>(i);
+					return type(f);
 				}
-				else {
-					//(-n1) - n2=-(n1 + n2)
-					multi_float temp = multi_float_add(n);
-					temp.sign_m = !temp.sign_m;
-					return *this = temp;
+			}
+			//相反公式 Γ(x) = π/(sin(πx)Γ(1 - x))
+			if (x < 0.5) return _pi_() / (_sin_pi_(x) * _exp_(_lgamma_impl_(1 - x)));
+			return _exp_(_lgamma_impl_(x));
+		}
+		//相反公式の零点の近傍ではlog(π/|sin(πx)|)とlgamma(1 - x)が相殺するため, 失われた桁の分だけ精度を倍にして再計算する
+		//(保護桁はG = 4(digits + 64)で打ち切り, 相殺は約3digitsビットまで補える)
+		template <size_t G>
+		static type _lgamma_reflection_(const type& x) {
+			using kernel = Multi_float_kernel<G>;
+			using wide = multi_float<G>;
+			wide wx(x), a = kernel::_log_(kernel::_pi_() / abs(kernel::_sin_pi_(wx))), b = kernel::_lgamma_impl_(1 - wx), r = a - b;
+			if constexpr (G < 4 * (digits + 64)) {
+				int64_t lost = (r.kind_m == wide::zero_kind) ? int64_t(G) : ((a.exponent_m > b.exponent_m) ? a.exponent_m : b.exponent_m) - r.exponent_m;
+				if (lost + int64_t(digits) + 48 > int64_t(G)) return _lgamma_reflection_<2 * G>(x);
+			}
+			return type(r);
+		}
+		static type _lgamma_(const type& x) {
+			if (x.kind_m == type::finite_kind && x < 0.5 && !_is_integer_(x)) return _lgamma_reflection_<guard_type::digits>(x);
+			return type(Multi_float_kernel<guard_type::digits>::_lgamma_impl_(guard_type(x)));
+		}
+		static type _gamma_(const type& x) {
+			//階乗は正しく丸める
+			if (x.kind_m == type::finite_kind && x.exponent_m <= 16 && x > 0 && _is_integer_(x)) {
+				big_int<> f(1);
+				for (size_t i = 2, n = size_t(x); i < n; ++i) f *= big_int<>(i);
+				return type(f);
+			}
+			return type(Multi_float_kernel<guard_type::digits>::_gamma_impl_(guard_type(x)));
+		}
+
+		//erf(x)/x*2^prec (x > 0, 2x^2 < 2^62)
+		//erf(x) = 2x/√π e^(-x^2) Σ (2x^2)^k/(2k + 1)!! の各項を漸化式で求める
+		//(xは仮数部の全桁を持つため二分割法では積の桁数が項数に比例して膨らむ)
+		static big_int<> _erf_fixed_(const type& x, size_t prec) {
+			big_int<> m(x.x_m, type::size), m2 = m * m;
+			int64_t e = x.exponent_m - int64_t(digits);
+			//2x^2 = m^2/2^(-2e - 1) (各項の切り捨て誤差を16ビットの保護桁で吸収する)
+			size_t sh = size_t(-2 * e - 1);
+			big_int<> t = big_int<>(1) << (prec + 16), s = t;
+			for (size_t i = 1; t.sign() != 0; ++i) {
+				t = ((t * m2) >> sh) / big_int<>(2 * i + 1);
+				s += t;
+			}
+			s >>= 16;
+			//e^(-x^2) = E*2^(k - prec)
+			big_int<> x2 = (2 * e + int64_t(prec) >= 0) ? m2 << size_t(2 * e + int64_t(prec)) : m2 >> size_t(-2 * e - int64_t(prec));
+			int64_t k;
+			big_int<> ex = _exp_reduce_(-x2, prec, k);
+			//√π*2^prec
+			big_int<> sp = isqrt(math_constant_fixed<Pi_constant>(prec) << prec);
+			big_int<> v = (ex * s) << 1;
+			if (k >= 0) v <<= size_t(k);
+			else v >>= size_t(-k);
+			return v / sp;
+		}
+		static type _erf_(const type& x) {
+			if (x.kind_m == type::nan_kind || x.kind_m == type::zero_kind) return x;
+			//erfc(|x|) < e^(-x^2) < 2^-(digits + 8)ならば±1に丸められる
+			double d = double(abs(x));
+			if (x.kind_m == type::infinity_kind || d * d * 1.4426950408889634 > double(digits + 8)) return type(x.sign_m ? -1 : 1);
+			int64_t e = x.exponent_m - int64_t(digits);
+			for (size_t guard = 64;;) {
+				size_t prec = digits + guard;
+				big_int<> v = _erf_fixed_(x, prec) * big_int<>(x.x_m, type::size);
+				if (x.sign_m) v = -v;
+				type result;
+				//vは誤差2^error_bits未満の固定小数点数に仮数部の整数を掛けたものであるため誤差はdigitsビット大きい
+				if (_round_(result, v, e - int64_t(prec), _force_(guard), error_bits + digits)) return result;
+				guard = _next_guard_(guard, v);
+			}
+		}
+		static type _erfc_(const type& x) {
+			if (x.kind_m == type::nan_kind) return x;
+			if (x.kind_m == type::zero_kind) return type(1);
+			if (x.kind_m == type::infinity_kind) return type(x.sign_m ? 2 : 0);
+			double d = double(abs(x)), d2 = d * d * 1.4426950408889634;
+			if (x.sign_m && d2 > double(digits + 8)) return type(2);
+			//erfc(x)が2^-(digits + 64)を下回るときは漸近展開 erfc(x) = e^(-x^2)/(x√π) Σ (-1)^n (2n - 1)!!/(2x^2)^n
+			if (!x.sign_m && d2 > double(digits + 64)) {
+				using kernel = Multi_float_kernel<guard_type::digits>;
+				guard_type gx(x), w = 1 / (2 * gx * gx), t = 1, sum = 1;
+				for (size_t n = 1;; ++n) {
+					guard_type t2 = t * w * guard_type(2 * n - 1);
+					if (abs(t2) >= abs(t) || t2.exponent() < sum.exponent() - int64_t(guard_type::digits) - 2) break;
+					t = -t2;
+					sum += t;
 				}
+				//e^(-x^2)は2乗を誤差なく固定小数点数で表して求める
+				size_t prec = guard_type::digits;
+				big_int<> m(x.x_m, type::size);
+				int64_t e = x.exponent_m - int64_t(digits), k, sh = 2 * e + int64_t(prec);
+				big_int<> x2 = (sh >= 0) ? (m * m) << size_t(sh) : (m * m) >> size_t(-sh);
+				big_int<> ex = _exp_reduce_(-x2, prec, k);
+				if (k < type::min_exponent - 1) return type();
+				return type(kernel::_make_(ex, k - int64_t(prec)) * sum / (gx * kernel::_sqrt_(kernel::_pi_())));
 			}
-			else {
-				//n1 - (-n2)=n1 + n2 / n1 - n2
-				return *this = (n.sign_m ? multi_float_add(n) : multi_float_sub(n));
+			//1 - erf(x)の相殺で失われる桁(約x^2/log2)を精度に加える
+			int64_t e = x.exponent_m - int64_t(digits);
+			for (size_t guard = 64 + size_t(d2 * 1.01) + 8;;) {
+				size_t prec = digits + guard;
+				big_int<> f = _erf_fixed_(x, prec) * big_int<>(x.x_m, type::size);
+				f = (e >= 0) ? f << size_t(e) : f >> size_t(-e);
+				big_int<> v = (big_int<>(1) << prec) + (x.sign_m ? f : -f);
+				type result;
+				if (_round_(result, v, -int64_t(prec), _force_(guard))) return result;
+				guard = _next_guard_(guard, v);
 			}
 		}
-		multi_float& operator*=(const multi_float& n) {
-			multi_float result;
-			result.index_m = this->index_m + n.index_m;
+
+		//Borweinの加速級数 η(s) = Σ[k < n] c[k]/(k + 1)^s の係数 c[k] = (-1)^k (d[n] - d[k])/d[n]
+		//d[k] = Σ[i <= k] a[i] (a[i] = n(n + i - 1)!4^i/((n - i)!(2i)!)は整数)を誤差なく求める
+		static std::vector<type> _eta_coefficients_() {
+			size_t n = borwein_terms(digits);
+			std::vector<big_int<>> d(n + 1);
+			big_int<> a(1), total;
+			for (size_t i = 0; i <= n; ++i) {
+				total += a;
+				d[i] = total;
+				a = a * big_int<>(uint64_t(4) * (n + i) * (n - i)) / big_int<>(uint64_t(2 * i + 1) * (2 * i + 2));
+			}
+			std::vector<type> c(n);
+			type dn(d[n]);
+			for (size_t k = 0; k < n; ++k) {
+				c[k] = type(d[n] - d[k]) / dn;
+				if (k & 1) c[k] = -c[k];
+			}
+			return c;
 		}
-		multi_float& operator=(const multi_float& n) {
-			for (size_t i = 0; i < size_m; ++i) this->x_m[i] = n.x_m[i];
-			this->index_m = n.index_m;
-			this->sign_m = n.sign_m;
+		static type _dirichlet_eta_impl_(const type& s) {
+			if (s.kind_m == type::nan_kind) return s;
+			if (s.kind_m == type::infinity_kind) return s.sign_m ? type::special(type::nan_kind, false) : type(1);
+			//η(s) = (1 - 2^(1 - s))ζ(s)
+			if (s < -0.5) return -_expm1_((1 - s) * _ln2_()) * _riemann_zeta_impl_(s);
+			static const std::vector<type> c = _eta_coefficients_();
+			size_t n = c.size();
+			//f[k] = k^-sは完全乗法的であるため素数についてのみ計算する
+			std::vector<size_t> spf(n + 1, 0);
+			std::vector<type> f(n + 1);
+			bool integer = _is_integer_(s) && s.exponent_m <= 31;
+			int64_t si = integer ? int64_t(s) : 0;
+			f[1] = 1;
+			for (size_t k = 2; k <= n; ++k) {
+				if (spf[k] == 0) {
+					for (size_t j = k; j <= n; j += k) if (spf[j] == 0) spf[j] = k;
+					if (integer) {
+						type p = 1, b = type(k);
+						for (uint64_t e = uint64_t((si < 0) ? -si : si); e != 0; e >>= 1) {
+							if (e & 1) p *= b;
+							if (e > 1) b *= b;
+						}
+						f[k] = (si < 0) ? p : 1 / p;
+					}
+					else f[k] = _exp_(-s * _log_(type(k)));
+				}
+				else f[k] = f[spf[k]] * f[k / spf[k]];
+			}
+			//小さい項から加算
+			type result = 0;
+			for (size_t k = n; k-- > 0;) result += c[k] * f[k + 1];
+			return result;
 		}
+		static type _riemann_zeta_impl_(const type& s) {
+			if (s.kind_m == type::nan_kind) return s;
+			if (s.kind_m == type::infinity_kind) return s.sign_m ? type::special(type::nan_kind, false) : type(1);
+			if (s == 1) return type::special(type::infinity_kind, false);
+			if (s.kind_m == type::zero_kind) return type(-0.5);
+			//関数等式 ζ(s) = 2^s π^(s - 1) sin(πs/2)Γ(1 - s)ζ(1 - s) (負の偶数では0)
+			if (s < -0.5) {
+				type h = s / 2;
+				if (_is_integer_(h)) return type();
+				return _exp_(s * _ln2_() + (s - 1) * _log_(_pi_()) + _lgamma_impl_(1 - s)) * _sin_pi_(h) * _riemann_zeta_impl_(1 - s);
+			}
+			//ζ(s) = η(s)/(1 - 2^(1 - s)) (s = 1の近傍での相殺をexpm1で避ける)
+			return _dirichlet_eta_impl_(s) / -_expm1_((1 - s) * _ln2_());
+		}
+		static type _dirichlet_eta_(const type& s) { return type(Multi_float_kernel<guard_type::digits>::_dirichlet_eta_impl_(guard_type(s))); }
+		static type _riemann_zeta_(const type& s) { return type(Multi_float_kernel<guard_type::digits>::_riemann_zeta_impl_(guard_type(s))); }
+	};
+
+
+	template <size_t N>
+	struct Sqrt<multi_float<N>> {
+		using result_type = multi_float<N>;
+
+		static result_type _sqrt_(const multi_float<N>& x) { return Multi_float_kernel<N>::_sqrt_(x); }
+	};
+	template <size_t N>
+	struct Exp<multi_float<N>> {
+		using result_type = multi_float<N>;
+
+		static result_type _exp_(const multi_float<N>& x) { return Multi_float_kernel<N>::_exp_(x); }
+	};
+	template <size_t N>
+	struct Log<multi_float<N>> {
+		using result_type = multi_float<N>;
+
+		static result_type _log_(const multi_float<N>& x) { return Multi_float_kernel<N>::_log_(x); }
+	};
+	template <size_t N>
+	struct Sin<multi_float<N>> {
+		using result_type = multi_float<N>;
+
+		static result_type _sin_(const multi_float<N>& x) { return Multi_float_kernel<N>::_sin_(x); }
+	};
+	template <size_t N>
+	struct Cos<multi_float<N>> {
+		using result_type = multi_float<N>;
+
+		static result_type _cos_(const multi_float<N>& x) { return Multi_float_kernel<N>::_cos_(x); }
+	};
+	template <size_t N>
+	struct Tan<multi_float<N>> {
+		using result_type = multi_float<N>;
+
+		static result_type _tan_(const multi_float<N>& x) { return Multi_float_kernel<N>::_tan_(x); }
+	};
+	template <size_t N>
+	struct Lgamma<multi_float<N>> {
+		using result_type = multi_float<N>;
+
+		static result_type _lgamma_(const multi_float<N>& x) { return Multi_float_kernel<N>::_lgamma_(x); }
 	};
+	template <size_t N>
+	struct Gamma<multi_float<N>> {
+		using result_type = multi_float<N>;
+
+		static result_type _gamma_(const multi_float<N>& x) { return Multi_float_kernel<N>::_gamma_(x); }
+	};
+	template <size_t N>
+	struct Erf<multi_float<N>> {
+		using result_type = multi_float<N>;
+
+		static result_type _erf_(const multi_float<N>& x) { return Multi_float_kernel<N>::_erf_(x); }
+	};
+	template <size_t N>
+	struct Erfc<multi_float<N>> {
+		using result_type = multi_float<N>;
 
+		static result_type _erfc_(const multi_float<N>& x) { return Multi_float_kernel<N>::_erfc_(x); }
+	};
+	template <size_t N>
+	struct Dirichlet_eta<multi_float<N>> {
+		using result_type = multi_float<N>;
+
+		static result_type _dirichlet_eta_(const multi_float<N>& x) { return Multi_float_kernel<N>::_dirichlet_eta_(x); }
+	};
+	template <size_t N>
+	struct Riemann_zeta<multi_float<N>> {
+		using result_type = multi_float<N>;
+
+		static result_type _riemann_zeta_(const multi_float<N>& x) { return Multi_float_kernel<N>::_riemann_zeta_(x); }
+	};
+
+
+	//数学定数(実体化された精度ごとにプログラム開始時の動的初期化で二分割法の共有のキャッシュから丸める)
+	//値は_constant_の関数内の静的変数から得るため, 他の静的変数の初期化から参照する場合は_constant_を用いる
+	template <size_t N>
+	const multi_float<N> pi<multi_float<N>> = Multi_float_kernel<N>::template _constant_<Pi_constant>();
+	template <size_t N>
+	const multi_float<N> e<multi_float<N>> = Multi_float_kernel<N>::template _constant_<E_constant>();
+	template <size_t N>
+	const multi_float<N> ln2<multi_float<N>> = Multi_float_kernel<N>::template _constant_<Ln2_constant>();
+	template <size_t N>
+	const multi_float<N> catalan_constant<multi_float<N>> = Multi_float_kernel<N>::template _constant_<Catalan_constant>();
+	template <size_t N>
+	const multi_float<N> apery_constant<multi_float<N>> = Multi_float_kernel<N>::template _constant_<Apery_constant>();
 }
 
 
@@ -2,77 +2,339 @@
 #define _IMATH_MULTI_MULTI_INT_HPP
 
 #include "IMathLib/IMathLib_config.hpp"
-#include "IMathLib/math/math.hpp"
+#include "IMathLib/math/math/numeric_traits.hpp"
+#include "IMathLib/math/math/abs.hpp"
+#include "IMathLib/math/math/sgn.hpp"
+#include "IMathLib/math/multi/limb.hpp"
+#include "IMathLib/utility/type_traits/is_type.hpp"
+#include "IMathLib/utility/type_traits/type_comparison.hpp"
+#include "IMathLib/utility/utility/bit_cast.hpp"
+#include <ostream>
+#include <string>
 
 namespace iml {
 
 	//多倍長整数(N:ビット数)
+	//Nを64の倍数に切り上げたビット数の2の補数表現で符号付き整数を表し, 組み込みの整数型と同様に
+	//除算は0方向へ丸め, 溢れた結果は2^(64*size)を法として折り返す(除数が0の場合は未定義)
 	template <size_t N>
 	class multi_int {
 		template <size_t> friend class multi_int;
+	public:
+		static constexpr size_t size = N / 64 + (N % 64 != 0);		//確保される配列数
+	private:
+		limb_t x_m[size];				//下位から順に格納
 
-		//確保される配列数
-		static constexpr size_t size_m = N / numeric_traits<size_t>::digits + (N % numeric_traits<size_t>::digits != 0);
+		bool is_negative() const { return (x_m[size - 1] >> 63) != 0; }
+		//2の補数をとる
+		void negate() {
+			limb_t c = 1;
+			for (size_t i = 0; i < size; ++i) {
+				x_m[i] = ~x_m[i] + c;
+				c = c && (x_m[i] == 0);
+			}
+		}
+		//絶対値を符号なしとして得る(戻り値は負数であったか)
+		bool magnitude(limb_t* r) const {
+			for (size_t i = 0; i < size; ++i) r[i] = x_m[i];
+			if (!is_negative()) return false;
+			limb_t c = 1;
+			for (size_t i = 0; i < size; ++i) {
+				r[i] = ~r[i] + c;
+				c = c && (r[i] == 0);
+			}
+			return true;
+		}
+		//符号なしの値から構築する(negならば符号を反転する)
+		void assign_magnitude(const limb_t* a, size_t n, bool neg) {
+			for (size_t i = 0; i < size; ++i) x_m[i] = (i < n) ? a[i] : 0;
+			if (neg) negate();
+		}
+		//上位要素の符号拡張
+		void sign_extend(size_t from, bool neg) {
+			for (size_t i = from; i < size; ++i) x_m[i] = neg ? ~limb_t(0) : 0;
+		}
 
-		bool sign_m;					//符号部
-		size_t x_m[size_m];			//仮数部(負数なら補数の状態)
+		//絶対値の除算(q, rの絶対値を得る)
+		static void divrem_magnitude(const multi_int& a, const multi_int& b, limb_t* q, limb_t* r, bool& sa, bool& sb) {
+			limb_t ua[size], ub[size];
+			sa = a.magnitude(ua);
+			sb = b.magnitude(ub);
+			size_t an = __limb_normalized_size(ua, size), bn = __limb_normalized_size(ub, size);
+			for (size_t i = 0; i < size; ++i) q[i] = r[i] = 0;
+			if (an < bn) {
+				for (size_t i = 0; i < an; ++i) r[i] = ua[i];
+				return;
+			}
+			__limb_divrem(q, r, ua, an, ub, bn);
+		}
 
 	public:
-		constexpr multi_int() :x_m{}, sign_m(false) {}
-		multi_int(const multi_int& n) {
-			this->sign_m = n.sign_m;
-			for (size_t i = 0; i < size_m; ++i) this->x_m[i] = n.x_m[i];
+		constexpr multi_int() : x_m{} {}
+		multi_int(const multi_int& n) = default;
+		//組み込みの整数からの変換
+		template <class Int, class = enable_if_t<is_integral_v<Int>>>
+		multi_int(Int n) : x_m{} {
+			x_m[0] = limb_t(n);
+			sign_extend(1, is_signed_v<Int> && (n < Int(0)));
+		}
+		//浮動小数点数からの変換(0方向へ丸める)
+		template <class Float, class = enable_if_t<is_floating_point_v<Float>>, class = void>
+		explicit multi_int(Float x) : x_m{} {
+			uint64_t u = bit_cast<uint64_t>(double(x));
+			int_t e = int_t((u >> 52) & 0x7FF);
+			//|x| < 1, 無限大, NaN
+			if (e < 1023 || e == 0x7FF) return;
+			//x = m * 2^(e - 1075)
+			limb_t m = (u & 0x000FFFFFFFFFFFFFull) | 0x0010000000000000ull;
+			if (e < 1075) x_m[0] = m >> (1075 - e);
+			else {
+				size_t s = size_t(e - 1075), q = s / 64;
+				if (q < size) x_m[q] = m << (s % 64);
+				if (s % 64 > 11 && q + 1 < size) x_m[q + 1] = m >> (64 - s % 64);
+			}
+			if (u >> 63) negate();
 		}
-		template <size_t _N>
-		explicit multi_int(const multi_int<_N>& n) : x_m{} {
-			this->sign_m = n.sign_m;
-			for (size_t i = 1, m = min(this->size_m, n.size_m) + 1; i < m; ++i) this->x_m[this->size_m - i] = n.x_m[n.size_m - i];
+		//異なるビット数からの変換(符号拡張または上位の切り捨て)
+		template <size_t M>
+		explicit multi_int(const multi_int<M>& n) : x_m{} {
+			size_t m = (size < multi_int<M>::size) ? size : multi_int<M>::size;
+			for (size_t i = 0; i < m; ++i) x_m[i] = n.x_m[i];
+			sign_extend(m, n.is_negative());
 		}
 		~multi_int() {}
 
+		multi_int& operator=(const multi_int& n) = default;
+
 		//単項演算子
 		multi_int operator+() const { return *this; }
 		multi_int operator-() const {
 			multi_int temp(*this);
-			temp.sign_m = !temp.sign_m;
+			temp.negate();
 			return temp;
 		}
+		multi_int operator~() const {
+			multi_int temp;
+			for (size_t i = 0; i < size; ++i) temp.x_m[i] = ~x_m[i];
+			return temp;
+		}
+		multi_int& operator++() {
+			__limb_add_1(x_m, x_m, size, 1);
+			return *this;
+		}
+		multi_int operator++(int) {
+			multi_int temp(*this);
+			++*this;
+			return temp;
+		}
+		multi_int& operator--() {
+			__limb_sub_1(x_m, x_m, size, 1);
+			return *this;
+		}
+		multi_int operator--(int) {
+			multi_int temp(*this);
+			--*this;
+			return temp;
+		}
+
 		//代入演算
 		multi_int& operator+=(const multi_int& n) {
-			multi_int result;
-			result.sign_m = this->sign_m^n.sign_m;
-			bool carry_out = false;
-			//キャリーしながら加算
-			for (size_t i = size_m - 1; i != numeric_traits<size_t>::max(); --i) {
-				result.x_m[i] = this->x_m[i] + n.x_m[i] + carry_out;
-				carry_out = (this->x_m[i] > (numeric_traits<size_t>::max() - carry_out))
-					|| (n.x_m[i] > (numeric_traits<size_t>::max() - carry_out))
-					|| (this->x_m[i] > (numeric_traits<size_t>::max() - n.x_m[i]));
-			}
-			result.sign_m ^= carry_out;
-			return result;
+			__limb_add_n(x_m, x_m, n.x_m, size);
+			return *this;
 		}
 		multi_int& operator-=(const multi_int& n) {
-			multi_int result;
-			result.sign_m = this->sign_m ^ (!n.sign_m);
-			bool carry_out = true;
-			//キャリーしながら加算
-			for (size_t i = size_m - 1; i != numeric_traits<size_t>::max(); --i) {
-				result.x_m[i] = this->x_m[i] + numeric_traits<size_t>::max() - n.x_m[i] + carry_out;
-				carry_out = ((this->x_m[i] + carry_out) > n.x_m[i])
-					|| (this->x_m[i] > (n.x_m[i] - carry_out))
-					|| (this->x_m[i] > (n.x_m[i]));
-			}
-			result.sign_m ^= carry_out;
+			__limb_sub_n(x_m, x_m, n.x_m, size);
+			return *this;
 		}
+		//絶対値の積から求める(小さい値同士の積では上位の0の要素を計算しない)
 		multi_int& operator*=(const multi_int& n) {
-			multi_int result;
+			limb_t ua[size], ub[size], r[2 * size];
+			bool neg = this->magnitude(ua) != n.magnitude(ub);
+			size_t an = __limb_normalized_size(ua, size), bn = __limb_normalized_size(ub, size);
+			if (an == 0 || bn == 0) return *this = multi_int();
+			if (an >= bn) __limb_mul(r, ua, an, ub, bn);
+			else __limb_mul(r, ub, bn, ua, an);
+			assign_magnitude(r, (an + bn < size) ? an + bn : size, neg);
+			return *this;
+		}
+		multi_int& operator/=(const multi_int& n) {
+			limb_t q[size], r[size];
+			bool sa, sb;
+			divrem_magnitude(*this, n, q, r, sa, sb);
+			assign_magnitude(q, size, sa != sb);
+			return *this;
+		}
+		multi_int& operator%=(const multi_int& n) {
+			limb_t q[size], r[size];
+			bool sa, sb;
+			divrem_magnitude(*this, n, q, r, sa, sb);
+			assign_magnitude(r, size, sa);
+			return *this;
+		}
+		multi_int& operator&=(const multi_int& n) {
+			for (size_t i = 0; i < size; ++i) x_m[i] &= n.x_m[i];
+			return *this;
+		}
+		multi_int& operator|=(const multi_int& n) {
+			for (size_t i = 0; i < size; ++i) x_m[i] |= n.x_m[i];
+			return *this;
+		}
+		multi_int& operator^=(const multi_int& n) {
+			for (size_t i = 0; i < size; ++i) x_m[i] ^= n.x_m[i];
+			return *this;
+		}
+		multi_int& operator<<=(size_t s) {
+			size_t q = s / 64, r = s % 64;
+			if (q >= size) return *this = multi_int();
+			for (size_t i = size; i-- > q;) x_m[i] = x_m[i - q];
+			for (size_t i = 0; i < q; ++i) x_m[i] = 0;
+			if (r != 0) __limb_lshift(x_m + q, x_m + q, size - q, r);
+			return *this;
 		}
-		multi_int& operator=(const multi_int& n) {
-			for (size_t i = 0; i < size_m; ++i) this->x_m[i] = n.x_m[i];
+		//算術シフト
+		multi_int& operator>>=(size_t s) {
+			bool neg = is_negative();
+			size_t q = s / 64, r = s % 64;
+			if (q >= size) {
+				sign_extend(0, neg);
+				return *this;
+			}
+			for (size_t i = 0; i < size - q; ++i) x_m[i] = x_m[i + q];
+			sign_extend(size - q, neg);
+			if (r != 0) {
+				__limb_rshift(x_m, x_m, size - q, r);
+				if (neg) x_m[size - q - 1] |= ~limb_t(0) << (64 - r);
+			}
+			return *this;
+		}
+
+		//商と剰余を同時に求める
+		static void divrem(const multi_int& a, const multi_int& b, multi_int& q, multi_int& r) {
+			limb_t uq[size], ur[size];
+			bool sa, sb;
+			divrem_magnitude(a, b, uq, ur, sa, sb);
+			q.assign_magnitude(uq, size, sa != sb);
+			r.assign_magnitude(ur, size, sa);
+		}
+
+		//符号(-1, 0, 1)
+		int_t sign() const {
+			if (is_negative()) return -1;
+			return (__limb_normalized_size(x_m, size) == 0) ? 0 : 1;
+		}
+		//2進数での桁数(絶対値)
+		size_t bit_width() const {
+			limb_t u[size];
+			magnitude(u);
+			size_t n = __limb_normalized_size(u, size);
+			return (n == 0) ? 0 : 64 * n - __limb_clz(u[n - 1]);
+		}
+		//要素へのアクセス
+		limb_t operator[](size_t index) const { return x_m[index]; }
+		limb_t& operator[](size_t index) { return x_m[index]; }
+
+		//変換
+		explicit operator bool() const { return __limb_normalized_size(x_m, size) != 0; }
+		template <class Int, class = enable_if_t<is_integral_v<Int>>>
+		explicit operator Int() const { return Int(x_m[0]); }
+		//上位2要素に残りの要素の有無を加味して丸める
+		explicit operator double() const {
+			limb_t u[size];
+			bool neg = magnitude(u);
+			size_t n = __limb_normalized_size(u, size);
+			if (n == 0) return 0.;
+			//上位64bitを正規化して取り出し, 下位のビットは最下位ビットに集約する
+			size_t s = __limb_clz(u[n - 1]);
+			limb_t hi = u[n - 1] << s, sticky = 0;
+			if (n >= 2) {
+				if (s != 0) hi |= u[n - 2] >> (64 - s);
+				sticky = u[n - 2] << s;
+			}
+			for (size_t i = 0; i + 2 < n; ++i) sticky |= u[i];
+			hi |= (sticky != 0);
+			double result = ldexp2(double(hi), int_t(64 * (n - 1)) - int_t(s));
+			return neg ? -result : result;
+		}
+
+		//10進数の文字列
+		std::string to_string() const {
+			limb_t u[size], q[size];
+			bool neg = magnitude(u);
+			size_t n = __limb_normalized_size(u, size);
+			std::string s;
+			//10^19ずつ取り出す
+			while (n > 0) {
+				limb_t r = __limb_divrem_1(q, u, n, 10000000000000000000ull);
+				for (size_t i = 0; i < n; ++i) u[i] = q[i];
+				n = __limb_normalized_size(u, n);
+				for (size_t i = 0; i < 19 && (n > 0 || r != 0); ++i, r /= 10) s.push_back(char('0' + r % 10));
+			}
+			if (s.empty()) s.push_back('0');
+			if (neg) s.push_back('-');
+			return std::string(s.rbegin(), s.rend());
+		}
+
+		//二項演算
+		friend multi_int operator+(const multi_int& lhs, const multi_int& rhs) { return multi_int(lhs) += rhs; }
+		friend multi_int operator-(const multi_int& lhs, const multi_int& rhs) { return multi_int(lhs) -= rhs; }
+		friend multi_int operator*(const multi_int& lhs, const multi_int& rhs) { return multi_int(lhs) *= rhs; }
+		friend multi_int operator/(const multi_int& lhs, const multi_int& rhs) { return multi_int(lhs) /= rhs; }
+		friend multi_int operator%(const multi_int& lhs, const multi_int& rhs) { return multi_int(lhs) %= rhs; }
+		friend multi_int operator&(const multi_int& lhs, const multi_int& rhs) { return multi_int(lhs) &= rhs; }
+		friend multi_int operator|(const multi_int& lhs, const multi_int& rhs) { return multi_int(lhs) |= rhs; }
+		friend multi_int operator^(const multi_int& lhs, const multi_int& rhs) { return multi_int(lhs) ^= rhs; }
+		friend multi_int operator<<(const multi_int& lhs, size_t s) { return multi_int(lhs) <<= s; }
+		friend multi_int operator>>(const multi_int& lhs, size_t s) { return multi_int(lhs) >>= s; }
+
+		//比較演算
+		friend bool operator==(const multi_int& lhs, const multi_int& rhs) { return __limb_cmp(lhs.x_m, rhs.x_m, size) == 0; }
+		friend bool operator!=(const multi_int& lhs, const multi_int& rhs) { return !(lhs == rhs); }
+		friend bool operator<(const multi_int& lhs, const multi_int& rhs) {
+			bool nl = lhs.is_negative(), nr = rhs.is_negative();
+			if (nl != nr) return nl;
+			return __limb_cmp(lhs.x_m, rhs.x_m, size) < 0;
+		}
+		friend bool operator>(const multi_int& lhs, const multi_int& rhs) { return rhs < lhs; }
+		friend bool operator<=(const multi_int& lhs, const multi_int& rhs) { return !(rhs < lhs); }
+		friend bool operator>=(const multi_int& lhs, const multi_int& rhs) { return !(lhs < rhs); }
+
+		//ストリーム出力
+		friend std::ostream& operator<<(std::ostream& os, const multi_int& n) {
+			return os << n.to_string();
+		}
+		friend std::wostream& operator<<(std::wostream& os, const multi_int& n) {
+			std::string s = n.to_string();
+			return os << std::wstring(s.begin(), s.end());
 		}
 	};
 
+
+	//多倍長整数の判定
+	template <class T>
+	struct is_multi_int : false_type {};
+	template <size_t N>
+	struct is_multi_int<multi_int<N>> : true_type {};
+	template <class T>
+	constexpr bool is_multi_int_v = is_multi_int<T>::value;
+
+
+	template <size_t N>
+	struct numeric_traits<multi_int<N>> {
+		using type = multi_int<N>;
+
+		static constexpr int_t digits = int_t(64 * type::size - 1);
+		static type(min)() { return type(1) << (64 * type::size - 1); }
+		static type(max)() { return ~(min)(); }
+	};
+
+	template <size_t N>
+	struct Abs<multi_int<N>> {
+		static multi_int<N> _abs_(const multi_int<N>& x) { return (x.sign() < 0) ? -x : x; }
+	};
+	template <size_t N>
+	struct Sgn<multi_int<N>> {
+		static int_t _sgn_(const multi_int<N>& x) { return x.sign(); }
+	};
 }
 
 
@@ -0,0 +1,397 @@
+﻿#ifndef IMATH_MATH_QUADRATURE_HPP
+#define IMATH_MATH_QUADRATURE_HPP
+
+#include "IMathLib/math/math.hpp"
+#include "IMathLib/math/math/orthogonal_polynomials.hpp"
+#include <vector>
+#include <map>
+#include <mutex>
+#include <algorithm>
+
+//数値積分
+//Gauss型求積則の節点と重みは直交多項式の三項漸化式から作るJacobi行列の固有値(Golub-Welsch法)をNewton法で精密化して求め, 次数と種類ごとにキャッシュする
+//適応型積分はGauss-Kronrod則で区間を二分する
+//関数値の再利用は1区間の中のGauss則とKronrod則の間に限られ, 二分した区間では全ての節点で評価し直す(Gauss-Kronrod則の節点は二分で入れ子にならない)
+
+namespace iml {
+
+	//求積則の節点xと重みw
+	template <class T>
+	struct quadrature_rule {
+		std::vector<T> x, w;
+	};
+	//Gauss-Kronrod則(2n + 1点のKronrod則とn点のGauss則, gauss_wはGauss則の節点(奇数番目)以外では0)
+	template <class T>
+	struct kronrod_rule {
+		std::vector<T> x, w, gauss_w;
+	};
+	//適応型積分の結果
+	template <class T, class S = T>
+	struct integration_result {
+		T value;
+		S error;
+		uint64_t evaluations;
+	};
+
+
+	//対称三重対角行列の固有値と固有ベクトルの第1成分(陰的QL法)
+	//d: 対角成分(固有値で上書き), e: 副対角成分(e[i]は(i, i + 1)成分), z: 第1成分(nullptrならば求めない)
+	template <class T>
+	inline void _tridiagonal_eigen_(std::vector<T>& d, std::vector<T> e, std::vector<T>* z) {
+		size_t n = d.size();
+		e.resize(n, T(0));
+		if (z != nullptr) z->assign(n, T(0)), (*z)[0] = 1;
+		for (size_t l = 0; l < n; ++l) {
+			for (size_t iter = 0; iter < 60; ++iter) {
+				size_t m = l;
+				for (; m + 1 < n; ++m) {
+					T dd = abs(d[m]) + abs(d[m + 1]);
+					if (abs(e[m]) <= numeric_traits<T>::epsilon() * dd) break;
+				}
+				if (m == l) break;
+				T g = (d[l + 1] - d[l]) / (2 * e[l]);
+				T r = sqrt(g * g + 1);
+				g = d[m] - d[l] + e[l] / (g + ((g < 0) ? -r : r));
+				T s = 1, c = 1, p = 0;
+				bool underflow = false;
+				for (size_t i = m; i-- > l;) {
+					T f = s * e[i], b = c * e[i];
+					e[i + 1] = r = sqrt(f * f + g * g);
+					if (r == 0) {
+						d[i + 1] -= p;
+						e[m] = 0;
+						underflow = true;
+						break;
+					}
+					s = f / r;
+					c = g / r;
+					g = d[i + 1] - p;
+					r = (d[i] - g) * s + 2 * c * b;
+					d[i + 1] = g + (p = s * r);
+					g = c * r - b;
+					if (z != nullptr) {
+						f = (*z)[i + 1];
+						(*z)[i + 1] = s * (*z)[i] + c * f;
+						(*z)[i] = c * (*z)[i] - s * f;
+					}
+				}
+				if (underflow) continue;
+				d[l] -= p;
+				e[l] = g;
+				e[m] = 0;
+			}
+		}
+		//昇順に整列
+		for (size_t i = 1; i < n; ++i) {
+			for (size_t j = i; j > 0 && d[j] < d[j - 1]; --j) {
+				std::swap(d[j], d[j - 1]);
+				if (z != nullptr) std::swap((*z)[j], (*z)[j - 1]);
+			}
+		}
+	}
+
+	//三項漸化式 p[k + 1] = (a(k)x + b(k))p[k] - c(k)p[k - 1] に対応する正規直交多項式の漸化式
+	//x q[k] = beta[k + 1]q[k + 1] + alpha[k]q[k] + beta[k]q[k - 1] (k < n)
+	template <class Recurrence, class T>
+	inline void _jacobi_matrix_(const Recurrence& r, size_t n, std::vector<T>& alpha, std::vector<T>& beta) {
+		alpha.resize(n);
+		beta.assign(n + 1, T(0));
+		for (size_t k = 0; k < n; ++k) {
+			alpha[k] = -r.b(k) / r.a(k);
+			beta[k + 1] = sqrt(r.c(k + 1) / (r.a(k) * r.a(k + 1)));
+		}
+	}
+
+	//Jacobi行列と重み関数の積分mu0によるn点のGauss型求積則
+	template <class T>
+	inline quadrature_rule<T> _gauss_rule_(const std::vector<T>& alpha, const std::vector<T>& beta, const T& mu0, size_t n) {
+		quadrature_rule<T> result;
+		result.x.assign(alpha.begin(), alpha.begin() + n);
+		_tridiagonal_eigen_(result.x, std::vector<T>(beta.begin() + 1, beta.begin() + n), static_cast<std::vector<T>*>(nullptr));
+		result.w.resize(n);
+		for (size_t i = 0; i < n; ++i) {
+			T x = result.x[i], sum = 0;
+			//Newton法で精密化してからChristoffel数 w = mu0/Σ[k < n] q[k](x)^2 を求める
+			for (size_t iter = 0; iter < 3; ++iter) {
+				T q0 = 0, q1 = 1, d0 = 0, d1 = 0;
+				sum = 0;
+				for (size_t k = 0; k < n; ++k) {
+					sum += q1 * q1;
+					T q2 = ((x - alpha[k]) * q1 - beta[k] * q0) / beta[k + 1];
+					T d2 = (q1 + (x - alpha[k]) * d1 - beta[k] * d0) / beta[k + 1];
+					q0 = q1; q1 = q2;
+					d0 = d1; d1 = d2;
+				}
+				if (iter + 1 < 3) x -= q1 / d1;
+			}
+			result.x[i] = x;
+			result.w[i] = mu0 / sum;
+		}
+		return result;
+	}
+
+	//Laurieの方法によるGauss-Kronrod則のJacobi行列(alpha, beta2は長さ3n/2 + 2以上, beta2[0] = mu0, beta2[k]はbeta[k]^2)
+	template <class T>
+	inline void _kronrod_matrix_(size_t n, std::vector<T>& a, std::vector<T>& b) {
+		a.resize(2 * n + 1, T(0));
+		b.resize(2 * n + 1, T(0));
+		std::vector<T> s(n / 2 + 2, T(0)), t(n / 2 + 2, T(0));
+		t[1] = b[n + 1];
+		for (size_t m = 0; m + 1 < n; ++m) {
+			T u = 0;
+			for (size_t k = (m + 1) / 2 + 1; k-- > 0;) {
+				size_t l = m - k;
+				u += (a[k + n + 1] - a[l]) * t[k + 1] + b[k + n + 1] * s[k] - b[l] * s[k + 1];
+				s[k + 1] = u;
+			}
+			s.swap(t);
+		}
+		for (size_t j = n / 2 + 1; j-- > 0;) s[j + 1] = s[j];
+		for (size_t m = n - 1; m + 2 < 2 * n; ++m) {
+			T u = 0;
+			size_t j = 0;
+			for (size_t k = m + 1 - n; 2 * k + 1 <= m; ++k) {
+				size_t l = m - k;
+				j = n - 1 - l;
+				u += -(a[k + n + 1] - a[l]) * t[j + 1] - b[k + n + 1] * s[j + 1] + b[l] * s[j + 2];
+				s[j + 1] = u;
+			}
+			if ((m & 1) == 0) {
+				size_t k = m / 2;
+				a[k + n + 1] = a[k] + (s[j + 1] - b[k + n + 1] * s[j + 2]) / t[j + 2];
+			}
+			else {
+				size_t k = (m + 1) / 2;
+				b[k + n + 1] = s[j + 1] / s[j + 2];
+			}
+			s.swap(t);
+		}
+		a[2 * n] = a[n - 1] - b[2 * n] * s[1] / t[1];
+	}
+
+
+	//n点のGauss-Legendre則([-1, 1], 重み1)
+	template <class T = IMATH_DEFAULT_FLOATING_POINT>
+	inline const quadrature_rule<T>& gauss_legendre_rule(size_t n) {
+		static std::map<size_t, quadrature_rule<T>> cache;
+		static std::mutex m;
+		std::lock_guard<std::mutex> lock(m);
+		auto it = cache.find(n);
+		if (it == cache.end()) {
+			std::vector<T> alpha, beta;
+			_jacobi_matrix_(Legendre_recurrence<T>(), n, alpha, beta);
+			it = cache.emplace(n, _gauss_rule_(alpha, beta, T(2), n)).first;
+		}
+		return it->second;
+	}
+	//n点のGauss-Laguerre則([0, ∞), 重みx^alpha e^-x)
+	template <class T = IMATH_DEFAULT_FLOATING_POINT>
+	inline const quadrature_rule<T>& gauss_laguerre_rule(size_t n, const T& alpha = 0) {
+		static std::map<std::pair<size_t, T>, quadrature_rule<T>> cache;
+		static std::mutex m;
+		std::lock_guard<std::mutex> lock(m);
+		auto it = cache.find(std::make_pair(n, alpha));
+		if (it == cache.end()) {
+			std::vector<T> a, beta;
+			_jacobi_matrix_(Laguerre_recurrence<T>{ alpha }, n, a, beta);
+			it = cache.emplace(std::make_pair(n, alpha), _gauss_rule_(a, beta, T(gamma(alpha + 1)), n)).first;
+		}
+		return it->second;
+	}
+	//n点のGauss-Hermite則((-∞, ∞), 重みe^(-x^2))
+	template <class T = IMATH_DEFAULT_FLOATING_POINT>
+	inline const quadrature_rule<T>& gauss_hermite_rule(size_t n) {
+		static std::map<size_t, quadrature_rule<T>> cache;
+		static std::mutex m;
+		std::lock_guard<std::mutex> lock(m);
+		auto it = cache.find(n);
+		if (it == cache.end()) {
+			std::vector<T> alpha, beta;
+			_jacobi_matrix_(Hermite_recurrence<T>(), n, alpha, beta);
+			it = cache.emplace(n, _gauss_rule_(alpha, beta, T(sqrt(pi<T>)), n)).first;
+		}
+		return it->second;
+	}
+	//n点のGauss則に対する2n + 1点のGauss-Kronrod則([-1, 1], 重み1)
+	template <class T = IMATH_DEFAULT_FLOATING_POINT>
+	inline const kronrod_rule<T>& gauss_kronrod_rule(size_t n) {
+		static std::map<size_t, kronrod_rule<T>> cache;
+		static std::mutex m;
+		std::lock_guard<std::mutex> lock(m);
+		auto it = cache.find(n);
+		if (it != cache.end()) return it->second;
+
+		//Legendre多項式の係数(alphaは3n/2次, betaは3n/2 + 1次まで)
+		size_t len = (3 * n + 1) / 2 + 1;
+		std::vector<T> alpha, beta, a(len, T(0)), b(len, T(0));
+		_jacobi_matrix_(Legendre_recurrence<T>(), len, alpha, beta);
+		for (size_t k = 0; k <= 3 * n / 2; ++k) a[k] = alpha[k];
+		b[0] = 2;
+		for (size_t k = 1; k < len; ++k) b[k] = beta[k] * beta[k];
+		_kronrod_matrix_(n, a, b);
+
+		kronrod_rule<T> result;
+		std::vector<T> e(2 * n), z;
+		for (size_t k = 0; k < 2 * n; ++k) e[k] = sqrt(b[k + 1]);
+		result.x = a;
+		_tridiagonal_eigen_(result.x, e, &z);
+		result.w.resize(2 * n + 1);
+		result.gauss_w.assign(2 * n + 1, T(0));
+		for (size_t i = 0; i < 2 * n + 1; ++i) result.w[i] = 2 * z[i] * z[i];
+		//Gauss則の節点は奇数番目(値はGauss則のものに揃える)
+		std::vector<T> g_alpha, g_beta;
+		_jacobi_matrix_(Legendre_recurrence<T>(), n, g_alpha, g_beta);
+		quadrature_rule<T> g = _gauss_rule_(g_alpha, g_beta, T(2), n);
+		for (size_t i = 0; i < n; ++i) {
+			result.x[2 * i + 1] = g.x[i];
+			result.gauss_w[2 * i + 1] = g.w[i];
+		}
+		return cache.emplace(n, result).first->second;
+	}
+
+
+	//∫[a, b] f(x)dx のn点のGauss-Legendre則による近似
+	template <class F, class T>
+	inline auto gauss_legendre(F f, const T& a, const T& b, size_t n) {
+		const quadrature_rule<T>& rule = gauss_legendre_rule<T>(n);
+		T h = (b - a) / 2, c = (a + b) / 2;
+		decltype(f(c) * h) result = 0;
+		for (size_t i = 0; i < n; ++i) result += rule.w[i] * f(c + h * rule.x[i]);
+		return result * h;
+	}
+	//∫[0, ∞) x^alpha e^-x f(x)dx のn点のGauss-Laguerre則による近似
+	template <class F, class T>
+	inline auto gauss_laguerre(F f, size_t n, const T& alpha) {
+		const quadrature_rule<T>& rule = gauss_laguerre_rule<T>(n, alpha);
+		decltype(f(alpha) * alpha) result = 0;
+		for (size_t i = 0; i < n; ++i) result += rule.w[i] * f(rule.x[i]);
+		return result;
+	}
+	template <class T = IMATH_DEFAULT_FLOATING_POINT, class F>
+	inline auto gauss_laguerre(F f, size_t n) { return gauss_laguerre(f, n, T(0)); }
+	//∫(-∞, ∞) e^(-x^2) f(x)dx のn点のGauss-Hermite則による近似
+	template <class T = IMATH_DEFAULT_FLOATING_POINT, class F>
+	inline auto gauss_hermite(F f, size_t n) {
+		const quadrature_rule<T>& rule = gauss_hermite_rule<T>(n);
+		decltype(f(T()) * T()) result = 0;
+		for (size_t i = 0; i < n; ++i) result += rule.w[i] * f(rule.x[i]);
+		return result;
+	}
+	//∫[a, b] f(x)dx の2n + 1点のGauss-Kronrod則による近似(errorは誤差の推定値, absoluteは∫[a, b] |f(x)|dx の近似)
+	template <class F, class T, class S>
+	inline auto _gauss_kronrod_(F f, const T& a, const T& b, size_t n, S& error, S& absolute) {
+		const kronrod_rule<T>& rule = gauss_kronrod_rule<T>(n);
+		T h = (b - a) / 2, c = (a + b) / 2;
+		using result_type = decltype(f(c) * h);
+		std::vector<result_type> y(2 * n + 1);
+		result_type k = 0, g = 0;
+		for (size_t i = 0; i < 2 * n + 1; ++i) {
+			y[i] = f(c + h * rule.x[i]);
+			k += rule.w[i] * y[i];
+			//Gauss則はKronrod則と同じ関数値を用いる
+			if (i & 1) g += rule.gauss_w[i] * y[i];
+		}
+		//QUADPACKの誤差推定(resascは|f - 平均|の積分, resabsは|f|の積分)
+		result_type mean = k / 2;
+		S resasc = 0, resabs = 0, ah = abs(h);
+		for (size_t i = 0; i < 2 * n + 1; ++i) {
+			resasc += rule.w[i] * abs(y[i] - mean);
+			resabs += rule.w[i] * abs(y[i]);
+		}
+		resasc *= ah;
+		resabs *= ah;
+		error = abs((k - g) * h);
+		if (resasc != 0 && error != 0) {
+			S d = 200 * error / resasc;
+			error = resasc * ((d < 1) ? d * sqrt(d) : S(1));
+		}
+		S roundoff = 50 * numeric_traits<S>::epsilon() * resabs;
+		if (error < roundoff) error = roundoff;
+		absolute = resabs;
+		return k * h;
+	}
+	//∫[a, b] f(x)dx の2n + 1点のGauss-Kronrod則による近似(errorは誤差の推定値)
+	template <class F, class T, class S>
+	inline auto gauss_kronrod(F f, const T& a, const T& b, size_t n, S& error) {
+		S absolute;
+		return _gauss_kronrod_(f, a, b, n, error, absolute);
+	}
+
+	//∫[a, b] f(x)dx の適応型積分(誤差の推定値がmax(abs_tolerance, rel_tolerance|I|, 100ε∫|f|)以下となるまで誤差最大の区間を二分する)
+	//100ε∫|f|は各区間の誤差の推定値の下限50ε∫|f|の和を上回るため, 積分値が0に相殺する場合もabs_tolerance = 0で収束する
+	//分割ごとに2(2n + 1)回fを評価する(子の区間の節点は親の区間の節点とも共有する端点とも一致しないため親の関数値は再利用できない)
+	template <class F, class T>
+	inline auto integrate(F f, const T& a, const T& b, const T& abs_tolerance, const T& rel_tolerance, size_t n = 10, size_t max_intervals = 1000) {
+		using result_type = decltype(f(a) * a);
+		struct interval {
+			T a, b;
+			result_type value;
+			T error, absolute;
+			bool operator<(const interval& x) const { return error < x.error; }
+		};
+		integration_result<result_type, T> result = { result_type(0), T(0), 0 };
+		if (a == b) return result;
+
+		std::vector<interval> heap(1);
+		heap[0].a = a; heap[0].b = b;
+		heap[0].value = _gauss_kronrod_(f, a, b, n, heap[0].error, heap[0].absolute);
+		result.evaluations = 2 * n + 1;
+		//合計は分割ごとに差分で更新し, 収束の判定が成り立てば丸め誤差の蓄積を除くため全区間の和で確かめ直す
+		result_type total = heap[0].value;
+		T error = heap[0].error, absolute = heap[0].absolute;
+		const T floor = 100 * numeric_traits<T>::epsilon();
+		auto converged = [&]() { return error <= abs_tolerance || error <= rel_tolerance * abs(total) || error <= floor * absolute; };
+		while (heap.size() < max_intervals) {
+			if (converged()) {
+				total = 0;
+				error = 0;
+				absolute = 0;
+				for (const interval& i : heap) {
+					total += i.value;
+					error += i.error;
+					absolute += i.absolute;
+				}
+				if (converged()) break;
+			}
+			std::pop_heap(heap.begin(), heap.end());
+			interval x = heap.back();
+			heap.pop_back();
+			T c = (x.a + x.b) / 2;
+			//区間幅が丸め誤差の程度まで小さくなれば分割を止める
+			if (!(x.a < c && c < x.b) && !(x.b < c && c < x.a)) {
+				heap.push_back(x);
+				std::push_heap(heap.begin(), heap.end());
+				break;
+			}
+			interval left = { x.a, c, result_type(0), T(0), T(0) }, right = { c, x.b, result_type(0), T(0), T(0) };
+			left.value = _gauss_kronrod_(f, left.a, left.b, n, left.error, left.absolute);
+			right.value = _gauss_kronrod_(f, right.a, right.b, n, right.error, right.absolute);
+			result.evaluations += 2 * (2 * n + 1);
+			heap.push_back(left);
+			std::push_heap(heap.begin(), heap.end());
+			heap.push_back(right);
+			std::push_heap(heap.begin(), heap.end());
+			total += (left.value + right.value) - x.value;
+			error += (left.error + right.error) - x.error;
+			absolute += (left.absolute + right.absolute) - x.absolute;
+			if (error < 0) error = 0;
+		}
+		//分割の上限または区間幅の下限で打ち切った場合も全区間の和を返す
+		total = 0;
+		error = 0;
+		for (const interval& i : heap) {
+			total += i.value;
+			error += i.error;
+		}
+		result.value = total;
+		result.error = error;
+		return result;
+	}
+	template <class F, class T>
+	inline auto integrate(F f, const T& a, const T& b, const T& tolerance) {
+		return integrate(f, a, b, T(0), tolerance);
+	}
+}
+
+
+#endif
\ No newline at end of file
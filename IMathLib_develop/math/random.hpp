@@ -3,128 +3,522 @@
 
 #include "IMathLib/utility/type_traits.hpp"
 #include "IMathLib/math/math.hpp"
+#include "IMathLib/math/sobol_direction_numbers.hpp"
+#include <mutex>
+#include <stdexcept>
+#include <vector>
 
 //疑似乱数
 
 namespace iml {
 	namespace rnd {
 
-		//乱数の基底クラス(テンプレート引数は符号無し整数型)
-		template <class UInt, class = typename enable_if<!is_unsigned<UInt>::value>::type>
+		//2^e(2のべき乗はどの浮動小数点型にも誤差なく変換できる)
+		inline constexpr double __random_pow2(int_t e) {
+			double result = 1;
+			for (; e < 0; ++e) result /= 2;
+			for (; e > 0; --e) result *= 2;
+			return result;
+		}
+		//k*2^e(2^64を法とする)
+		inline constexpr uint64_t __random_shl(uint64_t k, size_t e) { return (e < 64) ? k << e : 0; }
+		//xを表すのに必要なビット数
+		template <class UInt>
+		inline constexpr int_t __random_bit_width(UInt x) {
+			int_t result = 0;
+			for (; x != 0; x >>= 1) ++result;
+			return result;
+		}
+
+		//整数の疑似乱数から[0, 1)の浮動小数点数への変換
+		template <class S, class UInt, UInt Min, UInt Max>
+		struct Random_unit_kernel {
+			static constexpr UInt range = Max - Min;
+			//[0, 2^w)の全ての値をとるか
+			static constexpr bool full_range = (Min == 0) && ((range & (range + 1)) == 0);
+			static constexpr int_t width = __random_bit_width(range);
+			//浮動小数点数の仮数部に収まる上位ビット数
+			static constexpr int_t bits = (width < numeric_traits<S>::digits) ? width : numeric_traits<S>::digits;
+
+			//上位bitsビットを2^-bits倍する(除算も丸めも不要)
+			static S _unit_(UInt x, true_type) { return static_cast<S>(x >> (width - bits)) * static_cast<S>(__random_pow2(-bits)); }
+			//範囲が2のべき乗でなければ1/(range + 1)を乗じる(Sへの変換で1に丸まる値は1未満の最大値1 - 2^-digitsとする)
+			static S _unit_(UInt x, false_type) {
+				S result = static_cast<S>(double(x - Min) * (1 / (double(range) + 1)));
+				return (result < 1) ? result : S(1) - static_cast<S>(__random_pow2(-numeric_traits<S>::digits));
+			}
+			static S _unit_(UInt x) { return _unit_(x, bool_constant<full_range>()); }
+		};
+
+		//整数の疑似乱数から64ビットの一様なビット列への変換
+		template <class UInt, UInt Min, UInt Max>
+		struct Random_bits_kernel {
+			static constexpr UInt range = Max - Min;
+			static constexpr bool full_range = (Min == 0) && ((range & (range + 1)) == 0);
+			//1回の出力から取り出す下位ビット数(範囲が2のべき乗でなければ1ビット少なくとる)
+			static constexpr int_t width = full_range ? __random_bit_width(range) : __random_bit_width(range) - 1;
+			static constexpr uint64_t mask = (width >= 64) ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+
+			template <class Engine>
+			static uint64_t _bits64_(Engine& g) {
+				if (width >= 64) return uint64_t(g() - Min);
+				uint64_t result = 0;
+				for (int_t w = 0; w < 64; w += width) result = (result << (width % 64)) | (uint64_t(g() - Min) & mask);
+				return result;
+			}
+		};
+
+		//乱数エンジンの基底クラス(Derivedは(min)(), (max)(), operator()()を定義する)
+		//仮想関数を用いないため, 具体的なエンジン型のまま呼び出せば生成はインライン化される
+		template <class Derived, class UInt>
 		class random_base {
 			//整数型でなければならない
 			static_assert(is_integral<UInt>::value, "Template must be integer type.");
+		public:
+			using result_type = UInt;
 		protected:
-			size_t	cnt = 0;			//カウンタ
+			uint64_t	cnt = 0;			//カウンタ
+
+			Derived& derived() { return static_cast<Derived&>(*this); }
 		public:
 			constexpr random_base() {}
-			virtual ~random_base() = 0 {}
 
-			virtual constexpr UInt min() const = 0;
-			virtual constexpr UInt max() const = 0;
+			//疑似乱数の取得
+			UInt get() { return derived()(); }
 
-			//シード値のセット
-			virtual void seed(UInt s) = 0;
+			//[first, last)を疑似乱数で埋める
+			template <class OutputIterator>
+			void fill(OutputIterator first, OutputIterator last) {
+				for (; first != last; ++first) *first = derived()();
+			}
+			void fill(UInt* first, UInt* last) { derived()._fill_(first, size_t(last - first)); }
+			//[first, last)を[0, 1)の一様乱数で埋める
+			template <class S, class OutputIterator>
+			void fill_unit(OutputIterator first, OutputIterator last) {
+				using kernel = Random_unit_kernel<S, UInt, (Derived::min)(), (Derived::max)()>;
+				//ブロック単位で整数乱数を生成してから変換する
+				UInt buf[256];
+				while (first != last) {
+					size_t n = 0;
+					for (OutputIterator itr = first; n < 256 && itr != last; ++itr) ++n;
+					derived()._fill_(buf, n);
+					for (size_t i = 0; i < n; ++i, ++first) *first = kernel::_unit_(buf[i]);
+				}
+			}
 
-			//疑似乱数の取得
-			virtual UInt get() = 0;
+			//64ビットの一様なビット列(出力が64ビットに満たなければ複数回の出力を連結する)
+			uint64_t bits64() { return Random_bits_kernel<UInt, (Derived::min)(), (Derived::max)()>::_bits64_(derived()); }
+			void fill_bits64(uint64_t* first, uint64_t* last) {
+				using kernel = Random_bits_kernel<UInt, (Derived::min)(), (Derived::max)()>;
+				if (kernel::full_range && kernel::width == 64) derived()._fill_(reinterpret_cast<UInt*>(first), size_t(last - first));
+				else for (; first != last; ++first) *first = kernel::_bits64_(derived());
+			}
 
 			//乱数を進める
-			void discard(size_t k) { for (size_t i = 0; i < k; ++i) this->get(); }
+			void discard(uint64_t k) { derived()._discard_(k); }
+			//乱数をk*2^e進める(jump(k)でk番目のストリームの先頭へ移動する)
+			void jump(uint64_t k, size_t e = 64) { derived()._jump_(k, e); }
 
 			//計算回数の取得
-			size_t times() { return cnt; }
+			uint64_t times() const { return cnt; }
 
-			//正規化した疑似乱数の取得
+			//[0, 1)に正規化した疑似乱数の取得
 			template <class S>
-			S unit() { return static_cast<S>(this->get()) / ((this->max)() - (this->min)()); }
+			S unit() { return Random_unit_kernel<S, UInt, (Derived::min)(), (Derived::max)()>::_unit_(derived()()); }
+
+			//エンジンで特殊化しない場合の既定の実装
+			void _fill_(UInt* p, size_t n) {
+				for (size_t i = 0; i < n; ++i) p[i] = derived()();
+			}
+			void _discard_(uint64_t k) {
+				for (uint64_t i = 0; i < k; ++i) derived()();
+			}
 		};
 
 		//線型合同法
 		template <class T, T A, T B, T M>
-		class linear_congruential :public random_base<T> {
+		class linear_congruential :public random_base<linear_congruential<T, A, B, M>, T> {
 		public:
 			using type = T;
 		private:
+			//A*xがあふれないように32ビット以下は64ビットで計算する
+			using calc_type = conditional_t<(numeric_traits<T>::digits <= 32), uint64_t, T>;
+
 			type		x;		//現在の生成された値
+
+			//a*b mod M
+			static constexpr calc_type mul_mod(calc_type a, calc_type b) {
+				if (numeric_traits<T>::digits <= 32) return (a * b) % M;
+				calc_type result = 0;
+				for (a %= M; b != 0; b >>= 1) {
+					if (b & 1) result = (result >= M - a) ? result - (M - a) : result + a;
+					a = (a >= M - a) ? a - (M - a) : a + a;
+				}
+				return result;
+			}
 		public:
 			constexpr linear_congruential() :x(1) {}
 			constexpr linear_congruential(type s) : x(s) {}
 
-			constexpr type(min)() const { return B == 0 ? 1 : 0; }
-			constexpr type(max)() const { return M - 1; }
+			static constexpr type(min)() { return B == 0 ? 1 : 0; }
+			static constexpr type(max)() { return M - 1; }
 
 			//シード値のセット
-			void seed(type s) { x = s; cnt = 0; }
+			void seed(type s) { x = s; this->cnt = 0; }
 
 			//疑似乱数の取得
-			type get() { return (*this)(); }
-			type operator()() { ++cnt; return x = (A*x + B) % M; }
+			type operator()() { ++this->cnt; return x = type((mul_mod(A, x) + B) % M); }
+
+			void _fill_(type* p, size_t n) {
+				calc_type y = x;
+				for (size_t i = 0; i < n; ++i) p[i] = type(y = (mul_mod(A, y) + B) % M);
+				x = type(y);
+				this->cnt += n;
+			}
+			//x -> ax + bのk回の合成(a^k, b(a^(k-1) + ... + 1))を二分累乗で求める
+			static void affine_pow(calc_type& a, calc_type& b, uint64_t k) {
+				calc_type ra = 1, rb = 0;
+				for (; k != 0; k >>= 1) {
+					if (k & 1) {
+						ra = mul_mod(a, ra);
+						rb = (mul_mod(a, rb) + b) % M;
+					}
+					b = (mul_mod(a, b) + b) % M;
+					a = mul_mod(a, a);
+				}
+				a = ra; b = rb;
+			}
+			void _discard_(uint64_t k) {
+				this->cnt += k;
+				calc_type a = A % M, b = B % M;
+				affine_pow(a, b, k);
+				x = type((mul_mod(a, x) + b) % M);
+			}
+			void _jump_(uint64_t k, size_t e) {
+				this->cnt += __random_shl(k, e);
+				calc_type a = A % M, b = B % M;
+				//2^e回の合成は自乗をe回
+				for (size_t i = 0; i < e; ++i) {
+					b = (mul_mod(a, b) + b) % M;
+					a = mul_mod(a, a);
+				}
+				affine_pow(a, b, k);
+				x = type((mul_mod(a, x) + b) % M);
+			}
 		};
 		//MINSTD乱数
-		using linear_congruential_minstd = linear_congruential<unsigned __int32, 48271, 0, 2147483647>;
+		using linear_congruential_minstd = linear_congruential<uint32_t, 48271, 0, 2147483647>;
+
+		//GF(2)上で線形な生成器の飛躍
+		//特性多項式p(x)をBerlekamp-Massey法で求め, 飛躍多項式x^J mod p(x)をHorner法で状態に作用させる
+		//状態Stateは_step_(), _bit_(), _add_(const State&), _clear_()をもつ
+		struct F2_jump_kernel {
+			using polynomial = std::vector<uint64_t>;		//ビットiがx^iの係数
+
+			static bool _test_(const polynomial& a, size_t i) { return ((i >> 6) < a.size()) && (((a[i >> 6] >> (i & 63)) & 1) != 0); }
+			static size_t _degree_(const polynomial& a) {
+				for (size_t i = a.size(); i-- > 0;)
+					if (a[i] != 0) return i * 64 + size_t(__random_bit_width(a[i])) - 1;
+				return 0;
+			}
+			static bool _parity_(uint64_t x) {
+				x ^= x >> 32; x ^= x >> 16; x ^= x >> 8;
+				x ^= x >> 4; x ^= x >> 2; x ^= x >> 1;
+				return (x & 1) != 0;
+			}
+			//ビットoから始まる64ビット
+			static uint64_t _extract_(const polynomial& a, size_t o) {
+				size_t w = o >> 6, b = o & 63;
+				uint64_t lo = (w < a.size()) ? a[w] >> b : 0;
+				if (b != 0 && w + 1 < a.size()) lo |= a[w + 1] << (64 - b);
+				return lo;
+			}
+			//a += b x^s
+			static void _add_shift_(polynomial& a, const polynomial& b, size_t s) {
+				size_t ws = s >> 6, bs = s & 63;
+				if (a.size() < b.size() + ws + 1) a.resize(b.size() + ws + 1, 0);
+				if (bs == 0) for (size_t i = 0; i < b.size(); ++i) a[i + ws] ^= b[i];
+				else {
+					for (size_t i = 0; i < b.size(); ++i) {
+						a[i + ws] ^= b[i] << bs;
+						a[i + ws + 1] ^= b[i] >> (64 - bs);
+					}
+				}
+			}
+			//a mod p(pはd次)
+			static void _reduce_(polynomial& a, const polynomial& p, size_t d) {
+				for (size_t i = a.size() * 64; i-- > d;)
+					if (_test_(a, i)) _add_shift_(a, p, i - d);
+				a.resize(d / 64 + 1);
+			}
+			static polynomial _mul_mod_(const polynomial& a, const polynomial& b, const polynomial& p, size_t d) {
+				//bに0～15次の多項式を乗じた表による4ビットずつの乗算
+				polynomial table[16];
+				table[0].assign(b.size() + 1, 0);
+				for (size_t j = 1; j < 16; ++j) {
+					table[j].assign(b.size() + 1, 0);
+					for (size_t t = 0; t < 4; ++t)
+						if ((j >> t) & 1) _add_shift_(table[j], b, t);
+				}
+				polynomial r(a.size() + b.size() + 2, 0);
+				for (size_t i = 0; i < a.size() * 16; ++i) {
+					size_t j = (a[i >> 4] >> ((i & 15) * 4)) & 15;
+					if (j != 0) _add_shift_(r, table[j], i * 4);
+				}
+				_reduce_(r, p, d);
+				return r;
+			}
+			//0のビットを挟んで下位32ビットを64ビットに広げる
+			static uint64_t _spread_(uint64_t x) {
+				x &= 0xFFFFFFFF;
+				x = (x | (x << 16)) & 0x0000FFFF0000FFFF;
+				x = (x | (x << 8)) & 0x00FF00FF00FF00FF;
+				x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0F;
+				x = (x | (x << 2)) & 0x3333333333333333;
+				return (x | (x << 1)) & 0x5555555555555555;
+			}
+			//GF(2)では(Σa_i x^i)^2 = Σa_i x^2i
+			static polynomial _sqr_mod_(const polynomial& a, const polynomial& p, size_t d) {
+				polynomial r(2 * a.size(), 0);
+				for (size_t i = 0; i < a.size(); ++i) {
+					r[2 * i] = _spread_(a[i]);
+					r[2 * i + 1] = _spread_(a[i] >> 32);
+				}
+				_reduce_(r, p, d);
+				return r;
+			}
+			//a^k mod p
+			static polynomial _pow_(polynomial a, uint64_t k, const polynomial& p, size_t d) {
+				polynomial r(d / 64 + 1, 0);
+				r[0] = 1;
+				for (; k != 0; k >>= 1) {
+					if (k & 1) r = _mul_mod_(r, a, p, d);
+					if (k > 1) a = _sqr_mod_(a, p, d);
+				}
+				return r;
+			}
+
+			//状態sから得られるビット列の最小多項式(bitsは状態のビット数)
+			template <class State>
+			static polynomial _minimal_polynomial_(State s, size_t bits) {
+				size_t n = 2 * bits;
+				//r[n - 1 - i] = s_iと逆順に並べると s_(i-j) (0 <= j)はrのビットn - 1 - iからの連続したビットになる
+				polynomial r((n + bits) / 64 + 3, 0);
+				for (size_t i = 0; i < n; ++i, s._step_())
+					if (s._bit_()) r[(n - 1 - i) >> 6] |= uint64_t(1) << ((n - 1 - i) & 63);
+
+				//接続多項式c(x)
+				polynomial c(bits / 64 + 2, 0), b(bits / 64 + 2, 0), t;
+				c[0] = b[0] = 1;
+				size_t l = 0, m = 1;
+				for (size_t i = 0; i < n; ++i) {
+					//食い違い Σ c_j s_(i-j)
+					uint64_t acc = 0;
+					for (size_t w = 0; w * 64 <= l && w < c.size(); ++w) acc ^= c[w] & _extract_(r, n - 1 - i + 64 * w);
+					if (!_parity_(acc)) ++m;
+					else if (2 * l <= i) {
+						t = c;
+						_add_shift_(c, b, m);
+						l = i + 1 - l;
+						b = t;
+						m = 1;
+					}
+					else {
+						_add_shift_(c, b, m);
+						++m;
+					}
+				}
+				//特性多項式 p(x) = x^l c(1/x)
+				polynomial p(l / 64 + 1, 0);
+				for (size_t j = 0; j <= l; ++j)
+					if (_test_(c, j)) p[(l - j) >> 6] |= uint64_t(1) << ((l - j) & 63);
+				return p;
+			}
+
+			//s = q(T)s (T は1段の状態遷移)
+			template <class State>
+			static void _apply_(State& s, const polynomial& q) {
+				State acc(s);
+				acc._clear_();
+				for (size_t i = _degree_(q) + 1; i-- > 0;) {
+					acc._step_();
+					if (_test_(q, i)) acc._add_(s);
+				}
+				s = acc;
+			}
+		};
+
+		//飛躍多項式の実行時キャッシュ(特性多項式とx^(2^e) mod p(x)を保持する)
+		template <class Engine>
+		class f2_jump_cache {
+			using polynomial = F2_jump_kernel::polynomial;
+
+			polynomial					p_m;		//特性多項式
+			size_t						d_m;		//特性多項式の次数
+			std::vector<polynomial>		pw_m;		//pw_m[e] = x^(2^e) mod p(x)
+		public:
+			f2_jump_cache() : p_m(), d_m(0), pw_m() {}
+
+			//p(x)とx^(2^e) mod p(x)の取得
+			void operator()(size_t e, polynomial& p, size_t& d, polynomial& x2e) {
+				if (d_m == 0) {
+					//既定のシード値の状態から求める
+					Engine g;
+					p_m = F2_jump_kernel::_minimal_polynomial_(g._linear_state_(), Engine::state_bits);
+					d_m = F2_jump_kernel::_degree_(p_m);
+					polynomial x(d_m / 64 + 1, 0);
+					x[0] = 2;
+					F2_jump_kernel::_reduce_(x, p_m, d_m);
+					pw_m.push_back(x);
+				}
+				while (pw_m.size() <= e) pw_m.push_back(F2_jump_kernel::_sqr_mod_(pw_m.back(), p_m, d_m));
+				p = p_m; d = d_m; x2e = pw_m[e];
+			}
+		};
+
+		//x^(k 2^e - back) mod p(x)(backが真ならば1段手前までの飛躍)
+		template <class Engine>
+		inline F2_jump_kernel::polynomial __f2_jump_polynomial(uint64_t k, size_t e, bool back) {
+			static f2_jump_cache<Engine> cache;
+			static std::mutex m;
+			F2_jump_kernel::polynomial p, x2e;
+			size_t d;
+			{
+				std::lock_guard<std::mutex> lock(m);
+				cache(e, p, d, x2e);
+			}
+			F2_jump_kernel::polynomial q = F2_jump_kernel::_pow_(x2e, k, p, d);
+			if (back) {
+				//p(0) = 1より x^-1 = (p(x) - 1)/x
+				F2_jump_kernel::polynomial inv(p);
+				inv[0] ^= 1;
+				for (size_t i = 0; i < inv.size(); ++i) inv[i] = (inv[i] >> 1) | ((i + 1 < inv.size()) ? inv[i + 1] << 63 : 0);
+				q = F2_jump_kernel::_mul_mod_(q, inv, p, d);
+			}
+			return q;
+		}
 
 		//Xorshift
 		template <class T, size_t Shift1, size_t Shift2, size_t Shift3>
-		class Xorshift32 :public random_base<T> {
+		class Xorshift32 :public random_base<Xorshift32<T, Shift1, Shift2, Shift3>, T> {
 		public:
 			using type = T;
-			using inner_type = unsigned __int32;
+			using inner_type = uint32_t;
 		private:
-			static_assert((Shift1 <= (1 << numeric_traits<type>::digits) - 1) || (Shift2 <= (1 << numeric_traits<type>::digits) - 1)
-				|| (Shift3 <= (1 << numeric_traits<type>::digits) - 1) || (numeric_traits<type>::digits <= numeric_traits<inner_type>::digits)
+			static_assert((Shift1 < numeric_traits<inner_type>::digits) && (Shift2 < numeric_traits<inner_type>::digits)
+				&& (Shift3 < numeric_traits<inner_type>::digits) && (numeric_traits<type>::digits <= numeric_traits<inner_type>::digits)
 				, "The parameter is incorrect.");
 
 			inner_type	x;		//現在の生成された値
 
+			static inner_type next(inner_type x) {
+				x ^= (x << Shift1);
+				x ^= (x >> Shift2);
+				return x ^ (x << Shift3);
+			}
 		public:
 			constexpr Xorshift32() :x(1) {}
 			constexpr Xorshift32(type s) : x(s) {}
 
-			constexpr type(min)() const { return 0; }
-			constexpr type(max)() const { return (numeric_traits<type>::max)(); }
+			static constexpr type(min)() { return 0; }
+			static constexpr type(max)() { return (numeric_traits<type>::max)(); }
 
 			//シード値のセット
-			void seed(type s) { x = s; cnt = 0; }
+			void seed(type s) { x = s; this->cnt = 0; }
 
 			//疑似乱数の取得
-			type get() { return (*this)(); }
-			type operator()() {
-				++cnt;
-				x ^= (x << Shift1);
-				x ^= (x >> Shift2);
-				return x ^= (x << Shift3);
+			type operator()() { ++this->cnt; return type(x = next(x)); }
+
+			void _fill_(type* p, size_t n) {
+				inner_type y = x;
+				for (size_t i = 0; i < n; ++i) p[i] = type(y = next(y));
+				x = y;
+				this->cnt += n;
+			}
+
+			//飛躍のための線形な状態
+			static constexpr size_t state_bits = 32;
+			struct linear_state {
+				inner_type	x;
+				void _step_() { x = next(x); }
+				bool _bit_() const { return (x & 1) != 0; }
+				void _add_(const linear_state& s) { x ^= s.x; }
+				void _clear_() { x = 0; }
+			};
+			linear_state _linear_state_() const { return linear_state{ x }; }
+
+			//短い距離は逐次に進める
+			void _discard_(uint64_t k) {
+				if (k >= 4 * state_bits) { _jump_(k, 0); return; }
+				this->cnt += k;
+				for (; k != 0; --k) x = next(x);
+			}
+			void _jump_(uint64_t k, size_t e) {
+				this->cnt += __random_shl(k, e);
+				linear_state st{ x };
+				F2_jump_kernel::_apply_(st, __f2_jump_polynomial<Xorshift32>(k, e, false));
+				x = st.x;
 			}
 		};
 		template <class T, size_t Shift1, size_t Shift2, size_t Shift3>
-		class Xorshift64 :public random_base<T> {
+		class Xorshift64 :public random_base<Xorshift64<T, Shift1, Shift2, Shift3>, T> {
 		public:
 			using type = T;
-			using inner_type = unsigned __int64;
+			using inner_type = uint64_t;
 		private:
-			static_assert((Shift1 <= (1 << numeric_traits<type>::digits) - 1) || (Shift2 <= (1 << numeric_traits<type>::digits) - 1)
-				|| (Shift3 <= (1 << numeric_traits<type>::digits) - 1) || (numeric_traits<type>::digits <= numeric_traits<inner_type>::digits)
+			static_assert((Shift1 < numeric_traits<inner_type>::digits) && (Shift2 < numeric_traits<inner_type>::digits)
+				&& (Shift3 < numeric_traits<inner_type>::digits) && (numeric_traits<type>::digits <= numeric_traits<inner_type>::digits)
 				, "The parameter is incorrect.");
 
 			inner_type	x;		//現在の生成された値
 
+			static inner_type next(inner_type x) {
+				x ^= (x << Shift1);
+				x ^= (x >> Shift2);
+				return x ^ (x << Shift3);
+			}
 		public:
 			constexpr Xorshift64() :x(1) {}
 			constexpr Xorshift64(type s) : x(s) {}
 
-			constexpr type(min)() const { return 0; }
-			constexpr type(max)() const { return (numeric_traits<type>::max)(); }
+			static constexpr type(min)() { return 0; }
+			static constexpr type(max)() { return (numeric_traits<type>::max)(); }
 
 			//シード値のセット
-			void seed(type s) { x = s; cnt = 0; }
+			void seed(type s) { x = s; this->cnt = 0; }
 
 			//疑似乱数の取得
-			type get() { return (*this)(); }
-			type operator()() {
-				++cnt;
-				x ^= (x << Shift1);
-				x ^= (x >> Shift2);
-				return x ^= (x << Shift3);
+			type operator()() { ++this->cnt; return type(x = next(x)); }
+
+			void _fill_(type* p, size_t n) {
+				inner_type y = x;
+				for (size_t i = 0; i < n; ++i) p[i] = type(y = next(y));
+				x = y;
+				this->cnt += n;
+			}
+
+			//飛躍のための線形な状態
+			static constexpr size_t state_bits = 64;
+			struct linear_state {
+				inner_type	x;
+				void _step_() { x = next(x); }
+				bool _bit_() const { return (x & 1) != 0; }
+				void _add_(const linear_state& s) { x ^= s.x; }
+				void _clear_() { x = 0; }
+			};
+			linear_state _linear_state_() const { return linear_state{ x }; }
+
+			//短い距離は逐次に進める
+			void _discard_(uint64_t k) {
+				if (k >= 4 * state_bits) { _jump_(k, 0); return; }
+				this->cnt += k;
+				for (; k != 0; --k) x = next(x);
+			}
+			void _jump_(uint64_t k, size_t e) {
+				this->cnt += __random_shl(k, e);
+				linear_state st{ x };
+				F2_jump_kernel::_apply_(st, __f2_jump_polynomial<Xorshift64>(k, e, false));
+				x = st.x;
 			}
 		};
 		//周期2^32-1のXorshift
@@ -138,7 +532,7 @@ namespace iml {
 		template <class T, size_t w, size_t n, size_t m, size_t r, T a,
 			size_t u, size_t s, size_t t, size_t l, T b, T c, T d,
 			T f>
-		class mersenne_twister :public random_base<T> {
+		class mersenne_twister :public random_base<mersenne_twister<T, w, n, m, r, a, u, s, t, l, b, c, d, f>, T> {
 		public:
 			using type = T;
 		private:
@@ -147,9 +541,10 @@ namespace iml {
 				|| (a <= (1 << w) - 1) || (b <= (1 << w) - 1) || (c <= (1 << w) - 1) || (d <= (1 << w) - 1) || (f <= (1 << w) - 1),
 				"The parameter is incorrect.");
 
+			static constexpr type mask_w = (~type(0)) >> (numeric_traits<type>::digits - w);	//下位wビットのマスク
 			static constexpr type mask_a[2] = { 0,a };						//aのマスク
-			static constexpr type upper_mask = ~((~type(0)) >> (w - r));	//上位ビット抽出マスク
-			static constexpr type lower_mask = ~upper_mask;					//下位ビット抽出マスク
+			static constexpr type upper_mask = (mask_w << r) & mask_w;		//上位ビット抽出マスク
+			static constexpr type lower_mask = ~upper_mask & mask_w;		//下位ビット抽出マスク
 
 			size_t	array_cnt;				//配列用のカウンタ
 			type		x[n];
@@ -179,45 +574,98 @@ namespace iml {
 				array_cnt = 0;
 			}
 
-			//2のw乗の取得(何故かwの値を含めるとインスタンス化に失敗する)
-			template <size_t N, size_t X, type Result>
-			struct _2_power_of_X :_2_power_of_X<N + 1, X, Result * 2> {};
-			template <size_t X, type Result>
-			struct _2_power_of_X<X, X, Result> {
-				static constexpr type value = Result;
-			};
+			//調律する
+			static type temper(type y) {
+				y ^= (y >> u) & d;
+				y ^= (y << s) & b;
+				y ^= (y << t) & c;
+				return y ^ (y >> l);
+			}
 		public:
 			mersenne_twister() { seed(type(5489)); }
-			mersenne_twister(type s) { seed(s); }
+			mersenne_twister(type sd) { seed(sd); }
 
-			constexpr type(min)() const { return 0; }
-			constexpr type(max)() const { return _2_power_of_X<0, w, 1>::value - 1; }
+			static constexpr type(min)() { return 0; }
+			static constexpr type(max)() { return mask_w; }
 
 			//シード値のセット
-			void seed(type s) {
-				x[0] = s;
-				for (size_t i = 1; i < n; ++i) x[i] = (f * (x[i - 1] ^ (x[i - 1] >> 30)) + i);
-				cnt = 0;
+			void seed(type sd) {
+				x[0] = sd & mask_w;
+				for (size_t i = 1; i < n; ++i) x[i] = (f * (x[i - 1] ^ (x[i - 1] >> (w - 2))) + type(i)) & mask_w;
+				this->cnt = 0;
 				make_bit_array();
 			}
 
 			//疑似乱数の取得
-			type get() { return (*this)(); }
 			type operator()() {
-				type y;
-
-				++cnt;
+				++this->cnt;
 				if (array_cnt >= n) make_bit_array();
+				return temper(x[array_cnt++]);
+			}
 
-				y = x[array_cnt++];
+			//状態配列の残りをまとめて調律して書き出す
+			void _fill_(type* p, size_t k) {
+				this->cnt += k;
+				while (k != 0) {
+					if (array_cnt >= n) make_bit_array();
+					size_t len = (k < n - array_cnt) ? k : n - array_cnt;
+					const type* q = x + array_cnt;
+					for (size_t i = 0; i < len; ++i) p[i] = temper(q[i]);
+					array_cnt += len; p += len; k -= len;
+				}
+			}
+			//調律せずに状態配列の更新のみで進める(十分に遠ければ飛躍する)
+			void _discard_(uint64_t k) {
+				if (k >= (uint64_t(1) << 26)) { _jump_(k, 0); return; }
+				this->cnt += k;
+				while (k > n - array_cnt) {
+					k -= n - array_cnt;
+					make_bit_array();
+				}
+				array_cnt += size_t(k);
+			}
 
-				//調律する
-				y ^= (y >> 11);
-				y ^= (y << 7) & b;
-				y ^= (y << 15) & c;
-				y ^= (y >> 18) & d;
+			//飛躍のための線形な状態(状態配列を先頭iの循環バッファとして1要素ずつ更新する)
+			static constexpr size_t state_bits = n * w - r;
+			struct linear_state {
+				type		x[n];
+				size_t	i;
 
-				return y;
+				void _step_() {
+					size_t i1 = (i + 1 == n) ? 0 : i + 1, im = (i + m >= n) ? i + m - n : i + m;
+					type temp = (x[i] & upper_mask) | (x[i1] & lower_mask);
+					x[i] = x[im] ^ (temp >> 1) ^ mask_a[temp & 1];
+					i = i1;
+				}
+				bool _bit_() const { return (x[i] & 1) != 0; }
+				void _add_(const linear_state& st) {
+					for (size_t k = 0, j = i, sj = st.i; k < n; ++k) {
+						x[j] ^= st.x[sj];
+						j = (j + 1 == n) ? 0 : j + 1;
+						sj = (sj + 1 == n) ? 0 : sj + 1;
+					}
+				}
+				void _clear_() {
+					for (size_t k = 0; k < n; ++k) x[k] = 0;
+					i = 0;
+				}
+			};
+			linear_state _linear_state_() const {
+				linear_state st;
+				for (size_t k = 0; k < n; ++k) st.x[k] = x[k];
+				st.i = 0;
+				return st;
+			}
+			//状態配列を系列の窓とみなして飛躍する
+			//窓の先頭要素は上位ビットしか状態に含まれないため, 先頭要素が未出力ならば1段手前まで飛躍する
+			void _jump_(uint64_t k, size_t e) {
+				this->cnt += __random_shl(k, e);
+				if (k == 0) return;
+				bool back = (array_cnt == 0);
+				linear_state st = _linear_state_();
+				F2_jump_kernel::_apply_(st, __f2_jump_polynomial<mersenne_twister>(k, e, back));
+				for (size_t j = 0, i = st.i; j < n; ++j, i = (i + 1 == n) ? 0 : i + 1) x[j] = st.x[i];
+				if (back) array_cnt = 1;
 			}
 		};
 		//mt19937の32ビット用
@@ -226,8 +674,727 @@ namespace iml {
 			, 1812433253>;
 		//mt19937の64ビット用
 		using mersenne_twister_19937_64 = mersenne_twister<uint64_t, 64, 312, 156, 31, 0xB5026f5AA96619E9
-			, 29, 17, 37, 43, 0x5555555555555555, 0x71D67fffEDA60000, 0xFFF7EEE000000000
+			, 29, 17, 37, 43, 0x71D67fffEDA60000, 0xFFF7EEE000000000, 0x5555555555555555
 			, 6364136223846793005>;
+
+		//SIMD指向メルセンヌ・ツイスタ(SFMT)
+		//128ビットを1要素とした漸化式で状態を更新し, 調律せずに32ビット単位で出力する
+		template <size_t MExp, size_t Pos1, size_t SL1, size_t SL2, size_t SR1, size_t SR2
+			, uint32_t Msk1, uint32_t Msk2, uint32_t Msk3, uint32_t Msk4
+			, uint32_t Parity1, uint32_t Parity2, uint32_t Parity3, uint32_t Parity4>
+		class simd_fast_mersenne_twister :public random_base<simd_fast_mersenne_twister<MExp, Pos1, SL1, SL2, SR1, SR2
+			, Msk1, Msk2, Msk3, Msk4, Parity1, Parity2, Parity3, Parity4>, uint32_t> {
+		public:
+			using type = uint32_t;
+		private:
+			static constexpr size_t n = MExp / 128 + 1;			//128ビット要素の数
+			static constexpr size_t n32 = n * 4;				//32ビット要素の数
+			static_assert((Pos1 < n) && (0 < SL2) && (SL2 < 8) && (0 < SR2) && (SR2 < 8) && (SL1 < 32) && (SR1 < 32), "The parameter is incorrect.");
+
+			size_t	array_cnt;				//配列用のカウンタ
+			alignas(16) type	x[n32];
+
+			//128ビットの漸化式 r = a ^ (a << 8SL2) ^ ((b >> SR1) & msk) ^ (c >> 8SR2) ^ (d << SL1)
+			static void recursion(type* r, const type* a, const type* b, const type* c, const type* d) {
+#if defined IMATH_SIMD_SSE2
+				const __m128i mask = _mm_set_epi32(int(Msk4), int(Msk3), int(Msk2), int(Msk1));
+				__m128i va = _mm_load_si128(reinterpret_cast<const __m128i*>(a));
+				__m128i v = _mm_and_si128(_mm_srli_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(b)), SR1), mask);
+				__m128i z = _mm_srli_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(c)), SR2);
+				__m128i y = _mm_slli_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(d)), SL1);
+				z = _mm_xor_si128(_mm_xor_si128(z, va), _mm_xor_si128(_mm_slli_si128(va, SL2), _mm_xor_si128(v, y)));
+				_mm_store_si128(reinterpret_cast<__m128i*>(r), z);
+#else
+				//128ビットのバイト単位のシフトを64ビット2つで行う
+				uint64_t ah = (uint64_t(a[3]) << 32) | a[2], al = (uint64_t(a[1]) << 32) | a[0];
+				uint64_t ch = (uint64_t(c[3]) << 32) | c[2], cl = (uint64_t(c[1]) << 32) | c[0];
+				uint64_t xh = (ah << (SL2 * 8)) | (al >> (64 - SL2 * 8)), xl = al << (SL2 * 8);
+				uint64_t yh = ch >> (SR2 * 8), yl = (cl >> (SR2 * 8)) | (ch << (64 - SR2 * 8));
+				const type msk[4] = { Msk1,Msk2,Msk3,Msk4 };
+				const type sl[4] = { type(xl), type(xl >> 32), type(xh), type(xh >> 32) };
+				const type sr[4] = { type(yl), type(yl >> 32), type(yh), type(yh >> 32) };
+				for (size_t i = 0; i < 4; ++i) r[i] = a[i] ^ sl[i] ^ ((b[i] >> SR1) & msk[i]) ^ sr[i] ^ (d[i] << SL1);
+#endif
+			}
+			//状態配列の一括更新
+			void make_bit_array() {
+				const type* r1 = x + 4 * (n - 2);
+				const type* r2 = x + 4 * (n - 1);
+				size_t i;
+				for (i = 0; i < n - Pos1; ++i) {
+					recursion(x + 4 * i, x + 4 * i, x + 4 * (i + Pos1), r1, r2);
+					r1 = r2; r2 = x + 4 * i;
+				}
+				for (; i < n; ++i) {
+					recursion(x + 4 * i, x + 4 * i, x + 4 * (i + Pos1 - n), r1, r2);
+					r1 = r2; r2 = x + 4 * i;
+				}
+				array_cnt = 0;
+			}
+			//周期が2^MExp-1となるように初期状態を修正する
+			void period_certification() {
+				const type parity[4] = { Parity1,Parity2,Parity3,Parity4 };
+				type inner = 0;
+				for (size_t i = 0; i < 4; ++i) inner ^= x[i] & parity[i];
+				for (size_t i = 16; i > 0; i >>= 1) inner ^= inner >> i;
+				if (inner & 1) return;
+				for (size_t i = 0; i < 4; ++i) {
+					for (type work = 1; work != 0; work <<= 1) {
+						if (work & parity[i]) { x[i] ^= work; return; }
+					}
+				}
+			}
+		public:
+			simd_fast_mersenne_twister() { seed(type(5489)); }
+			simd_fast_mersenne_twister(type sd) { seed(sd); }
+
+			static constexpr type(min)() { return 0; }
+			static constexpr type(max)() { return (numeric_traits<type>::max)(); }
+
+			//シード値のセット
+			void seed(type sd) {
+				x[0] = sd;
+				for (size_t i = 1; i < n32; ++i) x[i] = 1812433253 * (x[i - 1] ^ (x[i - 1] >> 30)) + type(i);
+				period_certification();
+				this->cnt = 0;
+				array_cnt = n32;
+			}
+
+			//疑似乱数の取得
+			type operator()() {
+				++this->cnt;
+				if (array_cnt >= n32) make_bit_array();
+				return x[array_cnt++];
+			}
+
+			//状態配列をそのまま書き出す
+			void _fill_(type* p, size_t k) {
+				this->cnt += k;
+				while (k != 0) {
+					if (array_cnt >= n32) make_bit_array();
+					size_t len = (k < n32 - array_cnt) ? k : n32 - array_cnt;
+					const type* q = x + array_cnt;
+					for (size_t i = 0; i < len; ++i) p[i] = q[i];
+					array_cnt += len; p += len; k -= len;
+				}
+			}
+			void _discard_(uint64_t k) {
+				this->cnt += k;
+				while (k > n32 - array_cnt) {
+					k -= n32 - array_cnt;
+					make_bit_array();
+				}
+				array_cnt += size_t(k);
+			}
+		};
+		//SFMT19937
+		using simd_fast_mersenne_twister_19937 = simd_fast_mersenne_twister<19937, 122, 18, 1, 11, 1
+			, 0xDFFFFFEF, 0xDDFECB7F, 0xBFFAFFFF, 0xBFFFFFF6
+			, 0x00000001, 0x00000000, 0x00000000, 0x13C9E684>;
+
+
+		//SplitMix64(シード値から状態を初期化するために用いる)
+		inline uint64_t __splitmix64(uint64_t& x) {
+			uint64_t z = (x += 0x9E3779B97F4A7C15);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+			return z ^ (z >> 31);
+		}
+		inline uint64_t __random_rotl(uint64_t x, size_t k) { return (x << k) | (x >> (64 - k)); }
+
+		//Lanes本の独立な系列を交互に並べて出力する生成器の基底
+		//Derivedは_step_(out)でLanes個を生成し, 全レーンの状態をまとめたlinear_stateを_linear_state_()で返す
+		//状態はレーンを最内にもつため, _step_のループはSIMD命令に展開される
+		template <class Derived, size_t Lanes>
+		class random_lanes_base :public random_base<Derived, uint64_t> {
+			static_assert((Lanes != 0) && ((Lanes & (Lanes - 1)) == 0), "Lanes must be a power of 2.");
+		public:
+			using type = uint64_t;
+			static constexpr size_t lanes = Lanes;
+		protected:
+			static constexpr size_t lanes_log2 = size_t(__random_bit_width(Lanes)) - 1;
+
+			size_t	buf_cnt;				//バッファ用のカウンタ
+			type		buf[Lanes];
+
+			//各レーンをk*2^e段進める(バッファに残りがあれば1段手前まで飛躍してからバッファを作り直す)
+			void jump_lanes(uint64_t k, size_t e) {
+				if (k == 0) return;
+				bool back = (buf_cnt < Lanes);
+				F2_jump_kernel::_apply_(this->derived()._linear_state_(), __f2_jump_polynomial<Derived>(k, e, back));
+				if (back) this->derived()._step_(buf);
+			}
+			//各レーンをq段進める(段数が少なければ逐次に進める)
+			void step_lanes(uint64_t q) {
+				if (q >= 4 * Derived::state_bits) jump_lanes(q, 0);
+				else for (; q != 0; --q) this->derived()._step_(buf);
+			}
+		public:
+			static constexpr type(min)() { return 0; }
+			static constexpr type(max)() { return (numeric_traits<type>::max)(); }
+
+			//疑似乱数の取得
+			type operator()() {
+				++this->cnt;
+				if (buf_cnt >= Lanes) { this->derived()._step_(buf); buf_cnt = 0; }
+				return buf[buf_cnt++];
+			}
+
+			//Lanes個ずつ呼び出し側のバッファに直接生成する
+			void _fill_(type* p, size_t k) {
+				this->cnt += k;
+				for (; k != 0 && buf_cnt < Lanes; --k) *p++ = buf[buf_cnt++];
+				for (; k >= Lanes; k -= Lanes, p += Lanes) this->derived()._step_(p);
+				if (k != 0) {
+					this->derived()._step_(buf);
+					for (buf_cnt = 0; buf_cnt < k; ++buf_cnt) p[buf_cnt] = buf[buf_cnt];
+				}
+			}
+			//端数を逐次に進めてから各レーンをk/Lanes段進める
+			void _discard_(uint64_t k) {
+				for (; (k & (Lanes - 1)) != 0; --k) (*this)();
+				this->cnt += k;
+				step_lanes(k >> lanes_log2);
+			}
+			void _jump_(uint64_t k, size_t e) {
+				//e < lanes_log2ではk*2^eが64ビットを超えうるため, 端数(Lanes未満)と各レーンの段数k >> (lanes_log2 - e)に分ける
+				if (e < lanes_log2) {
+					size_t s = lanes_log2 - e;
+					_discard_((k & ((uint64_t(1) << s) - 1)) << e);
+					this->cnt += (k >> s) << lanes_log2;
+					step_lanes(k >> s);
+					return;
+				}
+				this->cnt += __random_shl(k, e);
+				jump_lanes(k, e - lanes_log2);
+			}
+		};
+
+		//多レーンのxorshift128+
+		template <size_t Lanes = 4>
+		class Xorshift128_plus :public random_lanes_base<Xorshift128_plus<Lanes>, Lanes> {
+		public:
+			using type = uint64_t;
+
+			//飛躍のための線形な状態
+			static constexpr size_t state_bits = 128;
+			struct linear_state {
+				type	s[2][Lanes];
+
+				void _step_() {
+					for (size_t j = 0; j < Lanes; ++j) {
+						type s1 = s[0][j];
+						const type s0 = s[1][j];
+						s[0][j] = s0;
+						s1 ^= s1 << 23;
+						s[1][j] = s1 ^ s0 ^ (s1 >> 18) ^ (s0 >> 5);
+					}
+				}
+				bool _bit_() const { return (s[0][0] & 1) != 0; }
+				void _add_(const linear_state& x) {
+					for (size_t i = 0; i < 2; ++i)
+						for (size_t j = 0; j < Lanes; ++j) s[i][j] ^= x.s[i][j];
+				}
+				void _clear_() {
+					for (size_t i = 0; i < 2; ++i)
+						for (size_t j = 0; j < Lanes; ++j) s[i][j] = 0;
+				}
+			};
+		private:
+			linear_state	state;
+		public:
+			Xorshift128_plus() { seed(type(5489)); }
+			Xorshift128_plus(type sd) { seed(sd); }
+
+			//シード値のセット(各レーンの状態をSplitMix64で初期化)
+			void seed(type sd) {
+				for (size_t j = 0; j < Lanes; ++j)
+					for (size_t i = 0; i < 2; ++i) state.s[i][j] = __splitmix64(sd);
+				this->cnt = 0;
+				this->buf_cnt = Lanes;
+			}
+
+			void _step_(type* out) {
+				for (size_t j = 0; j < Lanes; ++j) out[j] = state.s[0][j] + state.s[1][j];
+				state._step_();
+			}
+			linear_state& _linear_state_() { return state; }
+		};
+
+		//多レーンのxoshiro256**
+		template <size_t Lanes = 4>
+		class Xoshiro256_starstar :public random_lanes_base<Xoshiro256_starstar<Lanes>, Lanes> {
+		public:
+			using type = uint64_t;
+
+			//飛躍のための線形な状態
+			static constexpr size_t state_bits = 256;
+			struct linear_state {
+				type	s[4][Lanes];
+
+				void _step_() {
+					for (size_t j = 0; j < Lanes; ++j) {
+						const type t = s[1][j] << 17;
+						s[2][j] ^= s[0][j];
+						s[3][j] ^= s[1][j];
+						s[1][j] ^= s[2][j];
+						s[0][j] ^= s[3][j];
+						s[2][j] ^= t;
+						s[3][j] = __random_rotl(s[3][j], 45);
+					}
+				}
+				bool _bit_() const { return (s[0][0] & 1) != 0; }
+				void _add_(const linear_state& x) {
+					for (size_t i = 0; i < 4; ++i)
+						for (size_t j = 0; j < Lanes; ++j) s[i][j] ^= x.s[i][j];
+				}
+				void _clear_() {
+					for (size_t i = 0; i < 4; ++i)
+						for (size_t j = 0; j < Lanes; ++j) s[i][j] = 0;
+				}
+			};
+		private:
+			linear_state	state;
+		public:
+			Xoshiro256_starstar() { seed(type(5489)); }
+			Xoshiro256_starstar(type sd) { seed(sd); }
+
+			//シード値のセット(各レーンの状態をSplitMix64で初期化)
+			void seed(type sd) {
+				for (size_t j = 0; j < Lanes; ++j)
+					for (size_t i = 0; i < 4; ++i) state.s[i][j] = __splitmix64(sd);
+				this->cnt = 0;
+				this->buf_cnt = Lanes;
+			}
+
+			void _step_(type* out) {
+				//64ビット乗算をもたない命令セットでもベクトル化されるように5倍と9倍はシフトと加算で行う
+				for (size_t j = 0; j < Lanes; ++j) {
+					const type r = __random_rotl((state.s[1][j] << 2) + state.s[1][j], 7);
+					out[j] = (r << 3) + r;
+				}
+				state._step_();
+			}
+			linear_state& _linear_state_() { return state; }
+		};
+
+
+		//カウンタベースの生成器の基底(出力はブロック番号と鍵のみから決まり, 任意の位置へ定数時間で移動できる)
+		//Derivedは_block_(lo, hi, out)で128ビットのブロック番号に対する4個の出力を生成する
+		template <class Derived, class UInt>
+		class counter_based_random_base :public random_base<Derived, UInt> {
+		public:
+			using type = UInt;
+		protected:
+			uint64_t	ctr[2];				//次に生成するブロックの番号
+			size_t	buf_cnt;			//バッファ用のカウンタ
+			type		buf[4];
+
+			void next_block(type* out) {
+				this->derived()._block_(ctr[0], ctr[1], out);
+				if (++ctr[0] == 0) ++ctr[1];
+			}
+			void add_counter(uint64_t lo, uint64_t hi) {
+				ctr[0] += lo;
+				ctr[1] += hi + ((ctr[0] < lo) ? 1 : 0);
+			}
+			void reset_counter() {
+				ctr[0] = ctr[1] = 0;
+				buf_cnt = 4;
+			}
+		public:
+			static constexpr type(min)() { return 0; }
+			static constexpr type(max)() { return (numeric_traits<type>::max)(); }
+
+			//疑似乱数の取得
+			type operator()() {
+				++this->cnt;
+				if (buf_cnt >= 4) { next_block(buf); buf_cnt = 0; }
+				return buf[buf_cnt++];
+			}
+
+			void _fill_(type* p, size_t k) {
+				this->cnt += k;
+				for (; k != 0 && buf_cnt < 4; --k) *p++ = buf[buf_cnt++];
+				for (; k >= 4; k -= 4, p += 4) next_block(p);
+				if (k != 0) {
+					next_block(buf);
+					for (buf_cnt = 0; buf_cnt < k; ++buf_cnt) p[buf_cnt] = buf[buf_cnt];
+				}
+			}
+			void _discard_(uint64_t k) {
+				this->cnt += k;
+				if (k <= 4 - buf_cnt) { buf_cnt += size_t(k); return; }
+				k -= 4 - buf_cnt;
+				add_counter(k >> 2, 0);
+				buf_cnt = 4;
+				if ((k & 3) != 0) {
+					next_block(buf);
+					buf_cnt = size_t(k & 3);
+				}
+			}
+			//k*2^e/4ブロック進める(バッファに残りがあれば1つ手前のブロックから作り直す)
+			void _jump_(uint64_t k, size_t e) {
+				//e < 2ではk*2^eが64ビットを超えうるため, 端数(4未満)を読み飛ばしてからk >> (2 - e)ブロック進める
+				if (e < 2) {
+					size_t s = 2 - e;
+					_discard_((k & ((uint64_t(1) << s) - 1)) << e);
+					k >>= s;
+					e = 2;
+				}
+				this->cnt += __random_shl(k, e);
+				e -= 2;
+				add_counter(__random_shl(k, e), (e == 0) ? 0 : (e < 64) ? k >> (64 - e) : __random_shl(k, e - 64));
+				if (buf_cnt < 4) {
+					uint64_t lo = ctr[0] - 1, hi = ctr[1] - ((ctr[0] == 0) ? 1 : 0);
+					this->derived()._block_(lo, hi, buf);
+				}
+			}
+		};
+
+		//Philox4x32(Salmon et al. 2011)
+		template <size_t Rounds = 10>
+		class philox4x32 :public counter_based_random_base<philox4x32<Rounds>, uint32_t> {
+		public:
+			using type = uint32_t;
+		private:
+			type	key[2];
+
+			static void mulhilo(type a, type b, type& hi, type& lo) {
+				uint64_t p = uint64_t(a) * b;
+				hi = type(p >> 32);
+				lo = type(p);
+			}
+		public:
+			philox4x32() { seed(0); }
+			philox4x32(uint64_t sd) { seed(sd); }
+			//k番目のストリーム(k*2^64個目の出力から開始)
+			philox4x32(uint64_t sd, uint64_t stream) { seed(sd); this->jump(stream); }
+
+			//シード値のセット(シード値を鍵とする)
+			void seed(uint64_t sd) {
+				key[0] = type(sd);
+				key[1] = type(sd >> 32);
+				this->cnt = 0;
+				this->reset_counter();
+			}
+
+			void _block_(uint64_t lo, uint64_t hi, type* out) const {
+				type x0 = type(lo), x1 = type(lo >> 32), x2 = type(hi), x3 = type(hi >> 32);
+				type k0 = key[0], k1 = key[1];
+				for (size_t i = 0; i < Rounds; ++i) {
+					if (i != 0) {
+						k0 += 0x9E3779B9;
+						k1 += 0xBB67AE85;
+					}
+					type hi0, lo0, hi1, lo1;
+					mulhilo(0xD2511F53, x0, hi0, lo0);
+					mulhilo(0xCD9E8D57, x2, hi1, lo1);
+					x0 = hi1 ^ x1 ^ k0;
+					x1 = lo1;
+					x2 = hi0 ^ x3 ^ k1;
+					x3 = lo0;
+				}
+				out[0] = x0; out[1] = x1; out[2] = x2; out[3] = x3;
+			}
+		};
+		//Philox4x32-10
+		using philox4x32_10 = philox4x32<10>;
+
+		//Threefry4x64(Salmon et al. 2011)
+		template <size_t Rounds = 20>
+		class threefry4x64 :public counter_based_random_base<threefry4x64<Rounds>, uint64_t> {
+			static_assert((Rounds % 4) == 0, "Rounds must be a multiple of 4.");
+		public:
+			using type = uint64_t;
+		private:
+			type	key[5];				//鍵と鍵スケジュールのパリティ
+		public:
+			threefry4x64() { seed(0); }
+			threefry4x64(uint64_t sd) { seed(sd); }
+			//k番目のストリーム(k*2^64個目の出力から開始)
+			threefry4x64(uint64_t sd, uint64_t stream) { seed(sd); this->jump(stream); }
+
+			//シード値のセット(シード値を鍵の第1要素とする)
+			void seed(uint64_t sd) {
+				key[0] = sd;
+				key[1] = key[2] = key[3] = 0;
+				key[4] = 0x1BD11BDAA9FC1A22 ^ key[0] ^ key[1] ^ key[2] ^ key[3];
+				this->cnt = 0;
+				this->reset_counter();
+			}
+		private:
+			//4段分の混合(回転量は定数)
+			template <size_t R0, size_t R1, size_t R2, size_t R3, size_t R4, size_t R5, size_t R6, size_t R7>
+			static void mix4(type& x0, type& x1, type& x2, type& x3) {
+				x0 += x1; x1 = __random_rotl(x1, R0); x1 ^= x0;
+				x2 += x3; x3 = __random_rotl(x3, R1); x3 ^= x2;
+				x0 += x3; x3 = __random_rotl(x3, R2); x3 ^= x0;
+				x2 += x1; x1 = __random_rotl(x1, R3); x1 ^= x2;
+				x0 += x1; x1 = __random_rotl(x1, R4); x1 ^= x0;
+				x2 += x3; x3 = __random_rotl(x3, R5); x3 ^= x2;
+				x0 += x3; x3 = __random_rotl(x3, R6); x3 ^= x0;
+				x2 += x1; x1 = __random_rotl(x1, R7); x1 ^= x2;
+			}
+			//s回目の鍵の注入
+			void inject(type& x0, type& x1, type& x2, type& x3, size_t s) const {
+				x0 += key[s % 5];
+				x1 += key[(s + 1) % 5];
+				x2 += key[(s + 2) % 5];
+				x3 += key[(s + 3) % 5] + s;
+			}
+		public:
+			void _block_(uint64_t lo, uint64_t hi, type* out) const {
+				type x0 = lo + key[0], x1 = hi + key[1], x2 = key[2], x3 = key[3];
+				//8段ごとに回転量が一巡する
+				for (size_t i = 0; i < Rounds; i += 8) {
+					mix4<14, 16, 52, 57, 23, 40, 5, 37>(x0, x1, x2, x3);
+					inject(x0, x1, x2, x3, i / 4 + 1);
+					if (i + 4 >= Rounds) break;
+					mix4<25, 33, 46, 12, 58, 22, 32, 32>(x0, x1, x2, x3);
+					inject(x0, x1, x2, x3, i / 4 + 2);
+				}
+				out[0] = x0; out[1] = x1; out[2] = x2; out[3] = x3;
+			}
+		};
+		//Threefry4x64-20
+		using threefry4x64_20 = threefry4x64<20>;
+
+
+		//低食い違い量列(準乱数列)
+
+		//GF(2)上の多項式(ビットiがx^iの係数で, 次数は32未満)
+		struct Primitive_polynomial_kernel {
+			//a*b mod p(x)(pの次数はs)
+			static uint64_t _mul_mod_(uint64_t a, uint64_t b, uint64_t p, size_t s) {
+				uint64_t r = 0;
+				for (; b != 0; b >>= 1) {
+					if (b & 1) r ^= a;
+					a <<= 1;
+					if ((a >> s) & 1) a ^= p;
+				}
+				return r;
+			}
+			//x^k mod p(x)
+			static uint64_t _pow_x_(uint64_t k, uint64_t p, size_t s) {
+				uint64_t r = 1, x = (s == 1) ? 1 : 2;
+				for (; k != 0; k >>= 1) {
+					if (k & 1) r = _mul_mod_(r, x, p, s);
+					x = _mul_mod_(x, x, p, s);
+				}
+				return r;
+			}
+			//s次の多項式pが原始多項式であるか(xの位数が2^s - 1であるか)
+			static bool _is_primitive_(uint64_t p, size_t s) {
+				uint64_t order = (uint64_t(1) << s) - 1;
+				if (_pow_x_(order, p, s) != 1) return false;
+				//位数の素因数qについてx^(order/q) != 1
+				uint64_t n = order;
+				for (uint64_t q = 2; q * q <= n; ++q) {
+					if (n % q != 0) continue;
+					while (n % q == 0) n /= q;
+					if (_pow_x_(order / q, p, s) == 1) return false;
+				}
+				return n == 1 || _pow_x_(order / n, p, s) != 1;
+			}
+		};
+
+		//Sobol列の原始多項式(Joe and Kuoの表記で, 次数sと中間の係数をあらわすa)
+		struct sobol_polynomial {
+			uint32_t	s;
+			uint32_t	a;
+		};
+		//次数の小さい順, 同じ次数ではaの小さい順にcount個の原始多項式を列挙する(列挙済みのものは共有する)
+		inline std::vector<sobol_polynomial> __sobol_polynomials(size_t count) {
+			static std::vector<sobol_polynomial> cache;
+			static uint32_t next_s = 1, next_a = 0;
+			static std::mutex m;
+			std::lock_guard<std::mutex> lock(m);
+			while (cache.size() < count && next_s < 32) {
+				uint64_t p = (uint64_t(1) << next_s) | (uint64_t(next_a) << 1) | 1;
+				if (Primitive_polynomial_kernel::_is_primitive_(p, next_s)) cache.push_back(sobol_polynomial{ next_s, next_a });
+				if (++next_a >= (uint32_t(1) << (next_s - 1))) { ++next_s; next_a = 0; }
+			}
+			return std::vector<sobol_polynomial>(cache.begin(), cache.begin() + ((count < cache.size()) ? count : cache.size()));
+		}
+
+		//Sobol列(32ビット, 2^32点まで)
+		//n番目の点はグレイコードg = n ^ (n >> 1)の立っているビットkの方向数v[k]の排他的論理和で, 次の点は方向数1つとの排他的論理和で得られる
+		//1次元目はvan der Corput列, d次元目(d >= 2)は(d - 1)番目の原始多項式を用い, 初期方向数m_k(奇数, m_k < 2^k)はJoe and Kuoの表(21201次元まで)による
+		//表を超える次元のm_kは次元ごとのSplitMix64により定める(他の方向数を用いる場合はset_direction_numbersで置き換える)
+		class sobol_sequence {
+		public:
+			using type = uint32_t;
+			static constexpr size_t bits = 32;
+		private:
+			size_t				dim;
+			uint64_t			cnt;			//次に生成する点の番号
+			std::vector<type>	v;				//v[d*bits + k]はd次元目の方向数
+			std::vector<type>	x;				//次に生成する点(スクランブル前)
+			std::vector<type>	shift;			//次元ごとのデジタルシフト
+			std::vector<type>	seed;			//次元ごとのOwenスクランブルのシード値
+			bool				owen;
+
+			//方向数の漸化式 v[k] = v[k - s] ^ (v[k - s] >> s) ^ Σ a_j v[k - j]
+			void make_direction(size_t d, uint32_t s, uint32_t a, const uint32_t* m) {
+				type* vd = v.data() + d * bits;
+				for (size_t k = 0; k < s && k < bits; ++k) vd[k] = type(m[k]) << (bits - 1 - k);
+				for (size_t k = s; k < bits; ++k) {
+					type r = vd[k - s] ^ (vd[k - s] >> s);
+					for (size_t j = 1; j < s; ++j)
+						if ((a >> (s - 1 - j)) & 1) r ^= vd[k - j];
+					vd[k] = r;
+				}
+			}
+			//Laine-Karrasの置換をビット反転の下で用いた入れ子の一様なスクランブル(上位ビットの反転はより上位のビットのみに依存する)
+			static type owen_scramble(type x, type sd) {
+				x = reverse(x);
+				x += sd;
+				x ^= x * 0x6C50B47C;
+				x ^= x * 0xB82F1E52;
+				x ^= x * 0xC7AFE638;
+				x ^= x * 0x8D22F6E6;
+				return reverse(x);
+			}
+			static type reverse(type x) {
+				x = ((x >> 1) & 0x55555555) | ((x & 0x55555555) << 1);
+				x = ((x >> 2) & 0x33333333) | ((x & 0x33333333) << 2);
+				x = ((x >> 4) & 0x0F0F0F0F) | ((x & 0x0F0F0F0F) << 4);
+				x = ((x >> 8) & 0x00FF00FF) | ((x & 0x00FF00FF) << 8);
+				return (x >> 16) | (x << 16);
+			}
+			type scramble(size_t d, type y) const { return owen ? owen_scramble(y, seed[d]) : y ^ shift[d]; }
+		public:
+			//dimension次元のSobol列(scramble_seedが0でなければスクランブルし, owenが偽ならばランダムなデジタルシフトのみとする)
+			explicit sobol_sequence(size_t dimension, uint64_t scramble_seed = 0, bool owen = true)
+				: dim(dimension), cnt(0), v(dimension * bits), x(dimension, 0), shift(dimension, 0), seed(dimension, 0), owen(owen && scramble_seed != 0) {
+				std::vector<sobol_polynomial> poly = __sobol_polynomials((dim > 1) ? dim - 1 : 0);
+				if (poly.size() + 1 < dim) throw std::length_error("Sobol sequence of this dimension is not supported.");
+				//1次元目は全ての方向数を初期方向数m_k = 1とする
+				uint32_t m[bits];
+				for (size_t k = 0; k < bits; ++k) m[k] = 1;
+				if (dim != 0) make_direction(0, bits, 0, m);
+				size_t pos = 0;			//表の読み出し位置
+				for (size_t d = 1; d < dim; ++d) {
+					if (d <= Sobol_direction_kernel::dimension) {
+						//m_1 = 1で, m_(k + 1)は上位kビットを格納している
+						m[0] = 1;
+						for (size_t k = 1; k < poly[d - 1].s; pos += k, ++k) m[k] = (Sobol_direction_kernel::_bits_(pos, k) << 1) | 1;
+					}
+					else {
+						uint64_t h = d;
+						for (size_t k = 0; k < poly[d - 1].s; ++k) m[k] = uint32_t(__splitmix64(h) >> (63 - k)) | 1;
+					}
+					make_direction(d, poly[d - 1].s, poly[d - 1].a, m);
+				}
+				if (scramble_seed != 0) {
+					uint64_t h = scramble_seed;
+					for (size_t d = 0; d < dim; ++d) {
+						shift[d] = type(__splitmix64(h) >> 32);
+						seed[d] = type(__splitmix64(h) >> 32);
+					}
+				}
+			}
+
+			//d次元目の方向数を原始多項式(s, a)と初期方向数m[0..s)で置き換える(Joe and Kuoの表の1行に相当する)
+			void set_direction_numbers(size_t d, uint32_t s, uint32_t a, const uint32_t* m) {
+				make_direction(d, s, a, m);
+				seek(cnt);
+			}
+
+			size_t dimension() const { return dim; }
+			//次に生成する点の番号
+			uint64_t index() const { return cnt; }
+
+			//n番目の点へ移動(並列計算でブロックごとに割り当てる場合に用いる)
+			void seek(uint64_t n) {
+				uint64_t g = n ^ (n >> 1);
+				for (size_t d = 0; d < dim; ++d) {
+					type r = 0;
+					for (size_t k = 0; k < bits; ++k)
+						if ((g >> k) & 1) r ^= v[d * bits + k];
+					x[d] = r;
+				}
+				cnt = n;
+			}
+			void discard(uint64_t k) { seek(cnt + k); }
+
+			//次の点のビット列をout[0..dimension())に格納
+			template <class OutputIterator>
+			void next_bits(OutputIterator out) {
+				for (size_t d = 0; d < dim; ++d, ++out) *out = scramble(d, x[d]);
+				//cntの最下位の0のビットに対応する方向数で更新する
+				size_t c = 0;
+				for (uint64_t n = cnt; n & 1; n >>= 1) ++c;
+				if (c < bits) for (size_t d = 0; d < dim; ++d) x[d] ^= v[d * bits + c];
+				++cnt;
+			}
+			//次の点の[0, 1)^dimensionでの座標をout[0..dimension())に格納
+			template <class S = double, class OutputIterator>
+			void next(OutputIterator out) {
+				for (size_t d = 0; d < dim; ++d, ++out) *out = static_cast<S>(scramble(d, x[d])) * static_cast<S>(__random_pow2(-int_t(bits)));
+				size_t c = 0;
+				for (uint64_t n = cnt; n & 1; n >>= 1) ++c;
+				if (c < bits) for (size_t d = 0; d < dim; ++d) x[d] ^= v[d * bits + c];
+				++cnt;
+			}
+		};
+
+		//Halton列(d次元目はd番目の素数を底とする根基逆関数)
+		//スクランブルする場合はk桁目の数字aを(f a + g) mod b(f != 0, f, gは次元と桁ごとの乱数)に置き換える(Matoušekの線形スクランブル)
+		//末尾の0の桁も置き換えるため, 倍精度の分解能を下回るまでの桁を計算する
+		class halton_sequence {
+			size_t					dim;
+			uint64_t				cnt;
+			std::vector<uint32_t>	base;
+			uint64_t				scramble_seed;
+
+			//次元d, 桁kの線形スクランブルの係数
+			void coefficient(size_t d, size_t k, uint32_t& f, uint32_t& g) const {
+				uint64_t h = scramble_seed ^ (uint64_t(d) << 32) ^ uint64_t(k);
+				uint64_t r = __splitmix64(h);
+				f = uint32_t((r >> 32) % (base[d] - 1)) + 1;
+				g = uint32_t(r % base[d]);
+			}
+		public:
+			explicit halton_sequence(size_t dimension, uint64_t scramble_seed = 0) :dim(dimension), cnt(0), base(), scramble_seed(scramble_seed) {
+				//素数の列挙
+				for (uint32_t p = 2; base.size() < dim; ++p) {
+					bool prime = true;
+					for (size_t i = 0; i < base.size() && base[i] * base[i] <= p; ++i)
+						if (p % base[i] == 0) { prime = false; break; }
+					if (prime) base.push_back(p);
+				}
+			}
+
+			size_t dimension() const { return dim; }
+			uint64_t index() const { return cnt; }
+			void seek(uint64_t n) { cnt = n; }
+			void discard(uint64_t k) { cnt += k; }
+
+			//次の点の[0, 1)^dimensionでの座標をout[0..dimension())に格納
+			template <class S = double, class OutputIterator>
+			void next(OutputIterator out) {
+				for (size_t d = 0; d < dim; ++d, ++out) {
+					const uint32_t b = base[d];
+					const double inv = 1 / double(b);
+					double r = 0, w = inv;
+					uint64_t n = cnt;
+					for (size_t k = 0; (n != 0) || (scramble_seed != 0 && w > __random_pow2(-53)); ++k, w *= inv) {
+						uint32_t a = uint32_t(n % b);
+						n /= b;
+						if (scramble_seed != 0) {
+							uint32_t f, g;
+							coefficient(d, k, f, g);
+							a = uint32_t((uint64_t(f) * a + g) % b);
+						}
+						r += a * w;
+					}
+					*out = static_cast<S>((r < 1) ? r : 1 - __random_pow2(-53));
+				}
+				++cnt;
+			}
+		};
 	}
 
 }
@@ -0,0 +1,5535 @@
+﻿#ifndef _IMATH_SOBOL_DIRECTION_NUMBERS_HPP
+#define _IMATH_SOBOL_DIRECTION_NUMBERS_HPP
+
+#include "IMathLib/IMathLib_config.hpp"
+
+//Sobol列の初期方向数(Joe and Kuoのnew-joe-kuo-6.21201)
+
+namespace iml {
+	namespace rnd {
+
+		//2次元目から21201次元目までの初期方向数m_k
+		//原始多項式の並びは__sobol_polynomialsの列挙順(次数の小さい順, 同じ次数ではaの小さい順)と一致するため, 表にはm_kのみを格納する
+		//m_1 = 1とm_kが奇数であることを除き, 各次元のm_k(k = 2, ..., s)の上位k - 1ビットを下位から詰める(1次元あたりs(s - 1)/2ビット)
+		struct Sobol_direction_kernel {
+			//表に含まれる次元数(1次元目を除く)
+			static constexpr size_t dimension = 21200;
+
+			static const uint64_t* _table_() {
+				static const uint64_t table[] = {
+					0x4009371290A6A503, 0x8C6E2AAE3071FAAA, 0xF33DDFE9518DC88F, 0x2D30257E2794476D, 0xD7A9361FED4758A6, 0x13A965C0486D1184, 0x248EB1ED82F551D9, 0x4DEF81E1A16A45A2,
+					0xFA60DFCA1B14D8F3, 0xB4FC98AB4B07FBFE, 0x1F8796A0B5F048EB, 0xE395326604B20A78, 0x7A39C8E5DCB2017C, 0xB6470C1EA10DEE6F, 0xF7FA8A34910FD872, 0xD65D1CAC26AAA96A,
+					0x2E7081104D8035F7, 0x0B47CB33CF88D582, 0xE5AF3C1C962DB47D, 0x744A53EFDF8352D3, 0xC6CFFA14EFDCF643, 0xB554402B4EF99280, 0x0A50A7706B7497CF, 0xF6FD8077B2081A0D,
+					0xFF18DF902CA06A82, 0xF52051FADB3E41F9, 0x516487949F6E3B3F, 0xD566818C087ADBEB, 0xBE7A2A748803E781, 0x5D3DA68C7F7DAE0A, 0xF849257C702064C5, 0xA9B846D0A7427861,
+					0x1C9D670B2C3B2F3B, 0xB6D056968A3FAD63, 0x3CC87F13C84A7F12, 0x00003AC4E73CF00D, 0x778863AAFCDEC892, 0x7612E245EBC1A9B2, 0x8190B14A1D4DA8DD, 0x3683355E4399FA77,
+					0x66BE382DB39B6299, 0xB63A584AA77FE06B, 0xF14845CA4BD425CD, 0x2F343FEFCC9672B7, 0x0774CA56D9F2B1A3, 0x8022110D3B9EED78, 0xFF99529F281F655B, 0xE0B83369B14CE547,
+					0x47E26789C114C953, 0xEE9F0583F526F1BC, 0x0445D813E4CF4ECA, 0x1932175682F7DCEF, 0x426732BFEAC06A39, 0x8C3C4EDAB7DCF295, 0x659A1A98B0F0CE87, 0x7C8C9CED6CC49E2D,
+					0x687963DC90025B66, 0x4EBB6B75E2A8EA5C, 0x5B73392A865552A6, 0xD61739612CE38D0E, 0x13726A19A7609F94, 0x10F4B87ECD047BFA, 0x24C1EE72A6B97E10, 0xBA704224732F787A,
+					0xA76F4FD3AC503B82, 0x4177C10C2CE7F075, 0xB50DFE328241F6B9, 0x613C740BDDFD68B1, 0x6426F3A058C5F01D, 0xD3389F5949B32F6D, 0x81198006A1291BC2, 0xB6AA18E35E677796,
+					0xE56F58FA515158B6, 0xE03386DD686FD5A7, 0x34FADE9CBBC87E6F, 0x4F602CE5C73244A8, 0xD292F9052C97D38F, 0x6604126B2F96A41F, 0x57E1BBCBE59B178B, 0xA53575FFE4D5DE09,
+					0xD1B5F26BEA6396F5, 0x5FA669A54CDA4008, 0x5ECEA60AD76FE473, 0xB52FE57A3EDCF891, 0x31BDD9F3188E1361, 0xA56B1BCEA109C3DE, 0xB3CB641F831BC4EE, 0x16C986621745C8D4,
+					0x6DEC2F6B87C00D99, 0xD5A39B35B70908DA, 0x531F833605CB870E, 0x65A2B1E0ABDBA23E, 0x6AC0791641D023C6, 0xF72BCF806A41679C, 0xEFBD45FE13B3B6BA, 0x980817E8E0D88C0F,
+					0xC64CD8E8D0CA1C31, 0x4A9ECE1AF8C71B3D, 0x73D7F4C5384A36C8, 0x7969DCAE3EAB5B1F, 0x68630B2F666D03DF, 0x3DDD6A0590D08BFB, 0x0CCF9597A7728EA8, 0x8495801FABBAC684,
+					0xB12CBBCAD2B810DB, 0x7F6932364BFB1149, 0x8B17686AF101AFCA, 0xF3088B470D55B1D9, 0xCC92006DD6196B10, 0x0DCE37FD274564ED, 0xE36F572701DC54C4, 0x01E465093FBF6A6F,
+					0xFD8F2AE438FACB1E, 0x10C16086FFF58E06, 0xDF7C95244B8CA1DF, 0xC8D7793F72209454, 0x32D4D9FD6381C52C, 0xE0B34A6713D98C37, 0x751E46541756188B, 0x5868D8A6080588E9,
+					0x2C515D6F35370754, 0xC4D403F9283757BD, 0x06C9097A52AD528B, 0x4E02735A07625114, 0x5D69F8BA621CA171, 0x67D32F2CEE29613B, 0x932F915166F637AF, 0xA806352A577CCAD4,
+					0x610149E860BB391F, 0x98A0BE340DDCBCBC, 0xB50E69DF21926B05, 0x60AA65178D9066D8, 0x8C031E4D6E98F82A, 0x755B23BC63D52C7F, 0xF720A28442348D03, 0x186357EB8C957B63,
+					0xB2BF95F09BA53776, 0x61C749B7909D4490, 0xBBD9226C3F7EEB19, 0x6B7EAF3E5C268C35, 0x9901AB47EBEEFB54, 0x162387BEC98B2FE0, 0x27D39879C7EF95FA, 0xE2E6FE552D9331F6,
+					0x28AE0AD0B7F8DA93, 0xB24AB6AFD3EC754A, 0xEA96C10BB6C55640, 0x9BF4CCCE0123448A, 0x30FE5DB74450C766, 0xF3D5F46627FA3FE9, 0xDD2954DC57B1E7FD, 0x6516A62DDF73C62C,
+					0x500160C85401E465, 0xE9520D26216A4050, 0x27D24D446D4BF795, 0xED28C3012C9031B6, 0x3FF15CE3B4EF27AD, 0xBFE4642F5148809A, 0x603AEC86C8BC8112, 0x70F26CDD67F4EB8A,
+					0x0630759472F70FF9, 0xC6E7FF7486B3D2A6, 0x3B43CE21724C8553, 0x1E308E12A9265766, 0xBA62213F9E9D5326, 0x109A0CA1EBABAC54, 0x056696D1317AF5E6, 0x33991C2E70662703,
+					0xABD447E0B2F585A1, 0xE274EC1EF97FDF57, 0x10ABA79E543FB828, 0x298D4FE18B1F0718, 0x841A111E9A0E35A2, 0xC04438ED27F1AE10, 0x137EF23CCE45FB3F, 0xD266EF5E5079C9CB,
+					0x83F2A57419DEA3F2, 0x6794BEA2C1866113, 0x26799CB4A3FADD31, 0x60B33D37AAD97602, 0x0D9D2ABE5AA8169D, 0x456DE95E541F9434, 0xD01BCCA92F094213, 0xB552D09FCA1109BD,
+					0xA703117368308417, 0x2A439A142747DF4A, 0x3BEC06EAA0810104, 0x0E064A04B5734518, 0x52BEE66CAABE2641, 0xDB7D9B2B6C3DDEE5, 0x81D88EA2E1E5B720, 0x8D1208AFE10E83AA,
+					0x0120E4CE01452A21, 0x2DAE5A59B436B689, 0x815E6BED0A9BEBC7, 0x6CA31AF733657FDB, 0xC543222A67A9A672, 0x6B518DFD9C285791, 0x4D5512247E00DE3D, 0xE8ED0C49BAB537D7,
+					0xC806F0D2CD61B047, 0x2D0593C6A7DDC5D6, 0x3740D5FBED9EB942, 0xFAA1D0F807C7D7F0, 0x8739FBB086893305, 0xF3A939720FEFC777, 0x884F086E93B23429, 0xA96A9D7E1A8F8E19,
+					0xDA2D9EEEA76AC3B9, 0x83260C11C0FAB94F, 0xE6782D30584BE7DD, 0xD2BE10F35C705533, 0x6A6B6EE7E0D9D755, 0x4731B05A2795E4B3, 0xD72E4252F5B1B0DE, 0x32E1E32631A730CD,
+					0xB2180E66B233E0CB, 0x49B9E89052DA19D8, 0x7B311ACBC951A0CE, 0xEB9C31DAF0B0263B, 0x8649F19CCBF2B24F, 0xB7799A66C742E57C, 0x70B7B989D7A97366, 0x56D7CFDE13775A3C,
+					0x409D16FB6222ECEF, 0x5AAE03E208F97738, 0x47598D218FF32988, 0x2280E52915F9F23C, 0xA8D807A9F0C94C75, 0x8424AAEF2E17B59F, 0x89E5415385365F4C, 0x1A54D3319EE5856E,
+					0x09E6133971AC155D, 0xB9E69512B47BAFBC, 0x8445CA763E1F0C7D, 0x3865343857289D94, 0xCF374CBC750F3A2F, 0xBA172617D573B883, 0x15586F6E41D617D8, 0x29CF23B34F2D1D70,
+					0x277D0A18953AF676, 0x853C07FB4BC55C3F, 0x33B68B6CEAE7E8C0, 0xE82250AEDE6DC5BB, 0x5EA306D6A4F51F79, 0x988C624D2B1BD2BB, 0xFFE75648044C4978, 0x74FEBFD73B233114,
+					0x0FF886795AF80E0D, 0x7269034F70E4E423, 0x9EDFE62DA6E14960, 0x7BF5755A6CF96685, 0x1E4F35D18948BF99, 0x213EB7316FD05302, 0x5A84ED092C353626, 0xA07894780E8C491B,
+					0xDE39B5D755FC5731, 0xE142F44144AA0ACB, 0xD9D9067629E903FB, 0x5F904DC11D8009CF, 0x85441590F659C626, 0x80D540BCF805E545, 0xFFA2D464B8AFC8BB, 0x45EE95570F7C8320,
+					0x97494500F32A9A48, 0xF6910BDA1D9F53E2, 0x57F13682C2084267, 0xD6D2F63F532B4907, 0xEB1BE300997B539F, 0x05438624912E3C5A, 0xFE25892A63F5AF70, 0xA7F52D30AE440381,
+					0xBD44DC998E68316B, 0x199AA7BCDF707AF2, 0x4D376B77BAF6FA65, 0xDF5C6175FBBEC7EA, 0x5D78F8B39990A81C, 0xD6F134E76E687513, 0xE560A94952A5ADD5, 0x23B1A250D2696FC4,
+					0x0A2850CACBB91F70, 0x3E530DED30D6FCDC, 0x83AF203D85924E46, 0x92F2D4D0D46967BD, 0xFD8CBE5292768989, 0x5F21F534F91FAC8B, 0x14480F0E66D5BB93, 0x425C91889F44A2FA,
+					0x45B94BA85FC801DB, 0x6796BAC8B560F92D, 0x46958AB61335E406, 0x61610693485EF4A9, 0x9EDA33C5B987F6C0, 0xD1A18B81B6B75645, 0x7D084CBC47E91B07, 0x97D43EE3198F6D85,
+					0x92CD344905CB680C, 0x484828B514F9C924, 0xD1344AB6BC77C0BE, 0xEDB303A19F8951B1, 0x63786302419F1E6B, 0x19D8303EE355AFE9, 0x2FB7CEA2CDBE4A79, 0x56DF12634A353B52,
+					0xB8A17E00F9D84B9F, 0x89DFA97D608CD56A, 0x6528F23E0A99B2F9, 0x0B7B89E2A8235B76, 0x285361FE17DA536B, 0xF6DFA2A2FE2764F6, 0xCC9CF86767F223A1, 0x7A9A71B536A73026,
+					0xD0EE8BF9891E50FD, 0x1D9AD69447C69E6E, 0x5D7284BDD931169D, 0xF1099D37DEF4AD6B, 0x2E8C310CF2FE9E24, 0xDCC52C93EB80AD52, 0xD2215B38D0B3EC98, 0x327355E793A4F77A,
+					0x1D3C16489D7678D4, 0x776A98B1BC168017, 0xF639E8CA8BD428E6, 0xDBD48857805FD46E, 0x9A05195A3DD2A1E3, 0xB205E7F56DC5EAFE, 0xE6CD6D5D576C3597, 0xBD25AFF3A1C69CF6,
+					0x9E787D7459A36759, 0xF8838D723BE539A1, 0x85C58DE5EBDEA720, 0x4FAD57F7DB2D0D64, 0x27FCABC26E8EDE68, 0xF5F8BF92DC1959E1, 0x01ACB64FE6ED81FA, 0xEFB21B1DC6F02E83,
+					0x6B952E3E2237951A, 0xDAEA2FF1BA64B0DD, 0x50C5E5576B19DC9D, 0xB7183FA233F1CCBC, 0x94C39417A411596B, 0x9D67DCE7FACDE732, 0x8796EE3D0EE267AC, 0xD670F392FDBAD4AE,
+					0x3C62EA32E97FBCE7, 0x7E2B0C4CFF663A65, 0x7FFEB2F34C94E994, 0xB969C12DEA5BBAE4, 0x8D97783C9791E874, 0x3FC571CC1385A09E, 0xD3FDA1AF310D0C31, 0x9DE10D5DE2F5E809,
+					0x0ECA91DE2981850D, 0x72E610E216CF49D9, 0x366C17822FF525A5, 0x4AB6679D8F81817F, 0xB9B504CA75983D91, 0xEA74D76FC5BC6C62, 0xC7861AB0CE122A5F, 0xDCA7A012DD40E785,
+					0x229C36B5C6891D05, 0xF4819BE74009C815, 0x68CA503F4AC9323C, 0x43AE1056C0F1C850, 0x96062A00DB05B90E, 0x8044D1696A829B0C, 0xD1CE7CF15D218947, 0xE8D3A34D545485D3,
+					0x010B322BA32A058A, 0xB28EEFDD605B9BD5, 0x1CA66C35A7A389F7, 0xB5796AD03E9B4A9E, 0xC8FC9ECD16CC0BA8, 0x3D0A82788808B6FD, 0x6854C850AEBC9374, 0xD4A7C40262547262,
+					0x33C3010846E3459C, 0x29508816F8532460, 0x35278507138BDD6A, 0xC0FDC4D725B62D49, 0x2C547982616B1AF5, 0x18906B5AA03B6EDC, 0xF004B0236E3A1835, 0x401F87742D96EE3C,
+					0x2CB4D35073310E62, 0x6898EAA477E9D7D6, 0x416CB4FCBCE07641, 0xA21E19E2A9A74B78, 0xD5043B549A316AFD, 0xD6E9BBF9B9FE7E34, 0x4768142788D7BCC3, 0x07225ACB02AB3A62,
+					0xBF7B313DC7959356, 0x087B471503563F83, 0x44877BDD0E522784, 0x80AF0BFDB2151032, 0xC830D331945820C3, 0xAAAB8AD74B9D159B, 0x983A8A62539D8451, 0x227D4F9E46C49160,
+					0x7D6A0DD4FC8FD776, 0xF127F7DD94C0491D, 0x65A3D2E830F3CEE0, 0x652EFF7875F6BE9E, 0x9B4750C44AAA1A42, 0xE30BFED6AD5B84AB, 0x0EED95481FACA229, 0xC9A30A455E0B6579,
+					0x5FC4BB7FFCD87251, 0x25065056735E128D, 0x475E3E86717CF109, 0x1CEFD7E0C8288734, 0x8BD2A451755FD948, 0xCB66A54C4F71E432, 0xDF18C3563A697732, 0x8E4E33DE8D686EC1,
+					0x0C863D66A3BE99AB, 0x8109C4342E7167CA, 0x87B47BE1DC51008B, 0xF9CB747665947034, 0x58950EC9B82FB224, 0x452D9D60702C9804, 0x04FAFD8F9143091D, 0x159D2A87A768E5BE,
+					0xEB70531CDE18F380, 0xD3D11A738CF70B3C, 0x6BE16744F49CF158, 0x947D250F7B8A93C9, 0x98675F18EC431713, 0x0C818D07B8DF5B47, 0xDBFA837D52FD6159, 0x99EA09DBA8903DC0,
+					0x562A2FD44263019F, 0x946AA23165E2AA22, 0x128297475BABDB02, 0x50B417917D3DAAA7, 0x5E94F5BF8D5A3B2F, 0xB3E14B891D1777E7, 0x941FA59296CF257E, 0x6A4C2E48F23980BD,
+					0x620D72A7F435EBE6, 0xF9CA13B6D1665470, 0x18AD80F0B2C60C3A, 0xAB5F72139F5307F4, 0x64F30B5571CAC610, 0x9B2C6F0625E411BA, 0xC4F03185F8F2D7B7, 0x1A2E35B7B93A002C,
+					0x990AA44FEBF98955, 0x591598D3ED43B124, 0x61F7CAB7B4FA9290, 0x5A4AD6D986920D54, 0x608503FB2259F2EC, 0x7FA88DC320050817, 0x8A3693DE33188170, 0x522B2BAC2D2A8BC4,
+					0x3EE4EBCB70759680, 0xC976D56DD2FDA7A6, 0x1A974D007BE0F0E5, 0x0DF0B733A4D5B05D, 0x0A93C35C7DCF509D, 0x70541D4C986B157D, 0x10E305E763F6131F, 0x76BF92600FE90605,
+					0x5A8F6C8CC0F2EEA8, 0xD7180C292206E128, 0x968B7A0C015293D7, 0x0909BF950703DACE, 0xBF32F2A377224C06, 0x8159440CF10A80E9, 0x379F22A9FBBADE08, 0xF3CD5930D6C94DCE,
+					0x52576A222DC7D116, 0xFC914969FDC95028, 0xAC62B7B3A2B35FE8, 0x618077853B7BC847, 0xC3DB643CE174C8B1, 0x68A6B350B4D474EA, 0xC61D0BCE0F60C501, 0x44E76A902F4E0F52,
+					0xB77D717641ECA83A, 0x340D827394349E00, 0xAA8612431B4A1ECE, 0xE156743C5D8DF3FE, 0xEB597B9CD264B969, 0x32C5DA86EF305893, 0x58F8E36A81543531, 0xAB4B60F4304A76E3,
+					0x994169B54EF2257B, 0xA47A209BDEC096FF, 0x77EB953B0332ED59, 0x6F1228E99EFB9C53, 0x9CC49FE42CB01324, 0x2DF70AD1718F88A9, 0xD2B8E1CEA7C88F9E, 0xB7FC374CDB0F5097,
+					0xF47ED4F541667C8D, 0xF4EDB3790FACFB43, 0x3A647B4A32514451, 0x69A30B7AE14C397E, 0x1F8751E1137F323F, 0x4EE29293D8FF2FA0, 0xABD2424D14555BEA, 0x7FC625C903272AD9,
+					0x54F233A1FE1559E9, 0x542D78EE1FA7F933, 0xC8E3147518522D0D, 0x106CDDEB0EEFED33, 0x16EC4DE007C9C030, 0x5D08B15C0D6794B2, 0xC309AECFE18E3034, 0x1D94D5FB8ECD9B86,
+					0x5BA76496ABEC8217, 0xEC3B8F8DDC16FB47, 0x5E23DE6F5318F94E, 0x9377225661ED3D58, 0xFFD31E701F8BA9B9, 0x1EE93FCC396B8169, 0x80AEE890507D3182, 0x804F94317F1DFC8C,
+					0xEA8192B0AEDD512B, 0xA867DA90771BED38, 0x3E31BA8D0F9AD163, 0x83222E4986C7DFEA, 0x0656E635C95AE367, 0x771144C52B30869D, 0x875502489374928D, 0x309426E25876E3D8,
+					0x0338D3C70CE37AA5, 0xC0CD27E5F8A82CB0, 0x294080D655C2EE1C, 0x28F50B125CD2AD2C, 0xAB9B76565774EA45, 0x1E716666B30905CA, 0x3AF1ECAA1E4E8F04, 0xD7583AB83B819B45,
+					0x9F977F4B58E378AE, 0x50A7AA0D36D59E0D, 0x25C7D657DB3F957E, 0x17F825CA06DBBF2D, 0xD56AD6C0BB7039C7, 0x2AC2D7B9EB73A9AA, 0xF81C81BDF26D3279, 0x23A6E0A7BB07F7D9,
+					0x13EBA55DA5E72C77, 0x7A480653944A8EFC, 0x5F93F2E271471BF0, 0x70E9273918E9878B, 0x1C7D95183C966014, 0xCC9DBB392F83E1D3, 0x9E639F4E7F5A7E48, 0xF8B4768D89D7C676,
+					0xD89552ED794B564F, 0x66AEDEFD28854F4C, 0xD98B78F62DBEBCE2, 0xCA4EFDD91C55D06E, 0x8658C0842C1C03FE, 0xFCB735C32D7704EC, 0x75CA7F12617AC872, 0x19743DE32FF8E6A6,
+					0xD92E3D6843C545C9, 0xB74172D96F1B59F1, 0xE13DA367547204C0, 0xAE467E6FC6F7C622, 0xD8196AE1C22CDF74, 0xD3FD0108ED9701BE, 0x53EBC1972357854E, 0x462B6063F63019DD,
+					0x09AA000D7273400C, 0x3C76465A6B2BAB51, 0xDE9232AD159063C1, 0x21CD4CD2919C5D2E, 0xE445CA04257B5211, 0x730501B3A78F31C2, 0xE9E499D396C2E2C5, 0xFBA319FF61F8C40B,
+					0xC456F49BA15B203D, 0x75463C835A0183F5, 0x646200E0D42BD151, 0xEE4C2FADA43A90AA, 0x125A5EECBD41F502, 0x8AF7763DF8123D48, 0x5167074410DFFAAF, 0xB84F92A435D66148,
+					0x0B388AA5628E2C5C, 0x51DE63D44F6E94CA, 0x8C1EE336A5DEEE0E, 0x8C915DB599462EFD, 0xF14293C2BF27DF19, 0xE3A300F9F11D9F19, 0x7923D0E7833346EC, 0x512E6BDC25338C09,
+					0x8496802401621473, 0xA5557675407678AE, 0x108AC6EDF6A7D404, 0x71B884970AFD07A0, 0xD4AB6B6C12568768, 0xB14CF7F25191CBB5, 0xC6235E25D77A20B7, 0x438BE6805899EBDE,
+					0x9530744FA78F533A, 0x2D77AEE52023A639, 0x9A38867819E30C58, 0xF77DECF0F9BDBB9B, 0x1D60FACDCA245DF8, 0x9497CC1A1822D2B6, 0x37360EBB3D715729, 0xA95828E67BB3581B,
+					0x2D3877418CB41737, 0x35F27274FA216FCB, 0x98140F7F3898071B, 0xF21B529C0025C849, 0xAF4C510C71AAF648, 0xD72485ABCCE668FC, 0xE718EAA41084F517, 0x4FCA36340E5EEC0E,
+					0xA9AF2C8B8AEB008E, 0x7CDC7B89921E6840, 0xFEA8491C0CC2C947, 0x46EE3D1B6C289DD9, 0x8CC50C35666EAA55, 0xE40E3F38A3F7F511, 0x8422A644F0F9AF98, 0xAA840A9A22FB48BE,
+					0x6CCED262B7BABCCD, 0xE1A82D2D97B41823, 0xE8329EE9545776FC, 0x43AE6DD9867617AB, 0x561418CE22CE5E86, 0x36930BBDE6F73B09, 0x88C208FFD430E04A, 0x142A46269B78C869,
+					0x78AC8B089F89921C, 0x8EF1B7163BCA382E, 0x5F67201D4FC0EFD1, 0x40FFF9F2F8F7C2B7, 0xC26DFD91444D309F, 0x80B96BE747648E7C, 0x2CC42938B038CAD9, 0xBC47F4B2B75E15BB,
+					0x8D5B186CF0ABA2FD, 0xCD01DFA73F2FAAED, 0x0A9109E072C143C5, 0x0483288270F8201A, 0xCD731DA908884CF7, 0xFAFF6B024CD81D84, 0x69CF4F0DD572601E, 0xDE40DF23219722AC,
+					0xD523EABA36B533FD, 0xFE921BE02F7FD112, 0xB0738B82AC81E20F, 0x9FEA7DFD93CBCE29, 0x03D9ADC6E28207F0, 0xAAE142ECB8B846E2, 0x1E5A15E72B8C0834, 0x577486C38319498C,
+					0xDC8B5057378D4CD9, 0x8E5337CDE7F533C2, 0x34F6563A90CDA16E, 0x12271D53E94951B2, 0xFF967A47186421A0, 0xBD4808D8C6A08089, 0x94394ED031DD461C, 0x841BBB0894579B6E,
+					0x11EDED9A55AB3473, 0x65F56E318ECA20AA, 0x59B3D259FD523ED9, 0x802CC918F60FC12D, 0x7760195523A4EB0C, 0xC1111B5B7CB45D52, 0x468D59844E2A4B3B, 0x45182EF6562CB70F,
+					0xBC3AD55B1F5472F3, 0x804A2317B2533AC8, 0x85D63E9EE9308C05, 0x8467C23C1292FEE5, 0x988BCE13BBD91EB1, 0x51BBB4CEB3614FB4, 0x17BD37FDB8B6835D, 0xB492B0334512D38E,
+					0x27C529BDFBDEA5C3, 0xCB8D5F7B16D4BFC2, 0x35A71A6829A36A93, 0x61FAF43507E4631D, 0xA95793D1731ADEDD, 0x4048290BFA632069, 0x84F930F598C41D59, 0xC9E88E0EE2422D9E,
+					0xE8796FC2D2B84514, 0x11C6141A22AD04CB, 0xBE87425666E633B7, 0x5B260DDDE055F2BD, 0x4C4AE7ABF7374E4D, 0xA05900B3F4A2FADC, 0x0B5B4A0AF81CA926, 0x420BFDF35F7E71CC,
+					0x79BF7351E6CF2082, 0xDA0B9703F6ADBA13, 0x076DE39FC92F87D4, 0x47F3AF3EDE0E6305, 0x40816DE5CDA31451, 0xBFF845D9E3692E4D, 0x01A5BF45E69DFFF9, 0x515EE18780AA5304,
+					0x0978B7F9C32524A0, 0x478A3858C9D8EF3F, 0x8121AD631AD5E214, 0xEBCA45F7D4824927, 0xA4F11287FF4B7B76, 0x2400ABCB52DBB3D6, 0xABEB901A42742091, 0x8087C82050A57753,
+					0xB0260D8266F67213, 0x28E0F4616836FA8B, 0x6B537F5C50A6D142, 0x6CB65A2554728DA4, 0x11612011024F6739, 0x8F59C4E4A7A853BF, 0x0BB39DCEF8890F75, 0x3027298B186363B2,
+					0x419512EE292C1D64, 0x050BCF50B91E8DC9, 0x14BD03BD0CA9A967, 0x4F62FDE18B355277, 0x50B350C27BA0B49E, 0x8A0D6E5B6A9A7AF8, 0x5B3980CEF777C070, 0x1B0169D1DB0749B9,
+					0xE48367C1F7F333B9, 0x5545BD8E7EC3F34C, 0x15C9C86E67E83CB2, 0x7FC8DEC73A8D88CF, 0x20ACD68AC71CEA32, 0x0BA767CB0C9D240E, 0x42BBF731CC12CB25, 0x1AE64DD886B06D41,
+					0x561F5AD17917AF88, 0x69F2A6699FD49A22, 0xE8E4BCBEB8248EDA, 0x835721CE229804B2, 0xBCCDB37D793A918C, 0x8BAE92EFBF58AA06, 0x1A29901696DAD12F, 0x3F18094CB1F976C6,
+					0x52FDBB6179332305, 0x1A9372A6DC5AA0B0, 0x05D04F1811D7C393, 0xCD019A62FDB77231, 0x7BB56DA5A03537A3, 0xF7FC96EB61975CD6, 0x70981FB40ADE632C, 0xFE1238B457121C90,
+					0xC0BE11130537F73C, 0x4DBA9154908F732B, 0xA2C3FBABA46F9A1F, 0x9E2D758F2F89D249, 0x0B0080EF0A54CE37, 0x237F45C9778F6D3C, 0x9ECB0E57005371EA, 0x5C0476E9E4B4EB13,
+					0x429CEEB04E31B10D, 0xA218C53FD9A963DC, 0xC9D0FB4517E17325, 0xCD2AEA35137CC074, 0xA0F196A8C3CCEFBE, 0x37A95D2FB9C207E0, 0x6F531852EB40AB98, 0x88C2DDBA32837DD0,
+					0xDDB5B34FB5FB5D06, 0xFB8787114DB4FE4B, 0x27BB07173B21C4CF, 0xAD060AD804A51E7E, 0x04DB732F18B6DC28, 0x6B775CD4F2E5E9AA, 0x89A87257D441C931, 0x6E12F6141EFCB17F,
+					0x698533E85B1889D5, 0x611E3FD71458CF78, 0x9E9AEFD061A505DE, 0x5C06E98740B59636, 0xD56589A9B170823A, 0x4223170017EAE32A, 0xF1CD3662F5BC92DA, 0xB5BAF638D8021FA8,
+					0xA956174C3B007446, 0x6E6B5A1D01E2CBDF, 0xE9DE5F77BC0BD07C, 0xE171909639F2DB01, 0x2780E267FDB4C00D, 0xC2FC3C4BD82E4630, 0xAFD3DAE8373DA60E, 0xF3C8722BF0FD6581,
+					0xC3C8803A1EB2B826, 0xA87064FDEFDB1456, 0x5D0349B972C3E933, 0x79B784ABFB289138, 0x6CE7028DDFC70EE6, 0xCAC316AB0D789B92, 0x64EF75C7B071EC43, 0xBC0BA1190A14612A,
+					0xA577537DA8BCB8E3, 0x6608C686392B56C6, 0xD68D83D666C2DAC7, 0xFF869526DBDC0565, 0x3C66C1560CCD044D, 0xFB8AB6F59A771E10, 0x6271BBC9314B6B9B, 0xF559ADD177C06771,
+					0x7C54BF6F7B0E5A43, 0x207497C5BEB940FA, 0xCBD2CE7DB3C55D65, 0xD2336BBEBCF20FD6, 0xD87583A33FC10679, 0x1CBBDD6385657C90, 0x7723CB9ACAD43B5D, 0x6530A91A1B8C7EB6,
+					0xDA1FBA772524B24D, 0xFD5CADFFDBE93A20, 0x0D120BCBAC41B076, 0x5F186D0ECBDB1C5D, 0x4CAC0939D2979033, 0x573E0B916644313E, 0xE13FA0B1AAB54DB5, 0xE9A95A8648CE8690,
+					0x91B51B2714975E41, 0x22C976AF9447710F, 0x3CB54C8AE5D12A6D, 0xF5A908D6722412AD, 0x913ED25074B5F9ED, 0xB6C1BE8B4A354FAE, 0x9E47EA70C5793FFD, 0xC348D1F75CE58CBF,
+					0x9FF719BF8DCEF717, 0xDF8F1590CEFFE587, 0xB741823F897CDAD9, 0x126EEFB70D67B039, 0x5A81E0A0368BEB2E, 0xF4C8CB87C08B8436, 0x7A5086759436B2E5, 0xBD3C465A6F56CE70,
+					0x840C7B4523D01638, 0x317565BD8079EAF9, 0x4E39FB18799F9F7E, 0xB596225ECD1A1E21, 0xDFC7D132702AFBE1, 0x6F705AEAC5331049, 0x89C79FC1449D9645, 0xBDA8106D2D783E35,
+					0x303F57CB5B1EAFCB, 0x2A56A9EC0320F768, 0x92520A97EEA7894C, 0x920E5B50C29DBDC3, 0xA6086B24C63E8F55, 0x9715CF320A0CBC08, 0xFE49C620021B295D, 0xB9A2817A7FDBEA15,
+					0x2E2256727E0A2F75, 0xE78B08052EA595F4, 0xE145288BB2B62F95, 0x0E1A4FA09B848314, 0x46EB1998D86EA2C9, 0xADF10C24AC6FD895, 0xD89BC6AB9724DB7F, 0xD3F1A3DD3E304928,
+					0x565DC0661720BE07, 0xDEAA8F1826DB3A65, 0xB9A0B6C0EFF4159E, 0xBB7CDDDA1A343707, 0xF4F7D2E938018B7E, 0xB408A6DD48665A51, 0xC498F284266BF5A2, 0x735D2C2C46569C75,
+					0x1A7C849343CCA98B, 0xC7FBCE18401B55B5, 0x4130FE25681AE2B7, 0x5632AD87064D93C5, 0x4D20EF1EF6865A0B, 0xB4AE03927329873E, 0xA919E87F347A8ABF, 0x5BE7EB89DCF4C0F3,
+					0x12AC82917BAED8B9, 0x64C287E31EB3AC1B, 0xE832CC3FA91013B2, 0x3EB10A02D7EB3C16, 0x4960BF62302109E3, 0x795924257A0DD1B7, 0x9337E15E779236BE, 0x585E750A38762E92,
+					0x3773211D5A7D6FC5, 0x3B8BC6C2EF22D05C, 0xECA0F082EC7009AA, 0xCA6ECDA02D184CBB, 0x5C7A3257D0F9DF8B, 0xB07E23A9E2603149, 0xDD0F0392397E2BEB, 0xBAB7F270486DDF02,
+					0xF1C07C07D232BAC1, 0xD71C342460B95AD6, 0x29C5285FF550C942, 0xAFB12D251581D079, 0xCB7AB3D2A5AF4BF6, 0x60338890E430079E, 0x86DC833F84E8400C, 0x3F9A49C21958F3A0,
+					0x80D504ED5A19C589, 0x8C07D8F1E16A6133, 0x7F4850A0F7802DB4, 0xCC6A9E86C39B33FC, 0xE4B71284C4830038, 0x32CD3D1DD545ED46, 0x5E0694F14DA258A4, 0x528C7CC81E6946BF,
+					0x68A53252F9697956, 0x9B597314688CECE8, 0x154AACB7C35F7E9C, 0xEA95907AC0EA6951, 0xD3A92A927A1A8882, 0x8CDC193E698F20B8, 0xE591B212BF6899A8, 0xED8E13836BF894A7,
+					0x711DEC0F2E6C7B1F, 0x29C80C3AB0735B7B, 0xA2C42B08A2DC5F4E, 0x164871ADEB713536, 0x4004BD4E33166721, 0x5AD727C5D5CA5991, 0x92670D69BFC72347, 0xD73EC077175E78BA,
+					0x1A764060733404D2, 0xEAC83FAB4E8270F5, 0xFA815157A96FC7D9, 0x47BA7C5377B8EA02, 0xF5E5018F43A237A9, 0x471FA9139C6F81A7, 0xC6019EF4D9DDBF54, 0x7D460BCFAD0C7EBB,
+					0x52E1CFC3C7819E76, 0xED73E0E3032227B0, 0x857A3E2E0EEC2268, 0x9CEDC6CE1939159D, 0x8A4DA474C11461E7, 0x05C6AE6C133A02E2, 0xD46EFED5FBEEB077, 0x33E6C7131B0C4E88,
+					0xEE3F68F009DD970F, 0x1B8D61B877E79D31, 0x7E63AD4888DDF6BC, 0x7B31E02C98AE5803, 0xA4A5B38E40C6D21C, 0x1040571E3CCE1E58, 0xB87451294C6D0EEC, 0x7F49BD8D76B2D463,
+					0x15283DF7EA282427, 0x570D69E7749D8808, 0x047B4CD1D87AEEAC, 0xA66D69D20926DAB5, 0x55DA2CB80F8FC384, 0xAC26B7554FDCDB6F, 0x80AE7388E0C34CAC, 0x68CF86A7B056EC96,
+					0x51696303DEA4ED7E, 0x0C75232BA66B3165, 0x30515FE9C8C00716, 0xDFD3A9B7CF14CD4C, 0x88880C38EA28692B, 0x28FE0D7024446200, 0x82486D75B04D1D97, 0xE72E7E2C211AB405,
+					0xB0CE85F7FED53149, 0xB46EDBD932234738, 0x715F427890CE6F2F, 0xA80F4AFE1894A3AE, 0xC679628C66130053, 0x091BFC1604ACE654, 0x432B67CD62D8941D, 0x5DA20B9AE1F619E9,
+					0xBCE458F68A04A987, 0xFD16F9CF13340212, 0xCED2B02831C2C47B, 0x9FDA84F35BB521F9, 0xE087BE5927BFFA31, 0xAE722D3367B30A41, 0x046AA03F76A4521E, 0x9DEADAF2E83E0761,
+					0xD360E6D2B98DB9FD, 0xE94A4BACDE3ED280, 0xD3C512A49A6354BA, 0xC86A87462970B415, 0x343DF6A5D2AA5A7B, 0x523085610C022DDE, 0x799607A061DC1CC9, 0xF981B3A8871DE022,
+					0x4A0533D8B384FC70, 0x7B95D55FAD9A0659, 0xB044A7579577B05E, 0x5DB2D9258B586BD8, 0x35227E0A392819D0, 0x6A618BEC711A77FC, 0xD0358D1D8768CAF2, 0x84C5DAC3AF7BDC66,
+					0x5BA7068DC9D2B928, 0x45026D5385E3D308, 0x20A221F9844728A9, 0xAE2133CA3BCAE7F7, 0x82D58F4038109FBB, 0x549B6898DEC84B30, 0x51AEE56D90671D26, 0xA6AD8B881014856A,
+					0x39409434DF3AA64C, 0xBE237AC16F1A52B8, 0xB7CD44E3791E4EFD, 0x6E2B6921A740B917, 0x6ED49A8431EFA105, 0x0ECC59B5131B80B7, 0x416E5766EDC80186, 0x2314136CB222CF4B,
+					0x9F89DDCBDB5D64D0, 0xF82C0A248C46AB73, 0x60BF05888847D786, 0x98F40B0A10948C98, 0xAEF32F7540419B87, 0xE28C1AA032C7F843, 0x450853BC6B434760, 0x25CE3801ACC5E771,
+					0xEB190D81105A1DCE, 0xE3FBD29FC6DCE5F2, 0xA133B722E2AA80CA, 0x8A40DF1263B1BC9F, 0xB280D0F40836CE54, 0x1A289BF99D0895FE, 0x194F2A852E69F4BA, 0x2F0A3FE0DDAFDEC4,
+					0xC5590A0197CD480D, 0xAB67CAA50707E10D, 0x4547C42A4652D5E0, 0xBBCDC4385FE701C5, 0x68960475720AAC17, 0xC7F8F6F91C686883, 0x457AE439A2461872, 0x4E3F198E689A7217,
+					0x7B769A8626F04CAB, 0xD8DA3C18DCEB16E9, 0x60ADDC6DF9A724B6, 0x2B2FCC744477353B, 0x157B8644ACC8B24E, 0x5948FEC18E4A0B65, 0xE5F045D267E7E7EB, 0x4B95BDE0068515D4,
+					0x50F9B0E8ED3E23BC, 0x37B0C55952434F58, 0x1E32862C63A11ADD, 0x74389D5C7CCADC8B, 0x485D36E6D3C11525, 0x345D6F5225047212, 0xEECC7F5E0206749D, 0x9B5621BB96C08066,
+					0xD603A3B6856DB81B, 0x745678B6F2B142B2, 0x2A972C7545F7B26C, 0x481674497E264AC5, 0x99A11D0A8AC0DE99, 0xAB1476E997763E2D, 0x4E972857F8C40028, 0xCB6B3B675E952704,
+					0x01C8E7112614344B, 0x4BFB7D290574355B, 0xA5B86D9FE092F657, 0xEB882F75C52A4BB9, 0x7EBE35700EFD52C9, 0x170DA038D914DBBB, 0xD83F576E5654D882, 0xC4C34EC843F9F3B4,
+					0x40A3D5FACAD876A1, 0xFAFD6400141C5EAD, 0x5CD0B8B581FF0A8C, 0x38FBEC1649C7385E, 0xE2480304486D8DE7, 0x2ED52C81266ED1D3, 0xA63DF09C3BE00926, 0x2ABA03AF3143A88C,
+					0x023877878F4F0578, 0xB94322E74DC3FBB9, 0xCF335CB61DB661BB, 0x16E7DF5E90ED341E, 0x9C53DC5E34592226, 0x116C8B31333D1831, 0x240C10C75DC4D914, 0x6124CE8C16EF75E2,
+					0x0448ED8D28B4730D, 0x7731DA68CC388A32, 0x0872BF5146F5E80F, 0x3496C368F96572EE, 0xF6393E7B4F48C480, 0x895DDA2814E4311C, 0xAEEF9EA158328015, 0x4FF703FF3CF2C18A,
+					0x7EBDF45E4F037A54, 0x8AACBDB24B9BF893, 0xC2C499282AFD0B1A, 0x0BEBA45542533C7E, 0xC930B31FD9636C00, 0xE86CAFBCE09DA3A4, 0x02BEDFFC61433A8E, 0x4DCB24E2762B3698,
+					0x8F0EF0B8259F733B, 0xDDE8C5106C11CB74, 0xF1777CEB756A54C6, 0x4E38CCE6F60A5A46, 0xA457203F36461D2B, 0x67059597E85A946F, 0x221C27B16D1A3A46, 0xCA319CBA72A2A1E6,
+					0x48866AFBB2BF50B5, 0xD8DABCAB7740397D, 0x8AAC4F66D2C37C9D, 0xBF3BBE1D66EA1D48, 0x525EDF4055A10A67, 0x71FD0F58B2D3F39D, 0x8381FCD0C552C34F, 0x637F6FCF641DF73A,
+					0x6F3F755CFDA0F460, 0x12C94EC055E4DABF, 0x463FA5949804C24B, 0x52ECD2EA56846C43, 0x08C4C17B0D8D4495, 0xDFD9D61F42B46EEE, 0x76F5F8EF320CA96E, 0xBB9A1F7F5E942FFD,
+					0xA290915D68394672, 0xA3DA6CF80D82C225, 0xB7C08A5C95722AAC, 0x54ECFA372F888A47, 0xB523FEED6CA9EC33, 0x472576535ABD67D2, 0x16A70A8F6EE814D4, 0xE02A7B207234E690,
+					0x384EAD2A33B22547, 0xC3D06B8AA07FAE84, 0x1F5804B08D5967D2, 0xC89A110E202A98CA, 0x4E3AFE64117AA603, 0x7B1F54AC64FA460F, 0x815E2710B209C535, 0xE702F40D032D915B,
+					0xE08C4A66E8CFE6D1, 0x76C3928D9A9E8F1F, 0x9EAE46C11F5194FD, 0x41A8F8EDC1065B21, 0x37489C685954D0A5, 0xA498525D52553BB8, 0x879A1913561D6043, 0x53265A9DA4304F8C,
+					0xB4D486FB51A98BAB, 0x24ECA8D36A833904, 0x93FB3D77F4C11936, 0x41935A6642DD5401, 0xAB3291AEB3AF4741, 0x53C51C111674AA77, 0xB0FBED94F112CFFC, 0xB6E9E2CA40E670D8,
+					0xFCC9BED041AE7638, 0x14BAEAA42B58A68B, 0x240AAB8F23C731C3, 0x9BD78CE0D02CB322, 0x68DACC82771371EC, 0xD0B75F5F900997BA, 0x7F708825EB828479, 0xDA1F0293659E1CBE,
+					0x0310BB10BFAF3B14, 0x52B9B7C9C51A461D, 0xA8E9908A453E8D74, 0x6C770DB890CC62CE, 0x034320ED13A44A9F, 0x70A650451405F816, 0x381EAD33D579799C, 0x162D0BEBE8F33C13,
+					0xF1D84084A61A9E67, 0x73F097B550BAD9BC, 0x26DC509337504167, 0xE8A5B3A5BAB1F094, 0xBB1A17E032548B7A, 0xC37B82A3DD5F93F9, 0xCEB9E3B29EDB6268, 0x8751721D652A22AC,
+					0xAE43C7598025A81F, 0x27188AD994805CD6, 0x1C4133CF87623C3A, 0xF006D117B3BFE55C, 0x20CF6D6A3267F15F, 0x7D32D6C240545A5D, 0x8DAFC9D4E31B4A51, 0x2D14F58564FD8391,
+					0xAACDC66E5ABEA88E, 0xB279A8CD98D2309A, 0xABEFDE8C7235FAE1, 0xA22D1938031C613F, 0x2801122C7234EB37, 0x89AB93D5E53D8EFE, 0xEE2AF443748A12E7, 0x2ADEBF2A704FD284,
+					0x780FDA94A73257B5, 0x50A51E27E39A4CAF, 0x6BDE2742178FE984, 0xC77E3F82A4CA6F9B, 0xCE966C809D8566E8, 0x752E51C902EA64C1, 0xD5B4B1004A73A503, 0x1DC957E28AB66F18,
+					0xD83A670ECA7248A6, 0x9DA4AC5D3CFE2F4C, 0x62E9C25BD336FD6E, 0x5A66192AAA20D4D5, 0x51C26700A33253CF, 0xDB15EE0D05AB3CD1, 0x0E7292414858CEB8, 0x20C32223B98DCCD8,
+					0x79AAD9AAAE5CFC78, 0x60CCCF85E95B9F86, 0xD08B9EC94F2DCC2C, 0x79DC2B60F3BF5533, 0x638604EE7FDC441D, 0x868C32F8374D2F6A, 0xF346F4B212248E6B, 0x764C9C1304FB74E7,
+					0x30010A15392C29D8, 0x37E13263B40F726F, 0x0085985911B9EA20, 0x67F53FB251B821E4, 0x347A7CCF974E874F, 0x715CA57D82AF8F86, 0x3DAEC03C41C27165, 0x73E216B4AFE1460F,
+					0x7E000AF7E12FD028, 0x84EA218F00011DB4, 0x39DBE5ACDF7AB408, 0x77B483E4709C4B3F, 0xF6E26FA53BA76B8E, 0xE5690DAAD3287DE7, 0xF5F1A1079F400D0C, 0x579FA1CE3603CF92,
+					0x3DD688EFCFF2D925, 0x61277E3509B418CC, 0x054D64FF9A0CF1BA, 0x6306095382FB431B, 0xF7D0EE25DC8E591A, 0x84B21A739F837139, 0x314C855C6270E61C, 0x078FB9BCCABC763F,
+					0xA2143B4DA3B0710D, 0x3891A6EB64A7153A, 0x446FAED40EAE556E, 0x97AFA6D6BFEF6531, 0xED1EC8CA33169C4A, 0xD4D8F7455185400F, 0x74EE4E7C7FCD72AB, 0xBDE11F133C7F5F82,
+					0xEF505AF0592E806A, 0x9804CA46D2E6F265, 0x55428B2682D1D695, 0xE31068AEC01185A1, 0xB13B147327F0738F, 0xA6FB9536F631F0D4, 0xD35735FC143432B7, 0x5934F05455994700,
+					0x840228316A8EE25B, 0x21FD8F243E0E8DD8, 0x2843C648EC8F1DB7, 0xF38F99FA6B529C60, 0xB4C24AFC5256C13A, 0x24B1E1A684EB97F5, 0x25F70AA32EDFF3D6, 0x008FF6ECB7B08CC7,
+					0xBCCFD0B70B485980, 0x2DCB668FB92CAEA7, 0x90C64DEAFD33F11C, 0xEC18003364210187, 0xFD92DDF02416D563, 0x1312CD1159AFB18C, 0x070E3603036D1FF3, 0x1D44CE6F8DCFB6A7,
+					0xE58F5A4E8272358D, 0x6D69BB8212E1BBDE, 0xBCAC45BB60460D58, 0x3D1A220871D0EF9F, 0xD17C38469C0F8F9B, 0x8DE4A503A5507AAC, 0x9BD3DBF7F19D41C4, 0x7971EB876D37537A,
+					0xF9C41630E226FFFF, 0x0D4EFA36593619B0, 0xCE4B5B3FABED0D24, 0x143CB5585C54934C, 0x9478E6118800B169, 0xCEC2E4F648A1CDDF, 0xB4D6C512E0A93A11, 0x7928BDF38CD08FB2,
+					0x5C5F0269D987E8A2, 0xEEB379D429B09949, 0xDF737FC4B366B043, 0xB7C53AC39B5CEAAB, 0x19495A0E6558EC38, 0x1E7BE7D4A25AC8BC, 0x27F593F93E92ABFF, 0x5D06C25867DECDC0,
+					0xE29232460F8A65D7, 0x79D79E7642F529AB, 0xE3AA92FF5644DAC3, 0xAC349EDF7E859483, 0xE9E69B81504A31D2, 0x8E364A1BAA207CDC, 0xB98C40D4B5BDAB62, 0xC00D3327FB9A1F91,
+					0x8B8716ECB4D8B2B7, 0x2D57E054B08306F1, 0xB34116681C6B1770, 0x9BE6E708A5325276, 0xB5E33CCB553E12F4, 0xEA1740A8C72EC8F4, 0x4F15A4779CEC6D3A, 0xF9C59E87908709CF,
+					0x5FF824CC2AAE70DF, 0x18303FF4807CC915, 0x3105145BD9BC70B8, 0x399FBA0A33F94FDB, 0xBD504E9F54D21A53, 0x83763823A6C66C10, 0xCD9034B8B1A998B5, 0x0A0162945C96F0F7,
+					0xEB1D048844453C44, 0xE3AA05B7AE20EB05, 0x41BFA63AA8981B81, 0xB2C89A1BAFDBBFED, 0x264FBFDAD6485DE6, 0xF1027302AAE67928, 0x03778D4FD791BD62, 0x7E89298DED8AB416,
+					0xF1A3BEDA78C6C4DC, 0x398F147BAB69841D, 0xF5BD0A781ADCB634, 0x9A37175B9D5283DF, 0x35BD6256B541CAF9, 0xBA881977F09C3E35, 0x4A3C942FEABAC157, 0xBCCDB5580BA6952E,
+					0x9EFA6630D2518971, 0x326BCA0C8757253B, 0xE96A6C94E8A9A780, 0x63AD7CC81A522B09, 0xDAE35A9D8FF45001, 0xD6BA5A3714C050C2, 0xC6CB3546666DA437, 0x00A6A6A6A9137C87,
+					0x8EF70EB5B0032C86, 0xD23A08F632FF3F0D, 0xF332185E2471094C, 0x6AFB39343927CD78, 0x88EFA858969218B3, 0xE7577BF0B2FBA369, 0x2F6B1ECA7CDAE29A, 0x2FE1D735E1878634,
+					0x87011688F59D18EA, 0xCB82889BD37130AF, 0xEBA52DE646712557, 0xDE3E3840FE4CB20B, 0x11B89947B52B45C6, 0xC6DBB89FF8BBD630, 0xDAFFA0F1FB0C2D29, 0xD6D5022547973780,
+					0x06149B56CB6D0E96, 0xF606EACA7E629ADA, 0x229C3EF2AD4D456D, 0xE84504B0406BEC1F, 0x7A116A7AF966ED91, 0x31F5E3FC10E74B36, 0x3F73597EAA09F51D, 0xB972CC20BCD0CB0A,
+					0x84A3F706C0C3B70C, 0x337A69ED7A46448C, 0x48C2B8EC66031003, 0x39BD65FFEE6B0480, 0xC56E88B12BF56135, 0xE687387F297ABC11, 0x34F0F7A4CCB936EA, 0x39A837BD062E2979,
+					0x19FD2709D628ADD3, 0xA82D8185A24CCBED, 0xE924433A3EF68885, 0x07F9C85D3E237960, 0x2607E231F52FEC50, 0xB46E706F4ECD7AC4, 0xE531885806CA9609, 0xC4E6CA6AAF4BE0C3,
+					0xC794DA3EFACE0598, 0xAA24CE13F462F5C0, 0xC9D1F4A2E2FC0E28, 0x501840634419E3E2, 0x2753F0ABC5A078F3, 0x532DD741A9AFA0E4, 0x306316C2B132C9A8, 0xDDE7F3171B938874,
+					0x3A0650EEDFD61663, 0xEDE5785E4FA32C7A, 0xAFA64A7D6A03BDE6, 0x66508452724BFAE7, 0xAC3EF141F2033328, 0x4C7884BB8DAA4FBC, 0x9F346DA46D928862, 0x75C5E68367E76E5A,
+					0x9ED4C974EF6D53C6, 0xEF7B8C5916CB3BB3, 0x2510BF902CFD1F49, 0xDC5E8ACCF59B165E, 0x21AEB826BB1997B4, 0x56DA8411985B2F8C, 0x0551D1B65CFB4562, 0x07DEF90790E0A06F,
+					0x795ADC4B1D0244FD, 0xCB60680E23D4FE7D, 0x37012CBE6279F799, 0x2442E564E2356F10, 0x5971C82CD5C01D49, 0xA23F819413207404, 0xE755EE63F6E1CDD4, 0xBC4AB57D9C39842A,
+					0x605C58FC56A17D5F, 0x09647CD36EE4B663, 0x0D132360D71D87AE, 0x3555CB334C629D63, 0xA52E619592C7718D, 0xD0F500E8FF5C299A, 0xC878C42F5209CE89, 0x2571A1DEE551411A,
+					0x6D531B0692CAE09C, 0xC0EA9A36F85713F5, 0x3DA54FA722319189, 0x1909B129E214D85F, 0x75A916ECBE4B2FDA, 0x99EF9862AC76142C, 0x87D35EF7BA3184EA, 0xD678767B2E7405DE,
+					0x9928F563F025B7B0, 0xB1869B4A4394C462, 0x3F6F86945FC655D6, 0x0CD98BC88525D554, 0xEBC961F83F5BA647, 0x794AB202BC02D094, 0x777891AD90CA740C, 0x5DB71142C4BE8EF2,
+					0xE43E1D0126729389, 0xB41B84780540F800, 0x4FBAFB45016BF851, 0x785E07D5CE2740F4, 0x5ECECA839157BBBC, 0x90814170EC20DC69, 0x0F7569800FA1EB98, 0x18184E16D34F0A19,
+					0xF46E8E0252D4FA69, 0x3F5CEE57CD30665E, 0x978CF26BBA62D2B8, 0x272C7200ABF34C79, 0xC138E61CD5B2A4E6, 0x97E9C73C8003DB22, 0x7DA32AC81B2DF5D0, 0x1B45E3E151482E68,
+					0xDA2D7450E6554300, 0xC844E9CCC8F28A16, 0x1E23DBEB15701F13, 0xFF20B5984B39F335, 0x1874558B0C71652B, 0xEE823227DD2D2685, 0xB91AFD24C4D7D94A, 0x19E09009ED30CFED,
+					0xADD8B4E2FD46FD5F, 0x49E796A174C65118, 0x66146597B8B9E3D9, 0x974627AF6E09BAFB, 0xE765D671B7119922, 0xACF94AA20ECDCDB1, 0xC0216AAD5CEC3EB8, 0xF027CAEA7D8E2943,
+					0x4BFCF0A2560D884B, 0xFBDFA0021C043866, 0xCBB6E6AC5710E3F1, 0x304DEC1B96663E6A, 0x0ED676330C572235, 0x1000A27A69A15484, 0x6BED8A8047ACD572, 0x2EC5B4BD9EFDE17B,
+					0x4A204661FA96B93D, 0xDDFADB90B793C23E, 0xF160D993D7A307E0, 0x5789B0BC6AAFCD19, 0x928DB7E1A2FD48B1, 0x59FEE809D6867948, 0x53B9CBA04478CA2B, 0xD504BFA19805DF9A,
+					0xBDC9D4FFCF557CC0, 0x5DAD076B96CFE105, 0xD0AC9A247BE56427, 0x681173D8FAC73CD2, 0x4CA9313BD14D2AAD, 0x1F7296659D6DCA0D, 0x8342FD966A0E4705, 0x3CA11BDB21FCE40F,
+					0x9D7774E991876088, 0xE61958B7974918D3, 0xB7DA7BEC001AC428, 0x5B716E2B714E011F, 0x074E81E7BB20479E, 0x1A9A2FBD07A627E4, 0x54608B78CEC65AF1, 0x59F3B6B9AD2CFF6A,
+					0x28AB1BB615BAB5EA, 0x5C221767DAFD7FFC, 0x8B08500E119A5161, 0x4CFDF665C07D9B54, 0xAC8EDCA2E0352FCE, 0x3CB134225FFCF85F, 0xEFE7AE5D56079365, 0xBE4CCE26278DB495,
+					0x5FE5600A424BAF90, 0x67B0D3A030BC1166, 0xE6BCE7C6C7CA71FC, 0x2134C9AA0575345E, 0x03F27E712116E6F4, 0x9BAA02E6C1D2586E, 0x94E47A3D3B693549, 0x98FBFC68FDA7D21E,
+					0x7C164C0EF6D19AEC, 0xD6B756B3D6A8F428, 0x4C15F22BF96D68E3, 0xC57AD5842F76395C, 0x7BFE451244611C06, 0xE3817A97D494EA62, 0x942BDC4586A23269, 0xC562F1E7B809DAB8,
+					0x42052B7530D21444, 0x89CC34419716972A, 0xD143DB1C4E83DBE2, 0x29152A20501E42F9, 0x028D0B7FFDD70BFC, 0xBF74754776E7E62E, 0xBAAABFB526F248FE, 0x82C08EF09C733CD3,
+					0x118AF128D91AA3FA, 0x485BACF268DEBF26, 0xA7FDC3FC47C8B4BA, 0xC93C1D5B9604AB95, 0xBF78385FABA5F404, 0xF954407CF609461D, 0xA85BC6388A33D708, 0x3F8E38EB6406A90E,
+					0xDE90A228863227E7, 0x725A89C9C5F9A1D6, 0xEB28DDDCF868D681, 0x939DAECBC0EDD40B, 0x16794F0F3941432A, 0x7FADCA804CB71328, 0xD0676BDD227809C2, 0x7E7049ABE28AFC7E,
+					0xDF94F5F86B8E5EE4, 0x84C9A68FC1F0B022, 0x99A3B8FA3826BC03, 0xFA347B5538DBE687, 0x41C2410B44EEC858, 0xB6892C3B258208C6, 0xA3B9145F518ECE8E, 0xA7573AA5088B497A,
+					0x35D66ED6B05AA314, 0x6CC8168BF1320433, 0x939C06BE4394D2C4, 0x3FC7E173820B8527, 0xC773FDAE8D5D072B, 0xE1A00A6E5ABC788B, 0x275CCAAF46BB6158, 0x165657F277D6250F,
+					0x3C47A674B3A288DD, 0x847F0E5F304837DC, 0xF6FC5D4FB12066F7, 0x063A64574261C81B, 0x341DCC88FB3D2690, 0xDB29BDAF5980E58F, 0xFB8F3E87E2FC1FB3, 0x8FBFC7653D2CA392,
+					0x46C376C283D48D28, 0xBE64941FB8E94C7D, 0xD08093DDB6FFD9F5, 0x31CDAE9A82078196, 0x1B970DBF4970A209, 0xB3DA426051E7AAE2, 0x167B30264560C81F, 0x4061EAABF08E7B8D,
+					0x0881742A62877064, 0x7C08465EFFCEA62B, 0xAA7108FA7DA1B62C, 0xEB41AE5FEC4A5EF5, 0x4FB667410B8A6A96, 0xC2944CD78408C608, 0x9A131C2619F7DD94, 0x1C78352E84AF9CF3,
+					0xC5B7446E8E41BA8C, 0xA9517311DE178384, 0xABDBC7D24C528E67, 0x73A6CDBE264B7EC9, 0xFF3DB1A3D492426C, 0x833A53C0941A6DA0, 0x8417E775302141D2, 0x593083A87382D32C,
+					0x90C925A2B6169A24, 0x471BC2DF251C4E6A, 0x4C2A097EFCF8E0F9, 0xFCC1A2F77BA3E88E, 0x06BC71CF81100A7A, 0x93E6A02382FF016A, 0x1D25F831DC22F93C, 0xA3C3731C0DFE4646,
+					0x15C7DD423818535B, 0x6190F24ED75FBEC6, 0xEC055DC8DF94251F, 0x7A27DF6156A00BDA, 0x84CDD5DC1E4056FF, 0x52C9F83A887BAD6B, 0x14998E04CAC654DD, 0xDF2543F02DFC5795,
+					0x12F238260AE5CEBC, 0x7928F9592683ECE6, 0x430F71A294AA40DC, 0x83E0D35C2B3657A8, 0xDE4E42D502F3D645, 0x59F787689182B8F1, 0xF819E689DDCF1C36, 0x89A99525112ECB0B,
+					0x25C768F60381CF77, 0x835096FDAB6C73B5, 0x76821022D5CD61FD, 0xB2904363114E9FA5, 0x9C897624450C2708, 0x76BD3EF3389B848C, 0x018182774D198CCD, 0x38016F3F55047B38,
+					0x9B1D06A0D6F7DF6F, 0x07DEE64333AD5C9B, 0xC2B08929E99AB899, 0xDB50CEFF4540BE28, 0xDA2CC64525B1042D, 0xCBA21D9826F2EC3B, 0xA9DCC671DCD94F4E, 0x4C9A62A15C566BAB,
+					0xBE7CDC445370F091, 0x725001DFF93AA174, 0xEBCDAA547A22D968, 0xC36F44D2DFAC8E59, 0x08F9513E0DDF2231, 0x15B573EE6CD234F4, 0x78B0D10B3AEC2B24, 0x546918FEF1E1DD7D,
+					0x9E0E137C79B72428, 0x004FD55173D1633E, 0x53D5048511B6218A, 0xE319D76BEC6FE022, 0x8A6E0F7897F9640F, 0xB8217186079ED182, 0x9275318FA2D27826, 0x294CB3749A71731B,
+					0xE9B7AAB77FC57E8D, 0x3F980A4287644093, 0x0834044893653F5D, 0xFA27280741E55806, 0x4542371ED1601FE2, 0x20DCCBE125CD3A41, 0x9000B2594CA29C27, 0xD9AFD97D8384D6B2,
+					0xC7395A4A7908F60F, 0x5F23A5B1CAB10C9A, 0x90E7465FE6780087, 0x277DB4E443D1C8F6, 0x7E0380DC62D62154, 0x68DB3D899541FB36, 0x5E6212CF1564984B, 0x0662C8B62ACCAE14,
+					0x3D2AA2E3B278B18D, 0xE4998A0C2A8173A2, 0xC33280FE8CA90474, 0x4063DAD4C6C3DD5D, 0x3070505402CA528C, 0x345FC4589DD17EDC, 0x0E098216E766A841, 0x8F8B75771DE6C794,
+					0x4E2DF5DD0CB11CAC, 0xB1CCF4D97680DD57, 0xF01C2CC542310C62, 0x12BF045BFAB9E6D5, 0xD45C7B276C4B1BDB, 0xF8D819147FD910AE, 0x4E67D0B34FA6EED6, 0x40BEB23CD6493E29,
+					0xD1411A6577B43EC5, 0x6BD864CF37754133, 0x1689E4069B69B9E4, 0x78D3B96F6061DBE6, 0x20ED02EFB9EFB11D, 0xEED4D1F2A8E27EA9, 0x96AFC448C890E6AC, 0x12CE840FEBC0D730,
+					0xB40404DFED0FD5AA, 0x7E14F50AFCCA846D, 0x8E0FF534F3A35DD3, 0x66BA753FE0C035A9, 0x0C1616B44CECB307, 0x58E25B2ACA4862B5, 0x5921C2C8A51BC5BF, 0xA2D0C87982F8A892,
+					0x46594E59B8925874, 0x88ED752032441C26, 0x83EAFC7ABC51DE98, 0x7529283C447D59D5, 0xFB96C84B1B926CFE, 0x0EE0871A500A66DE, 0x3E494A16EF24432B, 0xCF669E07397F2C46,
+					0x06087F4700BD3E91, 0x878FDF57CCCE615E, 0xE3ABC6F8106A8646, 0x8DDDC544812D0ACE, 0xE89CBE1C2C837503, 0xF4B188FB4343C1B1, 0xE1D36BC93ACFDFF6, 0x9C83AEE1F8A8C622,
+					0xACC7B74FB723B7C9, 0x4D98F96C056A6277, 0xC696A8CFDFAE68E1, 0xD942A153655209F0, 0xC5C8FC31750388CB, 0x93F0DB28F9ADF704, 0x087080BB6581BF40, 0xCBBD427248670B11,
+					0x165513327F626D19, 0x4DFC7408F183E2BD, 0x0C3B6FC42E376073, 0x88BB82A43BADC95B, 0xB5ADE84E0A5176A0, 0x4E0DF76149B73934, 0x35FFE4C1679A5714, 0x7CE4B2CC51DB45BD,
+					0xB120925D23C69599, 0x23538AB22D13A7FA, 0x1156A1078437BCF3, 0x79C6B905C1090463, 0xE2FB83389CF618C7, 0x8F2C39E15C941C1B, 0x1200A399FC46AC24, 0x0C261D99E0DEFC6C,
+					0x841F028E63C1A578, 0x645BE9D56EDC2E98, 0xFE08654E4D48C7E8, 0x18983FD6BBE3144B, 0xDF1D823DF9E680DC, 0x39D5FF0B14DE2934, 0xDA05E6E824515BFE, 0x371E9F3979A894E0,
+					0x151E747697003A87, 0x1F79ED7ACC0F2513, 0xAC7E69086EB65EFD, 0xC1143E69ED557361, 0x674BE1EA58F0B9EC, 0x3E065193CE3A2B29, 0x529F94F7675D91CB, 0x3D45C0083C2E2145,
+					0x54E5BA84BEC18823, 0xD745B96280C84999, 0xC8D46BE68127B94D, 0xF03F340CEC9C4D12, 0x573EDA990E08AA89, 0x582AA8425AB22D06, 0x16BE2F3CC11FB2BA, 0x086256643A3D3C4B,
+					0x76069042C7AC6696, 0x4279D104B79A1AD6, 0x71594498B0BE83EC, 0x2DE5DE3C8EC08EC4, 0x6EA03B2A3E32D333, 0xB6D5223B11F38198, 0xBF587A3B286DEB1A, 0x5573488C719FA51C,
+					0x55C82654ABE9896B, 0xA97899381950D4BE, 0xA584AA344FBDD378, 0xDC907A4DD1E2B53B, 0xC11EC3F1FE3E535B, 0x883389AC4806B991, 0xE47293525123DECD, 0x4CB3939DDDBDB50B,
+					0x39BAA513336FC376, 0xD2C6AA30860AE560, 0x4A016D3AF94198CF, 0xEFC24FD6C991F767, 0xA1782AD26B32B1DF, 0xE6C8A2D8025B3B02, 0xBABE1C645AECDB27, 0x8138F596E6F26D3A,
+					0xFAA81D1CAFEC73DE, 0x9D8D46239C7BDC4E, 0x7A19DEDE2EAC2C59, 0xD61132EAA55DB94D, 0xDCCC05301D1F7AA2, 0x1E51A771D9E3B739, 0x8916727371E375A2, 0x08D096FC8840DDD1,
+					0x4B9B6308B247B242, 0x1D2ACE34C4C538F2, 0xEB730C23F5893D11, 0xF6693E936A3F9F4F, 0x9B8BE2FF90E2E7DD, 0xC00DED24F62082AD, 0x59C6B38B188EC9FA, 0xB804FEF5D24E9F4F,
+					0x98FEADAFDCF6BF5D, 0x31C0BDD8106C2063, 0xB62BBFA91C21DCC4, 0x5BA628E49056F4FC, 0x3919869ADEA97CA4, 0x6E5FFD461AAAEE18, 0xACCB179906E2EB2F, 0xE2E9424B41D19CBC,
+					0xAAEF2D9546BB8CAC, 0x507DB7746262AEE1, 0xF921EE36EA4F559F, 0xF30C0A5EAB6BA20C, 0xA42E708479693360, 0x62E343A19E091B02, 0xF6155C9092BB381A, 0xC19018F426315BE8,
+					0xBE76BF9B9E424326, 0x390B8CC0D17EDD41, 0xB59F9205FCFCCFDE, 0xF19197ECFF55F5D0, 0x2935284205E95B0A, 0x2C343E4B0DB3BDFB, 0xF485278A4410B296, 0xE9BF165AE60437DC,
+					0x19077E3A0A1FD485, 0x5DBE2280ACFA5DB4, 0x6FDF294B9BDC0996, 0xE726D6989612ADD8, 0xB0C4641BFD802210, 0xCAB2B76D9ED30897, 0x952930729BD3A35E, 0x0764D7E9DE04E1F1,
+					0xC62705B8FF105797, 0xAF7024418411A958, 0xB32CD3AAE3E0C1A0, 0x3C1FDB47BBC13862, 0x9E1E2434ED942C6C, 0xCB37556F04BABF49, 0xC834EDBACA31506F, 0x1765FF6DC6D8083C,
+					0x24E721A66749B57B, 0x5B1E1027088A550C, 0x06FB35A0BBE94A76, 0x0952A38616870E2D, 0x4A5D179C41710088, 0x8C8710F58DA57757, 0x86A06152E04CCDCA, 0x1BC095DEA69B2CE8,
+					0x289281677CDFB7C7, 0x26002CF9AD9851A8, 0xAEE04B2A6E9355F9, 0xDF3BAC4EC0249375, 0x7CAA47A274C24945, 0xEAF338DAB858CCBC, 0xEAE80C741360758E, 0x12999D02F8B08AF5,
+					0x63279BC0ED2D1C73, 0x2DD4B343365047B7, 0x7F0E039BF1E3CF82, 0x731B1DE4A311C077, 0x5CECCB171C53ED13, 0x503F09119B160BEF, 0x65DD1D303895D56E, 0x10EFB45045C1F5FB,
+					0xBB1A894BCA69EEA7, 0x566E50DBA2DDEAA0, 0x12C5CD3D1785E5C6, 0x54B330EE88FA8D7B, 0x48A41B0C379F194E, 0xFD7C7EB12BE10C5D, 0x2B838E51D28D5580, 0x0FBE9CAAA23BD17A,
+					0x107C0BB69B4C2355, 0xB406EC701D8346AA, 0xEE0887F1202DA8E2, 0x13C0E52AF6EEE6F3, 0x8F6A8EB4378C9EE9, 0x1F86472940195A88, 0xA660DBCC16DA9A0A, 0xE7AEADC61FC05E5C,
+					0xBEA714D0A5063D86, 0xF453CB1C8855A8A7, 0x688BEE12B2A1BE27, 0xB64B835875EA7161, 0x72C191D25F3CC003, 0xA0F33EE0CBB2CEC6, 0x1EB505D0E0EE5B42, 0xFB927F0AA0B62B59,
+					0xCDB50179500D2C08, 0xC4D1209D9C8683C1, 0x792112A1F29BB518, 0x254E89406290138E, 0xAACB1EE148D3F2E5, 0xB4804BA282E7B89E, 0xD66142B55BBB9AB5, 0x6931E813A2F427FE,
+					0x05AC03E25862063F, 0xB360992F78A1F9E7, 0xA9F82CB811F292D7, 0xEF7669E6A130EF97, 0x78BCCDCA53911AD1, 0x059ABE2E6F33E21A, 0xCD891DC3BC581294, 0x7D53246E71BC750E,
+					0x44528A1AA8CEB555, 0x20C751D4C7A4128F, 0xC3A4F239BA8E74BB, 0x099A4DFD49C74954, 0xCA75C601F2E48185, 0x50BD3CC2E3F1B01D, 0xDEEC0CDAA9ED2C75, 0xFEDB1837D8DF938D,
+					0xB9BBAD1B493388F0, 0xCAD455077D41EBAF, 0x70B761BFCFF81EE3, 0x7091F5E1EDED8650, 0xA5D136B4C99843D7, 0xBB115B13BD85C1DB, 0xB9470D91C8C7A18D, 0x485EE0B35EE09E61,
+					0x7BACEC69C9FDAF87, 0x0B18DFBFA3C7FAE4, 0xE76A365DE2F85DF0, 0x9F09717F154CD5E6, 0xC656EDF0F21F6882, 0x8BD33B84354E2FA7, 0xE551ACB5F941F599, 0x33970F416E682E3D,
+					0xB72F16665B11A3B7, 0x09F6910669B3C60A, 0xBE9F8A6DB66CC57B, 0x14F8FAFC58237497, 0xE9111D6620A9A0BF, 0xB17B031EFA519E1F, 0x0047328A3DCC0ED5, 0x2E618F46A03F51C1,
+					0x0F99BD9A71449167, 0x7B2B815B2DD57BC6, 0x6EAE6B4E200D244B, 0xA2A201229109EF86, 0xDD959C852A742267, 0x19ACE9137CE50206, 0xC53BD76CEA343F10, 0xA868C1CC25601204,
+					0x1B9C872895A27135, 0xE390B4188CE14442, 0x4AB8F2D4E57F0619, 0xC0A7A0036F9550A7, 0x707A7C8A28273E06, 0x7FC6BD0D0165219D, 0x23357117564FBE01, 0x799D51F2A994A9D6,
+					0x584F1FC98828E633, 0xF03B566A59776D9E, 0x7CEB6D5A39B23DBB, 0x567447C030792A3A, 0x270BC1674D1132D8, 0x16D1713B546E9DC8, 0xEAA3A9518350E5F2, 0xB2BFAEB9582178EC,
+					0xE8C174B530B4E294, 0x528B7FADCE40AA18, 0xBDFC128EEFA7DDFB, 0x736957C9C8B31BA7, 0xCDE9ED6A1304BDC2, 0x926F977257D03B47, 0xFEBD37A32003425F, 0xE4AE362696F4BCAD,
+					0x4BAF09B71F2145A4, 0x8E83A88A4C563E43, 0xECFA4FAB15825392, 0x1D393D2141783C3A, 0xCD8AC559925B088C, 0x72806758F36AAB4F, 0x33C4995D5E8AA93D, 0x466505147C2C4991,
+					0x34EC502C4AB62897, 0x0FF43124E47223EE, 0x3E1826FB7B0765AF, 0x1D28CB518FB3657D, 0xC2739DA066A7CE9F, 0x44D23C27339057A2, 0x0E0565007B50F4B3, 0x5ED27DD8B9C2670E,
+					0x8C0DE3CE958D7E1A, 0x94AD11ECEEA93515, 0x8EE07C8D7C6A860B, 0xE3815B4FFCB487EB, 0x05102DE13680EB23, 0x92048FF3247808D1, 0x9DD93471DF5EB06C, 0x7D4E97482F0FDA46,
+					0x2EAE22F6DC94076C, 0x2AB2C2280B5C565B, 0xD36FDD9BECB16D25, 0xA1AC715A112ABAA8, 0xBB7EE736E451A81E, 0xC231125C0BD0AEA2, 0x983BB3C40C6B31B7, 0xC21A981A3B17735B,
+					0x702525CB66AC8BDD, 0xAF1946DFF751BF1E, 0xEB9C5E6B722E3BCE, 0xEE3077247566D8BC, 0x7B06281E2D87323D, 0x0614B8345EF3644F, 0xB9AE62719C4B608F, 0x42F4AD48D2E3C561,
+					0x9BDD5609EE84BEF3, 0xBF4A40E42CE8AB58, 0x5153667661E82F79, 0x4164EC77E8BB62A7, 0x795B9990306788F8, 0x50275461C363A5F6, 0x8DC683FCF0B1A7FF, 0x3E54E196990D2905,
+					0xB8B849F022ED0497, 0x0A1E29274A3E5920, 0xBE7DDDD9566967AE, 0xA9B5A9E59D316B0E, 0x8D02A7375C1DD5A9, 0xB89EE1C98CD68C7C, 0x3E278610A63EC3F8, 0x658CD0DEC3C47BD9,
+					0x1BC9F82BABA077F4, 0x9766A565C0E89C53, 0x790F73E70ECF3BC7, 0x041F904FE5633AF2, 0xE7850A07474E7B08, 0xAAC3DC3D0AAB7580, 0xD727AA483BC92563, 0x6979AF177C47DA00,
+					0x57B0C2123F9DF120, 0x4FAE3DA299205AE6, 0xEE6CCB6C616D6896, 0x577C0E3CE37FFF33, 0x13FB62724F924FEA, 0x0E2EA65C59D21189, 0x4B757D20A455996E, 0xB9BEDFE2CD1C66D0,
+					0x12D3E8216A8DBC64, 0xFF29C62A129D559E, 0xEC25E12BE758625F, 0xAEB0401A0E7F83DD, 0x7D694FC347BBE78C, 0xD4741C83409EA2A3, 0x9970EEAA838D88DD, 0x8E1786BDAAF1B10F,
+					0x4A8971255D338F10, 0xFDA67DABE3DF640C, 0x32279E4FBF86703D, 0x5C7C56ABC1FE8734, 0xF81669EDE1DD09DB, 0x69C43A63C292DB33, 0xD83298DADE50132C, 0xD85957F96C97A19A,
+					0x0D8556BBD3CA2D4B, 0xFD91BB61D7347E4D, 0xE6E6F0C3A589C061, 0x3EF7BC6F0A766D38, 0xF32D7E56122B7941, 0x2A6BF92919A29C19, 0x8223CBDA729C07FD, 0xC1242B079FC18737,
+					0x260C3EC1C64CAA87, 0xECA2FBE0BFD5D776, 0xE9E5F1998EEF4EBC, 0xFBDDE7ECC463CED0, 0x9D753ADC9DA05B51, 0x5194F78470BE20A0, 0x62A8007535EB9374, 0x76F3D4D3D67C56EF,
+					0x3201EB3B40F65538, 0x57BAB6C04378BEED, 0x72EE8850740E46C4, 0x1D75028535950B9D, 0xE425429A9EA24A58, 0xE11DA5AFED72C02B, 0x4D5FF3323140621C, 0x00EB4096AB3C0F3F,
+					0x90B7AA1E257FCFC9, 0x3614D0367153EE17, 0x37D6DE6347DE443F, 0x58ED7770943A04BC, 0xD83220C05C8C49C8, 0xFC546B47D5AEC0C1, 0x8905FAB710873C85, 0x3BDD20A4E6824239,
+					0x1DD08AB39971EF7A, 0xB1CE7A8F168B1F6E, 0x7C10648CA88CAE2B, 0x75C7D3AD60E89409, 0xD5B93009ABB63557, 0x6ACA78A4FB35A706, 0x83A8D525905F4B4D, 0x3C40E20F96BE2730,
+					0xE7B06FE508D73EEA, 0x67FE4B0D42736F36, 0x1ED74B1CFEF4A184, 0x65ACA40D06B1C54B, 0x48BF06D82A22268A, 0x04EF01F90703A66C, 0x3421C1570335D405, 0xD044CAD0319E38B0,
+					0x6BC52D44E7ACD1B4, 0xB26651378BAFD0E6, 0xBFDE911FB63001BE, 0x4930E8C16F3DD00E, 0x5A4402BD76F060AB, 0x89E826080FD8A19D, 0xDEB01BC13487DE95, 0xF45F65803FB8B091,
+					0x76A38E66A3B5F751, 0x208E47D9EFD0080A, 0x125008719AC4DD9D, 0x05AB6D1716C3E66E, 0x9411AACB3AE58EBB, 0xF3A9088EF8C2C77D, 0x2AF324D3918EDC38, 0x5078A0BDC27CE9D9,
+					0x013AEC8D3DD9FE91, 0x0DF9E4F5D0C02813, 0x808584B4FF1B4E6E, 0xA81FB25732E7D956, 0x703501008A93F38E, 0x57E974FAB41C7F10, 0x03717E5BAE6B6C6C, 0xBF4178CF0405F119,
+					0xA915F82983D4EF3D, 0x928F0686603A2D77, 0x5FBBF4A34E7F240B, 0x9B5B25EC4801095B, 0xC4874BCA528F219B, 0xADBE4507232EC3CF, 0x05B6332E2450E8E6, 0xB1BEAE49B22FF5C2,
+					0xD555140CEC8DEF70, 0x71B0E9B3988E1784, 0x6BF816778A9F1646, 0x1B1A4938E238B244, 0xC508841F60A23FE3, 0x15F0B742CC56CDE9, 0x2C7F3BEDA3D74355, 0xC9253EE1EE2E88F8,
+					0xF16B846E6BE5567D, 0xBFEEEBBD30FEA98F, 0x19FC7DDC933F266C, 0xE4C1529D94CB596B, 0x8063A50ED810A9BC, 0x008235CB0C638FA1, 0xC286C0450E7A93B0, 0x778E27D07854F205,
+					0xD3B00560C5C4730C, 0x2B60B56F8A42207E, 0x95D8120705388178, 0xD44CD1B521E9C76E, 0x5DC135EB005B9312, 0xE6C4250918089F34, 0x7A2B0E434A773544, 0x396DED44B7154BB3,
+					0xC60880CE33E06C38, 0x4C95359693E520BC, 0xEDACA2F8493B7908, 0x579513BE92534789, 0xC1A631F258A1C106, 0x1339397E32DC5952, 0x72CE6EA7106A5F0D, 0x528E89A411D341EB,
+					0x4FB7967F9847E595, 0xD510ADCF4E0ED7CB, 0xCDCFE1C8555AE74B, 0x35E2851DF1C270CC, 0x54BBB7495B083674, 0xB66F11463A48D7A7, 0xEB4CA6B610E606CC, 0x4563DAE305C0436C,
+					0x37EE0416F1983BEB, 0x6F1E8F831ACC6D21, 0xB84D5DC605949251, 0xCF329A71ACE9146A, 0x189AE5DFC1A6AC00, 0xA3E54C1B24E8AD85, 0xE38DC1E1A3495002, 0x6225394B258A93E9,
+					0x1E904A8CE38FD456, 0xE158447648CA6FBC, 0xDF0DDD48BE3A3C17, 0x76A720D1A0D98806, 0x1544924596714B68, 0x021865BD83B6DFA9, 0xC3424A8B6353E905, 0xDBD1AA85666AEC63,
+					0x142A94980F0E4295, 0xC9F5CA7CFDAE35F3, 0x4D70C4C4658E02BF, 0x3CFD12DBC1439C16, 0xBD2DD3BDE5748F12, 0xDC6452834D3D2D4D, 0x9B6D99EAFE2FD4B7, 0x368E3EAA2B64C0A0,
+					0x723E5986749AC9DF, 0xE9274350154384AE, 0xBADD6C65D7119B81, 0xB744D3F7C6041104, 0x6E3C43D0927140EB, 0xF2C748937B5CE9BF, 0xBB91A46C5D38338A, 0x2003858E5005B387,
+					0x9A7037D9DC091E6F, 0x18FC0816A5E3E1E0, 0xB4C44A86F205BBF1, 0x71A5A10618B55DA9, 0x45EBC89852E5E008, 0x73155D0884F23D9F, 0x92307DEBA3A9A12A, 0x7565D4301DB5E5C2,
+					0xC36DEC303D4399C3, 0x3D71CA35D4AA3245, 0x84719C1FBDDA676D, 0x33B320E31AA2F94E, 0x4A8D366792D3940B, 0x46C75CE2D840B9A5, 0xE778ECAC07A17FEE, 0x72C87497D7CB0305,
+					0xBAAD561C4939B27F, 0x3706EE8711D3E479, 0x7A7411595B7596D7, 0xEA54CBC16C791B60, 0x451D53B193DB750F, 0xB039D49C8DDD4694, 0xD246894B8D5D7D23, 0x76C09EBEAC2983B4,
+					0x22C35BE861D74FD6, 0x54D510858EA2327E, 0xBA8F5CB6844097A7, 0x2BFE1C0E08EC458A, 0x13FCC29C95ACD500, 0xEF57481EB4D8AEEB, 0xE28AE1F9179C630C, 0x819CC892AA3D08DB,
+					0x376641857D2CD0A7, 0x2F8F61BA3E33DAAF, 0x0AFC7D845B84B85E, 0xD6A359E2AF09A213, 0xE623738FEF25BB12, 0xB22BA10C2D459F2A, 0x95361BFD1A05B216, 0xC1B067AD7FB7C510,
+					0x3EEDC72258E809AC, 0x0AC14C8741C88D39, 0x13C88EEB47E98936, 0x9E13EC710A58DBE1, 0xCD23B807780F6F5F, 0x4D6E6BB997C2EAE3, 0xC4697B9FC6AD3103, 0x0754E5F51636AA8F,
+					0x5B276EBD15FC8D21, 0xF57974C569380A7E, 0x44CC9B7625CB97F4, 0x3AEC195EE716B8A5, 0xABBAB3AEEB20B461, 0x19A70B2E92BCBEA1, 0x39329E24C0E44B7D, 0xCDD3E76BD00A5EE0,
+					0x7BF5592C1C35F709, 0x532B7D33AE9A0BA8, 0x6BF706837B1528D4, 0xFE49D83D93648111, 0x1D0567D85FEADD33, 0xCE1E7FEAB6753D45, 0xEBAB37D27DFCA2E4, 0xCCC272EDFEE24C22,
+					0x2889BBBB3493808F, 0x9EBB2F6194D402E0, 0xC9523A8A1E6F8D61, 0x9D18E53AB093200F, 0x1398C384B900B385, 0xE3E776C1148F163D, 0x4D2F470DE2E0C721, 0x2687712DBCAB263C,
+					0x48792F4B5259AEF7, 0x9B7E1E9109E0C1B1, 0x8A176027806ECFA9, 0x4F1568ACC463834B, 0x24A19301B2EF6A51, 0x157E6ADA70F111EA, 0x89C57DB2864E1F0A, 0xA7463F34898186E0,
+					0xF2F75E4FE4AB089E, 0xE3ABC14DF5B27162, 0x8B405F238BEF02CA, 0xA823BF2FCA3F9618, 0x4BABE5552EC969E7, 0x28EDBF3ED1F21930, 0x1A6A0C7B99C5840D, 0x41EFCFAE938D13AC,
+					0xD07383A890927C9E, 0x46298CC813A167EB, 0xCDE206DC77ED6F6B, 0x7E4953D1F4C5E367, 0xC69B7FA8051C78B6, 0x0D6796A1A672CFC8, 0x1B52306DA974D43E, 0xF0272283A24DA566,
+					0x7CCD714EF5D35824, 0x76167A3D154DBF63, 0x75DF68C8CA72D50A, 0xE552C823A4E948BD, 0xDC16CE65E22FF537, 0x690DD7952430DDC8, 0xD3006E583A03210D, 0x68E8FC942B4E3C16,
+					0xCE3A7A799100C134, 0xF9A9048DF3950537, 0x7264AB75A121099F, 0xF901017273A22202, 0x93699DE1DD394EA4, 0xAC7BF19B9D0040AB, 0x075E6F70C1396C3E, 0xA3E2F9D6B5081BF6,
+					0x0CA57CA582EDF8E1, 0x59CA7FFA176C9BF0, 0xA1B52BB78BD426B9, 0x79A500FAAAED98F5, 0x79F0E2C13C69D7DE, 0x72A865141947F728, 0xE1607DE06E949309, 0x13E4AD1DB2291C9F,
+					0x5965ED2B77179B62, 0x4FBD24CA67EC4394, 0x489825A330E45F32, 0xD6CBD6ED70E8EB3F, 0x50236FAB89EC7F2E, 0xDE27EE8638CB7E43, 0x81D9854B7CE112C4, 0xC42076D6287BFB99,
+					0xCED47D2E0A9CB9E3, 0xDF113821C32A4DEC, 0x775ED175496D0C6E, 0x47EAD5E7E102C52F, 0x3C32C48933E368DC, 0x0FAA3278965BCB49, 0xD77B7318C0C4006D, 0xD4D4D67B37E142FE,
+					0xF343D95A85755440, 0xBCBEA15F0F90DA25, 0x7DFC8AA841229659, 0x9BE106DC81E925DA, 0x88702EDDA160B3C2, 0xE5E87BEE13845FEA, 0x64DFA71CEC7859BC, 0x78603F08F9052D20,
+					0xA5A7769E094976A8, 0x90760F52306BE140, 0xDB0CD81636F3880F, 0xF0E8153C51733DB8, 0x5805C0AF92F54E07, 0x2746963690BE4A27, 0x3520FC88491A9983, 0xC57E7F81A26B4695,
+					0xD104EE046A567D5C, 0xD6F452EF515FD331, 0x50896D004E8DFC9E, 0x0C2B10A08F5FF214, 0xEC7AC9DBDD223DCA, 0xCF228ED63179073F, 0x08DE574756CF2891, 0xB9B3179A91A57E16,
+					0x53D368A382DE93E1, 0x1C27F433525053D3, 0x55C8B991A8244DA7, 0xFE7DB2515D1624F2, 0xA0B7C7CE4B893783, 0xE3A35F7C9A092FBC, 0xDF49AFBA9A6A542B, 0xD33B59DDE36878B5,
+					0xCD018D581028410D, 0x9C4AE0C9E777F628, 0xF62716BC6665ADEC, 0xC8B33AA2452D6539, 0x7333343D88E4F7A7, 0x7C2B7B8747FA2F5F, 0xE2FD4BE217B60072, 0x1CB8ACF865059EA0,
+					0xD0DF514ED1DB9F7A, 0x33D39FD2E6EF4958, 0x69E50BD7D4D4DFC4, 0xB1147C060ECAF638, 0x7201EDF3B9B2E75A, 0x2FB0745CA2D1C41D, 0x36D8193B4CF45EDD, 0x8883770AD298886B,
+					0x5AACDEB9C9FEC4B8, 0x9541AB7B50DD95EC, 0xE4C49863F3892200, 0x0FA8B43A9D3E136E, 0x62BE8C285852B3C0, 0x8532A865DFEF16B7, 0x0F7BABE6154BD967, 0x6667D74A05B12E72,
+					0xA1DB755FF0C889D8, 0x0F795EDFB5AEB493, 0xA94F670604882CE9, 0xF1FED337F1B7DFFF, 0xB48817760F5EF701, 0x7F21B506C5A4BB47, 0x7F1B4E9A55178EF1, 0xA57F5C85BDEA39EE,
+					0x08125752D0B894B7, 0xE49175E9B1D53829, 0xD8A46E656B7E318E, 0x45ABF8C2BF447DB5, 0xB6A242A00BDA4B98, 0x757061B621E25936, 0x118348E9A6FA2283, 0x839E21149EB4EC71,
+					0x6B783E11120DE2DF, 0x5EC5860DECEE17C6, 0x4D0A1C6A834D1C43, 0x076C213A44AE2C78, 0xD750AEB8D0B5CF0E, 0x10CB5FE7DE8CB542, 0x66DE5B2F8C35272A, 0xA885902177FA253C,
+					0x25EB8467DEE1A2AA, 0xC357308FB3742C4F, 0xF55BF1AB3DECB5AC, 0xB1EEC316A4FDCD1B, 0xC8B4DA7E4DC4F37E, 0x04BF1D70D4C34833, 0xB96DCFA87A8F503C, 0x804FAD80E388C6B7,
+					0x313542AE50B93254, 0x782D2722288FCDA1, 0x92702CDDDA02C863, 0x296E9C9A2034F45D, 0x72AADE1EC6EF3F84, 0x2F349884BBF5929D, 0x31B88337A903AD8E, 0xB7A6A0BB1C744883,
+					0x275F912A2D605C67, 0xDB199F2F1EF88EA4, 0xABEBF17FFA182BF9, 0x5F826224F378BD9F, 0x564F227FCAED3038, 0xDB3D4C208CAA3E56, 0x8618EAFE6F9AED5A, 0x73C40AC9701967ED,
+					0x396D5097E4A7DB31, 0x8B918B7C6B88E1D2, 0x2DC87671516EDAC9, 0x0A5EE47E6D83D923, 0xE31F8AADDF225161, 0x57661CAD2C39303C, 0xC6E0B9B560A9C124, 0x97FCBA5224BC1864,
+					0x89312FF04EAF1392, 0x57B85DBC63C89245, 0x94A9E0EDC72319E5, 0x8601F608CDEB7B61, 0xB320878A1DA11943, 0xABFA440949135755, 0x60A554E1D5DBD0F1, 0x6F779DDCE17A7A6E,
+					0x4B311AF6EE22FEF2, 0xCABF6CD1F210DCAC, 0x47751ED3DC256796, 0x8872A1A945B2D2F9, 0x1561780D00A5E105, 0xF6FB2D31ECEDDA25, 0x0336D401C86CA48C, 0xC42E2835874EAEFA,
+					0x9E3E0F8B8965CA32, 0x187582C00868F3EF, 0x157FB267D8AF00AD, 0xB74FE64BF7065BD0, 0xD3F3A3254D86C834, 0x722BB283F119CD85, 0x0F6ACE507A5B6CA5, 0x9A7D9B966D1CB128,
+					0x20C7E91CA4D53387, 0xBF27BD35EC94139B, 0x7A42993F6EFB5277, 0xAEEBBFFB593D82D1, 0xD572E12AFAF05557, 0x9B0BAF63593831B6, 0x33458445E3734748, 0xDA8335B93B78E81C,
+					0x11D551A8E954F0DD, 0x6A4CFEC3A56F6C1E, 0xFB57407325E2D3EE, 0x593250C330875087, 0x98F34AE6A4B03C87, 0xF5BE22FDCA0E40EA, 0x38ECDABF3E24AEE7, 0xFD206A046DBA2297,
+					0x7D877B9D21D2277C, 0x94EF77C8FB148E89, 0x50F54CE75754A46C, 0xD2AF72E5F0AD716F, 0xAC73EE6A2EE5AE9B, 0x336D4A2F25C409B4, 0xE9D5BD1E7C75A2B0, 0xB9F8612D88D97FE7,
+					0x36105A1A3AAB970C, 0x40C556375996CF82, 0x0C3069D45655E94F, 0xD763DFE348EE3DD9, 0x72F5F07560B8CEAF, 0xF69710119B778611, 0xFC6D5F8D23FF688E, 0xE3674FBAFAAE56DF,
+					0x197EE3B43B0BB0E5, 0x93D4DA9003EF9F21, 0x2065EAA2070639C5, 0x0D2CE8030FBBDED9, 0x635DC0A3ABA189E3, 0xCD93FE09099DD88D, 0x6370A0324522A7E4, 0xE349680CB6909309,
+					0xF1CDD8890F7FEF84, 0xCDA25CD9525035EB, 0x6648E0675AE83130, 0x9262DB5462E0A6FB, 0x41ED7658EFA9EBA4, 0xE45298A3B220BA24, 0xA3006F662F12824A, 0x8DF6BD59141E49E6,
+					0x5737131E81556681, 0x203233B91E471D53, 0x6ACAD71472D5F272, 0x7DDBB3D440140D9A, 0x1BD9BB604FBDAABB, 0x76A4CBFBD4B9988C, 0x7B16DD068715C9E8, 0x708A715724EA45F9,
+					0x7761648FFE1F4554, 0xA0B36E9540EDAE6A, 0x3CF2A05DAB3A13DC, 0xC37DE170B03EF5E9, 0x8723E200A2F16D82, 0x729ABE0ABBDB8237, 0x5DF5EE63443992B2, 0xDF58173062FC3386,
+					0x6B7E637FAA7D2173, 0xB7E7087F63DB1254, 0xA2601185FC1F6840, 0xE4EBDB4671261D12, 0xBC2D77B975AD7469, 0xE75DED888F9AB758, 0x6C0E861C5E335E33, 0xCBC48507F1FAF1D2,
+					0xBA68B565C2CAEBD0, 0xD450EF0A69393042, 0x27B6CC2EDACDB7FA, 0x1E04EA298C17C3A1, 0xDE8D6F52431EE462, 0x9801B0C25EEBBD8C, 0x74BB4B2F5290173D, 0x896D948516E0EA0B,
+					0xEA66381E25EF015A, 0xF80C2CAA57213406, 0x336E0B8C6A0F0072, 0xE85F309AF357AAEA, 0x5F3E9AD8DA9E39DE, 0x1FB348C70FC22D97, 0x7012D80673C0B1EA, 0x78C26F85769CF293,
+					0xB074D21C11828069, 0xFB8FE2A630A3A38B, 0x756DDABD35F338ED, 0x2BC096D696A4E22E, 0xA6EADB9B011B54CA, 0x4B6DBD49653F00FC, 0xDFFC42711EFE84EC, 0x133BFBAB03A3A93F,
+					0x848C673BA3B12D92, 0xF881147DEE86207F, 0x22996C38E031197B, 0x8188072AC052471D, 0xC82BB8FA19909CB6, 0x1940E82EDE2A9B48, 0x0BFA9B7C25A1E827, 0x989E2DBC96FF800F,
+					0x4D1B3FB5B55BA27E, 0x827AF9735B9B5846, 0x9773964739481BC0, 0xC53B110A3D0E071A, 0x142DBEE366EF78B1, 0xC9F739285F782F81, 0xF870E973ABB1B982, 0x3B62DF6BA978BE60,
+					0x33B3AA06FF765325, 0x41142D4E5ACB4228, 0x540C7BE32D47D6F1, 0x5D5EDCF4DC23995C, 0x73F3DC1115E51BCD, 0x70239FB514E8B36A, 0xE6C9A59581DC0BF7, 0x829DA6E4D1CEC763,
+					0xD1D94379CD120A08, 0x391242D853C8F71A, 0xA6D5755DC281E41F, 0x4CC30D794D16FEAB, 0xF1B0869C623C1C26, 0xF31DBCC609EA6298, 0x52DE6EBB0A11FE97, 0x1A4145243B8A82D2,
+					0x4569F5693B518221, 0x35869D672975CE4D, 0xF8868A21AAC677F2, 0x36B245E56AC7781D, 0x8A5674253884FD7C, 0x6F4435F43AAA31AE, 0x1764D3FB4F8DD901, 0x72ED194CA09EE3EA,
+					0xC7095CA968BC00DB, 0x61D76C66B6BDE980, 0x5FE9B5A4690BF461, 0x9788D1BB1793FB02, 0x8695E46D9CD683CA, 0xCD7A3B83A082B819, 0xC5A7C5689197DDFC, 0xE767877D249BC841,
+					0x036ACCD1B7070DE8, 0xAC91432BBA044C29, 0xF6E39D9B55BDF1D4, 0x989B7AD4EFF127F1, 0xCBAE07EFF7052CBD, 0x4C5FB0AA7673D14D, 0x461F1607A91A3745, 0xF104A88DADAA20D2,
+					0xCA100A9E248C764A, 0x731CDC9D100FDCFA, 0x71A92E19A91F31C3, 0xAC8A0B6B2E709576, 0xA59B2540E16389C0, 0x4B366228D7C755F6, 0x1EA59EF6B2546513, 0x76D5F5166D232CB3,
+					0x5B997E0FF27968BC, 0x57B1107427181BEC, 0xD4CF25EF9E5BBD83, 0x2B0FFB51F15381F0, 0xCC3335F992CADA60, 0x5E19F81A1F38F860, 0x373A2725EE15C45D, 0x5E79103310B24A87,
+					0xA388B8ABD0408F62, 0x8F0DAEB89FF47592, 0x404F9FB51498DD41, 0x2D77D3183FF976E4, 0x432C7BBD2D8BCA54, 0x5DC9BF73A8C16DF8, 0x0FD633AA78B4870A, 0x2B81E2555CEB380F,
+					0x31DBBBBB341D4874, 0x28907D22C028658D, 0x214D546816699CCE, 0x5B930C10F588E21C, 0x2B900E1C1707B445, 0x6D33842394D62D7D, 0x7C1BC86DDB25F183, 0xA509EFB2816D109C,
+					0x9445655E6ABF61DE, 0xB56ADE11907887EE, 0x7E2487EF9FC25A9B, 0x13F5AD52C7031154, 0x7D076C3E3B6CB204, 0x5A0D80BF0CA4BE9F, 0xAE4F44E057B4DF9C, 0xBD69EEBD984A1006,
+					0x220CBD29F10D1C62, 0x641F0C3E55DEBD70, 0xA673A288A1CE17DC, 0xA5E112CBA3ED9E91, 0x3F1C8A2D475D333B, 0x37BEA542C7350981, 0x5BF088EB490D6159, 0xE5152D37C5610388,
+					0xDBB15AC45F9FAD1B, 0x88964CC1B46ABB95, 0x006568902B6FF6E0, 0xF952FE16C282551A, 0x19493DF245E93CAF, 0xA949941184D46FEA, 0x857D7BDEF2C0ED58, 0x03B90842A556F59B,
+					0x1F5C89417D6AAEBB, 0xFE1EF0010E982A2C, 0x256929820D6A0BB2, 0xCE73E28FCFF314CC, 0x6775E12426E05816, 0xBC1D9EF92155445C, 0x747D87C96E92099F, 0x90C79CC7960DA05C,
+					0xF7AB1BA269EF9FF0, 0x3CFBB75FFE075473, 0x876286ABACCD30D5, 0x588C1FAE52445702, 0x82CF983B290A68F6, 0x220EFF0F01C01BA2, 0x2E448CEA39EFEDAB, 0x1479FEA6942961DF,
+					0xC432A52665E052FF, 0xE8042CD43507854A, 0xD8AEE8C04AD4AE56, 0x45D1A59536B0522B, 0xA64592984D3482F5, 0xD28A2388B22910AA, 0x8434DC906EA17D05, 0xE164599386EA577A,
+					0xDF1D32918F4013C3, 0x06AA0267CD83A2CF, 0x044BD3F0B4F6D04C, 0xA11D9A07EE996458, 0x44A720836C805229, 0x28CB7A66C59AFE8B, 0x3CF7D6B462E114D0, 0x89E9BC6CF2E97249,
+					0xCC420D40B1717FD3, 0x1E2B33AA6AA75143, 0x8E762692DB8FBCBA, 0xC7F653E525D2CB1A, 0xA09A2BA783B1A0A1, 0x6FC0C726C0FC4018, 0xA92A2052EBF4AFD0, 0x685B796DD72B60DB,
+					0x69B048142C630B1C, 0x68EEE44A97056C42, 0x69420442633F9860, 0xA1BF78BF0C5BF983, 0x66D65F064F64EEAD, 0x1F861C5F82C5F84D, 0x1C90CE0F023ED639, 0x482B6B786E9E229E,
+					0x2277A6B8EDA61E27, 0x9E17A27EBAF54225, 0x26B91244F32E1806, 0x87E9A5A212E73DBE, 0x962DD3CC10D54C36, 0xCE2D55D0BB9A0805, 0x323AE1D14267CB9A, 0xA0F46F1AA8EB0A1C,
+					0xAC7243A9337C4600, 0xF3D74B705A8A0AC6, 0x2131B05B5F1FCB82, 0x4BC3CE7FD5888175, 0x0CF616D33C4C8253, 0x7D0CB16C5BBFBFD9, 0x751E907A603336A0, 0x88F12AAA0747288F,
+					0x82099E86D5FBE1E3, 0xFBA4C72ADC69F97B, 0x845EEE35B56ADE07, 0x9CE657192B1201C7, 0x2FC5B8F02E5F933C, 0x04EECF779C43FB61, 0x67C4496489C59ED0, 0x5C9440AA5A29E0C7,
+					0x69CDE2B35AA4908C, 0x2F0AAA64C8B7CA5C, 0x71AC2A4D0949AD43, 0xBDCCA9FBC7DF3C67, 0x617989EFD8900696, 0xA106F9F72253C208, 0x6E12F3589B982F1C, 0x28EDBFCEC19F8836,
+					0xAB3FD07C20D5E5BB, 0x1608DC53DC94F938, 0xE06F3A501AA7177A, 0xFC76B27303CFFF74, 0xC14B9DB4EB4BAEF8, 0x6064A3F6F518EF32, 0x787770BB9575A3E0, 0x9C0BEA265FFBFC87,
+					0x293119F45B6C9FE5, 0x62F0B8243152211E, 0x5572EE644FD96513, 0x73298CC75E0FD06B, 0x5958D9C4CEB84EE5, 0xFF528A26A58A9D43, 0x4D76CF3A04E1CBF6, 0xD8217306A758F2EF,
+					0x0F071528E9762449, 0x558CFDF75EC2E801, 0x35025BD90B778D1C, 0x126C3CE889E63FE8, 0x2A3D76155EC5EFD7, 0x9437B4B7762D81F0, 0x9CDCCE323BC5FF38, 0x88BDEA6BBE0B7542,
+					0xD77B77654C7923D0, 0x7F3CA6A003A6EE97, 0x46DE5C8B7EA22909, 0xA16BB2042FA67CFE, 0x3743C58FF925A4F6, 0x752945A88182947D, 0x90F0A0FE2919BDC5, 0x2797486827DB8B7B,
+					0xF938F19DE3387B4A, 0xC7B7F7839B67A7AD, 0x2A8B5ADD580F46C4, 0x34F8EC641A31F68F, 0x78F9EC503362B9F8, 0x6D88CBC26A6422E8, 0x1052D67BA2C5B14D, 0x726E63C05ABAB68F,
+					0xEBCC503AB75F5E85, 0xD4A6D1A4EA817B79, 0x15A6E88478A1968C, 0x2FBCA9CD0EE5A9C0, 0xF78A7332D853960C, 0x6B426CB427A1236C, 0xD8214E75834572BC, 0x8E3DC519A5C4EA6B,
+					0x99A65F5B1A956CBC, 0x247BBF5554C88548, 0xD26A02E80B65FBA5, 0x12762F26100BF75B, 0xE45B6219EEC8DA07, 0xED63387A13D6F245, 0xDD4B66BEE2F96830, 0x013CD2504BAEAD37,
+					0x330BA1003BAF088A, 0xCB1B70DCE6DDE50F, 0x3E300A93F5C51C0A, 0xCE4C7CDBBC4F24B9, 0x5D0DA0729B49E7CD, 0x9FCCBB1F0FA8CC05, 0x9A63565D1E69F695, 0x37EA0159F424D7B0,
+					0x08E0946B61F2591A, 0x87FDD6B7191C6E0C, 0xC1C9D2F157B0B90B, 0xC6E160F9FC6C693A, 0x25CE9B2996535764, 0x6C537DE70218F86C, 0x335E2E5791C18329, 0x79A575F135CFE7AB,
+					0xF056A28828974705, 0x906F102F268740B3, 0x176240508A205236, 0x30C8A77EC5C31B33, 0xA617E8E517B45F5E, 0xADAED765D9B7D128, 0xD4245EB8605EF249, 0x0E9BA5E6AD17F93D,
+					0xC4EFA6AFDED9E825, 0x2623A6D1FE1514B3, 0x06069D6A8033FE17, 0xAA69148DD2011BEA, 0x9F6B6AED71606EC9, 0x2F5E90D0F5C1815A, 0x6737597860AF833D, 0x5500A057254EC4DD,
+					0x32796C1D886FD1BE, 0x330967BFD5B3EABA, 0x90C10A4D62A896F4, 0xE00E232C6F7E0C95, 0x16AAFD46D1A1C902, 0xC34239941BC8EEA0, 0x624C125870915427, 0xC4835928F7015664,
+					0xAD9F4578DADAA57D, 0x5C93B612FB83A721, 0x791F76C827EEB711, 0x1D61B1F636787BFA, 0xD1F159B537E679BB, 0x72FD4FC95386E1C5, 0x6D267D7C318D139D, 0x49E70416197F8175,
+					0xC78D4F8EA56D2C79, 0x83EBD8AF6233FCEF, 0x9B6AD818EB0740D1, 0xCF7F0DE5C4DB0D1B, 0xFE6CC19B4FC6C935, 0x51C8A7B06ADD5E52, 0x010EE00613195314, 0x064DAA8E19D53A25,
+					0x9F27F466E2165687, 0xDA7DDEED25D5FCC4, 0xCFBC55446AFB93B6, 0xBCD76A4424D1B403, 0x29E777C251E3B406, 0x71B9F34D3DF49845, 0x2164D9CF53118D43, 0x180B7016AB042AD6,
+					0xD907C581C6455AB4, 0xF72FBE002AE91A99, 0x92F0BB8718A3C4F8, 0xBD36E8C2AE9E9222, 0x71F5A00194C290D8, 0xE20C410F73899EB9, 0x7DCE38E03D59FF7B, 0xFA7692D6E7ABBD79,
+					0xD4D3A6033B247206, 0xA13FE0ADF2152779, 0x5DE60AC02AE15D08, 0x2EE592B45F9D39A1, 0xFB8D67E2CC3EB646, 0x5AD64120B788F197, 0x333659FF0959C225, 0x8873D64F12288457,
+					0x453B1D4D5F918799, 0xB43D779EE3F539C8, 0x2D91548EE771F160, 0x0BC9C5E80138BF47, 0xE85B687445EB3C85, 0x5F0EEF4EFCA8A6F4, 0x504C611C9DFD8DA4, 0x9020E73D53F7393E,
+					0x95DDECE443E9D0F7, 0x85B0B45E61D27A2E, 0xE6EF0A788A91A237, 0x8E095796AB3865D4, 0x7C2DB067654A4C85, 0x3D4F8C8C8A38FAF7, 0xF2E0D87A125147D3, 0x21D5EE35D8FC42D4,
+					0xDFD0D9545D395DF8, 0x789E1C4BE9123F4C, 0x6AA373118E01869B, 0x445D328CE8A56D3E, 0x27A3B4952B31F7F2, 0x90B0DB9F77EF7708, 0x01E5EEDA573A57A8, 0xB0FD798E70EDCC05,
+					0x7F25B4721C3F4921, 0xDEF2E73A89BA0FBF, 0x0F3DF64A787ADC78, 0xC330A6CAC9BCE232, 0xFDA8C7D350AE7EF8, 0xAB6CDB5ACF0C9EF3, 0xCEC97D79263F9EC5, 0xEC865558BD617174,
+					0xA5DDA7ADC25B13AB, 0x0C3381D8307056CC, 0x2A380FAEE0589736, 0xBA5E1C6116AB46D5, 0x85C0A4D961EFDE42, 0x061200398B7EC9FC, 0x72BC9FCAFF6C3669, 0x9E63274D76C210C4,
+					0x0DA3C2BDC5238BD3, 0x078A36D94783A21D, 0xAC492B9DA81420DA, 0x7B6C8E3700B368C9, 0xEE1DF8DC5975BC3D, 0x250A46F342CDC5BC, 0xCBB25AE9D0AE8886, 0xE0A623FBAEEAD8C1,
+					0x5E400C667935DA96, 0x2C2D4E56BE1ACAC9, 0x2ADDB5AFC53320DB, 0x9349D59D0FD0A935, 0xD46A72E7309E1EB9, 0xB607B1D04EB62931, 0x737C8CE368761D3A, 0x88873739EBDDFCF7,
+					0x9A8005447454D093, 0x29B8B5AE5A8EF57A, 0x3454EC61DE411D8D, 0x3F71F986C148D0A8, 0x52BBA6E1FF4E2B7D, 0xDA9287EE4F531C52, 0x233A091991ACED0A, 0xB8D24A15A4F21D79,
+					0x52AA8553A7DF3A33, 0x4BBEB300C8DA0D22, 0x4006C1BDDE2AC645, 0x288104205844B5D7, 0xDD1FF554E9FE00CC, 0x9C0171A2C312AA6C, 0x9842F78D3A5CCA4A, 0xB77536C3F82EE0E0,
+					0x46338921B1FE2344, 0xD773382E2AB426F1, 0xFB712F8F0F93A34C, 0xEE766F4FB2B44E63, 0x0226F5AB6038FE6F, 0x9D1EDFBBE9214CB8, 0x9B3F72EB377830FF, 0x962DB4789002E87A,
+					0xA9B1FFA866FADE1D, 0x68D1A511EA8194E3, 0xE0D21E29A04F50E4, 0xDBEB27A86EBB081F, 0xC0D0B5B9E747F333, 0xCEA9164CD37BCDBF, 0x818F31176E9ABD3E, 0x38B03EA126B7D03E,
+					0x9542D279940E1CD4, 0x18A7AF2E6950D1DA, 0x84F2547BD5686392, 0xB364EAE8002D9AD6, 0x1A0F0C1109C64E92, 0xF59C56FBD7D94C96, 0xE7D02EFD90E3FEF2, 0x5E3787B089A3ABF6,
+					0xD2CD8B91D282BB98, 0xD65E4E65110543BE, 0x2AC19B22C9D10DB6, 0x99EFF939CA1DAC3D, 0xDC17168C79A7FFF7, 0x5BCAF6F552B47F0D, 0xF56561B4B84B529E, 0xCDFD11678021F6BD,
+					0xA64EFA2C054FFA7C, 0xDF0DFFFE0A10D061, 0x27B309A4A2F70F9E, 0xBC4A8AF46250FC00, 0xBDAE00CCB44FE926, 0x605DA7C71D356F09, 0x96142E6B44D30C63, 0x083D9B35DEE90027,
+					0x6F75FF4EB854C762, 0x44A1116BA60895B4, 0x91D5B4CDDDF6685A, 0xBE2739A91C1C0791, 0x5702221FE169893C, 0x6DD2E93FA72C3985, 0x15ABD931CB9DCA4F, 0xAF22C10202BDFD21,
+					0x38F2B9626DC1984D, 0xFC462121A2B49327, 0x3DEC3A47EE93985D, 0x50018997BEA01DC7, 0xA87D263B07DF8CA6, 0xA3451ACA39A56955, 0x517299F4F9521499, 0xD9D42FAA887C2322,
+					0x392FDF827626A940, 0x3E0BAE19729E657D, 0x9A7C9D658AC7406C, 0x2ED22A46F045840A, 0xB364A4F565F7576B, 0x1BDB97007F1E1189, 0x5DA0C4EE805F164F, 0x4626805D1172031B,
+					0xDC1ECA5F7143B723, 0xF2D608EB77883030, 0x10811A4EA33F71AC, 0xCAFEF9EF67626758, 0x0B859815F4BE76F8, 0x1E8D3D15B9F55A0F, 0xFE2613F54305C0D4, 0x9A9D41A0E8FB4F18,
+					0x3C8600BC592CAA4B, 0x0804A83039D49C64, 0xA9E19460DADF143F, 0x5D44DEDCFD4440D5, 0xE61EBD8DF1B40290, 0xA9C56C1D2F413340, 0x47D5D5A0001D39B4, 0x3D75A9458FA40D1C,
+					0x35527FBC53677DD4, 0xB924A00BC1A2A0DC, 0x3B824D7E7E2F844A, 0xBDB0B60AF5784414, 0x6B03E3C85AB9635B, 0x8184CF2D232BDE87, 0x644DDB88EFC7E745, 0xB521CD1C8732AF7B,
+					0xBEC4A841436C021A, 0xB87A3521EFCB5201, 0x73C6B173A4894D31, 0xAA3AB782AC193B5E, 0xA985D971CE01407C, 0xE7159D3147534D6D, 0xF77CB87337E1794F, 0x8D4C04B656B1C0A9,
+					0x3F8B1EC46C944449, 0x9EE7F5C35A31512C, 0xBADAE9831D18180E, 0xF75B59E13799BAD5, 0x078FC6EA4AA262CB, 0xD522F564B342E8FA, 0x393ED09681703DA8, 0x44D73665D351B8DE,
+					0xFC74C0C381D28561, 0xA996E296C9492C8C, 0xB0888228855C4950, 0x293970A3DAF2FE71, 0x7EC68891AD89B3F2, 0xDDA0ADC9158DB386, 0xA851EACCBB99833E, 0x2653F6835A35C267,
+					0x6DB005937A2023D6, 0x6C55CB272E3DCDCC, 0x8A943B7ADC3BE639, 0xA688204629F7378B, 0x0510C86D1540BD7A, 0x88FAA5500BF89A6C, 0x2EB365F7A4D17EC0, 0x9B6FFD008F9C384C,
+					0xC2A6AA364C563534, 0xF54640D548506FE9, 0xDECA74FCC4CA96A9, 0xD824A6586BF6C72E, 0xEE08B850EABE922B, 0xDAECE5A98ED943AD, 0x84A309B07252F914, 0xEC6BBBCA514E4BC1,
+					0x85E73734244CA53D, 0x35E0A4D8590A13D8, 0x0C946E8ED295CCA6, 0xEA23554936499BE1, 0xA8518E4A48BA76BD, 0xBB1CB184E6686DBF, 0x43CE653A44538CDD, 0x7D108EE2E7E3CE5B,
+					0xD8EE910CAF8AC6A6, 0x48A8B83C036C1EA2, 0xA2331026DE7F7AF6, 0x32A3BC65B745FB55, 0x3E594528920ADD8C, 0xD73151AE69D02A1F, 0x4F451E135B48703C, 0x67383A2AAC7FFBCF,
+					0x7725F2AEA1B4F0D1, 0x5008D16BD6EB3973, 0xE12952346BAB2013, 0x533194C02A02ADED, 0xD3FC767409800B27, 0x28E2C8F559DF8EB7, 0x1DB7E2CEFD05DBDB, 0xB2808B479E51953C,
+					0x50EC20429CB6DB5E, 0x70A891B8AD456080, 0x70744EC8C7FFBB8F, 0x1BB33C44D88DB8E1, 0x71808AB6B34606CC, 0x1E6CB3994D3BA689, 0x90EC2DBD8E3BA9DA, 0xD789091EA7123671,
+					0x3CD382E2D2A12F5E, 0x486CFDAE11910AF3, 0x59A4F9780165F891, 0xB168B56B017336EA, 0x36D9B572B187CF88, 0x5CA9029C34BE0B2F, 0xC1E93EE977CF6A45, 0xA679B9F79F253F29,
+					0x373DA77541A91403, 0xAA4EE85D0C826BAE, 0xE7236A003027D9A6, 0x5815990B1C9E0122, 0x2493AB951C3CE4E4, 0x62CC25C8AEDEBCC4, 0x24F79C182B8CD671, 0x29E7B7E285041F1C,
+					0xB848CE9CB9886D54, 0xDF4EE49229DB2F0A, 0x693CFE4BE9816F67, 0x68E3DB0CFC064B7A, 0xF5629243669B37C8, 0x3E5A6A8E4085FFD0, 0x0125420B7B3518F2, 0xEDF85F9A28DF62E1,
+					0x1179201255CB3B3E, 0xC08D78CF9974502A, 0xD132D5FFCF779EE6, 0x2D1EAE721E8FEB67, 0xECFF4A17C19A65AE, 0xC3BED7D5CBEAA835, 0x0FC09AFC09279B3E, 0x4CFCF14CE9396313,
+					0xB9F18D8AA1835FC1, 0x8A77F608EAD3C366, 0xBD6A37CE14F953BF, 0x8C9C3DBF69953E5B, 0xF5A408CE51CC33A1, 0xC7B5CE5347D6933C, 0x0E9693DD8F9A848F, 0x1B3BF89B992E3D36,
+					0x202F9D3182E4FDE7, 0xBC7485BA3ADFDF62, 0x7EBF36050300E620, 0x486E214ED3059078, 0x10ACB6C53A6BA0BB, 0xC5BBD9CF0E92E2E0, 0x27409F3AA06E2731, 0x436C28B538E8BC04,
+					0x07D4A02C30974F9E, 0x3690718FD57857AC, 0x20CC57DADA1D8339, 0x1C1CE3A6FDBE05C6, 0xC780EB81121B955C, 0x5B6D8E26674D38A7, 0x875ADE9BDCD6BF93, 0x378F7BAABC88D902,
+					0xFA5C7634F4597FDC, 0x746275D4908296EF, 0x5778B28055247AA2, 0x548C3FC1B99617E5, 0xDFC1C3B3254DA170, 0x5784039927E98BAF, 0x7A876D6974C873B5, 0x81F071260EB88CA6,
+					0x1AB43A4702A1E3B2, 0xAAF79A24151B89BB, 0xD483A5DBD0837BE3, 0xA7615D0390FE879C, 0xB59166BBA9CE0947, 0xB83E9D4FE3464374, 0x8B145C6F9D347D57, 0x8D349C052F69E418,
+					0xF4536919ABF35A28, 0x00156A6CCC103DFF, 0x1C673892A48B5D37, 0x4A9898479BBEAD43, 0xEE7AB912EB8E999B, 0x68C4AC0C4AA6D1A6, 0x951828C0616C4019, 0xC2E1EAEA402271FB,
+					0x706655E64FCB9B9D, 0x1A72ECB7F12EA884, 0xA4A2E863AFF7326C, 0x25D57A8C48217BB4, 0x199068FCE0977DFD, 0x9AA54161AC5B9C52, 0x61B5E8FE46AEC7A4, 0x6AFE39629A169575,
+					0x75166EF4D139D014, 0xD916F6D5F0E6CBF6, 0x0B8C44CBF493A782, 0xB392C34DA98FDEB4, 0x1694CA510A650CC6, 0x49B03F0F87A4D80F, 0xAF003180303A8735, 0xC355DB695AD28E2E,
+					0x9EA7DA661C988616, 0x7618149E2DDE7ABB, 0xE12AB68B8FB6CE75, 0x27E72E783AE56D8A, 0x625B4A9DFB8DE494, 0x0610F3C74D739DF6, 0x20E0000022BF17F0, 0xAD49420B89BE6F67,
+					0xC5FF6D5CC4293A5A, 0x7A5EB27459E28AC7, 0x85C80A8F56D389F5, 0x80637D06CA942F96, 0x78FD769AB3220BFC, 0xD53F61A507BECD41, 0x112B6C8494A94987, 0xC9B6234A955F80D7,
+					0x558733376940D023, 0x4EC7B66F664B173C, 0x8C2D070EF1D4EBC8, 0xC30F23F6976848D2, 0x3C5B6A25C355A789, 0xF96EE2CBCD2FF97F, 0x2A1BD216A1793FE4, 0x58EE0DCAF2264F7E,
+					0x63525B8217D2E242, 0x3D4A9808A4615ED6, 0xCFA2AAE62662E80A, 0xFD621CBC5434A76C, 0x4507A52A38DE2248, 0x61FBC7388E35C718, 0xECC923105FED130D, 0x795A283563E1C0CD,
+					0xBD9D3EFDC1E39646, 0x76F6659F91893052, 0x983748B89E84D77A, 0x2CABB69CAC33D20D, 0x82B0C08B6C1BD68B, 0xB232DC4D9C26260C, 0x2FCF4D030536FC31, 0x68EEBDA8AF2A336E,
+					0xEEC52205876E5255, 0x1D2125E8CC33007B, 0x4BBC1DFE8A998321, 0x88E31939B35E960B, 0x1AA6287EEE196FD9, 0xE8391421D4CD7D67, 0x06DDB2213454D86F, 0x24D69B223BF7D90C,
+					0xAA495EC41E41A2CE, 0x84D71459D1588978, 0x3D39BED3F4EDE985, 0x83E3084ED7A9F978, 0x9BF751D614E1A6EE, 0xF75C53C6FB910B1B, 0xD77CA4181D279A2B, 0x5034A20DC9F2B9A0,
+					0x270F888C5CD656E9, 0xA95D03CD0050C288, 0xAAA5E62A804777E7, 0xAEEC0B221246AFBF, 0x4DF626E6C0F2CB5B, 0xFB298283468B41E1, 0x2FD9E761433359D4, 0x874743C58A71D785,
+					0xFBF3EF5BB216B25B, 0xAB775407E78DA5B0, 0x857ED491107033F7, 0x642025C1260A8AC6, 0xD74951EEED69A3A1, 0xF00B52AD963DAAA0, 0xAA819271B9A42099, 0x0F2CC2E9C9669942,
+					0x0EBAEDAE4B49D554, 0x4CE92B8831A20F70, 0xBB2744ABAB3C60DC, 0x25411714DEF7870D, 0x74A7DCACFD0CD0D4, 0xB6D0A19D83FA7DEB, 0xCEADD2E9F96775B3, 0x9F7E90E45CCDCAE6,
+					0xEADFC2384703B0D6, 0x32A8F0F49559CD95, 0x5A27142E16CB5456, 0xF56967FC1D4CF72B, 0x8F3CAFB5FD765AD7, 0xB3268E7853D3D53D, 0x537500A1BE78F850, 0x2A60FAA65C0B1EC7,
+					0xBCBBFADD988C3D9C, 0xB0324394DFEDC838, 0x3ADAE727E7975748, 0x4269ACAAC596DC0F, 0x25DE6453DF8CE913, 0x1DEA9390DC2B7EB8, 0x003CEEE30849F77D, 0x56E2BED947121256,
+					0x6FF9B81B4B2E2C72, 0x7076A0CFF86AD43F, 0x34CDE0441AD8CDC2, 0x51D712270AF77E89, 0xD25846FBC7BAFFCF, 0x0D1E6E6645A8B39F, 0xFB714CCEA320D95E, 0xCAEAD479110BE9B6,
+					0x598931FB93F8ADAE, 0x399E1F98DCF9BE16, 0x1C2207598A6616A8, 0xEF3FCB79DC066C41, 0x3BA4BA512FF950CB, 0xD971677B4C5C6712, 0x53E7FB923E47BD74, 0x444D16F254083C03,
+					0x393A2CADE3B31825, 0x94E2BB6B0A4F9462, 0x9613A31C0B32CEA7, 0xEF4EA652EC447A0D, 0x5F4FDFB0A12E4222, 0xCDE889F0C60EF0AE, 0x4B4939BF0F9DB875, 0x9959FBF0FE953124,
+					0x642F1A27157BC6A2, 0x53BF41B9F7F907AD, 0xCD31E4337C0B8979, 0xDDBD73ABC5CC60F5, 0x47739CE40F36AEB3, 0xE7EEB03848B0704B, 0xC6F02E8D2F9C6E38, 0x83C75F338D44ACD7,
+					0x6E9B0CE45F2EB593, 0x818017A1716C308F, 0xBB605F7FD1AC554F, 0x5D1D1F759714B08D, 0x50D6A3D863DF27F5, 0xDD91E2595F9FEDF1, 0x9471697EC5387BE8, 0x01038E3ED0BF45C6,
+					0x7B3F2408F3C88675, 0xE571FE664EA44ED2, 0x950F00EE3A1EB560, 0x50E0ACE72843B699, 0x5F77D85AD18F6801, 0x7C4E38275DADB4A6, 0xE909FCACCAD7FB5E, 0x619FFB63C113E145,
+					0x1E4172D32BDC7F54, 0xF05E21DF1388795E, 0xC4710DBD3278B3EF, 0x7BA11A052A69B7BB, 0x7EB2B562D46BC041, 0x0E3613E542ACDEF8, 0x7A19927688D24BC8, 0x3CA08E095992F117,
+					0xC4523896D6F01433, 0x62B0EDEFD773DBBD, 0x8D81EC0477657275, 0x2D1E067679DD3B0C, 0x285909491827E347, 0x1AC5B9463CD41107, 0xD7967C7926058DE3, 0x47D489B06B82D051,
+					0x937A646E23B48E6A, 0xA01735E3A54E8DC7, 0x1359BBCF4A5CF9E5, 0x71BED0D6CB90DFD6, 0x01B54009E621318C, 0xEFA5F1A1C104CC08, 0x2540696F7C702262, 0x64E9D77AACAF4710,
+					0x1C3464B4905A7E9D, 0x3415D1BAE5F91F29, 0x37455DB4A274FD1D, 0xA2359682002C7950, 0x18ECE587219C5BD0, 0xB33F2798979C7D47, 0x3CD8AC4CF4427844, 0x343D38130367CD37,
+					0xB7EDFB485B8A84AC, 0xEF316FD7135E1179, 0x637438740E1B0DCA, 0x4F3888877A8E5921, 0xDC036724A3DC3F88, 0x88779661036DD93B, 0x73E95FE2F3D715B5, 0xC36D24A92A75FD1C,
+					0xE04C8B277CC21979, 0x2AB8E870DF892A73, 0x1F0CC4BA2AB5F305, 0x75DF69C63F0BBED5, 0x1FEB71EB538661DD, 0x0B6A63916980F118, 0xADF1283086062245, 0xF339BF63D99107C1,
+					0x2A899738F0F0D9E2, 0x69FDEFC783BA724C, 0xF92440D475C64F6D, 0x34E2512B79C1B9D7, 0x9FCFC9915C75C2A2, 0x3E0E4155DF51B263, 0x90633E0CEE4D6DDC, 0x0D3E7395765F3EA3,
+					0xB4525E112074DFE8, 0x8E972ED21444D88A, 0xA6533609851AB043, 0x77445837EA61695E, 0xA06EA6799545E079, 0xAC483686FC5CD05F, 0xB17124D06EFEFB83, 0x9C1AF6CEA8C2CE16,
+					0x235D8780ABB3BEC1, 0xEB96CAA70E8663C0, 0x4AD099BBE95F6A09, 0xBAE67C414B226EC2, 0x79F60CE5627B531B, 0xC3744CF69E156D69, 0x1A918AA4D39B79E8, 0x15BA779AC173018D,
+					0xB2C35424A8F47612, 0x296DF87CED86B728, 0xC6157A81F2CF636B, 0x9CEA3F235A10BB1D, 0xAECAD4CE26AEE6B8, 0xC4214CD1A69E24F4, 0x5143C7A65D808A6D, 0xADDF0007FEB6CAED,
+					0x8287F884CB548D4D, 0x3616365139B566CA, 0x21927E172C10E575, 0x08AC72CBB57EE0FA, 0x8B3FD2F5A562FADE, 0xE2578ED7877CDCDF, 0x1A97053DD9DA1B26, 0x0CC75B2C45E56A97,
+					0x7FE03F1F6E845B99, 0x2DCA605648D83B4D, 0xEFFBC69655F3E559, 0xFFA8E44BD9AF113F, 0x836EEB2A25E727EB, 0x8D8ABC97167B7E4D, 0x90C22674EFE4B9E5, 0x0977D1D64339A023,
+					0x00F55DF2CC9D118C, 0xF7924DC7693D7F97, 0xF01F213C0A39E73C, 0xA5BFAC7EA8635A08, 0x2869C08E43C3CC60, 0x4852299660974D15, 0xE433DC066D151567, 0x42738602605FFC84,
+					0xD06D5FCAA97577F9, 0xADBD9184D7D6888B, 0x2B611D08527156A9, 0x860B68663E6911E8, 0xC7F76722667A9A61, 0x37673E395F5FF7BB, 0x9E43FE4036D348AE, 0x4C1653C47EF1CD3F,
+					0x5446E20353CB8B34, 0x4D56F730C869235B, 0xB9AB1D118D5157E8, 0xB79500C982CC753A, 0x6C5533041A94BBAD, 0x285E871349F043A0, 0xE1F79B88CD52D22C, 0xC17D5B2924343C07,
+					0x48EDC9FF0E1F89B6, 0x7914B08673910F51, 0x0D5F201F74DA97AD, 0xE19FCC4988614C36, 0x74715D3625A2A6BA, 0xB3D0C48D966D9E98, 0xE7CFDE414A00B067, 0xB3FFCBC9A012FC27,
+					0xD08E3B5C2F858321, 0x8E10200F141629F2, 0x8FDE6359BC5C9E56, 0xDC810CEEA579FDCF, 0x2DF1FF21086F92C1, 0x765C1E750811256E, 0xC430E52F722263C9, 0xDDB85BB5414FD7FD,
+					0xE441F9D65B6C82A9, 0xDE5F784E27053EFF, 0x65ECECC215403C00, 0x417453AE916A043D, 0x1D6CA8AD5653A3CE, 0x901F453E1D959CAB, 0x26D83C6C44A3FD61, 0xDBC2E5EB75F94654,
+					0x159448F0E0DFF23C, 0x35DD7AD43F0BC92B, 0x794F5B9716F73B43, 0xEA721A9B59444784, 0xB6FE09A694315B9C, 0x859E14F81CE2E064, 0x41FC60CB9A58C782, 0xE5D27236738DBE07,
+					0xAB2A662F5CCE64B3, 0xFB6778E38B061E9D, 0x1A71DF6205974447, 0x1FB94A6EC87E1D4C, 0x1E7BB2B008D84FF0, 0xC387D32BA446A200, 0x60C39FF7BE0FE15A, 0x437B5328BF140269,
+					0xCCADA436D2782135, 0x1810B95748E2A2DC, 0xD04936F8131904FF, 0x9AA498519850DC83, 0x2EFA32F2FC06E99C, 0x4F87C5DC031D1F2F, 0xB753A577F51632B0, 0xAFDF2E81DB53587A,
+					0xD7127EA33BC1A2E8, 0x1CCC61D96ECE35C8, 0xDA0BDEF6F1D77D0B, 0x396DD62D7F872395, 0x199C0CA2BDBD9762, 0x9BF20EE45B85466C, 0xFDA4C14FA70DD2CE, 0x00F51937BB84D209,
+					0x41A03F44D0991BD7, 0x6ED8E9EB979EE84B, 0x73E69C3FB103257C, 0x0879024FFFCB31DA, 0xE52D38229F9D4C66, 0x6C393C3FEE03DC82, 0xF49051CC83557A95, 0xD82F840ECCBD76C1,
+					0x57C0BBB4761DDD31, 0x8ED36EB04A6DBD2E, 0xF67330D54086AF12, 0x285D5E23FE5B4D94, 0x9B05E87A70A17D09, 0xDF0F5EDFBF686B63, 0x220C377CBF723CA0, 0x1D44EC8F440AA7CB,
+					0x34D167AF6063C845, 0xED7E9CB5AE5B70E7, 0x51A28580046121F2, 0xD1025FA3F28296FC, 0xDBF4CDCBAEC5DB15, 0xD99D7A2184CC9457, 0x061277CD7D3BD426, 0x164F7CB359C332A1,
+					0x433D80E88EA6D5E5, 0x5BF74E83E7FE3347, 0x09E88D7EA226BF57, 0x2936364CC6784A9C, 0x534787588E8B696E, 0xAF12B71387605DED, 0xEFFD181CF6CE15B0, 0x4B865A1E05C9F7A6,
+					0x7F42E8DBA164CDF4, 0xAB768F54BC47310C, 0xAD38281429DE202D, 0xB89F5B8C15B7C457, 0x33A3034244BCC5D6, 0x27DC60A619AEFD25, 0x31799C4A70DF08C4, 0x57BBA8654B40A44C,
+					0x6F02E685CD6598AA, 0xE7B29868375FAB25, 0x3BF7ACE2819AAA2D, 0x1885694AB3C5E3DA, 0xA0A9CF48C9863B28, 0x9C51588FC7DD1764, 0x785949C93C2EA36A, 0xAEA9EE5DB618A676,
+					0x888EA00B02E2D495, 0x48C7B702DFA10C81, 0x1FE99F200718A59F, 0xA9A2A8C26CF20959, 0x2FE200273182A665, 0x7DB32F9D413DB8E7, 0xA92DD949186681CF, 0x8534C6C90F0BBA5B,
+					0x784196D3E0E0C498, 0x7E3FA0B9CC05D05A, 0x1B024D06A598E723, 0xA81D3C022C94C515, 0xA8047B9B0644760E, 0x91E195FADBC1E15B, 0xDD90EA39F9E3CA72, 0x643EDD8A44D3AAD0,
+					0x6695695A781D40C2, 0x7F670EDC4C1604B6, 0x84E53145991A3E69, 0x0CF89A5B8422D302, 0xCE27872791DF8731, 0xAC5399D0DE832B26, 0x7669D70588C8E62B, 0xDF0850248E3E883F,
+					0x06EA34C727A7CF67, 0x968694BA4CD1E16C, 0x7BC205AA985F5071, 0xB05B57297D1AA0EA, 0x586F57EEB6981C98, 0x29272957286714DE, 0xAFB79BAB6B9907EA, 0x1C5CF6696F51B22D,
+					0x7378A2102A036CE9, 0xA5D05298289B46D1, 0xBCC5652612AACD02, 0xFFE0C1E48D086A32, 0x9528B1E94465687E, 0x5DB214988FC3BC4F, 0x98ACEC5E11CEC9A4, 0x09240C98B59B9D9C,
+					0x1C6D73E4FDC4CB08, 0xF5C8CC48BE667CC1, 0x1A03BDA0E61B1C14, 0xF05774D7C9109E1D, 0x270BEAB38D666EA8, 0x6552BAA96300D5F8, 0xD9874A654E372738, 0x86AB2204FD94BFA5,
+					0xA1741F608250C0E3, 0x9003F8A28593930B, 0xD81814BC45FEE941, 0x31598B57A4FBB563, 0x667B46F88F06A168, 0x2ACA1047494D6CE2, 0xC4A4885C4DA7C1F8, 0x33B9764326F666D1,
+					0x84A9045199797DD1, 0x03202AD38FEB371F, 0x8025F438F179B099, 0x1C7DB67F84956B6D, 0x190AF63264C9C9B3, 0xE1A81A205ADA6A34, 0xC890C3BE6F98B202, 0x70537761D8335898,
+					0x7FCC375EF7699B65, 0x7EC18149BDA9FD45, 0x89A5106E19CB4DAD, 0xFF102E6A60A0318B, 0x43C5BF8BDD60B53A, 0xD520B06200C7767C, 0x61473C6A8D788311, 0x261A9500B0E027F4,
+					0x1BB3A9AB9A3EC2E2, 0xB64984753EB17CE8, 0xB764193B52D0C50E, 0x09998454A5F506FA, 0x1A6F9A5AC1A7772B, 0x838EBA6DE0F22BED, 0x419D2B0A22BD71C0, 0x5D3F16E354F10754,
+					0xF0334849298925A6, 0x1867C3AD5A21B46E, 0xD8978C680AC18046, 0x3940CDBA63AD198A, 0x2183C1034724BF61, 0xA13EFF831F23C7DA, 0x457A44ED97F62F02, 0xB1175C7EDE1C492D,
+					0xAEB03B797FAF5EC0, 0x05243D9AEBB1AD67, 0x105312FAD88393AA, 0xEDB73483FEDF3A63, 0x099681D61B4A99AE, 0xA914C71F99DFE57C, 0xB9FAE6FEFE8EB678, 0x4D7A50737EDC4554,
+					0xE5F6E51D823BEBD7, 0x219EC356D0505C03, 0x0E435B5D4955DE6B, 0x563F7B17F07725CB, 0x54F6E1A535C1B94F, 0x0E32B1C78633A7FE, 0xC18BB0C8242FFCEE, 0xCEAE04F09021120A,
+					0xF4A6797A96B33F98, 0xCF409CCE17C4AEF2, 0x0C490B11DA015D29, 0xD822B68C12B0DE63, 0x8E09D86320CC95BE, 0x01D7FE242CC48F66, 0x49162BBD98741337, 0x6F3A9261EAB6E0DD,
+					0x6F90BC92526225FC, 0xBF52364D8882DAA4, 0x6BE2A6A304D6E6AA, 0x07BDE4F946C4F446, 0x0FF538860358EE46, 0xF8F18B325A833733, 0x7ACB1A261270B250, 0xA7ECE066D9A727B4,
+					0xD82DD53AEBFE20B3, 0x8865412526D2F2A7, 0x10D9AA747CE4C83F, 0x42174DE1E0C3DB49, 0xC0EEEB848434EC87, 0x835F849CD51D0D59, 0x4C66EBB3A7AF7C93, 0x2E754B88C3AAA476,
+					0xF4EBDD633DCE3590, 0x4D6872C645CB631F, 0x0E7183A9E3332A3A, 0xD328C7FFD8B919ED, 0xD4A3B33BD467A61C, 0x54E63242DA320148, 0x76AF593FF9CE4622, 0x2AAD04F08ADAF167,
+					0xC2A70601CC719E85, 0x16EB13A11027FB56, 0xB2EF6B9BFBBB02C2, 0x9CC751B49A2EFB7A, 0xEFB2C4043AD5A270, 0xBB3874B2B522E4B5, 0xA5C2C90CB506E010, 0xF27531759DBC843F,
+					0xE81AC908C0E399E6, 0xDC9265ED9A1A2691, 0xE54FC3F1F0FC7848, 0xD5BEABEAAFCE29AC, 0xEBEF3F689A677363, 0x89C1F061F69752C0, 0xA465BD580031CA44, 0xEE8945C828BAC680,
+					0x759B93FB1F4E8467, 0x7C48B726499E3F7A, 0x46A8D1711CF5B3A4, 0x8F10A6E6945E8427, 0x17BB0CFC403CE2D4, 0x44179BEA333DBA5C, 0x724F7335D27FCA97, 0xCF1D016C1DB88A26,
+					0xD98C1383E6152284, 0x233A7CDDF89FE5DB, 0x0A5754B4B1389A67, 0x5824FF42E96AA9C3, 0xBA511D01676E2F01, 0x6851E640D7802B9F, 0x89549EB0C43B7588, 0xDB1DAD7E12128525,
+					0x10B00C801F25774A, 0xE7BC28831F2E1B28, 0x2302021CEE26F923, 0xFBD2FC9FD713A342, 0xB7CBB700F9260763, 0xE947A022819F5925, 0x705C98A88AA55207, 0xF2384CB79140B926,
+					0x097DB15774C8F7B7, 0x9B1B7B921F145477, 0xC7884C1D7BEE641A, 0x37A7C9C85AF758AC, 0x2A755C1543022028, 0xDC4839DB0470E844, 0xE92609E01ACC5414, 0x5751BCE5B9A6B641,
+					0x8B6060A82F6D7F12, 0x820ED99B71211B0B, 0xD343A4839CE913A0, 0x82D078B51FA00B1B, 0xB73C1B2B3505E4EB, 0xC9B60CCB485BE3A6, 0xF10B26503ECFFA81, 0xEAC9EB79AAB2DE84,
+					0x2C21FD5F4E7E69BB, 0xFB9AF9C2E868E994, 0x9A6FE957E458031F, 0x286520FB0F3C2ECF, 0x03868259FE88FB13, 0x48C56F4BB7987C10, 0xBE81549E1F411690, 0x3D32A9F742C2BF2F,
+					0x8EBA0A93C06A68CD, 0xC310E6FC57CDA37F, 0xBF81CCAE1D290CCC, 0x99A768783C552D0A, 0x2AF66D889288D63E, 0x2010A28FEE0C4314, 0x9865AB3C1C1F174E, 0xCDDBA51B660DA72A,
+					0xC62A6E1971215553, 0xBCE70B3EFFF826B4, 0x9B5ADE718D30E9C6, 0x574FE85164F8A34A, 0x82134712B650DD07, 0x93EF8B2B56EC7CA1, 0xF2219FE9AED03902, 0x7D37E196871E4FA6,
+					0x4EE8F8993975A183, 0x4F70FE4FDE7793AE, 0x287331CEFE0800B0, 0x9F492F47E9BDA717, 0x728CC24B7A87DD8F, 0x1F35332B74D332BC, 0xCF46967821B5BE56, 0xEFBF72121B5E823F,
+					0x2051F8EC8C03EDFE, 0xBC8F7780B3597BF9, 0x0E59327C950B7D77, 0x7726786C80FDFACC, 0x6357E5D1651534F2, 0xC5114E6A9D1B897A, 0x66B7860BB49DDE57, 0x4D01454E073EEE81,
+					0xBE0FBCAFBB9B778A, 0x49E908FE47E09002, 0x17AA76813BE9BCB9, 0xE607F69D4166904E, 0xE58E9B744F8366F4, 0x47C6D6A5FD4E2D26, 0xC340C66D767CCC62, 0xD0334B6FCAAB9AD1,
+					0xF79B24A359BA6B47, 0x89811A6E5D7740C6, 0xFD48CDBE237F4AF5, 0x593FC22E935E884C, 0x3F631FE352DCAD65, 0x1EDEF55B3950706D, 0x44CD1D2E7C65AB52, 0x6E49761C83C835DF,
+					0x4057704D73FC73A6, 0x252F1887F0C0FD59, 0x6DD6B510B71E47AE, 0x0717EC4A7693960C, 0xBF476EFBE1197CB0, 0x5557531306D22BE0, 0x2C8221BA5A68A36D, 0x6EEEFA93E10AC5D9,
+					0x04D14F9F9A064AC3, 0xB417A4E8CB3C1988, 0x4A1054DDD6A04DDB, 0xE7AF0AD84B060843, 0x6085785C061044D4, 0xE482B930EBA2BB58, 0xCF935154D494A320, 0xE90EB6E7DFD3E69C,
+					0xD90B7A7F77A28270, 0xC7490B2990F81BC0, 0xD1D949B6C9A8491F, 0x10D8042A69ED3A06, 0x116CAF11CB44B1FE, 0xE356220E7C3D5236, 0xDC3D79B73E9A18FB, 0x60C007A55134B157,
+					0xD9B675AEDEA1F81E, 0x08DF3228438E6BFA, 0x09597A9544EC460D, 0xFC6AA184A4B0A28D, 0xA0796F7FD0823BA7, 0xE6AB9A7303FBB36E, 0x0D68A6D252CE5486, 0x1DA39B3361AE2952,
+					0xD069606C8CF6BEA8, 0xCAFB32CB3EE5F723, 0x23A4DF9967D4CCF2, 0xA68B5404EB9D0BD2, 0x4241BEA5B594A04C, 0xB366D3BBADDEFB45, 0xB5496FFB5F92DE7D, 0xD80EC7561EB012D4,
+					0xEBF0927AB10DD641, 0x85DA7419745DE302, 0x15A45D0B30FB95AE, 0x3D5F0569507B3BCD, 0xA692EAE22D5D5643, 0x2CEE4B07C7B4AD14, 0x84FBCEE85E2A3D93, 0xA5F03CC75EB340A8,
+					0x03973EB101125171, 0x7F96437C12C8A61B, 0x2D5906A3A3F8DBE7, 0xC53B4BFEDB064CE2, 0xA65C09196C17580A, 0xBF3DBB922B34D6F9, 0x25EF1D77F9B8F601, 0x10815D37096DFCD3,
+					0xF77935A54EA83E0C, 0xF81DCEACF7D52969, 0x233E25D8635654D2, 0xC1D021D00BF940EC, 0x221677E1EC0DF7A2, 0x381F0ABCF1C51ADC, 0x9148F0CB6D3780E1, 0xBC9DC99506424582,
+					0x5D736A0BD9AE3741, 0x3E6A5B38FF58956C, 0xEA773B018397378E, 0xC6FC5CF393F2B0FF, 0x93F6B86BAC5CCFA2, 0x47A9101FA58A730F, 0x1124252690C2F17F, 0x2F145D3468E4BA45,
+					0xD081CE87B6D0A42B, 0x53C9E9C1B3BBD769, 0x04A84071984321A9, 0x316D6416BEA4C09D, 0xB982583E7BD5DAF4, 0x5E3DBE5A952BC69C, 0x3E75610EB2F8489F, 0x6864E9979A671332,
+					0xBE73CFBE6F4FB45A, 0x019BAEF9528FCD72, 0x0AAE88283940DB4D, 0xA1D00FF8628C3C82, 0x10996301C2F3BFFC, 0xC9788BFB2B4EB0EB, 0xC3005EB9BA087299, 0x9E9839128C8BF256,
+					0xE1B3D69CF48F16CF, 0xFAB2A014E8D3D44D, 0xB11B5CEA368831A2, 0x6B1EBC6F1C90A84E, 0x9F27F91FEEC27C17, 0xC4FD1BACBB0C0939, 0x8E0F6DDA25F10898, 0xB9CA7BC74CFBDCC6,
+					0xBF623A708844A7E5, 0xC2B50ED33FA977D3, 0xB8D3AFC52A503E9E, 0x585784335D0356CC, 0xAFB91DEA5268C295, 0x619057C6810CA9A6, 0x86273E0E3676A694, 0xAD77A30936F9A1D2,
+					0x853B08D9E66746A5, 0xEA524B2977DFB291, 0x714B08A9DE7C2563, 0x3B4CE37A7122204F, 0xE0DE520AEBF02C96, 0xF748A72567CA515E, 0xCD20B32AC665D3A9, 0x456A59CDC3748165,
+					0x876806B483520208, 0xA4364165B7A0CD7A, 0x78E31C53A2BF19CC, 0xCBFB997FE87BA5C6, 0x703336DA794276DE, 0x1B71D14AE4C456D6, 0xBE4A5C791889708C, 0x39726F4184DD5ABC,
+					0x3B5EB1606347C520, 0x6E7A8AF55FCA2690, 0x76A71D5D1840037A, 0x492BB75A4507F7F1, 0xF2C3D7DCCD6B06CE, 0x3AAB77738028E6E5, 0x821E4F0B5FFD24EA, 0xAFD52722FE6046DA,
+					0x645A55D778A3D44D, 0x856781A9B16B2EB7, 0x792CA1B10A297AE0, 0x3CA87C50B2FE4D82, 0x2C0C90CE8B66563B, 0xDE464B1CCCD3B7E3, 0x9D5335C7E59747CE, 0x846FD8DABF6AC7BE,
+					0x0E09C7A7E999A76C, 0x44FDDA523BC14A05, 0xE5021B86FA2FA78B, 0x2CB9E23769C6289A, 0x311A17D9622B270A, 0xF975783006340D96, 0xBED89CD4E8ED8414, 0x71CA64AAFC36BA73,
+					0x888EFE12C16E2C25, 0x56B31440CADB1848, 0xFCF9D2CB7927F157, 0x0B88E267D0BADA94, 0x67A23506903186B7, 0x3E01553E4564D5A9, 0xB1CB007DA62ED785, 0x359C7C9467B4EFC5,
+					0xAB8034F3BF7D35DE, 0xED73896C706D8686, 0xF7F59F8F2F94B076, 0x17A28799A3221E80, 0xADCC2879BE97BB34, 0xBEA4FECEBD65C574, 0xB05844061F7284BC, 0x21B2E99A8FC912F0,
+					0x777F74AAA3C892B5, 0x1743FD6BF5341B71, 0xE7016FC6223571D6, 0x2B916C38F1BD3366, 0xD6DCDE55AE558047, 0x16A65FA1263B0F4F, 0x99C483C087B800F3, 0x8414CCCE474BD369,
+					0xF9464996876A41A5, 0xE920151F22C7E08C, 0xB05DA104A18C3E22, 0xC794C92200071E53, 0x7D5EE5A2B3F95DBE, 0x84A230B2EE6E9F39, 0x4BE896012E7E1786, 0xD76263D2337CCE4A,
+					0xE982E4317700A9ED, 0xEA9D8182315B7C05, 0xDD2AD794DDBE732E, 0x3611B6760A4BD810, 0x15B486B1F72A7A84, 0x0A10193A972C13C0, 0xDD574F149BA75647, 0x9CDB8CEB0E3CDC4D,
+					0xE749C1244DFEDA63, 0x154C634F32B02404, 0xAF224C82B35A253D, 0xDE375114D090B66D, 0x00C635A72D237067, 0xC8EA5201591CE991, 0x3E3BBAC295330EC4, 0xB39161275E14D599,
+					0x279F0F6C956064C8, 0x2288B5D297645427, 0x037ADD2EEBD21E80, 0x86638C03030585EA, 0xE96AB47214DADF05, 0xFEFCF6D5B8D5152A, 0xEE904E6DA93E92F8, 0xC8DC5B38ABE0A414,
+					0xC1E77354481FA8B4, 0xF49A3ABD962B5F51, 0xBC2F51F73029C81A, 0xE27D05B32C1650C8, 0x346DBABA9C88FA28, 0x2AE57FC1968CF0F7, 0xBA51CE978C1D830A, 0x09DA73885536682E,
+					0xC647156EB9D7C74F, 0x3ED55C42CBD96FE0, 0xCF237CE4744E74D9, 0x84E2A943B0B1C8AF, 0x6246B749A5FE80BB, 0xCAB41C9FE675C13D, 0xDC92D3D21BB62098, 0x97FAFCE3546F9913,
+					0xD14B7F328EF14EE4, 0x5866C2D08DB3D99E, 0x2A9D2BF004DCA53B, 0xC1016FF3FE08BFA9, 0xE9DE9373C0DDD390, 0xE3AF2D29D3EF89F5, 0x4A76EBE7E061A1C8, 0xD1F0FF7F1946D49C,
+					0xB20722DDBADF4B77, 0xD42976FE89C443F5, 0x991B72241FE87DC7, 0x623FBB49C9D6550F, 0x97DD338FCD669751, 0xE983289AC188C06E, 0x6C9C5545A26F3A07, 0xCE453A0926E34249,
+					0x65EAD6B1FFEB7B4A, 0x37E02BF66B187BB4, 0xC1D1E2141A530192, 0x1006F40A988BED7B, 0xEC86BCDCF7D8D99C, 0x2949CD171B91D877, 0x7941FAA65C91C36F, 0xCD1FBED01A340D55,
+					0xA697A64FD60156BA, 0x43B9894CFF12F635, 0xDEFE9D2ED6D34353, 0xA88BC5BA57248BE3, 0x5719661EC3184AF9, 0x4C416E6A4C543342, 0x40845C00B32277B8, 0xF79EB06432DE12B1,
+					0x4103313942CA88AC, 0x8BC573719AD349D6, 0xC96DF382141E9227, 0x7F830B42BE690B63, 0x0F0ACC1EB036B7FB, 0x3101C55B630B4284, 0x8AF2DF21B3F1284D, 0x2A10106194F0ADDE,
+					0xFBD51CC1C4047745, 0x3732425C2E43F12C, 0xABF11A427995BB8B, 0x6EC8DB3A29391378, 0x50FB28108E754509, 0x1FC873BB884E7561, 0x5E2410011A1861FD, 0x5B7F96BDC2116793,
+					0x99757DA1FCF4E62D, 0x237394C0AEBD2B75, 0x69126090E194C6FB, 0x1D145D976207FAD0, 0xA05FB623DE5C08EF, 0xD63D63668F4973FC, 0x6A7651258B1F2515, 0x5E9049655E05E91B,
+					0xB5D9EFBF5582E674, 0x8BDFFFAC8CD84D49, 0x14FEC8A43FD4977F, 0x7EA54E0839CC9E01, 0x864D83E03B92A690, 0xB359F3E6A7120652, 0x7949D48FFDCCF37F, 0xFA852BFB6426E6E0,
+					0x6498A551FAEF4DD9, 0x55DC7A120AD4D036, 0xF65C64E04032CEFB, 0x825319B315CCD28A, 0xCEF61E4554AAC71A, 0x1CE59E3F3CFC343F, 0xDEAFD45694B2F5E8, 0xED79CD7F6CB23279,
+					0x2C98A181BEBAA0BF, 0x0BCD195507AC6410, 0xE6C98620E35B18AB, 0x997B852B1033882A, 0xC82FE2D0190C8015, 0x2B4D77299A980137, 0x75CB82F4A7FD3C60, 0xAA7D3483BB28CCF1,
+					0x078E255526B2CD62, 0xCE55D0085C158735, 0x6DBDDFAC2A3BBA15, 0x5EB99E4A6A9EB2CC, 0x6FB0934B814A813C, 0x360B203C514F194E, 0xFB60771DA190A90A, 0x942FDF593A3A32B7,
+					0x293F6F338F342AB5, 0xF7773D14888F12FA, 0xFAA728FE9668CC38, 0x179E87DFC922B46A, 0xF91EADF6559C1380, 0x1155AA4F69C02755, 0x26FC639A9972DD8E, 0xC24861B51DE8FC7C,
+					0x77899CA530200AC4, 0x6AD02AB8442EED65, 0xB450D967EE368DB4, 0xBCC9A52978B58BC4, 0x5B7C8551912EC92F, 0x26154C9B516A3DF8, 0x327D1BD84C444C5A, 0x3E685FB1AB1B8B3F,
+					0x0163CA4EC7FA51AB, 0xD31174EF53F1340E, 0xD3B81FEC4F3C85E6, 0x7213422F860EEC16, 0xC83F259543B704AE, 0xC2261FD52878BF3B, 0x58492D99BDF5B757, 0x9CBD40AAB474B2CB,
+					0xB9031FCF30AF1AD4, 0xCCC7D1A0DF9020F6, 0xE16D62C5D37404C4, 0xA1C207768730F529, 0x7EED2903A5D8628F, 0xE597720B5BF69797, 0x563FA8E3F8A1F2F0, 0xC8E2EEBEC7262FAB,
+					0x0618139738564734, 0x7153E6EF8A70FA0F, 0xE7B4FFB3C52E075B, 0xAB20C15470DB4489, 0x18F8B4423504CC34, 0xA9748CCBA1BBFB78, 0xEF80ED5147AA7736, 0xC2251215E8B719A7,
+					0x638C74DDBFA2E8C9, 0xBBEC0B86F8A0FEBF, 0x1152BB46F32B491E, 0xD7C1F6CA4D46551E, 0xBB551323020B8995, 0xC9B8C3BCDE8DB923, 0x86A4016488A350A7, 0xB6ECA4619C3F9CE5,
+					0xA42F5BEDE505A787, 0x40231B17C86F81B4, 0x61293D700B3AD87A, 0x50B1B1EBE606905A, 0xAC80CF5205EA83CC, 0xD942BD23B6A17DE9, 0x4D633B4313A5C430, 0xA30409F1283BC924,
+					0x9D98802116D6613A, 0xC9A5F8BDD23FB6A5, 0xDE0F79448E4B4380, 0xA7F6403F8451DD53, 0x402513CE77E8B787, 0x811ECF84F36B24D1, 0x3A802137A1A3C51D, 0xB2555B19DEF80910,
+					0x99B76BF73461127A, 0x8AE38CBABAC35D46, 0x756697DD7B4F3A4F, 0x1F3C4534530BFFFE, 0x3FE0E77A12D872D9, 0x22DB00CD49F0BBED, 0x7D3E2272F057A734, 0xA121643F1F35AF4F,
+					0x3A8DDBEE0B489845, 0x70A09A5F6FD6F170, 0x79E96421FC8B6570, 0x9F2E53858AA57432, 0x17CEE1AD85F182B3, 0x710A3187AF304E4E, 0x1BF981931B893740, 0xD8D465997E747A0C,
+					0x8BE46BE9CEEDB034, 0x10A506ABE22DE0CC, 0xE824F6989C1705FB, 0xF7D7F4EA9B324CEA, 0xEC4819315577E631, 0x728C3FF448B86FA9, 0x3A0F3BD2E85D7872, 0x583CD926D060AF7C,
+					0x99A7477010B79A02, 0xCE99E77ABC92FB3B, 0x8FE535B900C4E86C, 0x057596E5C9D3A6AD, 0xA598789701178794, 0xD595343E1F95AAF0, 0x0B6498ACC07B87E1, 0xD82EA7FEA7B6798A,
+					0xD7B3E2D57F2F362D, 0x42F84BFABE4872DC, 0x821EFED6039BF2E0, 0x59260CAF210792F8, 0x6AFA9AC120102F48, 0x0FFA63486983EE73, 0xA19BAF3102198ECB, 0x92BEC1DDEADCA432,
+					0x0A7E6AB792468569, 0x44C497D82F3A084A, 0xFB07CE2C824357E1, 0x5E55CCA65BD8C7D6, 0xF409C4EF9C9F405A, 0x2CC3FB0F4534B7DC, 0x06CC7AAAE6A88D72, 0x5BED1D921DAE8BAF,
+					0xD6DDDA9A96D4B292, 0x788E5346CD2DFCA1, 0xD6669871EA75B16F, 0x9096FF0A4F0D8041, 0x33E16E998D54547A, 0xB446D2862EE8DCFA, 0x4736EE0807D55DDB, 0x91DCB04E9BDBC501,
+					0x68C19D44174068D6, 0x98047CC975B2C3D7, 0xCCBCCC32328D60BD, 0x2E65C08DA6D1059D, 0x3DBDEEE6FA5E1C10, 0x306D89D02A204BF3, 0x072695DCFA14CF21, 0xB7BBA6A65881C1A5,
+					0xE5B97A13DA28448D, 0x303FEED4B6CBA283, 0x0E48BBCBABEBABE9, 0x82AD8052139A54E7, 0x96F4399A8D60F58E, 0xE6B55ACD4D121020, 0xD52B40BFA50A3734, 0xC3B19861ED9DA23D,
+					0x70FD4C564FA1452F, 0x85AC99435C076FDA, 0xFB287359348626AB, 0xC97538B9908A6E9C, 0x75804ED83CBBD660, 0xD8DCE7FAC2BD5C89, 0xBC514E571DE97679, 0xB5B540A08C8FB68B,
+					0x98A609C3BB9C35B5, 0x550C5ED22B74E0D0, 0xDE1A6A28978A3A1D, 0xB8947CBDBA7652C3, 0x466CB5C8A56EE390, 0x84981C9B5F14A7A2, 0x50E458C7932B42E6, 0xD5A133A89FCAD450,
+					0x357012FCDFA3FB66, 0xF7130718ADEE4FDE, 0x2F964E9660AC3EB1, 0xB38B19FD99524375, 0x70347F7983AB1251, 0xF9635CEEDA2E9540, 0xE10FDD948716AA2F, 0x7706511D88ACA5C5,
+					0x036F813A6D9D6FFD, 0xBD7179151D972AB7, 0x7E29B4EC6DA49925, 0x31B93F7068B58D7E, 0xE37DA3C25EFA79E8, 0xAD44A1EF1AD80D4D, 0x6875F07F0E469330, 0x82B52642934617EF,
+					0x02E11E862B61806B, 0x40DAA7F58BD9A477, 0xFEE10F9E8A5CB469, 0x0FB1C912EFCF8AD8, 0x65E96654B7CE06A1, 0x0489BF64CC26890C, 0xE143A5F904329622, 0x1DB69F516B3A6F5E,
+					0x80A5526103515E58, 0x144E7140EF30C40F, 0xD313A588AE230E02, 0x28FE9BBB2BDAE744, 0x002CF607B870B285, 0x98D3A45D030952DD, 0x8E5A6940B0C3C3C8, 0x2C840EB32874782F,
+					0x8F0CE426371C8A6B, 0xA60B3DC07C5FD6E3, 0x0B0DB7DC7F89D188, 0x5F15B6BFBDF18C9C, 0x161C0D58521363FC, 0xC39A01609806F081, 0x7BDD2AD25C6E82F5, 0x870C2BCCBAE7630A,
+					0xE343CD152345C382, 0xD5C0736E357231D7, 0xE880E7DD65F046E9, 0x26223A60B131FF5B, 0x00E055957915B8AB, 0x58741A6E21A752AE, 0x0D7D54CC1E39B262, 0x1455632BFE57D53F,
+					0xFA233CC6D3C3937B, 0x6C16C616D58DF5A7, 0xC2F59F8EA69EA39F, 0x7ED6635B40EF92DF, 0x25B3B8BB6492FF27, 0xF3E52C79A1264741, 0xC3DE921325D2927B, 0x6180BEDDF58E923B,
+					0x55A1766B932C095B, 0x2F094B93C8DAED92, 0xD206630A286C395A, 0x3C50281D2B4B3358, 0xEA0EAF8D887613A6, 0x5D9CF401DC38C00D, 0xE62A9ABBABB5343A, 0xF4FBECB2DF170B5F,
+					0x77017B2E1ABB7F6D, 0xE767A0285BC7EF9C, 0x222B126429990FF6, 0xB30F673E276E450A, 0x149D004506F4F4E2, 0xDAD43B1F836A789A, 0xDB4F7965901660A2, 0xA10B039B6A6EFE05,
+					0x0C6879BEFD8BA4DC, 0x43C6AC1CD9646FA9, 0x02A228282FBF40B8, 0x70E000F174CC7563, 0xE5F6081BC2442A25, 0xBAFD20844663DA38, 0x25559BCF4FAA9305, 0x9FE957082D309221,
+					0xD4892F49E9A6BAA3, 0x0345510CE433B0DB, 0xFADBAB074D0D09AB, 0x8F90DE52A0ECA203, 0x134AAAA4C545A0FD, 0xB37CC65F60151D74, 0xA79382FA8D6D6E6A, 0x06F34EC1A5F08B11,
+					0x775ED19812D977ED, 0x0BDB5AB3CA4FC2CA, 0x53586A6456BA99E8, 0x2D28282B4E9A1807, 0x19BBC285C0793370, 0x47D50285D2B34614, 0x66EE97D3BF1971C6, 0x431584A8134F7EC9,
+					0xCF9715DA12C8E387, 0xCED95BADE49633CA, 0x93BF685C8A25E096, 0x83812CF6A60143EE, 0x3D675A671F1F1AD9, 0x7FF6A9ACA4682647, 0x3811C8259FFAC103, 0xD0AA866698784A0D,
+					0x74F7630B58F481E8, 0xD6B77A61FF73B059, 0x89F026A9736BE911, 0xC53DCA46AA820CEF, 0x6AB03B401FCE803A, 0x9C3D28464309CE47, 0x9DF71E33BFF0FBFB, 0xDA9C28BB98532F28,
+					0xEFFDD9E42ECA961F, 0x258A86C389475ABD, 0xE2CC4F44AF65FD76, 0xFEE1FC6B80610782, 0x7F09E08898086D05, 0xF83B7883A8A113F9, 0x8E6108C1C0B87C79, 0xE1FD9C4D8FEE4602,
+					0x0FA86EA07C046BDF, 0x9F8EFBCC1C03C2DA, 0x85DB7548AE66A67C, 0x431D413A6C25DF35, 0x30DB85CE7216C06B, 0x1423247919F883DA, 0xBBAD74F8050DF90E, 0xDC604CF606F8E5AC,
+					0x1023DEC4A989676A, 0x34E06A1A2572FFE2, 0xF6F82233FCE1D5FA, 0xC1CBA4CF93A44D06, 0x6676D9824F593BFA, 0xBE93E3B789F4939C, 0x8E72D00EB0B47A72, 0x0667E1DE1B6C1EDB,
+					0x6004269C77F3753D, 0xC19ED4292C921F59, 0xCDD28A70E94475B2, 0xB47F9C686C3CFD63, 0xAC244E3736424A3F, 0x09548E793020F9D2, 0x0B4F904B7B64603C, 0xF8C4740AFE5AC335,
+					0x1EB2AAB36BBAB6C0, 0x9C7FDFB449545997, 0x600F279D01E60F09, 0x4D5B3707EDCF6CBB, 0xE80490181DD648BF, 0xF30B6466DDC691C5, 0xAD2EC6678F2609F6, 0xE56CE80B13103FC9,
+					0x6A31931E1B6F1BD4, 0x4F2733FEF6999316, 0xE0191A92A3E92EEF, 0xC608CB3DEF86F49D, 0xAA36EE0F8E942CBB, 0xF943BD744D52EFC1, 0x4DFE3444C71EA5AA, 0x44096AB73227DEB6,
+					0xDBFCA8F2A86B0BD9, 0xDBC23699EB9F394D, 0xA09EF9285599796E, 0x6C77E47B79783DE9, 0x253595E4BA4D1B53, 0xC8FB099D0A509CA0, 0xBE715091B3DB6543, 0xEF3D60746082A108,
+					0x4CF3A712207D0323, 0x834D89A9DA19DC75, 0x9CBEE224CAA10CF3, 0x73C590C6B79A2B80, 0xC847A977010631DD, 0x503167D4082D3E15, 0x477B0B1ED2177489, 0x383F2D7EC06BD66C,
+					0x6420A821B54BC450, 0x112C6D85017B15B7, 0x04FD2B4CB5B8F601, 0x760A91FC237D2463, 0x55EA208CD240DF17, 0x90870DC63DD74B73, 0x71C558A154DF1824, 0x9680A00172E2F1C4,
+					0x6226E9E308079D5B, 0xFEBE0642B8D9423C, 0x53AD8A3A20E7C7B0, 0x9F0E8370E32ADD14, 0x8669B0A0BD30AF2D, 0xFDE93FEC74DB277A, 0x8FE38912A6F5CA15, 0x48781399FFD19F56,
+					0x9E60D2B7ECD224A7, 0x2A28D083756F0413, 0xC7CD248DDA681E90, 0xEDB4BC1103EE960E, 0x766232FC1D1DDB90, 0x7E2C4C371BEC5B24, 0x17B8C959F228F71E, 0xE4427BF7E61BAA58,
+					0x7EE7778337D850A9, 0xFB0850688491E3F9, 0x4560E47E5F7D39D9, 0xC4F603D003C642DC, 0xEB4C2B57C8E80045, 0xAFF7820FB2E3E6DC, 0x9C07B0135DAABEBE, 0x43E4828F6535086A,
+					0x73003CB5CB1525EF, 0x93D070814D518985, 0xC663B8015B6160F0, 0xC8C3844F0F168B31, 0xBEBCE64344FE3012, 0xB92215DD446775C6, 0x9EAB103B2DAF363F, 0x7BCF2C2B9CC6EF66,
+					0x6970D92AD4573AB8, 0xB5E0900DB93329DB, 0x737C98C77A551C1F, 0x5125F361D057F9AC, 0x71B428B74289ABC3, 0x092E8A68EEB24D83, 0xE1717DEE8AD14D74, 0xFA8BB78FEFCF71BD,
+					0x97FC323155926A99, 0xF28BA1416FB4BBE0, 0xB25B8A8DF6D2C5F7, 0xE027FB8F52FC5F5E, 0xC1666C287C3D2FBE, 0x6A73A37BFD79A329, 0x3330FB4BBCB11484, 0x5CB17A140870B493,
+					0xEB3002768025775E, 0x53B15EB4A14A8FF3, 0x237DAB9A63766B9E, 0x166BA90E36728FF6, 0x9E7C6A9A7654F4C5, 0xFF8FB0B7AC14957F, 0x8A3F1D9078BA9ADB, 0xCB57DA8ACBEAEA0D,
+					0xC76AE9D816DE3E41, 0xCD0C32555E059B90, 0xDB1171ECD524CCFC, 0x551FBDEA81DC3C9C, 0x065EA267E3123AEB, 0xB09400FEF728845B, 0x304F48F46428FC06, 0x2C76630A5C5F671E,
+					0x2F768DAE5A467118, 0xD844F3986C6ACD37, 0x812562425B2349B1, 0x22D70C141BDF9355, 0xCF8F4BCA2FFAC46D, 0x3362CF539239E333, 0x22285295491A2C2D, 0xE01E6D88D8594A87,
+					0x9AA08383B491E716, 0x54FCE618FBC40F4C, 0x9017C285E9EDAEE6, 0x2828D3A30A2668C8, 0x05ED28221E716D71, 0x19DF8BCAA54696C7, 0x01A44FB9D2750EC3, 0x80B2BD623DEAE620,
+					0xE4A2BE2D0BFA3F94, 0xE042C8BFF133B220, 0x8E80CEDB3AFDA8BD, 0xE2FA3F08EDBB58D3, 0x6A0B81890ED144FE, 0x9006AC43E5FB3B20, 0xE45C71CE957C2646, 0x571517235E9F25C0,
+					0x2A7E28C65CB7CA73, 0xC67F529569690CF2, 0x77B633A1DCFCC47E, 0x9EAFC9A44ACA4AAA, 0x620BD0790E93EF45, 0x563F651758C6C447, 0x9703C9577D7DC3F4, 0x08E9120D55B1A518,
+					0x45AF0DC9822B83BB, 0xF14D86434D98A56B, 0x5120EE3B33851BFF, 0x14034ED70BA49B5A, 0x8A6D238D806BF352, 0x45B60C22EA46B58D, 0x1660D8FCA2AD666D, 0x36EA27A591EDA076,
+					0x7291DC316D5CA8CB, 0x79DDA32FF3DB9E46, 0xF4172E3F0EF5B0A8, 0x418797F74CF84D53, 0x9641DDFEFA587DE4, 0xA4715C6ABB8EAD5A, 0xD7E24CCB6DA28FF9, 0xA11E3AC2B8703A5F,
+					0x41865720F0CC2BB7, 0x8949331F47AAD737, 0xADE366B9DFFBC6D1, 0x77658F591C04C5DE, 0x0FC3A63BBADB36B7, 0xEA968E200A65857A, 0x81925E3C1FD88C13, 0xFB8D2CB3678CE59C,
+					0xC76E04E69CC10222, 0x34CC55B8865534D9, 0xBC9D0D443A4831B6, 0xBCDCF8434AE713F8, 0x496A96D7FEF21967, 0x46DCC5E513ED5230, 0xB5D9F07F1E0A1412, 0x07812F67E81F6BC9,
+					0x139306A148FB3D6A, 0x4D1CC3C262798055, 0x904F41C67F96563F, 0xA798244038D99D6C, 0x0F00F4E681803A30, 0x5E4D519C33BFB190, 0x6DA1F61D5052688A, 0x1213680812261DE0,
+					0x12F4B60DEAA7B42C, 0xE0F7B20C694DDB64, 0x4AFB1844705C92BA, 0x94B1E730763998B7, 0x377E48E4A1F37F6E, 0x3835D76F4101EA08, 0x758C5AC312A6D52A, 0xC3B89A6C5A488399,
+					0x0F81784070BD1759, 0x91D213CC1A2D1538, 0x5D73CEFAD3098B55, 0xAEE0C40F1D72B9FA, 0x4CEC7C36D4ACCB1F, 0x0499B5C0F6133747, 0x5A13048303211575, 0x5BDA2E72F3178323,
+					0x79BA27A4BB196459, 0xD2B51C7A0B92CCA6, 0xCA23A8A44514F50C, 0xE85CCB04FA2A9CA5, 0xE3BCD834C6A78B96, 0x54862C54AEEEAC8D, 0x22FFEF93D16D177C, 0x7C871D0AFCAE4EA2,
+					0x3421037ECF3376A1, 0x706A33DD71CB86CB, 0x50543977055D0E98, 0xB0134E9B495F1C21, 0x86D0608C23DEC6D8, 0xFC2FCB2E9E4D0807, 0x1E634CF6D602418F, 0xAA64FECC823A532A,
+					0xB62159E7F157FCCC, 0x041ABF362D6E1254, 0xE12AD36350746D21, 0x587E6A50373C559E, 0xD34258F9FC44C89B, 0x1E5F10B7CEE5D8BB, 0x5587805AB9D9B9C3, 0x99B41BDF18275965,
+					0xD9B147B1823AC721, 0x39D15BD74B2EB4BA, 0x95969280226A5F9F, 0x9E10DDADA5E2E3FB, 0x9FFE3DFEDE84FE5E, 0xEA644235C320086F, 0xA3E43DACA37F6AE3, 0x1BF78009596717C2,
+					0xDE436C46D23859B4, 0x8973D6DCCD50B6F6, 0x91019736B26C0A5A, 0xF9B285E12E87A960, 0x9F2679B5A9FD04A1, 0xEB6ABF0337D980B3, 0xD04A699654055EB5, 0xBF6EE0853A7F7553,
+					0x731A1EAD4621CA78, 0x155FE82A25EB2FDF, 0x6D2F2F01FB372B43, 0x7FAA870D3706FB54, 0x85A1D58369B152DE, 0xD09C45C24A66BD77, 0xE2D2559633BD3872, 0x83A49A86D6362EF5,
+					0xEE1239104FCFE083, 0x640BDC4E53FEF05E, 0x0405F0699CD6F5F9, 0xF0AAC41773F0FCA3, 0x38FBF958F2C0A879, 0x2F360644F2DC94F8, 0x03C415AF62770C12, 0x6E25C54B07EA15D6,
+					0x4CBE04E0C727D883, 0x827B931EC772A2BB, 0x2DF915DC898A5932, 0xC5275FBA60019346, 0xE2A24ED337600976, 0xCFBDCF18B2841E1C, 0xD91FDF127A25F4DA, 0xC1C1860B3E66C53C,
+					0xAA3DBAC068CFD175, 0xD5208DBE2CCB66DB, 0xFC1E08C53C7C15C9, 0xAE1BF1C6C5FC2328, 0x4791E48A6BD3EC59, 0x4E4B304AA1F2A438, 0x456818E02764300B, 0xF44E75985B91D0BA,
+					0x1720EB51A1331C43, 0xA06529EC2DB1F027, 0xD31D62DA7D4EDC6B, 0xE8CF9BD7DE85F6AF, 0x7045695FC6F871BD, 0x23AD697BAB6FF236, 0x5F116942E78DDB46, 0xD9AA9C90A272EE71,
+					0x41CC1E7EC3679219, 0x2C7C24124AD6B7E6, 0x35AA0424A3BA4C6D, 0x64C8F075D62023A9, 0x2EE6DD051F70BF9C, 0xD95D652877116697, 0xD539175C73CBD6A8, 0xA9806BBDF401DE2B,
+					0x84D5BCED7184EB65, 0x30FA68FEFF44F81E, 0xC7CB1739C8409671, 0x9A70786D1AFF4DB1, 0x6420A1E750E0E211, 0x198679E7510B1BB8, 0xF280A230FF1A5841, 0x67FF0C0B290E7A45,
+					0x3693EC67A1463112, 0xE977A59C1ECD559F, 0x5A84C6D43FF248B4, 0xDF628F357E2289D8, 0xBDB98223522AE68F, 0x9D963A84A54D3B63, 0x6D4C2ADAB41ADA10, 0xFA3EC6294B7F59C2,
+					0xCFA322932D39FE7F, 0x2892DB4C99E7484F, 0x41DCA6BDCD59B1CF, 0xB0BA967C83DD5BD0, 0xD04C1C35A8763E83, 0x60EAC43C7C863C07, 0x6313D07A8F0EDBB9, 0x72FBD710058B8A6A,
+					0x33F76FC7509A0E6A, 0xE66FCCA877E2DB70, 0x6930CBE9278102D7, 0x492A8898FD168B76, 0x8699C558A61C660F, 0x236FE0FA274BC173, 0xADFC5EC8CDDE0F0A, 0xEF4008DF1EBF1AAE,
+					0x6BF801FB2A879405, 0x98C11D7A6A78B20C, 0xBFE0865670E94E70, 0x5DFF53C3D5E85ECA, 0xCFBC90586C930F80, 0xA04E3C342D243C08, 0x187AC7977D57BC8D, 0x43F967A1AF56C1D7,
+					0x03321EF59F1C8E30, 0xD61D9A4DBCA82E26, 0xAF3B53432CA11A75, 0xF3B0306CAFB3A127, 0x54EF7B362A343291, 0x5C4A1B022EA28A9C, 0x7D15CC0F98707356, 0x7EE3669DE3F8C6A2,
+					0x738F267975784A8E, 0xE9CB73A1231EA5EE, 0x6F938F1FADEC99DA, 0xE489685EF95415EC, 0x5E816720D9B23D70, 0x602432E672C54060, 0xFDB3CE944790E6AB, 0x6B938FBD24FA8379,
+					0xB22551337642349B, 0x91369FBD2DF8E1C0, 0x7F19676798E5E63B, 0x9F301F65F0E4F849, 0x2EFDAB5D8C568887, 0x9A18C79B39AA46EB, 0xB9E47CE211D368BB, 0x267C84E42738668D,
+					0x430340358C4098D0, 0xA71539DE99DFD575, 0x80864DA48494B227, 0x6A21BC07A62D4400, 0x2065AE84295CB96B, 0xFE9D173BD380B0D0, 0x170387BEC6F70DC7, 0x42AD96D2B650F517,
+					0x27A562D02A54EE28, 0x76BB152A23CD62F4, 0x1A97D4E2105B50FF, 0x265E739661691DC5, 0x49BB0E50F001DD09, 0x063B8A86F00F9AFD, 0x95629509D8A65D65, 0x436DFBEA7E5C03D8,
+					0x62B017A7AE76377B, 0x4C304120A752046F, 0x9066F0290ACF5445, 0xB968332C7B48E11E, 0xBB1318BB812BDC11, 0x491BAEA872160F3D, 0xF37E45B17EF38ACA, 0x065F9DD94794D27D,
+					0x83F0AA888725536C, 0xF049AB6E31CFDCA1, 0x16B136A49F6EFBC6, 0x2DA3AE8226C805F5, 0xFD83F4C9B2373A81, 0x9F0D326FEA3D3B3B, 0x5C266C7AE640CE05, 0x02617F986103FBAB,
+					0x131AE9DB2576B065, 0x9D23BC6F949B01C3, 0x4F40300D20CAB666, 0xF767647F32CA03B9, 0x93B27DEF1B0C6987, 0x6B9B313C823C2C57, 0x385C07D72E0AE9A2, 0x4DAFE62D8202C36A,
+					0x189DACB9B46B7A96, 0x5155232CE6B26639, 0xD64A455C51159CC5, 0x6FD149322B83D782, 0x3524263352738221, 0x6E7F32756C769A60, 0x95E8411F5FB7E0EF, 0xC7B0B17CD2B25E6D,
+					0xE83E498E2DF39F0D, 0x38F97B026B11142C, 0xB5049BE60B7CF8B0, 0x72E3D51F6C8A002B, 0xE8FBEB9A54BFC446, 0x9559DC478CF4515E, 0x4463CCE0DCEEEE6B, 0x01861B0390B0D0AE,
+					0xEE44DC28EA769B4E, 0x79C7BD15F7CEAAC9, 0x3DCE2E720E2FB73D, 0xEFA8E08229A45B9C, 0x1F3FF67C630431E1, 0xA28AC6BA3107334A, 0x86AC8F7F39124E3D, 0xF8E54B3CF56AB830,
+					0x871AF65B70C87330, 0x67E48724AD69F10A, 0xF826CF2E1E941780, 0x0B046189EFFB88B0, 0x112CCEE87B052F61, 0xEB199DED2CC0D1A4, 0xE828B54C61142B70, 0x3EF1A1427CBF38EA,
+					0x5143D329CDF4C337, 0x592FC1D9E724839F, 0x62CEABB919F6D153, 0x9E63965234B2BAD9, 0xEBEFEB639D262D9C, 0x7DECCEED0B3A453E, 0x110D3951C56FDBB6, 0xCC38A66EA17A6C8E,
+					0x99251C182AA46843, 0xF7D7BF5D6ACCE173, 0x55746B41D6CABA15, 0x2E6AF4870F904737, 0x69010FA255706277, 0x2176886DCB5742D9, 0x70A29D70AD30EF64, 0x1B550EDEDE83B344,
+					0xA47268BFE9B1C5B6, 0x710DBB61DDDDC049, 0xE30039AD929F88C4, 0xDFC7F90E1D252FCC, 0x41E3179348417444, 0xF31A2C97F89E0185, 0x8DA9C9A9C2391BA3, 0x0A2960E59AD66E37,
+					0xA8018D38A722C49F, 0x31BF5ADA5D73807E, 0xBAAC15C4BD729D88, 0x244580F5A0EC46A1, 0xB10055E4F8A38B4B, 0x58B4C787CC299147, 0xDAC370A156200769, 0x339BF3D6846CAE65,
+					0xF2DCC9B770303FA4, 0x1D716FEF83EBA047, 0xEE1EBA6BA13CF8DD, 0x5CC9E03D3CD16E4D, 0x2615B8125A11A1E5, 0xBB2138C695686615, 0x7986CB1829CF190C, 0x57369EACAE7E0D9D,
+					0x423E7152601CD55D, 0xB5ECDA7ADC572F7D, 0x01E32EE465EAC960, 0x45AABEFFBBAFB899, 0x8D2475094C20613B, 0x00B0B9DA8D807DA7, 0x788647E5AC94443B, 0x54DCA446BE8D503C,
+					0x858AB27E75FDEC59, 0xE38554C82ECD9ED7, 0x9062BC097942090D, 0x704076199CFA1DE9, 0x147218F9B174520E, 0xED68DABA0313C581, 0x8EEBC7204C7C944A, 0xA793FC8B29E1D099,
+					0xC08AEBED6FF2BD76, 0xA20077B841702B83, 0x36E82AD83A96860B, 0x0F79174C98C039BE, 0x5ADB1775EEA72EA2, 0x9DFAC85FA851367E, 0x9FA8D411E1E33BD9, 0xFE55F2678C7D6BCD,
+					0x88D789DDFBF9433C, 0xF501CBE39E362115, 0xBC30B2B9C0FC4326, 0x871076F095C17F44, 0x73E639AE74ECA64F, 0x7A1B9E9DBD7D2F9E, 0x7155B8915E55EA31, 0x7E1FD76CD0F2700A,
+					0x601BAE2B8DF3CE82, 0x4A06CEAD798D7B7B, 0x9C12A243C073F44E, 0x2A3EEA084AB01134, 0xEB066602C47D55F1, 0x5C80F9F998EA8818, 0x81DDBAA92888BFAB, 0xB7A90571FD1F80E2,
+					0x1A6AAD50942FDF93, 0xDEE54A7398BADB7C, 0x13FC577C9F21EC2D, 0xA966FE9F2F2F9AA3, 0x4D4CF21B1F53AB20, 0x10248D049E911F7A, 0x5E80C800B209F81E, 0x70D9D905D6A2A548,
+					0xDB1F0E8363D59C42, 0x2CC1BF73C9802184, 0xE79299E98A21BF32, 0x76F57E20587FC4AA, 0x583F92B10FB2103A, 0xEC00FFCF7FD421A0, 0x9E39961DB49507C4, 0x10EBACBE093F2729,
+					0x546D5D774EFBA02E, 0xC0A0ACB4D16EB476, 0xAC304E2420957DF8, 0xB47902B2DFC450EF, 0xE96F1596EF22608B, 0xD56905C544A21EA8, 0x01C120157B274848, 0xE26FBD415C72AF79,
+					0x18AF482662EED738, 0xB3FA23BE7F514D93, 0xECD23AB929BA1D4C, 0xA852E9276BBBAD7A, 0x9A08F842B6183F7F, 0x4B5F6E918DA483ED, 0xC6D177DF0EEEA9F4, 0x7A9D2A5525993BD8,
+					0xCB18F855F8C729DE, 0xCB60F4BB1249DCD1, 0x19DC66A32B5FE0AB, 0x4AAF86E3D53058C2, 0xFFF045AA36B26EFE, 0xBEDC707B71F91ADF, 0x20C629CDED84DEB5, 0xCED3EC5ADE7F167B,
+					0x152D694661982790, 0xA2E38C3AF8829763, 0xAE04DBE91BFC1A45, 0x463764C3FD24786D, 0xFCACAF4AB8F5E850, 0xDEE52B42038225BA, 0x66067987F731BFEB, 0xC90AC4EB994EF9AA,
+					0xCBEAC12BCA72EE03, 0xB81599FD270B3BD4, 0x73991B1A469EF4BF, 0xA699EF61756603DF, 0xC4A56D9F21DBA31C, 0x40011225A651176B, 0x6F300D79A471B437, 0xEF9E3645AB1667E3,
+					0x76D594B7A7127139, 0x5C9EF17541520F42, 0xC393167900DCC152, 0x71634592BD02E83E, 0x06B3A0443C81EAD6, 0xF7760BB17EFAAAFB, 0xD11E441C65146050, 0xD95736E89AC56F0A,
+					0x7EFAD6FA05CD2028, 0x708089BD0C740B8E, 0x8EBAC28BAC8DD560, 0x3ED78067D1963C91, 0x2748A735120743CE, 0x3372736CD797D8A6, 0xE943BD445E78AAFC, 0x3E48CBB606A002FF,
+					0xE7C1FFC1A8672A56, 0xD052527AE54E7C37, 0x64F520B696DC3827, 0xC19869D4A5D39A51, 0xEE1D3711E4C5D9EB, 0x301736C326F70821, 0x6D2089C2468768A0, 0x685FBF92133D24EC,
+					0xE95F262E68CEA4A9, 0x1F12113872FA0388, 0x3AEF485522780763, 0x882EFF3C6ED4E1E4, 0xC2D744C1D78BFAC8, 0xC70DF227717CFEC8, 0xB53CE8A101C0A4E4, 0xDB6BD3BE0C633609,
+					0xEDF3FD08714D7AD8, 0x268B3DB4B48ACA13, 0x68CB09686B85052F, 0xE269336CCD41699B, 0xD9C6133003890BF0, 0x6C577AD6ECFCAAC4, 0x6D780F3782978190, 0xB8D54097C3888143,
+					0x38B916F583C97B10, 0x0BBA82FF416F90F5, 0x5650A6329860E950, 0x36EEC71961047BD6, 0x199D3D6E4811EDA8, 0xE5DFEC1ADCA8DA06, 0xB9E962CF2E998090, 0xE562DAC692C32621,
+					0x71F92652D34E6C4E, 0xB34949BEA58DC56F, 0xBE1909AF68B65835, 0x77B53C6E131AE04C, 0x255378B513A8DD64, 0x5F3662D8A97B1FD3, 0x83B1302CA98FE469, 0xA5998A9DFBF61E90,
+					0xDB13B8329A7F31CF, 0xC6BD31152E945C98, 0x4FDBE182500EA2E1, 0xD9887F4968C0C32A, 0xAD63B545F1CF9FE0, 0x236325A182C9D1A7, 0xDDDF30341736C81B, 0xC3B2288D17E599A3,
+					0xE7EAF0077A78F777, 0x38A9D9921FBCD93C, 0x1BEB51CEC589C090, 0x8799F6C8AFCDCEC4, 0x68536C8186273811, 0x0EE7B30D834372E1, 0x113CD82D34B9D2FE, 0x90B7B89E446B0814,
+					0x89D4933C945B47F7, 0x2FB17225E755678D, 0xC8D3B32E42130C1B, 0x317A93DD33DD17FE, 0xB0C681D15D4127AD, 0xD49497EF1880735A, 0xE32939A84EF11244, 0xDD18D5FDBC15E9F8,
+					0xA5EB77CF847A4CCC, 0xC7AB7864EF6762C2, 0x3BDECB2F7B1DFE14, 0xEE38F38E7A0964BA, 0x2C40D39D0F8233C3, 0x7D773A28B4813A04, 0x20B44C7055047A88, 0x3B68D683E2931B11,
+					0x0D9F9E5F9ACD0DF5, 0xBC8A90E3E76E2F00, 0xB3D2CCA0888BE46B, 0x7EAD712911E6DB25, 0x8C2BB4B4A7E6A2C2, 0xED7C241D0D509687, 0x79037A3C934BD24C, 0x38F6C7BDD6A4B192,
+					0xCA9B20A4B8355AB6, 0x572118EA21A897AC, 0x5295CCD6600DCA36, 0x88DBD71B98109AEF, 0xA9FF0CF91933B1F9, 0xCA98D180D0E0CD7A, 0x3371056DF5EAEB7D, 0x4FB0E24153683536,
+					0x4D734FAED4CBA758, 0xDC348DB661E7B232, 0x1B46A7C969F206AF, 0x6C68153734DAEA05, 0x388DD363B4257DAC, 0x5D48E9FE7F785D8C, 0x9E5EE86BFC289C7E, 0x7275589A80B70CC2,
+					0xF3D2F604D3111882, 0x4BC8E0DACD1A8BA5, 0x97071E2C4C7E89B9, 0x71A58A62027C4627, 0x4537176BD6A79626, 0xBA1DBE214C49F1C5, 0x5A5269039EB0A900, 0xBF198DA326CAD3C7,
+					0x5E3A63EC2C45F81F, 0xD3845558B669C670, 0x8E95B5587F2A5B45, 0x68F3406A923A66C5, 0xEEC2F04A6A43CB16, 0x136A113890FE5A5C, 0x7FB77FFB2F3C2E7C, 0x5D82556D6806644E,
+					0x5E0FC1BF0B300DB9, 0x6A2B076EA9A3B3B3, 0x114BBE16E5BDC6A3, 0xD498093918C46597, 0x4D5D6AAE6FD3A199, 0x4712832D422597C5, 0x6FD010F0B48BA206, 0xAF07ED072C2034D6,
+					0x4108CE83BA050E7A, 0x5D8F3E1CEE004A5F, 0xE25A4C66C9A8D40F, 0x5EE321B020C6537C, 0xCECA4084D096D201, 0xE9FF0D889E816411, 0xEA6B3C170DDC35DE, 0xE02CF7FA27AB8A91,
+					0x13C08D22369803C3, 0xCED036185F0DB9EE, 0x5F4F610C4C6760A2, 0x01CAD3FF1FB13BA6, 0x9786794DB547F9BB, 0x6C8C4C8105CEDFF5, 0xE55A3D00FFC9DF7A, 0x70E1D1B0585F86C5,
+					0x8542DB367B82BC98, 0x7D8F0A027637766E, 0xEE2A5EAE59F1A0D9, 0x17C22B1AF4308D26, 0x014D6CAC1020601D, 0x4BBF0AC5CE136A16, 0x1DAA330245E9315D, 0xD4884D6D5A1FD7EF,
+					0x2618FA2429BE58CC, 0x176CB57E1DC46AD9, 0x404AD2E3175D1D42, 0x32DC07973BE6EDFB, 0xDB740863D7DF1063, 0x58EA2B5E3DB5A436, 0x09F55BA2FBD6A871, 0x1919DED78B06D2F9,
+					0xF708FBA4DCE2162E, 0xBFD4E8517D904E3E, 0x357796C3D2337E41, 0xCEC2E35455261567, 0x53875A5D46202EAD, 0x9DB2BAD1E1D66FBB, 0x0ADA332FD8C62828, 0x1A9CF0B559802A25,
+					0x2EBB2C46FCA04D28, 0x13F5EDB116290CB4, 0xFF8238BD16F8CE62, 0x7F186F87FE133363, 0x1C92BFD261C58A52, 0xBDD1591674B246E9, 0xB1FD01DF23F5E77D, 0x56DBF3058D6C6441,
+					0x6B6B80C826F5BA11, 0x12AE592E022EB512, 0x5613DE8E0CBC4AD0, 0x8980990BB57CC302, 0x2E131B91C532BB4C, 0x360EBD9C128A1FB5, 0xBDFC569868FE2696, 0x0ACDC70D59C45BEE,
+					0x1A98CF96F3BC55B8, 0x66091D59D62C339A, 0xDA3526C53AD52FE2, 0xCCA7F5927F19FB11, 0x2D5805F77B7F62AF, 0x99BE1F99D395474E, 0x6537BB949668F856, 0x338BE8202445F46C,
+					0x19096681A3F745D0, 0x4D677887B8DB98BF, 0x25692CA568FC7D9B, 0x826AAC4F4D72802A, 0x35EE33E4557CE49F, 0xECABE5ECA237615C, 0xBA087829843A7822, 0x8CDFA0FB630939D6,
+					0x02A80BBF3120BCEB, 0x727FC3A1E9FC9E9C, 0xC839911B14692E1C, 0xAE3A53A176BDF8D4, 0x4551CD7EB94D87B1, 0x59FF27F3B025B1D0, 0x5482F7F353482DD7, 0x0E744BC79B6ED680,
+					0x8D86A7EA25284D15, 0x1F1BD459DF304847, 0x9ED628F71EE0A3D6, 0xC4A3C81A6815CFF3, 0x4141DAF218B2CE74, 0xB0E3E49B4533E25C, 0xFA3CF64A52A55CC6, 0x8ED068627D868FFB,
+					0x1D84B0E7E50D028B, 0x4AC4A410649D290C, 0xB7DFD3F050643542, 0xD2107E96ABE9233A, 0x3E378DD86BBACDC0, 0xE53921E46A2BBB1A, 0x42B04C9E570769BF, 0x844CC11AAB738495,
+					0xF2B5E14FFF43D496, 0x773416629FC4EFF3, 0x3C377AC6B31CF3CB, 0x908537FECCA7AEE7, 0x872118B702336E3B, 0x4919603AD316D16F, 0xBBBDDD367657C8B8, 0x852A4C6F79A828F5,
+					0x2B575D585AD90C85, 0x96395E652559EE3D, 0xD3A51324BCEB8CC1, 0xC8AD9F41342EF68D, 0x2839BDC87A02B725, 0xF0C5FB2F51DE4ED7, 0xD2DB62E29B496388, 0xFBF21C4DDC2089F6,
+					0xDD5772649CACD33A, 0xCF111572B6A84362, 0x7E1B3EFCA7C390E7, 0x4A94B550BAE0F860, 0x3C790515B2F86E72, 0x808ED32CD58E6EF1, 0xCA23FC888D10688D, 0xD8E7416052F5AA7B,
+					0x599C99EBFCC40F82, 0x4AA7B36DBFDB0E51, 0xF53265D08DD3D85B, 0x8EA20EAFDE5C2912, 0xEF46725BF9963358, 0x4B8E954444A91DCC, 0x8921503B8F4E02D5, 0xD3688BBB4796988B,
+					0x924B25A204A177B2, 0x326745246B3B7F52, 0xB03D4FB944200172, 0xB373EA9A8365BD24, 0x52E64E1D53560B8F, 0x48D40CFBBB59F2DA, 0x27AFA594DCB42B18, 0x5626C2FB7EA54DE4,
+					0xAD881102C24E6516, 0x05BC8B35731862E9, 0x6EB29C40AC04FEB4, 0xA43B922210C996C6, 0x7270CE001B80299E, 0xC0E2CC90F1BBB023, 0x6B4CED4355056127, 0xE1D2BE17BB39A83E,
+					0x6651397CA6E8B221, 0x42AAF91595F8E63C, 0x80F734FE1EEE0EE7, 0x96C2BA47FA2CF117, 0x0DAFF11AC47C0EA1, 0x64919B9933373682, 0xCE4F043E1F02C526, 0x6FEFE556BAA5219F,
+					0x37888671A32EC2D8, 0x935FCA9E5D9D677D, 0x7436D8149C11A717, 0xAB22B245FB03F87B, 0x4ED6A486B1F0A5F9, 0xCF4A0D07E313FE75, 0x8C3525DAD8094F89, 0x5A04B0A697EE15D2,
+					0x142D6BA004637018, 0xFFDAF87C6AE7946C, 0xEF8BE9CEAADD08C0, 0x0ACB476571CBBB48, 0xD2FB2EE1B1318758, 0xBE6160FCE5605F5E, 0xAF09B27FC18267F4, 0xD2D90CD7D7178DA5,
+					0x20BA1F72183CD664, 0x6C67BA074903BB7D, 0x1B54EDCF7B9AE9F5, 0x93FEC5E12D0402F8, 0x39424890C93D1033, 0x436CAC881A7095B3, 0x6A8AAB7735820680, 0x5CE69118768EF624,
+					0x7D409F7E1778811D, 0xE260BD6D6F39383C, 0xD2F7904C63045FBD, 0xBD7DDE18E1C952F4, 0x3E447E8CFA246C26, 0x23D0917B9E2284E6, 0xDEF9F44DFE932BB2, 0xB2BEA5B6938B6912,
+					0x8DABE0E1F8623BC9, 0x9C54CEA7547028BD, 0xD2B40986A73BA169, 0xB52A87E588F1F1F0, 0x189ED731798F1248, 0x2AFCF75FA690BE94, 0x2C1FE43A999C0F3A, 0x7972D8E26BBCE7B2,
+					0xA0D1501E3B261724, 0x9BBD04110BD12249, 0xA3971D930EA20783, 0xB531D2CBF531FF76, 0x0D2476015E631538, 0x56CC75CB150711F2, 0xEA15A27116E7D364, 0x62C465B28F52676A,
+					0x85E8334734AC81C6, 0xBAA6BF3D8A94539A, 0x8A2D506C476A8D2E, 0xC47FA685D81D8CEF, 0xD49945D396C53C65, 0x62E566F31E04DC04, 0xABE60BC98E073D61, 0xA53C69FB5BBC1972,
+					0x33F4A341B2D49227, 0x3BB03CEB4B6AA893, 0x6C5946B607E68FD9, 0x3D3AC079B3BA68AE, 0x0DCD680868996EB2, 0x5B5243DD99E697BF, 0x45D342EBE8F07A10, 0xD1915342E97E921B,
+					0x5F5534D9E262BFE5, 0xBF3A31F2A5E8C92C, 0x99EE52CCA9B4AF5B, 0x310B91536F48AEFE, 0x04BB9CBB38053997, 0x96C21240001FEBED, 0x538C999EB01CE672, 0x68E6C5B2AD5695AC,
+					0xEE78089A316E9DBC, 0x19ADABE46FBD12E7, 0x46832A8DAF5365A0, 0xC47D4E00E424CF35, 0xBDBCC44109BCB00E, 0x04D2C635B03ED900, 0x38CA00729FBF1AF7, 0xE94780CB4A145533,
+					0xFA5661BA4A6DB7C4, 0x8CC649223886325E, 0x229A97408200F441, 0xE6AAAD330E207AC6, 0xCADB4DDB301F0F05, 0x0D277C00D452C45B, 0x428F53620BB8D53D, 0xCAF07BFC0A602E3E,
+					0xC1B4B46C6096EC26, 0x7D257943C6AA1037, 0xB4C15C915B2E3813, 0x3E4703B95E7E43E5, 0xCD79F9B0B1291482, 0x602DFB692488F323, 0xF0DB46AE2553E7A6, 0xDF2013DA44AF45E0,
+					0x530EDF5FCDA8D899, 0x3E3A80E623756821, 0x30F48408D18A21C2, 0x8F07A65425D039B8, 0x42E342548958DE2C, 0xD43CD8CB88D3B876, 0xA2C046C1CE9CBDE4, 0xAE0F278AE872DEF8,
+					0x26B05296EBD1CB6E, 0x275E4C6334A47BE7, 0xFC8B20340AC22FFA, 0x68ECB890999138DF, 0xCE9BC67F95222439, 0xFA402C7B2063EC80, 0x18BF28F437F66DEC, 0x382E3AEFC848B813,
+					0x6EB3695FDEE7CE74, 0x8F387AF057C448DC, 0x220DD2F333FB1CE8, 0x5ED76471C0F6C5D2, 0x06A06845DCB540DF, 0xB60CD9657F360E2F, 0xD1357BD4E7263B63, 0xA26A74772EB6DCA9,
+					0x118313758CC772AE, 0x3A4CEB5EF15C3F09, 0x2F0557B313D040EE, 0xD904DDF914FDCF19, 0x2EE9F80F251A1C61, 0x3596A0CE3B6B3027, 0xA4BCB7FB09BCBAE3, 0x1E42F83103429F87,
+					0x5C49462CF9FB9C80, 0x6D1AB3B74F9E99FF, 0xE024B75CFB53ED9B, 0x04C1363B42A1DA88, 0xD8EB3436B823BF08, 0x7D369D18E74DDB4A, 0xB768BE9B5C963198, 0x6B8ABF659C7B4BDC,
+					0x0F2CCAACB748C45A, 0x1E1418AA95E8EC52, 0x7102FEAD8301EC3D, 0xD1400A92A50CD02A, 0x04F491272951358F, 0xA23E3E918DEC2E43, 0x6D1B9AD85A0D9FB2, 0x83BCF475DE7C6A96,
+					0x0338AB026B3773EE, 0xFC2C420076033E57, 0x9A7832F37D36D05A, 0xC6106EE19FB0058B, 0x9702909F3E9AC710, 0xD7E3BAFF9AF4F4EF, 0xA90BC5D4D11317D9, 0x9DEE7E2FFBCDF313,
+					0x2EE3F1EE5DB82AED, 0x8FA9066571A10D84, 0x18F37461EFA7BAC0, 0xD52DB8A0DA1F4B9F, 0x02BABFC22213671B, 0xD5B866C3D6E48CDC, 0x3288A92F2751465F, 0x4F21A5741C9963CB,
+					0x308F0EB23AAF893F, 0xF1502D35A2AEFA6F, 0x8DC042765D44BDAB, 0xC00E4AFE6F4381E0, 0x3D61AFCC1CCBA671, 0x1CB3D5E8EF220171, 0x9051F3B3774DAF4E, 0xAAF43FD3083C3136,
+					0x9A359E25CB44C7D9, 0xBF4F0977073B0E4E, 0x057AA9A47A8B10E4, 0xB57E27A304B68E0E, 0x059CED8020C75D24, 0x2EAFC09284776D0B, 0x147C814F06FBF8D2, 0x04EB345ADB1AB663,
+					0x75F166E19948DE57, 0xF718E752D642DEF5, 0xA89E61C37314DDD2, 0x0699E2A4FF9C2D9D, 0x4EAD81698A21E6CD, 0x4AAFF94602C17908, 0xE0B0ADE1E0873BCD, 0xB274ADA6D7781388,
+					0x82C7106C4632BB2C, 0x5E56E9FCB8370A14, 0x5432D342D52B3972, 0x8B68BC41227C9003, 0x6BB5FFCB197D9FE5, 0xDF36BF8AC9F208DA, 0x1AEC474225CF00C8, 0x6DAAD48BA62B0EDF,
+					0x39719B8179A52356, 0xBEB650BA7FF0D3E2, 0xE6E46FC929CCB7C3, 0xEC839E5F6EBEA260, 0x74D54688FB7F4408, 0xA6A190FD7AB5480E, 0x4BB48CC32C985547, 0xDB48363CCBEAC422,
+					0x7FDBB416D7A5AB58, 0xABD9B55C5C5DCFA6, 0x2D8ECE03869C6E0F, 0xBB165F8F1D0B170E, 0x984C173B0343E64E, 0xF49E237C04D849ED, 0xB27036FFE225AF69, 0xA7747E263AA49EFD,
+					0x16BD3862E526660F, 0xADCD081F897E4CCF, 0xBB969CBA04884BFB, 0x9FB9E2E8B9FC2D4C, 0xAD56127B8ECE64C8, 0x33C4B12AFD3463AE, 0x508685427F174ACF, 0xA7DE013A9A7819C8,
+					0x64E7157995B3A794, 0xE435E51A6304B7BB, 0xA32F40E483F957C3, 0xFEB8EEB2D005214C, 0x7225774010ED2505, 0x2E4420C6F9A04CAC, 0xAF3EEA70098BA2E7, 0x7640483267F36EFA,
+					0x9D3AE05D1A9FC702, 0x101503EE6B4B0FE0, 0xC3DE021CC60137B8, 0x7CAAE9694CC08FCD, 0x550A7F01E665334A, 0x456050B2C3B6E32F, 0x81E7C780D155EC58, 0xDC0ECE045A30BA48,
+					0x42E9184B07CF1450, 0x0AA74FD29897F1CA, 0xA0B78682CE02EA1C, 0x0C282E8568EC65F1, 0x4E23AC8325F143CE, 0xA2EE1D5951A06731, 0xFE08CE0DCD56B865, 0xDF1EBA90FEFAF884,
+					0xD2A2463456237E00, 0xD2639E042CBBA4E6, 0x1D8A84F08F4AC305, 0xA694219C80D6FAF4, 0xC0BBAD1F081D51A2, 0xC8A87A3EC6D83C3D, 0xD09F56EBF66E6574, 0x77F7BB03557B9C3D,
+					0x664B691F7EB6858F, 0x1A473C537663537C, 0xE96FC27EDC7E94CC, 0x57F7C27745212C72, 0x224BCA2AD8AEAA88, 0x24AF0F6B429E9A0D, 0xF8A8A1EB236FFE70, 0xF30619EF362FE71C,
+					0xACC0DA5C65F5C940, 0xEF5A315ADB700CBB, 0xED4AA86610E5D592, 0x74579465629F87CE, 0x0F8D2FCD5A3326F2, 0xDBEA8B9E29FD2F56, 0x8BBE6EA78F19D8EC, 0xC86D1FD15DB07BF7,
+					0xD350BA93C725017D, 0xC6E907898627A672, 0xBC99719B9CDCB145, 0x854D0313173EE831, 0xBD37A8829119D21A, 0xE99707F1455EA32D, 0xE3AB1C6C5B85A2B0, 0x17F9972E293388D9,
+					0xD9064B7EB1F65960, 0x85A2E099C3FF7A15, 0x3682A457473C98FE, 0xF243CAFBF8DB0F9B, 0x7DD3D952C00E1779, 0xCCDE44FCF10D23FA, 0x870483CC987F2D02, 0xA1DB939E452F10EE,
+					0x73E596F44AA3A365, 0x6772C8BB90ACC60C, 0xEDAA56B5F81D8F31, 0xCF502701840D2ABD, 0xB4A9A3B6FAC6AFE1, 0xA553D25B6ECCBF79, 0xA904788DF6E2F3D3, 0x9A31E3F98C4D6F07,
+					0x85257F75AB4AF693, 0x19E5EAFD1FFF19A6, 0xC30E806C67979AA0, 0x109BFE96247ED9EA, 0x2619C0AEE5DC562F, 0xB7F040C708E59B43, 0xA83AEC190C76B570, 0x25CFB2B6AF5C463F,
+					0xB4A62DD8DF5D4B70, 0x2441E008BBF4CF94, 0x4586529C29A53F5F, 0xEEE5829B05DE1932, 0x4BC8833DF82E8727, 0x5B586DF0D8BCC178, 0x14392ED2EAD1266B, 0xD22D6FFF45030E68,
+					0x0FC7932A81338A49, 0xCDD2A45BD86A187A, 0xB158434E7D3477BF, 0xE5DC1F9FAA616874, 0xB20D6689D1994BBC, 0xE4100D9C2700DBB8, 0x569E1DB2153F2400, 0xF449C3D246FB61A9,
+					0x282AFCC478551835, 0xD9142E45CDBAB95F, 0x95D4E9C283B7E0B0, 0x9E3440F087233EA6, 0x2E4FF4B06D86D37A, 0xB06BC6253D80CCC8, 0x9D4DCD0A0204325E, 0x4AABD4B1A2DBC35B,
+					0x00EBCCCD6B85BEFB, 0x8E960A15128F1C0A, 0xE9C6D5A01438CB84, 0x95472DBA472A5A94, 0x1171089E5256F011, 0x9B6A61FEB6815D7A, 0xC2786CE1ECA58AC1, 0x0D99E037A3F72A4A,
+					0xB9276ED8EC553AAF, 0x7663712692358B65, 0x02D822071CB44BBB, 0x57FFC0F2BE324A8D, 0x17358D612000EA19, 0x4F4EF1BCF4940694, 0x992D621FAFDD8187, 0x686306806C9A3665,
+					0xCBA4443713E5165C, 0x4BCA37963C3D0F72, 0xB8B182CBE4CAF514, 0x3B39AD0F31F4EC28, 0x768FA603C67D5182, 0xDBC9FA047F2C77B7, 0x3FB605C90A19C130, 0x0D49F04E537E96B7,
+					0x5B570473EDB9D6C5, 0x207013A861D6B783, 0xFE94460D5A3954B2, 0xE821CE20B43A4B2E, 0x824A7FA6EB4F2C70, 0x1D4BB01D3A9B6EDB, 0x42AF2BBAB79ABB03, 0x8339C78678B45306,
+					0x37231DF553D03A14, 0x8464701E43089428, 0x7E53617C254234A2, 0x1D13DE22EB23CFFE, 0xE12867EEC50A201D, 0xB4DF76AFBD6BD297, 0x4A8A4A01457E53BE, 0xE9B99FAE42D7103D,
+					0x6999CD5728A69293, 0x0919744E402F5188, 0x5A56714A92362207, 0x6A88B08289E8D94B, 0xB9D6C3C13741C04F, 0x96271B7D5E07521A, 0x1AD033D64EB47C15, 0x56E3D6EC62E6E778,
+					0x1DC560E051CC2B82, 0x72CFEFE7DC5B9513, 0x6B98BEF3C3EB9B82, 0x3021D2A5544E3E7B, 0xD267052D6B82C602, 0x5FD134C1F2CD78D2, 0x1D081F7D9855ED94, 0x51200B61EBEA79DA,
+					0x9B2F781CE4C07A5C, 0x60E20670DACCA4D2, 0x9139C7F543307D96, 0x690252D247CC7EFF, 0x1672003A6DCB4912, 0x5DBE07FE9939CFE7, 0x0F34675BF7DECECE, 0xA2BC2CD4222A13A1,
+					0x73E21ECEE43353EC, 0x05CCBBFCBF04FF21, 0x2AA8CB48C1EF3C44, 0x5923E14412FF731D, 0xAE6B2B0B12CEE8DC, 0x6745BADB61CF01A2, 0x566A230F69D456ED, 0x4D7517CB2363961A,
+					0x26A77406222292DC, 0x740CA1BF260D2C88, 0x1D3A1D7585EBA75A, 0x6AC419A965791D6F, 0xC93408F093B25071, 0xB75730CF3DA757D9, 0xC02EC81F360E603E, 0x2E67E46C06BC09A1,
+					0xA49C0D133A1DB959, 0xE85E4311BD8A9C3E, 0x733700A45A3A2FAA, 0x1CB9AF4E7BC44ED5, 0x3EA789CD5C9DDD89, 0x925DF6955D60B4C2, 0x9781C64CF2D005A5, 0x766971359195564D,
+					0xB3AE19CE64622529, 0xD225CEA35B599CB9, 0xC619D343EED0B562, 0x6A6A1FACF5023E67, 0x70C6336CA75BE04F, 0x6213B6D6729DAFD8, 0xD0F8313F22A82AFD, 0xED58F829724BC5CB,
+					0x0CA99E5B8740E753, 0x8B8BA21808D588E7, 0xAF8D15CFD548AB1B, 0xBF143BE472A199C6, 0x94BB9A79D7C94BB9, 0xB8B4C84232006172, 0xF36FDA485327623B, 0xBDE6F5A9E885E31B,
+					0xC525CD06A7D00BDD, 0xF06EAD991C6101FE, 0xBB4AC90D474D2096, 0x61951C53C1D1FFEF, 0x89B573D355201950, 0x002015EC6CEAEA09, 0x299D6C4FAA1E9A4B, 0x941E637CA08FEB3A,
+					0x77C06484D1B19DDC, 0xB8B252575C319A14, 0x9352E4D44D29E5D4, 0xD1C6698C5C95DB12, 0xE0C3A0EC695AF524, 0xAF89149012CAC2BD, 0x2A3F03FDF26945D0, 0x245869D3F5F02B2D,
+					0x2DBF9182E6037612, 0x99930BE9D3914583, 0xEA17A41CEEB731AB, 0xDD893022ACD800D4, 0x6C595024E48BA7A8, 0xCF8D43A904242DC4, 0xB854235B93197E4F, 0xB6EAE09B124C8708,
+					0x6C2F1188093945D6, 0x6C32E73D470E8FD3, 0x9C3641DA74F15821, 0xB6DDE5E1CDCEC23D, 0xF3E58D1F3EA77964, 0x2FC55EE7B32EB44C, 0xEBA027E195BDA3B0, 0x9FECFA2DE87A884D,
+					0xAD6755A230E5D6AE, 0xA5D88B56D53BE0F4, 0x3135F1426AB7BD8B, 0xAABE268424E2D80C, 0x25D6108F1C1BD771, 0xE1C70A3CC4036401, 0x1FABB4AF38EF5BC6, 0x23176DD76EE60B92,
+					0xF4702C5CF1FC042B, 0x98D74206B6AD7FC1, 0x6C3214CE52DBA406, 0x09622263D7FD319B, 0xF85FB58895404B07, 0x947DF3F39BFF90C5, 0x4EFA1633E3FC195D, 0x58FCF3358FD0FADE,
+					0xCB71264FB3BEC378, 0x2747B52C80C960A8, 0xEA816CC918A803E0, 0x2434FC12B0241883, 0xA7433039B8C04616, 0x86BCECED13D135FC, 0xB331DADB5F9D905C, 0x01ED9DC9B4CE57EC,
+					0xBA6739B799E736F9, 0xAEEC73928DD02B0A, 0x3D36700BE030A96E, 0x3EAB5FF1D418D338, 0xBFD164F39B609E46, 0x1EA589E53D5F2A73, 0xC71A95D16C76B14E, 0xB3FEC63EF24D7878,
+					0xAFD01D93569E4F45, 0x979EB7EB42F7CD90, 0xDFD26F368542ADD0, 0xE9DD656B1FBEB6DE, 0x5D986911F24AE442, 0x719E6AE32FCF0154, 0x2CD7FCDF07868098, 0x44EDE235B3F93190,
+					0xC27BC9158816451B, 0x2BA3E4AFE52D23C2, 0x71895B7C5AD467DD, 0x128D5245391265E2, 0x09C3ED5802661942, 0x4DADD2D1BD3254D3, 0x431EA6A55D5DF249, 0x7405CEB432581E68,
+					0x4B5C8629B00E704A, 0xDDFF01BB3C39926D, 0x09F41925CB0FEBDF, 0xF0A27AB3BC639D97, 0x6727B96CAF3B3531, 0x058A2F1C1576F668, 0x7AD8A3ED894AAF33, 0xA029507AFC2595A6,
+					0xFF874899811BFC31, 0xA8FE054E46395308, 0xAE17FF68F4B581C2, 0x0942EFC9D52EF335, 0x15E98B41C2ED6D4F, 0x61F3E1B75F895878, 0xD5F4DEC751E3D6B1, 0x120DAEC7028984E1,
+					0x52614440121E1D8E, 0x0A3A19BD4CD43899, 0xA5E10A38C6FAD389, 0x2DFE3ADD4FB28076, 0x5A8EF5A841B71F94, 0x00C667E6354AC9DC, 0x64CE4AB178E1DF01, 0x6839CE72A9AD36FB,
+					0x10D01D06C330DB27, 0x170945E2E668B59F, 0x7E33845B63131A8A, 0xB1619B9101FAC7E1, 0x0686D6417C4FDFE7, 0x666F264E55C89E95, 0xB66487AF0684BEC4, 0x4981CB69BD63665E,
+					0x65428EA7FD85E057, 0x0E04C745C91F51BB, 0xB0DC4BFB6EFECEB5, 0x770C197E2B3FABDD, 0xC5CDE2367FC31584, 0x6A56EEA055B1D688, 0x31BDC000AC514B87, 0xAF5B576781B0168E,
+					0xC9D0C50FDAFFD3CD, 0x82206554C4C72D54, 0x38FB06FD15769891, 0x353A3AB2A2BA00CF, 0x1596C547E891769D, 0x23BFD296D57643FA, 0xD0E3B4B9DC003CCD, 0x3B34F6EB9CF8C1D5,
+					0x5DEDEA4EA7611EBE, 0x32D77C2800B9A3FF, 0xC95B59860CF47A95, 0x95F121FDBE994592, 0x634F4F6EBDC100B7, 0x3A1EE433987E045A, 0x9DD3B3E67FB86CC2, 0xF7D63D8B1050D9FE,
+					0x83D74F4720DB5323, 0x2351BBE83209A960, 0xA76E36DBFFD6747D, 0x2FBD73355C93E5C1, 0x03F5B4627CF1372C, 0xFEAC65671C93D555, 0x779A7EC047D80FE2, 0xD905902FF43D40C1,
+					0xBAFD0C663A841118, 0x8121827630E234E4, 0x42DA32E8791FFDB8, 0x0FE494FE684596D5, 0x3B1AF585200BBFA8, 0x8810977B9699DE00, 0x48850734FB6D3EF9, 0x0307E0400BD140B8,
+					0xE335ABFB92CB22DE, 0xB97F2E607DC1F727, 0x54647F001847A60C, 0x5811248E8817C8AC, 0x8FF05D670B741601, 0x8E724BF6B23837EA, 0x2E8419CBCD6A926D, 0x350F9032101ECC04,
+					0x81A1690728CF2290, 0xEE1A129DEA935A38, 0x28F33E30D17BD382, 0xB708E48BB6A1AE3B, 0xDBE9DEFF170486E4, 0xDF26D431D10918DA, 0xD2243961C1720FCC, 0xE8F2C8802FE81122,
+					0xF801E5CDA348BF6B, 0x04891C79612A8B74, 0x908A042D065F7032, 0xB913937168578F79, 0x1B195598D234590D, 0x32C1C371C25919EF, 0xD24FF59B0F6B6943, 0x36B707CD806E1089,
+					0x68E21CEA0E07AD8A, 0x0A08353DD5967A93, 0x6C023B4774D38C0D, 0xC77FDFEF60D02F38, 0xE8AAB041B7301A6D, 0xA0208BB5BA67F099, 0x3B1BD25B72EF2A99, 0x4FEACAAF5AB6E1A3,
+					0x213309706B7B7871, 0xF2E65104D17B001D, 0xB47D83395F0E038A, 0x5A356E2F95D0ED4A, 0xB98832F4AC0E952E, 0x4610D6FF3CF826A6, 0xE13E8A30F2A2BECF, 0xCF4F7C5C8DF9FD1B,
+					0x4153F45C1D9DDF94, 0x13D3098E2DC94DEB, 0xCAE7C0202669FEFA, 0x6AC5CFFE41376CE6, 0x44BC7BD5212F8BBA, 0xCEC800975CECA155, 0xFE349347C35837AA, 0xEBBFD3F829B0D64A,
+					0x1A789DB22E3D32F6, 0xAAFC2A40C563D665, 0x101563A00C11B0F1, 0xAC9F218038FE4DA8, 0x6B0EB2769DAD7FF7, 0x7896EDB7E1534592, 0x2C93009BA57895A2, 0xD7A0E2E1DE5ADD3F,
+					0xBD8B6B8C24B3AD6D, 0x028153BBAA62192F, 0x92525DF2BA09B92A, 0x4EE91D088EFBB29C, 0x26E085B2D3C59B8B, 0xA9DBCDF2E8FF3C0D, 0xAFFCD98815A14661, 0x361847CB37E6DE56,
+					0x11C8516B0D2A8C11, 0x69CEFB5B8DA2C228, 0xACDE5807A30EF361, 0xB258CFC875A7997F, 0xD917B9A7837F93D4, 0xA334B5DD98FF826E, 0x5D8538FB89030F09, 0xC467B1500224C391,
+					0xB8D78D9F213D47A0, 0xF9BC324769F9D9BC, 0x8748F4C5490FCE49, 0x74F93626DA3318D7, 0xCD4EC7CD0EEC2B26, 0xB497838D5AF8F7D4, 0x11123763557B7D97, 0x47C01AC8AC355220,
+					0xF17EAAD1AEF8D7D5, 0x63DEB29061EA66B1, 0x83E01EC1769E57EC, 0x90C19B5D909A198B, 0xF1B8CFDB5422E3DF, 0xBD18C1AC6E7D47B3, 0x8A1C63F48605CE34, 0x64087A3C705873FE,
+					0x17001A18F755D6A1, 0xB2F5BC75F2944983, 0x9782A1A27F7DC479, 0x3A93082882CD798D, 0x9BBC0484D21941C4, 0x7E0D739E258B4914, 0x3791B84E0FB4E000, 0xC9593AED033368B1,
+					0xBFD4B2EF95596507, 0xFC62E73F05F4C20C, 0xB2A99CE6748D5C07, 0x5BEEA5B7193A5F87, 0x3796353B8091210D, 0xCFDFB0B6BF70D66E, 0x228423BC153AA764, 0xC3B0F48C81DB37CE,
+					0x3D53900658E59357, 0xAECBE812D876C041, 0x9C80A6A9A31C767C, 0x2301C6915188BDAF, 0x8977251ACE0C08F5, 0xDEFEFFBC8E3158EF, 0x012CD185428327B5, 0x62A48E78C964CC2B,
+					0x438EF31932F16095, 0xB5F6864A5FAF0FF5, 0xA04F4F319D7E89DE, 0x32CF679ADBB2C634, 0x95AB7D48E7CEB4C6, 0x74FC59BE9FEAA023, 0xAC18DB37BE03E721, 0x8BDEAE16B2E08DD0,
+					0x6461D11695C778A9, 0xC3AC6EEA7E9A7E4F, 0xA4B3DFD03BE37E2C, 0x49BDD3E4C7EB0ACE, 0xBD9B22A16D9CAE6C, 0xE07FF75F9C8A0892, 0x6DA812612A2FB6BA, 0xD2DD7ED896ECCFFC,
+					0xAA66DE4A98691661, 0x014821086EBC4385, 0xBFB9C7F04BEF616E, 0x184F5A45C937EE82, 0x1FCF4A60F2914FD1, 0x0D00CF3384486983, 0x38BA23B1F83BE365, 0x9F5FB3E9E5AAF8DE,
+					0x7CDFA54F713B175E, 0x45B07BC4FF84C43C, 0x6B034218117F3A9A, 0x5908670F768A623F, 0xFCD748824BF4A2D6, 0x8975368AB8EBECA7, 0x074C22CE51670AA5, 0xD622C44AB4D2FD48,
+					0x5AA5198CDEA3DB10, 0xB3DAA8E69F8BB5C1, 0x8BB244390CB94C19, 0x186D575DC92250C4, 0x9846F6F41281FCBC, 0xD3976C9947889222, 0x70D5FEC716CBF8D8, 0x1028A5BAFF7163A3,
+					0xD185FEBE01664DFA, 0x4C43F2C00EBED5C0, 0x3836CE9BC6C09E2A, 0xA1A56396B575E275, 0x88A5D427DF5935FD, 0x4B6829AEC1E65034, 0x54323FD63145F7CC, 0x963824CC96E4E923,
+					0xC4DDB66DF9176581, 0x5F33BB26FB55D35A, 0x048033484C839285, 0xF84BF78BED5BE7EF, 0x4DEB353C386A52D5, 0x3CC65A031EC8A7F8, 0xC91B67182F0A9ACA, 0xE0152B8C3AA882F5,
+					0x396A0C412ED7E307, 0xF1C97D89BA599B31, 0x18A7B8D953B54427, 0x05E565475BD41819, 0xC80FCC7AD96D1C6A, 0xE5EEE69840AC99B6, 0xB5A1D7DA23E1D8B9, 0x8603E00861FDDE0C,
+					0xC7CFCCB2AA872DDC, 0x5A52DE13595B4F49, 0x64D9B0D377582A0D, 0x69668A55B13FFC7C, 0x62E2BF8E913979ED, 0x18F42FA7AAD23DA8, 0x12B4788B557F3F2D, 0x9420FE30CB5BCDF0,
+					0x6564B83892D9B516, 0x03DF7D5BABC3AAF6, 0x194ADADE9FCCAAB4, 0x6CA43A2669A4198E, 0x4904F893E51440ED, 0x74A6FDC220513B8A, 0x3A402A46C7B7FFFD, 0x55FD8E200519FD81,
+					0xEB88DF9FB3EF9E1D, 0xD7F335BC8D5FA0DC, 0xF70C8BD25130B6C3, 0x67B9989BA60EE0E7, 0x467B015BE11C9078, 0xA9AEC99525051AB0, 0x982FB9592B6097CA, 0x367076B5312676D5,
+					0xF653E4D2ECE6A502, 0x024C8115BDFD76E5, 0x2233F09BE0759151, 0x3E7C6546DD46DF62, 0x1C25615518B01FD6, 0x425D11426BBF4323, 0x7611AAA4051FB370, 0xAEB87B2EC21E78E6,
+					0x8D01AF71E5E73F56, 0x2B02C9C689B38C8B, 0xB469A9BA045F1BBB, 0x033FFFBC462F4F2E, 0xB63682B34B18380F, 0x1E08EBA4592DCFA7, 0xEDE1FB6E73955012, 0xA9B0ED82346D6115,
+					0x456D7407A99BCD1A, 0x83E19F02671582F9, 0x3FC150F811A3E442, 0x2A163CC4A1D62575, 0xBA6FACD67122547D, 0x7E97B46C683F6362, 0x7FCF6DFB91E5A7DB, 0xA82384213D919A05,
+					0x6509A5136975E3E1, 0xBCB8554A71BF66E9, 0xF1ACCCF77969208E, 0x0B0A0DBC16B34256, 0x445CC57D563506AC, 0x9B2A367179BD4070, 0x4076586020D645EF, 0xBF967ED186D3823C,
+					0x5A7395B21A6E640B, 0x2C3AAA9B4CA1D4F4, 0x06163F8D12A38A66, 0xBE0793582218CDB1, 0xC50DFD211CE1A6E8, 0x2A35F0153F1C8035, 0xE311962DDC1BCE2C, 0xE89E5F4451A4580E,
+					0xE1B1C60DA35DE2F3, 0x19D6CF6C4D7766E9, 0xC66228DD62766708, 0x8C2BE0C0E066E03C, 0xFB78B6EDF21DDD4E, 0x8C667B7765DB9101, 0xC6DD131AB4208B45, 0x18A9119D49B2B170,
+					0xA1F3F1668723BA9A, 0x4046FEFAA9F3B46C, 0x77A4110D0FA1795E, 0x5611E21CA6C65564, 0xECD41ACD0F73F352, 0x87C7015B0F3CB34C, 0xC029AB2246F4EC73, 0x88D36F4349755BB1,
+					0x0CFE2C428CA9FC37, 0xE31CA3518834F3A8, 0xA08083270132871F, 0x8B04D5141D1797A9, 0xD784B49AFDF3F87F, 0xC2FBC6E7841D2E0E, 0xE2CAA2D63C8B0654, 0xFD2FBBAEE1D9EE95,
+					0x56EB011100ABB5B0, 0x9E6256C908AA754E, 0x466B955483BC9304, 0x5C348C4EBA877ACA, 0x72F736D91EDC852F, 0xFA867650A687E594, 0x6694C3C9CFB86C78, 0xF55DCA566EE1B2B3,
+					0x256A881766E92033, 0x5A5FE7D50C9F98D2, 0x5953408B854D2820, 0x32E04363A17159B6, 0xACB06D8EBF535BBA, 0xBFA4F0F2FE4A7947, 0x66EE4820DEFC9436, 0xA08F8F12D9DA881E,
+					0x7D273A156DFF5B91, 0xB3BB10A22E137215, 0xA4C4851946D96408, 0x4824B2F7C5D7C418, 0xBEE0744C7BAE9F4E, 0x27C9BF7278B9C521, 0x57F0DD5D57AE7C77, 0xD1B4161BB60CA87F,
+					0x96E33DDA6591EA9A, 0x39D449242E923376, 0xC3B7C8F15669BE6D, 0x386419913A8567C5, 0x88A2207696C0E762, 0xE8037B6C55D718CC, 0x5A7A09DDE2566F27, 0x761623BEE3F4DF09,
+					0x5A5297CAE6DDD2AA, 0x81B926D7A6A8ADBE, 0x13B32FF2172F1BCC, 0xB92F0D2880FF9CDC, 0x78A8638E3EB7183E, 0x99D987B0DA91B675, 0x27899D5E72CF2DF8, 0x6C3BAB8F5E8BFC78,
+					0x83CC3C9377FE8AB2, 0xA556EF60C846E1ED, 0xE9677D54CB86A191, 0xF8CAA9D333D165FB, 0x5C16BA9AF7B363B4, 0xF76ED79204D58DC2, 0x6B0434778FB7835A, 0xEC490299B88FB917,
+					0x4F58540D688F1CBD, 0xE8A92CEBAF5C5077, 0xF98ECA976EE334DD, 0x9D44748DA27CE886, 0xF86CE32F6F15AD78, 0x5900689AB71AA58D, 0x9BF334DA53BFCBD0, 0x990F41DB401D3269,
+					0xA2F56C7BBE559DEE, 0x8EFBA9CFE79AC340, 0x18C7BB970956435B, 0xF027607D6BE83192, 0x9F7789178C8AF648, 0x2FA69DA14CB465FC, 0x151A7810550ECFCC, 0x24AA59BBE92D1187,
+					0xC5EF351C7D61FAB2, 0x18EE5B81DC18F5BB, 0xAC2332634F252C5C, 0xD65523BA46652AFC, 0x9121550740E8D49C, 0xB6C1A434E3137763, 0xA361561698096366, 0xFEC739F891AE03FD,
+					0x95E16FDB7BDC95DA, 0xB808C683D12866A3, 0x1EB8A4A716F87188, 0x9F8C1BD45EC22E2D, 0xFB028A0E60857C90, 0xC2C74D9908AD1517, 0x5936DE4C2E3B423B, 0x445822C5DA3DAB74,
+					0x5296F0CC59869083, 0xB244566011ACC72D, 0x14D09301DB3DF631, 0xB7FBFE0F5024E99E, 0xA9AF14084F0A1BE5, 0xF56F0B1A851661BE, 0xAEB7F487B552E5DD, 0xE57C4F7AD72F9F25,
+					0x10CB53BF5779FAD8, 0x41B8E45D8654C858, 0x76BCBB488A15191A, 0xB8283050F56FA1E4, 0x43E8D5876DD2E8C8, 0x0C38DFA090D833D4, 0x36BD428195DFB066, 0x87727B459363BCA4,
+					0x1032E18D98A5E967, 0x4D4D074E34AC808F, 0xFD5E63A0390F51DD, 0x2CDB8DD98D2EDD9E, 0x7B6FD9D622E187ED, 0x6505AA17CE13DD17, 0xE9804E7C7B45EFDE, 0x98BB2F3100683AC7,
+					0xE97311F02E41F3C7, 0x632A04C7D9DD07C3, 0x44370055A41BE290, 0x8ADA879A3B36E75A, 0x2A148C2A52122450, 0xAF3D5A5E51798DC5, 0xEC75F3F17D5A33BA, 0x34E6CAD2D998C19A,
+					0x2E20924F2DAB72EA, 0xCC83C5F6A90D5289, 0x72FF1311AFB442FA, 0x57ED7887A0FCF6E1, 0x0404024ED1F6B173, 0x518C8D3746D050AA, 0x1193A7B59EAF3A18, 0x15EF6AC9FE7AFE1C,
+					0xEDB1F4FA7883768F, 0x1ACE03796BBC8EFF, 0xD7BE4B174ACA6A64, 0x2B63CE7AA8131E7D, 0x6AFF1F5D506F69B5, 0xDF2D2E684C6D2376, 0x8ADA012EFAD77908, 0x101694C6C149885C,
+					0xE69F5CC53E1083DB, 0xB9A2F8E44BAFE9F5, 0xE29CC74F31ECC8A6, 0x695ADF70B297FCF1, 0x873BE17827A14962, 0x588C13D9E89059B3, 0x90BC1F85FCED3F3C, 0x34E93E8C4211E4A8,
+					0xF721017BE9835DF1, 0x178FD2195F9D6F37, 0xEAE32EB3ACF00574, 0x912A95049A17724A, 0xEB2EB1F5A94910B2, 0xD56AACB61163BC06, 0x198E38A2A847E2DF, 0x8666FD66FD0D3684,
+					0xBEF6EA83A86D58C6, 0x30F0C0D154BCF4F3, 0x2A50A3A2648D5B11, 0x6D892FA32A080E9C, 0x8678284C1F23CB0E, 0x272C493AE9AABD15, 0x4D6E3AF7B498A5FF, 0x2DECDBA404EE452B,
+					0x1A57271C89631A4A, 0x4DF2B472CAE03FC3, 0x9CF47897AA618861, 0x34A4DF266BD3CC23, 0x43CC8C4F8387240D, 0x28F1DB071DD03CB5, 0x77BDCC2C96FD8501, 0x16383B26CC40DC79,
+					0x17F5411F80763619, 0xC017F87CE82BCC19, 0xA9696F9C4C1357BA, 0x9B7D9F88BF75078B, 0x1AF867DD8A924B4B, 0x49EA68309A612C1D, 0xABB92662015579E6, 0x4B8AEA1BE5D154D2,
+					0x35DF9CE8993A8896, 0xAEFACBFE96E75B82, 0xFC3BA8471EC104EF, 0x801F52A9FA2C1EDA, 0x5C9300B876251BF7, 0xEA75DD094061FFCB, 0xAE1039BA9774717C, 0x97EF593161EE1EC9,
+					0xAE45DB2E90F824A0, 0xC38316E4D21893E4, 0x3F5F094438892FBD, 0x95E1576582C1524C, 0x2793F570F793C6C2, 0x79E3994EC2C867A2, 0x5F4333F001D3E4A4, 0x6E3F7DCD8D08E74F,
+					0xA90A77CE1461F886, 0xDA34BAF06D580FD0, 0xB87E24878BBE6A1D, 0x5593AAFC7CACCD05, 0x74D2EE74F970E946, 0xD0D119313C7D5E08, 0x95EC0B8C56363DAD, 0xC0D40166D707FEE8,
+					0xBCCA7ED6DE707616, 0xB4AD118A9F9CE20E, 0x7CCB1FBF897823C5, 0x927A947822D90A73, 0x775371DBBC01AC7A, 0xAC72A55346184E5E, 0x806045F69555CBD6, 0xE4F59E41F03E47A1,
+					0x90CA3702B9F280C7, 0xF0EAF108F2102FA0, 0xF4E1331401E7BFE2, 0xA90886EB4229DFA5, 0xD60CFD79F984FF97, 0x72DB599C340DA6BF, 0x2757B89A91D3DFD7, 0x2A11BE8A706596ED,
+					0xEE6D0A324C5357BA, 0xE56E8B5DB19B7AFA, 0xE9FB74B72B0E0882, 0x8BCA489875393F2D, 0xF561B6E4DBC879C8, 0x8F2C8D4D49A59BE0, 0xF5D8CF05A529E34D, 0x6F08B5DF9389E92B,
+					0x35F7ADB12104D292, 0x80F2D33646A4A719, 0x451C6C06A3B1BA0E, 0xBAC710D140B0A30A, 0xA4AF55FE29983463, 0x98FA78E72D12E04F, 0xA21F668AC98C0338, 0x878EFFC0D6572503,
+					0xB22A2BA8E58D858D, 0x5AA082D78D8838A6, 0x7DDDDDAC866EA7EC, 0xE938D9DBEE98202F, 0x38649D955B2AED19, 0x980EABB3937E5114, 0x898E187E7FFED0F8, 0xEE5F107BD19FC0D6,
+					0x4B7408FBCC93B6C6, 0x40DC488C0BC6095D, 0xC5E7A3A41A3C0F39, 0x8C93A07E2888F6F3, 0x4B57676F04D512EF, 0x6A7E6BB20C0A993F, 0xEA8FBACC85AEECB4, 0xDCFEFCE927791EE4,
+					0x1CFA4977262855F1, 0xA84B52D6E52FF3AC, 0xF83407C3F22873F6, 0x17796F209FE7F53E, 0xE2E3A98803309BD4, 0x803A2EB9FEDC94C4, 0x856ED3D2BD84ED73, 0xEDAC21A56BF27490,
+					0x54AE83AE1B247782, 0xEB5D62EFE1FE4AD8, 0x3D6F52510308C354, 0x91394902B5500300, 0x5871DFC3A2F90F00, 0xFD441F6814E35953, 0xDBED4B444C63F8DA, 0x27E0A7981E394464,
+					0x3E027191370B164F, 0x0DB97DFA4DA8F602, 0x865F89ED3D902C73, 0x3330D9FDA9CBF250, 0x4BD9B61E91C0781D, 0xF781EE93878C8A84, 0xA0E6B984D392AB0F, 0x3250B399999347B2,
+					0xE1C018AC40D7B33E, 0x729D77057D75821F, 0xEC8351A17697E553, 0x892EFCD000DA4753, 0xA24CA162D13189E3, 0xF80F5A6F3EBF0128, 0xFD7E048652550779, 0x2D74BCEA006CBDB7,
+					0xA6017F27F1F31017, 0x169CFB034546A2BC, 0x7F7C7BF1862CEA28, 0x25156C5EB96800F7, 0xD882C2DF74A2CDA2, 0x63EE5FB8863ADED7, 0xAC99EAE94678CB5F, 0xE596666CACA85C79,
+					0xB96A6415535BEF68, 0xD50F9FC99F6A019A, 0x89FC42FD7D695D0F, 0xA165C84C97881DC7, 0xA473AF63FF87BCF6, 0xF68B100A606955D3, 0x74ADDD5149B02DC3, 0xF1DAF3C5ADB90A1B,
+					0xC600DC0510124CA3, 0x47263859F8E5F19A, 0xB406469D2D171DAC, 0x31F797A5ECDC696A, 0xD771BE98B8240B3D, 0x14CF9F57CA883D93, 0xF88AB60C4F5661AA, 0x5C38A6712129195E,
+					0x023BC4809A8659C8, 0xD718E406891C13B0, 0xACBE37C71E9B381D, 0x544376C7A4C06FCF, 0x3C4802160BE28A7F, 0x63F8BEB894EBF7E0, 0xD3B8D2D03DF5B038, 0x2057CB49EB1E64CB,
+					0xB7E9102CF4309F2C, 0xA7F62AEAC312B0A0, 0x8586D7F0A0E645EF, 0xDFB6314776ED20FB, 0xF1F0E35BB9E7CE65, 0x144F85F6C3B17FB3, 0x6A0AC5084D3E976B, 0xC4DBFA5D287060E2,
+					0x3B4F229501117312, 0x8669CE28274A8BE7, 0x39007B727B6D786D, 0xDE67EF08BC7931A9, 0x2E69E88EC67BD233, 0x2E927DA42855D7CE, 0x7E0AD5B5F0EC7BB8, 0x64397E5D2612D0C6,
+					0xD8C0AA07B87CC25B, 0x8C2CCC164323075A, 0x3D35B0011E867752, 0x91B862529F2C3361, 0xBBE97027798F8A95, 0x492864A174C6B30B, 0xA3F2D10BFE6C6A5E, 0x1D690B6978C691D5,
+					0xE3F63EA631455ADB, 0x43C1BDF141C531F0, 0x808773430A3A4372, 0x9D42BB94256E4781, 0xC653A2A1B910F139, 0x393AFBA5875834E0, 0xC74C8047F76BF93B, 0x4FE6C22EF58BDDA2,
+					0x588C84208E0075C5, 0xD7E016B2461F6F66, 0xF6CCD5A863D7D2BC, 0x57198C45E380AE57, 0x807E7BEA00045229, 0x67A5947BF6CBB0FF, 0x131AA4934967B008, 0xEE7296FBD117C42D,
+					0x3444F1CE0001F059, 0xEB2E2E0473118032, 0x1782299211AEEAE3, 0xA6083059A2AC2E76, 0x175090E786F58770, 0xBFDEC292381061B2, 0xC999F4F784C97C23, 0xAA9AD897FC5B5823,
+					0x8F92ABE9F4C9877C, 0x49BA6A8AFA62091A, 0x118EEB918239B46D, 0x5DAAD6EAAAD04362, 0xB45CE74A5375EFE9, 0xD90CCC9F07990F04, 0xE2A6C821B8B9A1BB, 0x9FDA0E3A09364090,
+					0x0BAC98538836911E, 0x8E1D4127CCC5F761, 0x59337CD777F60012, 0xD5E486B0F0C73AB8, 0x412F9F0CA11C57EA, 0xD7304D4755D59903, 0xC4B8688C3CEAFE35, 0x54F39A5AFEBC0C9B,
+					0x0BCB952AB60E0999, 0xDE4D1C4162D817EC, 0x002B6954198FD31F, 0x8160A5B52CE25877, 0x4E074ADA105FBAE8, 0xF4D278B7471B8518, 0x7E2BC7D7470F366B, 0xCB4BA675CF52D467,
+					0x99BB5DBC8E9A292A, 0x855BFA6D156F70AA, 0x6A21F7EEC2951FB8, 0x262B04628466F995, 0x2E29E916D236C80F, 0x51C8B11DE22AE362, 0xEB31C64402E6C17D, 0x3DEB9AB9486940B1,
+					0x8FE42DD9393AA5EC, 0x321B2A5B27570C3C, 0xA5ADCA0FDFF219AA, 0xB548CDF10DD9B64A, 0x3593153866F588B4, 0xC9A31189B501131B, 0x0B2B38518FCE89F3, 0x5CC702265A758235,
+					0x8947B78053CDFEC3, 0xE5521BA2922F3697, 0xED13BF6812EA2121, 0xE87812E0D709295D, 0xB2001A95A373A50C, 0x736FFFA1FFE03DE5, 0xE548822B74BFAF7B, 0x1BE33E493E623FD2,
+					0xB608AD79BD92624B, 0x4CAB1999353CF345, 0xA118E330CB123340, 0xEC180530FA978085, 0x82168EE3AE8AF1C0, 0x8E8173ACDCAE5B7F, 0x58375449DFA72DBF, 0x2AF2CCD0EB6F3A89,
+					0xB06E1E6B40F22636, 0x1143C138C216BBB5, 0x076C4A10BF5AE884, 0x76AA87519EBB6B5A, 0x20754FFA83FE5D63, 0xA72EFC0CF0C96398, 0xE83B1AF92DA7291C, 0xC5339637771DBDDB,
+					0xDAE4D2759FF3E427, 0x6EC3B3FDD0EF9117, 0xA4675D11B15EDB54, 0x5A7CA642DABF78A3, 0xC209877F72540592, 0x42AB972D8954D955, 0xC783285E68BEC083, 0xF4C73CF5DC97494A,
+					0x6BECC1D660B7023F, 0xB08572D45356DEFF, 0xF4EBBDFCCBF3D777, 0x1CE033F43B37CB9C, 0x761FFD19AA1C788B, 0x5D90F2FC9ADA694F, 0x9BB1C2BD74F11427, 0x61C6A624F23A8C3D,
+					0x57120F0A4B54E2DB, 0x3B4A14BE4276DB5D, 0x41C9CA6756AFFBC0, 0x7215EA44323792B9, 0x327B88C999168DB0, 0x12EA1C1FA49E3C17, 0x04829B9BB657412B, 0xA1D165F6A58F9346,
+					0x18F6B06E6386444D, 0x3B8ED0081A1BDEE7, 0x47988D53FB8034B1, 0x531626E93013A927, 0xA03F4B53540F2D0C, 0xAE964248D76E6658, 0x84432F49AE7BD57E, 0x403B370FC9E023AA,
+					0xB503B08D10389939, 0x4C76A4DAE9A3609A, 0x3032615E61172A03, 0x494E4215ABD9DA95, 0x2587734B2849DCDF, 0x56F16B96DDE74D77, 0xAD34E23DFD34B8F0, 0x131A1C1C828F89C9,
+					0x0E2F3CD7D9D9BCA3, 0x933D79A33A3FC471, 0xE92A192D9FE3DD7D, 0x51D8261666F92A74, 0x3FCA12F960FE2E78, 0xADEBE2050D9F61EE, 0x9D41A983A53070ED, 0xBA5F1EA6782B3371,
+					0x5EB7A6537319F37E, 0x6C81EA94BA9C0B86, 0x387EA4B9E0314B64, 0xDDF01938A01FE0A6, 0x68EB7846B41A407D, 0x169BA5B770E91888, 0x22E0C97ACF4EC419, 0xE75B436E8304BBD2,
+					0xB4FC6275FE0F00FD, 0x45B29466D7AFDA2F, 0x22EA843F48BCFC3E, 0x52DA749672E99F9F, 0x6FE064AA51CBC9BD, 0x54F25087E14E7A09, 0x4D0F5F70C2DE6AF1, 0x35795A1A4FBC3391,
+					0xA6EBC8E1529B28F3, 0x9426A5307DCED75E, 0x4A0C72A4E824569A, 0x6EC0785D1A9405F5, 0x457F67B33F0B4CB5, 0x95AA02813E1FCA5A, 0x74954D44A6EB5479, 0xED9B8A8B69C58E87,
+					0xEC47294D57EBFF2C, 0x5F6C19F9FDA046E8, 0xD68BE7C4653586BC, 0x2125F08487D26A2D, 0xC148812C0070D898, 0x0C31F1AFA821EF62, 0x335354165887CB9B, 0x92F1259BCC539602,
+					0x7066E623D3566B0C, 0x7E0A43BDC1B44566, 0x19E5EC27330EAEAD, 0x46FD3EB50C2D28BD, 0xD33BC84AF933E671, 0x923E786F998E137A, 0x119A041553AA9F11, 0xF774D60FC6E72077,
+					0x14E2D5CEA57898CF, 0xABE0C196E4B1B15B, 0x130DD5623003E674, 0x3BD461BC9B6B0625, 0x07B9210D163C5840, 0xC2E23441044B42EC, 0x508B3A2C4C539BF5, 0x9C80EBCED1F6B48F,
+					0xCD33BDDCD6091909, 0xA0823CAAF2F3682A, 0x9CE04A3A114CB1A9, 0xAA0D132FB1BF090A, 0xCD8410FAD7C8EF29, 0x1207658BEF01B665, 0x119F2596B2A8D5A2, 0x146C0FED5E2B1910,
+					0xAE8A3D3E21B4CDCB, 0x3D9BEAC965F19193, 0x72CB1B04784FA718, 0xAD6B356D2AC90BC2, 0x0CC5CBC985809966, 0xDE71B244AFABFDBC, 0xFD3A2E460B5DCC91, 0xC3EBC99DED6B203C,
+					0xB7FDB8FE55D25164, 0xEB9FF3F050383597, 0xFCFD31DAD82A1575, 0x36A85FD3A0A25C8F, 0x493E883AA80908D4, 0xAA5304A1CB83B4A8, 0xF91EC73A3EC09BF1, 0xEFA970D6A2673654,
+					0xCD8E71A69807D0BF, 0xDFEBF337B988012A, 0x02DAE8DF434D0014, 0xC28B7DB98B8D27D8, 0x5F79A4BAA8DF2076, 0x7F87598EB47F9623, 0x642E674645D7BF99, 0xC7EA67425DE52E40,
+					0xBDC5E2CAECDBB532, 0x1BFBD92DCA1CCBA7, 0x8F644F7681AD15A7, 0x90B65FBA4F71C4CE, 0xB71971CB398795B4, 0xB2746CD6A3352CBA, 0x192D687378E49AA9, 0x64A1372CCF53D922,
+					0x4970A613CE3CF0BF, 0x2867F769E1D251D0, 0x7CF10BB55BE5C911, 0xDB0443B2494FEEC6, 0x18CF9011DBAA2E5C, 0xF329E2D4244449B0, 0xB7895B8F800A15EE, 0x6F6DEE82C7A1539D,
+					0x6925DB9CAF5F8EA2, 0xDF36CEECC41BB9AD, 0x99252EB1D7155DCE, 0x0FA0BB92F7A6F35F, 0x737DF89958128E12, 0x53F766777CA767E3, 0x220829B66B2324A4, 0x2BC0BBAA55686E4F,
+					0xA0757624F7DE4863, 0x681FBC1A87B8084A, 0x2BFAA2028A381B53, 0xA408F740914E2B34, 0x0D29126E26C47B6A, 0xA76BCCDAB942E8EC, 0xFDE51D9CCCFD96BA, 0x49715DDB802907A2,
+					0x00A73131882A2218, 0xDF3FFA1BEC5DFD46, 0x95710ABDC65E56DA, 0x4AF15F89341AC934, 0x22929CC5EA411CC5, 0xF22865E023EA992B, 0xCFBA255D47E86A66, 0x147A9867AC5454EB,
+					0x2E652F2896506E1D, 0x16EE07DBA0D7C2AA, 0xC26D0462CF3C248B, 0xDB1584088C92B22E, 0x9181291FC25C89B1, 0x4A7532DF4E25F09C, 0xE28E3BADBB8C9220, 0xF7EEC4F4C8C9C0BD,
+					0xFE95E8E61213F66B, 0xD0E09E26E8045F64, 0x47885F62752AD8E0, 0xAF07A10A611D2116, 0x44287C70E211ABB9, 0x4EEF7C228BD0316E, 0x5267002BD732F089, 0x0754E318A92AA465,
+					0xD8DB5218FE511863, 0xDEA428CD053836D3, 0x48B4043607B04FFE, 0xEB9CEF3A458BCAF8, 0xFE7AAF99B02AAEA2, 0xFDA32C4D24837201, 0xA54834C5624EBFCE, 0xC1E763C05963B128,
+					0xB22B001526859B6C, 0x5804F6023ADB6126, 0x8448D8AB25C3ED82, 0x2206EE699155EB9D, 0x2CCF517D63FB3AF4, 0xC9CFFA610F2A747E, 0xB14BE7E4C0F6FBC4, 0x69DA189DBD510F58,
+					0xF31CD304219349E9, 0x0F155106BE488239, 0x67FA2D8290AE7B68, 0x2DE7510BD05F6EA8, 0xCFA438EF3DA55B27, 0xC7031CECB4AD8614, 0x2F866A6112C2A75C, 0xD87C6F34FD782E40,
+					0x47C1BAD8765B5DF1, 0x00AD5E3079EE5D3F, 0x8BDC6E69F364127B, 0xEB811A395F94E2A5, 0xA438B598A9D95D2C, 0x334D5F6E1C1F82FB, 0x0211E3CB4D2C7941, 0xEA1A209C0880ED8C,
+					0x9C72A9093CDBB335, 0xB1ED7FC9AFE03DD6, 0xA26D60AF1361699B, 0x0715017AD9A6BFD1, 0x2C5BA55E8BF4A92A, 0x5E56E4120B8F533D, 0x110099969167FAD8, 0x86DFFD1A524FB106,
+					0xA315CFE45B533F53, 0x2E227903C64AB85A, 0x496D140EE33519BC, 0xAA41CB17A351E1AD, 0xBF03971789328D13, 0x54CA203FC6BD8CCF, 0x8DF52A09F625A04A, 0xF8E167333673492C,
+					0xE661C9003891D995, 0xA008C1A1211E6E46, 0xC68F27AC8523BBD7, 0xF4D5A37FCB65931E, 0xF7FFEC7EB1EE704E, 0x5DDF610E1C849C64, 0x1408B7D31D218A5F, 0x8C06E6E4023AD5A7,
+					0x4C89C3CF526B7550, 0x198E371710DDDD8E, 0xF23A98400B4C1E69, 0x9D98732EDA129E6F, 0xD3B1E0FB472DEDE5, 0x7E6AFA8BFCCF2054, 0x895C44FFA673A970, 0x9003752940A89063,
+					0xC1B40CB1BE564721, 0x6D24523C09F21981, 0xDD70625862B3B4FF, 0x7B09C768F0C7BFC5, 0x449F8165752AB566, 0x4786E9E4B7671336, 0x12CA2354D7929FA1, 0xE2C22F2C85035AA1,
+					0xFA7C56BB0B58069F, 0x564F91EBD75E588C, 0xCA8B2F46F3117B53, 0x8714D13222FA2544, 0xADBB9CE4DD2E9B67, 0x94E6A5837F7BEB07, 0x887CC8FD21C4C559, 0xF21E18CCCC881F7F,
+					0x143F85628F4A2A75, 0xEE33D8DC65362B02, 0x1F71DBD67CBD442E, 0x306BE6EBC6927AFE, 0x2FFB78EF3F54145D, 0xF5B263B8C58DCE04, 0xD01EDB621FE21A86, 0x54C252C4BF4FC3B1,
+					0x6DCFDEE87740375D, 0xB9DB7616C5CD72A0, 0xA9D4C97BD90332B1, 0xA9E80416F113D5CA, 0xD07E2AE5CB0DC038, 0x9022C836C1AB9EC3, 0xBC8F4F584D215255, 0xBEE239A6E7A72285,
+					0x0EDA078AA3D7762C, 0x70EACBA5452B1E71, 0x669BB26CF5F84C8C, 0xA2A1CD02E3A4BDB9, 0xB0E0F260AADEE265, 0xDCA8EDEB5B667B22, 0x1EB372170C237C46, 0xE2A96957FBF1ED11,
+					0xE19A821381A8A9D6, 0x76A4CD2FEC01EE6A, 0x1BCB560A6D89E708, 0xC85555FCB76D86D6, 0xF503735E889858F8, 0x50D82CB421B63EFC, 0x3AD3C3BC8462790D, 0xFF303908B800724F,
+					0x03516FC1AA4F93B5, 0xBC01CD5CB8579E0A, 0x83F6CC9D4E9236B2, 0xD0BBC1F85060F800, 0xCABF498A5EFD492F, 0x3D4B773B0337455A, 0x5A118E7CED364749, 0xF371BFEA3712BDB6,
+					0xDEB48963569B5FD5, 0x3FE56B64BA8401B8, 0xC1996EF93683517D, 0x7720EB50A82B56B1, 0x5ACF2ADE9B4B1F75, 0x9505A9E5DA38A7B2, 0x76561C73357E9E4B, 0xF770C757232ED333,
+					0xD29913C12D024B57, 0x4C39E86CFA7C0F37, 0xD87230FF885CE924, 0x0074A180A77B1BB7, 0x9C09A54F5B2B209E, 0xD10A57E138D85A6F, 0xFA1A5767ABC5FA2F, 0xE7C5FACBE152E0C4,
+					0x3C8E99959B3928C1, 0x8BD12A5C463165DD, 0x7C5D90EFFE26E801, 0x8CA2CD106A6F3E08, 0xE35AE4432CDD6011, 0x372C693ED9F619F0, 0xFB0D3CC3E73B5294, 0x7A1D7F75A8CB2FEB,
+					0xB69CA0026B40CBE8, 0xDFDB9B2554058BE2, 0x98AD8E16F8A9CE33, 0x89CB533E99E441CB, 0xAB6E1A9F47590AD5, 0x5985EB91A79D4452, 0x474D584151F7FBF6, 0xF398AD1F2B0426B0,
+					0xF5A5EEB3D128750F, 0xFE7C0765667CD9EA, 0xD9BAB54A0AC571D7, 0x25B8A0DAD522EE47, 0xFFE9BC4556F3FD50, 0x0F4ED7C6B1A3DC18, 0x21FF8905BE34F2B2, 0x5ED7744CBAEF78BF,
+					0x67832537485B57D6, 0x30A3EBA8D9B758C7, 0x7F92EA8D40879BB7, 0xD476B5C02754D505, 0xBDF62EA961C2918D, 0xC6BB77B55798AB62, 0x7328101B721E66E9, 0xE1C894B2096697AF,
+					0xAE98CCC56989F313, 0x79D3AACC8DE328CE, 0x753E3CBEEF8694A2, 0xF67A0DABEAB66CC0, 0x3B07A530011D033F, 0x606B496DF6ED5011, 0xEA3728C4CCC28C4E, 0xC8A55C5CE1D9C472,
+					0x555032D4E98397AA, 0xE068C41C345A1BDF, 0xC59B33077C266B68, 0x48319FC71DD5A405, 0x50B3EB1A3F4AD079, 0x03F16C12F4A6442E, 0x512E4966624541BB, 0xF721A4B6A2FE0CDC,
+					0x49BEEF1734116C76, 0x4623F8D39DBE6A71, 0xFD7A1134AACA2AA2, 0xE0FD12E67F6EE3F0, 0x10F32DF3EB2A007D, 0xDB788F1E6A6EF822, 0x0540579B4A7A1FC8, 0xC51F19202901317C,
+					0x91B449B5F8E605E5, 0xFDE164AD901BC443, 0x9763B78BCA27ABD8, 0xA5F2A8F83AFE5D2E, 0x4E52B7BBFB0BC045, 0x8AC14CB645B9DFC5, 0x8E13F33D0BD51624, 0x75A990B5DD59C318,
+					0x1392661E12E0C807, 0xCB751920AF7875B4, 0x262C2C945B6CEF0E, 0xF25C8EA119A10EB1, 0xE4C4032770B9CA0B, 0xB3C9D914D3531AAF, 0x1C91BA954FDFBA95, 0x7E5A031BEAEB3433,
+					0xF7FECDFC3C3CE550, 0xE30E10A2E7695231, 0x010ECE45C2D6865E, 0x9ADF71C3731D4230, 0xA440EA825744953E, 0x94543FDCF5A30D9E, 0x6157558CF567FCA2, 0x8453C564C23C8348,
+					0xA9B41032AB6277B6, 0x219DD15D4D56D54F, 0x68314687A2F4615F, 0xE2A99CAD626ED374, 0xCC902DCB910FA7B9, 0x97B684243342AB58, 0xB284D1866B928B7D, 0xA560708374EC086C,
+					0xD827DA7687AAE4D9, 0xA8A93FC6B3FC913F, 0x43B84673634D0013, 0x22C4729C5C5BB1C2, 0x819152040D867800, 0x9D727CA53FE6DA29, 0x57B46BF220A83061, 0xF500F9EDECAFC04B,
+					0x51D71E15C789C4B7, 0xCFD51DDBBA8BB43F, 0x304A3C439C07BE25, 0xAEC23B3D52EB70AC, 0x88675880BA110511, 0x30EF10A39143C1F3, 0x3EFA57DC070CCC22, 0x219EB3E66FBE937B,
+					0x524E72572A903FFD, 0xB85E62F334A937D5, 0x0E270D4D6AED5E51, 0x4FCD339E4607B7CF, 0xFAD625D9CFD78ABF, 0xAB386CD33B09085A, 0x15BC3FD535803582, 0x9ACF5DB0FFC6003E,
+					0x8309792E2CA88DF2, 0xAC9895749820A330, 0x52A14B8641B9243E, 0x7B0C12B6ECA28AFD, 0x08FBA22EE9B613DE, 0xC15BE4958F7193AF, 0xD6169FC0D0F6C1CB, 0xD97FE9B3587FECD7,
+					0x2A733FDC22FFC61C, 0x61737DCA9C2CFE6E, 0xB2C884848615D77F, 0x749A1B0EB8749759, 0x458E32731177B9A8, 0x1F1A8B4B31BFB2C8, 0x1B112BB8FD3C8999, 0x7A7299DFAC41CD46,
+					0xAB706B96784E7E98, 0x242E328E71B02E07, 0x8F0B74FD3E7DF23D, 0xBB3D5C91ED2F73C6, 0xCD3D2410CFE1A59D, 0x0286E5632EF8DDD0, 0xF4F80660C19C8320, 0x550D2CB42D73EB0F,
+					0x8AB37301FBD38ACE, 0xFC1C449B8BF50865, 0x2D69FB123F9CEFA4, 0x4E03EB790B6E9BD1, 0x31834FE238477B4E, 0x9E3F710DE478FFAB, 0x8AC9377B857E8A6E, 0x01218E55A935BFE2,
+					0x0E6FA9A2440656FC, 0x213ADA5F0D7A7789, 0xD8B5DBF4D9256C34, 0xCE356CC4BF0EC218, 0x2CFAA7B5A81600FC, 0x8DD9ED08A8B33534, 0xD8F8A3735DB882D2, 0x417F66B407B862ED,
+					0x93680CD068F34C92, 0xB2EBF01256F3CEC2, 0x5AFADDE00653A12B, 0x110529EA908B6049, 0xA1414379A2A0A848, 0xBBEAA4388CBBF529, 0x2CF08BC21D21050A, 0x8614D598A84A10D6,
+					0xFE1DAAD29DA81BBB, 0x134C1663E44C55F9, 0x07F3797E89B2F230, 0xDE85D5A6EF2C9A70, 0x381957721E0EE27B, 0x26698044E191D57F, 0x208F9C143E943E17, 0x5767E5ED536BE517,
+					0x8BA54654ED05B216, 0xF46DC1F2A44E4723, 0xBC7D2DC6146EE22D, 0x80BC3E8A941555DE, 0xAE3DF651B6073EAF, 0x43AD0430C821389E, 0xE9159143EABEAD57, 0x5104A0420D631D1C,
+					0x5A5B7F21E00C4956, 0x7DFBF01243CB8C29, 0x17560A9B0867305B, 0x607E44FE2FF8F4D4, 0x110EF7D969FE5665, 0x5C8132E3928318C7, 0x8776E3DF9136C243, 0x9B4B41B431983511,
+					0x46CF9BF945AAAB7D, 0x495578BB2DB4966C, 0xD7668D237F14A978, 0x44CB69A68A9BE2FD, 0xDE551679D4058485, 0x58243A20D14A1F54, 0xC29E04675EFDED1E, 0x66085139AA678F6F,
+					0x0959BBDF52290245, 0x0B61415DBC05AB46, 0xCF0EE3B9881896E6, 0x1756AF881310EFAF, 0x746D20C24A6180ED, 0x40B3A976DFE4ED4C, 0xE8635923CBD83235, 0xCC4BBC6C696B4261,
+					0x868D3FCD3BD63394, 0x43497501B2BFE64E, 0xD882264AF5CD5297, 0xC6796E214E5BD7CE, 0xA873095B14E92681, 0x4579BCF6C1E270B4, 0xA5112CBE19C2740C, 0x4AF4F5EBB0484A71,
+					0xDD9AE5DE70247F30, 0x0758422FC0E519E5, 0x99D7762C1CBEBFDB, 0xBA68371A0F8C7E6B, 0xC4E986B623175F5D, 0xAA382A3AB7C7167F, 0x3D94F94887C6A3FE, 0x95B46A9AB85748E9,
+					0x57F0C734FF8F06AC, 0xB0554581EAA46AC5, 0x828BE69EB13461D7, 0x4DFA4A67CB33A31E, 0x4056B38FD12C735F, 0x349D659C529587AB, 0x9B0A71EA074A8F23, 0x9EC7155B706AD319,
+					0x0B0E643625F2FB54, 0x691F9C5C21985366, 0x24E2F929BEEB58C9, 0x1746F17C5522122B, 0x317C16D8878EB0EC, 0x9ADB87F2A1561E8C, 0x578102895C919A0D, 0xAD20AB1F90A0338E,
+					0x95C34D23A0491BB6, 0xD561442E050103F1, 0xB24C4C6616086555, 0x51E5D7B87A1A8B04, 0x6DC4D1BD6E0DD4C6, 0x61EB8FE1DC2400FF, 0x378A987A3C90A7CA, 0xDCED1B1DB82E42BC,
+					0xBA3C76900C920152, 0xEC3819142510BF53, 0x6876CFFBC0819221, 0xD7ACFC8D27FE5FAE, 0x308A25A02E0B21A5, 0x98AF198013C61FB2, 0xE647E08C7122C005, 0xE9D6C0C908861F31,
+					0xF25815CDCC961E17, 0xDD6343C5DE693E74, 0x4879DD9768FDB684, 0x13966763591413DA, 0x224F3266B30023CA, 0x0A08C04EA9656087, 0x724B6D04E703E6A2, 0x63C59AB71363830B,
+					0x5E66F92EBE892BB5, 0xBAC1479218546E09, 0xD4E13F9DBD4FA853, 0xB6B51ECDAC50F2B6, 0xAF95F0E961F8E19B, 0x32011805D1931C92, 0x2F9D0F6FFDAC24BB, 0x7ED6A81D93FAD4B6,
+					0x0EAB9E26199F163E, 0xEE8AEC46D38179F9, 0x3D8A3BAEF614322F, 0x08940B94B25F829A, 0x8A9ED8503DE9024B, 0xE25B3DAF47E16504, 0xBD9794EE950C063A, 0x4320FDC7C34D937F,
+					0x29F594B2000EF1FE, 0x92535646D28E700B, 0x6D8AD42EDB2DD505, 0xC3F54F91E881B049, 0x04DBA46D449174B9, 0x10286B5253271471, 0xAB28DE118F90A4E1, 0x5C20D66EB8C20667,
+					0xF9F056FF0168CC16, 0xFD21679AAB184896, 0x875C73F0AF511AFD, 0x2D50416137FC7634, 0x0356B3F81B74C1BC, 0x4932754280AB9B6F, 0xF78327A8F8193F5B, 0xA0AB8130C436FD20,
+					0x1B545429FC932F2A, 0x89E1238BACB0E2C8, 0xE1849AA3DA5FFB08, 0x32CC2DCB4243A80F, 0x60DF88DD7E96DB12, 0x7EE016808A90E340, 0xA2778F1DA7128AEA, 0x9534452FC343E0AC,
+					0x4474EEF9F189CA25, 0x39AF7704D32CB753, 0xC7096658F8201C92, 0x5AE4B0349FE8991A, 0x52C9A8A447ADBCFC, 0x1DCF131BEBC17E96, 0x790BC152E4F2F23B, 0x4A55D7663D8A4B13,
+					0x5632CC1B0662CB36, 0x9C4CA0824875D67E, 0x5E65BEF78B2D370D, 0xFB9C82A0714C630E, 0x5857939F0A7F298C, 0x2357C7AC38610C0B, 0x12BEC2D20DD350C8, 0x25893A33F775BECE,
+					0x4C072C1064B4C9E9, 0xD7D2FA1F2BC1F146, 0x2EEFAE48BE9BAEBE, 0x3C0F27BA7CB8A862, 0xED841A404CB928A7, 0x7FEE96BC2BA92F26, 0x31BFFD47890E3783, 0x0F9D171B82596757,
+					0x207B6A9B9A04A84C, 0x6277EA9E7C371C5F, 0xB326AE823EA87BB9, 0x0E8D3A5122219BAE, 0xFEDF0B83167D5995, 0xC9712E841D99E8A6, 0xE0B23F542B1F4983, 0x02EF24919C484649,
+					0x343D33363E40C176, 0xB256105FE63219F0, 0x867FC420F6B7157C, 0xEAD7D0E398726EF4, 0x1D25F6B2DBA0C6E4, 0xDFB70B49D22A0A92, 0x0A99B91F413831EE, 0x6F6A0F0B11675E48,
+					0x3434478BCC1C1EA1, 0x119E0B97ED4206BD, 0xA770A89D50463AFF, 0xA32597A3C9DDDC15, 0x37B84C204B746F2D, 0xC4F7ACF653B9BD0D, 0x0B8C84CA65949243, 0x62DE2C821DD88C0B,
+					0xF6FA062C37C9A0CA, 0x983215BD449113D1, 0xDD3D2A89BCC0883D, 0x72C2CB1AAAA230AD, 0x1F230A63E3FC4C17, 0x647C4151666B5C84, 0x1823B8483BCF8EDC, 0x09876918F1E9612D,
+					0x3F1C66EEC579D9A3, 0x22D8DE06F78BBC20, 0x17A99FBFF2B97A74, 0x78C4DBB3B8915F0B, 0xF9C14F2F1619546F, 0xBA8852429BEDC679, 0xA27735A8EB9297CC, 0xD5879BCEB2745A99,
+					0xCA0FF0FCF938F93A, 0xB9FF3EEBFF3E5E4D, 0xB6BA7FB0726919AE, 0x166FA8F076865DB8, 0x336CCAA548B096C4, 0xBCA3ACE3CE49A01E, 0x6EDC9B29F6F768CF, 0x766BA66BC80FFE4E,
+					0x5455D5BB2DAC8134, 0x8B7DCE4112A297F5, 0x5CD05C538DDF47F0, 0x0A10EC263378F88E, 0x625825572A96BAFF, 0x49027C823E2B1F85, 0xA741D39857CC2167, 0x9112791B62E2441D,
+					0x7403DB448CD6FED2, 0xE7837961C2D82D16, 0x618AAA99FF428785, 0x59BCC356FE5E5289, 0x5C77DE16103453A0, 0x8695576FCFEB5E7C, 0x63BA9E23A53D4E58, 0x01EA7C928FD1C744,
+					0xE3BDFAF026C1FA79, 0x37775C6D430991E8, 0xF9C3A0C809FEE2F7, 0x144463D809F32F92, 0xFE5A565A3878CB21, 0xA7BB58A8B1E80DD7, 0x029B20633D02FCD9, 0xC49493141F3D770D,
+					0xA21A8DDFB5432AE5, 0xC4C4B117EEBA9197, 0x7417BC3D3FEAF8A6, 0xC586A74E290FC13D, 0x4629E9C393156A84, 0x9CA13C0AF7BA6081, 0x9AB52E5CACAFB095, 0x324212231F727D53,
+					0xD87CC6EC539BF97A, 0xD77511B7A923C213, 0x4E377A89028E4B12, 0xACB28DE87185ED22, 0x04329D49CC2B3CA8, 0x0C656C4E5F3E00DE, 0x7428129703D43440, 0xBE78CDFA9328171F,
+					0x3BE0293A2C2CE25B, 0x4733D0B683426DBE, 0x0076F7CDA49642FA, 0x468149174A56B1D8, 0x5BAA880C784D2E06, 0x32CCF9CA3D5CE0EA, 0x02B9F0ABAD39C951, 0xBBE7EE2F4355FB1E,
+					0x73A965DCB1657B56, 0xFA659EA98A09A70F, 0x8C8C4B95496756F9, 0xDF6D444DBFDD7BFB, 0x19753ACF2E4F1B8A, 0xF127FDB9370A2FDC, 0xC4058FFBC87E85B0, 0x88DF08C0D365E4AD,
+					0xBD50C2FF2DE42FA7, 0x9BF000A620335CA2, 0xCB3877C0AD185F70, 0xA86BA65D772A2795, 0xA659B4B01A9DC36D, 0xDA054417218F33B6, 0xF1B614DC693B76B6, 0x5307F57174745475,
+					0x444FF41B0844FD55, 0xAB3366EAEE758B0F, 0x38B6C4C2D824FBD3, 0xC417ECF402EC2C15, 0xF6B15D0063828351, 0x285A62A2C0036D99, 0x5A9A5985A8F727A5, 0xFA70D418E9B9C5D8,
+					0xCA1DCC53CEC555EE, 0x47BF884E3B26FBC5, 0x849FC9651F93333A, 0xC1CD7AD7D9DDD0D4, 0x8EF4B34ADD4DC8A8, 0x814ECB30FA9FB940, 0x80B026B22B54FE83, 0xFBD542DE7E52DCD2,
+					0x3DF063A1A69245D5, 0x10581F9A7EC23CBB, 0x3DEFC0BF037BC093, 0x771A8450E8BAFF9F, 0x5F8176CC8AC2D1D6, 0x547C9A33B80BF2A0, 0x659E082C9A85FF7C, 0xB0DE43A9D227419C,
+					0xC046C9BC0B882269, 0x268BBDCB507BB5B7, 0xB0A89FCD81C14B2B, 0x59572DDD47E98FF5, 0x4307B6A2527C8DA6, 0x1F2C3354702F8710, 0xE53FA5337A5F08AB, 0x37040D3906F176F0,
+					0x7B8D7E8CD2EF9471, 0x682E4F496EE4402C, 0x7FBF04D0829FF7CF, 0x2C76556AB044D762, 0x264214965C025100, 0x1CA7C72471279A68, 0xA087D1249C7CB7FE, 0xF1D94C62513788D8,
+					0x10A7F01781C7A8F0, 0x8A6410421FDCF47D, 0x941CB045188B1757, 0x4FAAA39A1939A1ED, 0xFE979CB286A2642C, 0x40D80C046D619903, 0x519B4E89CF592A5E, 0x3FB56FC0B1032C05,
+					0x4FFA2D39F1D72472, 0x4CB18A1A101B3DC3, 0x8D98D11EC0742753, 0x39301C273EACA50B, 0xE1A84DDD1AE74C6A, 0x18DDD43DDFFB27DC, 0xB7197CEC77AD13A6, 0xBACC168C4C02D1BE,
+					0xFCF3631AC908F8ED, 0x907214D0E3CCE3C3, 0xE660DC203CF2C5DE, 0x17BB9EB287214CCD, 0x1B2BA19BBF296F9E, 0x05C8A79D4ABE89B1, 0x8633941D9E8F479A, 0x89531DB0BDCF9F44,
+					0x60BD1055FAD60E1D, 0xDC90FD98897524BC, 0xD7DC562BE4132171, 0xE8841DA2FC63D3AF, 0xA8D0C747673670BF, 0xA7CD747816F8C8B9, 0xC6AE2285E9234058, 0x77C523F229E748FD,
+					0x66861246C464B8E7, 0x44B20E83D6ADBB1B, 0xF60FC98708DCB56E, 0xC4E14618C3B6CA79, 0x1EBCAC7EEED5EC8F, 0xE797A2FCB750C87F, 0xDA7463EBB2918F90, 0xFF3C983880F309CC,
+					0x803179457C2F414D, 0xBCEB2492334E615A, 0xC3654D76EB2E95AF, 0x9902A645BBC58D72, 0x8BD90795B2E984D2, 0x7EAF6EE62188321C, 0xAA1EAAA62679B418, 0xCF7FBFF95B223DD4,
+					0x250C9FFA2F8147E6, 0x630071D8FA93431B, 0x1F198AB40A66C581, 0x04F037B15846C62D, 0x9A0963955B4577AA, 0x0EEDA0FFAE869B8A, 0x03D2C01A71D4C041, 0x9299DECF1CE6CBE5,
+					0xF0AFFF55EAE43A5A, 0x31DFC621CECDCC3C, 0xF19FDC05BE4DFA20, 0x48D0058DBC24D622, 0x978DED82246E93CF, 0x2C06B69219846725, 0xF7AFC8C741925EBD, 0x6203F5AAB8FB0326,
+					0xD2B917CF4A2814ED, 0xC6E030BA42F8A6E3, 0x04CDAD31EDD3289D, 0x788E154A9F8B7A79, 0xFFBB5293A9EECD50, 0x7AA653D6CE3D1B00, 0x14B0BE16E43FCF47, 0xEBEAA3E9CE713F45,
+					0xA962FF0BF5362FF9, 0xC9FFE7A8F1C856CB, 0x57CAD10ECBF044B6, 0x421CB431747F5A1D, 0x5546AFBBCF46CE49, 0x9A5F7CE64D61FD99, 0xB829006DFDF3A531, 0x7E3C418792F71D0D,
+					0x0BA9F8B19A96D115, 0x55611E199FCD3823, 0x3960346F02EB7F86, 0x72C7AE4678992305, 0xAAC82A723EE50316, 0x40791BFFDFBA1E84, 0x0E3CABD2E51D052C, 0xF7E3DD166216728B,
+					0x1543FFD46E86DA9A, 0x81780C9959D931CC, 0xC03F56EC163430DC, 0x7C11C0E445B5195D, 0xBAA1664324D97C77, 0xC6E3A3DA32A8ACA6, 0x95F60CCC7DF2C6B2, 0x5FA270D1921A0795,
+					0x7F8105D47F3C1F41, 0x913E2671AEB90956, 0xC448FDDBA25D6A12, 0x3845E0540860C1AD, 0x5759195E28E1381A, 0xF44EABB1768BB768, 0x4A16F8478514ECC4, 0xEC0984DA34476297,
+					0xF20F9E1FD42FFE7A, 0x12F9C20B05EE7C49, 0x0657D1E76FBAD481, 0x3ED2ECDB7536BA3D, 0x04A93B19BAE12976, 0x3844BE595021E7AD, 0x08C881218DC0A79B, 0xFAC9903C2C519739,
+					0x5213777BA606F69E, 0xC56D166BA4E68976, 0x7BBD72EADD098BF4, 0xB510D50B46933159, 0xE6D12B9694959A69, 0xD28D23626F726498, 0x5F47BFE309F7CF56, 0x6FB69B8C11A34CEA,
+					0xA9464918FEA0262A, 0xEC26289AB37F6655, 0xBEB1DF4C2A868F8E, 0xC28795AE00A954E7, 0x31F624931404C406, 0xDA445B850CBDA11C, 0x9E540C1CFBCB2D57, 0x1386F605A305EA62,
+					0xFCAD2F62DF337627, 0x0929737B302CD8DD, 0x5F30C1102DA5E2A4, 0x967BC38C18B852BD, 0x6AA1D7F08D005B27, 0xE4EC16856B18C2C3, 0xE7070D8AADA690AB, 0xC9622EE71ECF3159,
+					0x9CEC648059FB5981, 0x2AA498D5F1EA52F6, 0xF8E9B72175597BCF, 0x88E7A0A1665A8A9C, 0x4C826495DDAA469A, 0x78EF4DF4B547C436, 0x5FF71113446AA20F, 0xE21D614177FA626D,
+					0x2C2D3DEDC2C55FC8, 0x51FD0209589FBFA6, 0xAB27351487666EA1, 0xD63DDEF1BC7F2C9B, 0xD7F8A645A7FF6C59, 0xC66EA1A1196DECA5, 0x5011B81DB2495CC6, 0xF5601F2719EA0599,
+					0x062CF5D098D88CC7, 0xC43403CA55570F05, 0x1226CFC1B968B945, 0xE27010A3F2723437, 0xAD887468F1D96F50, 0xBCDD48A6AAA14736, 0x7C5EF0897BF3C990, 0x9510C65A75907486,
+					0x9B162ADBF35DF224, 0xD96571723C1CB13D, 0x58604F7B208629D9, 0x433FE6BBFFED3E72, 0x4A3246CC1B247708, 0xF70AD3410E1536A0, 0x1C92302D1C18CBA2, 0xF7B8EE7600E5652D,
+					0x6BFF2E95ADE7294B, 0x71B3519862830619, 0x02593DD0349E1025, 0xEE40136377D8EB4A, 0x3C3E157C9CDB4C67, 0x0E6576881C4A7D0C, 0xC419D06E2A6F9B49, 0x26A4EDE6285E7791,
+					0xC53865ECFEE4095A, 0xA030719B3E6EF956, 0x64E244F61650B43A, 0x33132ED14A1F0DED, 0x82780D522208E770, 0x0C4C5247C6C26D9A, 0x23A707A5697F25A1, 0xAA5F0A0B43D945B1,
+					0xD31EBCDD03E47703, 0xDC009BD04023230C, 0xBE0024833E98EE6D, 0xEFB7C65B7423846A, 0x6F3F40FD84CC0BF3, 0xAAB95C82F85E315D, 0x48AEA61C8F348D33, 0xCF0651C516642AF9,
+					0x2B4A2AC8B5EC13BF, 0xD7F94F4281EC2543, 0x6F9168B3A17FFDCA, 0xE75F545DD5ACF00D, 0xCE100DE14526FF04, 0x517704D0D21E079E, 0x44044A288B39A518, 0x4E0D8A905E123965,
+					0xDF7FD3A00DDA31E2, 0x6700257745986311, 0x77852CA2282A8377, 0x639C0A2B67794CE6, 0xE4C7FA208692E264, 0x781C61824E6EC27A, 0x1FF437064507BE39, 0x85EA09B229078787,
+					0xE3D1153148FCA336, 0xE3128E1CE4847384, 0xA2F81670B558C9E0, 0xE8EB27123CE95CF2, 0xB11F9794664CD40B, 0x72F2F8097C5A1E59, 0xCFFD58943F2E2E61, 0x03873D0E022A5346,
+					0x16DB83A52924FCE2, 0xC357606C6D82926E, 0x45A067D1DAACCFF6, 0xBFFF90E79CC92486, 0x7D8055552C8860EF, 0x916878C9570ECAE7, 0xBD2B20BE7D1EC4C0, 0xC00D5E08ADCF6125,
+					0x6C2211E7F31E15B6, 0xFF7DB252BBB8745F, 0x8A3CBEB5C8E2AC6D, 0x192FAF135B70440B, 0x7DF6BB5DA1BE0294, 0xE9EF0720F6D5B529, 0x1DC09465D6A37446, 0xEE0C19CF8CD1EA2D,
+					0x629D9DD1323D7762, 0x166E0A68F8C58AEA, 0xF8A776A2048FF357, 0x941D64C1F5C942BA, 0x703A5C4D2522177A, 0x663C31F8E81C37E7, 0xEB770B4DE5FCA661, 0x62090FA7C1ADB895,
+					0x99D5825E753FEDC6, 0xA91C1E479C5B809B, 0x4C4D97C5F81823E0, 0x73EE558B07ABC7C1, 0xECC490BEE8ED2DBA, 0x3D20006A746A1E23, 0x3556D3780F6E844D, 0x99E8A3B2314E499B,
+					0xE5E641403EB37FC8, 0xBAA41DCCEC4A67B1, 0xDDA79667BA988EE7, 0x9CDA62E57D609576, 0x0A09666C5FA0C7A7, 0xA67B98B4819893AE, 0xF13E1BBCC9EE1F9B, 0x745FBAD6188B8101,
+					0x6928ED092277E95E, 0xB1249CBA097C3244, 0xB90ACE134D3D7415, 0x4A018C80C834831B, 0xDBA6227979F64DD4, 0xB907343D64977BEC, 0xB62A2951E3EFF253, 0x3BC06BF1C367BBF0,
+					0xD7D0C0DE4582D5F4, 0xF81E865C93B34CA9, 0x040B01E9A089C9F5, 0x2A2FD8D6BA8D79DB, 0xA8150F488501AF97, 0xC65A34102CE3F981, 0xF73CA745344C6941, 0xF2B3D272285B06BF,
+					0x35DAA872C9236E0F, 0xF7E95CF54C545652, 0x11C9C6BB90A61564, 0x192C128A222F3737, 0xD8C41997522D5A71, 0x0C4E801C43BD14EE, 0x987631195509773A, 0x6D88893ED9623F90,
+					0x28B01DFC2A0BDE3C, 0x49A05E0134A5720B, 0x90363EA1635380B4, 0xBDEACF27FA3368A1, 0x1851CFCA66D81B87, 0xA7BD238B5CB16F09, 0x7698BC7DD30321BB, 0x53026F3E3EDC7185,
+					0x8E0F67C647396556, 0xC5021519908ED5AE, 0xA4840D428C0E67AF, 0x7DEA5BB9D328510D, 0xBCA35077224D9042, 0x4D837A27D90D86BB, 0x0B600E4789CC9CCE, 0x1551A2614DEA70E7,
+					0xABD13820266A7C1B, 0xBD080C03457035B4, 0xF78EBC5FC4B275D5, 0x40E7F52E5DFEA10A, 0x3BF24B00F18C783D, 0x4931E590626FB97F, 0x4BB91670976405FD, 0xB39C4373194DDFCB,
+					0x156EFE2A0FC609AD, 0x8CF0909BE04E1CDE, 0xFEAAD6054F2FB8AE, 0x321895B6AC60BC06, 0xE2D7752EFB0ECA61, 0xDC66647124971970, 0xE24A9A1F479B31E2, 0x8C1149BDFA1E8336,
+					0x1D6E36815EC1AF69, 0xB08AD73F28151434, 0xE8923024BD64D093, 0x63BFF3CFFD8C4A70, 0xF6117C1E31E21FB5, 0xCB22AFA10C9CD034, 0x6EF5D58C2CBBD0D3, 0xFF7605111D9341AD,
+					0x04D9DB25D34F5F27, 0xC17662F4D1E99D92, 0xBA83B57691E75EAC, 0x27816FE320BE9DA0, 0xB890CBE85F71EF2A, 0x215C8C983EA848B6, 0x0F191B2CC02AA865, 0xA805272B514B07B0,
+					0x212E5EFA35C16C4A, 0xD1417499053EFFDF, 0x954B8E4D7128F326, 0xBFF108D1DA093A75, 0x5FA76680B34CC5D8, 0x78CD6F3C88238819, 0xB52434E563ED72A6, 0xE712E9DBD22C4CAD,
+					0x76CAFD2D0A8A37AF, 0x90B007C024199AE3, 0xD59A8A72ABB98CCE, 0x9550E7E153FE7A97, 0x03CD4CC5771816DD, 0x4F0078F49B83FA59, 0xFE280B2D6B850983, 0x0D079AC3BF5AFC14,
+					0xD25F33CD07F4E5F2, 0xCF3960AB666A908A, 0x1E3E303C69ED770C, 0x5CE7FEF23016208A, 0x7AD8050DFD18D38F, 0x20899CFEC8D172C1, 0x14A0118A395DB507, 0x71FB009C04586E44,
+					0x847DBCAD6CAFCECC, 0xDDAD4461A8CF59A1, 0xEDEF5BE86DD366B9, 0xB698D4720674D708, 0xBB8171BD88B6A4A3, 0xDE297817F7AD3B5F, 0xDAA5CB2465CDC2C2, 0x16201B081C550014,
+					0x1ED81B2F7833137E, 0x06BD3A512E21697C, 0xE2BE61354A73E83F, 0x9E6311CAD57BF15A, 0x320234C52A6E7BBC, 0xDE6D8530066E0110, 0x1DC6D4F2537584AB, 0x28AC41BCCF18B609,
+					0xE59EBC7BA4787ABB, 0x850370A4C587F7C9, 0x6E995915FC070466, 0x93EA4FFE542D9227, 0xEC86631E538375C3, 0x8CC35A0CB9C7BCE1, 0x708D55EAA28C49DA, 0xD9AD9EC0B85F11AE,
+					0xB43C7196349500D8, 0xB8918446E2E8D5C9, 0xBA5A7D88CAE616D3, 0x0874EBCE3DE409B0, 0xF91A40AAC81EBDB7, 0x0CC1C678A24B3044, 0xAA4FCDD1608B60A7, 0x317060CCF05B8A22,
+					0x3F75D78987DD8CD0, 0x4ED75058AE48032D, 0xF27AF0BCB1D867F1, 0x61A974FFBCC7B361, 0x1DD4A9ABCAD33D23, 0xD8C7DA54844F6415, 0x53BB394AB92A3805, 0xA461951840D7DDFD,
+					0x6A9F0D7EECA46428, 0x29AA10DA62409482, 0x84FFD80BCF3C17D0, 0xB7FCD7CF7865E563, 0x079E49C9C2D4AC73, 0xFF0C0C70D2DA367F, 0xDD04EF7CA692EED7, 0x2AA37FF6AC2B830F,
+					0xED030CBCBADC1A36, 0x4842FD71C907B176, 0x2C8CBD34DDBBB1A3, 0x3AECFA57F1F1FCB9, 0xDFF6473B210384F2, 0xC2F87ACCA46BEA8B, 0xC468141828F0B6D5, 0x45B11CBC03745675,
+					0x8BE35C101A819E8D, 0x6AD26628C5BA017E, 0x4B58C8F552D42D58, 0x3C2D02E4C30273DF, 0x1FE6BB202E5B6CF6, 0x041C2FE30DF7B449, 0x1AC6F20E14095835, 0xA1CD337A215B9501,
+					0x6119FD9894F9BCAB, 0x79D67362C87805C1, 0xC1C8DEB32E455433, 0xD9F234693307EAC1, 0x543CE5C64C4A2EEF, 0xAB6049FB81EF2101, 0xC593A8795C9BDB7E, 0x94961B86C5D45402,
+					0x4D89F503A5344250, 0x1C0286388F8E77EA, 0x70C83D04D1C8BA4C, 0xD096719AE6BA64C8, 0x34FFB0A4B558046E, 0x7C721CD606B8E7F8, 0x6CFDD85A2EAC9367, 0xA1DC2465480470BE,
+					0x621C299DA89B24F0, 0x5809ABD00DBC5718, 0x85E693C30F6412D3, 0x3661E0A353B2C990, 0x759698C0CDC1834C, 0x18DD8CC3D88CB42C, 0xFCFDA5A2B81EBA04, 0x1C0419351D7988DB,
+					0x51D1940848470E3D, 0xEE37A73264B8F088, 0xC606917E3DBE477A, 0x20790D1C3BB997B7, 0xA6DEAA355CE8EE1A, 0x7D2CB1E179C10E98, 0x46AA2430178280FE, 0x91A3A10A3A18A0F0,
+					0x34287763ED24F607, 0xC9BF2C1E980F450B, 0x357683CE9213B5B9, 0xBCDEC7D6584FBCAD, 0x08E7D6B33017AF9E, 0xEC486FA2E5AE2BE7, 0x3F5726C92CC035B7, 0x7FE03A215BB8933A,
+					0x2A45D4B683284E06, 0xC24D31160E33F73B, 0xC757B8E0F92DC272, 0xE0E1C14010ECDF57, 0x404E3AF062299259, 0x1DDDD80E0835408A, 0x221D363B1DD97675, 0xEFA8D2387AF05A91,
+					0x793C8DCA55F80C07, 0xFD0EA633BE897B03, 0xEFE69D4F2ECB81AB, 0xD08761CFB82537EA, 0xF402ECAB26A6CDB9, 0x2909C727B7E571A0, 0x28EDE3233E10AD6C, 0x6DFED6F120F3A735,
+					0xD38DBB36248B0814, 0xA7DAA10DEB1CDC77, 0x07E0A9BB136129AA, 0x560A05DF8AC5BF28, 0x75F18D83DA0AA35C, 0x30988BCE06CBC36A, 0x88644EC2EB3A1A73, 0x448CF7CB88E91172,
+					0x4BA594083153338F, 0x65B0D3567CA6CDE7, 0x2435183FCA1C144E, 0xA73BE2FD448328BE, 0x3ADAE68F4373E787, 0xF0BAB8FA72FCD4A1, 0x2605A5395A4FC877, 0x271E3F51572910AF,
+					0x341F4EE0D6CC3D07, 0x9AEF2EBA364F8885, 0x262D8602D62039AE, 0x787D6D4256746565, 0x25167788200B06B1, 0xA6ECECCA29C8E105, 0x6FF0440125C23453, 0x502FBFAF6CED55A3,
+					0x6ED8F88EDCA0D68D, 0xDB1AD8600918EC5D, 0x76C7156BB25008BE, 0x3F722F31B743A2A6, 0x24E270BA1483D4EB, 0xDEDFE3E55F7B6386, 0x3AEB9E90DE50F4B6, 0x47FA39C5BE139305,
+					0x901F9070FFF8B45E, 0x34FAD7CD1FC505BB, 0xD236E92D4256146E, 0x64FE5263777C34CD, 0x3F6788378F67BB48, 0x1851814472E896E1, 0x18850D9FA9368B97, 0xDE28F3A2426EDE12,
+					0xD9562CEDF488165D, 0xA4D96B10A8F55068, 0xD7361FBC6260B2E6, 0x3367A34C988CC86C, 0x55F3C16A0FD0F4C3, 0x8880C6B9B7C32A17, 0x2ABD4C0F5E94ED96, 0x523A9327764942D4,
+					0x5A2012113E1CB848, 0xB78223D2A863895E, 0x704AD2A9CC55135B, 0xD6B18AF80FFEF55C, 0xDDF367F5FDF7D70D, 0xE0E6CC248D827998, 0x10A148B9CF6D1FC4, 0x9B700DD29DB3808F,
+					0x1E1ABE0879EF882B, 0x9D4267F180A806FA, 0xC7B983A1FC3F951B, 0x08666C5520B4665E, 0xD61F0364BF9A30C6, 0x9B3A624826D4BB4A, 0xC4D39072CE946514, 0x319C18C0F7F6D91D,
+					0x8118365FE1501478, 0x8C6D508AD39BD15C, 0x22A46C4CC0CFE2A0, 0x74B25ADD856A830A, 0x36A15D97E99213B2, 0x1EDCA9D77A0A7D85, 0x43948FE78B748FFE, 0x675BB4B6C51C5D56,
+					0x69DAEE57697FE91A, 0xDD213237584EFBE0, 0xF85C84473B54E602, 0xF5872DD56A991FE5, 0x566576DA6C14D883, 0x391748D20F6B0A7C, 0xC2D59556595CD15E, 0x5D9F3F3D49F03155,
+					0x2AB6D48D44D00427, 0xC3013282ACB58305, 0x9ADD4A059024B2DB, 0x567AB90B440F5275, 0x9877BBF12886D3CD, 0xA9CAD986E30E9086, 0xED043FD40728E4F2, 0x2BD4F822F180D6BA,
+					0x56C611F4C3B7B75C, 0xE3A00AA11860B441, 0x552B0FD9C08C3472, 0x172D9C92289A23A3, 0x2FACF1F146ED67F5, 0x119551F23CF5A83D, 0x3EEEB90039FBC1B5, 0x77206DB1F69B4BF7,
+					0x178BC8E8845604C0, 0xF4B6325BC65898BF, 0xDC08CFDE7BE23586, 0x2098E9D394C855B5, 0x0FE0FB44317FF3CA, 0x5E55F66B1075934A, 0xB003DB873E7B4F2B, 0x4C6267F89FAC93DA,
+					0xA934B6C7A052F7AA, 0x6ABA18FCEA71EA2D, 0x86C78F1A0ED70BF3, 0x64D08DDA386C4F3A, 0xC6F3BF6A2264623D, 0x46704C65F02ABCEE, 0xB4044ACC659BCB20, 0x34399B482EB00465,
+					0xCD5FD27AA7314A67, 0x1D41081EE3D39219, 0xBFB6F0040E19A6EB, 0x44A1DCE0A8846707, 0xF964C90A828224B8, 0xFB50E661B2113868, 0x1229B0A67D9F2F69, 0x8334113D9A41E853,
+					0x6FEFD0865756D064, 0x928C430BC6781A24, 0x8EA45420C5E65871, 0x317FFB3755E9E9A2, 0xACBE137E5AD049A1, 0x4A95765FBC64897E, 0xD305A7C4B4E589C3, 0xDB4D12B987EA9F0F,
+					0xF161F4B562CD23AB, 0x079AD8C79272FDC4, 0x0F492A85BE67F497, 0x2BF9C0FDBD4A772E, 0x8AE5C1688B43041F, 0xADA73946DD6DC38D, 0xE3C7E665B27B6477, 0x46F232AC7327D03E,
+					0x420DB4EE5671403A, 0xCB5245A062527D3A, 0x6FCA0EC2687268B6, 0x1A104470DD09B753, 0x098A55DDCE6FC020, 0x1295F3C9D786A884, 0xA5BA5AEECE3C1D1C, 0xF2243D9D6D0419CB,
+					0x9793E6DDA686CA18, 0xA31217EAEECAB564, 0x83364D251AF52CFA, 0x6B19B33F7EB74D9E, 0x5672FEE803FFE80D, 0xB9D27CAE8179424D, 0x79AAC0D3597CA6F7, 0x5F4DD7AC37814C6B,
+					0x032F32ED0DA48A0E, 0x8180D6376AEB558C, 0x0C4955591EC45F9F, 0xE17CA48ECB7C4C95, 0x6A6DF6C4E8045C92, 0xF6E64091F3107DD7, 0xCDA8A7770ADA2403, 0xE5BD373C1430E7C3,
+					0xF8DE874519A8FFAF, 0xC30EBFC570DA3398, 0x9F961B2396A0967C, 0xD0E5E4155EE80551, 0x389A6870CB36726F, 0xD4137771BB80E5F6, 0xDF5B6D7C1DA3BEA4, 0x0A227BBE95F18D2D,
+					0x1A509ACEEBA567B5, 0x0C90B83A090A9A2B, 0xDF508A73E95CAFF1, 0xC3BFF9EA6648658A, 0x5367CF0876391540, 0x1A71D9DDE958427C, 0xA8074FB89568EC6F, 0xF3EF608E054F8B49,
+					0xF99362E8F20B0AE3, 0x2A347CA51ED2C8A9, 0xA885ED8BC0C60D69, 0x052DD81BD027B2D8, 0xC875FB4202DF514C, 0x1239D5044919CC2D, 0x4E5D974268EF27A0, 0x68BB15E8AAD7FA61,
+					0xD05DDFE5AB78A0EC, 0xB5F0FEB1995B8568, 0x103028DB1610C311, 0x434ABC1D44787CCC, 0x4FAECCFCE9F28531, 0xBD10F263B470847B, 0x8836A135F2073623, 0xCD783D2A0C306B06,
+					0x68E4B91360F0B7AB, 0x5E8B225A2710D68E, 0x9D70CADA7C52E830, 0x36A023003BD6FD98, 0x4645C27B9353DA65, 0xA66A1F66C4AFC883, 0x14BBF7A2502A8B41, 0x94D5A9E0B3EB7F1A,
+					0x8321EF8FE30EC20E, 0x123985E32CFAEBF9, 0x079DC5C7C9296A68, 0x960BCA9FD4C9EC07, 0x72F5EBD34E9D4078, 0x340E143EB9880CDB, 0x21922330E6761FD8, 0xEC034A7334261C26,
+					0x75564F95C81D11F7, 0x801E19780718AA84, 0x7A32C09CABB095F2, 0xB49F10A642429280, 0x04DDE58367F54184, 0xCC41A9BDC7D911FE, 0x1C1A809AF80768F3, 0x3FECBBC2AC42E079,
+					0x36740B480B6F665D, 0xAEDC73CE75EB5900, 0xF5CF9C06E03B9B85, 0x608554559CFF5B1F, 0x412957FD0383EF57, 0x8C29637DA3390B3B, 0x14B8D523BC5FC3B7, 0xC3F7908568846967,
+					0xE70E2E44571FC299, 0x6B6984D35684740B, 0xD2BD493FCCC35CFE, 0x16DB038ADD80F9A6, 0x488A4422518B4B56, 0x21BD5966ADB359DD, 0x1AAEB7C52180F19E, 0x44F9C5764C06A620,
+					0xFFDE38019B5D7D17, 0x08C63676BFF5BF5C, 0xCAB3DE24B508A7F3, 0x5447B1DEAA378673, 0x229015AEC9C26088, 0x64F13869AE319735, 0x596363A33B0E3420, 0x3CF2ADEAD5C15047,
+					0x0B509F8268E6B4B7, 0xD1A5681B230CBEF0, 0xB533CC4BBE27412B, 0xC368A79930525094, 0xCD2E8EE50B79AA20, 0x020C92DE2D7C73EF, 0x61F3AE4F08E5209F, 0x8B602C0909995307,
+					0x93B2448033191117, 0xA17C4A9CA63128DB, 0xAD11909A9892CBCF, 0x2FCCBFD549C217A0, 0x39E8C6E93C4C32DF, 0xE4A0CBC7A25B815C, 0x5A63885121EEE400, 0x9A8023AE660EC006,
+					0x61F3FD467ED1B489, 0x17BCF30B62671FD9, 0xE8FDCFB1298183D4, 0xC21325AD28AF4324, 0x6521BFDD82A8EB78, 0x01275FE4EE0736C1, 0x9088F6EFBDC60FB3, 0xA164B16CED8C0585,
+					0x26EFF2456614E6DB, 0x3645EA9551B0087D, 0x26F749E85ED35615, 0x1C20F88C3C74FE84, 0x4CECD96E4636A9C6, 0xD7B0B94DD09BA8FB, 0x3497E6433EB8A3B1, 0x19849E4EBB510B0E,
+					0x574612C8FA63DD6C, 0x87967427DADB4243, 0xE5CFBB2886C52A20, 0x449C8C7D0B999D6E, 0x81C63FBBFAAE14E3, 0x2044518DA811FCF1, 0xA4498A95D0D0ECA8, 0xD11AE552D69C1A3E,
+					0x7667A15FEB290EBF, 0xEE6D79A0B7C5A5B3, 0xAC14711203557824, 0x6FDB45E18AFBE2D1, 0x28386217BAE6C73A, 0x9B044D23FECFD905, 0xC883567FD760E0D3, 0x2AFC164460CA9E9B,
+					0x68E80D100C81EF23, 0x409189DE1343F9F9, 0xCD8FC4580F7BAF6D, 0xBAEE3161253A76F1, 0x4C4E9B898B8F8D88, 0x4282817A43AA09A6, 0x6260B255173121EF, 0xB99E1FAA9465833C,
+					0x5CA5A07DC843243A, 0xFD521D99D35311A2, 0x8A197FA53C08E26F, 0xC1DF07CAB7271241, 0x4D3CB131FF7EFDE3, 0xEB47A348ED005A59, 0x99341031FD03E2F3, 0xA9309B92A3C7F49E,
+					0xC9506C52BEF8A799, 0xD4E4CADAF0B33027, 0xD1E5F47E46CBA601, 0xE28A085582812F60, 0x004874098F80E8EF, 0x7EC3BD9132472E5A, 0xF01A43203318F431, 0x8AF9D8E803686194,
+					0x22C7E9FA16B746FD, 0x9F229F80DAD41DE8, 0x1DEAE096EEB97127, 0x5EEC78D0BCFD844D, 0x494F5DCF52DC83E2, 0xD1541A5D89CF13C3, 0x479F530ADA87A6EF, 0x4CF7E51D2DAA1677,
+					0x37E4E828CF9D525E, 0x0B74B6C6285129B9, 0x6D4E94D135BE9979, 0x33FD08751C2CE764, 0xECA05B2E8D139C9F, 0xF8C28020E6200227, 0x02C1669BEEB70D75, 0x8A2102C3DEBEA6C2,
+					0x28CE2C43B9FC4D05, 0x9009215364FDA4C3, 0xB714E1C5AF4F4ED6, 0x8112CC202CABA8B2, 0x393E713FEC535AE1, 0xB58DFB6871B621E5, 0x5A3495CA463D9DB5, 0x781C16B73D390B15,
+					0x38CD3C7CC8E6EE3B, 0x6D4239281C1EB52F, 0x64DC475F0435E417, 0x6E283A29B2E2BBC4, 0xDD1B6F7A78F605AE, 0xDB2F5D26C70E3400, 0xAD42A404B986E03F, 0x72E0E8FF5539D62A,
+					0x87907331E7AC8B5F, 0xBE90E3D4F407AB42, 0xAD28F4F534A82F93, 0xCC99AE4E36562891, 0xCBDA94C6C2B968DD, 0xEE8FBB8F05A713A1, 0x0D20B22ADC95FB2A, 0x6EE12F1AA2D82B39,
+					0xC5F9453FEF916C95, 0xCEA1CD9EE1E0AA71, 0x9086D50A14613532, 0x405CD1AACD44FD86, 0x72E924EA75102F5D, 0x1A5C4E0A7A9967CC, 0xC0E98243631656E9, 0x2300B8B1FD990F5C,
+					0xBCC91595EE904246, 0x0D4C57E2EF268F0B, 0x3D90A40265F134EE, 0xD46FDDA229230954, 0xD1FB10F837D12AA2, 0xC6E4241007698267, 0x00D2BE56DA7D9D44, 0x7507AD70DDE6944D,
+					0x2CE77A323BFB7118, 0x90C0BDBB01A35295, 0x01D0BA26C00EEC2C, 0xCF016C8B2F7DB80A, 0xB70BFB1783B824ED, 0x65BC4ACF300B5586, 0xC84745132AACD68E, 0xCB284C66E5240344,
+					0xED768FC9FC6DE9D8, 0xF0A11818312FC9CE, 0x3DEF879713B37C55, 0x39A4F38BA8F83B68, 0x53BD80FFDE60E137, 0xEE12DB04A20FE598, 0x58FE480A5C7B8446, 0x8DEC961F2B3A2A5F,
+					0xBB7869D188E3D173, 0xEE0299FCD563180A, 0x427C894171F732B1, 0xEFEA1C08C0F950CC, 0x2A0E474AC15250CE, 0xC133118DBFE3AD86, 0xE625C65796D366A1, 0x11C4CC0ADD154EF4,
+					0x86DB4419F758F839, 0x54E0B70F7453EA42, 0x5544098E9EA0334F, 0x34B90842CCBE52D1, 0xF39FA4849EA984A0, 0x9E0CC61105104425, 0xB33641C4A3CD1419, 0x3F3B49FD2C9B3E4C,
+					0xDCF1BDF5F6BC749E, 0x7659167AC01344DA, 0xFB02E921232FB2EB, 0x38887BA19595B857, 0x50D704FD28C75E0A, 0xDFA5ABF881E0EF08, 0x451EAAF770DD70B6, 0x33901671E500FCB2,
+					0xAFAEC1EC73C2D156, 0x757530F39CEDA08E, 0x4E34C8E2021AFDA6, 0xFE189AC058EFA16B, 0xFA2BDF29B761ED0C, 0xBBD7DED6CC2D4F89, 0xDC1C219E56B613A3, 0x2D19BC1D55BB7432,
+					0x3BDA992119C803BF, 0x1BA6F722448E4273, 0x56242CB9F1DC58B7, 0x719594F8CB380D3E, 0x94A2D72E54D9E269, 0x4F6C095B46585A59, 0xC20E62173F782132, 0x800E7CA1946EBE4B,
+					0x2E77CAA086BCD313, 0x4589493D144C4B56, 0x0093FBF94F796ABA, 0x9907EE8904C8FB8A, 0xD8FCDB0531C4E549, 0x505471A38F881963, 0xD8E811EED034C0B0, 0xCCB99933D1096263,
+					0xCCE17F3DBFE98212, 0x1DCA6173BE97ED5B, 0x53317ACBADEAEF3A, 0x9EE99612B89844E4, 0x7B7471530D653BBC, 0xB77F428FCD148C41, 0x737AF6169211F3C2, 0xB5594A8311218D9F,
+					0x19E4BECD4BB63172, 0x1385151A054DCADF, 0xED03F77542537A4D, 0x159856DF5912BBFB, 0x26897F543A14274D, 0x5BD572972B8F76D6, 0xBC903EA18F7A6EE9, 0x1A039D29B72D3E89,
+					0xF1579CB973F34AC2, 0x93ACA47A518BB913, 0x67A8ABF8015C2B27, 0x4CD9C9EDE085F461, 0x7472DEB80BD1152F, 0xCBF4C6F5951D4397, 0xDEEAF4ADF026E70D, 0x0AD38BD9CC9DCC91,
+					0x8ED68C2B0BBCE0D1, 0x775179BBE47F6068, 0xB5A64B8F554837C9, 0x0BF7736CE78D3939, 0x724E027D35E8C419, 0xDB3606428F191C31, 0x7816419D413A0097, 0x08905DA23801A8C5,
+					0xEFC801B68E552298, 0xE036FD1866B65CFD, 0x9F510AD7BC8E36C7, 0xF9EB01898386A89F, 0x930B6E2BC22BAE81, 0xF70D05A4EE6FC386, 0x78371E60D795B237, 0x70A37D1204E291B4,
+					0x76AAE0732E387108, 0x0112BDE70E8D2A74, 0x69EC4313DA96E10F, 0x4801A16F13D9F7EF, 0xE8AF6C5DB5047FB5, 0x4611F2474793CB4E, 0x14121FD14EECF293, 0x5E0D79F39DFBD155,
+					0x7BB35A592D0BD1D0, 0xC0B446E2B0B533FA, 0x99E093F5CA8CC721, 0xF3B8BB125A889960, 0x9BE55959D7E9EA8A, 0xC6D60434F9532EA5, 0x2CCB9EA60379D497, 0xF01471ED2E16C9AC,
+					0x7BC150638CA4A1D1, 0x0DFC3FF738F2410E, 0xA2E8F06B08B92694, 0x8A17BF8D53ECF78C, 0x8C522ADE861C4E79, 0x5B2DCD2C15B3071C, 0x942B0F0D4BFBEB0F, 0xC434441D0A11BDA3,
+					0x96727D811E5D6E90, 0x0F879675F17DFAAD, 0x2BAB1B7A6899335D, 0x0374FB1231BC181E, 0xFEB7CFD0BC14300D, 0x2EA4782691BD36A0, 0x00208192DC27963A, 0xE8AC2D91FE5ED897,
+					0x0A0CD3D9FE067548, 0x86DBF5AFD9F47699, 0x7FA7C807FCE62101, 0xA2EB51854C866B44, 0x71924D73AD785A46, 0x1AE75318B50AE95F, 0x29C2CADDDA9F5AED, 0xB68511017E40463C,
+					0xC0DBD2C3346144E2, 0xAFF74D6538379113, 0x297A904BD0378A26, 0x827A7D1AA1970609, 0x04F27FAC01835E99, 0x3BB8A6859ED4BD2B, 0x8D3507986042CE79, 0x159BAC2014EBD3DA,
+					0x6BDAD11DE12C7F8F, 0xDD7D2418C4A4ABA2, 0x82CCBF5FC21862AD, 0x196D34DBA368ACEA, 0xE2A271896BA21CB1, 0x9F8B3F99ECB9D5CF, 0xB2FC6193BE1E86F1, 0xBCB8DCBA30693B71,
+					0x2979B8B3FD70C9FB, 0x262851AF888C5371, 0x4207BC54D313D3F9, 0xB065595EE0EBACC3, 0x68ED7CB4FCF3F4F5, 0x0AACD6EE8AD70F46, 0x3E421D82459C46F2, 0xD6A529B3AD760E1F,
+					0xC4457056DC668C6F, 0x20E24C3E619EFCC4, 0x6164C918C59E07E7, 0x95AB2F49A5D9B109, 0x13CBBD778406AC9A, 0x4301B86B609A4D9A, 0xD8E5BD2C08659B1C, 0xDE58190DAD872FDE,
+					0x8034DD207812F933, 0x8564854D748C8915, 0x004C90D9D7943833, 0xF5E173A49ADA3BFD, 0x31FE9DD427E4B0ED, 0x5AD426DBB27E1658, 0x6D830F83C23BED5C, 0x84E77B3AF90BF184,
+					0x14AFA8566DDDCD78, 0x1B8559259504539E, 0xB876ADE02B514C78, 0xEFDEE72E43772502, 0x9C86012ADAF62253, 0xFE5ADCC917287E9B, 0x0F0513BD0B45B65C, 0xA862C1DC2D1B45BA,
+					0xB79D9A0DDC01FFDD, 0xF46BBA839B751DEF, 0xF4732D9ED4FF9EF6, 0xF1133F282D0167E9, 0x6185014A10454FA1, 0xC45F54935CB38FA3, 0x26A5B415FF4FA81D, 0xDC881D0BE7968B76,
+					0x2B0C3231560BD763, 0xCB48A7AF07A76E40, 0xC94780C073F35ED5, 0xFAE5CE429A42EFE3, 0xF033DD8337F45B0C, 0x1E1A761612D71550, 0x29163E801ED76A63, 0x642428553E22A58A,
+					0x8F3020A9332F0C35, 0x7BE8F9E6A04B4789, 0x44376BB0467F90AE, 0xBB26396837C37BD5, 0x1CACDB9EAFD74E64, 0x9B44E83A9B3FCF92, 0x0EA44ACD498CC354, 0xAE22C25C890511A4,
+					0x027C3194AD5C319F, 0xA48225FA9D35C896, 0x13AC027A1FDB3C9B, 0x319D8B0FEED8B6E4, 0x848F5E50B903C30A, 0xAE517DDF21ACCF94, 0xDC0C3F068526C9A4, 0xD3BE922F5D5343F8,
+					0xDD8014B9C0ECA66F, 0xCCE8629ABF29E527, 0xED7986422660CB52, 0xE67088549B16323B, 0x496A9C8B36B0BA47, 0xE87ED3075F2A9789, 0xF70FBFC62FC46CF4, 0x9D866CAC221F3E7A,
+					0x3FC371B47BCF2FAF, 0xA0A36F138D31DBC1, 0xD02CDF709E83F7BA, 0x0D4987699B72FC60, 0x75C0CD95CBE237F0, 0x894F4C22E1C008EA, 0xEDB7D5FD98085EE6, 0xA05598D21265027D,
+					0x2DCDD59254B04E92, 0x954F84ACCD632D0B, 0x8D79F2CF72A2BB2C, 0x9F26448EBA2D1AD4, 0xC9FF7E21B20319A8, 0xA89367E00FB18389, 0xE09B20EE504B1C9F, 0x4D4ED28988E5CA90,
+					0xAA526D3B3443B133, 0xF24DBDD94F569711, 0x7AA26B7AF7BABDB0, 0xBF743F2D429A1932, 0x13B64FE02D84E899, 0x86879FE1205DFDAA, 0xB9218DA25B3A15BC, 0xC3B282B21CACD198,
+					0x1F3A242C39A26099, 0xBBA8FAE031FDFA5A, 0x5CB6B8299FA8D826, 0xE95645A0E2083427, 0x0F88D1F3EF87128F, 0x417EFF00CD5EA201, 0x2C82A58419D9E09C, 0xDE7F0630616A471A,
+					0x6F5293CFD91B89E9, 0x4CF42068E9CA4303, 0xC513D83B9F1762B2, 0x6E5C93035FF6F2C1, 0xA9F38EDBA1815F77, 0xD5215E89BE3A133A, 0x768084899024F7F4, 0x7CD7487E70A44054,
+					0x81C0D54A9DE4ACFE, 0x426938EBE7648D38, 0xFB71210C82675BF8, 0x76DC546A90F4E881, 0xF3AF6C119169F5F7, 0xAA1A38C93BA996DC, 0xB33493F63609AF84, 0xD74206EBC5E0E9F5,
+					0x267CEE4B5345D2D0, 0xF4A64D4456385DDD, 0x7591397180838B94, 0xBD0008E004CF857B, 0x794C2FB2021FAA9A, 0x586482DBFB05AF4D, 0x79581453CD6A65ED, 0xCE658CF1199A1183,
+					0x2681EBFE986C22B3, 0x0C3F52831AE2EDEB, 0x0658D0D52D83C17F, 0x594584CDD87AA4B3, 0xE8AC18A69B6F76D8, 0x79B83B3518BEFAAF, 0x43BE7496D0F70F6C, 0x10B4A279589D754D,
+					0xC8927AF4A205251A, 0xCA0CCBFFBF6D6B80, 0x80A7996809BAFF07, 0x8AEEEFDC5C265396, 0x839D85F38B161CBD, 0xF2BDDF1DABE9A065, 0x5E90F71FD9716770, 0x4B30D7D3D1FAF314,
+					0x633CB3A2A1DDA35E, 0xA9EC630313439C0F, 0xD01CCEB7D4561693, 0xF86B2600A07E5186, 0xCDAD6603C5EAF7BF, 0xE8D1F651EFE03A32, 0x4B01D9B852E5D201, 0x23C6B3726676EC9B,
+					0xE3FBF768A2316403, 0x15AE138E87CAEFED, 0x03A8AC443002868B, 0x367E7F1E6AE11622, 0xE11031FBBC8C6B4F, 0xD23CC6BD5E4D502D, 0x5C3153683BFCF8B0, 0x085177A135CC2059,
+					0x2DCEA47D121AB67E, 0xD1540E17C0BC1374, 0xB6213A504E64E2B1, 0x7B616D08CD873882, 0xC6017E126E461B11, 0x3B1CB5C6A1FB5142, 0x7EB7E87136A8A277, 0xB0A018CE9711F318,
+					0x7805531A3272B9AC, 0x3F1440B62D3F318F, 0x9F0198D91F0371AE, 0xCBC659846AA6488C, 0xF2DB584D971E3D75, 0xC4E5FC99045306D9, 0xB6B3169F3EE7D97C, 0x3EB8FF66778232F0,
+					0xCE71DE62C94C4D4E, 0x9F8B5F212CB0C5C2, 0x22B64AFFFAF2E92A, 0x9236D3904E6DFB33, 0xDCC0FA99AB417E56, 0xD98BA876781D3641, 0xF26D27392B3723A4, 0xD85DEDEDAA08E6E3,
+					0x862769CF0B0EE567, 0x1B2303DB6B11D2DD, 0xE0D4D1B93FCDAE27, 0x6477A8A572EC6234, 0xFE11B676541D84B5, 0x9900AEE5D8B4C1CD, 0xE209126B76BA16A1, 0xAD75DE8F6CF8ACC2,
+					0xE52B75AC1D717110, 0x0EB69E86757E87BE, 0x98D7C04318791FFD, 0x78C8E2FF9B2B858B, 0x81F6E94B61B1D049, 0x6B3D1190AD7B86DB, 0x9D451756577FA9DC, 0x946E9D82AFF5D037,
+					0xABB7228ED2E99B8B, 0x9ABDF57D30A74A32, 0x4E2B5CADB882A7C6, 0x9E5CEE85463AC1A8, 0x31F67CB148EB565B, 0x7DEC326EE7E5D54C, 0xB71A7E98EB4181AB, 0x2BC1A812DE446BD7,
+					0x11CF2A2C2E0712B0, 0xD16614AE307D6D12, 0xCD1AF8F77E77E3C2, 0x4DC622196412F551, 0xB72217CB818F4945, 0xF07ED68D26AAEE10, 0xF89624C06CB4D4B7, 0x2626337EA634456A,
+					0x14B38CFB6973FD3D, 0x0F7554DA65BF6ED5, 0xE35B6860986F2A09, 0x9F1D3BA963BAEBF4, 0x97BFC61100509A6B, 0xD20F1A98C66E5D22, 0xECC81FC5B612D157, 0xFC9650D89370DC40,
+					0x1D889852F516EDD2, 0x8B9B9231D22BF54C, 0xFDB31585FA2F8DC3, 0x84319CA72936B9A9, 0x36E0F494252FEC60, 0x6E30A215BDC11882, 0xE6F8E1B3ADDEC7A9, 0x4BF9A8B398C37133,
+					0x35089CFE4976E9EA, 0xE26FC29D11BBA174, 0x2D6C8447AF05AD16, 0xA7E9A4E976A68788, 0x9BE579D7AA55D309, 0x67CA3057861CA57A, 0x0348C5537A1FBA59, 0xA487B5C3CEB41EAB,
+					0xE6F20CFD924ACFE1, 0x3203386D0EDE4677, 0xB3B25547D21A973F, 0x6C0A4B42328840F3, 0x6B40CE0CA3564709, 0x458BE77BAA0B4353, 0xADCBA531221D798D, 0x4D12465FE04FAD69,
+					0x20808EC585660011, 0x41F9CED7F636DF2D, 0xEA1E995C913F4E4B, 0x947C71E7ECBA8EC0, 0x8554D2DB2A795B01, 0x1597E5B5C5FEEF8C, 0x69CE5B26C8770038, 0x0F540E9AC00BEC2A,
+					0x1BFF43CA1A73AB6D, 0xAE0F11B69B57758E, 0x717B071122768FE2, 0x18C6EE0B581EC4C3, 0x2C2096ADC26BD15E, 0x6959C2FC22BECE47, 0x11B7F7432A25541F, 0x87A0E09CDA259F7A,
+					0x6B6775DAF35A7F5E, 0x9D9B72A4AC4301FD, 0xFCA9250932F5AE93, 0x12150287A93097BA, 0x67B15A455899FD4A, 0x448041C7C59CBF8F, 0x4DE66267F17D14DC, 0x7B7A05EA2A227B07,
+					0xB7B883A0FEC51CE5, 0x3309B298F3094437, 0x50CBDDF34CE890A8, 0x26FB0922EF3A2258, 0x1C261396446F1BE7, 0x7CD2484FC47915D7, 0x73355D5282E71858, 0x9F6D13F0C950B0A1,
+					0xFBD8F474ACF5A58A, 0x94F0DE504F53343F, 0xE47909340EB317DA, 0x3D63ACF27727AEC4, 0x61C75468C1287DFA, 0x0624925FA941DCB8, 0x50723BB3F59A9461, 0x0F382676BD3D21B9,
+					0x4C1961BBBF26841A, 0x62665FE616574D4D, 0x009909976E014D26, 0xD5CF611CCFEAEEBB, 0x4292B6A4741364AF, 0x28409EF261F73960, 0xDB4E6EC93F0C0BA3, 0x9C616F95620861D1,
+					0xE34F4450BF335228, 0x1C077AC90C4DBEA2, 0x46BDBB670206668B, 0xD7C9291E104AA9D2, 0xD74E2D78A75C6A0E, 0x65BCB10BA8CB9BA1, 0x0BCFD631E9687C63, 0x599CDFB8BAC66C44,
+					0xB98302609497E975, 0x72E333EBDEB51579, 0x1CF320E1FA2C939B, 0xB8696671C3DA2602, 0x5F554F990CDCED1A, 0xA6C43B4B0A6BF7EE, 0x878ABFF593B4948A, 0x9B0164AF8263D861,
+					0x01E152CD55FD4126, 0x352E423ACAEFA497, 0xCAAD466C14F54020, 0x5486D2BBB8D88E60, 0x99A00B5C05C0B10C, 0x26C212CAEC7B35E1, 0xFFF3F8E3FF54993F, 0x45D50B8270C76D38,
+					0xCBDD800D9415734F, 0x9C4D27E63C77F1EE, 0x60B48950C3C35D5F, 0x174221061041D6C9, 0x720FA94CFE254B1F, 0x398DBE58A6568460, 0xFF43C61EB3AFEB46, 0x865CEC46ACA3FB5F,
+					0xFADB779C5750235A, 0x7B519F166EA42973, 0x4A774C9F9BAAA0F7, 0x96A28213186E5000, 0x43B48C5A15B3227E, 0xE01D56B521E02561, 0xCFB11A176A7BD3FB, 0xE417C3EFF2896C14,
+					0x1D44CD6DE16E99C5, 0x48955DBEB45215A2, 0x778A9A13F281452C, 0x4142059E5B1DBB31, 0x398990CFF36F4D7E, 0x35B0C9FD8A7D78A2, 0x31BDB4F3F464B468, 0xB7305EB26D901832,
+					0x6AFEC65094354976, 0x5571BB42319BEBF9, 0xEF460B2DEEA662AD, 0x0980C9EE10E1D741, 0xB6ECFCDF27ACF79E, 0xC942DC8D2659B754, 0x10F1DE6B38C69660, 0x661E630D79700977,
+					0x91C615F25DA5537B, 0x51E50EB8585B9D39, 0x7B87B6D3B7EEDED8, 0xC12B65FC3723D1B8, 0x2FB2B6F92E99A2FA, 0x65307FAB0128F0B8, 0x928F154604236A78, 0xB1BF782802329033,
+					0x4691422F9A202C6D, 0xE40A94109082D140, 0xECEBB74B413D0C50, 0x09EDC2CF61C61DB5, 0x2E60F14668F6FB4D, 0x371382A77A936482, 0xDED4DC871F3435FA, 0xABD5719EA19BE5C1,
+					0x7A5252093A3B1956, 0x8F0C6982320C0116, 0x4DC860E8CF076A09, 0x181DCA4C55D0D178, 0x11E66CD943CC5D34, 0x38E05C51BFBF8A23, 0xD30861ED4461F873, 0xFCF4D06AAC9EB937,
+					0x78A4B0F78EB19DD6, 0x6B93C5B3EBC8649F, 0x27EE3779192CF868, 0x4B3EBAF2957E5A17, 0x4053E3FD803405E3, 0xBAB0DC81CC3C0031, 0x19BE16A4D5F9D753, 0x7CB68C90C1A76759,
+					0x85404D91638264E1, 0x9A961D0A07F000A7, 0x360EBDC6F4FE1183, 0x769662F6107DB403, 0xDC400AB253EB7229, 0x8D430AC7AFFD0E7E, 0x52F9B1D729BEAD82, 0xD0E57BFB33A68016,
+					0x623103CCE2668A33, 0x61BA220716FBFE8D, 0x20A0354297BC5249, 0xFAD0FE03F09C494D, 0x67EFC9CA6ED1D67B, 0x6E398AFA8D0DC79C, 0x51E47200D86F8EE1, 0x1770E6A8F9D8311E,
+					0x9E83C7A5078252AB, 0xEEB02A475BC9D565, 0x699F3C72488C1497, 0xD6841594DA1E61AA, 0x4E5EE4CA6342A436, 0xBEAB3D5299818C36, 0x2B1D5116D588A4CA, 0x3390694531BD5B99,
+					0x1D1F402AB33A0D7C, 0x00D1C3888F2DEA06, 0x38C3CF0C127CF8A8, 0xDA082E5AD5E9B484, 0x92A98750C9C87C9E, 0x6CC82681D80684EE, 0x2EA2E6A468442115, 0x2C8BFE47DDE96280,
+					0x708E976D469ABB55, 0x4E9D5FE3C18C488D, 0x76AA9015250CE15E, 0x9E55A6B9964152BA, 0x9B0BF611B1E4FAFC, 0x3B4360806C368482, 0xC40A369FD302B452, 0x24B01CEFAED73D9F,
+					0x0B0A9CDB2A4D90CD, 0x35880A1CAC3D052C, 0xE58BEA7F41F6EE7B, 0x291B675C670F1F74, 0x2845159B274DCD40, 0x4267725D09D530E8, 0xF750D8FBED7DCE78, 0x41A3495B988E1D8B,
+					0x0E78A08DCCBD615E, 0xDDBF6FEF0CAB3A92, 0xF2D8000848A99D79, 0x5E1633E88E3AE820, 0x738D8BBF858D174A, 0x453A4B2184DE142A, 0x9D6B0B0CED29EA9D, 0x850978ED3A3008EF,
+					0x555487893B593C24, 0xE27EEC1D318B5FAB, 0x78560968FF3CC221, 0xB555B979B73A5EE6, 0xA9C26ED7555C3BA3, 0xFFF20DE5014ED810, 0xD520270D3760B6EA, 0xB5ED254D57535F91,
+					0xD485864C9C39256B, 0xEA38D2DD7E33F6E0, 0x1D033F3D93077EC4, 0xCD8F6803C9C9EDFC, 0x4CDD4668017AADC4, 0xCE22E7B27D18F180, 0x00EBB0912AC6C1E7, 0x709986DF21BD9636,
+					0xA1A4B9EAF3C2E564, 0x5B2B23F29A594D98, 0x2F3BA8BB9B65DB44, 0xC911711B4E251009, 0x9C65730F13A248C0, 0x86B0C3DE12AD7E3D, 0x2173BE6C215F8A72, 0xDB24F8C1C066C5B2,
+					0xC1B6D2BC3D7C5939, 0x171F6CC7CBB67207, 0x277441BC5FE2DED3, 0x4B40C101B8BE7A3D, 0x4224C2EFED1BBD65, 0x790FF95A99ACEBD0, 0x76C48B6A55E42B40, 0x913095D4D6593C5E,
+					0x0613AF3DCD8CD5DE, 0x9255390CCC9F9E55, 0x66935F49CE4DACDA, 0xC59136EA7A7EEC0F, 0x2D0D496CD5FD5008, 0x2E7F5762F54115BC, 0x005AAEA8CEA388A7, 0x33E78007A0111A0D,
+					0xA58C0206731E021B, 0xFC747263C66F6A1A, 0xD219DFB5E7A50E58, 0x9ABE9BB3E328BA46, 0x216E67C096C6A499, 0x8C2778978967261D, 0x3E5708109CED3D4F, 0xF0C5D6ED57E35B70,
+					0xE91AA38688B868A7, 0x11D20FAB032B4EA8, 0xE0557175FED6E29C, 0x253399B36B81151A, 0xA6448661A502CB20, 0xE51570D46F94A372, 0xEE95C091DDF3813B, 0x18F65268E374C1E0,
+					0x8FCC766AA7E27D0E, 0xA294029458F5D376, 0xD41763BF63657A49, 0x67F12540B178D162, 0xC42CEED1172B9D3B, 0xB009FFC49AF0C4D8, 0x4C599B47F5EE7037, 0x24D6771815EC93CB,
+					0x5A16400EC8DAAF43, 0x3C14DFE8963BCF4A, 0x26C5092EA2E884D9, 0xC024082DB86FD56D, 0x16DD9585FA88F6F1, 0xC83057D3FD268365, 0x690AED454B3FB5FF, 0xC6269DFE7486F49C,
+					0xBA60E5CD91C8C445, 0x9D7AB9A27C616EDC, 0x99D01E1E7E953325, 0x59551CCC725AAA0A, 0x43E77FEE0960E662, 0x7F2700BA042D2416, 0x4DEB1365B9DE8E43, 0xE7DF66F56BFA68FD,
+					0xD8C180B9F8613C5C, 0x0A5EAD50A60922E1, 0xC2C3DCED27E88F3A, 0x4DD51010577CE700, 0x9894AA772070D69C, 0x1FF4BC7BC8D92393, 0x472DA8819F202A75, 0x03096E12DA3DE1E4,
+					0xA6D7BFD8655290BA, 0xF0D5F645016CE1A6, 0x19AADC0591ED8DC1, 0xA42AA41E656EA861, 0x55E2A3D3052DFB77, 0xC222604260746539, 0xA98BDF818CA7CF0F, 0xB483E7A2790BC942,
+					0xACFD957113297E39, 0x9EB541CD80176250, 0xF47CD3C98AEC3E34, 0x4AB0FF18F247C188, 0x514B35E0D2E65CB3, 0xB9E2A1B5454B24E8, 0xEE2FC29670515E13, 0x7F39CAA2EFCA9CEB,
+					0x016030FE644272DD, 0xF3EB234C4C852101, 0x9A2110FC5146E8BC, 0x5C88D6C4EFEE10A5, 0x1E3FB91684C0F3A6, 0x7FB31323617B0D1C, 0x092688B410089D73, 0xD962CE807B2A7415,
+					0x261841F8616099B8, 0xE78F280799993B2C, 0x0F7431E460908B76, 0xC4B858C2569C31C1, 0x239EF1FF41FC1A98, 0x8C2206BF261CC70C, 0xE8845AE932E21079, 0x5E33CBB6BBDAE2F8,
+					0xE1EE55AE800D3D2E, 0xAE345BE4F28D6A9D, 0x24335287A727DD1F, 0x61DA112F531628CD, 0xCC8D90354AF843FF, 0xE94CB6CB4322904E, 0x748CE00E53805BF7, 0x182021D69CD8A5F4,
+					0x2BD0B5160548D8BE, 0x2D092AEABFF7DA33, 0xAE687F43AC11CC53, 0xA9B5302AE50EA7D7, 0xC7E4B3345727064B, 0x40CC83E13DA2E675, 0xF5D1FBEDDAB7A30B, 0xA281BD993E67896A,
+					0x2293ADC9957A76E4, 0xB24C0756B06B9CDF, 0x227A454B56BE805A, 0x7DFD3D432EF480E2, 0xAC9C96B5FA9AD26B, 0xAE07F64468ECF3C9, 0x6075ABA5EBC7FB60, 0xBCA542B23586B2D1,
+					0xC022C641AFDFA373, 0x9B3866D9E093B8BB, 0x1EC75115C4022180, 0x6A973CE6C86A5507, 0xC02F9C3C7FE912E0, 0x4C094B7BF80819BB, 0xCA0B95D8F44DF653, 0x7BD3D05A31AC2389,
+					0x43E8A61518A9A2B6, 0x9FFA7342F207E3DD, 0xA69E3EEC9E061D80, 0xC5560C6E4E3195D7, 0x3CA4AEF057DC31DD, 0x557BCF7613C441B4, 0x5A6DA19C2A6325DC, 0x80B4123334F85E1F,
+					0x618D737EA73681C3, 0x83EE873330C02AEA, 0xE59D89247AFF38EB, 0xBCEE9B01D8A6D85B, 0x7FC34456CCAF0749, 0x867097AB2C122FAF, 0xB4D08C823DBC6BE1, 0x1E06C777FF43B941,
+					0xA3F70C43BAE1D021, 0xF8AEF28771D39902, 0xCF5F155B969FA326, 0x0FFC5D46D8EC8DB3, 0xE86BE8FC6F847722, 0xF3BE5D905C71E27D, 0x323C69FDB9460E0C, 0xECEC816AA898891E,
+					0xAD0A90FB40B6A096, 0xC6A7E99DDB2A5F71, 0x6DFF2EFD2CF2A112, 0x5244053A1CE23935, 0x7D3C2F23C72F22BF, 0xF18901A77D5F3A7E, 0x8A5503E1BC422D7E, 0x905D875896BA66F9,
+					0x11AC2FEF268DE08F, 0x68E3B1963E076421, 0x7A84E3FBAC348EE8, 0xD16D0570CF10BDB0, 0xE892F417B5551CF6, 0x0281B1592874CEB3, 0x1D70CB84381FACDB, 0xF276543E8D945794,
+					0x2E108B7C34A7CC48, 0x4388DE16E7C1C9D9, 0x88544D8E5821FFF3, 0x84BEDAE757AB991B, 0x2C199683F8B5789A, 0xB2E8366348A66BFE, 0xD48E7F561EA414FB, 0x2866C7483E3EA5D8,
+					0x41B655704D5C6B1C, 0xD8DC27A7BDC337EA, 0xFD0B6392369906C3, 0x4575B6F060FE4385, 0x58E72862515A1EAF, 0xA85A7C416D2CC1AF, 0x1F26169DE3BE379A, 0x422C9CA9DC09CD96,
+					0x2A36915210E3DFBA, 0x516ED55AA615F0FD, 0x2C2DBF231A508F6F, 0x1B21DE60B09C718A, 0xA6E561527D0EB7CD, 0x00295BB6235C2BC1, 0xE92362B4CC9C0901, 0x7421CB8AFD81C30E,
+					0x3C2CC97DDDD08D1F, 0x206688829FFBF4AC, 0x21A81080A978EFD8, 0xDD8B337C014910BA, 0x804E6C5884797209, 0xE45F295FF0459558, 0x95C68A16CB42D1B6, 0x6BCD91E26B335376,
+					0xC28BDAC14FB6B7FD, 0x690DA55C2301B9AA, 0xEEDDCEFA4FCF001A, 0x64AEE51FBF8A60A8, 0x37CFBE7954AA42BB, 0xD6559CE83DCBF2E8, 0xF52E11E5C5880368, 0xFCF18BB8DDC335A2,
+					0xA5EEEA10BA059CEE, 0x652967BE56475BDA, 0x40E188573EC23FF6, 0x5C276D94F57F54B7, 0xAE31938885E0253C, 0x61A093900B016862, 0xEA191B56E10F0139, 0xF9166BDF95CFBF00,
+					0xA20FF61108F99A32, 0x7B32F99E7E0E7911, 0x98849676EF4F2144, 0x2024EE8C8B03F453, 0x2BCE2DD23DC71FDC, 0x629CD8C41E059E58, 0x47D3B64951B34481, 0x3197378E391A284E,
+					0xBA7CF970D075C4AD, 0xDD64624ACC2AD1E5, 0xBEB5C557939223C2, 0x2588E71F88E0CCAA, 0x594EAD3D03E0E1E9, 0x5C3D1181345388E7, 0xBB7A471AA62CB53E, 0x94A245AB78E7AF3F,
+					0x1A3927399F41D5D6, 0x6609F44AFC8C86B5, 0x6291A304B443C2B6, 0x38B076F0733C0067, 0x80A3363BB31F2A27, 0x8A5662CCE6228703, 0x88CE1D585541561F, 0xB5A0262675D3749A,
+					0x1483026B7CCA67D2, 0xBA441FEA098DCB7F, 0x0BC4D967BF4836B1, 0xB12DCAFDCE25C379, 0x3C0F70C7E9AE4621, 0xC74AE4D089BBD5B4, 0xB7C24E13CF40ECB1, 0x82D3C21708F04B97,
+					0x9808D76E966096F0, 0x88CB525573A839D5, 0x1B234F88DCBFF37C, 0xA851BCCAB7461287, 0xC7D857B994DCC062, 0x3D41FA86AF22A085, 0x35ACC7AEE760B66E, 0x7BF1B8DFFF762B28,
+					0xB190E8852104C8AE, 0x91493EDA899743CA, 0x382D42B2FABB94EA, 0x35FD724A3A90F0B1, 0xB92FC49D955AAC5D, 0xA107251C5897499B, 0x5D87366E1B13AC58, 0x7F04FA3CD8BB3A18,
+					0x415797C84EC0257D, 0x3106A02F6965468B, 0x6175D4ED48B107D1, 0x7FFB277D319AABA6, 0x814304A3C8F77B6C, 0x6DABDBBD6DD1438B, 0x44A4105B966E1035, 0x69228C212A129AF7,
+					0xD9F2AA62C295380F, 0xE25E555C5D9DC50D, 0x7D75C5A694F9B7F1, 0xBD385D9F80C46D8C, 0x15F342DE0FAF108E, 0x085902923A24634A, 0x1775A88A93601F35, 0x5C2D8F85434EE1BA,
+					0x67FE1096FD001DC2, 0xEBA8377FB3F512E7, 0xA258F744EA89F81D, 0x01A1AB1AFC74DDC0, 0x3A827A5707C41028, 0x01653CB3FCA8A9C6, 0x0B33149DE796CB02, 0xBA5FA1A66632BDF5,
+					0x2EAD442F0C03EB5D, 0x293F601EDD8A85A8, 0xA66B33025E49CC59, 0xDBA3F64F6D8D3466, 0xA9952EEC2647B393, 0x8CBAFFA795ACDFF4, 0xE90ADE3AF5F5D6D0, 0xDBF104FA72C6BFD5,
+					0x6C8D2758CD991C98, 0x20C46167E1E8D344, 0x99CEEAD8D4B9EF2F, 0x4E58ED73CB71AB28, 0xF7ED4ECC01EB6C2A, 0x59129C5D0A1B333D, 0xAD15A23748BE8C03, 0x8FD615B4282B3D0D,
+					0x400054E842427BEF, 0xFEAD3324C5C2044B, 0x08BD70C19353030C, 0x42460ECF41EE4CAF, 0xFE9997D60B0EF92A, 0x4487C6972FBC7BA4, 0xEF38EB730426000C, 0x680046E110713CBD,
+					0x4389C993733F6EEA, 0xB69C6008F2726C62, 0xB64D4181FDF89E0F, 0xA67C5B2FFD8C6E9B, 0x22AF030E5B919AD8, 0x83E53DE0A19D6010, 0x6B718233E39BA1F6, 0x5E112C9104E6CB48,
+					0x4A6D465B052737A6, 0x79EEAF82646A441E, 0x45866E91C305DF75, 0xCAFB81530D7C4583, 0x0ABA78C0D58CA36E, 0x7F682DC0EC68EEEE, 0xA5F8FAE78F95CADB, 0xB26E4DB58F9797AC,
+					0x9A1BC8477ABD7D56, 0x9F96AB55E6A5B6DC, 0x1A4CDB3B88A6B24D, 0xA41A7ABE946BB115, 0x1A5A26CF45597C05, 0xBD9FEE22DD78DE6D, 0x5979F26926973551, 0xA6C4A24E9974AC6A,
+					0xAB40607A46595CBD, 0x0D5610700319B84F, 0x59F24223F6AB0922, 0x2410A72E6DDB0FE3, 0x74D3BEC7E9C8FC18, 0x8B9129C46BDC9BFE, 0x0D8FE0D1EEEA5F21, 0x2AE69CA060FACB5D,
+					0x44F7E9715F01EDDD, 0x148E3175F3B277F9, 0x2CBAB4BFA4A9D352, 0xD591F5A99A55DDCE, 0x2DCB273B0FB68840, 0xA02C3E0E46C882C7, 0xA822F6E11A55D7D7, 0x17A4ED4253F6891D,
+					0x8133529A0421A541, 0xF80C693A7848047A, 0x2AFBAC354CB71D8B, 0xE242312752F283D3, 0x75D36829DE1C88CC, 0x71D83DB080E31ECE, 0x7AA57E101C831B5D, 0xCD755CB12FA78BEC,
+					0xB91CE02BEBA4E595, 0xE70691D125AE1950, 0xFB500A5F12723E61, 0xF435599E88BB0835, 0x9BE7B441936B50AE, 0x0561218645C0E83A, 0xA9A2F3282B4CC6AE, 0x5E2BB5EEF8A30C8E,
+					0x8AA090224F3A397E, 0x37F01FAF452E25B7, 0xE4BEF7002DFEF9BA, 0x87F1E0CE30FE3D68, 0xB2CD769DBC40C3A8, 0xDAD339D82C4A131D, 0x7CD1E6A0ED8FB374, 0x66138DEF8FAD871F,
+					0xEC5C1786AFF45A99, 0x2C715A8E8764D964, 0xBAEAA3401A760879, 0x90874D7842D282B2, 0xC4EEA68206DA6AF4, 0x96031D597CCC37D4, 0x13AC387F3BD311B2, 0xA7F7F6709749C124,
+					0x1565DB7FB9D9FA8E, 0x61B96ED8EB17EF63, 0x3B936C1F983580A1, 0x652EC45B156EAFB4, 0x8DF7794C0B71F505, 0x1179DC37F49DEDC4, 0xF9A2DE98609D3384, 0xA4B8EE4381397C64,
+					0x22DECED70BF32FC5, 0xC633E69CC9915C08, 0xE99C02304C40745C, 0x8AF05EBC6C83A318, 0xD69DDEA8E4D01158, 0xF9F19F35BB477C39, 0x651D4B111C15777F, 0x520E15F09653E9F8,
+					0x55E82C866CEDC74E, 0xEF9C9DAD002B0683, 0x2DA48A84FE526FC8, 0x4205529B5586B4AF, 0x83ACE99DC277489C, 0x7CB202B15F8CF22A, 0x2B7BC87D33B32FEE, 0xE429E7856124CD26,
+					0x0A0C1D852240ABF6, 0xA02D3D71256B4731, 0x7A19CE48A0D67352, 0xAC29E954C0D03384, 0x7A63903C31FA503C, 0xBF7625CD76E33C88, 0x43C0AD2AF0EADA46, 0x9DF190B9F2CD0B6A,
+					0x18E0A81FED6C4FF4, 0x567CC3EF6265BC81, 0x16BB117C9847E183, 0x7B90C26E6F25A097, 0x3AA074431ADC66F9, 0x3379B4C510CA8A2E, 0x025AB72F855EDD46, 0x08C68F14DC61B372,
+					0x179201092C339C44, 0xE9EE783CB0C61998, 0xAEF819EE20F2CF2B, 0x324E6B9A7D047272, 0xBFF086A858372224, 0x61383A043B753AB1, 0x32843DAD52AAD92C, 0xCDD20BD39F5E9951,
+					0xAA2DB5FD169587DE, 0x6EFDCBDAA961ACA1, 0x9AED72351890C85C, 0x1868130D88416A86, 0x2706A955CE4F1D15, 0x366DB7C1C00A99D7, 0x83395A5A6ABFE2FE, 0xCECE31CB26114E54,
+					0x9EADEEDEC992E274, 0x56FE0DD096BA763B, 0x1A1DE7C0D131426E, 0x357C3C49F318F8ED, 0xF92DD95AA0267BB3, 0x4CA51FE6CCBE7754, 0xF01A92F134FC70C0, 0x61BCD1DF34537C49,
+					0x97D9EA414894310E, 0xD1CD3BD5ED7E4242, 0x9D263F8CFDAFB95A, 0xA9D9BF6E7148CC15, 0xF9B2BCC96B05DC0C, 0x064B3359EF1BC76B, 0x57A391FF3211D199, 0x19F2B9A08978B0E1,
+					0x2EAE7E460E353081, 0x667200B8F1032118, 0xC882D3A712133E4A, 0xEEEC9F20C6C758E8, 0x5787817FCC27FCE2, 0xF0E2C0F4C4C3E8A0, 0x6CE70181D5660F67, 0x2D4B05BCF8C979C0,
+					0x92ACB15DC81E4389, 0xD99A62D0E7024BCC, 0x53D6D17CD67E5265, 0xB2D6E3BE904E9453, 0x3C238A6336F78247, 0x9D4313FAE7958C3F, 0xEFD85FD2B6FB4916, 0xE0B06D21A955E30D,
+					0xC6F80D7CF0F52460, 0x54A282B1378001A5, 0xC2704A2BE321D3E7, 0x081924DABBC44864, 0x60982F9589B054B4, 0xC76557E7D56D933D, 0xA023A0A89E36C7B3, 0x0C3FE140CD1D51F6,
+					0x4BBA99F1E208F562, 0x53DF1C01B098119C, 0xDFE3C058C9187007, 0x53DCFC485EDDB76A, 0x0EDC1A6247E5757F, 0xD84B6852F7D702D3, 0x99BCBBB259421B9A, 0x042833867B7B5177,
+					0x92BF0C1C56F2524B, 0x757652CE597B9E11, 0x96FA1D215CFD3B89, 0xE08430382A31BB96, 0x14CDB333E3C6DF99, 0x38785926BD121921, 0xE01EE36552997BC2, 0x7051D38567E1629C,
+					0xF1804E518F0D2FCD, 0xB93ED2B23B0DAAA1, 0xF6B2C96C36C37E81, 0xE7FBDBAA8B3B5420, 0x5C759CE38D1F8C24, 0x0D64EA7638BC1D0D, 0x00B6BCE936CFE076, 0x106F8853E61C17C2,
+					0xBF9FE2ECAB29939C, 0xD9A4F711C9045F54, 0x00783E64F8E2946B, 0x678B138E173675FD, 0xF8BF70BE2F4B6CF7, 0x5AF052CD725C3310, 0x9144431A9AD5B810, 0x7B11176DD26B18F0,
+					0x429CF8AD2F737343, 0x136872E79646011B, 0xFAA19717138CA3FA, 0x73780ECB7413F5C8, 0xB6D2268CE5CC7692, 0x8772BEBB31C17864, 0x59699BB63B2DCD8D, 0x3708AA52AF913685,
+					0x6CDD588FF7A1942C, 0x74F8FAFD273178DF, 0x366E9E9A0CB120D7, 0xC3FD8CB561B2DEFB, 0x618D67D9350AEB2A, 0xE95F4D2385718A83, 0x9345D1560FE591A4, 0x1E33E3C45F299CE4,
+					0x6F09B71EC40E6DC8, 0x933BFB87D3D0E253, 0x8FB044E20042F569, 0x98FAD2B7750EAB62, 0x9679778D0AC121A8, 0xA5A46E883CB18CE0, 0x6712448B1252A6D0, 0xA4D68AE955B0C6C5,
+					0x3FE9AB8ECE3B0107, 0x437ABAD59813DE55, 0xA3DE3661B96D58D3, 0xE25841A2346A69C3, 0x92AEC8C7C570580F, 0x71387780A84952DD, 0x7C3693C359BF3422, 0x980117783CA66604,
+					0x8E70B9AFC8B757EC, 0xD29734A30098988E, 0x48A683B453BC6E3C, 0x098E02B283AFE0AF, 0x05487D459763C741, 0xC5D7E782E0C23C97, 0x66B3BD3032D34D70, 0x9A65DC481EB3660C,
+					0x802FCD5BB8511011, 0x043CFEED77B9EC41, 0x5F14B526EB3F278B, 0x13FF2B42876CE172, 0x05BC78A10C1DA3E2, 0xE82C570C57FA409F, 0xC630A48811157C51, 0x2E847F4F0E919452,
+					0x0DE99C69E1A09B72, 0xFF57E35869D3F738, 0xE87CFEF3213448E3, 0x8E83A0454AA8E257, 0x576F1744F42CAF1C, 0xAC1E7284853FD145, 0xE51A1BFA62D792C0, 0xF3873293494DEBC9,
+					0x8ADF3AE6EAE8E5B2, 0x2AA721D45F31D916, 0xA627DF8734AB25B7, 0x07C0775C2ACDE59C, 0x554B5C0ED1B6D5C7, 0x434F6B6BEBCD10CA, 0xE3C60F0D7BA3F854, 0x5F8E56174B6EF9A4,
+					0xBDF9D666D5FF53B6, 0xFBBF5AA1A5C14850, 0xB301258BB97FBD53, 0x17BA55CE1CAFAF03, 0xD0D250995336E8C5, 0x18FA5ED2810207D9, 0x78C309DE56290348, 0x0DF85FF39D3F6242,
+					0x77627B6BFF036C8F, 0x1BBE0DEE33C91B40, 0xE58E3DC5FCCCA2A0, 0x9AB3B770742BE902, 0x0C856A36C906A8BF, 0x8919356E43D84F64, 0x12F192442EBC801E, 0x44385E9C063C6DFE,
+					0x73A1B55119C0E9C0, 0x1D5D38F81C4CA854, 0x467F8378AC08B19A, 0x6A8BA0943828A0DE, 0x240EAE5EC1D9AF79, 0x04B954F6D1F611E6, 0xE691214CC8543BD3, 0x27C3A3033CEC51B1,
+					0x1DE40708F1F2BC3E, 0xBA1C5C51C59C551A, 0xA1B275B3F350108B, 0xD667B144430F55FA, 0xEEA2BF3B842B0DE2, 0x94303E5EF852BF1C, 0xFA80DABAF1F38E5D, 0x3552CAB50EC71BD8,
+					0x6C54890CD0FED01E, 0x8EBCB37528CA3E5E, 0xE32354BA5D6FB667, 0xA27C759019997D44, 0x6384D42C6A96555D, 0x5911AB30912E4180, 0x49449BF97391E312, 0x8CA10908DFB755D8,
+					0x26F51495A8AC5D62, 0x55EAE5BFC47D13AF, 0xD05E086AD70A32E5, 0x2F84034B089B62F2, 0x4D469562D9D9FC9F, 0x4F8029735A73750C, 0xDF594F27BD5EE627, 0x93A5662DC5DDFFC0,
+					0x3A62A3E7CF97B101, 0x8E7342A9317E40D7, 0x04557079164D7BAB, 0x8CB90B218009DFF5, 0xA65419CA9C34C0EF, 0xF6DE24088E2EC23A, 0xC20F7B90DE015E0D, 0xE72563DDA2B2C196,
+					0x2B14EB7A859DD5C4, 0x9FC74C88E402FE9F, 0xF1F111D99AD5819F, 0x1A1EDC141C61AEC2, 0x9C055093918B93F8, 0x3E09E00DDCEA25C8, 0x5B4D75FB5268E7AE, 0x7E5529BAABBFF95B,
+					0x0CE58A52242E7DAE, 0xB0F95F64A8DEE16F, 0xF02ABF533E289434, 0x4DF2FFD68FDAB1CB, 0x865012DB444B7699, 0x3B81D8953A7FF3D0, 0x414CDFAF5B087499, 0xF3FDB77A01F7794E,
+					0xD0E33707D6DBF1AC, 0x393AD94A8724A332, 0x3CBF8F6F74ABEB90, 0x7629D3AE3A32FAAB, 0x31D79EED2564EB57, 0x5B885A788CD67D19, 0x533BB2A5E125BB8E, 0xCC3AD96BD5F53CD8,
+					0x7E784A7AA3819DAB, 0x9B054F9C06377D9A, 0x4BCC421110801C0D, 0x55E08483EDC14164, 0xB454B4D9F775C1B4, 0xD324CF5D0F876428, 0x52E5429769D6577C, 0x363D6B813DEE4D21,
+					0xFFB541820A948860, 0x6277689CDBEAE9A3, 0x7DB06E0F2FBE4D03, 0x2BC9F9C25A98A3F1, 0x36CFFBE16A9EED59, 0xA7A922E89D027713, 0xFCB918FE676606C4, 0x179AA61D6746545D,
+					0xCACFA8716DDF928C, 0x979D9F6077F7B920, 0xF56B9B94482AACB8, 0x24E2BDBC63ED7F33, 0x0C5258DDE18A2C7D, 0x1979CD72EC432652, 0xDA1FAF5413FB6B12, 0xB21179D658ED1F62,
+					0x6937368F42FB7E46, 0x0E2E4D5194119E45, 0x1B35EBD048D56363, 0x91C6DD5C371CF20D, 0xECCCA2312B80CCA4, 0x5FB3983BAA1113BC, 0xBF180C11FF37DBCA, 0xB4D8D7DCF8D50DEE,
+					0xD10DE03D042CD73B, 0xEB2CAAB36749ECC9, 0x6075BAE2F5D966F4, 0x0E4599199F22177C, 0xB1FA57FEDE4DDBA8, 0x5281A9CE8C26B646, 0x9079FA158225A525, 0x1B686B76DBC7C04D,
+					0xFF58605CD398E9DF, 0x114FBCC9A4866804, 0x016DC5688CCB9023, 0x5EFAE5EB8EB94493, 0x233B27D7A56A852D, 0x2505176B437CAF55, 0x6CD7354CF1D9C7A6, 0x932DF14820C6F22F,
+					0xCBB8126B7981F577, 0xD92D22AEEF4F2905, 0x3D89D23EACADAEB8, 0x695997D9EDE19A03, 0x155F49940B9AED76, 0xA5EF02AD3B5DC038, 0x2C13E95C15AA6519, 0x178562211F2AB356,
+					0xD09736FAE72DD0F1, 0x5559EAA87831EC08, 0xD1A42324B4A575D0, 0x25BFFA60EF9C9CEF, 0x04D50B95FAD190E4, 0xC070A1164F719B30, 0x94D1D5D6C0B7FE73, 0x111A0F40256D9831,
+					0x10C38F8C9F1EB16A, 0xCEB61E1C24142957, 0x7CC6CC46F05613AC, 0xB54E2B5E5AA9F20D, 0xB6BE296173AE14BD, 0x8BFAA9D0D2FAA97F, 0x5D3CF6C05A59296B, 0xD2B895013C58261D,
+					0x7412404491E9609F, 0xD04F71B39495DC55, 0x71ED82C9C8CC03A7, 0x073FCE8DA35B08EF, 0x0CAACF3D2A4048CC, 0x5B59872E9E614DAA, 0xDDC9EEDD519FADF8, 0x7C715963FE8BF3D4,
+					0x0A80A37EB53A0288, 0xD1B6493F1B42FE75, 0x765E7FCB4EFEAD4A, 0x71C1A3CC540897F9, 0x56AD3AC512B2D00D, 0xA415266C48083A7F, 0x799953E1ADEED86C, 0x9A6BDD5820065962,
+					0xAC592F3AFEA53A1F, 0xE32AE879C58FB237, 0x5C50A9CA39003305, 0x3D1CC25D26AA4E20, 0x072AD6386B6C0798, 0xBC3673408BA63A68, 0x8993A091A84FE9F3, 0x9415D98E653B967D,
+					0x49103628B0993B90, 0x35ACC663F2BE31E6, 0x1F6F7CDD1DA02CAA, 0xA505337E815F6CD0, 0x5A45FDEEDA352572, 0x68C0569D241B6280, 0xB7AA40D5B9501B1D, 0x2BD4F426573D37D9,
+					0x32E5B4AB96349254, 0x07DF5BD716F398FA, 0x87B8F5C85647E13F, 0xDBB47ADB4BF449FF, 0x3F7359B34CA5FADF, 0x613D084EA7510A83, 0x492A490A9BD022DB, 0x207FB20CBDEC32F6,
+					0x152D009D230CA6C7, 0x40B993AC41CA90CA, 0x20DC338D690C3787, 0xB3BF7C2B1F6773D2, 0xD0D2BA36B4E13200, 0x5C11B7E6B058A292, 0x1C7FF4851E6A3E05, 0x14A014372A17DC76,
+					0xEF4FADB917F337CA, 0x660A405F48278E92, 0x8B3D57951D562E9E, 0x67FB2F141731017F, 0x65188171287EE711, 0xA5723C01C2401253, 0xFF74A52FDD898F86, 0xDE5174AC1C6D91E1,
+					0x95F6C7FC41D81BCB, 0xA0DFE8B81B617409, 0x2E751BCEA43FF4AB, 0xE881FC17EE111BC2, 0xB851119569067960, 0x7E9917FFDD999AF1, 0x8A03B16BF432E29E, 0xE15B443863BCB6CA,
+					0x6262727056B3C21C, 0x09A2C2D6E343A6F0, 0x6C41A1337AB25FD1, 0xD51D3384C8BEA0D1, 0x4BF0D5BF44725232, 0x50E0A0189F778561, 0x4E7192F81ACC6ED5, 0x0ED57C80546E5A35,
+					0x3859D059CE7DAE20, 0x441C472B40EB87DC, 0x416280AFDEF5AF44, 0x1D24E09E3847D962, 0x491CE94807FD90F6, 0x1BC6FFBEE7256742, 0xC66F6568FCB7F8BD, 0x41FA4635E20A6079,
+					0x54E68CC641EFBECB, 0x0DBD546801BAA288, 0x1F16AD77D24655C2, 0x3317687B2DF5D098, 0x4F4468320C273612, 0x7541919D04147720, 0x0A5EB0DD862295E1, 0xC24BEE1B2D7D7731,
+					0x7D6E8F8D0BEBDCAE, 0xA0FDC0361CB17C81, 0xE725686042BD9318, 0x44392E97607A30C0, 0x309B53718C96A90C, 0x2C353289097822D6, 0x692D8FCF6C50ECEA, 0x6A384F1E537C5E60,
+					0x79BD18ADA74FA338, 0x30CB020653F0CABB, 0x9D4C70F470592471, 0x3A03B631ECE162C5, 0x7D96632ABB8F677F, 0x8E0EAF0E9A650C5C, 0x9D669B1C5B1A0E01, 0x770D2DB4F8863319,
+					0x60E31B7D5E78E92B, 0x23FA8A956FEAEE01, 0xF7531838B767F4A0, 0x7E1513924864CBEE, 0x86B3A250B49CF8A8, 0x33A218D01D219A54, 0x52784FE581AB050A, 0x7FA7231B750FF108,
+					0x90AE09B250F250F8, 0xBC34934AE26198C5, 0x44E7EE6E76B7C3F5, 0xA3D31CF54EE16471, 0xC5F47794F046BE7B, 0xE6D824A8DD60AEA1, 0xDD4D3EE5126B002E, 0x6BCC085330F9F877,
+					0x09F636B12FD47E79, 0x94D81313A7D7885E, 0x0C0D16EC7DC72A2C, 0x9DC7DC505F959DBE, 0x86F1903634C21054, 0x826006396F1B53FC, 0x021F3C51E8FB6FA8, 0x25BA8F943EF0242C,
+					0x1C4A1316C9F49053, 0x1F6962EFA86D912A, 0xCA22A11165228D5C, 0x45C562B82531EA8B, 0xA69C321B8BC264C1, 0x23FD53F138CA34B6, 0xFDC52CA76FAC5D3E, 0xB8CC16A165A0A863,
+					0x8DE50556D865BFFD, 0x4D54DEBC8D455A7A, 0xB1C7B8A155867DC1, 0xCC41DF8935727A19, 0xAB96812236C14F9A, 0xF3E4DFAD03845F2A, 0xF5AE8F67ED6989C4, 0x792DC4016A428315,
+					0xE7F49CE5D4398CFF, 0x444593BA9CAD1845, 0xCCC9F929FCA19C5D, 0x509B26DD807E986F, 0x007AB76B91A41197, 0x0DFB62535FF39116, 0x7104F8A9B55F84A8, 0x7850E1B2430702B2,
+					0xD8F998EF3DA5F1C4, 0x096D42991A899A27, 0xA765676606A8966E, 0x2568B626597D031E, 0xF23651A488C44207, 0xBF4425F5D5469748, 0xA9C97D615D87CB0D, 0xA2F05437761922FC,
+					0xD1B9FBAFA5F2E76A, 0xD3F26FD9323B32E6, 0xE37FD9DD5E27E4CA, 0x669487F06C166A22, 0x862A7C7A69D473D5, 0x7D6833B897B25C13, 0x6F48D4432578ACD3, 0xD47B9215F928054E,
+					0x9D62BB9C116AA5F5, 0x77DE17A3677CF416, 0xC59D17FE99D7D4C9, 0xD3E8637F18E8B6E8, 0xF7FD0F5B865EE06D, 0x98B49EF778589C9C, 0x4E73F023FEF12B6D, 0x3942E1BC96CA4E3B,
+					0x4D76E7D7AEB3096F, 0xFD4F108CD9A3D357, 0xBF17FFCA89266FB1, 0xAA16B986B1C94078, 0xAA07CFFACCB1FBA0, 0x92E5C77DEB2D61E8, 0xFCDA376B0132E61B, 0xCFB97AD6723BF091,
+					0x8E2E1BEC8B251C9C, 0xFB6263D02A86EE4D, 0x1FF759F4FD5E9E39, 0x1D1BA875F892C527, 0x3AE11C0951A3CBFA, 0xAB145B5FD9C4F611, 0xB8E9761B1F4909F8, 0xBE389525133CF430,
+					0x7925BD5E58FCAE36, 0xBCD967162BC472F6, 0xCB926D78FD6ED812, 0x390A84A62CE4C53F, 0x39547146F8244AEB, 0x378C205773F3AE64, 0xD44C34C8114FEE65, 0xC39A79DE41BE1E58,
+					0x807B4F8B15AADC57, 0x28A7EA7F444A5091, 0x805CD2ABB307CACE, 0x4943143ED82EF416, 0xD9F3CE2270652D8F, 0x79D1FAC4D5F82A23, 0xF27A959E38736ECB, 0x434A582CBB5EF8EC,
+					0xC723D03E4704E62C, 0x9B7965BEC363B711, 0xC7B0192048C7436F, 0xF435FD949C375502, 0xC77BCAB775F3106A, 0x43238C7E3CB1D1F3, 0x1F0E0D57095B8342, 0x64D39CF3A3F7A67D,
+					0xBCB810C693DDF910, 0x94B131C9EA5107A0, 0x1C5D7AEA4AF414CF, 0x7B31CF46CD7B2FFD, 0x87074D6BCF6ED36C, 0xF89CE9276FA91877, 0x1CCB5D34B70DDEE6, 0xFFDAD7E77184DA45,
+					0x2B463A459167FFC6, 0x6D48A0D66AF5F6E6, 0xBEF314B984BBBEC8, 0x40E71F98257AA8E3, 0x4FC90E9A32FE8306, 0x7505394CA18E5900, 0x6998D7F4BC68EB26, 0x4AFFE983757C5FD4,
+					0x0D7B64EB254D4DF3, 0xCC0495FCFD3A41BD, 0x0D94EDF661C3370A, 0x0235D1FFE1640EBA, 0x2A12E3E176CBD33E, 0xC7996464930088CE, 0xC3FB5685A4559D4F, 0x88C790F8D461180A,
+					0xF33E0BE0DFEA9AAA, 0xFC6CDBE243A01488, 0xF0C74A90ACA7D20E, 0x5969B4078881CEA8, 0xB0DE0AE609A0A863, 0x80FBDCBCCDAE8567, 0xBE9D7B5047D00954, 0xC93249F6B022FC4E,
+					0x5C00FD7FB3A4BD14, 0x4BC1324AD6DFD0AD, 0xCABB329FEA0F1B9B, 0xE19D2766C94046AF, 0xFA10963ECD61E12B, 0x5B2FB24F53152C94, 0xE272DC834882B0BC, 0xEA3D92E064C8F867,
+					0xE5893DBE3431B4F8, 0x0470391D2E8084B2, 0xA2EC5D67F7B6C255, 0x01C3DDD34E04070D, 0xDF4BAF14D3F38C83, 0x722B680D63ACAAE9, 0x56CB82A054D8DCA1, 0xE382038BFAFFC16A,
+					0xFBBD3DEA71305B17, 0xCAE0C0FF28A581AC, 0x339371A96E722249, 0xFA856BBC16D42C80, 0xA91406CD8198701C, 0xBEFA4901038FF983, 0x74CD647B76C09954, 0xE020B26AC3BE72C9,
+					0xB40725E128DA7F2C, 0x7BFC294E0D93B4CA, 0x18A60F86410CD321, 0xEE1959825CC03ACD, 0xF2A8E838768041DB, 0x923FF34FFFA95497, 0xD4A9C366894C62AB, 0x814B9E7B06A1E90C,
+					0x212459E7B53C6B2B, 0x7A0BEDAE5B31C603, 0xBD1EBA52978D128B, 0x22BA72C586018DA2, 0x58A32B98FB261560, 0x75889DC0AF247E7B, 0x93C63A8959DA24E5, 0xB8648982E139F179,
+					0xE498D0C84826D363, 0xEF08334AF75EC20E, 0xC851BAE6ACEDF858, 0x93C14A8008D85079, 0x1811997CA0C89716, 0x16B57756BC22D0B3, 0x1E03943D48623F84, 0x15E037F6E935BF81,
+					0xE00C6C0E32B92D5F, 0x6696710263C6BCE9, 0x6B427E716BA3082C, 0x5E81ED64E8F2660E, 0x2E2E9F6F1DEF72C3, 0x1F668C5AA9B7778F, 0x24A558335DE45FAC, 0xA5527A4D8035B7CE,
+					0xB3DCBD156E11B691, 0xF6A010AE14D0C48B, 0x7247A75A20F6D33F, 0xB4B609F3944AE729, 0x89B41819283D9F91, 0x59541D79050E2730, 0x20CB993BF78FE26D, 0x8273FC156E5C3693,
+					0x208E7A163F6F21E8, 0x31607C912448CF42, 0x435579ADB3E98362, 0x2D2119C9814430CF, 0x40FDFE74271813E6, 0xA0F593A008D57E77, 0x8039350554144E93, 0x24126040EAC2F89D,
+					0x47F0088730643084, 0x81F33A2B9EAA8373, 0xEA1F733523B5D36F, 0x64EE908DDB9D5124, 0x6A4CA3C75C186782, 0xA5FECAADB486DCBD, 0x91F1726957A8FFA4, 0xF3F5FA4FEB570ED7,
+					0x7A06D74DF0C40923, 0x714120B6B649EFA3, 0x53880771A550FFCF, 0x6ECECF887E4E455C, 0x9465A2E62E9B2F51, 0x842449C1174BBE29, 0x41FA0D4BD4F884D5, 0x52B03481BE86A09D,
+					0x55B5E411083BF68B, 0xC3BCD1237E57AEC6, 0xFD430C3B534FF6FD, 0x586F35A5D14900C2, 0x5E4BA9BB274602E5, 0x962EC4EE9880F057, 0x383AA1532CFF10CC, 0x16E4D34FFF4B5405,
+					0xF39FFCB413DEBAAD, 0x8599B25F5D749EDD, 0xA4F7FA3B3C371B5C, 0x80427BC25C354EE4, 0xAA4F60B0ADC88CD8, 0xC49EEB309810BF94, 0x1F46EDFF2184643A, 0x986BD1A518DAAA85,
+					0xDDB96AFCDBA35B3D, 0x10D002DAE6206286, 0xECC48BDF96035118, 0xE3876857A3727057, 0xBC25ACDF1C9EC401, 0x5F4075E895149ABE, 0x0391D46B3CBA7659, 0x95EEFF62DC51EBCD,
+					0x77177D3A7D41F07A, 0xB4E62EC7EE316263, 0xC0FC76747AA60DD2, 0xE4241178482055CC, 0xA46090C3895A0602, 0xC65AC172B2B0B97F, 0x3D5C479A3DCC2991, 0xEBB11D13825A7A08,
+					0xDEC55D303FE87851, 0x77B593BE157A23BB, 0xDCB4C72AA2882BFB, 0x2AB39C9BB3E24B43, 0xF14B86D41EDEFCB3, 0x9BF1F9634028E200, 0x056E9193E4E92203, 0x56FDD900479E41B1,
+					0x144DA76BF8014246, 0x9708D0C7DCF84B67, 0xE23AD515B533035D, 0x26A4380C2872C6AA, 0x6009A26E15197BED, 0xC0D58EC797A83DA0, 0xFFC2C0D8EAE1627E, 0x21C0B69087876634,
+					0x62B2084758797BFD, 0xB557D623A5ACF539, 0xE88F31152D429D35, 0xD612A2908BB07342, 0xD03C2738891EE53F, 0xB379D15ED2FA02A0, 0x93774F28EE15258A, 0xDAEDD6EBF883594C,
+					0x4A81514F710B926C, 0xD3DCDA1EFDE0E9C1, 0x3AD55C9665DB7AFD, 0x87D57C99E52A4208, 0x2FD2B2C2234BDAEB, 0x9D552441D6FE46B2, 0xDA08F42812518997, 0xA2DF17026F4F2122,
+					0x8FDD79A6C97FD020, 0x36E39F907E13D9C0, 0x08FA4FFCE54D1EC2, 0x6F9C62B0ACC8A962, 0xDCF02394F288E006, 0xF67BD7300B31636C, 0x615429D27B3361C5, 0xF6A0176D3F3C0A16,
+					0xB98637493BE8BC6E, 0x6C4AA8710EFD9146, 0xB6A349C9D19A483D, 0xD8FC6F4FA2ED4910, 0xD6BB65E4DDFFD2B0, 0x1BB9FD52C8CDE19C, 0xCF190C375AFC18F0, 0xC869B9FF1CE85A5E,
+					0x7B1FFA60C9B456FF, 0x7752F667ACB26532, 0x795D01CF0628B20E, 0x793CCBB4F7962506, 0x328135EE6DFBF068, 0x60105ABD1822EC3E, 0x64EE94DCD4A4E6D5, 0xCEFFCA725816A83C,
+					0xA4CD6FB28862DB79, 0x208A823BBD71FC1D, 0xEBC3BB37266D14E2, 0x02D67B404614C946, 0xF1E94C35BA210B94, 0x09D9DA36C2E5D0B3, 0x7C3BAEA3406A27AC, 0x5777ECDDA021F93B,
+					0x4C158F97396B0230, 0xC8ACDFCFF8680C33, 0xA594F23A7F5AA491, 0xA50B2B20F911B2C2, 0xA3DB69470FC79045, 0x83F99D7766285E0D, 0x1F3605CDC4E7ACB5, 0x19549ED10ED723AA,
+					0xACF82E6B4596D472, 0x40C18D686AA6E0B5, 0x730E704B530C09C1, 0xC6147ADC183B63C9, 0x48231F1508FD7494, 0x24A9B9B8E2431170, 0x03A55ACAF7CE6D8B, 0xD7DB6D6707F8DC83,
+					0x231FD2AD26E30307, 0x1ADE6D80E7EBC16B, 0x83B2DAA19D428BE5, 0x0070CEB372D1F97E, 0x1BED9EECAC5F6A09, 0x92765AD60E51081B, 0xE30E6986D6CFC37C, 0xDC12EC8804DF55F6,
+					0xA5B54F9E3E1E9C17, 0x3CBB54D58E65F79A, 0x212B903DC7CA5C10, 0xE9A0CFB4004D7F72, 0x82C7D65239CE11AE, 0xF470CB0E1F855A81, 0xFE781F16B1B9497D, 0x14F535770C10F766,
+					0xC8B21661FB4A80DA, 0xEFB4E03187A19939, 0x27F0C577BC49F052, 0xB1C61B6C237BEC49, 0x5C769F5624B7344A, 0x431D55BCDEB38967, 0x500B2E9CCA373E8F, 0xF27D45DF792B0993,
+					0x4DDAA6E11EB6B055, 0x4D2A138EED87B81B, 0xD8C9D16E730287DB, 0x9C29EF92EAFBF1BD, 0x118E0A12A2D808E6, 0x14D1088A862028BD, 0x12FAFDF4A12E367B, 0x3497751BC394F46A,
+					0xDC4DBDB80072A99B, 0x07483F47E540C48A, 0xCBF831CC3F223C54, 0x86E9D5D76E307739, 0x2B78F909185B2D38, 0xEFB450BA5927FFE2, 0x50D5A3DE346A3068, 0x2DB1A4AD43A001A0,
+					0x1BA370E8F6678258, 0xF24390278CC2FAC5, 0xC68AAF0EDFE2A751, 0x6A00F0560C7348E3, 0x11DF59BD139DF3D1, 0x375A683AD30A3C59, 0x81C9418B22AFFF53, 0xA135FB9E2DC6E803,
+					0x84F78AA9DD97011C, 0x6D4FFC169CD046AB, 0xBB1941E4F93DC6A2, 0x548567F0BFEED3C7, 0xBC8F932429F30634, 0x9129114BF4D8CF70, 0x066BE1532B13213C, 0x6B7B1388B148CEE6,
+					0x16E98AC0236DF084, 0x563218F7D15BF067, 0xC19A7EE765B26A71, 0xA18294D46AF76911, 0x3CC266EB456978F0, 0xE6A66385589E668C, 0xC8A982A5F66343A1, 0xE219A00D571DFE05,
+					0xF13A01C9D0047C26, 0x492B7845B35FD221, 0xD3651A09DF17C798, 0x28773F4ED61A4F2A, 0x06153872E6B60A99, 0x40E2326337E05492, 0x1173912454EDD57E, 0x85BAC2576AA2CEC8,
+					0xBB26FC9FCB72350A, 0xA2D687A1ADAA73CE, 0x7C96DF19D2BB0E9E, 0x89485E1F298D6C0B, 0xDAB1C9785275A78D, 0x91A07488A68B9F0E, 0x1CBAD13B9D68E837, 0xF26B2B5198DA89B7,
+					0x384EE00F53579B4E, 0xF96962C7C9A1088B, 0xE323F0C67A04783F, 0x95A0D0AA3221AC75, 0xE025A2C3A04B321D, 0x3E27071774F79B8C, 0x742694B89D87A86F, 0xCD28912504F3F89B,
+					0xB1A458315CED6452, 0xB216286E03DBCCEA, 0xB366898ACE76B06F, 0x8833382548E6D2DC, 0x7F3A1D95D6229497, 0x4BC9FDB0FF2E1FE3, 0x8D93B49911E3ED07, 0x44FBBD2758C3751B,
+					0xE92F9E131894F342, 0xED45EF52BC621005, 0x1DA904A5F8FF7301, 0xEA38508FCFB94CA1, 0x2D898339E9087A9A, 0x8ED22937EC9D68C0, 0x3893B88B8DE68CF7, 0x70115BD0CB7B31C5,
+					0xA17ADB431048FEEE, 0x66EFFC7293F17327, 0x19E1D335D40B6E2C, 0x45B49050A606EC35, 0x5F1C02AE9AF4D942, 0xCFC6715F53A90785, 0x3482DDDACF2D5BAA, 0x1855A9038595FC90,
+					0xAB54DAA24F3196A7, 0x62E1D2BE46597681, 0xCAE60BE255162DB5, 0x4BDCA268DC7EDBDF, 0xC17DDADBCB747592, 0xF0F0139484DADD29, 0xDB22F2E541C49FEE, 0x130AC3D658C7942A,
+					0x1903042E2A02CA8B, 0xECE1913FDB7700C2, 0x599FCD01977B6B02, 0x448C4D9292823285, 0xD6D7E80D2AB2B6A7, 0x74F5180EA246D6B8, 0x2D381047629CD072, 0x3A4F191CE3226669,
+					0xBF175013FD45A07D, 0x0BE213998E806CFB, 0xFEB8CF4204639E57, 0xB35BA4A998BC1878, 0x07EC8EBAE0637CA6, 0x7B719019EE6293BF, 0x843DB63A6D0C3629, 0xF2EF572282633924,
+					0x836B3F5923D7E49D, 0xF7DE9337F469F125, 0x0D067F08C7D83FBD, 0x10CA83FA82D03A28, 0x1C92FDD520DDC27C, 0x2D958B2AEBF7552A, 0x48253BEE509F9F3E, 0xC1A99C35F77461DC,
+					0xF6F9E76A420658C3, 0x4BD25A7CF384B401, 0x28E4DAA0E972218D, 0x3FCD72185E3DF56E, 0xE7BA269B2563E56D, 0x84D54B08C48FAC2D, 0x59240425AFD10FDB, 0xA2C528D8480ED7C0,
+					0xD8A9E3C920E05CBA, 0xAEF7F49989815E92, 0x670A2A17040A85A1, 0xE59577CDAF2A4576, 0xAB0CDBEF79836C4A, 0x0A825066FD412BBE, 0x5C430A247D4C3C8F, 0xAD7616FAF6AD8B36,
+					0xE3FE0ABE046FC234, 0xC54CB2302379245D, 0x10FD5A31D2E43A22, 0xA6DE8473F8D0825F, 0x4DE3FEB78FC16745, 0xA9D8BBCB5A3FF12F, 0x33A64B6FD76C3031, 0x6B527B2E11A41E42,
+					0x21EB394FC2D4D110, 0x9AC5C88EA171AAC3, 0xB44FAA9B70894D63, 0xB7B8E49510278170, 0x19EB2ED8237775E5, 0x744F5276C453E472, 0xCF95ED2000A11CAB, 0xC5E180349FA34FDE,
+					0x76520A54078EC755, 0xDFC9D3024CB83B0B, 0xDD9AAEF1B33F6706, 0x284AD5D832A7422B, 0xB7F0D6B1CC07A4D1, 0xAA1F645A0F3010AF, 0x862B826FBD01D969, 0x92D353E4A553919D,
+					0x7705E1F2E43E8908, 0xC3675D3B107B1D5F, 0x0ED0B581C6D7AB82, 0xF1A8C334AF851AFB, 0x35807B5E6303456F, 0x55E083399631F5C4, 0xD97F720AA614E893, 0x965F3D3DED0ECF00,
+					0x27E1FCF30CEB13E5, 0x33C82A668DC9F9C9, 0xD23E62BD33CF8CDF, 0x5E5D81798CE17C71, 0x48AA9C64B40746A7, 0xA90959031DE58FD2, 0xA5B63A08E295713F, 0x24ED6FEA8F20CC47,
+					0x07779D03A9CA7AEA, 0xADD9C07605E30855, 0x5071BE1AD6D10581, 0x296A4484294D7FA9, 0x77CE78BD6541FDF2, 0xFE261F18F9338990, 0x0880B8E7EAB9A7DB, 0xE8B5291C10242D35,
+					0x3C4F37C289C52D2E, 0x0A7D6A3D6B774A3B, 0xD173F988C96804E3, 0x660DC7B7AD00EFC4, 0x449CC79C3A29A367, 0xE828132EE32EDF4B, 0xD96DB7648151C01F, 0xAB4C6874DEBA945A,
+					0xB69CE3E00D1810D5, 0x06BC0C8AA9152C21, 0xA82EB6A1CE215CB2, 0x64F5538E3AF59158, 0x2BAEE56598BEF483, 0xF3C1E1B07F79C59F, 0x0F1F41CF6866D42B, 0x87AEDC0D1AFA69C5,
+					0xE51E57A6AFEFDC97, 0x8A1E77531777FB71, 0x45FE89BC896EC7F0, 0xC47EDA941C792331, 0x50997DF1559E4D5F, 0xB09E76EA6CF61382, 0x1EEFEBB32DEBE140, 0xA707F662C5ED20F9,
+					0x78D63AB8EC480531, 0x4525A155B9BA7A34, 0x889462FD52386069, 0xD7925FE82DFC7F1D, 0xF57B0839174B0F8C, 0xD91B7D293E271270, 0x195FF6ADEE4E047C, 0xA353B7E6186C38C8,
+					0x8C2D33EA74B08849, 0xE9FAD6FD181B759A, 0x39665C3758557771, 0xC4CD32364E92BB81, 0x171510ADA2A7188A, 0x0DD4ABD75FDF07E4, 0x413104C214D2DE71, 0x0C38F584CE8620C8,
+					0xCB2C89E6F579E820, 0x84F7C8FA8050E0E7, 0x7E0B65E5C432AE48, 0x171C55EB44FC566D, 0x1711F489C7A8251D, 0xB0DC0EFF84605CCB, 0x8419F2A38A62F510, 0x64738F50C8912BD3,
+					0xC42C0FF5C53A387F, 0xD71285FFBCADC05D, 0x55168AD7BE831016, 0x8277FB15C8BDAE65, 0xD36461F88406E5A2, 0x13730CF505D2ADA3, 0x7A54C7294E1DB578, 0x059D9DE542DE0997,
+					0x50469D67E05574A9, 0x8A7ABC4A74591115, 0xB5980C30E91C9E93, 0x35A1CAC36995EFAC, 0xE20D918DD666BB1B, 0x0C8243FE0FBE599B, 0x5BD6A2B312E388A1, 0x65949173E7639E37,
+					0x81A4E93B2B0BAEF6, 0xEDEAF17105D1E3E0, 0x5890D77EF352D719, 0x8CDC18A6AA71EA53, 0xF229B28686296DD8, 0x9C01E81CBFEEB9E2, 0xE60311B21F2E0EE6, 0x486D1CD9AD220D11,
+					0xC3E6E92494A9A64D, 0x0FCE916C52D5C165, 0x9812D1E580A49328, 0x104E6A792F7E025B, 0x91B4622924392D0E, 0x0882DA2FD406B251, 0xA17BF9FFD7305ED1, 0xCF6DD518D0C3E4BC,
+					0xEB376988347909E8, 0x6FA28EA5E8A2B5B0, 0x3BBC282C5794611C, 0xA818341E021C2986, 0x9DB22DA60ECA83C9, 0x4BA29E26EA529222, 0x6C2EE72D908AEA5D, 0x13128F98C2A624D6,
+					0x5CA3572D356809D1, 0x72DC13CD0671047A, 0x4EEB7F4603C34DE1, 0x410F48B48418C686, 0x6BB7587EB8BB5B14, 0xB1CB9F2332791DFA, 0x913F07B9A5FDE378, 0x23898CB345557BFE,
+					0xF695CE22207773D6, 0x35072940FF7B0ABD, 0x99B72358E31BE08C, 0xE2E30D2D90987807, 0xDAB782834E2B5538, 0x3621F1E1839EE615, 0xF6C457DF252355D9, 0xDDF454C1270871ED,
+					0x685FF631D3D081F7, 0xC6C9B49689AA2631, 0xE449E31A7C5EC786, 0x52E218E46DD9DFB3, 0x4818862F0D68B7AF, 0xD54771A2D95A3529, 0xA4C6FC492D7AC456, 0x27F9EC0E9F354C43,
+					0xF6C003E413808EF6, 0x37A1A291B1DC44FA, 0x79FA14CABC1CBCC1, 0x270524C6C3E52B91, 0xC85F1434861494DE, 0x5A6182DBD1894463, 0x6A4784D1ABE4DF66, 0x869034C9441D7CB7,
+					0x9FB82E8DF47684EC, 0x18A13422BC15ED22, 0x5B02DE1499032015, 0x6EA1B8925F62E9E3, 0x8F9EC60DFFCE9585, 0x24DF98339741C42B, 0x0D46647A74AABDBD, 0xCC1996C2C4AD8B84,
+					0x6F4BA53FC97BF9EE, 0x28DA0C77EB9AE938, 0x66BB2C3F0B1CA7B9, 0xF5F2FE3724BE08B7, 0x151CDA6B4C2405B1, 0x3DCF9C23E43482A9, 0x7F50E93E3CDBA7EC, 0x59A53DEA659A3FF7,
+					0xFBDF37DFB74E2692, 0xE9302B34A851201E, 0xD4F895F545465062, 0x7AB90946A4CD7A7A, 0x18EE8B368B2727E2, 0x3EFE28145CBBB660, 0xA246C041E402FB8B, 0x57A81CBCBE34E677,
+					0x75B9DD7F00557BEF, 0x6EF2B8A6A86D3BCC, 0x1F1F2E6FACF4D130, 0x1FB0D8049C68824C, 0x3D88F261C193C239, 0x5D64C4C9880C4E67, 0xAB81E6CBC3283A02, 0x3FB17711EDF6C2C1,
+					0x37D53AF3F0BF978A, 0x7CBD4C32FD910ACF, 0xBF939B1FF2AF61BF, 0x74989E559B49FFE6, 0x602FF6FD3D266EA7, 0xDE28375CCAA5EF73, 0x46FB217A3FB2F54B, 0x831ADCC8D14B2BDA,
+					0x0FFB049F5687CC81, 0xAD5FDF1DB42AD045, 0xA9A9EE9973B9E7E7, 0x5C769643F54C79F2, 0x3EE88DED87A80F3E, 0x18208F49A0F8EEEB, 0xE5097C9AAA9C9CA5, 0xE3E0EFCE81334AF6,
+					0x8ECCB07428DCBC8E, 0xA93FBA57743A6A5B, 0x4A6C0AFB6F1580D7, 0xA690225C1EE8371D, 0xCFFBEC8E15A6BC2A, 0x68E2544403937274, 0x3B9C0E7A0A2CA53D, 0xE632D0A5B90CBDD8,
+					0xA17F645191452FF8, 0x7D7C5C9E54B9C3AD, 0x63A8F38B29531E3B, 0x06A5CA687DC2B155, 0xEF601241A0342838, 0x685F03AA3CCF486C, 0x5987A5CFE0F77E57, 0x351A4E9F4DD38DCB,
+					0x244AEDB93CFEB010, 0x319DDBC0532C33F9, 0x6FF40EE09C2DFDA7, 0xEB55AF8D45E7A20D, 0x8DE58299FF3C0E70, 0x8BA0CCB8808350D0, 0x43791091FFAB7EBD, 0x470D3C06872AC908,
+					0x2BFC7FBF4E201BA0, 0xBCA40F88C95C10C4, 0x4931BC2F72FFD2BF, 0xB46B59664EF5FFE4, 0x0165E2FAD1A81734, 0x5D121D6E454B33C1, 0x54746CC66D63B931, 0x6CB01138B924918B,
+					0x53D9734BD8B65E4E, 0x0F813E90E10E12CA, 0x0FA3C7F593F51501, 0xE4D9BBCB1A429A3D, 0xB0F45C5E6C18CAA8, 0xFB2EF22F805F7BD5, 0x437A6956B52E910C, 0x5B1370DE02433FE4,
+					0x260E38F108D187A0, 0x3288CB46DAE36071, 0x72BF7E8935FF4C57, 0xFF1F49A3158C5001, 0x58798851CB6CABE1, 0xB03AD30B56FBEE76, 0xDE0FD3D04481E61B, 0x18893C9AB3DE56A4,
+					0x0C39479455E4D4D8, 0xDA37809BAC9BC931, 0xACCF5EB7E88FBDDF, 0xA266E459AB765CDC, 0x9F2A9CE4C935705B, 0xDED7E0363307E82B, 0x2FB05E1D09509A67, 0x4DAD55A4E77E4C43,
+					0x93B1DFB6B4AC4855, 0x43B96460494F54F3, 0x3B139B8F507C83EB, 0x3F0EDA44B99522D7, 0x0C6A612D17B6D64C, 0x8ED9BADB551069BD, 0x81C43B1F21F6DBCF, 0xCD266908D55E2FAF,
+					0x706D5BAB0467A513, 0xA6E4F8A071B60181, 0x5D05293FB7702820, 0xECCD658B5AE767A4, 0x1700D5D55AF3610B, 0x482DB4D6875DF54F, 0xE1437C103E9FC6CD, 0x76233D383A2C7FA2,
+					0xF51CF4900A98BA21, 0xBEF812EC72F834F4, 0xB67685AEB2ED4E0C, 0xA555F088EE09F6F6, 0xE6BCEA369FB7B1C4, 0x36DDFA4EB3B2C252, 0x378EAF3F8C6AB719, 0x93179365EC20449E,
+					0x089A19DD4796B54C, 0x4A90E24E002A04E7, 0x99C999C0BDB83CF2, 0x69504E9F36C2FE0A, 0x0513D026876DF01C, 0xC290023C7563192B, 0x48DEEAB628595590, 0x04D7FB9E2C51B95A,
+					0xAAB360337B4F038F, 0x2E67D6A1DF20FE26, 0x5CC01847D64D62B0, 0x848479C4CFEB9185, 0xD8688B19E0DEB13E, 0x345E5A4B6569C69C, 0x1E12E1E6FDB7D43A, 0x78C6DDD759E0533C,
+					0x19D6A646677C3391, 0x3A373BDF7B202E61, 0xBA200A8B590FAAE3, 0x03A566FB0600EB8F, 0xF6D9BCBF6F94A4A5, 0x867A9987192F0E78, 0x250126E65748C941, 0xA050BDB7524C9B0D,
+					0x8E08A8B78E7FF632, 0x14C7D0ECB9C2DC42, 0x0C43E5B928E8AB4F, 0xD91C037EC166A6DA, 0xA85CCFF5F4972EDF, 0x424C5446E5750F06, 0x3686632B000F3DFC, 0xD195BE51F0889698,
+					0x4B32CFF55109F83D, 0xACFF9C5FD97E50BE, 0xA5D4E1FAD2F78E35, 0x54D80588F99F80DE, 0xF79D9B248FB4DEF3, 0x66C402B6EAC31042, 0x2CE96A28C50BD261, 0x72026906A8BE52AA,
+					0xED5040961580CF3A, 0x1B53F68CD4071D55, 0x8BBB59E3FC257325, 0xF93078194501AB1F, 0x98DC7BC686B0ACEE, 0xCC6BFF7ACFF26C20, 0xF519115F6DA9259B, 0x6B7F591FDE850781,
+					0x205A3939C593FFB5, 0xB794A645F04E862C, 0xB3B01353332713BA, 0xBA41EADBA976C60A, 0xA2391C58A2CCCABE, 0xC40C85116F084163, 0x309418D9E7BB6A34, 0xBEADEB4973EBED3A,
+					0xAFC83F4568ECED39, 0x1DD75F176F537336, 0x242143892712A57A, 0xA84D97FFCCFD1BDB, 0xB12A28465877C186, 0x676B3E821F7BBDFF, 0x6693B619B46CFC6A, 0xE402C3C3C39B25C6,
+					0xB4FBA7D732248087, 0x43DD2B30B81E7405, 0x9DA8833CFB532627, 0xF2EA35C8F279B296, 0xEB2F6BBEE5C67EF6, 0x475A6D7962FE6529, 0x7E77CA301CF67B00, 0x13355BD5781838C9,
+					0xC1F941761D9FEB23, 0x37D980C78E74C2E6, 0x7D1EFFF596006D75, 0xACDC4CEA290E6BF4, 0xB372E1BBD54C5A11, 0xED153B537CC346C2, 0x9DC605E2B91A6664, 0xF28F94910B101CFF,
+					0xBD9B78BFC45314B6, 0x5EC6CFC988F71607, 0x5C26BCCC5DF7FB5E, 0x7750F888F522E420, 0x0A2C72D8C165007A, 0xF0EFB2EFA20D10C7, 0xBC2156EE5132BB35, 0x490053CE5982E2A2,
+					0xF3F2B40DC24424B1, 0xB716B38A2946D7B2, 0x232A21CED3BB6822, 0x2365EA5D91303797, 0x5B3FEA073D155B14, 0xF778A0FE377593AF, 0x958A6A00E7D33E3C, 0x292E557A52D9150B,
+					0x680331FB93CB747B, 0xC8A8BE54BC623E94, 0x2367609338D883E2, 0xA06A3631B346728D, 0x6F1C7415C81213F5, 0x5479AC087FBE867A, 0xA56F141E5378D44B, 0x6681E7C359D57F40,
+					0x59B24AAEFAE04AD1, 0xF9DE4ADB82AE29C8, 0xCA6E214A56AD0637, 0x92BB8A11A6F5F2C2, 0xCECF2A0DC309D5D1, 0xB5437820D8357EF6, 0xC443874A1E411ECE, 0x44193B8E62010B3C,
+					0x378CC29B010D59AC, 0xB1A7775AA5119B1A, 0x1CF148A445EF7B66, 0x67B0C3D67DB13C1A, 0x739DBEBD3E2A01C6, 0x194F34DC79AEC21D, 0x4EF7E9380358D7FA, 0xDBE84A8ABC09CCD2,
+					0xFE8F10FD4C2F44D5, 0x222A393A0490C6EE, 0x5A3611A78C128493, 0x924048F8E5191782, 0x6FE9EDBB918A5567, 0x72FA4717D0FDCA2D, 0xD332B7CDF16139E8, 0xFAE51E5E0E552A98,
+					0xF1C179DA4ECC0919, 0x6AA93AD1555DE242, 0x4DE5C335715F0384, 0x93F283380623392D, 0x57B107892A4EA148, 0xF74AEAC469CF2AE5, 0xEE1A2A6A97DF8128, 0xC790D45F393475F8,
+					0x67EFE890FF6C30DF, 0xC984FAA2EA09D05E, 0xE29EEF87563D5216, 0x68D4E0CC121EC0B4, 0xD115C37118FE0246, 0x17BAF5747E188183, 0x2D67C4F07C49B63B, 0xEC81FC2EA070A7FA,
+					0x84B6314E1F86528E, 0xA9884F096BAC356A, 0xEBC38F9D38CB9A6A, 0x52579F1E82EE2314, 0xFC4A9EB3ABF22C2A, 0x0EDD91775A39D77B, 0x67A07503DCB87C67, 0x9A83D780BC5B714D,
+					0xDA9D142C8933A4F3, 0xFA078F035200B7BA, 0xEA8F3433DEF2ECDA, 0xEE285B7C313271D7, 0xD6B2A68F9CC549D1, 0x5C3E650C16B6CB83, 0x8CFE5369985B8961, 0xFBF1FCFCD733CC2D,
+					0x13000FE325020C1B, 0x59EFDD5D7FCCF809, 0x8F3AB1FAD6F08403, 0x6840BC8375988BC6, 0xE051F06E4A1625FA, 0x4D75BA049042AD38, 0x4B54C7B7B2E2DCF8, 0x3E038ED0E5EFAA38,
+					0xC42F57EF6D4B7CEF, 0xD9C8A9DE4D63259E, 0x386E8D3A7600849A, 0xE954677815D7D28D, 0xA28C9874DA083798, 0xF01E4F6F55C044DB, 0x9E45AC80A22FD44E, 0x9D140ADF46BA4C9F,
+					0xD5DAE4F5A965E420, 0xF3FA19E8874D61C0, 0x307AC0405F301014, 0x5727A781EDD027FE, 0xE654A22773A86186, 0x464E7553EA26CCE8, 0xB016AE247AF7D2B9, 0xB61AD714AB873BFD,
+					0xEE7193943AFB3A6B, 0x21E4604371A3219A, 0x09D2D8486A163112, 0xA4DE7C2A3162674E, 0xEB0BDAE8353FFE19, 0xDDB692E4A8ED4F84, 0xD150506F904C6D8D, 0x3AB3A5D6A8F5E2C3,
+					0x77930BFA11B8B84F, 0x072237FECDA95ACF, 0xEFD5D19ECC50A7CA, 0x4A9CD183244D0909, 0x7D5824446DB9460D, 0xD1AA679FDA34E6B2, 0x680C0154219BEFD6, 0x6851E836D3A89F14,
+					0xD0150AE5F2160B28, 0x0A35A52DCC1E058D, 0x87C3B303E6ADEBB6, 0x9AE2B93BF809B933, 0x58DA5D2F06F6BB44, 0xFA1E9B15C731D295, 0x9C33E72CFCDEC952, 0xC65C21E8A906DF4A,
+					0xEAF1F94698EC86D3, 0x4681834CF07903AA, 0x9CED8F8A3D1AD074, 0x90A8FDB7A7F9C907, 0x0B27F2C3370B75A5, 0x04FFC27EA29C01B6, 0x53BC1DBE20707BAE, 0x062A76C87C0B18FF,
+					0x23B13F4448B0CA62, 0xAE499AEF7BE6A684, 0xF479C2034B846DB6, 0x9EBCEF5211262C9F, 0x6F4CEFD5DBD8AC9B, 0xDCD68DBE847159D0, 0x206D9525C9472B7F, 0xD2C3E57A30B7B6CF,
+					0x47C8BEB674414737, 0x0F9DD028ACA131C8, 0xD49D3AC9EDC6DB6D, 0x6A689D8F610E08C1, 0xE20F764D15DEBD03, 0x990EFDA41D05D600, 0x1C08249710258855, 0xF763BC5C6337F12B,
+					0x94DD960767D9AFC8, 0x934652531F5314FF, 0x85704FF6F940DCDD, 0x57B2089164E27CC0, 0x39189CB21A2DA273, 0xD284D8803CAB564C, 0xD043EED834D3F460, 0x742C4F8B6B254649,
+					0x4BC167E35F60F1DD, 0x66C36767B2FA3A6D, 0xECBDB2090B7EE42C, 0x08172A5848F91B76, 0x2F706FAE5A08E6C1, 0xAF1B8A04BFF15110, 0xFB691D8944F6A83C, 0x0EC44CDE2C8927CE,
+					0xFFD73694D015D139, 0x3C0751AF94998D50, 0x49679459C83BC954, 0xBBB66B376FB62EAD, 0xD75BE52BC8175FFA, 0xF7BB477743053CB5, 0x114E9092AD61AC4D, 0x96E4505EA13304B3,
+					0xFD4579E8849E493F, 0x4841425F98567A60, 0x0F82B833467E1AF3, 0xE45A7332ED1ED4B3, 0x1E4F8E98033A9D5F, 0xF6685742D0C18A0E, 0x4E2107D82F9B9B9D, 0xC297FB769F848C9A,
+					0x99C14EC4CA0EC985, 0xD9BE6FCE9035966A, 0xF669C558E8FBA09A, 0x0AA6D6B14BD0DDA8, 0x97192DD66E614584, 0xB98780F54DBF8053, 0x91596945AA968F7D, 0x0E34A64BB3C2BE40,
+					0xB6401A2B3E063EC8, 0xD319F940B2B47979, 0x3535953EDCC88F26, 0xBE086D6C35C9AF41, 0x46147DC2DE62AC64, 0x99A6E66200343D1D, 0xB29217A57F633757, 0xC14B876C2D1FEE2C,
+					0x0354B9F608FC4BD6, 0x56C9F0E97D564FE7, 0xBE5138E9DCD3EAA5, 0x906B4A21E24D408E, 0x53C27CDECE11EB51, 0x7EFA1E7862774F01, 0xD0DF83A13A90460D, 0xBA9EA2FD5BFADC2C,
+					0x5E9C36CC3A51B801, 0xF84533AF112B48FD, 0x37AF709953390020, 0x8B5AC3C642F28F71, 0x1B4055682AB8EDF3, 0xE752B81BF410D153, 0x7A4C0BE938E19E34, 0x2CE4DC9731C107ED,
+					0x66AF71D0DFDD3E80, 0x0398C98049EBB0A0, 0xEED05B08496BCC45, 0x250929E23A612795, 0xBBE30BE6DB93723B, 0x8F5E09E48884EBE6, 0xB5427FF504321F8A, 0x39D41E436CBF11A4,
+					0x812EC39EF4FE2053, 0xABC17DE226909D4F, 0xDE25A53FA65015C3, 0x0A3C331DC15982F6, 0xCAC707FC90862451, 0xE69B9AED914EDBA5, 0x35B65AFCCAB76A90, 0x136FC49017ED024D,
+					0x86B4CBAC60C253FE, 0xE670AAE05BDEBD35, 0xA246C7F3112666DB, 0xFAD05B79F6AC31C2, 0xC25E198DC8839A77, 0xC96E40CC35390211, 0xC514EB1EDDC13EB7, 0xF34AC9B68CB48505,
+					0x5744B40186643A72, 0xF386D04FF74BFF0E, 0xC99C51FA351F41F1, 0x45AC41E879EBFD4E, 0xD492B02E4297DF15, 0x804350AC4C3C6953, 0x9E7EC32AA21C413F, 0x7D3A79700A995903,
+					0x29B34BDDC45AEBF2, 0xC7CE91BB8E2BFA8B, 0xD74EB1CD4E624A79, 0x7BD21ABA9C87E18F, 0xB426A266EBB4666D, 0x7595BD8EAF1DD371, 0x3D29F2C8EDCC123A, 0x2DE134C35BFA6C5D,
+					0xF661E4D61FF4BFCC, 0x4BA47FDBD1C0E0B0, 0x800ACB65E3D7C46B, 0x59F6A3BB8BDB201A, 0xB6DBBB9AC357F238, 0x6569A0D9C29DD370, 0x2B156A5B7F0F7E68, 0x0733B5E1F2D8D686,
+					0xDABCE5A653660B64, 0x308785E58B361E5A, 0x6EB1FE6FD17F0151, 0x47CAA8698D558900, 0xF9C13501894E3E00, 0xF5B87672E0DE161F, 0xC9326D3E3B8E1146, 0x8C7F811A51609FDE,
+					0xA8ECCE753A6D51F9, 0x7AAC92283D1A06C8, 0xA5A5E65AE7873272, 0xAE9E41CDF98E2BA9, 0xA571EB4BC7DF7534, 0x324447EED67244E8, 0x04318A7CD148B5F1, 0x899870537E779AC3,
+					0xFB88285C00DA6F72, 0x3731E6763FF07618, 0xE971009CE2A7AAAB, 0x1C642F552096E6AA, 0x3E421657DBAD4B72, 0x0F1890D87A8FDC9B, 0x45EBA8FCBE4368E8, 0x308E56B3A2DF40E5,
+					0xEA935AF61C04F9BC, 0x84BB9A5C581922BD, 0xC24687C32DB15615, 0xC574AD20AD8B5354, 0xBD00A4F02AE54490, 0x6AF47E5BF3912DC1, 0xC715DE05AD031CB9, 0x211EE0E964C8B38B,
+					0x6F263814B4C428D9, 0xB2EC9F48620AC1C4, 0xD73A471F42FC95EB, 0x0C4C16F386DAB51A, 0x7B2547BD173F0FE6, 0x270F97F890071122, 0x151F009B59C23BF1, 0xE4B9FC59D6B65BB4,
+					0x603E84CD264A264C, 0x48F1ABB27C34854B, 0x615C04DDD9C6FFD1, 0x4367BB61927D9E50, 0x996561BAF4AAB693, 0x5E70E52846BDDC29, 0x6A667171DC153E8D, 0x7F9025448A3D3BBC,
+					0xE844D3D363F157A2, 0xB51A0442EEC55EAE, 0x9041573E88BEA597, 0x315C68B78C4EC052, 0xFD0FB880F3403018, 0x82F6A4E492BABE1B, 0xB19830D7613A3098, 0xC595D6871F180DB1,
+					0x6A1DE64802DDE0C3, 0xF98440A0B7A63ED0, 0xB5A56DEC7EEA25B9, 0x175EFDA03880421B, 0xCABDD00A7442CE31, 0x90A13679C1C413B8, 0x4BDB9709F551A664, 0x2EA0072383B8248E,
+					0x5A63559046DBA387, 0x4F30BADB64F057C4, 0x100B7564FBEC2551, 0xCDCEDB14FC006B62, 0xC46C82E718E0B209, 0x3D413B3FB7948344, 0x43098FA6BB5B77E4, 0xDFCE93273EFC1B46,
+					0x385B5E4BA53C0E92, 0xD3E694BD3EFC31C1, 0x882DFAE567A1AB0D, 0xB4B17829680D0BFC, 0x383A4A5408074A69, 0xB6B974D33131C47C, 0x20506D60E44340F7, 0xCBF3B23E92123924,
+					0x61CF117828F0F7C7, 0x3D6E709EF53ED33D, 0xF294802DF0F84052, 0x22408EC95B1A2B58, 0xE73BDF874E55098F, 0x3CC4B061439C1F97, 0x082C571A2037207F, 0xB3D4AC19B319F6C2,
+					0xD8D076D875296033, 0x79746090486403C3, 0xB7F4948007E157F9, 0x346434EC78BDD798, 0x263B2732BB5647E8, 0x46C09F90E92D209C, 0x69723F2844AD2489, 0x22FBEB8FB0476BC3,
+					0xCA55DF11713E0CEC, 0x0FDC9F59AE4A2054, 0x27E509B10FB9D25E, 0xD0B93A8E2C74EF8B, 0x0E403D12839B5C2F, 0xA4AFD38336B322CC, 0xEF96091F6DD56D9B, 0x6CD9FA7EBEDAFB81,
+					0xB8B14E632D82D5DF, 0x3292F8A0F6ED0184, 0x48EDFA246BABE211, 0x5944FAC9199452A6, 0xCAF0254AAD8FD3F0, 0x867EA6927ADAB3F4, 0x7C06ECC72316DE4C, 0x4C58ED94B979BC3D,
+					0x292110CB2415E625, 0x0B142557F8E475EC, 0x0F4C7A7DFC4A54A2, 0x1314A9094BFF5BCB, 0x1559627027EB582C, 0x8645C16258916FAA, 0x7965CA7FF5335298, 0x570B9E35DEB669E0,
+					0xCF5845C7E159C75C, 0x0B149FD409C6B7E3, 0x8B1DD13770531D13, 0x4A937135FD129BD9, 0x987390B78E43E2E9, 0x036F90921D606BFB, 0xC65313B170315FBD, 0x33A7FCA0FE61728B,
+					0x7DE48E0D4892E748, 0xDCD89F0BDC8D3A4F, 0x855E3F53FADFE8CB, 0x112A2B417AB773E7, 0x960F9A22231E9473, 0x46A33A2A3663EFE6, 0x0B9B291F162534AB, 0x0921559CE4F378E1,
+					0xA169625F0FA7220B, 0x7DF2D29A8DB5E4FC, 0xCA8DFE34F8877283, 0xCD4F6E6D697BE6D9, 0x765E7DD3BADD0359, 0x8C9895CDF0299C88, 0x750D31D6576C7510, 0x247CC4F797A25775,
+					0xDC4243EFEA4AC0C1, 0xC6F2E0FA80B7A15C, 0x97360E027457CDC6, 0xA7274C2428FB1C9E, 0x70983C9FA521CCC6, 0x470396B3E96A1ED6, 0xDC147DC6DF56E094, 0x5EB16B5E4B096F81,
+					0x3B5DAAEEEC1C83F2, 0xDA13D931CBEA461E, 0xD499C84542832F33, 0x547966DFD0FD62BB, 0xD8379C6F7780BB79, 0x04AC89B90FF4B4DA, 0xDBA08853A506F5B3, 0x565E38C223F0C1AE,
+					0x1DD82DF441C0DB7A, 0xC0AA872AF3E038D4, 0x559E32BF21519CE9, 0x44790D98B7547FB6, 0x115D622147C2BD5E, 0xA10942B2D6259543, 0x6965B2E0D6F2530D, 0x010BB73EDB5A9417,
+					0x19A3D173FE5289E8, 0xA318266D3FB4F307, 0xC512F5767DE287D9, 0x56274091A353ACC1, 0x6A87F4193A1D96AB, 0x8C19D7152A84481D, 0x534E9E0904C29D57, 0x576E121BC75CDD67,
+					0xD4EAD1A1C3950953, 0x31D62BBA4D2373EC, 0x43BFE84D483B202C, 0x5A649579D91FE1F7, 0x286849F0DD105188, 0x86CE83919DB2C04B, 0xEBE42EDA7468A14E, 0xD3759DF1DDB624CD,
+					0xD511EB6FD6E25898, 0x548F30EC1A5A4067, 0x98DA93267884A06C, 0x63DD63669C48B0FC, 0x2370C30417957582, 0x1F8613EB518B0500, 0x6C91749E297E501C, 0x9DEEE0ABDCCAF396,
+					0x9710A45CE433EB43, 0x55B6C48924B5A9D0, 0xD222D0791C8E1792, 0x2AA4ADCF1AE5DA89, 0x30295BDEC9B3F061, 0xAE2FDA8545256792, 0x17FF6A4E230E4623, 0x290F1C8D14BEF501,
+					0xC97FE85FACDC2373, 0xD0B7AC8D646AE5ED, 0xF9C7888963696D91, 0x40F5052E76B85867, 0x0D39E23F1D1AF758, 0xD49BE55628546CD5, 0x8341228B9C3ACA49, 0x9F62ECFA33483129,
+					0x8FAF3D980ECAF96A, 0x3EA8AEE8A2E261AD, 0xFD5AA411FF23CDD7, 0xC8A99E9B577D3F72, 0xC443922F659BEAD7, 0xF4A9F61AD9D2FB92, 0x9F01107C7E8DB31A, 0xB63FFA2A1C698E7B,
+					0x8051CC3FCB105C0A, 0x624444D156235524, 0xFAE3E7BF7862923D, 0x9C1AFC95A4487D51, 0xD9E272143DA87A6F, 0x1A85328200E1198D, 0x15713B6191D587A8, 0x66DB790DF9BAC198,
+					0x4CEB3000D47670F1, 0x96643FCE40CF8981, 0xB13D394F302300ED, 0xF7ED4A56BC2DCDC5, 0xB1A3C833E0A9BF46, 0x0A3B2A7594D1DF4A, 0x3154CCBDCA34C67C, 0xC2D0552425E8E469,
+					0xFBEB348F81198035, 0x4AD4DC351020E903, 0xBB8A327A5BA3A8BA, 0xFCF57936E0A38B61, 0x2FE9FD207C581613, 0x3C1AD1E7C3D6A05F, 0x468D2C046ABE4367, 0x8C8D9A7AF731ABC9,
+					0xFE500E7573071140, 0x63499BD3C4C9DAA3, 0x12E9BBF079B368DA, 0x9D498CA99181870D, 0xA0A1F7D0246F7ACC, 0xF06185D81017E500, 0x9C27EA013115C299, 0xCDD7366509885DA5,
+					0x11A8D8AE1AF5CC46, 0x626C19A244DA8563, 0xA4F03D2DDAB9F091, 0xD1AF9625B3F71D3A, 0x250BC37170BCB67F, 0x5164F0A946FDD0E0, 0xD3BDC76DCC1B5738, 0xD2A2BD504CE454BF,
+					0xEFB21871F8B255FA, 0xC26EF53C2B9160FA, 0x1AECD5048ABF7291, 0x9146E6D4A49D9547, 0xCD0B5180110D6263, 0x16444B04CD4132F1, 0x93B9D2E96ADAA6F9, 0xF5D55BCF3BFE0FD0,
+					0x15AB067D99A8D092, 0xB8995957F3F6D779, 0x810C34F04F69329F, 0x62328463F25DF953, 0x0624EA2A7DCE3215, 0x084EDB71075E3A95, 0x13D495876B6B7D07, 0x369168F3855E6ACA,
+					0xB11540D3712C6F68, 0xF63196243A8A9EB8, 0xB40A9245467870A0, 0xCBF91716B458842D, 0x0F6A9E32623A7E16, 0xA8447E0BD2CBF5C8, 0xDAB872D5B11B4500, 0x9A6EA90C1EDBD516,
+					0x3041160DA84D3555, 0xBC6F5FFC75B15523, 0xCF89D9A0785EE078, 0x5DB6E03909A7C2A6, 0xFB3545C532BAC7C3, 0xD3D956194514A40E, 0x58092B29CB65539E, 0x820FF4467B6CE7F2,
+					0x44262C8174B52825, 0x36E69A028B714F69, 0xD3582330160460D3, 0x97FB592ABB1DF9C8, 0x3663AC43D7056D03, 0xDDC8F1A803768F19, 0x2A721CC4F6D44A52, 0xBADB82CD2981A09F,
+					0x703E717E9413D72E, 0x8C57E860C47172E6, 0x196468B90F342C02, 0xF3CA76D49EF161E0, 0xA6817534AA98A98D, 0x4E6B5C828D435406, 0x2848CC19EBD902C0, 0x4A596841C6EC10F0,
+					0x41EAC62CFFFF6F41, 0x15F41A1ECCA8B09B, 0x6C58A66C105D9327, 0x055D6F6EAC7D2DEA, 0x8699AEEA6057FBBD, 0x8AEB320C8C20B9DA, 0xA948278F16C37EC1, 0xE55224BD9DC1CBB2,
+					0xF4DC9BD1C0E54304, 0xFA7BA1CD9D540644, 0x9FC6AC1B1F604584, 0x94FB6E7C8C305473, 0x9E1BB1CAC5FC2B20, 0x48FDDB27B2694549, 0xF324C657FD916269, 0x132BA33E9CB42A0E,
+					0x24A080B499416A00, 0x718896FD16A7B532, 0xBA7B4386C3802F8D, 0x488F5110430C634A, 0xD37405256D311738, 0x3977321E1C228EA1, 0xD888611F32004597, 0x829C8D3CB6F91869,
+					0xE6D6F3643B18A1F7, 0xABD2975B76DE7407, 0x558D606C605A6BC4, 0x9712A843B23BFC14, 0x564C8AF05FAB0CF0, 0x588A8E25167C7455, 0x246AB1D2B6A59F86, 0x88C1293E950EC316,
+					0x367E7E9C7A8D7225, 0x0361A48DE0D991B8, 0x5155562F2CE4A269, 0xF927CED481930CDB, 0x80C6AED77B7745EF, 0x7D89F55FD71365EF, 0xAD004EB902F25057, 0xFA5E1C7ACDF30726,
+					0xE19B04C825A2ADBD, 0x3514BD5ED196C366, 0x39DE81A45D290209, 0x0F555FC697F77445, 0xF4B959A3030C9A23, 0x912642646D1E7F44, 0xAF6D8DDEB8B5437C, 0xD96ABF3210A39558,
+					0x414BAE982C820DFB, 0x58B14E553455045C, 0xD5B2850BD05C6F9B, 0xB3C408D78FACFB51, 0x1711EC070A7FD8D3, 0x1B535CD3EC9C2D11, 0xFC676E01C320C797, 0x18E8C0D94E20BA14,
+					0xF924E76CD47E20C8, 0xFFF612C9EB6B9175, 0x04B199326D992C14, 0x3312EF49171734E2, 0x9508597748D9F5A2, 0x6BBFB660A182001E, 0x8A5A933731CFB425, 0xC7303EF5C18CF010,
+					0x9C863A9E39359529, 0x24F16B6ECADB08F9, 0xEF4FBF1A547611B8, 0xDDBCC623801F6E73, 0xED2F7A7C01AB2BE4, 0xBE343476A54535D1, 0x2A0BF4CCF06C946B, 0xA37650DACE62D9EF,
+					0x6D432655033CD924, 0xB923D2512254681D, 0x3DD2481F67FFE0E0, 0xDE7B1C6550C92A09, 0xEEDAC9CE7E031F25, 0xA3253555C6DFE03A, 0x3BE08DF3E8922236, 0xBF603C035CEFDF70,
+					0x5FF9E6E2BE28510A, 0xFCBA695D2179A104, 0xBF3994D84ADD1AA1, 0x723B5B0718783508, 0xDDD2F63039C853E5, 0x2B2D2FF6D229596A, 0x1C6C8CCDF139E64C, 0x5FBE180E065C8279,
+					0xE4CE0DB46012D9EB, 0x84D0CF5A43B42D27, 0x43BCF7EE7126114F, 0x0BC7018EFD6D3F16, 0x2B2508293B49F305, 0xDB5155DD0609132F, 0xD710CA0B87D1E2A1, 0x8CE5EC0AC17E1DA9,
+					0x6CED5611165BBECF, 0x867175F475F66B5E, 0xF2093E43FF9D6D34, 0xFC43D32F5063EB00, 0x3911CCAAAE6C20DD, 0x3642C6531D81C5E4, 0x63D53D5328FA1BE6, 0xFB06DEC769F29EC8,
+					0x0E1A1CC5D7DE0587, 0x302C262C90ED5EE7, 0xE046C47ABBD1A0B5, 0x141832CBF170500C, 0x1F0FD7E5739E81EB, 0xDBAB1006873EB50C, 0xB514060E38CFF246, 0x60A70E7BD6609D39,
+					0x6A4FCF02CA6E6E44, 0xBD59C8778A842DA4, 0x092D59701F655987, 0xD6D674E5E23F0283, 0xFFAD831B03B3EE32, 0x73F7A5EC0A4F5542, 0x18ADC637D9B339E5, 0xE5A32B7FF3204BD8,
+					0x94CF580A9ACEFAA1, 0x1DEBFDAB98B81649, 0xF03BC2D3096F7E53, 0x459127662EFD827F, 0xEBBE1471D579D2DD, 0xA99D0C4B87BFAF5A, 0xBCEDD4CE59DE11EF, 0x8F96C1D1A999E487,
+					0x8AD0E1A773995774, 0xA58EC685D36720D0, 0x585B24C64F7C7449, 0x1E80A0635A532301, 0xBD9B5387C75726E6, 0xE23767B84784038B, 0xFCA2DA792C084217, 0xA5F51D94D807FE43,
+					0x65FB7ECD2DDE4FD1, 0x0E93D6FDB62AB40C, 0x138FBE0E62EDF761, 0x886E9ABB07E479CA, 0x3D908B46D7C170B4, 0x8999D3986CCA2383, 0x475AD3A871F3D1E8, 0x637EA2E135B012CC,
+					0xCCD51543D9F4BC52, 0x8612D14F8B5AA61C, 0x559295FC7D4787CB, 0xB1A3B4714D0DA75C, 0xB3340B66A507D840, 0x51AD8A9FC1B53191, 0x8C66BD01B384521F, 0x67825B90CC7770EE,
+					0xBADC5272FAA9C417, 0x2F2DE08D7DD461CF, 0x483BE6637D220468, 0x462E84E6EBFAB295, 0x7A56EAF82B1E855D, 0xA7BDF1554D975F25, 0x32B9CEA90B3EDB87, 0xA05D383F4A16FE82,
+					0x3ECEF1C5B4FD5F31, 0xED9D44EA8D618700, 0x41BA581C675B2120, 0x251CE2CFE6F1B17A, 0x43A95A0A38321CBA, 0x5E05BE91BF5CFD33, 0x55233DF7280F3471, 0x97B02AFD36269A41,
+					0x446DD6D4FAE6104F, 0x2353E51A08A62F33, 0x8BD97426384620F7, 0x8617F327CABB2A5C, 0x3269A8B7095BC0DA, 0xB2D8AB9C4DB317A6, 0x9822856DC4F07B81, 0xA1AD2083E87885FD,
+					0xF52E3F5959189B6E, 0x795BAE3004C33DBC, 0x553612B7B9022D99, 0x582A9F1AC45F125F, 0x9E4381AF72E640D2, 0xC028DF8AFCD49B07, 0xB544B7C098F23305, 0xB1C44F61B77ED3DA,
+					0x4C2BF14C542D6E6C, 0xACBD51D60DA93065, 0x0E0E358F029CE380, 0x0409756B02108DD1, 0xAA5A99862118C7F8, 0x666721ADD91274C4, 0x8FAC99FC3FF46015, 0xF4DBD52E82D98467,
+					0x28B554EFE0964B94, 0x30A4BF745091FE06, 0xE12E6835024DF7F6, 0x3115EB1B57088C9A, 0x0693C660045ABC86, 0x6E97EE65E79540A2, 0x70D9B7C520C32768, 0x9A0C866894FFB09E,
+					0xB85F80F2DCF9E424, 0xECE8CE4CC14B098E, 0xF3AC55EDE0052EB4, 0xBEDF51E73E559BC7, 0xBE230C2CEAF1794C, 0xE015D2C280F8B0B1, 0x4049A36CEA4FC2FC, 0xEFBB29531E35064A,
+					0x9826F5CEDF054347, 0xFB9ED723A623E738, 0x34E647AA9B7A14E7, 0x640EDFE780D829BF, 0x927AB9A455E84CAF, 0x577E4C75B3118A0B, 0x469DF51C96C88C12, 0x2525EC4476EBEED8,
+					0x7CA519A14272CAD3, 0xF4673011189837BA, 0x7E6C412E4C7330DD, 0x61432191F71D0927, 0xB6224DAABB2EA98E, 0xFAF87285075E8DDA, 0x0C547389FF2F7FCF, 0x6E6BBA59F3E2F478,
+					0x2B9B727240F936DA, 0x450739B502D1C46C, 0xC3C97468EA2213AD, 0x1B68522FDD626A63, 0x03474632DEB91C1A, 0x5FAE3B299E700582, 0x937A9055985449E3, 0xAFA955877FD4A51B,
+					0x734D26E445D5D4D2, 0xD7E87F3E28255B9A, 0xFA27631035710D74, 0x9032C3CDB623438D, 0xD3128BFFF32DE456, 0x870F439C15EEE015, 0xA5B9FD888C6068C5, 0xE1CBC0708F61AB57,
+					0xF923373C678108D6, 0x9F7EB568E8BBF1F6, 0xE304DC1DB4C94A83, 0x70FFA1796214F747, 0x04A18599DE271A75, 0xC1A7F93FDBDB874D, 0xA72B7D9A37D1AC58, 0x9CAF8883C65816FA,
+					0xC1011AA531E60C62, 0xCCC26E648109FE55, 0x4A8BFED2CA36B96E, 0x7E8982A55F3643D6, 0x6F56A48A6F96BB95, 0xF560AC8A6437A9FE, 0xD2084A39D8B8509C, 0xE629F07689813EC3,
+					0x76A87816B9B9A038, 0xD0E08B873CF3F385, 0x4F8E6DBEACDD3CDA, 0x2B90F0A23ACCD181, 0x35B2F751F5438228, 0x15335140853F7E13, 0xD340215245EB18DD, 0x5B68EE96FDD560FD,
+					0xC86616265F696B9A, 0x04FA97CC16DA5E27, 0x1B438445113ADF01, 0xF2C592B17E827990, 0xFF7C5CDC462FCBE8, 0xBBB8B655FC245E18, 0xFB38181CB792A2CA, 0xB58EC3BEFF2CC7E8,
+					0x30C02F922E9E03C1, 0x807ECBCFF7C60FC6, 0x97F733E5F53F3552, 0x2E1FC9A80E618605, 0xD00C398B12C589AA, 0xB435BB194842716F, 0x93591F662368193D, 0xBD1271085A727C71,
+					0x09CEDDAA8FEC4A26, 0xB5276A63196A5E2D, 0x9097848645681ECD, 0x7ADFC8A6B9362C8C, 0x3989D654759C7C83, 0x6C088E8E1F517FDD, 0xFFCF74F0431389CB, 0xE83ADED4DFA4159A,
+					0x40E8D7A6815369C3, 0x9480BE90FC2D958C, 0x43960474C39AD025, 0xB73ED7516750BCC4, 0xB0B268477F494884, 0xB1DDDA459FAED126, 0xA05C20C10D0A9C1B, 0x1B5CDA779A7E1611,
+					0x69816C3D2792D578, 0x1540F5194CC2148A, 0xFB50CD3EDB57EFC0, 0x826B33BB30E73D92, 0x4E1CD17D0D29ABDA, 0x44AF934476B24F48, 0x975E3D11867406B5, 0x6DD4694F44D94031,
+					0x9A5FDEC533C28161, 0x896DBDEF4F2A4755, 0x10B558D2061E020E, 0xC90CA4149A502AD7, 0xCCEBA34693074AD9, 0xFB886D94DAB10F9F, 0xA41930CCC9D524B9, 0xFB7FFEAC50E5B39F,
+					0x2A3C86DF6E751E75, 0xBECB261A33689DA2, 0xB8726E0A235AC07A, 0x8E75D032E24493EB, 0x8D1AA1D432DC571E, 0xE572F35B76BD2032, 0x9E82862483E3AE49, 0x786154FCBD137D72,
+					0xF7FEFCFFB7FAB240, 0x1A583F9F6B70AE37, 0x96D6D98CD7FB61BF, 0x7BBBFBC1C06F609E, 0x258F15845A33A6A8, 0xE47CD1486AD82685, 0x559029D0C3B8B805, 0xE819AAE115559594,
+					0x10181300E5EF0DC3, 0xF06AAE4840209736, 0x2B59944170508C68, 0x3E387EEE6206A5BB, 0x333B93AF65D9044B, 0x2A286F3A8914DCA6, 0xE6C1D543323BB50E, 0x5AE182CA8A6E7476,
+					0x0EAA25EDF2BD3729, 0xFB0ABF67C352C343, 0x8A956EA7333C0150, 0x6A7FAF5AA22D0F18, 0x1FC526E99CE63A2C, 0xF250E1958787413F, 0xC0FE7E72FBBFF7B4, 0xE94D2A8F3BC571F9,
+					0x38773B81C5C2F1F4, 0x3B31099AB3A0C9F6, 0x83AE11CF32DEAFAA, 0xCEAF332883B13471, 0x9CCB444E70FE902C, 0x81DA5450DC69CC79, 0x02196E5315AC6923, 0xD17AC9DFF666A08B,
+					0x63A996A431756D9A, 0x9142E78EFA2F87DF, 0xC211BFD49D2F2139, 0x9D26CBBF05E8EBF4, 0x621920F0DB7AD230, 0x0F44B8E00B995227, 0x8062827C350129FE, 0xF8419C4E8841C080,
+					0x0E1618341DFF069C, 0xC9FEE76939213F7E, 0x85FB6A73FC0C0ECA, 0x513619F8170F51EA, 0x09410E0CA96354CD, 0xAFCBC9AC0CE23112, 0xD6486A947E17FAFF, 0x505AB028DCCC4DD8,
+					0xB7F0BBCEE71B2E19, 0x42D73755132ABF20, 0x6A25FCDEFE1C3F62, 0x724A8665FC8DE20D, 0x7D009C5317FD8F11, 0x590A5E97E7096EE6, 0x82F125DE2185CD30, 0x269F736170B3204E,
+					0xB711542EF49F564B, 0x9CE89E6177A323D8, 0xC078CBC61B0B25B8, 0x454A2FE341237ABB, 0x39CA7E7BF4E79936, 0xF2E31FD9B26BD42E, 0x1195DCC7C0F9272F, 0x3564FE6DEAE928DF,
+					0x7A936A4E8A96770D, 0x626FC8B73762C56D, 0x0ED1623E840A8F34, 0x6C2DD1B11F439922, 0x560DD3FD3412C1CC, 0x666D98427F485294, 0x5FCF49662801A613, 0x2DD0F543D10E50FC,
+					0xDB18802E5C0C3C26, 0xABB84E3041B3C582, 0x3EE02C3CD9CB6E89, 0x69F1AC47ED81A3A6, 0xEC26066EF490FC24, 0x923F6D83D67597D5, 0xD0F07819B65726AE, 0x463523320D3DB479,
+					0xA622CBDA506D4D72, 0x02F8C8828374E6D2, 0xB9B9878483F191D1, 0xC8DBA5DDEB38C8B9, 0x78106EE770DCC455, 0x264F62123901EF0D, 0x7C1B74B6217D3B49, 0x41BA4E88AB61D47B,
+					0x11B0E1E3D936E0D8, 0x039DFC80F5E5FF44, 0xB414D75791C45CD3, 0xEB0162CBC5A5D30C, 0xD93CB13C0EB56215, 0x711339AFD603B619, 0x54F956F99C1BEFEE, 0x67805A6090CCF2BC,
+					0xC810470852137BDF, 0xCF1EE70C39C86AB2, 0xF1FC9454DA9DC9B1, 0x8EF72EDD5EDCC989, 0xE9523556B7AEC58C, 0x14C13D3015A7F520, 0x658BED65F56AEDE8, 0x9B8DC39564DF571F,
+					0xA26082987CFE1C94, 0xE3380EBFF0F69DB3, 0xC09E72BD03F8606B, 0xA9A9B3D8CAF80483, 0x97FF94C813CA9725, 0x64AE25C56D343E28, 0x2F54519FFDF93EE0, 0x68D8FCA3969A231D,
+					0x03B51AA0A6A5FEFD, 0x84C7EC032B10787B, 0x0C885CD29F95E266, 0xE263AEFDDD8B96A5, 0xE60D19CE69DD7311, 0xC4EE00025D06403B, 0xCEE08D03D1E99C0E, 0x717616C6BF30384B,
+					0xB51EB552F11A6675, 0x51C39B62D4E58486, 0x998A91FB94C58E63, 0xF4C7AEC64AF47C6F, 0x78CB2C25B2E87114, 0xF0591DAEA2E31EEC, 0x3FCEE32ED52C6B6E, 0xB37B175A9B44C2B8,
+					0x110F628280B3CCBE, 0x1A1D6C04C3797703, 0x092AAC03D85D6931, 0xD802AAEA6C696195, 0x74A3343C75BBC9F6, 0xFC55FA3297EC59E2, 0x509FE1B92D7CE5A1, 0xB91AC21C1D2EC237,
+					0x4EF22C3253DFF4F7, 0x07FB642982F2CC2D, 0x6AF08736F87C5467, 0xC2661199DF22EA38, 0x78DD4E97B7187A4F, 0x448D0CE0EBE21E04, 0xBE1AC638C90F104D, 0x4E57380B0DAF3B02,
+					0x0C13E28E23C92D81, 0x1A48759688619121, 0x3BED76DF6559C2D5, 0x321079AB96F2E46F, 0xD290BB56C793E531, 0xF2D1DF0B21ECC021, 0x82308177F30AF6C0, 0x99FF63C813C73F2A,
+					0x73AD9572B664D001, 0x50A0777848027474, 0x1CA27FF25E77A44A, 0xD7C7873C3D5BEC72, 0x1E810C4430090E41, 0x09DDC3142876878F, 0xDC7F70171DF86DCE, 0x73861B7788944DE2,
+					0xF7E0338440DDBA21, 0x980A189819178363, 0x5BA831B2A24204D8, 0xF64035D7B4250E20, 0x39738A64A9F67C13, 0x14E72AC165BEA143, 0x2FABCD7FACC079A5, 0x51E739BC50BCE85E,
+					0xE3A42CA7A7F206EE, 0xC5A067CE82384430, 0x85944AC746416AA4, 0xE3DEE605C62E0357, 0x36F7CDC1DEEC1140, 0x55DB70E5B3D20E3E, 0x0F57CE861A6C4F53, 0xCD907337CEA0998A,
+					0x8F23747077BC072D, 0x1EB6072A3365EA8C, 0xA434AD7D00617DF9, 0x7B4AFFF0C54B79D7, 0xD7C8A0FAEE5D88A9, 0x730D8385642DFB04, 0x64D2E9464428F61C, 0xB5FFD86E78DCD1D9,
+					0x9180410056B7F37A, 0x6F8B9B262E061873, 0xAA3F666FBA758C7A, 0xC9D9C1D7FAAC2A2C, 0x86ED0316D1A64F96, 0x8B11757B10ECFD78, 0xB15C40FB9DB75194, 0xF92ADBD04FC0A708,
+					0x9688BA115800D115, 0xFB27798D3206E6EA, 0x4EC184AE0362C9D6, 0xA90199F6BAEF5DD1, 0x72C808A9B6F66BB9, 0x9459DB777C11CF8B, 0xD202968052C0B7EC, 0x79745681543EE63B,
+					0xBF32FC9F6F1A5D98, 0xF68A5C646A7EF65E, 0x0E0404523A75E55A, 0x41795D20EF237140, 0x38471CB2D8CEEACB, 0x1DDCA6549597F349, 0x3A72D5A4C6B2717F, 0x16C0DE227D6B4785,
+					0x244ADB1963EF68D7, 0xDFD0264146D68BBE, 0x436DE693509E2009, 0x0EEC7E6C7706C065, 0x3311DEC8BA0DD0F0, 0x51D129546989D262, 0x2EB911E325CA3514, 0x72988220342EA1EE,
+					0x7A849312B1F9184F, 0x491BE65BA863C5D2, 0xF687DE1D704F1648, 0x48E38DF95E631627, 0x2EDEDA856480D9DE, 0x9B6B27D012101F59, 0x37CDF8558083BCF9, 0xAE242326640D2A53,
+					0x7A59428A066411AA, 0x0921CD6CDFB734BC, 0xD372053F6984F44B, 0x33460E175BA255DC, 0x174B2815EFEAD307, 0x24FEBDFFB39A8A80, 0x294F968D1BC79BC1, 0x282BCBD5B29798E4,
+					0xCC8BBB3C68A50BF2, 0xD33F6AEB7EB37F80, 0xE409A1A299C7773B, 0xB6A0D36DD3075D12, 0x15AB006B7E2DCCE0, 0x948F83CB5FB949B3, 0x385F294970C242DC, 0xADA7D29C20FAF76D,
+					0x8B7DC42711759F2B, 0xDAE60D43E2543C99, 0x48A05B60F15B8A82, 0x65D69B1357E91BCB, 0x3866D872EA6D2F9F, 0x21804750BD9316BC, 0x38573D8245DE978C, 0x4DEC318B8D77CF94,
+					0x163B4534381BEC11, 0x23CCB29CEBB87373, 0x7599B69F382864FD, 0x860BC0782375E60E, 0x9B881123F8F3EC73, 0x7D89737EBCD84B90, 0x3F9D9B571108C464, 0x356E3DE5F2865EAC,
+					0x24C95AF946C78D27, 0xF4F710103FA0166C, 0x9C926B9FA8683D30, 0x7F75C907C51E8817, 0xE84175EBD46E7976, 0x361618F70732A734, 0x645B4B17AF4A058C, 0x2563DD4D71852D26,
+					0xDF61C5A674D702F3, 0x8B7B9DB74E360755, 0x9D5D7CBCA3EB3B2B, 0x0DCB011CFC753069, 0xE21778BC3FBD4BE3, 0x5DCC94DCC72D9A3E, 0x72C45E68F79616DC, 0xA3732B58D3DD4ABD,
+					0x6FA9365B049AC7A4, 0x03DCB69DF1080094, 0x5DF95EDFCC3950F9, 0x50BCF608F3D2AF43, 0x8B44C44FDB85A016, 0x3E6E12614DDF2E34, 0x2A8169640D5DD25F, 0x42953454D1770583,
+					0xED6754148C193731, 0x48596A396E5172E8, 0x17859E1532D149C6, 0x9B5763E1823C8D3E, 0xBCAE1B1DE4E776CF, 0xA3B7E26B41AA855E, 0x0E998108064AC5EA, 0xB6A00E6E33BE0D0E,
+					0x57E3BECAE0A5491B, 0x02E9742B65895E2D, 0x88E5513C29E1A01F, 0x2C0CC848D323FE98, 0xBA2A4F2499492A6C, 0xE6177BD362D39E00, 0x06BA17FA3499B372, 0x1A44DD78792FC219,
+					0x5A3235C7D8E6E1D8, 0xA85D89298AABAF91, 0xCE32BF0B961CF76C, 0xDD8473C3086B49FE, 0xCC5D14AEE7646904, 0x7DB191F12270814D, 0xE24C37DD6E9F9759, 0x679E42B144D57D36,
+					0x68FC82F47BAB96A5, 0xA56664BE8AAE1564, 0x59F74422C2AED4ED, 0xF486F6F0FC359F45, 0xF99BC68E848BB64B, 0xD86C5D525ED0EB8A, 0xA9A8142207ADA089, 0x09276EB2FA960F7C,
+					0x5CC8C3B904CB2F45, 0xB2B3FF35B33C817B, 0xEF73AB3FF1DFD4A0, 0xF07C5200ECF723AC, 0x05F01FA02B5BBB79, 0x545747C03ECED005, 0x7A50EDC8E8D11066, 0xD2CAB3132844384B,
+					0x4E94E0F7C6E78014, 0xD6D7FD5E0AEFE2DC, 0x9A30568482C1C0E1, 0x0363F0ECD815C83D, 0xDCE192A1F33AEFEE, 0x6180A29034DC1019, 0xA406C63F5BDB32BB, 0x6ADC0CC04F185B7C,
+					0xE34E1AEF51F7861E, 0xB79CE75824594ECF, 0xD6EF492D74B4CCCF, 0x890B69B4BEF7495D, 0xC5633A91B20B847E, 0x466C8B4679F546A9, 0x483ECB578E22274D, 0xF5388BF49023443C,
+					0x74049D55470983BA, 0x110508EAD04B3E30, 0x86696E08AA9F1E93, 0xBEDC9D1390BB4DFC, 0x3C057A9DE53BB1C9, 0xFFBFBA134EA8B53F, 0x9BCDC358EFAFC7DB, 0xDE17E97F206A7EB0,
+					0xDDDCA3785CC699AC, 0xE7176127299EFC61, 0x8D419BED9D506A66, 0x447ED8DE01D5F9E1, 0xA30666C99E63D434, 0x8E2F04E87FBFFD31, 0x3E64C8F7BF7452DE, 0xCCAB65F26D160807,
+					0x9E9371034A943BC5, 0xB4EFB7540FFFE6D0, 0x56DEA66D58B79D8D, 0x62A527C1024A251C, 0x4E42A8A66E50A70D, 0x67D3881D6A700547, 0xEBA340A3C69FD0EF, 0x9B4D1F4968DDC265,
+					0x8D8E9D1BB09298C9, 0x055AFC5F93416E7A, 0x9967EB779A3EB248, 0x5A5AEBDDACBF7CDC, 0xB5FA9686814A8BBE, 0x895A3BC675226278, 0xEC9ECAE59BE6E196, 0x0A96DEA448674AC6,
+					0x75C7F661EBD3FDCC, 0x44020F148D65C746, 0xB442F41191177D28, 0x3C84A30792353568, 0x93A07913A13372BD, 0xB24399F3A78488EB, 0x51D07E1BAD6EDA07, 0x8EB57B21D3418CA4,
+					0xEDB554CDEED95BDA, 0xAF6899E8D170C1C3, 0x8344A099DBA604CB, 0x3EAD257DB51BB130, 0x801581A50B89610C, 0xAC245E4FABF9BC44, 0x6B3BFC6271351FF3, 0xE2932BB4002E1D95,
+					0x58DE5C8D5BF83E7F, 0x031DE589D11B833B, 0xEF4DE39CBFB8EAF5, 0xF1D4E493FAE4AE73, 0x94663C2BFBA1E93D, 0xFD20259B8C738CF9, 0x080A34D7A7FB821B, 0x27AF58E710D41426,
+					0x2FFC9CF265AA5055, 0x5E2AF5D9E5D2461F, 0xD8FC71563AA6C443, 0x3BBA1BB719B864D0, 0xE7A89CAF79EB0EDE, 0x28DA659770F23903, 0x45C632F4FB4BF6E0, 0xA1D4D60036FA6622,
+					0x2D9C7CFC4C09D579, 0x384692F03EF7ABE8, 0x060DA75CA4A8A709, 0x4F555A5F93FBBA42, 0x230CC5F897FF863E, 0x38BFB6E6B143E49B, 0xFA67BAFD5A33F5ED, 0xA6AAFF226EC1D89A,
+					0x90CDD4633BC12223, 0xC162E7B7FE16D47B, 0xFA27AF9169C5E59E, 0x71D8A05A2CEE5189, 0xC267E782348FB3D9, 0x3B55B8E0599BD84C, 0x27280D536FB8EA09, 0xC22C525E5C1E99F0,
+					0xD8132EDFCEFB87D0, 0x41E5D0863C3A6060, 0xA7336FAA27E6EE44, 0xF7F4B922BB0476A0, 0x9740F0AA16EF48E8, 0xAA0C709CC1389280, 0xEDE21530E2C4B65B, 0xB0D610A7CEF6F6EC,
+					0x8A1631C24B955E03, 0x9279029518E33026, 0x0EB414032083DD76, 0x44FF830C7114AA9D, 0x545FCB6A2033D44B, 0xF0507668EF1C040B, 0xFC5A3A9D7C098ACF, 0x27BB8F351F506828,
+					0xD90CD88350EC215B, 0x4B7EEAC673B31CBB, 0x30EC95E88E1D6A67, 0xF8AF3AD2E157C09B, 0x828A3C88A0E31B07, 0x54561C2E0C21C171, 0x61C8D7D3E83DD185, 0x0B2EB574BA28877A,
+					0x0035D6FE75FBD3DD, 0x0151253DC4C063E2, 0x63665809814C97A5, 0x6DE73C68BDA6774A, 0xDA2E58B4FC8469B8, 0x38DFA530D3BD3A34, 0x0C68A63552FA5AE8, 0xF29A25DEA5F7CDFA,
+					0x4B6A316D6F6C3BE4, 0xB71E2A94F00D6B10, 0x34A22B1EDE064009, 0x2C8CF156A98AB56C, 0xAFB5D816579F6C42, 0x2D4BD97ED2192AA4, 0xF3BB1F7728DA2E87, 0x407F1C75CCFEAFF1,
+					0x0B0313EFD8D792FA, 0x66481D28B88875BC, 0x5567BDD7EB886248, 0xD46D61E75C9F1EB0, 0x84E8B8659E276278, 0xF1A1C27C7C9A423C, 0x455ADD645C839264, 0xD44D5037EBB1E725,
+					0x79E035CF966F5298, 0x1A9D231D46698C57, 0xA443394E33BDABDC, 0x9E61C4D8518332E6, 0x2E7DCADAE5AB3420, 0x4DE36A3304ADB4C7, 0xFD059E61099ED876, 0x04DCCD2311CE0DF7,
+					0x9A03D14142056893, 0xCB5BAD9347B75595, 0xED74C927F9A9F3B6, 0x6AC970D08DB9A0E7, 0xA5126784AC3B237A, 0xAECD2149ADFE3E48, 0xE5790C015ACA06BC, 0x21ABC3DB594D1EC2,
+					0x9645BD25CF1DF9E7, 0x0BD9DC0697E4C7AB, 0x387955025550F1F0, 0xE20F453477B02B86, 0x6F78E9076F7BDB5E, 0xBFD8C41D20593312, 0x7DDB7735F4860932, 0x60A0A5E075A4ED4C,
+					0xBBB5C0ED6EFB46C6, 0x215C59713D02D8F6, 0xFA16988FB56717AE, 0x8D514341B954DF8F, 0x6FBFC8971BFA567F, 0x2FC06F1D24CE637D, 0x4BD50FD6D0506068, 0xD39F2EAC0D3E3F47,
+					0x2CFC4262A3209C3E, 0xE93BF75D2436D551, 0x4520CC3BFCBAAD97, 0x39FAB7B69E00542A, 0x182FDAE3DB47422F, 0xAF3230AE56F5977A, 0x03EC75C3E2A6D940, 0x5900357E9B0BCEE4,
+					0x63E50E464DC9BCDB, 0x8C09052252FD7017, 0x031AF494FFAF3C30, 0xFA5FE14340D11800, 0x9FD69AA9C9D40CC3, 0x60D7CC3EADAAA785, 0xF95CEA2420340F1E, 0x98451156603856C5,
+					0x0B16FDD5CF71C40D, 0xC90FDF691FC6B767, 0x605666C0EA0A5C79, 0x1D30F04656E3E4B8, 0x43196DF1CE1868CD, 0xF803322A9B49F048, 0x830876DEB2A81438, 0x4F4A7306531C2E42,
+					0x8D5B090C98257611, 0xDDC4D5AFDD7BA3FC, 0x4F0AD4FCA6BA4658, 0x673CAC92F6065C74, 0xCB1962873B5C34EF, 0xF161AAB17B0B7D53, 0xEBC91C3DE9912D6C, 0x6E7AC13BC53A1040,
+					0x1FD961BB5B68461C, 0x38BAD84937F6B251, 0x95A01E5420419C64, 0xB8CD9322F76A0838, 0x441959AB906193C4, 0x3BCF28C75A49F0E3, 0x396EFC45F2AE49C1, 0xC47365312C0463A1,
+					0x2F35EBA9346D6190, 0x92078DA58434A944, 0x66A48B0886B6ED29, 0x612C30E1C0A6BD85, 0x7F082A301FA8000B, 0x52CC111CFF18EB5E, 0x3E8881BFF2B96A12, 0x2F7D6B6753A0CC05,
+					0x3EAC001ED8025545, 0x3E5B9B814A339E25, 0xF8AF7CEDA6A30D20, 0x10DAE3D6A282FFA1, 0x4A408A2F58BE3C07, 0x18696611C2609002, 0x43D2528C062E1FCE, 0x074F2484C392E452,
+					0xE7BB1BE13E33C7A8, 0x78C74278290DA682, 0xFBACEDB78602C059, 0xD0A645E61B7C469A, 0xA19BAF79368151E6, 0xA4CB4DA8D4D65AEF, 0x48CC4EC6D37C8122, 0x434EF141160B6290,
+					0x1C79D32677BD0EFF, 0xC0D98FA8F419F5AE, 0xCC6D3188DBB7FEE0, 0x74E0D185B7496EED, 0x112EEE273C96BB46, 0x999F567534D5EA3E, 0x1BC5BF505EB4DC06, 0x4F3325D0638F7B8E,
+					0xA3CBFB8A55A80EFA, 0x59849E140405A525, 0x34415718A6CBC2C4, 0x3C9116A588744937, 0xC6E055059A707F3A, 0x0E8449B6088C432B, 0xB7A31E7505DF39A6, 0x5595CBD103F46A42,
+					0x3A473D5BFF005F59, 0x5230458A40812223, 0xFDADFCC14F08DFF6, 0x6EDA28F22187A268, 0xE72FE9F28BA3193F, 0x1E966F02DD6EF751, 0x4B44C66ED8F6B010, 0xB216AB8D4260896C,
+					0x5E598473D940F029, 0xB2E0B5C8AA19E498, 0xE59B9312A1D2D974, 0x4610F021DD956F42, 0x185900E2049D940A, 0x26556240A4BC01A6, 0x48263E48A78D190E, 0x71842C53FAAE6269,
+					0xF859C300BA8EEEE3, 0x97C2417020A78F6A, 0xAD5AFB50A22DE75E, 0x413201393592CF4C, 0x77D25CD4819E9C58, 0x732CA6619BCC911A, 0x4A74E4FAF9791B16, 0xDF00F73EAAF4A290,
+					0xE01861751F63C568, 0x8DC6FCB61AD93E7E, 0xF0BFD45F3E547C94, 0xF198D6CCBE70B551, 0x550013385887E963, 0x0FA0D782341B9B61, 0x8268AC322F187BDE, 0x2B46F50EB2128586,
+					0x17CA0860C79E02F9, 0xA2285127F46BFC93, 0x44E9360025E22C78, 0xA4313294CD9C8BF9, 0x534385A0CFFEC525, 0x36E58339EDDFECDF, 0xDA293235CA54673F, 0x0A51EEC8C52F66A5,
+					0x2255E006693BA736, 0xE2144E0C4550E107, 0xC6FA5B544C9A14FD, 0x686E304218D2CF4B, 0x51E7F26126CA259C, 0x34A3D5E9FBB9C900, 0x76B31F5E61BD8FA5, 0x5EC44F0BDC40F965,
+					0x17A49671FC50E043, 0x73388E92D27A0109, 0xB3630F5881A58098, 0x00E2DEB60F16038B, 0xF5CBCB0EF615E92F, 0xA25F20309E980C02, 0x6E56D75C6B370083, 0xBE1687F3220DC896,
+					0x737B57252DF66FE7, 0x5D8D6C9B771FA30B, 0xBF940E30016111ED, 0x71476A6B87C48AC0, 0x3AB70E090A2D27AF, 0x86784C07EE5C8944, 0x66E179AB7276AB92, 0xDC2AF9A55E2448F1,
+					0x4A42795F88359EF6, 0x566D6F106606DA86, 0x8E15B3E74F0D0EC9, 0x4CA9D7AA4DCBC018, 0x5CE10B6424D4C15B, 0x7F093A5C54CCC25A, 0x51529A0A7ADAD786, 0xEF9F1D101BFF67D8,
+					0x91C9527DE2A6A0ED, 0xFAEB5BE55021AB22, 0x033D13437B5E252D, 0xF748A0F374B89C4C, 0xA580FFDC496E33F5, 0x04A9DDBE6A76DFA7, 0x8A88E813EB250A6D, 0x95E2E985BA5FCB0B,
+					0x2B642E3D6B50927E, 0x0ADD1D2A698D6744, 0x43D0A7FBB1819332, 0xBF24CFD58DF9E23E, 0xD3ECE88CE5F48A91, 0x13CB283149431322, 0x4A38D568A9ADECAA, 0xD8A258C1DB563C19,
+					0x95AE4BD7165CBB04, 0xA1C3C3846AAA9AF9, 0x8ED48E3A35F0902D, 0xB3C187A0E8B4094C, 0x2FAB758ECEDA02A0, 0x213C9C1E5990B154, 0x71547588718D0BB6, 0x1FDBB9B8C9AABC8B,
+					0xA17F1FD8BBED31D6, 0x6BDCA62E1891973A, 0x3C128F70F61F755F, 0x85C30D1C757E48E0, 0xB631A4B347BB22CF, 0xCC4BADD37FF04CA7, 0x2102B4DBB7B1E125, 0xF44BEE2BC4E64E5F,
+					0x985A9F036F42AD99, 0x568251658BBFD42F, 0x2563C1488C65574C, 0x5906F7D882D4515C, 0xF854D24A79F365FC, 0xE9C246D867BB1F08, 0xFD840C2E046385C9, 0xC6D909AAC8C2E5EE,
+					0x3890F3A1E1DFEC9F, 0x4CC8A6ED5A4EF67C, 0x70451555B19E86A3, 0x2C4E165EBBCB8233, 0x28DBE0DED48527B6, 0x63DB6FA5D154B371, 0x3DB50B425E356281, 0x69061DDB920725DC,
+					0x9784824C32667E25, 0xF96CD912AC1CABCA, 0x6809CA6C42C284C0, 0x9D6619B92FF1436A, 0x074586A39199E045, 0x569B974D745F8BA1, 0xE318C5D56DAD121B, 0x180B3D652CA14B15,
+					0xEEAC2CEE408CC1D6, 0x47F3D44E09C167F5, 0x980DBE05C82648DB, 0x40819A78F6117476, 0x4B7DF02D3B2D56E5, 0x0002F5493B6E3396, 0xBBB3999C933996F9, 0xA5DE53F48B8FA36B,
+					0x2739FAC378043F15, 0xFE592B5852DD4240, 0x316FFC4DB857CB7F, 0x9F6F76AFAB90E046, 0x54CBE70FC6673363, 0xCAED7CEB222A405B, 0x82563ECD65566370, 0xC7D88F20EED82B5C,
+					0xA080D7EFBFC0D8B8, 0x6C42A92B6AFBF76B, 0xADAA3B4EF95F5B6F, 0x45C14B24D1B93AEB, 0x6FF36DF524EA88DC, 0x5EF89E8E57456EE2, 0x8C17ED9EF56C8EF7, 0x8DE9CF391B2FE790,
+					0x009F55A7654C6ED3, 0x44BC9594CF124985, 0xF8F3A1948DA6D53C, 0x3AE1FEF33BED5EF1, 0x3342CFFFF87FCF8F, 0x9108056593E5E19B, 0x47BF0AE8B5BC4E12, 0x8367FCE7017A0994,
+					0x7789FBC2864D3146, 0x48F4B2A44EB6C5DC, 0x9F93327B165A4EE4, 0x3F17BBD36948302F, 0x16739A4999701299, 0x05D81BE396F8F5A0, 0x13A91B7425EC9C90, 0x08504DA789AB1660,
+					0xA0B82607D6BE85B5, 0x5BFF3C66D2D02AC2, 0xCBC3D611767969F9, 0xA7BB0CB7E9CC5725, 0x11F354453D0C260E, 0x185E0418C7F1D1BC, 0x119FBFB048400012, 0x4D8F93D5C314BED3,
+					0xC453474252CC45A1, 0x078D7646B094D288, 0xA57DA2511F124251, 0x73DB09F46B6AC511, 0xECCC87665DC74A7D, 0x00AEF7EFEFD1849F, 0x8F3B83BAFBB8C2D2, 0x7204D30A4639539F,
+					0xD4CDF5ADF38109F7, 0x8BD22A1E1BE7BD63, 0x71C83F759CE9D24F, 0x57DD35FDAA644777, 0x81FA55A6DE5F1FAF, 0xD59DCC11C3215836, 0xBD7EBB1CAFF39F41, 0x0CF396A7FD442F74,
+					0x3B79223B26B64FAF, 0x3E090E1BAFB8DC88, 0x2370FE52039D0D6F, 0x9B3CE51696600A53, 0x102E1C25C64E55A9, 0xB90C5D807A455FA6, 0xDEA1CD5C6616BAA3, 0xF9A4FE95EF831862,
+					0x0EE7D5CD3CED6D4B, 0x52BC5E5E2A6A315A, 0x87EBAD51EE6EC07A, 0xC5F7627BC5277681, 0x4F4C523690790AF7, 0x3C57C679248E3EA6, 0xB0F3A2C106A028B4, 0x0F02D8F27E798389,
+					0x63D46D22732F536B, 0x351B03EA5FFC2250, 0xE4CEE68572B69A19, 0x699EF51E048FD789, 0x44F809714E5E4655, 0xB6D50C14FDD89FAF, 0x218CAB8CBAC5E923, 0xDDAF10322B79113A,
+					0xBAD2585E162E7A06, 0xCF363F49F9D4EDE9, 0x9A98CF7F2A831FD9, 0x0666BA593FF46AD7, 0x14FB784DBC9119D4, 0xBE55CB0268699C89, 0xFE0EB1F8CA25C755, 0x0D957F7A0F429F4A,
+					0x366EA1FCB72A4F1D, 0xDD7E219488D9AC00, 0x6EC65BCF4BAF0C76, 0x4E3ADEBF7A52B416, 0x8FC00FA1E35679FD, 0x795E5F856C6D325E, 0x6210D90CD0663026, 0x8560ACC417714019,
+					0x2487AB98931E2DAC, 0x07D65164F56D300A, 0xCC35AD7505EF41DC, 0x72CF3BD10C5AB536, 0x3AB6B6C2FFE9F770, 0xA8C4C3E1BA496040, 0xA6D8F1F94095B60D, 0xED3B52CA93440688,
+					0xFD3FB97719D4CE5A, 0x9AC42F8F9C605C04, 0x086D11CAFADC5124, 0x8703104855D90F42, 0x63F63C611630EF95, 0x744CDFDEEA1199DC, 0xE41908CB705F152F, 0xEDB839E74819F165,
+					0xEDDFD8CBEC830592, 0x273CA5617B5642E4, 0x841B332EAE90279E, 0x86D53848FB187041, 0x40238906920A5F49, 0x26AD8E15E504AB7F, 0xBB700F728961A55A, 0xF17B38EA7555AE60,
+					0x0BA9068BD01FE001, 0xBBAA44571CE248B3, 0xD0CC110306FEB71E, 0x6840393FC8E9311A, 0x05179B6D399F44A0, 0xB93170D48656615F, 0x00455BDE762FF25B, 0x8FB71297E54F9AFB,
+					0x888E43040C9B11D2, 0x34BA9E2E0225D82C, 0x4FFE5C318BA1B410, 0x2C3D5D82285A0981, 0x7E6EB476605C0FC4, 0xC808C4D8B70AA0F1, 0x9E6579143EFE9C9C, 0x50716FBAC221A47F,
+					0x6AE4E076509ECBA2, 0x07B4AD0E6E850EE8, 0x165A07CF3C07C1BA, 0x961E1FEEE7B83542, 0x278E8ADBD435831D, 0x1A235E61C628F8CA, 0x7744163D5789D148, 0x2FACFD6C6D1984DB,
+					0x050E03A5E4798F2F, 0x4297A6D158874874, 0x4DF8B84193437505, 0xF351F7C570776B69, 0x70A649E8609BB336, 0x79ACFBF196286FE8, 0x0E38110C9DDE0694, 0x018F13FAEE3A6076,
+					0x0B3B1D2892341BC2, 0xA201B881C456D770, 0x328384FE7F4D8226, 0x8E0CB005FCF329A7, 0x3B0B50B8D2375B3B, 0x6EB6B5378B041524, 0x44D3CD25E3B9A51F, 0x9D4C6266415DD163,
+					0x789E18AFFB92247D, 0x5BAB966F53DCB524, 0x2F0A0E0245F29975, 0xCF55CC807F91E98C, 0xDB3E37216D577536, 0x56710A4464D4AC50, 0x19CFAFAEF8AD18F9, 0x225DD270F39E2E4A,
+					0xD51CD0BBE00E515D, 0x53A0B5E441959F8E, 0x5EE6C1493D1F64A7, 0xE0ED3320E8319C46, 0x902266BFCF98E9E5, 0xFCF24AE04CB96053, 0x9917762408712D98, 0x8DA7F120656B3B1E,
+					0x54EFA94EE255B643, 0xD4689E700ABBEE70, 0x19596DD184DA4D92, 0x3AA705DF49ABC6D0, 0x0AE3EF1726248CB4, 0xE7A90F96EC50F03E, 0x9E6401B32E89D6CE, 0xB122F234673BC7EA,
+					0x8DD6328A7B7E151B, 0x706CF0EE67C9E46C, 0xD17DA17012D8C918, 0x431670394BED34E2, 0xFE18590AAAEE90ED, 0xDE9666F1A57199E6, 0x7E4CC07B5484FA25, 0xF3E634A1A34EFC91,
+					0x154454A28F5B85A8, 0x23FC03FDEB58B03F, 0xE4F8748FCB14C72F, 0x5DC23F65CE1745F1, 0xC4C9507110D8F281, 0xAD2623A8C3D12807, 0x047D3FC4E52DBA77, 0x68E957EA722AD2B8,
+					0x849D455ECC0E86A8, 0x3C9E7FDF67B76942, 0x48C4D650CAEA4870, 0x8C49A984A43A7236, 0x9F33980AA8F795C3, 0x95A2486BD07DAECB, 0x465FBCC57183431C, 0xA698F95FBCF170D7,
+					0xC8F1982E315FED63, 0x89090725CEC139E8, 0xE597B9371CAE57BA, 0x17C05AB2F3AAB648, 0x740CCD769642F539, 0xB63290B4A0B82492, 0xF160EA54F9262D53, 0x86E7B315872A9F25,
+					0xAC6B989471B54435, 0x8E3785D077794335, 0xB1E04F98039C1943, 0xCDA0ED03DFEDC081, 0x473EF0E14D84D2A1, 0x9D04454BD20B65D7, 0x26E299DCA94F3F6B, 0x2262FBFC5ED370DF,
+					0xB30462FB33625869, 0x187CCA6D16E3E153, 0x4A4BD031A433121D, 0x14B968C57F185398, 0x9E939990567A3EC3, 0x97A146FE84E1EEEC, 0x9550A08B6AB82C7B, 0xC1FF61D7FC48C3E2,
+					0xF3AB053509F66099, 0x8AE988F741DA1F93, 0x415E90C2A49BD6AF, 0xDE8387CD876F6474, 0xBCA7BB39B128E0D9, 0x81115F98D6829BD1, 0x3DE7D9C7848D994A, 0x714A61986A99CCA6,
+					0xF838D2EC46FAF8D2, 0x533058F4E3AE17C3, 0xB455E8A50048BEDD, 0x86DDBF0A4931C1E1, 0x874B05A19AE71F93, 0xA540C631125843B1, 0xCA1D36BD6ACAB491, 0xEDCEE410FF699C4C,
+					0x5D8027BFF6F36967, 0x71225681DA0B7014, 0xE057AEB3A7D6991E, 0x973E14184C1EA0B6, 0x9F6C8D02C9EC6F67, 0x112DEC2B7D10F172, 0xE000CD272EE1AA43, 0x8CFF204CFC6D4D8B,
+					0x903EA1BB705FAABE, 0x80E79A886DD2C47E, 0x4AD2DAB6C732AB8B, 0x36E6CF315A097CAB, 0x8011B1CAB17F1BB6, 0x0C870CFD7BC14291, 0x65F89629634B3206, 0xADC3A8E5CBB92023,
+					0x6E5964AA7581E92D, 0xA0A3210893ABF611, 0xFDD2921A222C6395, 0xC8934998B6D4EB80, 0x43F8E2C982A4C1DA, 0xFAE41AC546D2DCB2, 0x4C19C79D3DA5DAC4, 0xDC386D3EA93C182F,
+					0x412BE368AD630753, 0x79BEDF381EE88334, 0x6E477685D4F51F7A, 0x5AB722D8013E5105, 0x6173C72B4CA245A4, 0x4DD22A7B787EDA08, 0x6791D7CAFBA861C7, 0xFEC60CAC50AF07AD,
+					0x5AAEB76496002DE4, 0xCD5D4840B1EDB69F, 0x297ED4584FB643BD, 0x1345D7B77FD9DFB2, 0x889C29F134A55270, 0x113A30A9A7336416, 0x62C06CC1EF366DF7, 0xF3835A03B4AE385A,
+					0x588B6BF402885984, 0x11862AC9EA1CAF1C, 0x7B1496EEC17B62AA, 0x5C548C7D65F9797F, 0x9E7A7ADDD4D0B954, 0xDC821B3CBBAFBB5A, 0xAF828C9E682551C0, 0x66B36DAD0A5F3E7F,
+					0xCAA84414CC6AD1DF, 0xA9ABE26718B4D78A, 0x5580CC0C8CCB8178, 0x534E9C59AFE93BDD, 0x663409484A8B6459, 0xED3DD394EEF3D444, 0x91E147777CEF5A84, 0xF1970FFCD7C82B89,
+					0xB5678F5E3DE2D27E, 0xC8A44AC9E9A4D0FB, 0x764405338E2B34B2, 0xB4DDAA4FC1C6877B, 0xBF40BD275951E2F1, 0xCE06BE56CCA618F7, 0x5EC6B0539F24E048, 0x1CD53A3A2F8134BA,
+					0x8202DEF972E4B7EC, 0x9B233532AA1E025C, 0xAD074B093504E9E3, 0x849EABA3B3CEB8AD, 0x17C8D9C9A6FA55BF, 0x6C384E7C9B7E3017, 0xC168726B97245B26, 0x5FA56C5691DB0CF3,
+					0xA76A4A6F804C27CE, 0xC92B344143F4CAFD, 0x99EB3574F9F6B3DA, 0x84FC2DC98365B18A, 0xA1B479AE323413E8, 0xFA5711179C272CB5, 0x9B6463FC39009384, 0x08A2744D3D584957,
+					0x7380F6A44876A944, 0x3BE9940399D89706, 0xFD578086A297C775, 0x890CCA874180080D, 0x507A18E868F53E6A, 0x2DE308F2D24F5867, 0x7C4F0FE06950BBCC, 0x475B816EAB3DF7A1,
+					0xCAA09990DE225BC0, 0xA2DA95F4E89DEFCD, 0xA549ADED4186EA42, 0x58018816006BF80C, 0xF63B4BB808079D3B, 0xFF63F4A9205D417C, 0x434099717110C1DA, 0x6BF34079A8F24FC5,
+					0xABE52122659AC3BB, 0xBC986FA5781F6D6D, 0x8CB869CFCF668D87, 0xF1866354641E8439, 0x0CF5BCB91DC84727, 0x7216F6F9514724E7, 0xAFC3766A49850CCB, 0x8E04D9DA44DF9760,
+					0xB31DA70B12E32A3B, 0xBE5912F589361CF9, 0x47A519C9B89219F1, 0x71A34AC3864F1981, 0xD98FFE1E4CCE7FAE, 0xED756938524A9842, 0xD5BEDB14790D452F, 0x3C6DBE090DBF50C0,
+					0x98E5E8D704001172, 0xAB0F940C08DE5650, 0x84F8AE1B1E4773A1, 0xAFD5B3D479887815, 0xAE779B034F266B56, 0x7C928E0CB50EA8A8, 0x38BCAC30B76012A8, 0xB3B60F1C6689E182,
+					0x24291C2A0C65F508, 0x66BEDD02BBEF43E5, 0x36EAF73E8564E15D, 0xACB4F76BEC1E8484, 0xE581D4749172098C, 0xF008D896B3C4B14E, 0xDF536D90640CDB10, 0x576507CA0C708712,
+					0xA154E376FB7DF12C, 0xAF0223D6F82A366D, 0x8360FA3F125B2DA7, 0x6D4BA87A465648CC, 0x233825AF5F896FD5, 0x000F662D3F76C354, 0x8CE05C1D4CF08875, 0xFFE4A3A239ECE723,
+					0x090C124158926754, 0x49395971D7C7B0DD, 0x92D48FA4CD73074A, 0x9CD72DAD88175950, 0x84FF35810F94126C, 0x464E77DBAAAE3C05, 0xF67879AC36FAE82C, 0x101CFEE806ECDD50,
+					0xD7081274F8FAB30C, 0x83F7C084C570B491, 0x02B1203DD5146874, 0x0FED246CD94B3798, 0x0C7212EA1C4B5CF1, 0x8FCB1CD64E08959E, 0x98D671143E4E2250, 0x08AB29B04AC6F955,
+					0xFCA03F69797F2AE2, 0xA4F45915E98B5415, 0x5E5699E304C50E55, 0x0D5F0E53CF19D985, 0xAF4107B1FA5E46C0, 0xC65641DE5F0DF543, 0xBCC672E907BD8603, 0xC54B2AF9596C7A48,
+					0xC683085AC400205E, 0x26186910CC6B9B65, 0x3EBA6042B642B3D0, 0x64AA901E37409D8E, 0xE23DD905F8538205, 0x4CA55988C3DD62C0, 0x68305E60D371A381, 0x5A1D9616FB60B951,
+					0x5EC3353EDDB0AFC0, 0x97D0CF7D77B96037, 0xFE519B2F73FBABDD, 0x5EB271835B5C978E, 0xDCB61578115951B1, 0x43C09AE5F947E565, 0xCFDA64F5584ACB46, 0x093D7FC2A76EFEFC,
+					0x5F0532E31ADF5911, 0x0061B8B4B223CBE7, 0x20E10802EF3C4163, 0xFB5ACA9401A5E7C5, 0x43908912968A1B1A, 0x1CDA62EA6BDC0E5E, 0xEC1D983E58B56768, 0xC3A2BA806B7279F7,
+					0xD8F20E4DB14C5BC1, 0xAEA92C8BDA1C784F, 0xE6D2F89B6CA280FB, 0x142B9D56F093A00F, 0x6B6536192E2E911B, 0x06243F4327FBD60F, 0x2908669FBDAFD8AF, 0x736145A009227C86,
+					0xC50777D5BC4EA9D5, 0xC49F48E7C710ECBA, 0x10784224C56A132C, 0x750703A5C781472A, 0x98D799F180A5E344, 0x977290313A826113, 0x51CB6C06176BCFE8, 0x79F1D5ADD0E3796D,
+					0x76ECF55DE7E630B0, 0x60C88F1F44B59EE7, 0xD91B09B101E74D72, 0xFA9882694B7C7697, 0x9F1BFCD419A43A16, 0xCD199AD5C62801FD, 0x34BCDD19BD1B37D5, 0xC6F6F7C1E2280E4C,
+					0x0F050DD649F62523, 0x4EE1C0755640A5A6, 0x42E2B7927BF9659A, 0x0B3F1B3ABEFBF868, 0xC84BAB00A17BA38A, 0x3A913C34E8AF6D89, 0xCF75BC9999030E1E, 0xB99F469F3348E71E,
+					0xCC463FB278EA6C04, 0xD1954EF328C10D72, 0x37EAE7F9830F5D99, 0xD3FB8E68396EC8B3, 0x23C6CC8A178699A9, 0x951A5CA3DF675897, 0x01D0C7E364C63E74, 0x7BF9793CD1E06DD3,
+					0x677A15520BCE5380, 0x0DAB10256252EA15, 0xC5216774004AD6FF, 0x784FFD5D900B2559, 0xC0482D342060FE72, 0x90DF3690422AAA73, 0xFA42B3AE4B578B9A, 0xF86FC5467F6A8003,
+					0xD06711F7CC5BEAC7, 0x7A95B54E724F2A78, 0xFA12543DF74A2A16, 0xEF007D2C24ECA30E, 0x94A840D0FAA64E0E, 0x5C4C07E3CDDD2C44, 0x8FCD3D7A1A531264, 0xCA1E7BD7DD02634B,
+					0xE71D52156C7AA1A4, 0x669A91A5A529557E, 0x8DBBE9D0E307D110, 0x50E6A285CF04C30A, 0x146D279448107712, 0x0E73B64BF913476D, 0x908CFF0BB7F4AA1E, 0xD0A20606FE34EE9D,
+					0x4CC52018A4067A6C, 0x6BD47C5453E092F4, 0x176A6BF626D1812A, 0x97E1619A5C8E40EF, 0x881636C133BADA93, 0x786EFF5561083CAA, 0x4420A86F7ED0E1AD, 0x6FEED6AEBEF1ED41,
+					0x3F1DDFC1C6DD673B, 0x9A33FFB442A7A480, 0x24057971575B34B9, 0x06AAB1C6A0927615, 0x61E96F13543D95CD, 0xE7890CBE0CA05243, 0x3E1C8992F321DF5C, 0x0CD147C77D056E70,
+					0xFAB75A1E34CE35C0, 0x2F509B33F3421F9D, 0xF7A5E7B2D645D18D, 0x515378B3B780D6FC, 0xCD9FBA3F810D8A3F, 0x933496EC1DF81FF0, 0x605EFE6DEAC850F4, 0x1AF7B3BDA1D7D03F,
+					0xC22464C250D6CD7C, 0x7F365D25EE0E4D49, 0xF34302092F942C45, 0x018CE71097D8ADFD, 0x29BD558FA52DE6CF, 0x8A250347A9470BB0, 0x81A16EAC385C0E5B, 0x52BC893E538EA184,
+					0xB5615DA763E2D298, 0x6697FBFEC25A61BD, 0x4C191FE9E1EE1893, 0x2EAA11C5F22FF896, 0x9E41584FE0FB5130, 0x2306DCF736103A9B, 0xE7CA0B0D93E085A6, 0xE3BED26CCD17F51E,
+					0x8B362AD314D656B6, 0xB7C2585FA8042344, 0x38053C8EEE894B8E, 0x93F89FA7F1C2E853, 0x7891EFAFBF4DB667, 0x56556FB410CBD140, 0x30BF0FBBD7983172, 0x072B386DF70EFC93,
+					0xBC7BA6AE33C0F0F7, 0x5E75A21CFD70CF4D, 0x9C2E26CD764A7DD9, 0x2D78717D12BF9D07, 0x4BBA0CD2F90B9D5B, 0x889C7728F531B46E, 0x79D9B0F4F608F4D4, 0x155D27B5A3C8CEF1,
+					0x9AFEF6B6F62BC5BD, 0xF2A3EF37D0868362, 0xDDA9352C71246E74, 0xFD6D960C70EBC4DF, 0x2E431DF98C382558, 0xCF9E8FE98D30E4A1, 0xAA3D7345B859B7A3, 0x2BDA4893514BC3A7,
+					0xBF2D90AA497EB608, 0x8415FF7639810D9A, 0x6C91B7A3D89610EB, 0xD063BE562331C2F3, 0x0EC6F87CABFEEE7F, 0xBC2D7F5EEAC9DD36, 0xD930FD9C6242EC0D, 0x21356A1E0405B584,
+					0x280805097A91BCF5, 0xABA8B6AAA730BAE7, 0x586B3B3AB51DD25D, 0xFC9985B73B827C2B, 0xA7A0B036481A4180, 0x160827EEDDC3E086, 0x4179321C5BF8719E, 0x0EC0097209429B51,
+					0x86543FF9C8550610, 0xEBC64D0D66FF83F4, 0x288B65EBBE6D7EAA, 0x86D898377C29081D, 0xAEFA1C8F4BDB6196, 0x557AB8E3C2E65FB7, 0x2AE9BC31944473EE, 0xF9C8846A7FAA22D4,
+					0x318B659DD9B6A94C, 0xDBF4F2FA2D0E6DBC, 0x10948A3230C09361, 0x4EFB9DD786B60831, 0x87631570E2776D3D, 0xA42EFBD4D45C6859, 0xBB05B9358BCE9328, 0xF546128F4D389DAA,
+					0x6ECAA873CF3002AB, 0xBA45BCD1179A6DEE, 0xAC85A1458EA31B1C, 0xA55F7554425AA530, 0x7025B8B4C535E785, 0x80DD8F8269DFBFDB, 0x4083E7E89735C035, 0x07DD1CEA4BEC5255,
+					0x886A4B2122D0CC27, 0xC4036CD4CF8CFA23, 0x0E313B8213AB971C, 0xB299A088C090114C, 0xE930D24A162D1DBA, 0xE71AD68214FEB60D, 0x366E822915F5B329, 0xEB14EFAAA2476E53,
+					0x537559CE3ADBCA9E, 0xCD4151103E790380, 0xF2CF8FD3BB0D9E1A, 0xAB1248903EFD5605, 0xD834BBB4F1B99B8B, 0x5347FBE658915AD5, 0x8BC488B548FB6402, 0x0160AC71F3C22519,
+					0x5E6DC72AACD9AB70, 0xCB6B040A26C81223, 0xCD5A47E6320D755F, 0xF11BBEF466CE3D81, 0xAD00375D1B007E2C, 0x6EA3B51C7C79B4A6, 0xF233FD6EC5FE3F7F, 0xA1710110331068B5,
+					0xA45E0AE039055FBE, 0x4CF31B863095A38B, 0x0CFB9D8B73800E98, 0x2A80BCB1AC01A582, 0x3EC8FB77A345A8F2, 0x9920DD56E430A6C3, 0x3E46DF8EF2138A3C, 0x778ED680680724E5,
+					0x9794B5BB5D3DD64E, 0x2714AE5E09B85EA4, 0x5644CEC07B4379D7, 0x8898176B03B5C806, 0x2E22BE93EA18CB9F, 0x29FD8A2452091AEC, 0x369FCFD8D66F494F, 0x252A8D68F94AF717,
+					0xA68D80E38963D2C5, 0xD0B617CEF9ACE9B0, 0x7A5333594868BD3B, 0x052276C4BE9FB572, 0x87AE885CD94CCA52, 0xD61293435659C34E, 0x5CCA2E6862FD04E7, 0xE40AD52F0E0557FE,
+					0x1B2E9CC14DD97D3C, 0x58E2BBBA9A244260, 0x64DACE6FA0F94C25, 0x2C235AA8BC4F9A59, 0x30D45204E079AB77, 0x80C126FE8BE73360, 0x149010B8338543FC, 0x9B8143896C5A5F91,
+					0x413EC380C6D679DB, 0xA3ABFA68A5132A31, 0x95617F01955745F1, 0x56D1F76931B40EDF, 0xBAB6BEF69FD82F68, 0xCA1895B15C53751D, 0xB8281E9E1AB2453A, 0x7A862A02FE171BDD,
+					0x42B8100C2E3FA83B, 0x342B96EF1AD8C92D, 0xF938E4653DB90505, 0x705AD5A7CC9FC0AB, 0x1105EA6FFCB5458B, 0x65B54634AB95F269, 0x28A0C8909762EB43, 0x29881C283305A63C,
+					0x88FC2710AD5D68D6, 0xF916D40AAFB6ADA5, 0x03260B145037F565, 0x7B3359C2AC5AF205, 0x88C8C0140E729BB4, 0x0F9E03F9122CEFBE, 0xD01BF32DCD7634B1, 0x7D1FD2DF779B5472,
+					0xE0E274483C50578C, 0x4C8C2E9C749355CA, 0x50DCEB641DBDF570, 0x9F3714121119E48D, 0xA256F60344858F9A, 0xCFA3827DE5EB9944, 0xC7BFD059D5339FDA, 0x7BD825B2BC673187,
+					0x16948216F6A6AC1F, 0xC2431E112F85FE48, 0x5FA8302CC30E4849, 0x67FCD72D6A803DED, 0x96DF4B43C760DE6D, 0x9CAFC04D2BF748B0, 0x33419E0F81257643, 0xC4C00E967B04D38D,
+					0xD1BE0BC51A688BAC, 0x8CF050B3B473201C, 0x24EBF1B7B260DDAD, 0x8F6E84100FDD497B, 0xD333BE7EC2184F47, 0x666D26A15511C8A4, 0x33CB171CB20A715D, 0x8F6F61A45349303B,
+					0xE0B10A89A7829BD8, 0x8EE60A76202993EA, 0xCB1DF59E34519DAE, 0x50BF171B84E7CB07, 0x35B0214F8A6C2141, 0xF4F04B0545165D21, 0x45D188D0BA921AFB, 0x3031ED91515ECE22,
+					0x1EFEA864193C834D, 0x51DA64BAEEFF8FB9, 0xC74163574D76DCE0, 0x89CAF2A6EB3BB85E, 0xEC68AC778DA38E2D, 0xA24A066852C365BB, 0x86B5DCE614A491C6, 0xA3F7A7CD31F649EB,
+					0xBB81E0C303176167, 0xE5A2DF8FFB358569, 0xD40DE66156A67DD4, 0x2CC4BB56474A58D1, 0xC2F9E28F9B1606B3, 0xC30CDD484A1A0FCE, 0x1C77821FDABC3B30, 0xBA521CBA65C66733,
+					0xF2F0385A1C7DA535, 0xD6A4CEDB6DA520BD, 0xF1C3EB4821460B28, 0x756BC7F68E6DD33B, 0x864CAD3F32CE571F, 0xD37C3BCA0116411E, 0x85E663547B0DBC01, 0x6F2808B9FAC3EAAC,
+					0x62B94B00313F3C35, 0x236EC7F4DCBC1673, 0x8B731A184CBBE761, 0x15245D500AE7E17F, 0x14BD7AACD6EA0D61, 0x51A40B58F587F9D3, 0x282D39AAA8854BE8, 0x783897C5D3558DB5,
+					0xEC8060811B5C0456, 0xF3F9C0D9B53CDB48, 0x0D8EAD4C79059E79, 0x21B2A233F8098FFA, 0x86DE33C93FE2B3A6, 0x9DE9591FFCF51C48, 0x8D2C03F2DA6A3C6D, 0x467AADFE66BDEC8D,
+					0xE2C09495AFF9B544, 0x771CD67AD816A0DF, 0x5077DC40BA211F67, 0x4961EED4BA4BB351, 0xD243800087090589, 0x8D6A8E8F8029D62F, 0xD1C0FA84A0D29150, 0x85A2E9A9AF8BB81D,
+					0x7D96C78D0C8E5433, 0xF7EC40814D04DF4E, 0xAA7E910F1C6046CE, 0xCC1C2EE66409D26D, 0x2535CB6AECA0342B, 0xCAC5C1DE12467EBE, 0xA2D11568FD917608, 0x396960012BA30A2F,
+					0x1B77B4E18CC6EA81, 0x21463A5F64E59550, 0x95E10F11BD8B7B24, 0xD7291FFC58D04B0D, 0x270360FBD71725E7, 0xF0CC421DDDE4B3D4, 0x57C15AD5A39AD3F9, 0x0BCA21FE64039AB4,
+					0x056CB3528252E8D5, 0x3B8398BEBE212214, 0x499D11B2C632E83A, 0xA1E78CCAD8331F0F, 0x6951C21D847F7ABD, 0x5AFF8AB140190825, 0x7E4ADC7C86E6F3B7, 0xACC7FF8A31DD27BE,
+					0x414535D3BA67C128, 0xD00F3BFD14E7A63B, 0x8886EA4C2688412A, 0x883B98643CE90FC4, 0x46AD20F13ADADEF4, 0xDF2063316981D251, 0x95B7AFFD072535C2, 0x811E6950FF12F7BD,
+					0x12E3699B188EF61E, 0xEDA0A075E7E34597, 0x266A8671FA941F84, 0x6CB956E08574E157, 0x9CAF4DE4FDF96A30, 0x29986550FD2545FF, 0x6AEF4626E953CAAA, 0x163A8D306E3CD0C4,
+					0xA35292D90E3CE2DE, 0xDD1F17DBE96A9E61, 0x417C30942D549118, 0x90930F6990D179E5, 0x23F7CAE74B25756F, 0x556E32C0547102A5, 0xB90D304C04326919, 0x68F4B6811DB861A3,
+					0x556AB841A5A6065D, 0x6A2269321FB9D73B, 0xF610A632B58626BD, 0x327C12B200DF20EA, 0x916DC6CE827FD3C2, 0x927C3B4158AD8390, 0x2C9A8B4738CC2D43, 0x0A6E71F185D0BC57,
+					0xDD785DEAA9A96A76, 0xB681A6BC4B605253, 0x1E8A5EFFC1A4A119, 0x801C62C7BC01E3C5, 0xDFC904D56055049E, 0x7A08FC54519D5222, 0xCB6BBC539724FAE4, 0xC59652849752E6A6,
+					0x8E21A80D6EB2F5C6, 0x6D5511777D92265A, 0x0199AC987DF0E209, 0x4702D9FA0C03C753, 0x8E918B7D1FD7F67C, 0x1440A4BBBAA5FCBB, 0xBF1CC73D0C5C0F6D, 0x91EEDCB8321F99FE,
+					0xEC9B2457070AD63C, 0xBFB8F015E2846E0B, 0xB9848AD4E36E695C, 0x2F2BC5DEBABB9F9C, 0x36107E8B802885C9, 0x9E266AF98234EA09, 0x0B8707DE96739299, 0x99020B9D9BE3ADCE,
+					0x790186EB6B414A84, 0xC078E47B2E332D86, 0x67E89546FC5DDDE4, 0x327045C650B59E2D, 0x9F89D3194E58519B, 0x946751FF55D4C6C2, 0x916DD5B16FAFD7F2, 0xC774FF933ABB8102,
+					0xB07251E4FA523B3D, 0xC13E894F82263486, 0x78D1E189427925DF, 0xB8CC14F8EBDA5E9A, 0x916231F8C8E09695, 0xA4D8F238ABB51821, 0xE19BCABA17E76C5F, 0x609FDD79E6F1371E,
+					0x1A6AEC7F15711FAD, 0x5BF37BEA53BE3C92, 0x07693C2840C6D889, 0x2B0048BFF0E1D70B, 0x383C65822E86DDC7, 0xA392A06F431E18C4, 0x1ABC3451C62E9545, 0x9A772A444E0D4318,
+					0x8F1DD54A0C176901, 0x94D46D9FB11E94B4, 0xDE139118F7B69316, 0x4713A9A657B24595, 0x73906D96D08B54F5, 0x24AC883EB6FEA6C2, 0x6E6ED1ECA83229C3, 0x6D4350212EC21F50,
+					0x17FDF66DB32D8D48, 0x56215006B53A3667, 0xCBC37C2AA209CCD2, 0x1D64419DA2BB5871, 0x791CB25A967E7DC4, 0x4D8703E43F6BED1A, 0xA3788110EC3A2733, 0x24ACE02D2F5E844D,
+					0xADEE33DE68EC8255, 0xDAEBF06CBC3A5540, 0xDBF3CBF9263F614A, 0x457D5804ECE2B075, 0x08EBD788C2911D90, 0x6194B50F45491F26, 0x70E3A7C63AEC765C, 0x66AA209B4FDCAD60,
+					0x04B4AD634FD32B66, 0x8ACDB809559881F4, 0x0536A615B8D22941, 0x0A53E722F2B48ED7, 0x3A70151E007E5BBA, 0xDE8FD73FE1012F22, 0x48ACDB357AA30BAA, 0x4C954A0C400F8274,
+					0xC5E57601CCD736BD, 0x3A60E1D8F5BD2D97, 0x2E449E7A42D599D0, 0x0274FB86E70F8A2A, 0x40735A9957E8E07D, 0x0D98C8F3066713A7, 0xBC7D42A33FA30D61, 0x7A59CB8C0FF51782,
+					0x945C8CE814D45FF5, 0xCB1D08352266E58C, 0x6B4A73A723719C12, 0x90B7A9FFE3BABA42, 0x85DE28A1B1DC1F9A, 0xF3CEA1FFDEB03C07, 0xCDE9CFAC0A960CCC, 0x1855BEA27902BBEF,
+					0xE303D7253D30F769, 0xA3D27C48A66871D1, 0xF982CC8AABCEDE47, 0x5FE2295FAE4BBF2A, 0xEB53F2B82331ED52, 0x837EAEB32647BC22, 0x52388B3B79280661, 0xE615850054BB9FB9,
+					0x9EAB25BB18654908, 0x03CE5C9A7256C94F, 0xACAF28749ACA6AFE, 0xF8A1D8D24010CA3A, 0x100813BEC99D901E, 0xB1691F8672F25B8D, 0xE3DCFEE28AE54999, 0x3B5DBC2BE577A142,
+					0x900D7BCE8AC1E81E, 0xE1F3157F0EECD8CA, 0x6A064EC643D4D921, 0xE83B6C3452981E85, 0xDB072321FC51E5E1, 0xC7FBFE8F22355C76, 0x791B29F01B964A99, 0x2891C4663464BC34,
+					0x5771A4818F7EA860, 0x534B6E8CE7895163, 0x4C324962184E3934, 0xE27EC5FA94EE970D, 0xBAD3DEAB51CDE669, 0xFAFB60853E3A4281, 0xC6F58B5ACBA85F45, 0xACA1533799F720D3,
+					0x21865FA011C3F07E, 0x9B13F8FA4B83499A, 0x7BDE18B09AAF7611, 0xCC334DDC61055C85, 0xF8DC91AFDFB39C7D, 0xD834C787327C46A1, 0x83262866092AE84D, 0x5FCE70C03DB5F542,
+					0x4F7200974F460128, 0xC612F38BC085B007, 0xFC3278C6F97A310B, 0x776D5512DF40FD3A, 0xC55CADF5CD959DA2, 0xEA07BFCE8AE4E78F, 0x2D0933C2705C494C, 0x0DA4E4BEB51B63D5,
+					0xE431F13A1FFD8825, 0x7AACFC1C89600BC1, 0x38D55881FADF5409, 0x1940E32DC730621E, 0x321004542282D5C9, 0x4C02EAF245AA5BBA, 0x3CED2E418FFE2539, 0x08C88A80143E8150,
+					0xA38492E158BE3C41, 0x8B64D18222494901, 0xA58C1904DC28079F, 0xBA46233133BE4352, 0x56FB2FB113D61AA6, 0x6109EF4AF645E9C9, 0xDD13F8B0A1FFA209, 0x2A0EC9D3D11C7E77,
+					0x4EF946D7FE6BD4C9, 0xB96A7B7E119BA4FF, 0x94F13F0C600259F1, 0xFB1C065E277B8B1B, 0x2AE014AD41FD3269, 0x0B281E5E8BA185C1, 0x1353816A91B850AB, 0x63259D7557D8C63E,
+					0x9394DA53BAAB1DCA, 0x6169B3DDD12A2CB0, 0x45EF92F907C5F567, 0x3543364A67C5F2DA, 0x7A30689B2B4C4447, 0xCFAC441D67127A34, 0x2822DA564E081E9A, 0x2BBC42A1A434CA34,
+					0x01205D7A6DFAFE13, 0x3DD79866A019EFF4, 0x00564E98C3F234E5, 0x025F7D4BC3C355C1, 0xBFB96850DC0484BB, 0xF87245FC8AAE93C2, 0x15D2F13B0092F8C8, 0xE7996824D7047EBD,
+					0xF364A7AAD0C0DC4E, 0x7DB4BB86E2410CF8, 0x0AC1EC5B8DFE1D5F, 0x3ABC42CE1C2AA4BF, 0x9D4C969EB64F9A10, 0xAD5073A64FA9982E, 0xF982D46D7544579F, 0x5414F726C5BB0D02,
+					0xEE68BC39494493FA, 0x7AC28055F14939CD, 0x487E52830F457F13, 0x20B5205C5F85BD7E, 0x982821C9BD8BE216, 0x0232139374B770C2, 0x5D68A73ADBBF864F, 0x9D0E9AC6AF555628,
+					0xE6DCFB85BBF88665, 0x15EEFA3075375956, 0x26C675DDB91FCF31, 0x30E4F883F9370FC9, 0x6EB79BC488B94959, 0x803CA81D34706D82, 0xE4A1DF24BAE44BDF, 0x8C5D12E072C4D1A0,
+					0x1E46E3290579302B, 0x2E0DB5285023D698, 0x074D7439FF8EE54D, 0x8CBEFBCF80FD44C9, 0x7CF381BFACB031FC, 0xDB0CE428F59C5EBB, 0xA4070197CBEB7A8F, 0xBAF9E32E116E7AFD,
+					0x5DFD420DAC77C115, 0xD508B94F180F469A, 0x99B48242A0A79E1A, 0x034586A6FB4F33C2, 0xBB80222F655F7FC5, 0xA48E681777C3218F, 0xC7283A9286145672, 0xA50000FB3B3DF790,
+					0xABAB220B7F8FF244, 0x1C2764B10BB91C8A, 0xCB5B422F4867B62E, 0xD2B217155E89DB4F, 0x5B86F3CA426B628E, 0x9CA897BD947A1C4D, 0x35A8776E924EAB73, 0xE030A001AB0EB8D9,
+					0x85702124FB0F6B38, 0xEB08EB867364F201, 0x15C3A6EB2EE5DEB5, 0x0ED39C6B3049BBDF, 0xF3C41B89FDAB89AD, 0x58A5382F69E2D2CD, 0xCC449F2835400D1E, 0xDA4A25629ACE0065,
+					0xF1D0E3A1E8694E83, 0x54DB61EF7EAE7F6D, 0xDC10C8FFCB2CC829, 0xF0E8FCA9CE10769D, 0x8A982A6C31A49B92, 0x0FA885868A64FB9C, 0xFB18C1980AE63DF0, 0x125951740A5C7429,
+					0x754281B880D8B704, 0xE38ECA00B54DD7D6, 0x4C720982A338ECD9, 0xBFB71A52529FBDBD, 0xF888B27537F896DD, 0xE666676AA329AD6E, 0x02C7513BCDFD6BD7, 0x9F3A0FE7068D4CC1,
+					0x28246CBFD50B52DD, 0x6FA572D714F579C0, 0xBE7887954BAFC752, 0xB5926AA3A7D1EE6D, 0xE7A26FFEE5450145, 0x3035E150C4C7E74B, 0xF4E89F7A8319B097, 0xD2465AF51F9DAA29,
+					0x77AD8FDBDC2DE241, 0xC84C0B4159AB9FA6, 0xB32A1313E6B8D8A7, 0x654FB0423AEC5477, 0x66CFD33DA8CEF20C, 0xF4CC2F88C621FFC6, 0x5B4F2DF812CF4988, 0xDD8754C122253F9A,
+					0x5FC39B836125D523, 0x206B7DAE2234E95D, 0x5D0D2EC38D5F304F, 0x047C8DAF19919859, 0x19138144E3ABEAEC, 0x585B98795FB0B765, 0xF41227A4D5102528, 0x00099FF58B945505,
+					0x1FD50A3F8300F149, 0x4B288733BE456F46, 0x42B4E810A33422F7, 0x0F7F8FA5FCBEFB0B, 0x54EC0C35A534F1C4, 0x8D00F631EFEBB0AA, 0x897128FADEA8BD9E, 0xF6991AB42C9526D9,
+					0x0EA05E6D815F1C69, 0x27E46EBC8E086FF2, 0x8A041F06E2516937, 0xF336FCA6E2529FAB, 0xC9350016A56FB4FE, 0xE7DB33F0C2DDA96B, 0x046E6DFA4FCC354F, 0xFAA6BF012D6C22AF,
+					0xEE9A0EAC1C7DC997, 0xE893FD492801D98C, 0x8B391E158E7E98B3, 0x6A3EDDB5DB6D2F77, 0xB7E2147C98865BB9, 0x2944D95823090EC6, 0x154D04F682DD578C, 0xC9916356B2432F7C,
+					0xAC02A01161C2BB8E, 0x4858782A38A6F838, 0x890A04B665B2F55E, 0x7A98FEF5F6E34C81, 0xB834D2EFEF059323, 0xE8AB3FF2251C5727, 0xD62C9F9E5F3E8545, 0x6B8B1E15213EBBE7,
+					0x2E2734DFE78F9D67, 0xCC31B6BB1872C223, 0xEA27E5AEF95F296E, 0x27E252099AADA068, 0xCE1BB6921F5A18A6, 0x700E04618AE8ABAF, 0xA3DDD9B2849F46D0, 0x3ADB5342BD0B4DB2,
+					0xDD7624A0DD3C857D, 0x0275E3D9366BBB81, 0x2B64E4BFE86F930A, 0xD38FD506CCEAA9D9, 0x8C6726123F9A6CFA, 0x594656F8BA8ED130, 0x669EE56ABD581D2B, 0x37D930A6D84ADB4F,
+					0xD51D861688BB43A0, 0x3B6E678D79685774, 0x1BE35DC14C823A75, 0x0798BD0E849FC674, 0xB1489706A3E4A312, 0xAC6B2507E6890DD3, 0xCB6417112FB4AF02, 0x3841FB294DE5E1BB,
+					0xA5BD1C7CC0BFA13F, 0x53FD4D03F22C4A3A, 0x4C1FC0A639FCEF71, 0x5D82EE21C252279A, 0xB48D6C8F9C029D07, 0xEDD98D3904BEDA45, 0xABEC53808EC4FC65, 0x2184888B0201D91F,
+					0x3E11B143F33A3196, 0xD0073A42218E50D5, 0xD9DCF3747A2E6D5F, 0x56DA28E49BBC08F8, 0x36A65F3B7A9A04F5, 0x267D7420310F926D, 0x4700C4203071F689, 0xB6DAD1741807B155,
+					0x048FA8E8A9006717, 0xCCDAF11C1DF6D354, 0x856E99BEEC1647CB, 0xBD6B1DC98D8859F6, 0x005A64FB88607458, 0xCEA39D0BF8CC4099, 0x02B294CC847E9E5C, 0x9CE32D7B79E8CE43,
+					0xF1E1BCEC9BCB7E45, 0x0889993FBE27798F, 0x51B350F5A6A58E06, 0x9C442E32550BC6ED, 0xA675CAD380E07D82, 0xA8C21A449EA76C46, 0x25A6ACEB2EB31F8B, 0xF89BFA1EFE3D2B99,
+					0x5A6056BD894FECF4, 0x3363A15D1225700D, 0x68E4028E7A6D12E1, 0xD244E613025DEE41, 0x2AB77E4D993BD85D, 0xDFEE9C2AA641CB20, 0x0D3DFEAA42EC3F87, 0xB7EA6B137B52C5CC,
+					0x3B85CDA630D3B5BB, 0xA9F345BEE2018A3A, 0xC35538FC3DEBD584, 0xB4B8493F1B2ABB7A, 0x33C1753A683EFF60, 0x1EFBBE37635B47CA, 0x3481E4A3A710FC95, 0xCB7AEFAD5CBCD48D,
+					0xCD5D9DB3C74D22BD, 0x1656AE1B8CB4F6EE, 0x8DA5CAA924A9E13F, 0xC1520A6A597FE50C, 0x5F42687A2757224A, 0x2A6CCF544F1F8359, 0xF2C05D02826567DB, 0x3FD239B124CDF126,
+					0xA88B3F2A234D91A6, 0x60836C4F1BF752AB, 0xF62F8D4DBB9C7993, 0xC4B7E2A481EAC994, 0xF433320894FFB12A, 0xD3F24D02FB2E9395, 0xE70F0A091DFF443F, 0x03C12BCEB38382DE,
+					0x27EFD04F7DEF24A7, 0xCE7DEBB5010A55B8, 0x1E569CF56A624FC8, 0x16A858ADEA874EB1, 0xA99E889252EA9D93, 0x63573C25F22A42D2, 0xF25F0D45C4CD5C41, 0x3B48529356C6A4F5,
+					0x5374EB5B20442DA7, 0x9861376CD0C87912, 0xE2773754FD2B6039, 0x54D623BACF11E206, 0xC816EE70D945A4AE, 0xAE70F9A5E678F5FC, 0x68F89F6B807DA74F, 0x5FA1EB2E0199BD71,
+					0x59BD59E47B2D393F, 0xF42BD0215B6EC2FC, 0x85761BD8911B580C, 0x25F741CC905821A8, 0xC56C95673CFCB0F8, 0x381A51B15D87A50F, 0x080438CDEC51CA47, 0xFE23B80B55D6F600,
+					0xDF11AB31C496BC3C, 0xCF8DE1FC7DECCE12, 0x535B2ECBEAF2DD4F, 0x3210FC1D1FFD13C6, 0x4473D67B2998C7B9, 0x8137DC266CDE29BB, 0x08B2E2AAF86E9C96, 0x699EB286F011BC54,
+					0xC99A67AA29D40836, 0xBFA9F849D4310473, 0x183217A8D54D5E31, 0x4E872AFBCB2BAAA2, 0x8404978C598F6EB1, 0x81AA3824D960F49F, 0xECD1726FE83259BA, 0xA9DF81CE8965E488,
+					0x659F657A70488040, 0xB8488EE2B36F893E, 0x98BE715AFB6EBDC0, 0x5906FAD6612461A3, 0x0CA901B78C68434F, 0x323B8BB57D2DFC65, 0xE8F8D7A5D1265F3F, 0xBB6441B7C8E22E6C,
+					0x96BF6A19904D40C9, 0xA1A4D459F9008CA3, 0x47991D82827A3E94, 0x173A4F85E73ED81C, 0x927682CEA3B9813D, 0x6C794ED8FA3EEEEE, 0x3D1AFB261C31A086, 0x13F73D665E9AD0A8,
+					0x9C22E7197688A295, 0xCF26F98C2FABAA25, 0xB3A8A54A3C976E00, 0x619D23BCC304A776, 0x72E085A648D990F2, 0x94E116778C2C4983, 0x634A0CF8864DCA3D, 0x4FC8ACEFF7DCD037,
+					0xDD0A1E6E094CC9E2, 0xFF90203987B4C9A4, 0xCC734AD3CCA415B1, 0x210B23F19BA8301F, 0x9608F8053A5E0764, 0x095EA845BBACD2DA, 0xC7F2951EA37E9BDA, 0x0F57613394A44C55,
+					0xB1A87AC7254DE6F9, 0xED71DE399CC682A4, 0x3BF849A4E2D7A418, 0x3BE712D32C77DE5A, 0x972A16010EF24F04, 0xA467701106BFE4BF, 0x3C3031EA338038A3, 0x794CF9BD97B490E1,
+					0x9253F118A40AA631, 0x1DBC1A618DDC0042, 0xE5FBAD15E21C90EC, 0xB7210AFAC1EBBD57, 0x3A679C2B9DCCAFD9, 0x7420F2081C45F24E, 0xEDB97CC2CF2E9417, 0x95357EEA7E23B351,
+					0x04B6A1840313DBEC, 0xC5F3C456621F19C0, 0x4D3DB8C6FDF6DA0D, 0x2FDC8E90AE30853D, 0x8746997D21DE2A45, 0x06069D10DAFE6120, 0x900271B0FD78DA2F, 0x0B8DCB83C8784042,
+					0xC1FAF8BA25F2846F, 0x88F35F01EB890203, 0xC51EAAC85E50A77F, 0xB3E92327A13EBEEC, 0x2FC921D8CE0AB32C, 0x457F0D09FA87A9C0, 0x42077FFE0183FE25, 0x360DFD607DA095DB,
+					0x3503B95917762C0F, 0x7A8946ABEED9D864, 0xAA7A7694ECB31EE6, 0x8B8F3F63D5F5F179, 0xD63BC69500985E7B, 0x44818977E0EB2FF4, 0x811A17809802BA1B, 0xE26B68B104796155,
+					0xAF2027FE19E7AC5C, 0x44B1152CF7305D28, 0x48FA059541F7C784, 0x8819D29BC81C1099, 0xCAD05B3B1F8FE312, 0xE8ACE1ECFAC20644, 0xA16E225DA0A9FA6F, 0x05C5C11FE1318D1F,
+					0x26B947F5BA942555, 0xAEDAB24D55926AFD, 0xA5E7BA063F11E897, 0x591C1D6C0877CEB9, 0x03D56F597C811A0E, 0x8C67C7B14D3AD3FD, 0x85966529D886492A, 0x187C4A00F1650C29,
+					0xDC04F1801202B64D, 0xA475684AC6E50302, 0xB562214D62380466, 0x412384E26866014D, 0xCB389B2730D5E96A, 0x426CCAFD6946DDF1, 0x1ECFAA1E2F7BADCE, 0xF5095B2FD0EC3828,
+					0xD8F761F1C3B078DC, 0x465A59776FA565F4, 0x08395EC298EB0BE5, 0xB6122A760F9A882B, 0x4DBFF4497BE1A248, 0x4352598BDF4212E9, 0x13D2030B88B12911, 0x08DF7599E68FBDD6,
+					0xC288A406E495AFBE, 0x40BDEAB51ED5C3C7, 0xE985521C307588E8, 0x5F13C77C83BD4D14, 0x0239E211946300DA, 0xA07733CB0B5C19EF, 0xBBD7CD47219B7B9B, 0xB67B205560F05C04,
+					0xAB2DE9E4B3864C43, 0xC044CC210513A526, 0xBB81030B3923EC19, 0x33C71EB022B33352, 0x0EA2A318D59C4BA7, 0x256AB11D0AA35730, 0xCE3273C9BF915FBA, 0xFAF04695B3E00BB6,
+					0x897F236E77B989A2, 0x6749544B4A1A6091, 0xFF563D76F4972C25, 0xC8D16734A1753847, 0x9948C916A518FFDD, 0x5D1831ACD65D78A0, 0x6D55FBDFE6986C6A, 0x6FCEBFC20F423DAB,
+					0x4EDA9A8020F9F361, 0x6660B9C7CBBEBD0F, 0xD067FF1FB52C035C, 0xEF84FC5FBD0964D3, 0x21A7D739CB8405BA, 0x22BDE65863473A4A, 0xFACEC277913F6CA4, 0xCA8C0F02A3126661,
+					0xB32E2D4625D23CCC, 0x468F55992796B510, 0x14F76375964A713F, 0x6BC98BBE7CF95F0A, 0xEED042F26C3C2B3C, 0x3EF3B38708921E0D, 0x988DF657F80242CE, 0xE0AED5F51C912BE1,
+					0x2B889D73F88AB5CB, 0xA3B5533B7BDAA7BA, 0x6823EE2CCEFDF74C, 0xEC6CC90214024B87, 0x362A20A9843C8260, 0x447310712C3A2605, 0xD8726181DC7A6EB9, 0x52746F3C3A101C69,
+					0x8586B5DCBDE02FB0, 0xC53F1E794724D1BD, 0xE1827DCFC4A6C165, 0x87B4886CA9B25EA8, 0xCF88F0C9CFCAB250, 0x3620DB5CC159A621, 0xF61135008151A1A8, 0xB0FFBA6777991187,
+					0xD9B6C11C81FF43CC, 0x36D24E674C1A5B09, 0xBEE362EC0B89A38F, 0xBAEA42F5B16A0F5E, 0x128EED0A0D281A40, 0x1BC84A781F808624, 0xFF0D59502562CF98, 0x27BA94C765D4E667,
+					0xFECEA1922BE2DDDA, 0x4A16627E1D7424ED, 0x57F33D537A472070, 0xAEFE08236168C91A, 0x1D254DD5E6D85C70, 0xC073AF307D8FBE2C, 0x2BE7363574FAF9A0, 0xACEE8681A96A1A60,
+					0x450D98A71601785B, 0x362EB79A569A23E8, 0x386E28E496577AC0, 0x264155F341EA5DB7, 0x6C25D379888B4EB3, 0xD91C607F7C7E33CA, 0xC312020E8648AFDD, 0xB67122ACC4FB7179,
+					0x362FEB7EB7A2E18C, 0x989767B57E8C781E, 0x07F1AD8FECF040ED, 0xC7C98C625A31CEFF, 0x034FA7A2F0D799DE, 0x7067C64F88139556, 0xF4A3F87A0626CB9C, 0x5E10B8C082E451E4,
+					0xB853C639B36546C3, 0x2286560264FA19E3, 0xB7FD9423B9B92713, 0x002FD7049B9C9530, 0x74224D8EF9E953DD, 0x93C7E1E94AD7F1BA, 0xFEC2AF7622C75C8D, 0xF891C68A9457EA0A,
+					0x1E35C54BF3494C2C, 0xFEE1F9CFF58B5745, 0x5FDD0262F658131D, 0x0CAD563C29F48738, 0x83806B920B5423EB, 0x13DF0BF7DA3EAD0F, 0x11C5BCFA62F8F8D4, 0x7DBC5977EF19E7C9,
+					0x9B145E9F6768CEC8, 0x34BDAF003EA002A0, 0xF8E0894EF39FC09F, 0x0E2D299A77BCAC99, 0xD1D85D7355EF5153, 0x343EE02DCBCBA0BD, 0x841182B6986F28A8, 0x0071C26C498AFD94,
+					0x7A5DCB45FADAADB8, 0x85CFAF57F31BF1AA, 0x4F9B9D75249CF1BC, 0x5E2C891DA7AB8A00, 0x82A3993C9EBEA5D3, 0xCDDDE56A19F3BD2D, 0x6D289E8FFE8AB085, 0xC664F2EF792490F8,
+					0x773958DA191F3E3E, 0xCBDFCAFC7D1844FA, 0xC633DDB036AA073F, 0x109C4E916F3027A1, 0xA3DA53B45DC20D0A, 0xF1220D9BEB1D6D8C, 0xF15456409E5FB3FD, 0x2AD47C49548D6DC7,
+					0x6B18F687DD9FAF07, 0x5452B98F9F1D499A, 0xBA49463D69F7B674, 0x35DBB6B19123CF04, 0xEC4CB5D2D29B6DA5, 0x15DA42C6D76F8697, 0xC0E9B318723C5584, 0x71A768ABCAFA1FEA,
+					0xC253F7B06305DC9E, 0xCAF2A66EBFA61A9B, 0x7F205EE63F716261, 0x466C63DB70D7EEA2, 0x53D1B1ED4BCC24C2, 0xE0D43057644E5C39, 0x1A743B20E9CEBD81, 0x669B0240038DE823,
+					0xDAC55AACA9364878, 0xD4971D6E6ACD92EA, 0xA281E65D72413CD8, 0x39D16F9CC4DE98C5, 0x8BF4B2CC8BD5E2B4, 0xF1249BEE2B5BEA04, 0xE176CA9490F7BB08, 0x5EF806AEB391A686,
+					0x29B182BF3C7241CC, 0xE655B1C980C77856, 0xB7EC809E0B8DF392, 0x73D7A7107F1DADA3, 0x5EA04900D12D9E10, 0x4844B570AD6C4B56, 0xC694AFF54E7022A2, 0x6245981EEC6163B6,
+					0x3E05615C8D84E0ED, 0xA0E2A6E8FA392EAB, 0x9066294C1F916604, 0xF4020BFB49834105, 0x167B8876952AD48B, 0xC739CA8F18A6F876, 0x80697D2889C4485E, 0x67A9CDFB9B0AE1B1,
+					0x99EFBC6DD612002E, 0x32B82E25050583EA, 0xDB3E873A07E78DD6, 0x5C58A5F276545F04, 0xBFCA07630A480772, 0x6B1860A0B4B585D3, 0xF5DBF60AAE5EDBF6, 0x15F2B9BB1F1C2F08,
+					0x1BE55901B49FAF46, 0xAE936BA8DF6676B5, 0x2AE0F7836A1E6EAB, 0x96BA6244680E297A, 0xB407647C7521D928, 0x7D738395BFC095AF, 0x93F8750C0BF35881, 0xA6F9259B36A7AA2C,
+					0xC080D96E5D645440, 0xBD0C008A1CAC2B3F, 0xF44945545797FA5D, 0x38C8B1004532C9F7, 0x2686E9E4E4DCB426, 0x361751C94796BF23, 0xA87ADAF251688F62, 0x55D9786A12D2AD77,
+					0x9511D7EAFF18FE3D, 0xBB39D3AEC471E285, 0x60EADC5603889AFB, 0x05BF434DD55613CB, 0x9F03F1FD95D132D5, 0x66FD6F76DBCB8826, 0xB1CD273AFD83122F, 0x56814B9531678DC5,
+					0x188AE346E53C9816, 0x0F71D6313A2FA479, 0x14B4E655008D00FE, 0xB2FC1FEA47A21D61, 0x4C9A2C4A0E50B4FA, 0xEF904CE810ED129B, 0x640775F26FDA9C1A, 0x4005A02B4A5F710B,
+					0xA39AFFAEB1A0A9C0, 0x932D166D9DBE0073, 0x905F888A46ABFBD1, 0xE802A1B852AC9FE5, 0x9E02A0A5A06C1322, 0xEB42EFA1FBE516B9, 0x929337A2250FA92A, 0x7344B392855E09C3,
+					0x36933DBA119BA767, 0xDCB0FDB6B9C81440, 0xB0184D3CC91D9D5F, 0xD0948ABC00011EDB, 0x7766B5E416239322, 0xA28A4ABFB698A107, 0xC3978BE5DAD50577, 0x2BBC8CA368A9559C,
+					0xEEF612ED2CEAD8B8, 0x0FB2523AE9679AAE, 0x458962E8315C249D, 0x8433B3866F89AAAA, 0x362C55EC82BC31CF, 0xF9835F3F20EA3171, 0x1CABF6392025EC6A, 0x4107BA02111E6157,
+					0x1A2B95721544F33B, 0x58FCC774D03552E4, 0xCB8A8B6058D622F8, 0x6DCE2985C6C5C058, 0x8EE57D44A11590F0, 0x2AC1E06C98416AB4, 0xBC548E22D405EE47, 0x81BE892434B84C39,
+					0x31F1230617D937F3, 0x7F5F5D6309BE5107, 0x4B2C0AC2367DE22B, 0x5E9F4DBF3721CD36, 0xC914BFD9EDD90D66, 0x1C7CAC5A8099D077, 0x36ADC0B9AE51D9E4, 0x8121ED51EF08C287,
+					0x8564B9FBC8B1FC53, 0x57AC00E68957740B, 0xC348E260DBAB7BDC, 0xB776060BAD8268A4, 0xB3E1BF63C3E4BDE3, 0xBCF528421CADA1B0, 0xF25B5EC838C65FA6, 0x7D79EA5608858C10,
+					0x57CC60DF0BBDB8EB, 0xA1277651BD974B48, 0x63ADB16FDDCDB560, 0x348833EEA7344278, 0x7092DF7AEA1965E6, 0xD5DBD74216D6B7FF, 0x269F0E26E6907CF9, 0x7207B60B312C4E0C,
+					0x8E3079FEB5219BF4, 0xE7DDEB502091643F, 0x7505F423FAC68885, 0xF1B846F218D16B1D, 0x3FEFCFF10E34CC7E, 0xFB1F80F7F0CF0318, 0x35FB612D5E133E84, 0x740AAA8164A2FACA,
+					0xDB4C4FA257B89807, 0x0D300B5A934CE6F0, 0x17D39BE63D9C9ED5, 0xA1EC49D0519C58C5, 0x6CACB29D87B6523C, 0xD9099DEB0864EF7D, 0x2BE136DB34E63C4E, 0x24633F50B564E6DA,
+					0xC18115F058F3D311, 0x033EE61E9B109D1E, 0xC9680D740FBB2088, 0xD887FF2FF1B5C05B, 0x0E2113B5F8AF9DAD, 0x64A93BE9AB57BE5A, 0x1B2E6C21B5E99982, 0xEDB53F6C24A4257B,
+					0xE723CB835930C28D, 0x58CDD438A2C2DFB5, 0xF501110010F25AD2, 0x9509919B3FC3C66A, 0x978CA1F1869109CB, 0x064AEC76D0987C40, 0x8C705CE5FFE6BD35, 0x6809669DC2774944,
+					0xF6E254993D919BD8, 0x80C3FF389E311A23, 0x8DC37F1255F5F534, 0x910949104419F14B, 0x73BFA86D25EF6EF7, 0x41C57A573A2E2793, 0xC0BF5DCDD2C203B4, 0x19B9926ABC4335AD,
+					0x7A6CF1FEC937D2BD, 0x417A8C9F428415D9, 0xAEBA1E0A009F8B76, 0x4B14C8ABB5ED509F, 0x2468C6B00F5F7E80, 0x061E6658DB9D8A87, 0x7DCA4A7AAE29889E, 0xF03EEF1E60C71BEE,
+					0xD494AD2D6B978BF2, 0xC12BA13224782F9E, 0x5CFE080864D31025, 0xB7EA1CB43A68E7E6, 0x9556EAB5416F7048, 0xFF7A9435CA6913C2, 0xAD535A6C09174160, 0xA3FE1DEB98CA86F4,
+					0xD14B4B8A917F48EF, 0xB7DE495001F54AB6, 0x0AB9CF9A9C588232, 0xCAE09A7738DA2994, 0x39B739F1DE1BD70C, 0xCA6AC36E379A889D, 0x91FCB5C1A4666F54, 0x4CED16A08D97D585,
+					0xBB850DDFD66B0066, 0x9A93BAC818861697, 0x1B00B69EF6BB0AB2, 0xC2BEFCEDB229BEA7, 0xA9A53A4086A57F59, 0xB5DF56734E1E2AC4, 0x13E6C3F76243D6C6, 0x70944E5C3FEF4650,
+					0xFAED0BD9D7EBDC1C, 0xE72735941630B8C4, 0x9D027B493E849F4C, 0x33C69E42F6FA94BE, 0xE791965729CDEC40, 0xFF7E36BF23BB8B0E, 0xB82A097DAEF5AE45, 0x0A91A28F2A69775E,
+					0x8DB97675E995B1FD, 0x1078D592E46636D5, 0x742BB6ED831C976F, 0x73754D7C3AC4336C, 0xAA5B4E02128AFDD6, 0x0919FE3743F84F1B, 0x4B45226C3AA48AFB, 0xF4324C07353C2EC7,
+					0x6DF25EBA65D4C6FE, 0x15817FD4D32DAD97, 0x58870DE279EEF60A, 0x4B0F4300889D8756, 0x93CF8119E2F57692, 0xCF89EBFB0B0D88E4, 0x9210D9526501C8C0, 0x2BC1AD438F7B83A4,
+					0xD3B2B28D438A058E, 0x5A3186A255CE6479, 0x3B7D34A365F2433E, 0xDC3940112ED12D97, 0xB8B31E468AE06B06, 0x47D2D447880D8CD1, 0xD60611D378B4DB01, 0x99ECDAC0A428378C,
+					0x99DC474F65D0EB0F, 0xD0E922B5AD4292A3, 0x3EF54EAF03A03D9E, 0xC52D234B42FC41AB, 0xE3FDC5AF7F5F57D0, 0xAB0FFC47B9AC1CE7, 0x536EBE57BA369AF8, 0xE6DEAD59F0847AAC,
+					0x1EF4F30958778D75, 0x9E63072CB6DC3DAB, 0x982164AD67399E3E, 0x98ED146B7E089EF6, 0x5AADBA401074D245, 0xC0A2FC2438CA987E, 0xD6C82BA35547EF1D, 0x1C668541B7B7D4BC,
+					0x5D25C66167B8E3F4, 0xAADA414C3F928A68, 0x6D62B1468671D65E, 0x1E97497691A91954, 0x191C5CC677B23CFA, 0xE9413D3A5AC0AF3D, 0x8E012C558D87EE9D, 0xD44AD0201ABBDF7A,
+					0x14875DD2BFDBAE8D, 0xE84CE22117DFE59A, 0xBB8911E59A123C2E, 0x4304776D72178179, 0xEB2B35C08AA3E36F, 0x55F062793699A32B, 0x3F3D73C65E72B7D7, 0xC8A27CAB8412904E,
+					0x847BFBB352F53789, 0xCD0E5DD1A105B56F, 0x075F17CC5B304346, 0x4D9B5BBC64C9383A, 0x4245038E972D190D, 0x06180CCA8DBC8924, 0xA2BF491FACE834AC, 0x37FFF723D29FA1D8,
+					0xF51479EACB581B15, 0x01BF2647B4D01333, 0xA07FF51EF6EE2F26, 0x29F0332568FEC3D3, 0xF55D3EE5CFD1CAEA, 0x36001D350FB04E8B, 0x55C8B50E7B0A5478, 0x8EA55453019369DB,
+					0x8281CA667F1EF397, 0x58BA98217E6AA839, 0x28B24313A81ABFAD, 0x54F3EA3FB152F7B1, 0x2BB12AA2D7A7EEF4, 0x25A404D11C903B45, 0x7982C874A09D91B1, 0x0729CE07155C82F9,
+					0x94FB0C2CA789F17D, 0x532931F791E4DF55, 0x144CD147DD8F1E1F, 0xA881776423EAABBF, 0x7F6B0694439D689F, 0xC19623F05A93BD5C, 0x6F1F8939E00B1451, 0x6235830181CB085D,
+					0x867C7C169035949D, 0x8B5BEF5C3737D64B, 0x547006F430A888FB, 0x1EB20440F8DEA543, 0xBE0CEAC25F33203A, 0xBC7BBCDFB1F9088E, 0xF0E7689590B7CE38, 0x8BCB5B835310F606,
+					0x5D2D537B40E8AF6D, 0xC00CAF4AAF1C9016, 0xB5F8F51517D873BA, 0x1118D89BD4A69674, 0x686A553F8EA5C8D9, 0xCEFB4FD9359473CA, 0xAE16838A586E0F27, 0x82B2ACA3FDE5A3C0,
+					0x54F6968263197A17, 0x24EC22E4C7A65370, 0x57883BEE61B25D9F, 0xBBAFB5EB857D345A, 0x8A57BB1E8A0DD698, 0x75183D94EFDA1E8E, 0x8DDC9E4A98E8AE9A, 0xE24E3CFE88E9CC2A,
+					0x51828F7B146E35C9, 0xEFD64C8171F0DAAF, 0x1209256B211E041C, 0xC364E646E91D253C, 0x1BC9712BD39C4927, 0x932D674BE26F20BB, 0x995F0656E6680159, 0x18E00A2F83F5E64A,
+					0xEDAD24023210993C, 0x8A0C77115AD1DA45, 0xED92B77AE2248CFA, 0xECAB2D0E93A505CB, 0x846920484997791D, 0x97FF1863C502A022, 0xEAA677EE5622989E, 0xD5851CCA5EE571C7,
+					0xDA1037F8957F2E88, 0x6730C00CA1C308D4, 0xEF37EB1516C3EAF2, 0xF0A555662A18F137, 0x8D4BEBF2EAC9CCAB, 0x70EC549B56E6DCF7, 0x3741A2F206EEB1CF, 0x9397F47A026C97AC,
+					0x9D0D95CF7F4CC5D4, 0x6932C0F7EA62C7AF, 0x1069AAE785C05460, 0x85748A9F644D9181, 0x5B6CF5790D7FD9A9, 0xFFBCB787591A95F2, 0x38E7A16EF3D050FF, 0xF90940464260A152,
+					0xA0E1D0D94063127D, 0x7F492AFAB81F0322, 0x489400A3FDB18226, 0x83373A95F476396C, 0xE8B56027123A2932, 0x7B5BA14CA5CC10BF, 0x273370EE9394F9C1, 0xC154ACBEBC0EB268,
+					0x58CF5013A95A715C, 0x70392464A7229873, 0x0DC9D1A9BF8EC54B, 0x2EADE8AA80ABB5C4, 0xB74CC1A6DB1DC7EE, 0x14F4E091ACC75BE3, 0x920453927EF302ED, 0x3E9BC50A0A888F91,
+					0xA1D9AADE4D051590, 0xB32E48F0EA44F90D, 0xF8F9C68693E9EF3F, 0x100C39BF77AA414C, 0xAD213C56C8D77AF0, 0x6616218AEEEAD542, 0xC19521E1EF87587C, 0xCCC9D8C4C5EF64CA,
+					0x76DCD31DA0972B4C, 0x284E674C2022D938, 0xAC846FE7427774DD, 0x9F953EA43E1FC9E9, 0xFF2978ADD269CDA9, 0x064B3936A9EF33F7, 0xE48355B832A45F53, 0x3762744A36811A06,
+					0x1A7F310530A70461, 0xE6493745191BB4AE, 0x9DF2F98261AA51B6, 0x9ECCAA2190D997AC, 0xDEFA2D8E464465A0, 0xC9B279E6CF6B186E, 0xAAC724A56E2A3F26, 0x1CC2D5F55893A9FA,
+					0x7D02EAED9A5A4E10, 0xD90A11B426916A70, 0x9A00EF2EB540F086, 0x535B9D37C2BEFFAC, 0x35F243D0C49859EF, 0x31A74051A3EB683F, 0xD42E4F92A4E01B5F, 0x05B2DA2AC4A006F0,
+					0x76C2D73A49C7E460, 0x04CFE2DEB93C0B1D, 0xD3902794EAE798D8, 0x6E0C06D2ED452105, 0xA27D46F4BB140C19, 0x243A8FF6657099E3, 0xF53235F61BBEDBE6, 0xF65F6D56E1C1AFE7,
+					0x53F7E832B49FCA93, 0x687FD08180B04719, 0x7E0CAA14E7447B6E, 0xC11FE0288F96843B, 0xEE8CCE7B4BA24D5F, 0xC051CAAC7B7EC120, 0x3C5D61788AF868BC, 0x63648E783D440769,
+					0x46BBA58D883B00F1, 0x996203B853B8DBB1, 0xB80C0554AEFC0E33, 0xC6FEE4AF060BB060, 0x2985F78DEDB89430, 0x3E018371712E0BF6, 0xE04E03801DA47898, 0xFC2057F495377871,
+					0x3570F0A286E0749A, 0xAF14471EC13DCD99, 0x3D93A99190CAE906, 0x7CA9EF9B5E449C30, 0x78595B3E316A2968, 0x2C35C9BF07E98397, 0x2D433F812DD77DFD, 0xC12BF3F88477C9E7,
+					0x6142E5109E2FF8E4, 0xD1DCDE51B13017B5, 0x05CB061137F640D1, 0xED15AB18977929C0, 0xA3DF4F505A8AF406, 0x98646BC27ECCFD46, 0x6F1FC8CB1F49723B, 0x93E7FC8579D0F762,
+					0xA05A11A0A4B291D1, 0xE332BA510E0D3DCD, 0xF7D522C3165105DC, 0xF4FBC9C5103F5113, 0x1BDD9D759EAD57F2, 0xC7C060FBACB6BC27, 0x2F286DE53365B913, 0xC5B52BE0A9D8250B,
+					0xEE95C2F3234A736B, 0xA7A5A1411AB8A7E5, 0xB7AB81DD84509F5B, 0x5C80B6DA2763B8F1, 0xA40ED3E02FDAA9EF, 0xC9DF6B153F0206E6, 0x58599F39EC760827, 0x4D44269F21887395,
+					0x20E014CF087CC223, 0x81FA7370F2D839B8, 0xBFC8C42A938CD7A5, 0x434B731CD92C5E01, 0x19F25F04405CF2C7, 0xFB505B359BA4682A, 0x9344FEFFBD0E03DA, 0x2FE9C0664754EC26,
+					0x82E45C895F1AB8BD, 0xF5C195603AA06E1D, 0xD6509456EF9CBAAA, 0xD6927034FE06EA44, 0xB13F9565141F4C27, 0xB305ED318B8BC4C6, 0x2E43C523087BC800, 0x96C42F4B4D1E9575,
+					0x0748E33158586EA3, 0xA5C64AB662C61C70, 0x30FADE136B32CAF6, 0xDAB76C3F34B358E4, 0x1C438C2142915FCE, 0x22491E2F06872E11, 0xA80BF3AB59BCDA34, 0x52E9E7EE64771118,
+					0x651B73C184265CB5, 0xF8572B3AE5D822FE, 0x730B8CE5B8E664DD, 0xB7E389DA8F1FCBBE, 0x57F635C559478208, 0x2AA8C0A17E776E53, 0x73F792FA236999BB, 0x54D55E82B9F54D6F,
+					0xB2CC403E68BE6F5B, 0x7E942F69DD320EEF, 0x93217F9E26BB4A04, 0xFF9F76BF642F713F, 0xD08629A339AD3920, 0xCCE9EC6D173FF3C5, 0xBF2EC6DCAD11C4DA, 0x7BA141735B2A9B4E,
+					0xAFDAFB488F7E599F, 0x11554F7C0ABC8402, 0x95625103EDD2E286, 0xDDF9AED4E544981B, 0x6D5D69D81540CC9E, 0x4645489AD8FF20AE, 0x7FEE213ED3E0768D, 0x83C5EC35B4B2F2B8,
+					0xECD986B116C1989C, 0x32B4A3E08C613158, 0x3AA6BA63A3BEF259, 0xCBBEF8C59EA81002, 0x77FA093F45ADCDC0, 0x63ACD8C710307365, 0x0C596E7F3ECA892E, 0xF9655F5C4C818FB4,
+					0x892B238C11C016DC, 0xEA0CCBF0C2588CEC, 0x2179E3EE4370C8DE, 0x0DAC3B306BFC533E, 0x68E90DC223CF8591, 0xBD524D2689F493E2, 0x989F7E53BD038621, 0x15C8DCD9F4F97CDD,
+					0x6C43B3726AE6FD42, 0x4EFF301790E182BA, 0x04A83007E155A470, 0x7B6A07BBD618CB63, 0xD71934FE6312089F, 0xB564E7FF2087AFB6, 0x8C641966D4824296, 0x95C813B253580247,
+					0x13BB4666E6AA5C1B, 0xA0168609079535AD, 0x71FA0FCCAC7ED0EA, 0x3ABA4EAD4233B086, 0x3DAD985C37B1429B, 0xD833B841A488AFFE, 0xFBF9453E56B5AD6C, 0x33DD13C5C625B783,
+					0x5E3B2308C47AF459, 0x6DE0A020CF1EE3F7, 0xB81272595D4BA417, 0x26EBC4E97DF95626, 0xDE836159F99B416E, 0xB33C06A4A842A33B, 0xE9EED028D5035AC1, 0x999D400309CB4B9A,
+					0x4BC152F9534D408D, 0xB9AE3F705D5875F4, 0x49F20428EE6B4BD7, 0x144159FC06F0199E, 0x9DD86A6985E7B6FF, 0xE7A97930171FDA69, 0x6DE75A59CC473415, 0xB6B694EB646DE6DE,
+					0x0BE1C76EB866B882, 0x81C2C47605357ED7, 0xB2D21A2AA7CDE08C, 0xB6B3C2C8454483AF, 0xAC85C11625475DA6, 0xC5D12F4FC46DBFDB, 0x2C98FEBCC66130C8, 0xE3BE8B4C72A0213F,
+					0xE74BA9232F63D0AE, 0xE6FB73E90AF6EE32, 0xE1E960DE07F18D06, 0xE15791ED959A4262, 0x98F05B93C0789044, 0xA071DF39A001885B, 0x755CEFBA0A3C18C1, 0x81BEA30E7835622D,
+					0x753150CEE768492B, 0x6A3A8A81242D77ED, 0x836E497F986204B5, 0x1F4102188ED9ED22, 0x1F8993938DB389B6, 0xE3B104657B9E2634, 0xC569B440F1829C7E, 0x224257E90412EDC6,
+					0xCB66D808880BBC76, 0x14B12EE3EE06929E, 0x45D1DDAC5BCC4BFE, 0x23B2D880B8277815, 0xE901B2529041CF9E, 0xFAB0E198614CF172, 0x796A8A49600735D4, 0x51E15E0B5B8CE759,
+					0x24E7B71543257185, 0xDFD4FE02556410F6, 0x5087AD91E8B32B94, 0x6C98ED93E629F94A, 0xE9AA4F9BF929C13B, 0x1ACA056803490469, 0x99EAD723F912944B, 0x32A84879E3B2AF80,
+					0x3F5E6FB266D4644B, 0xD043A3BA6172A37D, 0xDDE4C9C8EE3F54C8, 0x037616612D236E32, 0xB8EA28AAF727F216, 0x075C898E2AA91EC9, 0x7D90C7496B92CBBB, 0xC9076D75DF398D9D,
+					0xDB97C29B803FD156, 0x482B352A65B187A7, 0xB6C2C03A92A47ABB, 0xF721B0BB0E5B6AE0, 0xB7A73A1E2894EA57, 0x18503013401571C9, 0x29957501B6B64DB7, 0x2088B359FA662D24,
+					0x078EDA00238D1FC3, 0x6EFF67A09AD097D6, 0x3AEDF52C12CC7162, 0x84DAF4F5030B0721, 0xA3ED4DB2D09D7CF8, 0x225042DE377B3BD0, 0x9AE65C051FF95D3B, 0x035D0CDC8FB29F5D,
+					0xA1D65A6396F84382, 0x195FD3320EB00CC6, 0x418A5099DB34BF94, 0xBB431AF7E4837DCA, 0xF66C0D9C4A674D75, 0x7466245ABD778342, 0x06FFC5C768865EE1, 0x3FB7F581CC9A30E9,
+					0xB91B6370236968DA, 0x70B8125AECDA1BDA, 0xF035ECB68F0F3BC9, 0x7BF09DF876108D7B, 0x69A4969FC80305A0, 0xB705EDD8FA45C5ED, 0x51792AC86DD5DD93, 0x9E0F96E98AEAE3D1,
+					0x4E06EAE365F1843A, 0xDA63D15E54305914, 0x2592AAFF98AFA8D8, 0x5BAF5172D67BC17E, 0x361BEF2443632B6A, 0xC511612B52A1ED0A, 0x25FA5A8326A69DC9, 0x8875E97AF325970B,
+					0xAE6C4E4323A8EEA3, 0xA6C66DCA98F1B4B4, 0x7D9F62A57513F6C8, 0x2F8158AC58AE74E3, 0xBFDBE3259885DC53, 0xE321D547A768BA74, 0xDECB8B0695E3B3F4, 0x786FE158E9BE467A,
+					0x9D5B5115031AC3DE, 0xDD0C4738136080E7, 0xBC8800CE817A57B4, 0x3BD2F1FE012029E5, 0x78ED57B000BE5894, 0xA28E59934761EC08, 0x60108F6A76F0AF9B, 0x565A21BE3DA3828E,
+					0x0696AC1CD42A498A, 0x98416B2628ED5C70, 0x5FA29BADEFCF8D28, 0x437871545DBD5E92, 0xD402DDF9CA2F0B53, 0xBFBD53CC8B1F2029, 0x016E281562C2BB1D, 0xB6A27014E92AF7B1,
+					0x40E7C8C56FAB885D, 0x56238907584E5814, 0x9C9A70A3570D562D, 0x10A7A45EEC0C7E45, 0x02EAA61E1EB6D8EB, 0x42D972E2490C2F79, 0x7005A852F6519D55, 0xE17259ED25314828,
+					0xE7AD56A40BD43621, 0x9E5AD0CD1F92FDA8, 0xE7BF3A57F491EBBC, 0x0D5184C4C9777428, 0xB685259C36013926, 0xCB8D7DB5B6F8AF55, 0x9E6E136D2AD472C2, 0x52DDA3EC07FA0F8B,
+					0xFB9DF4DE222B1F52, 0xC8EA5F59CD2A8579, 0x3356DD28F75511DD, 0xD0345D03A25F769C, 0xDC40763C86FD06EC, 0xCCA37ED3DA87D8F0, 0xB8F73013CDD251E0, 0xBB052E3275442BAF,
+					0x99213BDE4D292432, 0xB49E5CBE540000DB, 0xDAB649317E527A9F, 0x62DE0D76199C4FA6, 0x218A21DB6842DDB1, 0x2E6D571BC84F7D47, 0xD118FE75B8C5B34D, 0x29B2950679BF3B40,
+					0x7D75830F7BF0D9E6, 0x12865B881F63A0B1, 0xAC551ADDA83C3D69, 0x3C999D2ECAF090EC, 0x0B93573F428AC55D, 0xB52F147B4C50FBBC, 0x2B61CC5C5F4EFED6, 0x69EF9DCC9EB2C6FF,
+					0x2BC361A78817B722, 0xE3D404C9E3E5EDAF, 0xEC802532F2D3D71C, 0x3974052312AA5AAE, 0x1CDD25AD828B69F8, 0xE692F4BFE88A3CDF, 0xA3C23864CFD36FB7, 0x7A13E36B3880E6D1,
+					0x5B1D080464FBE6AD, 0xA45A01BAAF0B43FE, 0x4D69981F3CD4458C, 0x2F19E1206C3FCAC0, 0x6E5D01AE0E73973A, 0x4805AAB599BA0110, 0x8BD1FCA6CA253FEF, 0xE399B044070644D9,
+					0x943221E5D46C3345, 0x5AB7E8B2FA362813, 0x4C980BCDAC7DF21D, 0x221DD64E4C8740D1, 0x935B320FE192D779, 0xBB2735A0F3D7DF2F, 0x60A9519D0ED23D87, 0x7A1FF496FFCDD06E,
+					0x02BCB7EC8C93972B, 0xB3E060080ED30CED, 0x1072204D3B6D1954, 0xF11E359C8E515278, 0x0D98AE79DEAEFE5F, 0x8AE6B9003AF36E23, 0x6F6AF1B04B2084D8, 0xFF1C532C55B94A81,
+					0xED89084883775A2C, 0x11AFBBAA439663E9, 0xDB4B548986BCF10B, 0x0C13EF032FA296FC, 0x5A63C4ECD54C14E8, 0xEC8E1A3E7C2B4FBE, 0x927FCE43A8C7BC06, 0xCD00714CFB6091C7,
+					0xC383858E3BF4920D, 0x9DA695FB71DB4BDE, 0xAF8C9D597FA8CB96, 0x0F6F518BF0A222B8, 0xF016D918C3561377, 0xA2C3DD0F7FCAF0EB, 0x8AA3C2B78F3F4D33, 0xF48D3708C0AB0AE0,
+					0x36595E157E31BC4B, 0x72A72A9F662DF919, 0xF3A5BF6D10FC55A2, 0xD5E2DD1C69B24210, 0x48D873FCAAEA6833, 0x8FE3E11B318268FF, 0x0F92630CFE5D8968, 0xDBF9150FF8265225,
+					0x8F384552E601C89B, 0x5603A9FEB84347CF, 0xF573AF93731983B6, 0x51E56ECDD7C908CA, 0xDDF3AB0226272C62, 0x99D02249F40A0D60, 0x44931DE0420B3B8B, 0x7E05288CFC66EF26,
+					0x78BB845F4A50252D, 0x6E8E30FCF0CFCA27, 0x543C7EF24DCBEDFE, 0xE3249B103054DB2C, 0xC8677F52F2851364, 0x6C844E24CE54E2C8, 0xCB79663D398B3AD0, 0x7DC5B53D72F9A21D,
+					0x8C709CF44090E01E, 0x496004D8E399EA6D, 0xD7A5060734954A9B, 0xD8D4966A198CFC03, 0x147AA364A9F8D16C, 0x5AC8CEC282B43B70, 0x6E6DC182D940C26F, 0xCC890B276838AE7C,
+					0xF92AD56824E79865, 0x2D26A6B386A58CC6, 0xCD89DC68660A0F10, 0x85011179D31B9DDC, 0x3FB67D8FC3C1333E, 0x113AECF6E973029F, 0x14AF33560AA91AEE, 0xD9256E9DF6138D0C,
+					0x365355B260EC612B, 0xE4A25D0B6D2B08FE, 0x726A3E31B5535FAB, 0xCD2086859F8B527E, 0x37CEF18F7CBAF8FB, 0x681EA9801812FCEE, 0x6C1D181619FDA177, 0xAF828FC3593213AF,
+					0x15BB5677275F2AFE, 0x9DF5D09FB8F09651, 0xED43D943BE06F71E, 0xD622A1A77F7F2FAF, 0xF4885AF754448C49, 0x97A7D8C171943821, 0x9CF9981A83B8D9BC, 0x273493004411BD02,
+					0x47CC84B0CEE20F25, 0x68D540532D5D7424, 0xA19A17B04B6CE484, 0xBE513F5FB6AD833C, 0x389673A324D9E7BE, 0x188F2BA304296CE3, 0x56553604CF60D770, 0x69746B4DBC8659FC,
+					0xE9F18F7342FFEEAE, 0xDAF4F9426A7B0378, 0x59F9A23BDBC8AFD8, 0x2D1BEC92BAB4B5A1, 0x59FD3F28C7B12DF1, 0x21C6BB7BC5B35834, 0x56BFA3C3DE81D8FA, 0x9DDF15CDABB913C9,
+					0x09DAF4602B46E7CC, 0xC753074F20580B26, 0xFEACA6084D8D7A95, 0x3F2948D7C95C59B2, 0x9C899F79070479D0, 0xF28F4957BAE1ACCC, 0xF335DCD4807D7FB6, 0xC1ED59F21388455C,
+					0xBF7B7792A9E74694, 0xE9ECEE0EFC1AD8C4, 0xC91ED7DB9D0E9A55, 0x56D9AEA9999044D9, 0xFB0AA2C173B2E848, 0xAD6BF4C96DF236F4, 0x9E106F0D5CAEDF5A, 0xB571C6E7ACC05E72,
+					0xEC2B78BF1C6A926C, 0xCE97740FD27C14E2, 0x6F1259E50FF6FE7A, 0x0534460BC9AE176E, 0x7FDFBDBFD04C1D92, 0x4848BFC2FA470C51, 0xC14840028D964A03, 0x047F183D914C315F,
+					0x81E68B9C8B0A0A33, 0xF4533D8A55351A67, 0x064280764016A449, 0xB19F0673BC17CFFC, 0xCBC50E799ED722EF, 0x74B74AF8E9BB6264, 0xB6A1563CF30BCF2F, 0xC46BC7DCBA526D62,
+					0x76D3661C89D6F39D, 0x1313BE3D7C065C04, 0x3D77FAA542F8ACB9, 0x9798651C7463AA05, 0xBE1084B6C5721CBA, 0xD0E58E989228B86B, 0x3F106FBCA0EE1CB3, 0x7686F060E8FCE600,
+					0x2EF38413D6AABDB7, 0x386D7E212D6377EF, 0x7F5D6430FFE0BEEB, 0xBCB58096E066C146, 0xD38FE58FDCB31DF3, 0x6DAA6E70FAC6A3AE, 0x2FB00D5477CD4140, 0xDC4B29DF318FDB17,
+					0x530E381D67805056, 0xFBEFC1CD721FC88B, 0x77B8A938E9084952, 0xB0B18A634A6F0341, 0x0D2740B77A54C923, 0xF096AFD22D7F1D36, 0x1F7AF0A706118FAA, 0x32DE9B7570811377,
+					0x1CBBD21DEFC09AA4, 0xEACDFD31D3AF3594, 0x335790BF621C279F, 0x4A3715984EBA3B61, 0x6090A078061745AB, 0xDB76CB5BE3EA858A, 0xC014F22C99E2AA19, 0x4B9C495669AD0331,
+					0xF6C71FF1397253EE, 0xF74262EC43E8FFA9, 0x882358293B879D12, 0x4CFB2A030408543F, 0x3581552340A7047E, 0x293D82B3DAA3915F, 0xE66282A505B9B596, 0xC2A17CB18681CA5A,
+					0xE044BDD9F278CB0A, 0x2D38E2BC01C63CAD, 0x4A679BBC17792101, 0xB612F9C3F608A9F5, 0x9C3495B910F03841, 0xE53CD7E578023882, 0x7158E44883E6A030, 0x1AC039DFABD7F116,
+					0x13A11C2C61DAFD11, 0x224B56EA27F9EFA1, 0x4697187B769E5FDB, 0xE6C0DDE3327902F5, 0x46FAE037E1CF6FD8, 0x276D14644CBE2F35, 0x32E3B26FDD32A3ED, 0x3571EEE84946DBB3,
+					0x50B901107CF8BB3E, 0x7DE2A21860316A00, 0xA7F53A1E15ED62FA, 0x68983AE33F5269A6, 0x64D38B546CC66D66, 0xF699843BB461C7C2, 0x50A6F2048E2D5762, 0x4B1435419045E103,
+					0x8C45D3ECA6098C2D, 0x0106300DDE93264D, 0x01E2AE249C639E86, 0x01F5E30D47EFCEE4, 0x538DC063AAC4B70B, 0x038D296DFFBD40CB, 0x30B83C1B26C4DDB1, 0xC73D5ED9AA5E9133,
+					0x23BCB4B9703168CA, 0x422612C851C7AA63, 0x2AA501271F8219C5, 0x059A958D3DDC585E, 0xFAE066DDF80DF69C, 0xC7A917D0E28CB093, 0x9F8B34CC48D8D37F, 0x746271AB740F1535,
+					0x842F5989BFCB5B36, 0xB58BD79C877AD9ED, 0xB12FD5E86FDA05B6, 0xBC40C8B6EC7EFBDB, 0x629D3FE07F829C06, 0xDFDB9C8210DE724D, 0x65C0614E69330F96, 0x889471B75239EBE9,
+					0x74454A194A1E3CE9, 0x2AFA1A79851A6D7C, 0xC4F93B42E686CFEE, 0x1CCD0323D1CECA1A, 0xE3E7B77725B85A00, 0x7A1ED32D42D3F6A8, 0x51A806C47BA55340, 0xEC6295769CE49213,
+					0xD96DDC1920740D78, 0x8A2E93A390000A75, 0x944517FAFEA0D1B2, 0xFA2E1617BC589302, 0xAA6F95403E70A7E4, 0x95E21619984CA614, 0xBAE1FD02B9AEFBF4, 0xA328EA6CC1789589,
+					0x8AF0175971E70371, 0x95D7E640ADE288C9, 0x3413DD0A5722862C, 0x8B3D11EC87B5737E, 0x3C2728FD381324F8, 0x87E2BDFEABA39DAB, 0xF4A03C1BED158A06, 0xBB0C3718EC69A65E,
+					0x561D0E630BCA790C, 0xF9EC75BA4EA968C5, 0xC4AEB672D855E800, 0xCE754037B8A4B750, 0xC33B9BEFC6BAFB6E, 0x3A22BA00903550F2, 0xCF01F597D55D154F, 0x4A70420004DCB499,
+					0x7CDEDF63FCAEE756, 0x64AA6E1105BCE594, 0x0D82CD9EDE667372, 0xFC54816844CF3048, 0x4ED2FEADA0837B78, 0x21685E202017D5F8, 0x743EBE74064F66AC, 0x7BB19C480D26C629,
+					0xAC9DD9F08B6C57A0, 0x860DD79D31502A5A, 0x4EA5C2A250DFF3B3, 0x722124511FA344F8, 0xEA9B8180C2B22818, 0x0CB58FE710D2E358, 0x7F4E3D8119E76149, 0xDAE23BF375796408,
+					0x48430D7C93DA7C2B, 0xE5EB8376C8052F91, 0x73A424961E6F985F, 0xC4AE818246EB2BE5, 0xC63CF8FE4A4393BC, 0xA051878DFC958336, 0x5531DC114F4DBD16, 0x8CBA096EE21D04B3,
+					0xA13DB1B3F6B5C6EC, 0xCDF82A8387506611, 0x1F342ABA76914319, 0xF4CC61768D58201F, 0x4C7E9600B836AE3D, 0x6A4AF923D9894979, 0x9A2B388A970BD44F, 0xA8605EE2BF3484F2,
+					0xCDB20A863B087ACD, 0xCEF6DDE64BA7D4B7, 0x72F7EC7189CCFA3C, 0x30FFFBBE97C3D8C2, 0xF04ACF819EB6D5E5, 0x3DEFDFE465FFF662, 0x74043FED2E9BFC60, 0xB316CC3B7BACF04E,
+					0xC64D458823B261F3, 0xB7A248118B06037D, 0x2CB1E5D87090E40B, 0x0911C337841DB7E3, 0x52BF081F362CCCF9, 0xC2608CF1D3C47F6B, 0x77461600B87F7864, 0xFB457272486475A5,
+					0x268DEC41F326472D, 0xA380C8F7A2C0AC68, 0xFEACFBFDEBB1CD08, 0x5355EB6FD23AA178, 0x2FA01CE872229690, 0xF30AB6C6079A1993, 0x82D74702FF4645D6, 0x4E757ADFAE27A658,
+					0xFBC2C7B1F5EABFDF, 0x77682092FE2EE609, 0x14E182432DC65528, 0x111CAD87471D00EA, 0x19B258F888FC41AB, 0xAD0486FD2FD4C202, 0xE74C9F52BF49D2FA, 0x21E0497DA14F36F3,
+					0xB815D47609FE0F6D, 0x77227791A176F30A, 0x10DE0128E4722C1F, 0x4EEBEFFB7859F9BC, 0xCA3B8AE195220C86, 0xA90E5B7D05B82F3F, 0xD33118FA827FDDB4, 0x7E4AB5143992F3F8,
+					0xA34DD5BBED46D458, 0xD118BD89E3A437A1, 0xE31AFC4032C36F56, 0x4AFF3B94D5120371, 0x01CAF4AE4DEBF6D7, 0xE8C443479661FEC5, 0x8B87437D8697E2C7, 0xA6CF3DCD4B4010CF,
+					0x58A33852F88BD984, 0x8FB40F34584CD414, 0xC9EA313DF959B576, 0x017F660A89717A93, 0x0C6941FF265389FF, 0x687014CABC3F500B, 0x6413575AABCF1B2F, 0x30D6C63650236E87,
+					0xF807A861033CEB82, 0xCF40D883898174AC, 0xCBA379EF6D1B963F, 0x54F5E447EAACA8FF, 0xE044F78FF1158211, 0x44A8CB1D55B4DF56, 0x89ED2C6CF4DA0D0D, 0xAA6CAC2FAB68F993,
+					0x31313910169544ED, 0xC77F1F01828742F4, 0x9EB740364C69D905, 0xEF4441BE869FDA03, 0xCD21353C996308A9, 0x5AE16731359136D4, 0x48054013980B7790, 0xCACB9C5DC2EE3131,
+					0x339545C87555EDB5, 0x9F745D7BD41A91F6, 0xD0EB90A76E25D58D, 0xD772F098B67D8589, 0x47F4257C6469FB24, 0xE8F2081514E644AA, 0xCA78253A7753E5CF, 0xB7FD16D17D5FCBAF,
+					0x5F4CC9FC0066B43B, 0x4E9BA7F3F1C41000, 0xD415EF1F08CE0FBE, 0x813FA10CECBD1FEA, 0xE40BEFB48A1F9A44, 0xF33B76FFFCEAFCAE, 0xDFCF8D3A34EDF486, 0xE8A7F516EC38A096,
+					0x83D63DAB0C64D1CB, 0x54C982A2B2B10BA2, 0xD88D6DB204DBBE76, 0xA306027AF6EEE657, 0x16EA6B4F2E3C77D5, 0x8DE734C0309D9174, 0x77E91F925C2FBA42, 0x1781A368C3FA1FED,
+					0xDD51E2F90A787865, 0x66022E1E7637C9EA, 0xA21C5B557C894C7D, 0x945F73BE54B9D862, 0xDB695A7BE393CA50, 0xF1DE9CD1EB738FF1, 0x64B74313792B29F8, 0xD5DFEE0415ABE344,
+					0xD6924F42B0E95DE8, 0x45AE2A1CEEB80002, 0x4318E9CD994C7DF0, 0x4C3A817F67834914, 0xD4E40D14F78D6161, 0x0ABB154D10CC3F07, 0xDB0E4082CF3C8A7D, 0xDB0F94EB0F922BDD,
+					0x9C651C1FBAF5763B, 0x48990E085E00A14E, 0x03031F62E5237F76, 0x944986C7DBF30B93, 0xCAFE999BB454A94D, 0x1141465267E528DA, 0x2C5CC641A8B87BA4, 0x09844FA7222843C6,
+					0x7EE4CA8DC77E675E, 0x192E50E5E9465DA6, 0xA41A3B30072DECD5, 0x0FAC1CADC859C521, 0x05FA11D1A95695C1, 0x4350F8EA128543CE, 0xF9DA40C551E1EAEA, 0xC3E9818AFB8AED1B,
+					0x2DB94B64193A27DA, 0x0166C60E6A68C430, 0xA8B285C85EA04F00, 0xD4AFFCC56C28EC4E, 0x6853C847F8CAF0E2, 0xBBACE74802CD1285, 0x42DFFADEF7033DA2, 0x0223C296F9255924,
+					0xB98F1078A8D8A1FA, 0x5D0154D9C58A61E0, 0xF30695BBE8477215, 0xB832C2980C01DDEE, 0xE3EDCC110F1AEF90, 0x634B7B4035D0130F, 0xA7A9C842F8486176, 0xD633993D9D77EBD3,
+					0xC9FF1846216A8E36, 0x3F0147E36AC9C14D, 0xFA616819EB227426, 0xF938BF738F2B4CC7, 0xA00537D98DECF3D5, 0xBF3FA1A474CC2BA7, 0xB8A6CC770BFA6BD3, 0xED7A0F1AC84E2A1C,
+					0x42B146DF7C2DF611, 0xA35CBEF67F5128D0, 0x7637BC17BBB759A9, 0xEACCF0A16AB9E383, 0x7053D665C6C6C5EC, 0xE3BA5A2444AED0A4, 0x94FCADCBB9D4E203, 0x44AC3B2D20391CDA,
+					0x652FDDA68E412B66, 0x2B2D90CAA269A0EE, 0xFB09AE45ADA04E77, 0xDB49A7D8399FAEDC, 0x5827286845CB0AA7, 0x52DC3FC716BB9CAF, 0xDD2E533814A4FBBA, 0x5103214906DFC881,
+					0x431E9798AD7A11F1, 0xB97CF2138A93B95D, 0x863559C6B59D58C5, 0x9C4E5DB1EC15DF7F, 0xB421C75BB70CF0BE, 0xFDDE9060973CE00C, 0x0FA0900CE1D7ACD1, 0xDD30A136D29C3CBA,
+					0xBB2FA4FB5161DA14, 0x83AF44A9DB4BEAE1, 0x206898AA14C5B3E2, 0x618AFA19531C7045, 0xD75A262DC1C73B5D, 0xC5D9F8540564A932, 0x8DEEE04724DFFD1C, 0x8CA931944D2D5B71,
+					0x8324453642FB5A30, 0xE6CE5CDCBEAB3149, 0x04D59A857EB5909F, 0x2725D98B2C2765C3, 0x592128D9498ECD2B, 0xFDBD7DCA4FD0809C, 0x00C043E968B948E0, 0x934564F612A31BC2,
+					0x66F63D7FEE222142, 0xD700B7CA3CA3C409, 0x458EB4B34ACFDBE0, 0x04BD9D981088F418, 0xA49F79885F984926, 0xC4EEB2A54AB39C86, 0x81203BA407E9294F, 0x6017EBCAC2C446B4,
+					0x25EA6A7A7543D31E, 0x89F304AE23EAE3D8, 0xF687B0D229A806C6, 0xE8BE8237BFBF0CB8, 0xF6F73151E42944A6, 0x654EB6D976547A79, 0x3F97A7F0266B24A5, 0x8D6910E91E1EEF93,
+					0x803D773FDDB2FDE0, 0x6E226A75A2947894, 0xD30CD5DE3EBDCF53, 0x9EE05B3289C308BA, 0x404C2E435BEF56AA, 0x0A0442C753951F46, 0x12F40980AEA52569, 0xEE4A8723B92CCF1E,
+					0x43DA46DAC94A73D2, 0x50CFCDF148E6888D, 0xAC6965BD853DEEBD, 0x32DE8CEC43843CFF, 0x5396A3034F2E1063, 0xAA54B83BA39120A9, 0x152FBA500FBF059C, 0x655049275FA88E90,
+					0x4D9AAED29FD2307C, 0x6F98BE94B915F41A, 0xC5FBA7F6F94F2A2D, 0x3545332125CAEFB5, 0xCAB36BF7511697F4, 0xDED320679BCC394A, 0x1522ACA4F9E4E99A, 0xEA6323A982260C1C,
+					0xAC5973CFC14170FF, 0x4A5E29E880E64021, 0xED3774DC372F67AC, 0xC0F6F629853820C1, 0x5C8F75BE7DAA19D6, 0x682FDF0623D73A94, 0x637893372197A19C, 0xA7E1529A86B35E7B,
+					0x33C2360A744D9C88, 0xC74AA9DF1E6649B6, 0x4695DDF2E94DD0ED, 0x652A72CBEC97BC82, 0xF542AA8A157C1D0F, 0xE6A42B045BEE435E, 0x1E92FBE351A6603B, 0x22CD4A1217C47603,
+					0x4781D905DEDA7900, 0xA1F8F688FB2A5295, 0x897D3350958D7B12, 0xAC578CA1739EA3BF, 0x52CFB7C96DD078D4, 0x00E379675AF5843A, 0xD036A37CE62FB1B5, 0x04460018CC817A0C,
+					0x36C743221B992F1B, 0x15CC2B8A3AE3A2D9, 0x23E3D4964C6BC1EE, 0x8A90129BC69DA2DB, 0x43AD01B002880E56, 0x5C1EC044207D6B15, 0xAB3C3E20572E2656, 0x14031ED045EC5E10,
+					0xFDB0DADB61B137E7, 0x93CD4E5501B74C87, 0xE229DFE00A0A08D0, 0xE0722721CB4825C8, 0x10EB575333A31DCF, 0xB4992990AB5DE553, 0xA31C425D86EFD85F, 0x4C4F95530952F2CA,
+					0x2D0DABB035643B74, 0x7164459162D72A8A, 0x599356A04B18F99B, 0x8E0D12A3FB593B13, 0x8DFF1FB1875DD215, 0x7ED27947C5733A2D, 0xAAF9AE4B1AF6B6AA, 0x4DF8360408D6087D,
+					0x73BF87D0AE9E018A, 0xEC3CD20AF246EC89, 0x037DB35130FF4344, 0x811EAD3926F2C781, 0x72E319D0A233C039, 0x3773C45F027703D9, 0x3D5A55DBB50F5253, 0x7B0EE1B7BD9053D0,
+					0xCE71FAE66FF846B8, 0x848445E84E055519, 0x2267A51D0D7CF54F, 0xB9047314BFC8FDF6, 0x5B889F64EA3B900B, 0xF85B7E251A615E1C, 0x9B118EE7451DB9FE, 0x94E1F46A3E816A57,
+					0xD2F5408EC101AA80, 0x20E968A55B2BF2D2, 0x538626B058C05B9D, 0xCDBE186151A3F7DB, 0xCB816CAF5DFE614C, 0xC20090CD085BAAB1, 0x2DFAA04F4A9B1379, 0xBC976ADFD7FA82FE,
+					0x18EAD7DFC48E7612, 0x1AC15EECE53374F6, 0x0989D9830FB10FAE, 0x6602C4556BDEDADA, 0x74158595EAC8D38E, 0x3FEB96378405F2EE, 0x893B5ED69D0092B1, 0x0F5195AF290E1DCB,
+					0x1630630D0E257650, 0xC966AB3CADABF730, 0x346B7D7E142BB49D, 0x989FAFC87DD91A67, 0x871A09A2893899E1, 0x1F81C2304F7D63DB, 0x0226BC7A6C9353D0, 0xDDAAF5D31167E5CE,
+					0x26E2CD9DB064146C, 0x79D1B110AE2C48AD, 0x9FA56B8733F30D03, 0xA2607B4760086EC0, 0xD064AC88C84CB0F4, 0x3C83E836D2E231EB, 0x705EAEEB8A987DBD, 0x3FB169968D27F1F2,
+					0x6F738455057D3A71, 0xA46A84708F83DC70, 0x45628BD5CA6B9D51, 0x43E300E10898A678, 0x9A1F90AF0046C2D1, 0x130CF753B40DF4BF, 0x208FB43DC54975CE, 0xE55F516109617949,
+					0xD6A0874E66F092C9, 0x800BEE2EE76C48FD, 0xC034AD00C130FBED, 0xD5B80F0E74E254F9, 0x562D56B0FC483275, 0xC7AA448B43E14930, 0xEF0506D5098C6945, 0x9608FB17BF8F6989,
+					0x990062AA92BF9A93, 0x1C2F5D2C5128DB00, 0xA5D7002CF736E8C7, 0xB41FAC673E55FCF8, 0x90EE01678E22A997, 0xE934383C9D44E576, 0xA5DC46D88C2B17A9, 0x91726E6DE548CBDD,
+					0x2C4950EC960657CE, 0xCA759325F71428EA, 0x02664EE3F919571A, 0x1974B68CAB332795, 0x64E1EEC589A30427, 0x291579C9217A051B, 0xC450A6DD8789B69B, 0xFEEA957BF686150F,
+					0x8822CD60BA457A1A, 0xF3EFDFA3D2A59A01, 0xA52393F7207E50E0, 0x4E22C8F928CEC851, 0x3B646BC9DFD44610, 0x7531B3B921D3981B, 0xCEB82529F2EBD35A, 0x2F302FF21AB48762,
+					0x14A09A94E79CD5DD, 0xF9DF622057427C0B, 0x9E1D639092DCFE14, 0x890471D09A77FC90, 0xA90B9234518CF5AA, 0x06B0DF50D7F17B9E, 0x52AA6E97EDC34439, 0xA8D90BDD78B5236C,
+					0x9EA19973CB4F841D, 0x010B39918F31DACB, 0x2C043EDF2725A300, 0x885D321EA9092B39, 0xC0E6037496B3A61F, 0x3501216610DE4109, 0xDD9A0F6854024010, 0x3EC1B3F01EF267B3,
+					0xB2C3FBFEB57A0D0A, 0x6AD4D332B854C670, 0x32AFDDE7F06118C5, 0x2EBE22661504978B, 0x29155724B4354CB5, 0x15D5079D6892D94F, 0xED7926C9D02CF516, 0x57DE43CA94642FA5,
+					0x23799F099C80379C, 0xA2FA7015087929A0, 0x047987F57701B5BA, 0xA957442BFC4F1042, 0xAB5232DD09A43ED3, 0xAEB97057873BBB7D, 0x859FFEE8EC110EDC, 0x4ABD04C200BB1DE8,
+					0xC85E3E541656E71B, 0x4A0ED370CF5B7C43, 0x776171F0A266A05E, 0x8C2546C1C0584490, 0xE86EA476DE088488, 0xDF753C101DDFA601, 0x2EAE2CF3B58880AF, 0x294AE1AC329205A2,
+					0x14A182B2BCCE8294, 0x03F14CF073C0F093, 0x8CDCFA2D6F75886F, 0xF2426CE5272C7589, 0x52C558E6E01B4DF8, 0x5D57D541144A5993, 0x7EE5E1D57ACC3B77, 0xE8BF99FEF186ACAF,
+					0x25A7F604E82BD93E, 0x7304B4ADA7A61FD3, 0x8B07E55B606E05CF, 0x6FB8300CFC710462, 0x69AB68381CB3F9AD, 0xA169AA547A40D3CD, 0x505478CC626B97B2, 0xB89FAAA0920182BA,
+					0xEB4328AEF14372AD, 0xCF8BA684C2E2B011, 0x4E429E30DC4013B4, 0xC647A4CB853FA7F9, 0xC19B7A0BE015A4F3, 0xC327D637CAD3A41C, 0x077783B11C654B9D, 0xEE751859976453A5,
+					0xC12D65FEB45C74BD, 0x0628A5614F98679D, 0x8795813AECE1A351, 0x2E9DEC2E191C4024, 0x1905189F32A6F8BC, 0x6A611B4075424B22, 0xA5B3C806880E5D87, 0x51CF8E9C813DDF18,
+					0xAEA433E88D95FAFF, 0xC6F5DE39C0FF407E, 0x91C256EC2301FA2A, 0xCB0A381D7DE06066, 0x485C22EAFE6A9303, 0xB4F24040357A9277, 0x666001D13CB10F7C, 0xDAB2D2807C5C4FDE,
+					0xCA76A0B71A627F95, 0x7F2CE9DB17A2ECCA, 0x565A9E55187E7D26, 0x1C365B407C7F410F, 0x0366AE732A814EC9, 0xC526B3C0699487EF, 0x1A70A510A49D77A8, 0x1542F3DFA154527E,
+					0xE00D6F720835D1C5, 0x71F37CB49342FE59, 0x9CBD1E86E9E7AC59, 0x20365217956328BC, 0xB6CAC039E0DB31DF, 0xC8BF9C80A8F2E7E0, 0x1E7D8931352CDE50, 0x04F118F6B946F736,
+					0x71D5509DFED9206B, 0xE30812984107BF32, 0x2D47E0B92356FEC0, 0x850373890C5C7FB0, 0x9C71ED295F4A2505, 0x7C5EB9BE4AA3D268, 0xD0FCA3F82FB6A052, 0x2EC0E47DE79BA725,
+					0x7A9DCFAAF709DF1F, 0xFBDC881056E051DD, 0xF034D3309F225DAB, 0x0B33CF0B5721A8BD, 0xF1FC6EA6C47B27D6, 0x052A30D2319FF17B, 0xB8918D91D726BC85, 0xD24289D93328FF6B,
+					0xB7E85DE64B74AF72, 0x23D05AF03324CA9A, 0x62A60E3C98AB27DA, 0x7D53B0F3B5577D74, 0x5496D243B96B082C, 0xFF586EE322FD063A, 0xD8753D507F47348E, 0x6804A29260B39E12,
+					0x2D2FFC8AD3102ACC, 0x2B2BEC4D7A311A61, 0x2F3AEAFAD5FC3FEE, 0x89DFD0DDF704277A, 0xEE662EC6597EE4D8, 0x4153EBBBC7091A90, 0x7EEBA5912021358F, 0x569144FC87682BD5,
+					0x4E023EEACAEC3C35, 0x04A696F2F7798447, 0x6CA9910D7D23B71F, 0x96E3FDCD36B7517B, 0x12C0FA1D92D47740, 0x6751B6C9E3273F99, 0x10B41AD10D4D01FB, 0x2BC7391CE91FD01F,
+					0x655890DD0ECFEB13, 0x75F440C09C0783FA, 0xF96F53D1AA455DED, 0x563A9CD8032F257F, 0x57C46A98C74643B1, 0x342709C81AAFDDE6, 0xCB8C6BDA277B1384, 0xDAFD9D585A5ADFAC,
+					0x6102A7D773F0AA62, 0x3591AD1D8221C7D4, 0xE981348696A0C17A, 0x4260E7026D9B5CFC, 0x360BA72CC9FE07E0, 0x5BD8208D777B735A, 0x9E198C4AED54C171, 0x70240D3708C12DAA,
+					0x50499FEB8FD3E144, 0x86E8D95C3AEEE3B5, 0x642B1719FEC3018C, 0x6F5A4A3020309478, 0x64DCD89300D5B96E, 0xF88FFDBEB55645E0, 0x266654256262F781, 0xF6DBAE2B60952A2C,
+					0x80AF3DCD338B3F0D, 0x0014DACD346A1387, 0x50518FD080E32F1A, 0xF9A5296FCB62C590, 0xC665E1FC07510550, 0xA2F2D15E37747558, 0xCD102533684FDD22, 0xF759F7F3EE7E0CFE,
+					0x4638624FF607594A, 0xEF000F6F1A5A6DB0, 0x29B605BC7457FA60, 0x9F898229FB0DF538, 0xC86818745AFB088E, 0x98A3DED068DA8F13, 0x2DF3C64A9C38DCA0, 0xD7B7DD2206176D25,
+					0xAA198328EF01C03D, 0x05655AD593A001A1, 0xC0D79E3A5BB7A421, 0xB5594238906B7198, 0x1BAE429440F93838, 0x46AC3351DB7702E5, 0xEB178E8B92044A55, 0xBFA3966851A71EF9,
+					0x2B8ECA8C38559429, 0x6BE7B8EF5F8F89CE, 0xE8CD80F3453CBF97, 0x3D41B2D91DB5969B, 0x48CFDB21B17E5CD2, 0x9BAB9FA5D0145E8F, 0x4F04E4C5D408CC6B, 0x33EEB32882A60DC3,
+					0x2BBEB21CE7A9ABB8, 0x2AFF0EB9A5CA63EF, 0xEFB12A3BEC93C98A, 0x78355B911DFE9BDE, 0x9A1CE4BE95D01145, 0xDE8E19C4F1B822FC, 0x32FC130C69959CA3, 0xB8F981B2C9B37200,
+					0x1447AE403048DD51, 0x8B881F7EEC5D881E, 0x8F94DE147B4580F0, 0x0C7BC00BCEFE2DA5, 0x710925B2B27584DC, 0xA2B3B122ED0EA2D8, 0x9257D64CD471EF1C, 0x28D3EE0C528384FC,
+					0xE049C9758EB535ED, 0xBFBAC05B5748DA87, 0xF2EF725F5F61A28F, 0x2EA1B6BD577605EE, 0x0EB8676AC6F025E5, 0x8D8938BFCF3DECA2, 0x730AFEE74385F04E, 0xE65C9A9D9E70DB33,
+					0x1DE292E0ED736F18, 0x6491B540DE3D894A, 0x0B4A768F661E2CDD, 0xED53ED545A02DCCC, 0x31E2783729941003, 0x7CA45A1D4DCAE522, 0x27D16865A9CBD37B, 0x34E655ABC435832E,
+					0xDE84F8C9498ABBC1, 0x56E7B37F042AE12D, 0xF5EB7BCFB5E08E08, 0x82F527DA24980DB2, 0x4B35969A4C156056, 0x7B850631B98BF4FF, 0xDCE3256763BAA2AC, 0x74340BC27BAFE7A3,
+					0x42916F783790EB4F, 0xEA5701C6BEE6F49B, 0xEE6305790B4ABFCC, 0x9F09B84F8A2235BA, 0x29C45AE716D124AB, 0x2538C420D612F90A, 0xB6143BE6BB19E970, 0x64334B9E7F2F6B87,
+					0x5BD5C410CFE2D0E4, 0xF2F87F68E02392FD, 0x849D6296E76F1389, 0x42972D67C1ECE38E, 0x672E41E3801FF376, 0x951C1D42E576ED6D, 0x2044C477744E6A0B, 0xC7161E022F50BAC4,
+					0x43E524883D4E15AC, 0x4DB830D62C8AE445, 0xCC3B9B5B00FEA1FB, 0xD354984F00F1119B, 0xB01175BEAA29B8DC, 0x62CB4181B3D1C67F, 0x561B4E21BDFAF2A4, 0x0AAF5716EE21555A,
+					0xA1AD565575D409F9, 0x23774EA947209293, 0x82BA5DABB6609F79, 0x224BE4DC4D572D57, 0x8FB7A829195D2E65, 0x9DEEA4A4B952CA1F, 0xCD5E145403C135F1, 0xD73179F6925FD885,
+					0x528CF13FCAE2F6E5, 0x8903CE50EFEE3C64, 0xD4B5B1DDF536F872, 0x30B8A32D474C4217, 0x430602A4D5123C81, 0x42C584180EBEFD9F, 0xC04C1334978AA6AF, 0xCFDF6545485739B6,
+					0x8546B0DBEA56BBB0, 0x136B1A98283230EC, 0xA1D7BD51AB357DBC, 0x6A0E85837A43CE0D, 0xB2063A5E086CE2CD, 0xFD57A6D392F9B32E, 0xEF043C4584DF76BE, 0x7EB37E8064F56274,
+					0x6003A747DFA8D202, 0x33B323A3A59C01F5, 0x5A93121752ED3753, 0xCB42E414AD8B9395, 0x4D181EFF3AAEF10B, 0x9F7409ACD8817B88, 0x381BC5B1D7FA3D96, 0x1A1CAFFFCA61348E,
+					0x79A3BF06080F9C8E, 0x33C5C51244086928, 0xA91F545B656B4D1A, 0x980250EF9F44E515, 0xCF20A65443DD1BDE, 0x38ED24E92F45B219, 0xA7B59EAD3DB2C441, 0x39AD8C69944763C0,
+					0x6D7BC11FDE0A99CD, 0x713821EE0D04A458, 0x37982E98519B36D1, 0x894810DE852DA83A, 0x994CB9F51ECD4B6D, 0x134F0A4D01604F13, 0x47C923FB717956C4, 0x95892A26A63EEAA8,
+					0xADBBB828DCAC0876, 0xB37F90789D59D4DE, 0x8D33C8E46ECF2D47, 0x67A69FCF15857E7A, 0xC2103E58F8E56048, 0x760126D66B046492, 0xE8D7D1FD0E5F6408, 0x46E8028F8A95434A,
+					0xA096A1DE4E2E0A0C, 0xDE0E16C80823B758, 0x1932E02BFAC60986, 0x7966D5D83A324AD4, 0x7F70D32A98355A8E, 0x52386BFF47C95E3A, 0xAEEA11E67789DCF6, 0x30E1D5D945BD0826,
+					0x060E57C2AC99465C, 0xEA67948D8264689B, 0x829D30ECDBC29515, 0x2C8EC7E0C382BC88, 0x6BA53F0924246D1F, 0xC63810333FA8EF80, 0xBFD8D5741CDEA58E, 0x985BB0BD59D756FF,
+					0x5E34334C04991A8F, 0xD56B841BAC5CD46B, 0x779906B1DDED4712, 0x13F5C501EFD53D45, 0xD00D7835A8186D05, 0x1AC075E529612533, 0x49A0350BB9D88126, 0x86A2CC042115B224,
+					0x148EF11408FE4359, 0x1341B8705D49A749, 0x44D17E08965766A9, 0x436419E716F7F12D, 0x8BEE640547D28C51, 0x283BCFCC6CAD97C2, 0xBF0E891F5C701CEC, 0x3FE8E4AA7836EDDA,
+					0x9F486917D6E34A60, 0x8F72CEDFB5DF85AE, 0xC96DA9E86123B459, 0x874969945AFB21C1, 0x8D9E520B341A5BAE, 0x71C6411541C3CFFC, 0x292CD78B5E3763E4, 0x67D7EEEFD7A0B1C3,
+					0x7FF04803E3690B7A, 0xB93645B33BE0DD50, 0xB2BAFC4753B62DF6, 0x61E9BDD2AB8714C4, 0xA99B01985115BD96, 0xF1E4A6086BE12E7F, 0xE4F150FFEBFD765F, 0x922CC68DF9B3F500,
+					0x3EF500A208F60305, 0xD00DEC3F47C8C12E, 0xFE7C009C0116468A, 0x07CF94D47074F828, 0xBD6BD73496C45DFB, 0xA230AACF0A8F2433, 0x1EF832435A17C698, 0x66DF0298273209EF,
+					0x473DC554A17935FA, 0xFCE5AE551FB48854, 0x342DCAF16FA7F8CF, 0x32EFE40F8F298821, 0x404FD6958C34B15B, 0xE4B9A60F18FFF35B, 0x9AF9EF6D01E9A074, 0xB34FBD8983577FD7,
+					0xC95205C2C79B2961, 0x062663B52B3F7770, 0x4D674616850C9FB0, 0xB99493D39B4859B1, 0x6EAE86A0AF60933F, 0xCE2E7FED448BBE68, 0x178D6F661E604180, 0x5C183E8A0F7DCCE4,
+					0x85818064E555A92C, 0xF3B28FECAE83CCF0, 0xEFE6D4CBB7A5DED1, 0xC72ADB42490ED624, 0x2766FE7B462255C1, 0xC0C5D534BF918D58, 0xB58A3FF1089C4367, 0x58A1385FCFC4082F,
+					0x697CCF613A1FB7B6, 0x64D69B935E35E246, 0x0DDBD4FF03141538, 0xC295254D28AEDDC5, 0x5E1170BDCED4C9A3, 0x7633B0F8DEC52979, 0x667E60BF4F026989, 0xB1ECC56A23973B3F,
+					0x4778ACA9B921BD64, 0xD207C7635B55CCA1, 0xA3C626456BD859FE, 0x5E801D9C474910AA, 0xC5B11EF8FE88AFD4, 0x95EBD4FCEF8164FC, 0xD436DF08B0360523, 0xEA7518470120AFDD,
+					0x59BBB56B0C358461, 0xAB9605B66E5FD6BB, 0x4724E3FF032AF6C5, 0x427FE9F154AFFC36, 0x12C95C247B0593F9, 0x00DD3793E63B850D, 0x4F8B4DB8977C72BB, 0xB3B00D202E0373AD,
+					0x2CD086B44E2EC956, 0x23BC3DA0023AACD4, 0xB7DA885412D8208A, 0x96145B64AFBEC663, 0xE2C010CA0B901C05, 0x2DB3ECCDB63610C0, 0x2D5C8E8E1A406026, 0x73554D684FA5C17A,
+					0x2708F9FFFAC809E3, 0x80C6774DCA8A04AC, 0xD785727C6FE371CB, 0x635EE3181492B1A0, 0x8BA3241E56FB672D, 0x5BDE9AE4898B8F02, 0x881710F07ADF2458, 0xDEB10BD415375E24,
+					0xE581FB314A139965, 0x52C664E47AE04955, 0x86C5E27678BFB164, 0xAFDA663E55250046, 0x4517B225D53557F9, 0xB9CBCC5489DDA6BE, 0x1A682AC3C38AF911, 0x8692FD7C0268891A,
+					0xCF631B5646859CE5, 0x963BB12D4BE457D2, 0xA355D57CBBF66074, 0xA2EB94CCF3BD6F26, 0x363F730405E8A1CF, 0x3B170ED825E88627, 0x58E6867F19643ABD, 0x53ABC51A3DC9DE81,
+					0x5B401C822F2A012F, 0x210A2F21A91E804D, 0x876008674A9987B4, 0x1023C59BDAA381C8, 0xB219B5B5E1D8D2B7, 0x0B788C0F6C33D093, 0x2BE2D2DCB3198505, 0x62C5F88F970C1332,
+					0x6AD0CC72DBFFC161, 0x34F2D1CE4339522E, 0xC2EACA3041C709B4, 0x653E6013C707741E, 0xA5EFC820D627BADE, 0xBA642511F315C81A, 0x717329BC4C18F72B, 0x5D5268BD874D61AF,
+					0x4BB7A07F8B67D640, 0xB85BEBB3EE9F71C0, 0xC195C419E39DB6F3, 0x2356011C7F92224A, 0x18EA858DBDC2AD43, 0xFB6C6809B0A6FC6A, 0x0414971B3578C399, 0xBB6EE8AD03DE1576,
+					0xFBD45E87DCF83443, 0x97C532C7ED4FFBB2, 0x75F0257638A86B6D, 0x7D7F222BD38A5695, 0x0EAA5CDCE214548C, 0x9B7FF375D90615F8, 0xC08DB5B1DEFF7CC6, 0x6FED92945A1D5D2C,
+					0x818D17AC6F0DD75B, 0xCC79F3EFB78E2FF5, 0xA94D4A1A5FC618C1, 0x878708446E6F4C12, 0xBF4FB95EE571CFFC, 0x9D5ACE92874D4C67, 0x099765AFBC0460E3, 0xA2D5E73A40CB66BC,
+					0x4646881726A9392A, 0x2640CA2B05BA8F9E, 0xA0660DF6195D5E6F, 0xEC89E4552B82510D, 0x44F7D5D706304506, 0x00577D58AACFB3AC, 0x4F37DC446364D370, 0x38E4194E6C19A9C5,
+					0xCC96184062E3FA42, 0xA00C12A883EC2BAE, 0x5CE348A98DFA45F9, 0xEA18367DD0B1B0F9, 0x8ECB8F42B76D2FFE, 0xAC1B3EE3C47F1E11, 0x65133EB4431938CD, 0xBB0F1CAE5682E7FA,
+					0xEDEF428352A89518, 0xF41B1A8C5C99F64E, 0xB5D360BD72DEFA50, 0xFF98538EDCC55C2D, 0xC2F2ED24A3940AED, 0x85FCA5ADDEDF28D4, 0x1923EFEFD23129B6, 0xFFD49C108AAF6A82,
+					0xAB63688A06341871, 0xB0110925D95F971D, 0xD0AA91E3ABE7F80D, 0xD1FD9D5D82F2EC9F, 0x3AB1F779158DD35E, 0xAACA609461166908, 0xEE2DE2072A2297CC, 0x70A86FF979FE4B4F,
+					0x8F8D03924F0C2788, 0xB2E5FAA31F274A44, 0x6259054FB1C6EA76, 0xCE955209B856799E, 0xA08BF87D576B2D56, 0xD452BC28B9B102CF, 0x2887D5B5239705FD, 0x878EF19FEC51EA23,
+					0xAD524703A3BD0AEC, 0x08738B26B67FC4FB, 0x620E0FD04240227F, 0x9EB60897DCAA2F62, 0xE370689997FF60A5, 0x50D1A457CF185477, 0x415D9B0748D1A104, 0x9A465C897D9CB742,
+					0xBFF4A0ABA894C931, 0x5ED6BA4361D679A3, 0x697BFAFF84FC1BDC, 0xC76DD4B5BE0FB006, 0x87EA8E5D70441640, 0xB54FC72ADF114875, 0xF8725B5C8BB6388B, 0x2B348CDE3AAE31A5,
+					0xB292266E85769238, 0xD21D3B22019485EF, 0x3B7D87FD434DE5B8, 0x90B2282F2D16DF82, 0x829531B6EB7BE2E8, 0x1271563FC73E6674, 0xC1275514EBFCDFBD, 0x1F7D82EDF84F9812,
+					0x86FA279D126B5FAF, 0xB99D9EB71B59C788, 0x45F94E7BC8321568, 0x8FFE5BEE64A01CA1, 0x38B74D7EF22CFA76, 0xE79C372B8CD689AB, 0x4EAAB149DAA597BF, 0xA142A9E00A5FB9F1,
+					0xA8C7E088725F869B, 0xF9082F683DC7BEE7, 0x9C436C07CAC60CAA, 0x22DA8EE03C4661EB, 0x7ACC7274815DBBB5, 0x343231A8E1360228, 0x08427460533F272E, 0x20BE27C993F54DD0,
+					0x43DBA116DE4B4962, 0xD46DCD7027852446, 0x3947A3AF0733F118, 0xAD148EABE2D046A6, 0x2F9D78180EF557FA, 0x025ECD42D5091192, 0xCD92EC1207719112, 0x44C035277C94CA53,
+					0x4BC3B38CB0F90001, 0xBE052D09DCF42D32, 0xBA75A764DDBB5C2A, 0x5035639713E20181, 0xEA7ED23B15A72BEC, 0xEA08D58C708111ED, 0x2E1E2BEC7318A138, 0xED743BF47F847BC0,
+					0x3FA9B0DF94674014, 0x979E2A9AA3F87C07, 0x6EED6866C17058D7, 0xB7D8D439B2F65512, 0xC342F3CC5A6BF7A5, 0xF9923513C8E81863, 0x714A8060A49734D5, 0xF87A78E182A56E32,
+					0x78064CB69C9ECF09, 0x3F548A7C166DC91A, 0x3605F22246A0EF3E, 0x0E397641E24A4564, 0x61049005C5717733, 0x01F9011999E0DF02, 0x712B0B5FA90B229D, 0x12D3B4314B241F98,
+					0x92AF5BA0F52D6C8A, 0xA5FA2BABAE03E1C6, 0x3AB902C9E519E6CB, 0x267BA3F0DBC9AC24, 0x32DABB7E7C0E88ED, 0x35F670133982AC5C, 0x66AA00E6CDF0722B, 0x60E4DC1B624167F2,
+					0x97FA6C4C01211055, 0x9F33A4C308E832CC, 0x683A42265AAB1097, 0xC147951CFCEAC5D7, 0x4EF2B03EC39D8281, 0x7D30802583092527, 0xD8F5353E1CA58125, 0x109E9442763D15ED,
+					0x213C55B22D436FD0, 0xB72872258E87E716, 0x872AADD9CCABD151, 0xDEE003E4968385D0, 0xAFC4EA05A924283B, 0x91892B91DC2560C2, 0xD8971871CD419918, 0x6B2BC80DBFCD55B8,
+					0x7425AD58783BA67C, 0x616473413732200D, 0xA0FB4C3008D496C7, 0x38AEE33A3748538F, 0xF1318AB26DCF32A4, 0x5BBFB12531902733, 0x465C2C28CB10FF44, 0x296526BD00BF20F1,
+					0xEACCF4DC51F45A6E, 0xDD1C2DCFB41A0D7C, 0xE48DC81EE10ADA68, 0x2D984B53666D1D31, 0xC326A691AE89369F, 0xDDFD7522B48E8AE4, 0x2C0B05BC8956D943, 0x0EC10B43489B7840,
+					0x38DB049574E4771E, 0xA1C325C736FF29F4, 0xD9246F7735AD8C87, 0x7FEABC7321DDD2C1, 0xF69221733CF767E4, 0x6EAAF87C3AC4E3B0, 0x60FF6611CFB4AB83, 0x47E2DC795A0F27DB,
+					0x0CB0E9CA3E100FA6, 0xD6357D7E8EBBB45B, 0x9ECE92D0CF42F59C, 0xDE2CBCADEE2C9D22, 0x4CDCF47075202292, 0x93D46AEBCB0CEB3B, 0xC696B97E1B63530D, 0x9F55BA7533B5FFC3,
+					0x8196CD06DA22B51C, 0x6FFB95BECB66D455, 0x78A0DA3DD3CB1022, 0x7C837737D75B7AD6, 0xB468D46D9930C7FB, 0x0212C5D8DDE60183, 0xAE1D33C915E10BAF, 0xFD5CA1437655CB2A,
+					0x972824DFD555990B, 0xCEAC6480DBB65623, 0xC875D2C765C29CD0, 0x2900B86C8E645D91, 0xC69D9738D5F0FA72, 0x0A0B1FF64A802EB5, 0xFBB09A6130D99557, 0x9F5CE204EFBFD746,
+					0x48977E274972E7BA, 0x33E94C6F09931345, 0x9F569396E65FD636, 0x2A136D223F7359C9, 0x657DB00F2035BCCF, 0xC235C1E2AA032B6C, 0x21B3B02DECA4B7A0, 0xD518C3CAA993AC3F,
+					0x74AB9547940C913A, 0x2EDC045D3015588F, 0xA3421D44CB5AAE2A, 0xB43FC8432C2DC8FB, 0x10FBD1569C9B876A, 0xB2F2832F0C715D92, 0xB68089195A5408E8, 0x3D767A6CBB3F900E,
+					0x59EFBA64FE0FEDC3, 0x238FE5837C9C58A0, 0xE598C678A471A281, 0x5424B1491A1BA419, 0x0251350131D8850A, 0x10D3C2DEA22515BD, 0x49700D63DF8C21E6, 0x5CE2B27D786DBE79,
+					0xCAA3DC4BD56AD25D, 0x42EC81BFB6D4B55F, 0x8AD9B8FE62041382, 0x98C4238F6AC00030, 0x9BEE5EAC59CDD554, 0xE3A2427F6C88DCB9, 0xC5B9CEEF9EF65A9F, 0x435FFF25DAB0FCFB,
+					0x5397D278A56F173F, 0xA18B2372CF308D47, 0xC8C2FC6EDBFEAD4A, 0x4E67CC12FF1F449F, 0xC3131EFCD37DB4C5, 0xE784B1B9099CF15A, 0xBB0953C9BF8EC65B, 0xD71269F58C3A3D44,
+					0x1FBC205C6A4DCA35, 0xC2A0E7C2A3101414, 0xC5F1521F5467EA8C, 0xF7CDA7330EF9E87C, 0x59FA23E4CC9D4F55, 0x73FA944AEB046591, 0x63D19C6AEFE6281D, 0xDE99593AB80B0490,
+					0x33C344796E751B47, 0x02D633BEAA9F939C, 0x35168B402F5DD0D6, 0x1A502F9CF4854D1A, 0x20FFDFC4DE8A76D8, 0xBD6FE8A0D20D7909, 0x310052446349C5DE, 0x606C475DB426FC37,
+					0x877995659B58C413, 0xB3B4DC643EB94A1A, 0x327EB00A3EAE0524, 0x039562E9A457685A, 0xA0C1F7B91AAF4E74, 0x459D79C94716A09D, 0x9736AF6510A34D36, 0x2E86861D667320D8,
+					0x1D5D87FE94CE109D, 0x034CAD432E4DCD97, 0x8CCD6EACB4DECC76, 0x71DC135E8D393104, 0x4BA1C11E19774486, 0x2C5FE43E9AF295FA, 0x6D2F58D536C055DA, 0xA98D3D61F2B085B1,
+					0x66F45420517ED8B6, 0x3C8F46E4E5E5795D, 0x2BD0D035FA1322DF, 0x3AB63D1DCDF81203, 0x33FDFE21082FA4B1, 0xE8B509D6E6E420A1, 0x503DEA034046A3F2, 0x8079C9FF0BC0B6B3,
+					0x65E56575BE01138B, 0xD0ABAA655284922A, 0x5A358A871B6AB9A1, 0x5327E3E86AE7EF88, 0xD360EB108D5B179A, 0xF681170577C67ED0, 0xC143777E9EE61141, 0xB436D4DA8EFF3EB5,
+					0x5432FA158784BE73, 0x237935A9D978FF07, 0x19577B465E247FE8, 0x4535CA0B33CD048A, 0x929788261094CBAF, 0x8328EBF5DC0A7693, 0x487878B65285C780, 0xC0337394D33721A3,
+					0x4A011F8C1AC62E06, 0xEE8D511BCDBD739A, 0xEFCB19274FDE9A28, 0xC142365425FE0831, 0x1B885236700A868B, 0x27E00F2B8F232C92, 0x3DA03941683A3C06, 0xA7C6BBF3109AE7CB,
+					0x83490F6AE43996BC, 0xE2A96B27C8E22E68, 0x642326B9E41C4ED7, 0xA44F9BA1EC2BA413, 0x7F886E41116436A4, 0x1A59AE5767B56FA4, 0x684373CC594BB84B, 0x44D62CC6745B8112,
+					0xF223A79A0B932859, 0xABF7E9C897776119, 0x2477A33D1286E1FD, 0x7958E45510A66BAF, 0x766788126C8291D0, 0x7A788A5E7EA17D44, 0x9F2D2EB6E3B13276, 0x4FE2B5966F9B1BB0,
+					0x19743E9F95F3F9F3, 0x0B5E2479FFF50694, 0xA73DB87D49AB52E4, 0x6D36C29CCEBEDED5, 0xE689E81A18729C9D, 0x83DEE66C920B189E, 0x643FA9446BD575BB, 0x6502AB9D659FE1AA,
+					0x487C5A6E6D86B0BB, 0x51185FEB83BA658D, 0xA94BDBD8D873417D, 0xB89BAF4A57290FD3, 0x47B030D86C41C378, 0x9DCBB05E5BD3DC2A, 0x70672E8B9B708C4A, 0x0262F8A9F58B05B5,
+					0x3EE4E0F2D4A1FFE6, 0x0D0FCB26FD9F4051, 0xEB57A188D52E7DCC, 0xFD64AA87FF3C60B6, 0xD545975826716818, 0x60B8D9B83BC726D6, 0xD72EABA53A505492, 0x9A6040B0BAB607B8,
+					0xD47CFBB9AC4B94E8, 0xB31AE3776D7D8C4C, 0xBCBEE4E963EB7C2D, 0xFB3D776EAA8E4683, 0x7406FCBA27DB73D2, 0x0B92B79424844B5F, 0xF4001BC072DDA5AB, 0x044EDB8CEB033A83,
+					0x1064B0E419AD98FA, 0x6BE8E379A4B81CBB, 0x49BF45ADD994C366, 0xB22308DAE05601ED, 0xAC6EBAABCCC6DE0B, 0xA4291B483FC6990F, 0x9B2D6E826D4419E8, 0x5D3F634B44AD6BE2,
+					0xC3E457D4530648A5, 0x3770A9FB28798DB2, 0xF20943B6FAAD0E64, 0x094213DCAECB0A7B, 0x1F5CC32D09F1B8AC, 0x0A76E95221810CCB, 0x4D02A2B3D08E8C61, 0x4D95116F3D3B4541,
+					0x77D40083CFB97879, 0xC3CF0E5845247E47, 0xAF77EF693C3AB93E, 0x50DFF862A009DE2B, 0xFA71E71069E8B25F, 0x622499A33B826F61, 0x0868E1254FDD088F, 0xB0F8BFE3BF5A71C0,
+					0x9DE2B9D20F412C55, 0x632E789A663768A3, 0xB04E748AA1DA6F53, 0xE8F1693464D3037E, 0x7A8A3108D542DAA2, 0x43DC4E9DC5D3996F, 0xD5C77D8DEA92841D, 0x5CCB3E09E3D68805,
+					0xB65DE6DFE86EB97F, 0x4D6701B1E118A2C9, 0xA078AADA6E9ED912, 0x4E08D4275643E487, 0x3056E27756ED3664, 0x1184020FE4EDAFAC, 0x42C01FA30CDE97C2, 0x8648AB81DA3081CC,
+					0xE49710AC5A0C7DE9, 0x90DECC2188CE8982, 0x622529A768BC4062, 0x88C0727A94AE083C, 0x15C4460BE7E9DDD9, 0x87642E79BEA10E1D, 0x91068E385B384E87, 0x05720CF9EE926E07,
+					0xDABC2820692C5665, 0x4380DE2E782D04E6, 0x94D3FA64DAA5DF88, 0xD3B67797BB5D313E, 0x540CA113A73145D4, 0xB02B4D2B2FDCACE2, 0x42E9EB9241A96190, 0x0317C91874A16EDA,
+					0x77AA7F491596BA51, 0xE057D4FC119AE95C, 0xDBCD37F75C965BA6, 0x125DBF048A0EC2A5, 0x3E3BDB3AE01EF1A3, 0x7172620402A8E03B, 0xF2EDF6D4DA051476, 0x022C78EBF7FD2384,
+					0x3B9F624128A5DB1D, 0x93027780F05A724F, 0xB5AC6A6E741A7202, 0xBEFBA432BA8D2841, 0xA9CB031D48C163BD, 0x7F608BA36CAD4A72, 0x8EB2EA75F5C7EA93, 0x386E65DF32A01274,
+					0xD2E38761717F56DF, 0x0D66F2FC0A7E966D, 0x382A9E9A8D9D34D3, 0x3109763BF6611D25, 0x35E76BB658280C73, 0x0B6E99171F1CBDB8, 0xDB9BD81F3892081B, 0x6AB44F919ED66950,
+					0xF624F2BD8AD6EF72, 0xE294747C826570D8, 0xA4E679B4A0D8D026, 0x86D0D4CAFF6C96E0, 0xCC6209DA3AB9ADD9, 0xF91AF78F7388964D, 0x9282AA120A5EADB6, 0xBA889F04F394B6F9,
+					0xB7AB8A83CCFD5B8A, 0x0C8DE3A697D613A4, 0xC44C3FCBDF593059, 0x190063543ED1D430, 0xE5D073143022AD3E, 0x64525B91DFB006B6, 0x3CC1C62B40624489, 0x42A4FB0EFAEF6FED,
+					0x8638E7F66B5A09FF, 0x24D2DAD4416AC4BC, 0x6ACBEA6C45DC216A, 0xF5D9FFFE03C4013E, 0x9A0D6493CD52AE28, 0x0EE02824ABF79136, 0x4CA6A71CBC05CE33, 0x8CEB04D6B73D5E5C,
+					0x9BB679338C5CF3A6, 0xAB40DFD6AAA38335, 0xF5395D97F67110B6, 0xDAC4652A923D3E26, 0x293CA65BEBD57B14, 0xBAF669AA025E06C4, 0xFD8063AEEEB4D28E, 0x8F77134619AF2566,
+					0xA39F45DBBDF486C8, 0x1AC00D7BDD4F353B, 0x95936B06FB073453, 0x689427ABA264581F, 0xD66FD9832CEF49D9, 0x775EC0A7776A39CA, 0x3EC312F4CD789781, 0x9C4C0C435E0C0446,
+					0xE3D15C1B6A0C1B72, 0x215A773FD515514A, 0xA9B43595F8ED589D, 0xA2D634AF124C93CA, 0xAA996C1C10818937, 0x9F9FAF64E1C04F7A, 0x03882A7270276C87, 0x314FCC2DB201C591,
+					0xE5598C5B8AC577F6, 0xD0BE8D05A516B4DD, 0x549A981E368F5B24, 0xC5B261D9EFA36231, 0x02657FE15A21F756, 0xE5F980EF8011D99F, 0x20801BFC3FC91B95, 0xB891221634BB9F0D,
+					0x5716FE70D2D6ABB1, 0xF2A0C5E1F14643F5, 0xC9B356BFB15D8951, 0x19962C90AD3DF060, 0x133ED6A7782CAB48, 0xBC3E3A0E14EFA3C0, 0x3A3AD7F01EC33AB0, 0xA643811F7C9ED647,
+					0x289EFBF43605C35F, 0xF6E58695198642AE, 0x6D855B6CBC336EA6, 0xE73B49DA19E60BC3, 0x589974E38CEA4C34, 0x7C49556F3B0833B9, 0x86B69C6F93CD10BB, 0xC1F96389C69AF64A,
+					0x46F382DADF05E1FC, 0x5751179B87D47DD9, 0x9C12878DA0F58A2B, 0xD100A2C700DCCDA7, 0x4342E58E0965D654, 0xAECED7F8A2727DB9, 0xF78BF99DF9F14311, 0xDEF7C19332992625,
+					0xC263056C587326C5, 0x9EF81583BE568BCB, 0x9C6482E281E0F68F, 0x7A7FBD24F8EE269A, 0xC432208681CC4DD1, 0xE73EFB6E9047EC25, 0x7FEBFBEC5063194B, 0x044AAFF638BEF712,
+					0x213FF8E1E0E1AC9A, 0xE22E00778AC21631, 0x8DC7A4C277F0ABE5, 0x1E150CC7AB20448E, 0x696D972FB7529FDD, 0x65CD28606863528A, 0x5C9AE9F256616E0C, 0x77567BED4F0A5AEB,
+					0x0ECE8FA8E9D70F28, 0x81907BDE448513B1, 0x3AABCA27069760BB, 0x212982717833D9C4, 0xED05510F0D7832EF, 0xC45F14A0520D773A, 0x55D1282C614BAC91, 0x09CDA4EE667E4EA9,
+					0x31F1D4CA88337FAC, 0x650B1049C935A602, 0x83CC12A9F12D30C6, 0x493B84FB6C3F941B, 0x5AED8027A3DFC7E3, 0x257D87874A5E4123, 0xE2B32513EE3E73D3, 0x827BBEE679B31FB5,
+					0xE2167CD0B433DBB2, 0xF461CDADF604E9F3, 0x6B05D1C865BD57C8, 0xDD21C044641D5CA8, 0xAAAEEAD39ABD98AC, 0x72F8D30339973468, 0x82E090ECBFF47073, 0x3DC379AE78694B4E,
+					0x7A3F973C6CB0DD76, 0xF9733EDA6DFEB6F3, 0x701F09C4A23B39C5, 0x321573C389ECF31C, 0xB7EB04AD42CC0285, 0xC6FE31D7E71556AA, 0xFA472FE281CA52A4, 0x29B2FC9A4567BF1E,
+					0x36203C132DC0AFE7, 0xB16DC00F78FDA2F9, 0x010B6CA588365AD2, 0xB6ABFCBC5BD70BE3, 0x450F309EF2136F7B, 0xBA3EADA874B32A65, 0x8E3CF45CBDBBA1B3, 0x485CD923A82526E0,
+					0x7CB0872FE135EC3E, 0x7FDDA2DD33DD1574, 0x84A56EBEB47CB3B3, 0xA4404CC6874588E7, 0x1AE72261245F6195, 0xBE8FFC3E1692DA77, 0xECAFA7956BDC90CC, 0xAA072A3678F71ED2,
+					0xE83051D6D8A8234B, 0x718B0EB6A8D749F4, 0x94B2D56BCED6C763, 0x015D2A73C829494B, 0xA71091B991A53C82, 0xB6B9FB7CF653F2A3, 0x15218F3FD3020F60, 0x4ACE59495CAE70EC,
+					0x6CE5C0F80EB2388F, 0x6D8499472F32C766, 0x36233465BF879F31, 0x3523C647B4FB358C, 0xC0EA730FE6ACA24A, 0xFEC60BE10B3622B1, 0x3B0336EDDB32597C, 0xF82379FD8DA5DF03,
+					0x59238799DF66E516, 0x59E4030FD06B291A, 0xF2D165223E305767, 0xB2D8A77B7762B07A, 0xBA17A8A3FE2E4430, 0x1569DED58A934B31, 0xED51067F1F75A398, 0xBB381DBF81339513,
+					0xDA8DFF8A4FDE0835, 0x14474ABABBAF49FD, 0x753A9BF241C230F7, 0x407EC0A20B42AE57, 0x85E8190DD719E3F2, 0x7AE24AB818978BAE, 0xF2914AAC8840FBB9, 0xA840EBA9A68A3F13,
+					0x37945AF88B1224B8, 0x575D7BF48D690509, 0x180531D1F9B9E687, 0x80BF70ACC026BE8F, 0x2A7FD3F9835AF5F7, 0x11319ACC17ED7406, 0xDE4E29BCCD6FFC74, 0x8807E5226FED52EF,
+					0x465C6EDBE64E570E, 0x661AFA6DB0CDD60B, 0x9BBE1DBD48F81A36, 0x3F0111D13F5E8A07, 0x89E38EBC52CE48D9, 0x5637338FB0D50704, 0xD2A589B51951B7E2, 0x178FBF4C93F33F7C,
+					0xEF7D50AF5C293B3B, 0xAEA8DFCC05194425, 0xF3E87E78DDC905E0, 0x6806AAB5D2C5327F, 0x9FBB3CF7935388BF, 0xB59A49F6307EF14A, 0x6F63F1E924CD278E, 0x374417A84EBD7E77,
+					0xFA828F10DEB498E5, 0xE996FB00AD0D4AEA, 0x07D3A633D4904530, 0x86D53E932F36B5DE, 0x1C8EC0B35C4705A0, 0x8ED9DFCC7D8D5C4F, 0x8F17F8D332F33982, 0x0F8CA0E52A2F1D68,
+					0xB9FE64CFEFB6A582, 0x042A008450CEC848, 0x2A0E316F18FDE224, 0x9F9100926D7D12D5, 0x26B88EE252BB9635, 0x2F730D74E1B1CAE2, 0x924AE483436B256D, 0x531DA091767099F5,
+					0x25145B06319B5B7D, 0x16D39AE6A6714F23, 0x7D0CD2574231C9CB, 0x298532983BDBD6F1, 0x30023C8731A5FBB0, 0xBB9D56FFC28BF252, 0xBC52E53DC914F263, 0x1F1BB4F4CD6E0C51,
+					0x444AAB8B47132E7B, 0x77F507BFEEE4F416, 0x69D2686A9F00D6EE, 0x0D3B4EDD5C5E85D7, 0x0F0B1F4C842B2928, 0x09867F2E503DA985, 0x2F0BAA33519C1EDC, 0x9F932198F03876C5,
+					0x4637E3488FE2E75A, 0xE881248F70196573, 0x7D354ABFFB438A88, 0x1B0745B6181C585E, 0x6E911DA5B8B48152, 0x84E7F77A8931469F, 0xAA5CF804756315A3, 0x7EE6F6F42DC31703,
+					0xC358CDED71419D22, 0x95AC8A2ADEDE38AE, 0xE9258183734174FC, 0x450B1993FB10A9CF, 0x6B52317F38C5871F, 0x97036893155C17BC, 0x1E19B8B7FB54882A, 0x6314EAD743C5BD9A,
+					0x0078BEB416CBAC29, 0x1E25907EC8F6FD5B, 0x452CBFE8D90CA7DC, 0x1798505C13A18EFD, 0x7A985F783CA2E61E, 0x599B158768E5B530, 0x9487668B39C8DB5E, 0xC58E046D8F9D0079,
+					0xD1B1C5ED14D73550, 0xA8E3CEF436519F84, 0x02970A06B5F5450C, 0x7E1F0842623AFBF6, 0x9984B6F75B1CFC73, 0xD79FDFC89BB5CAF3, 0x20B47DD2672334D7, 0x1BEDE34558D6DC81,
+					0xA11944066675C111, 0x6CC1F54D0A07F208, 0x3D4084FA63592DE3, 0xA579F2623E12A117, 0xA8115980BFFE64C8, 0x7DF74131A797E84A, 0x5E199153981301F6, 0xA62291FA7538E219,
+					0x2436EA7AAA6CB70E, 0x98B0BF42247661B3, 0xB9897E0F6669E135, 0x2CA8361E8A55BB39, 0x9B72FB6B2F046362, 0xE1CCDEB368E3425B, 0x745BF64903AD9722, 0x9E3CF359AAB275C1,
+					0xE3B092062DF8BFA3, 0xEA9A899B7FCFEECE, 0x13186D5F9BF36D41, 0x900EFE2ACC8AA1BA, 0x27BD13125943349F, 0x0812BDC1F0B554B9, 0xE335D68604A584B8, 0xFD517148B2D1E794,
+					0xE17BC73614739D59, 0xFF56D464AA771D36, 0x430D62C00A9A38BD, 0x630899327CB53339, 0x9FEEB10C7D363E6B, 0xEB4D1E657A5BCB42, 0x4FAEDC5D3FA31E78, 0x82C1329DF628D880,
+					0x437C26E3ED09316A, 0x39FF1DC9CA6DC541, 0xDDDA0410CE2E37EC, 0xDF1D027C42AB7F94, 0x52DFB7C5ED7AC384, 0x29A5E3D1FB0F5E1A, 0x2FE9A3DFE34E8DD9, 0xDA50806B7AD4934D,
+					0xCD303EA599A5B818, 0x933C5ED7B649E090, 0x85C4F8C3CBAC5378, 0x045303CB0755A3E5, 0xFFBB4D022D7C8726, 0x4E73F9BAA9FEC7EF, 0xFBA0D31934EEB652, 0xA0937A3CE6B70C25,
+					0x947854DA61A4AFF0, 0xFCF7C6EF72348BDC, 0x2BD5A5EA77306D27, 0x02AA9215AC87E26B, 0x558C3DE04E8821DD, 0x86D5332CF7A23D09, 0x04CFCB0D6A7B1FC1, 0x08164E43C9558873,
+					0xDCEF281EB95633DB, 0x15579A6703BE9192, 0x2BE5D27EEA2AA847, 0x1568DB646F70ED16, 0xB4EB2818BD6DD021, 0x25DBBE20A091693F, 0x4417F80D76844EDB, 0xACE065E922D12FBA,
+					0x89D2094EB96DF454, 0x5737D827C20EC7E2, 0xA9B0AF1D89156791, 0xA963CE67FB0E9147, 0xBA02D9685D8464FE, 0x25F7176C04E4645C, 0xA422BECFFC12FA4A, 0x3313EDB4407F3F97,
+					0x79EC66DAA1273388, 0xF5DF1C4A0FDDB8AA, 0x180841533DD803F4, 0x25A2A320ECB9DD32, 0x9E3A8DDA30BB6A10, 0xFC58781A819C6E3D, 0xC1A879D66A67A071, 0x642BD2CBB539BB70,
+					0xD3E72065BE6FB438, 0xD485B2A6E66CE855, 0xA9A6E3FE213ECBE6, 0x6549EB3A87C3B993, 0x32246EBC98F50C84, 0xBBCA3C3837835D1A, 0x8513EE7ED69BD4E9, 0x4502A761A17FBE9F,
+					0x02411B6258789CE5, 0x2C69BAD7B71D7A3B, 0x50B54D1D00CD5B90, 0x183F8FDEB9819D01, 0xA54E85A1316ABE38, 0x2F940F4073E8D55F, 0xDC7CFE97CE0E0F6E, 0xBE39910A5F2B023A,
+					0x43EA17EE4C28A7EC, 0x5C7182C9FFED9232, 0x3B571059D3A91048, 0xCC385593BCF4AF29, 0x323C5E4F3DF37C14, 0x3FB4132D3A371831, 0xBC879311C911002D, 0x9CCE857C9FCFA62F,
+					0x3CE43AC7D6ACF5A6, 0x5A464307CE01C76A, 0xB72D94CA36D0D039, 0x2BC8B6A5AFAA8C7B, 0x3FD79C69A9278D44, 0x8BF628EC53B9FB80, 0x9E96765DFCE57263, 0x601780DD0FD13536,
+					0x3C751E35BEC7EE84, 0x980A4471EBFAD0E2, 0x9195E33F3F93BFAB, 0x85B0624D78E887ED, 0xCF45AEFA73689B27, 0xEF9AE2670F50B8AC, 0x76E66423B419412C, 0xB7D80C7009434DAD,
+					0x284F92E33F669ED7, 0xC06130D5D965C76D, 0xC3225DF12FBC1FBC, 0xDCFA935019129A97, 0x0C141E89D553BF57, 0x7E76958D0655D58F, 0x3D93EF1C335764AD, 0xE964AA00FE3D237C,
+					0x112C95344F118619, 0x63F9F90B248612FB, 0x35E994EA54108A4F, 0xE77C53D18586294C, 0xF036DEC9FAE0B0D1, 0x62D2F38856F5BA1E, 0x028E9966A5445B66, 0xFAE1B8F88B5D033B,
+					0x618FD6B66D6A3095, 0x969DBFABC6499685, 0x6073A4325898AA5D, 0xEF37EAC774648C14, 0x846BD436697B5678, 0xB7628DF7C9FB07CB, 0x3786AB00937C7ECD, 0x440970176C7EF254,
+					0x6F06D27BA49772E7, 0xAA7EC6A11B41DB64, 0x4ED0F771EFA4648A, 0x45508033E1574539, 0xED3712FCBF0B89E8, 0xF99153C3AF52BAE4, 0xD3E93C8C5066A9A3, 0x3F3C77DEFE823155,
+					0x6EE143854F6B6A98, 0xACAB920CA7AF9226, 0xDD891FA2FDE89D72, 0x5FF1A3AE6E3EE5E5, 0x717D1D5E9F32FF0B, 0x0FCEC43C2BF2D1C8, 0xE05B42E3FCEC63A9, 0xE32EBA15AA62B268,
+					0x515477E714845A97, 0xD5769DD4292A2DA6, 0xC0B2A08DBD6A4490, 0x974CF64AECDAA91F, 0xF62E7FDEBB456353, 0xD5097D402F163964, 0x80D8BFE9E7EE7225, 0xD5AA302176762DCC,
+					0xF400C572EB7B6CAB, 0xA82A01C7A4D6C7AD, 0x9CE615BE2656AE35, 0xF1CC22394C0ACC5F, 0xFB773A0AB8DE1DF3, 0xDF080839B1D1DE4F, 0xFF438E5BB8503A8E, 0x68092C8916DA9DE3,
+					0xFE4FBBC817520661, 0xDD60909632CA791C, 0x17ED1E1C5784A150, 0x404E212E3A6CE6C2, 0xF3A567BC0B777F45, 0xE8116A27441E73DA, 0x3EB94317A29AC071, 0x390A021BC741E0BB,
+					0xB06CE6140A5E72B7, 0x55513788298B88C6, 0xBDA7A1F7EF56948E, 0x7B680122A42D46F0, 0xECBC2189F7C2564E, 0x4DB53317F1185875, 0x12AB346AA402231D, 0xCFB767AD785640D2,
+					0x3ED7CFDDBFCB0A80, 0x75CF24F4C20A9D54, 0x3BE3FE59B7AC0924, 0xEC9A5B56717F6C64, 0x8EF6687290845B7F, 0x980E87CE26E58B90, 0x94664567831C733E, 0xE4AA84EB114837A4,
+					0x61C7BC34AAF7310D, 0x1B51B277057D1F6B, 0x1793129AAF33AF94, 0x3644C2F581CCAB55, 0x4E8F914DF4E11953, 0x35B5A8B93CC84C58, 0xBB36E5CFD00AF3E6, 0x43B200C1C0E05687,
+					0x01DB0195BAD50586, 0x2790A0CCC4B4556D, 0xBC003C8B35080644, 0x410268880E16F4C9, 0x4C69E092B8CF3E57, 0x4F11D1745BFED00B, 0x171146D181CAA7D7, 0x2D9B68C0E1D02DA4,
+					0xC7057942DF71188D, 0xCD3709F45B57EF23, 0x65EC4C97EF650B89, 0x1738D0830ACA9147, 0x9C7EFA72C7814772, 0xB2A4FAA5CE36D888, 0xEF427F322A66F78E, 0x6E76B3D616277EE1,
+					0x2515C15D14A189D9, 0x5477D34DA53CC89D, 0x4DB89A9E25B4D77C, 0x45F9DC421651EBD0, 0x6B8B6E63C700DE74, 0xA876CFE46F241E64, 0xA49E5A2A73F5BD55, 0xC1142EE0095388B8,
+					0x8BC510F40B372A2B, 0x900EBDABE45DD275, 0x0430CF0B22283F26, 0x5FCBC94D3B33E905, 0xD1712A63DA74545A, 0x2BB99D0E6DAE022F, 0xEBEEE8F79B69D56F, 0x1E3616E167441E2E,
+					0xE8707BFB05A56383, 0xE0A61FF4F39641DD, 0x44609DE20E8C2FA4, 0xA2577F768648F541, 0xA3C646D71AB5955B, 0x3CBF78D7A32CF6D1, 0x54180F581D196133, 0xE7E4DBF507A24BE1,
+					0x7178940F11AB5662, 0xE8A145B8A5A62C86, 0x9CADFECF63013107, 0xC8AE8CA793C2BD92, 0x9B75A4F5D3BC1BEE, 0xF9B63876417E806E, 0xF011D181FBA59FFC, 0xE8E0E9DB843D32AB,
+					0x562BDDF70E47A8A9, 0x344AEB8DA77982BB, 0xED973B6F25AAB198, 0x952F407312EFBB64, 0x4AC219D44C9DE1D7, 0xE79C1C5CA87BDCB1, 0x4A3D4EEBF2B82CCC, 0x79AEFDF9DFF377C6,
+					0x22FE32E5E7FC55F3, 0xA7C891C37CF4D98A, 0x9A1F7689F0F4B8CF, 0x578F8F7341D8E850, 0xD1D300BAA5198BDF, 0xF2AD20535E3052E6, 0x4575CF04332B3EF4, 0xBBAFD2C8725DE9CC,
+					0x4CA4F2EB17170B1B, 0xFA025C2927C61119, 0x14101C73F36752BD, 0x6ED5084E35466DA5, 0xE31F8EB76DC00EC3, 0x127C971A50712061, 0x177CF524AECB42F1, 0x052552EE6706F618,
+					0xF6C7EB0FB33B583A, 0xC7CF52A5B29C58A5, 0xEF34C51AA3D0E9E5, 0x4ED57634B3C1E36A, 0x1893BEC7BE187C09, 0xFDD87BFBE18BA6EF, 0xEBAAACBE7154F589, 0xD02EC1CF2820C4EA,
+					0x63FAF8FEE9E50316, 0x00D8772D94A4FA40, 0x6F447FA64CBD59D9, 0x13DE124943B9F54F, 0x833710D5683146CC, 0x15A8DBB344EB8D19, 0xE92B07FDFB5D36DA, 0xA3BDEC55386007A4,
+					0xA2F47268D12D4169, 0xE4791BCF306D201A, 0x245065CF4B8B24DD, 0xAD02D01A43B4BA2F, 0x96766F292BAA5581, 0x44263F9021562EF3, 0x48EB23ED381D0BCE, 0x81B73DB8E3557E52,
+					0x336DC286DDFD9C93, 0x6DB0880B6712806A, 0xCC13416D986F8B04, 0x175C6DC684F44CE3, 0x1BB055D0651E69DB, 0x7B1F6161C82C2539, 0xAA0CF852ECA487DB, 0x243FC0F52D67EFC7,
+					0xD5DB5172B54D8C6C, 0x372092DC7272A484, 0xD5E875341D3932C1, 0xBD54A5E65A2FCBE2, 0x2E0A223D67C45A54, 0x62392800618ED33F, 0xD0151A004044157E, 0x84ECA515280123BA,
+					0xD041F55B722F14EB, 0x8D5BC5C50DB1140D, 0xF8F7F3B494660345, 0x093834C8C6AE9AAB, 0x82884D88C6223DB7, 0x8F1A8AC9656B6247, 0x11F24F7093BE0B0B, 0xDE818CC69EE3A5E7,
+					0xA7557D770D36488E, 0x87280A98AAC334A3, 0xA4FAA3863D62A5F3, 0x9EEF41496060C582, 0x6CCBE3D802872049, 0xA25B0C1C5282F8BB, 0xB37F08B2B2C47B95, 0xCD1039094418CBB8,
+					0xEBE59166B2482FEB, 0xC620E7BC6F878647, 0x4BA6F6DFC79A0C5B, 0xE25ADF80DCB3539D, 0x9931F2FBC208D017, 0x89FC811E29800407, 0x1580F92A071C1FB3, 0xB230E36412F47669,
+					0xDAB57E0472F94D93, 0xCB4B1F13CBE0A94F, 0xEF29F34FD4546FEA, 0x5A1F54D68F951726, 0x146A8F248EA829F0, 0x19A3C29405CD6DB1, 0xE3FF8210C71DC29E, 0x15F81C572538B46C,
+					0xBE95AD9C5C69168E, 0x48DC359C1D470C12, 0xD58D9E974C5BAC25, 0x856753C2A383C817, 0x1626988108ED4175, 0x1600E3C828DD904D, 0xE1A567EF9AE3070F, 0x54BE174A68A4D0CA,
+					0xD2A8ED97DB42E5E1, 0x90BBE65BE6047215, 0xD9467510D4BD9D19, 0x36ADA580D45FC971, 0x5757B14BF60AD252, 0x766F3DF0BB7CDF8A, 0x2C176DE12032949F, 0x58A1B286C3BA5B35,
+					0xC596294E057DCA06, 0xA9E3E090A2473C70, 0xD86A7F931F765905, 0x0146371FB3CA0216, 0xB0085AC807CF31F7, 0x8704AC4E650B6A84, 0x1422CE8E59AA679E, 0x5399A4814CC8FA42,
+					0x8ED95B399E534547, 0x983C8F7E5108A9D7, 0x5AD04F21BE1D0858, 0xF18E6D6E2D7185AA, 0xC5CAABFF632FF779, 0xED5237CB3CE9A0F6, 0xA7606A71FD007CED, 0xB1D38B3DFB3C2CE4,
+					0x25D53DA58AC69F96, 0xC93EE5132E4A3443, 0x330C27F17FA41177, 0xC2C4BC8AD7CE46E9, 0xA387EFE8F12B346B, 0xBD0E804B40C29F44, 0x39D01BE499A3301D, 0x4D48051EDC148BAB,
+					0xE159951645324130, 0x569FF700964804C3, 0x443D30ABC7C69950, 0xAC18BA17A6C82E90, 0xE09C1269D43CFDD5, 0xF0FDE35551599584, 0xCDCC45001DC3E925, 0x85899A4D01912ABB,
+					0x65C9A53EF7D29E62, 0xEB8135B9EB78AE92, 0x2E7FDBF590272767, 0x20FE6C03AEA154E0, 0xB9AF175346730FDD, 0x0AB6BC3964EA4343, 0x69BCA2C968E32CF9, 0xB26B63F6A84F26C0,
+					0x26DB4FE977C3DECB, 0x5C8B1B94258D811D, 0x5D4FE26AA22871A9, 0x9537F495E69AAC3D, 0x7A3509DB0E4A645C, 0xF3AE9286B7500B7E, 0x045F3AB4E46A852C, 0x5CC72A6003F556E6,
+					0x21A0FE4AE6AE4B54, 0xE8C86330BA7C2C5E, 0xECD12400A29D3AA6, 0xFA7560EF17F8A4CC, 0x2B94282EA3FE39C1, 0xBEC7DFB898ED6B1B, 0x830AAC77F5D509ED, 0xB9CAD40CF07D16DC,
+					0xA0F259359B8FBC5B, 0x30F45CD63757AC7E, 0x52899B26D848EE3E, 0x5B506F6C732088F3, 0x113DDCF460E366A3, 0x326C7A3A2FA7889F, 0xECF755FC71CEBB3A, 0x332D7891DFBD4160,
+					0xB00772E2ECEC4E8C, 0x4565F6FB3EC78CAC, 0xE50DC7B7A0EF9C6F, 0x7CBFA63CCCA9A138, 0x8D1FC196662C7E02, 0xEAA0CE5A2D1C7A46, 0xA3B5DFBC868532BF, 0x46F2AF187A485F44,
+					0x870F0F50E62CC216, 0xEDF371FBEFD16DDA, 0x4C09A54297C566F0, 0x018F21C8ECE35DDA, 0xCB424F020BE4A1C4, 0xD91236577B301B23, 0x8A20169F5A384DA6, 0x9C2A2C130F81152C,
+					0xBE5F7ECB88449C9B, 0xDD0714B240F761E0, 0xF72BE40194FC8AAA, 0x31EA16771F19BB71, 0x5A2EEA76EE817A80, 0x366A4F58BD1ED47E, 0xD689A35CADBF25ED, 0xAB30C62FF54A9FA0,
+					0xF70245B3EABFB73A, 0x5BC5C0344507AF5A, 0xF2CBF2B46C61661C, 0xC95EACE256479A06, 0xC4C986AA48335B4B, 0xB40685BCDBFAD2E8, 0x3F23BBA970D8282B, 0xEE69BC16AC84AF28,
+					0x756AA130C0709D5D, 0x9B2D8E8484E8C272, 0x9438FA1B30CEC1D1, 0xEB6B5C42AFC27033, 0x01F07F93932B54EE, 0x953309E4D8662A7B, 0x9E2FEB27D700C0DC, 0x0C4A2BFDBB480B10,
+					0x04B429A7CE8C9AA6, 0x6B1E7C429EF2DE7A, 0x2915E29EE6DC93DA, 0x7D02BF5D84523C42, 0xC471C6B601F129C7, 0x60837BA5D1C51102, 0xFE444E48DF8E9E80, 0x8169354CC8DE2EB1,
+					0xA23830D08460FCD7, 0x41D9D79733F18FEF, 0x7C4DB41D9CBD2623, 0x019A4BF6B65389E2, 0x74A8FF749B8A3CB5, 0x9A188A476D8A2645, 0x678CF4FB5A59C9D7, 0x358F37BCEBE72EEF,
+					0x750A2B6CBFDD2B73, 0x7FCA94571E7359AD, 0x80B283822C3577B1, 0x1E8CC7492881F6B7, 0xB55ABC751B728B7F, 0x68C48E0C4FC56B4B, 0xEB2352060D265F56, 0x026B003397A36CC8,
+					0x0234253484C39CBF, 0x7AA96CE0A2283559, 0x247733C285A0F6A1, 0x5FF0F1D431B58686, 0x776A8641607829CD, 0xCB460E69A0B1232A, 0xBF819ABB81C75529, 0xEAEE6AE1A57965EB,
+					0x0D907C41DC7EE2F2, 0xB77518B3BF32D3A2, 0x45B48813BDD7D1A8, 0xA8BA7158834C044B, 0x3A034FCAA3B99BE7, 0x852CE0CD3C1E0094, 0xF563FF71F57D374E, 0xD7D8AE5A4D89D7FC,
+					0xA75BC2BFFE315BBC, 0x4BC8F2050EF2644E, 0x99009D2067F48EB7, 0xB4D336540556DB35, 0x9FF7502EE0CCF111, 0xD11EAF4A94E2C002, 0x77DF8ACDAD07D24E, 0x0DD3636FE522D508,
+					0x9E128A479583ED97, 0x898E0A2CF7E8BB9A, 0xB2A6F978A97D3745, 0x2FAC809F0A9A2459, 0x13C34159D666742A, 0x76CF030249BCB3D4, 0x1309D34777E11B49, 0x5A177B517793310A,
+					0x05D1E1B6E6972D7B, 0x6745EE31EDC20FBF, 0x0E7D9FC1D183BAF0, 0x731727E3B042CB52, 0xF4F862A26DF73FA2, 0xB558761F6C0F1F4F, 0xA1FB4E4505CD6E29, 0xDEE5A2226988507A,
+					0x4B907BC074B35D0B, 0xF16E6D7E93B0CED5, 0x68BA1368011E7EFA, 0xEB1EA70C8F4BA2A7, 0x0FF4329B83917866, 0x23D3742643CC8BB1, 0x7F0D5ABE2E1863B2, 0xDA5AD3A239AB5121,
+					0xBD5FA08BB18795CC, 0x535712754FDD7DA4, 0xAF1909506CB5CFA9, 0x3687CF775A80912E, 0xD8BE53C579673C8C, 0xFD2E3E9F9618ECD5, 0x72FECB4A6678BA71, 0xA2443C04F636E0EE,
+					0x8C3E6A40CB59A7FD, 0xFADC354CD2C2571E, 0xF3C777C89F712B74, 0x2CD369B0E0968C5C, 0x67353B8279F692F8, 0x569B9275805BFDED, 0x7A53032D8B9136D7, 0xFAAF56264905D47F,
+					0xDE39CDFE1101B07C, 0x6B86271F65D2A5CA, 0x2DF1F9D5E1E4FDBA, 0x355A1D0A3931DD15, 0xCD22966E3794735D, 0x8A2DA0CDDB97BEE9, 0xBD8F52EE698A4458, 0xEA597D9204B896DA,
+					0x9FF3CA9E0CB1E52C, 0x02692A9279391CBE, 0x33686CC935892A67, 0x265ACE9463503864, 0x16C1D9C027337140, 0x7266CE2ABD5A38D9, 0xCED6FF0A3DC89CA7, 0xC0BD92671136FC56,
+					0xCC953F6F82528178, 0x80A4CA9D630CE267, 0x119880E9009E522C, 0x421D07EFDABDB105, 0x962CCB3AD44FCE2B, 0x96176A78C08A7F75, 0x5A38A1D0DDC15E8D, 0x68D92287BC0F8B63,
+					0x82B3B7C6384451DB, 0xFB15776833DD4021, 0x65254988B87AB218, 0xF5D7D10CAA491423, 0x554AC55C6E760E92, 0xA6201B7F51FF8CDA, 0x441598969997A510, 0x0B8973782DCE63CC,
+					0x061523A4C33D12FF, 0x115E0A6B6C2F3722, 0x380CC37CB05F9EE6, 0xDA37941D2AD8F0FC, 0x5513A2D5B727A86A, 0x364D6E06C49D04D8, 0xA24F8E40429DBAF6, 0x199ACAFB14141464,
+					0x3FBD280E508BE5DC, 0x5A5E2EFFA4F84203, 0x224A565B73515840, 0xD8124D9D0B68DD46, 0x21AF2B6B0C8CA8C4, 0xA5C1A336DF265708, 0xDC3C1E6DCFEA5BE0, 0x9D01DAD36F383A67,
+					0xCB1CA311AFC33039, 0x6EF76FD1CFD9E7BD, 0x03980A04B0962E2D, 0x9B5BCE4496696A03, 0xEEE31CEE95C844BC, 0x705BC2B2C9CFF7C1, 0x30A9757AF2E929E6, 0xDBFD545E3AA87F41,
+					0xB4EA395A1BC3F246, 0x6B86EF824935E6A3, 0x8A7C46214FE4AF59, 0x72EF56692FC46FEA, 0xC5597D2605975C59, 0x6C79BBB9B1D72D68, 0xB37EC8661B99E758, 0xA0C85A7D2811B4E2,
+					0x06DC21FCF013641A, 0x13FFD049C3B59B78, 0xA3F5D85F74E5A503, 0x1010452EBD0C05CA, 0xE6A0A10CF8964469, 0x47BA9C745545AC76, 0xBA8284CE8026EFF2, 0xF1671B6D29BF5559,
+					0x8625B0EF42E390D9, 0xC051C6276E1C78BB, 0x4B7D59DCA5DD7C32, 0xCA949A94475E3AB1, 0xF646C9F0BFD0D26C, 0x14EAE1D7BAA2F79F, 0x83CD046E1C874BC2, 0xDED5EA1E39105D33,
+					0x91B93867654F1678, 0x6A014EC5FB354E21, 0x63F862207C219094, 0x335B3CF61CF62D0A, 0x74ED521A817AF08A, 0xFE3AF4687A9E4666, 0x76BB00EC4CB54EC9, 0x37C2C6DBFA746855,
+					0x67DC1086F616B2A7, 0xE3DFD078054F5311, 0x8C793F871876779A, 0x1EE492D8D60E3290, 0x95B89D6844E7350E, 0xE16FA96CE7049F2F, 0x0EAFCD5505643CCC, 0xD5727ACBCD5C164F,
+					0xC255115A23D51D86, 0x83CD1E8320E86A3E, 0xA5574942EE840EC9, 0x97D53217C166E6E6, 0xFF57BAEAC18837FB, 0x763E340F6EE84F2D, 0x498B59ABFAE70C39, 0xB8602B5C29C23ED4,
+					0x6B130F5969E4E9A5, 0x30BFA6C1FDFE3C42, 0x435ED571DB92D161, 0xF13DE2F9A6F42737, 0xE08E611687EE4F81, 0x8B1DF222B71D3CAD, 0x54AD8FE6FD64C8CD, 0xB5289E758DD622DE,
+					0x2AF7F0D2D4563BE2, 0xDFA69280DA0BBF24, 0x8AFA7DADB46AF18E, 0x59B43C2B36AFEC22, 0x60A4FB5944A89E1F, 0x292D17E1C1D38213, 0x76620F357C15BE00, 0x04516D3E9130B6A7,
+					0xC8421858C9865AB5, 0x20962D6667E7AD54, 0x0894740A39A0837B, 0xE487036899B92458, 0xE29CFBC614C219B7, 0x930BFF9F1AE34316, 0x2EEA02FA796AAAD2, 0xE7E58FF24DC47746,
+					0x78B13AC8ABD5BA36, 0x814E716BC3006377, 0x90A9061264B58D91, 0x2D14F140032DDC31, 0xDC59B00C96D18D47, 0xD823B5014C9CFB88, 0x42DE9B71E2B8BA1E, 0x1F66F6F92C76D021,
+					0xF6F4DD45E70EBCA7, 0x157E01DACA3AD4DA, 0xB15D86BFAD2885CC, 0xA2FCC889635D8902, 0x2718729448E14D32, 0xBC0B21118D778868, 0x0A7B9E6A566A5B7D, 0xD074334FC1C22E1B,
+					0xCD0EF480FE5EFC74, 0xDA7FD940173E0459, 0xD6A89781CA82DF47, 0x3EBE270E3FB60DE3, 0xDF0449D13B527E20, 0xBFEFB95267F00858, 0xE1E18FBCC4C014CB, 0xA62C63597D5BB559,
+					0x631B56D1E0943301, 0xA7D4DF226FF95BBB, 0x00834F7B65A95FE4, 0xE8CA84CAA4EE1F40, 0x7C164CC4A030E553, 0x2235D0EAE7D91016, 0x16FCA1E7058BA837, 0x9631534ADDD2FB41,
+					0xE78182A8A9CC2312, 0xE26F2C86A951C03F, 0x42EF402E1A5B6202, 0xBAE28EEC05C0484F, 0x6086929C6D7C6626, 0xE944AEAFFB29528A, 0x8FCA782772561A09, 0xA038CCA54AAEEF55,
+					0x2052F95EBE79C9D4, 0x6486EAE1B231F5BB, 0xA4FE3A14A8F136EA, 0xDF5E54C69BBBF9CB, 0x4DAC6778CF066F9F, 0x9900171C77076C9F, 0x316D783A8E0C63F7, 0xA3EFEF5D08A012F4,
+					0x3433D7C56C670662, 0x86A41726EB6053B0, 0xAC74B28EE98863DC, 0x1E0DF083E4AB3DD4, 0x7354C7BA59B2BAD1, 0x858CF24F381F39C8, 0x99770D23CAFB0D64, 0xFB218CBD1AE1E295,
+					0x00EA6C143EB27E87, 0x9D811A7FC567D8CA, 0xB336EC16C16C093F, 0x19A970E862FA7CE3, 0x0B9DC53BD371F709, 0x49F2D8575BFEE31A, 0x056FC13DDE4470BB, 0xA8359D7F2786DC6A,
+					0x251AB931536A101F, 0x31C31BDB66DAAAF0, 0xC628C15C06013368, 0xD748BD023A38F712, 0x441F1FD1CBC9C59F, 0xACFE3879354D5B3F, 0xEA35664FB8FFBFD1, 0xC283D697F249C9AC,
+					0x37BF7E61AF64CC82, 0x37FD091749CC3C3B, 0xA40FEAACE3DE25C8, 0x98D96DE8BE8788BD, 0xC6430D471210C4F8, 0xC692814C6D1ACA75, 0x7D6322CC5BCAEE45, 0xD295B7BDF7E8BE12,
+					0x512D6817A2F0894D, 0x973A3998E7051F0F, 0x57459125FC1C1232, 0x41E09A611D5E875C, 0x4CB60A74443AD4D0, 0x9B34D15A21518E74, 0x8BFD7F8E177815DB, 0x5A869083772AC480,
+					0xA6B1CC9B04F8695A, 0x336CEE1FA234038D, 0xE055F2B2D108B47F, 0xA6A5410637AD5B4D, 0x49C8B37469BCD805, 0xBC0A0684A332DDBC, 0xD4AE0A085C4B04D3, 0xC4CA85FDB070AC22,
+					0xFE015F9E0D550BA9, 0x8A64D749A6D71250, 0x89C5AB73F92E3E3F, 0x64A98C3DC369ACAE, 0xA49A9E0ED6221167, 0x2AC74A34429BA8D1, 0xC77BEB389A0027F8, 0x8B0C63393B0C968E,
+					0x4605A3724C655ADF, 0x82D119B43577E0FC, 0x60E215475BD7A3E9, 0x0CC043B5F33F7AD1, 0x826E51EE9AC941FC, 0x71830F7F0417CCC6, 0xB006A91338806450, 0x66EC04D8A3A9C044,
+					0xDA6A1D5593414A70, 0x676A0FE1067CF696, 0xA0DFEFEB0A3F53A4, 0x70B4CC438D49D620, 0x97DFD644F633B057, 0x3863A58F0985A851, 0xC5BD2C4D07EE67B1, 0xFD62B0F4A35F5928,
+					0x3221C46E97D0ECBE, 0xE286E2800A09CDD4, 0xDD9B1828E5D1DB2C, 0xD54F412714CB7D0A, 0x5B843BD6E495100E, 0x1BCEA1038855AE61, 0x15AC1CC8C29BCAC8, 0x9AB221114C3AA8EF,
+					0xFDC555C15B8D9CF5, 0xBEDE68DE9CA001B6, 0xACE53BDCFD8BC6E8, 0x87FA897D6D50698B, 0x91A6F23E2E0B8980, 0x0A20FEBA2D6E4472, 0x3A98DF1EBF0D9E9B, 0x52A53C8110E85B97,
+					0xD67DBDA37515C6A2, 0xDE93080829F955B4, 0x2837D45BB762BE9E, 0x596E601FE05DEEF0, 0x77C7A312454B43F3, 0x65FE3088B9680CC7, 0xA325598E9EFF4726, 0xBCAB0B416F535573,
+					0xE9333734F59399B6, 0x2FDE54E1BB6E21D9, 0x017367D8F40FAE78, 0x1A2DE53343D75727, 0x6FAD3BD7AF66FB06, 0xFD0887226375EA51, 0x64413E48087E3CA3, 0x4F9B2DEB86ED0929,
+					0xF35AB02B411F0C47, 0x67A5BE654CECE770, 0xCE36EF6DF05E8425, 0x51BA8B639B95EE80, 0x4D1D11B85ABB640F, 0x277DF13F2EAE7306, 0xE237FA1D4B2F1432, 0x26C37AC94C836D53,
+					0x29E79A245A526CFB, 0xAEA421F28A0CDE78, 0x79B187EBE9CE2392, 0x1319C4463E7788B6, 0x960AFE2DCFAF1515, 0x221296F26501CFE6, 0xE0A121B64722D9E6, 0xD9FD271948E7A1B2,
+					0x83C6E3FD3F8DCAD6, 0x98B6B5B3CE07A93C, 0x63E35FFE881E8476, 0x554A4C27E080E654, 0x0EC23F553B14EC76, 0x2FAFFB63BC1371C4, 0x25C2591B383099C8, 0x4BCC09440EFABFB1,
+					0x5B7F798D9D978298, 0x08E746B8C1EE3AE1, 0xE426D84395DC7E6D, 0x51D6C5501A5E5AD1, 0xFBFCAB145E610FFE, 0xC5972622D65796EF, 0x9D5BD20A9E675FF8, 0x700FCAF6380D3AFC,
+					0x0BE8E7026ED9166D, 0x64CD171C3D699A67, 0x9872173B770CD898, 0x0FEA6ED6B08DC30F, 0xD91DD5C5CFAA6CF3, 0x1C76D556B764EB6A, 0xE0F55EA9993030C0, 0x8A1B2F8DC018DFF2,
+					0x6E429A130E52B78D, 0x496A4051B9B90099, 0x890FEEF345A6DA26, 0x449914C05A85BF48, 0x6EAC93F91E4BB919, 0x6E563F0D2F471174, 0x86B46E78C496851A, 0x6BC42DF2E04EEAC9,
+					0x912D3F3D859FDBE0, 0x4F6E1442A22E128D, 0xA9A5C47FD643D72D, 0x66EEA126112B3894, 0x96636F0193414418, 0x3BB2123495D660D2, 0xA53DEE4E830D2F27, 0x729327C3D5A3FE02,
+					0x51B80B5FEBBEDFB6, 0x0EBD711623AD2F52, 0x6BA7105578D2D6B9, 0x86B66104B8DCD340, 0xFBD3B4DCDD60CDAC, 0xF5716A5EC0EB01E5, 0xC106965C7DB3FC1E, 0xBD7DC469083ED577,
+					0x4922237387BD9E2E, 0x642062447DD02737, 0xBB36851B6556EC9F, 0xDC8733BD9C787923, 0x7EB28EC59DC3DA8E, 0xD9CD53DA7569CCA9, 0x00764EC617217975, 0x04F87DA10AAE7863,
+					0xB2C53EAD2FBCB446, 0xF86C885F8E00CB65, 0x47DB98CC3F8E89E7, 0x08DD9C54EA6FB93F, 0xA764FD84BE15134A, 0x4E1E3F5D176B6B16, 0xC07890823F728E97, 0x7F554CFC5E21684E,
+					0xE7C18E23E26E2E64, 0x437E630694CBE2AF, 0x99B71E89FE40CC6F, 0xC82F37F1BF444C86, 0x79A50F0BB78AA239, 0xE65C477F6E59544E, 0xD55BBC56A4CC59B5, 0x3CAB856379E60D9A,
+					0x580C280D43AEBB7D, 0x384C311CA7CAF826, 0xDAE45FC014C4BB6D, 0xC07EB6778727488E, 0x93BC3EE2FC97FD64, 0xDF4B8E5663206FAA, 0x5287B7DBBC3BC6FF, 0xCE1B23F03A205CDD,
+					0xD260048F4B270A4E, 0x6E9F7EB6A676F7A5, 0x47A1150BBA2D19A3, 0xC2D2B7D2FF787330, 0x9D39E5A8BBA15540, 0x22306DFB19781A4F, 0x05E2BE9B8AE8C40C, 0xA042445DF3E8AF41,
+					0x56B7F0B24653DD05, 0xB308DF52CD78D38A, 0xD62068A744E7D9C7, 0x5FCB7CE2AD17FE02, 0xB8E2F247744EBA24, 0xB8E53809648CC7F3, 0x46102DE2CAB104C4, 0x35F2A3B4A9C77A05,
+					0x32881DA37C6A8375, 0xEE1C827FFC434BE7, 0x959EB6832CA8B73A, 0x5CBF6B6CA071F60E, 0xC6FA41CF9453400B, 0x7FFB15F3E063CE0E, 0x26C8380C8FD8AB2B, 0xA9E8C3ABED7E4953,
+					0x108DDD22DCA68A2F, 0xCA354393D5BD28BA, 0x17DBFAB1CAE4B723, 0x06A46C5D2B8F731A, 0x72900DE8012F8F86, 0xFD9699D4794A8962, 0x9199B19F8ECFAFAA, 0x9F95D0FBC1378ACB,
+					0x9A85BFA6811B9B7B, 0xFD9F7E790782C91D, 0xDD49CA3E693FB4FE, 0x8229F6678DAB0247, 0x9401284469AF3042, 0x8F923F220709F88D, 0x5FD45EB45DCAB72C, 0x2C03451DA987F10B,
+					0x50E29B045402E87F, 0x5F83A6DB2FE03FCF, 0x63F90E363CA7F80D, 0x0774346F56E95A18, 0x937446475B87B8CB, 0x546A51BD7D439DD2, 0x5A367759B080B4B2, 0x76C27EC7F70B53B1,
+					0x63C4E969E72DF413, 0x5FB80F7A2DB5C3B8, 0x794DEDF5AAF36762, 0x22D193FB4BF097F0, 0xD7F55B96ADAF5801, 0x92901B288F43B862, 0x6888AE8F2360EA9B, 0xFC173780343E0CE5,
+					0x846267615489894E, 0x7536E4BBC8B72F86, 0xB35D27256BD293BA, 0x0D7976A0EA86CA7C, 0x9108BD35623101B6, 0xF3086B72F60B4A36, 0x4E7AE5A0F72EDC3E, 0xBEE8E784D2804A69,
+					0x8B40346B1A806229, 0x739B6945308314F6, 0x8BEEDB42F1753066, 0xD60AFE579C1B7F12, 0x5F4E59B51E8F51B7, 0x0BD3A77B445A457F, 0x345233FF489CDE69, 0x86E4F6007EF92B1C,
+					0x52CA4DF28D9CF809, 0xEE038079C8BDEFE3, 0xB3DE9CC3A3FDAF6B, 0x306CD50678379741, 0x439DF2109633691C, 0xFCA93649B560168F, 0xAA2B066F0470EBAD, 0xE091E52826D2A7DC,
+					0xCD2AD77BA9D891EB, 0xE6CE72C1B1239164, 0x0207D1CBD7E9E1DF, 0x36A3DA2D45141C4F, 0x6CD31633AA3A31E2, 0x12B0734DA18EC4CF, 0xBCC7D1A1A1C411B2, 0x63C27EC7D7F44EF2,
+					0x4DB619D96118E938, 0x2E1E2100FB128CFE, 0xDD46A1E7219C54A9, 0x0D0F3F7A62E50BB9, 0x086A036F8D653B27, 0x5731C1EBF745A30C, 0x3860756B6DD94A9E, 0x7343B307EA44A161,
+					0x13D0661A68685EB3, 0x4A66073D8F7B0417, 0x780088FB52574639, 0xF717456366522795, 0x743F4DE612D2B77C, 0x4543463D079908ED, 0x95808B09CC67EF6B, 0x451A70D79A16F6E6,
+					0xB877B4C4DCFC8DFF, 0xDA4EBD377E434095, 0x6A833CB6D16FC61D, 0xEA83944F885E9646, 0x4FC3876AA4BD3F21, 0xDEB289513AC07B21, 0x832415BCA1B228D5, 0xC16E45CEE93D57A9,
+					0x2C42454728773452, 0xA0D64029385238F1, 0x54F213EB6FC7B3BD, 0x979B4D52BDF431CA, 0x81B100FED54D2B5D, 0x521A9C889CD1083F, 0x7E017C9B032074DE, 0x7537FA5C5C4959CF,
+					0x56C9E758B244876B, 0xA586DE5A7CC37BE8, 0x304238D74D8B0C9B, 0x368B91DD7ED579FB, 0x3F3A6B0542AF07F2, 0x4436A2CCAE1FC970, 0x2F80C3402D2DC056, 0x4E02209D27B12C4E,
+					0x8F4F84FF46E73B2F, 0xA77DE2596A8F7645, 0x1405821EC8F0E62F, 0x9D32AF00E0AB9346, 0x142F9A9F5EF15556, 0x909A2B2E399E1277, 0x7CEC8A8EAE52422B, 0xAC93A96267412B26,
+					0xA758A2E28192A5AD, 0xF8A3B4E08604167E, 0x11B31401B6684A84, 0x1FDF1501A6D32F80, 0xB06D49C7D388CD6A, 0xC05CE1A97CF5B07A, 0x57CD5A9184AE6DEC, 0x203982CC2F13E5D2,
+					0xB441206AC25421B2, 0x1810446C0B02B55B, 0x931E70DA956CAEB7, 0x3F18277746D5D17D, 0x122BCF73DE987B43, 0x036733C96C9DFC3C, 0x9A103528DE37092E, 0x49C827974A75851A,
+					0x13682FBCCD73DDE0, 0xA37D097A2C81AF16, 0xEB6E271B8899A4DA, 0xE119C77DAA5BAE47, 0x6D13503224D0DA96, 0x31ECA920C0C57D05, 0xE31E9F95AA1A32FF, 0x8F46C9F78A13AD2B,
+					0x889D20282A7C0BBC, 0x3A39A3E85D3E5532, 0x86984273B5E740D4, 0x886F3815421A66F5, 0xDFC29F0DE7705D74, 0x5BC37EE5E9E629E8, 0xE0F40B8074B6D5E1, 0x81A4E71998A61C6A,
+					0xAC9B063D9642605E, 0xC9EDA1EDEC252B90, 0x42F2FCA51DBE8658, 0x7E059F40F9FB8385, 0x95366E691F2DB336, 0x4022AED09D79B230, 0xB17F9A252F836749, 0x383B37CFCF235BB4,
+					0xDB64994839D61B8A, 0x9E0074DB58CAE9D3, 0x083B06BAE5A9AC4F, 0x70B57B03488A1BD2, 0x33CCA52C67F00938, 0x270BC6C2566A9992, 0xC9711AE10CECBA41, 0x1B3469B139E1C6F8,
+					0xB02690FD82076F9D, 0xE926F8E44EA9D27C, 0x20DC206746626DC0, 0xCD547876CF6E192F, 0x37AB48E6CB93C6DE, 0x45167F45947DC714, 0x3034875149C391CE, 0x67DE41F240051188,
+					0x1088A0D352B4212A, 0x9AEFDC9D73AB1AE6, 0xA9DAF3FCAB3AD81A, 0xA83452A4325A8833, 0xC9EFC869BAA80706, 0x8C2E2E757DDB860B, 0x558F5EFAF423FD99, 0x946F433A9C47FEE0,
+					0xBB8E87B47FFEC222, 0x8C1E0E26E415A0A4, 0xB34264996D5779EA, 0xAFDAAF39ADB1CB16, 0x3E5B13E2E0AD43FF, 0x5819E93EB7E494DC, 0xDC3B04559378B259, 0xD542686F6B41DF5F,
+					0xABF7DB89503AA73D, 0x6787234034FBA5E9, 0xA618654D98F64128, 0x65770E3549497692, 0x0D69D00AF58552B1, 0xFBED2B3F7935077B, 0x23A13A97CD4BA311, 0x3FA831848A0E1B22,
+					0x1BD225D71ED9E0CD, 0x8B3BC39824D48E74, 0x6BD387DEA6E069AE, 0x1B0DB1ABC06EEF92, 0x6D8BB3CD799A04B1, 0xA68B61E0F071DE61, 0xDD5E2BBECEDF180F, 0x0001D9B052956E09,
+					0x3FDF00F8DEFFC37A, 0xB544E83DA20829B3, 0xCF488A036B673D33, 0x1490751A5626FB38, 0x5C1311C7EBAD48FB, 0x2AE6B6960087FEAA, 0xC3ED374F114561DD, 0x006FFC76DB85278C,
+					0xBCC00989EFFBA62F, 0xBB84E219BA425D3F, 0x4123FAAE7602B4FA, 0xB70DCF203A5A5485, 0x637E1A5A83D4AF17, 0x06200D48668E4CBB, 0xAD74EDB856F9BE71, 0xFD08DFFC5D66480C,
+					0x677708419237904C, 0x592353F27D651ECE, 0xE7F6BCBF303BB4D0, 0x6C76E5B0E5A535C7, 0xDE5C37ADC8724073, 0xE317B534384AC823, 0x4A00CA523E83EA97, 0x83B5E16F8F7A427F,
+					0xF81C69F6512A979A, 0xE80A04B930715EBD, 0xDE76905D7416F5F7, 0xF809F065A1C297CD, 0x1E04531C9E395209, 0x6D1243D2E8FCB6AA, 0x51A347C89AA91B1D, 0xF4377979A4CAD65D,
+					0xF861F0A21E591783, 0xE6EF0800CDDA6BFC, 0x428C0ED722536DE5, 0xC6D7E6B8DE3421E1, 0x134E4AE8C93A230B, 0x9668C48682D21779, 0x376BED36392A2415, 0x131B268732DD422E,
+					0x260973ACC39438E1, 0x0859C7D614C1BAC7, 0x2473C763239ED927, 0xDCEBCCBD6BC32F73, 0x797D2DAFB3F59A2E, 0x2E95BCC0A58D5980, 0xEA13B2123DC15F62, 0xFF4A6EE39A0BF43C,
+					0xED447E98097B99E5, 0x2840BCE747A51B8F, 0x15074553490BA950, 0x9087944113271A01, 0x9B6548C622C395A9, 0xE23E0C4F73FE888B, 0x0D76FD98AD2ADA33, 0xE61FE87336BCF2B3,
+					0x14DDB61DE4EA7DAD, 0x0F2D5C206EC08AC2, 0xE827CC28FCAE158F, 0xFA390F1F98C23C50, 0x2C2BF8F30A800FAF, 0x37F5F77348FB64E4, 0x4FB91C2D5C537697, 0x416963FC622FE924,
+					0xFCB78A8798A44E81, 0xDFE50EB52C5A458D, 0x2E4901C1DD52F02C, 0xE9C1594CEFFA0619, 0xAB261AC8DDF1146D, 0x13A9011D4EA07D68, 0x218ECE0F4D9E51CA, 0x4487A2E0064E959B,
+					0xDC59539F22AD1C0A, 0x8AA8B5A685EE17B2, 0xBDB5819E8644D1D0, 0xA6BA0F6E46317812, 0x671C4E3B01547434, 0x6FA22B2CF7D03E5D, 0xC63EF500A032268C, 0x78374BADC30930F5,
+					0x5EAEE4310ACA295B, 0x488FA4BDB8967C44, 0x9438EEABD1A70147, 0xCDD906EC2826EE72, 0x2AA7B13F6FCF9D18, 0x6B4040107035435E, 0xADC638F0E07B14F6, 0x431DDE9F0C0837F7,
+					0x535ECDFC8DDDBE49, 0x603ADD1C17AB1AEA, 0x4169BC57D1521E9D, 0xBFE80D02D563C752, 0x3E2B8FE0653D2050, 0xB54D0F19B6D4D593, 0xDC6319FB0691A132, 0x5443FFFAB3093265,
+					0xC577984D4D504CE2, 0x224EE3A62A671AC8, 0x80C026EEE403EECC, 0x49B9E77B137E5660, 0x029BF5B143C2057E, 0xA3F576CFBF20BF13, 0xE3EE99DECFE1C18F, 0xCE6F744C76189687,
+					0x0385DE0A42477C37, 0x4E24BD54C38DF4EB, 0xFC774DCABCB3402A, 0xB9AF213E4419B9F8, 0x7F74BF8929C4B54C, 0x6B7B4DDAA0E0A13C, 0xEEBCB4D3DE0DD8C7, 0x7220F0E371B748D7,
+					0x7EC7A7DD4D6163E1, 0x5D3BA772B6FB53E3, 0x36BF6619BC3FFA8A, 0x20AB257BA0D62A4F, 0x60994909DB0715B5, 0xB1063D027D65B038, 0xC31CF80E9499B0EF, 0x9A480C352F28F126,
+					0x01D46993D7CF0FC4, 0x46CF271FF214407A, 0xFECB0119D0C30B44, 0x76EEC33D2860AA97, 0x958C0B4CB824B5E5, 0x72DFE500D0540938, 0xF50A5112AED7BC44, 0x03E4730E7F40A922,
+					0xC82772DC9DD9DE87, 0x4AE0C84F7EA00AD0, 0xE2DCD69E4B434466, 0xC147B4DBFE16B3E5, 0x26836879663D4C18, 0x719F7DE2A1513A15, 0xB5C4F16181D08080, 0xFDAEBB32028C8098,
+					0xA29CEA653805D5B3, 0x7ECF6E0B7D6E4AEB, 0x9802C7D4D7245616, 0xCC382694195B7826, 0xDEAF88B33AB35077, 0x6B16577925588F22, 0x778C05BDA8AA1145, 0x7F5017CED4933AAE,
+					0x925F473CD7E65452, 0x709CF411B19A8E12, 0x28E43386C62AB570, 0x197337CF010DD9C2, 0xB4C74F7DEBAB6F7F, 0xEB9AFABA00B05004, 0xA00FECE88E9C1BEB, 0x13FC6A73068C35C7,
+					0xFC5007B44F68DDC6, 0x3EB924A03E4C6189, 0xC122BB4DC74B8054, 0x760F82AE7F133776, 0x2A93161888053A94, 0xD82AED1B95EC4AC7, 0xBD2B20971C8DF672, 0x1C841D413912ECCE,
+					0x916AD8DE61C58668, 0xFBB378725F01DCD3, 0x7B152ED5414DA918, 0x428DCBFC92D9B848, 0xCCD2348F0C69A627, 0xD1D677F1495EDA6D, 0xB3A2D4E03837ACC2, 0xFE51C6E768A8903D,
+					0x281D2B72EE33DD30, 0x258B702BF2ADD119, 0x78D2F8D33B0E5007, 0x5BE7DEB0D6986ED2, 0x17A7EB9BDE89EB6D, 0xBBA443865CD36A57, 0x7AB5442C0BD620D7, 0xFC152305D07C33FD,
+					0x53AE816C3F12D424, 0xB23569623DDA248C, 0x1E2E5BA6D0E29AAD, 0xCD2A9CDFA88FCF64, 0xBC0DA487ED94AA0E, 0xB824A23354BB5BBB, 0x80F3C0E45F412038, 0x0B95F62840B59F34,
+					0xE1B8DC38F9E0D838, 0xD60E75570F295DD5, 0xC2B43613A2B2C2E4, 0x2B34378A403F92D8, 0xEB33EC47C7AA46B4, 0x2E7417FF04A4252D, 0xD96D8521FE59FCE9, 0xD2059ED521E6FEB2,
+					0xEF829529F6B3696A, 0x9DD17B94754BFB73, 0xD9EC695CD9801B7A, 0xD6FE5DC8E1B1D0F8, 0x48D5688506D4E7B5, 0x1252377DB3A0CB15, 0xEDDED2061E8C639C, 0x576DBE22219C4E36,
+					0xEEC2FB3C7E11E64E, 0xBC9036FF047811C2, 0x6E3809FA462A69DD, 0x091B5914D1EDE410, 0x22F4AF0A8D0F840B, 0x5EFAE05F5656AFA2, 0xA43D7C19A08E1EF9, 0x2AC6540AFA3B8B6F,
+					0x678F9B03A36D02E5, 0x977A3E1D701A9BB7, 0x548F5077EC8086B6, 0x58E3C4D50314587B, 0xC789656E27D8B954, 0x36CA978B3E48181D, 0x51B7F4123AF81915, 0x19C111E3A2057100,
+					0xA3BE34B1B2E84A57, 0x64B42BD39D4171D4, 0x33EA70CBCDFEC908, 0xC1E979486717F00F, 0x664CA3CCF8E5C653, 0x3B6AFC26608E16AB, 0xC13D7E0DB64B83D6, 0x0651A2C27BE95B08,
+					0xDB119A12AB9B69A9, 0x1DE2DE2A3BA68292, 0x7E6399B66B269B78, 0xD3F1595D22BFE3E4, 0x2C95E946D4EA5545, 0xB00295054CEEE764, 0x3BFFBF0FA9E92A8E, 0x685D7383C42002A3,
+					0x343DDCE708125979, 0x93493F9BC76E043F, 0xB89DA0A0BA903AB7, 0x3D0CFDA327686DE6, 0xE981561E6260FF3B, 0xF94C9AC2CF5C1FF3, 0x88957EE529D57E10, 0x2D7E66E550C57B31,
+					0xE78A516D55DBB1E3, 0x423FECED2B86CEAB, 0xBE26CB716AC88AC9, 0xE43F763DD38B7747, 0x6077A54BAECC069A, 0x5953BD0F0BEED681, 0x0AFE2DD4F15D49E1, 0x8D18E5AF578B91B4,
+					0x94C5C2296B0D7A78, 0x3BEF1A0B8FE6E226, 0xFE32A72743C748BA, 0xB24C8863FB1AB236, 0xDA6EA9D0FCFF162C, 0xB5C394862BCED811, 0x8B51FE7AFF50D1D1, 0x201A090FF376300E,
+					0x46E9055648FDB21D, 0xC6A5BD250FA46EAB, 0xAA1B03C95C0196E2, 0x3ADEE830F47A226C, 0x7BEDBE9B5EC2709B, 0x39FCACD40D85DD3F, 0xAB2396CAF5BD3861, 0x417BE53699270AEC,
+					0x1152F055BAF6198B, 0x4AACDC65AE78A6C5, 0xE5983D6E378706FC, 0xBCABFC212CB61C0D, 0x3F615650FBB9EE9E, 0x5258DE326F5A6594, 0x7313B7F6D96769F3, 0x11894DC3A76D66D2,
+					0xD1809591C44C5F95, 0x25935F988A755858, 0x3CFB5230EAFECF79, 0x6B99FEDF5EC355DB, 0xF625EE2C4081E869, 0x8E44E165D72E38AB, 0x09BDE9DCF1673FA0, 0x7FE44C1E03E2C23B,
+					0x66D61782C9AC4FBC, 0x753A1CAC046DE331, 0x1AB696225C06EDD7, 0x6170D9E79FCB90FE, 0xD58280F3CCCB995A, 0xCB3DF72D09460314, 0xD9F596C0AC2FD2B1, 0xF7E0E10C82F3C805,
+					0x06270B19FCA155E3, 0xE5F7BA60302A557E, 0xEB5F7941E50E960F, 0xB7344343DDA0DDBD, 0x59F2B1D1A34CDFE5, 0xB4D5F997B1C63103, 0xA6863833D02C82C0, 0x9A1211D28D3A2948,
+					0x89B0CD828FEB2F76, 0xDFD51ABB21346912, 0x1C8DE8BA7EE7D917, 0x200A0E7F1C759BAE, 0x668347868F4507CB, 0x966D5009EDD0E297, 0x9E3CC7FA3AC7B6E3, 0xDE305C8E2B7E76D9,
+					0x40859AC34537CCF5, 0x4FE7484D358A673E, 0x2102B295CFE5FE71, 0x16A78C40099DDAE8, 0x10FA5A64FCB3FBDE, 0x62FC2A04AC473098, 0x2871C64560A765C9, 0xAC2EAD694B74C251,
+					0xE477E8A84CB995D6, 0x81AA1CF1B15C0929, 0x7A8A94374D5D2AC4, 0x598A3C2FF56E1BDC, 0x761D86F506D57583, 0x9A41E564D9ECC43E, 0x4A583191A87C388D, 0x3E688FC9E5235AF0,
+					0xDBFFAB19AE14EF64, 0x94C546AEA4251437, 0x65DEC1C3DC24918C, 0x6B6099C441EBC1B8, 0xFF1AB64997567580, 0x558F5485B03F2491, 0x3194C35F83C17CCC, 0x4C28256EBAE3558C,
+					0x0C490B176A6DCD9F, 0xCB4927EEB0512047, 0xA7DE903A645692CD, 0xEB855FEB7CD7BE56, 0x7D5670BF5E15A6D8, 0x24F88A51FFE671EC, 0x3057A07DEC539E4E, 0x4209ECD250AF41B9,
+					0x9A96ACB3F57F2304, 0xBAB25F038C3D5FC2, 0x2B5A02C169798B48, 0xA940269AB9225AC4, 0x319742ECB3FD9533, 0x3CCE6F9D9DE624E6, 0x86046B3AE1F250C9, 0x0E71B4B0E280AF08,
+					0x02281C8044B78C67, 0x57CE3CA3FA37F2C4, 0x70C81F792565266B, 0xD329703C1862C5C4, 0xF728800E1E9B51DD, 0x2684EC0184997624, 0xFC217F0B42411698, 0x96197995F5123484,
+					0xB1E2C55FAC424173, 0x681B205A73894406, 0xD5E3D9D2D9A25C19, 0xBD80D32BE0719347, 0xF44D66E53643B0B2, 0x4B72A2B306DFF4B4, 0x01E2D4FEFEA4E1ED, 0x42EA8047A161FA16,
+					0xA0172FEA1B91E86E, 0xFE0357F2A1E49ED5, 0x7C31C16FA1844A22, 0x75C063ECCB5591C1, 0xD1F9795BD4C5716B, 0xA89070B78F07D798, 0xF4E3EADB5D4AD733, 0x7298DEB612E1402F,
+					0x530C4E125B1E3F0B, 0xF3695F616BD037B2, 0xFC75FC081CE5AEAB, 0xD87030EC4277B00D, 0xD654F67F268A0B72, 0x81D3896BCE7EB5ED, 0xDBB7E29E0539D65C, 0x093CD624C81C6278,
+					0x1E5CF48BDB976F52, 0x64586C7C32A033AD, 0x63CD685F35A29A5F, 0x889C9F51B9AEB6C4, 0x8B715B55367811B0, 0x2EF9187763C95B29, 0xB42AC80850F3233F, 0x5F2B449A3F5F54BF,
+					0xE4492CB57535FEB8, 0x1DA22A1D28366BD2, 0x8107AC1AA4BED74B, 0x243A26CC6C6E3C81, 0xF34C3702CC167C6E, 0xB239A494C6DD9A70, 0xC07583A1EBED8459, 0x61E0DE8F66F9B116,
+					0x9ABD15AE05968FEB, 0x22C8DA06383DA2B0, 0xCFBE8AA7D731BDC4, 0xE0482C87A5BE4376, 0xBF627D0574E707C6, 0x057125B4258A72BD, 0xAE7554570F1451DF, 0xA3DE8333229AC58F,
+					0x4A213E6C110B4EBF, 0x5935F1E0348D5764, 0x9EAEC0C5E77B0F87, 0x851EF4B7531082A8, 0xB108600E4F6E9C0A, 0xEF73837908247256, 0x3ECC6D21519E170D, 0x59DA3FBE985B900E,
+					0xFCB9C4872B8C2F7C, 0x6461C8E9EF513A83, 0xAAB42BB82789F048, 0x95BD051C5DC66A9B, 0xA7E13FDE2299D0EF, 0xDAD00A86E46EDF7C, 0x20AD10BBF79E50CB, 0x291134E088986907,
+					0x9EAAA49700E48687, 0xA66BE8DAD22F6602, 0x5FDDA08F53A872BC, 0xA6C3BFDB9A10917E, 0xB3ACBA568BF7EEC1, 0x4978D9A576166D87, 0xC642403568FE1F49, 0x19FBE48BE6CE4F0B,
+					0xBBDC203EB3FA0F40, 0xC9E8A1135997277E, 0x8DCBFFCD49E098EE, 0x0519203A7E497D04, 0x8806FD9A57211986, 0x2FE2DAD4A744961C, 0xFE75B5F82DF1B00F, 0xDFA37FA8B6AF2AF4,
+					0xFAADDBF6644F559F, 0xF522F37EBBBF426A, 0x2E130DBAF993F51A, 0x6AD9A7C956277E99, 0x1038CB4B78BE6954, 0xE55C3829E59C49E9, 0x93515A66D5578EF0, 0xC1118FE0C83BC1EC,
+					0x69C89C6F5B297E73, 0x6699B3E274618D8F, 0xC919C11B61724774, 0x589B1012D9F28192, 0x83459D59C8B2052F, 0x5F5672840CB4309C, 0x16143696F011529C, 0xD5DA8498D30AD799,
+					0x537C8DCF6A283F5F, 0x4B76AA96C1E98EB8, 0x76A8D925910FBD25, 0xE8CF40B7E365306A, 0x7BDD2F7462565712, 0x0092AF7999BD8BA6, 0xD2B3B041C2744BAF, 0x462C052ECDC01FA9,
+					0x88B5D3E96AA67E39, 0x922E3F19868597F8, 0x5910C42BF2DC4F8B, 0xF2DDBA3E7C37EF58, 0x46D3E9E400917FF3, 0x6DD271E0437C7B3E, 0x7AA7C4347C5CA26D, 0x74ED6ABD9A291FD7,
+					0x9402A1246CD54478, 0x8E342D77B1C1A96C, 0x2593AA4E806D6F7A, 0x09ED46F29A2D02B1, 0x129DEB0797B5CD53, 0xAAAB71A04E069C81, 0xE4DB4B16134879A1, 0x037D3D677C721B16,
+					0x4131AA4AB9826108, 0xC9EB59C86838EBC2, 0xDF3CF7D6E98606B2, 0x03E4028E0F7E59B0, 0x4F0230F971F06946, 0x49E14294FF3432A0, 0x54940FD81EC7C77D, 0xB99127B4F8887F28,
+					0xF690554F2A099B20, 0x3A5904D728A67DBF, 0x15A1D6A9C45C04C7, 0x0A8D31CAC61DC585, 0xE9821863182266E1, 0x71B5C5CF5664D937, 0x2DC718A54307DF9F, 0x899C1484B49F64A3,
+					0xB3CD37D8A9E95660, 0x9D52403474069D37, 0x09A9C4F9F5E069F2, 0xB3BECFD2F84B68E8, 0x8BD76DDDFE7CDAB8, 0x89F061F8010AC11C, 0x73A6A71955137885, 0x73CC0153FC12F7FF,
+					0x3F761BF667FDD077, 0xBE86F97BD9579FF9, 0x783F82813E93E965, 0x87531FA5DF266FC8, 0xCE22A0953BAED081, 0x4207267E2E73F234, 0x1F7533BD036F361C, 0xDE69BB34F819E870,
+					0x8B266322850047A3, 0x913FB5794D176F3E, 0x694F9649DEDCFA6E, 0xF579AF727562C70A, 0x7DE2BDA3FE5886FB, 0xC1995657A581C1A7, 0xB7F17838DFCEB34B, 0xE21549BEDEFD90D2,
+					0x9E8534CBE817C65E, 0x2E523C5D661381A6, 0x10343D2F3BDECACD, 0x2CF532517B64060C, 0x1110220893D31735, 0xB46EA1BA1DC991D2, 0xE377D04123F08207, 0x2948A3D2E144ADBC,
+					0x93F2A1353EB7E9C4, 0x4B17588722968C5F, 0x50FFE800E0F608BA, 0xFE6D5091D4DDAFB4, 0x1F44723EA2F3EA34, 0xBF43334EADC1C3CB, 0x231BA69833778A4C, 0x56B247578FFCB773,
+					0x8839D3B78BCC12B5, 0x8AA7714B196426CB, 0xB13A3FF5905F76A2, 0xFBFD353E7846DB42, 0x25343E8B4FD38190, 0x49110716A957ADF1, 0x7CA9A2BB58855A2D, 0xDCD7E581682FBC3A,
+					0xA2B73D1DF9064CD2, 0xCA521CFF18319B3F, 0xFF1DAA16F62E5805, 0xE26630C25E6ADA82, 0x58F108EE68A2CF41, 0x1355AAA7C418D1C4, 0x5728B04F1549D255, 0x2343DE4DABA4D1CF,
+					0x4149FDA404DA91DE, 0xCC49A52DA9D81190, 0x584247A9F47418E1, 0x75CDEC4FC808A50E, 0x9C8E1FBBE245948B, 0x32AD6CF5C36511C9, 0xF7AA77AC71E0DD2F, 0x58C7896C67C2D7EE,
+					0xF075DDDF107FC75D, 0xC64DF64218626577, 0xA65FF8A482AE514D, 0xAD6B01307129FD8F, 0xBABE14DECEB7C71C, 0x1A51554E429C5658, 0x1EB8C213FEC627A1, 0x4E433531EFCD9656,
+					0x163D5DF5198F6CA9, 0x368484B2362DCA33, 0x51FD38375966EF88, 0x0033693480DB23ED, 0x9DA2362E2B475443, 0xCF549E9BBC435263, 0x49D9559A22B7B9C1, 0x26CBA59960E77C6F,
+					0xC0387B61756750A2, 0xFDDF61F4E5A0E578, 0x041236DCE3E577CC, 0x09E73018ACF2BB69, 0xCAC34FE127F757B8, 0x976E1D02D830D259, 0xD9F1546EFFA65CB6, 0xBF82AB89EB0678C7,
+					0x64CE396CB5E309CE, 0xC65B8940FD1DF9C7, 0x41CBF5F203136BD2, 0x8BCBFA554DF91E5D, 0xEC60B384603D6C5F, 0x8614FA3FC79E9D19, 0xC8602DCBE506BD0F, 0x88C085A2262CD258,
+					0x17B5C214EA5AC627, 0x19D3481F27F91BF4, 0xBB90059A233B9A37, 0x8849D7558CC98B93, 0x09BE3DCCDADB1580, 0x0E05CD88517A5FCD, 0x5EF3FF0FBD4BFDDE, 0x060FF9105002606A,
+					0x8BB07B035DE7439F, 0x2FF0204320C0F429, 0xDD14E4C3DFF16701, 0xB464F011C6F1654A, 0x6F405662F95100ED, 0xFB010C6595B342B4, 0x6E3C5D7F92295846, 0x81FAD43B5E5C32C9,
+					0x41F6F163FDB9571A, 0xFBE7A1ED3AD7B5B3, 0x72785DE17BD18E19, 0x6A0CCC891DB12301, 0xCAA0B0BC1A0B0C8A, 0x9BE378E54E60FB03, 0x02ADB9B3E0C79AEE, 0x3FC68B0907996AB1,
+					0x61CF4B3C908269F2, 0xD0BA911D36668797, 0x333268C789C18FE1, 0x0B946DF8FFC8DF4F, 0x26DDEC83D22F714C, 0x1ABA15E8762236A1, 0xF69D57C085DF53C9, 0x3BF3FCECB404CE91,
+					0x4F684E5E3DFCC9F1, 0x19DB6F6A4FD8CE84, 0x7F805B0C4EF8FB06, 0x07CE009CCA1CFF6E, 0xA113A8A03CCFAA88, 0x21168C61D4391D33, 0xC9B563D28E22FD56, 0xA25911624676E267,
+					0xAC31ADA716B0EBCA, 0xA69F2C36EE72F307, 0x8F90029B1797F791, 0x159F155916F8D2A8, 0xCA50890E35831320, 0x1C66803F751B8F2E, 0xC65DC079998E3D08, 0xA02B72E18B135326,
+					0x7B44814874D3D26A, 0xE574D052E1B354B6, 0x8AEDA91728EE8E9B, 0x1EE5EEF816EA83EA, 0xB5EF4A411BA2B0D7, 0xEB2D81E30FCF91EA, 0x29E74BA3798B5272, 0x78041DE78BB3284F,
+					0x9CB86163FB5969BF, 0x83C56963D43EE563, 0x85633848877F8AA1, 0x5393DED2F92F49CD, 0xCBA079256EE05F4E, 0xC38D441DB96234E0, 0x98775762076097FA, 0x8BBDDE597F785E49,
+					0x40B0C1BE82B4F693, 0xC9800C2810A74A95, 0x57FABD029E79A7D2, 0xECA02F8584967F6D, 0x84A3490789C20488, 0xEC719D7ADA02291C, 0x84561404355AC2EF, 0x34F0FDEBF3723455,
+					0xF48EF52BD3F7EB03, 0xE867F137E7777CF2, 0x1F177BF60E6B03FB, 0x1AA18E44EE3C58D1, 0xABA0BD16125C6DF5, 0xEEAB7033A5ED8BB1, 0x9A340979A11147FF, 0xA034A9CCBA4C81E7,
+					0x2FAACF09B04F00CF, 0x5BB875E521592AFB, 0x7A63827C5C1CD168, 0x16A0ADC34CE72A93, 0x47977F903D18191F, 0x7114860F46B64A3D, 0xD192646E933BAF88, 0xE1E65DC64644992D,
+					0xB0BE8286A4C8BB8E, 0xEC938835B08012AA, 0x2B92B85FA7E40BA9, 0x91DB4CA61D915A32, 0x257D84FA0192DE5D, 0x8F283096C0D847B5, 0xEC7990A095E23785, 0x8B30D11844903CBE,
+					0x2EF4B6B97FF652C8, 0xA2F183295797D63F, 0x24074C8F8AB92C1D, 0xD861D45E90BE8E66, 0xAD0ACBDF6AAA1287, 0xF17956B9FD98E731, 0x7D16E0C9B5DF2C76, 0xD01EA4F5263F0FD2,
+					0x76C85C0D5A5280E3, 0xAF0CA2AB1A86482C, 0x31C0EC4C7967F952, 0x6C54E3A23873BBB1, 0x6680BCE42B962165, 0x85F7FFAFEC94FC93, 0x09552FF32C00537A, 0x29F13E4E0D30DD29,
+					0xA4835AE779128714, 0x97A7EB1D982C19B8, 0xDC2B73F74F653520, 0xCF23BFA8934E0B7C, 0x83F0E4A333D9EA9C, 0x0B26B7C01CC62BFE, 0xD40773355D12FE77, 0x757DCED541C1D636,
+					0x77356910BE582583, 0x3B8C0A36AFED3BAE, 0xB31C8FD0C6271054, 0x1A4A7366F57698D1, 0x11EC82E2EF85F7AC, 0x8D7D0B38B98E0A9E, 0xA64F4D75B39F3113, 0xD87542F42DBF00C0,
+					0xF1ADFA73096CA3AE, 0x6C0F578BD96AA651, 0x4A33A841B6032DA4, 0xBC284033F2F411B1, 0x3A6A7D97AE0D7B48, 0x99E139CF8814A14D, 0x6D3CB0372145E05E, 0x17B4E3757B659E4E,
+					0xA0F7E1E52E86E1AE, 0x2534A225E4E9FDBC, 0xB48DDB00828C04B1, 0xA2D654447B268BAF, 0xF504DC09867D342A, 0x50BE2F949840C7D7, 0x40A20E50EFB5D295, 0xAEAB6DC5FF3FE887,
+					0x49107FA3AB506CA9, 0x03E327153F7D1808, 0xF80F4609FC076A76, 0x15F9659A6B3FA26E, 0x0323A34D82FF6B5B, 0xBFACC419F43CF2E2, 0x198F2AD11834494F, 0x4277CA38D551C6DB,
+					0x0F2A5DDC2BC222CE, 0xE3091497C51D2BE3, 0x3286AD57D5666FFB, 0x62A91485A37B6D79, 0xB8A5599A3F5E87CD, 0x09185414E591940A, 0xC1E142739DF94914, 0x87402F9D0E4EB721,
+					0xE7FCDB5BEFAD7E0F, 0xA3968CA8F2B50188, 0xFF224F7717EB68DC, 0x281C65E623911DCA, 0xD765A08B8E698B2C, 0xBE54B31EACB5AF35, 0xADFD8FEF5473AD3E, 0xDA64B4B3B34CCD7F,
+					0xB761C9C3CA4C0691, 0x45141630D9B04141, 0xB5237CE93D74A334, 0x92732D064FD6B491, 0xB2D05A32E1A5A420, 0x26EA9D8958CD3280, 0x28F67FAE4B6EAF53, 0x6053C8D25B43E1B9,
+					0x85D15D6E138C1E41, 0x4AC7643C908D0AB7, 0xB9DC7F03B624B518, 0x4A90ABD3E0B360A3, 0x3FE9210C8053A55A, 0xA09D5F4437B7A2AC, 0x11F22F654F7BF0CD, 0xB6EDAAAA014C8C84,
+					0x80164BC2EF4866DD, 0xA731BE4322390B2D, 0xA946B306CD830A0D, 0xEEAF970F48A4BFCF, 0x4F27D0C5D17C6364, 0xBDB3124D455DCE11, 0x48386BA071E66C3A, 0x700FF33A88284BCA,
+					0x2EF6C18FE0E1B301, 0xD3EE8AA90FF08A9A, 0x4BA21E9DE58DC955, 0x01BD9D105ECCED0D, 0x31DA0E4F44F937A0, 0x4F7D0FC4118749D5, 0xD3C6568256AB9FBD, 0xD51724C8471D2005,
+					0x94683E13B981EF79, 0x9337AC36499B1D72, 0xFA744902840796B5, 0x1752DDCC2F05EB4D, 0xCE24E70396816622, 0xD38175210079D165, 0x146E6057FA45EBAB, 0x73F16661C014091C,
+					0xEE182F26169FED51, 0x5B91C7CE4D0919C0, 0xD99549213150C98F, 0xCBBB3A86F2398F89, 0x5A2363DB69CA0FDA, 0xA2F9EF7D133377C0, 0xC496EED867CC7F85, 0x05A79FB8B378FBE3,
+					0xBA074BAE7A574D9E, 0xEB14601277056F4C, 0xE8A3584991E604EA, 0x40FA688082D9C75E, 0xCEBE1DC563055EE2, 0x0087AE03AEDE8C9E, 0x2105017660AAE600, 0xA8EC53FE64089BFF,
+					0xB1F48628CBE71A73, 0x5E5DF999852ACC65, 0xAD36E1D6691381B8, 0x7E6A6DE7510A9CF3, 0xFB6471D355BCB229, 0xF9327E047C9C2553, 0x0AE33605AF00F0C8, 0xD362F19AB0AFA7FB,
+					0xE733D422E0841943, 0xCD253B1BE46F5E7E, 0x4149EF871E00B803, 0x4E6517E6A39AE879, 0x599FFC8EF92555F5, 0x4015BA7F9BD94F77, 0xEE08188C44418A46, 0x0AA1D73989612048,
+					0x2BCEB87DC784A885, 0xE7851FFD2A001390, 0x39503371E0758169, 0x094D26956810626F, 0x829ADF9A6C1BE37C, 0xAEB733B91034401E, 0x11E29CDC8876D744, 0x140854F60E36309F,
+					0xB02DD4930737F476, 0xB425A37C3F3B58FC, 0xE300FAF3D48F7CC0, 0x4F8232BA76FA365D, 0x177BE5BC7B67AE86, 0x7825A4199F2A87D8, 0x6CC531C702209008, 0x38223A201786ECA6,
+					0x38F39C36702656BA, 0xEC0D2E16E607DC26, 0xD9E1B1B54938DBB7, 0x73769616E9710F50, 0x975F84CC27ED66DA, 0xDC35A2422FF23710, 0x8A1FCDA816A37360, 0xDEE231E4DCFB7935,
+					0xB49B9C4333AB68B4, 0x2205C758D665F8E1, 0x9ABC45F3B53A7F8C, 0x72E4214E9ACF690F, 0x4705EDEF10E04574, 0xC0417E30AE0F3C05, 0xD1A6E251DABEEBC1, 0x7234A1CE894B4370,
+					0x498D679C451293F9, 0x4FC38863FEE68922, 0x1CC85683FFB41734, 0x8EA6E9546D9735BC, 0xFF6E160DF8DA7A64, 0x45E829E67C87267E, 0xD990EAB89D1AF5B4, 0xCE9D283517DA56C6,
+					0xF1AB7D0247FDB06F, 0xC3C5F4C3642DE418, 0xFE5F8E08848AA652, 0xFF8874A0CCF0F800, 0x0CEB03DDAABCE55C, 0x53B1ED786F9D40CC, 0x82DCCB004B79CE51, 0xD434BA087D1FE503,
+					0x51F6D7561B633F2E, 0xC9A9883B02586BCC, 0x91048653B4D9DB01, 0x356A71BCF91A02D2, 0xD8AAD8AB87CDC8B6, 0xABCE171E8FB826D6, 0x4DD3401B0091B06D, 0x559498FA9E92FA1F,
+					0x2F527D71A7E8975E, 0x059B1FF3B85A2CB8, 0xBBB88050B6A58646, 0xD6CE1AA79C86219B, 0x1985DD9C53F9006C, 0xFDB754BC253AB671, 0x90AA446F67B4AA69, 0xD0E3B8569FC01882,
+					0x09A21CCC46289BF2, 0x2DF936401FA78C89, 0x0E8E6D136FE37983, 0x8EC1FACFD13D66C1, 0x6EAE896C65E92EC5, 0x4C9C757B9649B8EF, 0x09DB41989CF1D984, 0x05C1F7EFF8E953E9,
+					0x1361361C45766C46, 0xDB4C16A617E5C11A, 0x89C208007621EBBB, 0x5130692187753F18, 0xC1970280C8379658, 0x5AA9862B44D39784, 0x85701F838281FC44, 0x653D607573063859,
+					0x29789E31328D4116, 0x03E063773E57E924, 0x46E1060E0AA1E536, 0x62C209E7E6BB36AB, 0xCB8CD06CCCB4172A, 0x77070C5AB15BC063, 0xBF2D176355CC3EAF, 0x3CF0990CBA76600E,
+					0xDF2D59186D1E6F89, 0xB7942C756BB2BF85, 0x57A9AC7E55BC5693, 0x02EDCD0194CC4D14, 0x59F2130DD8EE8104, 0xB7CC8E6C99F17A99, 0xC19682E16DE50DBC, 0x29090D08E9B3FF46,
+					0x0FFCA0F8692B57AE, 0xBFA3A36EFABE1D0E, 0x098F114BE04952AF, 0x4352ED3A88D3FBB5, 0x12DB4BCCBF931A36, 0x10D95927767075E7, 0xED698E10B71076CD, 0xE493ED3AB840242F,
+					0x3BF495725B20CAF4, 0xF311D7953B7473FA, 0x9E8381B653FE8582, 0xAD31D34B2BC6B3B4, 0xA1EFE977A8EF5581, 0x5754DC2CE7C90D9D, 0xA3F1F94419F34531, 0x98E45FC59425A404,
+					0x0DA26C1B1C06BDE0, 0x65553FE4D2AA69E1, 0x79ABECA4A27D0384, 0x93B01FFED164452C, 0xA07C7BD4F5A1D78D, 0xD281DE72BF29C596, 0xA3A070D0E50B121C, 0xD349532D0247172D,
+					0xC8566F3A4C1409AF, 0x8482427C769F14E6, 0xD30100D4E05845A5, 0x63C72C34A33C6310, 0xE985DCB853E08A4B, 0xAB136474FFCFDD3D, 0xFA94995A5C28A664, 0x560FAD11532C5368,
+					0x204C29487496CFD3, 0x6E283C625ED11B95, 0x0C254F3D5C5E54BD, 0x9E21AD5AA3363876, 0xA06D8BD67CB095EB, 0x25087DBE91233C5C, 0xB6A714944D167021, 0x0B1AA849E6D2E853,
+					0xF0764F39C56B3DF8, 0xC59B834C92EE5AB8, 0x94E57E5AF299076D, 0xB2379AB56BFF47FC, 0x94F83FE19B1E39A6, 0x9B7F217B7870A6A1, 0xBBDF96F1225A3D53, 0x6D4D138252427F54,
+					0xA9E1EEF742683B3C, 0x35988A3103DCEF76, 0x414C6E5D62F5EA7B, 0x4162D0035687A199, 0x9501345F0A0F0DD1, 0x9F5ADA56A26D44BC, 0x12A3F5A0281DCA19, 0x134842D9587F6F89,
+					0x2FA0EFCBC10ECE9F, 0x86BF73286B201687, 0xB7B192CC2F128919, 0xE7978E7D097B684E, 0x880AF495BE6A3CE8, 0xCDAD621E1713ADD4, 0x40DB5AD07F159425, 0x9B27A0DABEA1A503,
+					0xFC6E79142B68F8DE, 0xE17C528C15E53CCD, 0x89A2FBC6DBFFA94A, 0x968E00683BD57F78, 0x5AFB28CD223F23E9, 0xA8F37B6A580F1FB1, 0x2DE0429DF94C3810, 0x7850F7ED5A5CBC90,
+					0x5A25C1E1A89C00F3, 0x7EBAC5DE2B4B0F19, 0xDBC976EA384948DC, 0x5EB2D6D536703E07, 0x3EBDC900A6AFDDE4, 0x273D0FD2FDACB120, 0xF3B26B1B252AE669, 0x83BF560B53C549C4,
+					0x7EC84BA482817FBF, 0x2ECFC9EFE1D44626, 0x7DEA61E939FC109F, 0x62CBABAACBED2913, 0x41B7F9FCF0D65D4F, 0xD4063EF7F17AA750, 0x8E65DA5513B11277, 0x99E9596E04A40476,
+					0x40CF5194281080D5, 0x553711D52B474918, 0x7C1A8878B5B29150, 0x570371CF77343B9A, 0xFC7D0B42D7E18AD7, 0x2854D1410F25FB19, 0x3A3C62DB27E292E8, 0xBE4A0FBE9D2B57B5,
+					0xFE2F1E5C2D9E6906, 0xECDE37FCA86B2E10, 0xF3986A6186E77EC2, 0x46E75B744BA2E525, 0xEEE0812A4AF266E8, 0x4F0B6BEB8CDA34E0, 0xBB319797746C855A, 0xE31590CCCF3E7000,
+					0x5C2D1030528BC4AC, 0x8E9ABB105E1BA4C1, 0x16E78D04FB3E9129, 0x59838CE298000786, 0x1BE693227ED5C7BC, 0x22B3F1A74B5DB554, 0x65F539807A7ECC58, 0xFF3C61463B9AEAF4,
+					0xCFAEEBD349D04A89, 0xF16A30EE31526FC8, 0xC617AA6570A9258F, 0x572FDE9E7A864931, 0x4CB82ECE33BF1300, 0x0EF9AB7B4657665A, 0xE5C7C7EF18F78C74, 0x4E35A77BDA96656C,
+					0x1D6912E740BC0245, 0xB8E69560B8C8E4C2, 0x5281F77532CB7827, 0xE7B43B6D80B415CD, 0x62891470A58A9DF4, 0x8CB0D21FDA0CD489, 0x19C2E3201ACA7035, 0xF5542C909C572DA9,
+					0xD75AED5DC7074F2D, 0x8A97A2308D9624D7, 0xF723CEB6E7C29603, 0x3900AE09F0B2E398, 0x82DB10E1B6E5F6E1, 0x207F0ED4DA2904B3, 0x5D42A65DE2932B2C, 0xB2AC4EF9DE7D38C8,
+					0x1B108DB14D1EA115, 0x3877018E961BB2AC, 0x6F7CD5A146BD9880, 0x800BD45D0AA7F588, 0xF94543F0DEC68987, 0x7AC9FAACB037E78D, 0x9B5CFD21C197DCD7, 0xD810CD4E7EAC7C57,
+					0x6B7D226FCA5A7D3C, 0x21C2BDA9F5665364, 0x9129D832E750F7CD, 0xC782928BD85B6B87, 0xB2B8E770FDA8728C, 0x135DBB5C3A719B05, 0x33350CBFD7B8D9CD, 0xC6B0A2C93CEED36F,
+					0x017C2DBD17432875, 0xB1CC6CFCCDC38071, 0x2359ED52AEA8E0D3, 0x5325DDC2D339D3B8, 0xBE60F73F69F02586, 0x494DCE92579CA9C6, 0xBC93B9A9A18A98AF, 0x09C56F7EBC997FD9,
+					0x12ADFB58A5B2C876, 0xB2F79A3947F63DE3, 0x360CA00B06822C56, 0x8BD58D8946C6B26F, 0x12B92E7825B215A7, 0x051571E937C80F12, 0xB443593AF6F907E4, 0xD5CE90A0AE0A67D0,
+					0xC9CA4D791E98AAC8, 0xC6E9928DA03DBB75, 0x04B875EA01780207, 0xAD3EAC55FFFF45D0, 0xE161F24EE3FA9F41, 0xFFD5E840667EE6AB, 0x56D6AA49E7640124, 0x4C489E7941ADDDE9,
+					0x1223894DED308120, 0x257A16FD2F2F711F, 0x13C68A18517C0CB7, 0x1AD1D83B85B1AD87, 0xFB4893700394410C, 0xE77BAC57408BC2D9, 0x6A058869FFABD51D, 0xA9C8632E348B7168,
+					0x7B202AF76FCB0A92, 0xAFAFE8F9301B7FE6, 0x6CE2183D9FE6962C, 0xFED477AC3AB5B1A0, 0xAC81BED03C68EC2F, 0x942A2723C9E5AC42, 0xE8F149B9702EF6B8, 0xD3194E5FB81CCE49,
+					0xFCDC9FEED582FE93, 0x5BC13E0070FDA31B, 0xC8C60E3B3DDDA364, 0x00810A97060A750B, 0x1D08F6B7AB0AA5CC, 0x16B8DC45DCB36DEC, 0x73119D4E6F03A738, 0x5DED13BD2DEDE07A,
+					0xE72715EBED0D05EB, 0x38548AEEDA42D0E4, 0x2F3F23200BDFD7FA, 0x5607B334EAE549B6, 0xDFD315DB4E2890C0, 0x0C36F410A8B6364A, 0x60FD80C1DA6AAB64, 0x1282BC3362D48C9F,
+					0xFBB0BE885AFE4864, 0x496DC174DB60B132, 0x58E0978BBE773048, 0xB205099B76691E88, 0xDBBE203740E12017, 0x0078E1C5EED9AE4F, 0xE210982FCF44F455, 0xB8DE6EB796A7E4C9,
+					0xF8D8073D41431CE8, 0x3A0A31F659D42C62, 0x664930716579E0CA, 0x362DD7FA7D7F84AD, 0x0DD6D447CF5D1E15, 0xEB27020AEB2F7545, 0x4E180E671E3A53B7, 0x1CDF8F5C02F5E15C,
+					0x54C87D4003A072DE, 0x485C62110C250166, 0xE3CE3D10A32E9ABA, 0xE95139DD3B45FB9B, 0x8615A6B276F13BB9, 0x400EF34B4FAF70EB, 0x6B2F5239C043E7C5, 0xAA093B2471723DF1,
+					0xA76EE21988DF3EF9, 0x2F11C18F48F2A167, 0x0FF1DF83DBB768EA, 0x85D60FE2F4A01106, 0x7624B5EE8863B929, 0xC5F0A09B6F8BF521, 0xBD6044B3ED856146, 0x4A2547A28F605862,
+					0x11761C37239F6992, 0x175D3F50C6FCF685, 0x21432673D95C7430, 0xF559794E0271A586, 0x718E66D232C2A93F, 0x7F1E2F6CAE6CC199, 0x48A937F82045A04B, 0x6152440CF8BC75EF,
+					0x2ABF0C61E1160D9A, 0xB36C4ACF578496A9, 0x5E13C48899223A2C, 0xB9A95F882898D83D, 0xB5652BFB3FC22264, 0xA5814FE10CE590FE, 0xAEC2F8DF9A1B5CC3, 0x1C2174542C064190,
+					0x8327EBD52B0CFFAA, 0x76213471B631BB7A, 0x7EF7573A30B890CD, 0x77049CE8B4F21E07, 0xFEC87E9A4691749D, 0x5F04CC0334857408, 0x1F88B90C56D2733C, 0x8C1CB45FD5163844,
+					0x353D03DCDB73A8DE, 0x0B72B5222849F559, 0xAA5FF293235FCEA9, 0xB4894A9887D8441A, 0x96389C74D1EF3CC7, 0xCF6CBFF3DC29C523, 0xE6DBB92AB8CD51FB, 0xA87BEFBD4ACAEEDF,
+					0x9874A9661DF0753C, 0x8A4CE520F70157F5, 0xF34D33B97A122F01, 0xCA4363703CD5BB16, 0xA209C3D7FD903C9F, 0xA88EB24A7E5573CA, 0xE441584149A9FC6D, 0x8B641E2F5994DFAF,
+					0x819813A50FCAFBD7, 0x64376AF4DA6E61A2, 0xAD0272060CDB9118, 0x6533791729486D17, 0x06B3EE9FC944F798, 0x947A78E14CDC2FC4, 0x8A07019191D9278D, 0x3AA00D6251467736,
+					0xFF94FF4383538B3D, 0x5782D18AE1052709, 0xF0790B5A08769B8E, 0x76FF52C991639CEE, 0xD9775BB220B58F34, 0x4FF06A7A8CBDBF53, 0x726A4B9DBB58D880, 0xFF03A8964A83B2F6,
+					0xF982B3FAA04E7F3D, 0xABEF85793E428960, 0xCCEF871758FEADCE, 0x1D1FB812FDF5D4D0, 0x9C544E3DFF30035F, 0xE35481D9C82A0DE9, 0x2F38D842C620EB03, 0xFDD537DD0C5B6BCB,
+					0x5034B60B2076A193, 0xCACD0331E2501AF2, 0x9F23D6983E7F3A80, 0x5BE0284F716CD5F2, 0x1CB6C3B78EFC53A4, 0xC453D3A092093C26, 0xCE97494C3CC5F836, 0xA3499DE7CE4B1EDF,
+					0xC13A998C50CF59A4, 0xC227EA7C025E8AF8, 0x630D05F202C45808, 0x92DB0C4A46EF1CE9, 0x9448D961DDA8CC0B, 0xF34085E53F4E6184, 0xF18D9611CFEBCB96, 0x92B7EA3A23C25885,
+					0xCB628B1E08E2730D, 0xEE33BA6E8BB4F144, 0xBE6FEC09617B9DE7, 0xD796EC116453DBA5, 0x5C477330AF11C1F9, 0x7A772E26A5E0BE47, 0x6637B924678447E8, 0xEF4615562041A146,
+					0x76BF6EFD9666252D, 0xC6227F614041B3E6, 0x6CFCA736BE0F8591, 0x44A3847CC4A494E3, 0x0DE842C8677677EF, 0x6D6B5B0A72341957, 0x5B20B20512A11D08, 0x57B5BB744BB25CB5,
+					0x3ADFD6C09930E43F, 0x6FF7A8DD8FFA6AC0, 0xD7F206C238A8C425, 0xD02D66F2AA05913A, 0x88C09691A2AA51CC, 0xD43070F4270D0882, 0x173E0A89327B898B, 0xFAE4ED253F11FDE0,
+					0xB2E0003A6C06BA4F, 0x4E9E864BEAF4213D, 0x291660C9D1221250, 0x4CB616C1A6646494, 0xE7E35C76A7143F51, 0xCD6F6F7C3225736A, 0xB4B49558E8FA25CC, 0xAE1EF9B2C95E173F,
+					0x09BE6DA8BD023232, 0x33219CB73773CD64, 0xB3037143A69F4948, 0x932EDCF02EDFBE90, 0xCC4219890D827EAF, 0x2543F007833C67B0, 0x102E66D9B23DD120, 0x35382242B423D942,
+					0xB25AAFB0439FD02A, 0x5BFF230004DC9BB4, 0x18ED0F171CDA961B, 0x6797471FA42EA9F5, 0x81DA2F387381728F, 0x53BF80D6F039A38B, 0x2F453F3DA80FB7CB, 0xE3772CAABB1DF58B,
+					0x7385D2E107B35892, 0x46AD1B54482234C0, 0x119BFBE1CA828B38, 0x049DC1BEF033796B, 0x9DC52C3FC87AEAD0, 0x7D29C44B8ED175A3, 0x3E615651F00EE75D, 0x07ABE945A269FD0D,
+					0xBD04A56482EF903D, 0x74AC46D186CC1734, 0x6AECDF123B160908, 0x54E3495F49EE46B0, 0xB88632FF060606E7, 0x29271463A5AF6DF3, 0x81C7522DE811E169, 0x3ED28A89F720DD7B,
+					0x1475220AB56F29AB, 0xBC0A757CAC022C9C, 0x8ED0A608D8B27516, 0x83FC5FC87E7CA006, 0x700728C0BFACC828, 0xB0B254A88431D9A3, 0xD7EED8C1BC6E4E8C, 0xB2DFA029125F5505,
+					0x183DEBCA2EE67527, 0x28863AABA16E888D, 0xB20FF6BA69B0B09B, 0x30A0058E11D5B46A, 0xA17AB6639B9FBFE0, 0xB90963172112EC66, 0xAFF0DAD0F894C44B, 0x12789006CD1A406E,
+					0x46B7756B116120E4, 0x0913CB9021F4E919, 0xB213B4C7DA5A1DAF, 0x603C8BFA1D095982, 0xE5027386D8C2378F, 0xC23E99C1CA8B6E39, 0x6FDC8FA1DC070213, 0x4F8511B5EF70596C,
+					0x26C8B0F76CCF1473, 0xF5CFD0B317C66658, 0x0D67C2E588D4A2FD, 0x9A7055BDBAC9F705, 0xEB302F48A4BF1C09, 0x04FBDFDA9AA083ED, 0x136C68FCED3134CF, 0x99C0099F18BBA736,
+					0xC40C01A9E449BED4, 0x47145879266121D3, 0xD58DD7D1ED26FD55, 0xED3237BE518E80E2, 0xB2FC3DFF0AAE5DF4, 0xA1028E831AB2FF97, 0xE2F569081A0FB1E0, 0xA11712EB1AD10A52,
+					0x277CA288A7821FBF, 0x24303613143E8342, 0xBE207281AB09191B, 0xBAE60FD436F249BD, 0x0DDA115D267CE9DA, 0x08BCCCA5B9EC579C, 0x2434257566A4303B, 0x11E8E9F32607AB75,
+					0xA5C8FBA4FD0BAB7F, 0x57469433261B4BBD, 0x0082199DA35D6ED9, 0x76F7DAAED93EDBE8, 0xAF294612D591BD08, 0x491441609AA17DF2, 0xEE11B53CAEBEAEBA, 0xD9ED8C605DCB3D26,
+					0x9DE20C6DCBAD6E9E, 0x34483EAC38B3FA6A, 0xEE940BC82AB6C52B, 0xA941F34073FC6741, 0xD4EF0C20DD199231, 0x07996E24940E6F16, 0x9A761C4DC0B682BF, 0x2B058A672A435594,
+					0x1903C0254489F940, 0xEC95C790CF3A7434, 0xBA22F5ABFC8F3C82, 0x319F58DB3458623D, 0xBF290D6A75B7DCA6, 0x9BD6E8D676900FA6, 0x7D0BCA9DA27211DB, 0xE92CC686F1B6FB05,
+					0x6A6C7278F2FF214A, 0xDBEA684764106EE3, 0x15020C29AA70CF68, 0x518AA4307D9487ED, 0xEA35082FB998ABC4, 0xF0DB2220FC38FB86, 0xDB75044C4F8E6151, 0xB6B48B810A59980E,
+					0xD214AF77DD7EDC99, 0x4D623405F997D27F, 0xBDDFE362CCC0884D, 0x7A0505C138DDF885, 0xFB4ED0EBC7831CBE, 0x0EA193BB7D5A2D16, 0x938C59DB97E13E83, 0xD50511A3272D8E1F,
+					0x30690BB1CD124382, 0x5DA56C89E486243F, 0xFCB70E11C8340015, 0x3905AD64CB9ECF5A, 0xFB58CC0F3DCD12B9, 0x594EC2F409F4F375, 0xAAFE1FC5C7043A23, 0xE3C90A5DF624E9CF,
+					0xE8B8353E25E06969, 0x66DFDF8D571E5F5D, 0x146A1761A47990CC, 0x3F9213F2AB250B18, 0x85FE328D5C31D0A6, 0x64AAB112FABCC163, 0x087A8FF9C0E987C2, 0xCDD49233D9F4584C,
+					0x58E6E41F297032A3, 0xD641CFACE755A660, 0xCE797EBF7A3B57CA, 0xF4D46A75AA5829BB, 0x0FA9205291CBCD93, 0x1873743EBEB2BC14, 0xDE76C6B124DE129F, 0x2DA281B65F5B969E,
+					0xD58AABDEE3A3A419, 0x770B57A7856FFD5F, 0x464C5501BE603887, 0x44998A6E7094CCCF, 0x5DD6501BACC4E5E7, 0x78DADE0B69E6C06B, 0x76BAE0BD491DC6B0, 0xD5CC9882C93E34B3,
+					0x09C5BDD1CB7570A8, 0x33A7DB5E1F9BB1E3, 0x39BF3F98D95EF95E, 0x531ACECCC9A860EE, 0x6C1E4C209C2FC323, 0x84C6B74B21CB7C97, 0x18D8AFE5D835FB90, 0x30C675D6FD2D07B8,
+					0x7E9C61B14F3FAAE0, 0xE648040ED8F1ADE2, 0x7A53AD48A060FD86, 0x5B086EDA3D3C3849, 0x221325739A333A91, 0x698C79992BE18790, 0xC379751AC92DC651, 0xF24B9E978B18C9A3,
+					0x5CC0D8F2FA7E4557, 0xC70BEC576CF97A22, 0x2D69C78C31A6F4C2, 0x3907FB102C66F674, 0x1B86D276F0048BD6, 0x6F51CBBFB5658BD1, 0xBDE192334F957FFD, 0x0DCE4E8F5D54E5D6,
+					0xE0D082FDE4334BE6, 0xB59C11231B20CB9F, 0x5F2A680481E30647, 0x7EA72C8AE325E0A7, 0x5DD2A993717B2C1C, 0xC2E3D98918523F97, 0x3A0ECB603563B5A4, 0xE0D0DA009DBE9B79,
+					0x0EA9DA4B60F78F7A, 0x68039AEC3CC8AFAC, 0x74B49CEA61A9BFE0, 0x37D9992754B4DFAE, 0x0C5FEBC7ED42F55B, 0xE6522FD916359919, 0xB8F3573BAE439E3F, 0x4290BFA7D4EE965B,
+					0x8A66A6E07A63AF0C, 0x25BA68047BBAE797, 0x91DF50466BCD4D05, 0x1793E1DFE8C132D8, 0xA24ACA71DD1EBE19, 0x2F2D8BFECDFF7292, 0x924797EC72F04CF8, 0xC1AA0441FE715C20,
+					0x4772DEED323D7962, 0x64B67C01E546BF6D, 0xF443CA1D614FBFE1, 0x3FCEAEB9BD5C4756, 0x0E8DABC50774E5AC, 0x71F72397F66F0A61, 0xF0D6591B0BF20466, 0x619EA334B9DC1AD1,
+					0x2CD0B4BD12864C29, 0xF6D29037BE49B8A8, 0xCECD6AE4D660E5E4, 0x9754C3C338EED60A, 0x780EAEE928FB77BF, 0xDC25E5009BF2B68F, 0xE2CD0B8B6841F4CE, 0x86297F9761E5EB1F,
+					0x263D6A00E6612AF3, 0x3483240203DC9343, 0x904920F640F6C932, 0xD0D8E75B24CACEFB, 0x5B658FA9BA64F81D, 0xCF2CC91EAE21AD17, 0x3D2190D2ECC13612, 0xA38663866C36F694,
+					0xD5640489E279B1C9, 0xC54911E07ED11EDB, 0x0F016655C04E5937, 0x6156FFFEDDD4B425, 0xCD62BC9A6AE87EDA, 0xBEA7D9A085E0DE3E, 0xCFA9E7737D511F5F, 0x6651AEC8B1429F2D,
+					0x2CFBC15701849847, 0xC4FF3D1B35E44D72, 0x1B8DD9798E679BC0, 0x806ACB52A28C463D, 0x01C032A12EBFBAC7, 0x66402B2FD8C47F1F, 0xECAC01299B01B66A, 0x67D7BF06E60CF149,
+					0x7A457A86915CF756, 0x7DED214350515436, 0xC6476207841FDAEC, 0xC176B9C80621BEFB, 0x4EF47E6F9AC6E952, 0xDD9A0F79F5696B72, 0xF5213697A9C9992B, 0x15A94D5EAC409745,
+					0xD81B0BDE86E238DF, 0x63F71A514D8F2BCF, 0x116D0768C6E39739, 0x4B8CFAA3920B2A70, 0x153261B8EBAF529A, 0x90B0546D37DD7336, 0x824EFAF0B0D6E5DF, 0xDA618D7E4B831274,
+					0xE175E251CF1111EC, 0xE9708F7F864AE468, 0xBB944291AF35BED4, 0x17BE13F632651932, 0xF0825CB68DCDEDBB, 0x4A85AA2E56E849C8, 0x140D0674AC7D3246, 0xA97117DF3B00165C,
+					0x4B74DF63B792A10E, 0x5839D4FF02098DAE, 0x45CD7ACEEEA31948, 0x852EAEE8FA3AD0DB, 0x5FFB53DFB9ED5A8D, 0x5C27CBB6FA65D52A, 0x8B90FA20CDF17D1C, 0xA2BBC4F4B0240825,
+					0x43B16499D9D97085, 0x32DF7D60C23E1848, 0x7C09B2C187D63288, 0xDE64C1C571EC244E, 0x559C2A3C4555EB88, 0x01F3682D5213D123, 0xBBCABE0361E37CC5, 0x91E4328FB61E5270,
+					0xB1D130316CF1F2E3, 0xB879643325B5F730, 0x5ACD043B9172D651, 0xDD672821AB62E9CD, 0x56A0D0FA3356943D, 0xC2419F1243FE7846, 0xE883FDC26A617616, 0xE52C90C1C5364AC1,
+					0x29EBBB280252E091, 0xFE2CCB3E2F74D33C, 0x67FD4C15E9F1FDD3, 0x35D7CAFDBACB6F2B, 0xFBE672E854BA7A9C, 0xE2BA24577FFC6C7A, 0xE5CB69393CE6C921, 0x7DFC2682907EAFC0,
+					0x61DE856CBAD620D6, 0x85336E063DC208E1, 0xC4A0F79DA89512A8, 0xF146ECE42EB7FE50, 0xBC46698971319B3C, 0xE77990C374AA4247, 0x99A2FA878BDD0160, 0x83DA5169AF0CF09B,
+					0x779F83C7994F177E, 0x810B68D162B1A427, 0x37B7D9DB7908AA34, 0x846CF7B720AFF79F, 0x70AC61196B15F806, 0x05B3AAC52FC4F73F, 0xDABCA0A0AB835D31, 0x35137BB5B2DE745A,
+					0x92AB143A42183B32, 0xCBEFA5B3139D632D, 0x21D29A706B26A0CA, 0xF724CB428B5393F1, 0xC0B1FF64F1C71C2D, 0xDB2646FB4BDC386E, 0x40524CFD3650B15D, 0xA412F7D1983AA7B4,
+					0x4609BB5A8717C57A, 0x0EDB64B47134D138, 0x29562683093A4881, 0xE0792FAC56B6022E, 0xA7197E584F4997BE, 0x45772813F9E8114E, 0xC0B9403D7EB41341, 0xB59027C9FDF6CE52,
+					0xD8D569B7DDFB2677, 0x34086C3187A01180, 0xCF77239B9EFBE0F6, 0xBFAD5C46462CB379, 0x332B4F4A6115C61F, 0x366754D018875C0A, 0xB5556B55A7755EDB, 0xD8E549D87783BE68,
+					0x42CB3C2C6C3DD4A2, 0x737257F8598F32AA, 0x0CEBC08DBFD9725D, 0xDF536A529686BC15, 0xD88E26C08C30B661, 0x90BFDCDD72178C22, 0x9B1468C0DF265581, 0x014632A4F7C55DCD,
+					0x7F49B12D5EE01E6F, 0x774E672A05676794, 0xD84800C9218CE6EE, 0x25DB4174534A0992, 0x9C817CFD074118F4, 0xB6804699CF3A5CA0, 0x5DF0B5CB50025A78, 0x5E68551897DBF04A,
+					0x638253A1609E3CC1, 0x0555F27656B88AB6, 0xFAD124B48AD8EF39, 0x8DCBA5EE5D447C8B, 0x5756430849E6F99B, 0x6C570DDB991EF757, 0xA513D823DF2A883E, 0x17977CC05239D8F6,
+					0xA6A323A7B0EFA6E8, 0x8182D41023123763, 0x54E39A74893E2220, 0xC312FF51D55B23AD, 0x5E33A827119EA8E8, 0xC3EF7B8CF83A18C8, 0xD5FB9A104CA8507F, 0x546FCAE10CCB27D6,
+					0xA88D9B11262C5C1C, 0xB130FDC91926AF38, 0xD5815A6CD515E65D, 0x0B66A78E8F3E2270, 0xA2F5AA778AA559AA, 0x82CE08ED941BFAA7, 0x2B35F234DC69BD89, 0x2B6DCB9F54CA2736,
+					0x905F029FDE14348F, 0x4CB25C081C780F2D, 0x390B9F6AA143E5AE, 0xC57DA7D2F909454B, 0x5C15C675AD67D3CA, 0x81A5A5D109BA61F1, 0x56BEAC072868E56F, 0x07A1255350DCD3E8,
+					0x67DCB60FED30FE86, 0x65898DAB9260917A, 0xFF358ABC7291D55A, 0xDB47EDBCD8FA5117, 0x135011E74A046E8E, 0x140A1F62DEF500AC, 0x0E8C72C33BBD2E11, 0x60802BC9C6B43C53,
+					0x891F42AB3968B5F0, 0x503D788CCBCC3E42, 0x21F930F1652121E6, 0x887D2C28BD801ADC, 0xC1B011010943571C, 0x4D586A7B5A2D6F2A, 0x08D71A32D2BC377F, 0x2629190769E213A8,
+					0x5498354FE16D5B8A, 0xC2EA8D88D073A602, 0x0F07831F940C440D, 0x7323EAEB8D7D91D0, 0xF2CD1EB511EDF71F, 0x6787415C993C85FA, 0x5141C31395135AB8, 0x6A71CB7E285E1E72,
+					0x8C4F5476894FBFB3, 0x3052235164AD32BB, 0xE77AE52BAC581857, 0x6D2D0D70473D0424, 0x118D97F7F38EB337, 0x7FAE74BCBAC1E713, 0x457A03C2E02422F3, 0x7EBA53E36140082E,
+					0x5D491F3764603C85, 0x7C8E9785C43223D1, 0xC5CDFB9ED73A281B, 0xDC27156D5E1050BC, 0xBD32FB08CEF194EB, 0xAF4A908B9F968931, 0x5AEBB91DE4727A1B, 0xE85491F9849E4032,
+					0x9E1CC69A8136387A, 0x715B689E7AB7E2EB, 0xE745E3CC0BBFF075, 0xBAE959FE68608C89, 0x7160FAA7E3AEE9EA, 0xAA5873DB15F2744A, 0x20BD3C4753501928, 0x2C04316A80717CFC,
+					0x27AFA5453BE71692, 0x09B70C294E9E4524, 0xE3CB3A9DBDAB2563, 0x0261A905D01F250C, 0x121592C8A273DA9A, 0x70B04A4522028095, 0xE419B220583EB4E0, 0xA30A226E64EAA065,
+					0x5087E86AAAEAA751, 0xC604270D273C72AD, 0xA3F111DE9A162003, 0x8646FE1764047EC9, 0x6774FE76D9C885AA, 0x06EEFA1786ADB24C, 0xDC5FFAB599AC845A, 0xBB0ED2D5B3CF48F9,
+					0x5456C3021447BD82, 0xC757D7727F596D6F, 0x78554ECCEE212587, 0x9A7C8BCA5E2D0DBE, 0x94FEA9EAD245081E, 0xA9FA9E9BE1F287E6, 0x16600A5067EECFE6, 0x0CD7503D8C2E9138,
+					0x571BF235F773D0C7, 0x2F5B8ED511BD8869, 0xEF30B308F988AD61, 0xCBB495CE1963E454, 0xD4EE592B25719E6F, 0x6C05F7670EAE2ADC, 0x58B06BE75C5298F7, 0xB372828D1119199A,
+					0x3D42556725053FED, 0xB87E0BC01227C45F, 0x2DAB48B87A46E0B3, 0xF1484B5272477DAA, 0xFD15E528AA146B8D, 0xDB9B7ECE605539C0, 0xCC129D8994C2B60B, 0x635746A8C85F58FE,
+					0x348380377685E404, 0xB1736B9912040D66, 0x0CC9010453F3841F, 0x560B6288B73598FD, 0xFCFEFEC78216AC28, 0x4EC52D80AF36A0C5, 0x57F2B36E94098A9E, 0x8DD3BA4D0744064A,
+					0x643F34F0E6FF05E3, 0x4C77CA6F8D66C401, 0x9C7C1E0D7FD7ACC9, 0xF2AB9B12E22843E4, 0x064208317F3ED68F, 0x0C2A3C5A508B154E, 0xE3DD56E1FE25ED29, 0x72DB448346DF89E4,
+					0x45CAF49B738F81AB, 0x96970EF89B6624AC, 0x709F168808104AFD, 0xDF86020FC1F13878, 0xFA40E82E1D6C3F29, 0xB0A8563241E50031, 0xDD4D54214D1EC2D4, 0xD867A75F5636C739,
+					0xD9A6160DDCDB986B, 0xE5D38B169DA899DB, 0x3D89231AFDC4DF9F, 0xCD4513316CA725C5, 0xE9D4CA356423F078, 0x0C9110EAC5F6533E, 0xFA11DA1444B41530, 0xAFFFE9D357B28C03,
+					0x4E7F9443E67F5E45, 0x875748FAAA5DEA45, 0xE1DB45DB50BC1AAC, 0xBE72DABA7B6F9E3F, 0xE4F9A2F6C88A4036, 0x8FD568D24ABC4DFE, 0xB13BB1276756C0A1, 0xF938636636DD48DC,
+					0x4DD03C1EB1E2F25A, 0xA9C1A5A8E232C7BB, 0x5D75C0BDD9017DF5, 0x648C6AA15C09E00C, 0x4D351DF47788FDED, 0x3EADC17B389820AA, 0xB83C0385FE11553F, 0x72E3997DAA5E5710,
+					0xE17EF0E48B874315, 0x2435751163FE90FA, 0xA4A8BFC170B9A83C, 0xF464F4E180EFDAB4, 0x13EC3AA81587FCA3, 0xA751256B1DABFA88, 0xDC400BCB06E6A785, 0x33A7202779FED07A,
+					0x19CFA2074EC2E302, 0xB8CE4467A2B9DB80, 0x43DA41A55D2613FD, 0xEE56D8D378447BD8, 0x7693559A4FFE65C6, 0x33D27C450673BF6F, 0x1825FD2864FDF4D1, 0x68A266F0F3F8665F,
+					0x73DC12D769BE30D7, 0x4434E0E0161C561F, 0xE18FE464261B2851, 0x357B5F763E48B06F, 0xA20B72BF43900380, 0x4CC06864F90A7C7C, 0xD6AEF19405BED5FC, 0x53A20EDAC569EAD9,
+					0xBE999C2E587E8EC7, 0xF00DA5178DCECAF6, 0x5A3989A669ADA525, 0xB50257AEAD6564F7, 0xFB9E0231D643C846, 0x62C2016961C5B7DA, 0x492D5709A20C5CDB, 0x62648BB488800444,
+					0x054105BEF9268BC4, 0x087AD4737820E360, 0xE0AF4B7A424E3CEE, 0x9D874BB7E30489FA, 0x25D5321FFCAD07B5, 0x3CCE35D0F3E6BC64, 0x52293AA0E6C94BFC, 0xD621A3913890FAC2,
+					0x3E8A92023EAF492A, 0x86DCEE4B182E0A18, 0x19A1069D84253664, 0x1917E1AF6412E7C4, 0xFB292EA21E3B97C7, 0x0865376E31A670A9, 0x11AA95136D772682, 0x72BA5A3C7CBA74D7,
+					0x973DAE9BB3C7A8A9, 0x4E9EC2B813D3BD79, 0x9BF227261F68ECD7, 0x63F9A2B5EBB9474D, 0x62AF279AF2DB0592, 0x83EA949A38D69D6A, 0x5359C0151F1CB1EA, 0x9DAA344163DAFB87,
+					0x194B250BC8817119, 0x1A62C060DB75FFD7, 0xCD6F1402B205DC10, 0xEDBBDB9CDB9FAEEC, 0xA5D1D6BCC1595A0F, 0xB1ADBC1504C15CFA, 0xBB115E81CB431E0B, 0xF535AB55591684F6,
+					0x25CFBCCD0DA49464, 0x1C46158E962AA1CE, 0x18A58D101C282F4F, 0xA3F0A2A903C01317, 0xCC8428718DB40AE6, 0x8F9FCCC10CE94494, 0xEFEE4587DA4B9D7A, 0x780AB600ADD54207,
+					0xA2E8288196ECD2C4, 0xAE46EDE086501044, 0x7E3186A83049C37E, 0xAAE182B58661E684, 0xB710A9E5BC52C991, 0x50D17C6FFFC30849, 0x4CDB00E5D8F82BFF, 0x6721A63AA7A6215E,
+					0x8B024006938BF9D9, 0x7ABC1E22D76DFE8A, 0xDE8C97C0D686F71D, 0x633A11E4F4CF632F, 0x100ED2AD6A3F9BFF, 0xC427720729A6259A, 0xFAEA28C3C63138E3, 0xFC3B9B53FF15F82A,
+					0xEB072CC02552CE05, 0x70CAB0A2C8506F2E, 0xAAC6453306C7DD52, 0xDDA49379F28F1111, 0x8C7BA23E40577D71, 0x01891F14D4429A12, 0x4D1162547F868220, 0x1E2CF8E45C1C07EB,
+					0xE9CD102801156EE4, 0x54C64E5FEB5ECB5F, 0x27AD43EE356384EB, 0x117B783B734D8163, 0x4EBB4BC21BCDE883, 0xC11C7FC0B1D7B75B, 0x555D5060CD2770BF, 0x5B195D76FBCCC6D3,
+					0x335472C6D7D6DEB8, 0x900D9DD326EE1765, 0x65840DE024A03B87, 0xF41BD4963125A8A6, 0x18FD361BE1EB8E12, 0x925649652C9078A3, 0xE695FADE027595FC, 0x04B52DDB537D1786,
+					0x3384881F5240172B, 0x984EB42FC7791F65, 0x3DA5C312F019BB39, 0x9F37F6C3D7E87E06, 0x6FA5C8F19E4E5414, 0xA1AD9CCCCD72A888, 0x486F51A343861783, 0x6DEFBD7AAC36BD5E,
+					0xFB9FCE705E61F14C, 0x533604D10C2002D9, 0xA2AC2479FBCAA6CC, 0x3CE8C620E358651D, 0x8DCFD63ACC9076D2, 0x60B1E3335E7A181D, 0xD5645403DD8AEAEA, 0xEDE903CC2F1244D1,
+					0x333196E9AF18B72B, 0xE0705BD7103B8B39, 0x4C7C5D4F83E01234, 0xF4F1FF22A3E6AFAD, 0x90BECB9AFB8C1E8E, 0xB54D2AAB57B4183B, 0xF213C2619D835EDA, 0xF00CD0CB16096653,
+					0xAFFC2E572BD4E671, 0x2FC70346423528D3, 0x83CF4D476B8B3ABF, 0xED2B3BE4D2DEF612, 0xDDD64BF3E8D1C062, 0x258D3C918871AF43, 0x90C5A4D921363F51, 0x2767B32797F1A413,
+					0x7C0C21BF0187EBB7, 0x8E7DD0AD432C1684, 0x3767964040A28E6C, 0x9071A0FFEF190F3E, 0x1515E3BE5C0078AE, 0x6063422F61A1CD39, 0xA62859E89158C434, 0x1D98C1BA3E726B39,
+					0x4741777AF3EA8591, 0x6C26D175567746E4, 0x004C43268420F450, 0x6D0EDCE3FEFD400D, 0x6E6CCCCFD3012524, 0x95026AFEC30A31C4, 0x13CEBAC9164AEA84, 0xE5DCC6561CE3277D,
+					0x99BE407D50A4D620, 0xE063F33F922E1145, 0x8A867159FCB7AF18, 0x5223F0FE6F999415, 0x66396A2496192287, 0x93BE9EEEC4774D8F, 0x0BF271003BDB3E79, 0x589E7CCCFC86501E,
+					0x303947FEA2EFE349, 0xD27E1E9EC21C606B, 0x454845249B5916F8, 0x30435DF4FE0AB493, 0xD62F050F18EA6579, 0x43082225ADBBFD55, 0x8EBAFBA89CD56032, 0xD3B37589F0DEF765,
+					0x7307702D23B23041, 0x94F967FAF7FDC50E, 0x81AB59731ACCB83E, 0x3C73ACAF98EA8E5F, 0x2D6FBFAA6EC424A8, 0x4D15D04D0DD3BC88, 0x6EAB87069D096EC1, 0x608E69C947B547E6,
+					0xA418BDC9146A9C15, 0xFD86812470A7B3BB, 0x04C597A814521A54, 0xED5332B6689C1FD1, 0x6CDFE94B1CC670FC, 0x7268F76B55F9F9F9, 0xCBA4C18B3B09719D, 0x0B7AA2B796E1E7AC,
+					0x4933D5149632CC9F, 0x0EEDBF4DA3CA0C44, 0x4A529EF5A01BA496, 0xDEAFEBC12977BE51, 0x9EC9313C84998908, 0x1DB3BCF8518F3E80, 0x6A28084497E10C09, 0xE984D8F9587E16EE,
+					0x78536C0979A69D50, 0xBD5FDDB1F6A7BE06, 0x5C87DC98B8759167, 0xD43FC222BEE3BA93, 0xE14FA67F3DEA5459, 0x17220C9878808800, 0x155346BAF667FDA5, 0x02B9DDA812582C0E,
+					0x526DCE17E552558C, 0x451113031CD502C1, 0xC613420C4B5A243B, 0x8DE10A86E6E37F5B, 0xDA0462F286678426, 0xBBCB9D23C4C91772, 0xA32326248F7256B6, 0x007E2715CD24606D,
+					0x84AB1A565C1B3207, 0xF1BF01545403DDC5, 0x18EC0FAC8CB10E45, 0x875BD98D05FCF955, 0x089915816301B82E, 0x5A20330FFDB1B01B, 0x454842FDD4D0BFA8, 0x640D933C7FE752A4,
+					0x0E315A5B06FC4E98, 0x1B8AB3B59BD959BC, 0x5C55D7A87A9832EE, 0xF9D362D99E459792, 0x79D42E2EE9D8FC76, 0xBF91795A24E43CDA, 0x4197E90F712D32D1, 0x46FBDAF1F0F33AD5,
+					0x105B412B6856E4B7, 0x1AC7B9E58E8D7EB3, 0xE9B3A3AC44557681, 0x356727025D3B944F, 0xC4CFABB3719AE427, 0xC7A2E3E7C1C2FE4A, 0xFA34152943216B4E, 0x0D0DC0573E8AF86E,
+					0xE4968AF63A79A80A, 0xA286AD86C1241F05, 0xE06F0812CB5239A6, 0x8EA35867DECF2272, 0x10CB241128F53240, 0x51C3347A27E1D3A1, 0x606221C7CEAD7625, 0x7B0AE23E8A7FEE75,
+					0xDD2666E5E681F8FC, 0x32037FAD59C4FA1F, 0x36CC4EA113426E58, 0x1A74222A07C76742, 0x3898D1E0388307B7, 0x990040800C352C34, 0xAC626F271A7FB3F7, 0xD6A1614A8416CEEB,
+					0x583D5922B18D58FC, 0x083A79AEB120B7F6, 0xDD04723486930E42, 0x330BED3DA86D9A0A, 0x3304D4CD7E9B7EC3, 0x75246F8AB6018D60, 0x5F9FDACFBAE921D9, 0xA4E203666B627695,
+					0xAC68670003E951FE, 0xBA62EFF34E05C2C5, 0x3112DCFFFD37877F, 0xC92342F1BEF5352F, 0x08BA81E225609683, 0x7A0AA946F6E54B60, 0xD66F8AE510FC5109, 0x4CC807DAD3DBB090,
+					0xE36F3765F2A968A6, 0xF6C40A1F7DEA09BE, 0x069C40FAB2F7D183, 0xEF417A9BB194483B, 0xBE28A69EB47CBE63, 0x0F62942A60B4B53A, 0x6CFD207411C3003B, 0x129B00825897ED99,
+					0x8E6B7F173E17E163, 0x66E0F851211CC261, 0xB952ECE119FB5CEA, 0x1D340C936C0E1EB6, 0x2277E18F8E348974, 0x0FEAB51C95C42162, 0x540890EC43B04520, 0x8879E8227179E4F1,
+					0xB5EF209A3FB74258, 0xFE72B4339DA11C88, 0xF7D3067F672B3E55, 0xFE222BA252631A0D, 0x5B29756FF1E9EAAD, 0x59C065C72B233271, 0x994A1AE96C9ABF00, 0x761424D8AC91769E,
+					0x0FA50C99E14674D9, 0x10395F81A2E85085, 0xDA6D9F22A262165F, 0x43DB4BFC8557CC31, 0xB1FFE1A4C9983B79, 0x622C34647C92521D, 0x7930F6FA0A7D8D36, 0x3F9B1AF45DDBF3E7,
+					0xE0A1D79E389D4BE0, 0x31AF4C8F84460394, 0xCDAB7C6F21C13969, 0x15960E9EAAFFEDAC, 0x9C3F2D5E2B97BC13, 0xC0956BD45BDEC276, 0x67678F8F95D5E214, 0xEADEAEAF52C96C46,
+					0xB5ED1B665B59B647, 0x34D60F2521C9EDD8, 0x122B0CE1936A19E2, 0x31250ADEEF387AC2, 0x79C8B17B9329D8F8, 0x8079CD030338E6EE, 0xAF59D13689EEE4FA, 0xBFB6FD9EAB0FC0E7,
+					0x5E2887413E04DB3E, 0x3975C474456D4DE0, 0xB534D160197BEF9D, 0xDC4BFBAB25A4D056, 0x59601CFC0FCA5200, 0x4BB455D6F7A36C04, 0xFF0A08FFF362FABC, 0xACB59F1387E2B145,
+					0xC0AAD30188705039, 0x4B81C3D813E1E833, 0x3C8A4B4AA0828E05, 0x08FBB58A59DC0726, 0x425A0AA9A7C1F9D5, 0x6B3FA587BBF18DBD, 0xBE901490B6E23BF9, 0x7CEFA0B1FB508D56,
+					0xBF1A1BB70E01E78E, 0x4D4E853AD35E642E, 0x67E4569CF37226E9, 0x7AF735A1719B24D7, 0xF6A22C6E35A920B1, 0xA00AEEB5834DA0FD, 0x56E2E3394C96D469, 0x8E88FDDB254DA249,
+					0x694E3D1C6285F85B, 0x54AEB6ADC4B8A960, 0x3C55740DDFEDCF45, 0x04DF10440CCC6A1B, 0x340C7E94D90BD13B, 0xDF7A6E9DE3168FAC, 0x7C94F394060FE2E5, 0xDD3F901E7B72E946,
+					0xBEAB588CBD1C9C49, 0x74C8B1C00CA8EAF7, 0x6B887F33C8C6D8F9, 0x6D101F0736E4A5A0, 0x57162EBDE1F73CCB, 0x4BCBFFC8B0CCF35C, 0x84F5B45D2ABA001F, 0x13F48F069BD504A5,
+					0x2347D3B59CFCE97F, 0x19A5FAD9C0E31447, 0x7687AF237DDBA47D, 0x3DE3B8439E5016CB, 0x5DE28DDD099BBABE, 0xB2ABDF692FF150D3, 0xB9A8EA373C059773, 0x1349288CCCB8A517,
+					0x1868091CB3D163F0, 0xB98AEC8D7A2DB2E0, 0xE8EA0DD11E1EAF23, 0xABB553EF1D8878A8, 0xE0250D88B690926A, 0x8D88DF28AE9BB49A, 0x288354C1E0FC998E, 0xF8D47B1CB4E23028,
+					0x22B344B502C79AA5, 0x6859DEA7261AC286, 0x9E761754053B5A75, 0xE1CAC1346B3B98CC, 0x130EC97F1BC48398, 0x4C26597CF1480607, 0x44BDE364B927B54D, 0x49462E0E7DFC395D,
+					0xB95FB243736B9D53, 0x9C789883F84D7EDB, 0xA41A986A9A87EBEB, 0xA26A2CA27F6E4A53, 0x52A550AF8921A7F2, 0xBD498A172C00644B, 0x54C88E0A74523B7D, 0x36525ECAB893064C,
+					0xE6C431770CDF2FDC, 0x4213D6327F5ADB29, 0x90E53D526CA617FD, 0x9936431554A834F6, 0x37313B9DC5669923, 0xE4A37DCCD9F5399C, 0x10D7409339BAF598, 0x086FDB5919C01A50,
+					0xC67056251B136E91, 0x82AF8D72202CF16E, 0x4367C20F2713CFC2, 0x9925501E2F39C61F, 0x06269962050DD1DD, 0x4466ABB7425A0078, 0x1A04968054249C4F, 0x7D5B4C9D72022E02,
+					0xB9C94E28A84B21EF, 0xAA7F10E3B9171910, 0x353979E84E9C2FD9, 0x78D888AC92910B61, 0x2CFF794E8F7FEF1A, 0x0027987F343FBC30, 0x7B93924C37FFF7AB, 0xB4EBBE29E2EC9975,
+					0x5E2B267D6A8EF899, 0x223DF1A4C141B6D2, 0xE669DDB051440022, 0x7D48FA9117535D1E, 0x5D27DD509232C2B4, 0x2720DAABED649500, 0x46673B94CFFA9B7D, 0x1B0FE780C3F7BB69,
+					0x34880CC56E9005AD, 0xA44E4C7154C8036E, 0x658BBA343F895D4A, 0x7ED7DE18A03E2C00, 0xCD667496758920A0, 0x6C1EC62B72FCC5E8, 0x684FDA7F55F18274, 0x0E1823FB9123C52A,
+					0x56FC300DD80A5F55, 0x35A37D8C61EFFBA6, 0xC7D835B4C15E9659, 0xD3061431A36AB71C, 0x5215720051135567, 0x1D72BF81F9348BB8, 0x5CD2E01D5F3370AC, 0x7B6A44C59B672A9C,
+					0xA5AFAD23213B3844, 0xA36DE6B451FA683B, 0xF4A01F60A47B33E3, 0x0B7C2E687B4B97A0, 0x8662862B25DE2E43, 0x3CC61F0A0E658ED8, 0x603DB498213AAE97, 0xB2E650EE8E9275C7,
+					0x1E8B74F0ED1892F6, 0xE165B18FA1D1975F, 0xFBC088C0DADA56AA, 0xFAB28DBACBB501BB, 0x6CCE6C7FFBC1CDD1, 0x2C35453655A2D942, 0x290A515506E938EC, 0x15C52AA209A9AAFA,
+					0xBD093AFEA7B81EE6, 0xFC6D773952B4C024, 0xA7966FDFFAC76419, 0x38CBFDA8B3838EB2, 0x1A7B7E7D60A9B144, 0x295EE73CDD71F267, 0xE8377E78513A5B48, 0x754B1FA12CA7852A,
+					0x69C318E4021BEA38, 0xE602C2DB48A757C4, 0x2C4FB1DC5ED684D9, 0x8B032EF5CE4D9AE6, 0x1DE6AED408918F49, 0x676CEF1A9923566A, 0x1EA9C52620BE0939, 0xEEB144C0ACCF7472,
+					0x9EA6CC8835C5FE79, 0xCD15CB8F9350FF58, 0xDA0C64163BEDB39E, 0x1C641D438058D715, 0x14ADCDD702FF54A3, 0xB24B5E02EAF02C63, 0x8C15CFF3BAD56A35, 0x2DD40346E258F22B,
+					0x48A8CD6CF0A44A7B, 0xA68281A2FC7752C7, 0xB1DFF8FF0A2F4573, 0xFA55320A9505F646, 0xAA0E2331CFA7868D, 0xBC19086538A9CA76, 0xC27EA339481770D7, 0x81CA111511CA4CD6,
+					0x30E563B6053417CC, 0xB206BD9FA1D94355, 0xD16C9346B6D276EA, 0xD2E03061F538B8A1, 0xFA3BB8B8026C873C, 0x4B32ABE03B71A7A3, 0xA60B68001C1928F4, 0xD0DDF07B85E7E8FE,
+					0xEB50EF30663EA452, 0x99601D5A9A844B5D, 0x79FEBED7EE249578, 0xE5C9A98625139FC4, 0xE8B7E7E8B15E1DB4, 0x00C0511059AF72FC, 0x402F859B1DAF2576, 0xB60D976F15DC4E39,
+					0x9613EFD6388654CB, 0xCEA1F144C89FBCB9, 0x209FE420A29AD317, 0x93D4944BB89EC892, 0xEF89E147061EF26C, 0x1BED67E2F742F100, 0x582D5A5F57ADD701, 0xF35F8E19C0CBF697,
+					0xC7B7AD512BAB0D04, 0x29C4CF62EE53C097, 0x40A47EA3ECFC0C1D, 0xD1F45A0CC57A3E72, 0x6DFEE0D47AECB344, 0x9BE3D0C28A98DA74, 0x36CB5055EA8720C9, 0x2643DBBA82116562,
+					0x49F250A87B2B6D0C, 0xAE3A1F4E14E0BDDC, 0x1DCF8F8D965F0C95, 0x2A9CAFE1223A94A0, 0x0320F3984AAE1482, 0x0E1ABACA3C688220, 0x7CDF390555EE9A58, 0x46E5B48D22CEE8C7,
+					0x3D46C4C355054D5B, 0xE090A66FF738666E, 0x6CFCE7367B3C44BA, 0x4C972E32855B07DF, 0xF43EA1569FCB78FE, 0x779B78D4127C1022, 0x94C79593893B7ABA, 0xD647DD52966E7269,
+					0x32D19B9BF114E14D, 0xD9DD84C26745BF4F, 0x2A12738128A040F0, 0xE0124DBBE7137595, 0x04A35C2F609514C4, 0x52F8FC00046CC45E, 0x41C3FC9CCC61C031, 0xECD7357CE441A74C,
+					0xDAF221CC24F10BA8, 0x53C0403E34FA0906, 0x2B103E0797736025, 0x58C06830FDD96364, 0x879C27FF49AE4EC3, 0xAA02FAFC35BA6E2A, 0x46D62CB81F125335, 0x810E59CC2A64CAE0,
+					0x9949641E0FAAD8E1, 0xCC505B491B124F6A, 0xD83B90881C0BFE5D, 0x494A509BB602177E, 0xEFE290AEF7062603, 0xDB9E4F59646BB0E2, 0x0ADCA22A73A6D312, 0xB3B6D8691A108CA1,
+					0x2C3040CC8BB81A05, 0x3B5B3C2E74EEC3F2, 0xF152DACD31991CE5, 0x9A1927DA89D60271, 0x42D9C56333A77191, 0x41172FC01EA0EF22, 0x18EA453978021135, 0xCA4E320E28DC0130,
+					0x9DC3861A9E3F026C, 0x9EB2CE11D0F8B541, 0x21D52B46FA673767, 0xB7464B2DA7157842, 0x169FE80612FE2050, 0x35AD2AED573719E3, 0xCC566E935F14C7E9, 0x7038D593889B36E0,
+					0xC1FCD80CFE0DCC89, 0x0DC63ECB38E8722B, 0x78E1BEB551069760, 0x715884CB93C7DD48, 0x653922F8E8C3B14C, 0xEC72B4ED1EE0996E, 0x1C4049FF395932D7, 0x9B68B12FC958D65E,
+					0xB3CED3A27D260658, 0xB1741867FF30C991, 0xF4EAF0A2B87CDDFD, 0xB2DBE3B1F0AE6B71, 0xC446B02224E85CFE, 0x066A642F71A43A1D, 0x81F3D082F86F1957, 0x83660B96E3E00922,
+					0x72BD9CE66B936154, 0x257DB539A505C5D1, 0x8C430D7B8259E97D, 0x12AEC1A0DFEBF697, 0x0C2312AF70BCFA83, 0xBDBF0F3DE954AD64, 0x0D406E559086DCBA, 0x7EB34C19C205A602,
+					0xD085F1690066F5C3, 0xBC527BC265535E25, 0x59FD5A9F809F687F, 0x5BB23DFC5D44434D, 0x1AA37A5357864989, 0x61FF02BF4972DB72, 0x88BFF1AF6201F688, 0x7B7F3D7EB5A6CC16,
+					0x366059615512BEEF, 0x5D69E657755AD4D0, 0xC444E1663DC81B2E, 0x83B484CC6AD74CE3, 0xFF939B56F8160A37, 0xA1F9ADE5BB24DFCB, 0x13A19269D213F4F6, 0x5E1D39E1EBE1EE2A,
+					0xD0CA0D15A165A5DD, 0x6D26DCD20CE9317D, 0xB7D372ABCF44C2DC, 0x13B041B49254621E, 0x40E5FA96E39F58C0, 0x0537FC12F69752DF, 0x78DAFC8AE0662B29, 0x722B717031DDD644,
+					0xB0FC799842694DD2, 0x8170638AC590AD8E, 0xAC6FDAAE6CA48E1B, 0x12937C6FD676A532, 0x7A20A31E22FA0817, 0x57F41CBB02044EA8, 0xF8BD80316282C5A2, 0xED1FAC253A91A20E,
+					0x85EE4377BBF7C751, 0xBFF965378FBABE4C, 0x15172A3BD166317C, 0xCBEBBF53FAA4122C, 0x1AE5C4C577B3B081, 0xD75EEC96655F8061, 0xAD574C78FF18F246, 0xFDD4CEDA403EA982,
+					0xD222B829E49E6D8B, 0x768550BCC0F280C5, 0x408E81777E00B7BF, 0x69AF7FA8475199B4, 0x1BF06E56EB58FAB4, 0x05026A24A4A346D9, 0xB758C216551728B4, 0x1359AC04DDF3853E,
+					0x64F1E3071CA6AF19, 0x2D9DED3FF0C0F9FC, 0x6106551A1DEF4995, 0xBD559C85025F4ED6, 0x64BD457D0FED448B, 0x47BA08745E38E57F, 0x21FDB72B74887127, 0x0C04A04A04B49CC9,
+					0xC7825B998DAB34F3, 0x773F6BD9A7E3AEC8, 0x8DA254146AEDA03C, 0xB86DDC9A6EE14C6A, 0x49B7D9F2D1F603B2, 0x52996A91502F9C7E, 0x4DD057C645732937, 0xB4F56C34FACF384E,
+					0xB01C847C57B8E90C, 0x1486BB6181607081, 0xAA53F49BE47F3567, 0xFE297C5CF55017AA, 0x5E33AF664387BF4B, 0x1F208302C4518B95, 0xEC496E4FC3255042, 0x1BE75AA726C2765D,
+					0x5F7EBB773A786C22, 0x949C47B75BA08B7F, 0x21C2B6F8E381285F, 0xBAEC0A9964B4DE13, 0x6B311C0438E877A7, 0xECDD4339B28598C5, 0x219A35E891F5066E, 0x89A760B48CA6D6AB,
+					0x28C8C27DC42DDCA2, 0x266FAD4FC0206F19, 0xC30795FB91E3C711, 0x5EB0F7B5E5D54F67, 0xC9A5333FF936CC1E, 0x343993CBCD333E29, 0x5EE76A5071985038, 0xA937D64A933CB81A,
+					0xAABC657E2A1BBEC2, 0x4EAA02DC8DE6CB35, 0xA7EBB5C954956317, 0xEA878C4823BBF517, 0x71188A040F4BCABE, 0xCF9A4A3A5271A85C, 0x53152721078BB9D8, 0xC9FFBE804E1E93D9,
+					0x250EFCEFFF322D0F, 0x813579349FDB7E86, 0xA94637567B9DB791, 0x0E307E246E555070, 0x22A7E3DDA2C8831D, 0xE9259F34E3431FEA, 0xB877B43FD0664DF5, 0x8304E8FC9765412E,
+					0xEBE69E6441E190B7, 0xDDAFB954AB4E49C6, 0x764F02CEF1FC01A5, 0xC9C642BE4D24EC33, 0x15BCCB15BE97C248, 0x50DFF1EB51903A50, 0x57995FE7B562A970, 0x771B4BAC6D26A03E,
+					0xD0F8AA71B03427D1, 0xC956F6C118CE33E2, 0xEB8F3AFAA9A4C575, 0x5597E9ADD1BC479D, 0xE8A7ACB7C3FEB243, 0xB08097054D862B02, 0x21E32836C6975A9D, 0x3EEFB62B5090E639,
+					0xEB528B9017164CDB, 0x5AB9AC0C441FEEC4, 0xDFB7BB39660158AE, 0xAEBC1AFDB29704A0, 0x205BFA6684FAE44E, 0x9C0F9AF563BC41EF, 0xF37012585CFA59A7, 0x7D7BE008330068E3,
+					0x0E609AFB69B5DD4C, 0x30CED567E398F5F3, 0x46B38EA8D23F1850, 0xBAAC04CF0B972A19, 0xDDFA295A07D257F9, 0x1E1249F503017ACC, 0xA89958A40F90A191, 0xE53EDD72D7E7F595,
+					0x7D16E43D2A6D6DDC, 0x0A923DE706AA2704, 0xD5058DB5EECE0253, 0xBA2BEABA7A548542, 0xCC47357058642367, 0x3A471EA6653AE658, 0x8CD027F7E1F17966, 0xD3D32F0ABDAE990D,
+					0x40FB6D340B036205, 0x174B73F150605C84, 0xE6ACAE3B77D33762, 0x086E7600C81FF5DA, 0x093B08BDEA8880A1, 0x0A912E86D93C93E1, 0x4FE059D1FDABA481, 0x09714AC55196B520,
+					0x38E879FC89D5AC86, 0xE974FBD73F5CED5F, 0x1147729A09140308, 0x861CEDDF485CFAA6, 0x2DA62F4182D4E550, 0x1CCB671952180A2D, 0x0CD38A70D71E2D8F, 0xA8A0E99F6D08C29C,
+					0x93171E6B17C1FD86, 0xAF4AF8BF89354F65, 0x786C13AA4CA63590, 0x474F9A44EDE46ACF, 0x2E8A0A5F71E627FE, 0x826F4525DB544C50, 0x6068748864FE80E4, 0x732D3B7D6D93E39E,
+					0xDD4D17556A4E8219, 0xF6C0B11B72E9D339, 0x875C142A31766626, 0xCD528F6140DA4171, 0xBEFE6DF8532D9E15, 0x167CBCBDE071A7C1, 0xC6976EC5BE8083B5, 0xFBC2D7D9C5FCAB41,
+					0xC97B0830145B9ADE, 0x409AC7834BD9D9C9, 0x29EBA9781CBF45CF, 0xF03FD4B9181E1304, 0x850C9AA91E77B737, 0x6C9BFF4D0DB2B2EA, 0x93648FDCA686F710, 0x475F68D692B95D7C,
+					0x72DE3DE4FE0DA6C3, 0xB8B854856D8B3039, 0x8358711CEB0FAA15, 0xDF9E618CB9696775, 0x6D26EEBEF28CE5CD, 0x3F32D91E566999FA, 0xC24FD653BB2B07CA, 0x8AFA2B71917EA510,
+					0x6DE089BE675AFA80, 0x77247D790D7FBCB5, 0x24A2EA6DFBF840F3, 0x99801FB38CBA9EB7, 0xBD4F4F1814F4DCE6, 0x98CE2A185FE7E9E4, 0x3DBC57BF2E2074F9, 0xF576FCC2478BA9E0,
+					0x8D0BDAA6927D200E, 0x4DF31E4DEA98FA5C, 0xE4E4653C816180B6, 0xFBD9B24A594B6AE8, 0xF441CFA66775F30D, 0x1098F0C038FFB1B8, 0x38DB75A9C2F47726, 0xC0929E4BDA8C326C,
+					0x22B1D63288D32841, 0xE92FDEC91F09670B, 0xBBBB15BB8FA9DA46, 0xB32AF3514FE33E53, 0x4442163B440220C1, 0x7C8A3B1F62CC934C, 0x85FBF123DD13F40D, 0x9A3AE0C97959B8EA,
+					0x2B3ED29B6139545A, 0x0491C64830D37F58, 0xA183CBA84537369B, 0x636658539765A60E, 0xF2DAA57D4A7358D1, 0xFC0D4938CF480105, 0xA08446601D1C2402, 0x72B5224C9037C0BE,
+					0x82F13C72C9FFFAB4, 0x605F3EC76C3B23D3, 0x2655E1FEC7405786, 0xF1FF617BA483680A, 0x953CF3116C6E2111, 0xC5B3BA06CEAEED96, 0x85C18E1ABFA5B6A5, 0x34F29F535331677F,
+					0xE14F982A2403CD8B, 0x893C60377B2A8F44, 0x4BF3BECAF00B045B, 0x238792D754505028, 0x48654C7344F13205, 0xB2C7371EF173B7E0, 0x7C376F2870A06D05, 0xA0027BAD878C0D49,
+					0x03C0738C46652EF4, 0x662DBD1318C6AF41, 0xD4F6DCE5D646064E, 0xFA1783A6C5FC5F69, 0x57C107600CDC6402, 0x2093FE2F809400C9, 0xB67BB1F479558B0E, 0xC9B7139375003C7C,
+					0x5FB330F95C1FC5D8, 0x1BE5DC20A9CE54C4, 0xA4FA04801F3B9689, 0xD380470C8D8BDE79, 0xF7C52B45377B574C, 0x282F3B14D7A0AA03, 0x55AFE434A1E09A24, 0xAE626809F46F6A20,
+					0xEA185155FD8E1EC0, 0x0A8F480BF7E107D9, 0x4063B03B9C070D83, 0x9168D9F8EB53E17C, 0xF87873830FD3181B, 0xA0DDFEA63E03F198, 0x083A73FBB5E5F509, 0x542083C94A269204,
+					0x52902598438DE4CE, 0x3CD57F88B072ACBF, 0x172644A614FB9DFD, 0xD11866E609AF5485, 0x47AD264E9DCE7965, 0x762A5E6FCF466DF2, 0xE18B6B193A32AF37, 0xDEDC14ED3A72B33B,
+					0xF746B4734255A66F, 0x9900FC929E6C4B37, 0x611A931ADA9214F0, 0x67ADE53CB82D866D, 0x7DFF94195FD955D3, 0x1F5D8E45731AEEEC, 0x3AC7C323F9F2E4A6, 0x0D62268B86271DE0,
+					0x692783642F7665DC, 0x8F2D346582513B8A, 0xA1C150C3021DEDAE, 0x84EC33E02DA62CCD, 0x5CF754C0071629F3, 0x9F080A27C7C1AD9C, 0x80FDD211D28D69C9, 0x0C0BEBF9C86BE582,
+					0xD1FB0EE1A4DD16CE, 0xC7106A277A39AB38, 0xB272B2D8A2194C15, 0x52414DA131D67A6D, 0xBA8BB54360BB51A3, 0x68E1A6E8F6CCE03D, 0x95C85D03A2B666D7, 0x6748D44B918EE857,
+					0x67D810C9FCF9A085, 0xF19A3DF33FBDF8BD, 0x8922AA65E9A483A6, 0x73E333FE175999A3, 0x7F650C202229DEBD, 0xC4865CDCC278554A, 0xC909317DB9413D4A, 0xA0ADC70F5F7D9219,
+					0xA3E881819F72FAE2, 0xF89218D680848F1F, 0x92A4E57F2ECB6475, 0x14E53CDAA3CF2FB2, 0x26A102CBD33A5646, 0xAE0237AB4A0BD180, 0xAED961E6B6229294, 0xE0B6472A30C5F7CB,
+					0xCD81B80FBA8E1F19, 0x67FFB0E9EF93B983, 0x401C332F93AF342A, 0x088CF6D28594A118, 0xCBBF3FC8B87AE807, 0x3B33CBC419F72856, 0x0C473687253A63E5, 0x852F1768B11B48D6,
+					0xBE6E73673864E20D, 0x0FDB5E7E34BDC513, 0x2EA08732379B34A3, 0xF5C65AF78F463D13, 0xCB5B0B044BBA4451, 0xB9A77DC926DBD692, 0x008612976FC45B74, 0xB5718AED0EA1B41F,
+					0x8CFCD9F43CBEE989, 0x28A827695F6B4A09, 0x4D1E0955D135FB8E, 0x7B3BB024C28E6E79, 0x2D2AFF96D9009036, 0xFE60BEA112978ECB, 0x254CC88DA1437920, 0x673BFF49849C4E42,
+					0xDD46B1EE65A4E298, 0x9188D724AAA658AB, 0x0CDEE295E6FEDBBC, 0xF03E68FA83BEC637, 0xCDC5ECB718C2F333, 0x285A76F0C03CD8C5, 0x74152F79DF451D7C, 0xA4C6007B563DFD91,
+					0x86854F3F46166488, 0x2CB8A23BDCA6C3E2, 0x93A53A4BA0647B19, 0xEB912BF8B4D6DFFD, 0x447CE9F698925167, 0x29347D65695AAEB9, 0x3FC28192C362B423, 0x9A2F6D4F4B2D4CE6,
+					0xAE8CBC4CC40588F5, 0x620F6809F5AA7B64, 0x4855CE88BDF0243F, 0x8E3133D233B599AA, 0x263048E6940ADB8E, 0xD2822A7677C47AD3, 0x60BF2D58A47FBC6A, 0x006F5F2470C2E50C,
+					0xC594482358090991, 0x1924F171973C16D9, 0x6428B6EFE7F9FA8A, 0xFAF3D70D3F787067, 0x173275C4952B96E5, 0x74E3694A4CC1809D, 0x7589B2DD31529E36, 0x160F5D90D098487D,
+					0x2712ACA25A85DBB9, 0x6ED037E894811071, 0x3E5A1520A3AC89B8, 0xF2EF9996731D5A19, 0x70E183D3F402F46E, 0x0AC00F8F109F842C, 0x2A395909EFBE99DA, 0x24CB46FC30C22A5F,
+					0xCB54A4374E43DCCA, 0x552AAA3811D3C98C, 0x94194E102A93116E, 0x6263823B721ECF59, 0x16C7144FA4A0E3E6, 0xEFF1E91D5286345A, 0x875B86A65147C1A6, 0xEC2B0651E4CC7465,
+					0x58260277D4878E07, 0x0A1A16433AAC12A2, 0x097B171DD4299569, 0xFE645A3A7D3E8533, 0x2DE152D6C38B2DA8, 0xEF0472F3588807DB, 0x7C99CF10C4076709, 0x5260F914A7970934,
+					0xD1A063A054FE3A50, 0x70F6D0D515BABE65, 0x108A8683F2F45ADA, 0x69D38D39865E14EC, 0xE8B173714C45471A, 0xD00D86B0A80C9661, 0x2D003116E28EC910, 0x2349695DA81A07C8,
+					0x5161ACC3D461BAEE, 0xAB92CDB5738C9D1E, 0x2A47E2A21D5A65DE, 0x89F3EC24352D5C54, 0x730241B841408569, 0x947DCC0EEE03AF7A, 0xF381D04A402FCD63, 0x81B26071018BDBE4,
+					0x36B0B3F0E7574CD2, 0x305EF385E8FDEC35, 0xF74581FFCF9A41D0, 0x1351AAF4235E4A99, 0x44292E02BA581111, 0xE270385DF3DDA5D7, 0x4BB6AFAC8180781C, 0x3BBACFDCBAEBE49A,
+					0x012D675941E02A5C, 0x146B4183FB08AF2F, 0x015746A3F3A1E3AA, 0x664833B4F4AF3FE6, 0xC3E2485FDF195044, 0xC12A6F6A54708070, 0x63510DB5E598103F, 0x595380F5889E795F,
+					0xFD9BF485CB01F6F8, 0x5DB62E55CB50942A, 0x0619247CFE3E9F62, 0x47E2F5785589AE5C, 0x61F2CC0A7B552F1B, 0xB50D4FB5A8ABCA69, 0xD2DD535D3A03A349, 0xDCB6C2FCF2E8F477,
+					0x09A9581880D4BF89, 0x0CD2CF72F9C20A4D, 0xB6D6F8FC9104DA39, 0x2B70AB6C38D4EE10, 0x69E5004176DF5553, 0x72FBFD1E07DFD482, 0x58EE4185FBBD7954, 0xFCE29336B8E22A2F,
+					0xF162F5FF048133BF, 0xF3CF1F258266EA17, 0xD1FD0694C980DB47, 0x716419FD6E90DDBA, 0x507E813E52FA3A71, 0x1E87BCC40D889672, 0xBD10ECF516F233F6, 0xB4EFB7617FC254C7,
+					0xE2BE26ADF27924A5, 0xD941C78CFDD54656, 0x9DE5DFC74A4D6EA0, 0x7CB51CE0B6E15891, 0xD86D3BF6AEE68E03, 0x3150C884712C5C3C, 0x455B03957ED278D7, 0x6AA3548DDE2A6663,
+					0x7055627EF0867369, 0xF6A64D3F77C5DF5E, 0x20DC09F55E2E0C63, 0x8A7E62ABC3BD2DCB, 0xB81C13A4FBA35FB5, 0xED24E1684E045DD3, 0xCBC5DE2B3712841C, 0x07F28426E35E097B,
+					0x97DC653725581DCC, 0x682812F7445BB0D0, 0x569833B3A48620E6, 0xA9D1B7F10E7D2DD1, 0xBD0DCAA799BFC20D, 0x4E430E4D1E6C63DA, 0x8ADD4F998945E39F, 0x3AF54FBE37D58EF4,
+					0xF7393CEBB625AEC4, 0x868C9F3D72307AD4, 0xC752EE89BC62A175, 0x38C4DB7A9968ACB7, 0x822C96D80705872F, 0xE1A3153963669162, 0x8D5358DDA732B0A1, 0x2D05A8648BFB9825,
+					0x162E006556B605C7, 0xBD5FFBD0C77645A2, 0xA9B51000D0B508C7, 0x7BF6D2B5FF3C1B6F, 0xD679DF838426B033, 0x65FE13CCEAFF902A, 0x4C3CEFCC64820D24, 0x0A33144FE9C9C5D6,
+					0xC64526092F3A3CAA, 0x130FEEEE3E136E69, 0x3BB254151B7246D5, 0x18ED744D1532BD61, 0xC86F56C38A0D1F62, 0xA1BE088F3B196037, 0xA4DB6F43CFF970D1, 0xFD113C7DE758564B,
+					0xA755A2D74528C364, 0x43320E99E6A8E39D, 0xFBF44C7716227678, 0x098359EE6669FD3A, 0xEF0AA8C5C6B007D8, 0xB4BB01D49313B54B, 0xEA5057939967C561, 0xCB545E42A8D1B77D,
+					0xFDEEE293E4C95684, 0x1B851F00A58C4B4F, 0xFBE2DCE4FC969B72, 0x6F83F7443F0E3F7A, 0x4F01C8BEED0C6162, 0x50887A57FB016A1A, 0x3B6D0545B628AB92, 0x7C398B58369D89D8,
+					0xB9C28D4325916C25, 0x0EFECF5D801A75F4, 0x625CAC80CAC82A2D, 0x0BA67A819492B62B, 0xC526C8D4DBBABBC3, 0x1B80D3331D41AD93, 0x249C3CEF20FC8C54, 0x1E8ADB4522C4D31C,
+					0x6B7B8F906424DB9C, 0x7698B68ADD918D49, 0x5B205809DB4D246C, 0x27123E0696E9D6CA, 0xECB5C341C60916E5, 0xC46757E9FB59E079, 0xDF024B9C5978C5CC, 0x68862734E31137B9,
+					0xEB2BE3B2CC233F80, 0x1814887D8D67DEDD, 0xA20836EE57E60979, 0xFFF3AA8DB33122C0, 0x77A503248E034C33, 0x848BBBF4ED9D6056, 0x49A6EB25D631CB03, 0x4F0B28564055DF16,
+					0x80CA99FC9A282BFD, 0xD6FCF3C1BF1BDCE8, 0x277068636B63BA87, 0x1A9413C51FCBCBFA, 0xA7BEAE05CC7A2AF9, 0xA7A84DAEBB4EE7A4, 0xA7EF2F3D184134FD, 0xE981B6816BD8E454,
+					0xC35C6F55AC1878F2, 0xBB2375D4854AA9DB, 0x69F197E6E146CC44, 0x91F6BBE035F25B8B, 0x622AEFF036833754, 0xC921CE5E00604CAA, 0xE946571387822C71, 0x6CF95B771EADC922,
+					0x772B15E234F8E6AC, 0x46F3FE55BE9A74FE, 0x4EAB9B4EBACEE9DD, 0xDD1134371DB8F8BB, 0xD64985F2057497F0, 0x797ABA9695D2223D, 0xEFCD1084C7EF7618, 0x104B3AC108BF7BA9,
+					0x73FD41544DA96822, 0x40B0DA53DAB372F0, 0x22A4B9D89025F663, 0x73751B9B08F997F6, 0x2870D1973FBCF28E, 0xEB50608675A8A834, 0xEDA61409D75DB7AE, 0x1ABCF9D1F81ADE07,
+					0xBE8D7E6636C3EC2E, 0x24A99517F38B865F, 0xC3575A3EA81C5033, 0x5C07EE8DBAEAEA74, 0x9BDC4DF59433562E, 0x5BE6240A21CB646F, 0x6A63A5C5944A9489, 0xB9919FE4992CA399,
+					0x531932B23C0B8CB8, 0x12CCF8C8CB4B314E, 0x62C9CAF4E1556A44, 0xC53C620D4F19A84A, 0x0A93113F1CC58A34, 0xFDDF95C52CC93229, 0xE332FA16856B9106, 0x59AB9D2FDCDD97EE,
+					0xC8D23213A7B4763A, 0xE2CB3868257A59A2, 0x6E018588EDC788DA, 0x79C8E5C2671D9ED2, 0x26898266C1DE6D99, 0xAD685C6091F6E13E, 0xF645AC9DAC6FD5B5, 0x9BE6C92330CBB300,
+					0xFBB3DB6AD30C4628, 0x6129CFD07A2FAFF6, 0xD13E8BDF026CC5A3, 0xC820E4B96793EF9B, 0x07620B7CBAE787B0, 0xEB7FA56D4789A3E4, 0xACAF7DA563989E09, 0x0D6F118D3F93120F,
+					0x9F1F86FD6C8CD7C5, 0x3B15D5C9F44C9F86, 0x75AD662FCC11E1E9, 0xC486638D0CECC586, 0xB1A7BFD3A31688C1, 0x82603838181C84D3, 0xE982306F001CA96E, 0x7B79C1D52DC16089,
+					0x40FD71963F329E8F, 0xFFDBE72D0287C593, 0x35B6649E1B90AB69, 0x556F5BA4F85C8546, 0xF722B0E6463BCE94, 0x24FB6346A5C5AC85, 0xCD069806243E698C, 0x6463D6101AA180EF,
+					0x004F70CDBE38413E, 0x4E5883523BB86C7B, 0x0BA63E849D123031, 0xAC61EAFF5D2AA680, 0x9F8C2AFD0E812893, 0x473F16A20F2B4848, 0x40DDCEA5E8355DCF, 0x7D2082107C379064,
+					0x373D0D5A833826C9, 0x80A404BD968C4CFF, 0x0CD01EE66E47B51A, 0x034F7F6DC8EFAC04, 0xFC18318FCD782898, 0xA2A82586AD4227F5, 0xF7466B4056DC6254, 0x2C6BBA24851BAA0F,
+					0xF23A0EE98ECF4718, 0x57CA49B2DDA18A85, 0xD3E6159EBD8C8F95, 0x959B7803E0809B4D, 0xFF628EF48E0F7801, 0x5193C39AC26393A4, 0x2BD621E29D937950, 0xFCA9D40496DF90E1,
+					0x518A7CAB07084992, 0x33809F4DDB0842AC, 0x01171C48FD858359, 0x017FA2929693DAF6, 0x3965EEDCB1CEB6CD, 0x38B066CBC63C63E6, 0x0B281BBE39A60F25, 0x496C6DAD486C350F,
+					0xA432420E5A029F9B, 0x8BEB307E84F277EB, 0x607BA62B197D9391, 0x8024A137359E54F1, 0x2BD48E640DE59D11, 0xFE8FC08E804EEB5C, 0xCA56AEFD0616BF6D, 0xD932D439E0907FF8,
+					0xC1E3E80E7A9D7099, 0x424F7A6575551CD1, 0x1375CEC228F06B3D, 0x94259006C07545DF, 0x9ACB4678CA41033A, 0xF4B9776031C9A78B, 0x197FE277433702D3, 0xE441C56558176605,
+					0xC08582B2121C8B44, 0x33C70021A88D73B8, 0x414ACE0F3B4C5E27, 0x695051EFB053E619, 0xA5E56B6E65F22084, 0xCF8AAB0E10AD6D5F, 0xB9B29FB38E96DE97, 0x8042EDDFE7F49DB7,
+					0x4467F201F2307159, 0xDF00D7409B1C3B47, 0x28B892232217C13D, 0xB86D11C05AFD8519, 0x78379AD82523C642, 0x8A380AB0C9DFB050, 0x46242D44BAFB3E4A, 0x24D607D65B9CE88D,
+					0x8EC0D80ABDFF9815, 0x9C0EA9C2C1C1421E, 0x464200B6391E586A, 0xDB9C21F6A42BC0C9, 0x18D3B84098DA168F, 0x0ACCC021303B8DE2, 0xF0F3D4F9F42DE4D6, 0x27A2EBC2D02803A3,
+					0xAFEF13F4FC980CEF, 0x8A99069DDB47BABF, 0xB97276C6F2E14D11, 0x71B031B57A3E6C74, 0x4E43554B2D142118, 0x54D50B92214B5732, 0x9E7F734631CFA48B, 0x555F3515FF31D99F,
+					0xB9AAD5F0090BCC88, 0x08B1558E0D57363C, 0xDDB4CF9DD0980A1A, 0x687089761A434E7B, 0x03C02B9DEDD05D35, 0xF347E2D125316DA1, 0x5998058497BA46C2, 0xF56B012CEA54BB2D,
+					0xAA30D78A6973A43C, 0x8E19CD1CA5A63163, 0xBDDA3CD4EB53DBE3, 0x827A27E1F29E481B, 0x482C6F580FC9BDAB, 0xDAC520F2D100995E, 0x17F61C4C7EA8CE92, 0xBB69863C408CF855,
+					0x35B4319D38C8A0B5, 0xC831B3466667C2AA, 0xAED5AD673FA1D1DF, 0x08C9CC2F1BDF6213, 0xB714A3354F30A5AB, 0x21083FB50FA38F9C, 0x7B9AEB099297A436, 0x0CF2BC7F71E4274B,
+					0xB3BD8C908C59A60E, 0x239C712DCD27D71F, 0x31DB3C229D9B038A, 0x06D53C4C59BAC30D, 0xE1FAA4ED21FA885E, 0xF2C18A5CAEA344E3, 0x036DEB3A5B09A106, 0xAE116ADE7E217D3E,
+					0x24EC1E6BEAE28D2C, 0xE3B733ECCF2D1B46, 0x3C5C5305F7908EF2, 0x7FCE12F1C58E7E10, 0xBA616956985AE0DC, 0x81272A3A596B6E8A, 0xF903A254F33A4645, 0x61B16EA72D6E4431,
+					0x193C00BBB023C42C, 0x83B2A05195E54872, 0x9A2FE3F76C69EF9A, 0x013F94951B8AFF6E, 0xD04863FDBA6A5757, 0x34DDDE60442875E5, 0x0B29046A4F14FB4B, 0xB82CF2CAB377B37B,
+					0x52B17E157309FAA8, 0x622FF4CEEE20AA48, 0xC17A57FA9056682E, 0xB69F5290FB5D1924, 0x60150175094C470D, 0x3A046EF662B5DAC3, 0x43A41E7D3FF7763A, 0xA6156E1DE4B87955,
+					0x6768E6D3A89604EC, 0xBE5313AF116CF01A, 0xC5835A94C7209E5F, 0x555A20AFC807449E, 0xA69042CEC2CAEF7E, 0x6BE27D7E13346865, 0x6334F63062F02DB4, 0x50B2DE3757FBFC99,
+					0xC0AB20DE1062A937, 0xA459A33C7B9BD9F9, 0x473A8A417A536B59, 0xC07A982924BB7603, 0x75588DDE936AD505, 0x5039933E3A4C7C5A, 0xBAD43DB62383450E, 0xC95B8CA8F0734DD5,
+					0x2C532103C55EF186, 0x399D445D38D7976A, 0x82BAF5DB48BB128F, 0x3E1DAB723EA5CE03, 0x2205E8EBE1D74123, 0x48F0D2A9B35984A2, 0x05EA4D4648EBAAE3, 0x9F3E9B3304404CDA,
+					0x416946259DFE652B, 0x76701BC6121F1E63, 0x077739A4C64FCB8C, 0x62787DBB97CD0E27, 0xA4CCC161A5BDC099, 0x15F4340A7AD43D44, 0xC4852BAF97215FA9, 0x3AE806AD36CCA602,
+					0xD752D3F151AD9076, 0x6D51745A122863F8, 0x11671250B7E5BD18, 0x3448DAD835967BC8, 0x2513858A785FF295, 0x1A2B476556933E5F, 0x184283BBC26622D1, 0xC9556CF4E260896D,
+					0xB2903194D35AD049, 0x362B33A901215EE2, 0xB1630A876D7C6DD4, 0x1B7208E1E85A31DF, 0xB1E19E80A6EBC6E6, 0xB825CB663AD813D0, 0x23F3B02417F2FECD, 0x6E9EA53566E3D33B,
+					0x6B91985521BA98EB, 0x4FB7A742E8B83CEB, 0x4FB8209D5E1FF862, 0x6C012B3D1859C45E, 0x498BF6CA58D877DB, 0x6381F0A7DA5CD462, 0xE475C06C01D22348, 0x395DB7A883A76054,
+					0xB3940F026D717331, 0xD57F4CEE558D896D, 0xB10D2137F58FDB1C, 0x67D36298D1411CDB, 0x960D747FD01B4B5C, 0x96A2B77B3E6FBB8A, 0xEBCC4046938A5973, 0x4D49D170E0019339,
+					0xA9F0BA2A9024FCBC, 0xF2AA56B07709EC7A, 0xA216BCD2090AADB2, 0x4C46C154119FB3BC, 0xE58E2B8CD5103DB3, 0xE5A695424BE9482C, 0x0652396E114C2EBB, 0x16A69681BF1C975C,
+					0xFBD3F7BF41D0BDE1, 0x70E41C6F99E0D445, 0x2DF913D5769FD039, 0x612B010FCCD3C209, 0xCD5F4CB232420B8F, 0x3C7049F24637CDB7, 0x97E984DB09EDF8D8, 0xE7CCB8EDD788536F,
+					0x2FE9EC8937EA2552, 0x99C6DCF7DF8C6FE0, 0xEF72F7CCADA816E8, 0x5B42DB8BEF3FF4E3, 0xF45CD97EB1D38061, 0xC104E83699B56452, 0x4016D77A76D12B0F, 0xA0232661C348A9E2,
+					0x8835FA3CA216BF33, 0x3ABCD29898FF3607, 0xC02950E71CD46672, 0xEB261539EA2F0740, 0x8764EFFA2714BFE0, 0x0D4DB4741A2C89BA, 0x0412B03E024C32D6, 0xDBDE5FEB9C3642E3,
+					0xBBBF5AE0EDB960BC, 0xBCADE9A2B0068D24, 0x6DFDDEA06251D3C2, 0xE5A463C3758537B7, 0x1500A184D6EADE4E, 0xB0907A60CD19CF63, 0xFD2281A04EE2D3EA, 0xFD4FA4EBDDD6B070,
+					0xA3D05086B3ADCC2C, 0x6F636374AC6E7ED7, 0x5D24F54DFADE295E, 0xA9F85A048C41B72B, 0xC11B8195617B42B4, 0x1F072905B5898AC2, 0x788CD29ABC63F4B7, 0x3F2630A220EE29A1,
+					0xE0CAD68B4FDCA3BE, 0x70A17C4EF4B0F831, 0x7466A437A6644FE1, 0xAB58256246A99E01, 0x55AE61B881F87539, 0x9D1DDE7EB3A7CF9F, 0x3D8BE72E5619951E, 0x4F95802FDAA410DF,
+					0x6321840E56FBEFDE, 0x5BF9BDE432A59AA2, 0x7FD8877235EAC53E, 0xF43902F20B9C1828, 0xED4ECEBA85A06937, 0x29B35481F6C5CE7C, 0xB596DFE10F0D6507, 0xA462F010E53D6886,
+					0xCB3525631BCEA76A, 0xD2C6D00DCFFC440D, 0x294BB6DA1731A5F6, 0x2274E1924D723898, 0xAE1CE1710860A6B1, 0x9C53744D1E75E029, 0x921A088181DF5970, 0x386275ACAB6C816A,
+					0x77047734598413FE, 0xA0C51ED7983F6DD3, 0x2AA55F97BF7363A3, 0x3BD8E57F0119404A, 0x9B33A99F8AFB2A27, 0x4644CB13E6AF906C, 0x4215A64C4A9AD28B, 0x45AB2B9AA33A0EAF,
+					0x6088C62E2E715C6A, 0x5C33B6C15E32AE65, 0x9C4700EED7C1D28A, 0x3696065911B57122, 0x74B19C50C4FA5A39, 0x5827F05FAC1E1F1F, 0xBC06F4EF73320787, 0x87797F085A5C964D,
+					0xA076BC4361E0F5BA, 0x1F53633A1AACEBA0, 0xC8BC97E6BAA8CE8A, 0x4760FA3426E66B8A, 0x19EB5CA7B1235D9C, 0x4B51C6291173A01F, 0x83B349B00B3D6244, 0xE8CFE1C2EFC2036D,
+					0xE435269E993E8076, 0x61D4773E85DE2BA1, 0x4A7189284BA2CF8C, 0x015E3433FE16F672, 0x7FD970719B4FAED6, 0xFD4918DD21F551FC, 0xB166345DBC15ED85, 0xF5D547A53287F67B,
+					0xB0B13674AB3F28A9, 0xF967D422D2AC52F2, 0xC5066AC886D8253F, 0x6D689BDD360EB2A6, 0xB0DD9A2C96E656E2, 0x831AEA6C1A72B7C9, 0xB81C129B3C5D13C7, 0xA1466602CED6FC6A,
+					0xED8146371F018CB8, 0x0A56897F0BA4B0E7, 0x8E1612C9FB58784B, 0x392C84D7B73A5E4D, 0x85B3E75A782CD184, 0x375F8DCB668308DF, 0x8576CC19E7908A1D, 0x57F37AE22F4C518B,
+					0xDB068C587C9561F9, 0x7945EEBB67534A59, 0x029B83BC00CB686A, 0x303B0C9BF347D27C, 0xA824FD5DBBF8A637, 0x5871CD471396C66E, 0x248C0E0A50DB243B, 0xBBC24F0E6B51F913,
+					0xA4EAA79DCB54909C, 0x172298137D1D8466, 0x3AD87F01230A921F, 0xFFA2C2A85A14E781, 0x634B9931CDE2F5D3, 0xA71248E52BBEEB06, 0xCE2512742726E241, 0x0C9B366915F6E622,
+					0x69B63313A071FAA9, 0xD66B8EB6A81D6F31, 0x9D67D7A9BF984367, 0x28BE5D9EB75F0E82, 0x7BEA1C4D1137495F, 0x34D0A29712641CA5, 0x4F1F52B16FD4B5AF, 0xF94C83C2930E43CF,
+					0x771E259B30B6F027, 0xAB870312DFECEDF7, 0xBBFEF74664B6D670, 0xC17CE7DB092F4BB8, 0xCC049E3F3AF51FAA, 0x2E325A7A40F87FFC, 0xD698803BBA089378, 0xAB3062341FB72C18,
+					0x06615070A5B1A036, 0x0C10BFB69018BEE6, 0x4BCC4EFD4EFEC382, 0x7D792A704B8F3C8C, 0x011701D21BA8E825, 0x18F33C3437E77E5F, 0x77A972371C29A411, 0x8E42B35FBE4C8752,
+					0x33698B6F3735EC8C, 0xC8DEA6ABD2F2C2DB, 0xB3A3F2949B30CF72, 0x9C23DD4A2AD7CFA1, 0xC2F1E6F7BEEB8F9B, 0xDE1CDBDE6DE13C66, 0x79D9F9DF0576BDA1, 0x2DCF4F106FE6479F,
+					0x0BC79F076921A966, 0x8FB894E77B0FF75C, 0x676BD92C517347DB, 0x0F769B9FDA1908C4, 0xE0A4A2693EA7D2EB, 0x3A29420A50237818, 0x82BA55C519D82847, 0x3810B0C89CC53358,
+					0xAD9B45C30E984616, 0x84E61E254B332338, 0xE87BFDC80DA1FCBA, 0x2F0A5CFE246AFD7E, 0x7422168EA73406D7, 0xB916966033901E57, 0xD9E5E32FFF4A947E, 0xFB1D5E5E8F7A588D,
+					0xD7144657B67B8575, 0x1B7956889A1E1241, 0x5ED442368C52A0D3, 0xF317B5FC1B92F559, 0xC384074C6A1387C3, 0x6AD39FC9DDFE7CDF, 0x4288F70F88A64D58, 0xB814847F0B4FED20,
+					0xE8440A4643DB07E5, 0xF79BC3FDE18F133F, 0x8B8ADCB339049B7C, 0x35DDDE7F8A45A2EF, 0x8405AEFB24756F44, 0xAC66EA43D3B3071F, 0x3E6DF6624DAD54D4, 0x43114A9A8CC5AF70,
+					0x2FAC4D393807426D, 0xF3164B12C04FE92D, 0xA333446F8FC25556, 0x443DFA6B8067E997, 0x1775E1221F805525, 0x1C4B1C9A5B383C77, 0xC7155D36BACEC6D2, 0x713ED483883BADFF,
+					0x67BD11AEE4E5BC7F, 0x897723AA2EF7D4A5, 0x7A112142551C8464, 0x56F7EC62A5EBC16D, 0x6316401CDDC5156B, 0xEDD1EB565EEFD1C7, 0xA0B68C6EDA018B7E, 0x51DCEC159E52E6BB,
+					0x3F33F01081681DEF, 0x17BA67A508182FA0, 0xDF5EC820500E92C6, 0xC4FEE13F78C5D6DB, 0x65E4AC77F941120C, 0x2334D7A8278AC3AA, 0x85A3A2EA0E64B884, 0xDD5664A47F483ACC,
+					0xEBA33C274744372C, 0x95021C56275EC43C, 0x50A0A987B619E64C, 0x662006F997AED8E5, 0xE3F652796DAEC8CA, 0x22C30BBA80168661, 0x8EBEABD952F29119, 0xA0E86B15036B8051,
+					0x3010B198632C39B2, 0x3DDCF55D2E4B9F53, 0xB8FBA0D5CB820E02, 0x84C58AD101E8E3AE, 0x6329290959C118D9, 0x76C933C7BA648CD5, 0x5BB706E616B51A63, 0x84E02D1E0BF26749,
+					0x0E76F673979F8428, 0x58980BA3191BCEA9, 0xC5098389ED15ADC3, 0xC07F417155607558, 0x8E82332874042245, 0xABFE37437719FDB6, 0x8CD128D067A71669, 0x9DF9A9DEB26BC8E9,
+					0x0B389DEDDACD44F5, 0x4A33427D03D242B6, 0x86D9E7351905C2F6, 0x743FCE3CAE9D91F1, 0xE5822DB5B24B9349, 0xF1E380C7F9948102, 0x00E6AA1CB03DB77B, 0x58ECDC62D6B4AEDA,
+					0x09170780473D1036, 0x1167607FCEA49BE2, 0x3B7E99EF4E14E64C, 0xC096F4CA5F8D3A4E, 0x09EF42989F02AC2A, 0x189631059A604EFC, 0x1197367A9D8519AC, 0x07D438F48BDBED74,
+					0x0AAC9753B4D4ACDC, 0x38339AFC80DC5BCB, 0xCB64D29BF52A0C31, 0xD521DD5121E401B9, 0x52025154A1EF2B38, 0x62D5AB3D2AEC008C, 0x6A55B35080469D54, 0xA1B8A0B4022966F5,
+					0x5ABA6BA751DDE8EC, 0x154E2F790C196804, 0x5A6D06EA39A15464, 0x9839D600464E3860, 0x5D7EB4C63F12CFCD, 0xB04F5432E79AEA9C, 0x0FC6941034EB5E07, 0xE98512415F4482B3,
+					0x4DFFDDC626F034C5, 0xC04B493410942EE9, 0xDE9CD35C7E403162, 0x423CA4D08279A879, 0x0A11A1E4C4DA39AB, 0x5DC5222FD071453B, 0xB1E510FA6BDAB538, 0x404063BB9C7D493B,
+					0x8BF2A21E7C00E992, 0xE961769A174C200F, 0xA61D42E381978A58, 0x435FFD5BEF5877D4, 0x79EBB4C037DECC11, 0x261031B5D9DC0927, 0x92B58B6EECBB8AE2, 0x0D1F4CCAE06EC422,
+					0xC37A0E28130E9D60, 0xFF37B73452DAF237, 0x26D872360732C5DB, 0x95A85A23F87F4ABF, 0x1EF836DE7D643A43, 0xFAEF82E2A075D88C, 0xC1EE2C0C742A7652, 0x57A0ED65490F433C,
+					0x338298C95982346F, 0xC38A2B76598320CB, 0xEA9B2263D84B7CF7, 0x25DD2BAEC3FB9684, 0x7E2A501CACF314A0, 0x81830E04661EB8D9, 0x06A6940CA08135F4, 0x142A4F3FFC6B9B98,
+					0x9872F9C59FE9CF8D, 0xA3CB1A5144F96C6B, 0x38021CD6296C9DED, 0x4151289F9F90B463, 0x946BEE838777A445, 0x5F9F263EEAC66C02, 0x1973936787365E10, 0x7700EAB3F58E3B48,
+					0x3DDE140188E48EE9, 0xA574D7662453433E, 0x53F4E18A0D284748, 0x838952ABB21104C7, 0x608EC8DA6D6A44CB, 0x33338A6A68EB9F53, 0x6940A1C86083EB07, 0x313528B1878B5C42,
+					0xD2ED0C485B32EBB3, 0x8D516915E2D2E800, 0x510FFC2331144F89, 0xE3C4CBE8C336E06F, 0xFA3B05445618551A, 0xB691EBBDCA473603, 0x5BE29416F2C2DB9A, 0xB7851C9F9ED624DF,
+					0x024FBA7DD3E1FEB5, 0xA0DD9A024E283E0B, 0x1A4A6BD276B9B0A0, 0x170B26BF0785A40E, 0x749C0B5E7BB64153, 0xD30B92D0E59B0CA9, 0x1CE7B08BB6CACE24, 0x8237584BC3BD549E,
+					0x71452E108869FA34, 0xA0E9C9C0CF1C3D9A, 0x36473061ECAE8E3B, 0x790DDE214F315761, 0xB767000CF605F594, 0xD9999CD53345460B, 0xEE1CB69DB13BB20B, 0xF8056979CDB18D47,
+					0xFA17AA4871514996, 0x01D5115F82E458A4, 0x01022E0AE2331B7A, 0x101ABFCD8A8D926D, 0x12ADF871EAF875CA, 0x469F7B0A1A21A232, 0xDB9141062D31B3E6, 0xFD1453E80257D048,
+					0x2558062E42C46CD8, 0x9786E56C7919380A, 0x2D2382303D543E0D, 0x197CE01530124B97, 0xC3E44ADD819DE8AB, 0xB4A76CE2D0E9CF1A, 0x684BA6CBDFC6656E, 0xFB35E77E1452626C,
+					0xE5AF9248F488E14F, 0xFDBAA1E49BA985B6, 0x41616E77A3263B6D, 0x179C6E959B97ECF4, 0xED588FFC38B17DD8, 0x24D0F87AE2CAFD18, 0x848FC24D48C0AC57, 0xE6E7AE3FD0F8A282,
+					0x1B18366D493EF3A8, 0x8E7BC8BB8F8262D6, 0x3B7BB820C9FA4A60, 0xDFCF065020C93456, 0x3D9708161C116E88, 0xFE081AE6218398EB, 0x4976B5A5BF514228, 0xCF9874B4694DB485,
+					0x2D350E8AEDBABCE7, 0x62D2F3CC67235252, 0xE9C2797E689B664E, 0xC2A9C6344C58F737, 0x413C1D181922CC3B, 0xEE492364D0760E46, 0x6408C8041BE05C60, 0xCC999424853F6B43,
+					0xB035BC47A04F2B23, 0xF89082E0139626F5, 0x49CB9DFF295E611E, 0x45BB527F228D82AB, 0x8A023C14C812642A, 0xE086A66D599DFC08, 0x3614AADD4ECA075C, 0xEA6E5302EF36E50F,
+					0xF5A129E5E80F70FF, 0x42921FB24E9A4B42, 0xBE450ED69ACE16E2, 0x049E86D7E2A2413A, 0x61AF672E451DC327, 0x1D942923F5D37F51, 0xF9F63164069EE179, 0xA58BC4183B448153,
+					0xEED8236C49B4F472, 0x31BA539A101DAFC0, 0x0743264F49EBFE24, 0xC89ACBE782ACA0A8, 0x4BA4923C53760D65, 0x86A3900F6757C05A, 0x81B559704921B06F, 0x0CE4DE84E507ED7C,
+					0x5FB19F3AF71C4665, 0x4653747FDD35C42D, 0x87A2C4F78F81424C, 0xDDA69D9D3C13FD89, 0x653A4999DD1C9D2B, 0x9DE765D59E3F0218, 0xA7CD9C13AD609FAF, 0x3FF78A1CA9970183,
+					0x644B3AF81DD9D0A0, 0xFC8672706D754270, 0x3FAC40769896585D, 0x890B32DBD7E13141, 0x9A38D9ACF475DE2C, 0xCE4B7432AF4A9588, 0xA90DB90F709B6F78, 0x0D450B248A16DE02,
+					0xAD52597714847D5C, 0x9C103C68A5D772EE, 0xA6D946FC3FC10C68, 0x741713A03AE53572, 0xBA009773F2AED9B3, 0x0FFF015C9B8BD25F, 0x1903A9B8ED4166E4, 0x7E6B928097E6EB8F,
+					0xC7DB24BD178F9523, 0x898598805F6BDCE4, 0xD154B71C82B1BEA2, 0x4ACFECE8860B5E5F, 0xFBAEC5A3284CF058, 0xBA2BA0CE58308618, 0x758BDD04039559C1, 0x2B04D362616A3124,
+					0x34680A6C6A0E30FC, 0x06B7BC9FD2445141, 0xFF286ABCCDB890E9, 0x011F4764934E4E94, 0x17F8717012A7402A, 0x043E38674AC63D0D, 0x21E4B156707CA130, 0x83C82FCECC6009D0,
+					0xBF38EE33EB5471DE, 0x9A9BDB8194707653, 0x6CA50866DC0411C3, 0xF7C1D81513ADBB56, 0x1718FAC80E9857FB, 0x411326369E7CF54C, 0x0384B42161527CC4, 0xEB53EC479A1DA425,
+					0x0880F1C5877483A1, 0x2C51C77FA13BF30E, 0x97B6FE0EB73FC398, 0x23614063D98C5022, 0xE7424D56E418911F, 0x97D937D61D7B28F0, 0x3C1030A22255FBDE, 0x8AB671E57A4B4B67,
+					0xF8AC7C8BB3D87519, 0x2C6BB5FBD56E0BB1, 0x7C4EE62918304C4E, 0x12FE49A8B3831A47, 0x47BD4131B6699B68, 0x18FC6F0C4F3D692A, 0xAF51A0E324F4BD74, 0xD392BDF74EC88833,
+					0x2C6A9072EC78F650, 0x23401C5EB488AA73, 0x5CE95152FB785737, 0xB9BE4E1A3C677A01, 0xBABB35E9F9926D09, 0xDF3D5A3474DE4B0E, 0xC7FDF875E1279D8B, 0x1AC788509DE267C5,
+					0xA6DCB5111611A28D, 0xF1FBC895E613DA58, 0x4E306A6CD51D3640, 0x13AAD407D3440638, 0x9CD756EAEA580951, 0x08BC25DEC68A8249, 0x11EF48A7ECCFFBB7, 0xF5495FE6948454A7,
+					0x6F565DE647196B6A, 0xBDE8ACE99918EB9C, 0x5A14F670E8E68D61, 0xA3739F85051EEACF, 0xCD98741EE081B77C, 0x41A62C6A09AE3A24, 0x4A3A37574C21D0C1, 0x16C73FD8F8D0F6BD,
+					0xA8C8CAA9AEA2BC1D, 0x6373450E8B0BECF6, 0xC6833DEE80A6E6F3, 0x5655EC6B9F493F80, 0x5D33CB7074B7279F, 0x5F9A74590E2C3BEF, 0xFF02658EADD885B7, 0x1DB859B3392D46DF,
+					0xEE7FE422C5B2B247, 0x6DDEBFA8D467C4EB, 0x5D3266633F7CF130, 0x0126FDA8D6BD5565, 0xBAD311726CC115E1, 0xAD4A0E62D33205FA, 0xA9429F33B0928422, 0x0E332E934143333B,
+					0xB831E426F75E53D9, 0x65C897A07D0F31AD, 0x1FF6358A8DD0B0AB, 0x6F7A2B80157E6E54, 0x5E185C74BEAA9E65, 0x1FAD80AAA115E4DF, 0x3C826C10B10F9172, 0x839BDEEFB154B440,
+					0x7316669B5BA35B5B, 0xAFB70D4490DB53D1, 0xB514CE23313675AD, 0xBA909ED3BDDBE7AA, 0xAD9444FC4D8C2063, 0x02B0BAE2C2E73E6C, 0x000F67233A49A6D7, 0x7AB89F8D86708C98,
+					0x719A7C65C2461145, 0xA5BCC908D877058C, 0x6058457453F186C6, 0x3BD3606966CAF4CB, 0x94AF7E77F3F29B5D, 0x16038CEE8A598511, 0xD8B6F8B69438AEFD, 0x8B4FDDF2DF89FBD3,
+					0x6D236EAE82950B27, 0xE0F8E97F7F21AE11, 0xA60E26A77F670C80, 0x8E43E8E31E64B43D, 0x2332BEF798F2F306, 0x551B993AC5844AF1, 0x01A780334BA68E17, 0xAE1D07C2E715F5D9,
+					0x64854A2C395FC7EC, 0x2A08CD7BE48D4CB8, 0xC9ED900225352D64, 0x00B651BB461CEA9F, 0xF03C245D9FCD66AE, 0x71FF532BDDBD688A, 0x15A1C612E80F7164, 0x548C2C482B05459B,
+					0x7076FD7F3311EB1A, 0x7039638BFBC897CC, 0x20E6B0C1BA56B42B, 0x261AAAB509858043, 0x26219800CF02BD71, 0xE838277D4E39202D, 0x88C7968CBD622B21, 0x0E1280C7837BA651,
+					0x75FA5CEE9B89B9F3, 0xBDFDFC1E568B2DEB, 0x23F65DD3CA0A4931, 0x7CDCE070DC5D7919, 0x5BE590560A13E6B2, 0x901EE8B8497EC398, 0x078FE164167F9EBA, 0x5848D60C5C89599D,
+					0xC206142370BECC0C, 0x26D761F72AE0E872, 0x45BFC1F35B49B29D, 0x9259C7A45123CF55, 0x503A6C6C2B45E885, 0xE27305DE509B2563, 0x65AFAB25377B8137, 0xF5A82E374AA3B718,
+					0x293DE384CD4188D4, 0xAE5A8922CF68903E, 0x3D4EE9266C45D13A, 0x8CE332A86A45FC48, 0x0568FE539101223B, 0x822F6F7B8A8C227A, 0x85AF60BD1813DEC2, 0x8956E0D0F99B56D3,
+					0x5D05ABA5858D2C0F, 0x101AE02B6F9AA8CE, 0xE0F1698539CA2365, 0x05D6A35C96B1F48F, 0x7EF687C7E9D158DE, 0xEE075BA6501B16C0, 0x4B7B684BFA4B6914, 0x243CED16522B1FC3,
+					0x9F1D9F83C7730473, 0x9DF1B21D77982914, 0x1FE0C38FEB800C3E, 0x4B08638767089AF8, 0xFD6C1A765831B433, 0x03F51DE3094BA8F0, 0x9E22A1313A89965A, 0x19D98A60F007DAA7,
+					0x4E58310E5DEF0D91, 0x1BB233BD058E52E8, 0x381B15DB30DA4FC6, 0xAF4CDB6A933E5516, 0x7353ADB0546493A7, 0x3B17638AEBA762F5, 0x683A3D5BDA4FCF3B, 0x78F15D7E00A1B67E,
+					0x64DE941A9A25A25B, 0x240E61861D59A735, 0xEBDD8E160DAB05D7, 0xE976B027699BD69E, 0x9F1E8515EB8817E6, 0xDCE8121321B73019, 0xE6BF6A453C6B62BF, 0x5EE6349AFB386B3A,
+					0xBAFCE3BA913C2DDB, 0x2BDF21A04B10CE1B, 0x4736A17D3920B881, 0x1647E75719221B90, 0x98C690AA4C45E39F, 0xEF36B576207F00E9, 0x05A31DAC9007E6D1, 0xBE3751D623F97B9E,
+					0xA7B2D2335BF98657, 0xAA00E545DEDEF108, 0x3ED6B0C9FBB8AC73, 0x12D1D94369D4FFE5, 0xDF1A5C30D9DE84D0, 0x3D22D46CC49C69C4, 0xC447012EBE209800, 0x0EDD91AFC182F568,
+					0xE37D31C3B388B086, 0xAC3501DC0DDFBC48, 0x1544AC8A6E6FBA80, 0xDC2EDAB77CDC0EEC, 0x2C07A866BB663456, 0xB05F78AAA5F538F4, 0xB60045C3933371DB, 0xDAC6EFA3BE36156B,
+					0x80ED0F3601F65331, 0xA3D0017D2FB1ACA8, 0xA8E2C167A3913F71, 0x36BFB58EACA09FF4, 0xE7D2283CDC339618, 0x6FA139F0C1B6DBB2, 0xC76FB6E86414D812, 0x6681EA4C310D1CBA,
+					0x5F1464F4E09C20FF, 0xBD08A9E5EA634A72, 0x23D75F2C7E832950, 0xC8602E1295CEA251, 0x95B37D159761B7E3, 0xA378CA8CA848A69E, 0x465A90DB1B8EB9A1, 0x92A228850C5C1DC4,
+					0x324301EEB1F6D6E8, 0xF20C74F310DC9B1B, 0x5311D0EF0F1BB0A2, 0x00FDAB0C61BCCB0F, 0xD8563A1D09651397, 0x0288D282E6F14887, 0xF5E8844DFF8E7D95, 0xE57E342D01B3F35B,
+					0x1BC13A6F20A05C5F, 0x21279C1203433D39, 0x8EB09A2B8A31C9CF, 0x511459D4A2A0766E, 0x6B95C3FE71E5523F, 0xA815E663B8202055, 0x242DEFC48FA3A835, 0x95D85967F3AFFFD6,
+					0x928DEAC658D30101, 0xC81B151BC6CBFA6A, 0x230AD0A49E1BE0E9, 0x4CF96CEBD945E1EC, 0x00049AB26E1E9927, 0x7CC80FC2791E8EA7, 0x9FDCA4EBE1296ACE, 0x62FAEF635B91FCB5,
+					0x5488963CEDAC5C8F, 0x25F133C1BA3A1714, 0xAE4409450E7857FB, 0xF1C706E12AFEF481, 0xB09D931DD971336B, 0x3818AB0474068C77, 0xF8C46BD5E4364DAD, 0x09C3C3FFB8C6178C,
+					0x309DBCA87CD7F445, 0x487D26BFC0F0398B, 0xF814AE2D53FE68D1, 0xD0EDD1B5CE0C73D4, 0x0D57BD09371E556E, 0xF3539913F8F60639, 0x82F4C440A4AE2B94, 0x25F3F4B426AFD993,
+					0x8AD9F6C00F7671AA, 0x169A32C0317F9E48, 0x0DD4AE8F5F125096, 0xB311FF59C52C6546, 0xE9F4FBCED5938546, 0x1AFA51CD8FB06716, 0x7D83FA42210423F3, 0xBB3D3B956C77BF64,
+					0xCD53F659AB6953E4, 0x5616EA27E21E30D4, 0x534ED39380B239E4, 0xDD9BB18ED848C88A, 0x9E36DE858A98BE6B, 0xFAB16AE2B3AA6EF2, 0x0E0003DE2A3A6DC3, 0xA9449A7E1309D8F8,
+					0x0673B084F2370C63, 0x76F48A597875EAA2, 0xBE52375379B88373, 0x6014B422E3AA5273, 0x074BADD027CE4301, 0x9BCA14082DB02282, 0x5E175047B5512B2F, 0x4CFCA186B2783888,
+					0x08C94C2597BCA751, 0xB7CEB394E6DC1341, 0xECDAB6D42FA54B13, 0x3434DB14C8A05AD8, 0xF69F8CD30A6FD910, 0xD374F256A0FAF483, 0x62D495AD6FC055F3, 0x21D34D9E1461C741,
+					0xD4730965B750040C, 0x3015D74FD298C3B4, 0xFD5DCD9431674FFC, 0xC50AE8456584F4A7, 0xF8CC93740B2C374C, 0x86F2807D4D6B0B2E, 0xB2FE0104FE4CA7AA, 0x6498FF9C34E95DC8,
+					0xACD8F3667A05B7AB, 0x61AB884269172144, 0xCBD0AC31F34E58E7, 0xF9BF3BE47CCE1B11, 0xF383726631D49DD5, 0xDA246B6D8CC4273D, 0x348EBC6E8A03CA53, 0x74D6E6FCAC04CF8C,
+					0x0E3BF0E38F861340, 0x330A3F082524FB50, 0x73F2B79408145D8F, 0xB794C9C50470B72E, 0xBDAF98A80901429E, 0x5ABAF79E9932D1E2, 0x14287604C9CDD19F, 0xCBB588D6B6BC22B6,
+					0x5D570E5544AD0053, 0x91AEC4F3607DD7C6, 0xA8847C17E73C7D33, 0x57E9A5F666ED3B0D, 0x50F48FECD4D684E8, 0xB274526E808B5E2E, 0x780D0D669DEC66C4, 0x1334A94F204102AB,
+					0xEED2A7693541E051, 0x04E12419E9B9CBE7, 0x8F75C1A1BED660B7, 0x7E62963A32B45A70, 0xA1A9D9A629FCC14D, 0xE485C8F3775DCBCD, 0x747385B7A068B587, 0xF8BC705D7D7D5984,
+					0x2EAFF8BA75568393, 0x995DB89C5F360734, 0x5E919CE7FF7145B5, 0xDE77CFBFEAED9B3E, 0x18CEB52514BA99E4, 0x7721287EAEF54AA5, 0x5E9FCEFF5AF58FF8, 0xCAA3C3C7263BD06A,
+					0xF1F3316E1053D3C7, 0x92CD358B8F565F33, 0x0CC4E900CB4F3426, 0x9EAFC44325EAF3F1, 0xE5FCA13B985970B6, 0x24B305B1BBE43275, 0x3624550D3838F142, 0x59BC1747569559B4,
+					0x771F113D32B1C195, 0x6BD27AE3B564D688, 0xE586BD849A1EDE23, 0x1E5DBA11BEB9AAE6, 0xEBCC743F35DA9907, 0x48D89C6E5B2F1F1E, 0x46F4EFF545D08FC1, 0x08984B4F586BAECE,
+					0x2677D1BA26C6C80F, 0x71F1BC5E7A0E08C9, 0x67AED994D52AA3BD, 0x975F9B75AA6D544B, 0x603EBA95A3AC348F, 0x0A4AEDC33105597E, 0x8A77949339A37E85, 0x2BC5CCC90B5F256F,
+					0xFE38407116CFB7D9, 0xF4F5732DB3C2C20F, 0x9527B392DA4D5E05, 0x5A22866A149A395C, 0x5B51E38E51AC2930, 0xCAD7B83E8BDC658F, 0x2FC5D1C70BBB5A1F, 0x267662F8FA70283F,
+					0x2934939E6F032B60, 0x9C337871F4F5F140, 0x3D557703A9318A8F, 0x33C13B2DD7848090, 0x95538820CED5CC06, 0x5571A74AAEA47BB5, 0xF0BE329831BFBADD, 0xBC93E2883AE70F06,
+					0x737F751C95095367, 0x2ADADD401B9FAD45, 0xB4114DE2A3F63841, 0xAE213A4FB3615F80, 0x203DA8EA8D2A2785, 0xAFE4B818A48206FD, 0x838D4FBB38DBF9F3, 0x7401C70225D65FFB,
+					0x2D4A2F875EE62CE2, 0x5F6C77BB4294589B, 0x9CE269489A26BC23, 0x469CF5C9E7A47C50, 0x09CCA16AE32E762E, 0xE0E272A3F845D625, 0x2FF8EF9675DF9EDA, 0x31A8F9772A65EA6E,
+					0x12C84989E660B926, 0xF4D39FFE07EEF84F, 0x23E083926E325C25, 0x5DC756C4A36CC9D8, 0x576ECA188451DB4F, 0xD2EEC030D6DB4AAB, 0x614C00CB3DDAA29B, 0x376159E89B0C456E,
+					0x394B4FA1BA828ECD, 0xCE7261C7A6376E87, 0x7ACC07F187FF6A84, 0x5A4F14DFB31BF274, 0xF36DA74B8FC8121D, 0xEB54A6E6937F437F, 0x3947490C209DB8FB, 0xE1D1DD4A9B9793C3,
+					0x71EC6AED1A99E9B6, 0x645223952401D8F5, 0x5F2887D8E399C816, 0x1CB6F3941A30EFC7, 0xF82E0A9C359493EE, 0x47EAED78369A00EC, 0x58800EAF9731067D, 0xB1E8C34D2371CA61,
+					0x74E49670478DC800, 0xB1DDCCC0ACB6371A, 0x7AAC78E64591A727, 0x6BD170705D92A168, 0x2E2BBBAB52E9CF2A, 0x8C8F429865C7EF78, 0xE2C5CBF96E7262ED, 0x977A8A955EB16326,
+					0x790285E736338C38, 0x575D1AEF27878726, 0x6F3B99A33910E1A2, 0x4DFB894644A05346, 0xDD78899B79B54E11, 0x53520B5B49E23DC0, 0x7582D1D29846D695, 0x61CA6AE135F32D13,
+					0x50F2F68900EA3717, 0x4F1D458DB0711DE6, 0x865EBC921638398C, 0xBC9654FACC26C69D, 0xDBBA4F5FD3D3383F, 0xF3925C6EC05C4334, 0xD67947FA2EDE649E, 0x1E5A57F85C59BE10,
+					0x798B3DC5CC967672, 0xEDFD21721B8B2475, 0x578506D0AD89C4DF, 0x6A1D13279C2B7193, 0xC2E165319C0EF134, 0x17AFE14759E01A0C, 0x606C831E2419CE84, 0xE3764FDEC066DDE5,
+					0xDDAC4FE526859853, 0x70B2249C074DC293, 0xA52E351E5989A00A, 0x33FF93DFDD86C8A1, 0x1471BB95B038D24D, 0x96E4CB51243FB74F, 0xEC0390675FA21C17, 0x500B9B4800E4A3B0,
+					0x1B8BB63DBDBF10E1, 0x44C1B9668D09466E, 0xFD89F7D1070834CD, 0x8465C81DB8763E89, 0xA86E19FF6931D7FF, 0x03ADD8E5A8F84CF8, 0xFA570DB836E6837E, 0x9E2B21DCFCB5B7F3,
+					0xE5301941ACD33970, 0xACC144758A59B7CE, 0x91A008EA8191838B, 0x243AE81D1C230934, 0x8DF6B302D4A6FC4A, 0xB54367D27DFBFF86, 0x1E3AC9A5B4D7C752, 0x929C8349933C7F1F,
+					0x61C2FBBE544B4432, 0xEF4B74642A383823, 0xBBA9556F82967E6C, 0xC1F74A81070EEB39, 0xA4A35F345AD4C03D, 0x2DC9C85EBEE82A95, 0xF12DB0D2A1A06748, 0xC525AB40CF3907CA,
+					0x3632E1E8EADD7050, 0x8FE04B5116283E47, 0x5C0CB01E9D794956, 0x2BF849D518A78C13, 0xF0445C1AFB86ECFB, 0xEA2881859B5B4423, 0x97D7D740AC4F7BFD, 0x17D83F9194026948,
+					0xFA7C69318E8F4A3D, 0xD1563DD0F20C1817, 0x5295805E7060E20E, 0x913D9E194B056158, 0x37079B6BC5E1750F, 0x92614C376E3509CC, 0x326558BF8C2CEDF7, 0x4B03EA45634318ED,
+					0xE430D65BE62DA1B6, 0x332898050DAB729F, 0xED43DB9AFADBD93B, 0xCEE955E043EF052F, 0x1975C6D1566EB629, 0xDE05B0FFA1EE82DB, 0x0149540E943AF5BB, 0xF9BC1513ADBE0DA7,
+					0x2098D7ECDBF56A8B, 0x7527F1FAA1D3997A, 0xF82C9A1A32A0E2DD, 0x3F0E2E075C054AD3, 0x3FA793D98F5C87FB, 0x69AFA219237ECF56, 0xD9789887241B49A1, 0x4F78F31B40D0A5BB,
+					0x68E2285C4163C0FD, 0x294501E88CD09A0B, 0x2064B267215F885D, 0x47CCA0AC24B367B1, 0x7B903F63BB925E40, 0x269D0328B4732EBA, 0xE8105F5E15FB4362, 0x39510F380B9318B4,
+					0xEDDDC3A7FD7EF9A6, 0x2A9EC10308795DBC, 0xAE6D3407E8E18D5F, 0x29C09217899F883F, 0xC7023E7CBD033E36, 0xEC97834F2DB76353, 0xF45689169E92750D, 0x7DBD527C61CA8499,
+					0xB8DEFF5FF01F75F7, 0xAD915536F321C1EC, 0x2D2264831EC6390D, 0x331727E13D8A5704, 0x0624C4B3DE27A524, 0xC92F1996AA477D9E, 0x22C5829F6D3491D5, 0xFB648FB791707EFC,
+					0x70E3D9048260030C, 0x50AB40D630E82C0E, 0xD2BBDC127F2CB0A8, 0xD0E03AB5B384A300, 0xF402D3B981BE6A74, 0xA766431F0C37C286, 0x5B9DCE20D97C97E3, 0x8ABCB28A4D731434,
+					0x956487FD5FC246B0, 0x72F41790CE597890, 0xE14E98375C0235FE, 0xC53B2C6787DF4918, 0xF14B14DB9E802D4D, 0xDFC7D1C362810C85, 0x89F8411EB3F7C432, 0x67BBE2135ED54D25,
+					0xB7F948F6ABFD0F3D, 0x1DF29B484401974F, 0x8CDCC42A914E5710, 0xAF445273A644A139, 0xCB81A059C751DB37, 0xD69FF5ABACD4E451, 0x2A252CE688B4DB57, 0xF14597E243B6F2AC,
+					0x8A1A7C7C632004D5, 0xF23403DE5908CE43, 0x64DE278702785C93, 0x8143A9D34812D6B3, 0x68D7F57DA37D3315, 0x0069F812B402464E, 0xAC2537FF65716E08, 0xDAFC3480D0A751F6,
+					0x0BBC25995C8815EB, 0x08A8A23DC9E5328F, 0x994488C4EF306E1E, 0x9F3FCDB53CD6C4D3, 0x22FEA6D096A9B84C, 0xC4E97D697FDDABAE, 0x937A7F5AFACD1A51, 0xA5BA12DABAF3EEF4,
+					0x45B0D23CD80DC632, 0xA67C8B272098E12D, 0x6B4B97685C176AA4, 0x360131238FA6B537, 0xBD7342EEDFE2155C, 0x3E2EA2646D8C9A31, 0x2E9B589F3A6C3E46, 0x750E7005105317AA,
+					0x326B056619CE0628, 0xC322E34D68955C7F, 0x350325569C19ACD0, 0x96DA9F25A0B493DA, 0x7331EC24646E6AE4, 0xA60ADB9774C6FE0B, 0xA306484DAB244B18, 0x6C15E9C40F357A72,
+					0x459E8FC7AFAFE163, 0x301199D4722256D4, 0xBBF51652F12F232F, 0x46290D58D5F12AB9, 0x92D6EB14989B8A04, 0xD40A7EBF99456382, 0x6B43B3F1D075123B, 0x51E1668BD66E2615,
+					0x5E09E238A6DA8808, 0x9DFB9F94A6129771, 0xB9EF73A69F4B4C83, 0x1EA4622CCCCDB9CD, 0x5E2638E1B7438401, 0xD7A532E2BDA4D8B8, 0x4533608E5A922026, 0x4F3B13A24A8AAD6D,
+					0x9F173EEBD4788AAE, 0xD2733EBAB53F5C8B, 0xBA049E493C24CE15, 0xA4DB60F4AB59290E, 0x9BF8662A2A58153E, 0xC7083D2F18CADC46, 0xDF4FF59750C01B37, 0x48D9C3FF66EDB4C9,
+					0x09E7D4DFA213CF23, 0xC97C1A9D4CC8577E, 0x3FBD42B76BD14527, 0xD5F46899B18CA571, 0xBF36F40B250F6EB2, 0xC4B82E4C4393B9FC, 0x19436BE27E749AEF, 0xDDE72439FCD87857,
+					0xE2DC0E4838AD2EA5, 0x2F36EEDEE5530E8B, 0x9C44285E31621A02, 0xC78252294D01DA43, 0xFEAA830E53F4746B, 0xBE1C170B9963EB41, 0xA3EB7F783C028A85, 0x13EB5FF2CBE03731,
+					0x908A5338492F299B, 0xCEF3E63103E3F641, 0x0F79884BD1083E0E, 0x936747A5E1154118, 0x4DC94C710DAA7C20, 0x3C45B1FB989481F1, 0x1F7234E1BF75AF25, 0xEE5A4F3DF7642476,
+					0xBC01707659DC87CB, 0xBF8B449FA2517B2D, 0x6C8D8C7D0C341BAD, 0x25C2A31C1C644FF9, 0x4A5F13B1A2603306, 0x490303EB61A33B09, 0xF08C92310E81CC5C, 0x5843BCFE2CE02DEC,
+					0x1562C8EC15EF23AB, 0xC8B317DD7E1C57A1, 0x78371A84FD39946F, 0xA434235AB19A6475, 0x92C081A98487E800, 0xECE905B32B8F0499, 0x98A5FBC39D310A1C, 0x75280C8F35279FE4,
+					0x27C1D9EE997C8EBA, 0xF2EBD961C5E7CE34, 0x58593D2545B6CBF9, 0x3F1893899FFFDF3D, 0x42B7C8DA10D7F257, 0x84A4C1800317233C, 0xEE3071C545547C2D, 0xDA5E8D243BFAB4E8,
+					0x3F221EBA9E41CF63, 0x3AF02D73B8DB2B80, 0x5009C3F1F5B36B47, 0xDF46E5E57E272CCA, 0x53C99A08229481C9, 0x2973D88B94BB8FA7, 0x8FF620276B9F39FA, 0x410251FA993BAD84,
+					0xBB0E4D7EC4FF98A8, 0x4714E70C6C04E201, 0x2457D1043BC721C0, 0xA2D36E62A76275C6, 0xE634E8FDEBDDDD43, 0xDC0EC6C0ACCF9B06, 0xA7F6D8B6C9180C1E, 0x4D7ADB3CC80B2A56,
+					0xA5B28E5F17F9DF12, 0x9D2C31D46C8AAB53, 0x5A91300BA3902D96, 0xCFB3D36D0C03D95B, 0xDED1EE6C318EA586, 0xF23558E12C396BCC, 0x16B8A57481B77DF9, 0xCDA76E5F712EEF03,
+					0x2017DCB321565BC0, 0xEC77629E957A970C, 0x9ECC2F8AFC655D32, 0x5DB1ABA545658A31, 0x7A5F513804347DCF, 0x6A3ACAA041B7E1C3, 0x3EA2D0CCF84FA344, 0xD988614EECEA9981,
+					0xDD3BB1DE21E67F29, 0x86C573F1FA4A2B50, 0xD18A3B80AC705755, 0xC3DF064B466E0DAF, 0x78BC377ACDC9DE9B, 0x138D0F478D05E841, 0x6476E391064D4FFF, 0x7B78E85303C6B2F5,
+					0xAAF35DC9DF788411, 0x7736C62FD57E9EE1, 0x4F6F26B2946C4722, 0x597285A4238E1EE3, 0x2439A4C3B2FA5FFD, 0x3F29934A8D1BEF19, 0xECA2FD42EC274E56, 0x046B9C6E352440B3,
+					0xBE6A8C604535A535, 0x8589F29FCB855701, 0xC556127850343F3A, 0xE8AD0C08C25C1525, 0x9ABBF5796A6317AD, 0x086F922061BF99B8, 0x7CD0CE2D460734E8, 0xCE6807258E263720,
+					0xF0822EFAF740E22D, 0xE249FC5FEEC79C1E, 0xA4A5E1B8D6F01B5D, 0x192B187E479E81F6, 0xF46496D518AF8481, 0xA6E8DBD6D3BCDD23, 0x15A0992795B5400C, 0xD26B95AAD7C1C900,
+					0xD902B83842DFFB35, 0xDD79377F67817CA4, 0x204E72FF567E8018, 0x1589DAF0D4F30660, 0xBFEC967E3B673964, 0xCAC7929CE6F2167D, 0x32FBC2F2546206F0, 0x2F9488F1E06F9E8F,
+					0xC15486EFF1EB707E, 0x3CC73DAD0F838D94, 0x05DC96C221487DC0, 0x883144A938875C8E, 0xF8C071A2790D4D55, 0x51B6F11B127B08B9, 0xFB5D1149C6176919, 0x120D621571AB4038,
+					0x63B206058A88A1F0, 0xFB02807DDD6D4CD1, 0x4AB98DDF14013E83, 0x3E8ECE3D4F9A27C4, 0x607196A81F4FFB80, 0xBD05E210B36E44A9, 0x6BAA4798D03BEA46, 0x559EC18D21C68A3C,
+					0x2F32ABD8AA9ED5F5, 0xF5F3D905841589C7, 0xAAF0442F9C5DFC98, 0x054CC97372A59F89, 0x7E039158ECCE868A, 0x19C1E2C042E1159A, 0x63E2918244669507, 0x6F3CA95E65F1A308,
+					0xA39D22FD9A606CF0, 0x2402C9E197076EA0, 0xDF33398CE14DFFB4, 0x98E3B979623BB00A, 0x9EAE99905E1516C1, 0x257EBCE849E2C4A7, 0x35FD40A2DE07E6BE, 0x1DF84B71C342D772,
+					0x3D28DE37FA55A070, 0xA41FED8990BB391A, 0x5C35868292F45C96, 0xC27196F0161D436D, 0x72284F385CD1AAC5, 0x3DDBE854C4219E6B, 0x663314A59C09A067, 0x88194245C3A70FD5,
+					0xF99B552051C178B3, 0x2C1E91451DC1B414, 0x8003C67C129C7B74, 0x6F44CE2FD2E9F113, 0x80F2A8FE6F3F2B09, 0xEFF1CF97E4CF0217, 0xBE11698287A8AC34, 0x5E65B9D0332EA07A,
+					0x8A758A431C7A3E44, 0x6628C15AE8C80807, 0xF9FB5FAC17214072, 0xEC5231883754FE29, 0x9C1C7B5A27F8CE32, 0xB4DE29FE4814C99D, 0x7A8921CAA2B33258, 0x11854BAB518A55F3,
+					0x16AB08DF89BE0292, 0xB8654CF150255AF4, 0x7764C33192382410, 0x6833262929618E07, 0x98C156F31543CAA3, 0x61ACC9FF17759101, 0x27F525496309F779, 0xF0751B6B2FBD3D5B,
+					0xFD2CA4220BA3B6CA, 0xB118E15DC56E1560, 0x809BCAF01305F74C, 0xA2E483F11FF54CE5, 0xB77DD874ADF570B2, 0xF01EFA2782B117DA, 0xA8F4857C4372B86F, 0x586AF042E43B2A01,
+					0x3D1ADCD20BD3A635, 0x2C1E70A483D999A6, 0x5601B3B902D18C23, 0x46551E1EC8EBC921, 0xD1C5D6E93CBBAC36, 0x461C7DF529E00A90, 0xE77710CB7C908936, 0xFCF62E9945FABCE1,
+					0x532A26987CC2FC3B, 0x007088D9033854AD, 0xBA232E09B944A2DC, 0xABD874F8F0A3D513, 0x094E4BE4A9D1E441, 0xBA67B91E0213333A, 0xBEB89F7AAA4E34C6, 0xCB172B567EA966C4,
+					0xEE26F0BA40C3601D, 0x2A6B7B24C09622B7, 0x487376D2842EE85A, 0x4529640FD4AAA69B, 0x1B6A24BF41BB1BC2, 0x26284133F393FED4, 0x2AB7D8E387D00787, 0x13A9FEC5DE8C199C,
+					0x5CEC81C79731C6A5, 0xD5F2A28FFB59E87E, 0x95564E39CF527AC8, 0x309026D8EEF1EA97, 0xD0B6F9FC0D779347, 0x84AE5BAEF5F5E53A, 0x68561264DDF3C4BD, 0x3A8C06CBDB63B576,
+					0x481933AE2D90017C, 0x731A8F7E50B99129, 0x9082FB7AED6C4286, 0xD995B3547808E544, 0x612BC76CDC8A91E4, 0x92DCAA6961BD5F5B, 0xB8721C4EC9EEE7CC, 0x022A5404C681D043,
+					0x7A7C0A8FDE9D53E5, 0xFEEC9AA1956424F9, 0x3EE40D15BE508574, 0x24952986D35B56BC, 0x5D48148A25C8892F, 0x785878E119FEFB78, 0xF1289DF382C2E521, 0x68972A7C5411799B,
+					0x3730DCEDF9F45EFB, 0xDCBE8F99DD3BCE10, 0xCD85B4D8B50834FC, 0x8DF4870D23A24941, 0x232AD6C28BA30179, 0x01D0D7F17DE65CA2, 0xED4F09AA8C2F36A2, 0xA78E9CD7AEAFCD14,
+					0x23D7C5EB8F54F23F, 0xCC7BA4D4262BAC3D, 0xDE480CAB1251A6CE, 0xAB0DBDAF33F8F4C1, 0xC145AB5A9E1B38F2, 0xAF79199638316486, 0x45E98A454B78AADB, 0x48CFBF7AAFEF0B93,
+					0x0FCB006D59A5695A, 0x2806B8371B66FA90, 0xD585A555B946D47B, 0x3528531CDF88BFEB, 0xC75CC52E84A7BA21, 0xD99A2E609F5FC676, 0xBD946E6A0A5350C5, 0x86643B8FB0A66CCD,
+					0xFF8A6FE22F1EE970, 0x81AC7B5E4F21C503, 0x5CE6D5994F82C116, 0x726B8894B587EB9F, 0xDC1EAEFFFDBD1087, 0x54B48769097B8844, 0x29738139DE291D66, 0x919175ADF50FB87B,
+					0xE3B93F4FC269C184, 0xB6AD3812935DDA50, 0x780C446A2F39D8FB, 0x93EC61565A212355, 0xC1C88CCAEDEC9BE7, 0x778A17D702394958, 0x5DE6B0965F81DFBE, 0x69A6D792299D0A6C,
+					0x1636240066264FF8, 0xA89C5B1B31F1A5F5, 0x72AD89504F6B69CF, 0x8F95A02A88DED26D, 0x41F950CB4312EF8D, 0x152CD04A8190DD2F, 0x24E78EBBA0746A1D, 0x82DE7EEFBDB157EE,
+					0x64D568E0ED7AEAE3, 0x5042E69A3DA2AAE8, 0x0C708FAC313C4BA6, 0x42BA937463FD439F, 0xD17D1CE9FC786043, 0xEC6BD329F6F7E32D, 0x9305FC8C03056E03, 0xC879CC9ADF0487CE,
+					0x564434CB2E3F3B4B, 0x56EA39A2CC7F6495, 0x8ED6756F8FF9A9D5, 0x9BE65F5853DE90B7, 0xC36FCF542B6571EE, 0x0DDB40D6C050ED33, 0xBAE07938129E35B9, 0x93714647C618C17A,
+					0x6C01BA49889B5CCA, 0xB65EEC427724C7D9, 0x1DEE4544CC4222E9, 0xAB1C606F9B935803, 0x9E4A74BBF72594CD, 0x55A029D12B534223, 0xCC13D8DEA79E9249, 0xDFA33E92192F6399,
+					0x4F396165E88E9DC7, 0xFD0E5E4D20798932, 0x11AED01E2C9B6933, 0x89CCC228648128D0, 0xC7478CF1DDE70079, 0xEA5BF4D70EF2B5FD, 0x3B3D600F7542EC4D, 0x05C71EF62087C0B4,
+					0x4D1AE1411D03804F, 0x2FB50F7593D12D92, 0x1607B68A1CEB0443, 0xB3D460D1E9B8C73F, 0x316DA07D5DA6B234, 0x70FDA44B137E9DEC, 0x17C375877234CBFC, 0xE5E3ED07111D14FA,
+					0x8509AA9B25EB3E5C, 0x6C4C1518E6D05A36, 0x38984223F5064C44, 0x55630DA3E9D91CBF, 0x5AC8172515E3CC13, 0x3402CF1595218584, 0xEA6D716EEF9A4C30, 0x209D2F637DC4CCFE,
+					0xD371F0669D4E16AB, 0xBF910AC2F917F4A4, 0xA916C312E6656C51, 0xD6B8571DE2DDAB81, 0xEE63FCF45856BD2C, 0xAD06DA5981832415, 0xB21124E5BA5ED9D9, 0x18C903FCF2D5C13B,
+					0x76EA8367401CC37D, 0x23B957681B38A0FA, 0xDF6F3B7AD205BD8D, 0xA3C40542A94708B6, 0xBB58839F8076230C, 0x49070FF24BB3D2B4, 0xD71CA53E1F5D1717, 0x0A9CD16E1F776602,
+					0x24F23AF31C5D0416, 0x1C2C6B6E64543AFE, 0x39EDABE41136FF34, 0x5C5A7C9FE208B167, 0xC24BA0F0A4AEE273, 0x2E2EF1930DFC18A6, 0xEDC33F91661683EF, 0xA231C124F7695A28,
+					0x75DBB5951954772E, 0xFA483E2A1882732D, 0xC3C7411ACC7A5EDD, 0x060AB9CE04A6103F, 0xFC7F8CA9868D6A61, 0xCD91A1064868F4E2, 0x7918D2DBA1DA3467, 0x6742B668F20CCE01,
+					0x216B3E63DF773A9A, 0xD98BF8C0A91520F1, 0x130C886D24CE2E77, 0x64DFBCB717977981, 0x62A30FF7A9B683C4, 0xE003AC6FEFBCD951, 0xC1B5846D1BB0A21F, 0x790012EFE01B5131,
+					0x9D29CF8A8C0F31A9, 0xF2C0D9D3BD4F1D8B, 0xF5D595FC63492718, 0xBD57054E4F28786F, 0x16378E56638B1E20, 0xF436D88D0389343A, 0x22AF80624C7CE3BB, 0xA7CEE893AB22142E,
+					0x895E953A56D5F9A7, 0x0FF91E6F5987AC1B, 0xAD0F791D88D90599, 0x853D1E789E3B8EF6, 0x855F05FD9ADD0BBB, 0xD69E2F8F8A4191F3, 0x74EC5A0043C33EDD, 0xE263389E441BD614,
+					0x412D34E0A5616F17, 0xEA536461D58A69F6, 0xF82F97AEEE5E29BB, 0xD694782A7593BB05, 0x5E4B86485DF0E42E, 0x86D22E5ABA631963, 0x6CBEA76699E80B5A, 0xDE21590EB0CA6CF3,
+					0x1459CF9F86715925, 0x7CE771AA57DB83C6, 0xEBDCF540F9CAE49E, 0xA0689FB582BE5906, 0x143D427F1A8BAD75, 0x084D3F31CAF20EF7, 0x79CAF5FD02B619FC, 0x30CCA730D9F7EBCB,
+					0xCED014F3C5371AAD, 0x3FB6B9CBEADA612F, 0x2619EA9FA81292FD, 0x13D9638E2A2A262C, 0xA16EAFC48953B51C, 0x3F8DBDE2A4CC87A2, 0xFCF122DA9801D6E2, 0x2DBFB421B68C7BD8,
+					0x87A12A2F81A6BB1C, 0x94EA52C61E144ED0, 0xAA43D52667D14968, 0x7AB44AF2DD5523DF, 0x1F7EDC58B0015566, 0x0ED3D4A28462F9D6, 0x7F5EA51305151831, 0x11BE147338FB7A15,
+					0x0550FE32C3011266, 0xE1F9711C99838BCD, 0x5253C7967698A555, 0xA803AF096E0CBA6A, 0xE8EC571CC81FFA2C, 0x9CB3FDB29352CC8F, 0x1C8EBC580B327DBC, 0xF2B6B8EB8B32F51A,
+					0x8120D7BCCE524A76, 0x1B596185E2EB271E, 0xF935C3A8F2A0D432, 0x56BD1A8AFFA45022, 0xFFA8E61A26740D64, 0x9C6F8C48E433BAE9, 0x0006E8E9AE78F86B, 0xD173436D9CBB0BBB,
+					0x2699ACC69D8A0851, 0x6EF7DC37873334B9, 0x5936D0E8BB0631A8, 0x830450C45749CA4A, 0xBB55937DADDF287D, 0xA57C81D6E3B1D269, 0x14D5A4D3646035A8, 0x500DBF46CE0DD59F,
+					0xA1FDD077EFA37D21, 0xE6F16555ECD15909, 0xBC03790AA382E8BB, 0xCFAF454555AA7FDE, 0xE4BB81A0698DAD38, 0x6943385A7A1097AE, 0x05AC1295C1AEBFFA, 0xE59CBD59869AEADD,
+					0xDD530CB85398D680, 0x5890B5C652C0E4F7, 0xB8F6268B49ED18D3, 0xF8A3F5C9DCD518F6, 0x755B237C0110EAFB, 0x9652D65143B380BC, 0x44C08F3D68A41CA1, 0x391439E7A57FAE0E,
+					0xCB4ED8AA36EE2584, 0x17AF119D218311AB, 0xD8D090F5665B8107, 0xDD313DA1DD7C1741, 0x778E72BF3ADAD414, 0xE608A67336EE2F35, 0x4737B1553809990E, 0xA72FD364A4EDF16F,
+					0x1C3BD34AEA657D40, 0x7C49A4801B20314F, 0x905101C7EC38A3A2, 0xADD693E0E032B753, 0x94B1C6A8EB69B273, 0x6F90C57B18D1591A, 0xFFA4EAFA24E5ABA9, 0x180B8F3F04AF0DAA,
+					0xF399136074B885BF, 0x19303B8D10A27ED8, 0xEBDD770D78BCB96C, 0x73732EC1F807897D, 0xFE325DC137791542, 0x1CFCEAAE86F141AA, 0xB1FAE480F1F17B38, 0x8B13D95A7F5B90F5,
+					0x45A7293C71CF43F8, 0x7931DF7A0A125C4D, 0xBA88F6EFC22B713A, 0x1360CCB5AF78B0C3, 0x1D40BF8237139819, 0x9FD1F174D81B01B2, 0x973CAC92548F7497, 0x07678FE1EDC20453,
+					0xC8EA996C04C431DA, 0xDE1A4E97F2078084, 0x8BB4791A472E6B67, 0xA912578151E434E9, 0x23901863F2217DC2, 0xC25B542CB67AE421, 0x66C0471915605F79, 0x1282107A805A159D,
+					0xD0A83801CF7CD46D, 0x73A1AF93FD54C14B, 0x6882697299E557BF, 0xB91AA5219A8454AB, 0xC7C632CFCB181771, 0x09F8015F6B145A1F, 0xA706B3AAF368B666, 0x2374AAEB574349C3,
+					0xAE9DA2DD5347E298, 0x7B68C70842B1D3FC, 0xBE569C0D21E63DC5, 0x6BD940A469DF333B, 0x58658274FFCD23E2, 0xA61A982D2D33539E, 0x844E05D6BC289B0C, 0xC769A3CDF84E53E0,
+					0x0D796B3136ADD4D2, 0x3582985708E93321, 0xD0F0294C265E614F, 0x52748A94268B4B43, 0xE86DA6E5258E4CB1, 0xD483018A86C75217, 0x9CDF12F3492E58AF, 0x412EA193007E7B6F,
+					0xDF335E3C7CE2995F, 0x3AC5CBA20BAB36F2, 0x65852CD923739104, 0xA22513966826FB75, 0x61CBBC76CCA7D3E7, 0xEF5CC4E0457B5032, 0x4D20AE03E0B1C251, 0xC2C1D44D9FBE0B4A,
+					0x60C8EC63C7399402, 0xDF9EC251D038D4CF, 0xF64E5C4F360511DB, 0x2A313F495760675F, 0x036EE15751B7F4C4, 0x73B2CC6B3A87641D, 0x5CFA3E0FEAB80F79, 0x40ABB4BF7B6334DB,
+					0x3571B7C043CEB152, 0x6857D78CE550CDC8, 0x2B1AD7EF986A20AB, 0x865225A60069E195, 0x6B12B0383F04E391, 0x711E5435BC607C34, 0x7D7090E0329C77BD, 0x9EA04CEC09E9E079,
+					0x41C51AB2EC0CCAED, 0x802265815EE81ABE, 0x237BA068D1AFF3AD, 0x51E378CC7C803DAA, 0x862E7F1EC27E02DD, 0x72362CC4DC280DB7, 0x97A73ED300C42492, 0xB399F70FFC9FC143,
+					0x7AC234BB7B273002, 0x54C1CAE6DEED51F8, 0x1E54ADA566C2FC47, 0x3942C13C2C1F01A6, 0xC539398E8F4FAB6B, 0x09635DAFD86F1C03, 0xB4DAC0191DC7C6E4, 0x5F505227F969319C,
+					0x734264AFCA25627B, 0x225A646628EBAF25, 0x126F1902E10EFF14, 0x0B37965D9BB20E3D, 0x00D34C1310FEF35D, 0xF141B1608239031F, 0xE4BDB483450BA69A, 0x4A568CA30F8C5984,
+					0xEE4B87EC9A29B9B4, 0x1D1F1E8CAD3EC836, 0x72A39AAA8CDB33F2, 0x4EE55DEA8DD9E794, 0x26F4799B2C28DDF4, 0x4CE8DF51537BC70C, 0x1B9B6D3BB9C39937, 0x1C70A651DB0D3706,
+					0xB3CA86ED8F7C3A57, 0xBC13DEBF8AD38BDD, 0xB4072ED8128B88FB, 0xC6AC1B077EEA5FDF, 0x995DA1FED4C4ECE2, 0x210697175D39F00E, 0xBE21C11AA9975FE2, 0x8D43BE0771DD08B2,
+					0x3DCE7453A40DE112, 0x93F5BB430A09C1E5, 0x8C8E4D1B6A3503AB, 0x4ED500E801AF26C9, 0x33FF8A080F8CDA0A, 0x29905B14FC561138, 0xDB6B753423FB02D9, 0x9D89DB5C53DC9170,
+					0x01190C392FC00920, 0x5EFCAB93AFC37319, 0xA6A62F38439418CA, 0x92E292659A513217, 0xF9ADC896D1D099F9, 0xDEA786E040F883F8, 0x650ADED5A55CEBB8, 0xE2449C519CACB6BA,
+					0xE10D4F61234116AD, 0x5F2D8E2143B11467, 0xF896DEC2450CBECF, 0x38504D4977AB353D, 0x3FEA0C5388EFAD0F, 0x4D706BC8FB3A99C8, 0x68DEE9C08BEB8B49, 0xB1350922EB8E676E,
+					0xDEDDB4CC4C1A9AC0, 0x7E6588547040779C, 0xC52D267429B06145, 0xD2B85C1124C8C71D, 0xA1C3F1246EB37763, 0xD849DC37C5E83AFB, 0xF55D6D4AC9F07A57, 0xA7C9B55088055F3E,
+					0x23F48FF28FF34E28, 0x6DC950C72B935C57, 0xA2E29E1EFED72EFD, 0x368A02BE5E2019B1, 0x1DC381178EDF349B, 0xC49FB51F64425DC8, 0x2245DB9FA110E355, 0x87CDD094B100495E,
+					0x2D3C9896B346CC1E, 0xD8D52ED9C76C2017, 0x63AE676C4A707E6E, 0xDFDACAEC43B160E9, 0xA9B53C11163A565B, 0xFAA16A41B79DF4D2, 0xCB23E9308EAB9C29, 0xA119E07923349EC2,
+					0x8169F1726180703F, 0x3836077B0FDEF634, 0xF73F57143687AB61, 0x502DB5B6EC44EBB5, 0x89F8A4673A535E54, 0x896F199DDB6A1234, 0x581DD0E6C1462F97, 0x532483396B07F09E,
+					0xBF037B93D01C2CA1, 0x3EE49E6920A2DB2B, 0xF0335768CA6A1046, 0xFA9A8D4B7EA30F86, 0x83B5BFA38399560A, 0xC59CA60C794BF82E, 0x5B4A72A087FF4EF1, 0x314CE6F09524F441,
+					0x55E6D899C98F90AF, 0x792075257EB68A6F, 0xD1B2B0DF939C1160, 0x98A6C23EF251AF4C, 0x88EDC4102C7596F2, 0xEFAD17C3EEB8F71D, 0x7062E869AF71568F, 0xE064028BB3CE549F,
+					0x6F509ECA4FC5EF90, 0x1A45EFE644E5C375, 0xCB6BEA030DAA4C39, 0x73238A73DE3DBD07, 0xA93697AFC3C7DD76, 0x66A4A3D1C4966392, 0xC5469D3DD6E04D8F, 0x67B9FCD707765109,
+					0x1291A0FFD6DE5522, 0xEF073D0A0E06BAE4, 0x6913B56390072A78, 0x445D96A011753EF2, 0x65BBCA63A3C5BC41, 0x6FD34DF50E9FF84D, 0x36854710C16DCD31, 0xC2D4EB51FE765FBB,
+					0x7992B0BFBAEDC188, 0xCF41566633175DC5, 0x3E07EA1E5159C2BA, 0x07F7C54BB9779B1A, 0x33A5D07FF33F2B72, 0x73F5D92DE8ADB02A, 0x05F30C990D4AC50C, 0xDEA0D3C405D2E1F6,
+					0xE6756753898B2117, 0x975C55DC18B9662A, 0xD1B57CDE8F1905DE, 0xCDE6EAB1DFFAA166, 0xDADFBC48333067CE, 0x67166AF74F8FDF1F, 0xEEF92266761C2DB0, 0x0C6353EB8D5590B3,
+					0x6511A6FB42952761, 0xCFECC0A32AD94E87, 0x4F57795D9ADE367A, 0xF261A3ABA31A2430, 0x796B8AE2505B6C62, 0xD2A493AFE8F1FDB0, 0xABF0DC0B5FFDF9DF, 0xF139A409C8303976,
+					0x4D7DB5FB70763B41, 0x22213670EBF61FC4, 0x686EFA7A653B0623, 0x897251404AC42052, 0x5CE3765BEF4DEDDA, 0xC1FFB2AE2ED7197D, 0xC9D16E1958070572, 0x8188C839CA81DFBC,
+					0x4DADF0885FD21363, 0x9A57FD13E8D633DF, 0x23D9E7419772DD80, 0x387B66E40C71557A, 0x5A73735EDA94CDAC, 0xD6153F36A8B0FC45, 0x4869E414CC77D357, 0x0509A2F4196EF94D,
+					0x659649F4E324F58F, 0x1BFF782702800D1A, 0x977FCFD7B1528156, 0x95E5D6D3314387BC, 0xB9F39692C4BB4675, 0xA0ACFB2C9ACD5B2B, 0x32404438822BF6B4, 0xF5C49EF7EF8BC203,
+					0x6CB33B788A689A9E, 0xA89849BDCCB66D87, 0x7DAFAB0169D03BAA, 0xE7EB6044975A47AD, 0xE4D80DAC04DEB736, 0xBB8C6C35457DA97A, 0x5F57C032A03B98E5, 0x5C1256CBA5407372,
+					0x472CACBC72BEA760, 0xFD5B272549407D0A, 0xE7C48241E2308B7C, 0x3FD7CE851CE2B851, 0x64CDA8672DCD74DF, 0x4A49ECD425944AE4, 0xBCF274F168322227, 0x2A72AB7564A120BF,
+					0x9AA6EEEAB59A1823, 0x05A87418FD459DE9, 0xA811CE192F466B47, 0xDC5E2962E32524B7, 0xE32D379B83621FB8, 0x4DAE0D3BDA85D070, 0xC6146BFA204E1677, 0x0BDAA93BF56BC392,
+					0xC04D363CE03EB3A5, 0x2F354AB1575089DF, 0x4D10DC9A6B259ACB, 0x66E2E1A572761BE6, 0x630DE34B49A366E3, 0x98976B12DECA233D, 0xD9B69B9723BE4E75, 0x62624AB68C3C8EBD,
+					0x2D2E32CCD8D407FC, 0xB10AA86CC197D4F2, 0x1E6DB9A683210433, 0x829548BF172FA66A, 0x0573FFEEE13F5CE3, 0x0AF8943A88CD6137, 0x6017268488D27ADB, 0x7E388BA49358AB5C,
+					0x91EBB1BAD5A1B3EE, 0xF2BB313434C1A8A6, 0xE4587E5A38D3544A, 0x477C0C749F744ACA, 0x2C9C595C8178AF5B, 0x737E7D3C79B46303, 0x5EF46869B7941568, 0xADCD68A9E4519914,
+					0xE4A63B0B863C3868, 0x7A9935BFCF12A1F0, 0x84DEF41877C94D50, 0xA68F84A87E9167F6, 0xBBADC16343EB568A, 0xC99B73ADDF70B2B0, 0x49245B637A339F61, 0x95A71D2ED9528674,
+					0x1164184E0562785E, 0x0F722C766F428D3D, 0x83DE9A83BFCDDDC4, 0x051308FF159D07EB, 0xF29A24BEC4E0A6E8, 0x1A1DAA528AAC741F, 0xDE4EB510485FBCE1, 0xA501F506927639CD,
+					0xF91DD96CA46902C8, 0x53CF35D119C9C534, 0x7DDEAEA3FA384E56, 0xFB8B8FEF94C6DEE6, 0x7E6FD9CA48102DAC, 0x30F62793D909EE59, 0xF8AE216FFB456106, 0xCF3939BEFECBDE11,
+					0x0D03AEDB0D9A94FD, 0x2390CF55FF8EFD02, 0xB2650F59F3224DB8, 0x02483F1F1292A6AC, 0x4CCF2019BBD1A51B, 0xA9D569AE700FE9B4, 0x6F47D3739122D859, 0x6801C8A5AE77D61F,
+					0xF4D89330C18D7471, 0xE173EC80929892FA, 0x47411EB7ED085187, 0xF6FD8A32A8316153, 0x36C6192E09C8B978, 0x08AF5D399CFB3BBA, 0xA628CE57C92855BC, 0xD36B32DBDC612B2A,
+					0x351333B51173FB08, 0x3F726DFD6E621C3F, 0xDBD03E6CA5C5989D, 0x8EA243E3522AE2D6, 0x99CD07754B6A873A, 0xF5EDA9D5300F1295, 0x062E6E685EEE368E, 0x8D74A48099E428C5,
+					0xE2A7E26BE8D9D305, 0x726A4004666C0577, 0x6FDF4CE56B31F069, 0x8D43E280212A536F, 0xD8BFE9B53E5E7F25, 0xB5D3BE4ED155AB7F, 0x452E55CA6B6BD571, 0xE0062A68BBE0C84A,
+					0xAC89A48293309D44, 0x619F6A4B25FFD4E3, 0x938CEE3FFAE50F3E, 0xEE8D7307CF079256, 0xA6878322A72EECFA, 0xC79C7DA93AFF8558, 0x72FD27F525040670, 0x5E508E1C377233E8,
+					0x7DE07C9D863DD9BA, 0xD230FF68263C1715, 0x75C04F3F3F992A48, 0xFB8A01504F55D51C, 0xA2F1550DB8A4434E, 0xC9D3268513597559, 0xEC4D5C2B6F1ABDB5, 0xAE83E55441B987DF,
+					0x4225C1A45E534A3F, 0x7D6A8853433873F0, 0x708AA3E9C65EB095, 0x71FC2A84BD9F8717, 0x3FF40AB78BE9BD2E, 0x8C1257D403DABBAD, 0x740FFC3D1B5CD09F, 0x43B37DBF6566E505,
+					0xD57EF810821AEE2A, 0x9644B7A8E5D3E6FF, 0x27A5963401E99238, 0x92F42DD4EC0CAA62, 0x7FA631295529F197, 0xD704B695D906FE71, 0x105E618907A587CE, 0x71B20B8895D42A5F,
+					0xA6AE69636363A1D8, 0x421B53EAD9E313A9, 0x5F1121CEF3AB7F59, 0xCD6549931AF9113D, 0x0ECFAD6E18510711, 0x40521D1EDD9CA23E, 0x6F6CDFE06A7A7962, 0x36059B3CEE084B4E,
+					0xC67EEBFE0A711C17, 0x94D87DB832DC857E, 0x2BB967836FB5D389, 0xFD436E484B1343AA, 0x964830F020A3CEE1, 0x8A7A01518532F546, 0xCE088141F945C7F6, 0x4DAF3184F8F703CE,
+					0xFE5154F76969A48C, 0x3262D00992888F19, 0xDF438B63C4A45F64, 0xB08122A98CE86301, 0xFE940D64928258A9, 0x390E54AD366EAC35, 0x85875BCF3A83D188, 0x49653E52AE1FD4A9,
+					0x264D6596E1F15948, 0x8BAF8F4FF51D612B, 0x334C5DC860AF9B0A, 0x43064E275F9C2233, 0x98F0D05332A242B2, 0x9687E54A6B27A2AF, 0x3843C4ED74A17A81, 0xEDA0AFC502AB99AC,
+					0xEB1456554AC8015C, 0x18821CC9977E3C5B, 0xA922424D639B08F0, 0x58F1ACD76EC3C443, 0x12F805727A1D641A, 0x3B454A877F5C0FAA, 0x544BA2D2A5D42018, 0xD1C680125517026D,
+					0xAEA9DDE2F3F7CE0B, 0x78210C41654FAAEB, 0x5E0624A404EA971A, 0x8FAFA9C789002082, 0x85BF37919823BB8D, 0xC6C0765EA87167DC, 0xD6523409478D4FA1, 0xA806B26AE72FDD4E,
+					0xDBF1F3C556B298F4, 0x62EF187823B219E9, 0xD51A02FBAB30E5AE, 0x53569E486510934D, 0x53BADB392AD87461, 0x14A0F05973190911, 0x19319F08908B882A, 0xA632F747A8356E47,
+					0xB1F4B73615651FD3, 0xDED189BB11DD8A5F, 0x0CE39EDC1546E339, 0x8BE9D6008CC6A2A9, 0xDCD64375A713EEB8, 0xDB642D85FD0088A8, 0x403C426EC04FE707, 0x627388D860FB8ACD,
+					0x7FF3056BF40C6928, 0x129B63AF989E8171, 0xE7758761AA58E170, 0x87ABCD4E3D585322, 0x8A35115B95A45F65, 0x736FF9F48E5C4F91, 0xD1AE4F3AF5BB9598, 0x7C78A10E0B8A2620,
+					0x333067DE0260515F, 0x34EEDC24F3EE556B, 0xD6D654576D10C958, 0xADE7A273A70C670B, 0xE1791A7211206783, 0x7FCB077062A2B475, 0x2F278B8620A8FCB5, 0xF4BB2D7DED039B09,
+					0xA708A866E60E7763, 0xA084532C15F716CE, 0x001336C21871AFBF, 0x53FE3DD3DACEE0AA, 0x4BA62CDC3D576377, 0x8D1D82C70E00515A, 0x039CCC52892EDCC5, 0x991B5CB51E560742,
+					0x39F7B6457AAFA9F1, 0x6373DC2C8EA72B9E, 0x13EF520A961129FB, 0x5BB60D90AEB51853, 0x08A7CD5FF506A1BF, 0x6B939643E2749583, 0xA939773678F0366A, 0xD28F7DDB039F07EE,
+					0x9AA5758658B29CCC, 0xABD2BC27D3E88D46, 0xC7559AC461EF39D3, 0x91DC8A6F216A456B, 0x5FA80A553EAA3B96, 0x94DB27DEF38E79BC, 0xA267D7E1715727F2, 0x551CD943353BDFA2,
+					0xB5085319C447A429, 0x72CA47E2AF21E442, 0x639BED8C19F94E97, 0x9673DA59B11EA39C, 0xD1A33CE07812F755, 0xB5F465744AABA0C9, 0xCF43190CE8D1AC29, 0xE2C2CABC19895EF3,
+					0x94F300321375DDF7, 0x1473D2AC35FC1C5C, 0x10118DDEBD8011BF, 0xBE2F1F19232702FD, 0xE696100329EFB35B, 0x1B7A807248C35213, 0x12BB40A787D7E953, 0x0F41F41C694A20DC,
+					0x6A8CB84674735582, 0x82E83400F10AC6E7, 0xEF3B8CD5AEE56F6A, 0xAF96CB425F2753D5, 0x3A12FE4A5AE3F220, 0x1FA679907619E45E, 0xD8BA1F55922CB428, 0xDAAD2F00632CD2A3,
+					0x79FE794C703A0AC6, 0x4AF01E15E72CA1D6, 0xB24D8A99B61F4EE7, 0x72E9C0A8404979E8, 0x5DDC46AB3A1187C1, 0x6AF327D1DDF403CB, 0x58A37C87FD1E4D13, 0x642B5E760BE2968A,
+					0x07C3B0F86F5769A0, 0xC808E20445606BF7, 0x97E5D51FBF2FF7D1, 0x8CF0B9854CBE1C57, 0x557CB43C0393969C, 0xC3F974F6EA08E249, 0xE236D3F8960FA04A, 0xC0A673E6481CC244,
+					0xE97DB23861919E63, 0x79D4DC2C544BFE5B, 0x69372F778EC0E46F, 0x5EFEC48F84393B22, 0xBB694410F749B202, 0x4ED6E0889FA96E38, 0x58745FEDA5AFCDDC, 0xEC885E72C62FD985,
+					0x4724319DBDEB773F, 0xFE9EE50EC547519B, 0x5D7FA7E03EF7932D, 0x718DE1EDCC815A35, 0xFFE4F5580CFF2F18, 0xB7DEB5FA7AB1B687, 0x8792213979A6F764, 0x91AA5BFCEC6129A7,
+					0xB8111B4488918290, 0xB6E7F8C8BA85A3F8, 0x78FA300DFB4D5936, 0x1F92BD22D8431EF3, 0xDEF75BE31AA41ADC, 0xE4A07087E232AD63, 0x96ACF4E649E93D51, 0x5A3BBC131E16ACB6,
+					0x6E3BE81984EB861A, 0xB0B13EBC01254FCE, 0xDBA3B7D9929E6509, 0x0A1D7739BCBE18B8, 0xF032D310DA840A87, 0xAD6E94152235AD2A, 0xD0A2BF6E9ACA62F7, 0x58B0CFC522827495,
+					0x006901DA2415D244, 0x39756F1855FDEE19, 0xBEAEA4B12F864CEA, 0x14E7B1F1F7371EDE, 0x7BE7B4EBE60BE6DA, 0xEE40851DCDC6B4A2, 0x3869F9D69661B7C9, 0x2E2D19CC16228CE6,
+					0x2CB54053F18442ED, 0xE888E2611A5C6ABE, 0xE7CE68AE2C021E73, 0x1DDDDC7B0450C252, 0x3A07039442EF3B8F, 0xE7161EAE6166E7D7, 0xE870D8B217B72455, 0x46144C7F329F3442,
+					0x8F8B7615044F6916, 0x60DCE2BFEFE01180, 0xEDF557313DED08A9, 0xFB66A9C27185882B, 0xEF9E3E221E47370B, 0x7E46C13935A530E3, 0x655C6B789DFD8A1E, 0xE89F08C89DB859C3,
+					0x53C5C21F03B30EF3, 0xF4BAA7BAEBCD55BC, 0xE62369F0133CEE3E, 0xDA34A9F9A52A3A20, 0xA34DE63E6C1EF99F, 0xDE853A5745FB217A, 0x34F372441BD0114B, 0xFEA63A12A3828D86,
+					0x525DCC24F6568F89, 0xAA1CA94DFF7D6690, 0xCFCF8050B32D7015, 0x8F52BD261499F27E, 0x8C150382C4606EB5, 0xBF2F189BF3FBE968, 0xA93335C4A5745ECB, 0x47B956CA1AEA5194,
+					0xACCBA5CCC7A58757, 0x90387AFBB9ACC416, 0x845A0DEAF8F7768D, 0x1A71C3030091ABBE, 0x0689B13DE13CA56C, 0x5912A1A5024B8F5C, 0x5BF70803EE49F258, 0x983E7B8046BD22FF,
+					0xE38C035A634C110C, 0x8BF316C3B061EDA7, 0x8EE528D428E4F85F, 0xFA8946B43D8E1CE7, 0x195FE61E0349A53C, 0x689CDA72D1914D08, 0xA53B0E988E7B3018, 0xD8D8ADA047AA62E3,
+					0x3C68CF30049CA2B7, 0x538BBF8A65FFD9E2, 0xB727EE64DCF3E5CD, 0xC793D656EC8AC17C, 0xBFEBAE638975E5AE, 0xE30E405C0258B802, 0xE2C6EDD74887C61B, 0x649679961FD769EC,
+					0xB2EF64A7609FFF45, 0xD60F38B4EC6AB9F2, 0xAF06849EFEACE89A, 0x505DD4898344F3E6, 0x2B0CAB9F8470E1B7, 0xFCC8291AF140EED1, 0x5FACC4FE5AC4B563, 0x83E7DC570A263B07,
+					0x12D2AFA8059B77E7, 0x177C10B9B18AD853, 0xECFB03B84BF7ED2F, 0x1BB238CB66AA4AB7, 0x7D2C8CC93EF28D49, 0x893BD6EA5A2B3974, 0x3A817BAA2E160487, 0x9F5C631339920256,
+					0xD5D3F1BB9599EF65, 0xB5DC45D1D98A67B3, 0xAEB75A1D955A63C0, 0x00B914773D6D7A5C, 0xA0745BDAAF397E3B, 0xD309B929F3C7BD41, 0x307ADE1502E1749A, 0x462B4FE454773C2E,
+					0xCC5205E92B1A27B3, 0x2746A893A87C629D, 0xC3CC6E4C9E960253, 0xECF7830A0D6A5D97, 0xAC7BE9ACDD86BC0A, 0x61536EF2C889848C, 0x0793C95A545D3BCC, 0x4F21A4D6C4F421E0,
+					0xAB912674936C4786, 0x871D052804AF757F, 0x0334F3A963E72E13, 0x021BB576A72A619A, 0xEE5B94AD93C11222, 0x454BD074755189C7, 0xE0E15DC2E3AC815E, 0xF3A2B75543C5FE55,
+					0x77BACB330BA4B629, 0x038ECC62D039579C, 0xC047AE03372C415C, 0xEDE65859F2E98A81, 0x7E401E8C3927FF03, 0x95C3AD6645B84A59, 0xD2C83557443674F9, 0xC4DBB092737B0FF4,
+					0xAEEC0FFAD001E8F0, 0x7FC4E1DCF123DF46, 0x5ED28CCD55A30032, 0xE3E0F55F4D7381D9, 0xD075771DCB3E44F1, 0xE36FF602D54A704C, 0x24D79FE77EF2A66D, 0x0617D8F9E679250C,
+					0xA847CECCD6952B53, 0x2EAE58D2370B6CE5, 0x32A4D0195F910656, 0x864DC55ABDC2B21A, 0xEFBF60C6D236F52D, 0xFBE4593CC4214F74, 0x2E87F9846803F61D, 0x1134EA2E4CDFAF79,
+					0x27960BA33A6DB5BD, 0x0B740B4028AF27F4, 0x65568D7B18FD9BEB, 0x2FA33145A9AB7D46, 0xA950314EA4754B2F, 0x60C1FCE92BED7BC2, 0x1405284C90630870, 0x5741A2FDEE8D77CA,
+					0x95A33CFA44110A84, 0xB856876B72F2FC0E, 0x44FC8F6BBE8FE809, 0x60CEB5515468D292, 0xC4C662F788E128D8, 0xFA3AA1F63C95BC70, 0xE9BF60FE2C81D63C, 0xBFCFC031C70EF57F,
+					0x6F5BD755E70B7E52, 0x4356A2EB8ECDF3FA, 0x04A92499927BDC75, 0x23683D22D6D6CC3E, 0xC542DE8999ED6F21, 0x6F878AE469FF51F6, 0x4D81E896CF1542B5, 0x9ED69190ECF1DA05,
+					0x29D4793A39DB7960, 0x5A01427D574F318B, 0x98C5AEBED3800ED3, 0x11F651639C84E54C, 0x566832B6EB2B9431, 0xE182BDC9B879B852, 0x77F8871B918E427B, 0x0BDDA92106860F46,
+					0x176A32886E438BE9, 0x995B6629C9204B5D, 0x50E73B5909105B54, 0x4D6976E085ACEB18, 0x6B84585D4812965C, 0x0AFE58F984283793, 0x427D18269E461D4C, 0x1747D25B9DC166B5,
+					0x7DA52D51CD97A073, 0x5451AD5DBBEED5EE, 0x45034EDD09935C73, 0x331BC0E622F4CF59, 0x2D107C8772685DC8, 0xA2C511348C9752D2, 0x20800F499E0C73F4, 0xAF1A84FD33CF0F6D,
+					0xAFB60224643FA599, 0x570ABB3B37A05F9B, 0x797496AF18B3F8D5, 0x0380A0651E2716C3, 0x31044E0698A9E4A7, 0xA075001EB30FB11B, 0xDE81F4829BA1FBFD, 0x7824554A2636B7AA,
+					0x18C4651FCB90C202, 0x58B0EF77C852EC6F, 0x20FB56BF6A0F4BCC, 0xB1FD0DEAD8084B30, 0x65CD076540ACCA9F, 0xB7DCD305785FE3C0, 0x7FF4B44246AE5C0C, 0xD40E9E2EC606AA7D,
+					0x87E23CEECED59F51, 0x2BBEED625B30EECE, 0x8DEEBD701BC1E86E, 0x35A67076817914EC, 0xE607B122D3E7C0A1, 0x54E1159FDCF12A2A, 0xB4756D5E953FE025, 0x5071C83A1A815A09,
+					0x65D9D4B44BF4F1A1, 0x6FBB80116839F97F, 0x1BA1EFFF75ED3442, 0xBEA7BAFC0B887F3A, 0xDA487A024CFB2D4C, 0xFBCB2CEFB38BE881, 0xB74CDF4072FA9453, 0x71B7FDD656171FB5,
+					0x22BB7303DC0C595C, 0x274D7FF998AC2F27, 0x24C0965DCBEB85AD, 0x383DFA6CBA5CD106, 0xB4DE081A187640BE, 0x67C49319D885B148, 0xC9D89028CDA70FC8, 0x8C42477EE3C2AD0F,
+					0x229E000BC7B02BF4, 0x430027FDF008804E, 0xAEE05D531BBD5C14, 0xEC62F804DDBDC5C2, 0x570D84F1D5105DF4, 0xFE331523BCD00E59, 0x9A24ADD2E2B10DD5, 0xED7919093B4061E1,
+					0x3447734CB99E2147, 0x648AD750FB8A23F9, 0xD531AD02D990ACAE, 0xDB8480CD1B05ECB3, 0xFEAA4B58BAF0F4CB, 0xE6674C5C3B2B9C9F, 0x0091CA76B600CA8C, 0x6B96078C33EFC9F6,
+					0x1C7A4A27255C7B71, 0x59A0FCAD244340BD, 0xD71A5BC66C697A32, 0x99F912781A5CC606, 0x85D415AFF2C16626, 0x613D01939ACB755B, 0x09E5089ED83B4E60, 0x8194F3BEBC00E4BD,
+					0x2E16ECDB8F4FF5EB, 0x3C8883226601C119, 0x3B1B1A4BF762D943, 0xDA5AEA8C57FB4000, 0x9A3CB3BD15901C2E, 0x32A93110466AF790, 0xFAE9A4E74BB83A7C, 0xE487CF6ADF66F42C,
+					0xDFC03703A7C0DA4F, 0xF41FFF74E55DAEC5, 0xE0629FD48E731F9A, 0x8FA169668AD30261, 0x446127CBDA3A26A5, 0x811FD01DB167F0FA, 0xEA0251E60573E4F7, 0x5EE7AFF9C41CF674,
+					0xDB2EC001A55DBB1D, 0xA6AB6BD688D6B5EA, 0x501026E212B5CE3F, 0x98796841348D1BBB, 0x8AA19676503B0C22, 0x9EA505A8419EDF60, 0x127255C3527496BA, 0x1FE5282EA960CC8E,
+					0x4A1C937EF1C30836, 0x6C49F16236E2B058, 0x7AE7A1D678D4B833, 0xCC742EE37A1084E0, 0xA2A234A7455876E1, 0xE16588490ABC82FB, 0xE095E5C3DCCE298E, 0xD4822371A956B33B,
+					0x08E30A2103E4A818, 0xE5E90F3658BBB6FA, 0xCC295628404D29AF, 0xEBF05B4D0366C9A8, 0x33BF2A3F08E3AAD5, 0x12AE34DF59CECD67, 0x7F421F1478DADAD0, 0x9009E369B20E39E4,
+					0x140A232436011C23, 0xEDFF1DB5C1F14425, 0x3D6EFA977497BF9A, 0xE03387459DC62D07, 0xD696B4891EAFBD05, 0x0DCF37E10AEDA5D1, 0x27C25D1B7DAEEF18, 0xD93E902218A7CED2,
+					0x83564AFF1FACDB0F, 0xF76024DBAEEDA8B3, 0x16586AB552B30DB8, 0xBE46F3922EF5C950, 0xF57FE92CD283E63D, 0xF71CF03E0293C72F, 0x9938E02ED68F5BD7, 0xE2E1CBC0E052163E,
+					0x84C98750DB0F5535, 0x25BC95593AF22A17, 0x8C365A21C8BE744B, 0xB3125FB6EDEA7234, 0xF8EA89F92FDA05ED, 0x92664167EFE484DB, 0x52F6EF70D9EF09A3, 0xB474575F21330528,
+					0xECAFA45E7260D77B, 0xD5B9F6F18C06F736, 0xCD52135B438F8A5D, 0x06AF97855B853DB7, 0xCB9CB2ABFC81B317, 0x7D708E872A87123D, 0x5A8880C390E206E6, 0xFE5C8A30BB1A079B,
+					0xFFC555024C9BA889, 0xD11667D5A0E360BB, 0x4E959D7A4F0DFEF3, 0x6D5A55AA941E3D3C, 0xB28C4A14F2E8A5DC, 0xDCC5E2F51713B64E, 0xA29124F3BD59070A, 0x0E1D6EE1FC45421C,
+					0x246F449EE63230EF, 0xD18D37C7B3E07364, 0xB3B0F297C92C9DC5, 0x68D3BDD97C25DE23, 0x16F507434F4C1841, 0x19ABB1EFBF5EF0E6, 0xE4731F6A71F66CF4, 0xB4ADF12B2C02B2E6,
+					0x0EBF2358F5A79D3B, 0xD1763455A4ED0B28, 0xFF52AB3894772F2C, 0x75D4A2C7462AA4D0, 0xFC88304C2EB6C21C, 0x643CC0A088474D5F, 0x36771C6E75FB18B9, 0x0DCED6B8BF1D8E33,
+					0x7053ABF96C239EFA, 0x9E892884153351BB, 0x7FB2A3AEDE6D757F, 0x4767071BF152F771, 0x342829B1FD63BAC9, 0xB93D0F4E3B90193F, 0xAE44991844FDD1C6, 0x6FEC78755FB14F16,
+					0x4018F82E555DC87C, 0x98FFD394DA414AB7, 0xCE171407B2012A69, 0x4782946367C9C2D9, 0xCB43916C61AB8F0E, 0xA6CE4FB8CA660C09, 0xDDC5A68E74D82859, 0x7853E41FD93FA960,
+					0xF9FC5016F3E11FDE, 0xFB822401C08ADEC5, 0xA3B8633BEC437D3A, 0x12E26C767CDF4399, 0x8DD0A329706FC8E0, 0xFC35508A147A9CDF, 0x4F2695DCC16369B8, 0xEBE15E97EEA87AF6,
+					0xE60CE9856E770D4B, 0x86C1FE0AE4CD6D13, 0x5BB171B74402D7F8, 0xA2E5E820212D0FF7, 0x07672B5455C56234, 0x52F4A629D5A22CC9, 0xF1B63737E94EED70, 0xEDEC05FDDC1E6CE3,
+					0x55970063695591F4, 0x0F053855CDEEC9E0, 0x2641B01F676FA4CA, 0x8F1004F18F38D982, 0x53C58628EEDBCA66, 0x4E2FB6ADB7851ABB, 0x360EC9C43FFD8938, 0xA46AB53DF83686E6,
+					0x62D31BD60BD1DB9E, 0xC94E362F8AA99EB9, 0x1EE30A5A7F0981DF, 0x66DEA2DE2244A2C9, 0xD782711ACACAF587, 0x800AB496CB4A3918, 0x0EBDF746DED1474D, 0x6F9F05D7EA0C321E,
+					0x919216A666420705, 0x2DB741504CA214A4, 0x19777222662626E4, 0xCF159756881CEBC0, 0x3AC7AB2CBE6611FD, 0xCE413EF2AC496909, 0x3AF1CCA8260B98B1, 0xFCDC77B151BE818C,
+					0xADD14FF26A494A39, 0x1BAF24652DA93DD4, 0xF39CBEC73D676732, 0xCDE1250142D59506, 0x5FF7A04F75EB566B, 0xD79DB00A648F7EF6, 0x1C0064A4CA5306C9, 0x3989C2404BB2AD90,
+					0x0C1503741CCF6407, 0x42714FFF2AFC1C96, 0xB277CCD3FA457E06, 0xCC80A85B2B6FD42F, 0xEF055254013B9911, 0x77D3999EC25ED343, 0xEEF63B3A85D680DA, 0xCE2714E3640859D5,
+					0x66113C962A823583, 0xC0550004161EC54C, 0x160F878E88492455, 0x1646955E2EB042B8, 0x70ED3C2C51255FEE, 0x87361CF6576FC47D, 0xA590F0779D7D6DA3, 0x1591092D1BF93E24,
+					0x3DFEF9484568C895, 0xE20C9D7741789319, 0x49E4CEBDE14CBE83, 0xB15C297EA6E58D87, 0xC51D073CE86C2A2C, 0x6B23C281393D36B9, 0x5714D920BDA04767, 0xFC1D08214708D1F9,
+					0x558BC8ED639D8E82, 0x8BFDE335C68803D0, 0x9D696D3A7B14C50D, 0x2C415399724DB0E4, 0xE73B150B79AA2ECB, 0xB333A49B479D072D, 0x9847D35967EF480F, 0x50D77C073A1B757D,
+					0x072E64F1EF535EDD, 0xC093D2F5DE6469E0, 0xD8AC9368F9FC2DB3, 0x156309A721AFEBC2, 0x95913548A5A02642, 0x4EF16652963BED7E, 0x8C8A20F60248D5F1, 0xDC78362505BBA4EC,
+					0xACB04C0837746502, 0x4D9BA3D0132496CE, 0x5B167AFDB38DC8CE, 0x3624F19C96F55C1E, 0x98EA26730F7137F3, 0x6D15AEA0AC7DF1CF, 0x08C00B1CE0CDEF55, 0xA5DBC60FD2D80282,
+					0x6156DA7F96551306, 0x0A85E20655E9B812, 0x788020A093E06B38, 0xBC49C8E300E98A78, 0x765319221C9AA074, 0xCB2E4D129636CD62, 0x5D3E8A72ABB8E0FE, 0x3B4F1E837FC5405A,
+					0x2A77D8E4F5E667BC, 0xB8040CCA16CDC52F, 0x7B5E141E68636C00, 0x32B7459B4BC23B5C, 0xA231A524DA24E977, 0x9DA44FFA0AE3B0E2, 0x00D2FD94C7751E9C, 0xB7410D0CE665A068,
+					0x333FDDE138C64E99, 0x755AC1CE71E3F8AF, 0xB6C706041FD8E3B3, 0xBB5376F7A065B419, 0x2707465D8476A67B, 0x281F39F4E748D78C, 0xEAE3F4D8C6AE1825, 0x79427FC8BF786DE0,
+					0xCBCDD39642F5EE81, 0xA01E34A5E06CA7A4, 0x5E73F5610EB84A86, 0x745F3BF70D33A0BE, 0xF96E2DB09A570C9E, 0xFE3350049A3E616E, 0x3FB59E4153DC9D64, 0x07FA97279CFF211F,
+					0x58BD3CF9243C9004, 0x6724E74460E5B2F0, 0x489E1A576AC163F8, 0xB6D0E65BE4DBEE22, 0x70E662322E6E9815, 0x2987C5EE3AC0475A, 0xB72D956F612B9A04, 0x59D7875B41278AAD,
+					0x50D6118BCC35F65C, 0xC73143EB53F0B74F, 0x612A2AB41EB2C59E, 0x478A9D5F0E9BA896, 0x3F5C2018658986DA, 0xFD48C6F4EC76F677, 0x7C9B59439380642C, 0x3237A9339E4B01EC,
+					0x0AC19DAACAD32F7B, 0xE1A58217D807B909, 0xDB25EFEE8BEBB355, 0x1B321AD223A1FB5E, 0x3989BDBA694B0AC2, 0xEB363B0F096D70D0, 0x58952CC7123AAD7A, 0x91F0D0FBA655A3F1,
+					0x5C12B872BAC44B9F, 0xF4FA94369D98F0B7, 0xA6376E9AFFDC2AB4, 0x5F044F742B1EC676, 0x0BD7BE3B1E569DB1, 0xB7D5518BB7492EE9, 0x2917B86C9ED3C32C, 0xFE98114203B0D554,
+					0x99580B381A926834, 0xFB40506D2FB3DA09, 0x1408322A51BC895C, 0xD82DA61E0FCAB7E9, 0x13776FFF08437BF2, 0x6AFDEFDD3506C718, 0x5D4861D7A67A82B6, 0x7F73AB3916135656,
+					0x7C9F8C3FF5348212, 0x94C9B0B39F88AD56, 0x10B6AC7DB6718646, 0xC9E63A0FE80C0E52, 0xD0D0FEFF6BFE098A, 0xBE8D24C3274E843C, 0xCD890AF2D603EBBE, 0x63ABFF2ECC0395DB,
+					0x91B349FD77B176A5, 0x1C2AC81A026F8129, 0x49238253CEB45DA4, 0x513492290D484D01, 0x5EE8DEC8E5BAFDD4, 0x348F1953DFEC09CA, 0x0200CA9E5859454F, 0x979812E054D40CA2,
+					0xBA2C29617C2E63D5, 0xB378CEB751587218, 0xA69C1DEF84A568B2, 0xECDBEBAD8649C203, 0x0CD356E34732FF54, 0x8CC1F5826A8B3146, 0xD53FCD06AEDC8C41, 0x53E62176CBCFA055,
+					0x9FD0365B4D71AA91, 0x8C55BBF7E2CD44ED, 0xDE99740E6821EF86, 0x8EEC001657CF58CA, 0x6291755D22A7A4B5, 0x1CA4E1804134B0C1, 0x0C2FD65DEA5C4C64, 0x5AAA0ADA55982CE5,
+					0x8D0D74E7618BBBA4, 0x1B0DD9670332D76A, 0xBBF83C3C36E80DEB, 0x3DBEB288E8CA1288, 0xAD136FF7CC63049E, 0xE3433FD510C72243, 0x76D556DDCC731B5B, 0xF895649C34818F5B,
+					0x593813E3E58DA63F, 0xCF2B7803197E0812, 0xEC294F075E4619DC, 0xA372DA4C5A861EAF, 0x098FBD54ABF830F6, 0xD616E792D09FAFA6, 0x88F6A66B8E53F0DB, 0xF2007EB2346E1DA6,
+					0x2FBB5F0C41872FC4, 0xA83EF7C391563DAD, 0xBEEF506919BE2C7A, 0xE2960E030AF5F68E, 0x491607DDCFC9D59A, 0xF68AD6B67695F934, 0xCDDEDFCDB6B7899A, 0xF6F110B9E5BBEFC3,
+					0x9AA680E9E40D3B4E, 0xECF03599A596DFF3, 0x325C3587A60DB876, 0x1C1D64241D3FABD1, 0xB491D959B20238EC, 0x4E9DE2624B782F16, 0xF2BF524E8E9D0112, 0xA06F793C9A638DD1,
+					0xE64DC35AF60A72F2, 0xCDBD05FA3C4F11A0, 0x1B5AA49AE29DB11E, 0x160CFFFA00216E1E, 0x6B3B04C4B446FD84, 0xDFEF7906EDB5DAC7, 0x8B3D99771833D16D, 0xEABCEAA4A576AF7C,
+					0x95A7A29402CD2A38, 0xCA1E1CC633EBEF87, 0x4223FC85E4FD6094, 0x23094FCD7FA60416, 0xBF61408A841D84FA, 0xB44551FED38C6782, 0xB087A72A99F39326, 0x913B47B4D1374EAC,
+					0xD014139ABDEC4DF5, 0x0430B385400435F1, 0xCCFE051D988DC2CF, 0xB7444BFFB305D773, 0x2612196398B43B66, 0x2436064096B89D0C, 0x737718DF6CBB4094, 0x062A4FDA615C2914,
+					0x5F343C755AEC374A, 0xE9E7B36E21D480B8, 0xDA16DABD79FDEBBC, 0xD2293A4E90B2B845, 0x76B44B77991C4E01, 0x4D71AB0FB4770FFD, 0x939665053BC6C92D, 0x4C1B555CE6072854,
+					0xD4F0BA6604B6AACF, 0xD76A0FF09BE25688, 0x311AD375C1D4B2C4, 0xC3C3E5D2FDC806CA, 0x91D83329E95FE077, 0xC35B6371E870D3FB, 0xC92B3803149661FD, 0xA2D767702ABACB54,
+					0x5EC8E8CBA9B8041D, 0x8DFC784B915ABE5E, 0x2572B2E1E40ADC72, 0x2D0DE9830FB40DE4, 0x60726EE02C0073CF, 0xD96F125D5EBFDD13, 0x511BA3BC35DB4B0B, 0x5FE335D65DDE0063,
+					0x312DFDB84B4471B8, 0xAC2859652F3E46CF, 0x0186AC7102262907, 0x1A3E7F9C5C0876BB, 0xD8E6275D703F575E, 0x8DD0E1222F688AAA, 0x2B0FB98D8371CA56, 0x00EB9C9DAB16BC1F,
+					0x4BE823BF6A524BF5, 0xB260DBC3FF541DBC, 0x9389F6DCCCAFFB63, 0xF115335D1373985F, 0x7FD8DA4C595D7ECE, 0x603217BAE3EC553A, 0xD67089DAAD93B3F5, 0x55011404A55B45FE,
+					0x1A8E16976A82D863, 0x1CCB238FD3F57D17, 0x6F1BD30243541224, 0x4FD98BE8F3DC801F, 0x2304CF35BC09397F, 0xC790CC35E7287855, 0x6AAE67F16DF31DCC, 0x4B1404D8F3409B62,
+					0x347E45023E480F55, 0xAF9024F64003030A, 0xFC96B7F6AC58A2CB, 0x4FAD998C0A74B3BD, 0x05073DC40026EBEC, 0xFB2CF90E27DE0B9F, 0x15ACDCE7FF9F8BF0, 0xA468C6E4DA244254,
+					0x20D583D3015BDC9C, 0xA00C1A96EFAA865F, 0x0483D3EFD93FACAF, 0x750BB2B1A142D4AD, 0x43A6166259E425F0, 0x304DD63FFE33C4DF, 0xB0DC174356BB01B8, 0xC9E0654322291267,
+					0xEF2FC3DC15420A77, 0x4FDCA3637F2340C8, 0xAE15CE051F9156A8, 0x89568F3A720D837F, 0x0F0E8AE456C7A989, 0x5FBC6CE59CE6D8DF, 0xD3D9A4725160BBFB, 0x1BA0B7A6B5478469,
+					0x654E1F1E32368F4B, 0xE03D7DF9D769A2E8, 0xF477903092320FA0, 0xF63B6D3956F0B329, 0x3B3BC118C792D49E, 0xC67C51F9DCDEB48B, 0x75CCB8846B51D4B5, 0x03655BF399F1680A,
+					0x33D26975686B7F4C, 0x613204F1BA829668, 0xC1DAD7ED0AF1A142, 0x3F277314405A50AB, 0xE53A5BCF0EB1B2BE, 0xF3A3344167CF8346, 0x81C717F00F5D902C, 0xD7C5E389FE641AF2,
+					0xCB787B837D02358D, 0xA65C7F8D075934D6, 0x70D227A84AE8FE34, 0x1D39E78775AF53B3, 0x5F337B8177FD665C, 0x78D24C4AF1BB1DC7, 0x752B7E4033DF0844, 0x5ED5F5D14F3003D9,
+					0x00E3A1F0749EAD2E, 0x7B22437B1CFFE43A, 0x075688AD5B5D16C1, 0x1FF964827230DE14, 0x885B7C7388C69652, 0x7B19070583CE4269, 0x0CB1D235135DC020, 0x7F36941CCADD62B4,
+					0x3F8A53E1E4842CEC, 0x2876AAE50C92705B, 0xFC95FE1BBAEAD8C6, 0x3E480CB97C321467, 0xA09FC80C1A115BE1, 0x7E51CA98A91A5D5D, 0x0B5FF756EFBD2D1E, 0x54E8C706E7366D4D,
+					0xD419E2285D61FA36, 0x5CF0B408513A3A8F, 0x40809113F9281AC5, 0x61A4868DA6BD70E9, 0xD9E5E38DEA398F9E, 0xDCB3B77922253EC5, 0x5C8FD25CE0D2D193, 0x45BCF4A5E4A2924D,
+					0xFBC442BFECF56BC0, 0x72BAB9646F123C20, 0xB2BA86E3000EB776, 0x7AFDD568859180FF, 0xF2D1298FBEC4E9C4, 0xC320E91869FC96B2, 0x7621D1B7A9F23329, 0xB852619724DA0B5A,
+					0x592CE480751E7E74, 0xFC1B8E7BCDBCA9EB, 0x2490FE4C897DB673, 0x0A6F047B506D7A3F, 0x3F1080BB4B249B35, 0xA4DBB2B884ED9698, 0x436C1BCB0FFA43A2, 0x7EB168C2A97964C7,
+					0xD786BB294089F5DB, 0xFD03F5A0BF26DED1, 0x680B781823F5B03D, 0xC05C8AD9E18CDB69, 0xBBFFA1C1224FED92, 0x6E24EE39D705A9F9, 0x840C1CCBA3C7A73F, 0x9D4EE1543A82F7B2,
+					0xD7B443291A45BC25, 0xD1000E406BF5EDFC, 0x05F4D9EF3F4BEDA6, 0x3B2088F144B19EE3, 0xFFFC07D2799E055C, 0xB1E21A8213EB75E3, 0x5FC4AD8DD9949A30, 0x1F1282C5051A443D,
+					0xF54A78964CCBD219, 0xEBA272CAA9DA7496, 0x0A03778A0B128FAA, 0xC1B2D3BCB476366A, 0xED87EDCA024F836B, 0x727730B45B37E457, 0x1935398243D400E2, 0xCD6F8BD2E6520F9F,
+					0xEE7D867EBE753615, 0x5481FC8F89B4F7F3, 0x0B4FF90D758CBBAF, 0xDD5086E8A8D8DED7, 0x78182947B6E2B6C6, 0x73E47FE12B6FD0E2, 0x61E32D626D516CB1, 0x90012996380C0ACC,
+					0x9FE52BCE493B123D, 0x4A163587E53C4398, 0x3F72B37D2260C7DC, 0x410987F83BF2FC5B, 0x589A402E0AE833DE, 0xDDA081365058CD9B, 0x7B09492D2E0EABE8, 0xF1481BDD7522E5B0,
+					0xF9D266077E2B819C, 0x48F5DABC592FF7AD, 0x87D345B0177CAEC4, 0xEA608F385AD4FA28, 0x49C944FFE334F92C, 0x6B61A67F32B0E429, 0x0DC696C59170E87D, 0x805D877C5A1BCA04,
+					0xB02C9011040987FD, 0x67E5259A333C59A0, 0x95CE79C143BF333D, 0x84F45199A0953A51, 0xBFCD73283402EB64, 0x84BE901EB08763CD, 0x7774C8FD70A62D9B, 0x0804FC256DDEE674,
+					0x239CCB6F433AD19D, 0x134FE0ADF6185062, 0x688662E6658A95BF, 0x4250220569CB13FA, 0xC8695933CA96ABD7, 0x3330714761F51B11, 0xED19FDA20E48BF0D, 0xA1364EB691AC1C14,
+					0x53BB50DE88660A9B, 0xD9920602A4EB9A71, 0xF2A7047B01EDC6CD, 0x2708C6B3FB719CC5, 0x98DC0248F19BCCD4, 0x7B2F7C18D0F88443, 0xAF80BBFDF0882DC0, 0xEA9273C1F50F3772,
+					0xDCBD7C6586943306, 0xBFBE5EE3C8CEFF4D, 0x6B3D439D917C4C99, 0xBD4FA8D01D992D1E, 0x47983650D278AE7F, 0xAE2A16DCC006382D, 0x52828F6AD05B378A, 0xFA7DB083AC763311,
+					0x1EEBAED5D5AA7CD0, 0xD41BA1F91EAB53D6, 0x1D766596DAEFFF35, 0x51086EC5B9FDBF76, 0x9BE6178ACEA1E5F4, 0x122AEAD3C83F7D2F, 0x7E69F4A7D71F4416, 0x54EEDC9613BAB7EA,
+					0x4D0C5561EE3FE935, 0xF5DF355C38677317, 0x71A8A488263DB7AC, 0x6D05671F3A45E00A, 0x8A407CE9B06985EB, 0x6F62C7D9FD550DA0, 0xD509C34A28B2418F, 0xABE4D7A9DAD5517D,
+					0xA9D98F722EA3F372, 0xF55C6B984DDD513D, 0x8C45FA052483A852, 0x420B2D83185DE338, 0x766D480050878BE8, 0x832C1D6250399FF8, 0xB7D2322C83A4AFE6, 0x428A7C2B58BF70FB,
+					0x47CBF6B0F2807118, 0x07BE81E323ED3909, 0x00AF211DB7782533, 0x35BF166BFA11C6C6, 0x0A5A53CCD1CE708D, 0x71224818B72CCC77, 0x437B52E534C6CDBD, 0x7457A52DE06913DC,
+					0xFBFDA3F57EC08D34, 0xE2D899D6939E7C74, 0x5019897AC3E36153, 0x8BB529E7947F484B, 0xAD25775503B3B6AB, 0x045DE2B03C05CFC3, 0x7DAD26148E752CD4, 0xA275A5BE7CCCAA11,
+					0xC4B6935862244BF3, 0x25BBE7913E0F4715, 0x1663E58951ADD58C, 0x86AF8BACAFDAB449, 0xAA218F036C3D8484, 0x685F9242C67B3315, 0x42C89A9B4ECD13B5, 0x9C6D0CB9368BA47D,
+					0xF2D0AF5E6CF6F348, 0x4F8C2E3C8E7B84E3, 0xD97A11E31319233F, 0x2F2FFEEF2D2A59A8, 0x1523588ED8B8159A, 0xBD9EDF5CF156DC15, 0x4CFE7350C9AA5054, 0x48BDD30CA5371D24,
+					0x9E7507BCC3807103, 0x978258EBFE261365, 0x7ED9EE337A7D802F, 0xDADF7776DC9AD421, 0x7526CD0CF9C304CA, 0x297DC719EE927799, 0xD26054A6848909F6, 0x0F5BAA460C0CDC23,
+					0x4B5D51811F7C96E0, 0x014C093F0CD56DCA, 0x33754341F7CE8A0B, 0xAA9C4D5DDA7653AF, 0xFAE9412B41F66DC5, 0xF4743C4167029EAB, 0x3A0E0EF3F77E8B2F, 0xA907C4B3AAC271D3,
+					0xB2FBA9F338921953, 0x6C13F0714578DEEF, 0x37E13605B4E1AF02, 0xC736C484147321DA, 0x7AE8D3C1CA12C6B9, 0xF77656BCCF118263, 0x720C707018B01C09, 0x6E917178F89B6F27,
+					0xAC6290FF3B7B12A5, 0x792A6BC41A101E7E, 0x097B77CCAC5CDB87, 0xD4F5CD7B6F68D057, 0x3D0422770A2B1B63, 0x6477D731A36D34B8, 0xE8F1DE65FE6C4513, 0x27A483DD61627417,
+					0xF172C9053BA80A2D, 0x381ECCB75E8894E2, 0x1AE40A730A1919FA, 0x3AEDE6918A186FB5, 0xCB7895179F9ACB8D, 0xC0A9F6F016C9DF5A, 0x9A3E581DCC34620E, 0xA145C94F3B995575,
+					0xE09DFBEEEEA1325E, 0xEF37F8919EFF5119, 0xA7C34DFCCC533A83, 0x0C3A229323CE418D, 0x371948569D4DAA47, 0xCFE1B52B68DFA227, 0x2817342B12F9089E, 0x988C724D38DE3911,
+					0x1F09DE29D71D5955, 0xF7E5D703724B7A02, 0x093DF4B2DC19492B, 0x3021CBDF91331EE6, 0xC47A7DC7A2B7A73D, 0x55609AC5B56526AE, 0x193DA2E8605D216E, 0xD5E295BB87B7B0E6,
+					0x9F6ECAAD9A06B662, 0x00716CC8D4016DF9, 0x318A7F0C53813234, 0x7E1954096FAD79D4, 0xFA6DD47B0FA6ED54, 0xD8176DC32598090B, 0xCC1C22B764DF211C, 0x109D91713A2E85DC,
+					0xDA52451C37652418, 0x2579AD9558D1CF07, 0x9E599506587AE9DD, 0x7D81DF1B5D6C35A6, 0x197C580BD4A82F9D, 0xF1A57BB0831E5D9B, 0x60601F894FC96820, 0x18896FE2C176D58C,
+					0x902DC9E51EFAF39F, 0x688447F49FAAF8E2, 0xABCCE99A674C972E, 0x3925BDF76D790AF9, 0xD3564FB5BAAABCA8, 0xF4E6E62BB5EDEF54, 0x53E730DA12F8689B, 0xE27D5274658C8DC9,
+					0x43E705D42F1147F8, 0xDFF5032DD012F2A1, 0xBCDC40B66ADE7784, 0xCBF800B1D4D6DAF5, 0x458A8DA9E552D9C8, 0xF416EFE1F3EFADE3, 0x1117FD64715F2AAB, 0xE415B9201EA99132,
+					0xC4707229CFDE3AE3, 0x105CBDD29E608AE4, 0x8E0CACBF88B73905, 0x2CCECB90D8EF827A, 0x0A7929B563D1E5A3, 0xE09218BF85E5761E, 0x10BF05B9C42A3B60, 0x0CC6BA773DFA4980,
+					0x2061A2C628948247, 0x1170580FEBBF6590, 0x2E238BEBE5275D4C, 0x0C955F985C610DA8, 0x840B9F2D78EEF62A, 0xAEE6185778C226DC, 0xFC753768AF58B052, 0xA8FC087D7C8C0173,
+					0x4F1013CAA44ECD88, 0x2962172E79749200, 0x80A5259F217ABCC9, 0x4F224E8FB42584CF, 0x58507F78F661616F, 0x56CFAE0FED12B216, 0x6866A2D825B96991, 0xD468F1377EADEF85,
+					0xAD6B707CCDE9A611, 0xAADF92177DF48776, 0x9B0F4AE20BF41B38, 0x6F3F519850CAA767, 0x7EFCF3E96B727CB6, 0xE045C580CFE0974C, 0x2673296A8BAA67D9, 0xB7AE803BF00D7F49,
+					0x9CED6823494A0D4B, 0x2B1A7A8331DF8556, 0xF1BC9C8C72AF2361, 0x3842AC6C00F5A093, 0x9ACAD7E8466AFAA1, 0xF50D2DC5126F214A, 0x2394DE0842DDBF4C, 0x16AF708E029FAC18,
+					0x826850C8F93B2161, 0x57B577F2893F6424, 0x274713C47E6C7D93, 0xD033B44069AF715E, 0xF48D3DF9E067B643, 0xF170A4188BA5B689, 0x1DCB7911A0BE0857, 0x32C5013F0D324194,
+					0x4594EB9B6F1392D6, 0xA80F9B8B73DEEBCF, 0x9E3F743D9A89D53C, 0x6F928969F26EABEA, 0x37D2F4D2BBA7C7D0, 0x2B0ADCD8C614C698, 0x244F53C3D6D738F9, 0xE73838370216A6A1,
+					0x3FA6FAA825BE11D7, 0xB6FB9F6C591DB905, 0x0EFE54C2ADB1F379, 0xF638B43A5A3FE52B, 0x5BB7B99528319365, 0x651EA72494441D28, 0xC99F6CBCEBD6261E, 0x3C5A8A7D9E981D4E,
+					0x6B587A8DD4A04A53, 0xDDF808A936B3FE63, 0x557B93D5D4DA1053, 0x451B214E7BB6C643, 0xC0081A72BA5274C6, 0xDEFF297EFFA58EA4, 0x5D6B3774DD867ABE, 0xD34796EA632E9413,
+					0xEB051CC4F0FEA22D, 0x02D4548765529899, 0xE99438DF8C5DC493, 0x36DCD700E9E28B67, 0x25FAB1884FFA3C71, 0x5ED2A9BAA974AFEE, 0xB4AF6B92F3B2330B, 0x20FC214433C626A3,
+					0x6A4E56865670D42A, 0x9F01D0C6B8221D64, 0x91D6EDB16A54201D, 0xD65D616D7C7E11E9, 0x225050A753B7E0D5, 0x17E2F28963C391AB, 0x920B6109C20FC54C, 0x40BE2F6FC1CF8538,
+					0x49B78D516ABECC0F, 0x2B851EE14E0C334E, 0x19DC34875404C1E9, 0x2ED59C56F6931C40, 0xC1BBE7D1CAFD19A1, 0x6F825F7FEC01A6ED, 0x699E3C9C2D2065C5, 0xA125ADA746FD8CD7,
+					0xEFAC1EB44677AA59, 0x9FE5BE6975D4F7E8, 0x28CFF794B1161F23, 0xE74E8290DCACFBAB, 0xF7702EE0191FF138, 0x325725E82A7FE98A, 0x0B8012CEABB1020E, 0x31EDEDBF65309780,
+					0x75DA774D077ADE7E, 0x39FF7BFC0CD9715D, 0xE5BCBCC98613D88D, 0xAF553DF39A1CA268, 0x22B74160FFDF552D, 0x43BF1D13C8A847F1, 0x3B94B62D6AF69109, 0xBF21FB7A74A69B61,
+					0xCFB449261C9BD9D4, 0x5D77C55815425BF8, 0x32871F812AB0EFAE, 0x271B1A4B8A428AB5, 0xA3A4502CD11DB4CD, 0xE14479A0D12BB1D0, 0xB4D854296B90A120, 0xDFB58E0CF488AACC,
+					0x72BB7301EC4E4E21, 0x46C5FDC2C3DA75D8, 0x1CC19B57FB2FC5F5, 0x9BC396FD6B43ED3E, 0xA8B558CB11F1B779, 0xA48099681E7EE0D6, 0x2735F31FACDD341A, 0xD500BAF48A5D8507,
+					0xA38E6408DF907C7B, 0xBA87439782392079, 0x4384A3C2C6D97F45, 0x0195E38C17D2BE07, 0xE111151562C55903, 0x5361F492C37729FC, 0x08DCA2EC35972400, 0x642BED057953686F,
+					0x37C2AFD99A348428, 0x86F118E8291392CA, 0xECFA7A748F82D35B, 0x186758958E32A645, 0x3B5F4D6C31EC236B, 0x810D1C94379E326C, 0x02E1CBC9058A982C, 0x6EAFEFEC905643EA,
+					0x46C90EDAB1C8A712, 0x5568F5BB843C59B5, 0xF56CCE8572011C18, 0xD4358260D7490A82, 0xDA4E9A954EE7556C, 0x50E7A6F966BD8001, 0x00A35B2539CBECAA, 0x5E3187AF113449AF,
+					0x50EA30601604BF10, 0x937AEBEC1AA3EA49, 0x24B62C3B1C6CBF24, 0x0B3EB545D77B24C0, 0x349CDDA31284A979, 0x7EC41372FEA10ECC, 0xD5DF516846451816, 0xBB342D2DBB18E93E,
+					0xE32E055A0DB6470F, 0x97B6636F2995D8E6, 0xC38BD6BB8793E5F9, 0x7D72E32442CD461E, 0xFF32C64549E6CDD6, 0x73CBA78BD035BAD4, 0xD585A511AF1D9D6F, 0x5CDF5371900D046C,
+					0x7FD41C29C5F45703, 0x1E4EC99963217636, 0xAA0398592E0307BA, 0xA5D5E20273F11ED3, 0x40A81A455A880FB4, 0xB2B4F737D18B1F9C, 0xCFA9F3996A7149D9, 0x5BB0C57CEDA17F62,
+					0x58BC779357EDFE28, 0x9937CBF9A6B021C4, 0x391F28485793CB41, 0x30490C272EDE1597, 0xFA8CD0B3A8053A09, 0xFEB9FC47C4B52C50, 0xD08998A6335E8AB6, 0xC27BB1BC32D538B2,
+					0x116C633089DFCF28, 0x34B06530CE03AE14, 0x86CD025BFBDBA487, 0xF615929FD504DE4D, 0xEAAEE13B62D0F246, 0xB6B3691C865AD219, 0x7035937BE8DBAB63, 0x1164CE6C6E4BA455,
+					0x4BD1A9C72D181A3C, 0x6F0AE0CBB181AC7C, 0xAACAB062FC915852, 0xD7A608D10ED6D71B, 0xA38E2B1421F21617, 0xDFB7CA8A51C59ACC, 0x4F8C0BC27C741A8E, 0xF0DA01C5B129307B,
+					0xE1D973022FE9EB03, 0xADEF85381F2FC1BF, 0xCA683068A3A00886, 0xDED5A6BD2B2C9E99, 0x7DD1AA2C0142EE56, 0x9F237F8AAB54DFA6, 0x8EB5D0C500125BD4, 0x9E5702504FD5F6E8,
+					0x6FE1E2F000F89E36, 0x6E360E80056AB257, 0xBCB6CAEEED06BE7F, 0x4AA039C44AC7DC28, 0xAE8B0E8A7EDE5ECE, 0xE9556D7967D340C9, 0x0D4899FAA50D8899, 0x4FC76A4C398A25F6,
+					0x6447DFBE4E529A4C, 0x9F45DA4848A3F44D, 0x92CDA1F8D9DECA9F, 0xD9D6C7FAFEFF930E, 0xA1833A56D3AF63F5, 0x03210529385B9520, 0x5C51220A59CE1CBD, 0xD770502CDCDDD4D9,
+					0x1BFE9C02A1901661, 0x9E99D7376C581819, 0x377074964C6A65AB, 0x86AD461B66E8AA37, 0x057C1739CDA409D4, 0xD13BC4B76248E2B5, 0x1085AB5D55DB9DC5, 0x0A2D9A156562997C,
+					0x30399504AFFBBABD, 0xE0421D55412B5CC0, 0xF04A25625E51A25B, 0x36AF17D9EF38E6D8, 0x77830AC1EADD786C, 0xF7C95430F2630E5C, 0x20AF4829C33A0D11, 0xF5BC82D8795F7AAE,
+					0x125FAAA43963F715, 0x3BEEF10897DEA1EF, 0x9564BD71EB5900BE, 0x405B800312901832, 0xD3A8785C07899A21, 0x179F70F973318EB1, 0x618F4443701AAC46, 0x125674C6DC23E8E0,
+					0xE85839F80973BAC0, 0xF849C607E1A5360E, 0xE9B78C66EF822294, 0x5348EFA709AADF0A, 0x04C93D8A5A565F65, 0x5B50E6328A9ADA34, 0x948DA9EC73EF098D, 0xFD1F7CAE4FCA04F5,
+					0x5CB6172B1CCE7D99, 0xE6F9C3593B4E8BB5, 0x824D1FD517596C75, 0x3470CE3F2250C5CE, 0x665936FFE7B9D1B1, 0x024DAC79678AD830, 0x55E93FEA90E2784A, 0x9802448C5218DFC3,
+					0x16948C9CA7618F2F, 0x386E52006282AB73, 0x81366BF72496BAEF, 0xFEB5569EF6CE6285, 0x7FF4C7128AC03D83, 0xECF9E965B20D82E0, 0x01520FEF09B91DBB, 0x060505683E4488AF,
+					0x519B27E9ECE01748, 0xD1D00AE8C84BBB04, 0xC2AC8E2F41D7C8C3, 0xF6B0909AD38102DE, 0xB2FB50910AF56A5D, 0x4BD7858749612113, 0xAAAC3AFA94219508, 0x0AF25C87D53000F7,
+					0x9474BAF909ED5DD4, 0x0819599ECB755B3E, 0xEC30620CA5D809C7, 0xD072325C929EB6A7, 0xA675E7684C8152E5, 0x8D1375A7A3791583, 0xE958F71127397B07, 0xFB9FCFA60DA0A285,
+					0x5023290F8018B9B8, 0x93BA8734DBE4352D, 0xBF83FB2237F133F0, 0x0E3577BD711E0CFA, 0x56AFD637F5AA2BF6, 0x9B0740EAB76B905F, 0x0A1CC383C4390E81, 0x456D2A9BB21EC5F6,
+					0x07A31E3ECA92B978, 0x38F9FA561CEBF428, 0x54C1C403F37FA9FB, 0xCB9F05CDB6042D04, 0xE3043D87C0AE17DC, 0xED4B4DFE0FF36AF1, 0x73C1815CBC16C0A0, 0xCD60893290DFF755,
+					0x076C5E999D5ED163, 0x8E42B2896B5D718F, 0xF07D4A91AA2E1E4B, 0xD8D4835384C9006A, 0x64B9FE2E6B0E06F9, 0x416274A7EF0B0B32, 0x7F4FA5FE4526347F, 0x6BC11A136477EBE4,
+					0xB410876B474C4358, 0x28AE6A2A5A9884B4, 0x3332487210E2471E, 0x69C4121159AE0E13, 0xE29E4B0CCF990260, 0x295C5B24AF958F2D, 0xFDE6701812047560, 0xBF194F1F40EDCAC7,
+					0x6357C6A222CB90BF, 0x1D19C52C95C157E2, 0xC77040AC65ED754E, 0x79C8BEF8CEE69DB8, 0x2A6ACA45B1334457, 0xE719E520466B9E2D, 0xA1C6577F8BA53FAD, 0x793DECE0B4D8333E,
+					0x31547E49D1755F08, 0x4AC01D6422DA2E88, 0x118BCB829904CD2B, 0x1C5B91A51D51D543, 0x51806F1AB8AE0907, 0xBCC16C9E56621623, 0x3F540C6E6F3C8C56, 0x7878D1E5A82F9B27,
+					0x3ECCF4BFA5F9DDE5, 0x49DABB3BFAF96B4D, 0x88825ABE1B477509, 0xF3576B32AEC5C2A7, 0x559B85EC611D98B1, 0xAC96C5C87EC01D63, 0xC9224A18449B3AE0, 0xC5B5B3C1FCFDD751,
+					0x801A6AAA8EE5B08D, 0xA8C06EF9DC676358, 0xE473C931ABAA79EA, 0x8A73B431C16D7732, 0x28DFD97DE0F04488, 0x95A7CB25ED8C72E5, 0x988256E26B94158B, 0x9855D040339ADD9C,
+					0xD57AF26B568C04C6, 0xD8E36EF1D1814898, 0xF3B069F27BE6A344, 0x2AF58856AC2B3BE7, 0x0E4506093F32B834, 0x4F3F1C358BFA13E7, 0x3CFA7A90927852FB, 0x315695881DD3E36E,
+					0xFC2E602B3360BD77, 0x11B50061BEC1EA06, 0xAEB3247E42B73982, 0x5EF01D6C8DEA2078, 0x41DBD97C0AB22D14, 0x17664970FB8312C2, 0x020A6BF51EA73F51, 0x3C605B7B3180E2CF,
+					0x4FDB6742B1B3A182, 0x6DB2F7EB7C7A415F, 0x09BE5925C1904C56, 0x753F80BDD18BCEEC, 0xE35F0FF25AB1551A, 0x28F852508D2A5FA5, 0xF79F59FAE258A23F, 0x5902AC18D9CF17E4,
+					0xD293B9AE8C7B5323, 0x410E3367BC575B4D, 0xE17931A69EBE60C2, 0x38B8C8A109B5C968, 0x6E07F305CA4348EB, 0x65D134008C968410, 0x3A5B1FA177EB8E78, 0x7926450C5295D3EF,
+					0x96622CD8127BE890, 0x89AB82F2FCD4EE09, 0xA8887B1A5E57402C, 0xBDE537578C5A5691, 0xDE8D2698674ECEB0, 0xA8A4F8BDE38948DB, 0x300CD6ADDEBD9931, 0x2336E87F7BF961B4,
+					0x64D3DE2BEE6BA1A0, 0xB57AF848014652FD, 0x6D9D1F83CCD35D04, 0x264039B36E340D13, 0xE0E3D3D7871FF5BA, 0x8777E35298B985E7, 0x2C08662D4A341B1C, 0xA18247ED66BC530C,
+					0x687B713E15E15C88, 0xB8903894522F979A, 0xD8DE530155F086B2, 0x346CEF5A70964D53, 0x4F0CED4A8ECBDAEE, 0x131ABED0FA5294D3, 0xFA0FF5304481FF8D, 0x1E9277BB5CB999C3,
+					0xD8EDBFB0A06B893D, 0x9D11C4A24D1275F2, 0x4F9CCFEB361366EE, 0xA6553AC2137A9583, 0x2E35BED35292822E, 0x62701D9E17C3E146, 0x01A6A1F60C35AEC2, 0xCD663706F0EFED5A,
+					0x8A8ED9EF1F4C93BB, 0x480AFACD03520D8A, 0xB9D7E261464DD388, 0x7E25E9BBAADE10A9, 0x412F71F21732A890, 0xAE816439F28AC16A, 0x2CDDD3CB95C05F48, 0xD80921F66D63B36F,
+					0x5D6F556065005206, 0x46E34B51067BCA77, 0x8292E974AFA908D7, 0x3D2756D5BA41EB8F, 0xCB16A4355F2B1F57, 0xDF8BC0F339727648, 0x42A045060C13912D, 0x70F65C9104BEF125,
+					0x3761ECC892D83CDB, 0x8F979B9B4E2B3ACD, 0x9307F63DD7D17AB5, 0xA1ADB6E2DB4F7574, 0x10740A6398AD94CD, 0x785A1D6977F6AE01, 0x6A3D65FE05318871, 0xE429C165B0C9F0CD,
+					0xB482B0BAEFCD2DFD, 0x7A0FEAA1E52C5D1F, 0x6043F511BBF04CAA, 0xE35A6AACABDF7B1B, 0x150ABD51DCF4AE9A, 0xD6DCC4F52A4FD13E, 0x916E5894107C6805, 0x800F581B07BDCD2B,
+					0x85DE740BCB81529E, 0x67278250FF93B859, 0x012CE2DE2BABF012, 0x5E15513F7A7639A3, 0x0C5374944C7D6158, 0xF2CB7EA4D1160F37, 0x663F5EE6BD3EC31B, 0xC0EC0C584AD03689,
+					0x14C11EDA20EC96F1, 0x088D510E6E70E836, 0x1FA58CA579EC4422, 0x23B395A1C2F97D75, 0x18F6E4721957D83B, 0x5C1FBC0D2D213F1A, 0x16AD35FFD868F3FE, 0x49D14C25436AFFB8,
+					0x73B5ECE178042E7E, 0xCF2B40233D33C675, 0x3BDE0623BCC0F659, 0x40FC49617ED93269, 0x9347C59AE487CBD6, 0xC74F20E1246D0068, 0x3FF1DA2824E2E348, 0x3076EE76B1CB29A5,
+					0x417D907C2896571E, 0xE2813A0FCC9A004B, 0xB52899B6AB523DBB, 0xFC94618400481BE9, 0x9A06F50FC17E7426, 0x5C29D4F0040DE61C, 0x7A454BFE6D877C32, 0xB45AAE48ACA95796,
+					0xA021C3EB44C5C0B8, 0x31B4A178FDF6AE38, 0x00CD4DA25E90A6E0, 0xA84FD84DAFF0AB69, 0x23C4720D6526F46F, 0x22E54A55B7924ADF, 0xE79C002D676617A6, 0x905E614D7CB227E6,
+					0x094A207050FF43E8, 0xE63E43E4CF24695A, 0x466896FC69228C4B, 0x78D5A6CCE0CD67E3, 0x0E5BBAE2087D7C4A, 0x0122AD71CD621732, 0xF502B87544672AF0, 0x470C03EB2E8CFFBE,
+					0x0D5D55B3F26F6179, 0x5AF7F8B1366EFB14, 0x2BFBEF299BCA9B03, 0x5A4C059119462F60, 0x39DBC44D154E067A, 0x17F4A0DD5637870A, 0x04089B9C1318651F, 0x9DA6964BA535FFAA,
+					0xA5ABE3AAFD47CAA3, 0x8C9FC82D2252B786, 0x4A73CDE91320F707, 0x67EFD6C7E672F0CF, 0x8CA8A0EFC7BAF1FE, 0x0632D3B67A5DB22B, 0x998D751E0E59C7F6, 0x59D5BD0B682537E1,
+					0xEF2D9F2DE68A8ABD, 0x6FD56F126F7B14E4, 0x9155891C0832FD20, 0x96AFA87CBBF44CC9, 0xB6C9CB5329E98720, 0x623720B6E37847C2, 0x18B300067B88D463, 0x842C41D348301903,
+					0x2CA8C6595B39AD28, 0x81B6FD5D2B285C70, 0x2EA6916F007FF27E, 0x225D0C6DA4E22D11, 0x2CED27358BE6AAB4, 0x2C73FA70FD641098, 0xBD4AB3EBCA901EAB, 0x4D92A3610FEEFC9F,
+					0x7687AE0650604E81, 0x87C92E685F80813C, 0x82DD2C91356D4E0F, 0x7B0B9D268BE23030, 0x963294C60D52F2BC, 0x858D29EC8BD91FDF, 0xFF65C594FDB40A33, 0x4E3A74381CD38861,
+					0x61F7AB2EB118A05C, 0x6CADEFD2D6308440, 0x3F4EC513C13212A1, 0x2837A666A55CA8F8, 0x77ACA36272E7CB1A, 0xAA8DA07CC5C6EE00, 0xBB3C40146952EF55, 0xA3929BBA1EFC649E,
+					0xDF15D5942AE0C278, 0x495E50CA774EBE93, 0xB5275A5FF879CA90, 0xCFEB66432BC4DFB0, 0xB7EB286E71E8626A, 0x5BFF5AE6FBF36CBB, 0xFCEF657138855F46, 0xB674B33545ED0AA9,
+					0x91FD664D1B8439CD, 0x92E874C48858D115, 0x05DAC1CF3586670A, 0x9676E8003E2A987C, 0x628F6D214709DF7C, 0xC0D57BBADE9870EB, 0xD36B2E8BC4A2FC1E, 0xADFEB0917C0C7350,
+					0xDF5DB0FE1BBF0984, 0x875B3D6E4028567F, 0x8F57D57F08876739, 0xA92B07C7E78F20DC, 0xF9F816175AB42A47, 0x6F87385F9C054D9C, 0x121BF0A9E83EA6E1, 0x58EAD85ED1EA8BFC,
+					0xB448E91369E5F50A, 0x2285FEA1F7916FAB, 0xCE8A4BD1AB962EE5, 0x9B79E60C5790D218, 0x88653EAC17EF2856, 0x3B8B847BD45DBDBF, 0xB3E74B998BFD5CBD, 0xBDA8F4E74EB85147,
+					0x7090A59C48CB7F46, 0x2A924AEABB34776B, 0x36365FDA939E2D7A, 0xD40B0A739CE90B19, 0x5C511FF8BE48843D, 0x560520538F5AE821, 0x8C98DF0A73BEEA7C, 0xC89C700C7C1BE632,
+					0x78803F863C8703BF, 0x6A298633F105A0D6, 0xDCF5BAEA680D1399, 0x0233BD8CB233C9E1, 0xBC3E091797B8E255, 0x1EFFD09C2E222AD9, 0x37E5FD100576ADB8, 0xE188F2A59AF0A185,
+					0x2AD665029BAD9661, 0x0D4C0C30AE5BD3D3, 0xA8FAC763401499A4, 0xA73346A582E0A220, 0x537C4F0EE3F73D3A, 0x05C5A70E0A6D0861, 0x8B44498A487BAB3E, 0x1DA60C5CAB9B266C,
+					0xD1E10FB661207E3D, 0x21733FD9CFF630F4, 0x4CEE628DE88FC2C5, 0x689486300F587555, 0x15FC2A53FD572EB3, 0xFA8FC1604D2A620D, 0x4031D72904ABD5AD, 0x929E1151D04E00D9,
+					0x9320B06403765D10, 0x33FD2CA7131A4A8E, 0x8E81D0FFCB7721EF, 0xCF3C43768FCE8088, 0xE40A8BA60E7ADC29, 0x43AE2244F5B3D7C5, 0xC438313CD88061F4, 0xF8596477572EEC59,
+					0x17DBA1E69E01D551, 0xB67BFF14A8432553, 0x23B3F81311F44B0A, 0x236B6E7694164352, 0xF19DD3BB3BDBDAE2, 0x52BE86381AD67A53, 0x4FB8C82A7DD319B0, 0x624E41C34EE76303,
+					0x7443B53AC91FCF3E, 0xEC83DE7CE3FDB65F, 0xA3052725B154F978, 0x539DD584C9800D1E, 0x7369192E836BB08A, 0xE8EBB434179A8BA2, 0xBA660AFE37895B25, 0x9DDFA0D96AABC6F1,
+					0x6E7BE34B1F7DFD72, 0x396886AD67B5D8B5, 0xABC3593E86579F2F, 0xCBD1D83CD153AC8A, 0x76633E8E359DA4B2, 0xFB202CF627EE4024, 0x7DB93202F0CC5BB8, 0x977BEBD2D09FDFB6,
+					0xCD80198909D40B57, 0x507303B8E78C30A7, 0xB7308F9975CA0D6D, 0xE7AD819840B0102B, 0x1BF84DA5EFAACAAD, 0x5126679DCDAF4114, 0xBB7BB5A6F5CB862E, 0x8B53714AB9092B4B,
+					0xA4A5EFF7355D2C0F, 0xD8EB3BC4B8E9CAFE, 0xE8AAA27BE38C88EB, 0xCDC6AD00C3E93F4A, 0x88A9C6C7532B49EA, 0x5C2FD14DB8F05E80, 0x39C336C917E3B678, 0x1D1BECB9442486FC,
+					0xB984789D17BDC99B, 0x1E4A0E64F5831621, 0xEC847ED28E1100A1, 0xAFD793F9C17A6D0C, 0x31CDBA41E35462D3, 0x977CEC11B610E802, 0x158DA10973973656, 0xB9B8EA22F57C25E3,
+					0xB2024D51D83D2ED1, 0x38ED13A0D9E022CF, 0x3C8A848586AFBE82, 0x2F8075A2C129B781, 0xCC848DBCA19557DA, 0x8D24526D8FCF8102, 0xA9B41DAD9A1AFC2D, 0xCB2F18D3CC669DDD,
+					0x3029B7F758344A30, 0x49E4CCDF12BC0510, 0xF5C011F0FD17562C, 0xA411C253325E7EBB, 0x2A393EA7B8FF9D79, 0x1664092C7A3E80D0, 0xC199EB855D229385, 0xA1E5E365000E5D3E,
+					0xFDD9F33DB0DDC8AD, 0x3FB517B05783C331, 0x12F11D98BCF1C4E5, 0x2B66F055E59CA325, 0x2D88739BBDA992B4, 0x55A0EC2D9303A6FF, 0xE6EDEC88F76AB514, 0x81C61F05D5F07DA5,
+					0xB00ADAC8FC1113A2, 0x06E45CF6FA14D535, 0xDF5E3533E7AC4868, 0xF5B9608A34BE61B9, 0x56236751C43F4837, 0x6C9B3B98A0CDD07A, 0x38E34E338E8F7583, 0x21CE27089D778816,
+					0x5EFAE7949AD7E7E1, 0x834FD33D38E843E5, 0x862C1324A2DB6A5C, 0xEF1D6D5B2C47FA25, 0xF1DE56416DEC6ED8, 0xDD9014CAEFFF79FA, 0x0AB50202D3A5FD21, 0xDE4003DEE22999E8,
+					0xE3B8A0F9546C7CD3, 0x54D053C6AFC2B4B7, 0x7426781C2CE96ADC, 0xFC0880082BF08630, 0x39AE62471919103D, 0x9B9B4643CA2C1B01, 0x3D243EBD791DA4EC, 0x07683BBFE2715E70,
+					0xF3028FD03AD13DC8, 0xD598520485908233, 0x5B702BA8DE46E0FC, 0xCB6AFCE873B9EF08, 0xCD77E1BA8CDC0AE8, 0xA5964E4801E27893, 0x0BE6243C52AE9CD9, 0x2B665846580C9830,
+					0x57E379582B455A59, 0x6ECE63AEC98848D6, 0x7CA5EB6E78935267, 0xBBE163CBBB733CC7, 0xAA29A0E9C02E6D0B, 0xF37D9DB972876535, 0x3250EDDC8D0A3710, 0xD73C509E72DFEBA3,
+					0x8854B09ADC91B14E, 0xB61E8DDA133C021A, 0xBD282247DC44A0B9, 0x3B517B3443148C70, 0x13216378D80B2FD1, 0x8629DD29C245C233, 0x7D8572B9205494D5, 0x53F79C4D00B63DD8,
+					0xC440740B056F7B86, 0x7C96986BD015ECD2, 0xAC9B3AEAF42DF9F6, 0x0DA38EDCBD5E66BB, 0x2C0D95D97028A19D, 0x50279C8719FEC637, 0x66CC136177F086BE, 0x27C0BE2BCF7D608D,
+					0x4F6C5CF7015FF7EC, 0xFCC231EC267BE573, 0x0C58F5963556D940, 0x6CCFDFE0883AE82A, 0xA89A73BCF41D6644, 0xD331CABE701F4354, 0x699A4B6E85309DA2, 0xF70F3EC8CB37A292,
+					0xD6ED9C97B2C70503, 0x4E80C514081C098C, 0xBB39223995023EF9, 0x7555C82298B16F9C, 0x503755F22E9BC609, 0x09EA7FE0E0111591, 0xFB322FA195E7DA84, 0x004010CD5AF5C325,
+					0xC5BB7C529723137B, 0x3087745DE00944CE, 0x6616C7C83473C3E8, 0x2CBF06D65835F65D, 0x67E1F9CEE02671D9, 0x29019DFD65DF7B76, 0x8435C9F5DBA07784, 0xA2D176FCBB78C261,
+					0xCB954CAD7D629D33, 0x0822A36E195F00F7, 0x17C87C2B0EDFC1B3, 0xF6FBB1BDADFF9D2C, 0x4235180927F19CE4, 0x23CBECDBEC736CA3, 0x65F3F00FB1ED3098, 0x13BB72FDBBFE9FA8,
+					0x6BE639DABD17D7BC, 0x3A166B931B9B68BD, 0xDD2FA71B86DB9E32, 0x2B46C53F02F7A59C, 0xAAAF1EF5C062F5A9, 0xC97F21A1A8674905, 0xE3F69DD66AFFAA29, 0x5559E20C2260C36E,
+					0xEDB43FCA879229A3, 0x14059F7123D61C49, 0x809A22471562054D, 0x2B4210168D0BE44D, 0xB268A7C7C2F8A72F, 0xB6F85736C1BBCE91, 0xB502795B13CA0F7A, 0x3AA0B796633EBCBE,
+					0x0F925B13D9C188C4, 0xA6D2D15E4DF030D6, 0x71ED65EA89072397, 0xEB738EF79CDEE934, 0xAF0BCB4E10865E76, 0xC61F40C8DC75676A, 0x14ADE4F6B2964B1A, 0xC19BDA2132ACEB52,
+					0x700A6B6483DC94EF, 0x80721BE45233EF0E, 0x63D27F68FB0706D3, 0x2C1B336A99173FFD, 0x9904E233A2E64EE5, 0x822A3DC7A20ACA3E, 0x2D946B2CA48FADB3, 0xA69C9E7291CE7C97,
+					0x550F4B044F105DA1, 0x849AEFCB29D1C142, 0x016842725CB222F0, 0xE1C8A943318E2184, 0xF71E1D452A9EF30F, 0x997F8B85A4E81FAA, 0x844D6A284E19BE16, 0xA3405E556029C963,
+					0x709D5AC2E587AADF, 0x7D3522989519B983, 0xDD8A7B9528700E5D, 0x80F4004A5D719B01, 0xB246B831673F106D, 0x7DBED2D2CFD7471A, 0xD4C453FDF3437576, 0x8C2FD1C1DEF8C9F1,
+					0x5E544FCFAB998414, 0x352AEC55C2E77099, 0x9D5AB18AEF42CDEC, 0x39F84E9076664BFE, 0xD7E2A2D213D4D707, 0x98D7100E2FA7AF1A, 0xD23C5A9C9DEE1E79, 0xFF6805D9943046AF,
+					0x6F6FA1943430F94C, 0xC5408D5F1A27466E, 0x15ADC804C39113AB, 0x9C8B43E866AB6264, 0x0A423311AB6F63CB, 0x248E2EF3F30474CF, 0x715CD87D17154784, 0x625DA4FCF3D8862B,
+					0xE72E243F7BC76BD5, 0xCD77CDAEA3F62EC8, 0xF4F80FC227E92721, 0x98B8AA8261D4E7E1, 0x8A97BC9059BE3FA8, 0xECFF5B7070F673B8, 0x1C99C0BFE987B4E4, 0x78A612BD087DB90C,
+					0x8B39B545A9AEA177, 0x0FBD0DC1E0B8195F, 0xA4953D50DC7DE004, 0xCA9E817B32FCB586, 0x3DAB08AB7B9F4617, 0x8F96FBB45D5454E7, 0xB0113CEEC13D2534, 0x23696713674DFC84,
+					0x5070E3DFCA80B581, 0x9B5A193B5F2CEF8E, 0x1092529E216AD0B5, 0x980CC8628BC4D6E1, 0x9AB18D99C1627F46, 0x3BEF8C294B8173C3, 0xBE64EC0DC4185DAE, 0x2A9599AF447C212B,
+					0xF5EC076FE28ACE21, 0x929C3F12A8F8499C, 0xA78AE09552768F64, 0x51B567397EB26FA4, 0xCC47E154738EF892, 0x34A8728A6BADD85D, 0xEDEBB9EEF735D5F3, 0x9BE5DB6EEBA9BBC1,
+					0x379BD055F8FE257B, 0x39B77D1F113B7ADF, 0x9180649D4962A94C, 0x57C53ECC73328354, 0xC26E6312ECAC9817, 0xC2B4EAB5D5CF463E, 0x4263134B77CF20C7, 0x45C1FEB00EAC56D2,
+					0x5A764C3B7D76BA24, 0x2D276DE84B733948, 0x515928047A6D164E, 0xF67C6B4E8488CA76, 0xEB186A3A2E4BB70A, 0x0EB477CF77613D77, 0x0D96615F6B513E36, 0x97680C2D5127CD05,
+					0xE70BD1E103D80BF5, 0xFF322D92C6C719D6, 0xCADBFEBE051B0C89, 0xC56EDB1FC9F329FD, 0x4056E259AB5F520C, 0x2E8281F4AB5CA828, 0xBA3265982C312B79, 0x02560A98690E21C8,
+					0x20A2FC29B0E19E4B, 0xFB822966A5220C2F, 0xBFB2B2D5D84B1F44, 0xF5D1220F71378AA3, 0x66C764C03176AAC6, 0xF2D581159C61C8FF, 0x87644EB4EE6889DE, 0x2C9EBB23B72309E5,
+					0x910C6FF64B44C675, 0xAAC362AC603D3D14, 0xF05D1569F495952F, 0xD5B49BB639DEB97C, 0x95DAAEA9F4A23D21, 0x016EF097A91FAF55, 0x81DCD3711C608738, 0x576C1809E65092A8,
+					0x21936057972B3771, 0xC2AA91468ECE9647, 0x01964430FD41C4BD, 0x01B3DCCE7CCB71CA, 0x44A7936BF1135E37, 0x49168B50BBEDD4B2, 0xC7ECB5DBC2B73B56, 0x393C75BE4019F200,
+					0x305DBE58D98CA001, 0x5CFE05F05C82B7DF, 0xF73C477A81E3FBE6, 0x1D77B22133BE501F, 0x43857AAC407158FD, 0x7EF7B4164697C7A7, 0x8BE9C474BBB63E75, 0xA8168F947A9C41AA,
+					0x3AD32721298BE894, 0x5DB4460B5CC7E1E4, 0xEB9510DFCF64FB35, 0x2961E1B8BB49D416, 0x7EBA751E7BF8E9C0, 0x0DF966691C030D0F, 0xEE72D90572225649, 0xBC51EF1C7B8716D1,
+					0x8A297678676B046A, 0x6342D7672073A9CE, 0xDC7E0541D7FD4A24, 0x68B1FC50E6A1BEA2, 0xDA75D165EE029A29, 0x7A7D882677DB02F6, 0x0C58F422A74416FC, 0x3E222E805812A117,
+					0x4147DE614D3459A2, 0x5AAA61D0B79AFA43, 0x3BE50E578744F0BB, 0x727C662F4837BE91, 0xD6295BD9C488BDE5, 0xEE0E14E1CE7F5C54, 0x8F9357AD09CD1FA2, 0xD57C03BBDABA4102,
+					0xCFD0A5B48E8E8FB5, 0x408A4DBCFBB2A549, 0xC8CA81D2815C084F, 0xDAED0BE72E6D8DA8, 0xA5917C1E6594A251, 0x38186DCC74EADF33, 0xE692F311F11D218D, 0xDE12E6AABAAA3FE5,
+					0x731DADAA5D9495BC, 0x1D69413A0F58EAD8, 0xB897D6698846C8AC, 0xB3C08A65FFB3CBAB, 0x1DAAF7D5C08E750B, 0x03FF3521A2423624, 0x270799E25832BF79, 0x56129338D0C61098,
+					0xC62BD24EDC818716, 0x44BE3718350ADDBB, 0x15EA597113B9CEDA, 0xFC4986ABDBF4123E, 0x6FA9E97D84C6F2DC, 0xA5EA7D32F54794A8, 0xEEA6E463A7AC3851, 0x1DDD0346403B364F,
+					0xB2C50ACF7833612A, 0xF2320FDF82D4C7C3, 0x67F9FB9082CCD0BD, 0x09EDB2761E53EF3B, 0xEB3289166729E2D4, 0x4FBCFA9D88995304, 0x2C1697BCF9781C09, 0xEC5B2A5CBA199636,
+					0xB133D7E47E542B64, 0x7B008563228488AE, 0x01D44F29481CDC9A, 0x511642016E34283D, 0xDC416770CB26A2A0, 0xD0C98C94F0943A07, 0xE0FF4EC3255D5D22, 0x786E0573B811C2C9,
+					0xC290767BA698CFC3, 0xE252C51DA904FAFC, 0x5160CCC8FDF2247D, 0x5E66D3A6ABA7D3BF, 0x98FE10F9AD420C80, 0x0356BEA851DA2643, 0x7EA8F4E5D4FB0B30, 0xA0FF8FE696750E33,
+					0xEF322DCC146375B6, 0x64B0C2D2125D3182, 0x158662B9DF2EED8A, 0xE410414DB1D71181, 0x51DF4FEA36807E05, 0xDC69E6E2E07D3DF6, 0x8F8F55193B362630, 0x2C1FB76400BB162D,
+					0x65731D1AC8B15388, 0x7CBE39C37612C880, 0x5377A8339038E2AA, 0xA4AD2A45AAD56C81, 0xF8FE586E9BB87227, 0x9D7A6FE51CAE2BB7, 0xDBC829A05A97878B, 0x51E27DEC8007EF74,
+					0x2ADADA077EC7A572, 0x91C9EF65BED79C89, 0x8ECF2C9A655A072C, 0xC4497BF6949F76F3, 0x016781C143F27EA0, 0x4A9BB18A691576E3, 0x2C6050CC3DF6166D, 0x57126EE7F2EA8AD7,
+					0xE4B49E6E337D3EF6, 0x7F96D664A0C289A9, 0x9F73D12F02751198, 0xC33BB4E20BB27F7A, 0xA4C330C4BDEA6738, 0x429153BE7C2AB12D, 0x1C270A99A0AAD97B, 0xBF7018EBC3E56DE7,
+					0xA744A5CA84191D69, 0xDA055AEB9578A5F7, 0xAFB2DC8566F0794C, 0x70E832E0E6EFC611, 0x3E1C8EDE39BBC8A6, 0x67AD819CDC4109CA, 0xADA4E09085E252EA, 0xD674B73CAA87A850,
+					0x8B3DD78B37146453, 0xAFBD856507A7E83B, 0x85324D05D374F3CD, 0xBD8902FA0006B951, 0x10CAA82157537C99, 0xFC0344A285B45575, 0x4562704117C316E2, 0xDE391DAC47D1403B,
+					0x0BDF0B38693110B3, 0x8FD691B5ED792FBD, 0x8CFF82A6E87683D9, 0x05BD4F04047FFF92, 0xBEADD5E64FCF11DA, 0x911B2B57AFC4196F, 0x54639095D3BB4286, 0x76C1FC4FFC619795,
+					0xE0D90D35B223D5F8, 0x0C501A53B6C08D88, 0xACD23BC447A2B2B5, 0x33498B27D60AA4C3, 0x31FE33D5CA7E954D, 0xD191F2DE87CAFD9B, 0xF7A43A5A2C2FDDD7, 0x6E4906690141D817,
+					0x937006572E0D53CC, 0xF4150132C4F9F56F, 0x1B1A93B03ED91C6C, 0x79C46122F9AF0916, 0xA3B07F66575A46BA, 0xAFBEEB63EC086004, 0x2CE0BC10BF17694C, 0xF86234A75B84C462,
+					0x15480219A483A384, 0xF479E284382EA36F, 0x203A4C4E4EBE9402, 0xB5E566945681C4AA, 0xAADDEE8F8A745098, 0xBD28186887D8BB71, 0x3508CF5A6400C154, 0xF1D60694E3B7840F,
+					0xB9FE1B1B6733F0C0, 0x086429E0D81D9BA0, 0x75E2CDF39EDF6854, 0x70EA678FB57F4D22, 0xE9740EFA64FD5D33, 0x6D5BAC80E18BFF3E, 0x53554D7C0748ED65, 0xA1B05180E1208D4C,
+					0x85488FBE3AB83354, 0xDDE2BADBCFEE9E8C, 0x662A2434B0BE19A4, 0x0FFEFF203FACC3DE, 0xC313D899E0879324, 0xF647BCE7BA66BF7B, 0x5AF80E170F4BF790, 0x4A659A0DFDDB718E,
+					0x18D8B15C0A536115, 0xBF0199DF4B0070A1, 0x04CBD5356BE5C6F1, 0x1959B934D90A2343, 0xB7521062AADAB42A, 0x623E7EB123C45F33, 0x0DB526C28049D179, 0x9BD214678333BEA7,
+					0x6E3C274418FF63B4, 0xC30F682BD4DCFAD6, 0xC18DA8F18B481B9B, 0x84218CAB151512BB, 0x1DE0B3C15C28DD98, 0x0C588443B0690692, 0x94E18118AB5D05C7, 0x4F366396C7FA3A5F,
+					0x8ED2C9441D27FAB2, 0x70A1264F4092ADDA, 0x1114A1274536DBC8, 0xB1FD6F7818A0BE96, 0xF600556079965B9A, 0x2F5CF56F11C3C793, 0xADEAA3B525F36BEF, 0xB0ABBC47A6D30B79,
+					0x697850056D995A96, 0x8791B16CA948EADC, 0x109F032CD7A930DA, 0xEF0FDDB187FB81D6, 0x1B6B098EA74B6AA2, 0xB44D5204BD1881C3, 0x49998EE3382CC303, 0x91FFE1636438408A,
+					0x5E29E028627426B0, 0xBD420DC9BC1D9C48, 0x34D03527A802D4A0, 0x8045474BD3BF7E03, 0x1D409771D4DFC38D, 0xC1CDF0BD05E29806, 0xE420CF75046D2C57, 0x1408B8213C98815B,
+					0xC3C93B8CA1620E12, 0x548F3784365E9913, 0x5EEB7CF27774B570, 0xD7DAC546B2984EA9, 0x4F8D543E7FDDAA9D, 0x0FEA7593E46B4720, 0x19E07DEE79914753, 0x3D8AF7E06324D462,
+					0x7892835F6ED531B0, 0x59F22BC9B54B3609, 0xD98C7ECD12CF0849, 0xB3FA7B61B7355FC0, 0xEA521DCD7D1B4F63, 0x978235C2F71BEA51, 0x5C885AAECE05D43F, 0x357340BF04CF032E,
+					0x6279EF9728963806, 0x3D15E10930D34BAF, 0x48E4FA7B731200D4, 0x04380785B600F31B, 0xDB3F9B6FD1F30EF4, 0x35931F95F1613FEB, 0x92DE8B67BEFBE161, 0x8EBD03A1B61977DA,
+					0xB102A9F54C412EBB, 0x41C8A4BABEDCB55D, 0xB74247FA1C3525F9, 0xFE9E4842253A301A, 0x9344E173073B9E78, 0xCDEEB78B4FE96238, 0xE3E4220E8B932BD9, 0xFEB6C94807D0439F,
+					0x87E3D3761BE038FC, 0xD209317773BE81E8, 0x66A3FBEC228445CF, 0xE89BC7CEA9A6FD1E, 0x91375C8CE160A01F, 0x4A5B0BE250529BBB, 0xA163F3E9B7DCAFBA, 0xBFC6E5A5B11CF176,
+					0x2C827E097B6DD949, 0x99BDE834B59B6A7C, 0x37F0AF597EFAED1A, 0x589D5F3749F6D997, 0x6F6A5A67A02ACE92, 0xD3D64BB3AEA4CCEE, 0x8BD9C9395DCDBB8C, 0xE564318C4D54BD0E,
+					0xD28842E7CE5D8B4A, 0x067ACA892A06CA0C, 0x949C5FF26221640B, 0x4A7C19D4CDB96021, 0x54BC4281A8EEC9AA, 0xE11F31218D2453BF, 0xA4075FEF2B56E376, 0x386B84254FA082D1,
+					0x3F9F211D4E8D6CED, 0x5A78A884A6B9D821, 0x3B15D2A6B54E2ECE, 0x6CFA1F79A2BB0F82, 0x8643AD9DC4A01B45, 0xF7F9883598C0C752, 0x29C133960455A2E5, 0x85A1B65BDEF0C572,
+					0xBC85CA272F9CAD58, 0x1992D0B9212FABE0, 0x416B3FDA40EA5300, 0x1A3577609A56D92E, 0x49C159749F20112D, 0x0D4A3632BBD6D649, 0xB963B70AD3B2E6B3, 0x35CCCC4A1FDE0F4F,
+					0xAE1D34CE5F380440, 0xB8B71FF646CA92FE, 0x137F41C93476939C, 0xCE467F259A666B83, 0xAD57231CE36FA1E1, 0x730D0FFC9EF482A1, 0xC6EA82BDD0996ACA, 0xC00AAE27C8A84DFF,
+					0x0CCFE85F1A53D00D, 0xE4B119636DD9A6C9, 0xC53BF98C8DDAEE9F, 0x5CAD1A99ED686BA7, 0x7C48E9A1DF643FA8, 0x866938B1A047504D, 0xE928F72642022E69, 0x39C74E813D575957,
+					0xCAC150CAD5ECFF44, 0x9933A01B5ADC8545, 0xDB5A8DBFA87AF5BB, 0x03F8626A9936E845, 0xA0883B9708353F77, 0xE28C9CA84AF3369C, 0x56CB3EDEC665A218, 0x810F00758C0A1012,
+					0xD3E381FD43C47E3A, 0xFB149AB5C51CDFAB, 0x434485873E8C56BA, 0xF5059DE38B8D2EF7, 0xB1C9394E46911BFB, 0x34058F051869D3EC, 0x3139B37EDDCB0257, 0x8978096B0F3D9FB1,
+					0xB0F53CA6AD1AFC88, 0xA8B59A472B92ECDA, 0xAC35DA3492362889, 0xFFD7975E2FEC2A22, 0x85345FD05A5EC7A4, 0x404D6993455D4BA0, 0xF7C66AE9CBA149D8, 0xC0AFF0C6D268BB7E,
+					0x5CFC22BB173CD51A, 0x6EB0D87FE80E1D72, 0x581BE7E46B2A4A0B, 0xABB6DFAA4140691A, 0x2E48E11CDC079239, 0x237D5F0743782070, 0xE5C7F870D9369834, 0x6486E2BAD7D09BDD,
+					0x6025F4C8ACD55430, 0xA440EDCD775B5B1C, 0xBB3D6BE10F4D7E67, 0xA782E27A7C2FA20A, 0xCC51246B661F1CD1, 0x61CC535E9AA748BF, 0x7D9A0AC7A4D88714, 0x83B1A97BAECDA21B,
+					0x24AAEEE219827CD9, 0x442770190AE6D3DB, 0x3BED5EAEECA25011, 0x8F2294C2100C8B61, 0x1089E701BB3DA6C4, 0x24FF4A2025FC7850, 0x0BE62BA197348F00, 0xAE135B9A6F28F4E2,
+					0xC4357F3F09165E74, 0x3B1BF3CC2512C64E, 0x2F703B13A710C1BA, 0x2094B2A069BE6AE4, 0xC9186E5EEB2B0331, 0x44A21B9AB5518372, 0x6254A242068F30B2, 0x6C31887B18CCCDFE,
+					0x7037C38F3A5F691E, 0x6BD57E3D8F17E3D0, 0x26537436C58FF30D, 0x0B6B82FD6E3776DD, 0x543717B423F498E7, 0x35A3E32E775B90EF, 0xBC12753A23361D1D, 0x8CA305A5A4B638DB,
+					0xB62E471FCE05B811, 0x427F3E2506C9D8CF, 0x59CBB6DD7ED988C4, 0x2C1F9B54BDD2148D, 0x0DD0197AC1B9B2B0, 0x52BC29DA4D4B3611, 0xDC6C6CB4AAF5DC56, 0xFA1D8BA75D5C77BB,
+					0x31D6E1869D2240EB, 0x1C6C9027F876FE6B, 0x1061C5D030444D51, 0x22AC9F04DC0D2546, 0x636600DD1F6C240D, 0x81D12C4E99FBB793, 0x99E4632EFBDEE17E, 0xA93154D2DCD041BA,
+					0x22AC8D7CF9822FE3, 0x5954DCBACA13C11E, 0x4584D999A113EE59, 0xAADB2533351E7EB4, 0x386F27CCE901B31F, 0xA9A9EA7797DC097D, 0xF7B2BB5D3C9D96B0, 0x4790E914B4426668,
+					0x884F8DB5ECF745F9, 0x355844CF32B027A7, 0xAAD9A4D4C308E9D3, 0xBFDC086ECCBD1E3D, 0x45DC5E057E7C950D, 0xB1165072F85B7966, 0xC54D3A450EDAA7ED, 0xB6DC20724DDEEE26,
+					0x7B400C0A0F8204D6, 0xA77CBA4100415B13, 0xD3B677F941CD72A7, 0x534CB289BABF06EF, 0x0DDA923E66BB4192, 0xC38089C14793755D, 0x75E2F28FA707DCB7, 0xFCD98F5350D7957A,
+					0x94DB955C5882085E, 0xF6CCB856D05C6B70, 0x01C98CFAD47314A5, 0xFF1EF2E2E24F73A4, 0x11575F9A125363E7, 0x1BCCB6BABA4B96F3, 0x425BECBC02E7C08C, 0x583166D998F85843,
+					0x246E5F37DFE70F0E, 0xC8AFC1E3D1474697, 0xA596252DD65EE84D, 0x43431C9CF8761057, 0xF880134C7077CA07, 0xEC5B03ADB3760649, 0x9FBAC7C49EF5B495, 0x254B17AAB78F4B11,
+					0x7D93B84870CC4A4D, 0x9DB43C2BD6058DD5, 0x3FAE2A5B3A40130A, 0x39983AF6E263A233, 0xA3CD498EAC759DC2, 0x22D8129DA0C5A4AA, 0x57F37648D1D50AE7, 0x2C634BC990C53CB9,
+					0xAFCEA5C77AAB8328, 0x12C3385FE1E5E1DA, 0xD64B1C609D0BFD40, 0x57ADF562BCE31DAB, 0x66B8EB7750D56BD3, 0x187F4B0146A10DEF, 0xC9835C139EE8C204, 0x7612986AD7CD47B8,
+					0x9E45D9E60CB0B23C, 0x4AFEE6AF1DFC11EB, 0xED91AA47478CE60C, 0x2562AD7C1990069B, 0x7E464218199999E2, 0xFFEA99EF9B29D2FE, 0x6F55089C0C4CB464, 0xA383B40D55757462,
+					0x0932CF47074A9F17, 0xDACC9D1198B83164, 0x20C70EDB5FC03973, 0xA0BAB395AED8FCBA, 0xD2E41287C212F72B, 0xD32B6AE184F79D71, 0x31D10D9B36C2414E, 0xAEEE19759B69EBBA,
+					0x9630C2F54D3DCFAF, 0xFE9B98DB10077477, 0xB8464BB97E30FFB2, 0x670B4D69B845C630, 0xA7A71B9478441F9E, 0x3AADB56AB3312F5E, 0x01149BE9FF783ECB, 0xE199717EED908744,
+					0x24D825BCC2222DF2, 0xB81C631E9022690F, 0x603054051C9C2629, 0x6956666ADD465BA4, 0x269A153DD9CF3644, 0x5E70DBCEA5F2DFF9, 0x43311CA52A333F66, 0x23C670C73A815E2F,
+					0xCDB6648B836FCEEC, 0xFD9B8E224AA2C496, 0x41264BE35423389B, 0x7AED81F47BF4655E, 0x6BD4929D74485F73, 0x0B2FC1F39D7EF6F9, 0x6C833107E72DC35E, 0x9B89C5C6B554A7F0,
+					0xB1AF79E1DE2061DC, 0xEA26D6755C8C7531, 0x3015FE8889BDE12E, 0xB71E9C3265B7A3A7, 0x31240EE92FA2CCF2, 0x287E345ED4FD3EC9, 0x1B583BF43BDF54D2, 0xBA2392AFFAE8CBD9,
+					0x7F15516049A1984F, 0xFD65F7B777ABBDB0, 0x4541DE6F48AA0343, 0x00968FD9CEBA8390, 0x8357E91CFF5CAA28, 0x9534F90B05A024DC, 0x866299EA4BF47836, 0xDB77D8662B5B2586,
+					0xE13F5B4F77082F8F, 0x0C0B62D4112B8F33, 0xCC697A8443A136F5, 0x714C40AF3530149E, 0x286FF4246B82E94C, 0x837FA2AFC1894F87, 0x553C23D4379593AF, 0x18D1FDA8CB223545,
+					0x5A76F6B471E8275A, 0x5A8C296DD51716D8, 0x00CF559E2AFB2F42, 0xDD54335FA5D54931, 0xEE248F7E35F0CBDA, 0x39F67D8CDA3A9718, 0x598076233FFB4C7C, 0x5C4D48B1B013D4D7,
+					0x09B15420A6C562DC, 0xA4FBFC0503529BFE, 0x92FE10B332CBFE9C, 0xDE066762405E6D90, 0x2EB80B54A08DCF36, 0x41858966B93000E5, 0x3EC892D32D87FB26, 0x5DF3787C117D24C8,
+					0x603EE423D3A981B9, 0x6BCFD8171A522AF2, 0xD4C146739A1DC967, 0x781DF0DBE7134A17, 0xB830A55D44B0B406, 0x873C7BC209425A7D, 0xAFD446E74DEA1990, 0xBBAE8547C9D74DCF,
+					0x7FE0E90B86D890B2, 0x274544AD1D44ECEA, 0x203B6682ED54FD9A, 0xED21271F6CAEEDA1, 0x03BCB5A0E2BFC913, 0x781EC105AC391F29, 0x022ADFA60F2A1664, 0x7BD722EE54BE229A,
+					0x8A6D79931A7AFF1F, 0x80193B5F421D7A69, 0x1B1EB12936E40AB4, 0xE773003B93F56BE9, 0x97035978B220BDB1, 0x609A6D34AB492794, 0xC74DF32DC9EE03DB, 0x5AC6B9BA352C5DA5,
+					0xC800BCCB9736C4E7, 0xCFFADEA9025064B5, 0x11057F98FF63BC3A, 0xBEBC8BDDAD274D84, 0x10E09AA7EBAD3D6C, 0xB4F96236A7984012, 0x22036DB3D88B1742, 0xEE0EEC81B4FAB9AF,
+					0xDAF4DCD20AB46C7B, 0x2B49BFCF3B099C04, 0xA2336363B9F2ADD5, 0x7AA4FA0CCA8D41BF, 0x48424418F863266C, 0x225BA7C6406976AE, 0x7637369B13DC851E, 0x6E38B8C58F487B2D,
+					0x70BF0C340F534264, 0x932D9F9B6D1C493F, 0x1100F2431547216D, 0xB3D8AEC0A24E5905, 0xB77062F5EB2A38BC, 0xA9851BE02A53810B, 0x08E861592FD084E9, 0x616E2285F4334880,
+					0x5B97CC283E1EF8E4, 0x1380CDB4FD2CEDB0, 0x1717984C609E98B3, 0xD8DFBDC879F11E48, 0x81A967AD6594ED4C, 0x7F2FD6E13D32C43D, 0x6B1C6848F73306D8, 0x49617DB86BD11991,
+					0x4E93C975E03C1D2E, 0xD2CE6E0519EF1A65, 0xCD0DB6E83B83F0DD, 0x1C4EBA68B12542B6, 0x6AA22BFD35B6E09A, 0x1639822958820ECC, 0xF1116FBA8446A431, 0x9231B171EC3F77A9,
+					0xFF79181A4CEEFA50, 0x5CD9B64930F40BA6, 0xA04C767CBD068D93, 0x327551548CC494E8, 0x69CBA28E831C285B, 0x55BAAEDB61C38F3F, 0xD701EE346423C79C, 0xB371E80F2C0DFC99,
+					0x87EE2D4DB8B4DF6E, 0x17E1E24E3EBD667B, 0xC261066194FEF4E5, 0x7E40C6A30914A75A, 0x624B5061A2F9F38E, 0xAF129425D44F80E4, 0x699E91DE7B3CB83E, 0x56B7CB416BDC9948,
+					0x6056EC718049FF6A, 0x8548AC602CF57237, 0xC3347CED162AD890, 0x95C1808858F6E064, 0x935092ADF060CB76, 0xB1B7C99F717D64EF, 0xF1CF1CFBA281B81B, 0xFBE86D1821DC530E,
+					0x6FFE352EA4A848D7, 0x22D9A4A0EE9144B7, 0xDEE6048E6138CDD2, 0x59A130299CE959F7, 0x16EA1E256D60288A, 0x38D04BBC4766248A, 0xA426BC59DA72439C, 0xE661FF9EB98FF7CF,
+					0x16A809F540547674, 0xE4683E78845FF964, 0x344A7E5F8287908A, 0x5F968B1840574E2E, 0x455CA6DFC34ECEA2, 0xDD2E8459682C23A9, 0x4F952F3F901BB714, 0x680D64DB36FFEB37,
+					0xF5DE5C4466E16D1F, 0xAF84A46801BCFCA8, 0xFCED1A20ECB04982, 0x775F411C00B92C3A, 0xBE27B93584B4E7BB, 0x64BE699D87122BB9, 0xD0C6C313F4927F20, 0x9B5F749E292839EC,
+					0xEFBC8D065E5C2A10, 0xE84155C54E82FCD4, 0x9DDACDDA93682C5C, 0x2B0BBFCAA3282EA9, 0x30E4192B0CB6B620, 0xC869ADF10221EEE9, 0x896E75D57B0FD00D, 0xD078B244A5D53FD4,
+					0xF86D2C03B1804B3C, 0xFF98E5711ED260A6, 0xFA342F7E5D06A7A2, 0x49DCF6227447BB25, 0x44FEE0F36CCDE280, 0xEE1A0F46357987F8, 0xB7D887526B132320, 0xB6D52DABDC99EBAF,
+					0x0B808398A36447E5, 0x6D2A0CFC1227A80D, 0x3996DE47D42868DD, 0xEA68CAF30195FBA5, 0x816BD87DE451565B, 0x72CC5659A77BD0A8, 0x5A8990B72F9E8CF4, 0x285A828C4A6FB47D,
+					0x260AB879C311CF7C, 0x0BD05844B39C5B9B, 0x774FEEC9D62D4B3C, 0x38ED14A5F8F9C903, 0x8250CBA4E6B2259F, 0xA0B3D11573654A6A, 0x95B6BAC4CBC014C2, 0xFE3CE744BA709F71,
+					0x6524C6664ECE9FC0, 0x689B93C7D83C27A7, 0xF2CF9F5C9DB7C3CF, 0xCD6896CBAFCAF504, 0x9A9A90294D2D33E0, 0xDAE26667DBF47707, 0x6E10534D0CB0F2A0, 0xC10BCD15C0E300E9,
+					0x1AC8D9E7BF83DB61, 0xEB4D060BC35D2593, 0x81CDC59C9D3C41DC, 0xD700530C65DB92F7, 0x92B0C2BA816C8862, 0xECEA9F6F42A923B5, 0x1F287E9F71EFCC95, 0x290B18F9B97FA638,
+					0xD095E37353659449, 0x339823F90F0006C7, 0xA8E364D6283A43BC, 0xB2834DFB6040BAE8, 0xDFE9C1E325EC3C75, 0xD0774152176EA7D3, 0xB391829A51DC22A7, 0xA37D95311B6B4DBD,
+					0xA9BB04F2FACC087F, 0x1FB76DB546614242, 0x61593C5FC5DC307B, 0xF64EB43864A33861, 0x9731C8EADEA8FEB3, 0x0D1B2382E42D4E4B, 0xF2F067BAD8E1817A, 0xBDE0EC9CADBEC40F,
+					0xC1D12E0BBB016EEA, 0x976617BDCBEA7216, 0xB392F3FD8DE1E345, 0x344FE7C19A73E39B, 0xC3E6F03619FE6359, 0x71C910872989BB86, 0x22C7D396A7C61EA9, 0x418FF75C3860579E,
+					0xDB608D03A39C209A, 0x8279AAC8DB19F4C4, 0xA7FE2514B3461402, 0x0F94877664BD47FF, 0x12290D7B3B949772, 0x1F742A571EB6336F, 0xC117DDC5DDFB115B, 0xAC1D4DD0EA709032,
+					0x6A2A4926EFB00785, 0x33138E3FACB06A86, 0x980F4A6FE01F9086, 0xF4DD2FCDA6E8EE55, 0xBC8A796CB8379DA2, 0x049DDB78FCF02318, 0x2214D8B8084EA8C0, 0xE000E38EF3C3130A,
+					0xA8746093A5C1BA0E, 0x03F41DF748E1BAF0, 0xADA166E003136CC4, 0x86CDE80589F6E7CF, 0x01F57E59E6381B54, 0x414E95A1BCF7A439, 0xC1B594CDB1F4881C, 0xEB2CAE3F4514D0E7,
+					0xB3D63C3F96F45235, 0x5677A9B2818022AE, 0xFF73672A2215A3F3, 0x68F206B1CDCFB959, 0x24D7BA10BB751D8F, 0x8D52C233DF29E7F1, 0xCFF07BB3C5C178BC, 0xFB34A88E27E29855,
+					0x107507DC0D65E8C2, 0x1FD10331D51CBC84, 0x033062F3B15C7F6E, 0xDA646F706770803E, 0x99D3C17ABB36DF37, 0x34EE067F8149243E, 0x41E9228F9DD05FFB, 0x05EA6D13E4EB470A,
+					0xD663CABEF4F315A6, 0x08CEF4AA7034E56D, 0x54AEA204D86B1B93, 0x15ADCDDA7E9CDE73, 0x3AD43D25BD5D8A1B, 0x6BE6EBAF357D4B16, 0x1A41E17EE55F5B04, 0xB821F555C2B74797,
+					0x6EB3E7B03DF4A8BC, 0x46F6CF65F7A587B2, 0x6C1C5A8D3C6DF42C, 0xC8FF8B539108ADAB, 0xD90F7816FAE12BD3, 0x818A2837FB642CF2, 0x87AC1C9AD79D0026, 0x8EB4A65F2E6BDBFD,
+					0x28F01009E109C971, 0xA1F6BBD8328055BE, 0xD115FE8FFE75C121, 0xC8CA0C9D7770A8F7, 0x0650FA426852B038, 0xD52EFDAF9B75F8C5, 0xBE1B5D277540A936, 0xE102F160014C8A2D,
+					0xCD0AF943A58BF018, 0x42921E730469F6E0, 0xDEB171CED8258B21, 0xF5208F50F75A590C, 0x2A5CD43DE84323E1, 0x9C0D6323296ECD17, 0x8C590E527FCEB21B, 0x788A8951DA56D734,
+					0x27513E8C4DDB8657, 0x20280461405916C0, 0x7819AEE2D3AD705C, 0x362356951E7092C5, 0xC7F796D38298CAD3, 0x9DB3AAB5744B7529, 0x2BB985718A8D66CE, 0xBB1FEE9FB7215E08,
+					0xEBD75D5413192232, 0x2A78EFD6E661BCD3, 0x2C0F12C5372DEA0F, 0xD9B15F2B70CBEDA1, 0xAD093D72020E0B33, 0xD5AFF3DCF2573DAD, 0xF686FE576FD0B209, 0x51776A7CBBC7E1BE,
+					0xA7AC2B5D7401682F, 0xCAE7B268DEA23E83, 0x34337F7EE262E20A, 0x33974100582B09AE, 0x1D52D01CF0E32586, 0x8D1A8E9FF827458D, 0xF6B320807F884D89, 0x2D2B94C2D4B51800,
+					0x6DF4F1514E7F448D, 0xE09BD436FC06E84E, 0x65AA180BA3A6E484, 0xFB2A52FDD7166DF2, 0xD237F84B3CF8D598, 0x19D3C8B5021C300B, 0x06CC13E9E1D741C2, 0x6ECBDCBD4691F744,
+					0x13BD4225F859E89C, 0x6082E282608C1E77, 0x8F059594847DBB49, 0x76BB990414A63733, 0xF36E85C0824A724D, 0x6F4DBE162B24DE4F, 0x89756A8146E96240, 0x3374A95281134180,
+					0x516C04EA12E82A85, 0xA98432E11C610575, 0xA7377D33270E39C6, 0xFB19B22B3C5F2D7E, 0x31F7339A144EBA0F, 0xBD3A9FF4C218EE5A, 0xF5F445768DC93687, 0x139A4C966B9356F5,
+					0x113149536D41576D, 0xAD3DED45C37EB150, 0x496FB449165F48AE, 0x1146F8598BBA5B33, 0xB4D5519E796321B2, 0xD9110A6A63A801E3, 0xF3D4EAF30EADC451, 0x1B06BBFFEBA53909,
+					0x74E2ABA8496C63A2, 0x04E41FB25F692239, 0x0F17C1604A30924F, 0x9EC158EE295CAC5D, 0xF8F5C50413CEC427, 0x574EF040E0BBB814, 0x63EBD527C88DABE7, 0x9BA71AB362B1A865,
+					0x98AF93161720B868, 0x9B921F31EA8D0260, 0x2AFD1E0C18A60EB4, 0xBEA12D99CE2051E0, 0xCE68D55D5A4631FB, 0x54A0A6BC044C378A, 0x4F96DC4737C6AA3C, 0x588529DD5DEFC926,
+					0x50F9093B5A78001B, 0x6DFADBA3C79D6806, 0x0961DC7617E71BA7, 0xAE92F5F6C110BF7A, 0x00BD51D0854BE98C, 0x71029A143D37DCA1, 0xE31841C65718F8E2, 0x2D954717DE20C763,
+					0x44544A94FD9EB701, 0xA0F3C9704AC14E8C, 0x09529EDF9401C7AF, 0x511B74A9BDDD2FCE, 0x325A39787C72DE31, 0x56128B23E04D706E, 0x5EE49B781008E664, 0xDFC71696A291820B,
+					0x48F7C299959D09CA, 0xF4A99C2ABB1CCEAD, 0xCF88B1534002ABAF, 0x60E00317F5CA90B2, 0xF4A4959F9585C262, 0xFD764158C7890BB7, 0xE16D6014611C81EB, 0xEDB81FDF820C99CD,
+					0x04F2B20E603C281C, 0x88CE74D09D0AAC1B, 0xA9A07FE159ABF27D, 0x878915265267E7AF, 0x59E951E593DB7AD1, 0x3453181CF889B7F4, 0x6757CC94871D1BA4, 0x06093BC68286C3AE,
+					0xE56C1D4124022B18, 0x8F8A1AE610EFACBD, 0xEC95AD3C4F93246B, 0xF2DB572FECFB4B82, 0x5A3F088056058983, 0x167C4498F0F3F6D5, 0xD754F53449CA221E, 0x4D4F36C5A1B2CBA4,
+					0x2EC385D3D34CB023, 0xE54DBC18D1D86E6C, 0xEEF8A46A86DF2DF4, 0x04F3A1F36F1E168F, 0x95ABE3CD2AF7B33A, 0x58BE6F1E03A83B7F, 0xE6811D433BD16C33, 0x93CE855661A9ED13,
+					0x2701B4A869E5B625, 0x17A4A58BCF050670, 0x3F25CEE82B5AF006, 0x8705DE579F2960EB, 0xCD2CC05FCA9A9F8A, 0xA96CF2A8154E333B, 0x4BCFBB18DC8C4691, 0xF7FEB9F5A875BBD3,
+					0x33DDA3E78602354A, 0x14C42CFB8F5BA90F, 0x1B8201C4738272F0, 0xD8DEB6C9034C5ED4, 0x19D377B9631ED25B, 0xFAFF3EBC4D7C92C7, 0xB8C7760D0DF4D886, 0x11E3FE89F7AE1C61,
+					0x089ABB7EA98CCC3D, 0x1840B3E68E6C455E, 0x3D99CFCCEF371732, 0x36F537250C331649, 0xD813CA6253419634, 0x92A92B4F4BB94B7E, 0x72943AAE637F930F, 0xFE97FC0661DC393B,
+					0x245EB13EF51539B3, 0x333ADAABF0DE4690, 0xF157212461B49852, 0xE5960E481B7377AD, 0xE3A6A52E034E88A1, 0x0A4C4B0A95F32F11, 0x1E9CD03D3891F5C2, 0x97DE79D4ED2666D4,
+					0xBA67E0A1D4F199BE, 0xB11B3FD19C48EEFA, 0xF95CC987FA50AAC8, 0xBF80C71580E4CE9C, 0x757C2DE84F31A73E, 0xF981BCBF23E89A5F, 0xBA1EAF74149BED9C, 0x0FD068B9544D21F3,
+					0xA43CA1D29E650756, 0xF35C3F3BD476636B, 0x073BC55E11D8AEE3, 0x11F5AEB5C848D1D5, 0x58AD8F2F47B672CD, 0xBBE8A7FAAA6B450C, 0xF47609C241D34832, 0x7E57B88A16676A96,
+					0x397CE1C90FC31D21, 0xC2D8BF608212A33A, 0x56BDBF14C815DD87, 0xF68E37C517DC5B81, 0x4BD2BA71DE659729, 0x3DEA6812851008CE, 0x622E42B4AAD2863F, 0x62AA970AD117C68A,
+					0xB781B43D7A7E9B50, 0x45D733AE4A5921C7, 0x3CE590F16F70D531, 0x86220053C2F0D2BD, 0xBB20B88D51CABC83, 0x6427B73ACAC297BE, 0xF3AD49FA4EAE4870, 0x6403A4EB50855417,
+					0x691DBBBC31E9664F, 0x84A9C6F82B4946D5, 0x2DB522EFEB9E06BB, 0xD349E2AECFFF9906, 0x4ED73C8428123F0E, 0x33745073BE6C9970, 0x37DD7A30230A4BC1, 0xB0D0486111D2065B,
+					0x0374E12F97914B8C, 0xB37E3E0AEADF6A20, 0x81341562BD17C612, 0xF775DEF122110AD7, 0x33A0D766C4885A3E, 0xB03CBA2CADCFF119, 0x42431C4827FE6EEA, 0x65D281377FBA6BB7,
+					0x4A66910BD372DD62, 0x55D653E5FDA22F62, 0x1AF0FD71277F6CEB, 0xCA45F4093AA2764B, 0x7416AFE880647B53, 0x513C44791EC961C5, 0x401AC9BF04B29EC4, 0xE88F648F9E02FF46,
+					0x7ABF9C4FABB041BC, 0x5F08CC8E2D50037E, 0x156A838BEEE85FD7, 0xF2515274563C45F0, 0xB96F1FD0B54E02CB, 0x8615D94360B6D06F, 0xDE10B7C01501C5D4, 0xF227D5BC0BD89265,
+					0xD51E762D7E4A9386, 0x5AE7DA637B0654ED, 0x7F4639ED39357F6B, 0x05F1B6461EFD4C93, 0xEE0BA367AE3B4BA3, 0xA08844D28430A56F, 0x2C2558E55A8AD3B7, 0x872FC190BBE6F216,
+					0x8D5CB53021DD7A69, 0xE1C7AC44BF4E50AE, 0x994E4A97606A62D9, 0x09B77345DE4ABBD7, 0x482DFBB6782C83EB, 0x45938CA1BA574181, 0x2C060FBB4DFB210D, 0xC04D2B263A0531D5,
+					0x2FF7FAF4ECA6B706, 0xEA6B017F0CF41778, 0xD35B74C6D28D78F8, 0x435BCB1D4AC96E64, 0x45EDEED5360A44EF, 0x7EE407CE55FC33CA, 0xC2C2A8DA77FCB57E, 0x4A451FFC3DA0AF9F,
+					0x17A7C8C16401CD90, 0xB6D232A5A70C22AD, 0x22E64EEEDDADA3BD, 0x2CE51139F412D453, 0xFACC41643E1EB2B8, 0xE98E29EB7D492702, 0x1AC41DF5B905CA96, 0x6D7F4120C7B8DAE4,
+					0xE5CBABF3F95B2373, 0x1FD5E880FF3A3B88, 0x73190C1FBDA6E2E8, 0x3FD4AD8113BC736D, 0x1FED8ED997399776, 0x3F9B284C56EA3A16, 0xBEF43106372B8176, 0x2D3B3E71305CE4B5,
+					0x972310F85FAB8738, 0x19CE020AB69090B9, 0x39037F80B70E6D59, 0xC9E7BD2AE5F45B0A, 0x2E021F92BE9DC09C, 0x7BC563A69C0A9180, 0xC3D112FB263F11B7, 0xB80679096AD7355D,
+					0x928512CB77216C71, 0x0E3A44EBBABF8817, 0xEA1FB0066FD5320B, 0x69E8099AA0338494, 0x28F5AB5E6269D42B, 0x8AF49353A90D668C, 0x0FC93672B138BA4D, 0xF1FD6144DD74E41B,
+					0xE4B845E57B5A94E1, 0xD68D85F2CDA7C57C, 0x34387FF9462A7DC2, 0xCA4D6264A53AAA0F, 0x12A52FDC3231B0A5, 0xBA1FB84336EC1992, 0xDDCA3A9E5F74F474, 0x9B465DDA3BA608CA,
+					0x568A73731EC1A8E4, 0xFEB8FB400516BBF1, 0xFFFD68A5884C531C, 0x648018E238489683, 0x0A136A6AEA5B9010, 0x2F0486FE8703F556, 0x7994705802C75C62, 0x8F4A2EC8C507B704,
+					0x777355EB41B85600, 0xE7164707BF1CB901, 0x31D0752E0C8CB3FB, 0x96014DEB30F3AAEE, 0x8A6355FE8BA7E15A, 0x05CD36B1795493D5, 0xF4513F34BDD9917A, 0x7564F28D208B15CF,
+					0xC2C30CE72F8EA3EA, 0xB59082407FC97855, 0xC39E2BC6A435B356, 0x2EA04D78C34D541B, 0x6EEDA6F44611D7C9, 0xFED75B76DB8626C5, 0x087005AA1B090F4A, 0x244C0F65DF44E5B9,
+					0xAD74FC12A337220A, 0xD193A72BEA0D57D7, 0xC33643F5584105B3, 0xF196FE7799E2E074, 0x126825CC654B3DF4, 0xF25007B1525C90A9, 0x6C60A699FF18657C, 0x1F14292AF6F88C27,
+					0xDEA607AC5D1DC3DD, 0xA844AE3C09E129BF, 0xBCAD819C118FD191, 0x1B2C1DEBDFEC495D, 0x7A6F0F2C3E2C344E, 0x49C0E07A94BC918B, 0x0F0FA9CE5EDDAD3B, 0x701060D241D8AE35,
+					0x5045EA948CAA1840, 0x0CC20DE5FEA98F14, 0xF9ABDA50DE2B91B8, 0xDBB0B4CA45823809, 0xA1149B95DFEB9297, 0x4CA9DB39879B13C6, 0x310AF0FF1E2D3CC7, 0x4045540A93FB67C2,
+					0xE930374E421AA981, 0x9A73154A57D9CB32, 0x00E5350EDC033D90, 0x3C5147B9FFADE4DD, 0x454B3D1B6864751A, 0x270A38CAA20EAB34, 0xA8660FD05F2DD501, 0x51D85BF329C71C65,
+					0x271BBE0716B70253, 0x4F8A077EE2D8A19E, 0x7879A5AC9E349E4D, 0x98D6FE6CB06E0D65, 0xF113C26E3FEF11DA, 0x749734903CDEDD8E, 0x99C3A245F11397F5, 0x5C5A2BE9A85A217C,
+					0x7ABB35A729322FF1, 0x248A5A2263CE9F18, 0xB0F29814B251D4CE, 0x73C335376F864F31, 0xA1EEEAB5B0BE8196, 0x9978CEC031D8CD26, 0x33CE988D584A3D56, 0x681BE52DA67C86F6,
+					0x3150313C8788B2B9, 0x0FFF351E74B2A0F1, 0x74487533CD597E09, 0x946D7A65B611056F, 0x359993D89CC07ADB, 0x5D5001EBF8C20ABB, 0xE260CBF4B084B987, 0x5F941A6D16EC45EF,
+					0x06369C7C6C969F3D, 0x33E3B65B27FF26B4, 0x6FF968C1767115A4, 0xFA4CAD0C9F4D303E, 0xB110B0F339092FB4, 0x03A669103468F2DB, 0xE20CA9D0704B43F4, 0x528C956BED572332,
+					0xAFC3F87B0E578035, 0x35CCE955D8BAB924, 0x1A6ED4C9B75DF2D9, 0xA2D3365B291BB0D7, 0x6F51A560B07DF248, 0x383DF6C091CE8CA7, 0x99AD3210317DD124, 0x0AEC3F74611A9DD8,
+					0x9FCE2FADAF96041E, 0xC05610E67FD0FC95, 0xC8CE61AFF6806FF5, 0x0BB9124ED8ACC0FC, 0x69FC03065B97CD6E, 0x5A7A5E7C967970A2, 0x7D07FC37A054B630, 0x76A8AF332E851BE9,
+					0xBCDE820F47DF15A2, 0xB0E5319371FD12F7, 0x59E79896F690777D, 0x80F5CDA3D37BE10B, 0x9D1025D3C7259E49, 0xDE0A8EADB8F33574, 0x39D21A69B20CB908, 0x39181BB3DCAD400A,
+					0x937EB6C1F5061F01, 0x5E9D99A3B6F04AA8, 0x4C674113EDDA4091, 0x0FAABE706F776195, 0x962875436FE668EC, 0x3D3A4F8B01B05B51, 0xBEB4B95C1D89BA76, 0x1800C311BEA34A45,
+					0x824A0AE14746C3DC, 0x5735EF54AC8C6AEE, 0x23F2C83EF815DD41, 0x75635996001F94D6, 0x6021E9B20697703B, 0x41DBFAB608790959, 0xBB32438F7129665D, 0x9F9616559143B14A,
+					0xCCEE5EC9E5265EC4, 0x52FFD342F879E8BD, 0xD204DCAF0DA0D3B0, 0x3AE5D44BB5864921, 0x4CE9109315EA1400, 0xDEB2CCCE7DE3F3FF, 0xFAC09CA1231F7298, 0xB3CC3D9649F9AF74,
+					0x570887C58B8C074E, 0x54CEA1FDBE07F9EC, 0xFBC0031CDE3C63B7, 0xD0CD999DAB438EF3, 0x5CF0C0C7ED66AD01, 0x1E37FAFFDD7A93E3, 0x2A4AC02EC4F4ACF3, 0x6602DB115B57E522,
+					0x3F997BDE46AAF736, 0xEFCDCBF2D6300F8D, 0x69EAFBBF66AADD11, 0xD85370C6B67814F7, 0x7E6C00B0D7067E61, 0x0A6ED2091C88D23B, 0x3FD1D4D28E5E30C1, 0x1F38CFE3230E7DC0,
+					0x34C730CDAC1AAF2D, 0x20E6E8B17B6FE898, 0xF443F74BDEA6DF64, 0x5EA33E8ADCCB5D31, 0xA3523AF9C01C79A8, 0x6B25B2DD1085F3F0, 0x7F2E62D2929D7A1D, 0x2EC1EF40344D1725,
+					0x1769C03346168ED4, 0xD60C8DD8BD03F547, 0x6585828FFAD55016, 0xC6DF2342AFE859C1, 0x4C5CE5A672B0FE3B, 0xAEFA7CB1439A6453, 0xCA3BA01518845243, 0xC26A64C937EFA412,
+					0xA8CFE1FFD8F35044, 0x7711C04EA7030428, 0xF0F7226F6526BCB0, 0x27FA30F13149669F, 0x9B1F032A41BCA65B, 0xAD9906E5676767BE, 0x266D78D9B76674CA, 0x713EA35F70AB2E22,
+					0x76121E1A09B85D09, 0xDBD4B3E6034F2660, 0x0A72E492CFE570CC, 0x6079FFE9803DE73E, 0x3A157EB6C61A21EE, 0x474ED819DD6E979A, 0xC83F4E6522BF1AA6, 0xE789B818A1E5BD99,
+					0xD599048F2B9AD77A, 0x04927369416306A1, 0x65805AF56EC1E484, 0x8938DD8D1109FA4E, 0xA260D909527EDC57, 0xB3B6C7BCBB428583, 0x7F7AE513C47551B1, 0xFCFA850BEED1D8DD,
+					0x13C36DE0BBF236F6, 0x692AF91963302E28, 0x91B5098EAE8996D3, 0x78E5ADA4E003E36D, 0x9B22B1CB70F4C375, 0xAA3E9ACBA6AFC3AD, 0x4D8AE09463F6EEC7, 0x69A13E7F8C6EECE7,
+					0x629207B40FCD2E02, 0xED1DE6898BC85021, 0x4DBD2C25615E73E5, 0x2C8E2921C55165A1, 0x632A9BD8C693BF1A, 0x8E93427A9E3ED88D, 0x3E1A3C63E8A1CCAA, 0xB0DC2DB0916DAFEA,
+					0x76B40B4F7D1390DD, 0x93C3EA2EDBAAAF1B, 0x9166DE2A2F88101B, 0x1026C9362E4EF34E, 0xFB4568C4A4B97F9A, 0xE594979FECAC760C, 0x91EA3540981F15DA, 0x372CB710FC4A2A14,
+					0xDDC7F1E3B9A02862, 0x52C4A2FA65734D51, 0x9D45BE17E4585B32, 0x51669EBB541DA026, 0xA6DDCAA86471CB95, 0xEB8C1210DD86096B, 0xF880F8AE1812823B, 0xA85B54E51E99C33E,
+					0x0256124B17F6F120, 0x135D0C1EEFDD4469, 0xD309036C33242760, 0x0FA389FEDDEEDADB, 0x9540FF56A5A8941A, 0x73278BD16A95F240, 0xD4E646725AFA8511, 0xC8B372E96C952D6F,
+					0x704A8FBFBBB5AAB2, 0x81F675A290B5EC88, 0xCCB168C5E78F0092, 0x570BECFDEA2F34AE, 0x85F963977882413B, 0x62884958EE510DCF, 0x0E782EF0BA4B73B8, 0xA0B2AC708AC1F28A,
+					0x47C18D0A6FE10936, 0x984F9FC26ADA54DC, 0xA56D7497745A5583, 0x54A7846ABD320F23, 0xD64EB870C35C5914, 0xEE9403BE7EB8105F, 0x9AE520CF4C4CE185, 0xCBCA22EC94743F4F,
+					0x09ED814F325089FB, 0xA939625EAF5589A5, 0xECB15DFC95B63107, 0x43607AFAAA25D9C6, 0x50C9707D489DDE36, 0xE37E572A2058BFCF, 0x01F7162F88BAEFE8, 0x8FF59D843BBCF87C,
+					0xA98089CEEED0E7AC, 0x2321E29605902150, 0xD443C815EE0312AA, 0xC164B62C926E3106, 0xEBA661E9C549E9D2, 0x58D1EEF7E060D808, 0x998E81E3F9286AC8, 0x0CC788D2A6F7512D,
+					0x41EAE3972F012E06, 0x2964A65602C84418, 0x895A22A9F75C7260, 0x4E360B5857E0B30F, 0x595C62AB44A549EC, 0x5F4951BC7B405F08, 0xBB81CABBDDA4D3FA, 0x1ED99E167025CBB4,
+					0x423E8F7722262A88, 0x78EB2C20AD972705, 0xA084915DD47DC40F, 0xFB10CBE58C5A93DD, 0x9989077D04A975BC, 0xF9FCEAB4B4AA2337, 0xC70B9FD186D34B7F, 0x73303339030B4F09,
+					0x73493D8EDFBCE8F6, 0x317E1C7D3FEAED5B, 0x390B6A0792BA9A36, 0xB133727FA2433FEE, 0x8558E36B41062818, 0x7A994A9833B00C72, 0x13F921799CF42CAA, 0xF00925416E4356D9,
+					0xDB40D4884E645793, 0x78A69813C08A0928, 0xFBC909682056C7F1, 0xFD79B34761E02442, 0x5FE6ADAEAACEC32C, 0x4A544522DD6CF6D6, 0xBF2B2EBE4DFA40B7, 0x13DFF7973C03B379,
+					0x22BF759C1EA70C12, 0x348BDA9E1FA15B2F, 0x41021D97D988418C, 0xE3A85AF5753B5285, 0x55A045D700FE99F4, 0x9A374F512DBCD04B, 0x92C027EB8A8EA359, 0x33982A37CB0767A1,
+					0x11C35434F0920B0E, 0x39958832F71B0369, 0x154616F4C604D97F, 0x0DF48C6B32B8D976, 0xD2EF7148CEA92C13, 0x2339082D7C973C4D, 0xC4ACA2CC6CC79C22, 0x6FC95DD3BA26567B,
+					0x0F05E0294CAF227B, 0x36F071825C34B36F, 0x220E6A9B9D15AA11, 0x199513F000536D6F, 0xE539FF3D9AA594DD, 0xB80AD7CFF3662F75, 0xBE1D6B24849A8D18, 0x06F691530C492587,
+					0xC7E6D6363D1107F4, 0x4E14B9D424181FE9, 0x21619B6C964D3B2A, 0xAAD59CD929FD19D8, 0x369E1E8A4ABA1662, 0xC34D5331BCFCE0DB, 0x5BECE78C74597A66, 0x2D3BC1E77277C014,
+					0x09E2B2042A347C4A, 0xABA80E20A5F4A530, 0xC1F7200D5DF15E1B, 0xDA3F42BCC9671BAA, 0x9CF6098F4179E898, 0x75118B391FC9FE1D, 0x037D20E460C3372E, 0x95B7141A4FFA67C7,
+					0xCE2052495F6CACE3, 0xD8D00D49671153B5, 0xFDEE4E6D0F08F8E3, 0x12C391737A44A76D, 0x74C3329F78DBCF63, 0x961909AE57EB0816, 0x24F537D6CB31CA6F, 0xDB8ED1916AEB35B0,
+					0x5F19B1FD80CE09C8, 0x2A59035553878924, 0x0B3A5201484CB259, 0xF7B62ED4244B14F9, 0x7CBFB937BE691C69, 0x274AAF3020C735A6, 0xC0F5747051B719D9, 0x324EA4B3E2D4FBBE,
+					0x67B873F6197323F1, 0x0F46B6761ECCE87A, 0xC3778CE46B5BE71B, 0xA64D6B3297235943, 0x321632CB984AAFBB, 0xD11C893C30B32654, 0x6A959CC61FDAB824, 0xB22EE808EE365199,
+					0xDC60AE47C912B942, 0x023CAB732A57B3CC, 0x2F2D84F6EC900546, 0x6B9559FB2383CC73, 0xECD0E2BCEA87E4B5, 0x9800C012E26E15F8, 0x421EE17132FBD6A9, 0x642011659FFEA934,
+					0x364F5B466FB6539E, 0xC98E8FD8AE85A44C, 0x5B5EBF8A380E4124, 0xF3507FC1B48520F0, 0x8BE6CDB6670A849B, 0x4FE1E47A5D5294E1, 0x8D887CDFAF8E3B63, 0x3A57E09A6CDB3EE8,
+					0x3F6246840FD66D40, 0xDC61F44D1E4DAD79, 0xD8F515E4C8A9C450, 0x2A15B745DB49D454, 0xC88D11B0D35AFD27, 0x14812B98D737C765, 0xF8FB02C6F30431E6, 0x09F5B281E57E3E73,
+					0x72FE041A0522F18C, 0xA6CD9B0D0AFFDD75, 0x3DDEB42C705A83D3, 0x66F5777B31A7AEBA, 0xDC1D4AC0663FD9B2, 0x286D276FFC578BA5, 0x27DA7187A84D73DD, 0xAC4FE2355B2605E6,
+					0x7425CE415BE47EA2, 0x916FE7826FA0B07A, 0x552F7A7BA13200FD, 0xF1160ACD5752304E, 0xBB556A7F703B2185, 0xA0A5321E743E4315, 0x96939377701FB81E, 0x7A8526A4EFFF84B7,
+					0xF062CB31DB03FDC2, 0x61BA37400DAAB046, 0xBBF9C952AD63A346, 0xD168D479E8880CAD, 0xB73262520E7CBA5B, 0x0770B8389ADA51FE, 0x46B54718EA8B5DEF, 0xD7495E3E4DC99F38,
+					0xCDE62EDA208C53EF, 0x7E529B992F233E9E, 0x8E47478A23079ED9, 0x9EF9775C8063E897, 0x829E9E444ACF7001, 0x9421AF2183E5C580, 0x0442E78DCB667790, 0x4C0444D30240C48E,
+					0x269E735C3F6A4192, 0x3B3E5347E20DEF77, 0xD8A7F4E2109F1086, 0x7B29866983C3375D, 0xFCBF346FAFD15181, 0x6D5ECEC30C114149, 0x42371A78632321A6, 0x7A2A97029CC0864C,
+					0x0930479BBB32CF48, 0xD9B7FAF0AD68680E, 0xE5DBE4901250BE21, 0x0D2BA3EE1947C357, 0xA5BBEC276127849E, 0x7DEA3498AAB8FB79, 0x4110F81DE72C7FD7, 0xB1D1F5FBE3D1EE20,
+					0xD78E8E5435BEAF3C, 0x0BD3324883B5633F, 0x38C9CFF18270AA7A, 0x76A6088C76044297, 0x6FCAFDBF76C2C4AA, 0x031F77967F8D64A3, 0x7827F2171DD1CCF7, 0xBF54903D46AE9013,
+					0x7BAA912602D69EFB, 0x0D3CFD7D1AE8C4BC, 0xED18FBA522A04BAF, 0xCD3109028B69DC74, 0x7E2EAAAC9A335D65, 0x30C257C5B2D93822, 0x47F128FF569138B8, 0x26D7934EEC0553EC,
+					0x2BC2B7C41B85C191, 0x80ABC28EB49A2F8E, 0x1E1C4B8A5883FD7C, 0x6F5492B8ECF73A97, 0xF46A571F70155CB1, 0x6EA9E24597C91180, 0x43B1AE0FE4969EAA, 0x1C862FB6C75E104D,
+					0x2CEFF643C5406346, 0x3F03453CEF787D09, 0x54CAC26B596FFDE8, 0xFB32234629DBB3D3, 0x2D05BF43B437F789, 0x1C5F8477BB857C59, 0xF4C4DDCD749422C9, 0x778825E23549ACD7,
+					0xFDF172CC0DB24332, 0x68557C663E7943CE, 0x31C32C79FBC2CCF6, 0x26BBCA9957D378A7, 0xB3CB9C116E7A449B, 0xF9D18784BB426479, 0x19F381E82D2070C7, 0x8343C140FFE00646,
+					0xB8023298F4E2DC39, 0xBA309C129E4F0B53, 0xFE579A4E2A5C6AD6, 0x8746A5D55FC121C4, 0xDDC650345101E27E, 0x716FDC5DD4F10453, 0x9630AE6643C69B39, 0x1DB1A05747820C53,
+					0x90C0FA94864E3938, 0x54099EA56C6853D5, 0x2DDE75DE10F09349, 0x5DEF4ACF0C92C8E2, 0x611289EB07EEDFF9, 0xECB3FAD3A715A89A, 0x1D332D3D0F2AD9AE, 0x333FCB4C972E5A7A,
+					0x724E4655C629E0F9, 0x5EF0DFA0FE0B2315, 0x1BD5BA14FFADC0E8, 0x90570D2DE4AB7EC4, 0x467DDD6BACB85C8E, 0x83881632E8D99DB6, 0x808BBB827B19103A, 0xF5C67588135C7B14,
+					0xA427D4204C13421E, 0x3E30C652BF53346A, 0x945D10158FE96F03, 0x9E28C0C4B55A0DCE, 0x24473A5754340BB6, 0xDCC2E8A17ACA1B1A, 0xB8D3064BC33CB538, 0xC61F912C4D5F1590,
+					0x1709013290F19060, 0xA633CE10DA432145, 0xFDCD3E1324984840, 0x2276D2D92DF0122F, 0x99DDEEE7B536720D, 0x6BDA50F4A4A176A6, 0x99B4F4F0D472EFDC, 0xBE0134BF2129AA0E,
+					0x61449EC885664BE8, 0x59D8C8619CF3C077, 0xEB2DB61D3F87C333, 0x5C8F416CC748976C, 0x17FEBE0BC95B14BE, 0x8AFB308EB14071F3, 0x7ECB05BEB07303C0, 0x7C331985AC79372A,
+					0x25D7FBC3E45EB3D6, 0xDBDA03AB9F1E225C, 0xF6B2FF65E3CCEE7F, 0x6431CB10D0E072D8, 0x6D46F588F526E018, 0xD1B4CB90364C7527, 0x2AB6821403EC4161, 0x766C891A9F0272B2,
+					0x3372115DDD89B5DD, 0x15465F382C2D961B, 0xBF00EFF784748861, 0x362CB770E31336CE, 0xA83E4E8889AA8DAF, 0xBA6E8B3CB1337237, 0x9BD93F04D48D82D9, 0x36496E2C957A419F,
+					0x1EA6FAFC989DB385, 0xFCF57A6A245672F2, 0xD50DA66B18638D7B, 0xA274EB5B0478FF89, 0x44E9569127C5C9C1, 0x3F8FC16B0FC7A345, 0xA19345D8C2AC9BCA, 0xE1C88CA493C2DC0F,
+					0xFF7D58C4F53D5F00, 0x94BC603B7B63BC64, 0x6D45729591BA234B, 0xC527FFAAF749834B, 0x58624B724B530F56, 0x2A5126B3B18680EB, 0x71531B3D66178D96, 0x8C98898A4046D047,
+					0x06551F31BAD90C6C, 0x20E70504A2EA67DC, 0xCC370C3BF9824781, 0x26C8E223636E1A33, 0xCDF42F29F444355D, 0x6E1094827F848F14, 0x8A081B2E671D430C, 0xAEE17A5821B5A681,
+					0x0443B7FF6E4589FA, 0xF2C0B6611F95935D, 0x6ADE879E1AE0D172, 0xB7E135C649383EDD, 0x75A0DCEF1D45FD49, 0xA5D17F4AE5690A15, 0x7EEBB5AFE3ACB52C, 0x96388688C6074276,
+					0x0F9C3FB51E718EA9, 0x3B2CC91E88810987, 0xC08974AB0CE3803C, 0x8BDB4A71948FFD7E, 0x3115F4B7846CB23B, 0x3688A0495CA9893E, 0xD04BA61B3F945796, 0xF17A14B6C89EA92A,
+					0xEA0D33576AA58E29, 0xC6E38FA99EA1F36C, 0x540CBA4FB6178470, 0xB8A1ACF4D2C6407A, 0x118DA16C3EC46A45, 0x39AA2ABCA348105F, 0xABFA34C845B19AD1, 0x966D304074A589F9,
+					0xAF70C3C67AAE72C6, 0x78E4CB49DAB09756, 0x8035D9E2C1704FED, 0x63023FDBE7922D5F, 0xB6BE02A0EBCBA5EB, 0x6324B488F6429D08, 0x1117D484D6C02152, 0xFED67DDDAF48C036,
+					0x7E6D3A1D89DE6810, 0xD8FB5B654A9BAD94, 0x993FA53B710305C1, 0x8B38009AC1800C22, 0x6F29CCCA750B7743, 0x76F6E399364C2EB8, 0xE9BCA89B9A37217E, 0x13E4C1EF66101F2E,
+					0x7AF99E585EF02C1B, 0x34730DE18ADC9E4B, 0xC4C16C116A53DE0A, 0x6D51B13FF3A9EA14, 0x61486D589904005A, 0x992E374EBEEA1445, 0xED1A7EDBCE633B27, 0xC893D1EE883BC555,
+					0x36CA8685C08C0133, 0x6BBADB38C3831AA1, 0x8A2A4C27AADC3974, 0x9CEE0CAB47D056AD, 0x3DB6BC27C2979BDE, 0x4ADB73EDA7AEDB26, 0x6F55EB02E6E636A5, 0x9BB7EC8E74709AF6,
+					0x6B762E555CB97A35, 0x8FBA3C67EC7FECD3, 0xA93656DCF094FCF7, 0x84EBBADC99C5092F, 0x0E4B9E1EF9B22D63, 0x9B800C8EA5086010, 0x3B9E9DD4BF7E8AB4, 0x7A10BBC2B6406A93,
+					0xCEADBB8FF2EC4266, 0x3E7F3097D119B808, 0xDA41DA4E6E6F4BD0, 0x8BC893B37097E5F7, 0x7D700F1C01E222DD, 0x180B1594B9779C67, 0xB60350006162C189, 0xA87AB9A7F5293471,
+					0x051D3876F0D734D8, 0x0E9732C49C9881A3, 0x03C73350C6615DC6, 0x4F9A677222F13875, 0x258F3BDACFF1AB0C, 0x79B2F1444F8C7BD9, 0xC8871051B48807E2, 0x075B1A94582D8F4A,
+					0xF2374E4F76ABFE9D, 0x5B8E46893EE33199, 0x29D0EF74A9C95945, 0x6B1BFAD94526A969, 0xF6A7BA67DEDB80FB, 0xBDC3B97DDB1700BD, 0x1EE4FCF61B12ADBD, 0xFCBFE86F82F4B742,
+					0x16FD3A71AC80142A, 0xCD76C70403F8FE46, 0xC634ACF92817D81F, 0xB316A540C4C70022, 0x8005BBC7ADF4A1BD, 0xC146DAA71485BF15, 0xC30DE2033674BF75, 0x0D3E910257AD2A7E,
+					0x199324AD5E3E8965, 0x78DB55475B192FB0, 0xDCE8D42DB026FB1E, 0x2B8FB3FB88F36EDE, 0x5E6D222E20AC0AC3, 0x83A20DC27E734F26, 0x9EB0F6775DB78D42, 0x6F9C4FF6F5078827,
+					0xC88AC1CA7B0C4C6D, 0x9B33BEBD31502CC1, 0x024C1422123DFBE5, 0xAE05917BB4784438, 0xEE306F2283BE0E8E, 0x339DAE4778B0603B, 0x652CB5F1B611D45B, 0x180721501A178CBC,
+					0x72DBCB1AA4E66BA6, 0x365AF9EE0B1A0FA8, 0x98FC9834FA80655E, 0x0A7362EE3A85FFC4, 0x5859E35DD3EBAE1D, 0x88D9FCDE9F2C02B2, 0xD7D3B7C0CEA225EB, 0xA1EC9868A545C80F,
+					0xC385284749B62D20, 0xCB9CB6450AEF96C7, 0x7A0D9B3C87EFB3E4, 0x91532C8D85F36654, 0xF26B11410AB78EC2, 0xA7D349E54DD20E34, 0x49E24311B722FE8C, 0x7F575978AA5A641E,
+					0xA44951F949B2F0A2, 0x277CA513EB0EAF50, 0x07B737B9415F5F30, 0x2B7408FA8F0BB66E, 0xE25CE7A194343E02, 0x2EFB71298F8879BC, 0x282679D270862092, 0xEF864273803F97E4,
+					0x1E01F387DD8FAF97, 0x4F85A69DDE27A37A, 0x4CA159A0479F2D46, 0x5FC7B7657D3B4204, 0xBBF696623CA2C725, 0x7A1D4CD2A58A2A4C, 0x813D879147645C41, 0xCF82D59ADFACE4B7,
+					0xE84D94DD47222FD0, 0xCDAC092D07760217, 0xAFAB20B0C402BEF4, 0x9ED894D1F97D69AC, 0xDCE963A3DF714582, 0xB4FB9375741FCE61, 0xACCCBC8460223DDF, 0x642AE46B0F6B6CB9,
+					0x3EBCEE02E579DC90, 0xE7A56DEBB679AAFE, 0xB2613E06D12135B4, 0xF24C9A88D5707B89, 0xD2594F49598D7F43, 0xE7E00709C1E8BD10, 0xE151AEFEB09ED7C4, 0x07A71FD6D69ABDC0,
+					0x4A8214BD6D0E409C, 0xB1AAA354F11EC518, 0xFB934467ABB104D1, 0x3BE13745A3E75EBD, 0xF303A00693544689, 0x23AAD15D9BE0389F, 0x1C572D3F709F3F7A, 0x859A8D742972C7ED,
+					0x1B05F00955303939, 0x6EA11290F752F19E, 0xE8316434C0A091F2, 0x530974D194F1E4AF, 0xAEFEF53BEC23AC5C, 0x4CA3E727DC18929B, 0x89DDC86D294FCD55, 0x0E583DE9001F86EA,
+					0x7216FFB0D9D4C8B5, 0xB1E30CC68ADC2E6B, 0x9BB42801DC71D7F3, 0x6848B029D4DA3D6F, 0x52FC1AF921DBA1C2, 0x3D1D4045003DC270, 0x0F5CD13F6E81607E, 0xA456450AB883D94D,
+					0x471994B6A9585DED, 0x5B84B3F4D02AFF39, 0x482E6AF4978A0FF4, 0xAAFDF6F29F5B5232, 0x2BE2B989A89E53EA, 0x63F39736A9202C52, 0x17BE2A08F3684971, 0xA6F2207DD144E5FD,
+					0xF83040B71A4B2064, 0xF7244E4F484CA470, 0xF775DA62561D1E5B, 0xB185CA1F3054AA9D, 0x34AED29EE08655ED, 0x5B62D7853EE53451, 0x0DC5E4AA6A55BE1A, 0x625D79540270B72D,
+					0xD835654942B83AAB, 0x804CCB1582EC2973, 0x7BA7F36301342F65, 0xE7A81B2DFC1F13B9, 0x07E54BBAD3495ADF, 0xFB857481A3A1465C, 0x1928401E4818B455, 0x74AC309662CBCE54,
+					0xCE29674C011A4DAD, 0x8E2F05D0832710FA, 0x0499FDD0D181094A, 0x973F7C334BFA41BB, 0x34112B17B89CD7D7, 0x017627B4B1A0DEF9, 0x409AEE31338F9806, 0xD5F7DF09C6D0DD6D,
+					0xE04DA44E37BAC7EF, 0x1591238CE0AD1793, 0x58BF53127B3DAC5E, 0x381D2CA292A37364, 0xA2B184C399BDAC22, 0x3EB7123146E7C76D, 0x5DD372050789A401, 0x006AB0D41A947B9D,
+					0x422DEF78E9A20459, 0xD52DABE7A7A37E1E, 0xE6AF3E93CCA5204F, 0x26A654F9C7742F08, 0x336FCCEACB820002, 0x3704C7C701823760, 0xDFECAE8C203CA3BA, 0xC107FFB1A1ED1615,
+					0x09E6C6D24A7E0499, 0x7F569E3958D0FAB4, 0x2C3DFA7FD9A07ED6, 0x1652026C14C5B7D4, 0xAAAC9606A5478502, 0x06353710AD09A64E, 0x91E1A8530D205F09, 0xA6FC59EA17491EDD,
+					0x30560BF98CD73AE7, 0xFB9CA6362C151EFD, 0x461BE56113853CA3, 0x77E03A8715267A7F, 0xAE332EE6F190633D, 0xA803335CCCD5D09E, 0x7DC9C9D68929CE04, 0x7875C6C46C3FAA51,
+					0x603E8D497BC4C1CD, 0xD1007780DE8253CC, 0xA674B084961EDCCF, 0x0137DCF378230BB7, 0xBFF5D665A2FD56C9, 0x6F4CA9091EA679E6, 0xEC72E711EA867278, 0x034CB6717B755E48,
+					0x5DDDC8A5A4E2E6DD, 0x8A967B7DAD4F97EE, 0x1CC739EC06F7BAF8, 0x137C4F55F1CF7C96, 0xDFF223F0C4C31F91, 0x51B71258F347746B, 0xA49446320B6D5E61, 0xACB3F6340CAA613C,
+					0xECAEB8854DF50E46, 0xF16F39B5FCAC5078, 0x0B0735CFDFD37EFC, 0xFD6A957A5C736256, 0x17EE09BFC62BBFD0, 0xC404A0CF1F3298CC, 0x8B806E3003A3032A, 0xE5800EB118FD16F1,
+					0x98B843655666A73F, 0xEE34EE8A39149801, 0xE542A6F1B227B904, 0x18CE48D4A603091A, 0x80DBD2E87E665305, 0x3880C85A71A8854E, 0x581C04BEE9C2903A, 0xC117C53802658314,
+					0xF4A6ADF3F554B9A9, 0xEFFF08BA9ACB0705, 0x25BD4E1955771F6E, 0x9B98D00FC585BF70, 0xE96FE2C295082B1A, 0xCCD5C6D45EAAE50C, 0xC21AEBD4C4F50A29, 0x8EB301C056A313B7,
+					0x3D7CBBBB5E398B4B, 0xC2CAAA431D64FACF, 0x2F8A4ACA1733CBDC, 0x8C1EA0BEDBAB4093, 0xA5C4950F8D451553, 0x5D3E07E4EF2401A3, 0xA525A749C50DA275, 0x67A2BE735EAA8285,
+					0xAA3480D5D67274FF, 0xD3573DD2E38316F2, 0x49F37A2A37F2DDD5, 0x268A32CB4C548AAE, 0x5A0F3C4C44F645A5, 0xEE1B5F6CE42C6AB7, 0xE8F4E6E700BEEB83, 0xE9EA6D863DDB226A,
+					0x955903D4EEADE44D, 0x6298581EE78B9ACF, 0x1D55535523F444B5, 0x3453DC9F0864C65D, 0x46AD7E2FDE3B66E7, 0xF6D35838EE543B31, 0x37154F7F8227F9B6, 0xD7BCAF03DCB07C2A,
+					0x6F962BB935948E2B, 0x14BA493D4461BE18, 0x389C9EA38B231381, 0x9E46BAFAC5547BAF, 0x8EC13ECAF82441EC, 0x84275E86085FD4E2, 0x49C18200FD81A841, 0xB89A4F54B9169D71,
+					0xDBD0C9CA8E7A10FC, 0x758DA6702E365D56, 0xFEF116042131C8A1, 0x2238221C047533FA, 0x329960CFCB55E93C, 0xEFAEEBD946A44054, 0xF8023D82759D6690, 0x7BEA15D07DE7EDD0,
+					0x9F73560C53D7EAFE, 0xADA0F287C22F4BF7, 0xAD4413E57296FB59, 0xA818CC62D05A1839, 0x8F2CD342F8BDA8EC, 0x8995F78A0D77DD72, 0xD6C58EC291B1399A, 0xF007D5B2F2DF09C8,
+					0x2B31105612AA40C1, 0x09F38BD8212FD43A, 0xE7E3BB848D560943, 0x45CC885498D2D173, 0x7E24F334878FCAAE, 0xF9FB63DCB06FB5B0, 0x57BBF8872884B9F0, 0x01ED2D1D73156D71,
+					0x71157BD2EA4E715A, 0xF07C98B97BDAB172, 0x95DC13085A57A564, 0xB367D51FF57E6FD4, 0x7E401DE155030179, 0xEABD781BCC9BE94C, 0xC8395F70C81118EB, 0x2CE4A8F04FB551EB,
+					0xEEDA1180DB3BA8DE, 0x219CAFE47A6938FD, 0x140F641985632817, 0xF7E449C2AD1FC14A, 0x9B9164CE462CDAF8, 0x818274F51B1D46FB, 0xF8F33C4DB4DE2C78, 0xF35731501123021C,
+					0x17BEC190A47A6B2D, 0xC261CC9F074F2F32, 0xE220AABAD75043E7, 0x801107E79E640BFC, 0xFBEA7E53FA2EE7D6, 0x721B3E4801D06BE1, 0x87B09456A63E77D4, 0x212890E4C94B74CC,
+					0x1E5B986D5528C606, 0x4D8AAF34D6DC9CFB, 0x0FF170E54508BC24, 0x0D9401183B60A8F1, 0xAFF0A0C665D9B3FF, 0x9100E124BB762069, 0x5003D51DCD7CB467, 0x4107AB958AF1E34E,
+					0x940BECC4906BE6BF, 0x596CA242C63C1014, 0x99DBDB61B2269F86, 0x494EB97C95898CCF, 0xF9720C224A4A7E5A, 0x02786C8603BB5DF6, 0x6998ED99E30731AE, 0x96FBB9D4065DFD4B,
+					0x8EA8AD36D24F6EE3, 0x6A80FC7AF95B876D, 0x7D2E8343BC4903B7, 0x90F0159B8F651CC2, 0x7462FEB6443264F8, 0xC22A17A91127AE03, 0xD39A981A7071C79F, 0x1E462B3D3E427E2E,
+					0xA0C87028C5F160B7, 0xF368A2D126C1E00B, 0xC56D0BDE9401CA57, 0xA2AD6AC4F1D294CB, 0x71C4ED5BA04F023C, 0xE41BEB8D865C445F, 0x612AF679D275300B, 0x23A1D369388BBBE5,
+					0x01AF0D2D46775F14, 0x4B8E6EFBF3CDDD1D, 0x32A88B68216D365C, 0x5A403945297E9789, 0x9EDC2E79FB5CE4EB, 0x41B7A2A18EF487E0, 0x051D00BB984F7E21, 0x1146D7E77C0F3034,
+					0xDA04ADD1287DCD1E, 0x0BB9FA1601F02C79, 0x5D29D451F251C89B, 0x5A5738A5981F1EEF, 0x98B68AB9C0D268D2, 0x6C37F72B18F05E95, 0x1E976DFCF6A1B37E, 0x5AD34A8913A1C8BC,
+					0x1AE23C4243FC402D, 0x54E38C7968B10A68, 0x261AAB0E8E384632, 0x5160904968E808D4, 0x26F449FAFB0C3720, 0x393370E2AE32FD22, 0xCF60CE20ACA66E8B, 0xAFBE71D5B3A8B7E7,
+					0x2520B932EA8D7295, 0xCB06A6244ECC4800, 0x7952262102A4A528, 0xD7EBA9EB0DB857C9, 0x076EE0D7A4619AE8, 0x61813F539E6CE370, 0xA83E121E9E04FE90, 0xBDF54E51E6028682,
+					0xA95800C7FF08BE8A, 0xC9118ED6AFD3B2C2, 0x15FFEB4899B3687D, 0x48CA0E79DC7F1FCC, 0xBECEDCE7224159C0, 0xAB5D931FBAA2A469, 0x103B2D5C5E3589BA, 0x5412D620B786D337,
+					0xCFC666F6C6C51871, 0xD6E982552CE9F531, 0xEF1CD8A99968210F, 0xB6363A06F25BB37D, 0xAAD4D7CA6D623864, 0xBD8916D53A32EB1C, 0x228DFF1A3E09238B, 0xEADAB2E763A72C2E,
+					0xE8261E771FF36570, 0x6C6BE9EAC8C64EC1, 0xF471F132BC34D101, 0x24F9E5C90E9B5FB8, 0x50F3682CED5259E6, 0xF374B0406F4A9E80, 0x6CA9E2E3B960F1D8, 0x0E3430B67E58B5AA,
+					0x72B6232559BA85B2, 0xA5EEF65C0623D94D, 0x039B595EA87EBC49, 0xBA0397A957E8DF5F, 0xADA12D63AC2D732E, 0x487B4C72AD7CCC06, 0x8CDB502D2944FBAE, 0x2E6187B192A619A1,
+					0xFBFCC9893307CBD4, 0x2A8EF66E15FAB0E4, 0xDD16749535831378, 0x3B25B1BD499E8764, 0x06ABF1EA23847D73, 0x9A74E33A32E0D36F, 0x62DF16712682A6BC, 0xAA1D62BC602CDD23,
+					0x0B74C41F0B9AB77C, 0x5DEC4CB9E69ABAF7, 0xFA6BBD84249DE5F6, 0xF957C568A99469B6, 0xD46F27E875471C53, 0xAC30BACB945BDBB5, 0xD2801CCDBE6C36C0, 0x5BE7D0E6BD842597,
+					0xFD29FA5167E167FB, 0xA01320233CA73177, 0xC6BFF0C626128F95, 0xA8992ED89535B437, 0xB7B11C6A31C7B3D1, 0x5D43CBB4C475CCA9, 0x615112DB996CC556, 0xE8F0FF35086C66FA,
+					0x9F40894E949FC484, 0xC17E8E120D6A0EC2, 0x78925DAC6B55CBE3, 0xC29C2B213300ED48, 0x40A59125211E17E1, 0xD73BDD1C5F2C346A, 0xDC2EAB217115B081, 0xDE279F0F3B0ADC85,
+					0xB8DD767065F518A4, 0xE8A003D9D8B3252A, 0x009A5D0F72323685, 0x176C005ABBA47B8A, 0x3B863A8041DC8F01, 0xB4E28764577E6DA7, 0x96EBFE937DF1FD9E, 0xC1A9914B7C9829DA,
+					0x791E2B70EB4139E1, 0x0C869B4B799FEBAC, 0xBAD281265E3AE65B, 0xF0BFBEC36FBE1A0D, 0x8452C4160FC6E110, 0x3DEF856FA56437EF, 0xB1BE4FBDB990752A, 0x9035C498CECB8189,
+					0x24438BC606F3D6CC, 0xFA0FA3EEF9924700, 0xB82957802F0B59A2, 0x7E32F63C8E038C6D, 0xC76F876043A5628D, 0xBFD85541C997AED3, 0x609960B2DBB963C0, 0x061BF7838112E218,
+					0x07622004A72C9865, 0x853B4DC7374DE5DC, 0xD4304F5374CD718F, 0x62954E8CFFCDFEA7, 0xB0111CAA91C9195D, 0xF3F9F63051FA3C58, 0x7EF2E3D9AD3E70E1, 0xEE6D6495E826FD59,
+					0x11D602FFBECDDA6A, 0x628C63C83518E1CC, 0x89F885071C79DA23, 0xA52F8D6E11A8E1F7, 0xD831EAAB6E69A05C, 0x3C66B4F5FBA9B186, 0x86459124583904E4, 0xC12021CDC2CC8825,
+					0x9A463498CFFE82C3, 0x4B3F167276301674, 0xF1A40D5D3858D504, 0x052AB2D7B0BA0A53, 0x348AB0C6610D7208, 0x1326F43FDE9E0458, 0xF7238F95644CED1E, 0xD9BC865BF02069C8,
+					0x795640B7862720BD, 0xF838F8FE19A23226, 0xF0114C5105AADED8, 0xB9422EFAECE1226F, 0xAC89A150A25852D3, 0x7E7215BCCBA72008, 0xC60A4D1328458F7D, 0x7231E9DD46A4A5CB,
+					0x2FBA352EFC424F2E, 0x82C13AF8DB82E6B3, 0xA96F0620CC57400E, 0xF128019FC20FD855, 0x55D921DF03F1DC93, 0x1F0F3A3FFE4D7F62, 0x07C089709C27933F, 0xDCEDA923DB40E2C3,
+					0xB9E27A2895E7DC70, 0x2B87AB68252FC8AF, 0xDAE2EDF161BD4D92, 0x3D82C12352157DDB, 0x5D19BD35408FE4FD, 0x2CF900F873697263, 0x000A4529173B084B, 0x31141931D3B535B8,
+					0xFDFEB63F88DD1960, 0x93F47476C61A8FB4, 0x852FC28CD1D83404, 0xE9BC4E53B315D888, 0x9200070DFA98AC6B, 0x6A1312064492811F, 0x15BE5A6110545B78, 0xAA58E93430BF6E86,
+					0x7025E0EA39AF9355, 0x622B8B219A4E1AE0, 0x4EC315E101A8CAF8, 0x2F37EE32F80BBFC4, 0x4978DEBB7E22B63F, 0x78D5A52D77C9E744, 0x076782A0E428F10A, 0x85AC0EEAF7BDE24E,
+					0xC380025C455B98B1, 0x5376DEF1DF1E22DB, 0xE79C4337537803C8, 0xC13366D9EB5D38E6, 0x10A434B29147D4A2, 0xF874C7228BB7F00A, 0xEA8DE2D226FF2D85, 0xD49DAA0643A526E4,
+					0xA735E7571711C520, 0x58831BD2AA60006D, 0x99B835FC056BC44E, 0x583C8824F157BB1B, 0x3D7832D25AB9D633, 0xFE65C74B7BAAF530, 0x3C21E96EBD283C49, 0x6B54592C81C827B1,
+					0xD6C64F9FA1DB36C5, 0x20E1DB25B2A41B8B, 0xC75D6B442275C922, 0x707B596E556611AB, 0x7538B7D70699E870, 0x6D2103B370EB1E26, 0xB549DEEF97C069A7, 0x5C9B15FA31F9C58B,
+					0x31F04D1BAB92FC54, 0x6A629DA834E2321F, 0xE0C273DBFEC9B0C6, 0x5913CDE3DFE44A5E, 0xD50B92A1A1D87E1B, 0x01AEF0776D9F3445, 0x71C7D1E4610105BA, 0x74FED05FA508CA74,
+					0x399DBB3DCA79F5B1, 0x007CAE9DCD5D3C5F, 0x4BA8B865959F8419, 0x8E96EF1E2881BC97, 0xF4CC816C58D88257, 0xDA753CDA05DE3433, 0x056422DD84A33B1D, 0x8DA3EC22C2B088E1,
+					0xAF2B458CBFE80457, 0xCF821D309358A8F9, 0x1D2991086C6B54CB, 0x2BBC9333D027F857, 0x5BA0943C6A60CC4A, 0x55BB9AA7CF954030, 0xA98A12D4447A71C3, 0x8B3C13C2BC8A8103,
+					0xA08BCFB33B94DA43, 0xE2294552F3C998A2, 0xC29F2CC1631CF720, 0x68A282676437F9E7, 0xD1764FE1AC5BA083, 0xF15B2E78BA956BC6, 0x6B2A97900E8945AE, 0x27E902AA86E18F9A,
+					0x453FAC5E1184FD73, 0xBFFB4B3976414AFD, 0x102B42FD3F890065, 0x239BC1FA73592241, 0x01E4B54A95385675, 0xB49AC5A8AA74EBEF, 0xB85C4BC87C50C462, 0xA64E35CB38818CD4,
+					0x0E1596779F559C20, 0x7AE179AAA29DCB39, 0xCE2FF994413D2AA4, 0x588B2C784FC9023F, 0x991719933849D123, 0x28D0BEEAF92A6748, 0x06896DCD8975040B, 0xED0817027B270F32,
+					0x7B028E8ACD6FFC20, 0xD8150499555D77E5, 0xA544A0AA115EC522, 0x040DE3D188317485, 0x071CC4EDE36E5EF4, 0x9DBAB107578F11A8, 0x98A48C8FFAB6875F, 0xF428BFEF5AFB2706,
+					0xFEED692394E7FC51, 0x265D15CB114F5FFE, 0xA907247E97819BA6, 0x8CCA120DE7C71D51, 0xC001ADEBF87A3936, 0x1173DFF4E7F11828, 0xAE54F9DFE7F692F7, 0x8AAA50B46095A216,
+					0x551E3293422E3E7C, 0x50F12C133E82F907, 0x9AC72CB69FD9F4F8, 0x46E5D8FA7001FF1D, 0xB40B174CBD4B1804, 0x66F775C3661F3E91, 0x3B7EE41DA91DDCDC, 0xF52C45179D59480D,
+					0xA09739DCCB00587F, 0x0EDDED1422AAFD43, 0xDA57736FF4545F94, 0x95B1B3EC948F1F66, 0x310300710489A2B9, 0x490D114ECC0F671E, 0xD0ECE5967E4EBCAB, 0xE935D48556969F1B,
+					0x616992D24E7FC5E4, 0xC5F9F3C637E66A70, 0x1CB4F25F7AD05F3C, 0x2EE7A304F6B1B59E, 0x00AC93C1F42D947A, 0xE0B119261229C2E7, 0xC56B34EF9945F829, 0x5DC15202C5C2D5B5,
+					0x389AF9C7EE5C92ED, 0x4264D756C790DF28, 0x2C4EDB962BFF9D19, 0x2B633BFB736346D7, 0xCFA594C6C53CA622, 0x1264EEA94DB19B82, 0xE492E0723FF7AE6C, 0x184EAF190AD1C44B,
+					0x2E4336A464771D70, 0xDEE3ECA368F82CBE, 0xD86D6E5F1925D773, 0x9AF2F08AB0C7FC16, 0xD367E7365EC9E0E2, 0x3CA8FC29315B3437, 0xFBE13E4DC0C9154B, 0xB82863D0A54B4AE4,
+					0xB4558220F6E2BE23, 0xCA7314531A7C6512, 0xCBF8083AA137A78F, 0x4293E557B6946BAF, 0xC8E3999FB71AF973, 0x132AB239F723F46E, 0x34904B917879B811, 0x675B4D0CCA7CDC9F,
+					0x2F22A59256476EA8, 0x553CA1D1FA9DCE30, 0x8DEB33DC69EF2E6E, 0x6B349CC4EDAAF377, 0xCD205D6CECA130D2, 0xC7E6D2394097EC03, 0x0FFBF7660209A12D, 0xFAEBC1367BF61FCA,
+					0x30A5666F2B21AE3D, 0x67A2EBF4E1F7A8C4, 0x22FB0B9C00856E04, 0x4268489AD214C29F, 0x41E5C6564F096200, 0x5F79AF061D5968FA, 0x9A7C97031EE342B3, 0x2750506B3C7681B8,
+					0xB5C710A06FB7E79B, 0x5CA54E9011F32341, 0x2E6C5BB8FAE728CB, 0xCD1A23C145CE735A, 0x5B37A8A5789AEF48, 0xED05352365E83B5C, 0x6DAB2B29255C87B8, 0x47DBBF9D0292B339,
+					0x97A5DDD43E72FACD, 0x16D4953E9E2C93FB, 0xBD463C3FEC725043, 0x5AD258DC7E700A0B, 0x3C76C97EEDC47E3D, 0x8EC49FF6D59CAEE7, 0x88623948836FC3CF, 0x0270BA8C1623A727,
+					0x59B7252A6769FCDB, 0xF6B3284D0994A6C0, 0x667A8F3D271AF304, 0x0EC5ADD659DBA9B8, 0x4154FC267AA2ED63, 0x923E8C7992CB921D, 0x5C64BF3DFE509537, 0xE30F290E906AABB7,
+					0x831CA7F97DC424FD, 0xC888830B31290E09, 0xB6543D55BDEA626C, 0xE38585FCEC80DD99, 0xF239335AEE94ADDD, 0x215EFD75345A4083, 0x42D6C6DBB2EBD7A4, 0x5D7B02B66BF8F52C,
+					0x56537FD6A70FB2FC, 0xF7CF192D2FE38256, 0xC97D621B7C23D7C0, 0xE58B0A8053FC0C5E, 0xDDAE4A4ED2CB3681, 0x222A67EF51293A53, 0xA71158E81C8AB9CE, 0xDAFCD45CB83E38A1,
+					0x8A351612A6237E04, 0x9030203199D69197, 0xA58CF750DE5181E6, 0xB34BCF08578EBA6B, 0x3E015721A0502529, 0x1BA7498E3BABF39A, 0x647881C6F9473C36, 0x585D2D1AF21647BC,
+					0xF1A126E20585DE04, 0x8A94B86D328C5AB1, 0x9B9DAEE37670AB28, 0x32762CB41C40E2F9, 0x95F32326578D6133, 0x07CB879AF668A309, 0x298213140025A875, 0xCC399610422C47CB,
+					0xD79A5C9729D12AC2, 0xBE72CF4553E21846, 0xBB653F4F191E94E8, 0xC4B73297EF5354A2, 0x2BF0843FD914FF5A, 0x7473310CA48DBC43, 0xB94779501B04684C, 0x75B066EB9A850A2F,
+					0xEE678A95E99659A7, 0x6ACECE9C713250A8, 0x8C19699A007D5A56, 0xBC2439B313ECCE8C, 0xF3E6F9818FC64846, 0xD07B88921EABD729, 0xC5185CBCB2152EA0, 0x3EB6AA1E3C41F8EB,
+					0x342DA9BFB9B453CF, 0x2A4ACD916E00BA6D, 0x95D9DDBC2E1139E1, 0x3CC0AE678EA79BDE, 0xD1ECDB67622BFD7C, 0x84668C156714E8AA, 0xDEFC25F7C712DAA9, 0x0A682D13D3AEDF83,
+					0xB2A548BEA191875A, 0x2D4921A61118B448, 0x91F35A3C9EDE616B, 0x31C9A703F4E4994F, 0x720799D8AD02D73C, 0x105180921B70C954, 0x7326313CB456A3C5, 0xCD798455B02033A5,
+					0x685E227B3702C00F, 0xD44BE9A54E6E2A5F, 0xC2C843E83F08F58E, 0x4F733C77DF7A2BC7, 0x7CB947D0C9490AE0, 0xB874C8380EDC264A, 0x0A3471997054A3C2, 0x7FCFF7D7B06EF9B8,
+					0xDC3488A1B7424B25, 0x5FA93C561D6A4AC8, 0xAF914EFC61C1C0D7, 0xD85B210C4E593EBC, 0x4D1BDA1A2A81E993, 0x53686F277B461F45, 0x97FC4CB3FD8434F8, 0x64F1986FEA54DC11,
+					0xCE3AE5D8F939C8F8, 0x2935530F8D9A99D1, 0x1FFBDBFBB583EA03, 0xA9092ACAA427BC6E, 0xA3CC19B71DB92785, 0xBEA8CAE7330BB193, 0x7223CF921A16C9AC, 0xFDC0DC2DA20A04C5,
+					0x3FFEEBA5F061A177, 0x6829C3AEA2C6A963, 0x6F794E0A84026ADF, 0x6019B4B731169F96, 0xCC7A92E90CDB2185, 0x4EA9DC2A1B075369, 0x1553484492D17A02, 0x3141BF33CEE20BB7,
+					0xE3294BBB98FFC64A, 0x93B953EF5554B92C, 0xBB09F8AE686432FA, 0x770CA3351A433878, 0x7D11661CB5474474, 0xA6B49AF5EBAE7C1D, 0x20579C10531F729D, 0x327D2EE99C3B60CA,
+					0x157E5F2849C4D826, 0x802B6300F53DF1BD, 0x214738422EF3C8B5, 0xF23283045E8874BE, 0x102F4B85158A1189, 0xEE96D8B8D3B34148, 0x6AE2FE46FD27C3CF, 0x9526490BBEC8FCB3,
+					0xDE1DBA19415A7417, 0x498F185A1CF2D458, 0x98EB3732F2A99B48, 0x344949A7495F358A, 0x549AA8C198C90683, 0x24D83AB5884FC274, 0x76E5DE58440D4680, 0x2AD284E56B7D08A2,
+					0xF387FE0161939240, 0x5D33DC5DDBD7823A, 0x7718444E9C5162B4, 0xF6CC6F0F21BC278B, 0xAB336B2C48AEAEEC, 0xA139F6B8DC0C4234, 0x2A8EABDCB67ED466, 0x33B0ED1B91F68F5A,
+					0x4529C2C59BF37653, 0x90829F5021936BF4, 0x0F7B5C34DC4D8B6A, 0x3D7DBE93559F0D49, 0x19704E38371C0EDE, 0xEB9E677D4D305182, 0x229EA7B6366B0735, 0xEEEE125CDC8B8640,
+					0xB444535FC386A931, 0xF13FC792D2EF7BDE, 0xBA283D4C073B7235, 0x9D1C9FCB78959362, 0xC9D667C2166218D7, 0xC87EF46ED5217A60, 0x9807D7CD8240EF8A, 0x5A590E8DDC71B4AE,
+					0xEA0C1439B52713EA, 0xE358928A91E12A8F, 0xF1EDC6F91EC43462, 0x26B4A6D59A6900EE, 0x70C8A7E7BC27B971, 0xF1479DE01DCC30CB, 0x5BC5524766883782, 0x1C4AAAC63FC6888F,
+					0x1CFD7E0129842ADC, 0xB7A7BCE00593C003, 0xAE2D5E643748881A, 0xFFA2CCD5F899DF22, 0xFADE903463FA3850, 0xBB42D36E6E0D2BA7, 0x5098E0337A7FD0CC, 0x6BE73AA5D315AC6A,
+					0xBBDE5F3023931D59, 0xA69C14068DABF826, 0xA141731BD6FB9CF6, 0x3899D14F56E344FD, 0xC6C4CD77D1F50296, 0x4D8FC4BF45444562, 0x000B0CDB8EF31FAA, 0x17B0F05D1620DD5E,
+					0x44597C289F66AF16, 0x173CE62F6100519E, 0x069E78915553ECD5, 0x01C5A1B6A070F110, 0xEE09212D9F05BE2A, 0xA51A413D42D1952C, 0x228EC156274E2625, 0x2E1567DE8D633348,
+					0xE4299044FB9887FB, 0x9A891AE422D4B515, 0x0C266D863DD672DC, 0xE0C681235D617218, 0x5CC0320297CD1BF2, 0x3F74762772BC531F, 0xF91C307F4AE2D9C3, 0xFA207DF1A428C1D9,
+					0xE7EFB84BCB25D913, 0x862349DC82DDA405, 0xD5A17E3EDFA82A20, 0xDCC5A97B7014054C, 0xB619EFBA1C92FB55, 0x63453BCB678B9511, 0xC9AE54EF1695BA55, 0x87ADCB83182DE778,
+					0xB86BDFA4D3C98E7E, 0x06D1482FF3BEC751, 0x7F736C42A04B0575, 0xF483661818BA653C, 0x5D95FE3C151432FC, 0x36AD807316A6BBB9, 0x77199E70A089A5B3, 0xD9F9B2A19C159ABF,
+					0x1F06598F7094A006, 0xFB1410E8B9B596DE, 0xBC59497ADF72364D, 0xCD38E92EF552B5A6, 0xF85F49652A2CE9BF, 0x14354BCE4A7E002B, 0xEB0666BD7B45587A, 0x640B82F1EE73B599,
+					0xF4F71EABCDB3E50D, 0xCE7BBF4BFFA042B9, 0x15E02D6247B1E751, 0x85713CB399D7023C, 0x7A6622ECB082FBC5, 0x66B8CEE155F26149, 0xB68C8E078BC98362, 0x0D5EAD4AF7BA9254,
+					0x8A7C0BE4C49BBCE4, 0xB07AD6D700820A38, 0x90758CA58C9E9FA3, 0xBF3BEF3C01D39A00, 0x57C22C2A81CA3E88, 0xBF691851CA2DC28E, 0xF2C185E923B0C4D5, 0x68D01C4D7F416DB4,
+					0x6F32CBB6598B168F, 0x4AC4A8EEBA40DD98, 0x0CAFFB4D102FDA40, 0xB7F1E5F4BEBD1DD1, 0x336C8058187E29D0, 0xDBE0C0B884DE6FB3, 0xFDDA142AF3119E32, 0x89DE43639EB29CBD,
+					0x053D030112F370DB, 0x9E8076CBDAADDC8E, 0x9A0E78C7BF330951, 0x875DF83E7AEAA0FC, 0xFA5F4B56B19F473D, 0x0A27C43E2EA793B8, 0x9C5A575DDBDE3AB7, 0x8D67BB20EAEEDAB2,
+					0xE89652476153A3A7, 0x4F4AF76D76D279F0, 0xB0DD496D8F098B06, 0x238337B53E7A6D8A, 0x6D4AC9E1115BC486, 0x346C11DBDA285ED8, 0x5DEDDB51F4835862, 0xECDA951BB7E6F613,
+					0x4CE02A0D56713C56, 0x0733E3E91394EA3B, 0x01B1677E4C551EE2, 0x08BA292EAA3FB226, 0x22C7AD1A517F41B1, 0x8E7594873257F5FD, 0xDB6A6E621A3B52A6, 0x6FF69E2D74E3096C,
+					0x32671FB6F0D56FC5, 0xF108E3BA193FAA82, 0x1304456109741472, 0x54243430C09DB567, 0xC1D3A4DF6D5BAC4B, 0xD872AD1947655A6C, 0xD41584C6842E6B8A, 0x2B26AADD3C596C32,
+					0x7A72C8E9B3D04CC8, 0x7C12579081AEFE78, 0xADF1892A738E1C97, 0x1F3783396CB28465, 0x317BC443FDC44F35, 0xF2CF8AD07AAD7970, 0xDE6FC0B0A34E8487, 0x20927102199D7F0C,
+					0xA148BD98CD761D12, 0x4AA04628783F1E7B, 0x7CE11C87803F8448, 0xA78456EC1F290155, 0xDDD2AB63ABFABDA7, 0xCCD27B24CCB574A7, 0x5E33DAD0B065EFF6, 0x85D31D8316ECBB1A,
+					0x37C8B40313A9CFE1, 0x0FE398AD5F4B913A, 0xBC0174FE9F2F6C22, 0xFDEE521D494DEAC9, 0xA94B3528CC010158, 0xE3D85100A085C0C8, 0x5367A9ACBADC111D, 0xA332F35EB2C6D338,
+					0x13566166D37CBCDA, 0xFF9BB6E8D4D3BEBD, 0xC88DDF0C42248A1E, 0x39ABDC075A821927, 0x9D3C3116A833EB9C, 0xD12C4F048A05D46E, 0x3980BADBCF6F9B69, 0x61F6F89D2C4309F5,
+					0x7D250AA382BA20C7, 0x23B3AA24AE048CA3, 0x3398B5F6BBD36D5A, 0x2E3BFBC8AAA6A188, 0x08F1299AA0F97B4F, 0x6DFC81D2E7408F75, 0xF1CA12AEF04A618B, 0xDA6293B399EBE2DE,
+					0x089BFAA4C6C1CB4B, 0x92FD466CC78152AF, 0x28EEBA764F577AFD, 0xB7E062E85EE2D4C4, 0x32BA6BC4069CC305, 0xC5974FB8549E2B35, 0xBA1B99908F6DBCE0, 0x98C70DD9520D6D3E,
+					0xB10623BF945FA41F, 0x79FB1716E8D66C12, 0xAFCD184F42D1D198, 0x4E685813F6316C5C, 0x054CCB005762D501, 0xFFA2DD249809B6DD, 0xBC4529C2273FDF39, 0x2701394E53B81FE6,
+					0xDAAF84189465FCFF, 0x3D96DEFB2A5A666D, 0xD5CB9705D7C2C701, 0x4602F591E641669D, 0x1F7A00396ADF6ECB, 0xF202201C16984470, 0xDD622997521D2C5F, 0xF060442FAF4665F2,
+					0x2A79E6A224AA6459, 0x223C119EDA9BCF8D, 0xE4FBE49AF709E8BA, 0x776BAC8058F92744, 0x56155B857C9ED698, 0xEBE9B14272C79ED8, 0x01C84BE1998C4BDB, 0xA23975A2475E1992,
+					0x8E944ADCF0D2207F, 0xB91FD294D179AFC5, 0x3D27C036424DF437, 0xD4F737B0CC1A0F73, 0xA56A068EC6A226B2, 0xA1A110527A803168, 0xEB8EE6611244709C, 0x07A7AF47FF52EBCC,
+					0xBC3AD02C46837A60, 0xC13250DCC7D72CBE, 0x36BE6D469D89FBA9, 0xEB6E2DA38A3D8A75, 0x22461777489131D8, 0x930A3D67009CA634, 0xE768F02047AEF13D, 0x452585E80749B1B8,
+					0xAE466D05077CC3D3, 0x9781413EC220A955, 0xC4C0F708B043F626, 0xDBE69A4094D6F700, 0xC500A55C4F5B6EFC, 0x3261DFF001EE76F1, 0xD6F7DE224E93D9AD, 0x3BD6CA27B383A415,
+					0xD9E50575644ED7F3, 0x2CAB90BEC4991CDC, 0x038CA95A78B695A0, 0x8D57000F1E6CB241, 0xC55C1092FA62AAAA, 0x658E06853FADD906, 0x616997DAE8FB6A9F, 0x69DCEDA8F3090612,
+					0x57FD5BFFF2E708BA, 0x4B8EF589FA8A2B47, 0x6E9C6DD2710F2698, 0xB08935E45F044C79, 0x9A964DB948CC6B97, 0xE6D42224529D10A5, 0x90775EA3EEACBC7D, 0x255C21788E2326DA,
+					0x030C0DDC7FDC49CA, 0x2B405A0293B906C7, 0x9F624AF90474CCB7, 0x3B78B5456AD5774B, 0xF183C3FA2727B65C, 0xFA3BD402EE87DA53, 0x6F36394FA7B52B29, 0x8624D07CBEFCAD21,
+					0xA26DFDFAE1F9C88A, 0x4991016A8F67EEE7, 0xD9FDC5B04BF9C0A3, 0x47E42B8DF6922341, 0xFF9848983DBEAB14, 0xC23FCE3057EBE069, 0x5621500172A9CDC4, 0x537189F92316E016,
+					0xF9CE6EA0C1F9455E, 0xE292F2A728E0F705, 0x330E88D41C6C9A0A, 0x8E2227B3DD8A04D3, 0x4A172D32DDFAEDD0, 0xA35C099F08226709, 0x53F8676F2967E2E4, 0x87874B507618A4D1,
+					0xE68D2C3CABA0AAD9, 0x4514C9EC42D237DC, 0x7CC1DC8DF6F903AF, 0xE351257255AF06E1, 0xC8685E699ED0F49F, 0xD6735E56008B7205, 0x6D8CAAD664E680FC, 0xEA6B745660F83A6C,
+					0xFBFF0DFE5F186112, 0x2956C9F001E75214, 0x0DDF7A3247E92206, 0x3C5279D42E138A93, 0xD2E81DC231F44EC3, 0xB1A39A4EDC898298, 0x8DDDFB9C71064C81, 0x7B22F1F6A05FDF5A,
+					0xC4D09331216ADB02, 0xB72DCFA6E39F3FCD, 0x701A7CA82C0D1E3F, 0x4A111096A0A67DBB, 0xCDD8F3AE5463E30E, 0x5506148E518DAEA7, 0x5FBE2DCC0F427FEC, 0x21F9922B90A3BD2C,
+					0x68A2A61470CD06A4, 0x72C7816AB3D5A08C, 0xD763868EBDBDB1EF, 0x7FB6520469A9B05D, 0x3B7A63DEAA6D88CE, 0xBEC8E6E4DD8C2A9E, 0xA234588A4C377740, 0x50092E5B55CB8926,
+					0x9D8E868C8587F0F5, 0x73084ABE8875B25B, 0x5C7A63262A74F8D1, 0xD34E03B644E1721A, 0x5F00416E6FA6F5D8, 0x964C797FB35895F3, 0x43421FD8B7A6073F, 0xAAA82861246520C3,
+					0x99516D5C18C9C303, 0x218B52EFE5523012, 0xBDFA2B2E4EA6575D, 0x2CC07625AFD64495, 0xF243AC2D4E90D3FE, 0x5A9E54DE54DA089F, 0x00233E92F3F260D0, 0x9BABE1CCAAC97FEE,
+					0x517DFB2E6669C579, 0x8BA4A0A97EEB8BE1, 0x6F2C54A7F197FA50, 0xC9E2204A847E51D2, 0xA50179BC563EA52A, 0x6DDC708DC66A05F9, 0xB295385D52A41624, 0x3CE28556B0BD3326,
+					0xD1D9D95544085EAB, 0x2D4EE9D75D6B2BB0, 0xDFE30CC02C6E0B0A, 0x485CE38D2019D64A, 0x517B64D9B936CC73, 0x5986C078801E645A, 0xA43636C502FF433C, 0xEA2ECCF92634550C,
+					0x62C4709F55AB0C9B, 0x06979A54CA3CE8E3, 0x1CC16E5B3B8AD963, 0x648282DC81B29D1A, 0x469BD5B24DC1ED0A, 0x8B06744A3DC4A7C4, 0x1D5040385F520EA8, 0xF9A38AC18F1A1028,
+					0x90945311951B60B6, 0xC28E50C83176E7F7, 0x7E81B0138BABD875, 0x27B73BCAA06C44CA, 0x81BF77A2CAADD8A8, 0x60227DFD29A5C323, 0x92DA17B5BF3BCBFE, 0x5633EAA82AA53113,
+					0xDE34C7609F6A6E0E, 0xA6375739FADCE666, 0x94B205372027DB3A, 0xE2063F1F47C17AEB, 0x366C886AD4BA270C, 0x87F17A1A6EBCAEC9, 0xA2462EAA883E1BB5, 0xE756C11EBDB08257,
+					0x6CB9AB2333E00A48, 0x48917286D4E29BC7, 0xEAF0C0C3902161C4, 0x7877F9F34FF8F26D, 0xD13CC5D4DB44F298, 0x267944804463A478, 0xA49007979740A155, 0x1E794B12D515AA07,
+					0xA096A13C8C5AB7AE, 0x9769094DD6164F96, 0xA83CEA09583AF341, 0x6C308327C2A71E73, 0xF4E080F76C9BC7A9, 0x4D3ADE04340088C4, 0x67CF89306B7AB2E9, 0x3EB30C76CBF239DE,
+					0x0AB8391670FD955D, 0x4B47DD2048722962, 0x46E1F213E4EE9EDE, 0x074C2EB76D0B143B, 0x545D0D90C2825B6B, 0xB00FE26BD2CCA701, 0x8E73C2CB367FB443, 0xEF7B859F7454A0A4,
+					0x90CFFF44C257694D, 0x2A39DEAE296FF2E6, 0x7DA333329C08AA81, 0xD95EE792B90D64AD, 0x12F283DB066832F1, 0xAAD545D0FFDE4C40, 0x1E9B0086D7C382DF, 0xC984F7A33438AA7C,
+					0x4E3CB997FAF9CC4D, 0x65E618F995847DBC, 0xA55B6FCD250929C0, 0xD6884E656596A1CC, 0x28656B5E9CBCAAEE, 0x1BF4B17404ABFA38, 0x3257C2552E9C09FC, 0x565F3DED508EAE42,
+					0xEDB51F29131BBDC3, 0x57A0BED45CD26AF0, 0x2A37BDB4EA4F9C96, 0x8A326638225E5659, 0xC84BC5B95EF7514A, 0x5EF493D31EE6B9D5, 0xED5DC3AC54B2835B, 0xEAD9EF0B3AAA0C7B,
+					0x04B0B221C46AE69C, 0x57C2DBDB9697C2D1, 0x67BB3BC6AD4300B6, 0xC7F108A99477627D, 0x9154A6B928FDF318, 0x2B5E7C3B06F4DC6D, 0x4FD8D04F91B58C86, 0x353E135A27F5F385,
+					0xE6B99BE78944223B, 0x46332C49ECEA5DE7, 0x42DC8EC3AED8BC4E, 0x20A3A064B250C98B, 0x83F349DA92569152, 0x6650A5D1B88F138E, 0x938FA01B3AAF656A, 0x69739A264E5DCD5A,
+					0x3534AC2B38E7380E, 0x876E51344B14988F, 0x44820F15102C8033, 0xD1F61A59474ECC46, 0xE3257A2CD234B18B, 0x89F8A34F0B9A9515, 0x03E3E6A0A9380BA6, 0xFEB19A81C9FF3E23,
+					0x3D25643DBD359D46, 0x5A712DE923E5ABE2, 0x9FCCCBCADB27D0A7, 0x8F638E727E026DAD, 0x5A4046DF6E2D24CB, 0xF217E54A6C63284C, 0xBDA86541519E2CFF, 0xB408200059F69E83,
+					0x66FF7C6F70C6E6A7, 0x030D4DD69CE6A56D, 0xAB92BD62F452832C, 0x38EA2106C1073B27, 0x33FB170B719A06AA, 0x29BFBE5C42939107, 0x8B2A91BD29F7085B, 0xA3F00126E33DCFDB,
+					0x49FFA3A52F390B8B, 0x6AC5651921736660, 0x9C6151EF0B635A1D, 0x7075345FFCD8D7FD, 0xDE43857616D283CB, 0x132AAFAFC276913B, 0xE404013D168CD84E, 0xF0D5E629317F9D89,
+					0x2197F3C94AFE85D1, 0xFD269CEA63DBD07D, 0x72EDCA516B6B3D2C, 0xB9E3F6CC893E4639, 0xC0122854DBF1ACBE, 0xB144233DA5B9CBB8, 0x2F9DA7C70FD4C556, 0xC4087AD6A65E9A86,
+					0x2654CBE79730A41D, 0x2C96C74F18F0E15B, 0x39D2AAB5D2776E61, 0x8E9D105E44342F24, 0x0C78CA47A669D6C2, 0x99034762C0A9C23C, 0x1BB75FF9798978B9, 0x2EC7134E48864228,
+					0xE6ACD2E5C6C4393A, 0x0EFD26B4F97B248D, 0xC7EAEDD86B5CDA8A, 0x8F8184607B6B7267, 0x68539C178021B7DD, 0xF997213C0CCABDB5, 0x1FF405D95290645D, 0xF1FF616E0BEAE623,
+					0x2733E838240883D4, 0x80E045476BA17001, 0x3CDBCADA000D4406, 0x574AF33717AA5FCA, 0x6D7AF4CBB9AEA6D1, 0x3FCAD9ABE580CCFA, 0xDA412D45CEF07CFF, 0x1E94075997C61394,
+					0x0AF7E45253D89ED4, 0xDF8A6D855B7740EB, 0x31668515609CA1C3, 0xEA81C950F3D69924, 0xFE0F523889550D3E, 0x78756C998B192CE9, 0xC5110F0807BA5544, 0xF6BC4D4C81F810BB,
+					0x84FD3B8579456069, 0xBAAFAFF3EE1EF1AF, 0x91DFE7C61DCE9F96, 0x35D7D1431CE499FC, 0xAE5DF956A427587B, 0x5C3450DEDF48CC7D, 0xA2A6B323BC3BBC2E, 0x204A8622A37DDCF8,
+					0xA00D4D073120901D, 0xB418B0E3B5E6C519, 0xD022B66E7CF3E945, 0xFD5A0B46B63DCF47, 0xEC3DA6FFCC34BFFD, 0x0CB27D918670F7E7, 0x8AD162E3B50BAED6, 0x7AF065D71016EFF3,
+					0xE93739DDA88E789D, 0x10F8E17135E9F56B, 0x9BE45531C0167BEB, 0x328BAA9733A58995, 0xE45B0B693568D92A, 0x35D6C4C08112AE26, 0xBAEDA45AEF8153B2, 0x4CD715A828153B1E,
+					0x2C53BE8173CAE5E0, 0xCB358315D6D210A8, 0xFFB5F78A50966242, 0xF8252EA01662D4E7, 0xEB8A2748EF03E6CF, 0xD9545540CB2B7865, 0x278F9C8DB15C05E9, 0x6BC941C0CDEF73D8,
+					0x0CEC8FCC752BFE20, 0x7232D329456FC950, 0x8A1293EE7F078EE4, 0x92CB28F9569BE5C7, 0x1B919C965916701A, 0x0AD6153346D5AFC1, 0x801F20C5E642456E, 0x760EC7BEAD61EE87,
+					0x15A21A7F78F8E2AE, 0xBA7997CDAC174931, 0x499FF8647757C123, 0xCC8AB4A40AA8FDA6, 0xD6C623A2C80D9738, 0x66C43D2624119CE2, 0x3D24F9CFDF0542A6, 0x81B79C5549600F94,
+					0x5C20D1B23F13F8CC, 0x69BF0BD5CD05D55C, 0x1FED81613ED9C069, 0xCB19ABF0775D0157, 0xEC392273868A78C3, 0x069716822D5D68AF, 0x8096A893B6A048C9, 0x5D3814A5C790072B,
+					0x4D54811796CBAB0C, 0x9B14239F687AB9F5, 0x1040854E1541B9A8, 0x6B09D918308EDFD9, 0x303A9833FBCDCAD0, 0x99B317743F5C26CD, 0xA5B9C072FB112256, 0x2E38038218B430D4,
+					0xC8809419B22D0823, 0x10B628FDD27A9748, 0x33410C17E65F5625, 0xAD5BF8BA32C66020, 0xE90132A6273C3332, 0xBCBA1CF7C3F3EE57, 0xB1D51BC55DF91E29, 0xF05C06AF64182664,
+					0x60E40D5C23D9168E, 0x9FE2C398947DDAC5, 0x3AEC46D0D949117A, 0xD82213950A2A686A, 0x640C8B325BBF238F, 0xFB5D334F43E149C9, 0x6F2C0D7D40D8E8E8, 0x449D467F8AC8F1A0,
+					0x86122C6398903297, 0xCD6069892D076DAD, 0x01B4B891E43B1C9C, 0xA4387E0184F4F0FC, 0x17B47090DB18A493, 0xE049D91AF670925E, 0x57B14A1E63274974, 0x3B4CF170B13A8CA3,
+					0x78A2F3D37687DB48, 0xAA93B51CCAEFECE2, 0x2AE8E2DF1CB4B8CF, 0x125BB0A5B7FA4F7D, 0x3CF07654C086285E, 0x8944310EFEFE5198, 0xD4A0E0B6E073007E, 0xFA5E43AF626413DD,
+					0xC7B90C473BBEAF82, 0xBF86445488B1CC6B, 0xC1A49446CEDA1B02, 0x9BAE0995828B2D69, 0x5DA54DBBEDB836C3, 0x814DE6251B522375, 0xA54EA98753053614, 0xF6B725011721531E,
+					0x9B4DB9EF1CFB9D3A, 0x3CF18EF627FB08EC, 0xBE1F572EFCD6ADF6, 0x4697B8EC716155EE, 0xF3E154E57BD2C071, 0xBCF6BB530275B972, 0x700176FACD8567A9, 0x8F124C861BE5FDEE,
+					0x4B0E2C218D025422, 0x51D60B4BFCB19BAE, 0x23273EEA3D36C22D, 0x5F52E3CD19792FBD, 0xAB1B36904585E37E, 0xA8A1894914C04E43, 0x410B90B56B60DE19, 0x6613180A7C2EA89C,
+					0x46006A34C95D075A, 0x89072A5F04A1774E, 0x9240C924282E549A, 0x379A3997F44CE6F1, 0xC6A5120369C379D2, 0x39A16D9AB9049859, 0x3D7DE48527AF60D8, 0x51553EA164887774,
+					0x8D3B4B2105CD8DD4, 0xE60D23DE56D6941B, 0x19E8DD14AE2F8964, 0x704F010B23813BBF, 0xFE5BAE658FAA74E6, 0x24DBEED52FA30024, 0xACBB0CA60B214FCE, 0x9771E9CDE4C9E5FD,
+					0xCF6B1D6F13FBFF75, 0xA153019067117A3F, 0x099E79751BFFE551, 0x2BD5885585BCC7FA, 0x42DBE015881D90A9, 0x27E6BB441D5B0D0B, 0x944C200082AF43A0, 0x04697938DA8DE0AC,
+					0x8F0EBB122161AE79, 0x379F87231FC2BAE4, 0x4F7C378E16DC5222, 0x3AB71D629A429D41, 0xA4DA8163A0EE33A0, 0x61A623589962431C, 0x54F1E93B3C35759E, 0x4E29084BFC800184,
+					0x9030A71BBDCE251B, 0xDAD1CDB53930A457, 0xBCE88BE52DF911C4, 0x5CB5BDAF35C9103F, 0x1EE14DFDD2993B33, 0x931EC6FAC0D1CB58, 0xC2292041B9F8D26C, 0xA797695477843B6B,
+					0x1DA1B8CC6B10A6C1, 0xADE6263B0F01254A, 0x3FFEB440F27080F7, 0x6F9E3546ED6560DE, 0x6D26FB9E6E302B5B, 0x32A052B8BD0D1DE4, 0x6AD09BA17AF71DE1, 0x1662EFAA2B5CC17E,
+					0xA2E071EB3FD9DF59, 0xA70FB157770A707D, 0x438A93CD8C0154F2, 0xA8EE12307C28107F, 0x0309606FEA1307A1, 0xE1C01C4E4C75DCC3, 0x31926106F61DA1DD, 0x98605FB409E6485F,
+					0x24EA107D6DA1B666, 0x642E2F7BFF0FAF92, 0xC3C224D4010C9251, 0x47900558743F2170, 0x289C2FE7460438F9, 0x848879AE4CF60119, 0xF45A589E84D6B21C, 0xEAEEDBEEACBEBFEB,
+					0x07165192C8CDA54F, 0x76E5D142998BEB11, 0xBFFBD38DA94EC4E7, 0x8B4A0830A74E0F3F, 0xE957ED45FF9428C7, 0xFE167DB1D40AC84C, 0x62263D07B10253F6, 0xB0030BBEE97F4E1A,
+					0x12AEA05C96967DD2, 0xD7B55A62E5262AFB, 0xB05957D77CCD0039, 0x30B275E867B34A85, 0x7A1F0A78C13F4725, 0x686892F8CC499E63, 0x665792636FE49698, 0x30B63040B842B315,
+					0x5DF61AAFCF7AB798, 0x569BE663CA7176E9, 0x0AC4A00D1D603CE5, 0xC5887D695A7D8B5F, 0x1FC7D8806C51B22E, 0x4BFF41E838B0D6D6, 0xCED7CE80B85DFD62, 0xE3FD9A86D2ABD5A8,
+					0xB30E3B248713416C, 0xD32FB5926D8889AD, 0x94033B74C5D53CAB, 0xA0B841522AE6331E, 0x6F642FA05D660142, 0x0143E7793BAB2C1A, 0x6C627EA0CDEEB238, 0xDD75595991861F36,
+					0x7F3EAC0C5A26E0D2, 0x48532CC4CC1ACB79, 0x6FC60939C94035F1, 0xE65417F304E17C68, 0xCF0A22B459CE1C89, 0x37E97D498AD4C1FB, 0x3CE2168A147B7F1A, 0x68178BE31887134E,
+					0x32C5DE80124A8197, 0x6BE76663CC55FCB2, 0x62007B0F1E772F83, 0xC2DF5D6FD6D287DB, 0xB4CF866A0A943AD1, 0x5496436BFAAC7CBD, 0xE3CE191EA2B450A6, 0xD6393D9FD62F605F,
+					0xD70A3CC8EBD1F006, 0xDF410FA3BA0531C1, 0x7ABDAC6B878C90DE, 0x88F6AA557B90EE82, 0x239C95A24FA0208F, 0x1F7DBC5F3D648CF3, 0x4B6DF950D1FFA41B, 0xE8197ACD53468ECB,
+					0x447F0556A00FC706, 0xC07B3AD628A0AD23, 0x64ABBB5855C09EEF, 0xC747EE1B7D3892F6, 0xB0204C7410DEECDD, 0xEEA250337DC687B8, 0x35726D8B77501662, 0xA6453A5FA36BD8F9,
+					0x0D59CD75DF50EC0A, 0x614E7FAA591328CA, 0x235B87447D2CFB15, 0xF1767E9449798DD1, 0x247F2C25EB168643, 0x5B3699005697690B, 0x04DFDF9FE34C3AD7, 0xCC081E7B61BB59ED,
+					0x1CF4E1A4B0885A41, 0x0AD1FDAA228F345C, 0xC055907294AAE5B5, 0x4E72B24271B7F18A, 0x9E63B98604F6BFCA, 0xE63676469E18A531, 0xABD76DB504C088B2, 0x6A04F69A7EB2DA59,
+					0x6BB2E9F3527DCA58, 0xA331C3F51EFA657C, 0x508A98F76795A7B9, 0x19161948C3E0ECB1, 0x63564A7FB390F937, 0x65ADB599C0B1DD55, 0x0E1C24E32073E369, 0x9866FB0A2C1C420C,
+					0x5CEB89F1FE4ECAEE, 0x9BE8B7F192010732, 0x788F160486EE8E62, 0x9ABC2FA667E2186B, 0x474F1798EC77A7E8, 0x02F36C9FE732E578, 0xFA2BF316AA9D085B, 0x2A8597EC3D0B3046,
+					0x1EDDA5568AC1806B, 0x3B075381A150A317, 0xD045AFDCD12B2EFE, 0x5CA8D4103AE67471, 0xC9085F24DBD1237A, 0x5EF969C6B9D0000B, 0x248E217E8C31C3FC, 0x66BC82A0907B2CD8,
+					0x04DB7B20BAB2728F, 0xD8125CF8ADB01D3E, 0x5022C4842A1F4CD9, 0x929D55631FBEAB50, 0xAEF94331277ECD7B, 0x188D90302FEA2341, 0x846EDEE185DEE3FA, 0xFDCDCFD53FDC65AC,
+					0x7FBA2E5D2555F04C, 0xCC30C2A115943734, 0x69FE6B55BC30AC6D, 0x5454B41653FF808E, 0x550A759CE8B9844F, 0x251B573B912BD02E, 0x04DC2CF36DBFB7A5, 0xA6BB479CEBA22C17,
+					0xA2313672CFEBE6D9, 0x595AFEA9F0090113, 0x6574A82B7CC7679F, 0x0323FDB24391EA1F, 0x85F40A71BF8084C1, 0x61E1A8650DBB7D57, 0x8BB5C6799608F425, 0x12ED370BDD60FD33,
+					0xDFCD4C0B3A487D47, 0x68012404E5FE77A2, 0x58E53F24A40916BE, 0x2FA288A26106DB57, 0xF444D63E5786469B, 0xDEEB88E8FFF23F6E, 0xB700E6A8CC10711A, 0x94339C1374CBEF22,
+					0x4FD3E609BD3C1D4D, 0x2EB598414FD1E53A, 0xEA99AF78A223D0FB, 0xE7356B9353878936, 0xA1C04071BCFDCDF5, 0x5811977264B69E02, 0xD2F29C593BF1F34D, 0x76090873D76042BE,
+					0x39BB2E0E1EFB4DC8, 0x8392DD8E55F109B5, 0x28B3AD0A49CC5D4E, 0x28C146512422B21A, 0xE764F88F583ABF9D, 0x550E42DB348726D2, 0xC86BB5F93BB6B7D1, 0x762EF9CFDA96F497,
+					0xC5581EF710A5A972, 0x0A1EE3B95E4E3185, 0x6CE2FA221549F7A3, 0x6BC5A2CEC6CD2606, 0xE9F6B238963A20DE, 0xB8E5F238DE35B6C3, 0x7ED340BDCC036A60, 0x17EF70FC1EC45431,
+					0xB798389B5D4C3A1A, 0xD0AC6DDFF7370AE3, 0x2F49DDE73D1E131A, 0x33B82DEA5C12ED31, 0x6631914C57D10F06, 0x0C1BBFE1610B5CE0, 0xE4D46CB59365918E, 0x85F5BE583928BC80,
+					0xD44F0D75BDC4E2CD, 0x6D26CFACB81BA349, 0x386F0617A722D701, 0xD270F1B55BEF92F3, 0x584E545720C405B7, 0x4F1BC758DE56E587, 0x850180458B91AFE5, 0xD49A86A990AEA5E7,
+					0xE27D367F27372853, 0x4058972C21E4BA2F, 0x4648A2E5EB4C1DFE, 0x14FC9838AFA46508, 0xBE8781EDF708CCF7, 0xF0A7B8EF7EDB93CA, 0x6D605870BFF0DE71, 0x3C71822C42030290,
+					0xE3B98FC632232506, 0x6F2361E4E29AC10B, 0x6F71FFFDF76BB7C8, 0x57584CD282550D43, 0xC21EDC761736131B, 0x1070C253F4802FCD, 0xC2BB3D2BECED74B1, 0x77636539B1A8AD31,
+					0x5EB4C86B2F795F2E, 0x509434E8B81D53D2, 0x842AA3E180FA1CEF, 0x7E55F8C9ED1C8113, 0x5C4DDA9D1C8E75C4, 0x552B1F3682E57E87, 0xF90E2655905E23EB, 0x639E9B11E4216AD1,
+					0x8B3D6E685A7D5EF5, 0x8BBA4B83B444F4A8, 0x0DB31D7908F74D02, 0xFA8BC5774CF2FF21, 0x5DD6D7039DC9F4FC, 0xE2B10852802A3455, 0x79E9FF9A18C856D7, 0xDCA248496DDFAAFA,
+					0x68B9C7364EBEF0C4, 0xD7EFDC2699F0B74A, 0x36B8659066345F91, 0x54FF10DCCFC86D7F, 0x2EF6D015A36CE4AD, 0x8DC71F8291740684, 0x9A6BCA3E2283A888, 0x048CE43486B1A513,
+					0xCE43E20A3A12DCBF, 0x2826BD21AD30170E, 0x1C253288AE08C98F, 0xE142ABE696BB6FCF, 0x5DD7B486745D671F, 0x667E3134D05C05F3, 0xBB99FA0A3537E3EC, 0x046D9C7ED617366D,
+					0x58FB5CCE91BDA0AB, 0xD4CAF861D9EC7927, 0x4EB577D76E8001BF, 0xA709FA29BD6B1A94, 0xF47C016C8DD09452, 0x083C380EB4176336, 0x74EA55E5BB09AFDE, 0x6E0AB6830C8B826C,
+					0x6E5ED095BE53F4DA, 0x5B4B080A4F1EFF8A, 0x22FB3240E7AA713B, 0x2E4A37E9AE3BFD5E, 0x02EC8F4B31C8EEE1, 0x88268B8140B4B03F, 0x271823C024BB7516, 0x9DC6E38FBF71D2B1,
+					0x0C9962C82950087F, 0x74446F1928DC21D1, 0xC84D8F96351067AC, 0x78B29CEACD1CCFBD, 0x552F553A20911A5B, 0xC127232AC693F8D1, 0x52F8C8A899E69278, 0xD15C246AE14C0B80,
+					0x535F4E2A21646FD3, 0xB42A9405A270A380, 0x271E499112686980, 0x81328546358AAF25, 0x3A3C93322B1C94B7, 0xF8F05F4912CEAC70, 0xD4F256B781FF012C, 0x545F300F32BDAFF9,
+					0xCBB110D6FF135494, 0xE94EEE1D2595FF1C, 0x5C62D1D9EC2A4D70, 0x49D882B1C2EBA9D6, 0xB18230FF43B6D40C, 0x692C0ACC0013384E, 0xEF058E9AE4F9D6A3, 0xF9BA9B859DAB428B,
+					0xFD1ED143C37CC74F, 0x88915176557061E0, 0xE52EBFE1675454A9, 0x31A09CE69ECEF735, 0x9B79856808CA9146, 0x8998417CCBFDE62C, 0x0F2341037F70CD8A, 0xEF3DA8126DB2D83F,
+					0x5C24ACCC89C8B723, 0xA5D847E5571D2CD2, 0x988717B367E80722, 0x9F0B46FA488F70A5, 0x28ECD1BCAC28D70C, 0x2E2FE1017DD47461, 0x7DB3943BB284CB18, 0xFE0EBB6638624A0A,
+					0x0D2DC7694F273303, 0xFFCF35FC9553B90B, 0xD9A3E4EFEBE40241, 0x5E46C697602FB5C1, 0xA339A9E953A6D45F, 0xBF3426EF5FC3AE2F, 0xE6144D276297201A, 0x9349CD39EAC12344,
+					0x7C252DE3C8870BF5, 0x89FACCA626C86E37, 0xCEC61F4ADE324FEC, 0x9DEACF3729A56729, 0x19B96840D40260D8, 0x05B6BAD3242EB58D, 0x81667ADD0514955B, 0x48E4A62D22026CA2,
+					0x21E6CEEED24E10C4, 0x379180A3B3EB04F1, 0xADA300271333C6EA, 0x1603B778856FFCB3, 0x00F30D0FF3A0D8F7, 0x36D25428E9C1D949, 0xBB4A05ECD138844D, 0xB5FC22200F39C84E,
+					0x6A2B8F06BDAF281E, 0xFF9D2CDB299E9ECC, 0xE9FCDF21A4861650, 0xC45E8B84AF3B62BA, 0x78F34D53CA9291F2, 0x3282E6A2F4958B04, 0x332D2D312A1085D7, 0xE0B1F8AAD99ACFDF,
+					0xAF508C7F637601F2, 0x817E69EC51C364A7, 0x75F12E0B51384121, 0x75082F3279373A69, 0x228217769174FAF2, 0xF0A909E337363F2E, 0x8BE4B9AA5DB97A35, 0x33CC78CE84AA5332,
+					0x788C923E44725146, 0x6E6FA5B8A2318A21, 0xEED2BA1C976D1542, 0x1DD92261E25EAAD0, 0xE1EA710DDE6EA8AB, 0xB9AA77C44097F307, 0x5D0117225F05473B, 0x1E518452E38663FD,
+					0xE7066178AF437142, 0x93A9860CB0F46C3B, 0xFB2BD784DB4DA852, 0x1FA070577EE65857, 0x8F186674BE5D28B7, 0x6997F95FF481C1E0, 0x1B51B19D4214F7E7, 0xBF026480BD827B69,
+					0x2D30982A7B322A2F, 0xA4E1AC18DBE33E37, 0xE7890891077CD587, 0xF87454FB57079811, 0x1B3992E5E64C1946, 0x83369A817418AF5A, 0x0C4F43B657A700FF, 0x87C47C8F764DA3E3,
+					0x6FAEFA17F96C7E1C, 0xD060044A215BDD81, 0xDCAE470A021A7184, 0x189A3A741731FF0A, 0x5A1FC4A6222366E7, 0x52809DD5E6F62A6A, 0xE2EDA57F04999D23, 0xAA9267DCE9799DD5,
+					0x2F7A9811E0EC532C, 0xBDD58832B36D56C3, 0x5077226848A16BCA, 0xF91ABE7A4282785E, 0x7C61D8A8C2D1073D, 0x4725BEB4D93F0C6E, 0x8C079345BB143CEE, 0xB9C5F17C21A9AE1B,
+					0x861DBD7BB1428A66, 0x4F8E7901AB307CCF, 0xCD1224AC076D94C5, 0xEFBA310A13FDCE05, 0xFD4DBF9FD6C86FFC, 0xB9DF65A57E8D9D49, 0x5FCFFBAA583545F8, 0x6E1838912CD6651C,
+					0x07C8DDB68808A091, 0x3D8E81226198B9C1, 0x986A9D6C51C28370, 0x3DA8EE87F8CD2140, 0x029418067920DA05, 0x5188867E0B829574, 0x8DB43AD3DC534063, 0x41EA1B8EFF5BCFBA,
+					0x778E236BACFD393F, 0x17688DAEDCE408BD, 0xEF82136165971A5D, 0x40DE626CF5367A0C, 0xA3CE88E1F761E01B, 0xAAEF0AEDD663F9B1, 0x929E9A5EDD3503A0, 0x40D81A07B231DA3B,
+					0xF6E9FB3A069F4419, 0x2667A5388C3165CD, 0x4A4D0623212468A0, 0xE9434F63D374A5B7, 0x1598E1D77B841CF6, 0x4752A4B010ABEFBB, 0xDA905D7220A1AA41, 0xF58A8E91525D7318,
+					0xFFFCC42159F6DEA8, 0x10AA40018DF22812, 0xD0E5FF59AD08E417, 0x570CD4277157E152, 0x02AE9B0F7B7A149B, 0x1B89E82992E4A2D9, 0x58080A4448B7D440, 0xB308A23580F962CA,
+					0xB2BAC48C2CA1581A, 0xAB9A3D641180B89A, 0x755812FD7AC5290C, 0xB47B8B039D6E35ED, 0x7C230B9EC6178B94, 0xAE7F1FA375192A4C, 0xF155E077B335F44C, 0x016E3D62070D9EEB,
+					0xA6002D8B09F140BA, 0x2BE55A81CBE958F0, 0x02A019B011403E32, 0x7129919B2F563B91, 0x6FC5178A91DBA839, 0x18A5D324BCE07DE9, 0x802E3F5D83B56F2E, 0xBC84416F0981CC49,
+					0x8740D3DE53BED2E2, 0x5A2BC9DA4E706A2A, 0xE5BEF83014B87200, 0x7033E4E0BE6BE608, 0x9C4936580B9AEAC3, 0x1A1359825A4FD080, 0x9049FC786333D08A, 0xBEE6CD3121904821,
+					0x24776CEC1C9CACE2, 0x60F3AA160AF59CF4, 0xC815E3833F36CE30, 0x2C60410E63069DCC, 0xA9D4E1162AA749A7, 0x79D9D9ACC6D05EF2, 0x79729A5FFF69176A, 0xDB6A29852D3FFAAC,
+					0x7B3BB432119BF275, 0x524CD8CB2EA46EA7, 0x118751DC6D3867A5, 0x1FD93929CE2D70E1, 0x48F220DEB58C2238, 0x3C65EC8F46403ECA, 0xD0EEE1D8B01C9D2A, 0xFFD3E008189CAF0B,
+					0xF2575EFBFD497AC0, 0x883E6FAFE0C96388, 0x7B102A6AB34E4CC6, 0xF8AD501A04C6FE9D, 0x61979D7B266565FE, 0x76630AF4EEBDCD49, 0xD99F889C5CA9A403, 0x2BD6A107BA05C827,
+					0x0CB9F8F350EDB479, 0xC5FE85EA9A78666B, 0x1C33881C5F56E7E7, 0x87C3343108BD6B89, 0x30CA4455DB042AE9, 0x74BEF9F4548670EA, 0xD6862438F2DA616D, 0xE59BF4F414B55C4B,
+					0x7A8780511D164004, 0x78A3F3A841D150E9, 0xC0E9688B756FBA72, 0x04F48252BB5EB082, 0x3A701A7F030ED935, 0x591F11D75877842E, 0x4F06C69B5C178E74, 0x8EB296DD9D67FA9C,
+					0x0E1253EFB3372CB0, 0xA8376272BF10C8F8, 0x05DB0F82BBB990B0, 0x585B33F1A13CEBBC, 0xB0B02D0F5EF9005D, 0x815F8891B87668CE, 0x70D66D96A2840060, 0x1F062E849B1752CA,
+					0xA6BF9708CE0A6F49, 0x208CD054E519264B, 0xE60A6A4796287C8F, 0x5154A078C582D590, 0xBF996FD3DAD7E8A3, 0xD5F8A067B0D693E5, 0xE6D02412A823F44C, 0x1086816BF1106891,
+					0x181AED77145EF2DE, 0x435F016CD4B06D4E, 0x9DD20A904459FC32, 0x37519F2EE4ABB5EA, 0x95150F1E3A250182, 0xB16C74E4F86A565D, 0xCCEC0B63A370F81D, 0x35945D20017628A5,
+					0x9025B1EE1514F57A, 0x1CF3C6C17DFBB4B2, 0x191246B8D97CF50F, 0xB7C916A33912966C, 0xA56180FFDF490628, 0x9E47355EDB1DC022, 0x936C1F837DC6E691, 0x709B7D052FC3BEC9,
+					0x378B2AA932199955, 0x48152CBB87AF6474, 0xE6EDEF9E4E425E70, 0x598BA75B854C87E6, 0x883F733A1D8D5770, 0x3C67E763EAA882EA, 0x5738A4F64C8F14B1, 0x4947B0A52B07CF58,
+					0x5566E846A2F708BB, 0xEAEB69B5217690C7, 0x43100BA110E723F8, 0xD2A53E2DFF48B530, 0xC49A1CC51D6AC56A, 0x94E2073809C96F92, 0x3FEDE5A0EDF9C937, 0x7D3D061319B5C372,
+					0x0E82EA79D64490D9, 0x47A21548AA559616, 0x815291EB396DD1A5, 0x8DE16D4BF970F98F, 0xC973A4493E251E81, 0x9D133C4D0F20848D, 0xFD1738B75DDCE58C, 0xF02F84838DE00EFC,
+					0xCD0545B8A0BAEE14, 0x4697873AB5CBE1DD, 0x53DCEAF5B01E7081, 0x93D79234A7636EF1, 0xEA0562270198C7DD, 0xA1FDC3EAE5DE674E, 0xDCFB9C71EBCFFEE1, 0x9F512D02C7DFB5B6,
+					0xD46F5E1AA18FBD26, 0xBA0CFBE0BE8DA2D5, 0x7ECA6F8D4D2FD3DF, 0x2868096FCA435A6A, 0xA2359696F11C12AD, 0x28738827EC4BD648, 0x94DEB6B8B97955FC, 0x7FC2C80921B8BD35,
+					0xF81F16C0910E257B, 0xC1554423E55E3279, 0x16F9B9DBBF7CC24B, 0x82C92092EF0042A2, 0xECAC64FE9436A7A7, 0x6B2FB93BFE6BA980, 0x55894CBFB4886CC9, 0xEB2BB88A5CD55747,
+					0x93EF2646AF4CB8C3, 0xF895F1D6EE6B4053, 0x9C2FC5BE592285C8, 0x7F4AA215D8537A41, 0x6CA986DECE9E33D3, 0xE0CB600B7FFC9CC8, 0xFFF28C230B6DCD55, 0xCC51207EBB303ADC,
+					0xA52C16EB81AFEE33, 0xAE44ECA8E5DAA219, 0x4BBB2D8A51216099, 0xFF78209746011AA8, 0x5ED200EAD7EF4F89, 0x1F3414C31C66311B, 0x89ADC0DAA4CAAA7F, 0x904728E69DFB1396,
+					0x27766FE0E108034B, 0xF2D012618B27136C, 0x3A7650B44D74A5F2, 0x7A83EC7D306145D3, 0xED727E94650DBA88, 0x615A9386E766F343, 0xAB1AAE30F1A2C853, 0xC07D15846C8158FF,
+					0xE1421F6743623093, 0x92DBB0C4308158F0, 0x43D0AED3B9FA73CE, 0xB78FD270A74FE564, 0x5D6906DF552B4B85, 0x743ADFF7FD19D6B9, 0xA5DF9FA4C3D89E08, 0x940CB2987982078C,
+					0x00D7808DBB488658, 0x6D2F055E51115E18, 0x9EC8A339D12AB707, 0xF93DA6A3630A3E6C, 0x94B63D3569569387, 0xF4556817688CCAEB, 0x39437724AD79F177, 0x0606A4C1FB418EE7,
+					0xDADE6B1577FFBEEF, 0xFD29215AFF81293C, 0x9444C83DADD65955, 0x6DFD4970D5795992, 0x24668698E741DBFC, 0x717DE51AA424094C, 0x906683CBA79EC678, 0x879E4B5675856FB2,
+					0x9DA69AD64C2CA1DC, 0x0678EAF985388F8A, 0x8278E3383E36B78B, 0xE42955AB1B3CB161, 0x41770E98A587F2F2, 0x9D7085090908C66B, 0xBC34C4CF1F685B5A, 0xBE4FC8228B7D9970,
+					0x1EF6A63EB76E7B36, 0xDAA92E0EC6FE65A4, 0x0DBB77C7239127B9, 0x4E11E8F35C87F394, 0xAB894AB6135AB075, 0xA91DA107E5B3A756, 0x7A3CAEEB539C5C24, 0x2B50D2E173ABDD4C,
+					0xEB2351F2C1326862, 0xA848A13158664916, 0x5EBF5A6BB67B16AA, 0x7E5B7D7C3EE77FD7, 0x888C18E46E461AAF, 0xEF6CAB8C11D3CF74, 0x50C5959F0CBB3D69, 0x7872147712E0F056,
+					0xA5384C595F01AE42, 0x9EC28E141FE34578, 0x31E9331138C6C405, 0x992F081F6F27C772, 0x02C756D89A67F9F5, 0x5EC06CB95B4C1CF2, 0x9015D6A216534AE7, 0xCF22DA49CA19C1F1,
+					0x6BDAB3E5AA04EAFB, 0x9EE19B02BCC16630, 0x02D29F49B9F3D865, 0xD1E68CE2B4DBA501, 0x9EF56E042589B3C7, 0xF963A98C4AC55497, 0x6FEEB08A994B6562, 0x0E366D05BDCF82A5,
+					0xADACA1D2C92CA630, 0x5DCCF015453E699A, 0xADAFC08F0F142D30, 0x08024068336CDD87, 0xCE6BC81BF7BD8860, 0xF25589FA839A120A, 0x2C77020A95D03349, 0x9116DCAE886A239F,
+					0x49D0CB12797E1330, 0x046514DF99C18016, 0x595F61C81AF4C342, 0xAB33553FCEF4FB96, 0x53819709887781C1, 0x895418E520D22DD6, 0x2E4099FC44D01055, 0xC01E39817616D92F,
+					0x9426E3057410947C, 0xFB1D5F2D04625114, 0xB7C929E5B8E9259E, 0x31F8996DF1449AA8, 0x33E6EDEC54F1F9CE, 0x745917A7C14D4481, 0xB97267EB557E6152, 0x1B725078175E26A9,
+					0x96E88C572538E6B2, 0x26DC7AC23C7F50EF, 0x7A30C9AE76E9AF83, 0xCDA235216BB4AE40, 0xBCDE856DF5586C7F, 0xDC4B4AA07D048E5E, 0x4CE8D06B03362165, 0xE3C1861AC6A07D8D,
+					0xB561DFB4CA7BE62D, 0xCF838E79FBB16CE8, 0x7A1CB2CA2D052439, 0x577FE22D318C1883, 0x7BFE4CE3E4A23654, 0xD0CFD23453641EC3, 0x50BC9B6E0B69D6D6, 0x867051B719F5E502,
+					0x161F11761E084F6A, 0x4C1A1130401D16E4, 0x86F75C47222F7571, 0x98EEAB417768036A, 0xE98F5D43D012DBFA, 0x682C924954CE82AF, 0x144DED2FED0E2081, 0x686C32CF94490E57,
+					0x2B28244ED56C5C42, 0x49CE1777E4E56987, 0xD87FC6534192270D, 0xCA707B63D732EDE1, 0xD37D9DED882D87CE, 0x3E3FAECC297521E1, 0x71FE7F1FA2A4EB78, 0xCDCF66AE2316585C,
+					0x029137F63FA0423D, 0x6646612ED55ABFA0, 0x42C8866D2C83919E, 0x064C1C69A94E8D98, 0x2FED1669F5A2AD7C, 0x3E361BEA57B33765, 0x611DA3562E2B24A2, 0x0C000C40440C57CC,
+					0xDE64188F0273FEEF, 0x7B8F10E2C7AC8019, 0xCF2F02F11C36191A, 0x864EBEE30BF3B045, 0xDF666BE7A653F7FD, 0xC75E51D70EE19D19, 0xA99F38E67F7FB4ED, 0x44C5E1B7CFDC3E35,
+					0x6670F0D81BDB86A4, 0xC0C1E6DD01951BF4, 0xC72C8CE9747DA1A9, 0xC0E78F97D163B622, 0x43D2627762EF4C96, 0x7D31C07407F950C0, 0x8B9B1DAFC58164AB, 0x6A2336F9C876D03F,
+					0xF1577E2C0588F3A9, 0x20CAA6A4A7E4F0F7, 0xEC16EEC58416F6CD, 0x2E1BAF0F4DF3855F, 0xA0DE5687D1FA978D, 0xC29BFF3B10EC2792, 0x2A17B44628EDB90A, 0x97829D3CB8F51AF1,
+					0x9A54F73EF0586455, 0xE316F3D5D9959270, 0x9B507E4E6FCE0FC5, 0x01F0635671DE813B, 0x9D3BE6439ED8C96A, 0xA1CE6A5E9588143A, 0x222B82581CA2E552, 0x0BEC5323D17F281F,
+					0xB82F80DE45B14E18, 0xEDA4992479B02484, 0x37A5F43A04CA3BBD, 0xBA941C75D0C5E7A0, 0xCC30BD6FCAA7892A, 0x68C2B58B8D206F17, 0x9DB17CDF46FF3E3C, 0xC8000242FCDB93D5,
+					0x97B4D9C174FC4183, 0x6B65D551FE6355A1, 0x76ECF244C741BBAB, 0xFC92B24D6DC95535, 0x5D6F3DC0213EFFD2, 0x3926AF3686E0CD57, 0xBFA9617479946B56, 0x66A1D92EF0A0F713,
+					0x6D4F775B0028D5C3, 0xDFEDAFE6AF0889C9, 0xE9CD29AFAEC9AEB2, 0xCE82507B36160B1C, 0x0BCC4A063E6F37E5, 0x71F88DDB8EE3D026, 0xC9983BC879D04211, 0x76E8B6DEDEA83584,
+					0xB2831567BEA5C1CB, 0xA048006E097EDDA0, 0xBDA1E6F0A8A7A1D0, 0x8ED02AB6389766BF, 0x2B6B3C83D858CEDA, 0x394D6A998A726AD7, 0xA27F0C8DE5751AC5, 0xC378DEC8197F5DDD,
+					0x9BC6DFDBA6C58FB1, 0x231246B0E3DBCA33, 0x9987A6C955FD1942, 0xDB907D984F3F5241, 0x4A853AFA1E669B03, 0x11CBF09C6809CB5C, 0x9E2140155E7EFA6F, 0xCE70D164411B3D68,
+					0x51EE0C6E795D12D1, 0x9FE83EFDDBADE46D, 0xC01791C60426B50C, 0x9AADED71D135F704, 0x1B837849FB452A2E, 0x9B4E162D09891704, 0xE1E38D7C8009A8B0, 0x580E69D78D1CCF71,
+					0x5214291AE099EA1A, 0x5F53D993E983A585, 0x4F2C0664327F98C9, 0x1627CD768C612463, 0x01BE588682C2031F, 0x89F1AF1AC1BD2D3C, 0x8B346E6A4184FDAB, 0xDCE021BF261EDB3A,
+					0xC63B50C362BE2634, 0xB4EBBD294D796358, 0xF1DAAC87CF2B7FB4, 0x501C09BD838B3A01, 0x90D782EA51C2CB67, 0xA51C6635A978DEAA, 0x3376B18405EC5BAA, 0x72BAF668D1BE29C7,
+					0xB156E5499054CD94, 0x744C5EB0B0A2B671, 0x004492C053838691, 0x10F4F1614DCB76C5, 0xE3427983B72B322F, 0x88EEE85EE79145B2, 0x31ADD1121C7DA217, 0x28C675AC04761A8A,
+					0xAA4023A937F5A9D5, 0xCC8B624018EAE79B, 0xC55673E858967084, 0x98C0B26557174613, 0x63F8D618881D35E2, 0x197B6049533BFEC0, 0xAC54CB7328F09BD3, 0xBD76D99D0F938424,
+					0xF952EA8398C53F0A, 0x7EBC9A91680439E5, 0x765C2C99C5F2E090, 0x69934525C6D1E9F6, 0xBA242EB4D5D0E475, 0x0816CCD1F0F2F074, 0x770D4C99026666C2, 0xE121B18DAF244A70,
+					0xCF4BDEEE05863557, 0x5C42A3500C490F54, 0x6C2165ACF1F9AFB8, 0x4A31E1CF868D7BB9, 0x1DBCC9BE2D6EA2A7, 0x15E73F8785290FCC, 0xFD6AB3320F93206C, 0x516020660AC76E38,
+					0x77E25CD8EE8047C7, 0x1097837465AB12C7, 0x9F03AAC2CB17CF41, 0x7B3A901EC40F9D85, 0x61F56EDB798A1777, 0x70AA7A9187B174A1, 0xA9C296331D053791, 0x50F406233B2AA2FA,
+					0xE9A236249E100214, 0xCA8265A9EEDACB17, 0xB860BF3038465BE6, 0x87481411CB6309D8, 0x73A672189F2E6C42, 0x7D08F712081B20AB, 0xA911EC808B539385, 0x27F3F2E24E6371E0,
+					0x06EEC2DBAA2F09BB, 0x6362C60789614732, 0xBE12EB964C8B0F99, 0x52E4A6E5152315E1, 0x5657FD40872CC95C, 0x12606FF95D9D055B, 0x5F592FC923C75B6A, 0xBE162EB36E122DD7,
+					0x8D59F02CB26F2CA6, 0x0E6C2665BC718EF5, 0x8645C9CAE442E400, 0x2F47EAD752D6F884, 0x2BE128E5FCE541D6, 0xEBD16D24A502EA0D, 0xEB7E0DC6D4484D96, 0x71E4D956459B1993,
+					0x546B519ED3166403, 0x9437327750FEBEBC, 0xF5E479183A26D125, 0x8F33A1EEEE409728, 0x549AB713A54FF5E6, 0x37D2D47C65DADB4F, 0xEB5F48C79BAFFAAD, 0x982A285DD41213F9,
+					0x4B4C8A76B032CEB3, 0xED5740042C497ED3, 0x180182F9B03F10EF, 0x079457063B234375, 0xD630F9942F436225, 0xA9D89930DB1F33BF, 0xBF9FE316A4063C68, 0x79F23C2E08F49194,
+					0x9AF0F38BEB2B329F, 0x7C1D577729A1020A, 0xB81767363391D48E, 0x56E5BB9EDF37E2F2, 0xDF940DF5449FBC89, 0xED958B05BAB3F8B6, 0x8BF02024CB59F014, 0xFF1547176B40AA1B,
+					0x8B48A01695AED0BA, 0xF96D4C8B7B6640CC, 0xA52DD52AA3675615, 0x920690A953FD7B3F, 0x9DFEB1D6B25B593A, 0x50189208A1813006, 0x563974DF4504B1F5, 0x0F7849E9774A1AB4,
+					0x7FA9F12C43993E54, 0xBF58442F4C025D69, 0x99784A7C83575B74, 0x824D4783CA726F35, 0xC36B1996287C671E, 0x5B0687205A2A0772, 0xB07CB69A6F9CC9C0, 0x876518CEE04B8617,
+					0xB12AA5E7BD67FD1D, 0xF9848120716E57B0, 0xBAF8EB96FA86EC30, 0xA107B9BFE866A15B, 0x40BB7B1CEED95919, 0x189BE62F2027D75A, 0x164E4891578B77F3, 0x5C64560E99CE6250,
+					0xC082C9D9A5D1E9CE, 0x54F811A3F5C85247, 0xEEC1B4889AD21E08, 0x5C01AE8D62594670, 0xD90A910F2193E62F, 0x454DBD68E586FA30, 0x82031679166B7659, 0xBFABA05AD81C3438,
+					0xBC6999C9704426CB, 0xD409A631A36C0CFD, 0x30FB056BDA1AB8D2, 0xC00ED33D9F7D5FFF, 0x947728DEE5B369FE, 0x648B6CCFB23B1128, 0xCA717C724AED6B69, 0x060383FB5113C9D4,
+					0xB0862505AE3F42AD, 0xCA6EC35DCD1E04D1, 0x94A691898B9F9197, 0x514D8ED928C36DA4, 0xC46DD32B3929C332, 0x2D9EC1A153A0D481, 0x7BE4709DB70919F2, 0x56CF92509B996A21,
+					0x969141DB2690059B, 0x43362585AB11D5D3, 0x08531CC692109DFB, 0x5A262AFE92F68955, 0x89331521E97ED868, 0x06747B8302E1317B, 0x1DF080EFD29BB762, 0x7A4A50DF82853A3F,
+					0x642705D858B66D4C, 0x8082CF2BC3451FFE, 0x4EDA7DD3444C38FF, 0x76D2E4C21914B8CE, 0xDC9881C35A73D89A, 0xE0115B8630B8274D, 0x456CD11F6F27C8CC, 0x778EE15DB6BCBA8D,
+					0x68D4027A68854080, 0x8655AEC1FC8E8E2F, 0x22B929B527D149AC, 0x45094380A38BEC12, 0x2FA62EF2F80A7E3E, 0xE458E3E2FFACC23A, 0x0903D73438C40B4B, 0x14A5ABA9B2D14970,
+					0xAF8951EF82BC8E61, 0x9655229AA285B889, 0xD22492BA16AEA556, 0xBCEF07620EEACDC5, 0xF772EB4BA087F65E, 0x9410F610CC0345E7, 0x1609456DF44AB4E1, 0x923A538FE245EBFB,
+					0x2DA6C26C88CC1B3A, 0x9235C6EA8AE60E71, 0xFDE9081BC6C85B31, 0x2FD0578A4AB154B3, 0x718C154A449C8BD5, 0xF78C42FACFA602F6, 0x8FCFC0F3068934BE, 0x2E95765D0CA0DF3C,
+					0xB229530BBC05CA3E, 0x92858DA9129B78F6, 0xFDFE22767B1CA371, 0x27FF808CB1662B62, 0x3DF8D7A9AF00A2F2, 0x2993FB7B6D92AD4D, 0x1CF2781391C1955D, 0x3D3E44F64A49E2AE,
+					0x2AFD34EA3BE11337, 0xAD9CEF60E8D009B4, 0x1D6C6E93175E14A0, 0x25107021B64BEFA2, 0x14A2C40162FFA5DC, 0xACF8B936DA8CED5C, 0x7D905FCC90EC2B06, 0xCB7A30827C55383D,
+					0xA9CBCD6C1CE21DDB, 0xD5F53E880502ACF1, 0xD26A4245F7E58712, 0x129E5AABBB5DFA6A, 0x06E3445AB21C9E67, 0x81BD3145A229116F, 0xE43D3F58F4FBB881, 0xE67D112515F9E54E,
+					0x8804B425F2F31C96, 0x181B7EA1B25EDBE5, 0xC9A8B584493B289D, 0xFA8AD498946129C9, 0xC18D8AFA12BE2A6B, 0xB359E6DDB46E2E90, 0x76D049FE75D5656D, 0xE8989771A1194B5C,
+					0x7CB43E1BB2D7B121, 0xF5CFA723736E61F7, 0xF31367BD07B16BF0, 0x4F2D54329E054742, 0xC5DEC1E85E83F61E, 0x6EEC542C025793B4, 0x83361AB9C67A58A3, 0xC1A9E231C6001107,
+					0x3ABD2115B688DC52, 0xD3CD6106621039D6, 0x5D1C5601B861FFCB, 0xAD820D467676FB74, 0xD0D001F279442E2D, 0x380A490E016AE848, 0x08F210F351AF2487, 0x3A32D61AFCF59B59,
+					0xEB14F7DFF9E8CC79, 0x2DD1ABE66773218D, 0x75AA0F1380D1472A, 0x77C5E1632060F2C0, 0xF2B99CE6E66C281A, 0xF5F17247715CBFA7, 0x0C557486EEA2DF5E, 0x384F05735DFE89CB,
+					0xADF990CD7D54800D, 0xEDAB9F48ADEFBA18, 0x535FAEEB8B66E331, 0x2CFB748B10C31F4D, 0x5D88FEC524FFB9D7, 0x95E372621A7D2B24, 0xDEA8C8B07A9F3416, 0x9DD54CB913BEEB2C,
+					0xEE5A36ABA2C5E2C0, 0xF02E3F1041E26658, 0xD6C43D2D2E4509D8, 0xE6E1A2556B34C5FF, 0xD78EDB7F07765F53, 0x649E0745638583EE, 0x1017F77A42090CA0, 0xFA4A8287238B9FCB,
+					0x47E48E9BF342C748, 0x10563032C16CAD3D, 0x37D08DD4BF36A95A, 0x560004E1D7C913A5, 0x323B0C38EB9D795D, 0xC1C3F844149F4098, 0xF479D7EB8F2DD053, 0xFD7391DBE9DC6190,
+					0x9AF8B20D44337312, 0x089371336C2E694C, 0xFF1261445A908EED, 0xD0B1D90CE2739AAC, 0xAAB1602365760D77, 0x06AD8980506860C5, 0x4BAE3788B628EEAB, 0xA29CA9C4458ECFE3,
+					0xFFF698187D337254, 0x7720536E1D6B578A, 0x1359B7ABBC76142B, 0x03F3CEE2D503893B, 0x95CE292ED738FC6D, 0xF122CA48F95A4727, 0x9E8E3BA0BBB2DADC, 0xED0682DFB5D1F91A,
+					0xF53C25F2525D09A6, 0x764538AC600BFC8C, 0x2D6462E6E91B24AD, 0x634D54298B6937BC, 0x52568BA954076A07, 0xC9B0C0FC7BF67D65, 0xB16C68222C924821, 0x6529A91428AF027D,
+					0x5F60457E64F138B8, 0x7873A731BD8F411C, 0x01B408C2E764DA57, 0x77B7C1ED4C4E367F, 0xD7C00671AFCC0638, 0x6F49026291E7C463, 0x36F5E9B466F59F83, 0x5F0A935DE22125AD,
+					0x6A0332949FEBED57, 0x6D8602DEB336317A, 0xB596A84403E9AEA2, 0x14B861A66EFF8B4A, 0x1C2BE527CCB7E6F1, 0xE96A6B14E50A78C0, 0x025F517594D4047B, 0x10317D50ED2E5794,
+					0xA96A64910D3AA9BF, 0x1CFA7936A06B2CED, 0x2B90A6BC5B124019, 0x5D92B201BF9E0D6B, 0x59A850AFA086A1B3, 0x5FF437CE7E6DA704, 0x986713324CEE053B, 0x759E7481D5425A30,
+					0xAE69F1C9E94D2FC8, 0xAF685E339D4FC8A6, 0x287576D177384573, 0x2CCAAA7BD1D0D331, 0x9F7005AAF3A31099, 0x8E9553825097E14A, 0xDE9DDEA0C5467B4C, 0x45EB4DECFE85360B,
+					0x753F55B790442A7E, 0x21664C0983F4C69F, 0xEBD3E77A766FFAB3, 0x607B97561AE52794, 0xA8973CD6F31CC969, 0x66AE09072CE7752C, 0xB38D767460FF7E33, 0x4C16EEC7DE0FF0D1,
+					0x05D8CCEA21D8EC88, 0xA65ECE735B9D98F7, 0x1760FCC9D951B79A, 0x595057A16A4272D1, 0x0DA4AADB776FABD7, 0x99BBC6C739F47261, 0xE690A7F742F5A32D, 0xC0AB5C1440BDBAE3,
+					0xB095F690F0F14E60, 0xF6FFB52A26834DAA, 0xB9C0D5284F74443E, 0xA828D6A68CCB002E, 0xC0EC3B9AB8B1E71C, 0x7108E35CF4791DA7, 0xF603B9893D9C07E1, 0xFC46952A245351A1,
+					0x676706DEDA092DE4, 0x213CB3ECA7C43942, 0x86F7684911387E53, 0xD6BCC86D669F9A78, 0xEC7F98288DA57509, 0x97B6813858E72407, 0x05910DDF6B7B8ABB, 0x2B67830769C8EC3E,
+					0x4F50B8B976FDB9B9, 0x793E099732150D59, 0x7C9B5E7BBCA90B25, 0xE3977AE21A9A919E, 0xC3967E696CE1CC6C, 0x33A9DCC94520805A, 0x6A33DD529694F767, 0x0F406F7ECA8FD27F,
+					0xBCE6D8853937CCD7, 0x7F0126161EE3E3FA, 0x6A5096B8E334507E, 0xBAEEE5501076D658, 0xA451DE6A7F54CF17, 0x45D909F117AC8D4F, 0xC9CA2D68735C2D69, 0x786FDC30AE28187B,
+					0xC73A7F3A49A8FD1C, 0xBA5CD3C131FD6B9C, 0x5387830A93CCE5E8, 0x204A6C6DA70EDD71, 0xCB2392FCF0517D51, 0x9EAE816574B57BA4, 0xE3C2E76FAAABBDAF, 0x390439E9DC0D61AF,
+					0xE0DB8007D488667A, 0x8B8560B61A6952F2, 0x9DB89A5069C33696, 0x27A78A47D34C5C97, 0xCA0BE1C0D179375A, 0x451317E2C6FF61AC, 0xD7DCC059BCFA6806, 0x5A247050283D6C2D,
+					0xB4ACA79CA0DDFDA6, 0xBF36F4343EB6E3C5, 0x52EE3359B2CFA2F2, 0xC71844E0E3E987CD, 0xA09932210E5C7678, 0x3A6CA37F4B10E88A, 0x4274ED33CDD941F5, 0x124DB915035080C2,
+					0x2056AEE74E50A96B, 0xCF5C4A5CFAA0977A, 0x7A7A7DD055627BF8, 0xCED15F13DD01F198, 0xA93A8F585F1C84A8, 0x6CCD025D245A60DA, 0x733ABAE04B69B337, 0x3C7501EF674B349E,
+					0x691A07976B636FF0, 0x5F081AFE0BC5B73A, 0x2DFDF665EC225122, 0x074BF3B21BA28488, 0x0BEBB3315173096C, 0xC5724C2CA0066677, 0x9B77FE4191255378, 0x6A691468B8E0C80F,
+					0x732601C13CA2B0DA, 0x182A6DDAA64818B0, 0x441450B5C9125F30, 0xBB0C45AC41E8ECD6, 0x2892F33B1B572BF8, 0x306E5E4A22DB94CA, 0xA3A18AB59EA6E2BC, 0x920ABF11A1B2A1F8,
+					0x03FB2CF8F4AA9209, 0xBB62FE40167A0FA0, 0x307894DFF2BFC757, 0xD7496B45FADE0646, 0xC6008DA82AB86172, 0x49CF016840E699C9, 0x7C0F88A45CF24D64, 0x9B5C71455C961757,
+					0x27BCC8FC9B3B8943, 0xF1F57AB7E4E5BF01, 0x4835D918A43C00E0, 0x4AEE5CDEB7B301EC, 0xC9752E56F68B5007, 0x08AD5DA7518BF978, 0xB84A19A12E1856EF, 0xE0158350F2F051C6,
+					0x419DD5772965C978, 0x37554FAC1B343B21, 0x6E18FC7995AEEED3, 0x01FDB9F3A1494D75, 0x364F864AF7ABE734, 0x1A02AB4E9FD4844B, 0x204FE3F29B18EB68, 0x85B5AA7ED8D218A5,
+					0x201789B120E04D1E, 0x27D695B5F25C7539, 0x3CF119C380C886BC, 0x1DDC93DE31E29B44, 0x837A9266D04252AE, 0xD8DE3675780561AF, 0x70649BCB41890605, 0xD975E2BA6A5309B6,
+					0x2AB77000879BB0D7, 0x6E94E35D1B59ABCC, 0xAADA2BA56236EBF7, 0x53A5B905BCFCCA35, 0xD5061D22D7EDFE08, 0x014CD4377E9A46E2, 0xC244A46099AF172C, 0x0E97F94B732E5A25,
+					0x80A0117FCBA4C87A, 0xF62AC90BA0EB6CC6, 0x7E0607201608D72C, 0xA2FA301DEFE37E13, 0xD91C938B11BD9982, 0xFB19E454B59E12D9, 0x6394B01E6B21ED60, 0xBAD58D7012881F21,
+					0xD20657BE4532EDE4, 0x0A5D6E288E8E8243, 0x84290BE46DB97F1F, 0x13071E780C0E2110, 0x4043A32CC9457C21, 0x9BCE3EDB6A44D284, 0x697B6E2BF9E8BD02, 0xC2656FEAB979B935,
+					0x283A140EBD69A767, 0xB45D8EF403E333B4, 0x5D63BFAA30FAC3D1, 0x484F42D68EE1A40E, 0xFD668F68097E0281, 0x77058EBD96824C26, 0x79A60705508D8530, 0xFCF9AFE19F577A8F,
+					0x5DBCE340E8A64EFE, 0xB9FD00F758E7BADB, 0xA86468172C0A1033, 0xF6CD1E4164FFFE51, 0xE737FF4F2E90362D, 0x7696F2CC01BCB1FE, 0x13A92F0F6E55B9BA, 0xA96B7C8974085EAF,
+					0xED73F3BFD9AA4508, 0x7F8891A25F1A7552, 0xE2BCD61A3BA011EF, 0x5D297F8317599838, 0x8459FD3091DB63F6, 0x71CBE26B3B515AC9, 0x8E648EC5486296E6, 0x1A769C6984CC8543,
+					0xCE5800795ED22454, 0xE6F273673DED3FC2, 0x7E0C4AAA04E11DD1, 0xFBF59C721A96BF5D, 0xFDBDA809B1498BF8, 0x70A2B670475219E9, 0xBD05237FFCC67E9F, 0xE80B0E24A24B7E56,
+					0x25AC43FF2D297974, 0x8F08DB7A731B0991, 0xA205CE7808D177B3, 0x12B1046C7F6CBFE4, 0xF3A7B89DCA8A543D, 0x77A2B95DD84AD95C, 0x49EA584448760791, 0xFE1A4A516DA13496,
+					0x1C1E5FB8BDF329AE, 0xEC8F273409FD5612, 0xA89882866860CD4B, 0x36418740878AF491, 0x518E8978CAC0B832, 0x693700343543CC94, 0x6C4008CD5B7AA580, 0x21AD2513D9344B31,
+					0xE62E5CEADFC24AB5, 0x947D7B6AD6789114, 0x16485E9BE0327670, 0x11160458D2023F57, 0x0DD0DEA8C706CF12, 0xB593A2C63F015133, 0xA6C7AD475C431291, 0x595B2A09D4117820,
+					0xFFB0C013DD206A5C, 0x5CF54D26548BE744, 0xC057BCB2AAA95492, 0x2082353A67A0841B, 0x95151CBB063BC6F2, 0xA446245B89D9685B, 0xF1C221329395DCA7, 0x521D80905646C3D7,
+					0x0DE2448FB19DD527, 0x2CA76152A0E64773, 0xFBE8EB817F88E118, 0x1B771C3F618EBD48, 0xFC88F8A3E6F9D060, 0xD162E5FFA67EABEF, 0x89F1B9EB3663B255, 0x0CE9945BF3C8F911,
+					0xCAC425400FBA80E1, 0x012FC26DFCF64E93, 0x58D0ED00E5522529, 0xDF62B0A764385E63, 0x87BF91039C1740FD, 0xF2E1BE72DAF1062F, 0x3568798AB72929FB, 0x357B7741E9599E3F,
+					0xE52F22266004DDF5, 0xCF56BD1E2D8F89F1, 0x89A06893FF1EA15B, 0xCCC10EE0670F4683, 0xAA6D36D5A46734B2, 0x02D87FBE0C86CC5B, 0x95B83B6217D62DB5, 0xDC3E82DCC7B290B6,
+					0x25BA5E469EE639AE, 0x88BE231AE53255F1, 0x42A672A9352A1074, 0x8B6CD8AF5BD23077, 0x3C529D60DC68D015, 0x3CB6781DF04A61C5, 0xE365A7E84CAA570E, 0x5883DD4CA1AA462E,
+					0x8F0FB5028F5AB4A1, 0x84B513EDB0683455, 0xCF463AA5881BE68A, 0x89FB37865AE7FC9B, 0xBF49B5EE1D741B97, 0x8335417FB7BB4521, 0xE299BE75754752D4, 0x167F61CB80ABD3DF,
+					0xFFE3C465DABB3B27, 0x26B0D3A14D959C9C, 0xA9B1C46C1D4BFD47, 0x300B0A3A7D3E5ADD, 0xE4922E33FE511243, 0x334D03A3DFCD9C19, 0xFBC5B90FC8A49D41, 0x82EED4DA5BAF0F0D,
+					0x3B535F24D61C94ED, 0x6A6AE9AAB6B446AB, 0x65782BB1B1F39327, 0xE327C9AA53A35C11, 0x7E48F182EE2C565D, 0x9F8AA08D84F90005, 0x3CF8AAA8D08A0DC9, 0x8CEE619728AB12A6,
+					0x484FB15205FCA2A0, 0x3B681B73256818A3, 0x7C178B4E8E84D06B, 0xFA2819A8640DB15E, 0x293CB074954ADCD2, 0x948DB896AE08BC12, 0x3294FA677F0F972F, 0x9E09BCFE45F1D7E9,
+					0x2C5051B6C6274DFB, 0x8B7A053E0F00A044, 0xF72461B98757CBB0, 0x8E05E79DA736BC8D, 0x670EC615E06E08E0, 0xD370AEC00C760143, 0xDCC228BE73E9F5B2, 0xCCF687E24DD38746,
+					0xF7C04937E088A259, 0xF8794100CA121C4E, 0x95700819A6BF2193, 0x1857F3EF2D5B068A, 0x6DCF586F4DD3FD56, 0x2613B358649E2D3D, 0x4D3914945DC4F04D, 0x8879CB36AB5B5E91,
+					0x2AD8796546642774, 0xAB773DA0B444E656, 0x141E89DA130B620F, 0xB10487C0660053D8, 0x7D508D106553161B, 0x8B198594783DD585, 0xDE2051B531229120, 0x89C75300D596CD6C,
+					0x453371BBF0345384, 0x4495D76D5B4DCF94, 0xDFF596B61CBC8A2E, 0x15686A456E0C8CF4, 0x930887B22A8F2E0F, 0x6E9DA65BE450AEE1, 0x69A9F008680B8157, 0xC10D14802AD8A1BA,
+					0x57B7A6477CFD074E, 0x0AF24172E8640F4C, 0x62452F03365D5A15, 0x3956C41BBBC07255, 0x2B6D1EF3029B3E8E, 0x28CC9B782977F76D, 0xEF39829C8D43F817, 0x9D4735C08A8699B8,
+					0x0C2D9196132B866B, 0x2771BBDC30DB8916, 0xA61C54812FF796EE, 0x89A33D8F9F17B083, 0x8D416845BD94703E, 0x3D395186BFA11C50, 0x617792C299B334B1, 0x662A33C14E59EE70,
+					0x7C640F7A33B750CC, 0x02BA887E4CCB84DF, 0xF0115815695279D8, 0x0BC0FA3A0E2A3251, 0x2F832CCB2AF4CE4E, 0x47BC0AA2414B9ADE, 0x29F56F284CDD1D16, 0x5E94941E2C4B299C,
+					0x05B7260377264EC0, 0x14ACF088BB7B8785, 0x78ECDC8C0C2B3E2D, 0xF4889B518A5353AE, 0xD42A0D95E8F2BF39, 0xD2546C059A8B35C1, 0x6EDE86461CF703AB, 0x061921C27B917C07,
+					0x61B6603377CDEB21, 0xA1D9DE8D419367BD, 0x9B1F5F6CAF01AF8A, 0x5C456B1FDCF7E689, 0x14734C703D8DB65C, 0x12E0EA25A3363F93, 0x28BC21CE0992BB4E, 0x7C7FD9A0D8F15EFA,
+					0x5E1C154218A33D7F, 0xC6189ADD2AEBAEEE, 0xE7A75BB88FCACBD3, 0x30487EA09DC310FC, 0x3A45A5E86585CF8A, 0x55A51B9B262EAAE7, 0xF4DC7106AB2BDB11, 0x81285611F154BE94,
+					0x43B18781E24CFAE7, 0x10B91FF377B1C0BE, 0xD8DFD63643A58BBF, 0xC6E8DDDCC65E7523, 0xC6B1B1C867F91D20, 0xF4F32CF282E9302E, 0x7EC3B5FBFAD738E4, 0xCDDB684104165EAC,
+					0xC7F7522AA9A79378, 0xD75909DD3299F06E, 0xEBE80BBCA843D571, 0xEF919508C305CA62, 0x4A2BB4C87CC64C91, 0x90E467B63C7FEFFA, 0x9F8AEF52703D4A19, 0x5F9A957D346A53AD,
+					0xD324728529BE7FDC, 0x45A7DAFBC3BA0254, 0xDFDC38904CF9572C, 0x5B92A690C23844E1, 0xD59A2B58E88ADB73, 0xE3D1E6F18E65879B, 0x0D67FB00631AB0D0, 0x52D83E830457E6A3,
+					0xFDB95024E0BFC5AD, 0x0DFE40D7FC5D3CB6, 0x081E4453FB6D065B, 0x6AD37EE3461A2367, 0xAFCC6CC67B878E27, 0xAD99DA1B568C7753, 0xA78954C8A30D8F1C, 0x80EE3495EC261871,
+					0x6F98E70143EF3603, 0xD364924201B2A486, 0x1E97FA655F6D46AB, 0xDBB0EA57B52CB2AD, 0xC3C08BBD9F2B4483, 0xD2002C7EE9F7BF2D, 0xF549FB5876815AAC, 0xAFA079022410F1AA,
+					0xBD0733A0CF88926B, 0x6DC3E6E3760BE338, 0xF64103326FFD7E31, 0x73FA0FCE04C0DCCB, 0xA8B6E582052EC738, 0x18543BC3C33583AE, 0xADAF5B48909639EF, 0xB3324890C18B0759,
+					0x3F234F2E95F09429, 0xEB282557FB2285E0, 0x643FC3DB5AF28384, 0x3357B0BC2D465E18, 0xD608551782C0B72A, 0xF8AB7699CF870E8A, 0xC96FD5669BE2C9F7, 0xF15596BC65014CF5,
+					0x0E1A773E804911DC, 0xF73411E40A4E8E03, 0x35A54ACBC17E0581, 0x96B7C30AA88D03AC, 0xA5A4638781E27970, 0xA8AFE2476BB31967, 0x64BDAB6F63957984, 0xB0B31057BFB95B7F,
+					0x0B8FDAFC8D021D31, 0xF12842288C9BE700, 0xF2830B7AFD57AE3B, 0xF0DBE8D2CBA45914, 0xB49591E151C984D8, 0x657CC255D155D225, 0xC4328D12168B72B0, 0x566E0D26243333BB,
+					0xA9A9A7CAB584E3C6, 0xC4B3218354F4979C, 0x0693848A54C558B5, 0x78632C4BC138386A, 0x29D7645B4354077A, 0x2875DCC0117F14A3, 0xA3F8F03BA3477481, 0x4F4752A0716A1F66,
+					0x051EDC145AA70F0A, 0xB23CF3648A0E2015, 0xF20B801911146143, 0x81E1B88621C05096, 0xC09289724B6C9EF9, 0x23DD7545607D020A, 0x6E72AF5561F4B8B6, 0xC3C6699C06B4D942,
+					0x40DAD89B265A062C, 0x9DF1199C6D1B3F8E, 0xD28E361CCF220131, 0xA518CBD6B32B3B07, 0xB9700899BBBFD1FD, 0x49DC5B59515473E6, 0x9BDBA88677AEB696, 0x7AA5B53F416FC26B,
+					0x63ACB83CFB438BF5, 0x63C898A823CDE76F, 0xF356A30BA4070FDD, 0x0401937E3A6C3EC4, 0x8FBD9E5199C51274, 0x1B645C42869FCD49, 0x0F14E9C11A943EBC, 0xA3460D38CF244D72,
+					0x6D8D2BEB101A8C0A, 0x54A0568A1620FE10, 0xD9F03E7801D472C6, 0x4F93BEDCDD159E9B, 0xE1AC7E700AED975E, 0x94F0B02357C5073D, 0x9001A1286B403DA4, 0xC58F3BD6E46A5385,
+					0x50F58A1A37B0B396, 0x885689E68D413C04, 0x29DD20C8CD134E4A, 0x6E4C006F99596C00, 0x6CA92C9B1E1E90DB, 0xAABFC1AA87E224E3, 0xDCF1EC4C7259F4A8, 0x068705D69D3BD662,
+					0x3C86900207380EC5, 0x86B2AFB713D91080, 0xBC030866893B0706, 0x18F70B2F761D06F3, 0x25A3A150E5F97103, 0x8021E64E80617D73, 0x10378FCFF0132C99, 0xB6A82805CC970D1D,
+					0x7E8D391AD8619E6C, 0x3CCE7929B2A41400, 0x2DA347053A19214E, 0xE08C078586A3722E, 0x5494732ED87F2D4A, 0x61A1104C66749810, 0xFF5B2A5CBF7D8E47, 0xA192C269843FEA1B,
+					0xDBD0E8BE34097390, 0xB0463A05623CF0ED, 0x8664B3B399FB33BB, 0xFE76DC19A915D73E, 0xC3361659C1C408D1, 0x91137E34EA6FD276, 0x7DD8FD5217CC7DF4, 0x69B737C24611A3FD,
+					0x6E935DD795714C72, 0x26E84E2F9F128670, 0xC65A760713937DFB, 0x77C167D4D3CDAB31, 0x5562B02BA33A5E06, 0x69776A044602E6F8, 0xE45D7B6616DE6D7E, 0xC12F79283B826B08,
+					0x71EB58377E4ABC9D, 0xF6D7DC2C9F6FEA6C, 0xA5794ACD94454516, 0xFF95F13F6A5C4FE9, 0x8F96DDA546372D87, 0x586C1C7DB0152141, 0xD4357EB4E00643B0, 0x1E1AC56357E860FA,
+					0x44F58DCD96B30E53, 0xC8965BD69F47B31C, 0xA8F1B320D948C588, 0x912C1257710606FA, 0x659567434BE9310B, 0x9E51D584B5593974, 0xF3833D54B758084D, 0x53DFD8D13D17F7C6,
+					0x4268F6E17E4738BD, 0xF481C39E336DD94D, 0x7277868FEB061447, 0xDA2F9ECF12A72481, 0x43BE3877067B8578, 0x1530B7D80A11639C, 0x8F9261D8EA9E71E6, 0x30D50126CE447A0D,
+					0xA75753C3A9565C2D, 0x06FECC4D9C2CE85A, 0x6E19F20299519A70, 0x75E2D093917F87D7, 0xC1908891DD23EE06, 0xA05F52CC24B9B6E2, 0x16A8D029033F9CCE, 0xD028AE6BB9686129,
+					0x698353AFA628A2D7, 0xFCC9A17B94309B9C, 0x8FC07C150E722B46, 0xCE875C113B30F0BC, 0xAE7756D00628394C, 0xC18C53685D5FDAA7, 0x8DC08D7397675FC1, 0x15FF4DC1A696909E,
+					0x008A25ED2099C97E, 0x1A536F926C1571F7, 0xDF4C84ED5A69A44E, 0x56A51E736314EC4D, 0x483164ED8CE069C2, 0xE59EB27500F1A9AF, 0xDCE8CD15BC40C453, 0x840D7D939A3559DF,
+					0x9CE229DECA5F358D, 0x445B98039EDE3F58, 0x7C35A0CCCD109AB5, 0x08EA7D1BC86C0FDD, 0x3890FA1AA7FA0496, 0xE2419A7DF4B900DC, 0x0628057B81769308, 0x00D1D87EC4263A6D,
+					0x40E93FBF8CF94762, 0x3FC4AA78495B11E7, 0xB152F90CB55FD630, 0x5E651D18501E28B9, 0x3173C8B1C44E8F8E, 0xE05CFA09F0DDDA4D, 0x4B3F08EEDD8EF5CE, 0x5ADE204158102399,
+					0x823C8BE04FF41368, 0x2A0794C672AFD067, 0x70D9732DAAD35953, 0x8E073431F62FC53B, 0x8F534ADF21FFE68C, 0x912D9B3BA6A39EF6, 0x2AE583230739E720, 0xB8A1EA9D5422180D,
+					0xE808FC73C7CB8405, 0x46F5C3B93AC80C51, 0x709EF8451D621E51, 0x0C07BF915E557B90, 0x73FA7964E3D78033, 0x7ABCE0686181104C, 0x29A9F210BC188C3C, 0xDA311D6143C4DF34,
+					0xD21613603079759F, 0x1BAD3E6C3BED0B82, 0x318D98D1A9041EA2, 0x2D5D264895244DD2, 0x16F0D3E34B688888, 0x3ABF137630853B51, 0x15D361B2836B40FE, 0xFD58087F10753D49,
+					0x3C3E60530EEC96E3, 0xAF2F076B0424AFAD, 0x171118D580965AA7, 0x28342204C26D1C8B, 0x21C36CA6C73BDB4F, 0xC75D3991C1371353, 0x8F327D94FD97567C, 0x747D9829B38E88D8,
+					0x0C7F00863205B7E8, 0x335ECDF3D5CBB0FA, 0x03E6ABE9FAD9E020, 0x87E13CD52BE9C7A3, 0x94687FE066AB2DDE, 0x1FFF55EEF736C8F0, 0xD6F484CD1ACE3308, 0x6D2E1F18C1DD738D,
+					0xC944D8D8A30D14B5, 0x7DC337D184F1C879, 0x739A15E6C8C904E3, 0x959844F416D4C48D, 0xAE4635731A90C90B, 0x833B96C3AF529658, 0xF4A5D971D419AD3B, 0x92F2909A637243CC,
+					0x6C620317376DBBB8, 0x2AFD356F3777F3FA, 0x84750D7671E4812C, 0x71E8B741025DDC59, 0xF6D12028215804B3, 0xBB8CE9BFA0F31B62, 0x797BBC45DEAED475, 0x1C121A1F35D486CD,
+					0xBBB2321747137976, 0xF84FD2B9E64DE621, 0x4767345CCCF5E551, 0x488224F2B8B33EBF, 0x7449A4341A5828BA, 0x81F195B2424478A8, 0x9BB73A025F99BDEC, 0xE15608736A10A7D4,
+					0xD6856E7235001295, 0xF4919763A2B3CA31, 0xF12ECE602B63B493, 0x4E226BCA7AF92D75, 0x4FAE85E18F27E0DA, 0x363DC72BB2F337E5, 0x8D54EF25B2DF2691, 0x725D955F09E0CA61,
+					0x9489B7D156C71E58, 0x894C4B27BE949B43, 0x67C2020502F46517, 0xE056DC8526F8E62A, 0x9C0E2A861D1D0DE2, 0x6E9B8D1E2BCC1DCF, 0xE28F1929C1D35AA7, 0xA4E11CA85FE76A47,
+					0x99DCADBB3F02644A, 0xB3E33FA318BE961B, 0xD9CA5A5A02530181, 0x100E4C19C0CEDDA5, 0x779DBD3C258743AC, 0xDAD6182903F8AA3B, 0x1E8C9084BCAB5194, 0x82B2C9180FFAC195,
+					0x66A7EF0CC99E7020, 0x051BD2D6D558DAE6, 0xA69CF950E8A3C6AC, 0x931ADD09A7BE13AB, 0xDAC55F450ECAA29E, 0xDD4527BE0D127118, 0x3FDE7C87211CB48A, 0x222B3ECB42A81B91,
+					0xE062848C4762F8A6, 0x506C2310E970AE1A, 0x8F2DA4969CA8ED8E, 0x661A27B363F489A0, 0xFBF7AE4DB13EF04A, 0x5E3510CC2886618B, 0x2079278F4DFE0680, 0xA7A159229C52A3F6,
+					0x305A707245C12094, 0x5825CA5E427B7082, 0xE89CFC8228FAFC2E, 0x78CF0EDC99AD19B2, 0x05CE09EFA59514EF, 0xEAE30D598E1D52F7, 0x80E26B5CCCB78121, 0x08A495DABE58AD26,
+					0x39546690AD8F3409, 0x87B21313701DE0EA, 0x4D5E89128A368D4F, 0xE9DEA582C473E908, 0x7369CBFA2759C8FA, 0x5CB6E2014A51CA00, 0xE2E8717ABD1E7F04, 0xACDFD099DAA06654,
+					0xD7D493927176C45F, 0x8D6A0F1A7C5B448A, 0xA70850F8C1CDDD62, 0x2212C84AEB0AF9EA, 0xAF73EF4AD140DFC4, 0xB58C1E04403D6A10, 0x01DF3500BB2BAF93, 0x27FEA1CE28C8C1C5,
+					0x5116A284CDBCF528, 0xA94E6CE91717A7B2, 0x921FF88BF73BE0ED, 0x495BD199F667F4A5, 0x0F177FE8185A2D11, 0xD124AFBAC16C5484, 0x66EC6164C2825C7B, 0x465FCCAF1EB9EF32,
+					0xD56160DFDC8A10B0, 0x7F050ABE43F20077, 0x0E72A78254A0455F, 0x1406169B05B0B140, 0xFEF0FCA37BF6D923, 0xA9E2A2D20187DD16, 0xFCBD8A28ED203DE4, 0x0AA86F5A5F28FF18,
+					0xFFE2FE1ACF54EC37, 0xE7A37C5CA0F8E2E0, 0x4EB643C7733FEF98, 0x63F49F11B8CC9D9E, 0xFBC6DDE2CE4565A7, 0x79F85296B0EB2BD6, 0x3636570339A980FF, 0x24D33EFC0C0619F5,
+					0x6A5CB4F9ED77D6B1, 0xECBD500C42515389, 0x6ACDF594B63ED778, 0x0BF5DD0A901E7BEC, 0x35CACB6AA5E26D49, 0xED767C21CC8788AD, 0x1C8E7B8C5C1F3F36, 0x6B764B4AE9F9DD1C,
+					0x7D521DAD2BE7D0C4, 0x66E8E5A491E17F1D, 0x73DC962F7A418892, 0x97DEECC2BD4456D5, 0x4B0A494FB19F2856, 0x5FFF2314A34C5E46, 0x34C88EBF7D8412BA, 0x8A5B6977ABF78F8E,
+					0x729A223B1CCC471B, 0xE85D0B7B3A22B7DC, 0x5199419088782DF5, 0xD382128FA5C16CC0, 0x6E81E175B94B264A, 0xADF8A14B83E32B85, 0xC97C8A67DAB68FA8, 0xCC0661E7EC826038,
+					0x1E7281EF28D70AF3, 0x2749D8060B18ED59, 0x424B0899A045D6E8, 0x3DC0BECD6E7F4DD0, 0xC9880978700971F3, 0x66CA951BE06161F8, 0xA79C7C11891C5F36, 0xE24FBC74FA1BAD75,
+					0x5ADCB78BEC004B86, 0x2FFAC4E57D4AF7F6, 0x543920AB20139F12, 0x0BA93B76AC3C19D9, 0xF84EC5B4A4938D0D, 0xF2CA15D0050276FD, 0xB985A5CF16F1706F, 0x6339AFE13A32D3BD,
+					0xC0635A3037BF5082, 0x9CFB322A4A876F0B, 0x0BA6A66F8A0008C2, 0xFF366E28AE70C3CD, 0xF75C9A7FE1E7AC71, 0xC1FE68C0A3463E16, 0xF8C84D499A6DCDF3, 0x643C2A1B898368C1,
+					0x8B6D3391FD5C4E30, 0x80318EFCA8D37429, 0x9A4C0C0F4165F3DF, 0x0D3A85B8BD7ECB7B, 0x246727A9A9E56BFF, 0xB45237B8BBC1E63A, 0x961AC683703C6BA4, 0x55D70BAFA8237F13,
+					0x74164AAF70470885, 0xAAEE4C35A4439547, 0x1D00E25BA6D150C7, 0x6DD6650DB9235C2E, 0xB991EA77731F1A19, 0x0A06182EA2DEA3AC, 0x4B014E07D1D53C1C, 0x568D29C93A57BE8E,
+					0x85D5035302C11829, 0x7F89C43D9CB47418, 0xB21BEFE82F15F153, 0x7115FFA3F9D707F4, 0xC1482FA85F48C15A, 0x76D5C26FDDF7F00B, 0x177F2A5BC574B9E1, 0xEA9C9A4B21C6921C,
+					0x6A13CD9D564DE4B5, 0xFF3F55CC2129B11B, 0x2A4A73D68C29BA37, 0x9CB4A075353E27B7, 0x96F71FFCB1C0ADC2, 0x2DBF77EFF95ECA4F, 0x669B3171ECACC042, 0x7C7050620E9E5514,
+					0x44C198B1A8FDE6A8, 0x573AB21D950D52EA, 0x8286AC2DE03F9131, 0x48EE92DB0EA32B93, 0xE1507AE016BD0578, 0x68383309048D0324, 0xC362045F66363488, 0x84D34743B8BEB2CB,
+					0xA8930158DBAB21DB, 0x647C12C2DEC155B8, 0x3E1366AF6BF4B3A1, 0x62AB5CCB21746275, 0xAE812F199B4B4742, 0x6B56597B9F7F0887, 0x33F4BA6BB1FF9FB5, 0xC4298C37EC5EFF8F,
+					0x548B7471AD4313C6, 0x5E36AE19499CD098, 0x70277F4AFD138D63, 0xD53CF7ADB89C6770, 0x4D33D620782E9219, 0x22C31AB0BDD67227, 0x87E389DA1A5FD77C, 0xF3BECD237556E769,
+					0xF19BE66E66C172B4, 0x9329B1302C69EDDC, 0xD7340588B1369FE4, 0x4608ADD3D051593E, 0x9711755F6F477BB4, 0x84BA2187E9AFACDE, 0x7D5746AD86B15057, 0xF8B6C9D057053EBA,
+					0x2ED3DF207FDBBB46, 0x64DB3EC86028AD55, 0x06ACDE0258D2BD37, 0xE55C74F419E94FC9, 0x70799E159D313979, 0x9E0CA4835C19EE31, 0x74052254CA329A4B, 0x40BBCAB5655621D9,
+					0xD6562B9EE69D1C03, 0xBA85AA9F5C1EFC5E, 0x42174F8E3CC4BEB0, 0x34A68DDB23F51DD7, 0xD5DB5467F9869B84, 0x9EE0DCF8B7F2AAB5, 0x7EA29656EA641F08, 0x279DCB4B77A5FF73,
+					0x6143A373FEB55D41, 0x3A03AFEB178FDCEF, 0x534FB85BF38F07B0, 0xB87C88E20A5E5FFD, 0x8D5CA91BFE0EE1B3, 0xFC16BE10FFB9E675, 0x62B5F0505CEFBA6F, 0xFE47B04703B6D869,
+					0xA6C2F909C9DEE642, 0x4335E9D0FBB2772B, 0x9EA6929FC11F5EF8, 0x60C076F56FD20A66, 0x013905CC549999A4, 0x321FBFBB006EEC0C, 0x6A594D804FE7F156, 0x32C6316B946ABBE9,
+					0x4B6A4B63CDE5876E, 0xEA16076F26F57B48, 0x5C38BFA2E5CFB2B5, 0xC0C5615B96F196FD, 0xE3C26A924E9974C4, 0x40E8C5BA26EC9251, 0xA4BEE891C59F3DCA, 0xAB269DF5CCF87FBF,
+					0x4BC46A905BAE3E7A, 0xA48E6086E8C782AB, 0xD20D4102D0A8FD6E, 0xC50F40F20B1AEB15, 0x5AAEDF06172BC37B, 0x7F18A4EEC0A7B32A, 0x8A5B74D846E4E2B4, 0x9CC2A74280AD0349,
+					0xA7C3B0ABE909C4D5, 0x3CBE48C360E88F41, 0xF0AE6821465E65B4, 0xE0FCEC783A8D01B2, 0xBBA2DDBCE4EBDD00, 0xB541B724F6CE23D6, 0x4DEEA52B6DE51134, 0xE0DAEE08B23888A4,
+					0x5675C70900DEA7E1, 0xA26E7EBA7370A177, 0x83134ADB519C6BA4, 0x1693BE1EAC1343F0, 0xA8B4712B2040EC4B, 0x1A9A4B14D0CB7224, 0x8B7F896D27A3C8DE, 0xBAC5EC07C07F17FF,
+					0x7E5B598FDE0D80F7, 0x2D131A4B90A6A5F8, 0x8EF8E2D2A1726DCD, 0xF98239C3ACDF72B0, 0x3087F4BD2ADAA2AC, 0xB2BB03FDC9FF67FC, 0xE4365CF595AD45DC, 0xE44FE772E7BA026F,
+					0x5B8341B8F7DBF01A, 0xEECE4FD76E399AB5, 0x5A12118F29B4D2CE, 0x53F98AE03F3F684B, 0x2993F84397B104D2, 0x7FF0BBACB34D6958, 0x21BAA7C0850F4C37, 0x1FF2D11A51478429,
+					0x63DC89509B89EB6D, 0xFFA05F65DDC8A9A1, 0x7921E0957F5B8F91, 0x7B7C4E072C3DFD93, 0xC1073A0707420C59, 0x100F09CD42B725F3, 0xEF0163DA3D56F63F, 0xF429265F4EE4B199,
+					0x30E71D308093D8ED, 0x1557F35D94509DA9, 0x2A36DB4EE769764B, 0x8C22093630596296, 0xEBA3D269A7FF15E8, 0x2FCF7E72D16550D8, 0xF433D61D115D4D25, 0xE7AF295F21605241,
+					0x8E7C6ED5E3268E0D, 0x12AE98AE06F75D6D, 0x0D96290775E44F56, 0x2B56F3AA14F7EAAE, 0xAD0BF76E1057D437, 0xBDF75C89A096C234, 0x416AE3EFC73B0D2D, 0x4CA529FD1C4A9DDF,
+					0x82B4B60168D9B5ED, 0xB51693ADD92A3125, 0x1C04FD8FF87BBE44, 0x0E881449A3226BCA, 0x15069ED811C6EC5F, 0x16F94C19EDF790C0, 0x00E36C3068745FBD, 0xACDF5ED66E3AE6E4,
+					0x5330EBF8DE06F4D2, 0x4C551A4D5A39EFB6, 0xA518BBE937DE6701, 0xD4DFB2727919DA09, 0x9608C8B7EDA10956, 0x24E7FA780C21A49E, 0x606935B38FDF16CA, 0x45AF1350AF825AF4,
+					0xBF26E3262044EE17, 0x9AF92B1993C19A74, 0xD6B48DFCC13CD959, 0xC9658B2A442D36BA, 0x24639B58680C8DDE, 0xACF0A33BED3C842F, 0xE5F076D3BCEE5984, 0x59F47FE98F22B489,
+					0x803DE19F6A415E12, 0x2C055DCAC5C0B19B, 0x5A2F518796D6E8FB, 0xFA4FDBFFCABC11D4, 0x6D0DCE0C00A2C351, 0x72C7A95EA5400E87, 0x3BB82F16387A058C, 0x573D94B9E65E9388,
+					0xA1847C8C3C6516DB, 0xEEDB6B8DD0673330, 0xBC683638563BBB2F, 0xAB47F843A1D29ECC, 0x87453DD1F9542095, 0x524C08DF75A91A57, 0x1E1953AFBDDA6E18, 0x625499D866789F9C,
+					0x6E84FD09DAF8C922, 0x6B17DC39F4BB6F12, 0x536671AA150B10B7, 0x85A19BD16472E95A, 0xC3550FCE4566BD24, 0x32E214785411B932, 0xD2D1F230E27D9A2E, 0x9E30106CE8ED7D31,
+					0x96468F00BEDFB289, 0xFFA4F16EDE58EFFD, 0x81903C8761E4BA22, 0xC9274409E0AEE78E, 0x1B121E45848C7EF7, 0x507370A8CF08B5FB, 0x006E48A9B04F22A8, 0xD6B627E7DB47E70D,
+					0x5FC33234D0F20508, 0x1BB3A916076D1859, 0x9C70F4458F2AD141, 0x65CEEFD66AAF393E, 0x727E3FEFF49A1514, 0xC9AB558BDD7DC56F, 0xA9A4791B1DF2F622, 0x36EE6E79BAE3394C,
+					0x5DDD39DC88755290, 0x58D0CC80F3E8412F, 0x1D402CE11968A6B2, 0x37D4AA067BB2E226, 0x4E8A813A9B6CA89C, 0x33849BD29131F738, 0x8E3A9DB1BE6FB84F, 0x6F3DF9DCB48B2A2E,
+					0xAA01B7590AF742F6, 0x71A27F328370DC16, 0x39D714391BBFA288, 0xBA04D1826220CCD1, 0x0E8F1ACFCA997AA5, 0x30CB900AE89B9443, 0xCAA8328F75979468, 0xFFEDC3C685B8BA85,
+					0x20A8778B73BFD783, 0x79CB6B5654265E2E, 0x9FEC0BF0AB778CD1, 0x7D3E5EDE35A40DA0, 0x662E6C10FF3F7708, 0xD3253FCC9CCC8BAE, 0xF64A3C3EEFF1A7CA, 0xB695ECE70B76B378,
+					0xE574C6D57D28824E, 0x69D3F5223CFF4612, 0xFBE0A606CE8B3528, 0x1A91E1B116C6F27D, 0xEAE098F65EB8F8D6, 0xA0BAB4AC80A7A4B1, 0x961B277E3838057C, 0x98B5B1B361FFBE0E,
+					0xF425AEBABEEFA554, 0x674EFDCC45B3505C, 0xEDB41444CE95695C, 0x64FA6A0D40683B93, 0x1DD195798F8A2570, 0x8C9DBC222AE2421A, 0x595D873C5BB92F62, 0x91223098B5C7A597,
+					0xDBB226D8682AC81A, 0x91784BAC4D8B0E8E, 0x8A1F28C6BBA459B3, 0x06A7F63D581681A9, 0x3BCDE8F462548B79, 0x7790BB405474AF84, 0x7554A89EE554C197, 0x24EFCB926CE0E6D3,
+					0x885F9DBEA7C74E08, 0xC6440072D427A11A, 0x54E737EF346BD7B4, 0xEBCC5F05C5B0242E, 0xF56C6DDD09219B53, 0x692F8BFBAA1113FF, 0x9DBE003C463770C3, 0x6B0750BEEBBBA183,
+					0x685D914CCFEFEEA6, 0xC8F343D7428028EA, 0x0291DBE5D14C7CE1, 0x6D4FDC42FE5AD3B3, 0x5D83D42DBB99E355, 0x30F26948008E3AB0, 0x4F58A1B2C842ED6E, 0x2C1E03AD7349221E,
+					0xBB2776E9F8C99B65, 0x6BB83C48657D59B3, 0x955A20E2855FAEA2, 0x1EA69071AD3A1F5C, 0x9264A91ED4A15793, 0x67A6AC96952582EA, 0xF98DEBD1B46EB421, 0x5592CF741EE7A95A,
+					0x7B56D6F1BC9F986A, 0xD40B870DBC0DBDB4, 0x2F5C2CF0EDF42DD1, 0x7DCC2D18355C1C88, 0xD7AC1A0552828DD0, 0x7CFB09E830134EE4, 0x7751DD4D102B88AF, 0x0DAA7708BCF563E0,
+					0x0F54813F59EDB41D, 0x62DC1E96040C7707, 0x8C5C195CCD790714, 0x97FC0382E88BB8EB, 0x31F6EF8A25A7E3CD, 0x9EBB235EBC140601, 0x15BE700219D8A581, 0x99A248948A6A5E78,
+					0x004C51ECB383735E, 0x037BAC801B442F6F, 0x1C0CF8AC932F82DF, 0xD776FC4B2C079206, 0x2EB872F65A9BB89A, 0x144008CAC7C4B012, 0x96DEE0E7EFD09230, 0xA83CB4FED9AB309D,
+					0x5E4A6496B91B4EFA, 0xA0795E0F92B4C25A, 0x76F7D45C254B66C6, 0x03776B8C072ACB3C, 0xEC178B52FA78225C, 0x5724D063CBB3BDAF, 0xFC12029D91BC7317, 0x543AB77B91807AAA,
+					0xD3ED30D0E56026F0, 0x66F6DEE4EFD69064, 0x02EE377041E04E59, 0x63C9B756B3A938D4, 0xF8FD39341AF6B478, 0x1868E7E748F3FF25, 0x6386552F8C2A15D5, 0x13672F0B240DED3A,
+					0x1A7DFB7B41F92178, 0x549290D5ECE6EE7D, 0x7CAEADD18EDD0F70, 0x626F845DB33C0F0E, 0xE9DFB3524061E8E2, 0x76E041962A7358EA, 0x9D5D1A33B58AFBAE, 0x75EACAF42851A396,
+					0x423D887BA2E951CD, 0x936CBC1853F3A9ED, 0x2615D75E53DEDECB, 0xB99079AE9A8F8238, 0x6664D411AE09E518, 0x9C14903ACF2A129A, 0x5153A65E9F2F4F0E, 0xFE2AB6482889BEBC,
+					0x06629B6A3023774C, 0xC12E82E93F3B29DE, 0xD126513E3CFB9F50, 0x321628807A60C077, 0x25B7DCE28AAE0B5E, 0x9206ACB06E1934EE, 0xB92B36A9839A6B92, 0x19091983650AD785,
+					0x18A6687B7CBA0BB3, 0x73E2C8AAC4737592, 0x85F9A74E9BF9D039, 0x2046352E94D71D35, 0x54C610AB8C4EA105, 0x2332A50CF58C950E, 0x66060EABD5B2BDC5, 0x0E5AC89AF4E935A4,
+					0x606FC456B24D6DF3, 0x585CCEBAD934D7E8, 0x67199AE624F3F1F1, 0xB35BCEB4E2F69650, 0x8BD2D2B00A2365AB, 0x4EB017534095D906, 0xB7A51B46A7E4E380, 0xBE7AF609F7D27022,
+					0x5ED4AE1E252DE5B9, 0x6BF8ED6B65DC8A94, 0x2525A3DB56DA3338, 0x444F630171B03875, 0x2071BF4399C907A7, 0x7877915E2B8046CB, 0x0D85415F11C0EA02, 0x59A7BD4021A873FF,
+					0xBF82D4F24D240358, 0x9CEA27C29850C66F, 0x2F8B7FA303AEE647, 0x250B96E394DF56B6, 0x40C591F1A6B7FF71, 0x65D76ADD0341CD61, 0xA5AC12FAF7FE5604, 0xC96063F9AD7927C8,
+					0x686512959F893CB8, 0x527813D0A804F6E0, 0xD40A635F9E37DCD8, 0x55588568A39712F6, 0x991B6CA9445DBBAB, 0xAF883EC137D2F4B9, 0x4B62CB8CF0DEC321, 0x26AF831C00670146,
+					0x69A207F3A4CC6A5A, 0xCA79B6366CDA00B7, 0x04FF32CC52A75AE8, 0x2F1DECFF6E32B6CC, 0xCC26DDF9E6A10B17, 0x4445B9F9F691C01C, 0xAA1C10DF7CEA76FB, 0xC85DDAA29D8768D0,
+					0xDA5595DC27F1ED0D, 0xA1125AFCCFFDBF5D, 0x3DA7BAFCB94D82FD, 0xB46F8ED5C02CC21E, 0x07107C7D68061B45, 0x41501CA60BEBA538, 0x14B94C0DD0587D3C, 0xE8BE31425FB3BB66,
+					0x73DCB1110330720B, 0xD67C5517E95BD485, 0xF082563F4F2F9DD0, 0xDCF6E23EFF64F5B1, 0x836DB9272BB608C0, 0xA80F531125C8267A, 0x3F2D5A516A2F80E0, 0x28F7A7D2956727A5,
+					0xE3797CD2C57EC59D, 0x68A0474117B57A2E, 0xB3AB73A2222E6764, 0xB756E0F67D89C8D8, 0x582642210FD5C9E1, 0xC6E0AAD06560267F, 0x05DFD0D6A8154818, 0x76DBF74E7CA4F172,
+					0x3F0D34085F66ACE7, 0x76B4B62EED2B7CF7, 0x6EC215A76EE2436A, 0xF4E1F90458D459FC, 0xA24D26D39122B546, 0x4EB8D81073D45DC8, 0x407FCC5B305F961B, 0xB7629B8A9B7C81CA,
+					0xA0BB565A384DDB51, 0x09D8CC33AB726688, 0x5F3F6D27BCB41DC7, 0x4C6DE46EB3EEE96E, 0x1DCC789C432B6C94, 0xE465E2FE47D7FF2B, 0xBF641A7825DC412A, 0xE03B1ADD986BE8DA,
+					0x072D895C9B74F66F, 0xBC7EBE5A7BCA4FA6, 0x57906E26D1E0D100, 0xE66186888AD05C86, 0xD38DB76767984BDA, 0xD2E2AA0639648E92, 0xEAA5362DF714ECB0, 0x4C31B20966B77214,
+					0x9538B0E2C91020E3, 0x305AFFF63B372455, 0x5427FDEE8D7CBF94, 0x2E20F20F6C2B7F66, 0xD42ED1A8A3D9040F, 0x576550268030805F, 0x198789506905E264, 0x8D1763F88E0844A3,
+					0x49775BB78D5E75B5, 0xE07A8B0008FB9537, 0x00DFB1CC83ECEE51, 0x35583895600054F7, 0x70CDB77E7BD7CD16, 0x6FCB844233C54D0B, 0xB9BF7FFD657108BA, 0xC9DB3E9E6BDAF474,
+					0xBB2EC9E0E4DFC2DE, 0xABBE57BFB0662F1C, 0x36D7A5D696184B3D, 0x3CC83A0D2FB0CA11, 0x76F107AFD11F7275, 0x697D7ED5F6A4416D, 0x24B59A13A48505FA, 0xA6AFB848FBA3AE73,
+					0xF440238A810B9EBB, 0xF64B86ADA161B2ED, 0x53F1F95363230A14, 0xD3C8D461459ABE45, 0xF0627DBAE02FE084, 0x2E15848E7E0115A4, 0xBA98DB9D238B6498, 0x81E5957F5E08264F,
+					0xA7EA986064FFEB0E, 0x4854703C3F5E661A, 0x26FC819CA884BD84, 0x426E30357FE34EF7, 0xBC6DEDBDBBAF5066, 0xBF453320E4B07771, 0xCE2F1BDE72AFA66E, 0xE3FADA45EC998E13,
+					0x7F3F144B841BA6F0, 0x0DB5A2E03950A310, 0x22907362EE3460E7, 0x4B6E8D46C535C478, 0x8A2180100635E50A, 0xF658A73FADAE2F1F, 0x911CB5FDB5AD28B4, 0xBF2EA5210D8138EB,
+					0xBEC040EF9CB73B43, 0xCE2D1AB429879C04, 0x75193191347F322E, 0x3E63B0AD1F887E1D, 0x258DA95A6BB09184, 0x24C3F56EF339D87C, 0x4F43103BE921721F, 0xFAEDFBDB5ED859CF,
+					0x09C0E05D97E734E4, 0xBFCC0B9C254BAB22, 0x101C80E84B603636, 0xAEA057C34E53E719, 0xE68581CC56EEE146, 0x23B4BED62E0621DB, 0x373AA6A0E8600A31, 0x89D22F78050C4558,
+					0x74A461EF3C22B28F, 0x456E9CABB96BA889, 0x5CB05013977CFC2A, 0x9AFBF33D0C8EA0A3, 0x0B41AB92D3BF3026, 0xB92709BB869B6262, 0x30C01AB19A5461C7, 0xB0DEBEEB61793B01,
+					0xA8523FB6784706FA, 0xE99D554748E130FC, 0xE7511A2B70E774CB, 0xBFADAC1942015892, 0x476AC0228BF7A899, 0xA853514C967DCD3D, 0x7974FE706D09D2EF, 0x242A48F4EBB67802,
+					0x6EF63B3FA7052A45, 0xE7586BEFF8157380, 0x117A9E1A25860A09, 0x97DBCF5073D854B8, 0x3E583B9B2C10EF6F, 0x4101F4E160F45826, 0x53AD9C574FC82BBB, 0x798306FC4F5ABCFB,
+					0xC28CA72C31323329, 0x7F8A040080878D65, 0x62231B77A5EF6DC1, 0x017C5EC745C6A982, 0x180A104447F98B40, 0x4FB96DED43E0BCE4, 0xF1AECE336617E131, 0x3B32D1BFED951860,
+					0x04656A2BFA46F8BA, 0x827505876E090A02, 0x7922B481D4AC7D29, 0xF450E686931C06F4, 0x613DB3D7759CF493, 0x40A65416388F40CA, 0x3EADEA614F0C3432, 0xAA0A4F987F6B5E15,
+					0x790D4094A1C8F627, 0x3C960105234849C1, 0x854CFEBAD4CC838D, 0x47C8989416C2D3F7, 0x16A9B1B36BBA9EE2, 0x70BD59A6929C9DDC, 0x32FE9F42F9B12262, 0xA544C7EA98FCC064,
+					0xDB854410A16FC3A6, 0xFB5D75E867EF38F7, 0xAB08B7ACB96F1BD8, 0x4179722253252152, 0x3435F27698F7C85B, 0x46325AE640D4AB3C, 0x4A8AC0080AA5885C, 0x9BB08168D9867C69,
+					0x95D94A990A98E3A2, 0x21340D6A99700EFF, 0xB82EE9A30D39C3B2, 0xA5D35EB3FF66E907, 0x54F8DF5879314099, 0x73561007A4A372AF, 0xC9F43026FA9D4AD9, 0x36B81899DEC4BF1A,
+					0xB289AD03C0EC9F87, 0xEDD738E424CE51F1, 0x3ACCB7083AA51A16, 0x88FB5C520EF85DB0, 0x2262F018E0C4F79F, 0x042C0E467C435CB6, 0xB11ED04925E71108, 0x50A898E85A353AA3,
+					0x1CD627AE769BE10C, 0x4B639E0784ED1AAA, 0x4D8F68C5971F79AB, 0xBEBA34F764B23719, 0x2A6CA5D5D7B32247, 0x1F89BC060D664DF4, 0x38433D0492F2D894, 0x28C6312C0C21F511,
+					0xAE118DD5047D9E49, 0xEEB32C764EFD0204, 0xEB50285F5D54D358, 0x6F191E9203C4867A, 0xD5B4B6029D6DE80D, 0x4D81158FE54BF691, 0xF5D2E84BECA3FB35, 0x5940C698EBB3BD07,
+					0xFE700EFDDA463CD9, 0x0FEB3308818BBF11, 0x5E36905B931DAF43, 0x66325F5B7E82E4CA, 0x81855DB5CAF666BA, 0xDB367F61DFC9707E, 0x09BFBF4FA9B4E365, 0x3493517346B7AB14,
+					0xDBE94F3EA16A6153, 0x437827194BB5DE50, 0x745D3F0B66B605E2, 0x564EC1789926D49B, 0xF88C801C8BFF7265, 0xF7A9F055EDFBFF35, 0xDD2E2122A2005C9A, 0x4C1604BE584E29F3,
+					0x416A78817AF75814, 0xEF7F560A82F61891, 0xA71932FCA08315C0, 0x3CBBF8646492A215, 0xE6E64340FCAA969A, 0x94DFE69DD0E8013F, 0x5F0F0671D0F58DF4, 0xA9F3DFE5363E4370,
+					0x7DAE74FCAE00E619, 0xB39ABEB2FB19EE49, 0x5F09CE3A74BF9FBF, 0xF074690440038E31, 0xA8E287DD23E914B3, 0x117D5C765D7ECFFC, 0x29CFDFC0EF7C1971, 0x6F32AE2CA651B124,
+					0xFBFA2B113765866D, 0xDA5DFB7175A513CA, 0x99703EB56268DF5B, 0xADF314C33DEDC3EE, 0x2FC18BC5AB465050, 0x44A1B67066A624C2, 0x7DD6794752FAAE11, 0x8B54E84C85FBC9F4,
+					0x22DAC9A654390E00, 0x871517FE16166576, 0xE3A8DD5EB90C3F7F, 0xD8BF3AA8A2F7B95C, 0x32FE3D9C116A8A97, 0xCF7108ED10408F79, 0xA22A901F9547D9DB, 0x4C0313495FF13EA8,
+					0x4B38B5D49E420CBA, 0xE9A5959E0945D0C3, 0x560B7166B04825A6, 0x0690EEE409A4C313, 0x74CDB185DCF71966, 0x284B6622C3218683, 0x1BFB4A654FEDA180, 0xA1ED21087927D21F,
+					0x323267641007C54D, 0x2695FA165F54DC90, 0x496DD98C0F8F0AE5, 0xC9B48B5252B0B755, 0xA084052790401C0C, 0xFFB1D2358768AE2C, 0x9D6B4A607D391944, 0xB020E9B164DD155E,
+					0x402C0C69636E2386, 0x159438656CD3BC90, 0x56E57394FA1F2868, 0xF5B13DB699D154A7, 0x25854DB08177C7D2, 0xE2BBE6BC5B83E2F3, 0xA3330D79F51ACF35, 0x995F1E9C2BE90D3F,
+					0x02EC937247DAA1BF, 0x48DB110891253C07, 0x21EEA101415AF879, 0xDF4E194E867BDB7B, 0x527B530E926E2943, 0xD6CE641C5905E80D, 0x887E7CF198570C05, 0x3ABF985379699C0A,
+					0x226D96A9147337B9, 0x64EFE9A0E0418717, 0xE02ECA49B0C86165, 0x02461C8E4CA62247, 0x5F3A904AB08D6B45, 0xBC539A9485C6699D, 0xCD4B15F8B2BE126A, 0xE7F667874B8F89B5,
+					0x260F65DAE3418575, 0x8F8D15F8C97D76E3, 0xE301EA5821BE9DFB, 0x35D79ACCB6D2A666, 0x199437F94953935D, 0x038821FBACBA959E, 0xDBB68F65BA2C2206, 0x809901A6A79DD033,
+					0x699140817990B362, 0x2C9D978EEBA62FA1, 0x119F4BCCC6CC21FE, 0x91C83614BD3EDE9F, 0x8D1BA45D3215A124, 0x41C3340D476A3DFD, 0x07CEF046722CFC65, 0xC7E5BACF96B41671,
+					0xCEA57AD06AAF8F0B, 0x64F193FD58BEAE31, 0xE36D9CF9D9630B6C, 0xC213DE87F0ACB775, 0xA0AE56D957F3BB34, 0x1E75024FAA16E6AA, 0xC3C4152A284BEEA2, 0x3A447C191A663AA2,
+					0xD034C0980E46446A, 0xE76E1EBE06EBB684, 0x1823BB6EAE983CDD, 0xD7F32B02DABE73CA, 0x22A2705FB6C3DF12, 0x9E20979B63AF7837, 0x851534C2621917E0, 0xCF8D52E38BB492E8,
+					0x00A350197EF2EBBB, 0x894557BACE49F3D9, 0x6A37ECA0E4380766, 0x7EFC6F796CECF25C, 0x1270F1E4EBCC75B8, 0xC7E04864E46A4198, 0x0BE25270A58A248E, 0xB475D3BAB97BDC10,
+					0x6A136257F16A7C69, 0x0DA95457A6A67B5E, 0x242401FAF913893B, 0xD161767224EF673D, 0x723F39A941640F4F, 0x8B4A81717F4C3ACF, 0x0F79BBF0F2238676, 0xE1C674D739759560,
+					0xC55C5EB983CB0E63, 0x5C3E6060076A7828, 0xF15FDCEC45C2823A, 0x2AB5805796766E4D, 0x623CAAE4CEB23822, 0x2A1A3B79AA9D9B04, 0x88C1986FBFF33911, 0x72EFB3B91C0DC156,
+					0x9C15CE62DF1FDA30, 0x6B8CD707FD5457BE, 0x111C230CA64A1D29, 0x29FB8ED93FB2F6D2, 0xEFA468A17DB5312B, 0xB30A3135CBEDBAAD, 0x80B2739052C804F6, 0xAEB88C1FBFE4B0B1,
+					0x97E1B4775EE7A048, 0x7AEBDAE5EA683D31, 0xC18FFD3B1F015AD9, 0xBFD0DBDD8F7AB00F, 0x43C95D505487ADFA, 0x0F7749B4DED9CA00, 0x4944BA1C98C81B42, 0xA13ECA21D1AFE085,
+					0x4ADDA56041E147C9, 0x9B80E4F165DCCF04, 0x9A26A84FC2CE1306, 0xB829B17BB7379EE8, 0xAB0A5CA779DEAE6E, 0x14794DB901D3A594, 0xA972E9A3DBAF60C8, 0xF7192B19051ED9F8,
+					0xFE9465BE949BFE1E, 0x69CC92E93A8E7AC4, 0x6F47688B431E0928, 0xE76904698648CA07, 0xE2363E0F758AC05D, 0xC40E7EA3341981F8, 0x1908635BC93BAF26, 0x2C456AEB46A8B1CA,
+					0xB79A7C4250BDC9C9, 0x00CCBEB8C5AB6B8F, 0x8CC5AC874DF98986, 0xA83A5BC72285BC43, 0x788121AE9D48EA82, 0x21FD6833AE010B75, 0x50D84FD29855249C, 0x501DA942CDAA7C88,
+					0x2CCCAA24F565D9F7, 0x3E63091A1B7D97B2, 0xBBCAF3C8F8BB5E44, 0xF5F81D121338AD45, 0xF4040A5F328A2D1D, 0x890D4EE467570E73, 0x391D58C5FF00A203, 0x5779B1BE56C97168,
+					0x252D691B5D9A9468, 0x42CE07C6A63D5BE3, 0x1D18479704EF762E, 0xA3294BF4B4C7C9EE, 0x19FD2363B100862D, 0x66CA566712F44149, 0x50F0DA56B0488A73, 0x6C085FF48C2DAB5D,
+					0xFF5223E895333376, 0x2AAAB53794473079, 0x827D809646C5C441, 0x3104DD9B1F09DA40, 0x9EE1373C5B09E151, 0xF0C422DB43126E25, 0x273C2C6CE8187197, 0xB82A64811DF00C3F,
+					0xE453F41DF4F8E2D9, 0xF2BFE1113533F7B8, 0x2F1928EE19DA36CD, 0x62B7C264CB0B9DA1, 0x699F223707A2AABE, 0x3DEEFA0E98B23DD8, 0xBE438F46901F8901, 0x00C600F0F27C8CEB,
+					0x1CC8B75DA872A898, 0x0097A4B46EEDA30D, 0xB5445463D9D52909, 0x6FCCA9CF5DF2AF59, 0xE737A2725677F78E, 0x722A6C7AC56A84E1, 0x739F6A32C2F1D7D7, 0x3D2E03AB4B54A7DF,
+					0xC62CBC922F2C8086, 0x925970BCA4476A04, 0x2594D8BC782E9D6D, 0xBC4FCC4B402A7D39, 0xA6A754BFC85FD357, 0x3103C9EE9FB68166, 0x384F264F798B33AD, 0x3656DED746A137D2,
+					0xC0E52565EC8833B0, 0xB0FFBEBF82181081, 0xB918D586C9C001E1, 0xB5B3C0224ACAD054, 0x30C6812A95D19CFD, 0x465688F237833A17, 0x630353D57DFE1A32, 0xDCB09B5CAB77C475,
+					0xFC52E1163192A0C9, 0x8B0D22985C2C0A4A, 0x26601A88036641BF, 0x3629AACB4C64086D, 0x82125A6C806012CD, 0x54ED64AB4933F046, 0xDA435B2BA5B01278, 0x1D5A50D291C05A88,
+					0x38C2F4FD7605DF30, 0x227E80AC4D9F3939, 0xA13788C4BC43A743, 0xFBFDDAF7B8142073, 0xA2BF2021DF325C8F, 0xA1C3F933D5CDCB95, 0x7D7A97F0C6D1E85A, 0xFD05EED64588B86D,
+					0x54CC7ACBAE6EAFA5, 0x9ED8662F7EFB6282, 0x84133B822207525F, 0xE6E6C5D981184310, 0x524F1319E2C40286, 0x5544C37AD031474B, 0x10F45FB9FADFEA64, 0x2C8BB25CE3358802,
+					0x8C51BCC7224EA8E1, 0x2907C33805351785, 0xDECA7CCED9BCA82B, 0x833AE19FB172EBBD, 0x6A4ADCF4E2DD3AD3, 0xDF92753B9C7AD001, 0x14F82F1DE2C7A427, 0x48F840462A560C47,
+					0x0E20C7870ED378DF, 0xF5573502B8D046BB, 0xF55B89DC4D5C3E93, 0x66E38AA75CB9B528, 0x4E60A0800B3466E5, 0x6E0E8357346883A7, 0x615C91F93C98E48A, 0x655080B86A200AA7,
+					0xFD982B94A021D01E, 0xE097F8CA54BAF792, 0xA29030CB1343F91E, 0x2DEDA6B27F11A269, 0x6ECE7D488DA91EC4, 0x359C182BCAFF00CE, 0x8BCF54F804175770, 0x86F9252E17D9AD7A,
+					0x3A505E37B2DB138D, 0x99AD20260E868142, 0x405039F3F5078FBA, 0x3C1C0974BB660EEE, 0x3EDB2B5536C3BE9E, 0x42F2F357999B3F53, 0x5C0E8A598C1A343D, 0x245DFA063FBA67E3,
+					0x75B929D6A9EF8076, 0xE035FF8C71CA21E3, 0x7C33E72CEBCEB2C1, 0x594C847EE6FAED23, 0x92D6E0F20E56AB05, 0x1607FCDEB1B87873, 0x3111700DE2E7AFDC, 0x64E5B0D99ED454D2,
+					0xB2A32C6B3B608AD8, 0x2621AA4B6A7FAF1D, 0x7B560226EDFC5331, 0x7EF98FEAE86695DC, 0x71BFCB2DE14ED3F3, 0x43D5B4E6B7AC321D, 0x3D6297B91C5EBD74, 0xBC0E06E13D3ABD32,
+					0xC40ED8D1FCAF3B25, 0x145D1C1C70412A1D, 0x76365CADFCE07D22, 0x5EE828BFD4630B0F, 0x0557E6BDCF72A961, 0x208277A823913010, 0x59968E518FF98FCC, 0x0A67F6D653696254,
+					0xFB58B5115D635A36, 0x706982804831F3E4, 0x95B09D04A7E0030F, 0xD04AD0DAEECEBCD7, 0xAFF144A6B367EF12, 0x39A2C6A502FF0617, 0xC83D8013D95A8DBD, 0xE771C925FE411C80,
+					0x926EAD5E7A95D11F, 0xABE9BF5CCC1BFF3C, 0x7582340DE32BCCD5, 0xC740F24E4319B61C, 0xEDDEE5B18DCFB193, 0x856B67BAEC4EA49B, 0x6A954ACBD967D1B8, 0x98A08E15336CEE87,
+					0x1F3DBFE2CA36B5A1, 0x7EB6BEB8BE2AB0ED, 0xCA03CBEA008A659F, 0xFBFBD944CB9A6AA5, 0x9581D0C387CB488B, 0xD0063CC630236EA8, 0x2A3AFFF2D68E0008, 0x11A2C3D78F56D106,
+					0x441C784CFAD52548, 0x24F7A7EB1213FFD9, 0x16E2B11D998C8059, 0x095990510F52A935, 0xCD7F7AE2A3B3D3A9, 0xBE4ADDEECE7ED07E, 0x594E5FFD595C605F, 0xEAE070DC47EA572C,
+					0x05C1CFCA50BEF2DE, 0x25092D7D27E2C16A, 0x5799E91545200243, 0xDBAAFE17A92DCA60, 0x775D60E1271C3013, 0x924644B60EC952E1, 0x2CF03EB3861D9D67, 0x9FA6A40C234AB351,
+					0xACB4957D6FB611C8, 0xF3964F82C01E1961, 0x8EDA98EB64C890B0, 0xCE4CECF38622C349, 0x80967AEA522C2571, 0x3C12FD2611C7F5E1, 0x5575099C529D858E, 0x8EB6A668FC3A9D3C,
+					0xB0E7A2259A93BF5D, 0x53AA7459428A7760, 0x2B9C5B6A8A30F92F, 0x292FC84B6481B6E1, 0xA580DDAD48823EC6, 0x01E0AED10E8AF930, 0x0F63EE42A0E7DED7, 0x4FE1FB05B2CDB8A7,
+					0x89DF6C3725191C36, 0xF37FF4085486FA88, 0x52DEAD0E63E5A436, 0xD4BC0DEE0CB0ED47, 0x82640E7F814CA132, 0x4504A434E815024D, 0x0FAA3D96B1B09514, 0x8C75BE0A8A0828D7,
+					0x4F23D6DD675D5056, 0xA2D9439C6F8B861A, 0x2094543A55AC3A5B, 0xA26642F995307C57, 0x9F4CB114F786CBFD, 0x1BAB2E3AC32AE7FD, 0x6A1AFFCE85D94808, 0xAFFD93F88E6E0138,
+					0x55538A5E9A5FD819, 0x95DD99908281BE21, 0xDAA04A4E55C20C26, 0xCBD2CCD8E8BBE800, 0xF888550B70248CC6, 0x2C7AAECA42CFDBC5, 0xB2F75986266E69F8, 0x8F1EED2E4BD6E19E,
+					0xFAC9FD8AABCE2C05, 0x0B9AF5B9B1E9706F, 0x19C59D0C166787B5, 0xC79DCB7DA32C7279, 0x78CBF4009BB93862, 0x7F041EF735070B46, 0xFC03C0E29A511B71, 0x040D4FDE2742D18F,
+					0xF49C6B538112C4B2, 0xF1600271BCE96C6D, 0x8DF2331B41502FFE, 0xB2A883382CC87F96, 0x10E36EC1CA1232BE, 0xFF32AD33888D58AC, 0xCF13236A53FC7F14, 0xE3BE5A1905821645,
+					0x4F693715BD31BFDD, 0x2491420D28E9CB77, 0x22B80399475B4B8C, 0x9E27FC969E26BC41, 0x2CCCDCEF68EFF822, 0x6F03EF397652BFF6, 0x548C7B32E58866A3, 0xD94D576A9C190465,
+					0x8FB79886FC42E83E, 0x27F63A5130FC27E8, 0xB78C3E218B91FC80, 0x164570310BFEA932, 0x7243AE30A85FC85B, 0x31AAED8CF8F9ECFF, 0x861CFEAC3F68423C, 0x7B26B01B3A3AF2CE,
+					0x5555ACC0819EDE1A, 0x53891952E78F29FA, 0x775D8E9127EA244A, 0xF14FD42DE69F79DE, 0x791E6EB6D5B81775, 0x8EDFED68AC7BB822, 0x33948F2D5E249051, 0xAC137FCC9A3953F2,
+					0x5AC1911B7BCBD8A7, 0x536BC4E644D6A41A, 0x340A457D70459ADE, 0x60651BBF119A1E07, 0x21F54F09FC8D2E3D, 0xC006B997761143E8, 0xC805C1D5529B03FB, 0x35E3559621E2E7CD,
+					0xBBEC27750BBF958E, 0x4662C1AFB84D3E83, 0x4E6D82AB27C9F7CF, 0x0C4CDBC02A8D4BF2, 0x71A599AED4E4B0FD, 0xC94BEE4E83B431B9, 0xFFD421A87CB0E3BC, 0x4727A91DA8A0B45C,
+					0xFC93EB00F6148ABC, 0x17B3C4178ED077E3, 0x31FBA24D3DD40AFF, 0x59EF4982668B701A, 0xE6F78E464097D467, 0xDF04DCE650103FF4, 0x145A181C2C5336B4, 0x6128AAD3B784BD4A,
+					0x83224DEDE2EC4D59, 0x48D5B1B5E9996D9A, 0xFCC45CBF063BF691, 0x25CFD45A3EC7766E, 0xCE92FB3E73E2D2C5, 0x0B07D2106E429589, 0x7D35A6F49D36BA90, 0x62DECD8596FFFB0F,
+					0xEF3242C17F84D710, 0xF557990FCB87C0A4, 0x13BF53180A8F3864, 0x0C5BBF02D0643EAF, 0x108D6C2464C8E402, 0xE49FCAB27AC6604B, 0x95D45D3A9F91B1E9, 0x2A88D45D15083288,
+					0xE18BE5351494807B, 0xB91CE5D4A106F7D9, 0x92F39971B8037238, 0xCD62ADB463821562, 0xF849E208F90D1167, 0xE0843DCFA39BD820, 0x1E099FBAB68029ED, 0xE8F9CF8193CC3219,
+					0x90A982A1C37D400C, 0x3F61C21A4C5996C5, 0xDF906972F2026085, 0xC3B5EBBD1E127966, 0x38D8913598C31931, 0x21A2124A3B67229E, 0x4849DCA869A8E70F, 0x6AA051DC4AABD4DC,
+					0xBDC5CA7E9CD569FB, 0xA93D413926A04F7B, 0xD756C2C864F75403, 0xE3F31834E7C93C65, 0xC3472A34B67FAA99, 0x830508BC6041D0BA, 0x71F7BC0A6813C5A5, 0xD537FFE33D3A5425,
+					0xDAECA59C6327F64A, 0x66C6CBCBDFA3EBFE, 0x76DE351DA6E1AD90, 0x55913D8FCC2AD8DA, 0x3163970ABB6C3B11, 0x9F22DE867D9FF046, 0xCE5AED1322F977F6, 0x24CC7E5AAB826845,
+					0xFF85485AD1D31737, 0x7D7FA172A3E6521D, 0xEC66C1F0D450D7F8, 0x9CA01BD01FD1046B, 0xCA38B9685BC13135, 0x3FD8C2D50C84EC80, 0xF1B4B09E18DCE7C7, 0x8330430FB578AE00,
+					0x8B690EE9D60FC414, 0xC48046B724DF8287, 0xC6BAA6AEE8E7B1D4, 0xE79DD1A840714620, 0x06F772863977D41E, 0xCD4DD6619CC3D9CA, 0x468A97618BF2ABB7, 0xBD484A03131187B0,
+					0xFE0C2441A2480359, 0xF21ACE4B5E2A2705, 0x745122E2E287766D, 0x62780810BDB9907F, 0xE41DAACF8E9B97A2, 0x6DF7286A8EF4E186, 0x88184C9071665DD6, 0x8219F27BD8A52B9E,
+					0x99E5CD33DB35C3EA, 0xB445459F7CC964BC, 0x1E3011B1DE5966FF, 0x72C8730FDA2D0083, 0xF0B2C1C67493891E, 0xB76ED424D14E4620, 0x942CDF68D5495F76, 0xC589D3454DB52D4A,
+					0xEC430AC222D1E3D7, 0xEBC60924428E1234, 0x4D1294549C46A65C, 0xBBDECDB5FEB3EF98, 0x452880EE305ED827, 0x6B99BC3595971658, 0x26F0B4BD671F7E38, 0xBB42B7197E0F3A37,
+					0xA83B1F108297CC57, 0x974326F0171DBB84, 0x21ED8166E7E929C8, 0x7B9C89B3AFEB3244, 0xB265DDBE9EB429D3, 0x519EBE9E286E239E, 0xDD6BE0E792FB1A27, 0x6F32D4BBD12B2B32,
+					0xB6A82C8A073DFC67, 0x139BDD924E6237D6, 0xDEC3E9F28CD4FD05, 0xE1FF81C638B2D5C3, 0x2DBB19A7EE742ADC, 0xFF2ECEBAF3EB966B, 0xD2A910F886D244F6, 0x3B841E75ABF15F82,
+					0xDB6859A181FAB82C, 0x7AEAE991AA3172FD, 0xCA32513EE9EEB564, 0x1B8BF54665615BC4, 0x4BA6F3BCF128E306, 0x7AA2C64E8EC33F35, 0x4A668FAC42737312, 0x16B6EA835D666545,
+					0xE3A808AAEC7F17D4, 0xDDF83FFBE10B2A3C, 0xBCE2AD64F0C70C11, 0x904554B312C05DBA, 0xFB22F48CADEF5989, 0x1A47E62F6674A4E3, 0x90B0DC58539633CB, 0x43D7E23F2E7151C9,
+					0xF0FB306E4F8D8C8C, 0x0E8B86C0B49C9527, 0xEFC51434E405DFC2, 0x54E6B9CFDAC45798, 0xF898B13D2CEECD69, 0x5DBCCA7F39E7D45F, 0x1761561E3E529116, 0xA38D62F02104FAEC,
+					0x0065CED348B27CA4, 0xC78F6E43E6CA6CC8, 0xBCF3BCF74FAAD0ED, 0xDEA83088C08D3070, 0x3C08BF2BBF81DCB1, 0x19DB4CE894A3A7AF, 0xEBF67DAE587B1BD2, 0x7ABF0F242E5F0248,
+					0x660CB0353E87C646, 0xE699E22BF4CD99F1, 0xBEA74EA3A6D0DAE9, 0x56F53E1ABE02B4AF, 0x48B2971BA18ECCA4, 0x92EF3AAA50E02C7C, 0x8F0E931E8FACC2FF, 0x0EFC4D7798E9AA82,
+					0x334C943050315D7B, 0x9C126223902F005E, 0xC79388708AA4C3B5, 0xA3D4659626617BB7, 0xE86DC827CDB563F0, 0xF4019877C557050F, 0x7CB25F116DD919F8, 0xA6327040D67DDC60,
+					0xFD138926607304EA, 0x8731BC8A3BD133BD, 0x25AA4390ECB2A7D4, 0x7CFA002A8C6FA6E1, 0x5B1BA04DD15D3F20, 0xBF50A49FBEEBB81D, 0x5F182D93FD2DB15C, 0xCF35D89CB00DA197,
+					0x2219679632008FBA, 0xBB4FA76293E1B85A, 0xC32ED572C3F0A926, 0xB058F80314E2D68B, 0x8AC6A690F99D0649, 0x6A5411E5FF017824, 0x17431B46BE233477, 0xDF1B2C764EA4FE09,
+					0x11BD6F05DFD44857, 0xC3943FDCC050B47D, 0x05CC072AE0A515E3, 0xB5E3820243E092D4, 0x9F1517472A62AAAC, 0xDDBD88894714CEB0, 0xF2E04660DF8D2B1E, 0x5501906554376312,
+					0x5DE94D1B39832368, 0xD07BF599E6C10759, 0x8F6E10D32222DA75, 0x984E254366E268E0, 0x187A977BBD201588, 0xCDFAF2B9ECDF757D, 0x439EF57FF451BC23, 0x2F6F1581B409F8D6,
+					0x70242453C07BA186, 0xE0952376837F2DF8, 0x431E70B54CA28657, 0xAFA47AD083C1C9F9, 0x73FCE3D55EE82209, 0x7CA9BF0D10B8C5FB, 0xDA34AB8235FB741A, 0x026B492772E65AE9,
+					0x7767B0838004CAFD, 0x4F1EB2C05D4B0DF5, 0xB431AD007016EB07, 0xAEE166CC356EFF18, 0x83CFBEEC5B0B5BEF, 0xB248BE723F946145, 0x08109FAC697AF7FC, 0xD4C86BCCEF468528,
+					0x8C22812E9E453502, 0x148678BF444418B2, 0xD63700427C9660D5, 0x7D1B69A91086806C, 0x5703A56AA29607F2, 0x18BDCC2782AF1989, 0xB218862D769C5256, 0x3EF9FC8915FEA0BE,
+					0x451E90905048A14F, 0x4A131DA752F08645, 0xE0ED95816402A902, 0xC63A7B896890C684, 0xA04D3E69B2D4B81B, 0x24B0427554810162, 0x04E475240CF70193, 0x94898DC53B39DF6F,
+					0xC594AAFD8FC248BE, 0x0E481422E065738D, 0xF575B70CF8DA71EE, 0xF3BEAE8436C9DCC2, 0xE1436313643C711C, 0x89F57B35C1E2D984, 0xA4B470003268FD6E, 0xE3FAE873286EBB36,
+					0x8FE1F8102AC7C070, 0x6AE6F02561D82977, 0x8BC7F21A820F5570, 0x7588BF10F96E7373, 0xB5BF7BBB0C818F5E, 0x802DB3BB4C69CC77, 0x4C0EADB12665F6AB, 0x74006B24901F01B4,
+					0xB1D0EC6355B53C61, 0xBD6C51F943922AD4, 0x99A7807F6DEA29E2, 0x4A93C8C328E83194, 0x85E1CE2761E84293, 0xF72B0B473903CF67, 0x6F1F21C4152C6967, 0x2067A91689A33597,
+					0x3D35959581E64775, 0xD2400956E35A2ED7, 0x0021A73CEE9ED69E, 0x0201333418DFF827, 0x793A7BD52ADB5B2B, 0x55E384DCACA694E9, 0x0867C35A8B1185D4, 0x6504B73CC8A7256D,
+					0xA5A8A378F087A96D, 0x615BFD6C903CD757, 0x236EE1DCE6A95835, 0x5890CD73F4617844, 0xA9DFC8EFEEF694C6, 0x5EAAD0723DF66E75, 0x611D548A59F3C341, 0x68604F264F96CDFB,
+					0x723A5A35089EB7D2, 0x135E734A5488AF23, 0xFE5B6DE10300E946, 0xC48C40A25B685F9F, 0x809180F16C4BBF1D, 0xB61465786A20E8E8, 0x50BFDE8B1EC3BDF1, 0x9A88C18E090FAE8C,
+					0x169B10461026285C, 0xE798E4CAF545196E, 0x8464CDCD9F259CCD, 0xA0D887BE864F6269, 0xF8963C66CC59294A, 0x0CE5BBDEF201C822, 0xB50A24D9A2121E69, 0x77D7CA6EB5C844C3,
+					0xC2115051E5DD1937, 0x4EB0A67FF22ABF01, 0xAC879ECE30730114, 0x9ADCA7F68994E8E8, 0x2999474F55981CD2, 0x442BB8B4E6FA01A2, 0xC381D3D4C61FDADF, 0xED14C62CC8BCF90E,
+					0x855D8BF02742AAF4, 0xBDCB2C3CFBA53D80, 0xC83D84EE5D2426A6, 0x215D67442B12CB82, 0x9B08B31DA45BD908, 0xCD98F2B922659FAB, 0x5581F7C7A0B36150, 0x0D714343BCDC497F,
+					0xD947B44AEF03F91C, 0xBC7FB68730B803FF, 0x2E79A10140C56AAF, 0xED04CBCF25711799, 0x95BB3E3950C5508B, 0x84031B738A774BAE, 0xF5762AFB38A04B4C, 0xDB1BAC6336C0CD63,
+					0xEBDE473135E27F3C, 0x2DDE29D6674AB01A, 0xCE2D787269330779, 0x2DA2A9F0AA312DD8, 0x76DE32B43D929ABE, 0x6893DEC83BE9B36D, 0xC43F8CD0B3D6790A, 0xFECA9EE726427D39,
+					0x236942E37C9788C4, 0xB645BE278F84EDAB, 0x321C7BF9A6B4BED7, 0x3E2A143E4BAD08FB, 0xB7D4A8B6C6A3D32F, 0xEF688E5F5ED1A311, 0x4684D97564B7997D, 0xC86A8FA80834FBA0,
+					0x477DD5C2B0F9C987, 0x56BEB31CF450EDAD, 0xA092B583EA05EE7D, 0x647A98776495D7EB, 0x7D4B7C2397ECD346, 0x12A3A599BE03AAD9, 0x9E65869FAF7270AE, 0xE8E51828A3BE8623,
+					0xE960A8AB0CC30C26, 0xF36567461E5840AD, 0x61BB25746A848299, 0x687E3FFD8BCF2271, 0x050305BB4CA70831, 0x9FAE2858C04B7A85, 0x7E37C7F982B0AD73, 0x82C086BA2637655C,
+					0x94986852A82BCEB6, 0xD0A29C06D601D5F8, 0xCB1A0616BBE9188F, 0xDA82AE671C7F8F05, 0xA60543A0017B99E4, 0xB2C78D4E9286D5B6, 0x9675AF19E473CDCE, 0xE5729177DC4B79B8,
+					0x52A0798287F85D0E, 0xBBBF62F891FEBEA4, 0x673BBAEF1B214960, 0x2D2447D7C28FFBC6, 0xB818AFC85EB46820, 0xF8C415896F2D5DCA, 0x6A99C184A7B93930, 0x76BD7DFD0287CCCC,
+					0xA227E782BF116FCA, 0x8E7E8336A1AA452E, 0xB6A91EA4F3712C7D, 0xE80FF74B16E4D033, 0xEA1096F0C8823C1B, 0xA33F9E0077F89116, 0x8320BF24A17EF442, 0x4422ADF619AC409A,
+					0x96BA5B4557E62018, 0x2E1F82E8D90E1165, 0xC35CE7C440F59BE0, 0x0D5DE1B2F6034626, 0x6D1BF316B53C9CF7, 0xB74F6B497FD8801E, 0x93A0ACA47EEC37C6, 0xFF3E0F887833BF56,
+					0xC7BA9A47B3FA7BC8, 0x96988285690353A0, 0xBAB6EA50137D1EAC, 0xB9350D1B8814915C, 0x15E93CCB0C5187A3, 0xDB1BFE42E0E1115E, 0xF9A993CB17B6767D, 0x6A51E0AF00D4D766,
+					0x9E7875052DEB0F13, 0x7A3AAE2C065A0CBE, 0x4F597A1BD960F6CC, 0x2A297CE1F5D532F2, 0xABF6ACD6784823C6, 0xA51F6F327FB6BE71, 0x403E758082C20773, 0x447BCEC93BD2C14B,
+					0x63C4A9776980AB6E, 0x4E51450FDB2AF28D, 0x37B3CA99F15672F8, 0xD72B1221723CA310, 0x311BE83A84FDE477, 0xC4095DAFDD5F6BA7, 0x6A971E03DF811CB9, 0xCC22F0AE09C52BF1,
+					0x708EB86C66F5847C, 0x050B9B4D919DE63E, 0xEA6281EFDC065ACF, 0x626B9145EC0E8C12, 0xB71D10F3AD70A427, 0x46A67B2DF0DEC685, 0xD793A4A7EFE2317B, 0xE57ABB348E5A728B,
+					0xED1692BCAA99BDC1, 0xEC18EBC31333AAE4, 0xE8F2E4161BFBB694, 0xE300395129D8B3F8, 0x31D0B7F40778A4A1, 0x16104C8B8DA58608, 0x1E04A85FD09F304B, 0x6705D3F3DA67C166,
+					0x4BDF6A4A8C0E9F0D, 0x386CF4D22BA22412, 0x1C674F6C0D42DC96, 0xCD5516F545DCE05A, 0xEE6C72F2B664C9FB, 0x5744E5454AD0CD38, 0x3315921ED116008E, 0xD6D82CC07F19488C,
+					0x1F98FE8DF49C2403, 0x5FA1DC92605E3D40, 0x0C351E446F4E3340, 0x78424FDF7F90E86B, 0xC876EEA81D02B3C5, 0xEEB607ED05B7E255, 0x58D68E4C0813048E, 0x6D0AC93F46379A46,
+					0x5C64D6D56E53540B, 0x9BF0B7E2AF737A3B, 0xE1C0201B4D59374E, 0xF3CDF320C3EA04B0, 0xC407D723C3AB3057, 0x1C3506EA6EBEBBF9, 0x2F025A11463307C9, 0x2C2273E44524AEB0,
+					0xE5965AEC7AD360C6, 0x338216CDC66422F6, 0x952E6FDBC96F10F3, 0xA48EFBC62D0CB994, 0x0BA49A41A7A9D9B4, 0x24C2CFD22BECBA8F, 0xE8AE022D509A42BC, 0x89CA86AF7E932BD1,
+					0xC862A6D137332A98, 0x3B025FA72BB2FD06, 0x6D95DA8D327662BE, 0xFBF8C4EBE332A85C, 0xA96DBF5C6E2FF415, 0xB8DD899014856FBD, 0xE93286A4A47738B1, 0x59CC7735D5D40866,
+					0xF39A7AE0145AC2D7, 0xD1B25F675B241913, 0xAEF02AE24EA21487, 0x386690378D95D24C, 0xDBFE5347AB7C2E2A, 0x5FA0E13CE80C2149, 0xF9B5AF88531CC4A4, 0xF8E735C2224E9873,
+					0x1CB22C6AC47F17F6, 0xBFB7AB32E3AF45A3, 0xBBEF54998BEDB23A, 0x5DE623F07E02A155, 0xE3D21084EABC8B1A, 0xF28B54EF1F12A16B, 0xE7A5C422CFAA1242, 0xC4F7517694A1FB8C,
+					0x4B8E364B58BE99F3, 0x3D294B8C717C59B7, 0x8ACB53CBC9C7A838, 0x36F22A0100C1AB53, 0x09B2A9D20E291F65, 0x055881BA471B4003, 0x94614969EC82D9EE, 0x0BD98E6B9DAE1689,
+					0x4DADD7988F452679, 0xE47F92FECBB8493E, 0xBCD771A7CDA6BF99, 0x864ECB255A423A38, 0xFB0C5CEE33E4654D, 0x7F5D4F6F36AD93C0, 0x0DF5D40E8979B4FD, 0x4622CC99D141CB8B,
+					0xB55442193E12DFFE, 0xA70FDA8F04474AA5, 0xB3E3275CEA06298C, 0x10BC5DBEA562BD9D, 0x39DCFB8ED98F9340, 0x0B08781BF6EE3ABD, 0x17FF4A97B21A3E05, 0x8C4880E4E5FB92F9,
+					0xAA56390902E081D9, 0x00AC56B4EF55E30E, 0xB5C6A3E3FD1ACF11, 0x8B0F3E9D47A27C57, 0x2469F9CF4C0015D4, 0xAA0FE31F4E4C5E5E, 0x6648E2D10C05480A, 0x6F49B81CF89AD163,
+					0x5E4AEBA815D2D993, 0xBB8084DD6E64D4A9, 0xE156115BB5E6BB16, 0x91971608FFADD257, 0x61938E2FEE5D24F7, 0x488BF8E56C90C7D6, 0xD17D5621BED88A2B, 0xF28FC3A5F47573D7,
+					0xA09E8D1E46CECF97, 0xA426230CE5B064F7, 0xF9FBD7AB8A9512C1, 0xE84A49A82CB29314, 0xD2A30BF05D5A28B9, 0x8A2AF2C94E1F5D48, 0x6A188F65C0ED272C, 0x85D34C2495B2DE08,
+					0xB41839845866F244, 0x5A42F3A8D54DDC35, 0xE06A02209AE9C6E6, 0x2D5B0EA790706A5A, 0x1A210F6E213BA48A, 0x0E1EB5A06092F927, 0xAF8E3058DA6DE267, 0xB25BB9CAE8BA4B73,
+					0x1FF5AF9C6F7341A8, 0xC308F50D8623F9CC, 0x3AD94BBFC8BFF191, 0x0F3F2FC680264BC4, 0x333E5915BF97F13E, 0x3F7ACE52336A34BE, 0xFD13E125186EAB01, 0xFDB19F9ECAED8E4E,
+					0xA70DA8A3AB00A3AB, 0x6062F4BB1D66A99B, 0x714CE997945680AF, 0x36D0A135131F6383, 0xA5DA8378F3C2B9BE, 0x9B223A7710CC7BA3, 0xEDFA0B8C9851349C, 0x2D804101517BC0B7,
+					0x6C0920026084FCB3, 0x4C41668916B7AC4D, 0x80CA47D4A3971D26, 0x22DA90DB582849EF, 0xF48A34EBAB5A7EC9, 0x4B8267A6BC506836, 0x25F267A0C2102E71, 0xAFC324CC7D7F9E18,
+					0x8B3A004F7388E19A, 0x125A9860E5B45084, 0x666BB434664DA2A9, 0x5872D95B1AF096E4, 0x58F484FA5C649402, 0x735863C18074AA04, 0x7BD4F06A959487D3, 0x965F7528635B08D7,
+					0x30EC14FAEAEA6534, 0x45EA93E6562DE2B3, 0x71C976AD4F15AF17, 0xAC93F620EBC3E989, 0xCA56F56050FC9509, 0x46306CC30F1E3AD7, 0x95B5DDE42B194A79, 0x9FBBB3E05AC0197E,
+					0xCCB8BBCCA5368D24, 0x5B30DBD2F57C510C, 0xBD631C96B1768AB4, 0xB4F8393F6378BF0B, 0x32972B3C4D4E159D, 0x0F1A7B39418B1688, 0x661A718214289C51, 0xFB6061919B3E4F52,
+					0xAF6A6B12979C8CE3, 0xA376927E9B8F801B, 0x2E0CD13047AF281F, 0x9FDDE175D69F46EE, 0xC473A08C4813D49B, 0x515E0BDE098CD1C3, 0xCCFFBAA4CDB51948, 0xB0223D8C3038E6DD,
+					0x3C9DF8C72DCD5576, 0x7F2108E67329B366, 0x078895FFD5EED013, 0x9F5AD5D362A0EC4A, 0xAF1EBD50A0E62349, 0x83DAAF04963D4DE5, 0xB951F664BC5EE84F, 0x51B906E9A99F6B1D,
+					0x9B015D6615C7D1B3, 0x533A3F7F1C5326BD, 0x1E26A4D31B470925, 0xE3A5355342A5C1A5, 0x54CC0527FAE8AF6D, 0x36EEA01D18C2EEE3, 0x8AC58078E2F31F68, 0xEB456014A27F5EBA,
+					0xCD29FF64B3112ED8, 0xFAFDE92EB8CFA89A, 0x8B1092D68719BECA, 0xF4ACDB9DF48CEC3F, 0xF8969F57980C5C5F, 0x38C4486FBDE31D60, 0xD0A67D81851BDE91, 0x11FC9D6EFD29FD28,
+					0x3C13A43F73417F19, 0x178B3252F9BDE46F, 0xB2E7B1A3AF44F61A, 0xD3ECB5AFE6806144, 0xFB62925DD38A0D63, 0x8A4C6BB5722E270A, 0x0AA4383FF69768A8, 0xF4116CBBDA6C77DA,
+					0x8CD9C1D9F15CC5C7, 0x3C52D7AA8AEB1EDB, 0xA052E8CD18DC0BC2, 0xE85A8A1063210354, 0x700E4D4BEBCC5E2B, 0x1159486537DE6883, 0x7FF20EA0D0FB4572, 0x2544F0A3D1140FE6,
+					0x4DCF7C030AF89433, 0x333BDA9311FBDD1F, 0xB8B95582F6A27336, 0x0779533C0AB33A5F, 0x629F89CDEA15F1F5, 0xD6F30836FD2323F6, 0x4F4FB3BAEFF5382F, 0xD539738CF55ADD34,
+					0xD492A490F64E3675, 0x03F27FBAA14A92A0, 0x74C15FE5B6494CA2, 0x33393BE44AEB4B4C, 0x122B5043F19C8F70, 0x20D75EAFA12A3A3A, 0x350AABD2FDB54541, 0xFFD44F48D152D88A,
+					0x8A63F6B3839D7F7F, 0x37EDDF9175E0A295, 0x1A3F8063A7D548AF, 0xD8A8894E2393964A, 0x718C2EDA0A19A3E4, 0xB6757CB2D4D73D8C, 0x5A6694AB33F456D2, 0x785C96A8B77B194C,
+					0x6BB845CD781B65BB, 0x3748C740383C96B8, 0xC6E7A04EE0128E14, 0xFDC390AFC4551C3F, 0xDCF6CA16E649912A, 0x0910671098689B47, 0x6635AD2955149523, 0x80FDF3C92ABE1A5A,
+					0x51741521AB6BDF8F, 0x823D2EBA0194E5EF, 0x1170DBC78320F08E, 0x6639485D2B3690F9, 0xD1D9C09ABACFEB33, 0x24473BDD413CD4C9, 0x21FC194F5EC72A18, 0xCF585556340C0C60,
+					0xE6D7A66183A89B5E, 0x01C2D100AD6EFA45, 0x8E22DCB2A68CE232, 0x29365F8F41089F72, 0x758DA7587B8E4756, 0x96FED835D9A0344F, 0xD462037A74AD8ABD, 0xFB26B74D9318E82C,
+					0x54D9CA41D5630D99, 0x62C659C46096F012, 0x09B1A810B07B8A7B, 0x5F6F795F5DAE1FA6, 0xC2081EA46B7FE529, 0x5DFD13125EE053BE, 0x75FDCC9BE159A88F, 0xE62B23459A93303D,
+					0xD903259E9721BB52, 0xF044BA581A379127, 0xFA68FDD20A86F267, 0xEA0409F85EA9DAE8, 0xA5602F6995081750, 0x72EF603407B88265, 0xA30970DCFBBE9FAB, 0xB10F4BFBDF57E3F4,
+					0xAB372866F1A82AD7, 0x1F9CCD4A0E8BBBCE, 0x50C22D5CA8001B94, 0x0980242767606F12, 0x69D9C09B5619F4C7, 0x758F100CF255AF21, 0x13B639B9FCA523C6, 0xB89E4266471B700C,
+					0x344944BE0311A981, 0xBE920505EB07BEEE, 0x6589C51EED755BAE, 0x2503D02D12B9B149, 0xFC482C21E378660A, 0xFF22D190B2BD1DD6, 0x02E7A3E4D3330C4A, 0x8EB9AA8429616E8D,
+					0xDA2447A7F21EE21C, 0x6A59603175FF4B16, 0xB2B69E7AE402C79F, 0x857B9DAD8FBD910A, 0xA02919CD6AB4C3CF, 0x1BB7DD190EB64C6B, 0xB37F8B59A37B92E8, 0xFE98FC2E3F2B9034,
+					0xD264B1CA2ABC9063, 0x82C20B4A041EA478, 0x5FF4BFF8410154FE, 0x9F5F1C587AE34035, 0xC2362BD29633D265, 0xCC729351927DD46A, 0x482D3109F0A21BCB, 0x8F6F2D34F08B72C4,
+					0xE25B6683D11AD40A, 0x57538927394886AB, 0xD401E1626E584088, 0x6A4B24457E91BC35, 0x23B59EDB85CA7BD0, 0xC494AEB1D5994380, 0x86E3A8E7C6D1997F, 0xBAFEBBC3B4CEAC36,
+					0x4913589EA3E02E83, 0x2921243D7ECDC898, 0x79E61B602A312C6A, 0xC751E8F84451BC01, 0xB070BC1DA2AAE26F, 0x8BAC09B42D554ADB, 0x5341B23323249B94, 0xFDC5C988C805F974,
+					0x8F9680797842B161, 0xE0788E1C7C04EB48, 0xEED147E8966EA368, 0x9346CAEB8A460FA1, 0x7C4CE075AB2F0728, 0xEE5F63C2CB12A076, 0xB8108D3EA11DF470, 0x0B2B866405038E67,
+					0x2BB8C997C89321F5, 0x9E3E43F420946E8D, 0x219AB490EA754F28, 0x4C802456BBBB56E0, 0x0BFDBAF61FE6BA05, 0x2E5BED6FA977DC9D, 0x9BF497D912E005BE, 0x004E8984EB4268B7,
+					0xB3CA0E177B1F1EAA, 0x88222D1038FDFAC6, 0xDED33754561E3272, 0x05F66848FF95646C, 0xBCF302F067702BA1, 0x549045E7CD83C63D, 0xC38D9F022C02D556, 0xC45CCD0781E4C5BA,
+					0xFE2F3703FCFB6A4F, 0x7F50898AE03E5F84, 0x52897BAA5801FACC, 0xE930CEFC7E4C5FB2, 0x0EE4EB35DD9AB976, 0xE5E564B662BB8CE7, 0x613CE13A6A362C6D, 0x6B432FE3B8284A33,
+					0xC29E482EDC1783A6, 0xA37BB80F208D976B, 0x211EE399666490B2, 0xC251C993A7DCA57E, 0xABCF9E3700AB90FE, 0xD22B232B7C7E5B80, 0xEFBE649C9BAB393F, 0xFE595505DD595F58,
+					0xBA8E9002EE5C5595, 0x3E5D35EC725DFFA8, 0x590FEC557A8F8E75, 0xB81172F39276EBDA, 0xC84057EC2F3BA771, 0xBB3CCEC1DB4EB126, 0x936A96BA1B1423CD, 0x54C7068E51CF64CD,
+					0x35C6F1F063C2AABD, 0x01A810E0F2738D70, 0xFA446A001CBB371B, 0x9C33EA6EB1A9EF16, 0xBBD07041AC24F720, 0x3EB7A1E75C283FF2, 0x4CD3418F914C36E5, 0x894AA11A410806AD,
+					0xC42F421D5A09B4CC, 0x7E9346E1656033D2, 0x5B63CF9BC7D41A32, 0x06B611744062A1C7, 0xC16678714737EECF, 0x4FD98AA7D642F7BB, 0x86F2990195D55A00, 0xA8BEBE2E00C8D0E4,
+					0x75D09596F3326A2E, 0x9EFB80D498BEA2EA, 0xBDD15EF4B01FD18B, 0x609FD7FED24C1F56, 0xA65AEF249F226D00, 0x2AB5359FF555C439, 0xCA68365EB2BBBCC4, 0x04B5DC552BAF389A,
+					0x507A1237A4C31B05, 0x902C9EECBF677867, 0xFE4C83149D487B62, 0x5BC275DD8A8FA750, 0xD8EE90B603FF6D77, 0xB2A00B6ED408D881, 0x601872A28CCDD700, 0xCB5389733297858F,
+					0x77470B86E8649832, 0x35E331A6E47FB891, 0x383A9316D36EDFD4, 0x12B6D0C930A2231E, 0x6F634299DACE7E7B, 0x6AD271193A2B95D2, 0x866BDBEC49044733, 0x165602AA0C9B5287,
+					0x22F72FD9F84E4E3E, 0x9C26C5402D4BDA7B, 0xA8E75964B583AFA3, 0x3A75B413704E6CA5, 0x81096501D8EEC7D8, 0x7618D33254EBB5E1, 0x2A84B3A48A939B53, 0x037C32E9901181A4,
+					0xEC233176263F7294, 0x3B4C2CA901950BA6, 0x0FAEDB14D66C318D, 0xA67493272C1E8378, 0xF30942EBF467E4ED, 0xAB82695E3D07326B, 0x1029A3749D68FDAD, 0x3FD550A96A041747,
+					0x28FCF00325EFDA26, 0xC9D1412EC4332900, 0x4E7E1C74472B4CA1, 0x0522CCCAC56B37B5, 0x3B3167E67173435E, 0x2ACA0D60FB44EDA8, 0x1A79D3E0613C872F, 0x3A61B1DA8419DCBC,
+					0x92525CE72DD8C184, 0x9D551132EBFE1F80, 0xE23C6ACE92FDE3E7, 0x2DA3B594DC720BF7, 0x850FF1F8B715AACF, 0x31D4676CFE6F45FF, 0x1E0F1723BE89539E, 0x321F89F77E619FA3,
+					0x47D3DC01AC639FFC, 0x9041D7E40EA33422, 0x48214B64F74AD637, 0x25BE81549CED9E18, 0x4750E6B5D6382B8A, 0x0A1522CE63ABFE13, 0x33495AE955DEB426, 0x632C23B549AC9C8C,
+					0x494988E231410DF2, 0x4C8BE34BE5A5C4A4, 0x223F2CAAB9F318EE, 0x960BC1050CD02DF2, 0xCC2D8E96412CBD16, 0xA17B8F0A94174DC3, 0x7E9B0112E155B388, 0xA4D5CA64769A5A8D,
+					0x7A4B46E7A987C742, 0x648AB519853B38DA, 0xE5EFFC65C72B0BCB, 0x271FED646D8C0E07, 0x13711B3A2403B6AD, 0x54027B23C423D882, 0xECD84072B69BD020, 0x3B95986440D34AE6,
+					0xEA3956894F93955F, 0xDD05BDE87D836100, 0xAF2338752B66C3F0, 0xB10AE805BBDE6921, 0xDA67B4DF0D08FD8A, 0x7A4A528C8458FC6B, 0xD04509EAA352AED3, 0x7D04974A931D91D0,
+					0xACB4C8189D946B35, 0x28447BDF0714E5F2, 0x72713F6D23E3DC92, 0xF2627DA53D211936, 0x4C47B6E7669365C4, 0x965BFAABFF204F36, 0xD22F1CC256963293, 0x5CF76C211F62A56B,
+					0x8E7A21979C1C3150, 0x79B04E24F10435A8, 0x03EFFE37E2007938, 0xC430D647FAA7DCC4, 0x13AE4ADD885CCD0F, 0x0B1F5BB966ADFF0B, 0x7AC852D3C364ECEB, 0xC030791F41BEA8BD,
+					0x6A6D9C706839DC38, 0x9D836782CF513506, 0xB72E7294702BBCB3, 0x26C10F73EC4F5709, 0x372247F2BE843EA1, 0x0D67ABB98A37D453, 0x5811BE2AB94E5F19, 0x84DAA50E9F3589D7,
+					0xDF9DA50E7D2603E1, 0xD659B8A715EEAEFE, 0x71AA44A762FC1FF8, 0xF9C9E8B2AEFA3DBF, 0x80B87705E3A31459, 0xA277189B6D6C2FA1, 0x48221F27E4026013, 0xD73F2579B626AB98,
+					0x80216C127C5906FC, 0x989EB2340F5312DF, 0xECFB5A6BFC0C17CF, 0x2051084986A669DB, 0x2A7B8B1AD3C83442, 0x5C3C97930677CB9A, 0xEFCC06E5FE50DE17, 0x336617C1F595112D,
+					0x6F9A6A4B28F3007F, 0x10014EEB616FF71E, 0xDBB3656593D0B5E3, 0xD4152306C98912CC, 0x1758B115642DBDCD, 0x87A4340431CCB485, 0xBB8752B3DF1B26E0, 0x524F06102C12DB7F,
+					0x820D901AC955FBBB, 0xC3C9057949F97BE4, 0x2E65DC7AFE446DAE, 0xA1E01E1B2A5357EF, 0x348B075AFD1F9A4D, 0x72F25F71C115273F, 0x0D46BC8EC7CA5DC6, 0xE7780DD8E074ECF3,
+					0x67E0CC29EC2A0797, 0x63288A40986837D9, 0x3BD5229733118720, 0xBA32351DF4F14521, 0xD9153DC8AA2A2D42, 0x7474E07EC249A8C9, 0x597874B11148F4CE, 0x2E92DB031F7CBAE5,
+					0xB7585A2156A300A4, 0x5675E4B28DC75794, 0x0B465F65B2298799, 0xA1B5EEB43DCF8849, 0x411A0D66C336E7B4, 0x36AE2B35AD4DA9C0, 0xE666FFCFD7FF1A6E, 0xC48A80DB68E0C508,
+					0xC12B445C03340D93, 0xB876DE4479916369, 0x1E49791CBAD38E8E, 0x8566823DFEAD251B, 0xC9793D1F0BB32EC4, 0x7D94C69E3286A767, 0xFF08E69F0FF6458A, 0x38DC944F3A165515,
+					0x875CA3D1B3B81956, 0x252F22F0BE95380E, 0x89C75D7E95C20E59, 0x23767B903003CA87, 0x7BC36E51D19D849A, 0x2E0BEE265C0F91B8, 0xF5E11B054739C228, 0x82051813A3576951,
+					0x030E280C84F5C522, 0x1BE980D14AD1DD88, 0xEB99995A2AF79E31, 0x632CCE44B3A0519C, 0xDD77F450D154DB24, 0xDCAD0E32D338C512, 0xA80B399B0A5BDF65, 0x8FC3EE21C019844B,
+					0xB197E3A76CB41F9D, 0x6D5863A883162BF9, 0x4F14D4C90B1F1AB1, 0x26C83AF7C6BF4D5C, 0xD284C98B25D1E12C, 0xC0057F4FDE51A974, 0x8FB8FA359DDC22ED, 0x8C011C068706370E,
+					0x53909DCE27DF1158, 0x7F1359A5405E685F, 0x7A8B235FE2815EBE, 0x01281F9D05FDBC6B, 0x437B4858B03D8996, 0x41B73B35318B6008, 0xDE00E2FE8DFDA65F, 0xDF9B3468C4507B38,
+					0xA6072D23F066C8AD, 0xC52F742FAADEBD2D, 0x70CA7BFD279E8974, 0xF49E26D777480B47, 0xFD77CBE0AFA14E1E, 0x98236E99AF2392AF, 0x241FC5D643196E9C, 0x693BDDC5D89FDFCE,
+					0x41406317388940EB, 0xF8200EA15EF611AC, 0x0BB9EA17E791E5E8, 0x5AFE1930B5F26D9C, 0x0A08A9ACFA1F530F, 0x1035AA33509A4EAB, 0xF5A9B22ABC49EB5F, 0xBC77589C03486D03,
+					0x45396AE41199AA34, 0xAD48366B84E0D8B7, 0xBC1C1E16CCF864D9, 0x00FC908FB2205108, 0x347312AE3FEA96CE, 0x85178CF7DC28C816, 0x0935F47AEDB9E4BA, 0xFA910E95AE3CE042,
+					0xDBC6BF151C625DC6, 0xCDBF090C9A38FD67, 0x2B580DC62296C196, 0x0C1B34F8C7281194, 0x159BC68F5B0A6478, 0x5F959D9370586F90, 0x3629A450AA5C362F, 0x794D446528F985AE,
+					0x6298318DA96D51A2, 0x4F5744BDEC1A33F0, 0xC5FE44D22106E7E9, 0x12D328F44E333551, 0x35F68A5E9C08DC96, 0x4BEDDA8ADB6E3FFE, 0xCD199D6C5F15C93B, 0xB4DB4054CA1E0644,
+					0xC2A659684A18897C, 0xB8DBC995AF482FAB, 0xD05AA8710932DFFC, 0x55506B7337C19FFF, 0x56CFA10C57B17612, 0xEAF5C6FEDE3284DC, 0x0BB92416EA3366B8, 0x869395820465066B,
+					0x4DF1D42B449E0ACD, 0xB786736D138A2B9D, 0xBB67057498A5486A, 0xDEC2FC5EF0F90CAB, 0xD400CBE91CB26F06, 0x2E072DF9ABC10BDE, 0x1B4C7E25FF22C338, 0xC4589B5819274B00,
+					0x3CF47F1B43442F89, 0x9BC8EE2A7855C02B, 0xF34DA93990C9DE2B, 0x12BC788A8EF86416, 0x2F7236448D1559C9, 0x6CDC5CB791B5EFA8, 0x1D5A7050BD5C56BE, 0xC62C0B4BAFF138AA,
+					0xC064CDFC1703FDB6, 0x4C915DE55561C056, 0xDDD37BBD49373B2E, 0xE2BA11A79C6BEFED, 0x1A46FA1229CF7614, 0xEB74973FA7201DD1, 0x84C00D7F45E2A8CC, 0xC0D58554D34070A0,
+					0x1B1479A96620F681, 0x0B062A24D0460EA0, 0x08EE0FBBD44EF882, 0x4098F40D6359FD9A, 0xDC4809CD74E689DA, 0x036A1FACFC639622, 0xA8D2C2F2419CE70E, 0x4F164EC7E4B3C027,
+					0x8CC10C271894D814, 0xE0246C3369191E18, 0x65A1102A39482A8F, 0x41753C7970AAE24C, 0x03BFAA8110DC9FCF, 0x67E3777D98DA2744, 0x90A3F9CA3B03D88E, 0x6F6BF00EEB935FF4,
+					0x2FB8F4450FB502B9, 0xF547F718EFA4E49F, 0x4F71E57BC1EEC6B0, 0x14357E70E04A9DD0, 0x6349871C06EF162C, 0x51AEB0E2AB749E0F, 0xCF5B9A58E0ADF24D, 0x32CBB8DE470A7D90,
+					0xAB2C78B7E67ECAA5, 0x6B4CEC8B3CEC39C0, 0x6E016F5CFF9D8344, 0xBC638D5447BDE6D6, 0x1DB809501829753C, 0x4A470A227A92FAB4, 0x94772FD7339AD47A, 0x8145BE8E4F53BE9D,
+					0xCF3ACA6F99D56A0C, 0xA48438874BDAEA35, 0x9897D68C9EEDA4E6, 0x8C0E74E5279EF462, 0x747F7CBCEB7B4BD2, 0x26A01809B94BFCDD, 0x5623062C7E6CE8F4, 0x7DABAB3DADA88B08,
+					0x41616B87409ABBBE, 0x5F17AA631853F9A2, 0xAE36D4086CDD8234, 0xF2EEBB1E2B442BA3, 0x84CC6A85AEF91AEE, 0x803726031644D41C, 0x51209E7E842F5494, 0x19B2820C494539DC,
+					0x7CBE95B4AFCB9A2E, 0x5DB3A0CE9621E0E4, 0x73C4F657B5E4D4FC, 0x767D2E50EBD99186, 0xE444922174939844, 0x626A67E1C8F15845, 0xF1164F95C1D84613, 0x1EEA42D85CCCD8E4,
+					0xDDE5F7B224DC4047, 0x0132F3BACEEE8F72, 0x807583084DAD7CDE, 0xF8047007ACD822EF, 0x23E24305CB49080C, 0xFC71B40A53642536, 0xC80E21C938036DF5, 0x7B6FC08F74D64F24,
+					0xA269055368D37D30, 0x1F7C72AFDC154BF3, 0xED616A82EA9DA6EA, 0xC938774D7F6DE86B, 0xFE346909113D38F4, 0xC0FCECE9D7A979BE, 0x1B0D042B00CCB528, 0x8473E6044F8F2B52,
+					0x8ECAE9048FAF2595, 0x31BE1D1E041CBEDA, 0x4059677E0C3EED0E, 0x1DED0DE30B770F80, 0xBF806A40EB62D508, 0x0DCF9F3E3F1D65A0, 0x7C12895B1570E968, 0xB5F841443D17A42D,
+					0xB1BBC90EACFD582C, 0xBCE5A81ACBF569CC, 0xD474C2A13C73CCF8, 0xD4C2C0A16CB45088, 0xDE0BECCC0965801B, 0xEBF48605ED4DB41E, 0x936B08E1280CAD97, 0xF7AC85B284F3B0A6,
+					0xBD8DF3014E94B309, 0x9C0B7C22A81C0BAD, 0xC95F00C8525DBAA9, 0xA5DC9137F65DA916, 0xE082C329AD4F7D68, 0x371D9436A94BC0D6, 0x6D3CB26AD4A42286, 0x9E0EE2A2F9B3B180,
+					0x0E2BD5941B0207A0, 0x1D38FCC6912F3926, 0xBF695AA5D197749A, 0x7162060FB27693D2, 0x44594E46FDFE337C, 0x2E0831FD5FDA54E4, 0xEDFE4D7EBBC0AA25, 0xBE1A9494D2CFAA11,
+					0xA1DF4DE22113D3E0, 0x16F3F42CBC483382, 0x313CF9BE107FCAE4, 0xE6430F490C68BFBB, 0x6B62E40B5B69C1F7, 0x277905F8A4E616B1, 0x122B3AFCACD77E6D, 0xCB0F0AB41C983C45,
+					0x1BE107967E46828D, 0xF7A56194AB563497, 0x4A5BCAA382D2622F, 0x17416901F315C1A6, 0x948E608388879DDB, 0x68FEC10731F23784, 0xC8873B61024A3553, 0xB362F159D31BFE5F,
+					0xDF2E606C7600A3E6, 0x15A9A441192B0814, 0x2E93671336C4655B, 0xFD815A611192F877, 0xC8823410E8C77B75, 0xB598DC7F692438CA, 0xD013E27317C5835B, 0x4542951030CAC21B,
+					0x09871A1796B031B1, 0xBBE6B4DF7458D46E, 0x99A0A6FAFEFA5822, 0x42E3DB555EB5D4A3, 0xE3C5AB0049599304, 0xB2AD672C215AC91C, 0x669B39985DE9C2E4, 0x5FD58A0D55B2421C,
+					0xE7D6B23AD1ADB7BD, 0x10B0977F106C3971, 0x5BF1B197B8A13AF7, 0x2048FDF7BE7919E5, 0xA21ECB49348AC04C, 0xA30484D55E5ACF42, 0x48B0D9384D02A674, 0x77A569B1507C6269,
+					0xA3BA9BBEFF0742FA, 0xEAF621F4A87BBE6D, 0xD64591B50BB90A44, 0x1E931F82ED2F4E6B, 0xE2E8DD0A7A0FB7A3, 0x1B2AA9559672F263, 0x9D320B73A578E1F7, 0x03A0FCF23ABFA7FA,
+					0xFA0D4C75C3D55679, 0x66F8846468792443, 0xBC102DFADB50CE5D, 0x6D37194FE247D9F6, 0x2E527E7BE58159F7, 0x88F5C4929DF9BA5F, 0xC573E4A6AA8ED045, 0x47503A891790CE71,
+					0xED9126CBC5BE1F30, 0x2F1222BE71D7D1E9, 0x85EE37ACD99FC649, 0x3273C496C52D82F6, 0xA2EFD3A96DF908FC, 0x1C8636764B54BFF8, 0xF5DF89AD1E00F87E, 0xD9C77BC40C57EF62,
+					0xDD8D10E44759C787, 0x7569682C3F620246, 0x0F4249A28CE060B9, 0x26B05F8430CE6775, 0xFBE7D698EA4ECB21, 0xE74F3817AA6B1529, 0xA5F4E89F54F4DE7B, 0x7CC46E103381206D,
+					0x8F8494F2B71B1B47, 0x38FF2DBADBC7DA37, 0x67A74DD23B15E1D7, 0xF32FC3F68BAD0033, 0x088ED0E1945B9419, 0x910D43FDF4DC404E, 0x8CF99E7A9E071E41, 0x779D182E220CFB9D,
+					0x5D715E8620610571, 0x1AE6E8302C3EE7D3, 0x99DE83053DDBAA14, 0x2E251BA805AA24C2, 0x0C5987CCB61DB7E3, 0x0BCA354FF06A3ED4, 0x8040E2C560CBF743, 0xB504E47BB88BA12D,
+					0x77276782468B1AB9, 0x1BE33B5BE0CF055C, 0x14E92CEE4B7EBBED, 0xF2B40BDA561432F9, 0xB82D89E014E142FC, 0xA0A2DAE5BDA1FAFC, 0x56819B3F19BBD757, 0x64E65E043E0D2BCC,
+					0x6E42505DB2EE5AEF, 0x61899AE339820DCA, 0xED8B81ACD5DB229C, 0xE36F69B65030088C, 0x52B080642DBDB3D4, 0xDEDDA05A0B85C1FD, 0x0CA25A9527EEBB70, 0xB5EA022D2D82388B,
+					0xCD3F02D59C49DADE, 0x63843BB17192D482, 0xFE7522F99843766C, 0x667950CD783F1D55, 0x85E442B23C587EFA, 0x06036EFAC8F8094E, 0x3379326D28AF2AFD, 0x6DE6A079CD222B07,
+					0x0ED25B2CB53DC9DE, 0xF67FBA8F105F37D9, 0xD110134D98C2B77E, 0xBA652411AA19FCEB, 0x7B0ED73A6E8E56EC, 0x9DE3EB8B87473EE6, 0xEDC4506157C29FB9, 0x2062AA7DE4D9A2B3,
+					0xD1504AFE04AA66B7, 0x8F5DE3F9A5550CB7, 0xBAA9D02CB5C623FE, 0x658D5AFBED65B25A, 0x10BDCCEAEAA94C17, 0x90ABF8C371CEA18E, 0x63C16119CF39C6D8, 0xC287FAB4BFE2F676,
+					0x26D04C89AC3D3F99, 0x074A256FCBF0D9F8, 0xCE0FB57A83EBDE80, 0x46511BA3C605AB08, 0x007755DE4D853EE5, 0xD3F3C9063D317D38, 0x8F45B872581F66E7, 0x1BF455D8BFB814F1,
+					0x58D6A4F672F15738, 0xC6390FA7DF0BA327, 0x2A66E4739795AE41, 0x6DDF34F8891AC469, 0x575B24D94DA17C1A, 0x2FE700D243E7C4EC, 0x80EA0272405BA4F8, 0x03FC33A4613F7F12,
+					0x9A7CABF04C25C397, 0x8E4FDFFC6A6ACE50, 0xA711E5744DB31259, 0xC3A5C2E0B07ED312, 0xF1BA7ABA153246BA, 0x0F7A38C6AA0A2478, 0xCCCDF6220AD92894, 0xDFF0F99B9E40C089,
+					0xB6C968217AFB5E65, 0x0A8C72686B491D1B, 0xACB6C0B25A2421D1, 0xC957BB4366E1AB1A, 0x3797DA16739B144E, 0xDDD8EF2D3B330789, 0xFD487D655CBD9072, 0x250E1DBFFAC85D58,
+					0x26E4AC7EBE8296C7, 0x536C5FD939C11A90, 0x4EE64A84483C97D9, 0x3405ED1E0FCC83CC, 0x72F2CE8ECFF29DA1, 0x8806F38BD94E2B3F, 0x6EB30B8717366617, 0x559243D000A85744,
+					0x19C921A0AC6D074D, 0x45D3F54863040BF3, 0xFF0AFCA4B57E316A, 0xE6EC4E54066FFF6B, 0xA2BE814A8378D82D, 0xC17810233259B1B6, 0xFCF6E0F1CC1433AF, 0x65064535BB823E6F,
+					0x0927213DE0D4C7BA, 0xCDF5F948FAAC7342, 0x89B3D06437A85BFC, 0xB740632AED817CF2, 0xF8FB1D2B8195FFE9, 0x41AAE6E4F6948AEC, 0x8C68E40E88424633, 0xF41D89CC20CBD438,
+					0x3CEFE8619CB9890A, 0x882407F83A50AD14, 0x19E0B7B0043F1485, 0xFEA86AE0E112176D, 0xC0E098244B3021FA, 0xEB36DF8EFBF45F7F, 0xD551DC7E34EEE68B, 0xA2E1E9350FCA0BD9,
+					0x4D15BFC15394EAE8, 0x9D1C606E84219DB6, 0x2E7B5272CB01483B, 0x79F52F15ADA7F67A, 0xBDFDC55595439871, 0xF012893984F4A003, 0x52D1776479D702BD, 0x13EA5E5BD9238D1A,
+					0xB502AA71697BC37A, 0x1B7C4CA28E821D4E, 0x170BE55C6D6EB79B, 0x3CEBCC0378346C0A, 0x3810CC1C54F727BB, 0x57BB227D16926630, 0x743E90A084ADDC0A, 0xEA5817E5FE41F2B0,
+					0x32E5472437585F1D, 0xDC588F4B79991496, 0x338292347A4B40AD, 0xF84EE54AC7FEA040, 0xC95100EE6F732654, 0x2798AE5EBF5355DC, 0xBEBF73A44795D3EF, 0x1CCD7F8D9B3ADE80,
+					0x0A999D15BFC2BFDE, 0x550C1260670B6590, 0x06D7FDF65E9994BE, 0x272501233B3ACD0F, 0x6729D4B01BE6FB61, 0xF1784FA4DAA88ECE, 0x79A8A944992102C2, 0x85B3ED51828D394F,
+					0xA1F29EE046746BE3, 0xAE3741FBC7EB3DF0, 0xA8751A8E4F7F19E2, 0x407D166B66F52154, 0xA7A1FA2A9D20D4A0, 0xBAA5CCC62F1877A0, 0xB6F330E07BB070BE, 0xA57FAD9A4935F944,
+					0x0E16D03ABCD44AF4, 0xC3361EAB3EE5DB66, 0x97D61640E9331F7B, 0xF6E52F2356667BCC, 0x5EF00A63B9E61229, 0xDD3CDF36A9FC926F, 0x3E3915D42AD84181, 0xF732D6452B348B66,
+					0x7F76015BD4817B4A, 0x740356C9BBDA0F26, 0xAF10C3AE4A79C6D2, 0x0D17F8ECF70A7BFE, 0xFE39A0E10CB64C0F, 0x54674085B2542901, 0x99010325E6F9FD90, 0x31D962760386F17D,
+					0x87AA7BB277AAAE23, 0xC7A261077E027CA9, 0x1520F3395C2CE459, 0xAA6AB4438507F60D, 0x0E9BA49B48424DFA, 0xB0B1D914E9AA9F55, 0x2AEE2798BF30EDEF, 0xC749101A83968E8D,
+					0x287167D6B0964DE1, 0xD6EF308168EA0F77, 0x0B7DC7642C9505E1, 0xCBF20DF906DD3FFB, 0x0321CC1D5D7F45ED, 0x9A040EF25D9B6E7B, 0x01EED124E6338747, 0x36280F21599548FA,
+					0x1E70548C596EF89F, 0x60ED3B893D7670CB, 0xDD900E566CC64888, 0xEFA422B87EF1B409, 0x48B641A08D93EE1D, 0xFA1344568B91AF4E, 0xDAF7AB71530E319E, 0x8D469441FD6545DC,
+					0x28ABFD242A8F64F0, 0x1D9B82F2BD3E8418, 0x21C6983BF173CF01, 0x77A260E4F5A94C05, 0xC706AD72C890DA92, 0x7B78F961095480FC, 0x56D4297B5761F962, 0x9C34D32A463B469E,
+					0x827ACDB32C338CD4, 0xD86B861C00E3E724, 0xEB6A19CB28458409, 0x1A332CE9A0EA6999, 0x7747C3455ACCE86C, 0xC16BCACF81C403D4, 0x80154F364023B53B, 0x483A85A69257A5DC,
+					0x240B11D145F2B024, 0xD1B4AF8E8037378B, 0x10B73B2594547344, 0xD717C07A61D0CF35, 0x11CEBA32807D2413, 0x9FD57A8F1F40B444, 0xA4D6346B75611362, 0x16E4C6D91D678FBD,
+					0x9BFC48C0E8CB3C4A, 0x5558A4AC6E73D38C, 0x2098776C59FB5CBA, 0x4264820BCBBAC570, 0x24FA10D3B6E38971, 0xC4C1A850C1D32857, 0xD1D7847CB1915FD3, 0xBA679FED36B807B6,
+					0x659F3E0AC61BE002, 0x4D5D07385B8B9976, 0x38AB22B77B16A535, 0x1AFF33C81394E05B, 0x2B0F5FC252F50E7B, 0x0F87F14C25986D5A, 0x7E5BD4479E536886, 0x8F914305BAEE9E12,
+					0x0209FF593C3C3BB0, 0x6AD57FCE88FDA123, 0x992C04FC39B70870, 0x4A5519006F256415, 0x821F1AE77FBC87F2, 0x0F8F6B64ACAD1368, 0xDE68807E52FEE203, 0xFE4B7B4C02CBDA75,
+					0x218CC8B0FABADE91, 0x40B8B32B2C752737, 0x143DDC069268F78A, 0xBD898034C64F0091, 0xB69A33A70C344FC7, 0x4FE5565DD7BA6B66, 0xC4AFF3F18BDF5C0F, 0x62161D03D9C8CEE1,
+					0x5D207952DA29F21A, 0x50817773E18AE1B0, 0xDFAB7B72B669738A, 0x107AA39371CBC796, 0xC0841D9EB594BEE2, 0x64E8637F6ADCD156, 0x466CD09B57C2F888, 0xDA0A0C63891796AA,
+					0xB1ED4DE4F766C14D, 0x356C3A400EE09316, 0x2C3EAE0ADE718632, 0x9C8D0EECF3DF88A4, 0xCAFF33172778EBA6, 0x516B48996F6EDC64, 0x26AC0955F7E824EA, 0x53708E65D5F7F7DC,
+					0x093D78A318EDC7A1, 0x69B891F18848193D, 0x7EF12B0FB62505EA, 0x8D211E672B5171AB, 0x17CB8355DA809DD6, 0x79A80338146B7C91, 0xD0188ABC4D9F9998, 0x169D95CBA2AEF0C0,
+					0x52F041A30D8182D6, 0xC8E6BDA843239161, 0xDE5731ADC89D7BF9, 0xBEF4205A8BD44D07, 0x0DB33059654A5249, 0x73604370CB196945, 0xB8173E0D3D56B5C9, 0xFAC85301C4F35F80,
+					0x523717E8FE62A1F2, 0x79D2C43B1B3818D6, 0xABB3842D75B8FA63, 0xB7EB492E530AD145, 0x0C549B669CE19225, 0x383A82AA95D7D7C9, 0x238C47E8F358E831, 0x96EF68C220407E78,
+					0x9AB95DB2E069319C, 0x2A39E0AFB20CC4A8, 0x1E64CE22D13B7421, 0xF9421C8F685ABB3A, 0x5E4FB42BA93C5C08, 0xF6F3EEB1459E69C8, 0x400F035BD781E4C9, 0xBD48EB02FAB6E6ED,
+					0xEC18206F33F63B17, 0x06F8A6444EE4EFB2, 0xE4741B3AF8A9B0FA, 0x54909C353E886BE0, 0xA00171D806000E3F, 0x822BD6F61CE8E309, 0x72D10B8ACC7D8A13, 0x34C19FBDF85984A8,
+					0x7BC620D6601D3AA7, 0xDF6D27EC03BC7493, 0xF97C8A5ABB0DC4CA, 0x418B821E6B86DC60, 0x5078BA28756D357D, 0xDD3DE95059F15A67, 0x2ABA018AE86B798E, 0xFF09B8942A3B9A82,
+					0xC7FF756CCA4D3115, 0x05FEDD47C28CE63B, 0xD4EF1AB1252D0FFD, 0x83894F3A10C3C51D, 0x85C76AFF9BEA065F, 0xFDD33FEE9DA24479, 0x5E78ADBF8DC680AB, 0xD0F1C981127B8D0F,
+					0x305E4B8080CEEE4E, 0x22DA66897EE1CD48, 0x4F36039F5BDAAC8C, 0xAC55DC8F4FBDC6F1, 0xD1E28FBF0ABDE6EA, 0xDB355EC983AA81B0, 0x13749B6A9BAA5B79, 0x4683019EB4EF28E0,
+					0xCC9B496E8A22E96C, 0x3E21C6C1D69E9324, 0xAC68645FEBBC557F, 0xF30777D7173DCCAD, 0xFEB0A45C4AC88E78, 0x5E6DF1CCCAA24EFD, 0xE2425DBF2E991E1A, 0x6E8D8EA25CE6205B,
+					0x8027D9FD98B38887, 0x6EEEE4BCFB67A24A, 0xA722CAF64ED47B0B, 0xAE0DFE587CCC7749, 0xBEB504BA1BF92216, 0x5F1DC50BC2E3B72B, 0x8F7894D387D76B0D, 0xBACC923B9E60B1E5,
+					0x1BA6A2C6E0CA6306, 0xBBDFFE8FC9F9C2A3, 0xFE812F37FB20C278, 0x2D75FC06A55D8827, 0x16217050F4662CA9, 0x731A58673B7A45E0, 0x8B03184AACD0592B, 0xD9EE3289FEA98B5D,
+					0x097082B36AF8DD6B, 0x4D1E0BE248AB0B5E, 0xA6351B1FBC970674, 0x4A819B774528AF95, 0xAE67AF9DD6BF203B, 0xA3E62F98CBC01F6A, 0xA9C3C28395C6B0EE, 0xE3D26A989DC58387,
+					0x7AB78F421CD8DF03, 0x79592EDD3D1E8963, 0x06B7120E630BA543, 0xF7AC819C8B8F3A3B, 0xD41444833D2F07A7, 0x345BD3ABF2AD0DFB, 0x992123A23237146D, 0xD2C2452EAA63D202,
+					0xE99A25588AE96F95, 0x48A8882697F454BF, 0xFA0DEECED37BBE97, 0x2FC51BD785786F3B, 0x0B6A5AEB78EA65F0, 0x7DFAB68DE8F33377, 0x480E3ACECD72FBF4, 0x9E8F5FBDFD4107B3,
+					0xEB24F116D386AC9D, 0x698DDE0C6C8352DE, 0x24EA9E60A7CB3148, 0xBF2DE0D5B0CE2AC7, 0xB4492637153BF469, 0x4161C4E90D6DC8E0, 0x85866300446F7084, 0xD026CCC936386044,
+					0xFD5847B3E7831B22, 0x83BA1A31A6392DDE, 0x16938E1DEA52FA37, 0x0EDD1713AE62EFF1, 0x3BD68131C69A8D4F, 0xAE973B223C18029E, 0x0458EE17AD535E91, 0xA3223BBCBEFFA45E,
+					0xACE24B153F7DE991, 0xBDD3F25DCC41FB84, 0x58C2E40A29124C2A, 0xF4DD154B0C78A729, 0xEA092CC9BF7170D8, 0xF28898D3B771C2E9, 0xF3E52E612EF9C6A2, 0xAD9392BD705697FF,
+					0x0FB99006780A4B89, 0x6BB4778129644938, 0x896CAC0A49C35A34, 0xA3C2C5A38DFF5141, 0xA81FBF54259955EB, 0xF4D70E9E5D2D8201, 0x077673616FAA41E4, 0x99189AB58F7CC282,
+					0x7BA25C261AAE3930, 0xC46EDFF3A1D4F999, 0xEEE81809C8397681, 0x3A5889E64F3F69E7, 0xA38CC7699E767992, 0x40925C08B8791726, 0x6041EB821C025E7E, 0xA98B9F5726B325C6,
+					0x2EC9D48BAF68947B, 0x91C3DBACB516C145, 0x51B5CAC29B79902C, 0x13C79F0BB557AD84, 0x76C79F29C94A1A00, 0x7F49ACF52C85EA3F, 0x85C74B7F2F2A7F5D, 0x9CB2C1BE9043F93D,
+					0xF49D0FB35334744D, 0x396D9183A4847B29, 0x7B2222CBB30CA82D, 0x4D2F1E7A64531ABF, 0x5D1A430F4CD2A179, 0x0BC2E54ECDE751F3, 0x8DC329B815E9300C, 0xDB5A820211546096,
+					0xEA9A3F5AF683738C, 0xD5408BED08F41306, 0xDB95A93A87E9E00E, 0xC9C23827DAA8AA34, 0xA1F99EC5F819E74C, 0x3C56EA4D329E84C2, 0x7CCBF1EB33CDCD9F, 0xCDEB655E4BBC746F,
+					0x6FC95FCD31060D8D, 0x0254A0334475D89D, 0xEB6F677E9699FDE7, 0xD640134300690B8E, 0xA20EA4F6A8FD2D8E, 0x35C02F1C31174678, 0xFA422026C2898DFF, 0x2A294B2853C69E4A,
+					0xD5198F9BE96B6B9D, 0xA867F0DF13A2CFD5, 0x3A35812D4FD03580, 0x7F9BE88D63829DA2, 0xBA0BED7EA9662EE5, 0xAC787E9223D5F865, 0x81BB0BE704C58809, 0x14BD49E451AD5488,
+					0x80C2BE85F7353865, 0x508AF31981C0A94D, 0xB4C7C0E245222A51, 0x851045383E989286, 0x3AD293BB642096BE, 0xC6A3B5847C49C3B6, 0x5AEB240D72542FE4, 0x9970279B17BFA1EC,
+					0x40C6BFE042901548, 0x13A7A7B34FB2BB9E, 0x6D6DCEF85B435A69, 0x34471615FB805805, 0xBF11ECABBDCA886C, 0x91C0E77AE588DD1A, 0x8560C380B48B8286, 0xF2FFA61937F1340B,
+					0x8809AE3F3F4608F0, 0x30D20EC3898E98B4, 0x070559E40600BADE, 0xE1BB6D32A244BBA8, 0x1CB35E5366211354, 0x672A8BC386204D40, 0x0B34B8480DCB5429, 0xEAD3E919A22F94CD,
+					0x5F730D1278DD82A8, 0x7E1B18E6E386052A, 0x6FD95C44AC616BC7, 0xF3C92EEAB1E11544, 0xD3645E6BE6F07014, 0x5AB2C144308121C3, 0xA780FEFEA7DA0CB5, 0xAC14BFAF7F9FEB61,
+					0xF24D98F2D24E5FC6, 0x3D32FFE08F10DC09, 0x25ACCE909B65117F, 0xD66EAB4F988EAF06, 0x2F8BD59E130E863B, 0xC5B8AB19EB6ED59D, 0x76F9044DD4EFF255, 0xB735CB27CAE422DC,
+					0xE6B6AAC9E32509CB, 0xA73422CE7204E589, 0xB3A79D8D68E4AB28, 0x77257C5D33E6D137, 0x8EC1620B46436DE4, 0x8B4402467C94B66E, 0x8ACC03099E2DAE77, 0xCE0F9CF73B21879B,
+					0x0C2F56D46BAD39F2, 0x5CC8A726AFD572F4, 0x7EA370C379FF6B3C, 0x879A06176E49798B, 0x982A7E316FDD8FF6, 0xE50C831AB42E31F6, 0x61E49A9E1399BC51, 0x22530603C61F6FB7,
+					0x3FB7C4022C32E4C5, 0x3A41256AFAB0BC11, 0xD2AE5D961980A31C, 0x6D081D02A4126CB1, 0xB8CFB64073C1EC73, 0x9BE255BAA44270E9, 0x0DC367C3B3F8A4B7, 0x394DB5BF7922AA00,
+					0x7D58BED81F67B045, 0xFB4E1886ED140534, 0x90EA978C819B5731, 0x251BD8EE6A27A529, 0x62B8EA68A8B77475, 0x0F7B564DC8317BC7, 0x476E1A9D414D662D, 0xF9E5086F4D90122D,
+					0xFFED8F4F3D2DA1BF, 0x0964910F199ED35F, 0xF1E3D85EEE40E2EF, 0x91807134D01D580A, 0xE558AF3D5766CC50, 0x3A9570446AE16F35, 0x8F59D89711FFE3AA, 0x6615FEE93C6B038D,
+					0x353DE6DC27A022BF, 0xE59AAAB774431362, 0x268487EB2C660821, 0x0AC94E2531C26927, 0xEA74AAB666E2C122, 0xA807456518F87386, 0x454E1ACAEC235562, 0x138116C89BB41539,
+					0x505045C27AD1FD04, 0x7602869064CB4E58, 0x3713CA5B2A9A875F, 0x35AD26A53FF03472, 0x7812ECB4B5922752, 0xE649D6FAB2886A33, 0x073A8EEAA9A05A62, 0x2BF0B2A52E91687B,
+					0x17C1113C16DC29C2, 0x5A11B6329661EAEB, 0xC1B522C2ED8A21AB, 0xB1B10016B503D0DE, 0x6B7BF6805D522AEC, 0x291FD42E9ACD5009, 0x92A1CF2E9B73AFC6, 0x673C437F76A81A53,
+					0x2444C7C1DED2BB7A, 0x26DA614F3D56FF0B, 0x57A675F51AF313A8, 0x09832CDE261551FE, 0x88DDDB164883A36D, 0xE4954586FDF20B4E, 0x1BBE36E6A7F0A14D, 0xB58C543DE5BAA854,
+					0x3F629E235B22A600, 0xDB54276E82D7F20B, 0x18DF72248B20229E, 0x1493CFD1108B653D, 0x025FD494F8F72CB2, 0xF918B7C435A2B172, 0xD658D4175DB39581, 0x7ADBD1020533BC10,
+					0x59C8B6D45F8CFB48, 0x2D97FC02FB08B046, 0xC4699B25F1DD5A03, 0xF37F8ACC65478765, 0xC842E6FB1D682F0F, 0xC9F7949E132E4132, 0x56CE88E271005209, 0x08D55F0AD32EA531,
+					0x6FD1092678C20578, 0x2D259A8C3E1EF21F, 0x0E4837656AC95628, 0xB96121167A90E4CD, 0x4354F61078FC1169, 0x43F91C11F685B6EE, 0xBA4BEC269321C86C, 0xEEE0EA7FD01F4AF9,
+					0xD0B6EEA75B115479, 0xF92DA23FB15B0011, 0xE7C9C3769A0B185D, 0xE93B6869D5EFE767, 0x9D44307772BB740E, 0x4F88F0E88294BF5C, 0xEA3161633199C7BD, 0xCEC672C9E4E7A598,
+					0xD41F3B2F4AE012FA, 0x02DAE77F93EE9A84, 0x0BCAB28AB0B61194, 0x64E818EC942A1DCA, 0xF00E8B72D01B483B, 0x89A733B799AF52A3, 0xC32CE55F02BC2466, 0x3F8A4799E70E2D91,
+					0xA9C89C5E71BC3D62, 0xBC339239337A4FA3, 0x7561168DDCA212C5, 0x71FAE6F979ED9E23, 0x667F1FA9C41BF22E, 0x0D4D5E79D5976CB7, 0xBED19F5F54E684AC, 0x0FF9DBC7D16ABA7F,
+					0x89CE64385F17C995, 0x8437E26FC196D52E, 0x387D3D5771476762, 0xDE874E956A51CBC0, 0x570FCFAA044FF735, 0xB914488FDE0C8A17, 0x4546013848E6DFEA, 0xBE19E9BEE5EEB41D,
+					0x261E3E26DC6D01E1, 0xB17A1392A68A87F0, 0x915B26C141EF7F0F, 0x0483C70621F7C927, 0x7062FCF5618DCB74, 0xB86157B7A264CDF6, 0x63E4E786C2F320D7, 0x6EEAE4C4B5B796BA,
+					0x31FC85FC998F0DBB, 0xFBCB6DD0EC42EAF1, 0x22AD9F428DDACF65, 0x8C91F13F6CC40D00, 0x7969CD722D5D2ADD, 0xF213B3CD0A2E9080, 0xF94BD4156523155E, 0x79739C03F6DAE7C7,
+					0x5C5A563582B0F11A, 0xD3A8755187E4471C, 0x446958734AA27DF1, 0xA523AE55CB5402C0, 0x7C2AAB4ED56236E2, 0xA5B4DF6B60B1489A, 0xC47639D4D665CFC5, 0xE3C35943D01E5BAE,
+					0x1CDD50D7DA8B9DA7, 0xFC46FF574B99610B, 0x8C43DC75EC2278F5, 0x796D8E0C19841463, 0xFC1177767EE14BEE, 0xE07689CE5703FA01, 0xB28C7D98A8783FE0, 0xE9C56151D3E3FBA3,
+					0x52606B177F27FFDE, 0x797BB43CF8E8C325, 0x8BC697EF35663AB3, 0x5DA79905F7735634, 0x3A053E6B4F31CFA5, 0x7AEB17EF768F194E, 0x46E1AE953BACE8F0, 0x3B5748D05323F37C,
+					0xB15046C28B4D8D44, 0x840660EF18E79851, 0x1CFB16330D0279F4, 0x6B425F32173D1682, 0x917E45EA750DA3E7, 0x3A2C54CA80C46812, 0x12BBDB6B72E65210, 0x9FB74792BE22D0AD,
+					0x9AC165A51FF12CA7, 0x9E44DC11CB28428E, 0xDBD09D6021F78161, 0x4655A94E541549CF, 0xE9FF1CAD1396C590, 0x7F1A003CBD5EA8C1, 0x58C8D35C31828E69, 0x2CE4ADCEAD4AAA6E,
+					0x412CDF54CE6B1E9E, 0x60D4B93FD4DBC199, 0xDBF8D857CAEB5292, 0x98D693D2D09BA9D3, 0x2EF3B75516F936E9, 0xAFC78969FFFBC40C, 0xB8C0A40DFE36D28E, 0xEABB78FB58E49CB8,
+					0x3AADBB4D4609398F, 0xC16225C07C97B642, 0x41113A107F4F6617, 0x5A9EDA483AC779AE, 0xA14A4DE0B09AE3C1, 0x72363EA8A0E4DE26, 0xC78B2EB48DD24C55, 0xA6B44F93A1865841,
+					0x5ECA02978EE649FB, 0x772107D653C1D904, 0x3E8D5CBCBDEB2979, 0x0D9E55307477F185, 0xAEF6D8C22BAE4C1B, 0x3B0C6D47BD463313, 0x8D7DE1441AD35DCC, 0x701EF2C14A7C16A8,
+					0x9387BA4495BA5B7B, 0xA36E04C961B55491, 0x1C7E4A99BC853A41, 0xD0A179A2E40A3A5C, 0x114776A2304C032F, 0xBB2B4A07BDC0E924, 0x67F4F51D132A48BD, 0xFE5FA58A7D4F888A,
+					0xAAB95823A561468D, 0x85C8FE2A7CFDE403, 0x0385928D09D0E7FB, 0x7BBD04EB1B72F3B8, 0xDD6251725A31591D, 0x3C2B01AA02B2CACE, 0x46309A6B508FEE4E, 0xAC721B1B197A213D,
+					0x1B9CD9B0B5FB6A38, 0x2A6031233A1F7593, 0x39E7E10D20AC7F4D, 0x9E811362E7CDB38F, 0x22B8F19E6D78B8F1, 0x67746ABEFB047DD8, 0x2F324DD1CBFE0BC2, 0x192D3A31F01ECAD0,
+					0xAE01CA6768DFC4A1, 0x14024A8EDD95894E, 0x8B8097F9579C3715, 0x94275E950BF8D0D3, 0xB74FA4F6114682EC, 0xCF8384EEC35B9863, 0xEEF1EAB97B822BF4, 0x1B1D368F3A43F6A8,
+					0x3D196716D67F3B64, 0x2332089D23223184, 0x49240DB7A34117D8, 0x2AB588CB2AB713BD, 0xF485EF04E590FB55, 0xDDC2C0A54B851876, 0xD5BB582AEFEFFB19, 0xBFA7B776B06769DC,
+					0x1D01CE603E27745D, 0xAD3F4EF5222478CD, 0x6560B1BDEC8E0AF5, 0xD4E5ADA0B436B4BD, 0xD5D9C6E637186CFC, 0xE9313F8DA4A5175D, 0xEE7754DCFB143E88, 0xD9622937DD003160,
+					0xDCCBE1EDAAEBC218, 0xB2C4402A5ECB0AF9, 0x8D9F447BD987EA06, 0x6A88C0C2A59664C5, 0x60F7FA9A8F813958, 0xE78DFEA976293351, 0xC40E07498BCBF284, 0x96CC2E307B522332,
+					0xCF21EAEFF555C14C, 0x4EB2C05A38F8E6EE, 0xC13C8367AECA53F2, 0x4825B6392319FFD1, 0x1D9B485C2FDEBED5, 0x5ED9DEF693CE6C00, 0xC6E61DC736DA9B7C, 0xEDFEDE07E0A29D6D,
+					0x334E9F24E587E4CA, 0x06E88FD337B17795, 0x5CAF2E9DC46FDD10, 0x54191AB225E2468B, 0xCA5A2A3F47484B16, 0x2F73CB702780C039, 0x2452BDA84CAC9856, 0x29B15D7013C45F47,
+					0xA7A0B9B13A86FD1F, 0x399CF504F623CF64, 0xB38C425ACD096ABC, 0xD640374008FD8F6B, 0x603D1096B2E1007C, 0xD792C505A5C6E056, 0xBA9B4C753AF11622, 0x48105B2758F81896,
+					0xB5F80444DB43742D, 0x46748C44A39A1A3C, 0xD1B76BA97932744C, 0xE33891FD4C4AC598, 0x0AA6BE547C83ABD4, 0x48EE3573C7D6ABCE, 0xD438EA4AD9B3EA0F, 0xDEDA4D144C0D9688,
+					0x804EA6FBFBA5EE66, 0xED465B1773FBF8A5, 0x967E06E28D7B2FB4, 0xE2F99789C4DED35C, 0xC42B8A01BE1716DA, 0xDA1B005DCF41B693, 0xEF4EAF5503EC6B06, 0x8EB80052E9672653,
+					0xDEA5FACDC8192EAC, 0xB3DEB17BB15FE8AA, 0x5B102AAE4B9E3B2E, 0x6D69ED7435098E5F, 0xC317DBBC3B293B3F, 0xEF80C3C6C5173BDD, 0xC7763A306598F48B, 0x7F05A1C1A4567393,
+					0x78295633CEEF480F, 0x4F22FBEFD90D21F3, 0x9215213477405943, 0xFE054067BCB3DFBE, 0x4B4622B843DEC550, 0xE054B5CFBC953804, 0x00A2867A7C281748, 0xEF78CB4D72BC851F,
+					0xF2E6DD0461F95B31, 0xE648221E7E517F86, 0x02B7BC76D91FCD50, 0x56A9C7485061A9CA, 0xB9250316350FBBE7, 0xC4B78E7F328537C9, 0xA731D642B36FCDDB, 0x09494CDE51219576,
+					0x956F2A550DD29686, 0xD87E36AACADACDBC, 0x343DD7CD932894B0, 0x47B0082FBBDCCE58, 0x9FBE2D8B02028035, 0x4C4DC607A0F3B138, 0xE381F2872CECCA47, 0xCED6BC5B17D192BC,
+					0xB4AD592717826676, 0x752980B2140CED1B, 0x3D9DE19F90FD9616, 0x37B2F8FCD3E9D1A4, 0x381F65F327A824C8, 0x4BD7BB234CCB5334, 0xB06361157DA0AA8C, 0xB0E8B3C4A1CB22A6,
+					0xFAA5F719679D0B17, 0x2699C7E818CB1B37, 0xE7854F80B3E41335, 0xDA92C6AC8CD1A18A, 0x5A51A7C772D244CC, 0x80A621BBF3E84EE6, 0x31C3BD20CCE7CB1F, 0x14082D6C7578B7F2,
+					0xDB24D6AE009C78B4, 0xF8D7EA2620E5E8B8, 0xC3A8C6DC10A5B8DA, 0x8B8D971B68E6E5C6, 0x5291BFE88D62EE9B, 0xF7EE0E060C32D128, 0xB468E4971D5196C3, 0xA74278D7007B551C,
+					0x883E976B0F17AA10, 0x228A6A41AA8E9EB2, 0x4F334580F56F4251, 0xD71D5DBC8982F3D2, 0xDDD07517AB2145CA, 0x796EDD31FB811801, 0x43A47EF19B9F1736, 0xF3DFAB8A5FA87384,
+					0x3921604590770E92, 0x31D9343AEDB74100, 0x49A1C61ED6775DC0, 0x1BB0699A1894C676, 0x2176B04DEBDE7D98, 0xF26F564D01DAFAF9, 0x70D3B66E7CD20EE2, 0xC825DC0F647B4C8B,
+					0x699DC2E2DE7FA3F5, 0xE5B4E17650151D3A, 0xB3EF6A569871B062, 0x7C49771794BA186E, 0x8CA9E8E8BABBE2AF, 0x8E120EA167BCE2B9, 0x384C730933FC47FF, 0x73682BE149792C8B,
+					0xEB76EC0B8A229B3E, 0x4F7B90FC53D3F52D, 0xB11E78C4A7C6DDCC, 0xA2A825B32212B1BD, 0x9F350233A1B35385, 0xDEF33284747D589E, 0x47CBD1B0AC2BA151, 0x771E845FF2E453AE,
+					0x6864883D4558E7C4, 0x7576971C1D645C28, 0x4B526F1A677C14FE, 0xDCE460BFE1FD8B6B, 0x39A67582517AE4FD, 0x088139B92BD41BAF, 0x7A532D735AE56CB5, 0x35A514D79817B0BF,
+					0x855533CAC34016E6, 0x65FF0517A07B8395, 0x353462990F8D0582, 0x94B7B84A35068013, 0x3CA142A271E5F2C3, 0x41759C5A9B2ACC47, 0xD6F4BFD61DA9E0B2, 0x9A214E94DFA50203,
+					0x3B25F79412033D84, 0xC7E2268CD0D6B08E, 0x4AAB8A76AF4AA1AC, 0x5D916FEC2A512CC7, 0xECCAB4B36F172E39, 0x4258C5BC53EDC5F6, 0x0D5400620CE2BC9C, 0xF24E89BC571C1C97,
+					0x79004F1565435ED4, 0x6966928A15DF2D92, 0x56152E8DFA01FF48, 0x4D64628994B71AF9, 0x79E63DA7FBC87671, 0x7A586A8E9C0ADE33, 0xA48DAA846BF6D73E, 0xF8FEF2931E8C3ABE,
+					0xFF4AABA453FB6E95, 0x4951A740BCD4C67F, 0x861EC9B95E09B036, 0x0447C691970A4CB6, 0x8149D71F14C4FD7A, 0x079BE054D368E8CC, 0x654A2FBE783BE2B0, 0x51B9481C91100EE9,
+					0x6F0FC72186AEF32C, 0x8459BEB88ACACA63, 0xB8C22EBEFB6EF1A7, 0xCA524E0C1EEB3093, 0xE6E5DA37856A6B19, 0x74627B3B0E187C90, 0x908504ACF1F2B733, 0x3661513459366CF7,
+					0xAA2FD37ABAD99AB0, 0x30D167B55E85CA1B, 0x05B584820FE779D5, 0x25F23E2489DBA4CF, 0x9C13D76C30E3E42F, 0x6542597A04F9E9D7, 0x299406481B4ED48F, 0x8410CAC74237D504,
+					0x8BA509CE27930B2D, 0xC55879C8A6EAEDA5, 0x6B9DC1C5ED9C8205, 0xBF1E9CCE7D9A7104, 0x7B4D037CF8DF7673, 0xC66A5A15342E081F, 0x94AA9527439D429C, 0x62BBCF261DF45E2B,
+					0xB1B7460C6B9677D0, 0x77E445456526DB9D, 0x4016C47B01C6653B, 0x0A004AE865A475BB, 0xE335F46440D3C845, 0xAF90A613ABA03F62, 0xF242A31A304ED466, 0x52017B413AB1DB24,
+					0x12D8043D6075C829, 0x625ED50FDEE76379, 0xC764C4F886D72B76, 0x54073619A5034C39, 0xEE1E7B2807AD2217, 0xD57EE5AA98930B72, 0xB5E4470AAA870A85, 0x5391837780324894,
+					0x0B2B11760AC221EF, 0xCDA7CA118B5690AA, 0x39648EAC9293367D, 0x97CE93171DD70F63, 0xBFE950E7E4B0D8F9, 0x41B250B38AB21C15, 0x18FD47BF590FC018, 0x0D5D871F775168F8,
+					0xDEA095F2E8CB7684, 0x897FDB02FCB332B3, 0x4D835B74B1799210, 0x1F1895D35FAB767A, 0x676389F629499E97, 0xEB0FB2118B6694EF, 0x262234B0B0941544, 0x86145DFDA4B2BB79,
+					0xE6A87F1ACB56D9FD, 0x832456B685774172, 0x98A0390E5816CC0F, 0x39303948A44DBEA4, 0x556EF9934A36CFD3, 0x4D9E6497C6710540, 0xC4715930D9EC356C, 0xD97256E223171CD9,
+					0xEDCD877425A9FC7B, 0x350D80E4C75D9FC1, 0xA6E6374E23BCD90F, 0x24AE3A3723EC3DF9, 0x6940B0DB288FA6B0, 0x9BE4C64C25B5884E, 0xDF23D6BF0009F613, 0xA00C50CFD77B8FC3,
+					0x18BC2D381FEA1C2A, 0x75248588DB5B8CC4, 0x87F3BD2A8767484C, 0x607ED207BCA6D181, 0x4379E83A7DC3846A, 0x83BEA62C1083BEA1, 0x2919AC7909C712C8, 0x0C4E33C44C60FB2D,
+					0x61FB12F3262EB48D, 0x4399619AECE81581, 0x3A810B3A1D228B6B, 0x003EEF8E137656CD, 0x5B9FFAE972908CE0, 0xE0DC215029C63030, 0x4789CF3392FD3488, 0x4301A89E57FD31E0,
+					0x8B7F02147CF89299, 0xCB2D0D2E256A8822, 0x1AF2958D2201FEB6, 0xADEF70CBD27B068D, 0x8B88C3F3F5727039, 0xE34F14F2C3E572B2, 0x3D6D610BC930AC79, 0xAF324CBF1CEEBC2F,
+					0x11BF0AF7D4A65839, 0xEAE25140047CC9A4, 0x1541171B6D80BC5D, 0xC6D7F2FA9141D486, 0xF644761BF5D1D679, 0x8EF8AA18EF77F37B, 0xAFD121E91032688B, 0x4B5752A85D4D7F38,
+					0xF3ADF461736C135F, 0xE8659C12368CAF43, 0xB299F7FBB1658080, 0x04A6D06FFC66490D, 0x9FDF4C86A7997F80, 0x09215A3011223524, 0xD55B6B94888D618B, 0xC0285DC64E2B4D37,
+					0xF7F088090228A712, 0xEDF215465339C1C1, 0x6DF0D656F77719B6, 0x6F3209EA6A243F96, 0xCFA1601EB30FA214, 0x09ECA285B8DAFBD7, 0x518EBFA9147B4D18, 0x425D45F5275EA466,
+					0x777ADFC0F320B1E3, 0xB473AF043ACBCE3B, 0xCD868212DFFA5AC5, 0x10572319AA026AD8, 0x9DF65C9CABEED2B0, 0x2F06FDA7A5EBF9E5, 0x547E5BF359D3A0CD, 0x2D54561420739569,
+					0xDB9C13B5A34C7550, 0x78916D78C4F802C9, 0xD0CE406A51DBB188, 0x6022E95934502584, 0x76C4B64AA693CE83, 0x5F4E08D057E6CF27, 0x4C536C3E90D74B35, 0xB86CFFD5EB3AD6F6,
+					0x9DF395EFF9ADA926, 0xDCFD156F24C0F03A, 0x22C0CA13A5918F71, 0x8CB08C8D5C81B310, 0x74EF3A4F96CCADF1, 0x03306B39726A13AE, 0xEDFBDC3A4F346612, 0x764C57930C30355C,
+					0x007F074FF4656787, 0x5F5F8BD71510D962, 0xCC232EC02E7EFAA8, 0x25BDEF9637F0BA42, 0x439F6B0A9E1E9A9E, 0xEE02684C6ABFBDC9, 0x194434DF949D09D8, 0xE7C1CE54CADAA842,
+					0xDA9113119480C9D6, 0xBE76AB0F49AE732D, 0x4714F261CA191835, 0xE7792CC45CC81F40, 0x5A2F3E3A2B35F4E5, 0x5A66B63ACB19D181, 0xAD64B1DCA5637A91, 0x5456E6F9BE7814E7,
+					0x9D234E3230105AC2, 0x906A293EE45527F2, 0x5BA4FACF2F6AAD35, 0x126011F11DED8207, 0x8A328AEF98B85D91, 0xC2ACBF2FBA6F45C2, 0xB01566BD6A50F5B4, 0x4412B9F559C13510,
+					0x8BE134509DE9ED2F, 0x6E36EDD2AC896DBB, 0xC68B9F5ECFB3DFE9, 0xF5B8C67FCFD2A50F, 0xF6184629A5128A4D, 0x2DB290186DC41F53, 0x503AE4A7EBD16EA6, 0x3B2B02221CFA4B1B,
+					0x508C9DFF1546535A, 0x0BD663F97BA61CCB, 0xB4F807058E61048E, 0x38D4881B22010923, 0x43F64B1F7985A76D, 0x265D73EA5F35AED1, 0x83231BCD9E18CCC0, 0xA29E8835653F1454,
+					0xAE34CA621AEA39A7, 0x78386A6C944FF2CA, 0x35704BD1DD0077E9, 0x199489B6A005BB57, 0x62AC9F9B346AE0E5, 0xC73F4DF253C8C2D2, 0x5193CCAC97FFB5CB, 0xEB6180E35CDFC259,
+					0x076D2B2F93E43046, 0xD51D93D71E738CDD, 0x47409C2BC6C03226, 0xD79268B88166E93C, 0x245D5AFD0A1422E9, 0xE7BDE8E9BA670780, 0x9CC28106788A095B, 0xE8980CE1BA593D99,
+					0x7AF6FD69C0383751, 0x305230AD5EEC9078, 0xC8D0C171E05BEB84, 0x082D6AA457B4F956, 0x71D7F8BE020EADBF, 0x28DEBAB337735421, 0x1D9A74E07214BC35, 0xFDBECEC2EC6CB8B3,
+					0x0CE74CE417067610, 0x152F7BCF1992A81D, 0x727B3247B5110778, 0xA8EE2052988D8E57, 0x3ED922AD312B8093, 0x4A7453D6BBC82D74, 0x7ED6F6ED355ACB4E, 0x04CBAB8B55EAE110,
+					0xA271DA5012D991CA, 0xA4095838D5DBB8B0, 0xD293B5CDB00396F2, 0xB18154D46D361C67, 0x236778BEEBD5FAF8, 0xC6562612503608C6, 0xDC0EE2F7AE7075DF, 0x7EC8F20480792CA9,
+					0x4EA8375C2856E7FE, 0xADA8C2741FB79A89, 0x026FF8DBE78A0D5D, 0xBDB85D9A3224558D, 0x0BDF0C929FBD38F0, 0x3A308D8C43F97675, 0xE7A00D5D56FBDAD6, 0xE250FC0A2FC0C145,
+					0xC76172A34DE5F380, 0x30E660A43D623460, 0x06B930AC6688459C, 0xF3C950E39E397C08, 0x86590BD55C4F26A0, 0x81446F86D3B5586C, 0x68FEC2A831AF6FEC, 0x42ADECB21E168044,
+					0x6D7604255773EB53, 0x1EC3612C0E633614, 0xD832E51511C3E5A5, 0x863306424FDC7787, 0x91F0A85DE22C6F18, 0x1205D8A207145C2F, 0x2570182488C81ABD, 0x1EDC70451BE7CCA6,
+					0xA5DB157D20E61538, 0xD6BA2FBBF9B0B685, 0xD5D88CA5D90E6833, 0xF132DD80915B97C1, 0xCDE66D25F68A751C, 0x9BD775BABF8A1A43, 0xABA5FF9E0008F83C, 0x16CDF7F30D535DB9,
+					0xFD4100BEC886DACB, 0xF6EA5308216E2445, 0x7E5BAF2EEBF1B20C, 0xE9ECDE89FCD9D12F, 0x34C11CBC52A5B9EB, 0xAE6EAD013FCC675D, 0x77CB00F9882E2092, 0xF1659FDF505210E9,
+					0xFC669D4FD5F69CAC, 0x50164138AF9DB290, 0x0C673480DFEA572D, 0x5A69D12E5F9BCD7A, 0x70922937A585B1DC, 0xBF3AAD9856D7FBFB, 0xF5F62239F20FDB13, 0x43E91635404730D1,
+					0xAA06F2AEB0B89F18, 0x14896C5875B475C5, 0xA9A8626BEC37EC53, 0x72E14F337CB640A8, 0xFA37E459D45D47D2, 0x9334368681DD972C, 0x442B9BEB64C0346F, 0x29017B589081F2D8,
+					0xE174CF92976DDBCC, 0xD31113D6ABF8275E, 0x636770D86F4411CB, 0x261D88877A92EA90, 0x11535AAE96AC57B4, 0x092C6786C70D4A56, 0xBC3DD55446CFAD44, 0x8D6DCE28CB2A2614,
+					0xF1D40B7E8AB0391C, 0x61AF5DB38540E837, 0x28EF9D937136763E, 0x14E0832EF9D8C857, 0xDE8D01479159F69D, 0x82C7C9DC63A4ACED, 0xBCD7C451C5626EAB, 0xB83D56F44D0C66C8,
+					0x177381EC561786CA, 0x3A7B1F42C331154C, 0xA13199331E8A13E8, 0xEBADB84939A3932B, 0x227C7830A9F7BF82, 0x6A75C9C6E60F2935, 0x1C3D84F664903111, 0xD855744FB9113BCE,
+					0xE96A0A34324597F5, 0xAE811A77A1505DD7, 0x99C78ED5E7FB234A, 0x7E4DE07065A0293E, 0x38A7B041F28B87C1, 0x3FC59A5C2693E575, 0x85C8F889EA0F00DC, 0x713BDBC64AA5FCB3,
+					0x0B3EB0AE26E19963, 0x820F9D39645656B2, 0x8E5E06E850F0F7F9, 0xC7ABCEAC68FC362B, 0xDA088C6E7F787B27, 0xCD0C3DD9AF730C8D, 0x0F1C575696352E58, 0xA0905C33294979E4,
+					0x9E46E2B2D43DE3A5, 0xF7140034C129FA71, 0xDC0AED08987CD170, 0xFF94B96B684BA93D, 0xE39F461AAC938D68, 0xFC5E8594A9131036, 0xCD70ECC0E1755674, 0x2A3D2C322860D00A,
+					0xF270F0C5F40E5A12, 0xD6A018494A16F8B1, 0x328E1BB8A799A0E2, 0x83C72112CBADFC3F, 0x8A769675E8E2CE13, 0xC7278D0CF0523A9C, 0xB7A8E80ADF004947, 0x217C50D9C54C655E,
+					0x55DC25DF673BEC7F, 0x8AFF0374A09F3489, 0x9A3E51B8ABCC3D62, 0xEA4B47C2E0E8B6D8, 0x0B492AB678392BED, 0x95B23A0D4067DCBC, 0x53360AD68FCA7FAE, 0xE9D1FE98F476B7BB,
+					0x601C6E6794FD92A8, 0x2C020BBD42C2D7A6, 0x56D0173C51E213AE, 0x55BD1C937C93BCFF, 0x67027D2DE4573D62, 0xF3FB1BD0E9D7E71F, 0xBA53C025347097F9, 0x8582F6DFB1A6C0BF,
+					0x45A64CC5BAE79A91, 0x982F4BEAF7D7C806, 0xDD9254599FB15693, 0x6D9B93400F50D1ED, 0x60F6D7AE1ACA1ED1, 0x258C9072AC1A1E2B, 0xB0301D857A719F93, 0xD1B250A950C660EC,
+					0xE6DAC3D45017F156, 0x5CB8386FD6C25C56, 0x97885C7C151E4F8D, 0xCF3EC6778BBA504D, 0xCA952D8352E5800E, 0xB60E4C97606706EC, 0x1F39D44438021018, 0x706E3321F151B8B7,
+					0x301EA3F24F470B95, 0xFD584577C3C662A0, 0xEBDAF6D21BFDCE9C, 0x35151FDD08C5E31C, 0x7B4A22943D6DBB53, 0xB9922DEC529E6E25, 0x253E528029C4B0A7, 0x5778194564B24FDA,
+					0x38B51E9107BABC3F, 0xD1BB04AD1C5F0366, 0xEC362B0435690C5F, 0x8002DCA2829243C3, 0xD7671AE5C7EF633E, 0x613C439EFD6BD486, 0x023F67273BC45B88, 0x174641290086F8A6,
+					0xAA14BFE1C5702639, 0x81D52444444D8607, 0x0D78C12B31F73D2A, 0x1FB41D88415F97DA, 0x5645059DCC186B61, 0x37A41D21BF6B63A6, 0xB07314CB6DBA6ABA, 0xC173F74C7A3EBB29,
+					0x377CE37D68A08C6A, 0x1395829390D0CE6A, 0x0CABA86545B7660F, 0xE111F39873763DC8, 0x04DC1E3E8C65388E, 0xFA88C59D12AE9AA3, 0xC912506796C43D84, 0xD1858B4514FF6781,
+					0x40067915C3858401, 0x17C0BB456501F607, 0x1390CDA689658C03, 0x85A28F41F3649618, 0xC433762B995EB7A8, 0xD34BB0A91F06F46B, 0xC7D24842A74EDEC0, 0xD6395BCBA25134A1,
+					0xB10C30B7933B50EC, 0xF3E9CFC6FDECE78E, 0x5C6F682FC829E081, 0x5373E06D4ADCC050, 0x084BFA7543B98BEC, 0x63A76E1D50937A9D, 0x69BCCD007259C22D, 0x885A05B5B2EEA888,
+					0xEA8ADB101D4A7E96, 0x9965AFDC41BBCB4B, 0x0B5F9BFA09E3A8CF, 0xDFAF6A927CC3EA84, 0x3F7DE7A20B0B1731, 0xB5B35E303965DAB7, 0x7D5011D43F2030AD, 0xE6A2A54136922077,
+					0xA487FD8E22566E8B, 0x43E93A8D96F8A9A6, 0x32AFB7443D564F93, 0xFD28366B70DF715A, 0xBEA459547F43E6C6, 0x3229FAB1A4D61CA8, 0xB9E79ED5AC82560F, 0xF5EAA5F4E79A7599,
+					0xF117968868B7F6A9, 0x6B17FDA8FB8F47BD, 0xB1EC11D7B69CE0FD, 0xFE5CEEE8904FD5C0, 0xFF41981C2B61B627, 0xAB01FF7CB284FE78, 0x461EC6C6DAB6E6EA, 0x5D9B07A55612B9DC,
+					0xD8262D16C5FD47CB, 0xA60D7F1DA284DED1, 0x28240E6CE08A3963, 0xDCC4A0DB2F0B78A4, 0xBD380A6E62B0B955, 0x0797494771D146A3, 0x2C97F64F0D218A49, 0xB81C73ED67B92F91,
+					0xD76FDD253AC62731, 0x9CB8DDEEC7AD5A1D, 0x81DC8CD7BC53E484, 0xA421FDBEC2CCEC2E, 0xB12429368B46C594, 0x7D0B4B2E51F2E7AB, 0x0198750A43231504, 0x026BC9D7271CE573,
+					0x1FF465C7CE8512E7, 0xBCC30C8E0EE1C6E2, 0x7AB6FBD1F791C7D0, 0xD1F8E80A08812191, 0xCB7940A2D0FA1555, 0x7CA79506A221E011, 0xFFFA00261D0BA414, 0xBC2E3963D09BCD54,
+					0x2B76A5DC84A12390, 0xF5D5698169FDF3E8, 0x298F82DFD3D4C08E, 0x774284A1E0BC3209, 0xCCF88AF0FFAFAD4A, 0xBB6236223280DC6D, 0x8CAE77CFBDFB1AD1, 0x0FEF3A4323450377,
+					0x6E84D7CAB71CED95, 0xD240F1E901083989, 0x82C7172A182CE67B, 0xFC67667BBDD4485C, 0xF7F1396F07F05B02, 0x250BE3428C15D7D6, 0x86A246CB08190125, 0x48EE484BF4929759,
+					0xCFF2B182C10C7343, 0xEEEA2B331B4D5C46, 0x0C756EC935E03115, 0x467EA65BAE26AF55, 0x8537DB9F827040A4, 0xFD1D56356DFAA6D0, 0xC9A58DE242C8A08F, 0x3E7BF357659D07D2,
+					0xE4F4F445CE8FA14D, 0xA32DEDB51D906395, 0x2AB1BEE5BB305BF8, 0x9329AD4F2CA62B6C, 0xFEA5AF6378242DB6, 0x3E640F96815CC3B0, 0xC784A4A72B49761E, 0x0D0F9B91B07F53C4,
+					0x0C3EF1805F897431, 0xADD20BDA3D8E42DD, 0xDC0B4D623FA85BC3, 0x48A07A7681B673B3, 0x39F42F17D9611FD3, 0x4C85EB6278B823A9, 0xA71E5FA467829095, 0xD923E88AF28F8102,
+					0x5AD548A83025372A, 0x0E987E89B8FB5E76, 0xDB4D61BCA16ED1BF, 0x4B879798F25EA252, 0x2FFF839A3DB08CA6, 0x0C468A8911E8E86D, 0x18773ED19238171E, 0x93B40DB084CF33D0,
+					0xF1B97FFB6A314F33, 0x4CE807DF37B87B93, 0x415C30D5B32A93DA, 0x9183FE5EA8F7C3D0, 0x0A1B636CF5DB134F, 0x41A1833C815B7C4F, 0xAF2CDC4B28053831, 0x33D5A474386300A6,
+					0xB1FADAA026D9F763, 0x42F176EF88459326, 0x487D66781677299B, 0xE1DA6483B41499F9, 0xAC86513B6BCEEB79, 0x83562641D3A9A784, 0xD1F9CC7585EE2CB6, 0xA2EC73F7CD1A84A6,
+					0xB3180A52582F4D56, 0x6B927ADE61AD59C4, 0x8B768A7096C97963, 0xECC62D51786EED88, 0x4D517BDE771D9E27, 0xCD1E5591124D6DD4, 0xF1DC02E9A0308297, 0x3F511A6A2DBF8957,
+					0xD757A31E6246E60C, 0x8874F8245BC46FA9, 0x7A37F20E842A1252, 0x18A713852DA0D4CB, 0x4D2AF32D86ACFEFF, 0xCCF029E0073AE1C3, 0x51842006689C9827, 0xE4A7C157FAE10D78,
+					0xD10E0F9CE00F6E7B, 0x7EA2D57FC555A2BB, 0x4B33390DABEAF667, 0x5E203F78148DEFB6, 0x149B37744FC7E78F, 0x7DCEB01433445047, 0x85FEEECCFC237104, 0x81516E017C5C3E7B,
+					0xD2CC9790A13C6341, 0x6D1F4F06582F60C2, 0xE832EE5083E6D008, 0x28B2F1C97B706B8A, 0xA12E9FB8A2BBAC26, 0x8A747E122422AFFB, 0xEB1380F679B35078, 0x8EA11264559B769B,
+					0xEED805B5DF2137C9, 0x5A9A01B4A98EF536, 0xB110E5149BECFF71, 0xBAF86EBCA948CE82, 0xB385723E93AAA204, 0x70532DCD49BC3650, 0xED0DE5F2F4BA36FB, 0x6B9544362B19316C,
+					0x55403DCB9C26419F, 0x508EA92770A32285, 0x13BD5B23DDB32088, 0x994688440500D390, 0x831285DFE7B132DF, 0x13F941AB2A104752, 0xBCB94F93D63B2556, 0x855C6F7BB273B4EC,
+					0xFA92890A39D4779D, 0xEF2B320376D28272, 0xA90FABABB807A33A, 0xD1892E351F7A3236, 0x4835E3747E4A0B74, 0xBB219DCCE71F5F91, 0xA308F8C35904F6A9, 0x208DBABEFEB008D0,
+					0xEF219767B1B59443, 0x6F1C689460571D43, 0xBDA3124717966562, 0x5AF32273A5BF576B, 0x8E559AEFC222BFFA, 0xB9C51468FEB4708E, 0xAB75BC03B748B807, 0x17171E4484F876D0,
+					0x7D99D69370C80835, 0xAFE51F7C22B53760, 0x11538F252F143341, 0x74B7E90DA3E76E9C, 0xE6220A5832DFB750, 0x3120ED78EF29AFC9, 0x1791CE50167C1B1E, 0x9BED771A913BBB23,
+					0xE6B2083D9AE9AA2E, 0x0B124720B78CB689, 0xF21F84C8B4511422, 0x7C03C01B300295A1, 0xDF67FF03672227A5, 0xE75C4708582BAAC6, 0xEE5F31739B66CCDD, 0x632A44E6E3D7F2EB,
+					0x9140324B9B0AF239, 0xE3D300A40B88D56B, 0x23018CF4CDF02020, 0xDD8692E913EB3FB6, 0x733B5548C98B1A08, 0xB57ED3A5753BADE5, 0xC0988AE21B03A959, 0xA493F22FF26B1E65,
+					0xFABA44D30FA2414D, 0xCD8783366575FF5D, 0xE011B18DAFC4618D, 0x361B968FD4F2AD4B, 0x0B4D7C7F5608E460, 0x3C503C4D143C8E4F, 0xF39808C67EF9866C, 0x35A417B5488B82FD,
+					0x12146AE7E565C426, 0x22C0BF264DAA6D92, 0x28E3990D2EC5171E, 0x42DD6897B9F5AED6, 0x96E24B71F2383FC3, 0x9831F776DD11AE5E, 0xCCB24EBB6B6C2792, 0xE46AD6E613204E71,
+					0x376E76405E58C768, 0x7764B34B2F7BBE49, 0x898A94494664F1D4, 0xB4654BAE9FA1214D, 0xF268ACBE107CE1F3, 0x02E84571D91343DA, 0x1A5D31C607FEE98A, 0xF26D69AC3C45A225,
+					0x3F4F974B7FDD455C, 0x104F3C91E42EC1C0, 0x4BDF00B0E6694264, 0x9A7CCB379C0BEFF1, 0xB89FAFD5DC132E66, 0x2ED6FFE6ACBA2330, 0x3F91DE8BC853AFDA, 0x9A894D1D6664DFF5,
+					0x0B4EE2195FC352B2, 0xEE0312D13751AD8F, 0x30DB69DDEE8E8273, 0x6034E5FB5DFDE30A, 0x9517B4F94C16DD49, 0xDEABD22739B80AF8, 0x735074021DFB41A5, 0x066645443D77DBCD,
+					0xB73430FC675EAFEC, 0x2C7A1D4B98C0E020, 0x2F5694541D74C56B, 0xA67DBD02B5DF0866, 0xEDCDBE9A2B583E18, 0x2F6DBC8DF45050ED, 0xC5DC83BB6551A8B7, 0x9D9B0C38DE53752E,
+					0x4185DD9AF6043EF1, 0xE5C5A580379CC1F2, 0x27274EDEABACB087, 0x8AA89434CC94A0AD, 0x85D8F6C6E42C5A57, 0x2C3ECD0D8250CBD3, 0x54E8C23C83D9301B, 0x06F2F71EF597D1F8,
+					0x2B79F8F2F7FCA93B, 0x0844A3F10FB92202, 0xB0671B7FA7BACB19, 0x8AEB83DECD827C80, 0x96747AAC4F2A7D29, 0x308E64730DEEFE94, 0xE7179838F54AA5C3, 0xA0960766D4C97C9C,
+					0xE06930DB807AC0E7, 0x553900915516AA97, 0x0F90BC9F0CF73866, 0xEDD5B93F60363DF3, 0xED69C0CAA7291F3B, 0xB3BDDB15FBE24A4D, 0x672EC69F27465FC2, 0x49D3582BE5D42098,
+					0xDCCE9F819C86CA4D, 0x0DF46B832ECBE775, 0x71C0C87983059F86, 0x5658622A5FB334E8, 0x7C2F214ABF9D0666, 0xD41A189F41351765, 0x82BDCB1F9A117446, 0xF7359D2AE58CFF93,
+					0xFFD894D5E16987EA, 0x7EED81EFF415352A, 0xAE46590119943226, 0x645E8506E97376DF, 0xC64347E5BCF7B4C8, 0x71943E124599A472, 0x1F6AEB57E9F9FE02, 0x7CCB5A85CDEB9E88,
+					0x3E269869ECC82C78, 0x37C0A1D77FA4F350, 0x37CC22CD392B1E59, 0x2A4788EFFA5C7785, 0x321CF8C4E959E727, 0xE186C050CDB0CBF7, 0x7C049D20BD66C9B6, 0xC165ED598FC1BF77,
+					0x570677A2C91105D9, 0xD0694D785EBB7C60, 0x2EC870C0BDDA8A0A, 0x10D742588B1A99C1, 0x45A34CCE2F7E08FB, 0x590750BA73EFEF96, 0x4F26FD40CCD7CAD2, 0xF02FA8C953547AE8,
+					0x6E30D9FE5F09DC5B, 0xC7614D4DADB8D27E, 0xC12A090DA0791EE5, 0x92285D8B60CB293C, 0x39901E9B596C9F07, 0x9948B9A6573A6572, 0x42E5A811C8E5EE81, 0xB785A69CAE6F8953,
+					0x9BAE9894A7995EC1, 0x6C1F2DF66C3BFCE2, 0x26D6D8F394E2629F, 0x695F75209BC53A3C, 0xF3D57A19319816A4, 0xE2AE2F3E4EB9B34F, 0x1260BE2FFA99C497, 0x4EA93CE606F4B1BA,
+					0x24C6CE4FF41FE6FD, 0x989C5E77B0266F51, 0x78157E6A727473D2, 0x4365287A9DDBC6C9, 0x4643FF60BA39312A, 0x1D76D4784A02A193, 0x47AFFC31D062C5B2, 0x80D8D076280A1B60,
+					0x93EA44CE2F14A4B3, 0xAB5D39F6CBA200ED, 0x3E29AD5D7EB6BF57, 0xE4C18751EE1C1432, 0x13846B9FED2D6AF6, 0x3CC7062CB657D143, 0x77D1C66833415B60, 0xC3D86CAA0D1B761F,
+					0xF40A5BFD80F8CC51, 0x279C4981DA2418DF, 0xA6C347271D31F183, 0x499C29D2C58A28FF, 0x2EF2B6CFE073268C, 0xFBC451009343DD78, 0x6703E02F2A5330F2, 0x114F75A148007879,
+					0x93A3F3D0F3CD75E3, 0x4F69A3726A65DA35, 0xB3101004DCD2A018, 0x90F235E3D64D467C, 0xF55E3662987A14D1, 0xD3C090CBF2356DD1, 0x9F583061B9A3B170, 0x46B08CFC60D84A33,
+					0x449A921DB0C0ABC9, 0xDC9EC3EB76614E3F, 0x078792A3A0F1F5FE, 0x7B1CD2A16CE659B5, 0xFD0EFC1E19395E46, 0xE98275931387E4A3, 0x9909A93C182DD5EC, 0xF93D017F15F54EAE,
+					0x6DF48DF4C5FFD20D, 0x48F00FA01E2B6471, 0x0CF391335F7BA84C, 0x38BE2C01E1D99CC8, 0x21D162A5699A94EF, 0xD350E14E72CA77D9, 0x6F196E11CE153557, 0xEA8B2AD73F9AB1A3,
+					0xA8708D751C72065B, 0x64D1C572E1A79195, 0x04C14642E810B332, 0x5D4F5BD6888E9F0A, 0x5B1D95C1EB4E87A7, 0x6813EE402DAC9C43, 0xB755E829AB13FEF3, 0xB2C3FC791A51D25D,
+					0x3FAFF287A088E1F6, 0xBA2FE2BB7A46CA87, 0x6F9C37EFB5860FD5, 0xADE985117B8DCBC1, 0x10EFBD33010F0681, 0x9745E4103198A081, 0xBBEF39FC7971B11E, 0x35F93DECD6CC1030,
+					0xB6224255DF2CFC3A, 0xDDFDBE556220EC51, 0x58E569E34102E1DB, 0xBB7E144CB1607738, 0x08D8750D00BE2836, 0x04540ABC35F23BA7, 0xCB7ED6BE9E60B681, 0xD56F85C56082174E,
+					0x1095B51647C1A875, 0x63FEED5083E6843B, 0x1D22785D94E7A607, 0x1DACC7666DD2CEFE, 0x3E76B5BEAB7458C7, 0x417065C2E2CE4B4E, 0xDC37DD98BCCC4F55, 0xB29C1C164BA3B30F,
+					0xE36F1F24EAAF86A5, 0xA2B356C829A8BBA7, 0x49D4AA32396EB42C, 0x7C6F76F62BAB3E6E, 0xF02FA5503F83D9AD, 0x211AD478759DE6FB, 0xD0D637F7031F1F96, 0xACFDC018DCCED4B2,
+					0x98CC176FFB84F52D, 0x5A65C9219522D19D, 0x290B12B47A822552, 0x3B306BD7911B124A, 0xBDE65B170B346A88, 0x06D0DDDE7B8532AC, 0x106F9D391A6EA48E, 0x28380D968E7FDCD6,
+					0xE282E36F777CBCDF, 0x9DA26334C54219EC, 0x129BB17BBCD69B64, 0x91679AB75F971911, 0xC2578C1372A6C76A, 0x05B192FDC32319B0, 0xA2D32FC0F9A5BF81, 0x9715438D7AEF6F8B,
+					0xA1EEFFD2D4341F8A, 0x30730C2D1D175746, 0x7BE55A5DE2DAF1D0, 0x483D38B03DA015BD, 0xF43353B5E811659C, 0x965722CEA15D3ED0, 0xDB3DFBF3D11B147D, 0xB710A3370D4DF14C,
+					0x451E6B11940871B4, 0x31ED541B896B98E1, 0x3234FC4DDF2F9757, 0xC4214A0BAE7DC8DB, 0xF7FA9FB06E86D9F5, 0xB367D9CB3464B468, 0x7EBC637AEECE4305, 0xFC431726B3F54E0E,
+					0xC2C581B0C8756619, 0x5D49E2D764BDF076, 0xABDCF8A4047B73F2, 0xF0A08A9C09508345, 0xE815269BDDAD5779, 0x67CAE1A678E73FDF, 0x397C63C3DC436A5C, 0xBD90990D0FFF74DF,
+					0xA886F83840BE65E8, 0x71ED38F326BE3D07, 0xDAAFC976D04DA1D4, 0xDA70DD352BD5C8CD, 0x028AC20BA60AF508, 0x247D80715A071F4F, 0xD23C0B5E4B122FB6, 0x84EE0F1DD8F9DAE3,
+					0xF8548B65517E72B4, 0x8B92865BC5384263, 0x63D3DF307779BB66, 0xFF34715BBC456EE9, 0x60AFA713068ABBD2, 0xF1ED93E3A3C9A512, 0x25936FA45E96C26D, 0x3084ED62B24F805F,
+					0x4B4E4DA920F88833, 0x3F7802D96857E295, 0xBAD9F12F4BB32014, 0x6E982B8CC5FEC259, 0x09115645CB5ECBD9, 0x53644227B6E576D9, 0xB1E8B51287B216D4, 0x387565B42CF1207C,
+					0x3D262C2A777B9C26, 0xC0ADFF5D2E2AC3FE, 0xF896DD5BF5876230, 0x6034E7591A892FB4, 0x2DCCC3480326BA4F, 0xBBA843F7B1160FCE, 0xC57827CF59CCDE68, 0xD3363FA4D463F0C2,
+					0x5323D4CC344528D7, 0xF2561AD3E2BD6C98, 0xF881CCE78B9F998A, 0x4E83C4ABDFBFA82A, 0x59964881C580E11D, 0xC2715EA9DBF961DA, 0xF5488E7B0131E0DB, 0xA46AEF7C92FAA435,
+					0x303512E470DA3F27, 0x9CA3EC53A7F0E974, 0x8F86814E97555451, 0xB2C510EBAAA45F82, 0x9532669C5476B8EB, 0xC8E767B265B79FB8, 0x7B3E28EC15ECB485, 0x78450DC9E68B5923,
+					0xFFC24272D295EB4A, 0x4383B9E2A8B545FF, 0x77CFFECF70954AA2, 0x218AF87434C5CC87, 0x8DBE04230DFEBBE9, 0x4F33848B1EBBB57A, 0x95FAE3E98FA6BBD5, 0x6994D3DE9BFC98B2,
+					0x1E25CAB103DFCF09, 0x17986052BED89F3B, 0x0C91C42CCC8B72FB, 0x04E8B99BE33D647F, 0x47DDF23155D38F05, 0x169EFA95B23A5EE4, 0x65B2C5504512D725, 0xB3D80F5AB0A2A113,
+					0x4C259082E641B8D9, 0xDD164843330C6B47, 0xE1166E9838BFAEA5, 0x756BB58F0554ED9D, 0x61E2A8F5E82AACE2, 0x6274AF7D6501A7AA, 0x99F2563CEBC9DE0D, 0x5EB24C748591C19C,
+					0xAD8BB480B043B2D7, 0x30F6027C8476A787, 0x7F0D3FCFAEBB6810, 0x6EA09C47DE75CFB6, 0x513630DC8C6F91E5, 0x67325C9DC83D5442, 0x4FCBC161FF96DDC3, 0x4AF3A0A87EF6FD15,
+					0xAC941000B4C0A7EA, 0xFF955FD9DE7FF1D5, 0xAF6D802EAB333711, 0x1A81D7CEEBCBAE43, 0x696A65C8630FED6E, 0x63C400BFA77192F4, 0xD3A5755FB362D845, 0x12EE0D3041F4FBD4,
+					0x115992A92DD9C98F, 0xCB6DB025D873422D, 0x792D6E956D2946BA, 0xFA636A5689B0875D, 0x2369A3A48F36F7CC, 0xCC2CB6592619131B, 0xC6D9525ADA73228E, 0x97FF0E2FF094EA20,
+					0x0E0FDE65C570AECE, 0x92A6A956B6AA77B4, 0x2252F768903330DD, 0xDEF53B76639A86DA, 0xF8110B6103CAF92E, 0x3E4CB56DD469CE9C, 0xDB2FE2E90909BF08, 0x978F360B2E2C15D9,
+					0x9373FF05EBC904D0, 0x5198E8049E726BFB, 0x0A64A0A9E6E36F38, 0x6BB77F9100A9CA7E, 0xA47D0838E0124610, 0x926483116694459D, 0x71012605AD8F5EBA, 0x9FB67F7D939C8EDA,
+					0x902DC2C8386DAC45, 0x69D0B62BB97156F5, 0x4619CB8BF13A05F3, 0x3C3A3F3AB1E4389D, 0x67311B479D075D52, 0x3FE71C8E58284FD8, 0x49DDB51723A86706, 0x3CAFBE7FEB7953F0,
+					0xC40E3F51A6EA8562, 0x41B880DFE14549AE, 0xB471ABFEADA9DCF9, 0xF905A79406F8ED16, 0x39FB7D8B1F82B747, 0xBDDABE4DF8CEA274, 0x1F21B6C90A2D80F2, 0xF26CDEEDBF52F25D,
+					0xD7FFD8592195F994, 0xC643C8E22A9D2277, 0xF20B990FECF14594, 0x311E79EC0457152A, 0x6730947ABE9C3DA1, 0x8FBF48EBCC08E118, 0xAC82F269376DA215, 0x2A17C03F6A72EDBA,
+					0xBA2C037B44FAF3C6, 0xA884850528B73D94, 0x319DB9FEF4DAE796, 0x6D178C3B7DECD027, 0xEF74F2D89EC49C31, 0x936FF65F71B5D071, 0xE7C1F1B5A3923D87, 0xC079FBD3A1716D4C,
+					0x9EEDF50D4349AA5B, 0x9CBD12426584EB55, 0xF84B63332A181C40, 0x7965EDB4866ED68D, 0xFAD3F960AA04C7B8, 0xB1B2B2350DD2AB04, 0x0D8C84A86C2C9A93, 0xF1C73F90398F58AE,
+					0x72EDC3403B137271, 0xFA870B27A6F1EDA8, 0x27968ACFC56741E0, 0x61A0F457CCFA367A, 0x17F00E7D20C0B0B7, 0xBB56650B98D9BD7D, 0x47E0AC1EDB15464C, 0x3DDCA56521333269,
+					0xC52B3EC693681D94, 0x44D178A2BE4B99BF, 0x384D0D8F11EDB0F4, 0x2D24B90C01411778, 0x3191DA107ED61C77, 0x5FB2F571D150AF56, 0x8FC2481235F96ABD, 0x30294C1A89FEFD88,
+					0x3BEF8735065723F5, 0xFBB3F926DAC0316E, 0x3F732289D0BBED6C, 0x48048AB52131F1CA, 0xDD7529E8583162E3, 0x31756CEEADD7100B, 0xF69DF4494E086184, 0x3DD2FF0AF6594326,
+					0xC27C43F63B470C9E, 0x7D10584021D94F2A, 0xEA885FE6126F5D27, 0x7A794F3135A841B7, 0x6102E2F0624B28A6, 0x659BE9A29A55F169, 0xC84D869CAFC1C389, 0x3E7239F3F3464FD5,
+					0xB6946F708354F5F0, 0x6A725AE574CB049E, 0xE1A2A1AE68591A33, 0xF6C67406B0C7BB22, 0xDC96094BC59261CD, 0x8125F1C13FE75A2A, 0xF6DEC6DAC068F76B, 0x48A5924725B0CA53,
+					0x4B5D9D19FBC5C159, 0xA7F00127B0CAC92D, 0xCC82A938504DB103, 0x28E1D3EC9B7323B0, 0xB738C04CCCD25D5F, 0x1B760A3F9C184ABE, 0x5461D5F8755069D0, 0x412C30E0BDA6A6B2,
+					0x1625D849D55DB496, 0xF649F2BBF6CC0220, 0x718D4C6B36189FF9, 0xFFF3276D29081A1B, 0x3C21FA72562908FE, 0x70143A88BA664204, 0x0BDA23B4618CA34C, 0x8E582DAC11CEF9C2,
+					0x6A5ABEDF80D554A5, 0x52E8E036C01D1274, 0x864048497BA7205F, 0x125E48DDD5C0D7D2, 0x069CA16CCA7BDA60, 0x06CDC7338D07C300, 0xA527D0811FFF5425, 0x379FE5D199EA5B9E,
+					0xF33D2D1241CEA910, 0x5EA1DA4ACE1892C0, 0x50632B55A3E4E7FF, 0x4DDD3D3AEE181799, 0x4A98857E0F9F0EB6, 0x50BEA6F0E334D830, 0x65F1754E0D337C76, 0x8D2A83D6B7D5713C,
+					0xF824BEC588BDF3F2, 0xCF2BC0399743E25D, 0x2511E65760EB16A6, 0x800A91088E0E04B2, 0xBBC6F2FC10CA00AF, 0x9700730A8F04BFC0, 0xE508B3C682D68AB5, 0xD0737DED7959B9D1,
+					0x1BBADC616A198F7F, 0x61DD7D564E6494C1, 0xB4D53FAE9C8FFDA7, 0x5AF1F445F5A3E8C2, 0xF5BEA5F409D44D3D, 0xA32F88CC9914D288, 0x19D5FECA9CF94C9C, 0x1CBFD24A37BDF7CB,
+					0x17808285B2F08B27, 0x5585401491CCFB1B, 0xAD6D39F5057F3D7F, 0xCEBF4A4551F63FAF, 0xD0BB7874F5C31CDF, 0x77D6B82E7B60B0E6, 0x1541C1EF50A33266, 0xB6196C67F5A387C8,
+					0x4EC6F36FE0ED72FD, 0xBCB6590EA538EBA4, 0x7A777C33087E7CEB, 0xCBAD44CBCE533B74, 0x9E5913B6BB95060F, 0x473632B723EDF22F, 0xB37DEA6EF6B09104, 0xB65BF76941052B58,
+					0x8B00C821215C10A8, 0x27AF7B8BF8BB6DF9, 0x3736DBA6F439B915, 0x51759D4B86D48D6B, 0x1D1D6C146D2B67DA, 0x3ED0E9510707AAA8, 0x8110CFA64B0AE089, 0x9BB5F31CC79E705C,
+					0xC009A4BBB94A1F02, 0xA7303B485C859314, 0xB88D11FCD8494071, 0xB661447AF25FE22B, 0x478C08F545151171, 0xB5335F446FD036B3, 0x7B5FA7FDA1463CE8, 0xF0AA52C43F2EC5BE,
+					0x35BAC1F23C1F103D, 0xD4476642010B2AE4, 0x516ACB56DDDF4897, 0x80ACD04164109CFF, 0xD97759D1C54A1484, 0x64F60E5AF87F2635, 0x30A781B582731515, 0x21B6E39EA624C88D,
+					0x943CF69673811DFE, 0x3247AB1D7535201F, 0x1ACF7F09B5DD57B1, 0x617B77A18B011C07, 0xEDB7BDB6B3E3B332, 0xAF2D87C424A5A341, 0x04B8E264C8DEDCB2, 0x3E6038F806BE3240,
+					0xED9C6553D624B797, 0x60827B0609059536, 0x0B3D0F2EC09299DB, 0x6EA8738621FBF59C, 0x20CA27D0AA2B0230, 0x2AE4355E6005879C, 0xEACD9F2ED6B6676A, 0x7C496AE0AB80CB5E,
+					0xA8EB02F415D25797, 0xDC7D8A144B99C8E2, 0x3C91ACACE87964E8, 0xF15E3B1AD68401E0, 0x4958694232E2FDDE, 0xE7508C7895216A44, 0x48D7DD1D15BE13A6, 0xB354EF432E6DC3BF,
+					0x30DFA062590F4AA8, 0x4521BDEA97EB3F87, 0x85DF2AD8937721B8, 0x574DC887498C0DE5, 0xBCEB68C91BF05BF4, 0xFC5686D490B08B04, 0xC8CCF41398D49BEC, 0xB55B2EB80E6A9995,
+					0xA5592874B659D6CF, 0x7B62222F6849679D, 0xAA70603CE757760B, 0xD7EBD1EB061549AB, 0x26049909520D1586, 0x521A4E3C94F2F429, 0x1B8C78977A8F56C3, 0xEE7A22BDEA8279EE,
+					0xD7DB79DF7C97560F, 0x33E84959357F2E85, 0xF1DB66FB089C79E7, 0xCBF27EA5EBC878CF, 0x1F96A36802227A5E, 0xE9F8E26692C60A70, 0x5ECE0FC8300AF723, 0x18C83C2C3E973171,
+					0x6CBFB43F414C3CB0, 0x96E390235DF3A67E, 0x8A774196C1D77C85, 0x845AE11ABB15045C, 0x7A5837148330353B, 0x06E6D4855A684822, 0x8DD4EF04CD4167F8, 0xA43937DE307360E1,
+					0x3AECA51EBA74A053, 0xC141421E19CF0E9B, 0xCC87CE041733E489, 0x3A176AACABBDA3A4, 0x750FB215A2F94D11, 0x559FDFFBA6F13168, 0xF8C2E5F6443CC2D6, 0xD348DF7FD8036DBC,
+					0x1ECECD7C6748A9C5, 0x2CD9723D5F6D7F0F, 0xB4F467C21BA863DC, 0x3CB806D428F7AE36, 0xCCECA75CC8737A5A, 0x73F77960D1813704, 0x4EF03BECE35E6C7E, 0x219BD8F963DBAFE4,
+					0x278B0E9D8BF5066B, 0xC8AE126DBC9B167A, 0x013C7A56F2E02EBA, 0xE4CB4CD4DDBA9CF4, 0x2A5B4DEBB2C1DE30, 0xCA4B6A0ACC820548, 0xB8C5171B39F005D9, 0x781341AF7B783078,
+					0xAD3C615FE632FBCB, 0x2FFB612D95084030, 0x3C2053496E66447C, 0x4D8E8553BD32E25C, 0x5E8266A59FF3FF98, 0x0211BE9938D0D409, 0xF278AE0CEEFB0863, 0x07AA048CEE4401B0,
+					0xEA164E8C2AABC3C4, 0xCF0CB815365841FD, 0xF6111AEDE12AB579, 0x37EF4282956A7015, 0x888F55B17F8B4B3F, 0xC8433090CA272231, 0xBBD77B786F2A61FB, 0x8A5267FEC086AC4B,
+					0xC97F06522300FCFE, 0x92C9ED3C3ABE2726, 0x2D278F56956F1C03, 0x3F18A6DEAAE9320E, 0x1E825BAB3D87BE27, 0xD5CF55C4D15E439D, 0xF2A350BEB959F51E, 0x2C5B536D6B826E79,
+					0xC004E61EA2482F76, 0x6E044AAC1EFA0433, 0x12D52AE8AB948D35, 0x4D3224E33EB06B23, 0x3CEF40325B653865, 0xACC0A5452B038FED, 0x115B85DF6391D1AA, 0x1EB0C3361EFF00B5,
+					0x445106B979ACB5FF, 0x4C6A5971556D7945, 0x7F159690D9E7D41F, 0x8353143B37D0A414, 0xE950D2C7869145A8, 0x8B6DD7ED7D518EA0, 0x76EF851EA800CBC5, 0xEAAEE39D0F9822B9,
+					0x1C1326B6EBEEF7EC, 0x01AD9DDB6328A899, 0xAF4AED5EA5193BBE, 0xD45AC6471E91B693, 0xCE9AB35B3F262CFE, 0xBDF1E8AB05D5611F, 0x9B6C49CABFEAEC18, 0x7D653B89946C4671,
+					0x617AE7E890F29B93, 0x4FB07AF69DE2A55A, 0xBBCEBD27AEA831B0, 0xBBB56F6F1E9F320F, 0x73101B461E9AB333, 0x0AACCD53034D4555, 0x3303FE955B8BB258, 0x9F0D80FB39B14684,
+					0xE234E68F358260CB, 0x7D38853CEA6E3569, 0x83D3DEF5E3073689, 0x9A942FAB3D561B8C, 0xEEB8C006C8353929, 0xEAF3DF0CEDF352EC, 0x42B4B170D2AADECB, 0x444B26848A09A8F7,
+					0xC22E796F16A0AE21, 0x0A986BFD148A2B26, 0xB2510E9415424687, 0xBB95C58CAD85A66D, 0x8F888EAFD650B76D, 0xE8C48BAA9C6AFD74, 0xE86B73F7383CA5AE, 0xE3192D8FC2BB65F5,
+					0xD29672E03DE97372, 0x93296165F6125C6E, 0x2269A08E4DB6D520, 0x056A1EB1B3227D69, 0x79E4870B464C6B69, 0x170B7191EDF411B7, 0x6DEC5573C8F5CCFF, 0xA0F83E99714A9098,
+					0x02F7E79BB8B159DE, 0x1FFC11D17492504E, 0xC7F737240A3D89D6, 0x401350BD8B614C85, 0xCB6874B234E6804C, 0x4C510EF450A00F29, 0xC678748BFB6ABFFE, 0x35D83E581FFF5D88,
+					0x0FB4AB335E5F6714, 0xD8347CF6DF1ACD7D, 0x55895C5E56374D7C, 0xF972469A6CD2F9AF, 0xC4A9BE4A5A44E458, 0x32BF858B3B2611C7, 0xE3AB69BFA77E5574, 0x73BD71193FC64880,
+					0x9C396CC6C4449372, 0x6786B5AB4024C246, 0x8FDA2DF0483B6AA2, 0xF9D5B67E68D2E176, 0xFF7176DEA85E4D95, 0x5CBA4EC105110B4E, 0x1C871BDA08914AFA, 0x2859C84FCE59D4AB,
+					0x2A4227D0098B5074, 0x09253F2F3D53660D, 0xC216C31F4E68F1AC, 0xB916F56F81C28935, 0xC18B03CF30E361F8, 0xB5001D23CE7B9D5C, 0x95FEE33CFC833B60, 0x08862660447B0926,
+					0xA628E1010E79D843, 0x3486F4F9B4EB774B, 0x67C42595D8690BEA, 0xB411870242921C1D, 0x114F7C5E43581E2F, 0x79107D77F5B8D255, 0x02EC4240A7C9F5C5, 0x658260CBD9809A4C,
+					0x07ED99CEB3EB1E5A, 0xFACF300827F0A68C, 0xEF42AA4791141DEE, 0x34A0E27A60BD9819, 0xB0040A548C813232, 0x5F104976D1A3C85F, 0x4B057D7381F51E57, 0x2DCEA97027630E84,
+					0x5F95EA3DC5A1D5B9, 0x40686A3A7D5DB05E, 0x5FD7BA7ECF166FA9, 0xBC98374BDB74BEAD, 0x79736C9057EAAE80, 0xE065BBBA4524AD11, 0x29437EF5440251C6, 0x757DC1E84F5F82F5,
+					0x2378D45F944827AB, 0x3594ACB43E66C62A, 0xC019D9E282ADC98C, 0x7DFA297D80A4E97D, 0x3BE4F4D46F47E948, 0x89B83036D63E0B87, 0x3D019B39F513EDCE, 0x990903063AB8A26C,
+					0xC2EA02E204FB8910, 0xB2914672F429C4AB, 0xD56918085EBFAE02, 0xE4E091DD7C082C69, 0x069B1FFCE8610A89, 0x248FC70A02328AA8, 0x73EA9649D5707E9B, 0x723169F426D88EB3,
+					0xDBD4F6EFF1488B35, 0x15CA17FFFDE876BA, 0xB5E7D823AABEFF1A, 0x7C4B2915583A19C9, 0xE0EB42FEC7203BF3, 0x3C908550512F48E3, 0x2CE7E45BDECFAADC, 0xB1FC101228F659C3,
+					0xA4D518E3BCA7F158, 0x53A1332D5EFC6656, 0x6758E2761102A78B, 0x9EFD1D5B2A46EEED, 0x8FF7B056648C7243, 0xF0FD59DB0901E1C6, 0x44967B5454FBE602, 0xA6C39BF962C26E61,
+					0x47B91DA52D2F1CB6, 0x7C2E56DBCDE93FEA, 0xAC1060185746C92B, 0xADC07A06915CE774, 0xD62865C3DEFD2AAD, 0xBE819C9CEE7E7E24, 0xEB1A960E2F0CCD7E, 0x3E965F39E096224A,
+					0x4E9453115BE9F1E0, 0x456935B87E0D770A, 0x9913BEE30BCC214D, 0xCB4E8B228F1B65F5, 0x86EB539C2A9619F5, 0x5D5CC6D2D8956569, 0x15350C1E644CF29F, 0x6F567DD89B489221,
+					0x2E43C30AF2176582, 0x9D6E35743384F53D, 0x2E1F93CBA68B8906, 0x9B7065BE3A242AC6, 0xB5CC1DA2E0FF661B, 0x53600BDC689A0841, 0xBAB38999A938D92C, 0x8D2366C14FA16D27,
+					0x1B655758910DEF3E, 0x39712F3EB8D6BBCC, 0xD21CE119E8EC57D1, 0x541E05ECEDD31F50, 0x7B6F48A97B020D43, 0xE06019B11B9C45C7, 0x02F90A51B8FDEF1F, 0x756434FD92010A00,
+					0x7F692459CCFF3330, 0x056ACB66DAB1C2CE, 0x3668F2B7AAF6FC4B, 0xDAD5F9D27ED7F8AB, 0xC09CA5EBEB5EEA1F, 0x63937ACDFC902ABA, 0xE6C6C1D7D6D396C4, 0x2C7F82E96D8ACADA,
+					0xFA6D91A1E48BBCF7, 0xBC48BED66DE61BF7, 0xDDCB12F8B5088C00, 0x1F1AE7969075A933, 0xF52AAF0CCA39B60B, 0x7C3FCA0F4ABACE5B, 0x310FC619D4930D28, 0x2D7693140209D741,
+					0x8B917365653E5C93, 0x174AEFE13781D9E1, 0xB74C396CF6BCD67D, 0x1D46C7B124FCE6DC, 0xD0D03CEBE34425CE, 0x735DE26962D9302F, 0xD3CADE33709C9A94, 0xE03C8C54FEE87F5F,
+					0x4A749427C62D3FF8, 0xB234CC2C2EF3EAEB, 0x7008F2984BEAA1AE, 0x664FB068BE8054AF, 0x7C3131DA297D0EDD, 0x7F95F9B59F12D3EB, 0x657D02A4B664B34C, 0x33E48F510EBE4413,
+					0x706E6D5AC365AA89, 0xD7EEF769E890D645, 0xDEBF642CBFE16B3C, 0x9A92CDC09919C679, 0x37030F698B0841D7, 0xFA6AFA8EB0A1F58A, 0x5E3C9CC8BA2BF177, 0x24AD02B6660C7406,
+					0xF0241D97058C536F, 0xF3BE0C2B5E9E5DD6, 0xA9E75231F4E56741, 0xA9DEBCEEEB496D90, 0xDA6C78D8BA072556, 0x941D1E15FAC6B0D4, 0xF7E634B375E547EE, 0xDD9BE03BE656A13F,
+					0x78C780FD882B664C, 0x7BDA27C041B32F2D, 0x79199DF7B60F6EC1, 0xD121FB5E10481E6D, 0xB9DB7ED3C2196AEC, 0x21FE2CCFF4EEE1BB, 0xC35E37D5A4CEBAAA, 0x9DEADEE079A34BD1,
+					0x88965D1BB95B6B2A, 0x7F59562F20199594, 0x80EB2A3A5C721379, 0xB16DCFAA090691A6, 0x1D1CB6528C43D8D4, 0x56DE673DCF30FE5D, 0x35368F0C03D40A80, 0x2262307DAC069C24,
+					0xB4564AEE01E78A29, 0x777CDDF0E56A4F9A, 0x7C1E9A57AEDF85F2, 0xEAEAEBC2FFED9968, 0xEE2D8C70E14DDCCB, 0xA6409C10A4242A8F, 0x2EC10206A3780517, 0x9D2107994320C86F,
+					0x6C40045E74AAC091, 0x55F3DB362FB2529A, 0x9AD50B9DE7A87A6A, 0x60695B440BAD178D, 0x9BE118354770A43F, 0xD6D7B23FD9D3C79D, 0x62D692DE966FEFD3, 0x1C306BE0163C257F,
+					0xB5D5A320203F71FE, 0x018A5710CA0D33DE, 0x1B2C8DFACB46ADE1, 0x2E19038F39435BCF, 0x86E7DF8A0B412D39, 0xF1133DC472C83B33, 0x23E30EBE1FFA36AF, 0x6BF107812B0F459C,
+					0x0DA40CA7D045EEE4, 0xAB7B1278AFF6CEF1, 0x4F06D89D51619EA9, 0x24BB94144B9E42D1, 0x689A01BE51DD8F52, 0x134DA7B4E225D1A0, 0x41AC43D371F76891, 0x483E01CBA33C855A,
+					0x2338E258A4AEEBAE, 0x7CEB2AD0D9667829, 0xF5F176FBDAF64DC4, 0x8C580A3D9AB03462, 0x592E49DEC8119B35, 0x7B7599ADE7A6F463, 0x27752996FC1CED98, 0xCFB021428117CAD8,
+					0xC5AD2D735769B9F5, 0xEE80D79D6D4EC3B3, 0x409E2FAD36EE4EA7, 0xB4DFF95D62210B90, 0x6715F5B5DC1D088C, 0x831C6B11F70DFECB, 0x4326778F45751982, 0x4FE26943D4BB4EDA,
+					0x6FD7F7446FF67DDA, 0x0E1A7579A9AE2F86, 0x272779D0F766B3B7, 0x615A70A680CD6FA7, 0x08E834ECDDF6C1E6, 0xE56E00417F562E16, 0xA24F365FF0EE31D9, 0xD6499CBD770F280C,
+					0xAC214BE2DAE9746A, 0xF9811A79073EF9F8, 0x4A776762F76398A6, 0xE08C4D4604766147, 0xE55A1FFFC024E49F, 0x6CA8D5B5A33F1416, 0xF548E37656ABD978, 0x7D8B7F1B13CEBB9A,
+					0x78532B4A3486389D, 0x32964EE038B99510, 0x83DFCE696BD864E3, 0xFA0554BB952FBC21, 0x1B01C94FF8DE455D, 0x2553196C1EC2282D, 0xCF7B9C7CA3A87BE2, 0x0D4F777B8D1DFB6B,
+					0x5E1536A47FA2E9F2, 0xC1B82729A7166688, 0x4F36FB9E3F38656B, 0x207A7B8F2AC55473, 0x2C732825590A27B4, 0x568963E4E81594B4, 0xA9EE4651CC90B100, 0xB88DE19B867BC760,
+					0x06C78E7752E9125D, 0xDC4F8D90BEB0FA42, 0x4EB75169D3109D13, 0x796105ED5ED88687, 0x8F03E1389454FC04, 0xD5E5A6E432791D50, 0xC530A3518CBEF860, 0xBCF8D2C6CF797A9D,
+					0x883DDB9F35C6297D, 0x769A6B3C4E177C75, 0x8B1265E460E5B859, 0x0A7F2A008F1E8191, 0x5CA1B9D2774CC83B, 0x9F180034915DC43F, 0x684926C9C928DFC7, 0xA25F439C32B3F504,
+					0x47DF6CC3FE0B24F7, 0x47DA155E2034F2B2, 0x9511C93E47685AD4, 0x77D2463B35715483, 0xB983AF9B6968909B, 0x30EE658915E9432D, 0x867B532A17408314, 0x265F9C6BF6DD298B,
+					0x4F1E44DAC29176F2, 0xCF88388BAB754CAE, 0xF639F66C625226A0, 0xCF76D81CE89A8874, 0x6E97F90EE168AE3D, 0xF24D06313C5DCF08, 0xABCA7C4076EEC517, 0x1FCA370DE06519E5,
+					0x210D7C99082A7FE2, 0xD46E0639E6906612, 0x3CE9D0BACE76BD54, 0xDB6C0BCDE16B3553, 0x32298B33E063EFA6, 0xCDF2B0398DC1D151, 0xD25BD40A3ABFFBF2, 0xF79E59B222A28DD8,
+					0x07FC10F30D151F52, 0xEF504894CE165FB6, 0x825CBDA5AF3F086F, 0x146650C597F33F8A, 0x3CEC0AFDBA4BF5E7, 0x1E5AE3F8BC72729E, 0x3B59FCAA0FCAD208, 0xC6746490E3E35975,
+					0x8F17C57A7EB5B4B9, 0x287013D0B10A81E4, 0x8D36B0387E7CD13D, 0x7AEB14E415EA0C67, 0xDCB6BE6A8229A18C, 0x75597B2332478B44, 0xEDFFEEE1829B3238, 0xB391402485E10DB7,
+					0xFC97E7D494012F04, 0xBBAF4BD2FE4E1A2D, 0xB93E7E3E81CC1853, 0x368F6C561D269388, 0x60B5AC349D82EA7D, 0xB9E611DA6A5EC1FD, 0x0C06C9F38E775EF2, 0x2F199E594E04A9C2,
+					0x9D136B9E11058451, 0x8B7E731B0688E886, 0x3671A5059017F550, 0x738F3BE3A747B8C7, 0x92DEEAD95F84E888, 0x5CA50DC1DF98875A, 0x5D2F4CF1D48ECC00, 0x34FCDF47BA2ACFD0,
+					0x91E14520D0A51129, 0x09A080F9194A66F3, 0x33FE7FEE97B46189, 0x279B566AF6607313, 0xE1DAC882BD4477FB, 0x1C87D2A6A5118CDB, 0xACCC9F1EFC8C3C88, 0x859376D0197BD2B2,
+					0x0A80EE61BB90C8EC, 0x4BD21FE8E815D73F, 0xCBDE3F897D3800B1, 0x711F3EBC20BCDEDB, 0xBD8B488D749361BA, 0xE467DE1A2515E63E, 0x21083C2F7EC7C683, 0xB2293843A9B67C31,
+					0x8F85884E1D23775B, 0xBC0DC0BC2D14F944, 0x8B41AC86D18047E1, 0xEE660A6C9D3499A0, 0xEDDF5A5B04A2F294, 0x80AB39148DDC5866, 0x5E786F669568D4CF, 0xEFAD26D07F864AE4,
+					0x183CBADE297EA9BA, 0x86719C13970E7E56, 0x04372990EC0321A2, 0x91FF427267CC7972, 0x0A237987527CC04A, 0x79C751E9354F7037, 0x020A31506555A95E, 0xCEDFC7320733AEA8,
+					0x2080C981AA817E54, 0xB9AA5CC2CC1C42B3, 0xB1D7BDA54ACF182F, 0x1C488E09B29D676F, 0xD002DA47E80F460D, 0xF8DBB575FA7D9FDA, 0xCA0917AF85A20CF4, 0xC4688BCA3EEA4359,
+					0xACF919B4A45AEE26, 0x69628DBBA117945D, 0xFC5ACAE6E4C12F36, 0xAF7B7CE0BE04F84C, 0x050243E39B85371A, 0x3CC111FF6E73A177, 0x5676BF3942640D96, 0x712BBD5B95B74022,
+					0xABC94981372160AC, 0x166BAFE072D791F3, 0x93ABFAB89C6E89FE, 0x001525225828EC29, 0x0270CFF32EA9EE75, 0x6C7D88978AB25DF8, 0xE5B5B045EBC789CB, 0x5264E82A2C38C65E,
+					0x79C68B4F97C531A7, 0x80185F13A7C9E20F, 0xE475A37174090C9B, 0x72D1FF0388084410, 0xDB7CF9C448B66FA9, 0xD0EE0BD52E499111, 0x3D442CD6799AC010, 0xE1B160ACAA194535,
+					0xA0311D24686CC200, 0xE04E4F6DE92F66BA, 0x72089DAB2B835A57, 0xD0FDB2963C452A88, 0xBE678A8F17B54F8B, 0x1BE6499B8ADBE593, 0x373D1D4DD80E5FE8, 0x322AEFE292E01485,
+					0x860C72E1A64E1B2B, 0xFD5AAA478B688FF7, 0x032DC63B1AB38C93, 0x6B33651C58F6C580, 0xF0521786E9E76FD4, 0x47EE9D827EAD7D8F, 0xEF3C3B084B249DE9, 0xC7C0741F8B8B0790,
+					0xA60A69A1EC323815, 0xEE59195687597296, 0x1EA9666014AC5674, 0xAD32A0058656FFBD, 0x8A006FA585F331A4, 0x2DA74502BD7EAE35, 0x95349E153320C4A8, 0xFC58EB4646DA16AA,
+					0xB060A0D4988FE3E7, 0x480A5646713BBCC9, 0xE427D30B695D1D35, 0x1BB339A734FF7351, 0xC2DF06F878D4D1E8, 0x7C3E7A350DC5EBC6, 0xC9A8310AC0D5056F, 0xD6B2960E51B2211B,
+					0x4A0463FFE34EBBEB, 0x14BFDDC6C3523497, 0x74F296FC940D5F45, 0x457EC90445271082, 0xB4EEE6E3A5B57DD3, 0x43CD58E1DB033BC2, 0x1C517236F1A7B18A, 0xB9150AD582BDED14,
+					0xA7E598E6078D2887, 0x5EAEA192BE757A5D, 0x9D53A358FD2E870E, 0xCAEEFA757B9AD7C9, 0x240F77308933CEAF, 0x884E9799D952B292, 0x279CFF719954613B, 0xEE859C0CEE6DF347,
+					0x9032E88B478D696F, 0x0C25E84C44A38905, 0x078DA317DC0A5692, 0x99E3B20BD6FA7A0E, 0xDADADB7801C125D6, 0xB62B267A8A1DA258, 0x189A219A5A34619D, 0x1A35972D800BFB53,
+					0xEF904342BA3AA8B9, 0xB4F015D100D023A3, 0x088B0AD94DA49497, 0x139186707CEFEE18, 0x0079B5660C540CA7, 0xD51F6359BCF4539D, 0xB512B3686FB2073D, 0xBDF9D3EC63D8CDDB,
+					0xE92E78332A830DEE, 0x93A29D2A17C4B62E, 0x6EFD72F37078F9EA, 0x57DDD96F6EBF1864, 0x5E253FC50D4981A6, 0x4410E7533AA65008, 0x064833127304FF68, 0x96F82B04EF01323D,
+					0x64DB8123CD54DB08, 0xDE7513839259471F, 0x95D4517B56776F5A, 0x374E7986A5B42ED1, 0xE93AB3DF0E7E9181, 0x62643C058449B082, 0xCC16A296A1DC7884, 0x145B8C26E5282EFB,
+					0xEC056E68AF8C9E7C, 0xC30370C84C32CC55, 0x74C70771A8D5C2DD, 0xF2EF9EF7EBCC2F68, 0x9D0ABD3CD32E4B9A, 0x8A344BB748AF79F6, 0x694949BB13FA1D1C, 0x31DC90A1E2F228BC,
+					0x65B84B48A2645A3B, 0xCD29C4D1800C3783, 0xB877E9260E00C2D5, 0x0BBEC942E74ADFC7, 0xA38D8F0289CACA0B, 0xD3E7B937DFB13196, 0xE7F6683F2AA94A05, 0xE393A7735FF9BA1D,
+					0x7AE075CB136555BF, 0xEC015FDEDFCB5AA0, 0xD7607EEB7B582A26, 0xAA95FDA9DD0AE4F9, 0xF86E708034C4E5CA, 0x8C9C03C4629B887F, 0x56EF64EE35AA9FAD, 0x85119FD6EA62B265,
+					0x1559959D35380147, 0xCAACC8F705975F79, 0xEEAFB2BCFCE05E25, 0xEC73CA89EA40B338, 0x049681BA85E37CCB, 0x5777B195FD25ECCF, 0x500EEB19F0DACE9B, 0xC309DF572BF15225,
+					0x00429EFC892115C8, 0x81245F9C309B3DC6, 0xD08837CD2A0C85D1, 0x6BE98DA00685F547, 0xAC10F3C77BA55325, 0x8B3E5FE669AA87E3, 0x42BE930B21F5654D, 0x99E0249C72EAEF50,
+					0x5483F688DDDB2B66, 0x480A8A4070999410, 0x9386B5117A932A47, 0x05512C30784BBC51, 0xBB4C1155DC2C6B8A, 0x51E24C3BA285488C, 0x6198EA6DAA94ADBA, 0xDB3CC9039C15CE72,
+					0x193069222B7174BB, 0xE12A125867BBDA84, 0x4FEA841075B94517, 0x37A03EDE8EA011B0, 0x7F1E129749A89180, 0x284C937757ABA952, 0x4BCAE0C05BC31BB4, 0x8E2A4D5C89FD2CAF,
+					0xD24B72D2C8422946, 0x9953D23AE56910F1, 0x90A57AE8354D44B9, 0x5627FF5AE20734C2, 0x0605E9BBE39B7B37, 0xBA2014587D45A69D, 0x34AAC5BBB6692390, 0x1B47CA6F44E7153D,
+					0x30329ACD50AF8EE7, 0xDE6C296B34FD6956, 0xA0D277FF88CD4A04, 0x8AD5E6BC4EBA8071, 0x08E5A7D84FB1233E, 0xA258374EC1149906, 0xA5844A882E1625A8, 0x0EDC38C39A3E1745,
+					0xCE57760DD09C5B90, 0x2375D3A9B6F26537, 0x2DF728C123412651, 0xF8F362A6616D1B3D, 0x3EABD926695F0603, 0xBA6AACA55DB8B3E7, 0xC0756954143DD89B, 0x7B09575229896BCB,
+					0x27E8E4F1EE821FD6, 0x86B4B321DCB7AE6C, 0xD5DF08E80DCF715E, 0xB0F3EEDE4603CE5F, 0x350F04D2C39C0F06, 0xF3126E3DF298D9B0, 0xF6EDEBC77271165B, 0xFA3B696862547A11,
+					0xDE71A6BB766DF1A4, 0x6EF1CE1E6AF26FF2, 0xFF99729AE1F9ED05, 0x03730F3321FF970C, 0x9B07C69E1805B1EE, 0xEAA6F2DD8C7185E1, 0x4DC01CD6F5660347, 0x397FE63B48560749,
+					0x2A68F8A8EB4E505E, 0x2551134DA98ADBDB, 0x4ADBD18AC995B911, 0xE8B8860CAF2E5F8C, 0xA46F0FBE96D50578, 0x097CA8B82C71366F, 0xB5E81CCEE8796373, 0x0B65DA32946D9742,
+					0xDCF40377983A6EF6, 0xBE56F2E6B05FB3DC, 0x4D825B927C5E9567, 0x7CAE694982B6AD08, 0xA80AE34F09F9C6B1, 0x2220E3827E1587DC, 0x572BD3894A1092AD, 0xD0CD58E6CF4790C4,
+					0x9CB1641C758C63D9, 0xF7B89A69618103F5, 0xF8618CC4AC8ACFBF, 0x4CD9552C78EA6613, 0xCDFC985AD5CDF587, 0xE84566CA97C4E2B8, 0xB19BBD9088587C95, 0xE44A42A8C6DD975C,
+					0xED9BB0820E9AB974, 0x917A9DDA24A1D811, 0x1D8439FE9AD1E3A9, 0x62509D26326FF1E7, 0x635451ECBF6ACBC3, 0x24ACAF5BB23A7F05, 0x6100113A5FB5BE1E, 0xAE2FE24C16CF42F2,
+					0x8006EA8D8EF75CE1, 0x485C85242D25513C, 0x28C4C1F6B0A9ED46, 0xD97465D709087332, 0x0D9FFB4721AEFEB6, 0x011A488C4CDB20E2, 0x52A42E36E3BD153B, 0xCDD41C4F18656452,
+					0x00F354EF7E124305, 0x2E0742357B040A8C, 0x17F1C9D0A4EC94F8, 0x743DDC674B976CA0, 0x316AB988FCE24C96, 0x631A4FB0FC42448D, 0xCE59E804B64C797E, 0x22034474C9FAB36C,
+					0xA340AF6CF485702B, 0xE8BAB9270549A756, 0xF7FD7F21C1268B4D, 0xA2052DA58B23EADA, 0xC93DEA62CD2D69F4, 0xA5794E2F15BA2E4C, 0xD7E116CAC9F29164, 0x4697C58517512F5F,
+					0xC21EE9DB73688CD4, 0x5342D1E4F9C74834, 0xB468258DF41A353F, 0xC7B09233DA01F7C9, 0xAA7F3F0D9BB4F81E, 0xFE5949274CB9C3C8, 0xB43A8B2129F273F1, 0x319005F1172B92DC,
+					0x2D18637688D8F655, 0x75E6D5B419C037D2, 0xDAD87E778A4DC36F, 0x5CA52ED13683128D, 0xAE859A1864F59538, 0xEE1DBDC4162ED2B1, 0x07A860AEA32B0E1F, 0x7D9E1B604766F95A,
+					0xC29A23B8BC7EF264, 0xD5940A6A2DB6DC42, 0x9744761478239D79, 0xC2862BA4336F6A48, 0x5C06B32B5A41D2AA, 0x460F7849D33CDB55, 0x369DEEEF3543DD71, 0x8FA35B75F959EC04,
+					0xD2AFDF830133F983, 0x336ADF2062005A1E, 0x8C848C636367CC4D, 0xA88415FAC03E631B, 0x3405AED8C657C229, 0xC7F58C02B9DFF771, 0x63EFB355144859FE, 0x3322618F9711760B,
+					0x591040B9B74B61FD, 0xCC3D9AA8B028CDF2, 0x0B90A69BF620CBFD, 0x5882645047950E1F, 0x0D2808CD281AED83, 0x1D40B185EC0F127E, 0x5489FCAAAE352BAB, 0xB45086519856C94E,
+					0xC85C7DD2FDF99A13, 0x395903BDCA97C581, 0x2FA160E90F6322E8, 0xB7741F5514FF525A, 0x67D68C7C84859508, 0xBE0CF9DA24A8AD23, 0xC1137C92FEBF935F, 0xCCC24910AA225F0C,
+					0x86A1563041B37D77, 0x6BD8DA79FC1FC5F9, 0x218E60668459959A, 0x6E9E8B8BDE71608D, 0x0571D27BCC61E780, 0x3DBAD1A2DBA37E17, 0xC5D66BC8CF7F9DFC, 0x43004EE62DB57BAB,
+					0x620985D0D82E356B, 0x40A4AC8581AAE8B6, 0x62E948871154B180, 0xBABC815E8144E4B8, 0x65DA7C129D4AB224, 0xBA70A95FBC93827E, 0xC25CFCD7179376BA, 0x636B75F4D07B5A19,
+					0x7D985CEE4DFFEC38, 0x72D5C0F9711CA4BC, 0xD715CD0FC468028F, 0x18027C840B38B413, 0x0DAD5E3B8716F24A, 0x4E7D0A74D2D0C5CD, 0xF3B4674EFD3EBEB5, 0x518AF67D57D8A842,
+					0x1D54FE3A389A381C, 0x4C61899BE693B66D, 0x07EB9AA6C6B87359, 0xF3B7539F189F5BF8, 0xD6A9BAC04FBF0860, 0x889CA886923A54B0, 0x197E699ADD8DCD0E, 0x702BBD30FC524E5F,
+					0x42F62F4D9974B5F3, 0xFA921EADC255C47D, 0xDCC8B828E9321F71, 0xED65C5298B6499B1, 0xFFFFC4D51F3E522F, 0xDDEDCE797D54A7CA, 0x3879D21BC8487106, 0x85C6FC8A085E0139,
+					0x6DE25973BDC11DD1, 0xE0556F07B9ACEACF, 0x330895F08175A1F6, 0x319DC4C0800489FE, 0x3508E9E671AE40CE, 0xFED022E5A6B2FD92, 0xF93AFE04FB48D924, 0xC1C31F6E98D14593,
+					0x2DC2FEFAED1A12F1, 0xC99E31B19BF39C06, 0x6351DDF47306299E, 0x54BA36CBA42CE356, 0x91581D3DA0E9E5AE, 0x1EC4A6DED83CE161, 0x3AC2B8394F18D42B, 0x4A532AFE38FECD74,
+					0x90BB42B73BF0C01B, 0x8F5B7ED504F869D4, 0xEDDE25A5735BAC61, 0x97233A8BE0B3BE18, 0xC5218751A7B5A535, 0x7F6ED0622BF91B53, 0x5166830CA5B28A36, 0x68729BA6ADD166B2,
+					0x91C5F7CF988599F6, 0xF9E0A939163BAB9D, 0xB6E12E928C62A5EE, 0x9C531F644CB6172D, 0x5CBB222EDB89943B, 0x76A60C82DB3DB96A, 0x2EE671B9CC202A00, 0xA5B5F3B82B77F481,
+					0x277D163CFD035AA6, 0xB3FCE794C2D8F462, 0x90A2DC2C14487178, 0xAD63FAAA36D23082, 0xCE2A3E25E7BF65E8, 0x3CC37D0D7BB921D8, 0x2EAB1A7525374FD8, 0xDE882C53115F49B7,
+					0x97B1C3DAF50A1A32, 0x6816B84BCFA8114C, 0xAC688CCD8769DB4A, 0x91A2A219929D500D, 0xFF69C108EEFB4A60, 0x39D7DD4F7D692FFF, 0xC8FF7F3D88F35D56, 0x5C97F5D1E3C71A7B,
+					0xA315B3A690762DD8, 0xA2E67D20EF652B05, 0xD29FA65800816753, 0xC374C36C4EC819AA, 0x39220051B4F5C3DC, 0x7C8B5C0026D0C3C8, 0x870783946DF718FE, 0x91B5A98FEAA98DD0,
+					0x86CD114E30F6FCDB, 0xCE1E336722EE9DDC, 0xA1D4B9FC2BF7EFD6, 0xD5DA96CAE14CA75A, 0x4C994978168FC08B, 0x5B793C17878EE919, 0x181DFA8182438792, 0x0A7D5F37A3E4E03E,
+					0x2C2A59BD0DBA9D93, 0xDB882F870544FBB3, 0xA9EC9AF8693AF275, 0xB0FC207DCB4BCE31, 0x51DD76CC245DE0B1, 0x517746060D98B892, 0xD056763355B5D330, 0xDFDFD39B60CECF04,
+					0x8C78150B86D36CFB, 0xEF0AE6658028B274, 0x4359B5B1B7BE68FE, 0xDB9347810D0FA5C4, 0xD321BC4F0268CBF3, 0x395C791E67809790, 0x1CFBC718375084FC, 0xF7706E4C1FF2157B,
+					0xBB74B3150E5632F6, 0xE3F12F1D089F1EB1, 0x1C86B359FD32AA72, 0xC8A024C856BD57C5, 0xE6A7E5E042DD578E, 0xBE9ADB3DC70AEF36, 0xF8474ADFC6AD1C4D, 0x430408D8D11B55E0,
+					0x6A88DB2F5E7F3A37, 0xB29BF9F54D727D38, 0xD718A577862B4F8D, 0x7A15426765610703, 0x0E8F6C532915DAD0, 0xD112519EB4E2548E, 0x4904F2C9884FE10C, 0xB70ECA27FFE0F377,
+					0x070C1E5EC586622C, 0x68357CE15FD6B0A7, 0xE918E6E81ED44412, 0x7B71B12F2BF6F466, 0x1C89525644212669, 0x2D0F4AC6CB970C5E, 0x65BF79B20661F8CF, 0xEF29F2751610443E,
+					0x876038C1331942DE, 0x9D4613A7EAFF7E42, 0x1199F8CBB007BC97, 0x173E8DFE09FF910C, 0x1B48C4333F7613A9, 0xC3FF23A86ABD1635, 0x877A1358F3C02F93, 0x98873B23A930CDFD,
+					0x0EACCF61D7B4830E, 0xEB4C4CC87FC42089, 0x1B08E3D090BFB682, 0xD3D3460F3429AB83, 0x3E68973A37FE4883, 0xA28D34CF5EEF95D0, 0x57AE2B2FBB3C974D, 0xFCC6926B52E0AA48,
+					0xEA64799845F5C4D7, 0xE108D57510C75E29, 0xE5F2DED9B80BF349, 0x2BB1CE117050E482, 0x53F0E8BA1EB57F6E, 0x00E9A65C2EAEFCFC, 0xA400D03D5E150434, 0x6E973397875A4384,
+					0xDF2DD39410C4B8CF, 0x2D7B270246D28AB1, 0xEBAA966C79251E99, 0x11DBE5F400874172, 0x737BCA57A3E24FB4, 0x5FCDB38FBCDFB436, 0xE0D4FC0B9E846F5B, 0x1E85AF667387E35A,
+					0xED94FA24C41C8176, 0x14B648A488A3DCD7, 0xF738A94F6A7ADE51, 0x3C8DE55486BA9A3C, 0x7DAFCEE5ACC49F93, 0x91772174EFE9045F, 0xC3070DA618DEDE5D, 0x8839327C03C5ADA2,
+					0xA978CF832B249AC5, 0x2CE258FC89B3935E, 0x0B6334719FA58426, 0xED526DEF6FAB7764, 0x09797E262EFBF5FD, 0x6342F6AD701445DA, 0xEAD4148C133A8D0C, 0x7C04950B24F2032A,
+					0xC55FB4E693A71465, 0xCFC154FBF39AE8C4, 0xC735748068EE7F24, 0x618C72964DAB5E79, 0xB4E99C72B6AFF247, 0xC9E217A9541008AE, 0xD7621A0D8523BD6E, 0x5A3E50BE9563DB80,
+					0xDEBACE5487FC3E65, 0xA149B55648D90981, 0xDB096F2F55A7DEC7, 0x7A87CFD97A44F614, 0xA48E93EFBE0A89C1, 0xD7BD3410513CC7A8, 0xEB7DBD485291B1AD, 0xC09DB19AAE21BAFF,
+					0x1493BC3BA1A62BE9, 0x4C4DF2F24F4A8F1F, 0xFDCEC93D570593B8, 0x1C161BE7FBC801F5, 0x4B3ADEE8D4036F20, 0xEC437FE683177571, 0xDE7776E6342A0AC3, 0x772865F4FDE9D37E,
+					0x87B18E4B782CF261, 0xA973C3BF5DCCD966, 0x18E1F36DFE395866, 0xCFF8E2936AA1AE33, 0xD32CEDF0B3489992, 0xB44DCC36512AFA40, 0x353AD2C5491A97A8, 0xC7A2480AF382D234,
+					0xB948AB543D8136E5, 0x3FDEE3558F91E6CE, 0x4C7D91A78A84AC07, 0xA0FFEA61EAAF7D6E, 0x86CEB487E7C51955, 0xF450A6A06669A3B6, 0x9A2438E7ACCCD440, 0xEB87CB552D99877A,
+					0x590480DFF40E7421, 0xC8DE18FA23B33498, 0x9F8A1D921C42ECB6, 0xC68858CCF14AFFBD, 0xF94F3B0F7A3B9D45, 0x0FDEC84A47E5BB9F, 0x6E37D07907CBAA1E, 0xC9F12EF6917E6329,
+					0xD299BA0710EB3546, 0x0E293AB9F93CCF8D, 0x57B235CE006CADE3, 0xBE4400E64E11251C, 0x18DF79C2DB1CDBB4, 0xC1594EFA575D6BA7, 0x7C82FC275E9C9855, 0x04882836A4030B1A,
+					0x462418FF326CEAD3, 0x7026F319FFA2E51F, 0x5D03AF6B0F92431F, 0x0FC95AA1C88593B5, 0xC9FFEBC22608C279, 0x27E7E6F7BE2922EF, 0x36C455B17DA46406, 0xDCE2E37F301ECB77,
+					0xCC6FA0AB63A3B911, 0x1148F1AE95CC1E2E, 0xC5B336812B1D73ED, 0x3C7F391B68B90BDF, 0x0EBC11ABE4634F45, 0xCE721F9368F59C90, 0xC62455C84B56617E, 0xC8432C24833DC994,
+					0x64EFC732F2F7A2DC, 0xE835A19D84D4C7DE, 0xA08402C31BA2ED55, 0xD8D67E413F1DA6C5, 0x673957133C90B58F, 0xB2889FF832002F63, 0xC15533CC5132253E, 0x1205362D7C1459F6,
+					0x72AC75C6BE94280A, 0x3E7B98150AB46671, 0x26D4E0FB3CC2329F, 0xFE43E3DE22552542, 0xA581694BF0F22FA4, 0x7AC0B87AABB93657, 0xEA6074F5886C86B8, 0x0711CD379F6B99ED,
+					0x07DBEAC6AFB262E2, 0x8650CEB3158368CC, 0x51D6088C64B37AFB, 0x80B45CB81C70506D, 0x91ABF6B16942C272, 0x4F95B2DE2F518336, 0x3F3F436FF0F82E28, 0x587988262FD30D4E,
+					0x79934C2907876A82, 0x172F826941E43C32, 0xD1AA131C943CF036, 0x88F2DF68BFAEA020, 0xF753593ABDC187BE, 0x19089645250E1AF6, 0x67239EBE99FBB14F, 0x3CB82C13CDBED0F4,
+					0xC22F1B0ABB71D3FF, 0x84C595A272F2050E, 0xEE0C8D29CE562515, 0xE2828C146311536C, 0x1574AEB01541F428, 0xDE9E0F2A9DE5A624, 0x0954893CB1D5EEE4, 0xE929EB87FD460DA0,
+					0xC1FFEA49E9DE7C98, 0x6BC5BE93983CAA97, 0xF22AE34DF8635D84, 0xD1B2CD1FB2166FA2, 0xDB81C935F4171D11, 0xC76F63A7BDF0D2EC, 0xBE3B4F3F4D5C7FC5, 0x8FF9233AD7275B42,
+					0xA05509196A636631, 0x27DAB68B0B504C51, 0xB1EE676187AD1F4D, 0x9CEAF5374CCD17F8, 0xC60E7DCEF411804D, 0x951B0532220822AE, 0xE1072C3CF370650D, 0x93571DF1810DEF22,
+					0x515D0F075129A235, 0x9A1D72BC7D04D215, 0xB7891915532DD0DE, 0xD9A69F9060785720, 0x2C81EAF6806633F7, 0x60FD0DD859DB8C00, 0xB8A46B76B9A760A6, 0xE429D20D9C2DD7FB,
+					0x7B1F0E15D811DBCA, 0x941938E1B65EB400, 0x2214EB356E5FA53E, 0x52F46ED04249F750, 0x8EDEBA0DB9629259, 0xDAC90C6085A17488, 0xBF07A444DFB8FD39, 0xAD47720563B04FA5,
+					0x0C79ABDF60CEE08B, 0x7F9FFBFD5103E055, 0xA6543A0B60057CA3, 0x238CDC61D9E9424C, 0xEB49A63C37F7499C, 0x8C695AC19DEDBD5A, 0xD737F13F2BF6238D, 0x226922D0947FC323,
+					0x2C66740E8B9D5805, 0x707C17E475E66C43, 0x994C9AD93C50070B, 0x1D7F2B373CCEB90B, 0x23D467A5B1C67ACB, 0xC88E76DAED923BCE, 0x94A4700464D67946, 0xF6BAE9ABC2737408,
+					0xEEC7CA5D9A2A3A69, 0xD6075A1BF83E0C85, 0xD760CEA31218220C, 0x024BDD813C8E67AA, 0x626F058C3874C14A, 0xF565C4EE56981F03, 0xB8BA5A2F98BA8D11, 0x8F71DAE5F6E557E8,
+					0xD614AC5BBA79CEC0, 0x44EC47C4EF9D6C3A, 0xA5068B5ABDD804DB, 0x86C604B889C0512C, 0xD43097BCA823103D, 0x89B7AF23326227A5, 0x76FF54C1FA5388E9, 0x78C6387BDE39EAAA,
+					0xF16AA8019DFCD34F, 0xA0A032409726DB1F, 0xF806482DC5A187B5, 0x0B467DC6B0875143, 0x02E3FA2624A33E59, 0xCCDEC1A3B4E3B455, 0x5EF7B74B91854002, 0x4177A3C19728F005,
+					0x36A406752D0A141A, 0x6CB5C3529B4AB787, 0x03E3CDAA26C1FEE0, 0x9307022119C73A8E, 0xF5A5FA7BB7B7E0CC, 0x1757698E3D410595, 0x87F03B03770E1DBD, 0x0F41D64AE0954253,
+					0xD7AFF803D619B6E1, 0xD49435496BAB42DC, 0x1E191BC91E0495C0, 0x7CC30A54E1A36D5D, 0x8E4761A699CE5AC7, 0xBFB13DA8AFE450F4, 0x0C378CA191AC1CE3, 0x731EEA593B183414,
+					0xDF822A0CB1A5AEFA, 0x046806E1EA1173BB, 0x006F589DB9426813, 0x856C8A15C26114CE, 0xC0AE95AE52A16B44, 0xB28D90005CCF5E7E, 0xF86C446D748E5912, 0xEF4620A9CED4A18A,
+					0x95B9AF97DF389944, 0x5E42A2FB9DAB4E93, 0xE135D26371109F69, 0xB3147BA1B895B3DD, 0x3B88BE5512C0FCA9, 0xF6372ECC2BF1DAEE, 0xA5901097D9F7EB83, 0x8086C124BA358BB5,
+					0xC8E4A40A8B45CDB8, 0x156419A8880C5883, 0x0F5722BDA45CCAA2, 0x4D2C8DB290414C10, 0xBFD94A6B3B693EB8, 0x8FAEE72C95D500F0, 0x5B389EE0CD54F856, 0x80AAD367B7F88334,
+					0x4C61C54FD669A8AC, 0x138CC2A274D80DB8, 0x57A9EE2DA1F3006A, 0x419BB094F47C4240, 0xB1909261F6BFA832, 0xFFB0D3085D84A04B, 0xEB9D6AE3D645FDB3, 0xDA02CD8A59A2345D,
+					0x0053C5651406E777, 0x9C84FC6434C7A5B8, 0xB302D629F958A6F4, 0x5CD8446C7B0965AD, 0xB0E6F8BBDC60EDC6, 0xA081AEDF2A9E7FE2, 0xBC86E922D32C12E2, 0x5DF9B69A28661D52,
+					0x090AEDB75A4521B8, 0xBE9A3AC2C0513094, 0x883ABCC4C4C68790, 0xFA53FE6091A3323C, 0xE882029E13237576, 0x95FB1BC54A32E709, 0xA6B9A2BD49C3E2C8, 0xC564FEF94C0A27C8,
+					0xDDE2B7C4F63D39EE, 0x6E379864ADED74FC, 0x869C4262D9D01BA7, 0xBFC29E182DFA571D, 0x23251F419AFB7A09, 0xA0A098D7CF29E918, 0xE5D0161241718F7E, 0xB563FC3EC268EAAA,
+					0xE1905F60BC93E4E7, 0x609A930BAED7AB17, 0x3ECC351100C0D543, 0xC76711FDCC04945D, 0x2991F072BFB75479, 0xA5203672D6766A20, 0xF4E5191423DBEF1D, 0x11CB1AAA683A3A6E,
+					0x62FFA824B3A860F7, 0xAB5A47FB1F73B5CC, 0x3A28ED52CD194F4D, 0x313A2F5FA8E460D2, 0x864752B12DB1B42E, 0x594F8EECC2A38641, 0x0A2F46B5DDD723A1, 0x99BDC39F2A45D00D,
+					0x38900FFB38CF5847, 0xE1E1C8A156C5A6EB, 0x529853DD0A6FD53B, 0x05048896D68678D2, 0xC2F6E124FFA3DD48, 0x76EDD38EBEE060AE, 0x2F78CA6E2160287C, 0x8C0C66D316B0EAC7,
+					0x4D28419029E84D9C, 0xFE5ECD10968B0CFC, 0xC731134D02E3DA4B, 0x93A8FC511F1B06C1, 0x6385964B40DC8614, 0x51416A6F937D1769, 0x96823ABFAA78BD7C, 0x0DBEB1B3932E1BAF,
+					0xEA14C51A8A4770B8, 0xE84B0BAE1B3ED62E, 0x79F6131C7F052645, 0x5E5E1D903A58AD05, 0xC9BE4C2A2FFC13A9, 0xB69EF009E7DF3820, 0xEE5AF6AB2C04AB4E, 0x9C4D6F82F70AA4E5,
+					0x881F54FCFD7CA293, 0xD67DD6E85B06A69C, 0xA9B2B94B2CEF88F4, 0x18BCFA2EA1DD19D8, 0xDD0221F42658A4BE, 0xA0C56FB131EEA4E6, 0x468D79E386D5131D, 0x6D86E3E05206B728,
+					0xB4CF229C9CBDB852, 0x2B2D7B98CDA1C58E, 0x65737E2D167EAA32, 0x649ACF28DD25BE91, 0x3A4A83D1FE6E135B, 0xF5BA9216B8F44A1E, 0x6BD4F4FC1993CCCC, 0x137731CCD7FB3DEF,
+					0x849601A803802C6A, 0xF8CEDCA0E4322091, 0xC91396ED8080A771, 0xD90B97F30CF3B49C, 0x41263817EB9D4498, 0xBAD2E5EAD0AC5505, 0x87FDEA0CCE548F98, 0xF888F8276887D901,
+					0x4B598A7D911BC246, 0x7B9F973026CCD913, 0x5832AB66C1750476, 0x0DBAE15F80862489, 0x4D552E7F9B96BC9D, 0x59A53065A51D8A72, 0x76DE62CC01CE5D05, 0x9F3AF84A5F85D470,
+					0x002B5F8387E939C7, 0xE9019BA1DBA87406, 0x2C390590E9EC9BFC, 0xC89CEEAC2444EA9E, 0x52E126F41A8F7BA4, 0x4478CF1B8149921C, 0xC986C385A94FD6BC, 0x2C7EB5E8BCAA0076,
+					0x6578731BEB5040D7, 0x8527227488DDF572, 0x2D516C196EB00D4F, 0xCD5B65B448278BD4, 0x1954A99408F30CE3, 0xA35A3DABF9C338BA, 0x5B1C0E264C043CD1, 0x813184F293BCD028,
+					0xD8493BD71BC3141E, 0xCFCBE037AD23C328, 0x933ABE5FAB7C6DFB, 0x7D1250D358F6DF74, 0x173BB138247F8FD4, 0x8C10C6DDDD99CEE6, 0xA584C6ACF68E9C48, 0x5F65A6705E212F9E,
+					0xB3EC80F6F9E01EF6, 0x3C03BCD3574D1F99, 0x5D35CA4312DADECD, 0x28710F6CF63A90E2, 0x6FE35107E268B2E8, 0xB249B50819FEDE09, 0xCEE4C82420A1350A, 0x7B19A9747997ED9B,
+					0x8A92EA58543EDCB1, 0x7077C72136F4F191, 0xBE57B2C32E27BB8F, 0x0791685538F5857A, 0x300EF1184963A2CE, 0x50FBA9B3FD689BCD, 0x1954F5B9C35AB01A, 0xBA3B10ED8884569D,
+					0x68FC3C604F6B97AD, 0xEF99A4BFD76F1BC4, 0xD2E6FCBE9A3AC628, 0x4CC5A90866640252, 0x613AD7ABEA7AF513, 0xAAD2C304C8DD578D, 0x9F59533C2669B31C, 0x270F80BA8C6E6414,
+					0x3933C0948AF5C1E8, 0x1F41EFFAA55B1FC3, 0x8B5B4C2A7922B34B, 0x8618C90EE64AF544, 0x653CBD910BCAB295, 0x28FEEAC8A3164C01, 0x7C368CEEC1E1EB86, 0xD2C5FC74602C0AA8,
+					0x3E06470C11759BF7, 0x4451837B272EA9B4, 0x762C9DBF8182F82B, 0xC14493FC02F00C80, 0x6E9BE9E6516A29BA, 0xE62C88BFF0638E35, 0x00254B640F566DB5, 0x772BBD6D96B5D301,
+					0xB05ED77A216D8404, 0xEA25B09B1394FC29, 0x23E03A6F24216C03, 0x7E3BF4B2D36C514F, 0x010E36471A906449, 0xC31C25B0F86AB9CF, 0x72488BD31B6D9597, 0xB94D3AF17E510D98,
+					0x47DBF0C0C6CE1107, 0x26BB4EF87D493997, 0x850018CF92A84C80, 0xD468CD32404636CF, 0x2DDCF34AFD140F66, 0xFEE62ADC31071F59, 0xF53047FE33DE1615, 0x74478AA034DD95C3,
+					0xEE29A1326933C922, 0xED9985F90213A487, 0xA6B81090C81E110F, 0x442F485A538B99A9, 0xCD9FFA97B896B17F, 0x3C7A2A9520334935, 0xDEB4C9F0994B665A, 0x5DEF138DCE61F9AF,
+					0xE889FC07F4F4C243, 0x5D9379152B689B07, 0x1ACD73ABA542E94D, 0xBA9034357904DBE0, 0x80F7E8DD7C5BF465, 0xB156085EC8D2FB81, 0xA190E182CB59236A, 0x3FFAF2C6AF1E25B2,
+					0x30D46D77C9C69006, 0x31F5C218897F6209, 0x8D6A1FF3786DFBFC, 0xE6952D9E93C7375F, 0xDE4C97B4948AB816, 0xF77105088D58489D, 0xAA49D98CF0CB38AE, 0xBED8B119E3A7C692,
+					0xB0F3C2180536EFDA, 0x88431B9AC5A349C0, 0xC53E2F3C826956F4, 0xAEF358383A9382A1, 0x834E8C904AFE83AA, 0x4F15DBF7596333FB, 0x2107729ED483D21B, 0x9C7C0C1307C20BA8,
+					0x29211DDB4450915E, 0x9F980CD3149B4D65, 0x23DBEB7E1072139D, 0x106F06076509D525, 0x0FCD75C737DE04F6, 0x58293093CDF2C23D, 0xB9EA622DE003695D, 0xB609896DF8AC995B,
+					0x8BDF203BD396C3B0, 0x339CA871447B4DF0, 0x30A2F6F07B3108D3, 0x68B20CA5194EE0CD, 0x068491BDE0E58F24, 0x0E78622AF172B4BD, 0x85BF7E6F5A4A6963, 0x8D464CA01439B6EA,
+					0x8449B3D5A9A3BD52, 0xB52D252FF355A00E, 0xD70BADB4914F394D, 0xDD3D418EC8EB7F35, 0xECB149FE053BC0B3, 0xEEC57A23BFE3865A, 0x56A4E015EFC8E304, 0xB4F4E5F52F6DB3BA,
+					0x51AC3E3D22DC5C7B, 0x877D6007772FE557, 0xF7F4A16322DD5079, 0xA853BD99FBA0C5AB, 0x1359640E812E65DD, 0xBEF44C1C32584469, 0xD8463F6BD2FF371C, 0x38489398EFEF384B,
+					0x0D23FF2829AEB9ED, 0xD6203444BD869FAC, 0xC5F72968E295FCA4, 0xAA907CEFAC647D72, 0xC221798CACC23726, 0x4F6EE1AF644B3A0E, 0xD9AC2C79B01EF84A, 0x47A49EE48E51EE82,
+					0xECA60DEF7917F875, 0x2C052DE128ACD719, 0xA48A3F0CCCA29A87, 0xF4D6CD6DEEC98A35, 0xE342A00EA33FAF04, 0x355F9F6BDD52991F, 0xB66EF68F68C5FB90, 0x5FB14419FCF6F761,
+					0xEA14ACCE6BB5EFC8, 0x4244C29ABF17E9CB, 0xC86C6ADA0E28C51E, 0xCACE89024F4F2905, 0x7552D803C1B2A9BC, 0xB4A93F3B50734CB5, 0x02B70461513F68C5, 0xABB8AD65C4D4AE4E,
+					0x6FEBEB0E0048DBCD, 0xDB35B113EF4B5A37, 0x2B0BF358F1BD2A0A, 0x3679AFC13208D26C, 0xE7DE2EB7773B4C85, 0x033A2BF2049D15FE, 0x88F05FC3CF0C2A39, 0x4E0CDE73F9E5A80E,
+					0x3E857C15FB66C613, 0x334021CAC747ECA4, 0x46B90E13D59311B9, 0xECD8A78F5FD56B5A, 0xFF4631E79D554C8C, 0x5CC4B345D8A1F63F, 0xB5E5F1AF31FC3CC7, 0x8E207BE7DB43F01C,
+					0xB8DAAE200569EC4E, 0xFA9CA058394760B5, 0xF329894F84715613, 0x19145301C746626F, 0x5661A2E85CFAC65F, 0xAF8AA325ED2E21AA, 0x303DEAB89749D44E, 0xCECC67E802B6D885,
+					0xFDBEF297E2BFEA85, 0xF90F67B1F583C23A, 0x20D28434754DD263, 0xB201D384581F0160, 0x0A30A2E197FC0F5D, 0x50822F3412A500C7, 0x02156E662A1CBAEF, 0x74ED1F4973E47D3F,
+					0xAE451915A0C35D6A, 0x9BF3F1643D7C703A, 0xB508073320102480, 0x9C96010D04388694, 0x8EB0BA6FFA444534, 0xF771A26589E7F47D, 0xA05B8435E1D291CF, 0x537C77BD9F1B39D1,
+					0x96EE5108CB38DC36, 0xAE68611DD80E6574, 0xD56A867812FD8C57, 0x0269F3A8DD5B9536, 0x4CA06BD9AF87AB09, 0x9C701B6ABF5C7246, 0x42218AC02871C128, 0xA59CCF72CFC9D766,
+					0xD4814CF9D4D65C4B, 0x27B0805E4954CC40, 0x78BE98D6146CD450, 0x55B0923033BC5165, 0xF660F47D721900D1, 0x3F21A075ED2D1B13, 0x88363EFB51711058, 0x9401DA4FFAAF874E,
+					0xCDFF0652185B8A8F, 0x2E1684EEAAACDB24, 0x4957F6B1F677993B, 0xC5E57DE67B9D5248, 0xEAF0539B9C1967E9, 0xD21A4C40D15DDD12, 0x7ADEA24A491821D3, 0xDC4630F88009FB62,
+					0x28EFB76369DBB982, 0x297542881D6F6E14, 0x40AFD763E9C75151, 0xA67E376ACC0D3296, 0x625D2BF222EC6EB6, 0xE046EB59D238F3D4, 0xBD3BC3A5A85B0820, 0x7EAA3136B8836E39,
+					0x77A142712687A3B7, 0x8DA3A4818DA79A69, 0xB9BAD3F49AC63ACF, 0x71BD161177CBA24F, 0xADBAAF80F40D819B, 0x8151150E833F91DD, 0xCE419BFE79A8030F, 0xB2CE9D5570E79A46,
+					0x34C1FA3824706258, 0x48DA88C9BA6542B1, 0xCE58914A3FFCA0FC, 0x2034DDCAED64BE03, 0xFCD357B71CD91938, 0x9AB5C4F74B840496, 0x33874B4789F0D45F, 0x3EDDB71AA67E9572,
+					0x92F59F4AB5E90F5C, 0x32983718692F9B83, 0x59D02FE8885F2CBD, 0x2DEF168B6E57EABB, 0x1AB006B6C6A3198C, 0x6E4512C915B1FBA6, 0x46625D8BD3BAD646, 0x665FD000B05C3E5A,
+					0x44B9810633A6F12E, 0x2AAA561497CB2D3B, 0x486E08E1ED5B6396, 0xC61F3FCF22CAFDD2, 0x50C11EC20F6BA2B9, 0x87E705FB6D26C473, 0x0FCEA41277B3218A, 0xA0169A578B52DEFB,
+					0x50E8F3B2DA4AAA39, 0x4FF408EC9677B7FE, 0x4163D796CAB8DCBA, 0xB71D144A9DC2BDDF, 0xCC11C992082510EC, 0x3BD445428C90C9AE, 0xA7EA20F0EA317AA3, 0xF912CB888D3FB784,
+					0x09AFC7714D0F47EB, 0x851BD575683B8D9C, 0x505C6CF31CCCB2CD, 0xC6C5789F68555B47, 0x2FE56F714DD2C479, 0xC67B1A1EEF1C8D1F, 0xB2AA69FAD70CED75, 0x97D46962917DE9E5,
+					0x6AFAFB8359BD5AA2, 0x53C63813287C5FA9, 0x96DDF21DB0501E54, 0xE36CD4F390EA9720, 0x0B27709136EC7B03, 0xF892079C7B0B861F, 0xF300C9FAD0109F1F, 0xFA218E0EF004DC65,
+					0xC93136570AB5E6BB, 0x64224061BABB3BE8, 0x9CC3C8947FBAF638, 0x2870131FB80E4C67, 0x1C680F55E30932AA, 0x9CD124C7676017E8, 0x66BDA0EB8E9D6C41, 0xD0030C31D08EECD7,
+					0xA0096E3A4D5EB243, 0xA3D5C5863FC51C83, 0xEB5CE4200F6C037B, 0x8F5F6EE0A4B42E92, 0x3744CE9BC2B041CC, 0x06DA9B0F3F0E8E0B, 0x39C242A5290FD186, 0xEA9AA890E02FF2FC,
+					0x1BB76DF9364FB33B, 0xEBAA450601E60019, 0x4B554B6BD098010F, 0x4B68A0D5DBAEB26C, 0x39C83339F6154AC1, 0xF6D49B65124B78D1, 0xBA89672B8D0DD036, 0x3C451B2F819F74C4,
+					0x3AC7542349E5177C, 0x300780FF002E2E58, 0x3BE93C50346F4483, 0xBEAFE5C34F0928C0, 0x7A126C1FE47EC928, 0x1FEA1FA28033533A, 0x590CC178B6C268E0, 0x7C7010A573B95048,
+					0xA19CA3C3C927D033, 0xE868A82CBABCE413, 0xCA089331327DED63, 0x6C64AAED7DC30240, 0x5DEC2015DE6A8CDB, 0x4813F2300BB9D395, 0xC55288240956BD48, 0x50D76BFDB03EF339,
+					0xBF490E9BF1E55946, 0x3DA6C8A2511DCB25, 0x632E6FB9233B968A, 0x3BC9F7005C3E6800, 0x79853AB553C6DBDE, 0xDF657A93CCD1ED75, 0xCF94625BDADFDD68, 0x5548305BF303732B,
+					0xD35274838F308E81, 0xF46A9DACE63FEDA1, 0x1C31A6CD5A64FF2A, 0x12E35B2D5E65E9D7, 0x307C590833CE3FF2, 0xB982617398051BBF, 0xBC51BD0B10381E57, 0x92EE7E46783FC36F,
+					0xF1D4EE10A745465B, 0xEDB9ED83816627C1, 0xFD600AC70A0D7937, 0xB68054E53FCE9A69, 0x502AC3AF8AA51888, 0x4C9DEFC0559290C2, 0x38C4EB14FB6416CA, 0x1D0543333BC66E4E,
+					0xA29FE544CEF4C265, 0x95A7993B6A5E1E86, 0xCD78FD14B60DD9EC, 0xCED84FFC9549BC41, 0xECA85D028497CEA7, 0xADE5A8BD12A7535D, 0xABEA307653E84731, 0xFBD88B92FF94FB26,
+					0x348166E7BA813499, 0xFDDC30EF480FCF12, 0x25CFAD206BD49C55, 0xC167201D602DE6F9, 0x66A1E258669CB643, 0x2F47832B06022991, 0x78A76D2994A78842, 0xA51A17997616A581,
+					0x2A955BFB6394BFB5, 0xC90E1D46EF8B0EA9, 0x667052D4BF58FE17, 0x5DB62EE0CB7D8188, 0x5F3C9CAB4DB62F34, 0x93D63D103A18B008, 0xCC54E7127FD38993, 0x99BA20C78478DE02,
+					0xEF7C969D708E0BF3, 0x8719E31D790669E9, 0x2A3FDF2A5DFD9A65, 0x1FD10F5EC645F728, 0x82883202652360CA, 0x6BA0F7F1296046DE, 0x19ABD4C262CD05DB, 0xFB042735A949F00F,
+					0x7E017312D98D2730, 0x8450E64F30F9593E, 0xE79543FD0FE0C82E, 0x32526876FC2E53C3, 0x19324F6043A3B870, 0xC5742BDDB6D1E370, 0x1A7EE5FD28E9FA55, 0x4E402E4D3ADE734F,
+					0xA33F9A0A96F96624, 0xF7ADC5C078625569, 0x11915E807965D056, 0xFAD85A5ED1A4D0F0, 0x0E9EAA44870040E1, 0x0771DE77829ED5E9, 0x16437CD68560A7E5, 0x4B057F7FABCD437E,
+					0x6BC5E82C2BDE6693, 0x6AFB337E4C04E23C, 0xAEE5E28E235821C0, 0xFF81A309284E9DDD, 0x201C9CE7F88A7718, 0x0AFC4FEF1E13A7DA, 0xCB6F9D44871570F6, 0x68A68B2D8B5733A9,
+					0x0FDE20D815116EA4, 0x64D09C60A9480DAE, 0x13E1E0983A1C47D3, 0x29146BD4F6C17EB0, 0x23CF1C80C90B600E, 0x393B0FC676CFBC58, 0x524195EFF9624100, 0x5FE8E13CDD2238B6,
+					0xDFF1B26F6309FF6F, 0x466B495110249725, 0x112306B38DFCBA5D, 0x6CB586177A4B58C5, 0x7DD797DFD431D9A7, 0x6648C1DDB39B6A24, 0xDECB80A192B19729, 0xCB08F9C56D25BE94,
+					0x6E3AC41DF0C6FAC6, 0x04FA781DC586B90E, 0xE263C4DDA90E4516, 0x9DBC91F3C762AB22, 0xA6AF16F3FFB9E931, 0x736CD6605931F3FD, 0x75CEC80DD4781854, 0xFC236B648EF61D1C,
+					0x594E68E3FC8C1C8D, 0xD2CAF876443A43E5, 0xFC4649C77905490F, 0x3A24164B19C5ACBE, 0x39DD228C460FF2C5, 0x243690543C59B954, 0xFE0A31357DE49E51, 0xB2BEA3E483DFBC54,
+					0xB9ED75119AF79871, 0xCEBA63B51CEF62D8, 0xE8755F03FB304BA2, 0xD1A784AD22F1E391, 0xB9EAE398228D2B85, 0x1C1ABDF67F19C9F1, 0xE0C781BA65D900E7, 0x5ED57091EE93D1DC,
+					0x9E572108DFD6C700, 0xD2E03EBD95143494, 0x36C9CEC9F12713D8, 0x14F8CE5CDCACCBA0, 0x68BD20F1D68074DA, 0x16A2A115BD726243, 0x7079E28AB393DCE7, 0x2279B5FD86303FCF,
+					0xEF43C2DFD80F4ACB, 0x0A1ED0F71831AF52, 0xC5D6BB4CF0B38423, 0x862E1467090C3BEA, 0xEBDDB5BB1F3AD6A2, 0xA3108E7AA9F36AC4, 0xA7CBAF423EB87011, 0xF0CA934BAC953027,
+					0x3D575CC245594B5D, 0x6B0D21E3313FF57B, 0xFA574B790A52A8D8, 0xE2BFA9913E460B5F, 0x477CC68C5943E66F, 0x9363F26675555442, 0x1D7AB466F4F72172, 0xF9F82592F877211A,
+					0x7F132C34A634AE98, 0x21FE46B8EF7BE24F, 0x035A8954FBAD3C3B, 0xD66D55871DE3808F, 0xA8D08C5B417EEC1F, 0x4768C5860411EFF8, 0xABF0CC731B351C13, 0x6A63E3BB234CDACB,
+					0x380BE4EA89ADEC36, 0x379DB2180A3BDFD8, 0x7DA37455ED62963F, 0x87AE6BE9A5181014, 0xE844B9BA78AFEC3D, 0x1FEB122D131C05A4, 0x9E63DC8BCA429AA8, 0xC7507A79CC18E1E9,
+					0x21C5D2CCE43BE1B7, 0xFA12CB63633116E1, 0xB54DD6487C101B52, 0x04EB7D1E17922D59, 0x2B11B32A2F89EED7, 0xB56FB473BD17E236, 0x916F9BFC6EFED4B5, 0x79E2B068EF8C31BB,
+					0xDD94317BBFC9D411, 0x85436764365D45E7, 0x69DC54A559FCC648, 0xAC5C98C5B6CC1763, 0xD87E06ADDA41DF82, 0x0C0CC3E17F67222A, 0x32ECBCA2C3BA4037, 0x06003361CE2CFC9E,
+					0x33281B1F451EBB56, 0xAC240DA54736D4D0, 0x90A64D71EDAF2E9A, 0x57AC28EC06407FB1, 0xAD9870239DDAF13D, 0x008D6AABC6913609, 0x19F66A33AB8BF8F6, 0x6E4A73F862CB9CD6,
+					0xE4FD7FDF08AAD689, 0xD8F6E196128D05AA, 0x3E2FCA5106C4FD4C, 0xC1622820E0C89D49, 0x1124166556C4A40C, 0x9850DC1C64687420, 0x95F027E4C97051EA, 0x93B06AF0CE81F4E0,
+					0x8CA1466ACE2C43A8, 0x03C649D4D9E147C0, 0x8E4FAFDDD80BFC08, 0x688B0935FF506B92, 0x76CC7B29323796F3, 0xFEC06EC0BE891F7D, 0xBF294A9B88F74552, 0x95F1107B221CA446,
+					0x2D29D830EB31AEBF, 0xB0ACFC85FA52969D, 0x9480262C266B12C6, 0x520C5754CFABBFA2, 0xB884E13A6F39BAE8, 0x788ED91E8E6AFDAB, 0xB5C0E24A92A853AB, 0x9AB3A6071ECEAA7F,
+					0xDD97FE362EBEDAEC, 0xAA18D45E94C29550, 0x2425CE952E39CBA2, 0x51EB8775B18CCA28, 0x3BEB3C5D9BD64767, 0xF5EAE0F053BE924B, 0xF7347FDED6175C3D, 0xCC3A3957218295F2,
+					0xE397C3D4D4B6F05F, 0x536F5F23503B91D1, 0xC74E7724CD4AE544, 0xE3BB9972B4F7C536, 0x7B35EFD5D060D290, 0x8D75C8D7C2829BE8, 0x7AE668789E3FD67F, 0xBAFDCF298698C3A4,
+					0xE449657FE2AF5403, 0x488DD8C92C5EE6BB, 0x4343D67A6A4596C1, 0x1C980BFFAE15E712, 0xE06010DB74C3A4CB, 0xC353CA4DC011ED46, 0x31D19D12A677C3E1, 0x5D3CCD52E0923C98,
+					0x0086056453F37479, 0xFDF815551D0F8A73, 0x5E2933CADA64BE70, 0x173094FCEB247AD1, 0xA36F3566C20A9C20, 0x55E7759F6FFEE3B3, 0x6C1315A107A77561, 0x74354A63D8B32334,
+					0xA75377CCFD9E2364, 0x71CDC2F809F6B2B0, 0xBD421E67AD4773DE, 0x0490B3ED2C42263E, 0xEFB1EB3E000B1CE5, 0xA3E503748329063E, 0xF26E8A183BAC6460, 0x67144F07CF421026,
+					0xA71BF45547BFF750, 0x2650E524CEACA715, 0xC2C6240F9AD3505B, 0x29A3F6EED177A176, 0x6033F7559AED35A4, 0x80967D121037BEBC, 0x48B437354B5C5EA4, 0x23769167C5E4DDDA,
+					0x334D5726CADF2C69, 0x8259AD00E7AD5A1D, 0x51E954E79DCBF229, 0x2ED8FEB46AF80570, 0x063FC99B23301ABA, 0x5F57C5F09DA492B5, 0x421952E0B531FF30, 0x2CF353D477481A9A,
+					0x9AE009A646A33568, 0x097DAD650FFC226E, 0x624E5FE676EE55F4, 0xD163F1B2B3870EF4, 0x2B5987754CBC084A, 0x8C9F681DEB3ACDD1, 0xFF18C54CAD8AC136, 0xBA2029B6754B46AB,
+					0xE73FAE200CF472D1, 0x6B7DE2503B6D2F97, 0xD1DB2B29F17EBE9C, 0x3955F59DA34E7637, 0xF093436AE61D512B, 0x680DD1FAB72FE85F, 0x6A9D54AC2693F435, 0x3B7AA8292A010E99,
+					0x70780DD84FADE05F, 0x4441B22194388097, 0x35CC8382B824D018, 0x5121C8B87BA8A309, 0xAC737080BFCA8CDB, 0x9AB12259E3D8DAE5, 0xAEE86BAF586EAADC, 0x831435766426D465,
+					0xCA66C263E258FCAA, 0x16E8182301F1ACC9, 0x1090C46303F6EC0B, 0x3CA8B5E548F604BA, 0xAABE84419EEF2B83, 0x5F806ED1D8FA7346, 0x8B5D5D27A46548C3, 0x9301FB347FC08799,
+					0xF1117E9E5E86DDE8, 0xC96976C517EEEB28, 0x3D5DD7BC8FDCCCFE, 0x0F9600EF7DEFB170, 0x86B4C20B3DE7FCC9, 0x17BC84AB9E1FE3D8, 0x562E6955AFB1F7D4, 0x03F3314B86C3C5C7,
+					0x13E49FAB6FF0FB17, 0x9DB716E647B9842A, 0xC3834C4C7460E727, 0x5F94CFD6C82DB7FB, 0x3AE20A9C69A20D15, 0x1FF268AF0207CF48, 0xBA6CEC3B3DBE2499, 0x37F586CEB00D3901,
+					0x0FDA25FB3BA6D487, 0x3A778F5976D9EB6A, 0x37F7038A906F8E6B, 0xD0183331067B27DC, 0x2E0AA9848CB25F8A, 0x1D324064211A6E92, 0x02DF6811743A5EA8, 0x51FB586DBC0F7755,
+					0xFA8E14094AF1BD17, 0xD2E716C1FB924471, 0x6AB5B58106A30C45, 0x1A52498275C9AB04, 0x3CC4D6CAD30EFF27, 0x5D67B7B22FE41092, 0xEDB6AE9586AC306F, 0x4C394677EB9AA0EA,
+					0x77CEBD33BFF25476, 0x5D875C02C1451775, 0xD5562C95E7200A05, 0x4A9C01B6B757440F, 0xF26A3950C45819AF, 0xD792DBDA00F64C31, 0x452C3DD7E4C6EF28, 0x1A4FAD7FFF74ADE4,
+					0x355B294B83E57D1C, 0xA4D5CC69841A198F, 0x879F819CC330C04D, 0xC053E321A0BDC719, 0x2C45DE92D5240A07, 0x03F9A88492487B65, 0x02F9C7C39CC182BA, 0xECB50EF6985F15C8,
+					0x2FCCF63F15C7D287, 0xAC5480ED339F0F30, 0xE746A06CF153D542, 0x9A305217E2D215BA, 0xB09507E8D6FE15CF, 0x4DC87E592C433326, 0xBCB7554F50E2A6D4, 0x50F7BFE89B6B2289,
+					0x68BC0B1EF6A49A3E, 0x6297553DDB1A9142, 0x36519D53B1BCEDA1, 0xAC0DB0B0D57E5932, 0x998E7D97AC22CC05, 0x3BFAFCED7866EE95, 0x2ED1AB4E2B9C02AA, 0x0B34F9BAF60768C4,
+					0x944B0B132EE3440E, 0x42CCF4BB3D92AA37, 0x3FE32BEFB130557C, 0x5EB826BEEE84471E, 0x85253640E26ABE3C, 0x55383A927347BE1C, 0x848C20000D9190C6, 0x80F384DD903B6CFB,
+					0xA99EA4E36E3A7270, 0x9DA6A3462A9DA021, 0x0C7391F278ED50AB, 0x2BF1B9BDEE221216, 0xE820F0A7E94DFDF9, 0xD7C07319F518226A, 0x6EA740886ECF2C38, 0x17D92242D76C9F6C,
+					0x8C372D81643FB091, 0x30ADA69F651CC399, 0xDEC9691FD6D4A92E, 0x91814F94ABBCDDEE, 0x137B711C391B8829, 0xC69112278E990404, 0x5CFAC75B45815B50, 0x44F451A972E2126A,
+					0x7864C580282D39D7, 0x547FD632236D1112, 0x71EB13B99437DA64, 0xDAF0AE1DBAED794E, 0x3D8BCDCABD656998, 0x7149C187EA8C1B00, 0xFEDB40A54A572900, 0xC7E641BD921099E3,
+					0xF44BBB32A91F9498, 0x1DDB3A83B571C918, 0xAA5CB86D41DBE70F, 0x5986551ADBBEAE44, 0xD4E242309EA801BF, 0x2B509C1159106564, 0xB595D689CE045AE8, 0xB31DEDEE8747DD0F,
+					0x4B0FD8600D2D0ABE, 0xD18687191DAFA65A, 0x57C457461E25D4A4, 0x7E839641A23B2A5E, 0x04A6A0C4C3676BD3, 0xF156CE466FEA1FA5, 0xCF7129E733284151, 0x2031CD5A8DD738C6,
+					0x49BDEE088B93FAE6, 0x4E45F3A73F9CC7F4, 0xC24F3AE52EC35816, 0x864D92E6548097F3, 0x979A932300A19A69, 0xDC255D66C54F1AC7, 0x88C798E685A9A37C, 0xE8D8A2C0383D8031,
+					0xAA9783B06E10591B, 0x636C03ACC478FBF9, 0x8757661233D447B5, 0x6D95F53143E36EE5, 0x106F58CA21DE455B, 0x7A8A5D9BB66F2759, 0x027DBBBEF04C1E7C, 0xCB7C85A1E2B5CCF8,
+					0xD7DDE976460DA0D1, 0x084060A8EB680838, 0xCBA4761F34EA844A, 0x6B405A6FE4C4B626, 0x288F1D0674091317, 0xA5AF312405D291A5, 0x804AF339442FC21B, 0x30C916DBEE9DB45C,
+					0xB6E30B855D3661FD, 0x89633FE2EA294798, 0x3FD142E7894603E8, 0x740E17DC180DEB81, 0x215903D21FC21A72, 0xDDFB6BC0ADB95E92, 0xC467A7E47C491AEA, 0xAF875A3D346FEDE5,
+					0xF52B0867EF10F911, 0xF5605A560BDC3B87, 0x67C9C325CED7BFE3, 0x4D189677D2F300E6, 0x483D5378BCF2A22F, 0x8A0623456F0C9E81, 0xD9E641536714B623, 0x62FB04B6781F776D,
+					0xF7DF94EF2A5D6E4D, 0x3C3DC7E7AFF0A4F2, 0x910418F5BD5EC0F2, 0xFE09A2AB376C9FC6, 0x1284003ECD8BD909, 0xA50B5B0228C82F77, 0xB49BCFBA448260E9, 0xCDBC0DC5C1460F5E,
+					0x92BEB6B9E70DA227, 0x2F27D0E4212BED5F, 0x6DFC842E27D3B4E7, 0x11364CC4170AE5F2, 0x95590F66B01A3923, 0x4445B2784B7B864C, 0x5B21D445A2E01FAF, 0xBBF7515FBDEE09ED,
+					0x113CC7DC928AC826, 0x47B9F202C06B640A, 0x50F79FCE306D9E17, 0x70B96A0D015D275E, 0x6567F591536A1519, 0xA8FEF65B823BABA3, 0xB6A2157DBF767E1F, 0x5AD022E72DC99201,
+					0x8DAE500ED4AF7434, 0x7D7C2E448B930FFA, 0x955990FC5DA80FD0, 0x89FF730D040B9F22, 0xD6EE7471EDF395F2, 0xB4728D658F4622E0, 0xB4028972D58FB656, 0x76E4892EEE3F7940,
+					0x56B69512F82F648B, 0x397278A97551F9C7, 0x184811C64BCA8CBE, 0x46F0402F8BED48AD, 0x4946F9C2548C63D0, 0x18C088654721845D, 0x45913B1C735A0327, 0x9F6B22AA1B2EC071,
+					0xB20487B40D150A0F, 0x64AA49458FE5F088, 0x6E8394CF126758D5, 0x8D42E83BF68C5B8B, 0x1804D4914A6C5B56, 0xC4C87DCCD22467BC, 0x844D6B0C4CECC9CF, 0x34A93EB4A3720705,
+					0xE76C6AFE95AFF014, 0xD298447A6E1913F1, 0x1DB8D7CE3099C54A, 0xFE60C16A26BA12F4, 0x86AD09696C0268C7, 0x243FB32423A7B783, 0x2CFAC29BEA846A4A, 0x860A5CA63410F55C,
+					0x6AF78C688D4B672D, 0x883697470EDDCA07, 0xAEE50AF6D39DF053, 0x07235EE68DEBA17A, 0x2338662C2F506EDD, 0x177B7CB9B0553C88, 0xCD944BE2B369E150, 0xBBF9094E0F6DA738,
+					0x46CF4B054F578656, 0x24D0821792B7815E, 0xCC9E3312626B919F, 0x42A95698FCD4845E, 0x49C014977FE542B3, 0xAF0664ADBDE5B80F, 0x80D722221249803A, 0xC13CF38906CD2573,
+					0xE5F0AD05DE9FA41C, 0x3FF0CB4FC37EB5A4, 0x14473DD20DD6AF80, 0xCED09AD3FF297C02, 0xA3772A1857F23600, 0x2A1856F12A7859AE, 0xC8169C8154C8ED11, 0x92F3376D64560DC7,
+					0x76203A108BBC8CC3, 0x22A956095E00B2DE, 0x87A76A4D0FA06D12, 0x0BC192A68F0B4158, 0x3A551DFB2D4DF5E7, 0x82D9BCACCEA27D3B, 0xD7C57EE7325BD1B7, 0xB54D205FBEFE7F39,
+					0xAF6F103AE63A1DFB, 0x295F51D5DE35D6B3, 0x8FB8A32D9AD95392, 0xDBD9E20B78BCBEAB, 0xB55931C65E8F6135, 0xF9E422632BE31375, 0x9C2F3C1534AB9806, 0x719754F10AFBB7ED,
+					0x3626DEAACB9567A1, 0x278DC80C89609462, 0x6046797F05088D0F, 0x036B3C016C151CC7, 0xD8894A82FE862B80, 0xB25D174F67E30E4F, 0x6F93F30A09BDC185, 0x769BC238E806CFDC,
+					0xCF3A967DE7F2906D, 0x489BFA6502515C68, 0x666CB865061B35FC, 0xFC6AC8F4E849EC5B, 0x64588633E2399C20, 0xEEADC769B50EEDB8, 0x265E90E4B11E39B1, 0x2FB25A20049507ED,
+					0x9144EDAC9CC51028, 0x5C377B343E39E008, 0xF33DAF8B57C2873E, 0xDB0F876C41D45ADF, 0x9A936781DBC9D703, 0x83D47F0169FD221D, 0xBED2FDD063183841, 0x6D9F4177210102F4,
+					0xB5A340065FB326D1, 0x66C25443A15B5BB2, 0xDD74912BF31882E2, 0xA8BA1752803AB5D9, 0x606CBE94C33A71A7, 0xA6C6E302B996D58A, 0xC9F111463720A896, 0x83AEA632C0CC4360,
+					0xF54EFFD25D6CDFC0, 0x032569CA59D99861, 0x494D4C28F6451487, 0xF27B76AF1C23DA5A, 0xD0ABA7D4387F126F, 0x1B7AC3F4D3BBF92F, 0x03B1BF591A80B29A, 0x24C963B9EE35C312,
+					0x450230185935FAC7, 0x1DA166294D5A06B5, 0xB89B7869421FA08C, 0x09CA62EFE1560F33, 0x5F01FAABDDA977D4, 0xA53FF4122E65C9DA, 0x96053DE36EBD0C1F, 0xDAB23261114F3EE6,
+					0xDEDF7EA6D3ED99B7, 0x44BAD08784EBD0BE, 0x471FBF33122BFD79, 0xB566BAEBFEF8FAFE, 0x74487B60D7674F5E, 0xF2BE6C8D69D30A40, 0xCD90C2C4D0B969B7, 0xD2E2B4394ECC6022,
+					0xAFEF7B86F2D702DF, 0xA36AF70525EB4836, 0x732DD3CC1365D0EB, 0x8A4D3567D38B9F01, 0xE0F8F9D56C0CDAB7, 0xAA4549CDA1DC5EE1, 0xC7FC8C6852DE0368, 0x4EAAA998DCFE31BB,
+					0x59994CD576FB17E1, 0xD9509EA1DD6395ED, 0x93287E83B616D4A5, 0x93904FAFD9DC2123, 0xCF844EA7E67568AA, 0x949422CB755F83E7, 0xF0B077ADA19EC0E2, 0x518700D049CEB51A,
+					0xC9BE782ABFE0FD7D, 0x0B8B46DB62772858, 0x10C23D06B0AF94CC, 0x11C2D8A9EADD131C, 0x74DF6FF4D88D0C66, 0xB0317739222C6734, 0x985DCEE2D10008B6, 0x66AE3D7735538C08,
+					0x38551727CBA7153F, 0x03868A064D67FDC9, 0x45355118AB11BA55, 0xC36CD93DA8B35CB7, 0x32EFAF37349889FD, 0x6841EA5D730D0F8B, 0x7F612A54009F6DB8, 0xDEF30B843D20B4A0,
+					0x2397D72FF010C13A, 0x443BDB83D14C75EF, 0xC2516F885BF8FC63, 0x5E4019B38AD34371, 0x38DF1A904FEA0ACF, 0xD00BF91AE16625D1, 0x72508A7DA37001D3, 0x82077679361242FD,
+					0x4CB13907AD089D80, 0xEEA00390152B3221, 0xC123D3FE3640297F, 0x0B9C82C452428B6F, 0x003F1A1F5D5F95EC, 0x9F416F2AB196A692, 0x627CB2D309106438, 0x2F2F5FFC62A73E6A,
+					0x25304D861ADFFFB7, 0x33CB576DB41DA4C4, 0xFDC733E0D979D14C, 0x06E222CF6426607B, 0x81D6F5CD1365ED3E, 0xFBF31865AD29C0AA, 0x47BBBABB5734B6E5, 0xA157DE97D9F83C18,
+					0x97E3F0950E45C1AE, 0x1D0B4FA28CC7569D, 0x465A6A6E828D6289, 0xD3524D9818F4BCD8, 0x2B53DDECEFDDDC79, 0xC299559282C7B5E8, 0x52638E8E499CD587, 0x03128F1540A39532,
+					0xF3014394B3FE83AD, 0xCFACBDA20494F57C, 0x6D1AD03C4189F7B4, 0x698FCDB6E80E2DD5, 0x45342AC3EB3F275D, 0x056ABFC8CE8A5F98, 0xD2B781FD6D478F63, 0xA8D49CEB351BBA6A,
+					0x9C0FC6901FF7088A, 0x8AB6B70DC3492F81, 0xCC82136C69137B7A, 0xF7AF620290B04B33, 0xA5EF02738C983D73, 0xE361F5848F6C2E34, 0xF45BF5C87A49F7E1, 0x5294C6631AE524B1,
+					0xCACC1B8983E99521, 0x758D5191ABC36605, 0x2CBF93BFDA2F97ED, 0x9BAD2F038C6EF3E6, 0x14DC2833A77F51CA, 0x19F353DBE8F7A70C, 0x1EAD8FCA0393490E, 0xCB3733721273E9F2,
+					0x30086C407E30AF57, 0x2A3CF7DD1087D102, 0x6EC59B483BD7E517, 0x35BB0BA19A091CEB, 0xBEAF6F2F06049EAE, 0x15A08185F9D5E871, 0x0AE4ECD4DD9333C6, 0xE61160AF291C2788,
+					0xE35EAA68435651D3, 0x42DAA9A27EAAA9FA, 0xC7D05A65643384DE, 0x7B02911D3AE6DA5A, 0x78E2645997F5CFCD, 0x7F1ADAC71FCFC25D, 0x724C5260607A65F3, 0x2767842A2DE34101,
+					0x31E9A9AD263E8DE3, 0x3C4645F5931B7942, 0xA360EC9041FE7A7D, 0x3714CB6F814B8ED3, 0x63E4D4760657211D, 0x8BFC33A047E2A2A1, 0x67E87EFE08F71798, 0x184E1A1DBCE82AB3,
+					0x55904B8CE0A0A4F5, 0xD67670146D22C665, 0x5135934E9AA82383, 0xE15BCAA9F3061889, 0xF27FB783DB6B391D, 0xBD6DA918FF22AAF4, 0x0E75E1F7D4F8A0DB, 0x8EA45697E23F48CE,
+					0x86AD1801793CD168, 0x3FB14EB7188F119A, 0x57CAF2E70831D518, 0x363FD32B301187B1, 0x3DE33F8D2FD3BA7B, 0x1405DE0F9852DE89, 0x8F214548421177C2, 0x98460E0CD56C55F2,
+					0x3524CA49E60E8D4C, 0x6A6ECE6F6D9720CF, 0x12E7682E5048E6D9, 0x83B583A8D9D76FB8, 0xEA2E2AAF0086A4DE, 0x058BF2F411FB2D61, 0x5D48876D73929202, 0xF286001B297EE16A,
+					0x75D63C8E806600A1, 0xC0409577A333DDC0, 0x5675A2F931E11114, 0x17566E354034EE05, 0xD1B7317FF99D2058, 0x54C9982E982AC089, 0x29FEFC921D2B7D8D, 0xD480A75DABC536E5,
+					0x93935435F61596F2, 0x3474362B59C7E4B1, 0x12F7BCD7D78789BE, 0x4B7565F109A1078B, 0x5B8257C5A7B9939D, 0xDA50AE62F1E47A06, 0x89CD54CD34492E82, 0x2786A2B5FB3B8137,
+					0x8118EFB17E8B504F, 0xFE7048AF020790E0, 0x3BA2387F6785528D, 0x95C357D72054A16B, 0xAAE56AA99DFABB05, 0x7BE98F681D56B233, 0xB50C46AB83CC391E, 0x830A679FE513F5D6,
+					0x1C3DEF5334B42683, 0xB412F560EA094745, 0x2A946A2E9BB3D45E, 0xF1AD05A220D91FF9, 0xD4844AC8CD87104F, 0xBC990E1DCA237C23, 0xEB1BEE39C5D416A4, 0x2DDFAA0188F51EA8,
+					0x62234F6589EBB1E6, 0x743E22BADB916D7D, 0xDD400B3DA25E4792, 0x065E961E67AF107B, 0x485A3D449067AC04, 0x1467AC1CA5F5507D, 0xE9F6CAEAB76A364D, 0x56FD647DB282D2AE,
+					0x3D2FA7C15751488D, 0xE8AF872E147A29EE, 0xBD6B54647317EA63, 0x742C41CCA3685243, 0x8E52370384BF3263, 0xC6983435FCCA28B6, 0x0DD738D73E8167C8, 0xF8C66B136087E3A6,
+					0xF69FB03380E268AB, 0x67792F375CF3BE7D, 0xDB760FBE63122BB7, 0x5F1C2DE0CDD0EB95, 0x086B37C5DF503BB1, 0xF7AD44286FC4478E, 0x24014D09C048D383, 0x6499849D77573775,
+					0x2102FBA38943E282, 0x8AAF92F85277D580, 0xD9805893CE5AA07F, 0x8383DD386ECCC99C, 0x4197295E1F186D56, 0x89F7968C9BB7BF72, 0x2C5BB08080B00240, 0xEB34B78081C02E52,
+					0x4D18441E3C9C6674, 0x8E8BD8B706EB4588, 0x8E58A2C96A604804, 0x020B3A3A9B2267E5, 0xDE7E70B897FD1B4B, 0xD5AF795EBB882A66, 0x439372FB80941805, 0x3CD001B137010F09,
+					0x5B92D8309733C5DF, 0x12019BE7352B3671, 0x5997961895D4E886, 0x345CF80B77B1E2E6, 0xFE37DA669C2B0219, 0x3506A6B5249E050F, 0xBEC58888D91A65A1, 0x32507B9F62105648,
+					0x90E294D2DA98A8D2, 0x71D95BFFCB0DD7C9, 0xD018614223DD7599, 0xC9D44A5A993AAE62, 0x7E030F9D66809D12, 0x13BB2CF2097EE9B7, 0x11161F59E528D818, 0xE6D47B2C4E870790,
+					0x7214E732D5472F83, 0xBDDADC66023594DF, 0x615ADF899E9970DF, 0x555AD5FABC672C7B, 0x949F9E5507CA8F1E, 0x72844D9B3AC53C18, 0xE90FDB37CFA8033B, 0x9ABD93746F883E97,
+					0x030EA49ADF3BA2BD, 0x6BC50B6CA8A9EA8B, 0x11D43D9DA82BE4BB, 0x4CF9FC4682FB36CD, 0x265375250BBF9812, 0x9E08D62938CBCDBE, 0xAC9DC2AE6CEDDCE6, 0x68F8F96215CFC8A4,
+					0xFBC19A8A95AD3CD2, 0x7950F138CF63F876, 0x32C6AEEA2F2295C4, 0xEC270AEB76E79176, 0x87C9BB755EFB4AA4, 0x77B0418951F71077, 0x9F40450E80998E19, 0x128933FE2DBF0446,
+					0x7AEC0CFB44813850, 0x92863869DA2BC234, 0x0B0EE3D1873BBC0D, 0xE8924EB9C53B0C07, 0xBA65A8F2752288F5, 0xF134608C3D4831B1, 0xCE2FA9C5E20A6B25, 0xEC75896D2E7E3001,
+					0x4848D0AF2D933F51, 0x1CA6A7EA09AC4CB2, 0xEC94B1E498F23A51, 0x2BB53169991CA09E, 0xD6EEB887505E7A84, 0xA4C286ECD76DCE55, 0x24F37128AA065A5E, 0x2BB3803ED130F7CB,
+					0x97284E201A7F8567, 0x975431E592095C73, 0xC0633611C2950F38, 0x3ECAA679B4441092, 0x1DC2B7EC57E3BD9C, 0x14F40AA928CC9047, 0x24C07B5D06528010, 0xB25A937B880802D8,
+					0xEF145E5A3C9A075C, 0x3A6E586F165250DC, 0xF8A715C6122E2443, 0xC4413121129ADDBC, 0x2BA4A46F56FAD746, 0xB82027F959B3FBCA, 0x7EF74B7D81040E03, 0xA1E1E9FF8F56EB57,
+					0xE3D297FACF9A9AAD, 0xD68D5F0F5C54FD67, 0xE3119328310BB9F3, 0x4D83DC42DAE9E880, 0xCD76E40C3C41FE4B, 0x0561488EB65C7DA4, 0xE452FF618497AF68, 0x2633C68EFEED97F3,
+					0x65B630FCDF2E2F3A, 0xA3FD14BA15A21C35, 0x92ECE66A6721FDC4, 0x671C6FAAFBCD2B59, 0xE82E818D85225B03, 0xA4EAB912B603B5D2, 0xDEEF6EEF26424DA9, 0x3E481D35B120C84A,
+					0xA2AEA5BE60BED804, 0x6066DA278EFB7B05, 0x086D7600F52FD0F2, 0x9F25E33B8E36D4C3, 0x10A8C9CB04EE9A2C, 0xD5FFFD5B55D464B7, 0x7C8314D7AD481BF7, 0xE3FF0F707C2BFB29,
+					0x7B2542A185910A4F, 0x8D3FC8246D6EFB24, 0x9D9C476F44740D21, 0x587164C2877A2087, 0x4E74F510AAA2AB43, 0x4AA273F06CEFC82C, 0xD5E4E3FD51E398B7, 0x1B06BEE7098C1F2A,
+					0x6FCA57C2DD6A9E2B, 0xC600A04D61E421C5, 0x6A1203CDEADE6773, 0xEDCD0976596419A2, 0x8A5FC6B1BF37642E, 0x3F493FE169D22874, 0x5F5C7079CEA87A20, 0x1807B70A97AB4944,
+					0xE15184E30E35B35D, 0x5F9BD8F8E386075A, 0x3B3466C78F43EBAC, 0x17C1EF651B9D394C, 0xE2E476559E8B1369, 0xA32D27C3181092C2, 0x3E00DA1155252881, 0x93361DB5D2AB37BD,
+					0x78014CC709591F4B, 0x526ED9132FE8E173, 0x021321F38AF10205, 0x2FFC67D93F297AA6, 0x743DFBF9E2972010, 0x71488D1D6B651952, 0x5D3EDD4E062E2A90, 0x348F187D6D2EB0F6,
+					0xE0635D65CA00845A, 0xB3A246170531CB75, 0xDC7EC2726BE5B6BE, 0xFF6DB28AEF3E4C03, 0xDEAEDFD866A9856D, 0x2468A76BF8DC27B2, 0x0E9476E91B89FA33, 0x7994DA17A321E47B,
+					0x6B130BDA67C61FD5, 0x30A4F64A3650D253, 0x508419917ACDDBA5, 0x690EB3439337C707, 0x402121ED03538853, 0x9D13AB0D053E1A68, 0xDC33C67A65E1CC0E, 0x236E90D9BF6C56DD,
+					0xA543E805386BE8F6, 0xC84669C2404DFF06, 0x907A4D5FCAD5111E, 0x04EF097BA77F4A4C, 0x9D69DA6F618221F6, 0x8DABFC13BBE61A1D, 0xBBE2E6343FC459BF, 0x37235679CFBB8B9E,
+					0x4C004217D18E507F, 0x53F11F5363566F39, 0x9EF7D6FE1360554B, 0xAE3237C7D20AED50, 0xEB628D879C4C2258, 0x41DE11AB1E44DD1D, 0xEE41C67C0E6DE6AC, 0xEA53476B1E290960,
+					0xC5603D94EBDA884F, 0x5778DE759F831E96, 0xB7D5CFEE6BFA1DD1, 0x5DBCC06CCA3BA38F, 0x4242225E05B322DE, 0xFC6E0187D0208FF3, 0xDC9C3A1A5D720156, 0xFB5030113390143A,
+					0x566152B390E922FB, 0x17B4F15AD6626221, 0x38207E8D5130C2D8, 0xDC2BB3138D681F27, 0x3C12E21788CD3729, 0x48C7FF146287626C, 0xCE78A26274F05495, 0x6531A6F2665D26C1,
+					0xBB600997C9B65A78, 0x67BF6EC629084EA9, 0xF92307B13990A789, 0xAD81736484EBEBD7, 0xD5C7BAD27F2A7BA3, 0x1E20734E2A067AEF, 0x211E5DB2B82E9256, 0x1814B69EA51C835B,
+					0xA7DF120DA6427E5F, 0x9AD9E63EC3845455, 0xA34FD6CE51C40A78, 0x2E827E559F1D084A, 0x22469753DDCED0AE, 0x4FC1296EFB048849, 0x829BC9021F591CA0, 0xAE359F4806FBB0D5,
+					0x84A7D503177DE437, 0x020819E1D305C18D, 0x225F3039AAD1AAAB, 0x5E8F52A819EFD509, 0x4BEDEC2DA89F0567, 0xE1FC54DC8397DF32, 0x9DE184FB1157446B, 0x0F5EC93178C02EA6,
+					0xE4B66527DD6C502D, 0xD9D585B1AD137EF7, 0x093A3C66510BF0E5, 0x617B2DAA8466B33B, 0x464D9D4B039C5C93, 0xE52A9C0B7EF44EBB, 0x8067B706D0B3F8D3, 0xECCC5E276E90DA8E,
+					0x4A4BD5DA41E6BA4B, 0x690C58EA378F3F39, 0x0CBE101D5DE94B35, 0xCD86D1C692E1BF9E, 0xF189FF6E2FE4BCC8, 0x5535B4A0F5CDB9E0, 0x0D6D833D83349368, 0xA0FF77E9D639CAFE,
+					0x250BE0816151F062, 0xD03B310846CC656D, 0x2194F16BFA99D2E2, 0x2CA92BA374F56FF7, 0x8D9BC8D834FE91D3, 0x8CE63A7D50D9566F, 0xDB7BF40CC088B022, 0x75C53F7BC6017AB9,
+					0x78F8E9F090AF12BD, 0x5D50F852317DF45E, 0xDFEA66D0EEEF155F, 0xD889C487E1746A03, 0x35E3527E1F2F35EC, 0x78392194DBF23CA1, 0x013A24F8F8268C1F, 0x8F0C97B54E94AAC5,
+					0xC6CA19ED96395F05, 0xE5D5C157AFBCD07D, 0x978CA112495EC57C, 0xD7D61FEE5A9DA681, 0xD27988318796E4C2, 0x51A5A05C1B2A1328, 0x9EB36435475B032C, 0xDAA32A12FFE7C0AA,
+					0xFCC4892E981C183E, 0x7EF01C53BBAFBD44, 0x186311E758E5FFF4, 0x6F95C0BE67C44DDE, 0xB5D9EDBE34B58E88, 0xD415B8395D0EF909, 0xFFEAC2AFB37D694E, 0x0B231F04AAFDE623,
+					0x9BA4E6BD080A6DE5, 0xD9417E86CAA37473, 0x4B09A55A0772DEC2, 0x52AD79A337D4F294, 0x0137FE232A5410A8, 0xEAAE845F082B19A7, 0x88612CA220060A6C, 0x0DE27E4EF35740E4,
+					0x4FE22771FDE87E25, 0x83BB54D612399F2D, 0x539D766E2BB6DF59, 0x59CC973A39A865D7, 0x3E09D78DFCC2ACAB, 0xAE8D2E12AD5802F5, 0x51C4704CAA1C33DA, 0xC5F610415D7AE786,
+					0xD2A7F017C2E509FF, 0xAEC7F19D99285886, 0x7F182A8955D5FE1D, 0x11FEEB614369D884, 0xFB8561019727B4AB, 0xF1AD50C730B12247, 0x03A114A61B531A39, 0x603E28B0DD51E484,
+					0xE2D75AD3B4763890, 0x9C6ADC8E03119844, 0xC9EC83452CAC120B, 0x0F7D4CB2554F2A64, 0xBD128B37D6576808, 0x45AEA7A7E1946060, 0x5419AE0CF344B10D, 0x73FF5B17D34E0199,
+					0x37C1A3D2B32410A1, 0x15BAB273D71DA37E, 0x6931B22634176607, 0x13C1418AF4C9D0BC, 0x9ABCB8D4A9FDAB38, 0x6FD6317B056BA04E, 0x42EB9EE0D5BA1B6B, 0xF15C340097323FAE,
+					0xFD1B919D85FD512A, 0xC45E7AB5037EEAE6, 0xDB7A58F087E13C39, 0x664DAD9337EB6BD3, 0x788AC7889B39850F, 0xA7B85453EB45D0E1, 0xC7037145128C0006, 0x3C6E84D533A72D5C,
+					0x3D7C0E2B673A09FF, 0x8847D54F0339858E, 0xA26C132F32A503E7, 0x6726E3D092FF4695, 0x32ACC5751FD7C1FC, 0x6E9B16AEA63D628C, 0x8C9E013A7AA02A47, 0xD3F585C5F4D605F2,
+					0xE5081C8059C55149, 0xC0532757818154DC, 0x0EFC2CC3E3CC95BA, 0x9835019B9352F7C3, 0x93E892AD8B10B567, 0xAD4A3C5A16BCDBDD, 0x96F7B3F87ACCD8F5, 0xE94ACDB07DBE72B7,
+					0x249A827AF072CC0D, 0x5A01BCC0874FCB46, 0xEDF8980D9203FEA0, 0xA8A7906AD5086B2F, 0x3E120D368D74C984, 0x5DEA3C3386435BF0, 0x0FFB8B3D3BE2BE3E, 0x7A569D9C5A424DF3,
+					0x868C9554E7ABB4A1, 0x1D74B5229B8B70FD, 0xD7B6E66C61B98C4A, 0x3A870F5E7880F741, 0x10AABD8B23D1DF00, 0x30E13C1F84155F74, 0xCC70E2B0C9FDD691, 0xAE67CF76D0DBCAB0,
+					0x603061215B12D885, 0x41503D23CA30B1D7, 0x32681D17E3917926, 0xEF89EF19157DAE28, 0x033237E9C9AE189B, 0x8EE6543086535E22, 0xF49FAB01A461C20F, 0x74792B6B19CA958C,
+					0xAC7D289B24BFA2C7, 0x2D7C9278D5F09B45, 0x4795EDEFE719E83F, 0x7320A15FB65650A5, 0x5A162315F5E38E9E, 0x7ECC17CF012344D9, 0xF379D936C0D8ADF4, 0xCA6A17CD8B1A0CB7,
+					0xBBCA1A2E0DA3367F, 0xBD3B452E3B780A1C, 0xA0E061B0A9336284, 0x2CC4CE4E1A3EF326, 0xE7A0EF83A8B5E92A, 0x244B4E1AABF05F86, 0xDD756EF027FC18A6, 0xE1FE5D9EC46C831D,
+					0x79147FC08CC1C7C1, 0x817B03B68457D326, 0x9875F5840CD2637A, 0x7AE932E444D4B1FD, 0x77E491EAA3CDECE8, 0xC5E0891755F483C3, 0x2A0A62ED4D0D1102, 0x439ABBC00CB0EB91,
+					0x17463ED8242687E9, 0x5CE6EB7BB68402E8, 0x41D57E6669912581, 0xA818730B5910BF7B, 0x9D97CDE6BFADDC60, 0x5D02644675124B73, 0xB8309E613C27CC70, 0xD5BFEAAA15ECE43D,
+					0xBDD878DA688A962E, 0xB6DB431CA343EDB2, 0x3D0F289573C0243A, 0xBE0506ED5783960A, 0x008C9691248D395B, 0x0DFBBE08A9B5CDC2, 0x16304534B6BB5C6D, 0xA5B61495AC5B3950,
+					0x93E33BEFC150ECB1, 0x9E65D2A3E141A823, 0x21071AA164A6C703, 0x027A7770953A72D5, 0xC5AFC265E75F271F, 0x4DD4E553A3F407FF, 0xCCF0AD02CB9A3E74, 0x2650B14522073605,
+					0x32E4E7DA56E22A9A, 0xA6B23D4C7AD4E04B, 0x17811B0A0F61921A, 0xCDCE77797CDAC9C8, 0x51324E9638B7DDDA, 0x1D4CCDFA25CAC977, 0xE7AC8D2929D9A411, 0x6F4948DEE35F9287,
+					0x8C6C9B044A4C47EF, 0x0D96C444E255131D, 0x686B5B916F83966C, 0x489BF06A6D113AEE, 0x4A9D403CFD4B37BF, 0xF4BF6913B538A19B, 0x399BF70364D17657, 0x60D4E621AC0F7152,
+					0x42A6F663F245ECCA, 0xC5CBB6811E2DEAC7, 0xE923C659BDD64529, 0xE0AD65ADACD5AD22, 0xEE21A2C3BF9C35B4, 0xAB390BD60497696D, 0x9C781F3A3E9F782E, 0xB90762BB51D29854,
+					0xB7645866840FEF91, 0x74B8863637E9E8ED, 0x978A40FA2798E75A, 0xDC1B9039F4ADB031, 0xF5FB08B9E8C40E2B, 0xF9419A379399EDC6, 0x87B4C31DB8842EEC, 0xE8D4C8ADBE44CFED,
+					0x7846F367CB000EFB, 0x7CE0BD2C15A4D811, 0xE236197833414304, 0x1EFA79CC112C2B2A, 0xE2688856CA6B37AE, 0xE14B9F72D2CCF7E3, 0xFFBA18107C22A19B, 0xBDFE2F0079CDA30C,
+					0x95E8A5F36FC1B658, 0x36D7199D3A0874AA, 0xA15AEE344F2B1B93, 0xFA60961DDF75D51E, 0xCABA3B47F946E71A, 0x81EB527C4EFB622D, 0x8657531FF12073B6, 0x089F68AFC0B03DB6,
+					0x5AC2A7BE06CBF446, 0x8A9C772A0A119419, 0xD4FF6585BDB74489, 0x408EE343B64DA7E8, 0x4FFDA328850F036F, 0x6DE5910701E429C8, 0x2D6A31AB86C6FAAC, 0x90A95B52FF63A774,
+					0x3E18493A96F82075, 0xA9D861B896460EDD, 0x1E0728833C866E01, 0xF5187A0B15A30C36, 0xACEF4C19FA5D37CA, 0xD740B13152DE2B2F, 0xBE35BE9324EDF971, 0x613F60E124FC1C01,
+					0x1E2907EA1DCA87EC, 0xFC200D2B55B9AD0F, 0xB8435A0483554551, 0xA8E5D92EBD1523EE, 0x49024C258FABBA77, 0xDFB2690C8B9D7625, 0x8E9060EC42767559, 0xC66DFCBEF5399EC2,
+					0x6685EBBF283D5793, 0x643477BE0F7CA1D9, 0x638CED07B3E60919, 0xC0F7A7D2658A4BF6, 0xCCB564650CB6B473, 0x25AC95612264FD40, 0xB55A9654CC387B4D, 0xC54E83F8B20B7E07,
+					0x6D236C289714D02B, 0xA960A4661C244AD3, 0x77222DA18D1793FE, 0x8E28E681742AE96C, 0x5A0B40AD4287F09C, 0x4D883BFA377C0094, 0x8D7F0425612A020B, 0x02A69330A0E639EF,
+					0x122AC593C77D72F0, 0x0286A76B74D2B7F7, 0x4C96C67E78EC0B5D, 0x826F967BE7F85187, 0x4DBE687157A10869, 0xEFD151E03A6F3115, 0xBE78DCFA74497B5D, 0xD3652E19B4AB1EDA,
+					0xFA4FF24993ECFD59, 0x82A2A63A85B681E1, 0xC5C49D8EEFCB4F97, 0x25D8653A422CD861, 0x49476D4B396E7E4F, 0xCE1991684724DD60, 0x533FE55D8E69F7EC, 0x70873A948650A46E,
+					0xB233B6966BA70E80, 0x4F1718FE5042D976, 0xAEBA5169DB03CD14, 0xB33275E2CA820A77, 0xBF65A060977054F8, 0xB08ABC3258796428, 0xFB688CAA4C4D29F2, 0xBC449E0B557B3A9A,
+					0x06FC70FE24A94F4D, 0xEB150D28F5998845, 0x8A9F8A7E582DA25E, 0x7970D25414DF21FA, 0xE12C0D08EF5A9F33, 0xD0AD7CA2269FAC60, 0xC124B4F04DAAEFA5, 0xF103E9A2880E2538,
+					0xC850663D973C77B7, 0xDC804A9609E27385, 0xF84A3EC379E20985, 0xA7583118AE3A871E, 0x56C22A6262025D99, 0x88816627400129CA, 0x0514341F0702C9B0, 0xF1FD62583F13DF9B,
+					0xB2F87E827E9D897C, 0x80A35F8B45E04C9F, 0x3581621076E3571A, 0x9D4E9D3BDA6578D2, 0xEBB5181F332BC0B2, 0x4B193E0EB8183E46, 0x015AEA15AFE114ED, 0x848438E7EA288C95,
+					0xF625DA099FF3ED5F, 0x87E72A861527BCE0, 0x580930652EBE9279, 0x818EBE1A98513A23, 0x5696F8E0DE3106C7, 0x1D6CD89925F7AE60, 0x31D0D65CC6160C77, 0xFB679B79A61A3D11,
+					0xC20D41B8A33BEC06, 0x646502507D3F108A, 0x00D23311937A0620, 0xA1788F048773A0EC, 0x1CE4BA72DCA29E88, 0x7E028B70F78DB6DC, 0xC4CFE7D89F641714, 0x54E30C50B56F1BB8,
+					0xFA93CA999FBD6204, 0xEF934B381CFBFEA1, 0xB808D13227CEC8A4, 0xE2CFFB5E78F6729C, 0xECDCA0C3B7AB0D4E, 0xBD253FC9E0AF4663, 0x174686F1552C98FB, 0x9967F755E812C582,
+					0x4DF4DC9B2C801F04, 0x0E0845AFD603A5EB, 0xD8C8C4FCF83EA5AC, 0x30CEC3DFC8E954C8, 0xC9E5E702F95BC481, 0xE2E3BA5D51C70C8E, 0xC5EE5A6CA63B1739, 0xE109284343B74B99,
+					0x10D6632FD0A3363D, 0x59131089C0C5942C, 0x87BFE99DAC1522DA, 0x62A327E4C64D1BCB, 0xFC221700D196C856, 0xF5566B00BE8CC1A1, 0xAAAA753F6C8BBF53, 0x036756ABC28A6FC3,
+					0x9CF65520EC47B49A, 0xD5540229AC01E99F, 0x89060617B82C6119, 0xC851B1A14AA262EA, 0x8AB19FC1E2601622, 0xFCA87C570DE529F9, 0x63074AE6914DC53D, 0xE916919CBD81A431,
+					0x3C66781E369544B1, 0xFFC20ADDD8A3D68B, 0x85A003F1B7B37F98, 0x6F3CC72E434C0B7A, 0xB9D8D3C46BB908A7, 0xCE3AB104ECA69840, 0xFF308BEBF4A58462, 0xD70E8F246C47DD9E,
+					0x01F512A88B6F2B6A, 0xFBDD3CEF0ECD6269, 0x87D0D501F0EF4994, 0xCD41CC0C0C748300, 0x3738442236441F59, 0x2DDA5BF2C30CC67B, 0x965AC17B6C3031BE, 0x278D558BD4524DED,
+					0xC657C88DC37847D3, 0x55DAC24588F80318, 0x4ED0F5B7A7F0338E, 0x886D5ECC9493DEA1, 0x331D59FCB828C8FB, 0x9C45D46967DE1449, 0x60229F5C6175AAAF, 0xEFC1B6950097E1EE,
+					0x35C6509A01A39534, 0x0FDE63D9357EAD03, 0x01D4CC44F4D9DC6C, 0xD8004F1BBB9E6DA2, 0x4E0563B634A3FB13, 0x43057AEF918441F7, 0x288335A2E8128516, 0x29831364B68D02F9,
+					0x7CA8D85C99411012, 0xB5BB4E13A930668D, 0xE55AC85CEAA4F37C, 0xBC8592069CD63902, 0xBB984DFE93CA1FE0, 0x29646486B5E9A45D, 0x14288B5783FADA14, 0xC489FB43386745C5,
+					0x79012F10D7D872CE, 0x1EB82041C599B8A8, 0xB84C4AACAA638289, 0x59F81066C72B60C1, 0x69E1CF209B920857, 0x60F16B25A6BC2029, 0x836E3FC00A6295C3, 0xE713059D5E7C863C,
+					0x4F80358049A07270, 0x159E39E1B70C784C, 0xB15483122ADD81C7, 0x209763047757189B, 0x2AB307A7696C9D94, 0x9FE5038A88CB720F, 0x7D81174D61919DD6, 0xC065AFEC3568B47C,
+					0xA825DF8052688578, 0x755D6478F183AED9, 0x28A48CCC5CA06E50, 0x50E43AB7FE4034D5, 0x09C5509AAC7093BE, 0xDE7982939022A257, 0x3B3C04D901B5CD36, 0xCF500814E9524E17,
+					0xBEFA5231A91036B3, 0xE7D56C6B65AC876C, 0xA2CA4A8D19271EA7, 0x50F2D5DF4C16AA34, 0x47A2CD871F8628AE, 0xA183953E20BBB5C5, 0x8A3D781664A18A97, 0x89AE128C18118CA3,
+					0x85D459D03BAFA5E8, 0xE70B33D6A374AB41, 0x038B7D0592A08537, 0x145DE810E34C499A, 0x2B7C419D24AE99F2, 0x1010AED7548F064D, 0x7CF0EFDE7857F950, 0x677C3223B5A14887,
+					0x1ACB0905494380B1, 0x2A11FC61179829C6, 0xAB61824887269535, 0x49EFEE2CA427DCD2, 0x00BCA764DF672CE2, 0xF6BC3853240BF03B, 0xCF3039900BA4599F, 0x34ACBE235C813D21,
+					0xA72D62401FBFFB5E, 0x5C4F67C065064FE1, 0x53E4A9C81846D31C, 0xE1C6DFD9D93DFB8C, 0xD100FB8F9927623B, 0x49B1E335232CB0C7, 0x84A94B55F169F420, 0x504F6E1EE3E1144E,
+					0x6C4001823ADDDD8E, 0xC6A669D0A2D7C1EB, 0x947E29C5BB82DA56, 0x01E8EC6746DB5DE0, 0x86F02B181016C030, 0xD3DC2B65EE28CF62, 0x9D3747960DC7C164, 0xE7C8C24BBF28C3FE,
+					0xB25E093DF1B14D5A, 0x0EDE34FF6C26DF9E, 0x905611A1EBABAF93, 0xD941631DF135C201, 0x793D745B8F445A07, 0xF98DBBF701679212, 0xEA0850FBD7DE127F, 0x008E84C087F7D9C8,
+					0x8F61EBCFA2E395FF, 0xEE958C884616EA19, 0x727058E2E8CBDC9D, 0x8E03077E1546C7B1, 0x750176C4814B5CC4, 0x985FE0D5397E7F7B, 0x090570E0180639A9, 0x590AC50F94E7A0BA,
+					0x886FD49FD6672002, 0x0A7E25CFB3C9F8D6, 0x8C11E1EB0A3F602F, 0x3F1C4E4460A5AEE8, 0xFF5B0A053E9DBB75, 0xC97C1A47A4173EBD, 0x3939F4002531D80B, 0xC0C6E18CBDAE3FA0,
+					0x85310CC75F4058B2, 0xE619B9392773E0C2, 0x389C58E2EBF20B4B, 0x29F775B3B8590FB1, 0xF0CBC1FD90660A96, 0xE5FE4C2EB82EF24D, 0xE16A083D49255B66, 0x5C0AC73B30601CD9,
+					0x3417E1DE1C5F8FCB, 0x5B69A779B62F0EE8, 0x5BE62A9F2DF187FD, 0x4EF1CB6A96B7D8DD, 0x63D1776D9A18E6C8, 0xE963497EE565E77C, 0xFB5F3FCA4065FE33, 0xEE810F0D868155AA,
+					0xEBC7CE46A9C5330A, 0xFA55E73171ED3C02, 0x1441E18977FD1730, 0xA758975674C929D2, 0x4BE16781813B5185, 0x4FBCDFA963C1E30D, 0x86215F25FCA62DA5, 0x222C5D605AF3338D,
+					0xC24F90971F99C039, 0x437820B94DE63E0F, 0x697D7B4DBE04BC41, 0xF126C2622BE3F557, 0xB130D975A4B9D4F5, 0xBCD4759E6512A633, 0x042C2FA1DC88902E, 0x9BAE41DDC84973DD,
+					0xC4113D3496E50376, 0x0B139B820649502D, 0x00D4815840E5DE89, 0x945AB24E277EADAB, 0xB599AD4F892CAE30, 0x669C8015CAAC05F1, 0xF19E1B8A075A6555, 0x3C257284D8768549,
+					0x7831736D5632C424, 0x594728E0E7AB9908, 0x8D8A105D7B6C5E5A, 0x32D62227041194F0, 0x8E38A3E99CAE9CF3, 0xB9B9B23EED02F682, 0x315098ACBAC31F32, 0xCDA59F8ED880F009,
+					0x0BCBF4FCA4711A78, 0x6B6C7C214CB6C4EB, 0xB2C9AE6984217556, 0x10294AF6A5F92498, 0x51AFC10ADA8AADA9, 0x25F90BF3965418C6, 0xE22A60B36C32CF75, 0xE02B8E215B51CE63,
+					0x44FA30749288B89C, 0xB1A3915C46CC1F53, 0xE8B317B8BAD57896, 0xB0ED83982F6740CA, 0xCCB44C2163F44DBF, 0x8EBB6350C519E5AA, 0xEA505105E98B4DFE, 0x93DEB2648B03541B,
+					0x5A68EDA554921608, 0x974FE52D58F71F5D, 0x2A6A18B4206BC6D3, 0x4AC30D9EB7A18803, 0xBA0738AF809C4679, 0xC1B12E4FCC6443D6, 0x1ED589191CF7979D, 0xEF9055F1924B7864,
+					0x6B72D710AF56813E, 0x37C36D09B91C99AC, 0xC99691D845521DA8, 0xEB301805A2E8F273, 0x091950A12CCE37B3, 0x2186A1B943AAD078, 0xFB3A094F9C5FD822, 0x35C8095799C3BFEF,
+					0xD379AD5FB0D01E51, 0x2F62F940D066EDC1, 0x5BD5E9D658FAFCA3, 0x3C32C344756A6900, 0xFDA7C364F89BF190, 0xCEC074A81D7897AB, 0xC520C10141686ED2, 0x6829B42BEDA39133,
+					0x8A85B023BE7A2BB5, 0x38BF504198318A83, 0xF61F91C8B9E47928, 0xE21060B9AB872998, 0x1A1E268D207F0375, 0x3E23CD123ACCB8C8, 0xDE2E949ED0C2725B, 0x266E3BEF29204D81,
+					0x5DA3D3AAD8C4143D, 0xC2C539DBCE7D8445, 0xD6AEF8A363078CCE, 0x25C73B71738A015F, 0x3D9F1FC6F97B0BB8, 0x452E263012B9D1CE, 0x327EB82C3A529FCA, 0x6EAF83299212C564,
+					0x794C5E4B0A75369D, 0x36D1A447A58AF4D5, 0x215E9B58B4FC6A83, 0x06367DADD39C1146, 0x6700538D8939A12F, 0x0084FCECE367E69F, 0xD67FCB06EE665B54, 0x2C08A81AA1D993F7,
+					0xB51A99B0B5438BC5, 0x45F66E100741638F, 0xE577611BF0E3FB8C, 0x426E7DB954EBB433, 0x9B3FE08CB14A2769, 0xB6D34CB82955CAE7, 0x949A0734A33E3535, 0x4F9AF34202332D65,
+					0xE94A792659B3FBB2, 0x5A21A8F13EB65454, 0x1A87891DAB3D8E9E, 0x8CD39AEB53DB7138, 0x4AC88CE82A7DB7CB, 0x7E75CAAC4D59F8E5, 0xB4E2115CA5415948, 0x6EAF501ABBF24444,
+					0x0A6B72417FB6DF53, 0x8A5FEC74D8A4E546, 0x2AD589006CA01240, 0x6E20D04DCC952B7A, 0x860A3B4DD63DD2CA, 0xF9F7BC09A3FF2421, 0xC049D81C33729D44, 0x3AC9AE9165D517FE,
+					0xEDD6B470075D99C3, 0xFE9F8771A88AC63E, 0xFA3666B09B1C04DA, 0x7D9644EF35613623, 0x412E2FC7B579578E, 0x5DFC5D2905804D7A, 0x19A33ECA57267211, 0x5D4E2F282C7097CC,
+					0x43878DCF96EE442F, 0x7D61DE90299E7A6B, 0x2B774EF550B5D1E8, 0x565670D9023F756C, 0x17D36A7BFEC6956D, 0xBBBB1D274B7CD609, 0x788D25D5E1E3CB2F, 0xB6B7DE725EF40E3E,
+					0x860E353A558C3193, 0x7919C078482A177F, 0x2FF22DBC7C0C2877, 0x077E56BCAEBF446D, 0xDCAF7ADDBE55FAE2, 0x5603475AC4A3D0FD, 0xAD02AAB84B863F20, 0xC3F69E443EE36B52,
+					0xCCAD88924C24094E, 0x72C7ADD9962D8C36, 0x884CB262DD9175CC, 0x1BED5E10E2394AB7, 0xF807BB282D8EB2FE, 0x6CD0E007A843CF7B, 0x4715BFAFFAB7146F, 0xA6153F474C17AF3C,
+					0x085E3A6720FEA5A5, 0xDBA299E5FF726637, 0x84AF8977D5433985, 0x7C5FDAFDF383E60E, 0x4080A62881A5F93E, 0xB7120F185AA45857, 0xC087A11A0203E71D, 0x2668F0231C046D61,
+					0xA81DACFEC5A61E2A, 0xCFEDDAC03B24C20B, 0x8E50B6324D9F3EC4, 0x953583FB496D2CCB, 0xC81A0E895BCD51EA, 0x1C5611E421ECF011, 0x5E3000D6841F0B41, 0x381830D2CBBF9E25,
+					0x11FE369275A125ED, 0x963239B2E88A186A, 0xCDFE6986942691D9, 0xFE0B9EEDA27F761E, 0xAD3D50DD380B309E, 0xEFA75F561704D4B1, 0x7849174363ABCAD1, 0x3D5072F0BABCAFFC,
+					0x1B8DDA0A17EA0055, 0x12229F64E31D80CF, 0x32ADB79DD7A2B8B2, 0x534ACFE39E22CC8E, 0x06199A2C8FC1D6AD, 0x50B707E06B649667, 0x9A2C2FE42291A067, 0xAD3E220FA457F6DD,
+					0x951B06D7037E393D, 0x532955707F082685, 0xA306E240762781E0, 0x07557984214FBEB1, 0xA6AB43A01D308387, 0xFACB58F67E0A27A8, 0xB187FAE4A335B8A8, 0xEF0DE52E03FA42E0,
+					0x9A8C0F1886CC4358, 0x68C658B3E7CE4614, 0x452248822233D236, 0x65F64B1C6E2E5351, 0xFBC67241C618C9A3, 0xBF98483266DC3A52, 0x1AD82ADF61638F8D, 0x9C4B659EE78CD99C,
+					0xDB7A87E2AFA87641, 0x8BE11B090A89D211, 0x5A4A4340DC6237A1, 0x5313C00661133C56, 0x9B2EB216C1CD549E, 0x3F2B4849C561EAAC, 0x73619C3F6C15D7FA, 0x1946DB120E800D9B,
+					0x4CD6FF526AA76D2D, 0x8D5FFDC870A91A45, 0x9686F5E52E30B281, 0x5D05775F72DAC3B0, 0xD12EA83B7A0AFA45, 0xEC61F3D976E17BA3, 0xB914EDBD39D7C614, 0x5F89FC4F3E554B5F,
+					0xFE7BA1CDA00EDE35, 0x35C6807C9F657405, 0x8C7A35DB45365A42, 0xF4CD730C08F2D488, 0x3915D03C16492B0B, 0x6E58CC4517C78F57, 0x26AC6AB30B57103A, 0x1C2F6A72DE38C251,
+					0x6B9CC313379080B8, 0x57196381E226E10E, 0x81DD2A78EFFEFB4E, 0xDAE63138DDF64A58, 0xAAB79A667E9D7677, 0x3C418F5681D9C644, 0x08969B88CE42D2BA, 0xB7B6082B7198E7E8,
+					0x725657804C0F1452, 0x52584B3F348B814E, 0xBD4F4093EB15F175, 0xDCE3662DEB83D272, 0x87999B461F1FF42E, 0xDAA8527B63DA86A8, 0x61746C6D0610CA43, 0x69E00EFACEA94CB4,
+					0x5B0B27BD9953ECE7, 0x0506FF5C4D65869E, 0x4F28D858D4E55AD7, 0x4FACA1C504838A5E, 0x1C0B8BEFE83FC84A, 0x98469465EC2762A4, 0xD1A950B69C4FD72D, 0x54F3A2D40B4C65AF,
+					0x7BFABE0613089298, 0x0D1999A3FAA7831A, 0x60F83DC9321A30CC, 0x338A14A461F6508E, 0x5D5BAACFCEBCEB24, 0xB2C9FDB8F523829E, 0x61E6DB69245C3DA3, 0x65F23054FDE457A0,
+					0x3A427892393B7246, 0xC002C68F0753861A, 0x11A0628CB73C6602, 0xC83D74580B03D323, 0x223BDA095A2FAAD6, 0x618FAD2EA40750AE, 0xE1B96F61A89CC4B9, 0xA1AB4E0BDA25B286,
+					0x33912C118CAA49D5, 0xF0EBD6A13DBD1B47, 0x528A944B8E7ED91F, 0x20D20B759E85A53C, 0x0DA02FF5FB1E77AB, 0x53A33432237A6AC2, 0x037E589A8E03F87D, 0x718BB7AEB5FA114E,
+					0x14439D2E414307D2, 0x8F3C9C28CF677AB2, 0xB61E8ADB6CF4998A, 0xF24FAFE54D8080A4, 0x99B33E383B48693A, 0x0B7D49D5FFA54AC0, 0xB791CCC3D90134F9, 0xC1E51FFE37891CB2,
+					0x31630949C5F08D93, 0x2F32A4943A52F0C7, 0x1E4054BC746AC1D7, 0x0BEC978C1E83B4AA, 0x23D092DFE0689EA4, 0x3AF9149F3C0BBFD1, 0x1F9A65D3EF7985D6, 0xAE15700A0AF0534A,
+					0x522A59CF691A305C, 0xD7D1AAFD4EA95728, 0x4ECF53A34D6651D9, 0xF6EE82E14FC142FD, 0xD7F68FC25ECB8352, 0x3BACD580ECB70156, 0xAA559384EFE2B7BF, 0x7246A155AE1AB7A8,
+					0x71B78A06AB433209, 0xFA364B26A37BEDD3, 0xF4C559373519A769, 0x19D27ACDD2F4F5A9, 0xA027AA38AB72949D, 0xF73BA6414B5D8D94, 0xA18FC45FCCCF0938, 0x9D821C9C1CD3E59A,
+					0x515D243D536359C1, 0x5B8EC801FB232CF2, 0x495D8CA454D5962C, 0x675B632E0626BF7B, 0xA26BF3E03BDC2B6D, 0x0825ED1ED97A5596, 0x36B58352D6D29723, 0x1F3E51C2D7F94D4B,
+					0x690D31CC56F3BAC6, 0x5D79A41C71B78BC8, 0xE0AA22DA1BDAA211, 0x34C498031A1AB2D5, 0x27CE700CEAB12DEA, 0x7262D8EEF2958A3C, 0x6ABDEA717A294D81, 0x30CBB9180F2436F0,
+					0x2DCCE367E3ECB0E0, 0xDADD4A23B167270B, 0x734F18334A586542, 0x3D88A6AC591CF5CE, 0x909FCE9878AD807A, 0x5C517437A3F63ACC, 0x8C12105CFF8BD437, 0xEB18108BD0FEB164,
+					0x0162924F63232008, 0x53B3B4E3E8B8B25E, 0x48BBDDF341944358, 0x30511828EC5861E9, 0xE1F6FFF86F0C3912, 0x9705DDC9ADA18E8C, 0x1310C0B6DFFF566A, 0x245B7D1DF1D78E99,
+					0x116590F1EAFD7F82, 0xA69F9B1954351D16, 0x45B6CCC886850B46, 0x04129546F873BDCD, 0x1213E35AB794BF25, 0xDB1CCF0BD7F31407, 0x67FF32845421DE18, 0x6E44C7D3009DD7C2,
+					0xF4CE5531A49476AA, 0x9A223DB1C06D2887, 0x411A549F37A70F10, 0x8A037E88B21EE9D5, 0x9DDD27766979EA17, 0xF9FAF60B2ECA63DF, 0x60620277FAE1F4B7, 0x7986D3373217D041,
+					0x670E46D8F8058DF1, 0x660034A843CBB73C, 0xB728D871E7AC164F, 0x9800A13BC31E7493, 0x9A72550FDF75999C, 0x87553AC0166AC5A1, 0xE673C26E34456D0B, 0x4CC094DA620E4859,
+					0x0B8F7A80C785075E, 0xEA430EBE53184874, 0xDBCE30C91A2F2134, 0x294A33466FB990A8, 0xBE66CE5FB98EF501, 0x4BA766A96350BB0E, 0xF0024325973C03FC, 0x9D4AC4A11BAA12B8,
+					0x07A8C68F99713A8F, 0x53DE9A4EEF29EC9F, 0x3F7161C113FA2C83, 0xD4206C7089C4DD1F, 0xB1E6FC85D3733236, 0x72B0044231C53D48, 0x0A56502C1D5DF1E2, 0x1A9A4206FE93C4A4,
+					0xFE5E585BBFA4FB62, 0xBF9172C2643A1BD2, 0x89E148FCFB804A8C, 0xD92FAE96F004068A, 0x2B63A991FAFECA8D, 0xB75F86071BCCA01C, 0x162C9607F03490BA, 0x85C750B66AD04065,
+					0x92BB6E29C7AA79AB, 0x578FA0304CD63635, 0x64C40A2C7A6AAF7A, 0xAAD773E73F04F045, 0xADCB99704BE9EAFF, 0xB6D71C6C76CB96FA, 0xDFC530A170C69C3E, 0x0E75DD7DF94B962D,
+					0x2DBDBBB8F0FBF4DE, 0x0E9B8AF593360C7E, 0xF5D54FB8D7B0D198, 0x3C8648BCF400B40A, 0x8CB14D8E89E780C8, 0x969F9A009FD1667B, 0xCC3B405C3DDE1908, 0x5A4F11652ED98D83,
+					0xFC6EA499CB972FEE, 0x1D3EEC68B765301C, 0xFF403DA699FC3F23, 0x194D8960546861EE, 0x0DA33231A5EB6CC0, 0x3CDB9CA1E089C496, 0x92ACA53E502C5024, 0x72F18A9923AB61B7,
+					0xE2009723CA0C6B63, 0xC8B304CB552BC9F0, 0xB4746D30D71CF2D1, 0xE86B7AFEA0DC87E9, 0x74693D16E6A47F93, 0x1E665BB97F15D247, 0xDFBA1BEF115E3BCD, 0x8FECF00768AF5032,
+					0x47828FEFAE985614, 0x89E80B2721D286FA, 0x6643A288080038A1, 0x5587C1DD3DD62B91, 0x637A6BE1E700C5DB, 0x476BE4023CED6B40, 0xAF6A5A6CF6342C0E, 0x28102127D88358E8,
+					0x77CE3B96822F7C23, 0x62FBC2674D913DE3, 0x88276EDC8B1AB86F, 0x0A56C27B36D08883, 0x9F32ECF2F0FE0152, 0xE7CD4ADF722BDE31, 0x10BB14A1F5B46519, 0x2E853FE5616D2333,
+					0x8275C56923F316AA, 0x66073C569D2DFE85, 0xCB24761064484545, 0xD41C40FEA61E56D9, 0x0F22BA052E1492F3, 0x9E85DBB01DBD22F9, 0xCC96621A22085C9D, 0xBF835B57043B3F9F,
+					0xBFDCABD6163D6182, 0x71F8970883C36F23, 0x730B5AFFF09E7838, 0xC3122D2D92011FD7, 0x2E7C88BB515B1A48, 0x139A478985C4937D, 0x28AD46A6E753777B, 0xF5D51BC2DF57C245,
+					0xDF127B7C82166E26, 0x583A55DF3E3754E1, 0x728EB3E6140E5D4D, 0xCF991D54ED7F7C71, 0xDDC1A67DED546ECD, 0xCB5F0807C4C3FE7C, 0xDBFFEF6BC9195F0E, 0x9E95ABABF1A6C71F,
+					0xB9441700CE3C45CE, 0x96ECFE7E1E89A608, 0x7FA7AF7A0255C7CC, 0x76E886FFA87093C8, 0x25E031A6E00DBDD3, 0x0BE651F89D933A5C, 0xF281B23D956836B4, 0x434A08D7049ACBA1,
+					0x369181B0F08317AE, 0x20BAD90EDA3619E1, 0x111429FE1CF89EFB, 0x3897B737C8E819E3, 0x7E29DDF81CD08E65, 0x0B6D21E83D48D637, 0xDA9F32C19B2DE2A6, 0x363C0C3996DB8995,
+					0x38C1EA91B1155EB3, 0xA763AC0988CD0328, 0xA2E8250EE5EEBF38, 0x56473D5F42D04495, 0x7199E0DCF1B58024, 0x387400364805DE42, 0x6623697A643FEC81, 0x7D6F21F3303834BA,
+					0x66C7ADDD5848945C, 0xEDFBB46F57359A2A, 0x19865D0420621266, 0xE7343FF49B53EF1E, 0xEBE893F1A6F55305, 0x86441B1E94F4840C, 0x85C05F8464455C2B, 0xB6B49F1D7AFEDCE0,
+					0x72B92C56D510D756, 0x24548F2EB32A4EE5, 0xEB5916FBC9021C2F, 0x999403CD9D8DC639, 0xB9F339ABD01CFE13, 0xDC8E183993213F3B, 0x44BE92420F464351, 0x6DA0C5B085E8BBEE,
+					0x38B4FE0FCFE9BB87, 0xEAC66362C8E83902, 0x7A1C1BDC3630B939, 0xF7ACF07386A0BFC1, 0xF9C0A05883E86765, 0xA41B888B224955FB, 0x6AAEB2CA396763D0, 0x33BFC02144FCAF51,
+					0x0DEB3355E53FF586, 0xB48218CA0892008B, 0x55846A1945DE5C2C, 0x667C438A9081CA79, 0x9848C392E6323669, 0x914C6F2E3CEA79E6, 0x9F06A77154D4DCAE, 0x94AF2A306470E832,
+					0xCE44F7661260440A, 0x135311A614075B0B, 0xDD43A37FD77E0D4D, 0x42B7AEB9C6DE7DD0, 0xABE2B4FAAD62EBE9, 0xDEF266375D34315C, 0xFEB3B0A07A78D5C3, 0xA766EEC0BD5AE9C7,
+					0x22955F978BB32E49, 0x1ACACADD80637F43, 0x83BCD03798ACB84E, 0x7BA8EFBAE130B381, 0x88A7031D3366C0C3, 0x4FF483044DE8D340, 0xC37CDF76383F4866, 0x0D45BC9654160DF0,
+					0x390E1B7A90C4BABD, 0x6FD93643249752CD, 0xD64DA03C38B6B8B5, 0x38692ADE0D69CCE8, 0xC55FB8FD07F5EECA, 0x3D982B332804FE15, 0xA4E5E02B9562A447, 0x534503D728FA2E80,
+					0x195CA42062863EE1, 0xB52AD41A37FEA43D, 0x453F3311E5FCD587, 0xB20F0D606C6BF9F7, 0x191FCF97180DA52D, 0x0F33D3D187A73007, 0xEA8514363AE4B183, 0x34422288AC3099A4,
+					0x65989ADB97B82C88, 0x4D660DD7F666A25F, 0xAF3C66185ADE279F, 0x63CD2280CF9090C7, 0xA6E494231DB8D1A6, 0xE59A861D3135FA70, 0x5E4DA00244C2ACE6, 0x9B105E1113F78F86,
+					0x5BE4AC629CE60D40, 0x4EC0D2ACC0A94EDA, 0xDFE04E258F2E187A, 0x7E9433A62AB6B735, 0x971FCFD83A35E54A, 0x4D28D17519682CC6, 0xCD7BA61558916312, 0xA749D5E5454CC0C7,
+					0x3A553616CB4D8E78, 0x4D85A305B5DEFE4D, 0x98F93C70EF0AD89E, 0x3E4CB9966CCC20B8, 0xDC6FD503F5F3C6D3, 0x427568F5B0353D35, 0xBC4DED6135D486A9, 0xC7E7FCB3A421FBDE,
+					0xE6EAA22FCEB8D65C, 0xFDF8CA7C6B9C346C, 0xD292CD12E2684213, 0xA966794104E0726D, 0xD38BCB118B012D30, 0xEA0774A58D562B30, 0xDC80E0E1A89026C5, 0x461FE0E5E49C7C15,
+					0x08D07CF9DC4492E6, 0x862B9E1D1AAF6ED0, 0x5CDAE4A472C9B6B2, 0x50CF0EFDD3AF4CAD, 0xE54D1CC3482284DF, 0x3F1E1BEF696C189B, 0x657B81D9A95B2C79, 0x8070F77BCB1DD3EB,
+					0x8A75C01FCD2FC920, 0x8951563EB5653344, 0xB17CF7311C657D30, 0xD955B17CDECF27B5, 0x58CB7F5EC4828A7E, 0xB60E6298DD9FB657, 0x660D0E3A8A335406, 0x885CDC02286BB4B7,
+					0x1AE3CBC3A1733DC6, 0xF65C232C3B74743B, 0x69ED3841B4249545, 0x52B7A28BE7619CFF, 0x489EE8B3342DA317, 0x72F07B439FF823A8, 0xE0B16800FAEF602B, 0x99753071E7838EBF,
+					0x9BEE52E26512EC03, 0x63392C073FE87C16, 0x5415D91267495858, 0x8D226B6FFF031561, 0xDE8832669D4D7805, 0x222B3D914440EFCD, 0x66630C819C47ED15, 0xC6A196960CE86880,
+					0xDC08F196CCFD784A, 0xD761F27C645AECC2, 0x60AD7CEC8756C7A3, 0x80C08FA7349DF604, 0xCC289027164D9205, 0x3043834B9A513128, 0x1FA8A553DABA488D, 0x66634B9A607285DF,
+					0x358F958CD8F0CB25, 0x033824D61A125FE9, 0x0645CA93F8D9DDE9, 0xEC944B90A940293B, 0x4A618CB7D69C14FF, 0x91AF2264FC9F7481, 0xC0A94D20DC316C5D, 0xE09F3506099B82D3,
+					0x0624CA3B5F16104D, 0xF8EF95D58CA6F83C, 0x23786BDC3DF94AD4, 0x43316CD027B0933D, 0x5E08046FF9AF61DD, 0x9285DCEFF97914F7, 0x57745F0225C1D2B8, 0xD493CFB57AB22446,
+					0x9F5A46DFC9439C76, 0xCD7EEEC0AD884BDF, 0x44CE40441FD467C4, 0x79FF30525DE7276D, 0x6CCA829EEA2E300D, 0x09BAAE6C03D01941, 0xFFBB4CEA47DBFD84, 0xE78110602285CA6F,
+					0x69658D9064625F91, 0x8D6B9C6FD4467193, 0xE639D29437CADD13, 0x2E6EC87768D6E0EC, 0x3C6CF0A8F7EBDAA6, 0x75AD5755ABD9E8BA, 0x17D80B114A2D86E4, 0x8EC9156F62EE839D,
+					0x7D60B35D99C8372F, 0x46E0ED5CCA23830D, 0xEE2866B576A6A9BD, 0xD0BF1FF639ED3464, 0x8E08C170E69640EC, 0xF44838DEDC8DD4C2, 0x586B230BCBE0F392, 0xE90D63EDFDCE1929,
+					0x4F0BD2BA41619C7B, 0xE0EA046B89E4CAEE, 0x6C4A0FA514CA718E, 0x6F23A4ABCBFC3123, 0xABC8BD158B18E35F, 0xEFC54B182901F5DE, 0x8D6B35FC444528A1, 0xBD91BB0E927E0C2C,
+					0x6F032C7AA86B0386, 0x713547871E89EE2E, 0xB67B69E799C70E33, 0xB9E9E2D3B4A88038, 0xBEE5774A496F36C6, 0xFB2AD4A9B5C15D5F, 0x01DDC7B836BCD794, 0x0931B5169FBD852B,
+					0xBDEB43249D796018, 0x206087F390DE8C61, 0x45BB69E503F8EA1B, 0x007588716BBF6BF3, 0x1027E43EC58768F3, 0x89E3984C087880BB, 0x880F562A03565FE0, 0x9C639D48C013C81B,
+					0xA3A925BADF547D5B, 0x06FBCB966F431208, 0x9E6994300F79DC07, 0x01D602688AA6756F, 0x73980778F749D48B, 0xEDB1F65C9A3B4DFB, 0xB0D1C309534433A1, 0x5157F290291460C6,
+					0x524D5612377FD868, 0x33993129C096B68F, 0x41CB84211F2B8082, 0x74CD1311B45DBFD9, 0x6E2DE5769165396E, 0x03448720907B776C, 0xF2364FD5B3875465, 0x8DD487AD2B4A07E8,
+					0x236A0927DFCD250A, 0x9D826DC93D5232A7, 0xE5D2C1288B100E28, 0xFEB4669EFC60C40A, 0xC9EC7F7086115E58, 0xE92A6EDDEABE465D, 0x986981F83C5FF572, 0x4E84EC9A445242BC,
+					0x1A960CD46714211A, 0x814317769BF6C721, 0x79FAA191D6F505B9, 0x92F8FEEEE60C1517, 0x481423A15A3B5DD7, 0x335502FFD3DCBA96, 0x068A36EF70E2F70E, 0xBC7CAFA2FD5ACE0E,
+					0x19B94D935C0EA300, 0xD7C3AA2AA71E5253, 0x13BD17E93BA353E1, 0x330D467A0B6D82F0, 0xF4F6B15431073360, 0x3BE92D6D5A0A1B70, 0xECC29844CA188EAE, 0xE67E32E7012B4ADA,
+					0x1A58F3DD11859CF0, 0xD1FF17A67C26B52F, 0xDBAA8B1986F24DD2, 0x90CF9FC469A1C4A3, 0x2CBEA20219CE3B64, 0xF5517EDF4E0B41F7, 0x6FA76F9A0E245C9D, 0xAA4938C3C038500F,
+					0x3BDBBFF59F9575DB, 0x481E97A8F37214B0, 0x614F235B92E70013, 0x10B937F580581C18, 0xF3216A07239A9491, 0xF54F984A162445EE, 0x05142B983A0A9DA6, 0xB065285D1F7CA576,
+					0xD3D47701CD78BA06, 0x9B7CCB95EBA339A7, 0xC3E8304CDB141DAB, 0x2F996F8C0574F9B2, 0x81198EC4A276A15C, 0x3D789FBB057C531D, 0x94C66AC6B9DBC652, 0xAA4279283C2DBED8,
+					0x46E0DE6D3767B4CE, 0x9A848A0C704F2E5C, 0xD2117D4E2FCFF51A, 0x3AB630325600C2A4, 0xF23B0B8203884E56, 0x8DADE8E8535B2B8F, 0xCD271EA6B08259B3, 0xA1E998E0F0B75FDC,
+					0x5CEF8F873AA10642, 0x8052BF81FE77A089, 0x69D4218CADD8B3FB, 0x07ADA15DEB16132F, 0x1B364A70F49051C4, 0xD940C3F93C301944, 0x906F0F212AEF9C91, 0xA06B1E264F36E871,
+					0x3F31E9168059A036, 0x8F8F573D4E28B128, 0xC27DCEFC4BEF6C5A, 0xCF468D63ED9C7C5A, 0xE59532CF7D954B0D, 0x0A523CD8AAB5BE6A, 0x2D80CCC25968B6FB, 0x079B1C729EF3796D,
+					0x24BB071147F74428, 0x8AF84B58D343ED19, 0x0888A187A44BDEDD, 0x5D62457C8288A736, 0x7EA2970DCFFD57AB, 0xC4DA5422FD256D99, 0x1C1AE846199ADF94, 0x09E70B5766FDF3ED,
+					0x5912E3475BCB64E3, 0x4BAD4960CEBC3117, 0xD76C5B04D0EDEA39, 0x730A32A03D1607FF, 0x5D9C46247BA77E2D, 0x9A4D5A4A00F62F2D, 0x98A52BC52D73C907, 0xE11F750C4A3DBB8A,
+					0xDF0B94382DA448CF, 0x53F9B3606E01B187, 0x09FEE93B5D3A4059, 0x911EACE61C361607, 0x3C5F9D6303AE0A9B, 0xAD4ACDC2F89F4711, 0xD6A104784330200F, 0xF975D4E8C3D4083C,
+					0x8B5FAC5E240D37C6, 0xCB86D3D7B4641C4D, 0xEA2C136105899E0F, 0xD23161242652AA6F, 0x5FD9787C8AAB5F2F, 0xED0CFD9A6C15C770, 0x658EE2083534B281, 0x9D26EE661E81F72D,
+					0xCFB370FDA25DA29A, 0x05E1A892166BEDBB, 0x4C505CA64AB617FB, 0x1F56E6CD3392613A, 0xB75027FED8FEFEA8, 0xA7FCD38B97E0941E, 0x9EE4E8E261A7735E, 0x80B97DB873F55147,
+					0x06F3EEC1921E7214, 0x7256587A8FC21A77, 0x86A7519F16E72763, 0x7B6D035F45A689D1, 0x07BF7455C7D25B76, 0x4215F83439BA8252, 0xFC8A9CA2160F6B79, 0x05CB79C4C37A7152,
+					0xFD82ABF51DDF10E9, 0xFC265281E3D6629D, 0x8572CE748C5369A3, 0x5A453C95A570D31D, 0x103A322264412B37, 0x2C83B74E3E064983, 0xB99F6B7A9EB39D83, 0x48DBBE7ED24ABEAE,
+					0xD0CB653F2F304A44, 0x99DD9764464EE6F7, 0x0F718DEB4D126BBC, 0xA130AF18C7F48C4D, 0x1DF8BBBC33731322, 0x68719FE3E0E285C6, 0x9701C3297ED41540, 0xFAAC8B62F985773F,
+					0x7500803723D2A91A, 0x2DD3B15F5DC27109, 0xDAF79D64807A876A, 0xDF1307E0E0D2FFE9, 0x058B686A750FAF00, 0xB6BC90D0253B0654, 0xAC8DD34909C40215, 0x962086F9ECE1928A,
+					0xB629F2906E673CB1, 0xE7AA61229C5BE610, 0xBFBFCCFC8C9AFA41, 0xDC2F008AF91CB744, 0xD0E70DDDF746EAEE, 0xF0B48225A0BCEC25, 0xEE4C680E77AE640E, 0x940C728BD6CAD025,
+					0xC595B775F747F99C, 0xB480A87510548250, 0x224CF14AD6B182F5, 0xF0FFB9781506C9E6, 0xAAFD738D155E5230, 0x5DD0580E72CBE369, 0xEC26B7EEAACB66DF, 0xD813EBA7ADF2D7FC,
+					0xFB8CE98696F76C86, 0x182172AEF2D0664B, 0xFB6D38DC480CFA76, 0x7057607918E4AE02, 0xA00B55CACF1906E9, 0xF20E4DADE28605E0, 0x53FA43B5CFD3718E, 0xA4A3E8E82421C0E6,
+					0xD2F5910BB69BF92B, 0x793C5703EF84856F, 0xA31719D61EE02109, 0x62DCA4871DF9B773, 0x20B005684BDB83D7, 0x2EBD78024F33FD59, 0xE9BC6EBE6DA0E2E4, 0xDC1B0AEC5C1BF7B3,
+					0x4E876142056212CA, 0xEBBB67125A6129DF, 0x528423FED5DE7D89, 0x44C9A615E85501AA, 0xC1A1F9FC733C657F, 0x1E6594B6F9CCD386, 0xE4B7FFF1613B8AB9, 0x4412222CA2DA1386,
+					0x513F23E9EDF948AD, 0x213FECDB8B26D9CF, 0xC05DC2171673155B, 0xCE9F4DDFCB0B9511, 0x0A213D81806C8FE8, 0x3CEB093B40D0832B, 0x5F80CB8A739206F7, 0xF199A3222F6D4AD5,
+					0x4E2C0F93BA18011B, 0x2EED3B48B06A6D1D, 0x24630CF5FE778920, 0x211197930DEF5374, 0x10D7FE7DE3E26261, 0xC360B1BD4F320E7F, 0x46C17E6B3AAE4BF6, 0x72841D47EBDCDA6C,
+					0xDF604C8C68359A47, 0x2EA818D13DC2CBDC, 0xFE5CE23794604781, 0xA86ECBDE9C6C4148, 0x9D706AC685809070, 0xB297748D9386278D, 0x8DD0BDEEDF155279, 0x55A6976B1301BBAE,
+					0x665FE9B7EA4FB0F4, 0x895AF90539C3E192, 0x3ADB432E54B7BF5E, 0x508CB1D63EDC5062, 0x86077F7B422FB2D6, 0xC3E3BFC320BB01AB, 0xBC52A4E069D58E23, 0x96E3F0EA4146EBAF,
+					0x18915867994C89DB, 0xE019AB672884E886, 0xF3675E43B30C7DA6, 0xEB8FEAB723491234, 0xA76E13F67E76691D, 0x8C0CFBADEEA41D22, 0x8A72C80BDFEDB388, 0x88D0C3DEF6A98754,
+					0x0C9AE4130A127F90, 0x70ED0DCAFCDAC9AF, 0xC5F9A8007ECA25B6, 0x66E5078BC59D10D3, 0xCB920BC747021A06, 0x920E1D199C2CE08A, 0x0F0CF1682017FC7A, 0xD8B4BBA643AEE183,
+					0x7F3B46B4E377AC97, 0x462C5E79B207C687, 0x836F505218F403F9, 0x99CD913DD883ED28, 0xB1A7C74202F92A5F, 0x93D2D79DE987101D, 0xE482089D94828504, 0xD0CA422059124CC3,
+					0xC33278146EFBFBAE, 0x0A7F260998240CA0, 0xB2BD859F7CA49840, 0x1887E8BCB9D45879, 0xC06E1C6A2A41FC0C, 0x9D5BEE6963A0DE6D, 0x085EB0ABE095CC69, 0x9CF0F00149FB63BE,
+					0x9F36568CAD10EEFB, 0x7A6805443FF95001, 0xE6CA211B076F5206, 0xBE8899F46ECCBEEE, 0x25647C78A2C4AF5D, 0x9C5C8EAEFDC8D9B6, 0x4427879569B1FF0B, 0xDEFCBB3F5F01AA38,
+					0x2FB5F7AF7F71B6C1, 0xE9219CC8B9B5A112, 0xB8C8A5CCA935F7A4, 0xED8EE667FD5A4A6E, 0xBF4ACFE0B1390091, 0x947EE8D80E05C322, 0x07787EB40D2525D1, 0x7904D02ADBA9E121,
+					0x802C7234D27B15EB, 0xFB664C23C96F245A, 0x544421AF96DA2427, 0xD0F3CB4C8BFF2C68, 0xE0EC703D8EF63C19, 0x20FED1D513B13A3A, 0xA9F7FC223D6421CB, 0xC4457F1676DAA4C3,
+					0x50B416767675B413, 0x47E32880BDE57AB3, 0x93D118B1FEC1FB32, 0x49F0D3182E929CCB, 0x82B089FB4EEFC77A, 0x542329702C54FF32, 0x549DFA06585901D6, 0x83FBE550A52E0AA1,
+					0xB67EBB44943F1752, 0x196BC28318B15697, 0x68AA8DBB58DE735F, 0x025AA89C466708FF, 0xAF246621F1273DCE, 0x9B9AE5B8CEC84DDF, 0x2BC838AE894E0589, 0x309DFF29C6D44FAE,
+					0xA5F34DB22AA8570A, 0xDC3FBF0D2CF53D0A, 0xA6D73C2D4AA1C958, 0xCF2F1C23BC00E7E5, 0x1801345E086126E3, 0x1DDD9AC077B20F06, 0xCB47090F6B9B00BB, 0xFD461ABDD6D42FCB,
+					0x0C9DB3E211E9B5B5, 0x4E93E578480B5E6D, 0x77AFBE098CBA3488, 0x28A0F4F97E3D92F1, 0x12549DE5D27E1991, 0xD8090DE5F3D7A614, 0x6BA0B190E0E9CB03, 0x8F7B112117DCEF6F,
+					0x8038AA1B2A95A863, 0x2090EE56D3A48659, 0x059498A697430816, 0xAC0A72192B56E536, 0x80890FDBD1FBB92D, 0x804213B168271931, 0x0096D2C07A29E65E, 0x5BF4E9924EB78018,
+					0xB80898D0142B7A37, 0x904B270C5EF59073, 0xBFD905FC82993A8C, 0xBF16963A82CB5DAA, 0x3FB28578E017394E, 0x83F130123ED336C1, 0xDAC18F13A89A9EBC, 0xAB4944862FCEA24B,
+					0xF80057E15FC34EA4, 0xC115C765FE105CE8, 0xA29DA66DC02463EF, 0x14EEDF94AD411FAE, 0xBAF9FBBB45609959, 0x767129D120662453, 0xE7A600AD95B49647, 0x03AB2E1EFBB322F7,
+					0x7CB8688184394339, 0xCDA40E1662BEC825, 0x306E37801C3A8E87, 0xEACE50BC75980CB3, 0xC3A1B95D837493DD, 0xB99848EF6CDC96D4, 0xD195C866212AE658, 0xB88A5072109ECA9F,
+					0x846E1198359CDF13, 0xFB5707B4EF4F60E9, 0xFE5C1CEAF71D41A4, 0x4444EBF587AF1E97, 0xA49F2D53D805D272, 0xD1DC4DC49F28B563, 0xA868AD1019F1EF2D, 0xA5F73F82BE23968F,
+					0x44E0D02A8D113A01, 0x7F670FE04A865852, 0x40CD8BF70296DAF8, 0xF73A7965282A8820, 0xA71C851419C136B1, 0x18F3A48256EA8D2A, 0x540E3138D5B60FE6, 0x1F43603CE3EB2883,
+					0x42DED12E57AE2CBF, 0xF10B665E22896379, 0xED9EC1EEFD74D71D, 0x61B8DF9C6EC33D6E, 0x90CCE1F0BC850AEB, 0xAE43A49279B5D63B, 0xB8016A87ACB9DC15, 0xD4DEABF791CD6D1C,
+					0x3AC86B4F08EC5F13, 0x99F45EB17AD62A96, 0xC788F4BC205A9DBD, 0x42757DC6ED8A4475, 0xC9ADAE81B12EAE82, 0xD2705945CF500D18, 0x56D2B4E3D0BD111A, 0xCCD3A89589B41F8C,
+					0x7E7C5812C5599570, 0x44377FB1BD81D390, 0x84217B0AD3C6E61E, 0x47D09493E13C9399, 0xBB0901C7410A93CD, 0x9EA5072AFD8C9071, 0x4723B838787FE6EA, 0xAF18352E851DDE04,
+					0x36783EDF58BB7C3C, 0x7451480EED82EE17, 0x91C8A887819D7929, 0x5D8227169506166A, 0x9ABC60BA73A3C216, 0xB6CBBFB7C867E5AD, 0xBD8174AA1A807AFE, 0x81A0610DA183D5F8,
+					0xD5CC6058DEAE63A8, 0xD2A7C762495F569C, 0x04A804EA43F3C336, 0x6DE86EB0FD2B9F33, 0x35D2C3C039C170D2, 0x38B69EB7DEB44F9F, 0x1660C52BB8C7D9C9, 0x6CAC0A918E6EF9E6,
+					0xB2363B40CAE6502D, 0xF79F6D8E0E60F365, 0x3C550018539E5F3C, 0xBB9C3EB8D33DE4A4, 0x09207CDB68020473, 0x2E3BC0C72E6BDFEE, 0xE017D2B7B4E7233D, 0x46A41F2EA008FB00,
+					0x1332875D956E7A6D, 0x92484B1FABA8A1E0, 0xB7562CBA2CBB70D9, 0xE518DDBD02CBA765, 0x6F99E202886DC279, 0xB6FB9F8F2C863F4D, 0x768CE393D8A4E2BD, 0xC60017FAED8953C1,
+					0x4D45FDE94A484909, 0xB52D25684D706686, 0xACA74568225F651F, 0xF2A735F9163C3B9D, 0x1516BBF6AB3EA2F9, 0x38BA630C376F3222, 0xB760585358B5326A, 0x470DF33FF17D8DE3,
+					0x071AF49D5746E1AD, 0x509B2AE04128E6D4, 0xF9534068CD29BD11, 0x1363EA65FFD8F940, 0xA0D0C2C84B7EB0AA, 0x0D779A35A5A8162A, 0x923E61C2F4F8F0C9, 0xE997589698819C52,
+					0x5AAD9A720BB8CFBD, 0xB76E1BDA6F80ED21, 0xC93517022B8BE379, 0xC250E06D7F99717A, 0xDF7CBE353319932C, 0x53DD463D6ADAAA6B, 0x5E9354BA9C576678, 0xE4AEDEFE33A16340,
+					0x9A0225CD7D51FBA2, 0x87039D24736F3901, 0xC1D10023A876545F, 0x7AE63D17CCBC55BD, 0xF2F528FEF8629409, 0x39CBC5706B5D0CC7, 0x2E1F30B65C09D766, 0x02CBA18B6C1ECAD2,
+					0x5CDA88B186EFBF8B, 0x461495C15D36C22D, 0xEF6833E0ADF24D24, 0x8E46648A6EE56CF2, 0x47890FFE11C779CA, 0x26C951D318FC770E, 0x77146615185CF577, 0x6E3DCE74049EF0D9,
+					0x64508B423E1F5067, 0x0BADC04A189DF0F8, 0xD4FF4DBE178A93C2, 0x34EA338131B3249E, 0x2D3B80E1EE25BEB8, 0xCF958DDEFF84A4CD, 0xDC938034BD3C83BF, 0xBAF2B5E3A3FD44B9,
+					0xAA5A4202E5283913, 0xD902D6B2B717BD62, 0xF73CAF750EA003D8, 0xEDED4CFF004F8800, 0xB90F904269B14CF0, 0x66C5CE3CCADB074F, 0x2B0E1AC927809C24, 0x65896BAD49AB9177,
+					0xFCC741679BC47B2A, 0x9D0BD951FA5C71AA, 0x537DE2F9AA13DC02, 0x99681F5273322A87, 0xBBB16E8F765E8E57, 0xE92CF92645E24168, 0x485F3905D0049A15, 0x972CAFF7AF1D7C6E,
+					0xFA7411708A031378, 0x2046500FC2D6BBFA, 0xF768DDA49EE0E5F4, 0x402CBC4DEFF4916B, 0xF918B645EBB3F7AF, 0xEBC9BA173C6E8B3E, 0x5F7BA9E621E62045, 0xA425C91C65AB0F89,
+					0x01346006A4F96E8A, 0x2DB952E68A87D091, 0x80AE1419FAC2BD60, 0x89CA3FFB6A5C1A09, 0x0F69D77E5990B0C5, 0x4E95193A439ED1F8, 0x168BE45EF44BA0C4, 0x1CBDF96BAF08A69C,
+					0x0C0827C8EF0A9FA9, 0x11469B270BD0DA9B, 0x23E9728C3F786E5B, 0x693F00D7DD11BA3C, 0xD31F522A0CCFBCD1, 0x49C02CB0A7910661, 0xED60A67904672B97, 0x87E4C3E512D85BBB,
+					0x1F225A25E12BC082, 0x18D2C0876D300D40, 0x4B38F385B9B0639C, 0x5143305963FFB1DB, 0xF81FA08FCF2DCA3F, 0x88ED91EA85944A52, 0x679A4ADA37838BB5, 0x27AEBFEFC69C3411,
+					0x33A865E9D2197396, 0x7570947ECE80969B, 0xF39792701671722F, 0x5AA32390304C2AF1, 0x2CE2FED2FF74BC28, 0x23FCA60EB31C20D3, 0x3F8CD44DF906613F, 0x0C4C8EBF2D27868D,
+					0x76826E05E051C6FD, 0xCC3F3C0C0CEFBA02, 0x4524EBD45699EF24, 0xC4097031182BC894, 0xA1EAAE37BA83ECE1, 0x9C6B5A05E5BD9B44, 0x0E1B521E88E42D31, 0x6A1927BD615A960B,
+					0xD6B9CE0B7CA9D195, 0xB3275E2975A1F40D, 0x1B0C0E850AF6F3C3, 0x47DA2B4D39769970, 0xA91C734A89D1C1EC, 0x1BBEB6A4FFC9FD7A, 0x643EE169F1924AF5, 0x1D58EBE40FE52ACF,
+					0x9076DF7115924494, 0x1F4E1586ABA37DA8, 0xA545F443DC33DF7E, 0x6B30DDD7D43FF66F, 0xF814E39DAEA32193, 0x58AE92E101519EFC, 0xD9E96CD0E12E45C1, 0x1519FFFD1A5CFBFE,
+					0xD3467FCE60B09B50, 0x356708FDE6B5EC58, 0x3506C969A5FFD18D, 0x3B603C81CD7F93E8, 0xFD4801F446FF92C9, 0x9A5EB76BF8FB234C, 0xD0D91AC3F1DA7F41, 0xF1B046809FCCFE02,
+					0x8B0656BB6918CAE1, 0x8350850FB1FFA2A6, 0x3BE40D13ED0CCC84, 0x9A97C1C68C49AC09, 0x70DF4119DF8D4AF5, 0xA3D110AA74D52410, 0x0BC5F2013D82814B, 0xB369672F81EDE5C8,
+					0x02FA31D319F29D80, 0xF853F7F2B7B16681, 0xBA7A53228F41ABD2, 0xBF90C30A33D094DA, 0x3A2643A79AFED38D, 0xA4ADBEE76D1F01B1, 0x42B342B4397D0BC3, 0x65FAE3410A0EDF07,
+					0x3CD6AF98DAFAE2BD, 0x7A5043F96C95DEFE, 0x87B99D26A7960592, 0x7EF7DFB66E85455D, 0xB75EA6A826376615, 0x4614A1C4B17ACB03, 0x737271FA75761BF1, 0x4E9067763A693120,
+					0x5375F174B3E76680, 0xBEE840544DD38CD3, 0x585AE0B945DFEAA4, 0x2EC2D4EFEBE0BAC4, 0x9CB3590C0EC0F59A, 0xE1D0B1053E3DDB60, 0x2CC55B8A03474B21, 0x6E492EBF1B4F51DC,
+					0xCFBB8AD2A8152142, 0xF3E219D8972D094B, 0x89512824FB2601F2, 0x3B09A332070AD8C8, 0xAA2DBADC5388EDB9, 0xD34E8FC30A85310B, 0xCD1D9664D76D7377, 0xE1799204D0234EFE,
+					0xE99E2FF5EAFED546, 0x3EC20560479CF73B, 0x80CC69CFF23F1EFC, 0xC4EFF06D7322A07D, 0x9131886423D1A1EA, 0xFCD7F3B1900683CA, 0xF69CC8AEC06B47CE, 0xC1283ADA0F79D89C,
+					0xD262EF7B917D8F53, 0xD72A9B1115EEE827, 0x0A1D6DD48E1A1CED, 0xFE41E5DC522D0486, 0x015FD8F63F7C0C08, 0x82FB0B321F977C6A, 0xD49C02E5A641C55E, 0x8C4E2BF45DC0895F,
+					0x80CD79D9C385B051, 0x71591EF08863DE4A, 0x0E6DAFF3AC2000C2, 0xE04A7B5706DD2176, 0x3DBCA51030756ECE, 0x5899A9CF029B7DCF, 0x48A88F63988749EA, 0x9770FBEFA7D72430,
+					0x523D3867227E52AC, 0x754E402EB33C0D5A, 0x61C0BF1ECED69CFE, 0xAA406EB0373467DF, 0x72EBA0177E0F2BF8, 0xE530AF7ED43EED7C, 0x43C9F113B6F60B40, 0x06833A462489F65C,
+					0x830CC6BAB04A070C, 0x4161F7873F682003, 0x1BE20BB3A994352E, 0x7F4C7F3782259FD2, 0x259171EF29F64DDC, 0xE5429C52CC195ADB, 0x975AF365C8912E8A, 0xA6460282447501F8,
+					0xCD1457090573C3AC, 0xD43B8538DCBF017D, 0x1B65F120055BEAE7, 0x5FE68901379433EB, 0x6403C7BA09762AC4, 0x29BEBA5D5219CD01, 0x20CF2FCBC38BF307, 0x6E5905A38CBAE27D,
+					0x4D170ABC4DE60004, 0x42C41B9F051A6EB7, 0x0CD69367816777CF, 0x1B9453C51543EA51, 0xD41C9C83634EF74F, 0x0DABDFC07521FF14, 0xB535302335E06C39, 0x89D6EE10FA9AB734,
+					0x45CA0CB3182D630B, 0x3A2147CB5CFFE8D9, 0x5CA30CD5F1E8086D, 0xFF7042EB9586125D, 0x27E2E4D724F74FA4, 0xECE1DF46B9E4C086, 0xA7522F21B933C38F, 0x648B7ADA42EB0F8F,
+					0x8C3D75D18D302C01, 0xE1CE0009FE08EE5C, 0x01692C0BAA7750EB, 0xCF377D6C40114D60, 0xF0EF3BD306AF87CE, 0xCA4E4B31FF66A6CD, 0xAB1FD4E3CC08CB56, 0xECFBF38962E94829,
+					0x57D6AA2759ACA018, 0xDD1AE356D533EE97, 0x27C440C2BE86D933, 0x78A70D84EF70F03F, 0xCDEEB0FCE7DF7B13, 0x50C302C72D6EFDF3, 0x53566F81B4D68E65, 0x7186913D0627E903,
+					0x5618889780333943, 0x44D1F3CC3FC5DD65, 0xFDB0C010CA49989F, 0x7CD4CEDF39D027EF, 0xA2F91E175DF00E92, 0xF276AABF43CFB9A7, 0x62BA860FE60CF7EF, 0xE87CCB1B6AE4F410,
+					0xBFAF64CBBA0C284B, 0xC5E09ED2A87B4414, 0x827870458A0B75EB, 0x9AAF35B6DFEDB154, 0x0639FA0CFB68BC73, 0xB6A6FC26672F434A, 0x3A065C9B5853903F, 0x0FC505F645EDC144,
+					0x120A0E04CEB554AA, 0x1DF3E2C8D8B64267, 0xE4C01B556ACF3EF8, 0x8D28A41BE420D421, 0x5C0A61F22D48A7DF, 0x6A4CE52408F7A97E, 0xE4D4FC894904791C, 0x272186E692B3A5C4,
+					0x6EF644FD26B1EA40, 0x67D4E380A0A9E0D3, 0xA28EEF63FD6B1349, 0x43F7073272ABBB1B, 0xE221F54769D2960E, 0x2C9CC28857423ED1, 0x4C7A85EECAE061F7, 0xD0CF6863E09E0429,
+					0x473CB3C5ED02E62B, 0xA05B36F8157E3955, 0xF8547DD0B5F71280, 0xC77B2BF6642EF9F6, 0xA288443094ABCBE6, 0x08BCE8C056357164, 0xDF7E62422F97D856, 0xB8CC397993E95B19,
+					0x5DF9A7969CFCE6A6, 0xCD85D5313032F67D, 0x3AF5B3DDEC57EDC6, 0xEE08404F3CED0F39, 0xC2F629A9FE62921D, 0xE0DC61E3298922C1, 0x65517E7B8D6DF5B3, 0xF63CE8955DA9A7B4,
+					0x8AA2DF2FB86A1056, 0xC02C89A15CA5AD3F, 0x3DF5250AC145123B, 0x7D28BC77AF6DA921, 0x880EE019F0A831FC, 0x70A73E4AF862AFFF, 0xAAB7EAB16A3E5DB6, 0x55DCCC2ECF63A4F2,
+					0xE9586B6D1F90D852, 0x7C4AC0F80798C2DA, 0x586465E7B247AA62, 0xDF88F7F0769033C1, 0xD895DE620D9DDE7E, 0x9EAE7B8139C2C092, 0xDBEEEAECB18E189C, 0x1BBE84B147DC7F25,
+					0x0BC611F8320A1243, 0x1FA9D98823524574, 0x5F144A9615C93301, 0x99DB07DDB40BC093, 0x9D9427D42B4CA18A, 0x002F8E5BDE3D2D39, 0x01075B078879856D, 0xA3E8B7BCF281D716,
+					0x54DF9959F5E0570E, 0x7FEED489D02D2431, 0x28EAC450829C9180, 0xCAAA9EDDBDDD4A05, 0x184EACAF0211FFEE, 0x70F90733DF896122, 0x91DA46C8181106D5, 0x9057134B484F5A35,
+					0x7ACC713F39DE3106, 0x5AF18E49A6940037, 0xEB65DBB2E893A40F, 0x398CEA4E28574E7B, 0x64F145352F43FA14, 0x7A3500F1AD5175AA, 0x3AAF59D7223A52AE, 0xD9169E19F9AE0A2C,
+					0xF9A375C75C82630E, 0x25EF3CEE90E591AD, 0xFD45479D15A1A8A6, 0x292A3F627AA645F7, 0xD6A7DEBE7B57DA7F, 0x2056B465DD8B60B1, 0x454B175E6E9EA0C2, 0x4E110F82B25D8124,
+					0x066622210ECEEB97, 0x0C28C96902BA45CD, 0x1777DC8B34BFB568, 0x0890B7145F5F3045, 0x14C034AB51C303A1, 0xF78CABD72B5749EF, 0x82AC8F70E9C02C26, 0xF80BF0D616494AF1,
+					0xFE2B5F01677FDB38, 0x1DF6695D88282244, 0x1D43E672C9E3F6C5, 0x3D3994C2C188CDBB, 0x8A941850C2EBB087, 0xDB8583D4EC1BC97A, 0xCB5AABCBF6B059C1, 0x1AEA9DCD0AD5C93B,
+					0xB9AA18C30189426E, 0xBDD8A5760AEE86D6, 0x38A6B833EAE1C6B5, 0xACCBE28AFAF61A9E, 0x52564DEAEE491E7E, 0x4425CD04DB80CB6B, 0xE5BB37F3EA44E18A, 0x656368F2DDA53327,
+					0x149C649B0DCFC09F, 0xFDDB639FF7AA9516, 0xC3F7B726EA4F5F2B, 0x5BE7581994229056, 0x590D97D508DC3F09, 0x808E34E3430D8988, 0x72F39695CF114A0A, 0x5396F515D42B59AF,
+					0xE35B9160F7482062, 0xC83D0D36944784A2, 0x90A71168492D2827, 0x20993B6CF39E9DAC, 0xA69486E060185516, 0x9CA169E08A8B6168, 0x21E3A80C896B3379, 0x60145F68C6B85D91,
+					0xAB9ACF968DB914FB, 0xF30A424F7C1A0F0E, 0xCF87638E630F5CC0, 0xB9475F14581A48C0, 0x26C7CC43010308DD, 0x8E89E5CA93C619B3, 0xC5DE1E632F0038E2, 0x4F4B4AFBA96D4930,
+					0x74868611DAEFEDB2, 0x527C3816439E7506, 0x8758EB8F9891C38A, 0x225ED5427A4C2EF2, 0xF0DAB125B2117A61, 0xEAEDA8975CB45F6A, 0xEF8DC9FDD759A80B, 0x341BA688AA41C617,
+					0xE4CB946ABC4BC055, 0x4ACC2ECAE020DA12, 0xCB0771C291F3EB22, 0x551DE74863B62F06, 0x57076BAF598CE494, 0xC47315F56F8ACC58, 0xF0BF1F45F5D68D59, 0x54FCF430A030004A,
+					0x4ED28AA9359FB3BA, 0x7C70C3EBBAB58927, 0x066DA8449C9FDB11, 0x4BCA939986F41555, 0xED82C9E5A55A8D6B, 0x83821569498C0490, 0xCA2D10E92CDF17C3, 0xAC1536D5A04C9870,
+					0x88007FBEA2AEF65E, 0x3DDEC47B91A820A2, 0x6BE7718CAB9E446D, 0x0FB9776599BF073A, 0x015A309C3729EA88, 0x29EC5CAD5E2A39B9, 0x5B03D6FC9B5A6ABD, 0x19756E2FB55454F1,
+					0xE33A6EA12A1E7C8F, 0x38D8F581AF8F059D, 0x574DFFAA92C90BED, 0x8093E4788018D49C, 0xF55B65E41CA51435, 0xFA5F0777FF5D1750, 0xF12A77AE3ECB2DBF, 0x9B876B033165D3B0,
+					0x3FF6579572777921, 0x9EFE2615ED19A77A, 0x8F4FD7EA3D579F49, 0xE2F2DC78560311DF, 0x1F5B296628BDAAC3, 0xA655EEB1F9D69F61, 0x474BAE536DBC91D5, 0x19BB588E5EA9D57F,
+					0xC3DEBB68CD78FEDF, 0x7868C33F8F018B50, 0xEA9CA207C09A4FCA, 0x1E42F313DC820659, 0x716A0AED4684285F, 0xF22C3308C858A89F, 0x46AE2D2C4C6C886D, 0x2A5980775EF8579F,
+					0x90E362D459166056, 0x58618E5D04D4A182, 0xA60EF305CEBB5393, 0xD76927C79B2BF413, 0x291C37650B3FF03E, 0x0B091776585C3B36, 0x76B59BD35A02ABC4, 0xCD025B21EAAB6AD0,
+					0x801C01E21EE07B00, 0x41053FBCA134E184, 0xF5B7EDE5E8B51AE6, 0x06F814C2D8A35EE4, 0xDB35567A1BA3FE5B, 0x66550CEEBC8852B7, 0x7CE6E29C111ECDE1, 0x1BA313C350603DD7,
+					0xBD3E27ABDC526A34, 0x02C9AC5E52AF2CF0, 0x0D787F6E8A829647, 0x798DB9A1D8252BB1, 0x3A79848B6F9BCD24, 0x86DC728EC9452CA8, 0x431BAD87AA215E52, 0x099A5E7E2D6438B3,
+					0xB3E536295ABCA4B6, 0x3EA9C9A2D31F3B9C, 0x884B86C34AF513DE, 0x22334D142FF7B4BF, 0xAAF60EB1BA307D8D, 0xA997FC86D2D9B98A, 0xE0EF45DC20CBCD12, 0xF26C84F12973EA94,
+					0xCE41A45FDC6C7BF8, 0x23E6AF5E1D6190F8, 0x88A04849FE8ED837, 0x644C3DE02641A3E1, 0xD08BA73C61162589, 0xBAD3A08E587E2397, 0x3CF8C93676E72F23, 0xEF3A1D9DBCD20E47,
+					0xC11C963E65FD906E, 0xC7D4185F7A9C52B6, 0x10C3C8B6AD531989, 0xDC86DA4AF8D6F0A0, 0xC19AF26C780D040D, 0x6ADCBC72072A866C, 0x07C13D6175630BFE, 0x6212DB1050740CA1,
+					0xFAE3B80A6F5DCE03, 0x6E064559FB786FC1, 0x9512E6CB1923DF43, 0xCEAEBD4A009E5344, 0x08466FF57E6A97C6, 0xB3D7A8D7C08417E4, 0x91EF160AF15D063F, 0x4CBAFEFE0B816AE0,
+					0x0DB8B51019C0FC55, 0xD3CE85B241F90D35, 0x70A2BBD59D0F32E2, 0xBE0A61D74B9CB148, 0x75C1C9D5486F5425, 0xAC0E33D60C5B3936, 0x42C198B5DEB94FDA, 0x7E9B3A9B1B3B411E,
+					0xE747F8B79882CE47, 0xB93B5B8536EC8D9D, 0x1752C0725F9957D4, 0x06E9C32EDBDD1C34, 0x968E2BFD75D8071E, 0x9D3CD8007D7964D4, 0x43B12284C52ECC2D, 0x84700D91F6E27BAE,
+					0x864ECC9B6914E32C, 0xDA12DE640E40F345, 0x8CC01FA643B4B126, 0x92C81ED2CFDE8F8D, 0xA33A380FDA4F665D, 0x8A5CD3878D1C716C, 0x4CCB164B8907D388, 0xEE0189E840DDC598,
+					0x09EA967B216C8E36, 0xD0CC6C43C7625DE4, 0xA4AA3545061A83D7, 0xAB607CA4819F2F3C, 0x7A7B3CB45F51B35D, 0xDC0CDDC84216BBF0, 0x8B17584230ACDB3E, 0x1A27653427FD8CE4,
+					0x4079DA01C74ABD78, 0xDCA155A9069F2FA6, 0x140ECABB0F5858D1, 0x238C63CE9AD670EE, 0x00A0ADAEED5DD950, 0x915A652D0267452D, 0x412B7840918D6C11, 0xFF443CB5823E09EC,
+					0xF2ABD0DBC4419D26, 0xD33594C6F974DDDE, 0x66CE3E9853A68E17, 0x1E36FF42D4CC8A50, 0xE905FFCE2FD7C2B1, 0x0BD1A4767DE7546C, 0x3D3587985B57DF75, 0x11EAC838DAF33636,
+					0xF5CBCA6CF00F4B3A, 0x5ABE8A63196D7DBC, 0x40E9ECD84A19ED65, 0xDEFAA6AB4DADE75C, 0xB970B4DD9F71C604, 0x8F95FA95595C8B54, 0xFE502BCC828B6939, 0xB1035516972F32A0,
+					0x301AAA6D017118B6, 0x7DDA32DECF42BBCE, 0xA7CABCB337BF1FC2, 0xB201B40DED322B6E, 0x45334FBC713B5C63, 0xF123AE6A5B6BFDF8, 0x4F4A3C0DD9918E09, 0xDD40761E9A89F9AA,
+					0x1D26526CF5F02856, 0x31BA640CCA124421, 0x107CC7898FAC8E87, 0xC0AF397A9993E0BE, 0x113A7A1EB683BFF0, 0x82A18B8EBC48A9AC, 0x3C5294ACC4F018F1, 0xA27CC7D1D86ED075,
+					0x6A553FB12B41C8FC, 0x198A60ABB93CC345, 0x8DD74E5B08BDBD00, 0x399ED72FA184945F, 0xFEC7F22D35AFD720, 0x4C624D7F7F7BD6DF, 0x3DAB9F59571ABD8F, 0xB2961F77CB6DD224,
+					0x8B5F096F093BD335, 0x854C456A697D6BBD, 0x456C4D8974390AC8, 0x97D0C73F15A9E35C, 0x5C0A2C7205C3B515, 0x605B37EEC12CF95F, 0xC392A04C48B6627D, 0x8C9565CED115D18E,
+					0xB89DF913FDF04710, 0xACC749956C6EBA49, 0x68CB0BD46D7CF93F, 0xCCAAF08B17605961, 0xB4C0A7523232A757, 0xADCE1B74CC1DC7C3, 0x13CB3FE5CA0DF048, 0x744CFD0C2726B6B7,
+					0xEF1A4C1D6D22C57C, 0xA4934FD5FEB62664, 0xB8BE29F18C4A5AA4, 0x9C92945EA3939BBE, 0xAD11C939577EF0DB, 0xC6E691FA1A404CEE, 0xB33DEB05394877DC, 0x883E0C1DB96F1711,
+					0xCDDACE5C372B45BB, 0x79FA4BDA3538C8A2, 0x71BDCEFCA3F40385, 0x3BA813836D9F147C, 0x7BDF6607AE6B92B6, 0x2EE30BA3901D1FCA, 0x6E3AFDC10DB03A62, 0xA234F3D6AB7EEC04,
+					0x4F43DDA39F1621D1, 0x10B5F8DAFA78E1B8, 0x82F27DD4D3C2B1A7, 0xAB40578ED0AA23CD, 0x44904589142462DC, 0xC9D77278A8539541, 0x3E6F074588B2D12E, 0xDF574CC6267E5568,
+					0x72C6FE0AB95A5234, 0x6314101D3BA55372, 0x5A7D659E53BA8E50, 0x996ECD811B903042, 0x68052E69060B8635, 0xDB164BA6961906FB, 0x310F6C225A059343, 0x12B6F1644DA81C8E,
+					0xB1A57C52099B6A9E, 0x83FE4C5A8743E9C2, 0x34C955D1EA02179F, 0xAF1560855ABB716D, 0x535CE6B70CC0F2FA, 0xD8FDA4B8F0A1C16A, 0x486DC61DD4037652, 0xD57AA39C0019757B,
+					0x8FE13E57CF8EA9DC, 0xC1A25E6B9F919930, 0x8081E9043243EF82, 0x3F307CCFE4671964, 0x242F31F1F57EDBFF, 0xA83328DE1CBD1087, 0xBFCB4F802C76B674, 0x0333B8C78B926F05,
+					0x59F7FF33816D6BF9, 0xE541F19468EFC4D9, 0x547AE05E0015E2CA, 0xC657CD6EF31CF870, 0xCABE2205EC3B251D, 0x280C74A3AADEAB65, 0xD1495FBD1E485C0F, 0x6DB6E9A00C52239D,
+					0xFF2F70E7F5C7A621, 0x635D98C806A17CB7, 0x1920ABB2247BBB3B, 0x2F0004A91B401FC8, 0x1D8C6783A60A1D39, 0x5FB4082DE04E1F0C, 0xEEBD9EA70E37F094, 0xF47EA1845382FEE6,
+					0x5D32CC18A0277D8D, 0x14C33E198E99D036, 0x8A72D2E7A44228C0, 0x8D3C6DCD1F43B0B5, 0x82793BAFFE3DEFB2, 0x1A0B19E273B3AE8B, 0xA4440037FC3DFDD4, 0x347A8D28DDAD9CF6,
+					0xC1728241971481DC, 0x3F1ADA0DD46ED51D, 0xA0464E800C8B2CE1, 0xBB3A188BD475784B, 0xC71379556B0F1C7A, 0x1E2E3FAE9F1AEB7C, 0x2D59242EF02C8CC9, 0xE4741D099F055E3E,
+					0x3A2DD395C71EA351, 0xF20F102C7E132BF0, 0xDCB2563D31E0B97F, 0x583D5E7CC0A7D983, 0x04004DCA5C318113, 0x91E07BFC9F165FBE, 0x9FB18902B2F9B8BE, 0x5124DDEA94419340,
+					0xF1A13AB6FE2EB360, 0x0CEFE0F7AF21B4BE, 0x8C45D9214777AA44, 0xC7CFB7A37A1FACF6, 0x62FE11E10BA569CA, 0x0A1ACBFD283B284B, 0xC64BC5F38B7BE65B, 0xA14419C2A60685F8,
+					0xDC9508C743075875, 0x9EE4E6846BBBD6D5, 0x86D1DB6691C1F3EE, 0x2C3E3B853BE82059, 0xA249527F3F9ADB9B, 0x9239D1B7D3A034B0, 0x1FC4DD12EF1EC858, 0x5DC80175516C8878,
+					0x64AD74C14996E10D, 0xE060615732785193, 0x4409B33BE4D93646, 0x776608CF9C5A40BB, 0xE867C2D7A7760860, 0xD3626A6A4158114C, 0x90A5DBE5609A67F9, 0x34EA2F115A7143CF,
+					0xBFF43D6C4CD658C2, 0x0DB327FAF014B3C1, 0x4AA2AE8F80EDFA84, 0xDC2305C86355DE4C, 0xBE8B6E287ED47CC0, 0xA0E98791D7AB488E, 0x431537F87B19A571, 0x26248A90253284C7,
+					0x2878A8CDFAE585DE, 0x25B598BBD19BEF63, 0xD7030EB67C2BDF79, 0x6359261BE8AF56A0, 0xDB22AF850E51EDF3, 0xC49E9B7F758A12D6, 0xE71BA88D37861ABE, 0x319513A8E95F8BF9,
+					0x19234C295289B84A, 0x369DE8040C6DA8A8, 0x729A40BE2F637EDD, 0x1E24CD97AFD40378, 0x5B96BA979558EC50, 0x9FA5C232A7AD07ED, 0x0C3160C5D57560C7, 0x15498BB0ED5E279D,
+					0x8379806CF722F359, 0xD43E5A83D07907C7, 0xACD6B720BCE32525, 0x0548404C5B4AE889, 0xF2D4ABC2D432903C, 0x0283601909856FAD, 0x0975E0A410D4C895, 0x4DEFAD541C19FE84,
+					0x057D092732E4859E, 0xF1968B84179FDB2F, 0xDB1D40356A4A5809, 0x478A53A53CB81569, 0xFF18AE2713307C6C, 0x34F81A3CCF182D3B, 0x8754B9C3D5A0562D, 0xE7B7AAB35863DB27,
+					0xD147D6A9AE94C7A7, 0x3812DFE796D778AD, 0xD56B7D45F3D7A1B3, 0x61BCDC792D7E4D83, 0x8E8DED38941AA123, 0xA699F8C3A28646EA, 0x9FEA25EBCFF97902, 0x25B4CEFB04ED6827,
+					0x0AF0B4FF2F6F4AFB, 0x6DD0D24D0E162DFE, 0xBB9682918765E76F, 0x9BABCFBF03D82FCC, 0xABAECCD289CA4DFE, 0x819D94660DBE6B99, 0x04F4BEE0989500B7, 0xD178B7E6F6AACC6E,
+					0xEBC19D4EEEE67DBA, 0xA7CDE55C515E7E09, 0x8861C1F830CD4E27, 0xB8256D25A1F3A582, 0x87ACD90FDB93514E, 0xF67464FBCC1D8324, 0xC412E67B174D8F1F, 0x5E9886D271FF9CDA,
+					0x01C35DDEF6BE42A2, 0x4EF9647C376F1482, 0x3C2CFD43E47CC502, 0xDB1BCB9B02CEEF4E, 0x7C5A397305B017B0, 0x60D87CAE3DC33151, 0x6E335700F60470CC, 0x2E4E914EE51AA398,
+					0xE3D798E32BE74C6C, 0x70CFB804F785D412, 0x03D8B1D5C19A5893, 0xADA8EB06F43605C2, 0x5E14B7E99733CF8A, 0xD62E58ACE7134EA0, 0x335AB0B51E38D695, 0xBFA851904FAE3C40,
+					0x9F36A1BF33E30EE6, 0xCCB02ACBB572A21B, 0xD91E3F3D56FAD56D, 0x16055589DC5C4D1D, 0xF7259F31F85F5FC5, 0xF4D5F1CA782CC34D, 0xFC3D896026A04443, 0x9959655DF086DA58,
+					0xE655E933FE7472E1, 0xEA1A731753A21144, 0xC9DA20477AC548C7, 0x6560C12E5FDED935, 0x4D26DB289D2DD1B6, 0xFDB3C6749118B53C, 0x9339069CE5BABFA1, 0xC071B576FBD9D90B,
+					0x3C653B8DCA9E6E33, 0x682A111DB8D8ACAD, 0x74BB2DC06DC6E82E, 0x920126B624736394, 0x799D9BBA8E15AEAE, 0x34E686019F6B7472, 0x2D23490B6966B919, 0x65122B57988D3C8D,
+					0x9DA12B2006D09465, 0xE74098C6304BCBFD, 0x9816EF69308596F1, 0x0F91A25792AF917F, 0xA49DA1F85E85B897, 0x121E0D12806C3017, 0x79F36BAAD5185DB5, 0xF1958F503F0838CD,
+					0x5682D420E9DDFDB7, 0x9EDD66206BAA0BBE, 0x69B0B1E58139B64A, 0xD2A4171DAB09E4F5, 0x50878FC3774C6D97, 0x0367BB80636D3DA2, 0x75D7AF4AF5E207FE, 0x768068F8DDA61591,
+					0x8BB9097ECBD54559, 0x0E90AD65063A3397, 0x92795A443E36C93C, 0xDFE3E50251E8DD9A, 0x40547FF1FBCFE32A, 0xDBD6EFF32E73A7CB, 0x7B6BF7650F67B4CC, 0x7220C48E7691880E,
+					0x5C9A6E388C1B134E, 0x2DAA4FF76A76EE76, 0xFB1344AF672ABC88, 0x96DEA8A989E56D1B, 0x02585DBF062138F1, 0xAAADB8382BA7E1C3, 0x4792A6DD80C11F72, 0xC3D36C046FDA9130,
+					0x446A9FC0B35177BB, 0x39D924E8933D45B2, 0x208CA87104B99717, 0x3F1CC8A613B96007, 0x19A49160013139A6, 0x603DE7AB2CB767AE, 0xC386C61656A887F3, 0x4C356509100CA3C9,
+					0xD3287071B33160D4, 0x8B57DD2E822CB7AD, 0x255BD8026D4420F1, 0xA8EE70645926EB14, 0xEFE9B1DC32233868, 0xF5699F5D28952F41, 0x16AEDC4433BC7CDC, 0x8BE0F477553086A8,
+					0xA81439EA5DC5D3B9, 0x12A8E1C7D020E937, 0x645E61CD48C7E94C, 0x593FD305F7E563B3, 0xF52F80BF6CAEC248, 0x5FAE08DCF922CEBF, 0x8B613107F016592C, 0x626559822DE6E69B,
+					0x937813736C0F9B6C, 0x085CE5FF45C82201, 0xBF350C8225381554, 0xE09A6990FEF19437, 0x1FF91F486E6EB880, 0xE4809D9951214012, 0x73E18AFDC592DAB3, 0x0A6E735639779FCC,
+					0x10812A4F352C2233, 0xB7B4DB597F703E71, 0x38D3E90BC745750E, 0x4A8D1D947877B19D, 0x22D903BD8656B657, 0x9DBD31152F344909, 0x93A83FF22AC2045D, 0xC69C8A63A8FC78EF,
+					0x2DBEC73CCADB7FF6, 0xB60FA176D84980CD, 0xD9AED1B9B69F7A7D, 0xE537EDC363CFC58F, 0x37598316267E0112, 0x396061D4ED121A5A, 0x73F77C0286702421, 0x435E7089D34354B7,
+					0xEA11E3F885A126D9, 0x3CC38C7E92D197E9, 0x624F29AC1625EC2E, 0xD0E05EA00893A87A, 0xD2B813CC91DB81AA, 0xBA91C1F2FF1B0484, 0xD4CE7BAF78DA1E2A, 0x3D1CACBAB3F0ABEC,
+					0xA9E0B2244A793524, 0xCDF0A495ADB1EC64, 0x65B4901FA6957405, 0x0B7AB2F1343802BB, 0xE068B4953E3AFE21, 0x475A10CBBFDAEDAD, 0x509AA80511B495F3, 0xE2AF8DC50B883FB2,
+					0x5AFB237A35D53B6E, 0x6EA86B62F051275C, 0x6A6D4B5ACE5EF66E, 0x9DD4662BC91B6C2F, 0x5AF0114035B621E3, 0x4F807B2239605929, 0xEF8528C79493B6BD, 0x499F5AE784913798,
+					0x4AA7BFE7DF8258E6, 0xFBB52AB3285632E9, 0xA3A086684DB4C0D9, 0xD3674A779E3C833D, 0xF409B703B9E9CF58, 0x8662F434E9A227EC, 0xCF806B2B2EA07612, 0x3BD17ECAE5AFD29F,
+					0x66C459D1BBB3CBF1, 0x77CB44EA501047F4, 0xCA8EA0494588E1F7, 0x38C9C17ED62E2096, 0x9A1A9780B74363BC, 0x2DE6D2A61E7740C4, 0xDD65EC3FF002C3D4, 0xD20F7F4AAFD6487F,
+					0x84CF5626E3F19E43, 0xB10666B9B7098C2D, 0x90BF9625BC680715, 0xE5266361D3675108, 0x556CAAECB902B4CE, 0x957971BC8CFF78FF, 0x6FA3277E4F884502, 0x949520F0265F84EF,
+					0x3E760B07AB5B365E, 0x5C9EC2FF61F3113A, 0x988F2C41982402F3, 0xFBA88139A4D2DE9A, 0x02DEBA39BAC3720B, 0xB7621388BC8433FB, 0x33A2F8F542A2035B, 0x28909AA58B04FC4E,
+					0xA324881A4D053FF5, 0x030720E11FF7717D, 0x0BC93354C6EC1B59, 0xBE1029B5ADF81239, 0x8B8C6055397AF9B7, 0xBB6FE29C03C9BFBE, 0xD7946AF18F01C344, 0x91296D5B86BBF210,
+					0x2E18C7092958C414, 0xA672F0829C4468BC, 0xA8BEEF27E15B4CAA, 0xEA80036E86C9EA51, 0x121AB3C92B529C0D, 0x94BAAF8BBC225D49, 0xE49600F9718AEB7E, 0x14DA4983F1B1D8CD,
+					0x31466514242DC2B3, 0x6057B4FF00BE90D9, 0x3EACD256D0696E06, 0x9A00980A9B2588DE, 0x988352387A32FD97, 0x47027610131C6B2B, 0xCB011DCA7ECD05A5, 0xF482C4CCF9860FD9,
+					0xD64578BD1C4148C7, 0x6FB3160FF815FF76, 0x60C917B15D1B2A01, 0x009E938E39AA66A1, 0x31828695D7C0F2D8, 0xB6909FE61EBF2D0D, 0x6F1FAB6904DD4C89, 0xFA19E3D90EAE4C2E,
+					0x546B919F3660DE4E, 0xB6F188D7317810D6, 0x99D38387964454D9, 0xF1CAFA700288777F, 0x06D923F8C4B50136, 0x4FB641FA0E8D56F0, 0xA17D420DDF946C09, 0xDF93A75B3587B297,
+					0x41217A87C72B3A1B, 0xD594F4233B13D25A, 0xD7320ED1C5F1EA91, 0x7E99E00D9B040DF1, 0x42A5503F391B762B, 0x6177780EFEA0377C, 0xE51A95386D50D14F, 0x0EC19D5CFB523AB6,
+					0xB289544D14F0DE29, 0xED946AF8015B3EE5, 0xA4CF8140E84CC4D1, 0x5B8003652BD8CE2F, 0x9DBD69050FAF33BC, 0x29F0EF9199CE4050, 0x0654909C17DACCF5, 0xC60698712D3ED184,
+					0xC6BE1EDA3B09EEA9, 0xEBF214B58555ADC7, 0x2AC2EFE5968F7049, 0x352062C84E3FA2AA, 0x2C84F0495DFA8417, 0xC610DD57E376BBB4, 0x641F8A93B134613B, 0xA499C59FA9AAA277,
+					0xA799133024E0024A, 0xE6B898A9C7E34A36, 0x786062AEE3E97348, 0x53505EAEAEF39A30, 0x72633E85E16A95F8, 0x8ED59F6C217FB90A, 0x34641A3EB94401A3, 0xDA1EA83A9F91B8DD,
+					0xDC8907596B75281C, 0x55FEBB0D02848D1F, 0x80F27C0E5FA6C74A, 0x471B563AD71D5D11, 0x77965E5D4556D591, 0x0CACF3C3C802FB73, 0x121E6F686C2FA666, 0x248CC057352CC38D,
+					0x7DB548843BB0A07B, 0x03E5AA49608B8DD1, 0x8E8FF9781CD4BC87, 0xA7FBE50A43E3DCB4, 0x64E742335FA0F529, 0xBBE025729E5EE237, 0x3EB87A437EBE5625, 0x59CD304DC87F11EF,
+					0xA3F703A3A1FA2037, 0x69BD68E4F11205AA, 0x77876AD27754C881, 0x4BBF29C0B8C3E570, 0xE227AE75DD6057E1, 0xD89AA45C561C6E71, 0xE442BB32D7FE43DE, 0x2804054D39E2B197,
+					0xD7132BE200D8FEB9, 0x787AF61CA3D09F1D, 0x10CB66F859D38CC8, 0xD3E71AB4D27587FB, 0x773853AE2BF51A6E, 0x9351400548C81B17, 0x2E977B985D43F68A, 0x1279C2BCAE2F3AA0,
+					0x561682A43E8F4670, 0x5A866E462B7DF655, 0x72EEC89BC4B0BAAF, 0xB4B6084693F64543, 0x3CD19CB029D5658B, 0x322D18890D290ABB, 0xD49B420A823C3E3D, 0x326C23DED31CC508,
+					0xE3BA307EAFB3D081, 0x4DD56D3219C16242, 0x6DE557CFAA253D57, 0x916F079F745488A6, 0x84197BC3836DD7B9, 0xF827AC7CCD05C5F5, 0xEB4D4CAF1B7E61BA, 0x87E3B36AFB521210,
+					0xF20A80A51D8667CB, 0x89BDDF95853F0B6E, 0xE3E57D258E84C173, 0xC3597B745AE88C3E, 0x4746E361BA23D437, 0xDBCF50AB2DFDFA0C, 0x7A084F088237F512, 0x39AC4F50B1807520,
+					0x1B5334E0A7963C2C, 0x02235DE5F1EDFD99, 0x2CBAFFEFAD2596ED, 0xDC9363A672AD12FE, 0x6F4A7C3DC3405885, 0xAEA1E42C1D1E0C95, 0x7CD6AE706A3287C8, 0x0B866F07933F94BD,
+					0x78E2064D7151712B, 0x19ACF6B7A0799912, 0x583B5A22EB7CBBA4, 0xC798BB6D76208CEE, 0x5C9E670C3B41CAB3, 0x349CBC08835519F2, 0x4BE1C70D2626ABCF, 0xF6A9F07B152AD1C6,
+					0x3E6D23B2AB133B35, 0x5AC1759FDFCD2D36, 0x0911060450B02523, 0xDC65B6B3AC2F1301, 0xFF9750F317DA4E78, 0x2D3505F31C58E221, 0x5104D5C28BE70E13, 0xC6956D326BFECFEE,
+					0x62C039A11F3C09DA, 0x7A0E1EF589C04F7E, 0x3F2BBB8DFBC49B7D, 0xE421D2C3B41B88E2, 0x742C6364E5075353, 0x20CD015BC6894940, 0x605CD270AEFB9AE0, 0x89F1D91F98B6C3C9,
+					0x075CA59C23871C3B, 0xEA525554A768DB3B, 0x438A009A265593B9, 0xEBC5E4736DBC4428, 0x1644FC22442100D4, 0x5941595F8AF94743, 0x6DC4CD9484A61BD4, 0x8EAC8E50D9C95413,
+					0x09889F15B7A10F07, 0x514F773AA33069F1, 0x09FFF5F3613597C9, 0x3A0E9D60461A53A2, 0xD8EEEF402C15051B, 0xACCDF8150AA852B8, 0xF0D8EAE07008C0FC, 0xA899A0F7BC6A27A0,
+					0x1109CDF0FFAA99E7, 0xEAFEDA61EDA156B4, 0xB4B12BFA467503EB, 0x966460653C14CE5C, 0x0FB51D9279EE4272, 0x52128FEF4053B48C, 0x763A52C3F8DD1DFF, 0x3D05031569B606D7,
+					0xE3EEE4342C7A8421, 0xDB59E14BA19215C7, 0xFE2D384640BC5580, 0xB27C8D99632AEBFD, 0x3CA857DC2E3346A9, 0x6FEF518A0D75D737, 0x3336A863A50C2712, 0xD5B1E44C9D4E5B41,
+					0xC9F43D0E665B73D3, 0xCB1F5AAFD9E97C4A, 0xD88F4357D34E5D2E, 0x532E5A781C78DB48, 0x592CD7D963D49196, 0xB0ABF1A623ED5674, 0xC93F4B3D917E91BB, 0xF5C02174B36083D1,
+					0xC788DF8B44CC8F1D, 0xB891649B319B684E, 0x8A202B15D745C583, 0x59B55E0F309D2C99, 0x85699AEF9974A626, 0xC71ADF2B666BD009, 0x005B568305BF73B5, 0x883C2ACDC993BBDA,
+					0xBE503C032F624DE2, 0xF2C6D03D613D1F1D, 0x8693D241F86FC82B, 0x39D238C2E4E59B8D, 0x4FE8DF6F23CBBF0D, 0xF10EB4379C19E3F7, 0xAADE08166343F58E, 0xE5F5954867C9A5A1,
+					0xA2610D181B9ECC3A, 0x85E61859969732F5, 0x7745A9DA4D7E20EA, 0x6ECEE498E191E44B, 0x5CC2CF8A62601FA2, 0x76D1C3EE1CB6A1AE, 0x921FE70AD25655CF, 0xEA78F1D113E92DF5,
+					0x223F5DA2921D5CD0, 0x076968769F5A3072, 0x9CE2BCC27843BA9A, 0xA7753EF67B45A8CD, 0x770404F3B6E35CF9, 0x139028EB6575CCEE, 0x23AC96199004865B, 0xA8A2142612065945,
+					0xC6514411D12E6EA1, 0x2E3E0DCA5EDE9EA0, 0xE5A10EE4B580CCE8, 0xF947A3C13AD6B8B3, 0xD8A3FF60D48E4B2E, 0x3FDE4A98402CCAC5, 0xECAE3CF03C882857, 0x9394C4421347CACC,
+					0xC8F3C0A35753D2F2, 0x5A1948AA82810F11, 0x820B18273BBFB061, 0x4EFF03CF173D4905, 0xD431143F9B0982B7, 0xBC5AE1CEB9862386, 0x7751E9865316064C, 0x91F12DBA89D86A0D,
+					0xB1541B548E0AE629, 0x4DBCBB627C3E4B36, 0xFA326664B59F5B99, 0x76F5935EA1F75AA3, 0x897110362F068E18, 0xACE76B27B2135DA3, 0xA86FB405D131E5E2, 0x8F33AC78362F7F04,
+					0xA5154AE7AE8F86D2, 0xBA80A355D9F4E80C, 0x2EAD332AA21C5E68, 0xD42A6B4167C24662, 0xBA98C4ACFE03373D, 0x21914B91C620A67B, 0x24B5D8E618405952, 0xC192F517BD877FAE,
+					0x971D778E64CD60CA, 0x63D6152AC3F67C1A, 0xC538D441DFA6343C, 0x77DCE78DC4DFDFCE, 0xE514F8BC699DAD4D, 0x205353A8D55C6149, 0xEE97632B2F842CCD, 0x89FBB64ECED4F422,
+					0xB3574BD2EBC398F5, 0x26C133A8739C04F7, 0x8FFA7C86361D1A7E, 0xB6818E562C0B2334, 0xDC7A58503F8F04C2, 0xD86F9DBF8570A826, 0xA580E1E7C9C30A0C, 0x358340E1FA57407C,
+					0xEBF4F2AC24A449D5, 0xE2FC230A33C9FDCF, 0xEABBE3F0300DD1E5, 0xAA090E98D5F10CC5, 0x44287D7E449A5388, 0x4ECD95C8901658CA, 0xDAA4AB6CFCB90729, 0x455BBD0FB916324E,
+					0xF24800EE5A982408, 0x2CE4605F26C43EAB, 0x1397E380C3AFDFB1, 0xEE98DA9E1C6638E6, 0x93E61CE8BCAC47E8, 0x3BEC90EF05C9D24A, 0x13E9EA117F790514, 0x8974D977AC871519,
+					0xDE78A56BF7A6AC7A, 0x7F39FB71DBB8E407, 0xEF52733BFF1EC341, 0x856F628A57EDF5CE, 0x2F8AF2CF9B2C320D, 0x2C109A812E2FB95E, 0xBFFB8D8EBAC1650B, 0xDD487163FB72A1E3,
+					0x682D7815DD318DB4, 0xBD0BFFC48D535AA5, 0xBF5C81E36958EDCD, 0xF645B86EFCE8B54D, 0x6C8D527B15069DB2, 0xA848352940E792F3, 0x0522FCAFC145D8F5, 0x66C655B48461A8D5,
+					0x6258D823BE2D3EA0, 0xDB0B11D02ABE3EBF, 0xE4797972071623B5, 0xFCDD04E20EBF3E58, 0x36919310B5CC2FBB, 0x32EF08E6E0EF684F, 0xD1D404FC3EFFE4E3, 0x5764605E795E4DDC,
+					0xD4FA71F93CD37226, 0x0536FFBE9C4824BC, 0x197A93ECA377989E, 0x1C0D39A0D065E326, 0x88C881D5960BCFCC, 0x2ACA8A2C02AB8C4A, 0x8280A031A109426C, 0xA05441BFC8EE54F3,
+					0x69F52D0EBF8C0076, 0x5C5109A18A07E452, 0xE7846AE49B4C93EE, 0xC1E0C4A1D8A09D02, 0xB85D08E1B9C036B9, 0x730210E65508881E, 0x5183C84DBF3C443B, 0xF5C21B787A685743,
+					0x64206C76440D8F5A, 0x1BEBFD99018F3F30, 0x96021350ED56F313, 0x00A15F9ABA1B0995, 0x88646D1C59EEBC16, 0xB145E8D6F7BBEA44, 0xFEF0527E4E5DACD3, 0xBDDFE2C67080A9A7,
+					0xCB3EE896521BDC30, 0x5F28E5CFF32948E0, 0x1AC4A242E00BA472, 0x2E020F202BF23BC5, 0x2D6423DB80904D7A, 0xD2F764EBAC692CD4, 0xA64F4C44DAB3DAE2, 0xACD165CE91B3348A,
+					0x28802811923B4CE8, 0x6A96142ED163348B, 0xAB87A3FD126E10BA, 0xB05FB803AE616472, 0xE6D52461C32BCE04, 0x543EC7D7E3A50C4E, 0x042123A9E84C6C9F, 0x391F929C41A423BE,
+					0xCC9C99C717BCFE1F, 0x9DF4D19C40CDF819, 0xA82ECFF27A781A76, 0x6A6A461B28CB04A6, 0x883FB3F1302B96F5, 0x635581411B2D07B8, 0x93BF870C3E032ADC, 0xB9610DECCE62814B,
+					0x8ABA7053E507EAD8, 0xF3746F1E96C08F0E, 0xFB4636437270FE3A, 0x3FDC5B9EC3796B1D, 0x209B0B1CEFC42BB4, 0xDAB33C8F7983D7EF, 0x7A8E7C50BC569BFD, 0x3FE3D342A593B3AC,
+					0xD607845728C2061B, 0x4D738C97936F25D9, 0x23DACDD34CEAE819, 0x8206A76C2AE31899, 0x510D8287BCE00447, 0x628F325FFF34DC09, 0xA360119A1EAC215D, 0xE68A447874A741E0,
+					0xEE2001A1F553E8DC, 0xF5AC61606EE7FC2B, 0x5CC3DDDBCE3EF7D6, 0xA34D0137D32F1836, 0xE5F01C9F4861A155, 0x3FA53389DE96A131, 0x6AA1E4906CC4B41E, 0x07F4A828F1AD4325,
+					0xD864DC734536287C, 0x60106E62A50368C4, 0x8B41CF37F9BAA8B9, 0xA3666083EE81C3ED, 0x7A9FF89B6975AEB9, 0x07801C0FA503CD6F, 0x761D8DA8AD6B7FBE, 0xF6A7781FBB576167,
+					0xF084CE88D5459297, 0x03B82B842029D50F, 0x72956C93673EEA94, 0x554EC35599BE2D45, 0xB046EEEB9E6132D5, 0x644D7EA51214FC4C, 0x43D3FE74F5710F4F, 0xAA28EF7291504FC3,
+					0x99B0F22D5551A980, 0xDF11DD370A4879D0, 0x0D6006009373BC81, 0x9D975216D6802548, 0xD3E6AEAB93D3E9D0, 0x6590905255282CAA, 0x23CA4F191154435D, 0xBF8057840CCA0840,
+					0x0872B3A70596957A, 0x57E60EEE22A38B17, 0xD871F11CCBD6F842, 0x902FB714E455D1B4, 0xB4B089F4CE06234E, 0xB9D20F0B383F0879, 0x55F267F5B4575B83, 0xF4E2E5D989E7D2D7,
+					0xCABB91AC85C8914B, 0xB5B552CA52F3E652, 0x996B6D041C50D201, 0xDF5C5C0D220CE98B, 0xFBE25C97EC0D9E3C, 0x823D6EF3E931F9B8, 0xB6FF41F013A209FE, 0xCE70A6571FE160B7,
+					0x0DDF08647CA1D539, 0xB8FD3F6484C51120, 0x988BC7AB6B963F61, 0x3FB5FDF70AF02D6C, 0x956706C373DD5F7F, 0xD2E691AC0E689B99, 0x64987B6E83F0D267, 0x3B1FDFBDEFD611EC,
+					0x2FC853F7D54BE7CD, 0x1F94C49F1E482FED, 0xA0A6062D15F93D90, 0x2ADEA145F5EFB860, 0x370D1A1F2EE54D4C, 0xD15F38CDAF226981, 0x190AA2B3EB96A2CA, 0xAF717107C7B9D134,
+					0xE72FCD296D82C782, 0xFF69D23DC118EAC5, 0x07F0EF52C97C8220, 0x907CEBEF9F9A4C04, 0xCCD66F6E97371ADB, 0x1C5A0EF07C3DF764, 0xC0AC341C147EEA4E, 0x49B7AB81C555C3F6,
+					0x5346DE7CBDD9443D, 0xCAF4C5F6E47C03E7, 0xB5A9ECE0C1E72247, 0x5C735C6CAB55EE18, 0x1FCE68592724A6B0, 0x852C6346DE9CB483, 0xCE56CAD9CAB6F9B9, 0xAF13009911055FDB,
+					0x07464DE2EDA53F4C, 0xBCC936C3E01E7E09, 0x0DBFCE25A03BA07F, 0xE0DE69CA8CE84C38, 0xEFD1862EC058A43C, 0xE52D87176E021D95, 0x1E2220E3539D44D6, 0x3F22F0BAA0E8E22B,
+					0x42B26805067ABBEB, 0x57E82BA7E1BE6C5C, 0x50A5E4B90D21F9B3, 0x303ED40ABDFC7AE4, 0x2EA85C218F03ED22, 0xC4F044D1F30E8D1D, 0x918CA9FDB774F987, 0xA649FDE0C21CD132,
+					0x8400DF9DD4150906, 0xC5FEAC77B2E3C6D7, 0xFCA62D57506B09F2, 0xED8D7B577B4C893C, 0xEDF6DE9B10477FF5, 0x6E9756A69C5D08FB, 0x1E3447AC4B6D4A18, 0x4BE034147A0BDE74,
+					0x22CCB770529057FC, 0x866E78A7F867D58F, 0x430251196E5EBB0D, 0x7CE5EF3CE5DC04AA, 0x77846B127DE3A989, 0x475EADC06AFFB14D, 0xF0C06AAE4AC9D2C9, 0x741F519EBFB40C96,
+					0x6B501374C89E72FD, 0x47299A50AEF0CE73, 0x0708B80BB82BB5AC, 0x8222881C2375B18E, 0xF0F09859BDAADE00, 0x86A1335343C73A57, 0x225A881A6B6801F3, 0xCC64CC935BD21ED9,
+					0x9431F33BBAE6801B, 0xC85B6E02145772BD, 0x06A0A1EBC4527C39, 0xB4D732DA3669F1AE, 0xFC169902010BE9D2, 0x38877ECDCA7BF315, 0xB07C3971BC3569C6, 0x756394DD3A215EA7,
+					0x1323539CB7D06246, 0x67481F96A73636A2, 0xD7B54CF4C3F1EB2D, 0x1A4AF986227D06A9, 0xF9EF584B45DCA6D7, 0x19B6EE8634B9E926, 0xEC58C558695991DC, 0x2493534AF7768F27,
+					0x7A254B5ABB136A1B, 0x03F5D247566FA755, 0xA3B030C4708FF3C4, 0xF2CCF6877D153D22, 0xA7F0284E3F0BE444, 0x38D3F43DCA8A636A, 0x84646AF91BB7C6F4, 0x3E9F9C6BC3B273C7,
+					0x206F86CF7D453E9E, 0x52CB45DB820DCDBD, 0xCF4A163453059D56, 0x0E164F6527E08B49, 0x7054292E5DD7D834, 0xB6C9A826BEB5D8B2, 0xD7D51DFE471B930A, 0x5404BA3BB5595570,
+					0x19616298A9CBBDD1, 0x40B8E2163F995AB7, 0xD78B1F12D9A2D598, 0xC397EA92EA16DDBD, 0xFD141360FCFC8421, 0xE3DB83269779F696, 0x2FEAB88701166ABE, 0x8F94B537D17FD6B7,
+					0xE95FE1F1B054A6D8, 0x3768A696C51D89DA, 0x7D0904DACAD5E973, 0xF0CBD2714FC128EA, 0x8FDFA5D4F2665294, 0x8D26F1862533A9DB, 0x2AF45EF10DCB05A5, 0x5A2CFB9F24FE1DF3,
+					0xFA6E09CEDE17CD5D, 0x2B7835A6E3C14DF8, 0x37E889C37D9DE6EF, 0xBC09B9410F096874, 0x3F31320D988E5B8B, 0x8062EBF4B3E7EA6C, 0xB54C0675CABAE84C, 0xAA58BE2B6B365044,
+					0x5CF93577C82167B3, 0x072335A7B474576E, 0x4195B955A7FEDE70, 0xADC70B42D8627D54, 0xA10C44439BE3CC6C, 0x8B6FA7AB54FEE997, 0xBDC5015477476E3C, 0x75CC266372C09FCE,
+					0xC6CC06A6236996C8, 0xFF55015F2D5ECEEB, 0x8BCCF404C1F44D42, 0x4F022FCC4A870690, 0xC7C4657007F02E64, 0x2BAEDD549FCEE41F, 0xBD1B5B98438D8D0C, 0x638C6A9E6A75B64F,
+					0xD7C9A9DD15B5B6FF, 0x4599DFFAF9339714, 0xD446D329ACCFD528, 0x194E0C581670A111, 0x7BF249568949B57A, 0x23DB28643D6AE87B, 0xD84F1397616F97DE, 0x0C838AD1A957BE92,
+					0x588E80E8E72C61DF, 0x7D72ABFC955A2026, 0x1674F48DFE6A86E3, 0x289907F300261D3C, 0xF3FB53EA9DE43C14, 0x3B9DCF4DA8DE152B, 0xFB7B97909EA772EB, 0xFD76AA99F279DC91,
+					0xF58C3C63CBA5695E, 0xC867517FF8D9D4AC, 0xBEF9CB850656ED6A, 0x1E93577549AA2A5A, 0x12EA71191A01B85F, 0xE4C7BD3453359360, 0xFF7177B37353DC44, 0x7DC74277CEC3C087,
+					0x5899ADBDB5F42A71, 0xFB726DE4F80857C8, 0x6E81F659D1054494, 0x164F8850EC7F1063, 0xF0F74218B94E9CC6, 0x9F7B3A88171BE2C7, 0x718CF374DB5AB4C6, 0xA505F84DC5379D34,
+					0xCB0E34FEAC1E085E, 0xB87582F87EFEB46A, 0x1C69A90042461C84, 0xFA8698FC50B28E0F, 0x49FDC7BBE3D2E284, 0x78F9AB61069CE75B, 0x09FCF184A953620C, 0x64AF0D2F7FCE2647,
+					0xB91A15162440011D, 0x032E6CDF2B6695DF, 0x628303184A8DFB4F, 0xB070B719B3981786, 0x2437EB117DD1A5F4, 0xA7D5CD413159E0D4, 0xAA79DDB7BCBDC84F, 0x1EF092B13663B694,
+					0x4BF9FBD68B0BDF36, 0x98F32456481DF053, 0x3D903B629F02B7E3, 0x457236BD6335D441, 0x9A4B1022B11789B3, 0xB0F3A9E5F1368D53, 0xD4CFD90DCFD3616C, 0x98D44170FE8A6FF9,
+					0xA99229791924D205, 0xD551450DCDE934CD, 0x1B680D284CB36057, 0x1C2875613AC85457, 0xA1D240DA80DE033F, 0x85ECC53911DD8BA9, 0xA05722050457C5F6, 0x508FBB0731DA9CD5,
+					0xC5E418648BAA798E, 0xE9837CE754F11E66, 0x689F1FD166DB0B72, 0xEAD8DCD7E31649B6, 0x243C8878CFDAF4C2, 0x04D8292452896D96, 0x480E58DCA760EBB6, 0x02F33EE5BA57C1E3,
+					0x2A47BE46AE6F247C, 0x318CCBB4E70CB2A5, 0xD77CC87D43616050, 0x7DC64D48860562E0, 0xC81D007F92B2847F, 0xD740338D546758C0, 0xFEE35AD1D5F4C469, 0x5DFC8EBF111700F6,
+					0xF8F2D96A156BEF68, 0x3C75BFEC8694F5DF, 0x86EA95E3E04BBB83, 0xCC04D60F445B4151, 0x64867054B22183B4, 0x4B6179DCECD9FCF8, 0x85199C490D3C475D, 0xCA2EEB39831067E7,
+					0x765BEFFB2D1A8AC0, 0x121AB758E1E96194, 0x7A641D829902BF4C, 0xBB1903E76C4B15D4, 0x60C52DC892588D48, 0xE8E98163E970384B, 0x8CA78E1B87442EF2, 0xADD64E66EBAF491F,
+					0xF2BFF75766180147, 0xC96A6E67234C4366, 0x89E9ACE09D69A53F, 0x6F02A48A0859EDCC, 0xFAF7094AD152E0D5, 0xE163B75C2F963A6D, 0x3F3AD5BB81AC5995, 0x7F9AA5AC8E6C933D,
+					0xF7C6A0054DACD848, 0x627A0C156D4A2EF0, 0x6A63DE518FC02FFB, 0x004853DAE6616053, 0x063EBE6E2ABAC8B7, 0x4563EE8BD9F36EF2, 0xF4EF09C59B33209A, 0x34D7D822CBA23ABD,
+					0xF922DE804EDEEEB2, 0x86543ED0CB2757AD, 0xF7B39B4588D9912B, 0x889BD70FE6681D70, 0x8E43A4DB6AF12465, 0x0A5EF6578416207D, 0x37FB5D1E33CBE626, 0xC307DB834ABB2F53,
+					0x8279081DE29F1034, 0xAFC320FA8AECD81C, 0x59F955570C02CCBE, 0x7B4D411155BEBC19, 0xD3A6608D857BB04C, 0xE3E5E1E18D7BFF3F, 0x010FF0C6346967D3, 0xC41B3E4F591276CE,
+					0x23FA2F02D58A0F2B, 0x801C15BA08604C7A, 0x503AEF606D5768EF, 0xB87C7CC870F3707F, 0x01ABD43996E14B48, 0xA0C58DEB6149F855, 0x862B6C62B6CFCCEB, 0xEF7DCC685BBA5000,
+					0xB8303CB19156B440, 0x18EFA9792278DA51, 0x7872DC1493F0693F, 0x9CDC9994BDF1F62B, 0xD7EC36FB482A5578, 0x6BFA2CBDFD2D21FC, 0x8F3FEAD543ADEA6C, 0x0C9A32E637501EEF,
+					0x70963335A300CB1C, 0xABC483EE3DD8305F, 0x0F0FD7C6C983FEA9, 0xCF0AA234976BD71C, 0xB3142ADD6903F7BE, 0x9053BDE1E5476817, 0x7A0A251BEBDE89E3, 0x7E5F6F0AA2477FD1,
+					0x55D5BB4FC866C5F0, 0xBE13E07E9FCC94C8, 0x13A8F0CF86F688B8, 0x87BE33CC3FC45DB2, 0xC1F7D19112E2A544, 0x1F0E7642B1C0F60D, 0x73789400F0E7E4D6, 0x757BD6EB2B702EF4,
+					0x2A4B6E7215111E54, 0x1FC9C63CCF8C111D, 0x6287C87CB5BE57BD, 0x66E5937D56BF7489, 0xE84D9580A8045A0C, 0x8DE0F256D0EB0928, 0xF23FC045479ACB11, 0x75A1BF364E97EDDC,
+					0x4D077E48BF865521, 0x6733D96C63576A3C, 0x34DF67D28E450366, 0xA96D692616070FEC, 0x2548C4CE93C45A79, 0x1659C86F20458DC8, 0x54F6D99A03D32F02, 0x251966409437F75E,
+					0xDC22DBBD76B89855, 0x71F6D0E92B9B7373, 0xE615C0CE4D37B061, 0x244C55A192CB01A8, 0x1EC60F01638846C8, 0x320C405DB51507B1, 0x9F6FE8698612FE11, 0x7DD0C4AB09FF5E1E,
+					0xE930A2586F745936, 0xD20637877D6DB871, 0x37C25C6DE97AD3BF, 0x7ADCC8BC8FB2C82C, 0xE53FF9326AEC5C89, 0xCCF475A535084712, 0xDD2D7122ED218506, 0x5B13502A9C139842,
+					0xBCEB203F2E1C26A5, 0xEE32B539FE7B7067, 0x8F89F599D6D9E504, 0xF09B50C9FD632373, 0xFB9F3A9860DE9D0C, 0x125EBF4374346A68, 0xC7F1201252E3E31B, 0xDE78629293665D2A,
+					0xE5D7D0D118D692B6, 0x467A9380D70634E8, 0x33175D3C615582A0, 0x5F0D365359091496, 0x9857FD189EB991E7, 0x13422243069985A4, 0xBD582B8F5E6C157A, 0xB0465D2AC1FAA598,
+					0x1A33B9CB4A273BB1, 0xD7136D3F641A737A, 0xE4A60B149802B5F6, 0xA70EF855092E5CC7, 0x66479F4AAE0D4747, 0xD5687A6A3BB2CCF1, 0x889645A9B68A8A0A, 0x33E184F183E9EB1C,
+					0xE694F832C64422B8, 0x8BC51734F2C2BD13, 0x35D877C8AE07D6F3, 0x7EE8F14C9D57022D, 0x9DBA81805108DF62, 0xF1FFAC6CF39A6F5D, 0x58391F7538B9AD96, 0x8E3A0F69380782A1,
+					0x048F3A9243E9741C, 0x733B78DC15614C04, 0x01B4E5B2CA97C55D, 0x05F6647E582AC10A, 0x0E48B6136951ABCD, 0xCD66101084D2F85A, 0xCED71D1CCC47EBF4, 0x431E97EBD295B891,
+					0x7C35BBE5311313E5, 0xE5C783D0CDDE214A, 0x8BA4C0A326EA8FEB, 0xE0E655B80F00D4AA, 0x1112578DB298A822, 0xCC6CD79754DE3ED7, 0xBAA0F9AB0ABBCB65, 0xFB50BCA7788AEDB4,
+					0x27525C0C4348DB86, 0x177CF72D5FA2D6D7, 0x6FAD04A198B5D6E2, 0x9993A9531C1AC106, 0xC40E631F8DB6C229, 0x65E2D59A8BCC2E38, 0x145E9C463281A437, 0xF2E40181FC5D0ABB,
+					0x04A837CAE299440A, 0x2A234D8644CCB029, 0x28F4853A8322CF8C, 0x0E9936D6170E4A53, 0x0D5E50242706AB78, 0xF3D7E642C817795B, 0x20F93996AC15CB49, 0x51A51D346D31C039,
+					0x43ACCA22B64A6708, 0x518933BDED0247CB, 0x9DEC431EE49DB33B, 0x937CC84C4F3CDB32, 0x9925E0C0FF1BCFDB, 0xE7B1629E331D8782, 0x866DB4DEF9B49624, 0x819FB713DAA9B28D,
+					0x70CA562325EB6335, 0xCDD8160F45F7DC13, 0x03C1BFC06B008EB4, 0x24A9C149D27BAA13, 0xCA1B29C33C4578A3, 0x07705897E300B288, 0xDF2FE2F3399610F1, 0x1EEA3BFDB8FF36C6,
+					0x162DB2DF2D654322, 0x80153E4347F22069, 0x646767BC72B7EF50, 0xD6BB228B4CA4406E, 0x75E9DC25B83ACE3B, 0xB31B432687E01D67, 0x4741E422E490F5A5, 0x6AA66D584A70F46B,
+					0xB1DFDDDCDDBD6EAE, 0x6EC28D46CF155FAE, 0x9BBFEA3D21526774, 0xF828C9FDFD777EC8, 0x6B373BA6ACBCAC61, 0x3BF3FC178665B4D4, 0x26AAB77EDEFFE6AA, 0xF5034908A78C5192,
+					0x284C559D547C34F0, 0x87FDBD04D95B67AA, 0xBE506D69101D3180, 0x6C769685019DBD1D, 0xA2A77F7EED12D5E9, 0xF7A3AE7995819F3F, 0x633ED3884D06E3C2, 0x599204B29E19A027,
+					0xD6E5EA1D0FDC73CF, 0xA9ABEC9F09602A90, 0xBABA66C07C012545, 0xD46053009D8EFAA5, 0xF7A1312CBA1649B5, 0xFDD217D832E4CDEC, 0x937F08AD67F20782, 0x25460F88A2CCAA88,
+					0xC7E3C829F535BD28, 0xB445A4224EDDC78E, 0xE2ADBF62F10F4772, 0x5CBF284470F903BE, 0xA13F93670D32202E, 0xE9A8CD55E1FE901A, 0xA99F88F9DE9FBC84, 0x1E68AED12C237EDE,
+					0x750500761D967F88, 0x722F61A7FA2D55C1, 0x1C6E672462CCB7BA, 0xE6A5389AACB5A981, 0x6895B7625F7E0E7D, 0x8795A8E333801689, 0x7193C67D94B610B9, 0xD3580AE26B2867BC,
+					0xF6CF885AB8507A76, 0x077211FBC4FD0A36, 0x3C4F15C9E6A5FF8D, 0x385A941294A7FE34, 0x407B67B2B12460A3, 0xCB8F075BA10E6FFB, 0x2516A02D4D26EF0E, 0xB453E1DBEA4F6EEC,
+					0x30DCE38D9EA9A5A3, 0xCE2F32E4F19DF11E, 0x52159B89AD3E6FE4, 0xBD1B03FF84A3B518, 0x949F7A3AD62E5CFD, 0x92CB44EF8846DCDB, 0xC883B48423EFFB8D, 0x59E3F848154A6899,
+					0x7DDA373955C40955, 0x933E294C3369274E, 0x3C6C33B7D2DF363B, 0x7E1B8D13B9F79ED9, 0x42041ADD4F7543A9, 0x73F139847F2B293A, 0x5648177C33D9017D, 0xFB4DD15C10AB4A9C,
+					0x4F8AF5D24E4CA807, 0xFCBECDC945072051, 0xCC17D5894AA9DC39, 0x2340737CD4B93E02, 0x212C2B68FFFD5B20, 0xCD32733D9BB68E0E, 0xF717349CFC4AEE90, 0xF2B15F6AC35D29A4,
+					0xD9CA16E5BB65DA1B, 0x6091AC94F6A953FB, 0x3565DA47A1F7B827, 0x520B8FDBFCCDB2F0, 0x91DFCA5F02D533A6, 0xBAAB359C4E0C6418, 0x9D3D71D636A8FE5E, 0x8F1A5CC031E9D200,
+					0x4FF5B91EAA764378, 0xABA607C6BFC4FF9C, 0x99FE022BCF30EDE5, 0xD06D16A128B1528F, 0xA2FB6D67473013EF, 0xD468A8E520683970, 0xC670AD13893B36DF, 0xEA43D604C10E9962,
+					0x2239FD9A4D17F88E, 0xAA348032C941184A, 0xAE79327237AF36CD, 0xA3124ABF79B0ADE8, 0x98936D1237C28F23, 0x2BC762AEEE76670C, 0x3A23D1785918A72E, 0x1D875DD2297B698F,
+					0xB88F31D6074CFAAF, 0x89F05A2B45A4C70A, 0xE8EDBB966F6DA155, 0x9FCCB10B58C63935, 0x7B05084E87468D7C, 0xDED30F103F618DA1, 0x5B7E724D4B9BD073, 0x794C267628FA1FB7,
+					0x1314FB6B89900685, 0xB62C10DDF3871A93, 0x54EB9280FE0F57B2, 0xBAA595E5135960A0, 0x0DB67FC9FDE02AB2, 0x42A4729D615C3DD0, 0xE1CCE563889946FB, 0xF834D207334C33EB,
+					0x857241412BFA9699, 0x6B3AB681A9F86CD0, 0x74D2E2AADDED3E9D, 0xC82B7A53A767F5E1, 0xD18483871957F7BC, 0x8B2BCB48E872E470, 0x8F359E122F506F9B, 0xE8868B106AACEBB7,
+					0x741A7B743C21147C, 0x56104C8E3F5540B1, 0x249F72A1277C0226, 0x9D1D2581A537E049, 0x9671B152CA1086C6, 0xDF2BC2C36E4AB133, 0xB18E67CB44175108, 0x0744AF7D9AAE668F,
+					0x7905BF0E1EFB4E44, 0x2D68D8A20B244ED1, 0x4D959227532304B0, 0x65A35F81A94B24BE, 0x6E99688C7EC1A1FA, 0xE8FF01C1FA064446, 0xB09A961265DEC7FE, 0x5ED8B02B879E5DE0,
+					0x9E757FB4C65B98CC, 0xC9ED740AA048013B, 0x912D1A681A13E722, 0x2B219B3FBCEEB732, 0x200C191DCB384713, 0x58195D84740ADB62, 0x5EBC01C74E330CB1, 0x85095220B0BAE1A9,
+					0xC7FCBD9F098E7CC6, 0xF5E2AB612210B9BF, 0x0F292F14C2BDC136, 0x5C1FC8042A6591FB, 0x5EA0368AD298E28C, 0xFFC6CAEFDEF76A1A, 0x78BA6412A8D3B45E, 0x22001C409A66B7EE,
+					0x4A147B013750BF8B, 0x64B15C360F017067, 0x730B000A5346DA19, 0x9153877A93A2A315, 0x542D59FCB0BF91FE, 0x77D724BB1E158599, 0xB87B5BEF66D53CE7, 0xE050CE9A60636872,
+					0x9D60A90F144BA761, 0x7918039016BB6C77, 0xBBD089EC67643193, 0xD75C88641BE3A0E4, 0xE30D151161FFA7CF, 0x70318917DB100066, 0x3D0A20B5E3EAEDF5, 0xAD50CB4AE01B9C4E,
+					0x21DF8423C19D7680, 0x23AC717415D5D8FC, 0xF26D36BA483CBBBC, 0x83D5782C21787EA3, 0x6C7674E3B3C4E110, 0x79BDA10D7D318E7C, 0x0A67C4ACA703F94D, 0x1FD1B086931CD937,
+					0xB25D5AE11A94C318, 0xDC1DE92625CD6C26, 0xD409BBBEFC10C3DB, 0xD2FBEB910B3361B8, 0xF28EB186841C2377, 0x518AE5D04FD3DB8F, 0x96CD041542801C07, 0x7F7D5E472E6B8C03,
+					0xDB57401DF188EC49, 0x32609E5AF21BC39E, 0xE6F2C4C101952528, 0x4E37F0176EA1EE88, 0x293EFF65189DE90E, 0xAC4856D17FEB0A26, 0x82FC385A67DDD2CD, 0xA779709DD0BEBF84,
+					0x534F3B410F66E8D8, 0x84D75C97DBFF1968, 0xCBF8D368A7F6C580, 0x3674DF650FB52385, 0x343F039E7AFF0CC2, 0x8826ABD145D3C106, 0xC4DB424B431988B1, 0x547F68D80EE567F0,
+					0x9F59B289A8493162, 0xD249868C9B4A8FFE, 0xCEA785023F922E88, 0x760E8EC299B49CAA, 0x94B5F156103C10E4, 0xD4958CE61CCB7350, 0xDE8D5144B4FFAB1A, 0x57DAE6AD9E0F1ED1,
+					0x28E45FAEA7EDE500, 0xB54EDB87D60EB77A, 0xBD44AC8A4DADFB94, 0xB50EF943AE75C6E7, 0xC372FE224EA27367, 0xF0B6B6AD407071EE, 0xF62F502F98799E19, 0x0DAC211BFBB28D98,
+					0xADF6CDF0EA496216, 0x7D535751BE03DAD3, 0x4AA6696E2335516F, 0x121E59952062085A, 0x185D2F50EB5233CE, 0x3728AC9DAAA8B962, 0xB6929FF4F51A2254, 0x6E376EA0F18968C3,
+					0x8948843DBA778887, 0x53DF415FAC98EDE1, 0x93CF6C02FDBDFE04, 0x4BFEB4A1534F3AB3, 0xB8D7F6A26A711ADA, 0x32E5DDC54383C91A, 0xD6430FB639EBCC00, 0x78FBF840C8BC74A3,
+					0xFDE7E18F48C98119, 0x61851793AFB1CB9D, 0x1CCFDEEB77FF6080, 0x413B38430DDB7E68, 0xC6DF76E924CAC8CC, 0xAB484DDE23A199F4, 0x53395D6853CA7DD8, 0x8C4836BDD6D3AFB8,
+					0x2A47AC0281073E71, 0x480D722D622C27EB, 0x7E7A38D8715885AF, 0x52E3DC8E42DAFAF0, 0xB44363B5BFDD0041, 0x9023B34AEDC2896D, 0x19D19E3D0AAA0575, 0xC5CDA2A1BFABEE23,
+					0x161802668041F9BE, 0xBDACA80A71471854, 0x95683CE90FF0D118, 0x767FFBB9F0146602, 0x72D97AB9BE9702A3, 0x42B720F4964AA112, 0x787BA3DC72CE6ECB, 0xF771A64CB45C05C9,
+					0x139864A90031B588, 0xDF5B8AB756E6D827, 0x3D87AC89242A840E, 0xE8EEE0B8ED97C769, 0x71BA04DBC7686B84, 0x4A3A936710979CE9, 0xA19315180749DFB2, 0x394F536D860D01C5,
+					0x754C642516F36595, 0x8DDB53233EC4E4AC, 0x9EAB233EAB08FE28, 0xEBFE5FAC11EE6E91, 0x188CD13813E2AF87, 0xCEED68C15BDB7BD5, 0x449C93485637233A, 0xD4CCA6B76123E2A3,
+					0x70FE6EC78641D322, 0xEBC082C9E21B84B5, 0x2C15005C635C21A5, 0xEA35B6562C55C258, 0xFFE5730901C376A8, 0x822322BAC617CFD6, 0x4DCFAE7E12A1F277, 0x6D3E57660349224E,
+					0xF0E1BBE2AD4BB9A9, 0xF1DBD6D54959B200, 0x7FA11E78ADB321CF, 0x3A2C5E32B26AE0CC, 0xCFFF6A37755044F8, 0xAFE20B9EF7B28C50, 0xF019F9E429CEEDC9, 0x7D538D484C777A29,
+					0x2DBAB85E7476A7E3, 0x5EC519FA0F4A4D4B, 0xB905C1C1662ADF6B, 0x9FC8E574AC65CC2C, 0x7B582B063224C0E7, 0x9EAB4BB8C66B551F, 0xD90BD8B3D85D2427, 0x8CBF10EA43E46388,
+					0xE114E3C9A916A411, 0x7ED80242CD0173F5, 0x374EC12DAE1BD703, 0xB747817C5194E8ED, 0xE2A219DCF2E6C598, 0xC7E24CCB70FFF3C0, 0x7C26DD9C0FD2B9B1, 0xFD87DDF38410B2FF,
+					0x4C97C421211E3942, 0x685AD23B403F898E, 0x828DE052884C8965, 0xB11840FCF3C886F3, 0x1105D38FACA1B1C1, 0x6D8D7732CADB2115, 0x0ACDF959D330982B, 0xBDC94A56DD8FA368,
+					0xCE8C093AC9A57BFD, 0x38658DB5B1F58AB3, 0xEBB73ED44ADEF6C4, 0xE2E7BE2AA8D59AEC, 0xC8197544D57EB477, 0xB81E2B865FDF7036, 0x982B0DED1A0FB040, 0x4D2546AA7F9D8AAC,
+					0xC24E88741E6FEB9A, 0xEB72F2E1778623FB, 0xF52E581C577B8883, 0x2D839B77AB7CD9BB, 0x155F3B13263985F5, 0x00EC79DB8D3BC45D, 0xBE54120157DB1560, 0xBF367A058E7E3C50,
+					0x92771D868D1EAE8B, 0x181D80167DCFA789, 0x993D7F17ED65D1E9, 0x93D6F15DC13986EB, 0xC2FE3B2C670373A0, 0xFEEC87B1017E498E, 0x2DCF6B1070E13A19, 0xA7B8D19981E5419A,
+					0xCD91AAA6F384C70C, 0x9EF26B7E54E97E9A, 0x71552B48F4FAAE13, 0xF4F052E8EA9290E4, 0x50B67146AA060B82, 0x554384AD0AD3F40E, 0x231B60DCFE7873D8, 0xEE349B1812D81E93,
+					0x3900C376FDF4CCCB, 0x32DF6C849A612088, 0x7D3D61C49B91B8A3, 0xC2DC9B69745473A2, 0x8051D3C60952187F, 0x76EDB8C161333CC6, 0x319184301948D687, 0x66F14A073AA7A20A,
+					0xCE7AA26D83491BAA, 0x4879CB7246F5CBAB, 0xFCBEA9DB9326DE2A, 0xFF2195941259CD94, 0xEAEF6C20D6FE2E80, 0x4EE4261E3E75CCBA, 0x4A6EBC0BA31CDE38, 0x9865E71A8CE87C6E,
+					0x862F95F2C652A264, 0xAAEB4B73B4795228, 0x7C71204AC9A11271, 0x799F9CEEDC3FE33A, 0xC882FF143CC04959, 0x50C7A41642AAB4AC, 0xD16E9CDE1744F586, 0xC85427E78C5E797C,
+					0x1CB20382FE8BB9EE, 0xA3F693B19C05C676, 0xB3E1ED4E3927C6FF, 0x042A350DE6E44C5A, 0x755398C024380906, 0x4B7883A76C40700F, 0x1BC302D55C52DCF2, 0x6443FD12B1D588BD,
+					0xEAC25AA7A1D4A12F, 0x800E6B071C7DF021, 0x7C96349DB516B3A1, 0x9109F6A52CECE2E0, 0x3093BA742F5FB629, 0x70D03E33DF2A0AC5, 0x2680BD35B54B9D45, 0xCE3ABAFAF2C40521,
+					0x2A0604EC93A73190, 0x7CC80A97E3604FFD, 0x30B5BE5AD6A6770A, 0x634DADC0DB91B411, 0x6AF00105FD2ED2CD, 0x733BAC8C3B913422, 0x7D5499266EC8702D, 0xE54EBBC265F1F53E,
+					0x79E2A4B3D463A10E, 0xF81A01E71547E77E, 0xB8A06D51DB4A8BCA, 0x364D564B7760EF0A, 0x5289609A7022E568, 0xF26104A64F80F709, 0xAB6A496A66C95C00, 0xB124B2407381968B,
+					0xD55202D3E5E76EFF, 0x20FCCFA9E826B8AD, 0xA30EC036F64E152B, 0x0991C112F8E8BD5F, 0x71B5EC67B43ED09F, 0xBAB9C041D0AE0EF4, 0xEDFA88CA1C5EDF9F, 0xC6B009E8B04D7270,
+					0x487DA4F722562099, 0x4F88B3F7AFA0D6AA, 0xEAE47EF24E205F56, 0x99FC75336FBFB51F, 0x5DB4DD2004769F87, 0x95B24AB77D4FDA38, 0xD4F5394CCDEB468D, 0x00F08BFC80B42465,
+					0x56D9D82044AA6AB6, 0x9B37A27B5CEB38E7, 0x700FDE77B581907D, 0x341AFD1C875BBEC0, 0x2D169B59D27ECC8C, 0x9BE0CE311C4110D3, 0x1DDF5FDFFFC9D1B3, 0x0BFFB3B5AF4AD63A,
+					0xD7A64F0094F3C189, 0x9E5AEE74691F709B, 0xA0DEE6689B49356A, 0xF98FF2B2239DAD27, 0x72BA6A3E3904ABC4, 0x42E4C4A4FA163EC8, 0x5803AA3237EE1980, 0xDD51E482F8C5A973,
+					0x879F4ED532616DBA, 0xCF5587A6518F6C8C, 0x1E769CE34F49DE69, 0x5821D821BA7B44D6, 0x39726538AEE67AA1, 0x6D2D6F09718352D3, 0xCAC16A054C1894A5, 0x22BA107CE2B88D6A,
+					0x954588008822478F, 0x4F2B815EF358A672, 0xE6ED23B4E17C5D2F, 0x4B984A22B50FA06B, 0xA30DBCCA035F15D1, 0xD4EE2BEA839AB199, 0x022A8F3F312400C1, 0xD8BFC8AC1EDD1829,
+					0x2CB7940645680A94, 0x300D528AA0D2AFED, 0xCD24D6F6DC51BEA8, 0x5342A22E6DA89160, 0xE5F44D4BA5D89164, 0x0FE21B6386BC59A1, 0x273D30058A6B7877, 0xBDE0A59E4BF19287,
+					0x3E2882B228B7D831, 0xD3EC05EFFFF96648, 0x2D08912C55604DA3, 0xFA5ED45314915FA6, 0xADDF5AE17E97D559, 0xDE50786933590084, 0x894C6AF6BE51B43E, 0x9EF3B947BEB12BBF,
+					0xF872B436E5693063, 0x00256231569C1E91, 0xCDC20414567C067F, 0xD572E4D8060BA842, 0xFB87BD027403F5DB, 0x7FBE2AE3DE1D2BC2, 0x2505F20F6624819A, 0x73205EF0752193D8,
+					0x9A9FBEB0FC145C4F, 0xB66DFA824F2967F5, 0x1C5FEC4F2FBE581F, 0x99C9D12A555AB474, 0xDA3B508863566DAA, 0xA44BEEC3898785A7, 0x395DD0B258D650F8, 0x8571EE49389AD312,
+					0x90F919374051D09F, 0xA7D11D506ECCA9CC, 0x390774CC503C4569, 0x9297A304904E0466, 0x2EE294B626B6B3C1, 0xEEB5A75A0849BD38, 0x496C575FDB398C41, 0x1F4BE78C13A0DDCE,
+					0x1B4BE8CFE5B51A94, 0x39B20CE49D4BC6EA, 0xDCB631E945C2265B, 0xB8063D786CC81523, 0x52027CAEC5400A75, 0x7C6EC592B1946BCD, 0x3BFE130C7CB948AB, 0x3FC9056A0AC342C9,
+					0xB1E57687F86FAC46, 0x6EC32BB95A36E528, 0x0AB91D5231A3B1BD, 0x1093402AC94365D4, 0xCDF35A7FF30A0224, 0x468C5CE441D426A9, 0x08E9F8F06915A70C, 0x859A5EB9B1270AFC,
+					0xCB76DCD9BF0AD5A6, 0xC86C9EDADAB8B4FC, 0x321FAA80265811B3, 0x6E392EBE207D97B5, 0xD6C8B7C75D0CC096, 0xF89072010F620D8B, 0x6F57865292D28D21, 0xE47DBDE2401DC824,
+					0x7E3FDE083D60E4B1, 0x9BACF7D113207025, 0x5EC90441CB0122E4, 0xA11AAEEFA65A9241, 0x5987DC6143D81F5F, 0xAFABF25C93DF1591, 0xFF0801D282D7FF93, 0xF0058BBAED59FDDC,
+					0xC7AFC9E7003E0B5D, 0x6D13E59649E82ABE, 0xBFAE43941E843F93, 0x7D09118534989A77, 0x3A09FB2C7F0544E3, 0x1C46E4FF313019CF, 0x4C4246A704DB53F5, 0x9F1AE74AC21C303C,
+					0x0EFC5FBF88BFF81C, 0x074AFA0727A2BD9A, 0xF5B6DE11A4532D45, 0xFA1A200FFDFF9304, 0xA73EC992AA675E93, 0x53957C258BB63F71, 0x16EFA926AF03B030, 0x1AE35786B8184AAE,
+					0xA1E68A85C9543A6A, 0x00DEB42A952865EB, 0x1F0A9FE095530EDA, 0xC0C8FA52E9AAAC9F, 0x9AFC58A49DF3A038, 0xBDE1D1D6FFFA8448, 0xFC89B0B3C9F48BBA, 0x2043F02E30F0F31D,
+					0x09B26F5EDDB85E7F, 0x83DA7C6028492DC7, 0x03C11A7D06457215, 0x573483E15C679985, 0x0B858DAB3FB6B6FA, 0xD48960E4ADC6F1D2, 0xDE7C77C76DBE96BF, 0x9B31CDFDA35EEE7A,
+					0xB72278346DCEBF48, 0x883A214B1A39E4FE, 0xF5FBCFC823987473, 0x351B7C9F4E5CD4D2, 0xFDFB610EF4972C34, 0x1903D57251995AC2, 0x96EDDF9706A9F9FE, 0x6016D18B46B5289D,
+					0x5199CF75D71B863C, 0x5C27D081BF300BCA, 0xE6367D398233DE33, 0x1F6956FF1B4C2DB0, 0x5C916C3B574B626C, 0x461056FD4CB01F6F, 0xA4FAA6C9ADB3571D, 0xFD3FD3C8CDF02765,
+					0xE588B0AB6B0C5C4F, 0x7935DBABE5C356E9, 0xC58E6B5D0EA86EAE, 0x044747E629DA526D, 0xC44EB636FDCFFA4B, 0xDB3FB06EE7BE19C3, 0xA49AFF83AE04DEEB, 0x7D4CBDA8C20FD8D5,
+					0xFBA529023E21B367, 0xD3F595BA2BD61015, 0xDB3871957EC8F9DE, 0x331476DD3727F8A6, 0x683E49E0BD63B38B, 0x5784F90B7B098217, 0xA45F756E9E0CE1D4, 0x58D5EB71B3C7A0B7,
+					0x59C6558A099FA281, 0x4541D8227C2D092E, 0x7F027ADB969C8D66, 0x4FE5E9F6989E42A7, 0x97463CF308BFD5C0, 0xA2A1EF0F9BB352E2, 0xC613C74084353B66, 0x64E05CD63028DF08,
+					0xD30DBFDC01FBB40B, 0xC3B218BEB48A466F, 0x569F2E140A62BDE8, 0xF816D48F1797AAED, 0xD9BDDCF6B727B76B, 0xA021BD6077579988, 0xF2D018E1206BFAE8, 0x5621BFAA56EF230C,
+					0xAFAC7A75CE1C5284, 0xA58C491389668C23, 0x2DB4A24A41A918C7, 0x57FE0A51B9CB2694, 0xA11E018001328BCA, 0xFDA9917598C1C1E1, 0xCD3CB631089D7E2C, 0xD7D8D0B972189512,
+					0x946E6AEF503109EE, 0xF60A80E8668111AA, 0x9B00BBC3AA8FC5F4, 0xF7A46406BA2E1544, 0x7CA6E7B107A69EC8, 0xCDC67F4C6A99EBE5, 0x99149E0B81D2F6E6, 0xE1DD6CB46D4B8B29,
+					0x11398E6E57966AA8, 0xBDFDFBC1D54348D1, 0xDFCB1856D35C3E3D, 0x92ADF4D9FF3505C0, 0x73C03572712F0D2A, 0x945184C16CB22E95, 0x51F396F4CB136FC6, 0x836755AA739B4A05,
+					0xDF7B65EA29E958AA, 0x25DE3BA512EDCD44, 0x7B15408D3D5AA521, 0xD9D73D40769BD0AB, 0x1A30E7787F831D72, 0xDBCDEC5D1E6793F8, 0x2B9CC1ED778AB1E0, 0x4382725996643EDC,
+					0x51644BE6DEE07060, 0xEC3C27ABFEC943C7, 0x9F1BC011D9D7A8EC, 0xC314A9A3F0E61F3A, 0x059D7D2CA2439FC9, 0x5CF9270133B74D94, 0x7B2B05C6EBC0B406, 0xA71FA91795896A6D,
+					0x35A55D0F0A09FA38, 0xCBD82F7AEF2BE22C, 0xFEB242D8A04BBBD9, 0x824A21EDF6A3B7AB, 0x03E7A04CC6D7B6D4, 0x8FB2F4F0F5BAE78B, 0xDC71266F59178397, 0xC3C3B9F83B0CBDE4,
+					0x3C2434220A6450B6, 0x97678204ADB1BE18, 0x9CA3067ECBB07A89, 0x7C24FB198F268CC6, 0x7A27F9C1706A194E, 0x0095137691BD366B, 0x46B321C9D55F1070, 0x70682487DE59F848,
+					0xC06B6859BAD72B85, 0xA71C7075773ED411, 0xD2378ED344A4C9F0, 0xDCAAD33231B5F9E3, 0x33B3F49FBA110B5E, 0x3D01BC89184840F3, 0xA041BAC708D03142, 0x6FD033EE60B58A88,
+					0xC472D8BE092C0B29, 0x249306AC1451883A, 0x374447F0688B5D5A, 0xB81F305D7DD8DD9B, 0x92D5FDE0C7E8E5E7, 0xF5CCFFE8BBC5643D, 0x5095E4939F22F9A9, 0x661B85E85732F340,
+					0x52E24BBB3E9AB240, 0x900675B63A99CFFD, 0x6C89DBE388FCD662, 0x40B6AD267166D4AE, 0xD2E3A490D93FE330, 0x40AF88B4A48D1AA5, 0xD638A559787DC343, 0xF9C9C4BE22CE674A,
+					0x1480467DA2C2C20B, 0x7D8F14D8153B7415, 0x334920F4BA884E2D, 0x74908966A69275CB, 0xC7A2B021013DF870, 0x493D367EB316FE69, 0x78E433C346D2BA24, 0x9AF61F5D17E67C2D,
+					0xF7ED30F5FA74D09D, 0x39237F9259314B68, 0xFEFB73357C8A675D, 0x3F85C66F0ECE7048, 0xCA11DAF6DD4ED3CB, 0xDC29E67F19DBEBB6, 0xE7F471B8ECB6D344, 0xC148BDE487080D08,
+					0x70D978EB0EDA3EE6, 0x10C9EB9C55B26653, 0x5CF15029D08BFFAD, 0xE79111AE01A6824C, 0x26F8B366AD3266C1, 0x06AFA36C5AD0B4DA, 0x58558AE005BB15CC, 0x1C1488C40848E213,
+					0x8ED61BEF86A5D691, 0x1A85D5BD673640C4, 0xF044D0C0AE8A999B, 0xD5F230171F9BED14, 0xD9B40DFE691FB9C7, 0x6EB4552C791D40D1, 0xA66B05FB7C967410, 0x74D886657AD6D2AD,
+					0x1D98648A783DC584, 0x84D1D3E01BB3D750, 0x145E06F08C4B6C52, 0xCC2424D018B691A7, 0x2D9FDF627B622C59, 0xE8ADCE7CD90A9431, 0xB3F756F7BE6487CF, 0xE4B47154E28B6DF8,
+					0x04C3CB1BA13DE30E, 0x11E927DF6D0CD7E6, 0x6796F05A6777C84C, 0x6E2EB612235595B8, 0x852BAD460B687C43, 0x9EBA46F6A3B16EF0, 0x3E03BC4225754EF8, 0xDFF00CFA26A3AFCF,
+					0x23B65791FFB13011, 0x787AF2A154C21F48, 0x5451FED373C94E61, 0x972C0AE28A83B6F7, 0xC60814BF133AF4D9, 0x516C6110992B31F6, 0xC66246F9F01D8D50, 0x23FC44055EE6C34B,
+					0xB6258008D762C4F3, 0x5DAEA5A2287D0BCA, 0xA1BE8128EA8B08B9, 0x2EE7A4E5893A1026, 0x49148FCEFCE2F18B, 0xF53D37A30F48AAB0, 0xB3B95F8CB60544EB, 0xD0DCFF3FBCC3A8AA,
+					0x8976DC37E86519C3, 0x03E328E8211AB4AF, 0xB78BC26E80FE650C, 0x6ECAE973A12E2EFA, 0x4399A33DC5BAF2AA, 0x535C6219D2F4D72C, 0x0707A23C4DC64A6E, 0x4ED7C978DCBAF783,
+					0x2D468E0B1EB2E608, 0x9ED1191E134D26B2, 0x1ED74FD6D847B1F0, 0x795959B5EC8423C1, 0x67CA5DC208FDC580, 0x8AB063170632A64F, 0x8AB87F389CFB4B0F, 0x8EF400FCB192CD36,
+					0xC72D8E78B7912203, 0xED2336C4B1BE43AD, 0x014EDCED198E41E3, 0x362043212B3F3A8B, 0xAB7902C362AE1C9D, 0x828F623ECC370CAA, 0x2E69C6BFEFCF7406, 0x415DE50667991044,
+					0x7CCE36F4D1E3B6D0, 0x8ABA74DAE56E408C, 0x929A8EE20F1425AF, 0xD38BF23811D5136F, 0xC0DC74810F5B6BA4, 0x49E713E185D3F7F8, 0x874CE56D99B7D788, 0x6355B4A6B71AAE1A,
+					0x9462E0F48670AAD8, 0x5995E06DEF7072D0, 0x23C1CD7DADBA4A53, 0x9749A9B37708FE15, 0xA15736DE8A19554B, 0x91CA45D5DC9BFD04, 0xFD3191655E2D80F6, 0x6DFB62AF7E7A72D2,
+					0xBB6E26E1ED349433, 0x3E9711A7446420E8, 0x1F9B52CE16CA0874, 0x2A6447CDA4F90E67, 0x6E6F54AE69BCE544, 0x12AEAD540D10E8E8, 0x2316FF505828D425, 0x7585328E1DE227CA,
+					0x4B31D7845C313A30, 0x6356DFF1247D140B, 0x43E6EE7F1125FD1F, 0xDC53D005880693EF, 0x795BF72C082B4211, 0x2A483657B03CE38E, 0x0E0426EAD21C0BF5, 0x5FF231E00BEF52E0,
+					0x9B2CF1E2BFF94E75, 0x121B456E8D903C8E, 0x6F8422736448FD1E, 0x091F373116D0EAEA, 0xA664DB9BCC209D1C, 0x023554EF28ECA7E7, 0x62652E4661B6B24F, 0xB2ED904BD6805913,
+					0x61C406806B56907D, 0x0D168BD2FEC4F6F7, 0x2A53822EBEFBA9E4, 0x07366A84C15F4C1F, 0xE923F9329C970A08, 0x578B64F3FE843454, 0xCE79CFA4EDEC0CF3, 0xBE323340F52A5FDE,
+					0x6F481AF5C2E902DF, 0xAE91DB2DB9EA302B, 0x0AEE04F3BF9039DB, 0xDE3381A16DBADBD3, 0x5E23E4E5EE2FA99D, 0x88A6C94C480F2D93, 0x3CAE7A729DDD6AE4, 0x456BC3D8081C2BC4,
+					0x9E27C1E4550DE580, 0x323069AE3D90CF69, 0xBCFA62C306B8B3E5, 0x670FEA0FD708D421, 0x4897A7E152BD570E, 0x49281012819F6F54, 0x3319FE025E999A65, 0x0383A2B48472E7E8,
+					0xF48A570DEE13591C, 0xF567BFE08201AD5B, 0xACD383C740A7743A, 0x723928AF841400A5, 0x96C186EC69178EA4, 0xDAB5E99C294C73B1, 0x13190EE6C3454D46, 0xF47EEC6CF0165E50,
+					0x9CFF5C4023E0E25A, 0xF6FDCE0A26487BE5, 0x48B88A2F506AF842, 0xEF7DBFC59C0F3C37, 0x771CCB0C8F22ABE7, 0x49E84C68A880AC99, 0x6B002E870678D9AC, 0x3E5EADAE6F84CA1A,
+					0x0004B2529F8CCB16, 0xC645C897537991BD, 0x32216F0C62F93E3C, 0x7B87E9668EA50FF6, 0xE23A0CFFF6718EFD, 0x899C81F8803C01FC, 0xC00CD454AA3A5480, 0xF55246AA024D5B90,
+					0x6FD637A4A71660F3, 0xB8BAEB1D03543BEC, 0x00C505B6708BD91F, 0x8086528C9792ECA9, 0x674BE719FF8B2D72, 0x7071B60B40115EBA, 0xD1A644B2AD9F2AA5, 0x3DB06ADF1995193F,
+					0x8D4108198A1A8A3D, 0x48954918ADC2AEC4, 0x9DEDF1EA3756E0CF, 0x4642EC2F939BE4A1, 0x156EE59405EFE58E, 0x2095B609CC1284F7, 0x0C7B3B4E38D2FB89, 0x7CABEBD211BC4E30,
+					0xC0C10E2F9E30B450, 0xBD62D57265F89422, 0xB15EB70F64E95599, 0x3DF6FDB92047B2EC, 0x11158A87F6BDCB11, 0x58F7D7A02A47F09A, 0xEDBCA11A972D9B74, 0xC02E95F3B47F0C57,
+					0x40B35C197F342122, 0x3E0FE94B9176B325, 0x5B8888B793BE5B52, 0xA40EEC31CB87DDDA, 0x937D10F91E9F5BD9, 0x9C93ABC6A8991B34, 0xBBBBF8942C8F263E, 0x0904B765560FD66C,
+					0xEBA2D5599769B1B5, 0x74B2B0FE5C43B8E3, 0x86500D67DEEA87A7, 0x63503594A0ED3E67, 0x2161D5BEDE3F15B3, 0x96864EB533ED22C3, 0xA9D8B27451E72AAB, 0x6534DA37AE76EE3D,
+					0xB9AB16756E28509A, 0x8D0CCE8CAEBF911D, 0xAF25EF7654B35E78, 0xCA45D1D55436C74A, 0x231C0CB3F68F87D1, 0xE293A1A3FCD768F1, 0xD796188864F4ADD3, 0xA675F3DD1FDC3D74,
+					0xAEB1ACA749846EEC, 0x4E14EC40382C5DE6, 0xD8E8A7B346AD2426, 0x9DA44A5545D3399C, 0x52086E1BF9DF109D, 0x2DCB488F4FE48DD7, 0x44B7C14FDF8B577A, 0xAB5565A7C054995A,
+					0xCD43321225BA1E8A, 0xB3C4FCE3F6EB3D98, 0x5D759E933D29E339, 0x6C87C040256D6013, 0x9528D4553AAFB27B, 0x284923F00ABD427B, 0x82C5F1329F263BB0, 0xC02914F0ECF3CA4F,
+					0xAC8BDF799E27E15B, 0x4A5173656711A688, 0x4D39AB3B1AD7D5C5, 0x477EB7C32F9FE8C3, 0x0BD5453AC0FB9F08, 0xA7E21292C4B9AE92, 0x3716911F0A73DF09, 0x60FA472B9737170C,
+					0x3400B82C4EC38D16, 0xECC40742E7C85C49, 0x7076F6F664E88E7B, 0xA574F71E1E36C5BC, 0x049CCCED797291BB, 0x18A3EEFEB8938627, 0xBD28708D21F8FD79, 0x65E30DA434092A5D,
+					0x6D3E5D37A5E7E845, 0xDB9C693CA8211A46, 0x6EC73E7756F92D3A, 0x3D702C9F7FC9B498, 0x010A811F44158AC9, 0xC81C1F99C909D1C0, 0xA2A364B4076FF9E0, 0xBEC4F3E6EDC37172,
+					0xE8CE59844482B101, 0x6B543CC634C6BBED, 0x85380AE02A8D5498, 0xB848B70A729FC2E6, 0x9FA3A6A814A0C926, 0xAE590E963F986243, 0xEDFC47F8808896D3, 0xE65D53CC23075CB6,
+					0x91399878D450FBBD, 0x678F3E7061D87ADB, 0x16722FCA52FE0356, 0x089897CEFF6F608A, 0x212D8C2D57028912, 0xB1343ECF2642F780, 0x9D07C1218147D7D1, 0x7E68621EE7607A81,
+					0x1B914ED2067C7B64, 0x7D1FCDA213484404, 0x6103CC342D48301B, 0xF8AA1A99BF72FD91, 0xCC43C32F1D714FD4, 0x0A818C5F1AD654C5, 0x03A7859C65DD307C, 0xCFF087A7A4A495EE,
+					0x0CB93E1E38463432, 0x759CFC4DCF897341, 0x0EB41653F4EB7847, 0xAD114ACFBB1EFF0D, 0x16F624B459A2CFCD, 0xC9B70B3C83D64414, 0x223B4A3CA8E3E8A9, 0xC07E9C2CC93CA7BB,
+					0x8E5CCD77C3B56680, 0xB101D750B4A22389, 0x219BA3A36C909D68, 0xEDD1C3777BC106E0, 0x4FE5244B06964F98, 0x66B8371D83A53310, 0x3D9124469DCA63A6, 0xA959CFFF39A7C5B3,
+					0x10637EAEE42E09BF, 0x45287A3BB2EDBC6C, 0xEA7A84175B93415F, 0xC105AFCB06BC73BF, 0x8F6A19AA4F9AC63C, 0xDE7D75D25AEA97BC, 0xE819C109FBA98842, 0xF38F5A15EBAA5001,
+					0xD5FDFC76DC3195FF, 0x5871502F67809FF4, 0xF5F93DED402403F3, 0xCD67C51BAF6D98A2, 0xEA703DF58CC9C13F, 0x616E64ACCA9D5AC8, 0xC4A54D9CF44CC472, 0xDC19BE20C1EB588E,
+					0x3CE75601F9F96F24, 0xBF57AC0A1C868961, 0x48EF6DBA7DDF047A, 0x5179BB85A76CFAAF, 0xD8908CF57DD22A3E, 0x450720A7ACB71B43, 0x8FD90BCB088F5954, 0x8920B195694ED2A1,
+					0x23BFE45EA9AF7C34, 0xA607C12FE1C4E33B, 0xC549B24172404B52, 0xE7E468BA19462442, 0x7989987535AEDC49, 0x45FC2A55C8326E0F, 0xFEC40F907D0D4FD1, 0xBED0B49A0BCE314B,
+					0x7433D5ED1353E679, 0x3ABEC2985384BF3D, 0x3B2BEB82254C892F, 0x3FFD2E4C4FF503EA, 0x1F89A1D3D51AC363, 0x8AD4788338521746, 0xED37025A9662765A, 0xA1DAC523CFC6BEC5,
+					0xA09D51CB5D494400, 0x028A3ED98C79402A, 0xCC6167C0F8EF1432, 0x270F54F460525870, 0xC2A7C73929DDF5AF, 0x9053E60153CB7264, 0x479CEFAF378F35DF, 0x3D4374B5054A8E0E,
+					0x56B3A9443A73A789, 0x0D4BF68F50CDC66D, 0x14BC08CCAAED8885, 0x0EE2378B85C44FC0, 0xBF0D0FF7525ABDBF, 0xFD31CA0790D16CB6, 0xE8227A525194ACFD, 0x9D41FDBB8F7FA03E,
+					0xCF5F0DDA9A93A7AD, 0x1F26FCBF21274390, 0x784115F6CDBBC1A6, 0x04FCF21B65B83AC5, 0x569B7B14A1636060, 0x92DC962E604F5294, 0x0ED39E7216B5ECDB, 0x7E810E313511EB06,
+					0xFE7EAA5DA85099BC, 0x0C19D682B1E4B942, 0x40EC1F7F9E97C414, 0x6375262F2EC58020, 0xBE72ABF6567B7D85, 0x182C5288B7FDB936, 0x43015DF9A6E1FF18, 0x2D5D719A836AA147,
+					0xBD925AE008BF407A, 0xA9AEA19528A57444, 0xC1D15DCD8BB49BB3, 0x5EB0FA849E6D2FE3, 0xD20E1A3C0A06CEF2, 0xA3A527BBD4F7D586, 0x6D3EAC0DA91F68B9, 0x3FD22702B6EF98BD,
+					0x26510BD0C7650BE1, 0x494691822CD702F7, 0x97EDC395B13473C7, 0x1F431B1A82DF0AF4, 0x033D0434FB01AA0B, 0xEA07D4A4DD1D48D1, 0x414F11E0EF25D6C8, 0x4639476457FF4065,
+					0xAC384AB7DD4A967B, 0x35D7856FC93517BF, 0x6C9DD1697E2888EB, 0x559A4A2CB6092F69, 0xB239AA5DC7E34C5F, 0x47867B034AE40AF8, 0x0E5A16BEAFD2ACE1, 0x12DC0573DD57CCD0,
+					0xAC65E4E30F8BFEF8, 0x104E978B16DCB19C, 0x1B93CD28921BF52E, 0x81EFBFE9DC63C3C5, 0x76278D92448BE01B, 0x2D67A5E47B384671, 0x8FDAE10C939FF368, 0x2DC0A80C690B5CD0,
+					0x8982034D2A96C22A, 0x7B3BE2623667AA6C, 0xECE6CFA7334DD1D4, 0xB46B68A8547E1909, 0x7CC61A8572F6C921, 0xFBC46A49C6FA8EDA, 0xEF314E06CB02D5A1, 0x20A0991BAAFE2918,
+					0x4840B162346EF4F6, 0xCA64CB65F6819604, 0xCA358204FE5B07C1, 0x4F28E37EC97410EE, 0xF4AC09AE213AD2F5, 0x9C354177CDC53556, 0x07C0BB3D42465D3F, 0xDFB2D069FF667848,
+					0x090B1A08DF865F1F, 0xED4FB1FF1038BBF0, 0x71259F5F02D4A6DB, 0x9D7C276200AD3BF7, 0x2DC51CC739E771A9, 0xEAFEB4552AC8C3BB, 0x0D348A3D6574BC29, 0xD4DFE1C388F20CCA,
+					0xDA4C8C3622A92F23, 0x5680E33E43F077F5, 0xF0FC7AD6C25A070A, 0x442B484FE375CC0F, 0xFB583EC1CD79DC88, 0xD55B11CB6AF0D3A8, 0xD04CB6085AF86323, 0xA6ADD4D48446DF0E,
+					0x28388776E15F4EC0, 0x4A0FEE3F786AF0E5, 0x27421EAA26A3B2EC, 0xCEFBF017CFF462E1, 0x5A30E750205805FC, 0x89FF0920C175F5FE, 0x8267F5E936DE7B7C, 0x58E8F8032E5E5B69,
+					0x064D9CD3BB36D88C, 0x30C10AF40E080525, 0x19F3FCBABEFCFD66, 0x81A5207D20150A03, 0x9DF49ED2B54D57A6, 0x977A0B8338FA8F73, 0xB19D20A651F2E7B7, 0x836E5FB62E59E82C,
+					0x6C485D535CCF7378, 0x5AF1F2C2474E6889, 0x20CB9114F0883A95, 0x721EF98DFD350792, 0xCFD0BD23B4C096BA, 0x6AA67F6232FC75EE, 0x5B8855558B1CCD5E, 0x30A8F484B6958B2D,
+					0x988885694353BBC7, 0xDA1599CF9535B240, 0x464DD2168DEEF661, 0x4586D76458C71806, 0xDF3AEB46131B106C, 0xDAF934D1DAD835B6, 0x9076B2BD803217FC, 0x1549966B5ABA6BC9,
+					0x581364A0D054A935, 0xDFE235119AA87ED8, 0xE7F502B3FD7F676B, 0x151C0E5C0BFA804E, 0x3F3CA601F132A167, 0x676359C9D9A1CE19, 0xC18836FADF43915C, 0x8CFC7A1200543D18,
+					0x18E366A2F7E539ED, 0x772CDA1A13CED28B, 0x562016AAAAA4E025, 0xD0FF4739B8A3C49B, 0xB154D0A3225CDE90, 0xC776795D0FA547F4, 0x66817A4016E47A24, 0x4E76B7D0DE15544C,
+					0xD1A8A2FD19A403D2, 0x707B7A29F27898CA, 0x7BBF664F6A5F56E8, 0xC905FA4ED0F6F209, 0x96D73BCD61EDA714, 0xF2AD8600D7B94476, 0xEFF9DB6A7C177C1A, 0xDAD8F40886B6E5A2,
+					0x03F90F171FCEC08F, 0xCA949A7ADD01B6F4, 0xD2347E85BF57B16D, 0x1CF12758A56B85B2, 0x304A361DFEEAAABD, 0x7DECC887E1A8D4B8, 0xC35164A6BB74621E, 0x49A0B0D2FEC861E8,
+					0xC1A0339C938F8CB8, 0xFBEB7D5E7E40DE39, 0x9F34E1F663D96094, 0xD76EA507BE1CCE73, 0x4B8D3CE5ED04F42C, 0x10F9C9F27A61F6CE, 0xBF05E34E899AD0A2, 0xAF55D28EDC368F43,
+					0x9D264D7290581A6F, 0xEC2571ECDA3763DD, 0x813210D43C397C74, 0xB599D03399EFDEA2, 0xA954F61E446D2DA4, 0xE5DCFF62820D4F55, 0xF14B35D9ECCF6A33, 0xC599D1AF5CF40F1B,
+					0x45C0B2E357F9B839, 0x2058E532AB44896B, 0xFF86F54A7829D678, 0xE1F63441A9E10B6C, 0xE640216E629FEB9B, 0x7A489C9DB150CA61, 0x786C3CFB7CCE7C25, 0xA61A62DF03696F83,
+					0x34A7A0F12656873B, 0xE8CED0DA0EA8A56C, 0x56B43674C31825DB, 0x28ABCF94BA4612D2, 0x837459053411A1DF, 0xC4CA4DBA79EA1547, 0x3CE3E143B42ECB2D, 0x6945C47DD8AC39C2,
+					0x1AB5D73023F75C47, 0xA9A9961932D8AE4B, 0xD6C8C4C13B4BEBEE, 0x82005D74BA291B0C, 0x8111155E3957E3E5, 0x43DBE6C204EEAC7A, 0xFD9F963E4BF2ACB0, 0x146B6B8A8DDABAC3,
+					0xE9D7110A7A691A7F, 0x40948F476092E223, 0x7E098975A8F78AC4, 0x7FF1AC610EF6217A, 0x34ACED6C2E631B4C, 0x98336C814441A4A2, 0xF9863AD78110BF8E, 0x640A97C68D6DC35F,
+					0xA4B53CCFD28E6426, 0xF63FB249A5AF1615, 0x9D9C2F98C7E78C0C, 0x33F9D604B9F99776, 0x29E1E005FA26CC81, 0x293FBD70E9C8DDFE, 0x272E591EAB3A452E, 0xC197137F9F33D1DF,
+					0x0AD5BC4E9D9FB579, 0x2F3B8F28F78F98DC, 0x644E6C4EB044E15F, 0x8B3283DA510932D1, 0x27E4E9259E10766A, 0x1DA669C9D2B68256, 0x10B21DE50983179B, 0xD4A68A7109E62350,
+					0x8A6163CF59CABF97, 0x51A1CAB39F92ACC8, 0xE9E44BF491DA1689, 0xF631BF674AEBE88E, 0xED8776010BC8DF99, 0xAE89484F8679C703, 0xC58A5A2F23F54144, 0x4B077CAA34F1102D,
+					0x1AA58D637CE57ABE, 0x1F6168338A628CF7, 0x83F181870D70EFAF, 0xD6448DD84B33F45A, 0x54A896EE05CF5E06, 0x0B3E0F3ABE93076B, 0xBC65DBE6BDBA8C64, 0xD115E78D2F77EBBB,
+					0xD06C3849B49D44AE, 0x1EC087D1AFA057A3, 0xFD297E4B958CDEDE, 0x5133AAC8877419BD, 0x549AE38C4A6CDFE6, 0x3324F644254B4656, 0x6781BC60EC048791, 0xA1CD589EE9AB5AC8,
+					0x89D5C88392F52249, 0x018DA58AC6DACAC3, 0xEDAC1726DA58EF7C, 0xFEFEC50155E2AB4A, 0x88B08A9B8B81744F, 0xEA8A5794ACFB2E3E, 0x5961D7856C276088, 0xFD06AE1853BC3FB4,
+					0x8BA70E9D74498E77, 0x9F7F292C18EB6485, 0x055C5377672D63D1, 0x33C71E4710067792, 0xECFA448FC577902C, 0x0825F1E893AFD046, 0x5A7384C3230257B3, 0xEBEB0D2F1E3E4F23,
+					0x3DD95E1C0586C29A, 0x6CAF101471BD8202, 0x81EBB6550CED71EA, 0x22E7EF26BCF7B4EE, 0x6EDFA23B47B102CC, 0xD0723BA9C8615971, 0x85DD0C7AAF5FAECF, 0x5596EB347F268ABF,
+					0x85056482669DE4F0, 0x77D65081CD1AD3C4, 0x7007EBA5CC59F248, 0x6807F8205558AF0D, 0x5A4169CE84082C1C, 0x563FE54D1E7E878B, 0x073559330FCC32DA, 0x2F28C894348BAC07,
+					0x89D4C3CDBF08B9C9, 0x174CFA39FE51F904, 0x0E910A361FED1E40, 0x3CC3EA552D843AE7, 0x9C92463D59C706F0, 0x82EF3FDD468C40FD, 0xA600FA17DE5276BE, 0x5FAC9BBFEFDCAFC2,
+					0x25FA434E98E5BC9E, 0xAF2E8D95EC1F4169, 0x846E28D9A646E299, 0x0C998C85270396A7, 0x071D2CB42220AB80, 0x2E273ED4233BA3F3, 0xFE16AB6C7B5856A0, 0x36691F21682AB386,
+					0xAFD4DA507615C429, 0x0F6E2C7BD48DF449, 0x3D9D71581434F714, 0x54B1A67F8D003613, 0x130DB5C8B92F1033, 0xD2DF5F03024CA92E, 0x48BE995491B0EF1E, 0x9820DED873DB5646,
+					0x2D7C7A2C8C96A40E, 0xC01C745287707E72, 0xBFC6FEAE0BDB5DF8, 0x550BD381614BAB49, 0x0B8901236D785704, 0xB6497E1BC103E8CE, 0x024251322813CAA6, 0xDCC0BB564237A42D,
+					0x40CB2FA1A1F98EAA, 0xAF476F364A8BAB8B, 0x6456C977FA7A3A9F, 0x2FA2494B6F20ABBB, 0x3C2FCA5D4CA399FD, 0x8D8A7719BB8DC3CD, 0x81A85DA6E69DF020, 0xE8B8096E1B11BE29,
+					0x681C1D05E87DDA69, 0xAAE9A04FA29EA331, 0xBFFDCD53F0450B62, 0x9859F85230A3FE98, 0x239C91222727F267, 0x8E0C18A32DF03081, 0x7574042E1F313AA8, 0xA929D4FFC8178331,
+					0xCB04EAB5702DC5C9, 0x133F5DDA9DDDE518, 0x24EA6424B3D0087D, 0x8678809A8C20BF28, 0x5C8307F5F6658B02, 0x73956416C192AE5B, 0x83AC40C55FC3E907, 0x240E0BA73D098A41,
+					0xF4459F58820613A8, 0x866AECACCA517C58, 0x07886F05DB344555, 0xB109058FDC349509, 0xEBB38747E8898197, 0x62153BB760B452A9, 0xCC77A6A8B3D2D2D7, 0x17A49F10CFD53CA7,
+					0xDBCFDE1B1890C93F, 0xB0B37B6119F4E981, 0xBDAA41431B2DA9A2, 0x8C5E8BAE3F090F07, 0x58C78BB643E71748, 0xE82F2EDD257F8790, 0x23F116ED9D0587FD, 0x254AE43ED30284C4,
+					0x6F73663CCE939960, 0xA1539107E48817CD, 0xFBDC52A285C49633, 0x454351E3F097C2D7, 0x8AA56AEC6147379E, 0x8C10303594991BB9, 0x97A694091F3E6A09, 0x52C325470A26F5DE,
+					0x1A20EBE63D74C07C, 0xF721E5F47CC7A4D9, 0x163F256574BB740A, 0xC8CAE83297809343, 0x3C14DA1D0794D9E0, 0x65F35E5E9B7DCBBC, 0xFCB61F16A2418CA3, 0xDF041199A5B08DA0,
+					0x357BBF6FCD6BA95C, 0x62701BC0E56115FA, 0xAEE95D359BA71AFC, 0x313E10D2D3CCDD66, 0xFD48B0CC22CEE4AE, 0x971A27711AC5F328, 0x23067F7D51459A27, 0x2254BF1BF171073B,
+					0xAC135BB3BD5615C4, 0x2820C1FB02A8D61E, 0x9F26B036795586F5, 0xA07764C9C52017E5, 0x1EAFA2589EDD446C, 0x8DD3163BFA0FD50B, 0x1CC421D2FA7AE2F6, 0x3E5859B046464360,
+					0x0FE4D15FA47CE682, 0xCDE01DD908959417, 0xC2B623A6D050CE51, 0x6B1BE64BCDAEA262, 0x1A7551FD5E439A30, 0x683277B698DB2F03, 0x4B32D054B43AF6DE, 0xEC211A44F2C73AA7,
+					0x0CE9362DE83DC6A0, 0x7114C7EF3991800A, 0x770EA825364EEE30, 0xEE098DE02232681F, 0x20E1B7AABF71018B, 0x0676AD97AF28805C, 0xE53BE10C89D32026, 0x3422B72A3D76226E,
+					0x4FBC869B9BFF3EBB, 0x0990FB5B52010B6F, 0x1FF99A8DA15ACF37, 0x8B658B7ACDCDC9E8, 0xA397C00A732C336B, 0xA79AC92E1F3276DE, 0xECABD10CB694FAA0, 0x2B64085F1462407D,
+					0xEA7A1355BE1B2B49, 0x71F50C828EF94E1F, 0x2BC84CF3770B016F, 0x0B1B640BCF687669, 0x4A415C7211823FE4, 0x849651CEBD8B463D, 0xE4C8DD22D5E5D230, 0x28D81FB9B6456F13,
+					0x6A04DB1F2AD834C6, 0xE0DEDDFA60046B8F, 0x61BBB403AE4B2E37, 0x178864F71BA1F92B, 0x4DB3089F2B037436, 0x2A8356DE00ADF5C1, 0x6AF91AF89E1D0292, 0x7D120B341B0D85CC,
+					0x9CD12D8C301B7F03, 0x7ACA11D4A0FA4893, 0x7705098B956DD3D8, 0x02AE54A041628C79, 0x0247F83BBC1CC482, 0xAFC003540F162AFB, 0x118011F373F0F7B6, 0x2E9EC69102595DF9,
+					0x4D975AD8ADE873AE, 0xCA92DFA3126FE399, 0x6BD9317168F12301, 0xA8AE8B8BF81AD3B0, 0xF346B250666886B4, 0x1AFAB1DFFFEC03DC, 0x5EE842F0376DC9EE, 0x7E08AC9835C54B18,
+					0xCBF25021D8FD8E12, 0x53AAB8786666F263, 0x4FC0F8055FFFC81E, 0x39B50E60EFECD5A9, 0xB75B2C933635A6F9, 0xDA07899F3C7C916A, 0x4D9A13DBCD2D57A8, 0x40229A17B78BB876,
+					0xD73DE4A8C1C8AA12, 0xEEEABFD6C057E441, 0x540A58893C5304C8, 0x98B105796761C015, 0x1CC9EA0EDED1E03D, 0x6814500C78ACA7D1, 0x2C9E63EB845B1321, 0x5B98E66181B0DC87,
+					0xD2BCE27B630AC784, 0xB7675D02C219D30B, 0x27D8BEFB32B8A7BD, 0xCBE503016B73121C, 0xF3C5976B5DBA5BF3, 0x54A34673F3C05CFD, 0xD1AF0B8C8CE4A82A, 0xB5C64CAA8E695BA3,
+					0x5183377A9157E384, 0xBD7F21F2D3443458, 0xEA035CDE08B1E092, 0x5151F84DC034C955, 0xD815CFE0798246D2, 0xA8C6D363138E0BD8, 0x0C96B3AE8D04F31A, 0x8B674BE94E955BA8,
+					0xDE41AB9AD9A270F3, 0x9C8D0391A15A3D6A, 0x3F9204BD680366E0, 0xC94F141E026AE0F4, 0xE90F2C14F7227CD5, 0x9067BE263CAC6FF9, 0x4B3C7ED17055EE38, 0x2E6C96A72B6F4D9B,
+					0xA1F01B5FDCBE213C, 0x1AEFCC03C7D5CFF5, 0x58BAF1EC69A4CABD, 0xA828DF4886816DD8, 0xBB1FD0521FD5A850, 0x00AF6757CAC900D7, 0x9711868F8E6C9047, 0x31A6FF09575F93DE,
+					0x7170E46167541F36, 0xE893177A18236972, 0x0D9A09DC5D8147BB, 0x4D0F7B6AA872FE08, 0xA556C1B42991FD29, 0x843F00ACFD01BDDE, 0x71CB610F7D704A5A, 0xC4AEB6E4FDA0B677,
+					0x8647AE9FF332F96B, 0x5F23F2DF1805EC9D, 0x088A8BE7A530B027, 0x01896F75CAE35CAF, 0x5C36B95A6C4CDEAF, 0xB5CAB07229B36D25, 0x1EDC321B57B58C66, 0x31670ABE0DBFBC1E,
+					0x3D5AB77498D40096, 0x866CE7C1188AC223, 0x386331C94EF08E10, 0x5D9E26659AD49B48, 0x84EE2DE0DF3BE5A7, 0xA33D3B2DA6286065, 0x7D12D05905CD3BB0, 0xFC55F774704AE553,
+					0x9FBCADFBECF5BBA9, 0xA8ACC1F337CDD5B4, 0x12886E45D2670033, 0x14B50BF2D15E1977, 0xA69C92F9A9D4B3EE, 0xB8A752D2D9A50339, 0x5D63708A8534F90C, 0x8D285B75148AC1AA,
+					0x9EC0DAEC49F3A575, 0x26B9897BD384D3A4, 0x361F1F7BB0E93EAA, 0xFDBCFD11E912D624, 0xECC4DDCE1D6B6FD9, 0x8AFFD938009ABF2D, 0xAFE21606D083ECA6, 0x6875FC7947CD35CD,
+					0xACB08AC9D0E70B4A, 0x76451EF3BEBDCF25, 0xD283A8298341A9BC, 0x5385E1767A84B4BD, 0x681365344D182E5D, 0xCAFEF0CDDDA614F7, 0x8DEEB144EB410EBB, 0x5700A90E6A38E265,
+					0x479DA67700E17BD9, 0x756735B92C6339C8, 0x7D0F3D96645D130C, 0x397DB557AAC56046, 0x3A936953B6B394FF, 0x5020A1F34B3AA6C7, 0xEE4AB65FD6C0957C, 0xA2968707931E37C9,
+					0xB126CF63E2604EE3, 0x326506570E4CDF87, 0xB3270840DF1CEF73, 0x291C121DA63613CE, 0xE47EEC87C413A32F, 0xBCB47950AA21E849, 0xA13CFD21D28B7E27, 0x03CF05926387431F,
+					0xC72A33361AEA032E, 0x727683F6A1F5390F, 0x10E39D0EFD19ED76, 0x785BCC695A63E8FF, 0xD26BEA18D52DD249, 0x54CA01241052BA6A, 0x95502D36B8CABFC2, 0x1393E591943C4A40,
+					0x2F704D798CD63BC1, 0xE2922F2F699116DB, 0x2B1714097EA977C0, 0xF8C177C3DB95921E, 0xF60302ED0EF00BCD, 0x45D35C5517D3B42E, 0x5B47D2F6A1C917B6, 0x0DF694B988FF0BCD,
+					0x3C27D1E8FAA83A91, 0x1783497B55FD1B9D, 0xD48039D96ECF5FA3, 0xFB13934BA7205A8B, 0x8C9F467D8E8C59A3, 0xFCCC972509384552, 0xB2F3E04959C24988, 0xF71269AE9FD2F8D9,
+					0xA125981B1F9BD979, 0x7C1D74366CAAD1BB, 0x1B77558DD040B77A, 0xE20398040EC85C79, 0xA8735E50E396EE2C, 0xA169A6AC06138C88, 0x4D97171E984DE857, 0x3F5E24CD8E6226E3,
+					0xD820FDAC22A3EA8B, 0x0DAE599A63B29119, 0x36C31109AD170CFA, 0x931FFF4FC144FE78, 0x25C3519D1A3D074F, 0xEF5AE3BB7DC6F3DF, 0xA66C458A1CAD1144, 0x66DC2D65627D31F1,
+					0x2BF195A91793A99B, 0x58F1F405CF2511F7, 0x2C130253ABACE2C2, 0x4BDB1FC142EF6D08, 0xE32A2305DF29BD3A, 0x5F0D95F97791D71D, 0xD89784B42E35D10F, 0xAC05E01E01794F38,
+					0x99FAB197D592B6D8, 0x38EA969C155323B6, 0xE62838CF23A2FB9D, 0x2E3E84D90A7B91EE, 0xD4CA32D0728705BE, 0x977CB3C1F1550CBB, 0x305AAC080C1D1571, 0x4117D1AC00FEB957,
+					0xD5D34A2013BD4C8D, 0xCB6D56B3653EC7D9, 0xF21FD4A0665AC1F1, 0x011131BE434DC6BE, 0x72B43A6E54444591, 0x1B55338FE9387757, 0x9E7BE820777EC13F, 0xC19007CD1EF77038,
+					0x62C8A4852BB80F8E, 0xB6133227A2963AEA, 0xE3EA4271A051DF91, 0x50458FACE9415848, 0x747ABCD4BE0F0E2F, 0x6ABFE1DB73E16BEA, 0x50D219D7EE700516, 0xD8D6C707193F8D0C,
+					0xC5E67247D174A553, 0x569220F73C447254, 0x4C16E977507967B9, 0xFA96927DB8A15901, 0x2A5AB2084DA57CCD, 0xE29E532AF231BD57, 0x7225C50AA1176823, 0x92839F04C0018237,
+					0x9630A9CDA0503D7E, 0xEFB47F5A7E883865, 0x9A50E445995F4623, 0xB401E6BB12C8110B, 0x85FA43D5453146CA, 0x605CE2092C468C79, 0xDA80A2E33C876FFA, 0x28C6063E36B629B7,
+					0xE4FEB352180D9E62, 0x388F585CFA48FCF2, 0x342EC741FFD04E37, 0x9FBE19E348C83FF6, 0xF19A79A19B4EF439, 0xA56A62A2B365E379, 0xDA3BCEA0FB4C9704, 0xF339EEA84D3A02B7,
+					0xF7890FF2D54420FC, 0xB7CEBE6AE5CA785F, 0x7D0753C471AD4FE6, 0x8F3F2B3D7B4EC81B, 0x9B94F96AD9051158, 0x95C29AA123580409, 0x26CFA744DE69BDDB, 0x790242037BFCC1E8,
+					0x04B70ED949EF1CDC, 0xB53F824CA6600E47, 0x96BCAFDA9E87006B, 0x61A08B2B855FB307, 0x66A53A1AEA8377DB, 0x57AE16B87C66EAC4, 0xE0C18084365CCF72, 0x668C90C940B8E2BF,
+					0x47CD0420C373F212, 0x072EB2EA5E95EB5D, 0x24D3B0522BAA82E5, 0xA90704F160833000, 0x96EADDA08A73A14B, 0x7B615C476E97B96A, 0x3518CDE61561D760, 0xD81E3CB9ADBBD856,
+					0x345CFE1DF5ACF328, 0xC3348A22F9E2981E, 0x51B0043B0C0F3605, 0x88EA9CBF1E5627C7, 0xAEE08E55AD133F52, 0x5CF78614637E9793, 0xBCB09DA277D483C8, 0x3ED64C44D7825FEF,
+					0xFE99BDD8538527A6, 0xC36ADEADA57DF6ED, 0x02E8B64C0A442A1B, 0x6955983727212DE6, 0xFD8BFC9020301CCF, 0x1449757689A1F727, 0xCB42D0E2EB913694, 0xA4D758153FCCA471,
+					0x88E92951EBBF841F, 0xD53185F9E3A7EAF2, 0xBCBADCB4917FF14E, 0xBF1660687AA269A8, 0xB9904C7785640FDE, 0xB041579F8291F46E, 0x47D3469C02DFB59D, 0xE7DEE82082DFA6AD,
+					0xEE61B182E4BE4D7E, 0xCC4807A4F4A0D10A, 0xCD1B12AC4411AD5A, 0x8650A7798C0FCBAB, 0xFDB1C5538D409554, 0x08BAC75DC12AFCBD, 0xF2273BF60FA1C938, 0xFC0AAF48A10BADD5,
+					0x1F6EE6044688968B, 0xE5708123BB8CE34C, 0xC45A028E0AFED112, 0x90C3430502DADCE4, 0xC664D863F46686F0, 0xFAB24F6767369ACF, 0xA6706BC01C6471B2, 0xBC8344743E1BDEC2,
+					0x384C39D53348816E, 0xBB43549769967805, 0x5BBDC4EBCE850456, 0xF19384D06F92FE55, 0x432CC25B53981A4D, 0x0327ABC0ED774C27, 0x39855C5A62AC1296, 0xFEF1031FAFAB325A,
+					0x39FADA0B05BD36D8, 0x2E9CC6D077717750, 0x4DF6EB185744E7CF, 0x5539D90A6A2B1480, 0x591FC4558237DA93, 0xBF1BFEDAF8ABA519, 0xD3204FE9CCA7AEA7, 0xCBEFF655922860D1,
+					0xF939BB1566582283, 0xA0E03335891DC8AD, 0x56E9896B55F84AC1, 0x5E03C1943D09C9CD, 0xDE709E3BE14800A2, 0x436044FEA11BA200, 0xB936B401B72A7B9F, 0xB53C83E3FD2528B1,
+					0x1A05F2B574B303AD, 0xE62D7A41E7B284A9, 0xFB67983B472A5CF3, 0xAB462329C2ABEA4D, 0x331C40D287E86BBC, 0xBC108421CEE28231, 0x05EDBA8B8A9F661F, 0x4975EC34D92D3FF1,
+					0x5E840BCE831BE43E, 0x400FC1A32EC06E82, 0xFE5FB1A59AF345F6, 0x60A84F6EC7BAEBA8, 0x25A3EEBE59B8EC6A, 0x5FEE7990D0633076, 0x282B781D992BF934, 0xB96549961B9F933D,
+					0x357921FA979932D0, 0x97C9BB2A341EC476, 0x001D4F04BA6DAD7A, 0x60E7FC3CF4E1F432, 0xD8437483956AD4D4, 0x327109277418A9C8, 0xC9187999CF14D0AA, 0xF1577A194FEC618C,
+					0x651A50FDF76B5502, 0xB40FBBDB2DDA047B, 0x7BF46BFE54BF584D, 0xE87A0EB41CF709AF, 0xC414FE62A07F91A6, 0xE2C5FB1B7567BCEF, 0x04912B310A5BEA87, 0xE942B4DBA1FABCFD,
+					0x0DEA89D2065D75F2, 0x5D19EF7BF8779939, 0xB66562AAFB1F0FBC, 0x3C7DABE74BF5F867, 0x2076FA3FC6034775, 0x53D996E74CBD27C4, 0x18FD482BCC948467, 0xE845EF2D67B49995,
+					0x088E89197AF21842, 0xBD91E49F0ECC0B48, 0x4589C0241B862BD2, 0x3FFF000A25F29C58, 0x28C68F6E10BED7DF, 0xBA9185C6C5577E55, 0x067A428E75BD69EC, 0x53A631D2ECEB5064,
+					0x523CBEE6007C9216, 0x41709B4B70A0F794, 0x3A4DEBB413A38365, 0x10267DD181F29BCB, 0x7111AF1E6893CF65, 0x628FAB7FB2B85FD5, 0xEE53B7B3B3F7D3D4, 0x3477BBADC1C8E78E,
+					0x36A77237906F8291, 0x2BE50FA393DB9F3D, 0x0EBD5867A0F06F8C, 0xA30391ACAB5CBAA6, 0x9E5E355514175B96, 0xAC7322BD3F1F44E5, 0x70873D83ECC9A67D, 0xE9B5C506C9D40615,
+					0x9DE22FD0A3AC01E7, 0x45B09017253E50D9, 0x7A8E69D27A5CA09A, 0x553648CF1165EF3C, 0x6F27DB2C4371668F, 0xB77EFA8BA858B3DE, 0x06CC0F6D1A2C4352, 0x535C900C20C4AC2D,
+					0x2B9B3BB2F794C70C, 0x4010D4C3A3552373, 0x57BC666FE9738D63, 0x0CDFDC31969D45A3, 0xBC2E1BAFB78EA670, 0x703B425666D629D1, 0x77CFD8154391C471, 0x90131CDDA17FD43E,
+					0xB754BA7F1CB2F280, 0x7B6BE4F75AF8DC3B, 0x48D7D0AB37ABB500, 0x14B51BFD09DBE631, 0xAB503C7893412489, 0x5F1406989A3272EB, 0x56D654F3BAD18829, 0xDE73CCA26D7FEE3B,
+					0xB8A271F29955F211, 0xB44230A0A98A43CF, 0x142F64E1B72DDDBF, 0x54E64F21396C2FAA, 0x7615AAF2EB7183BD, 0xE5EF165398F0C65A, 0x876A8CBCCD2E471F, 0x144FD3DB05310D84,
+					0x370873FCBA3EAB2F, 0xDCFF9E0740E19C44, 0x6D641F4EBADCF930, 0x01ECD0AB600F1C3A, 0x9858797F90F1ADA2, 0xC33FD7EAA51D08CD, 0x4C8A98CF5F5A707B, 0xD38B68E95841DFAE,
+					0x96A8E1C1E6D6630B, 0x196B42824139933F, 0xC0B1B5A3267F18B1, 0x16AFAC8364F72C65, 0x36A7EA3E504F1F96, 0xEADB367D35A00D8F, 0x6FEC5BBA9A4876B3, 0x01F7B13DB947F5D3,
+					0x859FAD9B6C0A79F5, 0x7DE2BFFFF0597445, 0x7151189860863E74, 0x5AEE7F7365C56EED, 0xC2AC6A9A053C450F, 0xEEA6D8B3B42587ED, 0xA4E55D302528A23E, 0xBB78C3C26E4DA119,
+					0xEAC11C93899DC613, 0x578A7E362C8CA3B3, 0xAB7AC64A486A5D1D, 0x16BDF2D94B99C6C9, 0x1B185E40F58C1265, 0xB5566B328AB8E458, 0x144DCA03D5DA3468, 0x5727BD825CAD4D92,
+					0x021EDF74493E9244, 0x28E99DE99C1D32FA, 0x8DBF5CBB7FBAA406, 0x886B75CF9DEFDB3A, 0xAF32E507C8D03D1B, 0xAB74D358D4E6A158, 0x74BB33462451B6CB, 0x609010D19F69B74B,
+					0x8BBC107721EEF11A, 0x8C054352496A3A26, 0x6CCBD0D6F29C9E11, 0x873C81B241AD8BEA, 0x5E484EB77CA291FF, 0x464A782962F8A739, 0x078EBE2D17B0C3DD, 0x3749DB2587AB91C8,
+					0xBB3C765DC969E762, 0x848C81982E562BE6, 0xF30AE8DCBE504D80, 0xC5520DC90A734C1C, 0xC1AAD97F487E9916, 0x039D13C209D5DBA4, 0xF10E049EBD43B4A0, 0x52DBA50BC07AC307,
+					0x622BCA81C1D72844, 0x98C1F3FACAFBE3BC, 0x33D1F6CD8CA1846E, 0x2FD3FCE7C4D07E62, 0xDA4C38F81AE05DBD, 0x310453A8E583AF65, 0x994FF9284FD4F996, 0x1F9CE05C4FF5F145,
+					0x64F6F7752665E729, 0xBCF27D84D7423523, 0xB8EF1D69FA24BFF5, 0xB61A6F42E25D31E7, 0x76283934C8CF1A03, 0xFDBAFDC4CCDF9911, 0xE528801797C5DECC, 0xE69778EE916E83C3,
+					0x4A19E20810753239, 0x1E8E7DFC63909CF4, 0x694A02C87FD5D5FB, 0xE7A883D660D0DC18, 0xE0075659FB562525, 0x87C449077C8F66B7, 0x1DAC7EB6182D68C9, 0x3A02786818C76842,
+					0x2FD245D63D195DAC, 0x42B78666B426D5DA, 0xC2D3B7202C64DFA4, 0xA0A3F0CECC30BA66, 0x11B0C86358F979CF, 0x7BCA17C8AA974379, 0xCC521EDFAA634854, 0x7057E4D41B8A0CA8,
+					0x50965F17BF9CF6B7, 0xFF8BBA1EC57D06BE, 0x1E4133C126096096, 0xFAF3BBEFDE341751, 0xCA618D82174B0C99, 0x55FEE7638A0B3346, 0x01EA8F0CFF208613, 0x3A1BAFEB1589834F,
+					0x4398609DEB8EF3B6, 0xB9AEE925A5494A31, 0xBCA445320E076AEE, 0xA02BC94FC21D4D9C, 0x489227991F75A5EE, 0x1FA3957B43CADEAA, 0xA1E71E7A35E826D2, 0x3DF919930C1EEE33,
+					0xEC23BC568FFEF058, 0x541CB2F1FDDAC619, 0x6655D037642D8402, 0xDE387B4590EB48FA, 0x52F3FC7276E179E3, 0x500DDA78415C3C03, 0xEEB3283A98796404, 0x108FFDEF98D376EF,
+					0xDB7FF1CA3CF37465, 0xBE892AFB32484F82, 0xC719ED73F656FDD3, 0xD9472BB4FD14460B, 0xE65004F8BB46E266, 0x1B9F9D4307A18A7A, 0xFF973365B70C68F6, 0xD211D51E1B1311B3,
+					0x6072473D2B98152B, 0xF191CA2C5F758170, 0x0A7E87B33B5A6DF0, 0x01B64D3281FA1134, 0x7B5CA80DA0292DD6, 0x25D44ACCAED3748F, 0x7C52E67EEA06B288, 0xAE77929361C97506,
+					0xE87D29070DE6D62D, 0x38E6C4C1EAC5C069, 0x2AFB8B8291E5AF5A, 0x15D07A116A537F77, 0x1DCDE7A4F856AA65, 0x478D98BEC0F52D59, 0x6081B79826ED4B30, 0x33AE680053012F41,
+					0xE34511525BA96A55, 0x82D8ECDEC9E349ED, 0x2CD7271D56ECE86D, 0xEE093B920446EBCF, 0x6AE371A27DB60D13, 0xCDF4B3FBF095155B, 0xABC15ECD52B6F1A3, 0x13212F3D9DEB2B07,
+					0x92D72DF074A810C2, 0xE5AF670C5273917A, 0xEE95F4ABA03B2F55, 0xBCDFCC4A8A0110AE, 0x1C77424F607261C5, 0x1FE2970AA6103575, 0xAF46BC27E1252F4A, 0xE21566A4FB4E621F,
+					0xC38F3BA2743CAA19, 0x419FCB2BC02C22B3, 0xFB140DC032A43E25, 0xB3620BFDCD626A13, 0xE519BD2F559E7817, 0x88812DF35E1E0DBD, 0x27ED0EAD2474137A, 0x6CDE8B62B02CAB55,
+					0xF4356704E68F35DF, 0x362747B5FBB48CC1, 0xB8C802C4EE2D36FF, 0x8B85E701B6504670, 0xC1C7B52D4FCDC2AE, 0x11E44DB4C822C54B, 0xD13D4EB99DA1D9A7, 0x24613176F6FA9381,
+					0xC688801080D0DE2C, 0x712028D745C72FC3, 0x8D21182FA9F8E605, 0x9990C179849D76C5, 0x5E6513C6B7DFBB79, 0xBEE743CB1627049C, 0x080DF816CC96CC9B, 0xE50243502CFD667F,
+					0xF7900A61689CF4A6, 0x27E52486B0F61E16, 0x7C481D69A7A8D85D, 0x67ECA42CAC41235D, 0xED9B794D8E8C6504, 0x6A2965F1D1B784E5, 0xFADB08E01D3F231B, 0x012A351EDE0A4B30,
+					0x852FD8F1FC867E5D, 0x27ACD679718FCB10, 0xDEB3EB61D21703DB, 0xB79BBCAE194D90AE, 0x9AF2AFA9E4FF208A, 0x3C2A7DFA30102BF0, 0x6BE82CF9412E30B1, 0xA03E612832ED0736,
+					0xD677F54E8515684B, 0x74F7843D97B5D0AA, 0xBC260D41C02B584F, 0x2B0B87BDB914BAF5, 0xD6650A8F321A4C2A, 0x47F5D52BC8C63DEF, 0xCA7BB39B2D89D481, 0x24CCC781619D2780,
+					0x23A2DE992D1D715F, 0x30B7FDB510E0FB58, 0x6772E21686764216, 0x7F05F988C18D843F, 0x2F0E3F664FEF129D, 0x9D1F201CB15975AE, 0xA8BDC3805D72060B, 0x1B5664754CD33760,
+					0x0C067AC4E9F0A9D5, 0x26B90C35FDE7D1F3, 0xD3485C4BA8551CA3, 0x6E479245D0E07E1D, 0x648052C6E8FE9CFB, 0xFAA259A09AF68A05, 0x167CABD0B119A1D8, 0xB8664779A69DF049,
+					0x62EB033AB71EFD53, 0xDC1D8F0F0B1DACC2, 0x43C6D070526DDE69, 0x76F5F530BB6BAB15, 0x5762858FC90D0A16, 0x873B9250E5CF831E, 0x12C63EC3186E7D64, 0x138C4426337FB81E,
+					0x3477822CD8374E58, 0x98C0D21F28187E34, 0x836DBF0EC046B898, 0xD82A3EE3CB2970A4, 0xA06E7629CCE83958, 0x7A133A6BB4E719DD, 0xB529B617966D7233, 0x6DF5D74534F63815,
+					0x281F6170D4270F9A, 0x38F0C9068210562E, 0xBF7E7A41526B2EC2, 0xF017A1342AA320A1, 0xD0C0156AE36CEECB, 0x240EC68FB5414F59, 0xA2AB8C925C86242A, 0x3E3068292681867C,
+					0xE2508DD48A7E15CF, 0x4EFFF8B855CC180D, 0xF7F70B39321ED269, 0xC3574E4E1552ADA0, 0xE599AD143DA4EBCE, 0x403F36EC51B998A1, 0xC569DFC81A3DAC9D, 0x1CF576BF75513F38,
+					0xF1D4BD1607572270, 0x85AA138C613F2D88, 0xF53905C111B0F9A9, 0x33D7EAE444319431, 0x7BF324A0B8AFA0F5, 0x3E1E07F3756BA6E8, 0xBD10D90CF29CFA79, 0xCAFEA7256C0BD434,
+					0x81B1BB35CD87AE6D, 0xFC0C1EEB3A9FC943, 0xE0AABD727A606C82, 0xC7150F43B5F15893, 0xE68A29BA83C6D2B4, 0xF0C7BBB3E9492DB5, 0x75AEF34569E57D7B, 0x5BCFCC265CC0989B,
+					0xC16093193A65997C, 0xC1AF7892CE555FB0, 0x4171695BF18A44AB, 0xBBE6FE9CB97F4CE2, 0x79184D3FD92913F1, 0xB04D1B1191E44817, 0x79CAF5B558597141, 0xCAED5B5AC93DD97F,
+					0xB3295D1CAE3C06E3, 0xDD79131F36F10C23, 0x749EB96652CDD0D8, 0x52AEBECD8E675807, 0xC33FA51B283F7481, 0xB358CE197A1E190B, 0xEC65AEAC7F5779E8, 0x530748170724292D,
+					0x8533F11A3A8F930A, 0x9AF398D58051B1CD, 0x10EA435538895217, 0x1D3315A34E4D3672, 0x71F35E2940B3213E, 0x4C6FD6F74786CCD7, 0xB7BA79340319BEC8, 0x28FBB257CB2F5348,
+					0x4743C423351CB3B6, 0xAE86DD24A192CB50, 0xA52E0D581375150C, 0x2FA4164655FE646F, 0x9850D5B975B67C9B, 0x055B44F748D6A624, 0x354A6F14B422287A, 0xFE00BB7A2D3B82D7,
+					0xACD4811FA3EB2F96, 0xA7647A1EAB4A802C, 0x0E8E4B67EA34A4BA, 0x24FE2702BFB48E86, 0x985323C525770679, 0x5017B8C599D0F3EF, 0x3006EB9F69F641BF, 0x1F237B03FEDDDA32,
+					0x6A9D103905D48824, 0xE8977871B98B9949, 0x7CAF7AC5D91E1EBA, 0x24856252BCC52CF4, 0xCBF533A4B11750A4, 0x3EB2F444B21B89DA, 0x6C86B0008EBADBF5, 0xC7CA4AA17366D743,
+					0x06AAE0D6401B6E68, 0xA6FCA2AEDEEA8BDC, 0x1D6F7F8E73E17BF9, 0xC0C883063B087E1F, 0xD96D67D353BC6E01, 0x005F9BB1C7F9E713, 0xABF46B61C8051AC5, 0xB153519649453449,
+					0x0A8A9AA9C05DEC03, 0xC7ED225B5B25D367, 0x3D37D26239F7FD72, 0x5BCE8FC2D1C532D7, 0x5443E6F707603B0C, 0xEB8D6B94752AF7C7, 0x9AD50237520FF248, 0x0EAC39D3BE172512,
+					0x73B3DFF3E8F5AD91, 0x536EECF577853DE6, 0x81852F0A442B97F1, 0x71787A91A4418ED4, 0xFF96F80B6FD2EA2F, 0x5D23E555B045A630, 0x35F804EADF075BC3, 0x980B721C06753952,
+					0xAD3E80BA2197A76F, 0x26C7A0EAC38520D9, 0x31F26DACD730B995, 0x40002D2DFEDBB420, 0x210E2858CF9DD007, 0xD094568B965C30B3, 0xB092D8922904AE8E, 0x76C3E41DA90F3EB1,
+					0x9F148333BEC155F8, 0xD58964B49D8BD1EC, 0x9F850EC8A60FEAF6, 0x41EBDDEF3E0934FF, 0x6CD2B86DE413C826, 0x7976B3A314BCB8F5, 0x03A8CB1949A9647D, 0xF8FA823F32BB48AF,
+					0x0607FAA670414254, 0x2BEB1E08673E87E2, 0x708D9DBD9A4AD5EE, 0xC41108B97AF6950B, 0x898EE175B8D67096, 0x01570C4061711337, 0x05BD8A714E3E035D, 0x10E02FDB95B0E77A,
+					0xC97E2631D7E81A50, 0x912FC94BB3629E0F, 0xAB06BC81CA7EDF79, 0xF53C35C37D91E5CE, 0xB20FBDF9AA99BE80, 0x80437F62934EEB03, 0x83F19AD07F96F1A4, 0x2580568A2E96EA1B,
+					0x5DDF3976F93CAD35, 0x575541C54AACC9DB, 0x1792AD656969E571, 0xBCC1D41BD4A8D932, 0x3ABBD278FFDD04F3, 0x69CED5955D6021C2, 0x965C348E48B87E21, 0x4EA41EBEB1296520,
+					0xE4ED3CF59E03986D, 0xC3231D4CBB526FEF, 0xA7926AB2661A0EF7, 0xFF84C476882A9102, 0x5080472FB97AF49A, 0x41D73FC192FABFE6, 0x46884ABFC7C23B78, 0xC2AC3075AA4894E2,
+					0xCD89251F6316CB32, 0x9F7C946CE8F8654D, 0xFEC02C4090C21A36, 0x512FB1F414925F23, 0x2F94F2076216A779, 0xCE201620A37B333C, 0x57B1DC6A21CB17C1, 0x4EB0C164F38B1C3A,
+					0xCA9A2D3F081A9992, 0x49556BE36CE4D26D, 0x1617B0FA666206B0, 0xDF82757D02A7ECCF, 0x9BD45A176DBF534D, 0x141337C2B2666372, 0xC0ED4DBE82775FCA, 0xAC738D07DC092D16,
+					0x371EA2B8BDE8DBF4, 0x785E33FAC1A1DCA6, 0xDAFF9765DE04E9C1, 0x64F9FA75704F5699, 0x2D72A00253871BE3, 0xAF494C1E8E1AFA23, 0x500CFEAC5F978D22, 0x6A6D387365C19CFB,
+					0x3FBFB19A2DC01C64, 0x145E48962C7B7B38, 0x6767C4FFBADB5A27, 0xC12F2478C4BD86A4, 0x10A3D7B5169EF2C9, 0xAA9D316DE7DCEF49, 0x246D6F1AC488B5E4, 0xE0E2381223C9FA0D,
+					0xB71944FFF3808417, 0x3C1136738E7D10E9, 0x9A569D68B4C7E963, 0xB3997B4656522ABC, 0xDECBCE35547FF3E3, 0x759176D0BE5075C9, 0x1AAFBF76406C4382, 0x1B5A009D69FE028B,
+					0x1E41EE2693B2E9D3, 0x5EBA454C5781B583, 0xC32334A765524932, 0x16960F40EC8E94A0, 0x930A91B3F94A9A1A, 0x2A1B452066CCF11D, 0x6FAB22CD2E2A135C, 0x25A5FD8F68B04F5B,
+					0x8F4D00550381340B, 0x8B8DB8854DDA5D9C, 0xBF003F77D6213398, 0xDC364D88EE9FF083, 0x738845954773A95B, 0xF93CF0CA8FE94867, 0x5CA39A5FF5E0D011, 0x36E5A6FF2B178D74,
+					0xBDC03D5685B0BA17, 0x6148753E7B2365F6, 0x771180F5AA0037B5, 0xC2F5AB930E8F40B3, 0x8BD6ACE92D9042F4, 0x7401140C98B49761, 0x65BA9C5DB48A0E93, 0x82139CCDBEC302BF,
+					0x2273C8CC5D10E0A0, 0xEBE7407D039EA240, 0xB05DC34654454B8B, 0x5342E428E17419F7, 0x49787121F231771F, 0xECD6F18BB019B6ED, 0x13087E8FB4AF4D80, 0xD62978B692BFBC73,
+					0xE5C20E3EA7A74283, 0x1823D2184E1C4E0F, 0xE3AA809F2FB2F6FC, 0xFF989731A05534C8, 0x7987071ADB22B67F, 0x596ACBF8819239FA, 0x2696E99EA4006C83, 0xB80C71CDF4870A58,
+					0xFEFD1ED88ACB5033, 0x4E204DA949B7D9E9, 0x42D6242E5D141C64, 0x58E819323E69EA93, 0x45410E4760D895E9, 0x149221D0BC29679D, 0xD96A6E5E9A9026A2, 0x6C00671EE0CB5C0E,
+					0xBF4F0E0F24A35106, 0x963A39DFF8BFD3FC, 0x47F9AB6CA05DD18D, 0x76135841FD9FEBDF, 0xA586A61788AA97A1, 0x1AFA73ED486D7BBF, 0x7D6B057922595550, 0x96AA51ADB9994585,
+					0xA4923231793A9E5E, 0x6A36115B44E8782E, 0x925ECC10236C5080, 0x2AA1533349430C7C, 0x561B1CF80D5841BB, 0x3F65324AA3CE9C7B, 0x9D6A2DC348D37681, 0x7DAE25CD70A2FF25,
+					0xCC6289F3D7243C43, 0x82ADDA89170474A9, 0xF8CE6B1CC0EDD0B2, 0x2EBF1E4291B87A9E, 0xF99281E28923D1EA, 0x70D461424EEA7191, 0xB768C2C790AFEDD8, 0x63DE743B25BFEE77,
+					0x656266B96EB76295, 0xE9CCBA87FBC35B97, 0x9D74113FD641E890, 0xA3D63068E3625C1C, 0xB2D27F14803EFECE, 0x74832ABEA2F1B8E0, 0x5DBB94E767707924, 0x75B37B74EFA218C1,
+					0x51093EFF60CD4D58, 0x9429A3410AE9774B, 0x2EFCC09548414B2F, 0x30E8D2B89AA714E7, 0xA2411301FCB1D408, 0x535EBD765A0BCF01, 0x21A865FF583990D3, 0x82DCB0FF0C9478EB,
+					0xEC9AB8686B601EF8, 0x74944959199E0A84, 0x83BFC2C5EC3E541F, 0xCEB85EDD74326290, 0x492CE2D8FF09578B, 0x40F99E3E272588E4, 0x62A2EF6EC240DF47, 0x44D7A9640534D70B,
+					0x14FD30FB4171EF95, 0x378B27617681F0FB, 0xCFAFF7E58ECB2DF2, 0x5CEA648321F5BA57, 0x97A224A975C8367B, 0x08F57A67439D0A94, 0xC76D154F2B004304, 0x205D49329D34F32C,
+					0x8C71F5D37C12508C, 0x46CF7B956AA060F9, 0xBA2C5618A6FDB785, 0xE521A27601817D97, 0x9164A95B0336929B, 0x2ADD755A78C86AB6, 0xCF758BD59CEC2318, 0xC7F5C8EE380B55C5,
+					0xFF79E1843E5B66A8, 0xDB51AFDBAFC39344, 0x0AAC671EFC471FD0, 0xCA65D3794DC33911, 0x9F193BDA13EF50B2, 0x8112C0CE1D147621, 0x8357486B96FC5815, 0xE1CC6815DB767CDB,
+					0x3BBD8552A371C00B, 0xD0BA1861E86D9000, 0x191A90E2B10AF159, 0x30EE8B2FF3D39D92, 0xA169B54610BD2F89, 0xE5BBF4A8DE385E59, 0x3DD282FDF81FF652, 0x349C16E12670CEBB,
+					0x596B7638F94CE6DC, 0xA142A0A1B7654C22, 0xBAA88C9FE37A3B73, 0x6361542449F12856, 0x4356F1AE0F066E20, 0xA4E192B71B25841B, 0x7A23793A4A22A2CA, 0x00A34ACA03AC3F88,
+					0x803E10810DEFC558, 0x7D1CDB98A20C3181, 0xE418588CD19A88CF, 0xFB87AF348AFC29AC, 0x6E3103E6EBEC0F80, 0x32553E9BBD96810E, 0xF1C69713D11BEC4C, 0x6B7404C3AFFC5DD2,
+					0x633118B41697C847, 0x442649681F25F0E7, 0xB4980D65B54D95A3, 0x21AF7AC5B3DAC41E, 0xA697635572EAADEC, 0x83FA943B86FE7FE8, 0x076116FA8DE1E77D, 0x515251AE0760F1EC,
+					0xE2445406E0B00F3D, 0x69DBB6E2D0140E99, 0xCA4A2FD2CAC3CF83, 0x06CD76493C9AF473, 0xE4BFA05F83387847, 0x8144F867150778FC, 0xC0DAF61A18D65658, 0x865FE4F204F719F2,
+					0x10280710E89B38BA, 0x1351380FD59C9EE8, 0xF6D84BBEF9308A29, 0xB90CAF6009F71E4D, 0xEF977EC627031542, 0xC878CF9317796B0F, 0x559F10562ADAAFD9, 0x809F4FD6D9E562A3,
+					0x1D524420D59F1D4E, 0xFA2821EBEB5B89AF, 0xE5502FA64EB5621F, 0x9A5AE9B187338606, 0xCC36F1EFFEA3BBE3, 0xD8E45610B3C895DB, 0x6B69D5DDB8687531, 0xE7473FDD055EE5BC,
+					0x5E36500E3E65979F, 0xD6E118ABBA832592, 0x70323E05FD5C941C, 0x6CEF56764438449E, 0xB1907100BA3A9AF3, 0xD83A85DC6C4CC0AC, 0xDD86F9299D132025, 0xD75D23C9B56D3925,
+					0x8D7F181103847A6F, 0xEC38E054A7966104, 0x92E7797CA2CC8126, 0xA4234616E5F02AE4, 0x9DF6BEB128A218FC, 0xE6E09D94F51D8E30, 0x1A596585C7039BA7, 0x918CDBF1C180477E,
+					0xCB02DF35294C3995, 0x75613D1E810F2BBF, 0xB1332A1D90529713, 0x18DC4475C57C2A2E, 0x2AC7EBC69270ED77, 0xA8546203228E04B2, 0x571CE8531BD9D641, 0xCBC1FFADCC6437C9,
+					0x5722ECB3104936B9, 0x6A5992457826EF9E, 0xE8B6D410D60F967D, 0x4A32E3B31B9B2B9D, 0xE0479589FAEAD797, 0x5C73A4474AFAAF50, 0xC821A0FCC37B54E6, 0x0B067D2AF7C16894,
+					0x81BC749BD39FF528, 0x28A9BC6369545B52, 0xEDBDEBDC3616892B, 0x1F535FF6F8A4F66F, 0xEC0B5BA3DB1040B8, 0xBBE024F3F8538B5B, 0xF7488213C2ED7542, 0x323A9A73BE622267,
+					0x061878448BDF5A5B, 0x59C98A0407D96430, 0x6CE0EAEC7BB92D5B, 0xECA5D6EB947D2FE6, 0x18616BE551E5E3C3, 0xB63C51888B21B571, 0xC63E454E243ED101, 0x1EF98BA71A9D3E8C,
+					0x416A11758645532A, 0xA4FBBEB7D4EB6EAD, 0xABF208EEB6EAA031, 0x1D5626D2F23599AC, 0x9B0979CFFFB345B8, 0xE774848918D33A9E, 0xEC1662385B15CDAB, 0x97193A02AF9C298E,
+					0x40A93AD7979AF85E, 0xBA335F07CE3A716F, 0xBEE1826AD4A1107E, 0xF7803A47041162EF, 0x958DFD84D5A795CD, 0x48260BCE6094FBEB, 0x0739679817018ACE, 0xF967F97C0740682C,
+					0xC8B8BE5A31DB6A84, 0x3354661828FB5C31, 0x7A484203CFB9FD0E, 0x5C6A0A57339ECA09, 0xA76112309ADF2F7F, 0x3FCBFE256AA7E4C1, 0x5C4C9B285EC6D5C2, 0x7DA1FA3C61C2AB44,
+					0xA4CB52C74DE28B4E, 0xFF894C5AFDCB60ED, 0xCD0793B4769DA725, 0x8B7939261CC2BB02, 0x8E091D1518F78D9E, 0x70BE08B087F9BC39, 0x4C8FD4E39E268AA9, 0x7ACF82B633F85A86,
+					0x3197B6B7E5BD6439, 0xC129393EF8B3F0D8, 0xC9FB72CBBB7E7D12, 0x69B23BD9C9877446, 0xE6FA0FB95CD19DBA, 0x64AED0602987BA95, 0x98562C104AFDF34C, 0x38CBC3484AADAB56,
+					0xBB1AF49F6C1B4E16, 0x7ADCCE74BD30AEE3, 0x54AB1FB887E082F1, 0x165ADCD82E22FB61, 0x1D877E2F352C8E01, 0x34D80A201E0C8308, 0xC3E9691CB0B5F137, 0xCD2CA8F4CC2839BE,
+					0x4D66F112ECAF3289, 0xCDAA9E3C6C8416CD, 0x278635AFF2599D1D, 0x8921777A7EEC3CCE, 0x4249755B9564F3E3, 0x50324D929AFBB8EA, 0xEA8BBAC074F6E66A, 0x713C711AF6380A48,
+					0x7F22F3F2C4CAEA5D, 0x5836E30F4CCEDA0C, 0x756863DCCA15C8A4, 0x8A9B46FC8D043C2C, 0xF0C8DFC0F5E4C678, 0xDAE3C992E6A96B33, 0x0136591C3E372F60, 0x43FD508522C25A3E,
+					0x855D5051970D1FAC, 0x130DFE4DF759E8B0, 0x8CA788CFED6DC0AD, 0x18FC2C055A801682, 0xAE265058B0D5ED92, 0x9FEDCEAF18C2E3CD, 0x3C69478F17DE6EAF, 0xE397531427F56782,
+					0x4F8137D6872BDC93, 0xE2BDCC19E2D56BBA, 0x763578B9F3DE33FA, 0x06659B7167AD8651, 0xFF2A426EFF37987E, 0x97B77BFCD60065AC, 0x6B638BA1B23AD67C, 0x893237AAD3B32E07,
+					0x9FB183F40189BDB7, 0x0F0F8002D4816A7C, 0x963976B0A85C07E2, 0x14F8B82DEFCC5DD4, 0x98F77607A984A660, 0xFB339D53E2DC3887, 0x8A1138145D1D20C3, 0x7D3A602655245D56,
+					0xE12D4532C13578EE, 0x4A2E89C9AA91C0F1, 0x6FA76C2B9439900E, 0x5E8D23C521342B0E, 0xAE2488DE509EFD63, 0x573F96C93F89A7F9, 0x53789429DE4A68AA, 0x61442F79714572E5,
+					0xD8CD619083228911, 0x338E73415610C96F, 0x3B37C2D49CA9961A, 0x2992A51657C2243F, 0x5627C97435E5F0D8, 0x90600611F996FA76, 0x2A5AF7126AF0A3A0, 0xF8C02D52610328EC,
+					0xB8DB541E5DEC3BFA, 0xF98EC485E763677E, 0xF6E3DE61D44BC3A9, 0x1F8A3E7A41E858D4, 0x1E052027176995E5, 0xF619A3DFFB838B82, 0x27BA120D73301BFC, 0xA73CAA1847045770,
+					0xC678897854650378, 0x05C0943238B3D0DB, 0x5D25858BE39804A1, 0x83FF0AC52AC57DF4, 0x0EB2021C5F7B9D0D, 0xF2F778FD9D27A318, 0x123532D7F0A79A20, 0x2730104D7FC13492,
+					0xCF1C1F17D342C37B, 0xFD37564FA8009087, 0x02E90D35567AF764, 0x5C70B90556F388E1, 0x8F7793CC72BBC8EC, 0xB730968D6B1C8CDE, 0x51991E3A49D8C886, 0xDB7742B861C9435B,
+					0x13B98A80F6768C38, 0x6E7B404CB071B15D, 0x60B2846E505A2781, 0x240D748409105FB7, 0xC8BA155A8B80B5CF, 0xA4DF7198C4B3250D, 0xE02FCC1744724FB5, 0x421A8FC5CAAE44B8,
+					0x8049A1E2B93B0053, 0x631BF52B62A8401E, 0xF3E8E6E87A772C66, 0x556B18AF8E81B7B9, 0xDAA11D422554EEC2, 0xA52D174B573259BC, 0xB9B7112EB778883C, 0x67C9BA4908EBC23F,
+					0x1A767E073FAD03B6, 0xD5EA4738F68A7202, 0x63900B9E7C1E4D94, 0xAF5FD58470A925DE, 0xAA88E38845E90B5E, 0x3AD5F903B2BC2D43, 0xF6FFF87B03366A1F, 0x434F6A7DF7F0DE22,
+					0x51E26E73742DAC61, 0x37910FA502583ED5, 0xE7E9B3FD44A2773E, 0x29E44197095CEF91, 0x90E7112094071940, 0x26A30FE9846824EC, 0x22E09753F33AA19D, 0x10FC50D1090014AA,
+					0xBAA098F61FD68B2C, 0xE200080458FA1EF3, 0x82B2CB029A983B34, 0x6A218F1486832577, 0xF4E9A15DB8ACF9FF, 0x3E315F82BEB19D85, 0x1E48D24E4F3C49F4, 0x5F9ABA2CDA2FDE68,
+					0x472CFDC7BA77DF84, 0x94EF136B0FEC6CED, 0x6AAFCEF86E8F70A1, 0xDE18BF5D9C76376D, 0xABA97566C528E81F, 0x3D261A9606A6EBAE, 0xA6F751D23A6E2155, 0xA972AD0EC8027C16,
+					0x618A9CCAF3ADCEBE, 0x9C6F486651CE54E0, 0xB29BE809C107032B, 0x398503D1262034AC, 0x93BF08764C4BEBCB, 0x67A68E854CEFC7A3, 0xD01CE0430FB7FE4E, 0x8C65B2770EBA569A,
+					0x8ADA27E1F887B614, 0xE2A2E21DB7BAF840, 0x7C2FF8A20E656A79, 0xB40CC991AF96A722, 0x644490E9C0D396C8, 0x230E6368F5A4D382, 0x9DF9AE3A53DD8774, 0x9268E30AF60EECF2,
+					0x63D8062FF4852A73, 0x6E79B4EFFB5BB314, 0x3B1E6690F4C76F6D, 0x9F4F72E8F19A5358, 0xBD83A8D917B1A418, 0xB8F49F34C254DE1D, 0x9F2EB39A2115FD1E, 0xA6FE796132141E92,
+					0x7379FB85F345A3E6, 0xB938C7B66CE1B585, 0x5C18BB5F5007AE24, 0x410A836A31690A21, 0xEF05C012E0E73995, 0xC0550BDCB150A012, 0x36BD2F19121F7AC1, 0x10B6490C77ED15C3,
+					0xA54E9265A8F1FFB1, 0xDB7D59260830C8BD, 0x744BC6C1B0F44A44, 0xF8D58DE27BB77C9D, 0xF43A328AD9C07DF9, 0x9C35D6F822DC4A65, 0x6C028C02DD34EBF2, 0x813BC310692C9263,
+					0xFBE618E7DB40FC01, 0x316AC9A5D9A327AE, 0xCA54A8A990EADA8C, 0xDD79F7BCDBCF7F19, 0x677A18CAD31814EF, 0x790AC9B574B695C0, 0x52608E90B2BE5869, 0x43444A3AC6F83064,
+					0x8CB3B2DB754B42D1, 0x1B6521D4CA0AE565, 0x16AD35B88886284E, 0x78A207EEA53876C8, 0x58A92283E9B1B70E, 0xB78F122DF0D4A224, 0x64614EA7119D2DE3, 0x0DFBAEBDE949D7AE,
+					0x18514D34DF609B29, 0x2DDD529BBFC3F15D, 0x7587E8820B4E7115, 0x61080FE5E2C0DFAE, 0x538F4BC7952FC566, 0xD2A29F5556397EC0, 0xDC7340D01A823BC7, 0xECD4648C072B1841,
+					0x367C2240F615CD12, 0x9E1EFD0BB518081F, 0xD38FAA94EE0CE9DD, 0xAD0D2D1FD3BFB35E, 0xA1954B6F67505959, 0xFCB73AECBB17A76C, 0x1227015BD6CFB2E5, 0x3F9DACE4DFAD030D,
+					0x069C8F10E0246A65, 0x2DC4F9029CBD1D46, 0x9A92DF9B70E6A6FA, 0x3598BCBD15B419A1, 0x070A880339D7F63D, 0xD8D926E1ABB0578B, 0x0F2DC5452DCEFF97, 0xE99679ED8732130F,
+					0x4CEA4D6F90B10F8C, 0x92051A4FE1269FD7, 0xE82E4DE2D50A0AE0, 0xF5C042969307B3EE, 0x554953C6B4B2EB4F, 0x21E878D0BC5EFEAE, 0x7E0477F97F96A553, 0x72F89AD203FC13F5,
+					0x5119BBFBFAAA8C65, 0x475879A1953E4E58, 0x175673EA987FB907, 0x4E69AE312D9674AC, 0xCE11AF8BA113FA0B, 0xC9D44DB4C9BCBE85, 0xA6CC055E2F6BDEE0, 0x55C4BF73FC96488D,
+					0x5CFC6606FA60AAA4, 0xE84CEAF1C772213D, 0x13E22C43984B0394, 0x3D1035BB1BBC758F, 0x6B6B71214C37E3EE, 0x8863E01CBD1BD9AE, 0x9FDC0D0C3BA5AC35, 0xC47C33248AAE7C26,
+					0x81FA5DA86790FFF4, 0x3B261112BA098231, 0x63F83296D93C0CC9, 0x94CF2C3EC36778DA, 0x4077BBC24889113D, 0x0358893507E2335E, 0xD25236BB4B7D3F8D, 0xB238E9606526C05D,
+					0x9A3DE39EB0B91D62, 0x0CA78643AFD4A73D, 0x4D7DCFA6C48BA278, 0x6354EF0DF5C069C6, 0xA11453BF457F2B19, 0x420C643B4B8E2763, 0xFD063BCC8C645701, 0xF9703B2CB0773186,
+					0x148F7CBA8EBA0943, 0x39414510133C35AC, 0x4A84D85B371486B4, 0x97A8DE655F57FB50, 0xD103B16D5DFFA75F, 0x7C63FAA94655BCD2, 0xEFF3456FDCB6E6C9, 0x6CF4847CBC618515,
+					0x6500D8A127845C79, 0x181C14CF27C93F44, 0x3C8592742375C31A, 0xC9A818918D521E78, 0xA604FFC4827075FE, 0x0F208FC9B546BA5A, 0xEA32D23746CF2C0B, 0xF2FF63FC487338FC,
+					0xF6F2A37283A6C636, 0x0D08F1B9CE4CB7AE, 0x69683FF3BD19DC14, 0x3106779BC6F060C6, 0xCF1A48D35A93FD8C, 0x6A743B8C9E980879, 0xABC0C851CF053327, 0x9F2B5C0B3F4B3598,
+					0xA726B75863B40B7C, 0xFBBD65619014AE5E, 0x2CDFC13E20653FBD, 0x64E2DE723E0EB81D, 0x2AE9BD62BE304C9C, 0x7C5312332D78AD5F, 0x9AE531E72C1C3E2F, 0x3C8E79A5820ADEB1,
+					0xA911734544CB24C2, 0x2CC157AA0493422D, 0xAADFF9108FF430AE, 0x8427A52153858EAD, 0xEBC73611354A2E15, 0xA4DE6F22D5658796, 0x547664999A62A6A2, 0xD6A0332EF76E8AD7,
+					0xC873D63E18FC7C39, 0x3C3355CFA1EF2675, 0x7E3D6C46901D3BB2, 0xD117F83BEA4F46E9, 0xDC592F078B4EC5A8, 0x5A95270804F9CC5C, 0xC4B4DCD63D15567B, 0xF727BE5A1474F246,
+					0x5096C665AADE77E8, 0x5CB7A2A60E447E22, 0xA691D32A62490F25, 0x6B1D7A68ED411CA0, 0xEFE8B81B8038DCC9, 0x0B82916317BB4246, 0x4C041BB9B64B8798, 0x5B326FF84A91E751,
+					0x8C1C42E63CB56C20, 0xA26074C66F677D8E, 0x9A00D5D7C20A3C7F, 0xFFFA9878D225F584, 0xF8A210E47CEFC7F3, 0x517186D87330F3B4, 0x49BDE63A38411653, 0xF2ACEE0E2B1F76CF,
+					0x8FAFBB5C3F10D657, 0x7D922A8CBC282AE2, 0xFA0E838E6F60332E, 0x875A3507763D50E1, 0x230B005A9B68ABFC, 0xB9CF1079E0D06DA3, 0xCD2ECC91A2B6B660, 0xA4DAB1B698589B4C,
+					0x688810E9829EDA51, 0xDF55C4C0303709ED, 0x00FB8739B709E96A, 0x8FA3840B2FD497D7, 0xCA117F29DB80DA43, 0x553A2018F614FB61, 0x5AE2297F4B7C9E7C, 0x014AFEFF6A3AB52D,
+					0x6592F79BA56DDBA5, 0x95C802C27FF7C869, 0x0461C42AAE399A78, 0xBC938AC14FB6D9DD, 0x25E3F3FF047A8103, 0xCB81DC6EADE9250B, 0xCF5CECBADFA3706B, 0xCD8BFD6C00FACD84,
+					0x44527AF40295FB9D, 0xDCFB5F25D7B7CF67, 0x693FA3B816465AEB, 0x202B3C7E11463423, 0xD6F87DE841D989EE, 0x39EB7D21755F7F76, 0xC5C3E77D5C67622C, 0x204AEC356AE4BE21,
+					0x036137355CADFCD3, 0x97415770C2B3A775, 0xB8CEDF4AE392BF62, 0xD7C4890BD16A3475, 0x98182DE2AAECED81, 0x469F220984913E59, 0x6DB0F08D56C2F3CA, 0xDC305B961B42EC6D,
+					0xE3290E7380792F00, 0x9C4C74FA666E0AC5, 0x2483423254806854, 0xD333808C760B2FFE, 0x2AD0356DAF0003DC, 0x1A8BDD68D959BD3E, 0xD813A368EFDDBEE4, 0xE3E9B9373166259D,
+					0xB9B09E28FDC58974, 0xFDDC924CB01FB9BB, 0xAA24CA16B5D76381, 0x850CC910E69C0D08, 0x4BBD482DD6B866A0, 0x83B57508778A7607, 0x1EC24CA8562101D7, 0x42F0A8812F35ED4B,
+					0x3C47A0D4094E657A, 0x24153C3B252927FE, 0x37DFFBE506028AD6, 0x8A29FC6DD6A5847B, 0x30223D2B24209DA9, 0xE8EF0AB84053AA8E, 0x745A16A60676FD17, 0x8BC2683B552C6591,
+					0x1E1274FD221AE7CE, 0x88A972775386909B, 0xA02A35C4BB8EC8C9, 0x7EC1F81FB223BAC1, 0xE37B7E76695B7A08, 0x845DA38D9FAD75D5, 0xA2D0C4747225760A, 0xFEB0FE3E308653BD,
+					0x9D8AF1E648DB7845, 0xDD2C571E8C8BA29B, 0xFC59B31D7653BCF9, 0xBDBA72AE0E50E97C, 0x95CDF3FA42694213, 0xB3BA76C93D109F9C, 0x7FC3E6EFBB541A2A, 0x600955C91BC288BF,
+					0x1AE9C7C26F067D43, 0x69E8D24A3BEDA645, 0xDFC8F740D32AAE85, 0x53DAF8CDF694898B, 0x8B35617DBF6D0383, 0x5A095EAF5314DE29, 0x225079FAD1C56FC0, 0x213FD8F68E8E5381,
+					0xF29E20D8C2D6A46C, 0xB4D5BA68832A0778, 0x812A99512BCBC26C, 0x0F5332EFEC1EAF20, 0xE1F2F9E042B9568A, 0xE1648831196FB8CF, 0x0E88B7B62DECA53B, 0x40D7E24F50827324,
+					0x0E2A9FAB9421652E, 0xDCB752E67216827C, 0x0C0606AE696E21F3, 0x554142FA0D3676BB, 0x8B165F82F40DF872, 0xAE714BFB0768F9A4, 0x8617CBB8002C0661, 0x263CC1AC7397BCAB,
+					0x7EBC306C4ED89CB3, 0x03A92270D4C18AB0, 0x43F0EFFFECF7378A, 0x996B66AA32B5D238, 0x62A819062DCA10B8, 0x6898B6079A58C9B7, 0xDB220C68C6BBE2AA, 0x1B010AA60BB2C034,
+					0x871ECA021EB9434B, 0xD42418C90129CBAF, 0x903E274C39E66804, 0xFFD07EB58A9B6E73, 0xA915A1B456BA8C3F, 0xEF4AD313226EA47B, 0x48A85DEC1DC9214F, 0x537F2EC72D175C19,
+					0xD2D56093856E2EFE, 0x3E7F97340401CF8C, 0x573A1B0BC37BE3E0, 0x0CF5A5B1D1BDAB6B, 0x131D7DA650074939, 0xAAD1FEFDA7CC1FC2, 0x371F272D78800825, 0x3E6ADF78B4ACE0CC,
+					0xA48C8A9AE7AA2C9B, 0x7E0DFFC94114BBB5, 0xBFADD3AE66AB63F8, 0x306F73190BC51B7D, 0x37F21F024693D15F, 0x0EE80A8B3CE999A9, 0xC6F57D57A0D402D8, 0x2626C0809210D0A5,
+					0x7493F0DCDBAC2128, 0x395B531237F91A69, 0xAE61CFEA02B0ABD8, 0x9EF0720D1F93F429, 0x066C35CB258A0CAF, 0x48B53EABCB32D676, 0x238F6AF5510673A0, 0x2A07497AD4D8E5B3,
+					0x9E30079A5C963AF0, 0xE5A1621D8339A361, 0xCC6556FBAA2BBEC2, 0xFC9239953D4F59D7, 0xCC8AE12AD25991B9, 0xC05A737D7823A2AA, 0x8AC867C295DC3326, 0x63D11D8ED9203538,
+					0xE7C67CDC16ECD8FA, 0xDAC1319E0D758493, 0x11710088AF4AEABC, 0xBE966E241EBB4DB8, 0x0F6915AE060818C8, 0x8AFC39CEE0D0BAAE, 0x1C7800A6FA345C1F, 0xD0947734BD09D609,
+					0xD71E75B41E29C17C, 0x82221A1F245FE5F5, 0x5F25FAFE692464DC, 0xF260597636E2012D, 0xFE7657ECADEE9BC8, 0x5C7607DB6FF4FC27, 0x1B3B3408B6A16FE7, 0x7BFD518B1F0D2AFB,
+					0xC9076047975EDCF9, 0x0C0E304CAF6288BE, 0xF517A25EFF8A48A3, 0x16C799784CFE6F35, 0x5433B9DEAC786E91, 0x80133110BDD82A54, 0x367A4BF319186B5A, 0xDDFAC25D0D58ACCA,
+					0x6F388DCA5202B73F, 0xF98752608E768054, 0x8A253CCBB4E9BA04, 0x45D919B39210057C, 0x50E8B98FB3F6D04F, 0xB00678A8ACD2C0C2, 0xD01E28448457DE48, 0x999168A9CD287608,
+					0x7F5ED76BEB9F323D, 0x331BCB474C29E694, 0x21FAB5A53B7A841D, 0xCFD45C6DCE1F0150, 0x630133280ED08599, 0x7B75E0AFC4D5B396, 0x3653FD367BB5B6F6, 0xDEE4B833D046A4FC,
+					0xDC4F80F29019A019, 0x971F28F0DD3B055C, 0xA7F6F716167512D9, 0x3D5D64FB153EC55B, 0x05456A906B28E230, 0x4B1C6752B0201505, 0x4E3E269F8D666FFA, 0x20148D2C27CF1CEE,
+					0x23F290E8215D820B, 0x0316A260F8CF02A5, 0xC4E071F26F260BF3, 0xD31AA7F9E1D1D6E5, 0xB6EEC5D060BBFC45, 0x69F614A7061FFD01, 0x630761EE257EE7B3, 0x72ACBE82CFBFA466,
+					0x6D2E5DD487A43DA3, 0x0B7C187DCCF517A7, 0x8CC22CC4E5C308B0, 0xD447618F5C417C6F, 0x065DA4C702310A84, 0x81CF670AC98C86D5, 0x3D4AC2CBFEAC9BF9, 0x2A87E1D937FDB8FF,
+					0x010BC0AB7C34B278, 0x8E2F97304C21132F, 0x35FAF1D7070D9CC7, 0xC350D3284B7064E4, 0xC79CD96C3DBC736A, 0xE6AE11240B10CCC0, 0xBFCDF2E85FD2D16E, 0x9E07FD652AB1C1D9,
+					0x3C5A23AED2D5735F, 0x76DD71E10D1896D1, 0x0B8E148983EEF7D4, 0xF7FE4121918F24F6, 0xFA6360421A43928D, 0xD85E59809F334857, 0x713EC4D7B119DC1A, 0x1C0451B8885FAE7F,
+					0xDDDB25C14BE11F67, 0xE615E83D5E79ABA2, 0x22EE71115394AFE0, 0x57E31D4026EA6291, 0xE79FD71E4F7A1FDA, 0xD69D25FB960E2330, 0x75E48E5E41E826F8, 0x4077085B14C730C4,
+					0xDCC3BC24503DEC26, 0xAC62A3D41F4BF89D, 0x3108D095934937F2, 0x7C24BE499E28B2E5, 0xE176FBA19B4CA85B, 0x74D21EE03806FB12, 0x686C8F8682CF0D5C, 0x32430B5FF9B096F4,
+					0xDB54C27C4573C59E, 0x641C7DED145C7C6C, 0xAA31C8EE7FECDD2B, 0x9CA57A814833651D, 0x7161FF87499262B9, 0x5E9E3BD6B255CE50, 0xE8EC8625B8B6AB6B, 0x0A9D99922ED43FE2,
+					0xE377F2D629AD759D, 0x4208D946D19218CD, 0xEDD7EAF40C8EFEF3, 0x41F15A7393359374, 0xECE37A2284B2F0D0, 0x826996855D1C092C, 0x17E770F6D0E52FAC, 0xCB13860CEBE2CD73,
+					0x87D3A31D2B4B877D, 0xDD509ACB45019D49, 0x160DE4D69169F6CC, 0xEC17C89E8FEBF09A, 0xC375635460F5E9A9, 0x5A619D152BD71386, 0x6191F8FF26F50A17, 0xF8A17C8E6AA9A6EA,
+					0x49565F68F2889702, 0x65CB0BFBCF840AEF, 0xAF40151DB65D26EC, 0x337D568E3AC8CE4F, 0x02CC804973FAA915, 0x14B0D4A6BCAF2E91, 0xAD64A9B82E3395B5, 0xE57B1A400491BF8D,
+					0x61FDE7547673BD14, 0x1D016491A1EE0E2B, 0xB29C889926E02051, 0xBE7378A0CE402CF8, 0xB6FD05F5AB3073C7, 0x6117304A047A12F7, 0xB93D587DBB402E18, 0x793344DEE923B12B,
+					0xA6BDB3973963EDF9, 0xCDF84AFA6B36D30F, 0x6E4FCC177D279A83, 0xDEC7D7A3B512714B, 0x369B5E591C0ABD66, 0xC3D840F70453C366, 0xEF181552EEB95BE5, 0x9BD908E8598CA7B3,
+					0x0199279EDA634707, 0xF03B983833B62A80, 0x29CACD5E9E19A8D3, 0xD6639714850E2D5D, 0x34C68693D0FCC10B, 0x1EFA9726932A4998, 0xFE4F65898259DAA7, 0x0063F2478AE3AD54,
+					0x4EC86A8394461D00, 0x830BC55DDDA74ACA, 0x267650FAB857574D, 0x07E0DC43A673DAA7, 0x86C0968B40735D58, 0x38E3FA87C10DA566, 0xBE23404B09A3BD1D, 0x959B09B04C99F5C1,
+					0x4416632A0BCBB3DA, 0x8DFB9D7CB2EECE5D, 0x4969F05B37F28727, 0xE512E386570F4873, 0x2EA830FAB03C12B0, 0x5BEE1001B4169089, 0xBBF46BD3FB50E13B, 0xCEA9F53D76E30D98,
+					0x965BCA5F69F2920B, 0x95E126246437A315, 0x64784FD7CC03CD8C, 0x655CBC227FFBB5E8, 0x6C0C6B80270A2715, 0x20CC2510FD1D9DA8, 0x71D87D23AD86C549, 0xEAB1F3297101F261,
+					0x20D2683237ED9254, 0xFE1357015E9437A9, 0x5C190CF93E1AF0FB, 0x693576B379F92535, 0x607F278FCABF2A68, 0x163CABC75F4ACA3F, 0x0E6E449C4BAAE8DB, 0x310A3AFDC9CF6DDF,
+					0x303ECE2060B50A11, 0x0B534CAFA5D4511C, 0xDACCAFD48DE867BF, 0xB7388FDA6B7B96E5, 0x1699F4DE3A3079A1, 0x7CD832390EA0C2C8, 0x6DD25B2ED4234547, 0xB39A7C52295901A5,
+					0x4638EAB564978E3B, 0x907788A93658E7FC, 0x1B676401A88AC380, 0x3099478E997A569D, 0xF3E982C5DCBF52E3, 0x2180428E4738823E, 0xB267B22DA9C1503D, 0xE6039A45075DD12A,
+					0xF02525073E5EA334, 0xED14E8BE33832932, 0x7E1C9220C420EBB5, 0x3AB900ACF49708C9, 0x41CBAE46B495FCD2, 0x8B0B8E3C6BE8B273, 0x889D42B0351EFDA4, 0x4966FA20450BAA15,
+					0x915CFAE960260968, 0xB9D9DF21D083FF08, 0xC707CE4CDF6DEF71, 0x51C97871D8633574, 0x0F2CFA01A51BB6B0, 0x0655DCD405BA62A0, 0x8F305F3DB39CE17F, 0xD31791761991DCB2,
+					0xAEF9FECD1DAC9B80, 0x3D8C6DAA98CCB9B1, 0x4FD8FE233B8661B3, 0x0C4F9B2BB0B37FD0, 0x296CAD8E502FB27C, 0xDDD43705FC41BB11, 0x96F82B1C40E3FC37, 0x65801CB2B99BD8B7,
+					0x783935D93D11EF8D, 0xFA830E6A650A0315, 0xDBCDF81CD8DB4398, 0x659989204F6FC9ED, 0x8A71AECE38C667AC, 0x19DCF246222024B7, 0x71071E7C337E2D6E, 0x7DECA67915605CE9,
+					0x5D7E4DFC991A26D8, 0xA9BC0E40A484B177, 0x2FD9877B7BC4CC87, 0x483F48D0CD53BEBB, 0x678A6F5557AD9170, 0x9FF6D0CC977EC917, 0x748AF0174F2E2C70, 0xFEFF43E7DF1D5253,
+					0x7E14BF53EE622D38, 0x98BF95E5DC787218, 0xA1430C81CAC3FD33, 0x6AF7D87580FF5F74, 0xBCF642FD44E31EB9, 0xCFE9F316A795701A, 0xE63C9993C6F8C0F3, 0x5E4B72008FA978BC,
+					0x97A630B374065264, 0x529F2D35280D6135, 0x80EBA5C6D65F3680, 0xF3588274F314BDBA, 0xE37A359F92906BCD, 0xD1713BF461960F82, 0x5959EE0DA4A88FBB, 0xADEDC4EFA75D72AC,
+					0x190483E46071731F, 0x375DEB4841387F3A, 0xD8DB876B8B082F54, 0x07E263C226E4D050, 0xCE4AC5ED506C0A3D, 0x354AA783A9AB2EAB, 0x1B6CC784DF424A2D, 0x32EEB7BE8453D6C6,
+					0x37304CB29F475770, 0xDFD7FC46B563F92B, 0x389C80071A5EB37A, 0xCE029231D1CFD93B, 0x681B8A707D3EC8D9, 0xF5475354F16B4366, 0xEFB5C53C4135974F, 0x8ED87FFB547F6630,
+					0x16F435B2406BCB68, 0xD77BFBB9B37B90F6, 0x91A8B49395371C2F, 0x72B8544289756D25, 0x1B788BBE500C76E2, 0x71FE6B95E0E30591, 0x7A0B9C81374E7060, 0x00A5E3D920068010,
+					0x6F05DD6FD507125E, 0xD854798F57207F46, 0x2E5E9F4BD24E1081, 0x82544566CA8E18A2, 0x2EE28AB54E28F630, 0xFCA18D3457CE482A, 0x47270831AD802A70, 0x1EA6DAE83FA0DE07,
+					0xAB07087C649C4E97, 0xA40328A720161B96, 0x992CF46CD2AEF0AA, 0x02167A2C21AF313A, 0xCF845A9C8AC3C851, 0x3B69BF895B4F44D5, 0xED8D528830775346, 0x370647A1D448A85F,
+					0x64D37289ECCE30BE, 0x19C837F3553B6A88, 0x0E55ECC1C48EEF9F, 0xD68BE6478CE4B4C1, 0x602F7E62B74919ED, 0xC21082456CE8D68D, 0x24A6152425A61106, 0xE24464A236169330,
+					0xEA0C68F54EFD304D, 0x91B34EE7E3A82EEB, 0x832603BEF351E276, 0xECDDBF2DBD6D06B6, 0xC68DD04E90AD8114, 0x8333EBE28BE0E073, 0x8AB5D6EC33B4CCC8, 0xCAAD2765FDF94DF4,
+					0xA2B05B47F4E26394, 0x5D2DE167F06E31EC, 0x635FD250D5A773C9, 0x2CA5CA58B7CED6E7, 0xF7E36D0D092AE9D5, 0x8955BC98E9CB6880, 0xC01BD335CC277954, 0x4CBBEB1779EBC31E,
+					0xD7919EF2D762BD9A, 0x43176D63C9EC8004, 0x22F8A04139FB9D0C, 0x5CC62E70F0AA3BA3, 0x7AC36D30574290F6, 0x50AA3D55D3F3FCE6, 0x82643697C3C9DD3A, 0x12D3D279F48301E7,
+					0x019EA7212A6019EB, 0xC24AB51FEF51DF7C, 0xDBB16A222523E6E8, 0xB3A4127FDA28E2EA, 0x7AFFD7889CBE1A1A, 0x379139FE498217E5, 0xB2F6C5C71CA12DEE, 0x0C1AABCCF80928A7,
+					0xCD6D25985485C433, 0x7505AF95A1C87178, 0x9ED8F0A475A7F11C, 0xD8E7AF136BA0EBA5, 0xBFC5CC365C35CE06, 0x635BA90B4E5913DE, 0x5BD40CC83CEEFE7E, 0x40664700945E269B,
+					0x23352C626C33AF44, 0x94FBCD6FB251768D, 0xC30D8B1D51ACA11B, 0xCC6CDBE7C208EFCC, 0x2DB1296AFA182788, 0xE68A314F332A0F16, 0x7629DAAD489F3E20, 0xA33D450DC63F6024,
+					0x5DD241D0D865FF52, 0x96EC6C802091206D, 0xCFBF5E3F1768AFB0, 0x16C2249980F509B7, 0x22F7FFBABF23A97D, 0x2A6815657921F20E, 0xA2422A75437D1189, 0x3375A88A07F9F513,
+					0x48C184068A3B5E84, 0xEB005BEFB883DFAB, 0xE11F3E3AFCEEA221, 0x3F83877A63BA711A, 0x23DBE95CFABE9563, 0x7B3ECB422DB0DB01, 0x7B04AC67FD0D55F2, 0xA1A3F10B9E5E3F61,
+					0x643604B2A3342FC7, 0xA9E2AD3B4243E491, 0x671C52BE5785D03C, 0x31A300C0DE677FAF, 0x5083ED2273A6BB70, 0x3E13F143C33C32DA, 0x126A42A80C4BC80D, 0x3A64D01B36CACF28,
+					0x8D7845FAE973647C, 0x5F77926CB8D95F38, 0xD63E88BA39397716, 0x4B116D5113F78FCE, 0x2A3A1EAE9D0DDD44, 0x380D8B62F627A033, 0xF5F0782DA6B6E3B7, 0x62804614682F8DA3,
+					0x355506BB91FF2A5B, 0x3AC72DF7BA7ED9DF, 0xB6B5CB76EA060228, 0xE5BB4EF6FF427DC4, 0xE3649A7F3890849E, 0x3251BCF2226F7652, 0xD29810DE7192265F, 0x387CF36E4E72D023,
+					0x6666AB5B0AE9F631, 0xBD13DDE2A86FEB8A, 0x6012F85D69EDC776, 0xF41F4D0E6FE19101, 0xE54613B97C51476F, 0x6D0AB5EB8A15FBE6, 0x3D2C2DC4AC8FE299, 0xE7246F6EB5590FB4,
+					0xAB90186858AC18C6, 0x3541C04F1D508568, 0x6F1C88FB7424D908, 0x01C8067CE83E21EF, 0xD4AD269D70E72AFA, 0x74CDF4EEA774B1A1, 0x0989DDDB23BB487D, 0x922831D556AAD6A1,
+					0x152184CA5A49ED81, 0xFED07AF0B9435F89, 0x968C6E3B5951BE44, 0x9FCC2BE2E611BA38, 0x74042180565FDB77, 0x4AE2FF953AAFEDC5, 0x49E7D65481909989, 0x800A664AE0A20978,
+					0x6549A75FF15A7EB5, 0x243F54959C451BE6, 0x5AF51F508E9FBEAE, 0xB30DD79C79213C6E, 0x5F475E61B669636D, 0x5490C8BA1FD7EB73, 0x33882C0876F2152D, 0x5C5C8E6F1CFC3778,
+					0x8756C20C3691C267, 0x615957DFAF75B012, 0xAF94691253B00247, 0xBC98741A931638D4, 0xA20318AD6B6FB47C, 0x733FF97202A567C4, 0x906468EF0DE9E3C5, 0x6E981D672841A3AC,
+					0x545CAB53D1E62E13, 0x29A3C73F8AE3298D, 0xC6D8829DCC03046B, 0x02B4F23E459B9912, 0xB93858A515250590, 0x54FB39830D401F19, 0x8751D2FE9E64C7D0, 0x59E1C189D47817D5,
+					0x8CDA25659F75EE23, 0xB51ACA033F083736, 0x0EE28352C1BC1DF9, 0x9664D7836AD6D91F, 0x1ABF2D75B4A61957, 0x701EC28F03CD4D21, 0xBEBC5F6A05BA2EEA, 0x8E3A10CA1CB17F0F,
+					0x72ADBBF4D48DE9DC, 0x3D3ED8AC4DC066E4, 0x7306CF192E158D88, 0x536DD77717272134, 0xB67FDF428F43CDCA, 0xEF0C4ABFBE8A46C0, 0x6BCB08992D3B2AA3, 0xE5F2B4BC91D7ADB6,
+					0x97F0A73737D7B4CD, 0x2F969AA417425A4A, 0x07DAF962C44DDD41, 0x2067F63322806832, 0x2198F11A4601FE2B, 0x27FC8545C898AD5E, 0xF2EFB14578975BA6, 0x50A4293EAA10463A,
+					0x24DEB549B1810898, 0xCF2BF072D7096BAD, 0xD79BFF53A8225E6F, 0x02810C6C40F2117B, 0x186362FEC35CB058, 0x518580384EDC9673, 0x40A013F03D6FCC62, 0x1A5FB9F958877FA5,
+					0x05FC3470CE17CCF4, 0xF4112DEA8D080061, 0x87ECB4C4E0CA203B, 0x565C721D3D5518F0, 0x1D095B2D09D53D99, 0x7E7761554611A332, 0x79707713346451BD, 0x0146C2E4D79AA80D,
+					0x3FA8EACBC7EB5E31, 0xA46AF238D364B7C3, 0x6F7A423D80253B35, 0xBB04F8FA04413C1A, 0x4BF792AFDD36C381, 0xD6C8B3B5433785B3, 0x012357E5E36B10F8, 0x7A16D7DCB35679BB,
+					0x77ABDD854357F26E, 0x3957E9E833F88699, 0x4224AF5D1DE3FED8, 0x06D1137A7F2FC843, 0x315A0AE828BFD590, 0xE830E63A7E420FA5, 0x2A6D27DACDD54BEA, 0xE6A2A1F85F172D4A,
+					0xDB71186EC376D2D2, 0xAD2C21410590BA2E, 0x157D9F9DC961CAFE, 0x6AA2F309CD8F1302, 0xA30E9846755F9CC1, 0x9B3A27027D43896D, 0x4C43016F6AA65913, 0x3667F238ED4D7679,
+					0x5ED7C5DA81D85A5B, 0x19EC88BB675D0D3A, 0x993A89334AAD24E2, 0x5F5F56127DD61C75, 0x8A2C2F87E2DC2963, 0x518B8B989EF5CAC1, 0xDCABEDD30602D5B2, 0x85AC21CC546B8EF2,
+					0x44840DDCE17F8518, 0x43822A7E9A35B799, 0x1F1775349E91C31E, 0xF116E515D268EBB7, 0x2884B5732C9A7175, 0x6BC06DAF077BAA05, 0x96A8EC1CB95897A9, 0x012A8E701C1E3E2B,
+					0x62BA280C08551001, 0x05649C2E69E79709, 0x8B158E4A868CDA1E, 0x900E0CB990BF7F21, 0xB79E21E3FB008309, 0x1ED63F4CCB74A469, 0x30990C6115FB677B, 0x9C392D3212D87B20,
+					0x0A57F22ED991B080, 0x3E599ACEC612EFED, 0xEED2ACA01D92C06C, 0x43CE5BD93B4348DC, 0xC2CF401BE87EBE0D, 0xF2B56D8274715876, 0x46583139EE999EA1, 0x2A3241C0C87D2792,
+					0x8905D95108CE3E33, 0xF1A65F45C1CBEF96, 0xDAB519E9935BFA7E, 0x8E9AFF6D04094405, 0x02319BE10E4DB6CE, 0xCAAF5F631EF890E6, 0x70AFA1DA3063C8A6, 0x2911835D27E4BCEF,
+					0x8174CB8C324A4468, 0xA7AC87319C94EE28, 0x92006D199E5EF8DD, 0x9CEF41DCFB0BFC95, 0xE2B213AB8810A65E, 0xC867556F88E58698, 0x343718718A866503, 0xCD7A6BADC2F57845,
+					0x3D696E49202B3AD2, 0x29818BD2121B5AAA, 0x7AF1FC2F4DF49F7D, 0x3A00B5A8AE1BB12D, 0x6C83A7217C81393A, 0x0460323EE1D34C18, 0x948FEFBA83CABFD9, 0x2A91D28BF5EB74B6,
+					0x80DB068531BC5404, 0x8A1D97D131946648, 0xA1FC774592F04D1D, 0x1B4ABCCBE4776311, 0xA23E577CC3741D08, 0x3589A1449D759C10, 0x5E890539B09D29FA, 0xDA0DC87655A71DFF,
+					0xD9D60034D93D2927, 0x3AC8A65C52CE924C, 0xDFAFF47706BF0FEB, 0x99C582B2D9C2DC77, 0x7EC0AB75FDEBEB70, 0xCCC38DC42E9EB7D8, 0x2E58A643446E018C, 0xB21A534CA1D9AF5F,
+					0xD5F2EF81F6FAB6CE, 0x9F4CCDE472CACE64, 0x1FEF932BF1BD05F8, 0x2F50B564A06896E2, 0x83BB6E83A55C890E, 0x041BFBA80F8319AE, 0x474925FD0BA06F78, 0x79F211AB437E01F6,
+					0x8B9A8F86F6D1A4C6, 0xDDFD1A8F1FBBE7FE, 0xA4CA215BC487FA81, 0x8E7DD70D4F9E987C, 0xF871393704D3FEBD, 0x663F9F3DAB6659F7, 0x2CBC5755D0E5DECB, 0x4491DFC8070F2814,
+					0x2264B4C5F444725E, 0x00BCFD1CB71ECC27, 0x3936E25CEA1A3A50, 0x025757D5A519757D, 0x7FCD269C22A6DE3F, 0x0C32A2E24D59922F, 0xE9138634893F89FB, 0x239FB487DD9D1308,
+					0x91DC74F67F40E2EC, 0x1EB1F14885EB5B94, 0x4E2268918B88199E, 0x2C0C2849187F3C3A, 0x0C894A36B3278BE5, 0xED3F01BED7A81248, 0xCF9AE471A7245956, 0x92CCD8860F7A6C2A,
+					0xB3493E8BAD89223B, 0x5D9331B534471C70, 0x8651C06D4B31EA68, 0xB9F05AAC547A3FE4, 0xBDA5B402B80BCB8F, 0xCB67C5A9DC7BAEA3, 0x2810434540F24086, 0x75003673EBB65D03,
+					0x7DD777FFC818D7CD, 0xEAC98177C1F1BE46, 0x1634858C77B72B2C, 0x1D6DA4B8F36573E3, 0xAE22F50AAABAB57A, 0x4BA7705D1ABF254B, 0xC6FE886850C668C4, 0xD3B165CB905BB7BC,
+					0xEFD36B1BECB52127, 0xC880C1A03111FFFA, 0xD4EB624696194528, 0x9FA00FBB7B50D520, 0x56C67A7274F9AEE5, 0xD9D432124E2DFDC8, 0x34DB0C3389AC60BA, 0xD52C1267A18605CD,
+					0x6A2F7830C091DA25, 0x27565042BC457E1C, 0x73E0CEA68C3FB4BA, 0x02877F63863871E1, 0x47E6E43AD0DE5C6F, 0x1C9514BB302ECF5F, 0x8F25D32D4C9DABED, 0xDC5397CB49C6CA69,
+					0xC59B950DE898AD5F, 0x1C37F4469CE64BC9, 0x35BD805AC13C8F1F, 0x7FA44D2791F772B3, 0x1BA0B70BD2114756, 0x7D64DC7D904DB7C7, 0x31D79A3C7346D5B8, 0x1F81CEE1ABEC0F58,
+					0x6493B8810426CD24, 0x6E92B6B809BFCCD9, 0x353C08A6FD86C270, 0x99105026AC653AD7, 0x248DEA84D800E5C2, 0x2FADE70D9379FF57, 0x53C13B4F4FAA1DDC, 0x14A45F483017884E,
+					0xDA05E45FFF0B5A4D, 0x64AAA0E1C85F0056, 0xF84D6117AD955502, 0x29186211914DED91, 0xBBE0CCB8D3A24279, 0x83BAB93287230AF5, 0xAE7FDB15800F42CD, 0xCD1A554E1FC66620,
+					0xFC4F8B3DDF42B947, 0x46A35076FA53D261, 0x3E595A03B7DA1CF6, 0xAC49472A83BB0737, 0xB211919DE07148B8, 0x62D169426C9F3B8B, 0x2AFFDCD626B6B78A, 0x109EAADFBF891A13,
+					0xE15F2D2C6F9EF6FB, 0xA6C3269270552377, 0xB2316E3FDC96B0A7, 0x27540A849EA227E4, 0xF0328A9C8F01B294, 0x17FE5B51399FCA1B, 0x03576BD7B37EA9BB, 0xB43A523AD208C494,
+					0xF7E7FA2AC5DC288A, 0xD4A74210BF70B127, 0x4FA00C005A1212A3, 0xC35FD37132E61376, 0x4E2EAC880CA70993, 0x34C8DD317E16A01B, 0xEBC8871CFE38B991, 0xA98BC2D62DB85992,
+					0x45EA7B9BBD522926, 0xC74EDA81D68D3E5C, 0xE75941D86D66D8A8, 0x8E58CD772121B1FB, 0xB69801E0E99C9CAE, 0xE157713BB67D3F73, 0xC81C81AC3F605EF0, 0x092941199A7E54E6,
+					0xE7879B892B777983, 0x27E942B10F9E4CF0, 0x65055FC87DF51E1C, 0xA20498C08E3018DF, 0x5E1272789D4486B4, 0xF265534D27DE8149, 0xF4AD8735214EECD7, 0x94A24DB5373CC24C,
+					0x548822AA728F7928, 0x0B1E0CB8118DCC3F, 0x41EF497526196E40, 0x9E218D677BD5B8E0, 0xD94CC113513231C9, 0x0F19E2A83CC8BB96, 0x49FF6D48C617E223, 0xD25AA2719A2D9792,
+					0x072A810C364379C3, 0x635D9B310062A16E, 0xA9B07A14AD3F2A57, 0x450506E02D6E8786, 0xFEFCF03AD0E4FA65, 0xA08B3A011E4138C9, 0x6215331C07A25578, 0x68881AAE11EB234D,
+					0xA7EE294A05CC6716, 0xA39C76B852F69111, 0x05B896A424FA6F43, 0xEA0478A211F5F477, 0x6ECFEDE08F141188, 0xF80487E5A3CB309C, 0x57AF53B213DB9289, 0x4033D272BD06A999,
+					0x977643247225E63A, 0x662FF7E2E61D6C0C, 0xD9F9EEFCB89FC468, 0x782F4361D0D45F45, 0x01077948C853DF70, 0xB746EF692D2896A0, 0x7DC05FC4ADB7ABBD, 0xA6C0B01E1D91B48C,
+					0x41DC268D8E61687A, 0x711500721FF70A57, 0x1459BD9EE4FE7CF5, 0xA51BCF3BEDD9877C, 0x74F829FB76F67CA8, 0x05F8A6A0784E1BEA, 0xD18022E28D8F1EAB, 0xBB3EA75CBC1F1195,
+					0x9E6A4BF57DA64143, 0x94735BC82F5300B6, 0xCAC6C683B9258337, 0xC023AEB30F6A73E7, 0x17DC649B9FC5BC3F, 0x2774B0DAE51ED3C5, 0x2E53D6CAD6CB448F, 0xF47A194EFB87E45D,
+					0xE9F38AE5D16A6448, 0x5AA2FAAEFA869B3F, 0x0DDEAF2E67EF4E4F, 0xC9225A8C02A0D051, 0x16A877E5D3C131F9, 0x6B60C462A57DE5DB, 0x20D8BFE299D29300, 0xDF6FDC4212C994DE,
+					0x32831E61BB0081A3, 0x259D750F70F6E7E4, 0xD1A6BFD11ED6B03A, 0xDB3FB540AA438075, 0x52799D843745D52C, 0x143AF71D19311AD1, 0x3067F9AFE5E61C12, 0xE91758467DC51734,
+					0xD7744B888D495496, 0x6730FDD42C5A3F3B, 0x9822507AC2766DA7, 0x6983C75C1ED4B042, 0xCB7B329E04C0F943, 0xA428A1896261DDF0, 0xDBF8D1E8077F25C4, 0xAB08DD7C69349A4C,
+					0xF3CFA4E9CABD5ED1, 0x6C56DAE0350C6D76, 0x6E596CE4C8B0237B, 0x34F38CF4FCEEF860, 0x9FA1D5CDD41C7665, 0x79F66C86C26F0A29, 0x78EA2D94A2900C28, 0x9CFE642A619DE101,
+					0xB0779A7B5EC93F0C, 0x7A69B6D85B247559, 0x53F02835CCBF46CA, 0x9BEBFD7A73CA886C, 0x5A61B659F9EDCA47, 0x9088E98F8557820E, 0xCEF448566DE78151, 0x84E8447EBCF729A5,
+					0x91EA3378AB7A6928, 0x4B8582D6C5E3A7E8, 0x7D701EB8D904245D, 0x282894487699B603, 0x7A60F5BF911D0374, 0x7854321EA77D00C6, 0x3FBDB418422C2513, 0x818814760F5D4CBB,
+					0x914BA544203A8EFC, 0x7D7A1D8155F1D0CE, 0x9428B5EF7C5D4D6D, 0xA09A6F48D1A7BCE0, 0xC01B474D221E13AD, 0x1AA1D3581074C460, 0x419B63D0FF07FD79, 0x1D999546673CE391,
+					0xC61113C5B61C0DD1, 0xEF6A778D0AE9D45B, 0xC840756D27DDEDF1, 0xB21CEDA404E4FABE, 0xCF3DB5B93A7EB6BA, 0x2B5D5F32094F0F69, 0xDDC95E871771BC25, 0x1EF8566A021A2924,
+					0x73E7E570970E0224, 0x2802EB3570F41037, 0x9BE607448A908C92, 0x422F94D92717C167, 0xF76B8CBEC6591597, 0xD441F9EE7F9E460F, 0xF84D292CFA1590D5, 0x69454650BC5EF2DC,
+					0x5C7D897030EE6F9C, 0x8986A6CDBA78C3BF, 0x6314127AC447436C, 0x8EC57E925433A02F, 0x19DDCD6313A08E38, 0x01793E96A08E098B, 0x7C708AF76E732AFC, 0x0F46E2E6021849CC,
+					0xA3F9D76D86F715DB, 0x77ED32F000E83B79, 0xDECD07A9C486703C, 0x597DA6DAF40B17DE, 0xFC4400728C2B3F20, 0x1E14F9C0063C0A53, 0x447948E122B7EA56, 0xA12E8901F8999C74,
+					0x5FAA0CA54AD0737A, 0x662B12A5CD38706C, 0xBB627E11B85A0FFE, 0x6A1FADA129BDFC64, 0xCC7B448CF604F4C2, 0x3D70F8A82C7F1AA2, 0xCEC9EFDFBE319A52, 0x9BFE717D1272C23A,
+					0xD5C9265EB4C1BCB3, 0x81385A5ADA493455, 0x3F42A1AD553A2449, 0x4E26FB74B8354744, 0x489D4708A7143F8E, 0x287AFF2F69A80690, 0x255CBAF6171AE3EC, 0x51EAA3BA437B89B0,
+					0x3D6AE72D3E5EE618, 0x0000002A25B7F55A
+				};
+				return table;
+			}
+			//表の[pos, pos + count)のビット(count < 64)
+			static uint32_t _bits_(size_t pos, size_t count) {
+				const uint64_t* p = _table_();
+				size_t i = pos / 64, r = pos % 64;
+				uint64_t result = p[i] >> r;
+				if (r + count > 64) result |= p[i + 1] << (64 - r);
+				return uint32_t(result & ((uint64_t(1) << count) - 1));
+			}
+		};
+	}
+}
+
+#endif
\ No newline at end of file
@@ -4,12 +4,283 @@
 #include "IMathLib/math/math.hpp"
 #include "IMathLib/utility/algorithm.hpp"
 #include "IMathLib/math//random.hpp"
+#include "IMathLib/math/multi/limb.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
 
 //統計演算関係
 
 namespace iml {
 	namespace stats {
 
+		//1パスで併合可能な統計量の累積
+		//要素ごとの更新はWelford(Terriberryによる高次モーメントへの拡張), 累積同士の併合はChanら(Pébayによる高次モーメントへの拡張)の公式による
+		//float/doubleの連続領域は一定長のブロックごとにSIMDで平均と中心モーメントを求めてから併合する(ブロックはキャッシュ上にあるため, メモリの読み出しは1回)
+
+		//個数, 平均, 2~4次の中心モーメントの和, 最小値, 最大値
+		template <class T>
+		class moment_accumulator {
+			uint64_t	n;
+			T			mean_m;
+			T			m2, m3, m4;			//Σ(x - mean)^k
+			T			min_m, max_m;
+		public:
+			moment_accumulator() :n(0), mean_m(0), m2(0), m3(0), m4(0), min_m(0), max_m(0) {}
+			moment_accumulator(uint64_t n, const T& mean, const T& m2, const T& m3, const T& m4, const T& mn, const T& mx)
+				: n(n), mean_m(mean), m2(m2), m3(m3), m4(m4), min_m(mn), max_m(mx) {}
+
+			void clear() { *this = moment_accumulator(); }
+
+			//要素の追加
+			void push(const T& x) {
+				if (n == 0) min_m = max_m = x;
+				else {
+					if (x < min_m) min_m = x;
+					if (max_m < x) max_m = x;
+				}
+				T n1 = T(n++), nn = T(n);
+				T d = x - mean_m, dn = d / nn, dn2 = dn * dn, t = d * dn * n1;
+				mean_m += dn;
+				m4 += t * dn2 * (nn * nn - 3 * nn + 3) + 6 * dn2 * m2 - 4 * dn * m3;
+				m3 += t * dn * (nn - 2) - 3 * dn * m2;
+				m2 += t;
+			}
+			template <class InputIterator>
+			void push(InputIterator first, InputIterator last);
+
+			//別の累積との併合
+			void merge(const moment_accumulator& x) {
+				if (x.n == 0) return;
+				if (n == 0) { *this = x; return; }
+				T na = T(n), nb = T(x.n), nn = na + nb;
+				T d = x.mean_m - mean_m, d2 = d * d, nab = na * nb;
+				T r4 = m4 + x.m4 + d2 * d2 * nab * (na * na - nab + nb * nb) / (nn * nn * nn)
+					+ 6 * d2 * (na * na * x.m2 + nb * nb * m2) / (nn * nn) + 4 * d * (na * x.m3 - nb * m3) / nn;
+				T r3 = m3 + x.m3 + d * d2 * nab * (na - nb) / (nn * nn) + 3 * d * (na * x.m2 - nb * m2) / nn;
+				m2 += x.m2 + d2 * nab / nn;
+				m3 = r3;
+				m4 = r4;
+				mean_m += d * nb / nn;
+				if (x.min_m < min_m) min_m = x.min_m;
+				if (max_m < x.max_m) max_m = x.max_m;
+				n += x.n;
+			}
+			moment_accumulator& operator+=(const moment_accumulator& x) { merge(x); return *this; }
+
+			uint64_t count() const { return n; }
+			T sum() const { return mean_m * T(n); }
+			T mean() const { return mean_m; }
+			//分散(nで割ったもの)と不偏分散
+			T variance() const { return (n == 0) ? T(0) : m2 / T(n); }
+			T sample_variance() const { return (n < 2) ? T(0) : m2 / T(n - 1); }
+			T standard_deviation() const { return sqrt(variance()); }
+			//歪度と尖度(正規分布で0となる超過尖度)
+			T skewness() const { return (m2 == 0) ? T(0) : sqrt(T(n)) * m3 / (m2 * sqrt(m2)); }
+			T kurtosis() const { return (m2 == 0) ? T(0) : T(n) * m4 / (m2 * m2) - 3; }
+			T (min)() const { return min_m; }
+			T (max)() const { return max_m; }
+		};
+
+		//2変量の個数, 平均, 偏差平方和と偏差積和
+		template <class T>
+		class covariance_accumulator {
+			uint64_t	n;
+			T			mean_xm, mean_ym;
+			T			m2x, m2y, cxy;
+		public:
+			covariance_accumulator() :n(0), mean_xm(0), mean_ym(0), m2x(0), m2y(0), cxy(0) {}
+			covariance_accumulator(uint64_t n, const T& mx, const T& my, const T& m2x, const T& m2y, const T& cxy)
+				: n(n), mean_xm(mx), mean_ym(my), m2x(m2x), m2y(m2y), cxy(cxy) {}
+
+			void clear() { *this = covariance_accumulator(); }
+
+			void push(const T& x, const T& y) {
+				T nn = T(++n);
+				T dx = x - mean_xm, dy = y - mean_ym;
+				mean_xm += dx / nn;
+				mean_ym += dy / nn;
+				m2x += dx * (x - mean_xm);
+				m2y += dy * (y - mean_ym);
+				cxy += dx * (y - mean_ym);
+			}
+			template <class InputIterator1, class InputIterator2>
+			void push(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2);
+
+			void merge(const covariance_accumulator& x) {
+				if (x.n == 0) return;
+				if (n == 0) { *this = x; return; }
+				T na = T(n), nb = T(x.n), nn = na + nb;
+				T dx = x.mean_xm - mean_xm, dy = x.mean_ym - mean_ym, w = na * nb / nn;
+				m2x += x.m2x + dx * dx * w;
+				m2y += x.m2y + dy * dy * w;
+				cxy += x.cxy + dx * dy * w;
+				mean_xm += dx * nb / nn;
+				mean_ym += dy * nb / nn;
+				n += x.n;
+			}
+			covariance_accumulator& operator+=(const covariance_accumulator& x) { merge(x); return *this; }
+
+			uint64_t count() const { return n; }
+			T mean_x() const { return mean_xm; }
+			T mean_y() const { return mean_ym; }
+			T variance_x() const { return (n == 0) ? T(0) : m2x / T(n); }
+			T variance_y() const { return (n == 0) ? T(0) : m2y / T(n); }
+			//共分散(nで割ったもの)と不偏共分散
+			T covariance() const { return (n == 0) ? T(0) : cxy / T(n); }
+			T sample_covariance() const { return (n < 2) ? T(0) : cxy / T(n - 1); }
+			//相関係数
+			T correlation() const { return (m2x == 0 || m2y == 0) ? T(0) : cxy / sqrt(m2x * m2y); }
+		};
+
+		//配列の累積(一般のイテレータは1要素ずつ)
+		template <class T, class InputIterator>
+		struct Moment_kernel {
+			static void _push_(moment_accumulator<T>& acc, InputIterator first, InputIterator last) {
+				for (; first != last; ++first) acc.push(T(*first));
+			}
+			template <class InputIterator2>
+			static void _push_(covariance_accumulator<T>& acc, InputIterator first, InputIterator last, InputIterator2 first2) {
+				for (; first != last; ++first, ++first2) acc.push(T(*first), T(*first2));
+			}
+		};
+		//float/doubleの連続領域
+		template <class T>
+		struct Moment_array_kernel {
+			using pack_type = simd::native_pack_t<T>;
+			static constexpr size_t block = 1024;
+
+			//packの要素の総和
+			static T _sum_(const pack_type& x) {
+				T buf[pack_type::size], s = 0;
+				x.store(buf);
+				for (size_t i = 0; i < pack_type::size; ++i) s += buf[i];
+				return s;
+			}
+			//1ブロック(0 < k <= block)の平均と中心モーメント
+			static moment_accumulator<T> _block_(const T* x, size_t k) {
+				const size_t w = pack_type::size;
+				pack_type s(T(0)), lo(x[0]), hi(x[0]);
+				size_t i = 0;
+				for (; i + w <= k; i += w) {
+					pack_type v = pack_type::load(x + i);
+					s += v;
+					lo = simd::select(v < lo, v, lo);
+					hi = simd::select(hi < v, v, hi);
+				}
+				T buf_lo[pack_type::size], buf_hi[pack_type::size], mn = x[0], mx = x[0], sum = _sum_(s);
+				lo.store(buf_lo);
+				hi.store(buf_hi);
+				for (size_t j = 0; j < w; ++j) {
+					if (buf_lo[j] < mn) mn = buf_lo[j];
+					if (mx < buf_hi[j]) mx = buf_hi[j];
+				}
+				for (; i < k; ++i) {
+					sum += x[i];
+					if (x[i] < mn) mn = x[i];
+					if (mx < x[i]) mx = x[i];
+				}
+				const T mean = sum / T(k);
+
+				pack_type m(mean), p1(T(0)), p2(T(0)), p3(T(0)), p4(T(0));
+				for (i = 0; i + w <= k; i += w) {
+					pack_type d = pack_type::load(x + i) - m, d2 = d * d;
+					p1 += d;
+					p2 += d2;
+					p3 += d2 * d;
+					p4 += d2 * d2;
+				}
+				T s1 = _sum_(p1), s2 = _sum_(p2), s3 = _sum_(p3), s4 = _sum_(p4);
+				for (; i < k; ++i) {
+					T d = x[i] - mean, d2 = d * d;
+					s1 += d; s2 += d2; s3 += d2 * d; s4 += d2 * d2;
+				}
+				//平均の丸め誤差(Σd != 0)の補正
+				T c = s1 / T(k);
+				T m2 = s2 - s1 * c;
+				T m3 = s3 - 3 * c * s2 + 2 * c * c * s1;
+				T m4 = s4 - 4 * c * s3 + 6 * c * c * s2 - 3 * c * c * c * s1;
+				return moment_accumulator<T>(k, mean + c, m2, m3, m4, mn, mx);
+			}
+			static void _push_(moment_accumulator<T>& acc, const T* first, const T* last) {
+				while (first != last) {
+					size_t k = (size_t(last - first) < block) ? size_t(last - first) : block;
+					acc.merge(_block_(first, k));
+					first += k;
+				}
+			}
+
+			//2変量の1ブロック
+			static covariance_accumulator<T> _block_(const T* x, const T* y, size_t k) {
+				const size_t w = pack_type::size;
+				pack_type sx(T(0)), sy(T(0));
+				size_t i = 0;
+				for (; i + w <= k; i += w) {
+					sx += pack_type::load(x + i);
+					sy += pack_type::load(y + i);
+				}
+				T mx = _sum_(sx), my = _sum_(sy);
+				for (; i < k; ++i) { mx += x[i]; my += y[i]; }
+				mx /= T(k);
+				my /= T(k);
+
+				pack_type px(mx), py(my), p1x(T(0)), p1y(T(0)), pxx(T(0)), pyy(T(0)), pxy(T(0));
+				for (i = 0; i + w <= k; i += w) {
+					pack_type dx = pack_type::load(x + i) - px, dy = pack_type::load(y + i) - py;
+					p1x += dx; p1y += dy;
+					pxx += dx * dx; pyy += dy * dy; pxy += dx * dy;
+				}
+				T s1x = _sum_(p1x), s1y = _sum_(p1y), sxx = _sum_(pxx), syy = _sum_(pyy), sxy = _sum_(pxy);
+				for (; i < k; ++i) {
+					T dx = x[i] - mx, dy = y[i] - my;
+					s1x += dx; s1y += dy;
+					sxx += dx * dx; syy += dy * dy; sxy += dx * dy;
+				}
+				T cx = s1x / T(k), cy = s1y / T(k);
+				return covariance_accumulator<T>(k, mx + cx, my + cy, sxx - s1x * cx, syy - s1y * cy, sxy - s1x * cy);
+			}
+			static void _push_(covariance_accumulator<T>& acc, const T* first, const T* last, const T* first2) {
+				while (first != last) {
+					size_t k = (size_t(last - first) < block) ? size_t(last - first) : block;
+					acc.merge(_block_(first, first2, k));
+					first += k;
+					first2 += k;
+				}
+			}
+			//2つ目の引数が連続領域でないとき
+			template <class InputIterator2>
+			static void _push_(covariance_accumulator<T>& acc, const T* first, const T* last, InputIterator2 first2) {
+				for (; first != last; ++first, ++first2) acc.push(*first, T(*first2));
+			}
+			template <class InputIterator2>
+			static void _push_(covariance_accumulator<T>& acc, T* first, T* last, InputIterator2 first2) {
+				_push_(acc, static_cast<const T*>(first), static_cast<const T*>(last), first2);
+			}
+			static void _push_(covariance_accumulator<T>& acc, const T* first, const T* last, T* first2) {
+				_push_(acc, first, last, static_cast<const T*>(first2));
+			}
+		};
+		template <>
+		struct Moment_kernel<double, double*> : Moment_array_kernel<double> {};
+		template <>
+		struct Moment_kernel<double, const double*> : Moment_array_kernel<double> {};
+		template <>
+		struct Moment_kernel<float, float*> : Moment_array_kernel<float> {};
+		template <>
+		struct Moment_kernel<float, const float*> : Moment_array_kernel<float> {};
+
+		template <class T>
+		template <class InputIterator>
+		inline void moment_accumulator<T>::push(InputIterator first, InputIterator last) {
+			Moment_kernel<T, InputIterator>::_push_(*this, first, last);
+		}
+		template <class T>
+		template <class InputIterator1, class InputIterator2>
+		inline void covariance_accumulator<T>::push(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2) {
+			Moment_kernel<T, InputIterator1>::_push_(*this, first1, last1, first2);
+		}
+
+
 		//統計演算の定義(データの順序が保証されない)
 		template <class BidirectionalIterator>
 		struct statistice_function {
@@ -231,15 +502,15 @@ namespace iml {
 			//標本分散(可変長要素)
 			template <class... Args>
 			static value_type __variance(const value_type& first, Args... args) {
-				return __average(pow(first, 2), pow(iml::forward<Args>(args), 2)...) - pow(__average(first, iml::forward<Args>(args)...), 2);
+				value_type temp[sizeof...(Args)+1] = { first,static_cast<value_type>(args)... };
+				return statistice_function<value_type*>::__variance(temp, &temp[sizeof...(Args)+1]);
 			}
 			//標本分散(ポインタ)
 			static value_type __variance(iterator first, iterator last) {
-				//2乗テーブルの作成
-				iterator temp = new value_type[last - first];
-				for (iterator i = first, *j = temp; i != last; ++i, ++j)
-					*j = (*i)*(*i);
-				return __average(temp, &temp[last - first]) - pow(__average(first, last), 2);
+				//1パスの累積(Welfordの方法)
+				moment_accumulator<math_function_type_t<value_type>> acc;
+				acc.push(first, last);
+				return static_cast<value_type>(acc.variance());
 			}
 
 			//標準偏差(可変長要素)
@@ -355,6 +626,340 @@ namespace iml {
 			return statistice_function<BidirectionalIterator>::__normalization(first, last);
 		}
 
+		//正規分布の確率密度関数
+		template <class T>
+		inline auto normal_pdf(const T& x, const T& mu = 0, const T& sigma = 1) {
+			using result_type = typename math_function_type<T>::type;
+			result_type z = (result_type(x) - mu) / sigma;
+			return exp(-z * z / 2) / (sigma * sqrt(2 * pi<result_type>));
+		}
+		//標準正規分布の累積分布関数と分位関数
+		template <class T>
+		struct Normal_distribution_function {
+			using result_type = typename math_function_type<T>::type;
+
+			//Φ(z) = erfc(-z/√2)/2
+			static constexpr result_type _cdf_(const result_type& z, false_type) { return erfc(-z / sqrt(result_type(2))) / 2; }
+			//実行時は誤差関数のカーネルで計算(下側の裾でも相対精度を保つ)
+			static constexpr result_type _cdf_(const result_type& z, true_type) {
+				return IMATH_IS_CONSTANT_EVALUATED() ? _cdf_(z, false_type()) : Erf_kernel<result_type>::_normal_cdf_(z);
+			}
+			static constexpr result_type _cdf_(const result_type& z) { return _cdf_(z, is_elementary_kernel_type<result_type>()); }
+
+			//Φ^-1(p) = -√2 erfcinv(2p)
+			static constexpr result_type _quantile_(const result_type& p, false_type) { return -sqrt(result_type(2)) * erfcinv(2 * p); }
+			static constexpr result_type _quantile_(const result_type& p, true_type) {
+				return IMATH_IS_CONSTANT_EVALUATED() ? _quantile_(p, false_type()) : Erf_kernel<result_type>::_normal_quantile_(p);
+			}
+			static constexpr result_type _quantile_(const result_type& p) { return _quantile_(p, is_elementary_kernel_type<result_type>()); }
+		};
+		//正規分布の累積分布関数
+		template <class T>
+		inline auto normal_cdf(const T& x, const T& mu = 0, const T& sigma = 1) {
+			using result_type = typename math_function_type<T>::type;
+			return Normal_distribution_function<T>::_cdf_((result_type(x) - mu) / sigma);
+		}
+		//正規分布の相補累積分布関数(1 - normal_cdfの桁落ちを避ける)
+		template <class T>
+		inline auto normal_ccdf(const T& x, const T& mu = 0, const T& sigma = 1) {
+			using result_type = typename math_function_type<T>::type;
+			return Normal_distribution_function<T>::_cdf_((result_type(mu) - x) / sigma);
+		}
+		//正規分布の分位関数
+		template <class T>
+		inline auto normal_quantile(const T& p, const T& mu = 0, const T& sigma = 1) {
+			return mu + sigma * Normal_distribution_function<T>::_quantile_(p);
+		}
+
+		//配列に対する標準正規分布の累積分布関数と分位関数
+		struct normal_cdf_function {
+			template <class P>
+			P operator()(const P& x) const { return simd::Erf_kernel_impl<typename P::value_type>::_normal_cdf_(x); }
+			template <class T>
+			auto generic(const T& x) const { return normal_cdf(x); }
+		};
+		struct normal_quantile_function {
+			template <class P>
+			P operator()(const P& p) const { return simd::Erf_kernel_impl<typename P::value_type>::_normal_quantile_(p); }
+			template <class T>
+			auto generic(const T& p) const { return normal_quantile(p); }
+		};
+		template <class InputIterator, class OutputIterator>
+		inline OutputIterator vnormal_cdf(InputIterator first, InputIterator last, OutputIterator result) {
+			return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, normal_cdf_function());
+		}
+		template <class InputIterator, class OutputIterator>
+		inline OutputIterator vnormal_quantile(InputIterator first, InputIterator last, OutputIterator result) {
+			return Vectorized_function<InputIterator, OutputIterator>::_apply_(first, last, result, normal_quantile_function());
+		}
+
+	}
+
+	//Ziggurat法
+	namespace stats {
+
+		//Ziggurat法の表(256層で, x[0]は底の層の等価な幅, x[1]は裾の開始点, x[256] = 0)
+		struct ziggurat_table {
+			double	x[257];
+			double	f[257];			//f(x[i])
+		};
+		//単調減少な密度関数fに対する表の作成(vは各層の面積)
+		template <class Density>
+		inline ziggurat_table __make_ziggurat_table() {
+			ziggurat_table t;
+			t.x[1] = Density::r;
+			t.f[1] = Density::_f_(Density::r);
+			t.x[0] = Density::v / t.f[1];
+			t.f[0] = 0;
+			for (size_t i = 1; i < 255; ++i) {
+				double y = t.f[i] + Density::v / t.x[i];
+				t.f[i + 1] = (y < 1) ? y : 1;
+				t.x[i + 1] = Density::_finv_(t.f[i + 1]);
+			}
+			t.x[256] = 0;
+			t.f[256] = 1;
+			return t;
+		}
+
+		//正規分布の右半分(f(x) = exp(-x^2/2), Marsaglia and Tsang 2000)
+		struct Ziggurat_normal_density {
+			static constexpr double r = 3.6541528853610088;
+			static constexpr double v = 4.92867323399e-3;
+			static double _f_(double x) { return exp(-x * x / 2); }
+			static double _finv_(double y) { return sqrt(-2 * log(y)); }
+			//x > rの裾(Marsagliaの方法)
+			template <class Engine, class UInt>
+			static double _tail_(rnd::random_base<Engine, UInt>* handle) {
+				double a, b;
+				do {
+					a = -log(1 - handle->template unit<double>()) / r;
+					b = -log(1 - handle->template unit<double>());
+				} while (2 * b < a * a);
+				return r + a;
+			}
+		};
+		//指数分布(f(x) = exp(-x))
+		struct Ziggurat_exponential_density {
+			static constexpr double r = 7.69711747013104972;
+			static constexpr double v = 3.9496598225815571993e-3;
+			static double _f_(double x) { return exp(-x); }
+			static double _finv_(double y) { return -log(y); }
+			//無記憶性より x > rの裾はr + Exp(1)
+			template <class Engine, class UInt>
+			static double _tail_(rnd::random_base<Engine, UInt>* handle) {
+				return r - log(1 - handle->template unit<double>());
+			}
+		};
+
+		//Ziggurat法による非負の標本
+		//64ビットの乱数のうち下位8ビットで層を, 上位53ビットで層内の位置を選び, 大半は表の参照と乗算1回で決まる
+		template <class Density>
+		struct Ziggurat_kernel {
+			static const ziggurat_table& _table_() {
+				static const ziggurat_table t = __make_ziggurat_table<Density>();
+				return t;
+			}
+			template <class Engine, class UInt>
+			static double _sample_(rnd::random_base<Engine, UInt>* handle, uint64_t bits) {
+				const ziggurat_table& t = _table_();
+				while (true) {
+					size_t i = size_t(bits & 0xFF);
+					double z = double(bits >> 11) * rnd::__random_pow2(-53) * t.x[i];
+					//長方形の内側
+					if (z < t.x[i + 1]) return z;
+					//底の層の裾
+					if (i == 0) return Density::_tail_(handle);
+					//楔の部分は棄却法
+					if (t.f[i] + handle->template unit<double>() * (t.f[i + 1] - t.f[i]) < Density::_f_(z)) return z;
+					bits = handle->bits64();
+				}
+			}
+			template <class Engine, class UInt>
+			static double _sample_(rnd::random_base<Engine, UInt>* handle) { return _sample_(handle, handle->bits64()); }
+			//符号付きの標本(符号はビット8を用いる)
+			template <class Engine, class UInt>
+			static double _symmetric_sample_(rnd::random_base<Engine, UInt>* handle, uint64_t bits) {
+				double z = _sample_(handle, bits);
+				return ((bits >> 8) & 1) ? -z : z;
+			}
+			template <class Engine, class UInt>
+			static double _symmetric_sample_(rnd::random_base<Engine, UInt>* handle) { return _symmetric_sample_(handle, handle->bits64()); }
+
+			//[first, last)にshift + scale*zを一括生成(乱数のビット列をまとめて生成してから変換する)
+			template <bool Symmetric, class Engine, class UInt, class OutputIterator, class T>
+			static void _fill_(rnd::random_base<Engine, UInt>* handle, OutputIterator first, OutputIterator last, const T& scale, const T& shift) {
+				uint64_t buf[256];
+				while (first != last) {
+					size_t n = 0;
+					for (OutputIterator itr = first; n < 256 && itr != last; ++itr) ++n;
+					handle->fill_bits64(buf, buf + n);
+					for (size_t i = 0; i < n; ++i, ++first)
+						*first = shift + scale * T(Symmetric ? _symmetric_sample_(handle, buf[i]) : _sample_(handle, buf[i]));
+				}
+			}
+		};
+	}
+
+	//変換棄却法(Hörmann 1993)とMarsaglia-Tsang法
+	namespace stats {
+
+		//二項分布(Hörmann 1993のBTRS, n*min(p, 1 - p) < 10では逆関数法)
+		template <class IntT, class FloatT>
+		struct Binomial_variate_kernel {
+			//逆関数法とBTRSを切り替えるn*pの閾値
+			static constexpr FloatT threshold = 10;
+
+			//p <= 1/2での定数
+			struct param_type {
+				IntT	n;
+				FloatT	p, q;
+				FloatT	r, s, t;					//逆関数法: r = q^n, s = p/q, t = (n + 1)s
+				FloatT	a, b, c, alpha, vr, lpq, h;	//BTRS
+				IntT	m;
+
+				param_type() {}
+				param_type(IntT n, FloatT p) : n(n), p(p), q(1 - p) {
+					if (FloatT(n) * p < threshold) {
+						r = pow(q, FloatT(n));
+						s = p / q;
+						t = FloatT(n + 1) * s;
+						return;
+					}
+					FloatT spq = sqrt(FloatT(n) * p * q);
+					b = FloatT(1.15) + FloatT(2.53) * spq;
+					a = FloatT(-0.0873) + FloatT(0.0248) * b + FloatT(0.01) * p;
+					c = FloatT(n) * p + FloatT(0.5);
+					alpha = (FloatT(2.83) + FloatT(5.1) / b) * spq;
+					vr = FloatT(0.92) - FloatT(4.2) / b;
+					lpq = log(p / q);
+					m = IntT(floor(FloatT(n + 1) * p));
+					h = log_fact<FloatT>(size_t(m)) + log_fact<FloatT>(size_t(n - m));
+				}
+			};
+
+			//逆関数法(期待計算量O(np))
+			template <class Engine, class UInt>
+			static IntT _inversion_(rnd::random_base<Engine, UInt>* handle, const param_type& prm) {
+				while (true) {
+					FloatT u = handle->template unit<FloatT>(), r = prm.r;
+					IntT k = 0;
+					while (u > r) {
+						u -= r;
+						if (++k > prm.n) break;
+						r *= prm.t / FloatT(k) - prm.s;
+					}
+					if (k <= prm.n) return k;
+				}
+			}
+			//BTRS(期待計算量O(1))
+			template <class Engine, class UInt>
+			static IntT _btrs_(rnd::random_base<Engine, UInt>* handle, const param_type& prm) {
+				while (true) {
+					FloatT u = handle->template unit<FloatT>() - FloatT(0.5);
+					FloatT v = handle->template unit<FloatT>();
+					FloatT us = FloatT(0.5) - abs(u);
+					FloatT kf = floor((2 * prm.a / us + prm.b) * u + prm.c);
+					if (kf < 0 || kf > FloatT(prm.n)) continue;
+					IntT k = IntT(kf);
+					//棄却されない領域
+					if (us >= FloatT(0.07) && v <= prm.vr) return k;
+					v = log(v * prm.alpha / (prm.a / (us * us) + prm.b));
+					if (v <= prm.h - log_fact<FloatT>(size_t(k)) - log_fact<FloatT>(size_t(prm.n - k)) + FloatT(k - prm.m) * prm.lpq) return k;
+				}
+			}
+			template <class Engine, class UInt>
+			static IntT _sample_(rnd::random_base<Engine, UInt>* handle, const param_type& prm) {
+				return (FloatT(prm.n) * prm.p < threshold) ? _inversion_(handle, prm) : _btrs_(handle, prm);
+			}
+		};
+
+		//ポアソン分布(Hörmann 1993のPTRS, λ < 10では一様乱数の積による方法)
+		template <class IntT, class FloatT>
+		struct Poisson_variate_kernel {
+			static constexpr FloatT threshold = 10;
+
+			struct param_type {
+				FloatT	lambda;
+				FloatT	exp_lambda;										//乗算法: e^-λ
+				FloatT	log_lambda, a, b, log_inv_alpha, vr;			//PTRS
+
+				param_type() {}
+				param_type(FloatT l) : lambda(l) {
+					if (lambda < threshold) {
+						exp_lambda = exp(-lambda);
+						return;
+					}
+					log_lambda = log(lambda);
+					b = FloatT(0.931) + FloatT(2.53) * sqrt(lambda);
+					a = FloatT(-0.059) + FloatT(0.02483) * b;
+					log_inv_alpha = log(FloatT(1.1239) + FloatT(1.1328) / (b - FloatT(3.4)));
+					vr = FloatT(0.9277) - FloatT(3.6224) / (b - 2);
+				}
+			};
+
+			//一様乱数の積がe^-λを下回るまでの回数(期待計算量O(λ))
+			template <class Engine, class UInt>
+			static IntT _multiplication_(rnd::random_base<Engine, UInt>* handle, const param_type& prm) {
+				IntT k = 0;
+				FloatT x = handle->template unit<FloatT>();
+				while (x >= prm.exp_lambda) {
+					x *= handle->template unit<FloatT>();
+					++k;
+				}
+				return k;
+			}
+			//PTRS(期待計算量O(1))
+			template <class Engine, class UInt>
+			static IntT _ptrs_(rnd::random_base<Engine, UInt>* handle, const param_type& prm) {
+				while (true) {
+					FloatT u = handle->template unit<FloatT>() - FloatT(0.5);
+					FloatT v = handle->template unit<FloatT>();
+					FloatT us = FloatT(0.5) - abs(u);
+					FloatT kf = floor((2 * prm.a / us + prm.b) * u + prm.lambda + FloatT(0.43));
+					//棄却されない領域
+					if (us >= FloatT(0.07) && v <= prm.vr) return IntT(kf);
+					if (kf < 0 || (us < FloatT(0.013) && v > us)) continue;
+					IntT k = IntT(kf);
+					if (log(v) + prm.log_inv_alpha - log(prm.a / (us * us) + prm.b) <= -prm.lambda + kf * prm.log_lambda - log_fact<FloatT>(size_t(k))) return k;
+				}
+			}
+			template <class Engine, class UInt>
+			static IntT _sample_(rnd::random_base<Engine, UInt>* handle, const param_type& prm) {
+				return (prm.lambda < threshold) ? _multiplication_(handle, prm) : _ptrs_(handle, prm);
+			}
+		};
+
+		//尺度1のガンマ分布(Marsaglia and Tsang 2000, 形状母数が1未満ではGamma(a + 1)U^(1/a)とする)
+		template <class FloatT>
+		struct Gamma_variate_kernel {
+			struct param_type {
+				FloatT	shape;
+				FloatT	d, c;				//d = a - 1/3, c = 1/√(9d) (a < 1ではa + 1)
+
+				param_type() {}
+				param_type(FloatT a) : shape(a), d(((a < 1) ? a + 1 : a) - FloatT(1) / 3), c(1 / sqrt(9 * d)) {}
+			};
+
+			template <class Engine, class UInt>
+			static FloatT _sample_(rnd::random_base<Engine, UInt>* handle, const param_type& prm) {
+				FloatT x, v, u;
+				while (true) {
+					do {
+						x = FloatT(Ziggurat_kernel<Ziggurat_normal_density>::_symmetric_sample_(handle));
+						v = 1 + prm.c * x;
+					} while (v <= 0);
+					v = v * v * v;
+					u = 1 - handle->template unit<FloatT>();
+					x *= x;
+					//スクイーズ
+					if (u < 1 - FloatT(0.0331) * x * x) break;
+					if (log(u) < x / 2 + prm.d * (1 - v + log(v))) break;
+				}
+				if (prm.shape >= 1) return prm.d * v;
+				//アンダーフローを避けるため対数で計算する
+				return prm.d * v * exp(log(1 - handle->template unit<FloatT>()) / prm.shape);
+			}
+		};
 	}
 
 	//ベルヌーイ分布
@@ -374,11 +979,11 @@ namespace iml {
 			void reset(type a, type b) { range[0] = a; range[1] = b; }
 
 			//一様分布な疑似乱数の取得
-			template <class S>
-			type get(rnd::random_base<S>* handle) { return (*this)(handle); }
-			template <class S>
-			type operator()(rnd::random_base<S>* handle) {
-				return range[0] + (range[1] - range[0])*handle->unit<type>();
+			template <class Engine, class UInt>
+			type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+			template <class Engine, class UInt>
+			type operator()(rnd::random_base<Engine, UInt>* handle) {
+				return range[0] + (range[1] - range[0])*handle->template unit<type>();
 			}
 		};
 
@@ -392,23 +997,24 @@ namespace iml {
 				using n_type = IntT;			//試行回数をあらわす型
 				using p_type = FloatT;			//確率をあらわす型
 			private:
+				using kernel = Binomial_variate_kernel<IntT, FloatT>;
+
 				n_type	n;
 				p_type	p;
+				typename kernel::param_type	prm;			//min(p, 1 - p)に対する定数
 			public:
-				constexpr binomial_distribution() :n(1), p(1) {}
-				constexpr binomial_distribution(n_type n, p_type p) : n(n), p(p) {}
-
-				void reset(n_type n, p_type p) { this->n = n; this->p = p; }
-
-				//二項分布な疑似乱数の取得
-				template <class S>
-				n_type get(rnd::random_base<S>* handle) { return (*this)(handle); }
-				template <class S>
-				n_type operator()(rnd::random_base<S>* handle) {
-					n_type result = 0;
-					for (size_t i = 0; i < n; ++i)
-						result += (handle->unit<p_type>() <= p);
-					return result;
+				binomial_distribution() :n(1), p(1), prm(1, 0) {}
+				binomial_distribution(n_type n, p_type p) : n(n), p(p), prm(n, (p > p_type(0.5)) ? 1 - p : p) {}
+
+				void reset(n_type n, p_type p) { this->n = n; this->p = p; prm = typename kernel::param_type(n, (p > p_type(0.5)) ? 1 - p : p); }
+
+				//二項分布な疑似乱数の取得(np < 10では逆関数法, それ以外はBTRS)
+				template <class Engine, class UInt>
+				n_type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				n_type operator()(rnd::random_base<Engine, UInt>* handle) {
+					n_type k = kernel::_sample_(handle, prm);
+					return (p > p_type(0.5)) ? n - k : k;
 				}
 			};
 		}
@@ -423,26 +1029,22 @@ namespace iml {
 				using n_type = IntT;			//試行回数をあらわす型
 				using p_type = FloatT;			//確率をあらわす型
 			private:
+				using kernel = Poisson_variate_kernel<IntT, FloatT>;
+
 				p_type	lambda;
+				typename kernel::param_type	prm;
 			public:
-				constexpr poisson_distribution() :lambda(1) {}
-				constexpr poisson_distribution(p_type l) : lambda(l) {}
-
-				void reset(p_type l) { lambda = l; }
-
-				//指数分布な疑似乱数の取得
-				template <class S>
-				n_type get(rnd::random_base<S>* handle) { return (*this)(handle); }
-				template <class S>
-				n_type operator()(rnd::random_base<S>* handle) {
-					n_type	k = 0;
-					p_type	_exp = exp<p_type>(-lambda);
-					p_type	xp = handle->unit<p_type>();
-					while (xp >= _exp) {
-						xp *= handle->unit<p_type>();
-						++k;
-					}
-					return k;
+				poisson_distribution() :lambda(1), prm(1) {}
+				poisson_distribution(p_type l) : lambda(l), prm(l) {}
+
+				void reset(p_type l) { lambda = l; prm = typename kernel::param_type(l); }
+
+				//ポアソン分布な疑似乱数の取得(λ < 10では一様乱数の積, それ以外はPTRS)
+				template <class Engine, class UInt>
+				n_type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				n_type operator()(rnd::random_base<Engine, UInt>* handle) {
+					return kernel::_sample_(handle, prm);
 				}
 			};
 
@@ -459,12 +1061,17 @@ namespace iml {
 
 				void reset(type l) { lambda = l; }
 
-				//指数分布な疑似乱数の取得
-				template <class S>
-				type get(rnd::random_base<S>* handle) { return (*this)(handle); }
-				template <class S>
-				type operator()(rnd::random_base<S>* handle) {
-					return -log(1 - handle->unit<type>()) / lambda;
+				//指数分布な疑似乱数の取得(Ziggurat法)
+				template <class Engine, class UInt>
+				type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				type operator()(rnd::random_base<Engine, UInt>* handle) {
+					return type(Ziggurat_kernel<Ziggurat_exponential_density>::_sample_(handle)) / lambda;
+				}
+				//[first, last)への一括生成
+				template <class Engine, class UInt, class OutputIterator>
+				void fill(rnd::random_base<Engine, UInt>* handle, OutputIterator first, OutputIterator last) {
+					Ziggurat_kernel<Ziggurat_exponential_density>::template _fill_<false>(handle, first, last, 1 / lambda, type(0));
 				}
 			};
 
@@ -474,53 +1081,50 @@ namespace iml {
 			public:
 				using type = T;
 			private:
+				using kernel = Gamma_variate_kernel<T>;
+
 				type	alpha;				//形状母数(0 < alpha)
 				type	beta;				//尺度母数(0 < beta)
+				typename kernel::param_type	prm;
 			public:
-				constexpr gamma_distribution() :alpha(1), beta(1) {}
-				constexpr gamma_distribution(type a, type b) : alpha(b), beta(b) {}
-
-				void reset(type a, type b) { alpha = a; beta = b; }
-
-				//ガンマ分布な疑似乱数の取得
-				template <class S>
-				type get(rnd::random_base<S>* handle) { return (*this)(handle); }
-				template <class S>
-				type operator()(rnd::random_base<S>* handle) {
-					static type _e = e<type>();
-					int int_beta = static_cast<int>(beta);
-					double frac_beta = beta - int_beta;
-
-					double u, uu;
-					double b, p, x_frac, x_int;
+				gamma_distribution() :alpha(1), beta(1), prm(1) {}
+				gamma_distribution(type a, type b) : alpha(a), beta(b), prm(a) {}
 
-					//整数部
-					x_int = 0;
-					for (size_t i = 0; i < int_beta; ++i) x_int += -log(handle->unit<type>());		//平均が1の指数分布乱数の加算
+				void reset(type a, type b) { alpha = a; beta = b; prm = typename kernel::param_type(a); }
 
-					//小数部
-					if (abs(frac_beta) < 0.01) x_frac = 0;
-					else {
-						b = (_e + frac_beta) / _e;
-						while (1) {
-
-							u = handle->unit<type>();
-							p = b*u;
-
-							uu = handle->unit<type>();
+				//ガンマ分布な疑似乱数の取得(Marsaglia-Tsang法)
+				template <class Engine, class UInt>
+				type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				type operator()(rnd::random_base<Engine, UInt>* handle) {
+					return beta * kernel::_sample_(handle, prm);
+				}
+			};
 
-							if (p <= 1) {
-								x_frac = pow(p, 1 / frac_beta);
-								if (uu <= exp(-x_frac)) break;
-							}
-							else {
-								x_frac = -log((b - p) / frac_beta);
-								if (uu <= pow(x_frac, frac_beta - 1)) break;
-							}
+			//ベータ分布(X ~ Gamma(a, 1), Y ~ Gamma(b, 1)に対するX/(X + Y))
+			template <class T>
+			class beta_distribution {
+			public:
+				using type = T;
+			private:
+				using kernel = Gamma_variate_kernel<T>;
 
-						}
-					}
-					return (x_int + x_frac)*alpha;
+				type	alpha;				//形状母数(0 < alpha)
+				type	beta;				//形状母数(0 < beta)
+				typename kernel::param_type	prm[2];
+			public:
+				beta_distribution() :alpha(1), beta(1), prm{ 1,1 } {}
+				beta_distribution(type a, type b) : alpha(a), beta(b), prm{ a,b } {}
+
+				void reset(type a, type b) { alpha = a; beta = b; prm[0] = typename kernel::param_type(a); prm[1] = typename kernel::param_type(b); }
+
+				//ベータ分布な疑似乱数の取得
+				template <class Engine, class UInt>
+				type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				type operator()(rnd::random_base<Engine, UInt>* handle) {
+					type x = kernel::_sample_(handle, prm[0]);
+					return x / (x + kernel::_sample_(handle, prm[1]));
 				}
 			};
 		}
@@ -537,18 +1141,49 @@ namespace iml {
 				type	sigma;			//標準偏差
 				type	mu;				//平均
 			public:
-				constexpr normal_distribution() :n(1), p(1) {}
+				constexpr normal_distribution() :sigma(1), mu(0) {}
 				constexpr normal_distribution(type s, type m) : sigma(s), mu(m) {}
 
 				void reset(type s, type m) { sigma = s; mu = m; }
 
-				//正規分布な疑似乱数の取得
-				template <class S>
-				type get(rnd::random_base<S>* handle) { return (*this)(handle); }
-				template <class S>
-				type operator()(rnd::random_base<S>* handle) {
-					static type _2pi = 2 * pi<type>();
-					return sigma*sqrt(-2 * log(handle->unit<type>()))*sin(_2pi*handle->unit<type>()) + mu;
+				//正規分布な疑似乱数の取得(Ziggurat法)
+				template <class Engine, class UInt>
+				type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				type operator()(rnd::random_base<Engine, UInt>* handle) {
+					return mu + sigma * type(Ziggurat_kernel<Ziggurat_normal_density>::_symmetric_sample_(handle));
+				}
+				//[first, last)への一括生成
+				template <class Engine, class UInt, class OutputIterator>
+				void fill(rnd::random_base<Engine, UInt>* handle, OutputIterator first, OutputIterator last) {
+					Ziggurat_kernel<Ziggurat_normal_density>::template _fill_<true>(handle, first, last, sigma, mu);
+				}
+			};
+
+			//半正規分布(標準正規分布の絶対値のsigma倍)
+			template <class FloatT>
+			class half_normal_distribution {
+			public:
+				using type = FloatT;
+			private:
+				type	sigma;			//尺度
+			public:
+				constexpr half_normal_distribution() :sigma(1) {}
+				constexpr half_normal_distribution(type s) : sigma(s) {}
+
+				void reset(type s) { sigma = s; }
+
+				//半正規分布な疑似乱数の取得(Ziggurat法)
+				template <class Engine, class UInt>
+				type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				type operator()(rnd::random_base<Engine, UInt>* handle) {
+					return sigma * type(Ziggurat_kernel<Ziggurat_normal_density>::_sample_(handle));
+				}
+				//[first, last)への一括生成
+				template <class Engine, class UInt, class OutputIterator>
+				void fill(rnd::random_base<Engine, UInt>* handle, OutputIterator first, OutputIterator last) {
+					Ziggurat_kernel<Ziggurat_normal_density>::template _fill_<false>(handle, first, last, sigma, type(0));
 				}
 			};
 
@@ -561,18 +1196,17 @@ namespace iml {
 				type	sigma;			//標準偏差
 				type	mu;				//平均
 			public:
-				constexpr lognormal_distribution() :n(1), p(1) {}
+				constexpr lognormal_distribution() :sigma(1), mu(0) {}
 				constexpr lognormal_distribution(type s, type m) : sigma(s), mu(m) {}
 
 				void reset(type s, type m) { sigma = s; mu = m; }
 
 				//対数正規分布な疑似乱数の取得(正規分布乱数の指数関数)
-				template <class S>
-				type get(rnd::random_base<S>* handle) { return (*this)(handle); }
-				template <class S>
-				type operator()(rnd::random_base<S>* handle) {
-					static type _2pi = 2 * pi<type>();
-					return exp(sigma*sqrt(-2 * log(handle->unit<type>()))*sin(_2pi*handle->unit<type>()) + mu);
+				template <class Engine, class UInt>
+				type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				type operator()(rnd::random_base<Engine, UInt>* handle) {
+					return exp(mu + sigma * type(Ziggurat_kernel<Ziggurat_normal_density>::_symmetric_sample_(handle)));
 				}
 			};
 
@@ -585,22 +1219,21 @@ namespace iml {
 				type	lambda;			//0以上
 				type	mu;				//0以上
 			public:
-				constexpr inverse_normal_distribution() :n(1), p(1) {}
+				constexpr inverse_normal_distribution() :lambda(1), mu(1) {}
 				constexpr inverse_normal_distribution(type l, type m) : lambda(l), mu(m) {}
 
 				void reset(type l, type m) { lambda = l; mu = m; }
 
 				//逆正規分布な疑似乱数の取得(λ(x−μ)^2/μ^2xが自由度1のΧ二乗分布に従う)
-				template <class S>
-				type get(rnd::random_base<S>* handle) { return (*this)(handle); }
-				template <class S>
-				type operator()(rnd::random_base<S>* handle) {
-					static type _2pi = 2 * pi<type>();
+				template <class Engine, class UInt>
+				type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				type operator()(rnd::random_base<Engine, UInt>* handle) {
 					type x, y, w, z;
-					x = sqrt(-2 * log(handle->unit<type>()))*sin(_2pi*handle->unit<type>());	//標準正規
+					x = type(Ziggurat_kernel<Ziggurat_normal_density>::_symmetric_sample_(handle));	//標準正規
 					y = x*x;		//Χ二乗
 					w = mu + 0.5*y*mu*mu / lambda - (0.5*mu / lambda)*sqrt(4 * mu*lambda*y + mu*mu*y*y);
-					z = handle->unit<type>();
+					z = handle->template unit<type>();
 
 					return (z < mu / (mu + w)) ? w : mu*mu / w;
 				}
@@ -613,29 +1246,60 @@ namespace iml {
 				using result_type = FloatT;
 				using free_type = IntT;
 			private:
+				using kernel = Gamma_variate_kernel<FloatT>;
+				//正規乱数の2乗和を用いる自由度の上限
+				static constexpr free_type threshold = 4;
+
 				free_type	k;				//自由度
+				typename kernel::param_type	prm;			//Gamma(k/2, 2)
 			public:
-				constexpr chi_squared_distribution() :k(1) {}
-				constexpr chi_squared_distribution(free_type k) : k(k) {}
+				chi_squared_distribution() :k(1), prm(result_type(0.5)) {}
+				chi_squared_distribution(free_type k) : k(k), prm(result_type(k) / 2) {}
 
-				void reset(free_type k) { this->k = k; }
+				void reset(free_type k) { this->k = k; prm = typename kernel::param_type(result_type(k) / 2); }
 
-				//Χ二乗分布な疑似乱数の取得
-				template <class S>
-				result_type get(rnd::random_base<S>* handle) { return (*this)(handle); }
-				template <class S>
-				result_type operator()(rnd::random_base<S>* handle) {
-					static result_type _2pi = 2 * pi<result_type>();
-					result_type w = 0;
+				//Χ二乗分布な疑似乱数の取得(自由度が小さければ正規乱数の2乗和, それ以外はガンマ分布)
+				template <class Engine, class UInt>
+				result_type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				result_type operator()(rnd::random_base<Engine, UInt>* handle) {
+					if (k > threshold) return 2 * kernel::_sample_(handle, prm);
 
-					for (size_t i = 0; i < k; ++i) {
-						result_type z = sqrt(-2 * log(handle->unit<result_type>()))*sin(_2pi*handle->unit<result_type>());
+					result_type w = 0;
+					for (size_t i = 0; i < size_t(k); ++i) {
+						result_type z = result_type(Ziggurat_kernel<Ziggurat_normal_density>::_symmetric_sample_(handle));
 						w += z*z;
 					}
 					return w;
 				}
 			};
 
+			//スチューデントのt分布(Z/√(V/ν), Z ~ N(0, 1), V ~ Χ^2(ν))
+			template <class FloatT>
+			class student_t_distribution {
+			public:
+				using type = FloatT;
+			private:
+				using kernel = Gamma_variate_kernel<FloatT>;
+
+				type	nu;				//自由度(0 < nu)
+				typename kernel::param_type	prm;			//Gamma(ν/2, 1)
+			public:
+				student_t_distribution() :nu(1), prm(type(0.5)) {}
+				student_t_distribution(type n) : nu(n), prm(n / 2) {}
+
+				void reset(type n) { nu = n; prm = typename kernel::param_type(n / 2); }
+
+				//t分布な疑似乱数の取得(V/2 ~ Gamma(ν/2, 1))
+				template <class Engine, class UInt>
+				type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				type operator()(rnd::random_base<Engine, UInt>* handle) {
+					type z = type(Ziggurat_kernel<Ziggurat_normal_density>::_symmetric_sample_(handle));
+					return z * sqrt(nu / (2 * kernel::_sample_(handle, prm)));
+				}
+			};
+
 			//コーシー分布
 			template <class FloatT>
 			class cauchy_distribution {
@@ -645,18 +1309,18 @@ namespace iml {
 				type	gamma;			//半値半幅
 				type	mu;				//最頻値
 			public:
-				constexpr cauchy_distribution() :n(1), p(1) {}
+				constexpr cauchy_distribution() :gamma(1), mu(0) {}
 				constexpr cauchy_distribution(type g, type m) : gamma(g), mu(m) {}
 
 				void reset(type g, type m) { gamma = g; mu = m; }
 
 				//コーシー分布な疑似乱数の取得
-				template <class S>
-				type get(rnd::random_base<S>* handle) { return (*this)(handle); }
-				template <class S>
-				type operator()(rnd::random_base<S>* handle) {
-					static type _pi = pi<type>();
-					return mu + gamma*tan(_pi*(handle->unit<type>() - 0.5));
+				template <class Engine, class UInt>
+				type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				type operator()(rnd::random_base<Engine, UInt>* handle) {
+					static type _pi = pi<type>;
+					return mu + gamma*tan(_pi*(handle->template unit<type>() - 0.5));
 				}
 			};
 		}
@@ -677,16 +1341,250 @@ namespace iml {
 				void reset(type a, type b) { uniform.reset(a, b); }
 
 				//任意の分布に従う疑似乱数の取得
-				template <class S>
-				type get(rnd::random_base<S>* handle) { return (*this)(handle); }
-				template <class S, class F>
-				type operator()(rnd::random_base<S>* handle, F f) {
+				template <class Engine, class UInt, class F>
+				type get(rnd::random_base<Engine, UInt>* handle, F f) { return (*this)(handle, f); }
+				template <class Engine, class UInt, class F>
+				type operator()(rnd::random_base<Engine, UInt>* handle, F f) {
 					type result = uniform(handle);
-					while (!(handle->unit<type>() <= f(result))) result = uniform(handle);
+					while (!(handle->template unit<type>() <= f(result))) result = uniform(handle);
 					return result;
 				}
 			};
 		}
+
+		//任意の重みによる離散分布
+		namespace stats {
+
+			//重みw[0..n)に比例する確率で添字を生成する離散分布(Walker-Voseのエイリアス法)
+			//構築はO(n)で, 1回の生成は64ビットの乱数1つとn倍の128ビット積(上位が列, 下位が列内の位置)で決まる
+			template <class IntT, class FloatT>
+			class discrete_distribution {
+			public:
+				using n_type = IntT;			//添字をあらわす型
+				using p_type = FloatT;			//重みをあらわす型
+			private:
+				struct column {
+					uint64_t	threshold;		//列内の位置がthreshold未満であれば自身を, それ以外はaliasを返す
+					n_type		alias;
+				};
+				std::vector<column>	table;
+				std::vector<p_type>	prob;			//正規化された確率
+
+				n_type _select_(uint64_t bits) const {
+					uint64_t i, pos = __limb_mul(bits, uint64_t(table.size()), i);
+					return (pos < table[size_t(i)].threshold) ? n_type(i) : table[size_t(i)].alias;
+				}
+				double _weight_(size_t i) const { return double(prob[i]) * double(prob.size()); }
+				static uint64_t _threshold_(double w) { return (w < 1) ? uint64_t(w * rnd::__random_pow2(64)) : ~uint64_t(0); }
+				//i以降で最初の重い(heavy)もしくは軽いもの
+				size_t _next_(size_t i, bool heavy) const {
+					while (i < prob.size() && (_weight_(i) >= 1) != heavy) ++i;
+					return i;
+				}
+			public:
+				discrete_distribution() :table(1, column{ ~uint64_t(0), 0 }), prob(1, 1) {}
+				template <class InputIterator>
+				discrete_distribution(InputIterator first, InputIterator last) { reset(first, last); }
+
+				//表の再構築(重みが空か和が正でなければ分布は変更せずに例外を送出する)
+				template <class InputIterator>
+				void reset(InputIterator first, InputIterator last) {
+					std::vector<p_type> p(first, last);
+					size_t n = p.size();
+					p_type sum = 0;
+					for (size_t i = 0; i < n; ++i) sum += p[i];
+					if (n == 0 || !(sum > 0)) throw std::invalid_argument("discrete_distribution requires weights with a positive sum.");
+					for (size_t i = 0; i < n; ++i) p[i] /= sum;
+					prob.swap(p);
+
+					//平均を1とする重みq[i] = n*prob[i]の1未満(軽)のものに1以上(重)のものを前から順に割り当てる
+					//重いものは残りが1未満となった時点で軽いものとして割り当てる(添字を前方へ走査するだけなので作業領域は不要)
+					table.resize(n);
+					size_t i = _next_(0, false), j = _next_(0, true);
+					double w = (j < n) ? _weight_(j) : 0;
+					//軽いものを使い切っても残りが1未満となった重いものは次の重いものへ割り当てる
+					while (j < n) {
+						if (w < 1) {
+							size_t k = _next_(j + 1, true);
+							if (k == n) break;
+							table[j] = column{ _threshold_(w), n_type(k) };
+							w += _weight_(k) - 1;
+							j = k;
+						}
+						else {
+							if (i == n) break;
+							table[i] = column{ _threshold_(_weight_(i)), n_type(j) };
+							w += _weight_(i) - 1;
+							i = _next_(i + 1, false);
+						}
+					}
+					//丸め誤差で残ったものは確率1とする
+					if (j < n) table[j] = column{ ~uint64_t(0), n_type(j) };
+					for (size_t k = (j < n) ? _next_(j + 1, true) : n; k < n; k = _next_(k + 1, true)) table[k] = column{ ~uint64_t(0), n_type(k) };
+					for (size_t k = i; k < n; k = _next_(k + 1, false)) table[k] = column{ ~uint64_t(0), n_type(k) };
+				}
+
+				size_t size() const { return prob.size(); }
+				//正規化された確率
+				p_type probability(size_t i) const { return prob[i]; }
+
+				//離散分布な疑似乱数の取得
+				template <class Engine, class UInt>
+				n_type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				n_type operator()(rnd::random_base<Engine, UInt>* handle) { return _select_(handle->bits64()); }
+				//[first, last)への一括生成
+				template <class Engine, class UInt, class OutputIterator>
+				void fill(rnd::random_base<Engine, UInt>* handle, OutputIterator first, OutputIterator last) {
+					uint64_t buf[256];
+					while (first != last) {
+						size_t n = 0;
+						for (OutputIterator itr = first; n < 256 && itr != last; ++itr) ++n;
+						handle->fill_bits64(buf, buf + n);
+						for (size_t i = 0; i < n; ++i, ++first) *first = _select_(buf[i]);
+					}
+				}
+			};
+
+			//重みの更新が可能な離散分布(Fenwick木により更新と生成はO(log n))
+			template <class IntT, class FloatT>
+			class dynamic_discrete_distribution {
+			public:
+				using n_type = IntT;
+				using p_type = FloatT;
+			private:
+				std::vector<p_type>	w;				//各重み
+				std::vector<p_type>	tree;			//tree[i]は(i - (i & -i), i]の重みの和(1始まり)
+				size_t				top;			//size()以下の最大の2の冪
+
+				void _build_() {
+					size_t n = w.size();
+					tree.assign(n + 1, 0);
+					for (size_t i = 1; i <= n; ++i) {
+						tree[i] += w[i - 1];
+						size_t j = i + (i & (~i + 1));
+						if (j <= n) tree[j] += tree[i];
+					}
+					for (top = 1; top * 2 <= n; top *= 2);
+				}
+			public:
+				dynamic_discrete_distribution() :w(1, 1) { _build_(); }
+				explicit dynamic_discrete_distribution(size_t n, p_type x = 0) : w(n, x) { _build_(); }
+				template <class InputIterator>
+				dynamic_discrete_distribution(InputIterator first, InputIterator last) : w(first, last) { _build_(); }
+
+				//全ての重みの再設定(O(n))
+				template <class InputIterator>
+				void reset(InputIterator first, InputIterator last) { w.assign(first, last); _build_(); }
+				//重みの更新(O(log n))
+				void set(size_t i, p_type x) {
+					p_type d = x - w[i];
+					w[i] = x;
+					for (size_t j = i + 1; j < tree.size(); j += j & (~j + 1)) tree[j] += d;
+				}
+				void add(size_t i, p_type d) { set(i, w[i] + d); }
+
+				size_t size() const { return w.size(); }
+				p_type weight(size_t i) const { return w[i]; }
+				//[0, i)の重みの和
+				p_type prefix_sum(size_t i) const {
+					p_type s = 0;
+					for (; i > 0; i -= i & (~i + 1)) s += tree[i];
+					return s;
+				}
+				p_type total() const { return prefix_sum(w.size()); }
+				//更新を繰り返して蓄積した丸め誤差を除く
+				void rebuild() { _build_(); }
+
+				//離散分布な疑似乱数の取得(prefix_sum(i + 1) > u*total()となる最小のiを木の降下で求める)
+				//重みが空か和が正でなければ例外を送出する
+				template <class Engine, class UInt>
+				n_type get(rnd::random_base<Engine, UInt>* handle) { return (*this)(handle); }
+				template <class Engine, class UInt>
+				n_type operator()(rnd::random_base<Engine, UInt>* handle) {
+					p_type sum = total();
+					for (size_t retry = 0; ; ++retry) {
+						//引き直しが続くときは更新の丸め誤差で和が残っている可能性があるため再構築する
+						if (retry == 64) {
+							_build_();
+							sum = total();
+						}
+						if (!(sum > 0)) throw std::invalid_argument("dynamic_discrete_distribution requires weights with a positive sum.");
+						p_type u = handle->template unit<p_type>() * sum;
+						size_t pos = 0;
+						for (size_t step = top; step != 0; step >>= 1)
+							if (pos + step < tree.size() && tree[pos + step] <= u) {
+								pos += step;
+								u -= tree[pos];
+							}
+						//丸め誤差で末尾を超えた場合と重み0の要素は引き直す
+						if (pos < w.size() && w[pos] > 0) return n_type(pos);
+					}
+				}
+			};
+
+			//重み付きのリザーバサンプリング(Efraimidis-Spirakisの指数ジャンプ法, 重みに比例する非復元抽出)
+			//各要素の鍵log(u)/wの大きいものからk個を保持し, 入れ替えが起こるまでの重みの和を一度に引いて読み飛ばす
+			template <class T, class FloatT>
+			class weighted_reservoir_sampling {
+			public:
+				using value_type = T;
+				using p_type = FloatT;
+			private:
+				struct entry {
+					p_type		key;
+					value_type	value;
+					//鍵の最小値を先頭とするヒープのための比較
+					bool operator<(const entry& e) const { return key > e.key; }
+				};
+				size_t				k;
+				std::vector<entry>	heap;
+				p_type				skip;			//次の入れ替えまでに読み飛ばす重み
+
+				template <class Engine, class UInt>
+				p_type _key_(rnd::random_base<Engine, UInt>* handle, p_type weight) {
+					return log(1 - handle->template unit<p_type>()) / weight;
+				}
+				template <class Engine, class UInt>
+				void _jump_(rnd::random_base<Engine, UInt>* handle) {
+					skip = log(1 - handle->template unit<p_type>()) / heap.front().key;
+				}
+			public:
+				explicit weighted_reservoir_sampling(size_t k = 1) :k(k), heap(), skip(0) { heap.reserve(k); }
+
+				void reset(size_t k) { this->k = k; clear(); heap.reserve(k); }
+				void clear() { heap.clear(); skip = 0; }
+
+				//要素の追加(重みが正でないものは選ばれない)
+				template <class Engine, class UInt>
+				void push(rnd::random_base<Engine, UInt>* handle, const value_type& x, p_type weight) {
+					if (!(weight > 0) || k == 0) return;
+					if (heap.size() < k) {
+						heap.push_back(entry{ _key_(handle, weight), x });
+						std::push_heap(heap.begin(), heap.end());
+						if (heap.size() == k) _jump_(handle);
+						return;
+					}
+					skip -= weight;
+					if (skip > 0) return;
+					//鍵は(log T_w*w, 0)の範囲に条件付けられる
+					p_type t = exp(heap.front().key * weight);
+					p_type key = log(t + (1 - t) * (1 - handle->template unit<p_type>())) / weight;
+					std::pop_heap(heap.begin(), heap.end());
+					heap.back() = entry{ key, x };
+					std::push_heap(heap.begin(), heap.end());
+					_jump_(handle);
+				}
+
+				size_t size() const { return heap.size(); }
+				//抽出された要素(順序は不定)
+				const value_type& operator[](size_t i) const { return heap[i].value; }
+				template <class OutputIterator>
+				void copy(OutputIterator out) const {
+					for (size_t i = 0; i < heap.size(); ++i, ++out) *out = heap[i].value;
+				}
+			};
+		}
 	}
 }
 
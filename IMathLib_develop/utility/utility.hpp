@@ -4,6 +4,7 @@
 //汎用的なクラスや関数
 
 
+#include "IMathLib/utility/utility/bit_cast.hpp"
 #include "IMathLib/utility/utility/forward.hpp"
 #include "IMathLib/utility/utility/move.hpp"
 #include "IMathLib/utility/utility/swap.hpp"
@@ -0,0 +1,20 @@
+﻿#ifndef IMATH_UTILITY_UTILITY_BIT_CAST_HPP
+#define IMATH_UTILITY_UTILITY_BIT_CAST_HPP
+
+#include "IMathLib/IMathLib_config.hpp"
+#include <cstring>
+
+namespace iml {
+
+	//ビット表現を保ったままの型変換(同じサイズの型同士のみ)
+	template <class To, class From>
+	inline To bit_cast(const From& from) noexcept {
+		static_assert(sizeof(To) == sizeof(From), "The size of the type is different.");
+
+		To result;
+		std::memcpy(&result, &from, sizeof(To));
+		return result;
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,227 @@
+﻿//1パスで併合可能な統計量の累積(moment_accumulator, covariance_accumulator)の検査
+//使い方: accumulator_test (失敗した項目を標準出力に出力し, 失敗があれば1を返す)
+//要素ごとの追加, 配列の一括追加(SIMDのブロック), 分割した累積の併合をlong doubleによる2パスの値と比較する
+
+#include "IMathLib/math/statistics.hpp"
+
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <list>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+	//2パスで求めた平均, 2~4次の中心モーメント(nで割ったもの), 最小値と最大値
+	struct reference {
+		long double mean, m2, m3, m4;
+		double min, max;
+	};
+	template <class T>
+	reference two_pass(const std::vector<T>& x) {
+		reference r = { 0, 0, 0, 0, double(x[0]), double(x[0]) };
+		for (T v : x) {
+			r.mean += v;
+			if (v < r.min) r.min = v;
+			if (r.max < v) r.max = v;
+		}
+		r.mean /= x.size();
+		//平均の丸め誤差を偏差の和で補正する
+		long double s1 = 0;
+		for (T v : x) s1 += v - r.mean;
+		r.mean += s1 / x.size();
+		for (T v : x) {
+			long double d = v - r.mean, d2 = d * d;
+			r.m2 += d2;
+			r.m3 += d2 * d;
+			r.m4 += d2 * d2;
+		}
+		r.m2 /= x.size();
+		r.m3 /= x.size();
+		r.m4 /= x.size();
+		return r;
+	}
+
+	//相対誤差がtol以下か(scaleは0に近い値の誤差の尺度)
+	std::size_t check_close(const char* name, const char* what, long double got, long double expected, long double scale, double tol) {
+		long double e = std::fabs(got - expected) / scale;
+		if (e <= tol) return 0;
+		std::cout << name << ": " << what << " is " << double(got) << ", expected " << double(expected) << " (relative error " << double(e) << ")\n";
+		return 1;
+	}
+
+	//累積の各値を2パスの値と比べる(平均は|平均| + 標準偏差に対する誤差, 歪度と尖度は絶対誤差)
+	template <class T>
+	std::size_t check_moments(const char* name, const iml::stats::moment_accumulator<T>& acc, const std::vector<T>& x, double tol) {
+		const reference r = two_pass(x);
+		const long double sd = std::sqrt(r.m2), skew = r.m3 / (r.m2 * sd), kurt = r.m4 / (r.m2 * r.m2) - 3;
+		std::size_t failed = 0;
+		if (acc.count() != x.size()) {
+			std::cout << name << ": count is " << acc.count() << ", expected " << x.size() << '\n';
+			++failed;
+		}
+		if (acc.min() != r.min || acc.max() != r.max) {
+			std::cout << name << ": min and max are " << acc.min() << ", " << acc.max() << ", expected " << r.min << ", " << r.max << '\n';
+			++failed;
+		}
+		failed += check_close(name, "mean", acc.mean(), r.mean, std::fabs(r.mean) + sd, tol);
+		failed += check_close(name, "variance", acc.variance(), r.m2, r.m2, tol);
+		failed += check_close(name, "sample variance", acc.sample_variance(), r.m2 * x.size() / (x.size() - 1), r.m2 * x.size() / (x.size() - 1), tol);
+		failed += check_close(name, "skewness", acc.skewness(), skew, 1, 10 * tol);
+		failed += check_close(name, "kurtosis", acc.kurtosis(), kurt, 1 + std::fabs(kurt), 10 * tol);
+		return failed;
+	}
+
+	//要素ごと, 配列(連続領域と一般のイテレータ), 先頭から順に分割した累積の併合のそれぞれを比べる
+	template <class T>
+	std::size_t check_all(const char* name, const std::vector<T>& x, double tol) {
+		using accumulator = iml::stats::moment_accumulator<T>;
+		std::size_t failed = 0;
+		accumulator element, array, list, merged;
+		for (T v : x) element.push(v);
+		array.push(x.data(), x.data() + x.size());
+		const std::list<T> l(x.begin(), x.end());
+		list.push(l.begin(), l.end());
+		//大きさの異なる断片(空の断片と1要素の断片を含む)
+		std::size_t i = 0, k = 0;
+		while (i < x.size()) {
+			std::size_t m = (k * k * 37 + 1) % 3001;
+			if (m > x.size() - i) m = x.size() - i;
+			accumulator part;
+			part.push(x.data() + i, x.data() + i + m);
+			merged += part;
+			i += m;
+			++k;
+		}
+		std::string s(name);
+		failed += check_moments((s + " element").c_str(), element, x, tol);
+		failed += check_moments((s + " array").c_str(), array, x, tol);
+		failed += check_moments((s + " iterator").c_str(), list, x, tol);
+		failed += check_moments((s + " merged").c_str(), merged, x, tol);
+		return failed;
+	}
+
+	//2変量の累積を2パスの値と比べる
+	std::size_t check_covariance(const char* name, const std::vector<double>& x, const std::vector<double>& y, double tol) {
+		using accumulator = iml::stats::covariance_accumulator<double>;
+		const std::size_t n = x.size();
+		long double mx = 0, my = 0;
+		for (std::size_t i = 0; i < n; ++i) { mx += x[i]; my += y[i]; }
+		mx /= n;
+		my /= n;
+		long double sxx = 0, syy = 0, sxy = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			sxx += (x[i] - mx) * (x[i] - mx);
+			syy += (y[i] - my) * (y[i] - my);
+			sxy += (x[i] - mx) * (y[i] - my);
+		}
+		accumulator acc[4];
+		for (std::size_t i = 0; i < n; ++i) acc[0].push(x[i], y[i]);
+		acc[1].push(x.data(), x.data() + n, y.data());
+		const std::list<double> l(y.begin(), y.end());
+		acc[2].push(x.data(), x.data() + n, l.begin());
+		for (std::size_t i = 0; i < n; i += 777) {
+			accumulator part;
+			std::size_t m = (n - i < 777) ? n - i : 777;
+			part.push(x.data() + i, x.data() + i + m, y.data() + i);
+			acc[3].merge(part);
+		}
+		const char* label[4] = { "element", "array", "iterator", "merged" };
+		std::size_t failed = 0;
+		for (std::size_t k = 0; k < 4; ++k) {
+			std::string s = std::string(name) + ' ' + label[k];
+			const accumulator& a = acc[k];
+			failed += check_close(s.c_str(), "mean x", a.mean_x(), mx, std::fabs(mx) + std::sqrt(sxx / n), tol);
+			failed += check_close(s.c_str(), "mean y", a.mean_y(), my, std::fabs(my) + std::sqrt(syy / n), tol);
+			failed += check_close(s.c_str(), "variance x", a.variance_x(), sxx / n, sxx / n, tol);
+			failed += check_close(s.c_str(), "variance y", a.variance_y(), syy / n, syy / n, tol);
+			failed += check_close(s.c_str(), "covariance", a.covariance(), sxy / n, std::sqrt(sxx * syy) / n, tol);
+			failed += check_close(s.c_str(), "correlation", a.correlation(), sxy / std::sqrt(sxx * syy), 1, tol);
+			if (a.count() != n) {
+				std::cout << s << ": count is " << a.count() << ", expected " << n << '\n';
+				++failed;
+			}
+		}
+		return failed;
+	}
+}
+
+
+int main() {
+	using namespace iml;
+	std::size_t failed = 0;
+	rnd::Xoshiro256_starstar<4> g(17);
+	stats::stats::normal_distribution<double> normal;
+	stats::stats::exponential_distribution<double> exponential;
+
+	//ブロック長(1024)とSIMDの幅の端数を含む大きさ
+	const std::size_t sizes[] = { 2, 3, 7, 1023, 1024, 1025, 4099, 100000 };
+	for (std::size_t n : sizes) {
+		std::vector<double> x(n);
+		char name[64];
+		//標準正規分布
+		for (double& v : x) v = normal(&g);
+		std::snprintf(name, sizeof(name), "normal %zu", n);
+		failed += check_all(name, x, 1e-13);
+		//平均が標準偏差の10^9倍(E[x^2] - E[x]^2では全ての桁が失われる)
+		for (double& v : x) v = 1e9 + normal(&g);
+		std::snprintf(name, sizeof(name), "offset 1e9 %zu", n);
+		failed += check_all(name, x, 1e-6);
+		//歪んだ分布
+		for (double& v : x) v = exponential(&g);
+		std::snprintf(name, sizeof(name), "exponential %zu", n);
+		failed += check_all(name, x, 1e-13);
+		//floatの連続領域
+		std::vector<float> y(n);
+		for (float& v : y) v = float(100 + normal(&g));
+		std::snprintf(name, sizeof(name), "float %zu", n);
+		failed += check_all(name, y, 1e-4);
+	}
+
+	//空の累積, 1要素, 定数列
+	{
+		stats::moment_accumulator<double> a, b;
+		a.merge(b);
+		if (a.count() != 0 || a.mean() != 0 || a.variance() != 0 || a.sample_variance() != 0 || a.skewness() != 0 || a.kurtosis() != 0) {
+			std::cout << "empty: nonzero statistics\n";
+			++failed;
+		}
+		b.push(2.5);
+		a.merge(b);
+		b.merge(stats::moment_accumulator<double>());
+		if (a.count() != 1 || a.mean() != 2.5 || a.variance() != 0 || a.min() != 2.5 || a.max() != 2.5 || b.count() != 1) {
+			std::cout << "single: wrong statistics\n";
+			++failed;
+		}
+		std::vector<double> c(3000, 0.1);
+		stats::moment_accumulator<double> d;
+		d.push(c.data(), c.data() + c.size());
+		if (!(std::fabs(d.mean() - 0.1) <= 1e-17) || !(d.variance() <= 1e-32)) {
+			std::cout << "constant: mean " << d.mean() << ", variance " << d.variance() << '\n';
+			++failed;
+		}
+	}
+
+	//2変量(y = 3x + 雑音, 大きな平均を含む)
+	{
+		std::vector<double> x(50000), y(50000);
+		for (std::size_t i = 0; i < x.size(); ++i) {
+			x[i] = normal(&g);
+			y[i] = 3 * x[i] + 0.5 * normal(&g);
+		}
+		failed += check_covariance("covariance", x, y, 1e-13);
+		for (std::size_t i = 0; i < x.size(); ++i) {
+			x[i] += 1e8;
+			y[i] = -y[i] + 1e9;
+		}
+		failed += check_covariance("covariance offset", x, y, 1e-6);
+		x.resize(3);
+		y.resize(3);
+		failed += check_covariance("covariance 3", x, y, 1e-6);
+	}
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+﻿//数学関数の精度と速度のベンチマーク
+//使い方: benchmark [--csv ファイル名] [--json ファイル名] [--quick]
+//出力先の指定がなければCSVを標準出力に出力する
+
+#include "IMathLib/math/math.hpp"
+#include "IMathLib/math/benchmark.hpp"
+#include "IMathLib/math/multi/multi_float.hpp"
+#include "benchmark_reference.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+
+
+namespace {
+
+	using namespace iml::bench;
+
+	//配列演算を持たない関数は要素ごとに呼び出す
+	template <class F>
+	struct elementwise {
+		F f;
+		template <class T>
+		void operator()(const T* first, const T* last, const T* y, T* out) const {
+			for (; first != last; ++first, ++y, ++out) *out = f(*first, *y);
+		}
+	};
+	template <class F>
+	inline elementwise<F> make_elementwise(F f) { return elementwise<F>{ f }; }
+
+	//参照値を求める多倍長浮動小数点数(long doubleは処理系によって倍精度と同じであるため用いない)
+	using reference_float = iml::multi_float<128>;
+	using reference_kernel = iml::Multi_float_kernel<128>;
+
+	//点列(x[i], y[i])でのreference_floatの関数ref(x, y)による参照値
+	template <class T, class Ref>
+	std::vector<reference_value> make_reference(Ref ref, const std::vector<T>& x, const std::vector<T>& y) {
+		std::vector<reference_value> result(x.size());
+		for (size_t i = 0; i < x.size(); ++i) {
+			reference_float r = ref(reference_float(double(x[i])), reference_float(double(y[i])));
+			double hi = static_cast<double>(r);
+			//hi + loに分けて参照値の丸め誤差を含めない
+			result[i] = reference_value{ double(x[i]), double(y[i]), hi, static_cast<double>(r - reference_float(hi)) };
+		}
+		return result;
+	}
+
+	//定義域
+	struct domain {
+		double a, b;
+		bool logarithmic;
+		double ya, yb;		//2変数関数の第2引数の範囲
+	};
+
+	struct runner {
+		report rep;
+		size_t n = 4096, repeat = 64;
+		size_t accuracy_n = 1 << 14;		//精度を測る乱数の点の数(参照値の計算が1点あたり数十μs, riemann_zetaは1ms程度かかる)
+
+		//定義域の乱数の点列でreference_float版の関数refと比較する
+		template <class T, class F, class V, class Ref>
+		void run(const char* name, const char* type, F f, V v, Ref ref, const domain& d) {
+			std::vector<T> x = sweep<T>(d.a, d.b, accuracy_n, d.logarithmic, 0xD1B54A32D192ED03ull)
+				, y = sweep<T>(d.ya, d.yb, accuracy_n, false, 0x8CB92BA72F3D8DD7ull);
+			std::vector<reference_value> table = make_reference(ref, x, y);
+			add<T>(name, type, f, v, measure_accuracy<T>(f, table.data(), table.data() + table.size()), d);
+		}
+		//reference_float版の関数がないときは事前に計算した参照値の表と比較する
+		template <class T, class F, class V, size_t N>
+		void run_table(const char* name, const char* type, F f, V v, const reference_value(&ref)[N], const domain& d) {
+			add<T>(name, type, f, v, measure_accuracy<T>(f, ref, ref + N), d);
+		}
+		template <class T, class F, class V>
+		void add(const char* name, const char* type, F f, V v, const accuracy_result& accuracy, const domain& d) {
+			entry e;
+			e.name = name;
+			e.type = type;
+			std::ostringstream os;
+			os << '[' << d.a << ", " << d.b << ']' << (d.logarithmic ? " log" : "");
+			e.domain = os.str();
+			e.accuracy = accuracy;
+
+			std::vector<T> x = sweep<T>(d.a, d.b, n, d.logarithmic), y = sweep<T>(d.ya, d.yb, n, false, 0x2545F4914F6CDD1Dull), out(n);
+			e.scalar = measure_scalar<T>(f, x.data(), y.data(), n, repeat);
+			e.array = measure_array<T>(v, x.data(), y.data(), out.data(), n, repeat);
+			rep.add(e);
+		}
+	};
+
+	//初等関数(float, double)
+	template <class T>
+	void run_elementary(runner& r, const char* type) {
+		using namespace bench_reference;
+
+		r.run<T>("exp", type, [](T x, T) { return iml::exp(x); }
+			, [](const T* first, const T* last, const T*, T* out) { iml::vexp(first, last, out); }, [](const reference_float& x, const reference_float&) { return reference_kernel::_exp_(x); }, { -87, 88, false, 0, 0 });
+		r.run<T>("log", type, [](T x, T) { return iml::log(x); }
+			, [](const T* first, const T* last, const T*, T* out) { iml::vlog(first, last, out); }, [](const reference_float& x, const reference_float&) { return reference_kernel::_log_(x); }, { 1e-37, 1e38, true, 0, 0 });
+		r.run<T>("sin", type, [](T x, T) { return iml::sin(x); }
+			, [](const T* first, const T* last, const T*, T* out) { iml::vsin(first, last, out); }, [](const reference_float& x, const reference_float&) { return reference_kernel::_sin_(x); }, { -100, 100, false, 0, 0 });
+		r.run<T>("cos", type, [](T x, T) { return iml::cos(x); }
+			, [](const T* first, const T* last, const T*, T* out) { iml::vcos(first, last, out); }, [](const reference_float& x, const reference_float&) { return reference_kernel::_cos_(x); }, { -100, 100, false, 0, 0 });
+		r.run<T>("sqrt", type, [](T x, T) { return iml::sqrt(x); }
+			, make_elementwise([](T x, T) { return iml::sqrt(x); }), [](const reference_float& x, const reference_float&) { return reference_kernel::_sqrt_(x); }, { 1e-37, 1e38, true, 0, 0 });
+		r.run<T>("pow", type, [](T x, T y) { return iml::pow(x, y); }
+			, [](const T* first, const T* last, const T* y, T* out) { iml::vpow(first, last, y, out); }, [](const reference_float& x, const reference_float& y) { return reference_kernel::_exp_(y * reference_kernel::_log_(x)); }, { 0.01, 100, true, -15, 15 });
+	}
+
+	//特殊関数(double)
+	void run_special(runner& r) {
+		using namespace bench_reference;
+		using T = double;
+
+		auto lgamma_f = [](T x, T) { return iml::lgamma(x); };
+		r.run<T>("lgamma", "double", lgamma_f
+			, [](const T* first, const T* last, const T*, T* out) { iml::vlgamma(first, last, out); }, [](const reference_float& x, const reference_float&) { return reference_kernel::_lgamma_(x); }, { 0.01, 1000, true, 0, 0 });
+		auto gamma_f = [](T x, T) { return iml::gamma(x); };
+		r.run<T>("gamma", "double", gamma_f
+			, [](const T* first, const T* last, const T*, T* out) { iml::vgamma(first, last, out); }, [](const reference_float& x, const reference_float&) { return reference_kernel::_gamma_(x); }, { 0.01, 25, false, 0, 0 });
+		auto digamma_f = [](T x, T) { return iml::digamma(x); };
+		r.run_table<T>("digamma", "double", digamma_f
+			, [](const T* first, const T* last, const T*, T* out) { iml::vdigamma(first, last, out); }, digamma_reference, { 0.01, 50, false, 0, 0 });
+		auto erf_f = [](T x, T) { return iml::erf(x); };
+		r.run<T>("erf", "double", erf_f
+			, [](const T* first, const T* last, const T*, T* out) { iml::verf(first, last, out); }, [](const reference_float& x, const reference_float&) { return reference_kernel::_erf_(x); }, { -4, 4, false, 0, 0 });
+		auto erfc_f = [](T x, T) { return iml::erfc(x); };
+		r.run<T>("erfc", "double", erfc_f
+			, [](const T* first, const T* last, const T*, T* out) { iml::verfc(first, last, out); }, [](const reference_float& x, const reference_float&) { return reference_kernel::_erfc_(x); }, { -2, 6, false, 0, 0 });
+		auto zeta_f = [](T x, T) { return iml::riemann_zeta(x); };
+		r.run<T>("riemann_zeta", "double", zeta_f
+			, [](const T* first, const T* last, const T*, T* out) { iml::vriemann_zeta(first, last, out); }, [](const reference_float& x, const reference_float&) { return reference_kernel::_riemann_zeta_(x); }, { 1.1, 30, false, 0, 0 });
+		auto ei_f = [](T x, T) { return iml::exp_int(x); };
+		r.run_table<T>("exp_int", "double", ei_f, make_elementwise(ei_f), exp_int_reference, { 0.1, 30, false, 0, 0 });
+		auto fs_f = [](T x, T) { return iml::fresnel_int_s(x); };
+		r.run_table<T>("fresnel_int_s", "double", fs_f, make_elementwise(fs_f), fresnel_int_s_reference, { 0, 5, false, 0, 0 });
+		auto fc_f = [](T x, T) { return iml::fresnel_int_c(x); };
+		r.run_table<T>("fresnel_int_c", "double", fc_f, make_elementwise(fc_f), fresnel_int_c_reference, { 0, 5, false, 0, 0 });
+		auto beta_f = [](T a, T b) { return iml::beta(a, b); };
+		r.run<T>("beta", "double", beta_f, make_elementwise(beta_f), [](const reference_float& a, const reference_float& b) {
+			return reference_kernel::_exp_(reference_kernel::_lgamma_(a) + reference_kernel::_lgamma_(b) - reference_kernel::_lgamma_(a + b));
+		}, { 0.5, 20, false, 0.5, 20 });
+		auto gamma_p_f = [](T a, T x) { return iml::gamma_p(a, x); };
+		r.run_table<T>("gamma_p", "double", gamma_p_f
+			, [](const T* first, const T* last, const T* y, T* out) { iml::vgamma_p(first, y, y + (last - first), out); }, gamma_p_reference, { 0.5, 20, false, 0.1, 30 });
+	}
+}
+
+
+int main(int argc, char* argv[]) {
+	const char* csv_path = nullptr;
+	const char* json_path = nullptr;
+	runner r;
+
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--csv") == 0 && i + 1 < argc) csv_path = argv[++i];
+		else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) json_path = argv[++i];
+		else if (std::strcmp(argv[i], "--quick") == 0) { r.n = 256; r.repeat = 4; r.accuracy_n = 1024; }
+	}
+
+	run_elementary<float>(r, "float");
+	run_elementary<double>(r, "double");
+	run_special(r);
+
+	if (csv_path != nullptr) {
+		std::ofstream ofs(csv_path);
+		r.rep.write_csv(ofs);
+	}
+	if (json_path != nullptr) {
+		std::ofstream ofs(json_path);
+		r.rep.write_json(ofs);
+	}
+	if (csv_path == nullptr && json_path == nullptr) r.rep.write_csv(std::cout);
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+﻿#ifndef IMATH_EXAMPLE_BENCHMARK_REFERENCE_HPP
+#define IMATH_EXAMPLE_BENCHMARK_REFERENCE_HPP
+
+#include "IMathLib/math/benchmark.hpp"
+
+//multi_float版の関数がない関数のベンチマークの参照値(mpmathによる50桁の計算値をdouble-doubleに丸めたもの)
+//その他の関数は乱数の点列でmulti_float<128>による参照値と比較する
+//fresnel_int_s, fresnel_int_cはsin(t^2), cos(t^2)の積分, gamma_pは正規化された第1種不完全ガンマ関数
+
+namespace bench_reference {
+
+	//digamma
+	const iml::bench::reference_value digamma_reference[] = {
+		{ 17.907100677490234, 0, 2.8570156391137016, -1.4858588295153093e-16 },
+		{ 33.79389953613281, 0, 3.505411766042905, 1.4821382990565711e-16 },
+		{ 14.14900016784668, 0, 2.613889721025008, 1.6388644970822055e-16 },
+		{ 38.73040008544922, 0, 3.6436595177473956, 2.141551755507998e-16 },
+		{ 14.798100471496582, 0, 2.660330333350173, 2.0641923544320316e-16 },
+		{ 27.308000564575195, 0, 3.2887583349442746, -3.2396923346187255e-18 },
+		{ 24.319400787353516, 0, 3.1705738241747996, -1.1842719650310244e-16 },
+		{ 24.605199813842773, 0, 3.1824992635039564, 4.886925197536688e-17 },
+		{ 41.525001525878906, 0, 3.71420642822787, 1.1695933316211142e-16 },
+		{ 44.13629913330078, 0, 3.7759112331952216, -5.0478547821498073e-17 },
+		{ 38.273101806640625, 0, 3.631626456056596, -1.5100101919806195e-16 },
+		{ 30.95789909362793, 0, 3.4163902787263156, 1.7477630408267567e-17 },
+		{ 17.721799850463867, 0, 2.846316417284055, 1.4947377848434596e-16 },
+		{ 17.46980094909668, 0, 2.831579950750943, 2.1125885070859082e-16 },
+		{ 21.16119956970215, 0, 3.0283550907316696, 5.953706165507049e-17 },
+		{ 41.94449996948242, 0, 3.724379437579852, -1.0290253829068022e-16 },
+	};
+	//fresnel_int_s
+	const iml::bench::reference_value fresnel_int_s_reference[] = {
+		{ 4.399590015411377, 0, 0.5260805277111993, 4.026759776825609e-17 },
+		{ 2.4716100692749023, 0, 0.433459470493205, -1.505462619902592e-17 },
+		{ 3.51951003074646, 0, 0.4885220569634582, -1.0963515632001953e-17 },
+		{ 4.886240005493164, 0, 0.5971765890945315, 3.324137450373956e-17 },
+		{ 0.17532700300216675, 0, 0.0017963702755275743, -9.883138435375252e-20 },
+		{ 1.590749979019165, 0, 0.8400739963184076, -2.7715986517754693e-17 },
+		{ 0.623786985874176, 0, 0.08003650426487628, -2.5504934883042597e-18 },
+		{ 1.554919958114624, 0, 0.817901127649831, 2.0969559972635328e-17 },
+		{ 1.2570600509643555, 0, 0.5530222437148343, -1.4161657859305874e-17 },
+		{ 3.2990100383758545, 0, 0.6502350818879732, -4.324288092132135e-17 },
+		{ 4.186009883880615, 0, 0.6011475664410749, 1.5993385244259636e-17 },
+		{ 1.2941299676895142, 0, 0.5900192987589732, -2.1654255118949174e-17 },
+		{ 2.044059991836548, 0, 0.7690572683370086, -4.9275589567426343e-17 },
+		{ 0.5874919891357422, 0, 0.06701738163265447, 4.0818840917406013e-20 },
+		{ 0.411188006401062, 0, 0.023126673971000114, -1.4604042068609754e-18 },
+		{ 0.8098499774932861, 0, 0.17168268644984971, -1.4958303447700641e-18 },
+	};
+	//fresnel_int_c
+	const iml::bench::reference_value fresnel_int_c_reference[] = {
+		{ 0.31687599420547485, 0, 0.3165566610736198, -1.6952880177682518e-17 },
+		{ 4.205689907073975, 0, 0.5165128530890478, -2.2718278908015124e-17 },
+		{ 1.468500018119812, 0, 0.9177942172162362, 3.2643055228349185e-17 },
+		{ 3.4214398860931396, 0, 0.5124985648553625, -4.7571932159059856e-17 },
+		{ 3.830820083618164, 0, 0.7406040933383926, 3.188449891552652e-17 },
+		{ 1.2052099704742432, 0, 0.9745916993425199, -1.6958205681806376e-18 },
+		{ 2.2771100997924805, 0, 0.4268588595077509, -1.616608821578408e-17 },
+		{ 3.1415700912475586, 0, 0.565713880990841, -5.4215606068392305e-17 },
+		{ 2.26813006401062, 0, 0.4229335709697195, 5.3576488337722514e-18 },
+		{ 3.107110023498535, 0, 0.5981748339470427, 2.3188811182143343e-17 },
+		{ 0.3837130069732666, 0, 0.38288201518008164, 1.7422313451768917e-17 },
+		{ 4.29971981048584, 0, 0.5826563560448006, 5.0622734459227916e-17 },
+		{ 4.961309909820557, 0, 0.5750370929789841, 3.650774534039239e-17 },
+		{ 4.828000068664551, 0, 0.5270620225438003, -5.249128705905722e-18 },
+		{ 3.980520009994507, 0, 0.6134757955041237, 3.0018647369446024e-17 },
+		{ 2.969480037689209, 0, 0.7293727017314623, -4.595824228612746e-17 },
+	};
+	//exp_int
+	const iml::bench::reference_value exp_int_reference[] = {
+		{ 17.707849502563477, 0, 2946551.4992680624, -1.6569175352309164e-10 },
+		{ 28.92366600036621, 0, 130623237166.6122, 1.3090002051093033e-06 },
+		{ 28.597753524780273, 0, 95409627529.73544, -4.521538507807935e-06 },
+		{ 6.437172889709473, 0, 121.48595857097868, -5.416586998924166e-15 },
+		{ 16.22452735900879, 0, 734359.7820312508, -5.1123900911955493e-11 },
+		{ 8.077631950378418, 0, 470.31268452136896, -2.5728439194260603e-16 },
+		{ 0.927901029586792, 0, 1.6989561549000467, -4.576978764920141e-17 },
+		{ 4.219716548919678, 0, 22.892818398042976, 9.40706709658058e-16 },
+		{ 21.80171012878418, 0, 141706606.1407924, -3.983050378781758e-09 },
+		{ 8.892850875854492, 0, 945.856904985281, 1.1165754986702552e-14 },
+		{ 19.319555282592773, 0, 13456851.528528064, 4.657686521039077e-10 },
+		{ 8.213273048400879, 0, 527.7590222261617, 4.8417642634390106e-14 },
+		{ 9.542811393737793, 0, 1666.4016650050328, -2.918310859663251e-14 },
+		{ 2.4568495750427246, 0, 6.866182305495669, 4.327724636922728e-17 },
+		{ 19.324281692504883, 0, 13517091.406337576, -8.423582721302026e-10 },
+		{ 6.968575954437256, 0, 186.64748535022804, 8.111760874182887e-15 },
+	};
+	//gamma_p
+	const iml::bench::reference_value gamma_p_reference[] = {
+		{ 14.150699615478516, 16.19070053100586, 0.7277362655721011, -3.7819210986616857e-17 },
+		{ 2.0569300651550293, 9.043270111083984, 0.9986796448116931, -4.762262589610603e-17 },
+		{ 5.5838398933410645, 10.46399974822998, 0.9633293450060724, -4.763160672927917e-17 },
+		{ 1.5801600217819214, 3.233799934387207, 0.8984821670211586, -3.961066658466171e-17 },
+		{ 2.5831000804901123, 18.67099952697754, 0.9999993829549801, -4.8950439010879667e-17 },
+		{ 13.19890022277832, 22.820199966430664, 0.9885714920994899, -1.602492254367887e-17 },
+		{ 19.35740089416504, 25.531999588012695, 0.9116548200078733, 2.4681212909555164e-17 },
+		{ 17.46980094909668, 24.782800674438477, 0.9483767579496372, 1.4500833308020127e-17 },
+		{ 11.039400100708008, 20.723400115966797, 0.992491935142717, 3.6490836165612646e-17 },
+		{ 19.486799240112305, 16.045499801635742, 0.22540034761883843, -7.19856241669409e-18 },
+		{ 0.520924985408783, 25.7731990814209, 0.9999999999992204, -1.546522299656176e-17 },
+		{ 6.4232001304626465, 20.48979949951172, 0.9999130676285951, 4.006443302547379e-17 },
+		{ 0.7950519919395447, 21.064800262451172, 0.9999999996776973, -1.2505948640988385e-17 },
+		{ 11.435099601745605, 16.574399948120117, 0.9241257773484096, 5.2321425108166045e-17 },
+		{ 18.34779930114746, 27.928800582885742, 0.9777864035043132, 1.2679481230534749e-17 },
+		{ 6.936349868774414, 19.108699798583984, 0.9995526647339639, 7.086463017954164e-18 },
+	};
+}
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,120 @@
+﻿//big_intの領域確保の検査
+//使い方: big_int_test (失敗した項目を標準出力に出力し, 失敗があれば1を返す)
+//結果がオブジェクト内の2要素に収まる演算でアロケータを呼ばないことを確かめる
+
+#include "IMathLib/math/multi/big_int.hpp"
+
+#include <iostream>
+#include <cstdint>
+
+
+namespace {
+
+	//確保の回数を数えるアロケータ
+	std::size_t allocations = 0;
+	template <class T>
+	struct counting_allocator {
+		using value_type = T;
+		using pointer = T*;
+
+		template <class Other>
+		struct rebind {
+			using other = counting_allocator<Other>;
+		};
+		template <class Other>
+		using rebind_t = counting_allocator<Other>;
+
+		counting_allocator() = default;
+		template <class U>
+		counting_allocator(const counting_allocator<U>&) {}
+
+		T* allocate(std::size_t n) {
+			++allocations;
+			return static_cast<T*>(::operator new(n * sizeof(T)));
+		}
+		void deallocate(T* p, std::size_t) { ::operator delete(static_cast<void*>(p)); }
+	};
+	template <class T, class U>
+	bool operator==(const counting_allocator<T>&, const counting_allocator<U>&) { return true; }
+	template <class T, class U>
+	bool operator!=(const counting_allocator<T>&, const counting_allocator<U>&) { return false; }
+
+	using integer = iml::big_int<counting_allocator<iml::limb_t>>;
+
+	//値が符号sと下位からの2要素(lo, hi)に一致し, 演算中の確保がexpected回であるか
+	std::size_t check(const char* name, const integer& x, int s, std::uint64_t lo, std::uint64_t hi, std::size_t count, std::size_t expected) {
+		if (x.sign() == s && x[0] == lo && x[1] == hi && x.size() <= 2 && count == expected) return 0;
+		std::cout << name << ": sign " << x.sign() << ", limbs " << x[0] << ' ' << x[1] << " (size " << x.size()
+			<< "), allocations " << count << " (expected " << expected << ")\n";
+		return 1;
+	}
+}
+
+
+int main() {
+	const std::uint64_t max = ~std::uint64_t(0);
+	std::size_t failed = 0, before;
+
+	//加算の桁上がりで2要素目に達する
+	integer a(max);
+	before = allocations;
+	a += integer(1);
+	failed += check("max + 1", a, 1, 0, 1, allocations - before, 0);
+	//2要素同士の加算で桁上がりがない
+	integer b(a);
+	before = allocations;
+	b += a;
+	failed += check("2^65", b, 1, 0, 2, allocations - before, 0);
+	before = allocations;
+	b -= integer(3);
+	failed += check("2^65 - 3", b, 1, max - 2, 1, allocations - before, 0);
+
+	//左シフトで2要素目に達する(はみ出すビットがなければ伸ばさない)
+	integer c(5);
+	before = allocations;
+	c <<= 70;
+	failed += check("5 << 70", c, 1, 0, 5ull << 6, allocations - before, 0);
+	integer d(1);
+	d <<= 127;
+	before = allocations;
+	d >>= 127;
+	d <<= 127;
+	failed += check("1 << 127", d, 1, 0, 1ull << 63, allocations - before, 0);
+
+	//2要素と1要素の積が2要素に収まる
+	integer e(integer(1) << 80), f(1ull << 40);
+	before = allocations;
+	e *= f;
+	failed += check("2^80 * 2^40", e, 1, 0, 1ull << 56, allocations - before, 0);
+	integer g(-3);
+	before = allocations;
+	g *= integer(max);
+	failed += check("-3 * (2^64 - 1)", g, -1, max - 2, 2, allocations - before, 0);
+
+	//負数の右シフトの切り上げ
+	integer h(-7);
+	before = allocations;
+	h >>= 1;
+	failed += check("-7 >> 1", h, -1, 4, 0, allocations - before, 0);
+
+	//既定のアロケータ(constな参照からの複製で構築する)
+	const iml::allocator<iml::limb_t> alloc;
+	iml::big_int<> m(5, alloc), n(m);
+	n *= iml::big_int<>(max, alloc);
+	if (n[0] != max - 4 || n[1] != 4 || n.sign() != 1) {
+		std::cout << "5 * (2^64 - 1) with the default allocator: limbs " << n[0] << ' ' << n[1] << '\n';
+		++failed;
+	}
+
+	//2要素を超える結果は確保する
+	integer k(integer(1) << 127);
+	before = allocations;
+	k += k;
+	if (allocations - before == 0 || k.size() != 3) {
+		std::cout << "2^127 + 2^127: size " << k.size() << ", allocations " << allocations - before << '\n';
+		++failed;
+	}
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,217 @@
+﻿//重み付きの離散分布(エイリアス法, Fenwick木)と重み付きのリザーバサンプリングの検査
+//使い方: discrete_sampling_test (失敗した項目を標準出力に出力し, 失敗があれば1を返す)
+//度数は期待される確率に対するカイ二乗検定(Wilson-Hilfertyの変換で|z| < 5)で調べる
+
+#include "IMathLib/math/statistics.hpp"
+
+#include <iostream>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+
+namespace {
+
+	//度数countと確率pのカイ二乗検定(確率0の添字に度数があれば失敗とする)
+	std::size_t check_chi2(const char* name, const std::vector<double>& count, const std::vector<double>& p) {
+		double total = 0, c = 0, df = -1;
+		for (double k : count) total += k;
+		for (std::size_t i = 0; i < count.size(); ++i) {
+			if (p[i] == 0) {
+				if (count[i] == 0) continue;
+				std::cout << name << ": the index " << i << " with probability 0 was drawn " << count[i] << " times\n";
+				return 1;
+			}
+			const double e = total * p[i];
+			c += (count[i] - e) * (count[i] - e) / e;
+			df += 1;
+		}
+		if (df < 1) return 0;
+		const double v = 2 / (9 * df), z = (std::cbrt(c / df) - (1 - v)) / std::sqrt(v);
+		if (std::fabs(z) < 5) return 0;
+		std::cout << name << ": chi-square " << c << " with " << df << " degrees of freedom (z = " << z << ")\n";
+		return 1;
+	}
+
+	std::vector<double> normalize(std::vector<double> w) {
+		double s = 0;
+		for (double x : w) s += x;
+		for (double& x : w) x /= s;
+		return w;
+	}
+
+	//エイリアス法: 1個ずつと一括生成が同じ列となり, 度数が重みに比例するか
+	template <class Engine>
+	std::size_t check_alias(const char* name, Engine& g, const std::vector<double>& w, std::size_t n) {
+		iml::stats::stats::discrete_distribution<std::size_t, double> d(w.begin(), w.end());
+		const std::vector<double> p = normalize(w);
+		std::size_t failed = 0;
+		for (std::size_t i = 0; i < w.size(); ++i) {
+			if (std::fabs(d.probability(i) - p[i]) <= 1e-15 * (1 + p[i])) continue;
+			std::cout << name << ": probability(" << i << ") is " << d.probability(i) << ", expected " << p[i] << '\n';
+			++failed;
+			break;
+		}
+		Engine h = g;
+		std::vector<std::size_t> block(n);
+		d.fill(&h, block.begin(), block.end());
+		std::vector<double> count(w.size(), 0);
+		for (std::size_t i = 0; i < n; ++i) {
+			std::size_t k = d(&g);
+			if (k != block[i]) {
+				std::cout << name << ": fill differs from operator() at " << i << '\n';
+				return failed + 1;
+			}
+			count[k] += 1;
+		}
+		return failed + check_chi2(name, count, p);
+	}
+
+	//重み付きのリザーバサンプリングで要素iが選ばれる確率(重みに比例する非復元抽出)
+	//k個を順に引く全ての順序について確率を足し合わせる(要素数が小さい場合のみ)
+	void inclusion(const std::vector<double>& w, std::size_t k, std::vector<bool>& used, double prob, double rest, std::vector<double>& out) {
+		if (k == 0) return;
+		for (std::size_t i = 0; i < w.size(); ++i) {
+			if (used[i] || w[i] == 0) continue;
+			const double q = prob * w[i] / rest;
+			out[i] += q;
+			used[i] = true;
+			inclusion(w, k - 1, used, q, rest - w[i], out);
+			used[i] = false;
+		}
+	}
+
+	//リザーバサンプリングを繰り返したときの各要素の抽出回数が包含確率に比例するか
+	template <class Engine>
+	std::size_t check_reservoir(const char* name, Engine& g, const std::vector<double>& w, std::size_t k, std::size_t trials) {
+		iml::stats::stats::weighted_reservoir_sampling<std::size_t, double> r(k);
+		std::vector<double> count(w.size(), 0), p(w.size(), 0);
+		std::size_t failed = 0;
+		for (std::size_t t = 0; t < trials; ++t) {
+			r.clear();
+			for (std::size_t i = 0; i < w.size(); ++i) r.push(&g, i, w[i]);
+			std::vector<bool> seen(w.size(), false);
+			for (std::size_t i = 0; i < r.size(); ++i) {
+				if (seen[r[i]]) {
+					std::cout << name << ": the element " << r[i] << " was selected twice\n";
+					return 1;
+				}
+				seen[r[i]] = true;
+				count[r[i]] += 1;
+			}
+		}
+		//正の重みの要素数がk以下ならば全てが選ばれる
+		std::size_t positive = 0;
+		for (double x : w) positive += (x > 0) ? 1 : 0;
+		if (r.size() != ((positive < k) ? positive : k)) {
+			std::cout << name << ": " << r.size() << " elements were selected\n";
+			++failed;
+		}
+		//度数の和に対する割合は包含確率をその和(選ばれる個数)で割ったもの
+		//(非復元抽出の度数は多項分布より分散が小さいため, 検定は保守的になる)
+		if (w.size() <= 8) {
+			std::vector<bool> used(w.size(), false);
+			double sum = 0;
+			for (double x : w) sum += x;
+			inclusion(w, k, used, 1, sum, p);
+		}
+		else for (std::size_t i = 0; i < w.size(); ++i) p[i] = (w[i] > 0) ? 1 : 0;		//要素数が多い場合は等しい重みのみを用いる
+		return failed + check_chi2(name, count, normalize(p));
+	}
+}
+
+
+int main() {
+	using namespace iml;
+	std::size_t failed = 0;
+	rnd::Xoshiro256_starstar<4> g(3);
+	const std::size_t n = std::size_t(1) << 22;
+
+	//エイリアス法(重い列が複数の軽い列を埋める場合, 極端な重み, 0の重み, 2の冪でない大きさ)
+	{
+		std::vector<double> w;
+		for (int i = 1; i <= 10; ++i) w.push_back(i);
+		failed += check_alias("alias 1..10", g, w, n);
+		failed += check_alias("alias single", g, std::vector<double>(1, 2.5), 1000);
+		failed += check_alias("alias skewed", g, { 1e6, 1, 1, 1, 1, 0, 1, 1, 1 }, n);
+		failed += check_alias("alias zeros", g, { 0, 3, 0, 0, 1, 0 }, n);
+		std::vector<double> r(1000);
+		for (double& x : r) x = -std::log(1 - g.unit<double>());
+		failed += check_alias("alias random 1000", g, r, n);
+		std::vector<double> geometric(60);
+		for (std::size_t i = 0; i < 60; ++i) geometric[i] = std::ldexp(1., -int(i));
+		failed += check_alias("alias geometric", g, geometric, n);
+		//32ビットのエンジン(bits64で2回の出力を連結する)
+		rnd::mersenne_twister_19937_32 h(3);
+		failed += check_alias("alias mt19937", h, w, n);
+
+		//不正な重みでは例外を送出し, 分布は変更しない
+		stats::stats::discrete_distribution<int, double> d(w.begin(), w.end());
+		const std::vector<double> bad[2] = { std::vector<double>(), { 0, 0 } };
+		for (const auto& b : bad) {
+			bool thrown = false;
+			try { d.reset(b.begin(), b.end()); }
+			catch (const std::invalid_argument&) { thrown = true; }
+			if (!thrown || d.size() != 10) {
+				std::cout << "alias: invalid weights were accepted\n";
+				++failed;
+			}
+		}
+	}
+
+	//Fenwick木による重みの更新
+	{
+		const std::size_t m = 37;
+		std::vector<double> w(m);
+		for (std::size_t i = 0; i < m; ++i) w[i] = double(i % 5);
+		stats::stats::dynamic_discrete_distribution<std::size_t, double> d(w.begin(), w.end());
+		//更新を重ねた後の部分和を逐次の和と比べる
+		for (std::size_t t = 0; t < 100000; ++t) {
+			std::size_t i = std::size_t(g() % m);
+			double x = double(g() % 8);
+			w[i] = x;
+			if (t % 2) d.set(i, x);
+			else d.add(i, x - d.weight(i));
+		}
+		double s = 0;
+		for (std::size_t i = 0; i <= m; ++i) {
+			if (std::fabs(d.prefix_sum(i) - s) > 1e-9) {
+				std::cout << "dynamic: prefix_sum(" << i << ") is " << d.prefix_sum(i) << ", expected " << s << '\n';
+				++failed;
+				break;
+			}
+			if (i < m) s += w[i];
+		}
+		std::vector<double> count(m, 0);
+		for (std::size_t i = 0; i < n; ++i) count[d(&g)] += 1;
+		failed += check_chi2("dynamic", count, normalize(w));
+
+		//1つを除いて0にした分布
+		for (std::size_t i = 0; i < m; ++i) d.set(i, (i == 20) ? 0.25 : 0);
+		for (std::size_t i = 0; i < 1000; ++i) {
+			if (d(&g) == 20) continue;
+			std::cout << "dynamic: a zero weight was drawn\n";
+			++failed;
+			break;
+		}
+		d.set(20, 0);
+		bool thrown = false;
+		try { d(&g); }
+		catch (const std::invalid_argument&) { thrown = true; }
+		if (!thrown) {
+			std::cout << "dynamic: all zero weights did not throw\n";
+			++failed;
+		}
+	}
+
+	//重み付きのリザーバサンプリング(k = 1では包含確率が重みに比例する)
+	failed += check_reservoir("reservoir k=1", g, { 1, 2, 3, 4, 0, 10 }, 1, 1 << 20);
+	failed += check_reservoir("reservoir k=2", g, { 1, 2, 3, 4, 0, 10 }, 2, 1 << 20);
+	failed += check_reservoir("reservoir k=3", g, { 5, 0.5, 1, 1, 2, 3, 0.1 }, 3, 1 << 20);
+	failed += check_reservoir("reservoir fewer than k", g, { 1, 0, 2 }, 4, 1000);
+	//長い列(読み飛ばしが大半を占める)
+	failed += check_reservoir("reservoir equal 2000", g, std::vector<double>(2000, 1.5), 16, 1 << 14);
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+﻿//初等関数の実行時カーネルの特殊値と精度の検査
+//使い方: elementary_test (失敗した組を標準出力に出力し, 失敗があれば1を返す)
+
+#include "IMathLib/math/math.hpp"
+
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <random>
+#include <vector>
+
+
+namespace {
+
+	//符号を含めて一致するか(有限の非零値は相対誤差toleranceまで許容)
+	template <class T>
+	bool same_value(T a, T b, T tolerance) {
+		if (a != a || b != b) return a != a && b != b;
+		if (std::signbit(a) != std::signbit(b)) return false;
+		if (a == 0 || b == 0 || std::isinf(a) || std::isinf(b)) return a == b;
+		return std::fabs(a - b) <= tolerance * std::fabs(b);
+	}
+
+	//定数評価のpowの特殊値(実行時の結果と同じくIEEE 754のpowに従う)
+	constexpr double inf = std::numeric_limits<double>::infinity(), nan = std::numeric_limits<double>::quiet_NaN();
+	static_assert(iml::pow(0., -1.) == inf, "pow(0, -1)");
+	static_assert(iml::pow(0., 0.5) == 0, "pow(0, 0.5)");
+	static_assert(iml::pow(-inf, 3.) == -inf, "pow(-inf, 3)");
+	static_assert(iml::pow(-inf, -2.) == 0, "pow(-inf, -2)");
+	static_assert(iml::pow(nan, 0.) == 1, "pow(nan, 0)");
+	static_assert(iml::pow(1., nan) == 1, "pow(1, nan)");
+	static_assert(iml::pow(0.5, inf) == 0, "pow(0.5, inf)");
+	static_assert(iml::pow(-1., -inf) == 1, "pow(-1, -inf)");
+	static_assert(iml::pow(-2., 0.5) != iml::pow(-2., 0.5), "pow(-2, 0.5)");
+	static_assert(iml::pow(-2., 3.) < 0, "pow(-2, 3)");
+
+	//0, ±∞, NaN, 負の底と整数の指数の全ての組についてstd::powと比較する
+	//スカラーのpow, スカラーのカーネル, 連続領域のvpow, 汎用の反復子のvpowの4通りの結果が一致することも確かめる
+	template <class T>
+	size_t test_pow_special(const char* type, T tolerance) {
+		const T inf = std::numeric_limits<T>::infinity(), nan = std::numeric_limits<T>::quiet_NaN();
+		const T values[] = {
+			T(0), -T(0), inf, -inf, nan, T(1), T(-1), T(0.5), T(-0.5), T(2), T(-2), T(3), T(-3), T(2.5), T(-2.5)
+			, T(0.001), T(-0.001), std::numeric_limits<T>::max(), -std::numeric_limits<T>::max()
+			, std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min()
+		};
+		const size_t n = sizeof(values) / sizeof(values[0]);
+
+		std::vector<T> x, y;
+		for (size_t i = 0; i < n; ++i) {
+			for (size_t j = 0; j < n; ++j) {
+				x.push_back(values[i]);
+				y.push_back(values[j]);
+			}
+		}
+		std::vector<T> array(x.size());
+		iml::vpow(x.data(), x.data() + x.size(), y.data(), array.data());
+		std::list<T> lx(x.begin(), x.end()), ly(y.begin(), y.end()), generic(x.size());
+		iml::vpow(lx.begin(), lx.end(), ly.begin(), generic.begin());
+
+		size_t failed = 0;
+		typename std::list<T>::const_iterator itr = generic.begin();
+		for (size_t i = 0; i < x.size(); ++i, ++itr) {
+			T expected = std::pow(x[i], y[i]), function = iml::pow(x[i], y[i]), scalar = iml::Elementary_kernel<T>::_pow_(x[i], y[i]);
+			if (same_value(function, expected, tolerance) && same_value(scalar, expected, tolerance)
+				&& same_value(array[i], expected, tolerance) && same_value(*itr, expected, tolerance)) continue;
+			std::cout << type << " pow(" << x[i] << ", " << y[i] << "): expected " << expected << ", pow " << function
+				<< ", kernel " << scalar << ", array " << array[i] << ", generic " << *itr << '\n';
+			++failed;
+		}
+		return failed;
+	}
+
+	//乱数の点でのdouble版のカーネルとstd::の関数の差(max_ulp以内)と配列演算との一致
+	//(乗算と加算の縮約で誤差なし乗算が崩れると数十ulp以上の誤差となる)
+	template <class F, class V, class Ref>
+	size_t test_accuracy(const char* name, F f, V v, Ref ref, double a, double b, double ya, double yb, double max_ulp) {
+		const size_t n = 1 << 16;
+		std::mt19937_64 engine(0x9E3779B97F4A7C15ull);
+		std::uniform_real_distribution<double> dx(a, b), dy(ya, yb);
+		std::vector<double> x(n), y(n), array(n);
+		for (size_t i = 0; i < n; ++i) {
+			x[i] = dx(engine);
+			y[i] = dy(engine);
+		}
+		v(x.data(), x.data() + n, y.data(), array.data());
+
+		double worst = 0, worst_x = 0, worst_y = 0;
+		size_t mismatch = 0;
+		for (size_t i = 0; i < n; ++i) {
+			double value = f(x[i], y[i]), expected = ref(x[i], y[i]);
+			double ulp = std::nextafter(std::fabs(expected), std::numeric_limits<double>::infinity()) - std::fabs(expected);
+			double e = std::fabs(value - expected) / ulp;
+			if (!(e <= worst)) { worst = e; worst_x = x[i]; worst_y = y[i]; }
+			if (array[i] != value) ++mismatch;
+		}
+		if (worst <= max_ulp && mismatch == 0) return 0;
+		std::cout << name << ": max " << worst << " ulp at (" << worst_x << ", " << worst_y << ") (bound " << max_ulp << "), "
+			<< mismatch << " array mismatches\n";
+		return 1;
+	}
+}
+
+
+int main() {
+	size_t failed = 0;
+
+	failed += test_pow_special<float>("float", 2e-7f);
+	failed += test_pow_special<double>("double", 4e-16);
+
+	using K = iml::Elementary_kernel<double>;
+	failed += test_accuracy("exp", [](double x, double) { return K::_exp_(x); }
+		, [](const double* first, const double* last, const double*, double* out) { iml::vexp(first, last, out); }
+		, [](double x, double) { return std::exp(x); }, -700, 700, 0, 0, 2);
+	failed += test_accuracy("log", [](double x, double) { return K::_log_(x); }
+		, [](const double* first, const double* last, const double*, double* out) { iml::vlog(first, last, out); }
+		, [](double x, double) { return std::log(x); }, 1e-3, 1e3, 0, 0, 2);
+	failed += test_accuracy("sin", [](double x, double) { return K::_sin_(x); }
+		, [](const double* first, const double* last, const double*, double* out) { iml::vsin(first, last, out); }
+		, [](double x, double) { return std::sin(x); }, -100, 100, 0, 0, 2);
+	failed += test_accuracy("cos", [](double x, double) { return K::_cos_(x); }
+		, [](const double* first, const double* last, const double*, double* out) { iml::vcos(first, last, out); }
+		, [](double x, double) { return std::cos(x); }, -100, 100, 0, 0, 2);
+	failed += test_accuracy("pow", [](double x, double y) { return K::_pow_(x, y); }
+		, [](const double* first, const double* last, const double* y, double* out) { iml::vpow(first, last, y, out); }
+		, [](double x, double y) { return std::pow(x, y); }, 0.01, 100, -150, 150, 2);
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file
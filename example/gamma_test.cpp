@@ -0,0 +1,124 @@
+﻿//ガンマ関数族の実行時カーネルの精度と特殊値の検査
+//使い方: gamma_test (失敗した項目を標準出力に出力し, 失敗があれば1を返す)
+//lgammaの参照値はlong double版の標準関数のため, long doubleが倍精度より広い処理系で意味をもつ(digammaの参照値はmpmathで求めた表)
+
+#include "IMathLib/math/math.hpp"
+
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+
+namespace {
+
+	//|x|のdoubleでの1ulp
+	double ulp_of(long double x) {
+		double ax = std::fabs(static_cast<double>(x));
+		return std::nextafter(ax, std::numeric_limits<double>::infinity()) - ax;
+	}
+
+	//[a, b]をn等分した点でのlgammaの最大誤差がmax_ulp以下か(連続領域のvlgammaがスカラーと一致することも確かめる)
+	size_t scan_lgamma(double a, double b, size_t n, double max_ulp) {
+		std::vector<double> x(n + 1), y(n + 1);
+		for (size_t i = 0; i <= n; ++i) x[i] = a + (b - a) * double(i) / double(n);
+		iml::vlgamma(x.data(), x.data() + x.size(), y.data());
+
+		double worst = 0, worst_x = a;
+		size_t mismatch = 0;
+		for (size_t i = 0; i <= n; ++i) {
+			double v = iml::Gamma_kernel<double>::_lgamma_(x[i]);
+			long double ref = std::lgamma(static_cast<long double>(x[i]));
+			double e = static_cast<double>(std::fabs(static_cast<long double>(v) - ref)) / ulp_of(ref);
+			if (e > worst) { worst = e; worst_x = x[i]; }
+			if (v != y[i]) ++mismatch;
+		}
+		if (worst <= max_ulp && mismatch == 0) return 0;
+		std::cout << "lgamma [" << a << ", " << b << "]: max " << worst << " ulp at " << worst_x
+			<< " (bound " << max_ulp << "), " << mismatch << " array mismatches\n";
+		return 1;
+	}
+
+	//ディガンマ関数の参照値(mpmath): 負の零点x[n](n = 0, 1, 2, 3, 23, 60, 127)の最近点とその前後1ulp, ±1e-9, ±0.05, 及び[1.2, 1.8]
+	const double digamma_reference[][2] = {
+		{ -0.5040830082644554, 7.289763902976895e-17 }, { -0.5040830082644553, 1.0654146585779509e-15 }, { -0.5040830082644555, -9.19619380518413e-16 },
+		{ -0.5040830072644554, 8.939798378045658e-09 }, { -0.5040830092644554, -8.93979823386907e-09 }, { -0.4540830082644554, 0.4490218871879285 },
+		{ -0.5540830082644554, -0.4531035926929236 }, { -1.5734984731623904, 1.5649788481838454e-16 }, { -1.5734984731623902, 2.3639573480230873e-15 },
+		{ -1.5734984731623907, -2.050961578386319e-15 }, { -1.5734984721623904, 9.94151458718399e-09 }, { -1.5734984741623905, -9.941514289793411e-09 },
+		{ -1.5234984731623904, 0.4822717059841884 }, { -1.6234984731623905, -0.5219807384930518 }, { -2.6107208684441447, -1.0720275936410002e-15 },
+		{ -2.6107208684441443, 3.7455981709934854e-15 }, { -2.610720868444145, -5.889653358275491e-15 }, { -2.6107208674441447, 1.084832861200562e-08 },
+		{ -2.610720869444145, -1.0848330781602263e-08 }, { -2.560720868444145, 0.5163517251756243 }, { -2.6607208684441446, -0.5814803638966569 },
+		{ -3.635293366436901, -6.354883894064686e-16 }, { -3.6352933664369007, 4.5385680648323184e-15 }, { -3.6352933664369016, -5.809544843645262e-15 },
+		{ -3.635293365436901, 1.1650939671228179e-08 }, { -3.6352933674369012, -1.1650940976081638e-08 }, { -3.5852933664369013, 0.5473093185585934 },
+		{ -3.685293366436901, -0.6338555156811493 }, { -23.752362937385183, -1.6310324112690182e-14 }, { -23.75236293738518, 5.4727786868261925e-14 },
+		{ -23.752362937385186, -8.73484350936439e-14 }, { -23.752362936385182, 1.9995435914150102e-08 }, { -23.752362938385183, -1.9995468662577343e-08 },
+		{ -23.702362937385182, 0.8681951236209635 }, { -23.802362937385183, -1.2015869748202064 }, { -60.79246998985628, 2.705133677037523e-15 },
+		{ -60.79246998985627, 1.9307383829965835e-13 }, { -60.792469989856286, -1.8766357094559445e-13 }, { -60.79246998885628, 2.6791922977274703e-08 },
+		{ -60.792469990856276, -2.6791917787674446e-08 }, { -60.74246998985628, 1.1184873463326657 }, { -60.842469989856276, -1.7045959229588563 },
+		{ -127.81717272937543, -6.646434318064533e-14 }, { -127.81717272937541, 4.0857689967434705e-13 }, { -127.81717272937544, -5.415055860357033e-13 },
+		{ -127.81717272837543, 3.342811059180629e-08 }, { -127.81717273037543, -3.342824384512424e-08 }, { -127.76717272937543, 1.3538507226092618 },
+		{ -127.86717272937543, -2.2315346237305933 }, { -0.2, 4.034991433293861 }, { -0.9, -9.312643829299969 },
+		{ -127.5, 4.8520328070239644 }, { 1.2, -0.2890398965921884 }, { 1.25, -0.22745353337626542 },
+		{ 1.3, -0.16919088886679962 }, { 1.35, -0.1139280126830882 }, { 1.4616321449683622, -9.241265521729427e-17 },
+		{ 1.5, 0.03648997397857652 }, { 1.6, 0.12604745277347632 }, { 1.7, 0.2085478748734939 },
+		{ 1.8, 0.28499143329386156 }
+	};
+
+	//digamma_referenceとの誤差がmax_ulp以下か(連続領域のvdigammaがスカラーと一致することも確かめる)
+	size_t check_digamma(double max_ulp) {
+		const size_t n = sizeof(digamma_reference) / sizeof(digamma_reference[0]);
+		std::vector<double> x(n), y(n);
+		for (size_t i = 0; i < n; ++i) x[i] = digamma_reference[i][0];
+		iml::vdigamma(x.data(), x.data() + x.size(), y.data());
+
+		size_t failed = 0;
+		for (size_t i = 0; i < n; ++i) {
+			double v = iml::Gamma_kernel<double>::_digamma_(x[i]), ref = digamma_reference[i][1];
+			double e = std::fabs(v - ref) / ulp_of(ref);
+			if (e <= max_ulp && v == y[i]) continue;
+			std::cout << "digamma(" << x[i] << "): " << e << " ulp (bound " << max_ulp << "), array " << y[i] << '\n';
+			++failed;
+		}
+		return failed;
+	}
+
+	size_t check(const char* name, double value, double expected) {
+		if (value == expected && std::signbit(value) == std::signbit(expected)) return 0;
+		if (value != value && expected != expected) return 0;
+		std::cout << name << ": expected " << expected << ", got " << value << '\n';
+		return 1;
+	}
+}
+
+
+int main() {
+	const double inf = std::numeric_limits<double>::infinity(), nan = std::numeric_limits<double>::quiet_NaN();
+	size_t failed = 0;
+
+	//正の軸(極小点1.46と零点1, 2の近傍を含む)
+	failed += scan_lgamma(1.3, 1.7, 100000, 1.5);
+	failed += scan_lgamma(0.7, 1.3, 100000, 1.5);
+	failed += scan_lgamma(1.7, 2.3, 100000, 1.5);
+	failed += scan_lgamma(1e-3, 0.7, 100000, 1.5);
+	failed += scan_lgamma(2.3, 8, 100000, 1.5);
+	failed += scan_lgamma(8, 1000, 100000, 1.5);
+	//負の軸(零点を含まない区間)
+	failed += scan_lgamma(-1.999, -0.001, 100000, 3.5);
+	//ディガンマ関数(負の零点の近傍を含む)
+	failed += check_digamma(6);
+
+	failed += check("lgamma(inf)", iml::Gamma_kernel<double>::_lgamma_(inf), inf);
+	failed += check("lgamma(-inf)", iml::Gamma_kernel<double>::_lgamma_(-inf), inf);
+	failed += check("lgamma(nan)", iml::Gamma_kernel<double>::_lgamma_(nan), nan);
+	failed += check("lgamma(0)", iml::Gamma_kernel<double>::_lgamma_(0.), inf);
+	failed += check("lgamma(-3)", iml::Gamma_kernel<double>::_lgamma_(-3.), inf);
+	failed += check("lgamma(1)", iml::Gamma_kernel<double>::_lgamma_(1.), 0);
+	failed += check("lgamma(2)", iml::Gamma_kernel<double>::_lgamma_(2.), 0);
+	failed += check("lgamma(1e308)", iml::Gamma_kernel<double>::_lgamma_(1e308), inf);
+	failed += check("float lgamma(inf)", iml::Gamma_kernel<float>::_lgamma_(std::numeric_limits<float>::infinity()), inf);
+	failed += check("gamma(inf)", iml::Gamma_kernel<double>::_gamma_(inf), inf);
+	failed += check("gamma(-inf)", iml::Gamma_kernel<double>::_gamma_(-inf), nan);
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,204 @@
+﻿//モンテカルロ積分器の検査
+//使い方: monte_carlo_test (失敗した項目を標準出力に出力し, 失敗があれば1を返す)
+//推定値は既知の積分値との差を標準誤差の5倍まで許容し, スレッド数によらず同じ結果となることと分散低減法で誤差が減ることを調べる
+
+#include "IMathLib/math/monte_carlo.hpp"
+
+#include <iostream>
+#include <cmath>
+#include <stdexcept>
+
+
+namespace {
+
+	using integrator = iml::monte_carlo_integrator<double>;
+	using result = iml::integration_result<double>;
+
+	//既知の値との差が標準誤差の5倍以内で, 誤差が正であり評価回数が反復あたりの評価回数の倍数か
+	std::size_t check_value(const char* name, const result& r, double exact, uint64_t per_replicate = 1) {
+		std::size_t failed = 0;
+		if (!(r.error > 0) || !(std::fabs(r.value - exact) <= 5 * r.error)) {
+			std::cout << name << ": " << r.value << " +- " << r.error << ", expected " << exact << '\n';
+			++failed;
+		}
+		if (r.evaluations == 0 || r.evaluations % per_replicate != 0) {
+			std::cout << name << ": " << r.evaluations << " evaluations\n";
+			++failed;
+		}
+		return failed;
+	}
+
+	//2つの結果がビット単位で一致するか
+	std::size_t check_same(const char* name, const result& a, const result& b) {
+		if (a.value == b.value && a.error == b.error && a.evaluations == b.evaluations) return 0;
+		std::cout << name << ": " << a.value << " +- " << a.error << " (" << a.evaluations << ") differs from "
+			<< b.value << " +- " << b.error << " (" << b.evaluations << ")\n";
+		return 1;
+	}
+
+	//同じ評価回数で誤差がratio倍未満に減るか
+	std::size_t check_reduced(const char* name, const result& plain, const result& reduced, double ratio) {
+		if (reduced.error < ratio * plain.error) return 0;
+		std::cout << name << ": the error " << reduced.error << " is not below " << ratio << " times " << plain.error << '\n';
+		return 1;
+	}
+
+	double exp_sum3(const double* x) { return std::exp(x[0] + x[1] + x[2]); }
+}
+
+
+int main() {
+	using namespace iml;
+	std::size_t failed = 0;
+	const double e = 2.71828182845904523536, pi = 3.14159265358979323846;
+
+	//[0, 1]^3での∫exp(x + y + z) = (e - 1)^3(許容値で停止する)
+	{
+		integrator mc(3, 1);
+		mc.set_tolerance(0, 1e-3);
+		mc.set_threads(1);
+		result r = mc.integrate(exp_sum3);
+		failed += check_value("exp(x + y + z)", r, (e - 1) * (e - 1) * (e - 1));
+		if (!(r.error <= 1e-3 * std::fabs(r.value))) {
+			std::cout << "exp(x + y + z): stopped with the error " << r.error << '\n';
+			++failed;
+		}
+		//スレッド数によらず同じ結果となる(1スレッドは呼び出し元で順に計算する)
+		const std::size_t threads[] = { 2, 3, 8, 0 };
+		for (std::size_t t : threads) {
+			mc.set_threads(t);
+			failed += check_same("exp(x + y + z) threads", mc.integrate(exp_sum3), r);
+		}
+		//シード値を変えると異なる結果となる
+		mc.set_seed(2);
+		result s = mc.integrate(exp_sum3);
+		if (s.value == r.value) {
+			std::cout << "exp(x + y + z): the seed was ignored\n";
+			++failed;
+		}
+		failed += check_value("exp(x + y + z) seed 2", s, (e - 1) * (e - 1) * (e - 1));
+	}
+
+	//評価回数の上限まで計算し, 分散低減法の効果を比べる(∫[-1, 2]exp(x)dx = e^2 - 1/e)
+	{
+		const double lo[1] = { -1 }, hi[1] = { 2 }, exact = e * e - 1 / e;
+		auto f = [](const double* x) { return std::exp(x[0]); };
+		integrator mc(1, 5);
+		mc.set_box(lo, hi);
+		mc.set_tolerance(0, 0);
+		mc.set_max_samples(uint64_t(1) << 20);
+		mc.set_threads(4);
+		result plain = mc.integrate(f);
+		failed += check_value("exp plain", plain, exact);
+		if (plain.evaluations > (uint64_t(1) << 20)) {
+			std::cout << "exp plain: " << plain.evaluations << " evaluations exceed the limit\n";
+			++failed;
+		}
+		//制御変量g(x) = 1 + x + x^2/2(∫[-1, 2]g = 6)
+		result control = mc.integrate(f, [](const double* x) { return 1 + x[0] + x[0] * x[0] / 2; }, 6.);
+		failed += check_value("exp control variate", control, exact);
+		failed += check_reduced("exp control variate", plain, control, 0.2);
+		//対称変量法(単調な関数では誤差が減る. 評価回数は反復あたり2回)
+		mc.set_antithetic(true);
+		result anti = mc.integrate(f);
+		failed += check_value("exp antithetic", anti, exact, 2);
+		failed += check_reduced("exp antithetic", plain, anti, 0.5);
+		//層別抽出法(8層と対称変量法の併用)
+		mc.set_strata(8);
+		result strata = mc.integrate(f);
+		failed += check_value("exp strata", strata, exact, 16);
+		failed += check_reduced("exp strata", anti, strata, 0.2);
+		mc.set_threads(1);
+		failed += check_same("exp strata threads", mc.integrate(f), strata);
+	}
+	//多次元の層別抽出法(4^3の胞)
+	{
+		integrator mc(3, 9);
+		mc.set_tolerance(0, 0);
+		mc.set_max_samples(uint64_t(1) << 18);
+		result plain = mc.integrate(exp_sum3);
+		mc.set_strata(4);
+		result strata = mc.integrate(exp_sum3);
+		failed += check_value("exp(x + y + z) strata", strata, (e - 1) * (e - 1) * (e - 1), 64);
+		failed += check_reduced("exp(x + y + z) strata", plain, strata, 0.5);
+	}
+
+	//分布から生成した点での期待値(E[X^2] = 1, 制御変量はE[X] = 0)
+	{
+		integrator mc(1, 3);
+		mc.set_tolerance(0, 0);
+		mc.set_max_samples(uint64_t(1) << 20);
+		mc.set_threads(3);
+		stats::stats::normal_distribution<double> d;
+		auto sampler = [d](auto handle, double* x) mutable { x[0] = d(handle); };
+		auto square = [](const double* x) { return x[0] * x[0]; };
+		result r = mc.expectation(square, sampler);
+		failed += check_value("E[X^2]", r, 1);
+		//E[(X + 1)^2]はXを制御変量とすると誤差が減る
+		auto shifted = [](const double* x) { return (x[0] + 1) * (x[0] + 1); };
+		result plain = mc.expectation(shifted, sampler);
+		result control = mc.expectation(shifted, [](const double* x) { return x[0]; }, 0., sampler);
+		failed += check_value("E[(X + 1)^2]", plain, 2);
+		failed += check_value("E[(X + 1)^2] control variate", control, 2);
+		failed += check_reduced("E[(X + 1)^2] control variate", plain, control, 0.9);
+		mc.set_threads(1);
+		failed += check_same("E[X^2] threads", mc.expectation(square, sampler), r);
+
+		//標準正規分布を提案分布とする重点抽出法での∫exp(-x^2)dx = √π
+		auto density = [pi](const double* x) { return std::exp(-x[0] * x[0] / 2) / std::sqrt(2 * pi); };
+		result is = mc.importance([](const double* x) { return std::exp(-x[0] * x[0]); }, sampler, density);
+		failed += check_value("importance", is, std::sqrt(pi));
+	}
+
+	//例外
+	{
+		//関数の例外はスレッド数によらず呼び出し元へ送出する
+		const std::size_t threads[] = { 1, 4 };
+		for (std::size_t t : threads) {
+			integrator mc(2, 1);
+			mc.set_threads(t);
+			mc.set_batch_size(64);
+			bool thrown = false;
+			try {
+				mc.integrate([](const double* x) -> double {
+					if (x[0] < 1e-3 && x[1] < 0.5) throw std::domain_error("monte_carlo_test");
+					return x[0];
+				});
+			}
+			catch (const std::domain_error&) { thrown = true; }
+			if (!thrown) {
+				std::cout << "monte carlo: the exception was not propagated with " << t << " threads\n";
+				++failed;
+			}
+		}
+		//胞の数が2^63を超える層別抽出法(対称変量法での評価回数が64ビットに収まらない)は変更せずに拒否する
+		const struct { std::size_t dim, k; bool accepted; } cases[] = { { 9, 128, true }, { 9, 129, false }, { 63, 2, true }, { 64, 2, false }, { 40, 3, false } };
+		for (const auto& c : cases) {
+			integrator mc(c.dim, 1);
+			bool thrown = false;
+			try { mc.set_strata(c.k); }
+			catch (const std::length_error&) { thrown = true; }
+			if (thrown == !c.accepted) continue;
+			std::cout << "monte carlo: set_strata(" << c.k << ") in " << c.dim << " dimensions was " << (thrown ? "rejected\n" : "accepted\n");
+			++failed;
+		}
+		//拒否した後も各次元1層のまま(バッチあたり1回の反復で16バッチを計算して停止する. 拒否されなければ計算は終わらないため行わない)
+		integrator mc(40, 1);
+		bool rejected = false;
+		try { mc.set_strata(3); }
+		catch (const std::length_error&) { rejected = true; }
+		mc.set_tolerance(0, 0);
+		mc.set_max_samples(0);
+		mc.set_batch_size(1);
+		mc.set_threads(1);
+		result r = { 0, 0, 16 };
+		if (rejected) r = mc.integrate([](const double* x) { return x[39]; });
+		if (r.evaluations != 16) {
+			std::cout << "monte carlo: " << r.evaluations << " evaluations after the rejected strata\n";
+			++failed;
+		}
+	}
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file
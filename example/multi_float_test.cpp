@@ -0,0 +1,42 @@
+﻿//多倍長浮動小数点数の特殊関数の零点と極の近傍での精度の検査
+//使い方: multi_float_test (失敗した項目を標準出力に出力し, 失敗があれば1を返す)
+//参照値は256ビットに丸めた引数に対して十分な精度で求めた値
+
+#include "IMathLib/math/multi/multi_float.hpp"
+
+#include <iostream>
+
+
+namespace {
+
+	using real = iml::multi_float<256>;
+	using kernel = iml::Multi_float_kernel<256>;
+
+	//相対誤差が2^-250未満であるか
+	std::size_t check(const char* name, const real& value, const char* expected) {
+		real ref(expected);
+		if (abs(value - ref) < abs(ref) * real("5e-76")) return 0;
+		std::cout << name << ": expected " << ref.to_string(80) << ", got " << value.to_string(80) << '\n';
+		return 1;
+	}
+}
+
+
+int main() {
+	const real e("1e-40");
+	std::size_t failed = 0;
+
+	//lgammaの零点1, 2の近傍
+	failed += check("lgamma(1 + 1e-40)", kernel::_lgamma_(real(1) + e), "-5.772156649015328606065120900824024310756257565212533876496310322899956115347116969674e-41");
+	failed += check("lgamma(1 - 1e-40)", kernel::_lgamma_(real(1) - e), "5.772156649015328606065120900824024310259409321806327085001991015975161242665806339048e-41");
+	failed += check("lgamma(2 + 1e-40)", kernel::_lgamma_(real(2) + e), "4.227843350984671393934879099175975689094210546773671091158708891124843005718307054072e-41");
+	//負の零点x0 = -2.4570247382208006...の近傍(相反公式の2項が相殺する)
+	const real x0("-2.45702473822080062303945414765117954323659790903378442096479449528061263426049496170237029");
+	failed += check("lgamma(x0 + 1e-40)", kernel::_lgamma_(x0 + e), "1.515603448021657321637058004711201540731538266368491243760048325332215255825817464774e-40");
+	//極-3の近傍
+	failed += check("gamma(-3 + 1e-40)", kernel::_gamma_(real(-3) + e), "-1666666666666666666666666666666666666857.879060104722811446548508566888934284865190719");
+	failed += check("lgamma(-3 + 1e-40)", kernel::_lgamma_(real(-3) + e), "90.3116442505337723599071808289938660314357962890307480223456708007121498324701334491");
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file
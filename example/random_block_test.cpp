@@ -0,0 +1,191 @@
+﻿//SIMD向けの乱数生成器(SFMT, 多レーンのxorshift128+/xoshiro256**)の参照値と統計的性質の検査
+//使い方: random_block_test (失敗した項目を標準出力に出力し, 失敗があれば1を返す)
+//多レーンの生成器は各レーンをスカラーの参照実装で生成して交互に並べた列と比較する
+
+#include "IMathLib/math/random.hpp"
+
+#include <iostream>
+#include <cmath>
+#include <vector>
+
+
+namespace {
+
+	//Vignaの参照実装(1レーン)
+	struct reference_xorshift128_plus {
+		uint64_t	s[2];
+
+		uint64_t operator()() {
+			uint64_t s1 = s[0];
+			const uint64_t s0 = s[1];
+			const uint64_t result = s0 + s1;
+			s[0] = s0;
+			s1 ^= s1 << 23;
+			s[1] = s1 ^ s0 ^ (s1 >> 18) ^ (s0 >> 5);
+			return result;
+		}
+	};
+	struct reference_xoshiro256_starstar {
+		uint64_t	s[4];
+
+		static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+		uint64_t operator()() {
+			const uint64_t result = rotl(s[1] * 5, 7) * 9;
+			const uint64_t t = s[1] << 17;
+			s[2] ^= s[0];
+			s[3] ^= s[1];
+			s[1] ^= s[2];
+			s[0] ^= s[3];
+			s[2] ^= t;
+			s[3] = rotl(s[3], 45);
+			return result;
+		}
+	};
+
+	//シード値からSplitMix64の出力をレーン順に状態へ割り当てた参照実装をLanes個作り, 交互に並べたn個の出力と比較する
+	template <class Reference, size_t Words, class Engine>
+	std::size_t check_lanes(const char* name, Engine g, uint64_t sd, std::size_t n) {
+		const std::size_t lanes = Engine::lanes;
+		std::vector<Reference> ref(lanes);
+		for (std::size_t j = 0; j < lanes; ++j)
+			for (std::size_t i = 0; i < Words; ++i) ref[j].s[i] = iml::rnd::__splitmix64(sd);
+		for (std::size_t i = 0; i < n; ++i) {
+			uint64_t a = g(), b = ref[i % lanes]();
+			if (a == b) continue;
+			std::cout << name << ": output " << i << " is " << a << ", expected " << b << '\n';
+			return 1;
+		}
+		return 0;
+	}
+
+	//64ビットの出力(32ビットの生成器は2個を連結する)に対する小さな統計的検定の組(固定したシード値に対する決定的な検査のため, 閾値は|z| < 6とする)
+	//・各ビットの頻度: 64個のビット位置ごとに1の数の標準化した値
+	//・上位8ビットと下位8ビットの256区間のカイ二乗値(自由度255を正規近似)
+	//・連続する2出力の上位4ビットの組の256区間のカイ二乗値(レーン間の相関を見る)
+	//・[0, 1)に変換した値の遅れ1から8の自己相関
+	//・上昇連の長さ(1から6以上)のカイ二乗値(Knuthの連の検定の簡略版で, 長さの分布を独立とみなす)
+	template <class Engine>
+	std::size_t check_battery(const char* name, Engine g, std::size_t n, double* worst_z = nullptr) {
+		std::vector<uint64_t> x(n);
+		for (std::size_t i = 0; i < n; ++i) x[i] = (sizeof(typename Engine::result_type) == 8) ? uint64_t(g()) : (uint64_t(g()) << 32) | g();
+
+		std::vector<double> z;
+		const double dn = double(n);
+		//ビットの頻度
+		for (int b = 0; b < 64; ++b) {
+			double ones = 0;
+			for (std::size_t i = 0; i < n; ++i) ones += double((x[i] >> b) & 1);
+			z.push_back((ones - dn / 2) / std::sqrt(dn / 4));
+		}
+		//256区間のカイ二乗
+		auto chi2 = [&](auto bin) {
+			std::vector<double> count(256, 0);
+			std::size_t m = 0;
+			for (std::size_t i = 0; i + 1 < n; ++i, ++m) count[bin(i)] += 1;
+			double e = double(m) / 256, c = 0;
+			for (double k : count) c += (k - e) * (k - e) / e;
+			return (c - 255) / std::sqrt(2. * 255);
+		};
+		z.push_back(chi2([&](std::size_t i) { return std::size_t(x[i] >> 56); }));
+		z.push_back(chi2([&](std::size_t i) { return std::size_t(x[i] & 0xFF); }));
+		z.push_back(chi2([&](std::size_t i) { return std::size_t(((x[i] >> 60) << 4) | (x[i + 1] >> 60)); }));
+		//自己相関
+		std::vector<double> u(n);
+		for (std::size_t i = 0; i < n; ++i) u[i] = double(x[i] >> 11) * (1. / 9007199254740992.) - 0.5;
+		for (std::size_t lag = 1; lag <= 8; ++lag) {
+			double s = 0;
+			for (std::size_t i = 0; i + lag < n; ++i) s += u[i] * u[i + lag];
+			z.push_back(s / (double(n - lag) / 12) * std::sqrt(double(n - lag)));
+		}
+		//上昇連の長さ(連の直後の値は捨てる)
+		{
+			const double p[6] = { 1. / 2, 1. / 3, 1. / 8, 1. / 30, 1. / 144, 1. / 720 };		//長さrの確率 r/(r+1)!
+			std::vector<double> count(6, 0);
+			double runs = 0;
+			for (std::size_t i = 0; i + 1 < n; ) {
+				std::size_t r = 1;
+				while (i + r < n && x[i + r] > x[i + r - 1]) ++r;
+				count[(r < 6) ? r - 1 : 5] += 1;
+				runs += 1;
+				i += r + 1;
+			}
+			double tail = 1 - (p[0] + p[1] + p[2] + p[3] + p[4]), c = 0;
+			for (std::size_t r = 0; r < 6; ++r) {
+				double e = runs * ((r < 5) ? p[r] : tail);
+				c += (count[r] - e) * (count[r] - e) / e;
+			}
+			z.push_back((c - 5) / std::sqrt(2. * 5));
+		}
+
+		double worst = 0;
+		std::size_t at = 0;
+		for (std::size_t i = 0; i < z.size(); ++i) if (std::fabs(z[i]) > worst) { worst = std::fabs(z[i]); at = i; }
+		if (worst_z) *worst_z = worst;
+		if (worst < 6) return 0;
+		std::cout << name << ": statistic " << at << " has |z| = " << worst << '\n';
+		return 1;
+	}
+}
+
+
+int main() {
+	using namespace iml::rnd;
+	std::size_t failed = 0;
+
+	//SFMT19937の参照実装のinit_gen_rand(1234)とinit_gen_rand(4321)の最初の出力
+	{
+		const uint32_t expected[2][5] = {
+			{ 3440181298u, 1564997079u, 1510669302u, 2930277156u, 1452439940u }
+			, { 4079384732u, 3940604218u, 1973847306u, 1909546248u, 2527854230u }
+		};
+		simd_fast_mersenne_twister_19937 g[2] = { simd_fast_mersenne_twister_19937(1234), simd_fast_mersenne_twister_19937(4321) };
+		for (std::size_t k = 0; k < 2; ++k) {
+			for (std::size_t i = 0; i < 5; ++i) {
+				if (g[k]() == expected[k][i]) continue;
+				std::cout << "sfmt19937: output " << i << " for the seed " << ((k == 0) ? 1234 : 4321) << " differs\n";
+				++failed;
+				break;
+			}
+		}
+	}
+
+	//多レーンの生成器とスカラーの参照実装(バッファの境界と状態の再生成を何周もまたぐ)
+	failed += check_lanes<reference_xorshift128_plus, 2>("xorshift128+<1>", Xorshift128_plus<1>(7), 7, 10000);
+	failed += check_lanes<reference_xorshift128_plus, 2>("xorshift128+<4>", Xorshift128_plus<4>(7), 7, 10000);
+	failed += check_lanes<reference_xorshift128_plus, 2>("xorshift128+<8>", Xorshift128_plus<8>(123), 123, 10000);
+	failed += check_lanes<reference_xoshiro256_starstar, 4>("xoshiro256**<1>", Xoshiro256_starstar<1>(7), 7, 10000);
+	failed += check_lanes<reference_xoshiro256_starstar, 4>("xoshiro256**<4>", Xoshiro256_starstar<4>(7), 7, 10000);
+	failed += check_lanes<reference_xoshiro256_starstar, 4>("xoshiro256**<8>", Xoshiro256_starstar<8>(123), 123, 10000);
+	//xoshiro256**の状態{1, 2, 3, 4}からの最初の出力はrotl(2 * 5, 7) * 9
+	if (reference_xoshiro256_starstar{ { 1, 2, 3, 4 } }() != 11520) {
+		std::cout << "xoshiro256**: the reference implementation is broken\n";
+		++failed;
+	}
+
+	//統計的検定(各2^22個の出力)
+	const std::size_t n = std::size_t(1) << 22;
+	failed += check_battery("mt19937", mersenne_twister_19937_32(7), n);
+	failed += check_battery("sfmt19937", simd_fast_mersenne_twister_19937(7), n);
+	failed += check_battery("xorshift128+<4>", Xorshift128_plus<4>(7), n);
+	failed += check_battery("xoshiro256**<4>", Xoshiro256_starstar<4>(7), n);
+	failed += check_battery("xoshiro256**<8>", Xoshiro256_starstar<8>(7), n);
+	//検定が偏りを検出できること(8ビットが常に0となる生成器)
+	{
+		struct stuck_bits {
+			using result_type = uint32_t;
+			Xorshift32_32<uint32_t> g;
+			uint32_t operator()() { return g() & 0xFFFF00FF; }
+		};
+		double z = 0;
+		std::streambuf* saved = std::cout.rdbuf(nullptr);
+		std::size_t detected = check_battery("", stuck_bits{ Xorshift32_32<uint32_t>(7) }, 1 << 16, &z);
+		std::cout.rdbuf(saved);
+		if (detected == 0) {
+			std::cout << "battery: a generator with stuck bits passed (|z| = " << z << ")\n";
+			++failed;
+		}
+	}
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+﻿//乱数エンジンの非仮想のインターフェース(一括生成, 読み飛ばし, [0, 1)への変換)の検査
+//使い方: random_engine_test (失敗した項目を標準出力に出力し, 失敗があれば1を返す)
+//メルセンヌ・ツイスタと線型合同法は<random>の同じ母数のエンジンを参照値とする
+
+#include "IMathLib/math/random.hpp"
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+
+namespace {
+
+	//std::のエンジンとn個の出力が一致するか
+	template <class Engine, class Std>
+	std::size_t check_reference(const char* name, Engine g, Std s, std::size_t n) {
+		for (std::size_t i = 0; i < n; ++i) {
+			auto a = g(), b = s();
+			if (a == b) continue;
+			std::cout << name << ": output " << i << " is " << a << ", expected " << b << '\n';
+			return 1;
+		}
+		return 0;
+	}
+
+	//fill, discard, operator()のどの順に進めても同じ系列となり, times()が出力の数と一致するか
+	//区切りはバッファの境界をまたぐように素数の長さとする
+	template <class Engine>
+	std::size_t check_block(const char* name, Engine g) {
+		using type = typename Engine::result_type;
+		const std::size_t n = 5000;
+		Engine h = g;
+		std::vector<type> expected(n), block(n);
+		for (std::size_t i = 0; i < n; ++i) expected[i] = h();
+		const std::size_t steps[] = { 1, 3, 7, 31, 127, 257, 641, 1021 };
+		std::size_t failed = 0;
+		for (std::size_t i = 0, k = 0; i < n; ++k) {
+			std::size_t len = steps[k % 8];
+			if (len > n - i) len = n - i;
+			switch (k % 3) {
+			case 0:
+				g.fill(block.data() + i, block.data() + i + len);
+				break;
+			case 1:
+				for (std::size_t j = 0; j < len; ++j) block[i + j] = g();
+				break;
+			default:
+				g.discard(len);
+				for (std::size_t j = 0; j < len; ++j) block[i + j] = expected[i + j];
+				break;
+			}
+			i += len;
+		}
+		for (std::size_t i = 0; i < n; ++i) {
+			if (block[i] == expected[i]) continue;
+			std::cout << name << ": block output " << i << " differs\n";
+			++failed;
+			break;
+		}
+		if (g.times() != n || g() != h()) {
+			std::cout << name << ": the state or counter after fill/discard differs\n";
+			++failed;
+		}
+		return failed;
+	}
+
+	//fill_unitがunit<S>()の列と一致し, 全ての値が[0, 1)に入るか(最大の整数出力も1未満に変換されること)
+	template <class S, class Engine>
+	std::size_t check_unit(const char* name, Engine g) {
+		using kernel = iml::rnd::Random_unit_kernel<S, typename Engine::result_type, (Engine::min)(), (Engine::max)()>;
+		const std::size_t n = 1000;
+		Engine h = g;
+		std::vector<S> block(n);
+		g.template fill_unit<S>(block.begin(), block.end());
+		std::size_t failed = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			S u = h.template unit<S>();
+			if (u == block[i] && u >= 0 && u < 1) continue;
+			std::cout << name << ": unit " << i << " is " << u << ", fill_unit " << block[i] << '\n';
+			++failed;
+			break;
+		}
+		S top = kernel::_unit_((Engine::max)()), bottom = kernel::_unit_((Engine::min)());
+		if (!(top < 1) || bottom != 0) {
+			std::cout << name << ": unit of (min, max) is (" << bottom << ", " << top << ")\n";
+			++failed;
+		}
+		return failed;
+	}
+}
+
+
+int main() {
+	using namespace iml::rnd;
+	std::size_t failed = 0;
+
+	//<random>と同じ母数のエンジン(mt19937の10000番目の出力は4123659995, mt19937_64では9981545732273789042)
+	failed += check_reference("mt19937", mersenne_twister_19937_32(), std::mt19937(), 20000);
+	failed += check_reference("mt19937(12345)", mersenne_twister_19937_32(12345), std::mt19937(12345), 20000);
+	failed += check_reference("mt19937_64", mersenne_twister_19937_64(), std::mt19937_64(), 20000);
+	failed += check_reference("minstd", linear_congruential_minstd(1), std::minstd_rand(1), 20000);
+	{
+		mersenne_twister_19937_32 g;
+		g.discard(9999);
+		mersenne_twister_19937_64 h;
+		h.discard(9999);
+		if (g() != 4123659995u || h() != 9981545732273789042ull) {
+			std::cout << "mt19937: the 10000th outputs differ\n";
+			++failed;
+		}
+	}
+	//Marsagliaの論文の初期値と最初の出力
+	{
+		Xorshift32_32<uint32_t> g(2463534242u);
+		Xorshift64_64<uint64_t> h(88172645463325252ull);
+		if (g() != 723471715u || h() != 8748534153485358512ull) {
+			std::cout << "xorshift: the first outputs differ\n";
+			++failed;
+		}
+	}
+
+	failed += check_block("minstd", linear_congruential_minstd(7));
+	failed += check_block("xorshift32", Xorshift32_32<uint32_t>(7));
+	failed += check_block("xorshift64", Xorshift64_64<uint64_t>(7));
+	failed += check_block("mt19937", mersenne_twister_19937_32(7));
+	failed += check_block("mt19937_64", mersenne_twister_19937_64(7));
+	failed += check_block("sfmt19937", simd_fast_mersenne_twister_19937(7));
+	failed += check_block("xorshift128+<4>", Xorshift128_plus<4>(7));
+	failed += check_block("xoshiro256**<8>", Xoshiro256_starstar<8>(7));
+	failed += check_block("philox4x32_10", philox4x32_10(7));
+	failed += check_block("threefry4x64_20", threefry4x64_20(7));
+
+	failed += check_unit<double>("minstd double", linear_congruential_minstd(7));
+	failed += check_unit<float>("minstd float", linear_congruential_minstd(7));
+	failed += check_unit<double>("mt19937 double", mersenne_twister_19937_32(7));
+	failed += check_unit<float>("mt19937 float", mersenne_twister_19937_32(7));
+	failed += check_unit<double>("xoshiro256** double", Xoshiro256_starstar<4>(7));
+	failed += check_unit<float>("philox float", philox4x32_10(7));
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+﻿//乱数エンジンの飛躍(jump)とカウンタベースの生成器の参照値の検査
+//使い方: random_jump_test (失敗した項目を標準出力に出力し, 失敗があれば1を返す)
+//飛躍は逐次の読み飛ばし(<random>のdiscardまたはoperator())と, 飛躍同士の合成の両方と比較する
+
+#include "IMathLib/math/random.hpp"
+
+#include <iostream>
+#include <random>
+
+
+namespace {
+
+	//2つのエンジンの次のn個の出力と計算回数が一致するか
+	template <class Engine>
+	std::size_t check_same(const char* name, const char* what, Engine& a, Engine& b, std::size_t n = 64) {
+		if (a.times() != b.times()) {
+			std::cout << name << ": " << what << ": times() is " << a.times() << ", expected " << b.times() << '\n';
+			return 1;
+		}
+		for (std::size_t i = 0; i < n; ++i) {
+			if (a() == b()) continue;
+			std::cout << name << ": " << what << ": output " << i << " differs\n";
+			return 1;
+		}
+		return 0;
+	}
+
+	//jump(k, e)がk*2^e回の読み飛ばしと一致するか(バッファの途中からの飛躍も含める)
+	template <class Engine>
+	std::size_t check_jump_discard(const char* name, Engine g) {
+		const struct { uint64_t k; std::size_t e; } steps[] = { { 1, 0 }, { 5, 1 }, { 7, 3 }, { 3, 12 }, { 3, 20 }, { 12345, 7 } };
+		std::size_t failed = 0;
+		for (std::size_t pre = 0; pre < 4; ++pre) {
+			for (const auto& s : steps) {
+				Engine a = g, b = g;
+				for (std::size_t i = 0; i < pre; ++i) { a(); b(); }
+				a.jump(s.k, s.e);
+				for (uint64_t i = 0; i < (s.k << s.e); ++i) b();
+				failed += check_same(name, "jump against operator()", a, b);
+			}
+		}
+		return failed;
+	}
+
+	//64ビットを超える距離の飛躍を合成で確かめる
+	//・jump(k, 0), jump(k, 1)をdiscard(k)の1回と2回と比較する(kは2^64に近く, k*2^eは64ビットに収まらない)
+	//・jump(1, e)の2回とjump(1, e + 1)を比較する
+	template <class Engine>
+	std::size_t check_jump_compose(const char* name, Engine g, std::size_t max_e) {
+		std::size_t failed = 0;
+		const uint64_t k = 0xFFFFFFFFFFFFFFF7ull;
+		for (std::size_t pre = 0; pre < 3; ++pre) {
+			for (std::size_t e = 0; e < 2; ++e) {
+				Engine a = g, b = g;
+				for (std::size_t i = 0; i < pre; ++i) { a(); b(); }
+				a.jump(k, e);
+				for (std::size_t i = 0; i <= e; ++i) b.discard(k);
+				failed += check_same(name, "jump(k, e) against discard(k)", a, b);
+			}
+		}
+		const std::size_t es[] = { 2, 3, 40, 63, 64, 100 };
+		for (std::size_t e : es) {
+			if (e > max_e) continue;
+			Engine a = g, b = g;
+			a();
+			b();
+			a.jump(1, e);
+			a.jump(1, e);
+			b.jump(1, e + 1);
+			//計算回数は2^64を法とする
+			failed += check_same(name, "jump(1, e) twice against jump(1, e + 1)", a, b);
+		}
+		return failed;
+	}
+
+	//Random123の既知の出力(128ビットの計数値{lo, hi}と鍵から4個の出力)
+	std::size_t check_philox(uint64_t key, uint64_t lo, uint64_t hi, const uint32_t (&expected)[4]) {
+		iml::rnd::philox4x32_10 g(key);
+		g.jump(lo, 2);
+		g.jump(hi, 66);
+		for (std::size_t i = 0; i < 4; ++i) {
+			if (g() == expected[i]) continue;
+			std::cout << "philox4x32_10: the known answer for the key " << std::hex << key << std::dec << " differs at " << i << '\n';
+			return 1;
+		}
+		return 0;
+	}
+}
+
+
+int main() {
+	using namespace iml::rnd;
+	std::size_t failed = 0;
+
+	//Random123のkat_vectors
+	{
+		const uint32_t zero[4] = { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 };
+		const uint32_t ones[4] = { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd };
+		const uint32_t pi[4] = { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 };
+		failed += check_philox(0, 0, 0, zero);
+		failed += check_philox(0xffffffffffffffffull, 0xffffffffffffffffull, 0xffffffffffffffffull, ones);
+		failed += check_philox(0x299f31d0a4093822ull, 0x85a308d3243f6a88ull, 0x0370734413198a2eull, pi);
+		threefry4x64_20 g(0);
+		const uint64_t expected[4] = { 0x09218ebde6c85537ull, 0x55941f5266d86105ull, 0x4bd25e16282434dcull, 0xee29ec846bd2e40bull };
+		for (std::size_t i = 0; i < 4; ++i) {
+			if (g() == expected[i]) continue;
+			std::cout << "threefry4x64_20: the known answer for the zero key differs at " << i << '\n';
+			++failed;
+			break;
+		}
+	}
+	//k番目のストリームはk*2^64個目の出力から始まる
+	{
+		philox4x32_10 a(7, 3), b(7);
+		threefry4x64_20 c(7, 3), d(7);
+		b.jump(3);
+		d.jump(3);
+		failed += check_same("philox4x32_10", "stream", a, b);
+		failed += check_same("threefry4x64_20", "stream", c, d);
+	}
+
+	//<random>の読み飛ばしとの比較
+	{
+		mersenne_twister_19937_32 g(5);
+		std::mt19937 s(5);
+		g.jump(3, 20);
+		s.discard(3 << 20);
+		mersenne_twister_19937_64 h(5);
+		std::mt19937_64 t(5);
+		h();
+		t();
+		h.jump(1000001, 0);
+		t.discard(1000001);
+		linear_congruential_minstd m(5);
+		std::minstd_rand u(5);
+		m.jump(77, 16);
+		u.discard(77 << 16);
+		if (g() != s() || h() != t() || m() != u()) {
+			std::cout << "jump differs from std::discard\n";
+			++failed;
+		}
+	}
+
+	failed += check_jump_discard("minstd", linear_congruential_minstd(7));
+	failed += check_jump_discard("xorshift32", Xorshift32_32<uint32_t>(7));
+	failed += check_jump_discard("xorshift64", Xorshift64_64<uint64_t>(7));
+	failed += check_jump_discard("mt19937", mersenne_twister_19937_32(7));
+	failed += check_jump_discard("xorshift128+<4>", Xorshift128_plus<4>(7));
+	failed += check_jump_discard("xoshiro256**<1>", Xoshiro256_starstar<1>(7));
+	failed += check_jump_discard("xoshiro256**<8>", Xoshiro256_starstar<8>(7));
+	failed += check_jump_discard("philox4x32_10", philox4x32_10(7));
+	failed += check_jump_discard("threefry4x64_20", threefry4x64_20(7));
+
+	failed += check_jump_compose("minstd", linear_congruential_minstd(7), 100);
+	failed += check_jump_compose("xorshift64", Xorshift64_64<uint64_t>(7), 100);
+	failed += check_jump_compose("mt19937", mersenne_twister_19937_32(7), 64);
+	failed += check_jump_compose("xorshift128+<2>", Xorshift128_plus<2>(7), 100);
+	failed += check_jump_compose("xoshiro256**<4>", Xoshiro256_starstar<4>(7), 100);
+	failed += check_jump_compose("xoshiro256**<8>", Xoshiro256_starstar<8>(7), 100);
+	failed += check_jump_compose("philox4x32_10", philox4x32_10(7), 100);
+	failed += check_jump_compose("threefry4x64_20", threefry4x64_20(7), 100);
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file
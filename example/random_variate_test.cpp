@@ -0,0 +1,176 @@
+﻿//二項分布(BTRS), ポアソン分布(PTRS), ガンマ分布(Marsaglia-Tsang法)とそれを用いる分布の乱数の検査
+//使い方: random_variate_test (失敗した項目を標準出力に出力し, 失敗があれば1を返す)
+//離散分布は確率質量関数に対するカイ二乗検定, 連続分布は分布関数が閉じた形の母数でのKolmogorov-Smirnov検定とモーメントで調べる
+
+#include "IMathLib/math/statistics.hpp"
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+
+namespace {
+
+	//kの度数と確率質量関数logpmf(k)のカイ二乗検定(平均から12σ以遠の確率は無視できるとして両端の区間に含める)
+	//期待度数が20以上になるまで隣り合う値をまとめ, 統計量はWilson-Hilfertyの変換で標準正規に近づけて|z| < 5を合格とする
+	template <class Sample, class LogPmf>
+	std::size_t check_chi2(const char* name, Sample sample, LogPmf logpmf, double mean, double sd, std::size_t n) {
+		const int64_t lo = (std::max)(int64_t(0), int64_t(std::floor(mean - 12 * sd))), hi = int64_t(std::ceil(mean + 12 * sd));
+		std::vector<double> count(std::size_t(hi - lo + 1), 0), expected(count.size());
+		for (std::size_t i = 0; i < n; ++i) {
+			int64_t k = int64_t(sample());
+			if (k < 0) {
+				std::cout << name << ": negative sample " << k << '\n';
+				return 1;
+			}
+			count[std::size_t((std::min)((std::max)(k, lo), hi) - lo)] += 1;
+		}
+		for (int64_t k = lo; k <= hi; ++k) expected[std::size_t(k - lo)] = double(n) * std::exp(logpmf(k));
+
+		std::vector<double> o(1, 0), e(1, 0);
+		for (std::size_t i = 0; i < count.size(); ++i) {
+			if (e.back() >= 20) { o.push_back(0); e.push_back(0); }
+			o.back() += count[i];
+			e.back() += expected[i];
+		}
+		//最後の区間の期待度数が小さければ1つ前にまとめる
+		if (e.size() > 1 && e.back() < 20) {
+			o[o.size() - 2] += o.back();
+			e[e.size() - 2] += e.back();
+			o.pop_back();
+			e.pop_back();
+		}
+		double c = 0;
+		for (std::size_t i = 0; i < o.size(); ++i) c += (o[i] - e[i]) * (o[i] - e[i]) / e[i];
+		const double df = double(o.size() - 1), v = 2 / (9 * df), z = (std::cbrt(c / df) - (1 - v)) / std::sqrt(v);
+		if (std::fabs(z) < 5) return 0;
+		std::cout << name << ": chi-square " << c << " with " << df << " degrees of freedom (z = " << z << ")\n";
+		return 1;
+	}
+
+	//x < aの頻度が確率pの二項分布として5σ以内か
+	template <class Sample>
+	std::size_t check_fraction(const char* name, Sample sample, double a, double p, std::size_t n) {
+		double count = 0;
+		for (std::size_t i = 0; i < n; ++i) count += (sample() < a) ? 1 : 0;
+		const double z = (count - double(n) * p) / std::sqrt(double(n) * p * (1 - p));
+		if (std::fabs(z) < 5) return 0;
+		std::cout << name << ": " << count << " samples below " << a << ", expected " << double(n) * p << '\n';
+		return 1;
+	}
+
+	//Kolmogorov-Smirnov検定(√n D < 1.95は有意水準0.1%)
+	template <class Sample, class CDF>
+	std::size_t check_ks(const char* name, Sample sample, CDF cdf, std::size_t n) {
+		std::vector<double> x(n);
+		for (double& v : x) v = double(sample());
+		std::sort(x.begin(), x.end());
+		double d = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			double f = cdf(x[i]);
+			d = (std::max)(d, (std::max)(f - double(i) / double(n), double(i + 1) / double(n) - f));
+		}
+		double stat = std::sqrt(double(n)) * d;
+		if (stat < 1.95) return 0;
+		std::cout << name << ": Kolmogorov-Smirnov statistic " << stat << '\n';
+		return 1;
+	}
+
+	//平均と分散を期待値と比べる(4次のモーメントm4から求めた標本誤差の5倍まで)
+	template <class Sample>
+	std::size_t check_mean_variance(const char* name, Sample sample, double mean, double var, double m4, std::size_t n) {
+		iml::stats::moment_accumulator<double> acc;
+		for (std::size_t i = 0; i < n; ++i) acc.push(double(sample()));
+		const double se_mean = std::sqrt(var / double(n)), se_var = std::sqrt((m4 - var * var) / double(n));
+		if (std::fabs(acc.mean() - mean) <= 5 * se_mean && std::fabs(acc.variance() - var) <= 5 * se_var) return 0;
+		std::cout << name << ": mean " << acc.mean() << ", variance " << acc.variance() << ", expected " << mean << ", " << var << '\n';
+		return 1;
+	}
+
+	double normal_cdf(double x) { return std::erfc(-x / std::sqrt(2.)) / 2; }
+}
+
+
+int main() {
+	using namespace iml;
+	std::size_t failed = 0;
+	rnd::Xoshiro256_starstar<4> g(11);
+	const double pi = 3.14159265358979323846;
+	const std::size_t n = std::size_t(1) << 20;
+
+	//二項分布(np < 10は逆関数法, それ以外はBTRSで, p > 1/2は1 - pで生成して反転する)
+	{
+		const struct { int64_t n; double p; } params[] = {
+			{ 20, 0.3 }, { 1000, 0.005 }, { 40, 0.5 }, { 1000, 0.3 }, { 100, 0.9 }, { 1000000, 0.02 }, { 3000000000ll, 0.4 }
+		};
+		for (const auto& prm : params) {
+			stats::stats::binomial_distribution<int64_t, double> d(prm.n, prm.p);
+			const double m = double(prm.n) * prm.p, sd = std::sqrt(m * (1 - prm.p));
+			const double lp = std::log(prm.p), lq = std::log1p(-prm.p), ln = std::lgamma(double(prm.n) + 1);
+			auto logpmf = [&](int64_t k) {
+				if (k > prm.n) return -HUGE_VAL;
+				return ln - std::lgamma(double(k) + 1) - std::lgamma(double(prm.n - k) + 1) + double(k) * lp + double(prm.n - k) * lq;
+			};
+			char name[64];
+			std::snprintf(name, sizeof(name), "binomial(%lld, %g)", (long long)prm.n, prm.p);
+			failed += check_chi2(name, [&]() { return d(&g); }, logpmf, m, sd, n);
+		}
+	}
+	//ポアソン分布(λ < 10は一様乱数の積, それ以外はPTRS)
+	{
+		const double params[] = { 0.5, 3, 9.99, 10, 50.5, 1e4, 1e8 };
+		for (double l : params) {
+			stats::stats::poisson_distribution<int64_t, double> d(l);
+			const double ll = std::log(l);
+			char name[64];
+			std::snprintf(name, sizeof(name), "poisson(%g)", l);
+			failed += check_chi2(name, [&]() { return d(&g); }, [&](int64_t k) { return -l + double(k) * ll - std::lgamma(double(k) + 1); }, l, std::sqrt(l), n);
+		}
+	}
+	//ガンマ分布(形状母数が1未満では別の変換を通る)
+	{
+		stats::stats::gamma_distribution<double> half(0.5, 2), one(1, 1), two(2, 3);
+		failed += check_ks("gamma(0.5, 2)", [&]() { return half(&g); }, [](double x) { return std::erf(std::sqrt(x / 2)); }, n);
+		failed += check_ks("gamma(1, 1)", [&]() { return one(&g); }, [](double x) { return -std::expm1(-x); }, n);
+		failed += check_ks("gamma(2, 3)", [&]() { return two(&g); }, [](double x) { return 1 - (1 + x / 3) * std::exp(-x / 3); }, n);
+		const double shapes[] = { 0.01, 0.3, 3.7, 1000 };
+		for (double a : shapes) {
+			stats::stats::gamma_distribution<double> d(a, 1);
+			char name[64];
+			std::snprintf(name, sizeof(name), "gamma(%g, 1)", a);
+			failed += check_mean_variance(name, [&]() { return d(&g); }, a, a, 3 * a * a + 6 * a, n);
+		}
+		//小さな形状母数では0付近の確率P(X < x) ≒ x^a/Γ(a + 1)(U^(1/a)は対数で計算するため1e-100付近の値も生成される)
+		stats::stats::gamma_distribution<double> tiny(0.01, 1);
+		failed += check_fraction("gamma(0.01, 1)", [&]() { return tiny(&g); }, 1e-10, std::exp(0.01 * std::log(1e-10) - std::lgamma(1.01)), n);
+		failed += check_fraction("gamma(0.01, 1)", [&]() { return tiny(&g); }, 1e-100, std::exp(0.01 * std::log(1e-100) - std::lgamma(1.01)), n);
+	}
+	//ベータ分布
+	{
+		stats::stats::beta_distribution<double> uniform(1, 1), square(2, 1), skewed(0.5, 3);
+		failed += check_ks("beta(1, 1)", [&]() { return uniform(&g); }, [](double x) { return x; }, n);
+		failed += check_ks("beta(2, 1)", [&]() { return square(&g); }, [](double x) { return x * x; }, n);
+		const double a = 0.5, b = 3, m = a / (a + b), v = a * b / ((a + b) * (a + b) * (a + b + 1));
+		const double m4 = 3 * a * b * (a * b * (a + b - 6) + 2 * (a + b) * (a + b)) / ((a + b) * (a + b) * (a + b) * (a + b) * (a + b + 1) * (a + b + 2) * (a + b + 3));
+		failed += check_mean_variance("beta(0.5, 3)", [&]() { return skewed(&g); }, m, v, m4, n);
+	}
+	//Χ二乗分布(自由度4以下は正規乱数の2乗和, それ以外はガンマ分布)とt分布
+	{
+		stats::stats::chi_squared_distribution<int, double> c2(2), c7(7);
+		failed += check_ks("chi-squared(2)", [&]() { return c2(&g); }, [](double x) { return -std::expm1(-x / 2); }, n);
+		failed += check_mean_variance("chi-squared(7)", [&]() { return c7(&g); }, 7, 14, 12 * 7 * (7 + 4), n);
+		stats::stats::student_t_distribution<double> t1(1), t3(3);
+		failed += check_ks("student t(1)", [&]() { return t1(&g); }, [&](double x) { return 0.5 + std::atan(x) / pi; }, n);
+		failed += check_ks("student t(3)", [&]() { return t3(&g); }, [&](double x) {
+			const double s = std::sqrt(3.);
+			return 0.5 + (x / (s * (1 + x * x / 3)) + std::atan(x / s)) / pi;
+		}, n);
+		stats::stats::student_t_distribution<double> t1000(1000);
+		failed += check_ks("student t(1000)", [&]() { return t1000(&g); }, [](double x) { return normal_cdf(x * (1 - 1. / 4000)); }, n / 16);
+	}
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file
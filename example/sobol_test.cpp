@@ -0,0 +1,164 @@
+﻿//Sobol列(Joe and Kuoの方向数)とスクランブルの検査
+//使い方: sobol_test (失敗した項目を標準出力に出力し, 失敗があれば1を返す)
+//参照値はJoe and Kuoのnew-joe-kuo-6.21201の表から32ビットの方向数で求めた点(SciPyのSobol(scramble=False, bits=32)と同じ)
+
+#include "IMathLib/math/random.hpp"
+
+#include <iostream>
+#include <vector>
+
+
+namespace {
+
+	//先頭の2^m点の各次元の上位mビットが全て異なるか(各次元は(0, m, 1)-ネットで, スクランブルしても保たれる)
+	std::size_t check_strata(const char* name, iml::rnd::sobol_sequence s, std::size_t m) {
+		const std::size_t dim = s.dimension(), n = std::size_t(1) << m;
+		std::vector<uint32_t> p(dim);
+		std::vector<std::vector<bool>> seen(dim, std::vector<bool>(n, false));
+		s.seek(0);
+		for (std::size_t i = 0; i < n; ++i) {
+			s.next_bits(p.begin());
+			for (std::size_t d = 0; d < dim; ++d) {
+				std::size_t k = std::size_t(p[d] >> (32 - m));
+				if (!seen[d][k]) { seen[d][k] = true; continue; }
+				std::cout << name << ": the dimension " << d << " has two of the first " << n << " points in one interval\n";
+				return 1;
+			}
+		}
+		return 0;
+	}
+
+	//1, 2次元目の先頭の2^m点が(0, m, 2)-ネットであるか(2^-a×2^-(m - a)の全ての基本区間に1点ずつ)
+	std::size_t check_net(const char* name, iml::rnd::sobol_sequence s, std::size_t m) {
+		const std::size_t n = std::size_t(1) << m;
+		std::vector<uint32_t> x(n), y(n), p(s.dimension());
+		s.seek(0);
+		for (std::size_t i = 0; i < n; ++i) {
+			s.next_bits(p.begin());
+			x[i] = p[0];
+			y[i] = p[1];
+		}
+		for (std::size_t a = 0; a <= m; ++a) {
+			std::vector<bool> seen(n, false);
+			for (std::size_t i = 0; i < n; ++i) {
+				std::size_t box = ((a == 0) ? 0 : std::size_t(x[i] >> (32 - a)) << (m - a)) | ((a == m) ? 0 : std::size_t(y[i] >> (32 - (m - a))));
+				if (!seen[box]) { seen[box] = true; continue; }
+				std::cout << name << ": the elementary intervals 2^-" << a << " x 2^-" << (m - a) << " are not balanced\n";
+				return 1;
+			}
+		}
+		return 0;
+	}
+}
+
+
+int main() {
+	using iml::rnd::sobol_sequence;
+	std::size_t failed = 0;
+
+	//参照値(次元, 点の番号, 32ビットの値)
+	{
+		const struct { std::size_t d; uint64_t n; uint32_t v; } reference[] = {
+			{ 0, 3, 0x40000000 }, { 1, 3, 0xC0000000 }, { 2, 3, 0xC0000000 },
+			{ 9, 3, 0x40000000 }, { 99, 3, 0x40000000 }, { 999, 3, 0x40000000 },
+			{ 9999, 3, 0xC0000000 }, { 21199, 3, 0x40000000 }, { 21200, 3, 0x40000000 },
+			{ 0, 100, 0x6A000000 }, { 1, 100, 0x42000000 }, { 2, 100, 0xC6000000 },
+			{ 9, 100, 0xB2000000 }, { 99, 100, 0xE2000000 }, { 999, 100, 0xEA000000 },
+			{ 9999, 100, 0xB6000000 }, { 21199, 100, 0xDE000000 }, { 21200, 100, 0x92000000 },
+			{ 0, 1023, 0x00400000 }, { 1, 1023, 0xC0C00000 }, { 2, 1023, 0x9CC00000 },
+			{ 9, 1023, 0xD9C00000 }, { 99, 1023, 0x87C00000 }, { 999, 1023, 0xDB400000 },
+			{ 9999, 1023, 0xB6C00000 }, { 21199, 1023, 0xDA400000 }, { 21200, 1023, 0x3D400000 },
+			{ 0, 65537, 0x80018000 }, { 1, 65537, 0xFFFF8000 }, { 2, 65537, 0xF8D58000 },
+			{ 9, 65537, 0xA3CF8000 }, { 99, 65537, 0x7BC08000 }, { 999, 65537, 0xA3FA8000 },
+			{ 9999, 65537, 0x1B088000 }, { 21199, 65537, 0x7D548000 }, { 21200, 65537, 0x37208000 },
+			{ 0, 1000003, 0x46C71000 }, { 1, 1000003, 0x8FD9F000 }, { 2, 1000003, 0x13F79000 },
+			{ 9, 1000003, 0x01207000 }, { 99, 1000003, 0x0CB2D000 }, { 999, 1000003, 0x0A2D7000 },
+			{ 9999, 1000003, 0x4CFCD000 }, { 21199, 1000003, 0x53F73000 }, { 21200, 1000003, 0x84673000 },
+			{ 0, 2147495993, 0xA4140003 }, { 1, 2147495993, 0x85695555 }, { 2, 2147495993, 0x620CBBBB },
+			{ 9, 2147495993, 0x569191D3 }, { 99, 2147495993, 0x13C516BB }, { 999, 2147495993, 0x4AB11879 },
+			{ 9999, 2147495993, 0x63834DF9 }, { 21199, 2147495993, 0x97341587 }, { 21200, 2147495993, 0x39D1DC23 },
+			{ 0, 4294967294, 0x80000001 }, { 1, 4294967294, 0x7FFFFFFF }, { 2, 4294967294, 0x45005555 },
+			{ 9, 4294967294, 0x02FF78F1 }, { 99, 4294967294, 0xD8B73B7D }, { 999, 4294967294, 0xF1CDAAE7 },
+			{ 9999, 4294967294, 0xB6710C67 }, { 21199, 4294967294, 0xC095E9B9 }, { 21200, 4294967294, 0x59565CDD }
+		};
+		sobol_sequence s(21201);
+		std::vector<uint32_t> p(s.dimension());
+		for (const auto& r : reference) {
+			s.seek(r.n);
+			s.next_bits(p.begin());
+			if (p[r.d] == r.v) continue;
+			std::cout << "sobol: the dimension " << r.d << " of the point " << r.n << " is " << std::hex << p[r.d] << ", expected " << r.v << std::dec << '\n';
+			++failed;
+		}
+	}
+
+	//逐次の生成, seek, discardと[0, 1)への変換が一致するか
+	{
+		const std::size_t dim = 64;
+		sobol_sequence a(dim), b(dim);
+		std::vector<uint32_t> p(dim), q(dim);
+		std::vector<double> u(dim);
+		for (uint64_t i = 0; i < 5000; ++i) {
+			sobol_sequence c = b;
+			b.discard(i % 3);
+			c.seek(c.index() + i % 3);
+			a.seek(b.index());
+			a.next_bits(p.begin());
+			c.next(u.begin());
+			b.next_bits(q.begin());
+			bool same = (p == q);
+			for (std::size_t d = 0; d < dim; ++d) same = same && (u[d] == double(p[d]) / 4294967296.);
+			if (same) continue;
+			std::cout << "sobol: sequential, seek, discard and next differ at the point " << b.index() - 1 << '\n';
+			++failed;
+			break;
+		}
+	}
+
+	//ネットの性質(スクランブルの有無によらない)
+	failed += check_net("sobol", sobol_sequence(2), 12);
+	failed += check_net("sobol owen", sobol_sequence(2, 12345), 12);
+	failed += check_net("sobol shift", sobol_sequence(2, 12345, false), 12);
+	failed += check_strata("sobol", sobol_sequence(1000), 11);
+	failed += check_strata("sobol owen", sobol_sequence(1000, 777), 11);
+	failed += check_strata("sobol shift", sobol_sequence(300, 777, false), 11);
+	//表を超える次元の方向数
+	failed += check_strata("sobol beyond the table", sobol_sequence(21300), 8);
+
+	//スクランブルは点を変え, シード値ごとに異なる
+	{
+		sobol_sequence a(8), b(8, 1), c(8, 2);
+		std::vector<uint32_t> p(8), q(8), r(8);
+		a.discard(5);
+		b.discard(5);
+		c.discard(5);
+		a.next_bits(p.begin());
+		b.next_bits(q.begin());
+		c.next_bits(r.begin());
+		if (p == q || q == r) {
+			std::cout << "sobol: scrambling did not change the points\n";
+			++failed;
+		}
+	}
+
+	//set_direction_numbersでJoe and Kuoの表の行を与えると, その行の次元と一致する(3次元目の行はs = 2, a = 1, m = {1, 3})
+	{
+		sobol_sequence a(3), b(3);
+		const uint32_t m[2] = { 1, 3 };
+		a.discard(10);
+		a.set_direction_numbers(1, 2, 1, m);
+		b.discard(10);
+		std::vector<uint32_t> p(3), q(3);
+		for (std::size_t i = 0; i < 100; ++i) {
+			a.next_bits(p.begin());
+			b.next_bits(q.begin());
+			if (p[1] == q[2] && p[2] == q[2]) continue;
+			std::cout << "sobol: set_direction_numbers differs from the table at " << a.index() - 1 << '\n';
+			++failed;
+			break;
+		}
+	}
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file
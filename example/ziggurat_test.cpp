@@ -0,0 +1,151 @@
+﻿//Ziggurat法による正規分布, 指数分布, 半正規分布の乱数の検査
+//使い方: ziggurat_test (失敗した項目を標準出力に出力し, 失敗があれば1を返す)
+//表の各層の面積, Kolmogorov-Smirnov検定, 4次までのモーメントと裾の頻度を調べる(固定したシード値に対する決定的な検査)
+
+#include "IMathLib/math/statistics.hpp"
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+namespace {
+
+	//表の各層の面積がvに一致し, 層の境界が単調であるか(最上層は密度の頂点で閉じる)
+	template <class Density>
+	std::size_t check_table(const char* name) {
+		const iml::stats::ziggurat_table& t = iml::stats::Ziggurat_kernel<Density>::_table_();
+		double worst = std::fabs(t.x[0] * t.f[1] - Density::v) / Density::v;
+		for (std::size_t i = 1; i < 256; ++i) {
+			double e = std::fabs(t.x[i] * (t.f[i + 1] - t.f[i]) - Density::v) / Density::v;
+			if (i < 255 && e > worst) worst = e;
+			if (!(t.x[i + 1] < t.x[i]) || !(t.f[i + 1] > t.f[i])) {
+				std::cout << name << ": the layer " << i << " is not monotone\n";
+				return 1;
+			}
+		}
+		//最上層の面積は表の計算で閉じないため, 漸化式の誤差の蓄積として緩く許容する
+		double top = std::fabs(t.x[255] * (1 - t.f[255]) - Density::v) / Density::v;
+		if (worst < 1e-12 && top < 1e-6) return 0;
+		std::cout << name << ": the layer areas differ from v by " << worst << " (top " << top << ")\n";
+		return 1;
+	}
+
+	//Kolmogorov-Smirnov検定(√n D < 1.95は有意水準0.1%)
+	template <class CDF>
+	std::size_t check_ks(const char* name, std::vector<double> x, CDF cdf) {
+		std::sort(x.begin(), x.end());
+		const double n = double(x.size());
+		double d = 0;
+		for (std::size_t i = 0; i < x.size(); ++i) {
+			double f = cdf(x[i]);
+			d = (std::max)(d, (std::max)(f - double(i) / n, double(i + 1) / n - f));
+		}
+		double stat = std::sqrt(n) * d;
+		if (stat < 1.95) return 0;
+		std::cout << name << ": Kolmogorov-Smirnov statistic " << stat << '\n';
+		return 1;
+	}
+
+	//平均, 分散, 歪度, 超過尖度を期待値と比べる(標本誤差の5倍まで)
+	std::size_t check_moments(const char* name, const std::vector<double>& x, double mean, double var, double skew, double kurt) {
+		iml::stats::moment_accumulator<double> acc;
+		acc.push(x.begin(), x.end());
+		const double n = double(x.size());
+		const double got[4] = { acc.mean(), acc.variance(), acc.skewness(), acc.kurtosis() };
+		const double expected[4] = { mean, var, skew, kurt };
+		//正規分布の標本誤差を目安とし, 裾の重い分布のために高次ほど余裕をもたせる
+		const double se[4] = { std::sqrt(var / n), var * std::sqrt(2 / n), std::sqrt(6 / n), std::sqrt(24 / n) };
+		const double scale[4] = { 5, 5 * std::sqrt(1 + kurt / 2), 5 * (1 + std::fabs(skew) + kurt / 2), 5 * (1 + std::fabs(skew) + kurt) };
+		const char* label[4] = { "mean", "variance", "skewness", "kurtosis" };
+		std::size_t failed = 0;
+		for (std::size_t k = 0; k < 4; ++k) {
+			if (std::fabs(got[k] - expected[k]) <= scale[k] * se[k]) continue;
+			std::cout << name << ": " << label[k] << " is " << got[k] << ", expected " << expected[k] << '\n';
+			++failed;
+		}
+		return failed;
+	}
+
+	//x > aの頻度が確率pの二項分布として5σ以内か(底の層の裾の生成を確かめる)
+	std::size_t check_tail(const char* name, const std::vector<double>& x, double a, double p) {
+		double count = 0;
+		for (double v : x) count += (v > a) ? 1 : 0;
+		const double n = double(x.size()), z = (count - n * p) / std::sqrt(n * p * (1 - p));
+		if (std::fabs(z) < 5) return 0;
+		std::cout << name << ": " << count << " samples above " << a << ", expected " << n * p << '\n';
+		return 1;
+	}
+
+	double normal_cdf(double x) { return std::erfc(-x / std::sqrt(2.)) / 2; }
+	double normal_sf(double x) { return std::erfc(x / std::sqrt(2.)) / 2; }
+}
+
+
+int main() {
+	using namespace iml;
+	using normal = stats::Ziggurat_normal_density;
+	using exponential = stats::Ziggurat_exponential_density;
+	std::size_t failed = 0;
+
+	failed += check_table<normal>("normal table");
+	failed += check_table<exponential>("exponential table");
+
+	const std::size_t n = std::size_t(1) << 22;
+	rnd::Xoshiro256_starstar<4> g(7);
+	rnd::mersenne_twister_19937_32 h(7);
+	std::vector<double> x(n);
+
+	//正規分布(1個ずつと一括生成, 32ビットのエンジンはbits64で2回の出力を連結する)
+	{
+		stats::stats::normal_distribution<double> d;
+		for (double& v : x) v = d(&g);
+		failed += check_ks("normal", x, normal_cdf);
+		failed += check_moments("normal", x, 0, 1, 0, 0);
+		std::vector<double> y(x.size());
+		for (std::size_t i = 0; i < n; ++i) y[i] = std::fabs(x[i]);
+		failed += check_tail("|normal|", y, normal::r, 2 * normal_sf(normal::r));
+		failed += check_tail("|normal|", y, 4.5, 2 * normal_sf(4.5));
+		failed += check_tail("normal", x, 2, normal_sf(2));
+		d.fill(&h, x.begin(), x.end());
+		failed += check_ks("normal fill", x, normal_cdf);
+		failed += check_moments("normal fill", x, 0, 1, 0, 0);
+		stats::stats::normal_distribution<double> e(2, -3);
+		e.fill(&g, x.begin(), x.end());
+		failed += check_ks("normal(-3, 2^2) fill", x, [](double v) { return normal_cdf((v + 3) / 2); });
+	}
+	//半正規分布
+	{
+		stats::stats::half_normal_distribution<double> d;
+		for (double& v : x) v = d(&g);
+		const double pi = 3.14159265358979323846, m = std::sqrt(2 / pi), var = 1 - 2 / pi;
+		failed += check_ks("half normal", x, [](double v) { return 2 * normal_cdf(v) - 1; });
+		failed += check_moments("half normal", x, m, var, m * (4 / pi - 1) / std::pow(var, 1.5), 8 * (pi - 3) / (pi - 2) / (pi - 2));
+		failed += check_tail("half normal", x, normal::r, 2 * normal_sf(normal::r));
+		d.fill(&h, x.begin(), x.end());
+		failed += check_ks("half normal fill", x, [](double v) { return 2 * normal_cdf(v) - 1; });
+	}
+	//指数分布
+	{
+		stats::stats::exponential_distribution<double> d;
+		for (double& v : x) v = d(&g);
+		failed += check_ks("exponential", x, [](double v) { return -std::expm1(-v); });
+		failed += check_moments("exponential", x, 1, 1, 2, 6);
+		failed += check_tail("exponential", x, exponential::r, std::exp(-exponential::r));
+		failed += check_tail("exponential", x, 10, std::exp(-10.));
+		stats::stats::exponential_distribution<double> e(4);
+		e.fill(&h, x.begin(), x.end());
+		failed += check_ks("exponential(4) fill", x, [](double v) { return -std::expm1(-4 * v); });
+	}
+	//floatへの一括生成
+	{
+		std::vector<float> y(1 << 16);
+		stats::stats::normal_distribution<float> d;
+		d.fill(&g, y.begin(), y.end());
+		failed += check_ks("normal float fill", std::vector<double>(y.begin(), y.end()), normal_cdf);
+	}
+
+	std::cout << ((failed == 0) ? "passed" : "failed") << '\n';
+	return (failed == 0) ? 0 : 1;
+}
\ No newline at end of file